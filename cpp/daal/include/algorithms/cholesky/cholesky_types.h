@@ -59,7 +59,7 @@ enum Method
  */
 enum InputId
 {
-    data, /*!< %Input data table */
+    data, /*!< %Input data table: a p x p matrix or the stack of nMatrices p x p matrices in the table of nMatrices * p rows */
     lastInputId = data
 };
 
@@ -69,7 +69,8 @@ enum InputId
  */
 enum ResultId
 {
-    choleskyFactor, /*!< Table to store the result. Contains the lower triangle matrix L of the decomposition */
+    choleskyFactor, /*!< Table to store the result. Contains the lower triangle matrix L of the decomposition,
+                         or the stack of the factors of the matrices stacked in the input table */
     lastResultId = choleskyFactor
 };
 
@@ -0,0 +1,224 @@
+/* file: concurrent_online.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the concurrent ingestion of the data blocks into the
+//  partial results of an algorithm in the online processing mode.
+//--
+*/
+
+#ifndef __CONCURRENT_ONLINE_H__
+#define __CONCURRENT_ONLINE_H__
+
+#include "services/base.h"
+#include "services/collection.h"
+#include "services/daal_shared_ptr.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * @ingroup base_algorithms
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-ALGORITHMS__CONCURRENTONLINEBASE"></a>
+ *  \brief %Base class of ConcurrentOnline that holds the lock of its pool of the algorithms
+ */
+class DAAL_EXPORT ConcurrentOnlineBase : public Base
+{
+public:
+    ConcurrentOnlineBase();
+    virtual ~ConcurrentOnlineBase();
+
+protected:
+    void lock();
+    void unlock();
+
+    /** Holds the lock of the pool in its scope */
+    class ScopedLock
+    {
+    public:
+        ScopedLock(ConcurrentOnlineBase & owner) : _owner(owner) { _owner.lock(); }
+        ~ScopedLock() { _owner.unlock(); }
+
+    private:
+        ConcurrentOnlineBase & _owner;
+    };
+
+private:
+    ConcurrentOnlineBase(const ConcurrentOnlineBase &);
+    ConcurrentOnlineBase & operator=(const ConcurrentOnlineBase &);
+
+    void * _impl;
+};
+
+/**
+ *  <a name="DAAL-CLASS-ALGORITHMS__CONCURRENTONLINE"></a>
+ *  \brief Computes the partial results of the algorithm in the online processing mode from the data blocks
+ *         submitted by several threads concurrently.
+ *
+ *  compute() takes an idle copy of the prototype algorithm from the pool, or clones a new one if all of them are
+ *  busy, sets its input and updates its partial result without any lock held. So the pool has the algorithm for
+ *  each concurrent producer, and finalizeCompute() merges their partial results by the step 2 of the algorithm
+ *  in the distributed processing mode, e.g.
+ *
+ *      covariance::Online<> prototype;
+ *      ConcurrentOnline<covariance::Online<> > ingestion(prototype);
+ *
+ *      // On each of the producer threads
+ *      ingestion.compute([&](covariance::Online<> & algorithm) { algorithm.input.set(covariance::data, block); });
+ *
+ *      covariance::Distributed<step2Master> master;
+ *      ingestion.finalizeCompute(master, covariance::partialResults);
+ *      covariance::ResultPtr result = master.getResult();
+ *
+ *  The partial results of the algorithms grow over all the blocks computed so far, so the final results can be
+ *  computed again by another master object. finalizeCompute() must not be called concurrently with compute().
+ *
+ * \tparam OnlineType  Algorithm in the online processing mode, e.g. covariance::Online, low_order_moments::Online,
+ *                     linear_regression::training::Online, multinomial_naive_bayes::training::Online or pca::Online
+ */
+template <typename OnlineType>
+class ConcurrentOnline : public ConcurrentOnlineBase
+{
+public:
+    typedef services::SharedPtr<OnlineType> OnlineTypePtr;
+
+    /**
+     * Constructs the concurrent ingestion into the copies of the algorithm
+     * \param[in] prototype  The algorithm with the parameters of the computations
+     */
+    explicit ConcurrentOnline(const OnlineType & prototype) : _prototype(prototype.clone()) {}
+
+    virtual ~ConcurrentOnline() {}
+
+    /**
+     * Updates a partial result by the data block, can be called from any thread
+     * \param[in] setInput  Function called with the algorithm, OnlineType &, that sets the input of the block
+     * \return Status of the computations
+     */
+    template <typename SetInput>
+    services::Status compute(const SetInput & setInput)
+    {
+        size_t index            = 0;
+        OnlineTypePtr algorithm = acquire(index);
+        if (!algorithm)
+        {
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        setInput(*algorithm);
+        const services::Status status = algorithm->compute();
+        release(index, status.ok());
+        return status;
+    }
+
+    /**
+     * Merges the partial results by the algorithm in the step 2 of the distributed processing mode and computes
+     * the final results
+     * \param[in] master            Algorithm on the master node, with the parameters of the computations and
+     *                              the empty collection of the partial results
+     * \param[in] partialResultsId  Identifier of the input collection of the partial results of the master
+     * \return Status of the computations
+     */
+    template <typename MasterType, typename MasterInputIdType>
+    services::Status finalizeCompute(MasterType & master, MasterInputIdType partialResultsId)
+    {
+        {
+            ScopedLock lock(*this);
+            for (size_t i = 0; i < _algorithms.size(); i++)
+            {
+                if (_isComputed[i])
+                {
+                    master.input.add(partialResultsId, _algorithms[i]->getPartialResult());
+                }
+            }
+        }
+
+        services::Status status;
+        DAAL_CHECK_STATUS(status, master.compute());
+        return master.finalizeCompute();
+    }
+
+    /**
+     * \return The number of the partial results, which is the largest number of the concurrent compute() calls
+     */
+    size_t getPartialResultCount()
+    {
+        ScopedLock lock(*this);
+        size_t count = 0;
+        for (size_t i = 0; i < _isComputed.size(); i++)
+        {
+            count += _isComputed[i] ? 1 : 0;
+        }
+        return count;
+    }
+
+private:
+    OnlineTypePtr acquire(size_t & index)
+    {
+        ScopedLock lock(*this);
+        if (_idle.size())
+        {
+            index = _idle[_idle.size() - 1];
+            _idle.erase(_idle.size() - 1);
+            return _algorithms[index];
+        }
+
+        OnlineTypePtr algorithm = _prototype->clone();
+        if (!algorithm || !_algorithms.safe_push_back(algorithm))
+        {
+            return OnlineTypePtr();
+        }
+        if (!_isComputed.safe_push_back(false))
+        {
+            _algorithms.erase(_algorithms.size() - 1);
+            return OnlineTypePtr();
+        }
+        index = _algorithms.size() - 1;
+        return algorithm;
+    }
+
+    void release(size_t index, bool isComputed)
+    {
+        ScopedLock lock(*this);
+        _isComputed[index] = _isComputed[index] || isComputed;
+        _idle.push_back(index);
+    }
+
+    OnlineTypePtr _prototype;
+    services::Collection<OnlineTypePtr> _algorithms;
+    services::Collection<bool> _isComputed;
+    services::Collection<size_t> _idle;
+};
+/** @} */
+} // namespace interface1
+using interface1::ConcurrentOnlineBase;
+using interface1::ConcurrentOnline;
+
+} // namespace algorithms
+} // namespace daal
+#endif
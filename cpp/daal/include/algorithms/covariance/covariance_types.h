@@ -260,6 +260,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     /** Default constructor */
     Parameter();
     OutputMatrixType outputMatrixType; /*!< Type of the computed matrix */
+    bool packedSymmetricOutput;        /*!< If true, the cross-product and the computed matrix are stored in the lower packed
+                                            symmetric layout, which halves their memory and the size of the partial results */
 };
 
 /**
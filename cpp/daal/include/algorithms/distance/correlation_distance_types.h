@@ -51,7 +51,9 @@ namespace correlation_distance
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method. */
+    defaultDense = 0, /*!< Default: performance-oriented method. */
+    topKDense    = 1  /*!< Top-k: the k smallest distances of every row to the other rows within the maximal distance,
+                           float values in the CSR layout */
 };
 
 /**
@@ -78,6 +80,25 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__CORRELATION_DISTANCE__PARAMETER"></a>
+ * \brief Parameters of the correlation distance algorithm
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     * Constructs the parameters of the correlation distance algorithm
+     * \param[in] k            Number of the nearest rows kept for every row in the topKDense method
+     * \param[in] maxDistance  Largest distance kept in the topKDense method
+     */
+    Parameter(size_t k = 10, double maxDistance = 2.0);
+
+    size_t k;           /*!< Number of the nearest rows kept for every row in the topKDense method */
+    double maxDistance; /*!< Largest distance kept in the topKDense method */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__CORRELATION_DISTANCE__INPUT"></a>
  * \brief %Input objects for the correlation distance algorithm
@@ -168,6 +189,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
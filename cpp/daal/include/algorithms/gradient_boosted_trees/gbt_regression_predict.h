@@ -163,10 +163,69 @@ protected:
 private:
     Batch & operator=(const Batch &);
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__PREDICTION__PREPAREDPREDICTOR"></a>
+ * \brief Gradient boosted trees prediction prepared for one model
+ *
+ * The model and the parameter are checked and the trees of the model are collected once by create(), then predict()
+ * computes the predictions of the rows of the caller without the input, result and parameter objects of Batch.
+ * predict() is thread-safe: many threads can compute the predictions by one prepared predictor concurrently.
+ * The features of the rows are continuous, the models with categorical features are used by Batch.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for model-based prediction, double or float
+ * \tparam method           Computation method, \ref Method
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT PreparedPredictor
+{
+public:
+    typedef algorithms::gbt::regression::prediction::Parameter ParameterType;
+    typedef services::SharedPtr<PreparedPredictor<algorithmFPType, method> > PreparedPredictorPtr;
+
+    /**
+     * Prepares the prediction of the model
+     * \param[in]  model      Gradient boosted trees model obtained on the training stage
+     * \param[in]  parameter  Parameter of the prediction
+     * \param[out] stat       Status of the preparation
+     * \return Prepared predictor, empty if the model or the parameter is not valid
+     */
+    static PreparedPredictorPtr create(const gbt::regression::ModelPtr & model, const ParameterType & parameter = ParameterType(),
+                                       services::Status * stat = NULL);
+
+    /** Destructor */
+    ~PreparedPredictor();
+
+    /**
+     * Returns the number of the features of the rows
+     * \return Number of the features of the rows
+     */
+    size_t getNumberOfFeatures() const { return _model->getNumberOfFeatures(); }
+
+    /**
+     * Computes the predictions of the rows, thread-safe
+     * \param[in]  x      Array of nRows rows of getNumberOfFeatures() values each
+     * \param[in]  nRows  Number of the rows
+     * \param[out] y      Array of nRows predictions
+     * \return Status of computations
+     */
+    services::Status predict(const algorithmFPType * x, size_t nRows, algorithmFPType * y) const;
+
+private:
+    PreparedPredictor(const gbt::regression::ModelPtr & model, const ParameterType & parameter, services::Status & st);
+    PreparedPredictor(const PreparedPredictor &);
+    PreparedPredictor & operator=(const PreparedPredictor &);
+
+    gbt::regression::ModelPtr _model;
+    ParameterType _parameter;
+    daal::services::Environment::env _env;
+    AlgorithmContainerImpl<batch> * _ac;
+};
 /** @} */
 } // namespace interface1
 using interface1::BatchContainer;
 using interface1::Batch;
+using interface1::PreparedPredictor;
 
 } // namespace prediction
 } // namespace regression
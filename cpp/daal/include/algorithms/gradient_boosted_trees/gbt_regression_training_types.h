@@ -83,7 +83,9 @@ enum InputId
 {
     data              = algorithms::regression::training::data,               /*!< %Input data table */
     dependentVariable = algorithms::regression::training::dependentVariables, /*!< %Values of the dependent variable for the input data */
-    lastInputId       = dependentVariable
+    validationData,                                                           /*!< Optional. Validation data set for the early stopping */
+    validationDependentVariable,                                              /*!< Optional. Values of the dependent variable for the validation data */
+    lastInputId = validationDependentVariable
 };
 
 /**
@@ -119,6 +119,16 @@ public:
                                                  Default is 256. Increasing the number results in higher computation costs */
     size_t minBinSize;                  /*!< Used with 'inexact' split finding method only.
                                                  Minimal number of observations in a bin. Default is 5 */
+    size_t maxLeafNodes;                /*!< Maximal number of leaf nodes in a tree. If positive then the tree is grown leaf-wise,
+                                                 the leaf with the largest loss reduction is split first.
+                                                 Default is 0 (unlimited, the tree is grown level by level) */
+    size_t nIterationsNoImprovement;    /*!< Used with the validation data set only. Number of iterations without the improvement
+                                                 of the loss on the validation data set after which the training stops.
+                                                 Default is 0 (no early stopping) */
+    size_t gradientQuantizationBits;    /*!< Number of bits of the quantized gradients and hessians: 0, 8 or 16. If positive then
+                                                 the gradients and hessians are stochastically rounded to the integers of this size
+                                                 on every iteration and the histograms of the 'inexact' method are accumulated
+                                                 as the integer sums. Default is 0 (no quantization) */
     int internalOptions;                /*!< Internal options */
 };
 /* [Parameter source code] */
@@ -65,14 +65,21 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      * \param[in] preferenceThreshold Threshold used to define preference values
      */
     Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01, double preferenceThreshold = 0.0)
-        : nFactors(nFactors), maxIterations(maxIterations), alpha(alpha), lambda(lambda), preferenceThreshold(preferenceThreshold)
+        : nFactors(nFactors),
+          maxIterations(maxIterations),
+          alpha(alpha),
+          lambda(lambda),
+          preferenceThreshold(preferenceThreshold),
+          nConjugateGradientIterations(0)
     {}
 
-    size_t nFactors;            /*!< Number of factors */
-    size_t maxIterations;       /*!< Maximum number of iterations of the implicit ALS training algorithm */
-    double alpha;               /*!< Confidence parameter of the implicit ALS training algorithm */
-    double lambda;              /*!< Regularization parameter */
-    double preferenceThreshold; /*!< Threshold used to define preference values */
+    size_t nFactors;                     /*!< Number of factors */
+    size_t maxIterations;                /*!< Maximum number of iterations of the implicit ALS training algorithm */
+    double alpha;                        /*!< Confidence parameter of the implicit ALS training algorithm */
+    double lambda;                       /*!< Regularization parameter */
+    double preferenceThreshold;          /*!< Threshold used to define preference values */
+    size_t nConjugateGradientIterations; /*!< Number of the conjugate gradient iterations used to solve the system of every row,
+                                              0 means the systems are solved by the Cholesky decomposition */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
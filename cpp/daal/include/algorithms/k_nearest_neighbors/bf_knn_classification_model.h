@@ -72,6 +72,18 @@ enum VoteWeights
                            than neighbors that are further away */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BF_KNN_CLASSIFICATION__DISTANCEPRECISION"></a>
+ * \brief Precision of the distance computations
+ */
+enum DistancePrecision
+{
+    fullPrecision    = 0, /*!< The distances are computed in the precision of the data */
+    reducedPrecision = 1  /*!< The candidate neighbors of the data in double precision are chosen by the distances in single precision
+                               and re-ranked in double precision. The queries whose neighbors are not proven by the bound of the
+                               rounding error are recomputed in double precision, so the neighbors do not change */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -102,6 +114,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
           dataUseInModel(dataUse),
           resultsToCompute(resToCompute),
           voteWeights(vote),
+          distancePrecision(fullPrecision),
           engine(engines::mcg59::Batch<>::create())
     {
         this->resultsToEvaluate = resToEvaluate;
@@ -117,6 +130,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
           dataUseInModel(other.dataUseInModel),
           resultsToCompute(other.resultsToCompute),
           voteWeights(other.voteWeights),
+          distancePrecision(other.distancePrecision),
           engine(other.engine->clone())
     {
         this->resultsToEvaluate = other.resultsToEvaluate;
@@ -135,6 +149,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
             dataUseInModel                                   = other.dataUseInModel;
             engine                                           = other.engine->clone();
             voteWeights                                      = other.voteWeights;
+            distancePrecision                                = other.distancePrecision;
             resultsToCompute                                 = other.resultsToCompute;
             this->resultsToEvaluate                          = other.resultsToEvaluate;
         }
@@ -146,11 +161,12 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
      */
     services::Status check() const DAAL_C11_OVERRIDE;
 
-    size_t k;                      /*!< Number of neighbors */
-    DataUseInModel dataUseInModel; /*!< The option to enable/disable an usage of the input dataset in kNN model */
-    DAAL_UINT64 resultsToCompute;  /*!< 64 bit integer flag that indicates the results to compute */
-    VoteWeights voteWeights;       /*!< Weight function used in prediction */
-    engines::EnginePtr engine;     /*!< Engine for random choosing elements from training dataset */
+    size_t k;                            /*!< Number of neighbors */
+    DataUseInModel dataUseInModel;       /*!< The option to enable/disable an usage of the input dataset in kNN model */
+    DAAL_UINT64 resultsToCompute;        /*!< 64 bit integer flag that indicates the results to compute */
+    VoteWeights voteWeights;             /*!< Weight function used in prediction */
+    DistancePrecision distancePrecision; /*!< Precision of the distance computations */
+    engines::EnginePtr engine;           /*!< Engine for random choosing elements from training dataset */
 };
 /* [Parameter source code] */
 
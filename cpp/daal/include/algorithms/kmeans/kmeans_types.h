@@ -50,7 +50,8 @@ enum Method
 {
     lloydDense   = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
     defaultDense = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR     = 1  /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydCSR     = 1, /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    hamerlyDense = 2  /*!< Lloyd algorithm for dense numeric tables accelerated with the triangle inequality bounds of Hamerly */
 };
 
 /**
@@ -63,6 +64,22 @@ enum DistanceType
     lastDistanceType = euclidean
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__DISTANCEPRECISION"></a>
+ * Precision of the distance computations
+ */
+enum DistancePrecision
+{
+    fullPrecision,    /*!< The distances are computed in the precision of the data */
+    reducedPrecision, /*!< The cross products of the observations and the centroids in double precision are computed in single
+                           precision. The observations whose two closest centroids are not separated by the bound of the rounding
+                           error are assigned in double precision, so the assignments do not change */
+    bfloat16Precision /*!< The cross products of the observations and the centroids are computed in bfloat16 by the tiles of
+                           Intel(R) Advanced Matrix Extensions or the Intel(R) AVX-512 BF16 dot products if the CPU has them,
+                           otherwise in the same way as reducedPrecision. The observations whose two closest centroids are not
+                           separated by the bound of the rounding error are assigned in the precision of the data */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__INPUTID"></a>
  * \brief Available identifiers of input objects for K-Means algorithm
@@ -395,13 +412,14 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      */
     Parameter(const Parameter & other);
 
-    size_t nClusters;                /*!< Number of clusters */
-    size_t maxIterations;            /*!< Number of iterations */
-    double accuracyThreshold;        /*!< Threshold for the termination of the algorithm */
-    double gamma;                    /*!< Weight used in distance computation for categorical features */
-    DistanceType distanceType;       /*!< Distance used in the algorithm */
-    DAAL_UINT64 resultsToEvaluate;   /*!< 64 bit integer flag that indicates the results to compute */
-    DAAL_DEPRECATED bool assignFlag; /*!< Do data points assignment \DAAL_DEPRECATED */
+    size_t nClusters;                    /*!< Number of clusters */
+    size_t maxIterations;                /*!< Number of iterations */
+    double accuracyThreshold;            /*!< Threshold for the termination of the algorithm */
+    double gamma;                        /*!< Weight used in distance computation for categorical features */
+    DistanceType distanceType;           /*!< Distance used in the algorithm */
+    DistancePrecision distancePrecision; /*!< Precision of the distance computations in the Lloyd dense method */
+    DAAL_UINT64 resultsToEvaluate;       /*!< 64 bit integer flag that indicates the results to compute */
+    DAAL_DEPRECATED bool assignFlag;     /*!< Do data points assignment \DAAL_DEPRECATED */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
@@ -65,9 +65,11 @@ enum Method
  */
 enum EstimatesToCompute
 {
-    estimatesAll,         /*!< Default: Compute all supported moments */
-    estimatesMinMax,      /*!< MinMAx: Compute minimum and maximum  */
-    estimatesMeanVariance /*!< MeanVariance: Compute mean and variance  */
+    estimatesAll,               /*!< Default: Compute all supported moments */
+    estimatesMinMax,            /*!< MinMAx: Compute minimum and maximum  */
+    estimatesMeanVariance,      /*!< MeanVariance: Compute mean and variance  */
+    estimatesMean,              /*!< Mean: Compute mean  */
+    estimatesMinMaxMeanVariance /*!< MinMaxMeanVariance: Compute minimum, maximum, mean and variance  */
 };
 
 /**
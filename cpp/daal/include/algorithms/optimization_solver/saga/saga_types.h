@@ -272,6 +272,11 @@ struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Par
                                                                    in the objective function. \DAAL_DEPRECATED_USE{ engine } */
     engines::EnginePtr engine;                             /*!< Engine for random generation of 32 bit integer indices of terms
                                                                    in the objective function. */
+    bool asynchronous;                                     /*!< Flag. If true, the threads process the terms of their own parts
+                                                                   of the objective function and update the argument concurrently
+                                                                   without locks (Hogwild). The result is not reproducible
+                                                                   from run to run. The flag is ignored when the batch indices
+                                                                   are provided */
 };
 /* [Parameter source code] */
 
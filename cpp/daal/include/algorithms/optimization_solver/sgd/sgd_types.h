@@ -448,6 +448,11 @@ struct DAAL_EXPORT Parameter<defaultDense> : public BaseParameter
     virtual services::Status check() const;
 
     virtual ~Parameter() {}
+
+    bool asynchronous; /*!< Flag. If true, the threads process their own parts of the sequence of the batch indices
+                            and update the argument concurrently without locks (Hogwild). The result is not reproducible
+                            from run to run. The flag is applied when the batch indices are known in advance, that is,
+                            they are provided or the optional result is not required */
 };
 /* [ParameterDefaultDense source code] */
 
@@ -67,7 +67,21 @@ enum InitializationMethod
  */
 enum InputId
 {
-    data = 0 /*!< %Input data table */
+    data        = 0, /*!< %Input data table */
+    lastInputId = data
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__OPTIONALINPUTID"></a>
+ * Available identifiers of optional input objects for the BACON outlier detection algorithm
+ */
+enum OptionalInputId
+{
+    initialBasicSubsetMean       = lastInputId + 1, /*!< Numeric table of size 1 x p with the mean of the basic subset,
+                                                         can be the result of the previous window of the data stream */
+    initialBasicSubsetCovariance = lastInputId + 2, /*!< Numeric table of size p x p with the covariance of the basic subset,
+                                                         can be the result of the previous window of the data stream */
+    lastOptionalInputId          = initialBasicSubsetCovariance
 };
 
 /**
@@ -76,7 +90,21 @@ enum InputId
  */
 enum ResultId
 {
-    weights = 0 /*!< Outlier detection results */
+    weights      = 0, /*!< Outlier detection results */
+    lastResultId = weights
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__OPTIONALRESULTID"></a>
+ * Available identifiers of optional results of the BACON outlier detection algorithm
+ */
+enum OptionalResultId
+{
+    basicSubsetMean       = lastResultId + 1, /*!< Numeric table of size 1 x p with the mean of the final basic subset,
+                                                   computed if required by parameter flag optionalResultRequired */
+    basicSubsetCovariance = lastResultId + 2, /*!< Numeric table of size p x p with the covariance of the final basic subset,
+                                                   computed if required by parameter flag optionalResultRequired */
+    lastOptionalResultId  = basicSubsetCovariance
 };
 
 /**
@@ -93,7 +121,8 @@ namespace interface1
 /* [ParameterBacon source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
-    Parameter(InitializationMethod initMethod = baconMedian, double alpha = 0.05, double toleranceToConverge = 0.005);
+    Parameter(InitializationMethod initMethod = baconMedian, double alpha = 0.05, double toleranceToConverge = 0.005,
+              bool optionalResultRequired = false);
 
     InitializationMethod initMethod; /*!< Initialization method, \ref InitializationMethod */
     double alpha;                    /*!< One-tailed probability that defines the \f$(1 - \alpha)\f$ quantile
@@ -101,6 +130,9 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
                                                  Recommended value: \f$\alpha / n\f$, where n is the number of observations. */
     double toleranceToConverge;      /*!< Stopping criterion: the algorithm is terminated if the size of the basic subset
                                                  is changed by less than the threshold */
+    bool optionalResultRequired;     /*!< Indicates whether the statistics of the final basic subset are computed.
+                                                 Passed as the optional input of the next window of the data stream, they replace
+                                                 the initialization method, so the stable windows converge in a few iterations */
     virtual services::Status check() const DAAL_C11_OVERRIDE;
 };
 /* [ParameterBacon source code] */
@@ -131,6 +163,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr & ptr);
 
+    /**
+     * Returns optional input object for the BACON outlier detection algorithm
+     * \param[in] id    Identifier of the optional %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalInputId id) const;
+
+    /**
+     * Sets optional input object for the BACON outlier detection algorithm
+     * \param[in] id    Identifier of the optional %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(OptionalInputId id, const data_management::NumericTablePtr & ptr);
+
     /**
      * Checks input object for the BACON outlier detection algorithm
      * \param[in] par     Algorithm parameters
@@ -179,6 +225,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr & ptr);
 
+    /**
+     * Returns optional result of the BACON outlier detection algorithm
+     * \param[in] id   Identifier of the optional result
+     * \return         Optional result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalResultId id) const;
+
+    /**
+     * Sets optional result of the BACON outlier detection algorithm
+     * \param[in] id    Identifier of the optional result
+     * \param[in] ptr   Pointer to the optional result
+     */
+    void set(OptionalResultId id, const data_management::NumericTablePtr & ptr);
+
     /**
      * Checks the result object of the BACON outlier detection algorithm
      * \param[in] input   Pointer to %Input objects of the algorithm
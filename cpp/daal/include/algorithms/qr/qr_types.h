@@ -642,8 +642,13 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
     /**
      *  Default constructor
+     *  \param[in] _nMatrices  Number of the matrices stacked in the input data table
      */
-    Parameter() {}
+    Parameter(size_t _nMatrices = 1) : nMatrices(_nMatrices) {}
+
+    size_t nMatrices; /*!< Number of the matrices stacked in the input data table in the batch processing mode. The table of nMatrices * m
+                           rows holds nMatrices m x n matrices, which are decomposed independently, matrixQ and matrixR are the stacks
+                           of their Q and R factors */
 };
 /** @} */
 /** @} */
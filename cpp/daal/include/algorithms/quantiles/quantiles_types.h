@@ -24,7 +24,9 @@
 #ifndef __QUANTILES_TYPES_H__
 #define __QUANTILES_TYPES_H__
 
+#include "algorithms/algorithm.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
 
 namespace daal
 {
@@ -47,7 +49,9 @@ namespace quantiles
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    defaultDense = 0, /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    kllSketch    = 1  /*!< Approximate quantiles with the mergeable KLL sketch in a single pass over the data.
+                           Works in the batch, online and distributed processing modes */
 };
 
 /**
@@ -70,6 +74,28 @@ enum ResultId
     lastResultId = quantiles
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the quantiles algorithm in the online and distributed processing modes.
+ * The i-th rows of the tables hold the sketch of the i-th feature, the empty items have the zero weights
+ */
+enum PartialResultId
+{
+    sketchValues,  /*!< Values of the items of the sketches */
+    sketchWeights, /*!< Weights of the items of the sketches */
+    lastPartialResultId = sketchWeights
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__MASTERINPUTID"></a>
+ * Available identifiers of input objects for the quantiles algorithm on the master node in the distributed processing mode
+ */
+enum MasterInputId
+{
+    partialResults, /*!< Collection of partial results computed on local nodes */
+    lastMasterInputId = partialResults
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -81,15 +107,36 @@ namespace interface1
  */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
-    Parameter(const data_management::NumericTablePtr quantileOrders = data_management::NumericTablePtr());
+    Parameter(const data_management::NumericTablePtr quantileOrders = data_management::NumericTablePtr(), size_t sketchSize = 200);
     data_management::NumericTablePtr quantileOrders; /*!< Numeric table with quantile orders. Default value is 0.5 (median) */
+    size_t sketchSize; /*!< Size of the largest compactor of the KLL sketch used by the kllSketch method. The sketch keeps about
+                            3 * sketchSize items per feature, the rank error is about 1.7 / sketchSize */
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUTIFACE"></a>
+ * \brief Abstract class that specifies the interface of the input objects for the quantiles algorithm
+ */
+class DAAL_EXPORT InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+    InputIface(const InputIface & other) : daal::algorithms::Input(other) {}
+    virtual ~InputIface() {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \param[out] nFeatures Number of features
+     * \return Status of the call
+     */
+    virtual services::Status getNumberOfFeatures(size_t & nFeatures) const = 0;
 };
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUT"></a>
  * \brief %Input objects for the quantiles algorithm
  */
-class DAAL_EXPORT Input : public daal::algorithms::Input
+class DAAL_EXPORT Input : public InputIface
 {
 public:
     Input();
@@ -97,6 +144,13 @@ public:
 
     virtual ~Input() {}
 
+    /**
+     * Returns the number of features in the input data set
+     * \param[out] nFeatures Number of features
+     * \return Status of the call
+     */
+    services::Status getNumberOfFeatures(size_t & nFeatures) const DAAL_C11_OVERRIDE;
+
     /**
      * Returns an input object for the quantiles algorithm
      * \param[in] id    Identifier of the %input object
@@ -119,6 +173,80 @@ public:
     virtual services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__PARTIALRESULT"></a>
+ * \brief Provides methods to access the sketches obtained with the compute() method of the quantiles algorithm
+ *        in the online or distributed processing mode
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult)
+    PartialResult();
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of the quantiles algorithm
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Initializes the partial results of the quantiles algorithm with the empty sketches
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     * \return Status of initialization
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Returns the partial result of the quantiles algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the quantiles algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr & ptr);
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter * parameter) const;
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the
@@ -141,6 +269,16 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
 
+    /**
+     * Allocates memory to store final results of the quantile algorithms in the online and distributed processing modes
+     * \param[in] partialResult Partial results of the quantiles algorithm
+     * \param[in] parameter     Parameters of the quantiles algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                          const int method);
+
     /**
      * Returns the final result of the quantiles algorithm
      * \param[in] id   Identifier of the final result, \ref ResultId
@@ -163,8 +301,17 @@ public:
      */
     virtual services::Status check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+     * Checks the correctness of the Result object in the online and distributed processing modes
+     * \param[in] pres   Pointer to the partial results
+     * \param[in] par    Pointer to the parameters structure
+     * \param[in] method Algorithm computation method
+     */
+    virtual services::Status check(const daal::algorithms::PartialResult * pres, const daal::algorithms::Parameter * par,
+                                   int method) const DAAL_C11_OVERRIDE;
+
 protected:
-    using daal::algorithms::interface1::Result::check;
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter * par) const;
 
     /** \private */
     template <typename Archive, bool onDeserialize>
@@ -175,12 +322,67 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for the quantiles algorithm in the distributed processing mode on the master node
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template <ComputeStep step>
+class DAAL_EXPORT DistributedInput : public InputIface
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput & other);
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns the number of features in the partial results
+     * \param[out] nFeatures Number of features
+     * \return Status of the call
+     */
+    services::Status getNumberOfFeatures(size_t & nFeatures) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Adds the partial result to the collection of input objects of the quantiles algorithm in the distributed processing mode
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+     */
+    void add(MasterInputId id, const PartialResultPtr & partialResult);
+
+    /**
+     * Sets the input object of the quantiles algorithm in the distributed processing mode
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the input object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr & ptr);
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id   Identifier of the input object, \ref MasterInputId
+     * \return Collection of distributed input objects
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Checks the input objects on the master node
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
+using interface1::InputIface;
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::DistributedInput;
 
 } // namespace quantiles
 } // namespace algorithms
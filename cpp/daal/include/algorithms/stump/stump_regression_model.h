@@ -83,7 +83,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     /**
      *  Main constructor
      */
-    Parameter() : daal::algorithms::Parameter(), varImportance(none) {}
+    Parameter() : daal::algorithms::Parameter(), varImportance(none), maxBins(0), minBinSize(5) {}
 
     /**
      * Checks a parameter of the Decision tree algorithm
@@ -92,6 +92,10 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 
     VariableImportanceMode varImportance; /*!< Variable importance mode.
                                                Variable importance computation is not supported for current version of the library */
+    size_t maxBins;                       /*!< Maximal number of the bins of the values of a feature. If it is non-zero, the values are
+                                               binned once and the split is searched in the weighted histograms of the bins,
+                                               otherwise the exact split is searched in the sorted values */
+    size_t minBinSize;                    /*!< Minimal number of the observations in a bin, used with non-zero maxBins only */
 };
 /* [Parameter source code] */
 
@@ -48,7 +48,8 @@ namespace svd
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense  = 0, /*!< Default method */
+    randomizedCSR = 1  /*!< Truncated SVD of the data in the CSR format with the randomized subspace iteration, in the batch processing mode only */
 };
 
 /**
@@ -167,13 +168,29 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      *  Default constructor
      *  \param[in] _leftSingularMatrix  Format of the matrix of left singular vectors
      *  \param[in] _rightSingularMatrix Format of the matrix of right singular vectors
-     */
-    Parameter(SVDResultFormat _leftSingularMatrix = requiredInPackedForm, SVDResultFormat _rightSingularMatrix = requiredInPackedForm)
-        : leftSingularMatrix(_leftSingularMatrix), rightSingularMatrix(_rightSingularMatrix)
+     *  \param[in] _nMatrices           Number of the matrices stacked in the input data table
+     */
+    Parameter(SVDResultFormat _leftSingularMatrix = requiredInPackedForm, SVDResultFormat _rightSingularMatrix = requiredInPackedForm,
+              size_t _nMatrices = 1)
+        : leftSingularMatrix(_leftSingularMatrix),
+          rightSingularMatrix(_rightSingularMatrix),
+          nMatrices(_nMatrices),
+          nComponents(1),
+          nOversamples(10),
+          nPowerIterations(4),
+          seed(777)
     {}
 
     SVDResultFormat leftSingularMatrix;  /*!< Format of the matrix of left singular vectors  >*/
     SVDResultFormat rightSingularMatrix; /*!< Format of the matrix of right singular vectors >*/
+    size_t nMatrices;                    /*!< Number of the matrices stacked in the input data table in the batch processing mode. The table
+                                              of nMatrices * m rows holds nMatrices m x n matrices, which are decomposed independently, the
+                                              results are the stacks of their results, the singular values of a matrix per row */
+    size_t nComponents;      /*!< Number of the largest singular triples computed by the randomizedCSR method. The results are the
+                                  1 x nComponents singular values, the n x nComponents left and the nComponents x p right singular matrices */
+    size_t nOversamples;     /*!< Number of the extra columns of the subspace of the randomizedCSR method */
+    size_t nPowerIterations; /*!< Number of the power iterations of the randomizedCSR method */
+    size_t seed;             /*!< Seed of the random test matrix of the randomizedCSR method */
 };
 
 /**
@@ -472,6 +489,17 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocateImpl(size_t m, size_t n);
 
+    /**
+     * Allocates memory to store the nComponents largest singular triples
+     * \tparam     algorithmFPType  Data type to use for storage in the resulting HomogenNumericTable
+     * \param[in]  m            Number of columns in the input data set
+     * \param[in]  n            Number of rows in the input data set
+     * \param[in]  nComponents  Number of the singular triples
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocateImpl(size_t m, size_t n, size_t nComponents);
+
 protected:
     /** \private */
     template <typename Archive, bool onDeserialize>
@@ -25,6 +25,7 @@
 #include "data_management/compression/bzip2compression.h"
 #include "data_management/compression/compression.h"
 #include "data_management/compression/compression_stream.h"
+#include "data_management/compression/lz4compression.h"
 #include "data_management/compression/lzocompression.h"
 #include "data_management/compression/rlecompression.h"
 #include "data_management/compression/zlibcompression.h"
@@ -38,6 +39,7 @@
 #include "data_management/data/csr_numeric_table.h"
 #include "data_management/data/data_archive.h"
 #include "data_management/data/memory_block.h"
+#include "data_management/data/numeric_table_packer.h"
 #include "services/collection.h"
 #include "data_management/data/data_block.h"
 #include "data_management/data/factory.h"
@@ -49,6 +51,7 @@
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/merged_numeric_table.h"
 #include "data_management/data/row_merged_numeric_table.h"
+#include "data_management/data/normalized_numeric_table.h"
 #include "data_management/data/matrix.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
@@ -186,6 +189,8 @@
 #include "algorithms/boosting/boosting_training_batch.h"
 #include "algorithms/quantiles/quantiles_types.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_distributed.h"
@@ -199,6 +204,7 @@
 #include "algorithms/algorithm.h"
 #include "algorithms/algorithm_base.h"
 #include "algorithms/algorithm_types.h"
+#include "algorithms/concurrent_online.h"
 #include "algorithms/analysis.h"
 #include "algorithms/model.h"
 #include "algorithms/prediction.h"
@@ -317,6 +323,8 @@
 #include "algorithms/engines/engine_family.h"
 #include "algorithms/engines/mt2203/mt2203.h"
 #include "algorithms/engines/mt2203/mt2203_types.h"
+#include "algorithms/engines/philox4x32x10/philox4x32x10.h"
+#include "algorithms/engines/philox4x32x10/philox4x32x10_types.h"
 #include "algorithms/dbscan/dbscan_types.h"
 #include "algorithms/dbscan/dbscan_batch.h"
 #include "algorithms/dbscan/dbscan_distributed.h"
@@ -63,10 +63,11 @@ enum CompressionLevel
  */
 enum CompressionMethod
 {
-    zlib, /*!< DEFLATE compression method with a ZLIB block header or a simple GZIP block header */
-    lzo,  /*!< LZO1X compatible compression method */
-    rle,  /*!< Run-Length Encoding method */
-    bzip2 /*!< BZIP2 compression method */
+    zlib,  /*!< DEFLATE compression method with a ZLIB block header or a simple GZIP block header */
+    lzo,   /*!< LZO1X compatible compression method */
+    rle,   /*!< Run-Length Encoding method */
+    bzip2, /*!< BZIP2 compression method */
+    lz4    /*!< LZ4 compression method */
 };
 
 /**
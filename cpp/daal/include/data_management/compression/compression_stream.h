@@ -196,9 +196,155 @@ private:
 
     services::SharedPtr<services::ErrorCollection> _errors;
 };
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__BLOCKCOMPRESSIONSTREAM"></a>
+ * \brief %BlockCompressionStream class compresses input data by independent blocks in parallel.
+ * Every block is compressed by its own compressor of the given method, so the blocks are decompressed
+ * independently by %BlockDecompressionStream. The compressed data starts with the block index:
+ * the 64-bit signature, the number of blocks, and the uncompressed and compressed sizes of every block
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref CompressionMethod enumeration
+ */
+class DAAL_EXPORT BlockCompressionStream : public Base
+{
+public:
+    /**
+     * \brief %BlockCompressionStream constructor
+     * \param method    %Compression method, \ref CompressionMethod
+     * \param level     %Compression level, \ref CompressionLevel
+     * \param blockSize Optional parameter, size of the independently compressed blocks
+     */
+    BlockCompressionStream(CompressionMethod method, CompressionLevel level = defaultLevel, size_t blockSize = 1024 * 1024);
+    virtual ~BlockCompressionStream() DAAL_C11_OVERRIDE;
+
+    /**
+     * Appends a data block to the uncompressed data of the stream
+     * \param[in] inBlock Pointer to the DataBlock with the input data
+     */
+    virtual void push_back(DataBlock * inBlock);
+    /**
+     * Appends a data block to the uncompressed data of the stream
+     * \param[in] inBlock Pointer to the DataBlock with the input data
+     */
+    virtual void operator<<(DataBlock * inBlock) { push_back(inBlock); }
+    /**
+     * Appends a data block to the uncompressed data of the stream
+     * \param[in] inBlock DataBlock with the input data
+     */
+    virtual void operator<<(DataBlock inBlock) { push_back(&inBlock); }
+
+    /**
+     * Compresses the appended data in parallel and returns the size of the compressed data with the block index
+     * \return Size of the compressed data in bytes
+     */
+    virtual size_t getCompressedDataSize();
+    /**
+     * Copies the compressed data with the block index to an external array
+     * \param[out] outPtr  Pointer to the array where the compressed data is stored
+     * \param[in]  outSize Size of the array in bytes
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(byte * outPtr, size_t outSize);
+    /**
+     * Copies the compressed data with the block index to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where compressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(DataBlock & outBlock) { return copyCompressedArray(outBlock.getPtr(), outBlock.getSize()); }
+
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    CompressionMethod _method;
+    CompressionLevel _level;
+    size_t _blockSize;
+
+    void * _rawData;
+    void * _blocks;
+    size_t _readPos;
+
+    void compressBlocks();
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__BLOCKDECOMPRESSIONSTREAM"></a>
+ * \brief %BlockDecompressionStream class decompresses the data compressed by %BlockCompressionStream,
+ * the blocks listed in the block index are decompressed in parallel
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref CompressionMethod enumeration
+ */
+class DAAL_EXPORT BlockDecompressionStream : public Base
+{
+public:
+    /**
+     * \brief %BlockDecompressionStream constructor
+     * \param method %Compression method the data was compressed with, \ref CompressionMethod
+     */
+    BlockDecompressionStream(CompressionMethod method);
+    virtual ~BlockDecompressionStream() DAAL_C11_OVERRIDE;
+
+    /**
+     * Appends a data block to the compressed data of the stream
+     * \param[in] inBlock Pointer to the DataBlock with the compressed data
+     */
+    virtual void push_back(DataBlock * inBlock);
+    /**
+     * Appends a data block to the compressed data of the stream
+     * \param[in] inBlock Pointer to the DataBlock with the compressed data
+     */
+    virtual void operator<<(DataBlock * inBlock) { push_back(inBlock); }
+    /**
+     * Appends a data block to the compressed data of the stream
+     * \param[in] inBlock DataBlock with the compressed data
+     */
+    virtual void operator<<(DataBlock inBlock) { push_back(&inBlock); }
+
+    /**
+     * Decompresses the appended complete block-compressed data in parallel and returns the size of the decompressed data
+     * \return Size of the decompressed data in bytes
+     */
+    virtual size_t getDecompressedDataSize();
+    /**
+     * Copies the decompressed data to an external array
+     * \param[out] outPtr  Pointer to the array where the decompressed data is stored
+     * \param[in]  outSize Size of the array in bytes
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(byte * outPtr, size_t outSize);
+    /**
+     * Copies the decompressed data to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where decompressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(DataBlock & outBlock) { return copyDecompressedArray(outBlock.getPtr(), outBlock.getSize()); }
+
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    CompressionMethod _method;
+
+    void * _compressedData;
+    void * _decompressedData;
+    size_t _readPos;
+
+    void decompressBlocks();
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
 } // namespace interface1
 using interface1::CompressionStream;
 using interface1::DecompressionStream;
+using interface1::BlockCompressionStream;
+using interface1::BlockDecompressionStream;
 /** @} */
 
 } //namespace data_management
@@ -157,8 +157,9 @@ public:
      */
     services::Status setArray(void * const ptr, size_t obsnum = 0)
     {
-        _ptr       = services::SharedPtr<byte>((byte *)ptr, services::EmptyDeleter());
-        _memStatus = userAllocated;
+        _ptr              = services::SharedPtr<byte>((byte *)ptr, services::EmptyDeleter());
+        _memStatus        = userAllocated;
+        _finitenessStatus = finitenessUnknown;
         return setNumberOfRowsImpl(obsnum);
     }
 
@@ -169,8 +170,9 @@ public:
      */
     services::Status setArray(const services::SharedPtr<byte> & ptr, size_t obsnum = 0)
     {
-        _ptr       = ptr;
-        _memStatus = userAllocated;
+        _ptr              = ptr;
+        _memStatus        = userAllocated;
+        _finitenessStatus = finitenessUnknown;
         return setNumberOfRowsImpl(obsnum);
     }
 
@@ -387,13 +389,18 @@ protected:
         }
         arch->set((char *)_offsets, getNumberOfColumns() * sizeof(size_t));
 
+        size_t size = getNumberOfRows();
+
         if (onDeserialize)
         {
+            if (arch->setInPlace(_ptr, size * _structSize))
+            {
+                _memStatus = userAllocated;
+                return services::Status();
+            }
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfRows();
-
         arch->set((char *)_ptr.get(), size * _structSize);
 
         return services::Status();
@@ -406,6 +413,7 @@ private:
         size_t ncols = getNumberOfColumns();
         size_t nobs  = getNumberOfRows();
         block.setDetails(0, idx, rwFlag);
+        resetFinitenessStatus(rwFlag);
 
         if (idx >= nobs)
         {
@@ -419,18 +427,31 @@ private:
 
         if (!(rwFlag & (int)readOnly)) return services::Status();
 
-        char * ptr = (char *)(_ptr.get()) + _structSize * idx;
+        char * ptr   = (char *)(_ptr.get()) + _structSize * idx;
+        T * blockPtr = block.getBlockPtr();
+
+        /* the consecutive fields of the same type are copied into the rows of the block by one transposition kernel */
+        const void * columns[internal::layoutConversionMaxColumns];
 
-        for (size_t j = 0; j < ncols; j++)
+        for (size_t i = 0; i < nrows; i += internal::layoutConversionBlockRows)
         {
-            NumericTableFeature & f = (*_ddict)[j];
+            const size_t di = (i + internal::layoutConversionBlockRows < nrows) ? internal::layoutConversionBlockRows : nrows - i;
 
-            char * location = ptr + _offsets[j];
+            for (size_t j = 0; j < ncols;)
+            {
+                NumericTableFeature & f = (*_ddict)[j];
 
-            T * blockPtr = block.getBlockPtr();
+                size_t nRunCols = 0;
+                while (j + nRunCols < ncols && nRunCols < internal::layoutConversionMaxColumns && (*_ddict)[j + nRunCols].indexType == f.indexType)
+                {
+                    columns[nRunCols] = ptr + i * _structSize + _offsets[j + nRunCols];
+                    ++nRunCols;
+                }
 
-            internal::getVectorStrideUpCast(f.indexType, internal::getConversionDataType<T>())(nrows, location, _structSize, blockPtr + j,
-                                                                                               sizeof(T) * ncols);
+                internal::getVectorColumnsToRowsUpCast(f.indexType, internal::getConversionDataType<T>())(di, nRunCols, columns, _structSize,
+                                                                                                        blockPtr + i * ncols + j, ncols);
+                j += nRunCols;
+            }
         }
         return services::Status();
     }
@@ -441,19 +462,34 @@ private:
         if (block.getRWFlag() & (int)writeOnly)
         {
             size_t ncols = getNumberOfColumns();
+            size_t nrows = block.getNumberOfRows();
 
             char * ptr = (char *)(_ptr.get()) + _structSize * block.getRowsOffset();
+            void * columns[internal::layoutConversionMaxColumns];
 
             T * blockPtr = block.getBlockPtr();
 
-            for (size_t j = 0; j < ncols; j++)
+            for (size_t i = 0; i < nrows; i += internal::layoutConversionBlockRows)
             {
-                NumericTableFeature & f = (*_ddict)[j];
-
-                char * location = ptr + _offsets[j];
-
-                internal::getVectorStrideDownCast(f.indexType, internal::getConversionDataType<T>())(block.getNumberOfRows(), blockPtr + j,
-                                                                                                     sizeof(T) * ncols, location, _structSize);
+                const size_t di = (i + internal::layoutConversionBlockRows < nrows) ? internal::layoutConversionBlockRows : nrows - i;
+
+                for (size_t j = 0; j < ncols;)
+                {
+                    NumericTableFeature & f = (*_ddict)[j];
+
+                    size_t nRunCols = 0;
+                    while (j + nRunCols < ncols && nRunCols < internal::layoutConversionMaxColumns
+                           && (*_ddict)[j + nRunCols].indexType == f.indexType)
+                    {
+                        columns[nRunCols] = ptr + i * _structSize + _offsets[j + nRunCols];
+                        ++nRunCols;
+                    }
+
+                    const T * rows = blockPtr + i * ncols + j;
+                    internal::getVectorRowsToColumnsDownCast(f.indexType, internal::getConversionDataType<T>())(di, nRunCols, rows, ncols, columns,
+                                                                                                              _structSize);
+                    j += nRunCols;
+                }
             }
         }
         block.reset();
@@ -465,6 +501,7 @@ private:
     {
         size_t nobs = getNumberOfRows();
         block.setDetails(feat_idx, idx, rwFlag);
+        resetFinitenessStatus(rwFlag);
 
         if (idx >= nobs)
         {
@@ -474,7 +474,11 @@ public:
 
     virtual ~CSRNumericTable() { freeDataMemoryImpl(); }
 
-    virtual services::Status resize(size_t nrows) DAAL_C11_OVERRIDE { return setNumberOfRowsImpl(nrows); }
+    virtual services::Status resize(size_t nrows) DAAL_C11_OVERRIDE
+    {
+        resetCSCArrays();
+        return setNumberOfRowsImpl(nrows);
+    }
 
     /**
      *  Returns  pointers to a data set stored in the CSR layout
@@ -578,6 +582,92 @@ public:
         return services::Status();
     }
 
+    /**
+     *  Returns pointers to the data set in the CSC layout, the layout of the column-oriented algorithms. The arrays are
+     *  computed from the CSR arrays by the parallel transposition on the first call and are kept with the table till its
+     *  arrays are changed by the methods of the table
+     *  \tparam        DataType    Type of the values of the table
+     *  \param[out]    ptr         Array of values in the CSC layout
+     *  \param[out]    rowIndices  Array of row indices in the CSC layout, with the indexing of the table
+     *  \param[out]    colOffsets  Array of column offsets in the CSC layout. Size of the array is ncol+1
+     */
+    template <typename DataType>
+    services::Status getCSCArrays(DataType ** ptr, size_t ** rowIndices, size_t ** colOffsets)
+    {
+        services::Status s = getCSCArraysImpl(features::internal::getIndexNumType<DataType>());
+        if (!s) return s;
+        if (ptr)
+        {
+            *ptr = (DataType *)_cscValues.get();
+        }
+        if (rowIndices)
+        {
+            *rowIndices = _cscRowIndices.get();
+        }
+        if (colOffsets)
+        {
+            *colOffsets = _cscColOffsets.get();
+        }
+        return s;
+    }
+
+    /**
+     *  Constructs CSR numeric table from the data set in the CSC layout by the parallel transposition, the CSC arrays
+     *  are kept with the table
+     *  \tparam   DataType        Type of values in the numeric table
+     *  \param[in]    ptr         Array of values in the CSC layout
+     *  \param[in]    rowIndices  Array of row indices in the CSC layout. Values of indices are determined by the index base
+     *  \param[in]    colOffsets  Array of column offsets in the CSC layout. Size of the array is ncol+1. The first element
+     *                            is 0/1 in zero-/one-based indexing
+     *  \param[in]    nColumns    Number of columns in the corresponding dense table
+     *  \param[in]    nRows       Number of rows in the corresponding dense table
+     *  \param[in]    indexing    Indexing scheme used to access data in the CSC and the CSR layouts
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return       CSR numeric table with the CSR arrays allocated by the library
+     */
+    template <typename DataType>
+    static services::SharedPtr<CSRNumericTable> createFromCSC(const services::SharedPtr<DataType> & ptr,
+                                                              const services::SharedPtr<size_t> & rowIndices,
+                                                              const services::SharedPtr<size_t> & colOffsets, size_t nColumns, size_t nRows,
+                                                              CSRIndexing indexing = oneBased, services::Status * stat = NULL)
+    {
+        services::Status s;
+        const size_t base    = (indexing == oneBased) ? 1 : 0;
+        const size_t nValues = (ptr && rowIndices && colOffsets) ? colOffsets.get()[nColumns] - colOffsets.get()[0] : 0;
+
+        services::SharedPtr<DataType> values((DataType *)daal::services::daal_malloc(nValues * sizeof(DataType) + 1), services::ServiceDeleter());
+        services::SharedPtr<size_t> colIndices((size_t *)daal::services::daal_malloc(nValues * sizeof(size_t) + 1), services::ServiceDeleter());
+        services::SharedPtr<size_t> rowOffsets((size_t *)daal::services::daal_malloc((nRows + 1) * sizeof(size_t)), services::ServiceDeleter());
+        if (!values || !colIndices || !rowOffsets)
+        {
+            s = services::Status(services::ErrorMemoryAllocationFailed);
+        }
+        else if (nValues > 0)
+        {
+            s = transposeSparse(nColumns, nRows, sizeof(DataType), base, (const byte *)ptr.get(), rowIndices.get(), colOffsets.get(),
+                                (byte *)values.get(), colIndices.get(), rowOffsets.get());
+        }
+        else
+        {
+            for (size_t i = 0; i <= nRows; i++) rowOffsets.get()[i] = base;
+        }
+
+        services::SharedPtr<CSRNumericTable> table;
+        if (s)
+        {
+            table = create<DataType>(values, colIndices, rowOffsets, nColumns, nRows, indexing, &s);
+        }
+        if (table)
+        {
+            table->_memStatus     = internallyAllocated;
+            table->_cscValues     = services::reinterpretPointerCast<byte, DataType>(ptr);
+            table->_cscRowIndices = rowIndices;
+            table->_cscColOffsets = colOffsets;
+        }
+        if (stat) stat->add(s);
+        return table;
+    }
+
     services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> & block) DAAL_C11_OVERRIDE
     {
         return getTBlock<double>(vector_idx, vector_num, rwflag, block);
@@ -695,6 +785,30 @@ protected:
     services::SharedPtr<size_t> _colIndices;
     services::SharedPtr<size_t> _rowOffsets;
 
+    /* The data set in the CSC layout computed by getCSCArrays, empty if it is not computed */
+    services::SharedPtr<byte> _cscValues;
+    services::SharedPtr<size_t> _cscRowIndices;
+    services::SharedPtr<size_t> _cscColOffsets;
+
+    /* Computes the CSC arrays if they are not computed, the values are of the type of the table */
+    services::Status getCSCArraysImpl(int indexType);
+
+    void resetCSCArrays()
+    {
+        _cscValues     = services::SharedPtr<byte>();
+        _cscRowIndices = services::SharedPtr<size_t>();
+        _cscColOffsets = services::SharedPtr<size_t>();
+    }
+
+    /**
+     *  Transposes the nRows x nColumns matrix in the CSR layout into the CSR layout of the transposed matrix, i.e. the
+     *  CSC layout of the matrix, in parallel by the blocks of the rows: the numbers of the values of the columns are
+     *  counted per block, then the values of every block are scattered to the positions of its columns
+     */
+    static services::Status transposeSparse(size_t nRows, size_t nColumns, size_t typeSize, size_t indexBase, const byte * values,
+                                            const size_t * colIndices, const size_t * rowOffsets, byte * tValues, size_t * tRowIndices,
+                                            size_t * tColOffsets);
+
     template <typename DataType>
     CSRNumericTable(const services::SharedPtr<DataType> & ptr, const services::SharedPtr<size_t> & colIndices,
                     const services::SharedPtr<size_t> & rowOffsets, size_t nColumns, size_t nRows, CSRIndexing indexing, services::Status & st)
@@ -717,6 +831,7 @@ protected:
         _ptr        = services::SharedPtr<byte>();
         _colIndices = services::SharedPtr<size_t>();
         _rowOffsets = services::SharedPtr<size_t>();
+        resetCSCArrays();
 
         _memStatus = notAllocated;
     }
@@ -962,6 +1077,7 @@ protected:
     {
         if (block.getRWFlag() & (int)writeOnly)
         {
+            resetCSCArrays();
             NumericTableFeature & f = (*_ddict)[0];
             const int indexType     = f.indexType;
 
@@ -989,6 +1105,7 @@ protected:
 
     virtual services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
     {
+        resetCSCArrays();
         _ddict->setNumberOfFeatures(ncol);
         _ddict->setAllFeatures(_defaultFeature);
         return services::Status();
@@ -1004,6 +1121,18 @@ using interface1::CSRBlockDescriptor;
 using interface1::CSRNumericTable;
 using interface1::CSRNumericTablePtr;
 
+/**
+ * Converts numeric table to CSR numeric table of the given type with every categorical feature expanded to the one-hot
+ * columns of its categories, so the dense one-hot columns are not allocated. The values of the categorical features are
+ * the codes of the categories, the number of the columns of a feature is its categoryNumber.
+ * The zero values of the other features are not stored
+ * \param[in]  src     Numeric table
+ * \param[out] stat    Status of the conversion
+ * \return             Pointer to CSR numeric table with one-based indexing
+ */
+template <typename DataType>
+DAAL_EXPORT CSRNumericTablePtr convertToOneHotCSR(NumericTable & src, services::Status * stat = NULL);
+
 } // namespace data_management
 } // namespace daal
 #endif
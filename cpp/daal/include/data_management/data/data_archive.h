@@ -139,6 +139,15 @@ public:
      * \return The update version of the archive
      */
     virtual int getUpdateVersion() = 0;
+
+    /**
+     *  Returns the pointer to the data of the given size in the archive memory without copying it
+     *  and moves to the next data in the archive. The archives that cannot provide the data in place
+     *  return an empty pointer and do not change the reading position
+     *  \param[in]  size Size of the data array
+     *  \return Pointer to the data that shares the ownership of the archive memory
+     */
+    virtual services::SharedPtr<byte> readInPlace(size_t /*size*/) { return services::SharedPtr<byte>(); }
 };
 
 /**
@@ -496,6 +505,462 @@ private:
     DataArchive & operator=(const DataArchive &);
 };
 
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDDATAARCHIVE"></a>
+ *  \brief Implements the read-only DataArchiveIface interface over the memory provided by the user,
+ *         for example, the memory-mapped file. The arrays of the numeric tables are restored
+ *         pointing directly to the memory, so it must not be modified while the tables are in use
+ */
+class MappedDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of a data archive over the serialized data
+     *  \param[in]  ptr  Pointer to the memory that contains the serialized data,
+     *                   the deleter of the pointer releases the memory, e.g. unmaps the file
+     *  \param[in]  size Size of the serialized data
+     */
+    MappedDataArchive(const services::SharedPtr<byte> & ptr, size_t size)
+        : _errors(new services::ErrorCollection()), _buffer(ptr), _size(ptr ? size : 0), _readOffset(0)
+    {}
+
+    ~MappedDataArchive() DAAL_C11_OVERRIDE {}
+
+    void write(byte * /*ptr*/, size_t /*size*/) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorMethodNotSupported); }
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        const size_t alignedSize = alignValueUp(size);
+        if (_size < _readOffset + alignedSize)
+        {
+            this->_errors->add(services::ErrorDataArchiveInternal);
+            return;
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(ptr, size, _buffer.get() + _readOffset, size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+
+        _readOffset += alignedSize;
+    }
+
+    services::SharedPtr<byte> readInPlace(size_t size) DAAL_C11_OVERRIDE
+    {
+        const size_t alignedSize = alignValueUp(size);
+        byte * ptr               = _buffer.get() + _readOffset;
+        if (size == 0 || _size < _readOffset + alignedSize || ((size_t)ptr & (DAAL_MALLOC_DEFAULT_ALIGNMENT - 1)))
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        _readOffset += alignedSize;
+        return services::SharedPtr<byte>(_buffer, ptr);
+    }
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return _size; }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE { return _buffer; }
+
+    byte * getArchiveAsArray() DAAL_C11_OVERRIDE { return _buffer.get(); }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE { return std::string((char *)_buffer.get(), _size); }
+
+    size_t copyArchiveToArray(byte * ptr, size_t maxLength) const DAAL_C11_OVERRIDE
+    {
+        if (_size == 0 || _size > maxLength)
+        {
+            return _size;
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(ptr, maxLength, _buffer.get(), _size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return 0;
+        }
+
+        return _size;
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+protected:
+    inline size_t alignValueUp(size_t value)
+    {
+        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+        {
+            return value;
+        }
+
+        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+
+        size_t alignedValue = value + alignm1;
+        alignedValue &= ~alignm1;
+        return alignedValue;
+    }
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+
+private:
+    services::SharedPtr<byte> _buffer;
+    size_t _size;
+    size_t _readOffset;
+
+    MappedDataArchive(const MappedDataArchive &);
+    MappedDataArchive & operator=(const MappedDataArchive &);
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__DATAARCHIVESTREAMIFACE"></a>
+ *  \brief Abstract interface class of the byte stream, for example, the file, the socket or the compressor,
+ *         the serialized data is written to or read from by the streaming data archives
+ */
+class DataArchiveStreamIface
+{
+public:
+    virtual ~DataArchiveStreamIface() {}
+
+    /**
+     *  Writes the bytes to the stream
+     *  \param[in]  ptr   Pointer to the bytes
+     *  \param[in]  size  Number of the bytes
+     *  \return Number of the written bytes, less than size if the stream failed
+     */
+    virtual size_t write(const byte * ptr, size_t size) = 0;
+
+    /**
+     *  Reads the bytes from the stream, can read less than requested if the rest is not available yet
+     *  \param[out] ptr   Pointer to the memory for the bytes
+     *  \param[in]  size  Largest number of the bytes to read
+     *  \return Number of the read bytes, 0 at the end of the stream or if the stream failed
+     */
+    virtual size_t read(byte * ptr, size_t size) = 0;
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__WRITESTREAMDATAARCHIVE"></a>
+ *  \brief Implements the write-only DataArchiveIface interface that passes the serialized data to the stream
+ *         as it is produced instead of building the archive in memory. The small values are gathered in the buffer
+ *         of the fixed size, the arrays larger than the buffer are written to the stream directly without copying.
+ *         The rest of the buffer is written by flush() or by the destructor
+ */
+class WriteStreamDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of a data archive that writes the serialized data to the stream
+     *  \param[in]  stream      Stream the serialized data is written to
+     *  \param[in]  bufferSize  Size of the buffer of the small values in bytes
+     */
+    WriteStreamDataArchive(const services::SharedPtr<DataArchiveStreamIface> & stream, size_t bufferSize = 1024 * 1024)
+        : _errors(new services::ErrorCollection()), _stream(stream), _bufferSize(bufferSize), _bufferOffset(0), _size(0)
+    {
+        _buffer = (byte *)daal::services::daal_malloc(_bufferSize);
+        if (!_stream || !_buffer)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+        }
+    }
+
+    ~WriteStreamDataArchive() DAAL_C11_OVERRIDE
+    {
+        flush();
+        daal::services::daal_free(_buffer);
+        _buffer = NULL;
+    }
+
+    void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        const size_t alignedSize = alignValueUp(size);
+        const byte zeros[DAAL_MALLOC_DEFAULT_ALIGNMENT] = { 0 };
+        put(ptr, size);
+        put(zeros, alignedSize - size);
+        _size += alignedSize;
+    }
+
+    void read(byte * /*ptr*/, size_t /*size*/) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorMethodNotSupported); }
+
+    /**
+     *  Writes the buffered data to the stream
+     *  \return true if all the data written to the archive is passed to the stream
+     */
+    bool flush()
+    {
+        if (_bufferOffset > 0 && this->_errors->isEmpty())
+        {
+            writeToStream(_buffer, _bufferOffset);
+        }
+        _bufferOffset = 0;
+        return this->_errors->isEmpty();
+    }
+
+    /**
+     *  Returns the number of the bytes written to the archive
+     */
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return _size; }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+        return services::SharedPtr<byte>();
+    }
+
+    byte * getArchiveAsArray() DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+        return NULL;
+    }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+        return std::string();
+    }
+
+    size_t copyArchiveToArray(byte * /*ptr*/, size_t /*maxLength*/) const DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+        return 0;
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+protected:
+    inline size_t alignValueUp(size_t value)
+    {
+        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+        {
+            return value;
+        }
+
+        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+
+        size_t alignedValue = value + alignm1;
+        alignedValue &= ~alignm1;
+        return alignedValue;
+    }
+
+    void put(const byte * ptr, size_t size)
+    {
+        if (size == 0 || !this->_errors->isEmpty())
+        {
+            return;
+        }
+
+        if (_bufferOffset + size > _bufferSize)
+        {
+            flush();
+            if (size >= _bufferSize)
+            {
+                writeToStream(ptr, size);
+                return;
+            }
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(_buffer + _bufferOffset, _bufferSize - _bufferOffset, ptr, size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        _bufferOffset += size;
+    }
+
+    void writeToStream(const byte * ptr, size_t size)
+    {
+        if (_stream->write(ptr, size) != size)
+        {
+            this->_errors->add(services::ErrorDataArchiveInternal);
+        }
+    }
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+
+private:
+    services::SharedPtr<DataArchiveStreamIface> _stream;
+    byte * _buffer;
+    size_t _bufferSize;
+    size_t _bufferOffset;
+    size_t _size;
+
+    WriteStreamDataArchive(const WriteStreamDataArchive &);
+    WriteStreamDataArchive & operator=(const WriteStreamDataArchive &);
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__READSTREAMDATAARCHIVE"></a>
+ *  \brief Implements the read-only DataArchiveIface interface that takes the serialized data from the stream
+ *         as it is restored instead of loading the archive to memory. The small values are read through the buffer
+ *         of the fixed size, the arrays larger than the buffer are read from the stream directly without copying
+ */
+class ReadStreamDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of a data archive that reads the serialized data from the stream
+     *  \param[in]  stream      Stream the serialized data is read from
+     *  \param[in]  bufferSize  Size of the buffer of the small values in bytes
+     */
+    ReadStreamDataArchive(const services::SharedPtr<DataArchiveStreamIface> & stream, size_t bufferSize = 1024 * 1024)
+        : _errors(new services::ErrorCollection()), _stream(stream), _bufferSize(bufferSize), _bufferOffset(0), _bufferEnd(0), _size(0)
+    {
+        _buffer = (byte *)daal::services::daal_malloc(_bufferSize);
+        if (!_stream || !_buffer)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+        }
+    }
+
+    ~ReadStreamDataArchive() DAAL_C11_OVERRIDE
+    {
+        daal::services::daal_free(_buffer);
+        _buffer = NULL;
+    }
+
+    void write(byte * /*ptr*/, size_t /*size*/) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorMethodNotSupported); }
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        const size_t alignedSize = alignValueUp(size);
+        byte padding[DAAL_MALLOC_DEFAULT_ALIGNMENT];
+        get(ptr, size);
+        get(padding, alignedSize - size);
+        _size += alignedSize;
+    }
+
+    /**
+     *  Returns the number of the bytes read from the archive
+     */
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return _size; }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+        return services::SharedPtr<byte>();
+    }
+
+    byte * getArchiveAsArray() DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+        return NULL;
+    }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+        return std::string();
+    }
+
+    size_t copyArchiveToArray(byte * /*ptr*/, size_t /*maxLength*/) const DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+        return 0;
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+protected:
+    inline size_t alignValueUp(size_t value)
+    {
+        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+        {
+            return value;
+        }
+
+        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+
+        size_t alignedValue = value + alignm1;
+        alignedValue &= ~alignm1;
+        return alignedValue;
+    }
+
+    void get(byte * ptr, size_t size)
+    {
+        if (size == 0 || !this->_errors->isEmpty())
+        {
+            return;
+        }
+
+        size_t available = _bufferEnd - _bufferOffset;
+        if (size > available)
+        {
+            copyFromBuffer(ptr, available);
+            ptr += available;
+            size -= available;
+            _bufferOffset = _bufferEnd = 0;
+
+            if (size >= _bufferSize)
+            {
+                readFromStream(ptr, size, size);
+                return;
+            }
+            _bufferEnd = readFromStream(_buffer, size, _bufferSize);
+        }
+        copyFromBuffer(ptr, size);
+    }
+
+    void copyFromBuffer(byte * ptr, size_t size)
+    {
+        if (size == 0 || !this->_errors->isEmpty())
+        {
+            return;
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(ptr, size, _buffer + _bufferOffset, size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        _bufferOffset += size;
+    }
+
+    /* Reads at least minSize and at most maxSize bytes from the stream, the stream can return them by parts */
+    size_t readFromStream(byte * ptr, size_t minSize, size_t maxSize)
+    {
+        size_t offset = 0;
+        while (offset < minSize)
+        {
+            const size_t readSize = _stream->read(ptr + offset, maxSize - offset);
+            if (readSize == 0)
+            {
+                this->_errors->add(services::ErrorDataArchiveInternal);
+                break;
+            }
+            offset += readSize;
+        }
+        return offset;
+    }
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+
+private:
+    services::SharedPtr<DataArchiveStreamIface> _stream;
+    byte * _buffer;
+    size_t _bufferSize;
+    size_t _bufferOffset;
+    size_t _bufferEnd;
+    size_t _size;
+
+    ReadStreamDataArchive(const ReadStreamDataArchive &);
+    ReadStreamDataArchive & operator=(const ReadStreamDataArchive &);
+};
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__COMPRESSEDDATAARCHIVE"></a>
  *  \brief Abstract interface class that defines methods to access and modify a serialized object.
@@ -510,8 +975,25 @@ public:
      */
     CompressedDataArchive(daal::data_management::CompressorImpl * compressor) : minBlockSize(1024 * 64), _errors(new services::ErrorCollection())
     {
-        compressionStream = new daal::data_management::CompressionStream(compressor, minBlockSize);
-        serializedBuffer  = 0;
+        compressionStream      = new daal::data_management::CompressionStream(compressor, minBlockSize);
+        blockCompressionStream = 0;
+        serializedBuffer       = 0;
+    }
+
+    /**
+     *  Constructor of a compressed data archive that compresses independent blocks of the data in parallel.
+     *  The archive is decompressed by the DecompressedDataArchive constructed with the same compression method
+     *  \param[in]  method     %Compression method, \ref CompressionMethod
+     *  \param[in]  level      %Compression level, \ref CompressionLevel
+     *  \param[in]  blockSize  Size of the independently compressed blocks in bytes
+     */
+    CompressedDataArchive(daal::data_management::CompressionMethod method, daal::data_management::CompressionLevel level = defaultLevel,
+                          size_t blockSize = 1024 * 1024)
+        : minBlockSize(blockSize), _errors(new services::ErrorCollection())
+    {
+        compressionStream      = 0;
+        blockCompressionStream = new daal::data_management::BlockCompressionStream(method, level, blockSize);
+        serializedBuffer       = 0;
     }
 
     /** \private */
@@ -522,6 +1004,7 @@ public:
             daal::services::daal_free(serializedBuffer);
         }
         delete compressionStream;
+        delete blockCompressionStream;
     }
 
     void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE
@@ -529,12 +1012,20 @@ public:
         DataBlock wBlock;
         wBlock.setPtr(ptr);
         wBlock.setSize(size);
+        if (blockCompressionStream)
+        {
+            blockCompressionStream->push_back(&wBlock);
+            return;
+        }
         compressionStream->push_back(&wBlock);
     }
 
     void read(byte * /*ptr*/, size_t /*size*/) DAAL_C11_OVERRIDE {}
 
-    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return compressionStream->getCompressedDataSize(); }
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE
+    {
+        return blockCompressionStream ? blockCompressionStream->getCompressedDataSize() : compressionStream->getCompressedDataSize();
+    }
 
     byte * getArchiveAsArray() DAAL_C11_OVERRIDE
     {
@@ -556,7 +1047,7 @@ public:
             return 0;
         }
 
-        compressionStream->copyCompressedArray(serializedBuffer, length);
+        copyCompressedArray(serializedBuffer, length);
         return serializedBuffer;
     }
 
@@ -597,7 +1088,7 @@ public:
             return length;
         }
 
-        compressionStream->copyCompressedArray(ptr, length);
+        copyCompressedArray(ptr, length);
         return length;
     }
 
@@ -608,9 +1099,20 @@ public:
     services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
 
 private:
+    void copyCompressedArray(byte * ptr, size_t length) const
+    {
+        if (blockCompressionStream)
+        {
+            blockCompressionStream->copyCompressedArray(ptr, length);
+            return;
+        }
+        compressionStream->copyCompressedArray(ptr, length);
+    }
+
     size_t minBlockSize;
     byte * serializedBuffer;
     daal::data_management::CompressionStream * compressionStream;
+    daal::data_management::BlockCompressionStream * blockCompressionStream;
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 
@@ -629,8 +1131,21 @@ public:
     DecompressedDataArchive(daal::data_management::DecompressorImpl * decompressor)
         : minBlockSize(1024 * 64), _errors(new services::ErrorCollection())
     {
-        decompressionStream = new daal::data_management::DecompressionStream(decompressor, minBlockSize);
-        serializedBuffer    = 0;
+        decompressionStream      = new daal::data_management::DecompressionStream(decompressor, minBlockSize);
+        blockDecompressionStream = 0;
+        serializedBuffer         = 0;
+    }
+
+    /**
+     *  Constructor of a decompressed data archive that decompresses the independent blocks of the data in parallel.
+     *  The archive shall be compressed by the CompressedDataArchive constructed with the same compression method
+     *  \param[in]  method  %Compression method, \ref CompressionMethod
+     */
+    DecompressedDataArchive(daal::data_management::CompressionMethod method) : minBlockSize(1024 * 64), _errors(new services::ErrorCollection())
+    {
+        decompressionStream      = 0;
+        blockDecompressionStream = new daal::data_management::BlockDecompressionStream(method);
+        serializedBuffer         = 0;
     }
 
     /** \private */
@@ -641,6 +1156,7 @@ public:
             daal::services::daal_free(serializedBuffer);
         }
         delete decompressionStream;
+        delete blockDecompressionStream;
     }
 
     void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE
@@ -648,12 +1164,20 @@ public:
         DataBlock wBlock;
         wBlock.setPtr(ptr);
         wBlock.setSize(size);
+        if (blockDecompressionStream)
+        {
+            blockDecompressionStream->push_back(&wBlock);
+            return;
+        }
         decompressionStream->push_back(&wBlock);
     }
 
-    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE { decompressionStream->copyDecompressedArray(ptr, size); }
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE { copyDecompressedArray(ptr, size); }
 
-    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return decompressionStream->getDecompressedDataSize(); }
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE
+    {
+        return blockDecompressionStream ? blockDecompressionStream->getDecompressedDataSize() : decompressionStream->getDecompressedDataSize();
+    }
 
     byte * getArchiveAsArray() DAAL_C11_OVERRIDE
     {
@@ -675,7 +1199,7 @@ public:
             return 0;
         }
 
-        decompressionStream->copyDecompressedArray(serializedBuffer, length);
+        copyDecompressedArray(serializedBuffer, length);
         return serializedBuffer;
     }
 
@@ -716,7 +1240,7 @@ public:
             return length;
         }
 
-        decompressionStream->copyDecompressedArray(ptr, length);
+        copyDecompressedArray(ptr, length);
         return length;
     }
 
@@ -727,9 +1251,20 @@ public:
     services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
 
 private:
+    void copyDecompressedArray(byte * ptr, size_t length) const
+    {
+        if (blockDecompressionStream)
+        {
+            blockDecompressionStream->copyDecompressedArray(ptr, length);
+            return;
+        }
+        decompressionStream->copyDecompressedArray(ptr, length);
+    }
+
     size_t minBlockSize;
     byte * serializedBuffer;
     daal::data_management::DecompressionStream * decompressionStream;
+    daal::data_management::BlockDecompressionStream * blockDecompressionStream;
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 
@@ -841,6 +1376,12 @@ public:
         _arch->write((byte *)ptr, size * sizeof(T));
     }
 
+    /**
+     *  Serialization does not work in place, so the array is always serialized with set()
+     *  \return false
+     */
+    bool setInPlace(services::SharedPtr<byte> & /*ptr*/, size_t /*size*/) { return false; }
+
     /**
      *  Performs data serialization creating a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -1029,6 +1570,19 @@ public:
         archiveHeader();
     }
 
+    /**
+     *  Constructor of an output data archive over the memory provided by the user without copying it,
+     *  for example, the memory-mapped file. The arrays of the numeric tables are restored pointing
+     *  to the memory, which must stay unmodified while the restored objects are in use
+     *  \param[in]  ptr  Pointer to the memory that contains the serialized data
+     *  \param[in]  size Size of the serialized data
+     */
+    OutputDataArchive(const services::SharedPtr<byte> & ptr, size_t size) : _errors(new services::ErrorCollection())
+    {
+        _arch = new MappedDataArchive(ptr, size);
+        archiveHeader();
+    }
+
     /**
      *  Constructor of an output data archive from a byte array of compressed data
      */
@@ -1120,6 +1674,21 @@ public:
         _arch->read((byte *)ptr, size * sizeof(T));
     }
 
+    /**
+     *  Restores the array of the given size in bytes pointing to the archive memory without copying it,
+     *  the archive must be created over the memory provided by the user, see MappedDataArchive
+     *  \param[out]  ptr   Pointer to the restored array
+     *  \param[in]   size  Size of the array in bytes
+     *  \return true if the array is restored in place, false if the array must be read with set()
+     */
+    bool setInPlace(services::SharedPtr<byte> & ptr, size_t size) const
+    {
+        services::SharedPtr<byte> inPlace = _arch->readInPlace(size);
+        if (!inPlace) return false;
+        ptr = inPlace;
+        return true;
+    }
+
     /**
      *  Performs data deserialization of a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -1242,6 +1811,10 @@ private:
 } // namespace interface1
 using interface1::DataArchiveIface;
 using interface1::DataArchive;
+using interface1::MappedDataArchive;
+using interface1::DataArchiveStreamIface;
+using interface1::WriteStreamDataArchive;
+using interface1::ReadStreamDataArchive;
 using interface1::CompressedDataArchive;
 using interface1::DecompressedDataArchive;
 using interface1::InputDataArchive;
@@ -554,6 +554,7 @@ public:
     DAAL_DEPRECATED services::Status setArray(DataType * const ptr)
     {
         freeDataMemoryImpl();
+        _finitenessStatus = finitenessUnknown;
 
         _ptr = services::SharedPtr<byte>((byte *)ptr, services::EmptyDeleter());
 
@@ -576,6 +577,7 @@ public:
     DAAL_DEPRECATED services::Status setArray(const services::SharedPtr<DataType> & ptr)
     {
         freeDataMemoryImpl();
+        _finitenessStatus = finitenessUnknown;
 
         _ptr = services::reinterpretPointerCast<byte, DataType>(ptr);
 
@@ -598,6 +600,7 @@ public:
     services::Status setArray(DataType * const ptr, size_t nRows)
     {
         freeDataMemoryImpl();
+        _finitenessStatus = finitenessUnknown;
 
         _ptr    = services::SharedPtr<byte>((byte *)ptr, services::EmptyDeleter());
         _obsnum = nRows;
@@ -621,6 +624,7 @@ public:
     services::Status setArray(services::SharedPtr<DataType> ptr, size_t nRows)
     {
         freeDataMemoryImpl();
+        _finitenessStatus = finitenessUnknown;
 
         _ptr    = services::reinterpretPointerCast<byte, DataType>(ptr);
         _obsnum = nRows;
@@ -652,6 +656,7 @@ public:
         DataType valueDataType = (DataType)value;
 
         internal::vectorAssignValueToArray<DataType>(ptr, nColumns * nRows, valueDataType);
+        _finitenessStatus = getValueFiniteness(valueDataType);
 
         return services::Status();
     }
@@ -810,13 +815,18 @@ protected:
     {
         NumericTable::serialImpl<Archive, onDeserialize>(archive);
 
+        size_t size = getNumberOfColumns() * getNumberOfRows();
+
         if (onDeserialize)
         {
+            if (archive->setInPlace(_ptr, size * sizeof(DataType)))
+            {
+                _memStatus = userAllocated;
+                return services::Status();
+            }
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfColumns() * getNumberOfRows();
-
         archive->set((DataType *)_ptr.get(), size);
 
         return services::Status();
@@ -842,6 +852,7 @@ protected:
         size_t ncols = getNumberOfColumns();
         size_t nobs  = getNumberOfRows();
         block.setDetails(0, idx, rwFlag);
+        resetFinitenessStatus(rwFlag);
 
         if (idx >= nobs)
         {
@@ -910,6 +921,7 @@ protected:
         size_t ncols = getNumberOfColumns();
         size_t nobs  = getNumberOfRows();
         block.setDetails(feat_idx, idx, rwFlag);
+        resetFinitenessStatus(rwFlag);
 
         if (idx >= nobs)
         {
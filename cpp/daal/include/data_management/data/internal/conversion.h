@@ -71,6 +71,18 @@ typedef void (*vectorStrideConvertFuncType)(size_t n, const void * src, size_t s
 
 typedef bool (*vectorCopy2vFuncType)(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets);
 
+/* The tables copy the blocks of at most layoutConversionBlockRows rows and layoutConversionMaxColumns columns of the same type
+   with one call of the functions that convert the layout */
+const size_t layoutConversionBlockRows  = 256;
+const size_t layoutConversionMaxColumns = 32;
+
+/* Copies the strided columns of the same type into the block of rows of the given row size converting the values */
+typedef void (*vectorColumnsToRowsFuncType)(size_t nrows, size_t ncols, const void * const * columns, size_t srcByteStride, void * dst,
+                                            size_t dstRowSize);
+/* Copies the columns of the block of rows of the given row size into the strided columns of the same type converting the values */
+typedef void (*vectorRowsToColumnsFuncType)(size_t nrows, size_t ncols, const void * src, size_t srcRowSize, void * const * columns,
+                                            size_t dstByteStride);
+
 template <typename T>
 DAAL_EXPORT vectorCopy2vFuncType getVector();
 
@@ -87,6 +99,9 @@ DAAL_EXPORT vectorConvertFuncType getVectorDownCast(int, int);
 DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideUpCast(int, int);
 DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideDownCast(int, int);
 
+DAAL_EXPORT vectorColumnsToRowsFuncType getVectorColumnsToRowsUpCast(int, int);
+DAAL_EXPORT vectorRowsToColumnsFuncType getVectorRowsToColumnsDownCast(int, int);
+
 /**
  *  <a name="DAAL-CLASS-DATAMANAGEMENT-INTERNAL__VECTORUPCAST"></a>
  *  \brief Class to cast vector up from T type to U
@@ -27,9 +27,41 @@ namespace data_management
 {
 namespace internal
 {
+/**
+ *  Checks that the values in the table are finite. The finiteness status of the table is used if it was set,
+ *  the result of the scan is not stored in the table since its memory can change without a block access
+ */
 template <typename DataType>
 DAAL_EXPORT bool allValuesAreFinite(NumericTable & table, bool allowNaN);
 
+/**
+ *  Returns the finiteness of the values, used to compute the finiteness status of the table
+ *  while the values are written to it
+ */
+template <typename DataType>
+inline NumericTable::FinitenessStatus getFinitenessStatus(const DataType * values, size_t n)
+{
+    NumericTable::FinitenessStatus status = NumericTable::allFinite;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const NumericTable::FinitenessStatus valueStatus = NumericTable::getValueFiniteness(values[i]);
+        if (valueStatus == NumericTable::notFinite) return valueStatus;
+        if (valueStatus == NumericTable::finiteOrNaN) status = valueStatus;
+    }
+    return status;
+}
+
+/**
+ *  Returns the finiteness of the union of two sets of values with the given finiteness
+ */
+inline NumericTable::FinitenessStatus combineFinitenessStatus(NumericTable::FinitenessStatus first, NumericTable::FinitenessStatus second)
+{
+    if (first == NumericTable::finitenessUnknown || second == NumericTable::finitenessUnknown) return NumericTable::finitenessUnknown;
+    if (first == NumericTable::notFinite || second == NumericTable::notFinite) return NumericTable::notFinite;
+    if (first == NumericTable::finiteOrNaN || second == NumericTable::finiteOrNaN) return NumericTable::finiteOrNaN;
+    return NumericTable::allFinite;
+}
+
 } // namespace internal
 } // namespace data_management
 } // namespace daal
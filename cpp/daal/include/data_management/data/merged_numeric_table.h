@@ -246,32 +246,41 @@ protected:
     }
 
 private:
+    /* Copies the columns of the nested table to the columns of the block starting from the column pos,
+       the large blocks are copied in parallel */
     template <typename T>
-    void internal_inner_repack(size_t pos, size_t cols, size_t rows, size_t ncols, T * src, T * dst)
-    {
-        size_t i, j;
+    void internal_inner_repack(size_t pos, size_t cols, size_t rows, size_t ncols, T * src, T * dst);
+
+    /* Copies the columns of the block starting from the column pos to the columns of the nested table,
+       the large blocks are copied in parallel */
+    template <typename T>
+    void internal_outer_repack(size_t pos, size_t cols, size_t rows, size_t ncols, T * src, T * dst);
 
-        for (i = 0; i < rows; i++)
+    /* Returns the nested table that contains the feature and the index of the feature in it, or NULL if there is no such feature */
+    NumericTable * getTableOfFeature(size_t featIdx, size_t & localFeatIdx) const
+    {
+        for (size_t k = 0; k < _tables->size(); k++)
         {
-            for (j = 0; j < cols; j++)
+            NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
+            size_t lcols      = nt->getNumberOfColumns();
+
+            if (lcols > featIdx)
             {
-                dst[i * ncols + j + pos] = src[i * cols + j];
+                localFeatIdx = featIdx;
+                return nt;
             }
+
+            featIdx -= lcols;
         }
+        return NULL;
     }
 
-    template <typename T>
-    void internal_outer_repack(size_t pos, size_t cols, size_t rows, size_t ncols, T * src, T * dst)
+    /* Returns the nested table that contains all the columns of the merged table, or NULL if the columns belong to several tables */
+    NumericTable * getTableOfAllColumns() const
     {
-        size_t i, j;
-
-        for (i = 0; i < rows; i++)
-        {
-            for (j = 0; j < cols; j++)
-            {
-                dst[i * cols + j] = src[i * ncols + j + pos];
-            }
-        }
+        size_t localFeatIdx = 0;
+        NumericTable * nt   = getTableOfFeature(0, localFeatIdx);
+        return (nt && nt->getNumberOfColumns() == getNumberOfColumns()) ? nt : NULL;
     }
 
 protected:
@@ -291,6 +300,15 @@ protected:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        /* the rows of one nested table are not copied, the block refers to the memory of the table */
+        NumericTable * nestedNt = getTableOfAllColumns();
+        if (nestedNt)
+        {
+            s = nestedNt->getBlockOfRows(idx, nrows, (ReadWriteMode)rwFlag, block);
+            block.setDetails(0, idx, rwFlag);
+            return s;
+        }
+
         if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
         if (rwFlag & (int)readOnly)
@@ -317,6 +335,12 @@ protected:
     template <typename T>
     services::Status releaseTBlock(BlockDescriptor<T> & block)
     {
+        NumericTable * nestedNt = getTableOfAllColumns();
+        if (nestedNt && block.getNumberOfRows())
+        {
+            return nestedNt->releaseBlockOfRows(block);
+        }
+
         services::Status s;
         if (block.getRWFlag() & (int)writeOnly)
         {
@@ -357,68 +381,34 @@ protected:
         }
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
-        if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
-        if (rwFlag & (int)readOnly)
+        /* the values of the feature are not copied, the block refers to the memory of the nested table */
+        size_t localFeatIdx     = 0;
+        NumericTable * nestedNt = getTableOfFeature(feat_idx, localFeatIdx);
+        if (nestedNt)
         {
-            T * buffer = block.getBlockPtr();
-            for (size_t k = 0; k < _tables->size(); k++)
-            {
-                NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
-                size_t lcols      = nt->getNumberOfColumns();
-
-                if (lcols > feat_idx)
-                {
-                    BlockDescriptor<T> innerBlock;
-                    s |= nt->getBlockOfColumnValues(feat_idx, idx, nrows, readOnly, innerBlock);
-                    T * location = innerBlock.getBlockPtr();
-                    for (size_t i = 0; i < nrows; i++)
-                    {
-                        buffer[i] = location[i];
-                    }
-                    s |= nt->releaseBlockOfColumnValues(innerBlock);
-                    break;
-                }
-
-                feat_idx -= lcols;
-            }
+            s = nestedNt->getBlockOfColumnValues(localFeatIdx, idx, nrows, (ReadWriteMode)rwFlag, block);
+            block.setDetails(feat_idx, idx, rwFlag);
+            return s;
         }
+
+        if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
         return s;
     }
 
     template <typename T>
     services::Status releaseTFeature(BlockDescriptor<T> & block)
     {
-        services::Status s;
-        if (block.getRWFlag() & (int)writeOnly)
+        size_t localFeatIdx     = 0;
+        NumericTable * nestedNt = getTableOfFeature(block.getColumnsOffset(), localFeatIdx);
+        if (nestedNt && block.getNumberOfRows())
         {
-            size_t feat_idx = block.getColumnsOffset();
-            size_t idx      = block.getRowsOffset();
-            size_t nrows    = block.getNumberOfRows();
-            T * buffer      = block.getBlockPtr();
-            for (size_t k = 0; k < _tables->size(); k++)
-            {
-                NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
-                size_t lcols      = nt->getNumberOfColumns();
-
-                if (lcols > feat_idx)
-                {
-                    BlockDescriptor<T> innerBlock;
-                    s |= nt->getBlockOfColumnValues(feat_idx, idx, nrows, writeOnly, innerBlock);
-                    T * location = innerBlock.getBlockPtr();
-                    for (size_t i = 0; i < nrows; i++)
-                    {
-                        location[i] = buffer[i];
-                    }
-                    s |= nt->releaseBlockOfColumnValues(innerBlock);
-                    break;
-                }
-
-                feat_idx -= lcols;
-            }
+            block.setDetails(localFeatIdx, block.getRowsOffset(), (int)block.getRWFlag());
+            return nestedNt->releaseBlockOfColumnValues(block);
         }
+
         block.reset();
-        return s;
+        return services::Status();
     }
 
     services::Status setNumberOfRowsImpl(size_t nrow) DAAL_C11_OVERRIDE;
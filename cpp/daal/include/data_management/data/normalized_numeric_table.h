@@ -0,0 +1,272 @@
+/* file: normalized_numeric_table.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of normalized numeric table.
+//--
+*/
+
+#ifndef __NORMALIZED_NUMERIC_TABLE_H__
+#define __NORMALIZED_NUMERIC_TABLE_H__
+
+#include "data_management/data/numeric_table.h"
+#include "services/daal_memory.h"
+#include "services/daal_defines.h"
+#include "data_management/data/data_serialize.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__NORMALIZEDNUMERICTABLE"></a>
+ *  \brief Class that provides read-only access to a numeric table normalized on the fly.
+ *         The value of the column j is returned as (x - shift[j]) * scale[j], so z-score and min-max
+ *         normalized data is consumed by the algorithms without materializing its copy
+ */
+class DAAL_EXPORT NormalizedNumericTable : public NumericTable
+{
+public:
+    DECLARE_SERIALIZABLE_TAG()
+    DECLARE_SERIALIZABLE_IMPL()
+
+    /**
+     *  Constructor for an empty Normalized Numeric Table used in deserialization
+     */
+    NormalizedNumericTable();
+
+    /**
+     * Constructs the table that normalizes the columns of the nested table
+     * \param[in]  nestedTable  Pointer to the table to normalize
+     * \param[in]  shift        Pointer to the 1 x p table of the values subtracted from the columns
+     * \param[in]  scale        Pointer to the 1 x p table of the factors the shifted columns are multiplied by
+     * \param[out] stat         Status of the NormalizedNumericTable construction
+     */
+    static services::SharedPtr<NormalizedNumericTable> create(const NumericTablePtr & nestedTable, const NumericTablePtr & shift,
+                                                              const NumericTablePtr & scale, services::Status * stat = NULL);
+
+    /**
+     *  Returns the nested table
+     *  \return Pointer to the nested table
+     */
+    NumericTablePtr getNestedTable() const { return _table; }
+
+    /**
+     *  Returns the values subtracted from the columns
+     *  \return Pointer to the 1 x p table of the shifts
+     */
+    NumericTablePtr getShift() const { return _shift; }
+
+    /**
+     *  Returns the factors the shifted columns are multiplied by
+     *  \return Pointer to the 1 x p table of the scales
+     */
+    NumericTablePtr getScale() const { return _scale; }
+
+    services::Status resize(size_t /*nrows*/) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::throwIfPossible(services::ErrorMethodNotSupported));
+    }
+
+    MemoryStatus getDataMemoryStatus() const DAAL_C11_OVERRIDE { return _table ? _table->getDataMemoryStatus() : notAllocated; }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> & block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> & block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> & block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> & block) DAAL_C11_OVERRIDE { return releaseTBlock<double>(block); }
+    services::Status releaseBlockOfRows(BlockDescriptor<float> & block) DAAL_C11_OVERRIDE { return releaseTBlock<float>(block); }
+    services::Status releaseBlockOfRows(BlockDescriptor<int> & block) DAAL_C11_OVERRIDE { return releaseTBlock<int>(block); }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                            BlockDescriptor<double> & block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                            BlockDescriptor<float> & block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                            BlockDescriptor<int> & block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> & block) DAAL_C11_OVERRIDE { return releaseTFeature<double>(block); }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> & block) DAAL_C11_OVERRIDE { return releaseTFeature<float>(block); }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> & block) DAAL_C11_OVERRIDE { return releaseTFeature<int>(block); }
+
+protected:
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>(arch);
+
+        arch->setSharedPtrObj(_table);
+        arch->setSharedPtrObj(_shift);
+        arch->setSharedPtrObj(_scale);
+
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTBlock(size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> & block)
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t nobs  = getNumberOfRows();
+        block.setDetails(0, idx, rwFlag);
+
+        if (rwFlag & (int)writeOnly) return services::Status(services::throwIfPossible(services::ErrorMethodNotSupported));
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer(ncols, 0);
+            return services::Status();
+        }
+
+        nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
+
+        services::Status s;
+        BlockDescriptor<T> innerBlock, shiftBlock, scaleBlock;
+        s |= _table->getBlockOfRows(idx, nrows, readOnly, innerBlock);
+        s |= _shift->getBlockOfRows(0, 1, readOnly, shiftBlock);
+        s |= _scale->getBlockOfRows(0, 1, readOnly, scaleBlock);
+
+        if (s)
+        {
+            const T * src   = innerBlock.getBlockPtr();
+            const T * shift = shiftBlock.getBlockPtr();
+            const T * scale = scaleBlock.getBlockPtr();
+            T * dst         = block.getBlockPtr();
+            for (size_t i = 0; i < nrows; i++)
+            {
+                for (size_t j = 0; j < ncols; j++)
+                {
+                    dst[i * ncols + j] = (src[i * ncols + j] - shift[j]) * scale[j];
+                }
+            }
+        }
+
+        s |= _scale->releaseBlockOfRows(scaleBlock);
+        s |= _shift->releaseBlockOfRows(shiftBlock);
+        s |= _table->releaseBlockOfRows(innerBlock);
+        return s;
+    }
+
+    template <typename T>
+    services::Status releaseTBlock(BlockDescriptor<T> & block)
+    {
+        block.reset();
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> & block)
+    {
+        const size_t nobs = getNumberOfRows();
+        block.setDetails(feat_idx, idx, rwFlag);
+
+        if (rwFlag & (int)writeOnly) return services::Status(services::throwIfPossible(services::ErrorMethodNotSupported));
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer(1, 0);
+            return services::Status();
+        }
+
+        nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
+
+        services::Status s;
+        BlockDescriptor<T> innerBlock, shiftBlock, scaleBlock;
+        s |= _table->getBlockOfColumnValues(feat_idx, idx, nrows, readOnly, innerBlock);
+        s |= _shift->getBlockOfColumnValues(feat_idx, 0, 1, readOnly, shiftBlock);
+        s |= _scale->getBlockOfColumnValues(feat_idx, 0, 1, readOnly, scaleBlock);
+
+        if (s)
+        {
+            const T * src = innerBlock.getBlockPtr();
+            const T shift = shiftBlock.getBlockPtr()[0];
+            const T scale = scaleBlock.getBlockPtr()[0];
+            T * dst       = block.getBlockPtr();
+            for (size_t i = 0; i < nrows; i++)
+            {
+                dst[i] = (src[i] - shift) * scale;
+            }
+        }
+
+        s |= _scale->releaseBlockOfColumnValues(scaleBlock);
+        s |= _shift->releaseBlockOfColumnValues(shiftBlock);
+        s |= _table->releaseBlockOfColumnValues(innerBlock);
+        return s;
+    }
+
+    template <typename T>
+    services::Status releaseTFeature(BlockDescriptor<T> & block)
+    {
+        block.reset();
+        return services::Status();
+    }
+
+    services::Status setNumberOfColumnsImpl(size_t /*ncols*/) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::throwIfPossible(services::ErrorMethodNotSupported));
+    }
+
+    services::Status setNumberOfRowsImpl(size_t /*nrows*/) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::throwIfPossible(services::ErrorMethodNotSupported));
+    }
+
+protected:
+    NumericTablePtr _table;
+    NumericTablePtr _shift;
+    NumericTablePtr _scale;
+
+    NormalizedNumericTable(const NumericTablePtr & nestedTable, const NumericTablePtr & shift, const NumericTablePtr & scale, services::Status & st);
+};
+typedef services::SharedPtr<NormalizedNumericTable> NormalizedNumericTablePtr;
+/** @} */
+} // namespace interface1
+using interface1::NormalizedNumericTable;
+using interface1::NormalizedNumericTablePtr;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -397,6 +397,29 @@ public:
         minMaxNormalized        = 2  /*!< Min-max normalization */
     };
 
+    /**
+     * <a name="DAAL-ENUM-DATA_MANAGEMENT__FINITENESSSTATUS"></a>
+     * \brief Enumeration to specify the known finiteness of the values in the table
+     */
+    enum FinitenessStatus
+    {
+        finitenessUnknown = 0, /*!< Default: the finiteness was not set since the last modification */
+        allFinite         = 1, /*!< All the values are finite */
+        finiteOrNaN       = 2, /*!< All the values are finite or NaN, some of them are NaN */
+        notFinite         = 3  /*!< Some of the values are infinite */
+    };
+
+    /**
+     * <a name="DAAL-ENUM-DATA_MANAGEMENT__BASICSTATISTICSSTATUS"></a>
+     * \brief Enumeration to specify whether the basic statistics of the table can be used instead of a scan of the values
+     */
+    enum BasicStatisticsStatus
+    {
+        basicStatisticsProvided = 0, /*!< Default: the basic statistics, if any, are set by the user and are used as they are */
+        basicStatisticsActual   = 1, /*!< The basic statistics are computed from the current values of the table */
+        basicStatisticsOutdated = 2  /*!< The basic statistics were computed, but the values of the table changed since then */
+    };
+
     /**
      * <a name="DAAL-ENUM-DATA_MANAGEMENT__STORAGELAYOUT"></a>
      * \brief Storage layouts that may need to be supported
@@ -658,11 +681,13 @@ public:
      */
     DAAL_DEPRECATED NumericTable(NumericTableDictionary * ddict)
     {
-        _obsnum            = 0;
-        _ddict             = NumericTableDictionaryPtr(ddict, services::EmptyDeleter());
-        _layout            = layout_unknown;
-        _memStatus         = notAllocated;
-        _normalizationFlag = NumericTable::nonNormalized;
+        _obsnum                = 0;
+        _ddict                 = NumericTableDictionaryPtr(ddict, services::EmptyDeleter());
+        _layout                = layout_unknown;
+        _memStatus             = notAllocated;
+        _normalizationFlag     = NumericTable::nonNormalized;
+        _finitenessStatus      = NumericTable::finitenessUnknown;
+        _basicStatisticsStatus = NumericTable::basicStatisticsProvided;
     }
 
     /**
@@ -671,11 +696,13 @@ public:
      */
     NumericTable(NumericTableDictionaryPtr ddict)
     {
-        _obsnum            = 0;
-        _ddict             = ddict;
-        _layout            = layout_unknown;
-        _memStatus         = notAllocated;
-        _normalizationFlag = NumericTable::nonNormalized;
+        _obsnum                = 0;
+        _ddict                 = ddict;
+        _layout                = layout_unknown;
+        _memStatus             = notAllocated;
+        _normalizationFlag     = NumericTable::nonNormalized;
+        _finitenessStatus      = NumericTable::finitenessUnknown;
+        _basicStatisticsStatus = NumericTable::basicStatisticsProvided;
     }
 
     /**
@@ -686,11 +713,13 @@ public:
      */
     NumericTable(size_t featnum, size_t obsnum, DictionaryIface::FeaturesEqual featuresEqual = DictionaryIface::notEqual)
     {
-        _obsnum            = obsnum;
-        _ddict             = NumericTableDictionaryPtr(new NumericTableDictionary(featnum, featuresEqual));
-        _layout            = layout_unknown;
-        _memStatus         = notAllocated;
-        _normalizationFlag = NumericTable::nonNormalized;
+        _obsnum                = obsnum;
+        _ddict                 = NumericTableDictionaryPtr(new NumericTableDictionary(featnum, featuresEqual));
+        _layout                = layout_unknown;
+        _memStatus             = notAllocated;
+        _normalizationFlag     = NumericTable::nonNormalized;
+        _finitenessStatus      = NumericTable::finitenessUnknown;
+        _basicStatisticsStatus = NumericTable::basicStatisticsProvided;
     }
 
     /** \private */
@@ -711,6 +740,9 @@ public:
     virtual services::Status resize(size_t nrows) DAAL_C11_OVERRIDE
     {
         size_t obsnum      = _obsnum;
+        /* the remaining rows of the table of finite values are finite */
+        if (nrows > obsnum || _finitenessStatus != allFinite) _finitenessStatus = finitenessUnknown;
+        outdateBasicStatistics();
         services::Status s = setNumberOfRowsImpl(nrows);
         if ((_memStatus != userAllocated && obsnum < nrows) || _memStatus == notAllocated)
         {
@@ -737,10 +769,17 @@ public:
 
     DAAL_DEPRECATED_VIRTUAL services::Status allocateDataMemory(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
     {
+        _finitenessStatus = finitenessUnknown;
+        outdateBasicStatistics();
         return allocateDataMemoryImpl(type);
     }
 
-    DAAL_DEPRECATED_VIRTUAL void freeDataMemory() DAAL_C11_OVERRIDE { freeDataMemoryImpl(); }
+    DAAL_DEPRECATED_VIRTUAL void freeDataMemory() DAAL_C11_OVERRIDE
+    {
+        _finitenessStatus = finitenessUnknown;
+        outdateBasicStatistics();
+        freeDataMemoryImpl();
+    }
 
     StorageLayout getDataLayout() const DAAL_C11_OVERRIDE { return _layout; }
 
@@ -796,6 +835,86 @@ public:
         return oldValue;
     }
 
+    /**
+     *  Returns the finiteness of the values in the numeric table set by the loading or the filling of the data,
+     *  so the values are not scanned again
+     *  \return Finiteness status of the values
+     */
+    FinitenessStatus getFinitenessStatus() const { return _finitenessStatus; }
+
+    /**
+     *  Sets the finiteness of the values in the numeric table. The status is reset when the table is resized or its blocks
+     *  are accessed for writing, the code that modifies the memory of the table directly is expected to reset it
+     *  \param[in] status Finiteness status of the values
+     *  \return Previous value of the finiteness status
+     */
+    FinitenessStatus setFinitenessStatus(FinitenessStatus status)
+    {
+        FinitenessStatus oldValue = _finitenessStatus;
+        _finitenessStatus         = status;
+        return oldValue;
+    }
+
+    /**
+     *  Returns whether the basic statistics of the table can be used instead of a scan of the values
+     *  \return Status of the basic statistics
+     */
+    BasicStatisticsStatus getBasicStatisticsStatus() const { return _basicStatisticsStatus; }
+
+    /**
+     *  Sets the status of the basic statistics of the table. The actual statistics become outdated when the table is resized
+     *  or its blocks are accessed for writing, the code that modifies the memory of the table directly is expected to reset it
+     *  \param[in] status Status of the basic statistics
+     *  \return Previous value of the status
+     */
+    BasicStatisticsStatus setBasicStatisticsStatus(BasicStatisticsStatus status)
+    {
+        BasicStatisticsStatus oldValue = _basicStatisticsStatus;
+        _basicStatisticsStatus         = status;
+        return oldValue;
+    }
+
+    /**
+     *  Returns the basic statistics of the columns to use instead of a scan of the values
+     *  \param[in] id Identifier of the basic statistics
+     *  \return Table of the statistics, or an empty pointer if they are not available or outdated
+     */
+    services::SharedPtr<NumericTable> getActualBasicStatistics(BasicStatisticsId id)
+    {
+        if (_basicStatisticsStatus == basicStatisticsOutdated) return services::SharedPtr<NumericTable>();
+        return basicStatistics.get(id);
+    }
+
+    /**
+     *  Computes the minimums, the maximums, the sums and the sums of squares of the columns in one pass over the values,
+     *  stores them in the basic statistics and marks them actual, so the algorithms that need them use the stored values
+     *  instead of another pass. The finiteness status of the table is set in the same pass.
+     *  The statistics are not computed again if they are already actual
+     *  \return Status of the computation
+     */
+    services::Status computeBasicStatistics();
+
+    /**
+     *  Returns the finiteness of the value
+     *  \param[in] value Value to check
+     *  \return Finiteness status of the table filled with the value
+     */
+    template <typename T>
+    static FinitenessStatus getValueFiniteness(T value)
+    {
+        union
+        {
+            double value;
+            DAAL_UINT64 bits;
+        } converted;
+        converted.value = (double)value;
+
+        const DAAL_UINT64 expMask  = 0x7ff0000000000000uLL;
+        const DAAL_UINT64 fracMask = 0x000fffffffffffffuLL;
+        if ((converted.bits & expMask) != expMask) return allFinite;
+        return (converted.bits & fracMask) ? finiteOrNaN : notFinite;
+    }
+
     /**
      *  Returns errors during the computation
      *  \return Errors during the computation
@@ -905,20 +1024,51 @@ protected:
 
     NormalizationType _normalizationFlag;
 
+    FinitenessStatus _finitenessStatus;
+
+    BasicStatisticsStatus _basicStatisticsStatus;
+
     services::Status _status;
 
 protected:
     NumericTable(NumericTableDictionaryPtr ddict, services::Status & /*st*/)
-        : _ddict(ddict), _obsnum(0), _memStatus(notAllocated), _layout(layout_unknown), _normalizationFlag(NumericTable::nonNormalized)
+        : _ddict(ddict),
+          _obsnum(0),
+          _memStatus(notAllocated),
+          _layout(layout_unknown),
+          _normalizationFlag(NumericTable::nonNormalized),
+          _finitenessStatus(NumericTable::finitenessUnknown),
+          _basicStatisticsStatus(NumericTable::basicStatisticsProvided)
     {}
 
     NumericTable(size_t featnum, size_t obsnum, DictionaryIface::FeaturesEqual featuresEqual, services::Status & st)
-        : _obsnum(obsnum), _memStatus(notAllocated), _layout(layout_unknown), _normalizationFlag(NumericTable::nonNormalized)
+        : _obsnum(obsnum),
+          _memStatus(notAllocated),
+          _layout(layout_unknown),
+          _normalizationFlag(NumericTable::nonNormalized),
+          _finitenessStatus(NumericTable::finitenessUnknown),
+          _basicStatisticsStatus(NumericTable::basicStatisticsProvided)
     {
         _ddict = NumericTableDictionary::create(featnum, featuresEqual, &st);
         if (!st) return;
     }
 
+    /** Resets the finiteness status and outdates the computed basic statistics if the values are accessed for writing */
+    void resetFinitenessStatus(int rwFlag)
+    {
+        if (rwFlag & (int)writeOnly)
+        {
+            _finitenessStatus = finitenessUnknown;
+            outdateBasicStatistics();
+        }
+    }
+
+    /** Marks the basic statistics computed from the values outdated, the statistics provided by the user are kept */
+    void outdateBasicStatistics()
+    {
+        if (_basicStatisticsStatus == basicStatisticsActual) _basicStatisticsStatus = basicStatisticsOutdated;
+    }
+
     virtual services::Status setNumberOfColumnsImpl(size_t ncol) { return _ddict->setNumberOfFeatures(ncol); }
 
     virtual services::Status setNumberOfRowsImpl(size_t nrow)
@@ -963,7 +1113,9 @@ protected:
 
         if (onDeserialize)
         {
-            _memStatus = notAllocated;
+            _memStatus        = notAllocated;
+            _finitenessStatus = finitenessUnknown;
+            outdateBasicStatistics();
         }
 
         arch->set(_layout);
@@ -985,6 +1137,8 @@ private:
             array[i] = value;
         }
         releaseBlockOfRows(block);
+        _finitenessStatus = getValueFiniteness(value);
+        outdateBasicStatistics();
         return services::Status();
     }
 };
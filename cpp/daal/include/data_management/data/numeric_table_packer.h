@@ -0,0 +1,132 @@
+/* file: numeric_table_packer.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __NUMERIC_TABLE_PACKER_H__
+#define __NUMERIC_TABLE_PACKER_H__
+
+#include "services/daal_defines.h"
+#include "services/collection.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * <a name="DAAL-ENUM-DATA_MANAGEMENT__PACKEDVALUETYPE"></a>
+ * \brief Types of the values of the numeric tables in the packed buffer
+ */
+enum PackedValueType
+{
+    packedFloat64 = 0, /*!< 64-bit floating-point values */
+    packedFloat32 = 1, /*!< 32-bit floating-point values, for example, for the partial sums that do not need the double precision */
+    packedInt32   = 2  /*!< 32-bit integer values, for example, for the numbers of observations */
+};
+
+/**
+ * <a name="DAAL-ENUM-DATA_MANAGEMENT__PACKEDLAYOUT"></a>
+ * \brief Layouts of the values of the numeric tables in the packed buffer
+ */
+enum PackedLayout
+{
+    packedFull          = 0, /*!< All values of the table row by row */
+    packedUpperTriangle = 1  /*!< Upper triangle of the symmetric square table row by row, the lower triangle is restored on unpacking */
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__NUMERICTABLEPACKER"></a>
+ *  \brief Packs the values of the numeric tables into the buffer without any metadata and unpacks them back into the tables.
+ *  The packer is intended for the exchange of the partial results of the distributed algorithms, where the receiver
+ *  knows the dimensions of the tables: the receiver allocates the tables of the partial results once and unpacks every
+ *  received buffer into them in place.
+ */
+class DAAL_EXPORT NumericTablePacker
+{
+public:
+    DAAL_NEW_DELETE();
+
+    NumericTablePacker() : _packedSize(0) {}
+
+    /**
+     *  Adds the table to the end of the packed buffer
+     *  \param[in] table    Numeric table, the dimensions of the table must not change until the packer is used
+     *  \param[in] type     Type of the values of the table in the packed buffer
+     *  \param[in] layout   Layout of the values of the table in the packed buffer
+     *  \return Status of the operation
+     */
+    services::Status add(const NumericTablePtr & table, PackedValueType type = packedFloat64, PackedLayout layout = packedFull);
+
+    /**
+     *  Returns the number of the tables in the packer
+     *  \return Number of the tables
+     */
+    size_t getNumberOfTables() const { return _entries.size(); }
+
+    /**
+     *  Returns the size of the packed buffer in bytes
+     *  \return Size of the packed buffer
+     */
+    size_t getPackedSize() const { return _packedSize; }
+
+    /**
+     *  Packs the values of the tables into the buffer
+     *  \param[out] buffer  Buffer of getPackedSize() bytes
+     *  \param[in]  size    Size of the buffer in bytes
+     *  \return Status of the operation
+     */
+    services::Status pack(byte * buffer, size_t size) const;
+
+    /**
+     *  Unpacks the values from the buffer into the tables, the values are written directly into the memory of the
+     *  homogeneous tables of the same value type
+     *  \param[in] buffer  Buffer packed by the packer of the tables of the same dimensions, types and layouts
+     *  \param[in] size    Size of the buffer in bytes
+     *  \return Status of the operation
+     */
+    services::Status unpack(const byte * buffer, size_t size) const;
+
+private:
+    struct Entry
+    {
+        Entry() : type(packedFloat64), layout(packedFull), nValues(0) {}
+
+        NumericTablePtr table;
+        PackedValueType type;
+        PackedLayout layout;
+        size_t nValues;
+    };
+
+    services::Collection<Entry> _entries;
+    size_t _packedSize;
+};
+
+} // namespace interface1
+using interface1::PackedValueType;
+using interface1::packedFloat64;
+using interface1::packedFloat32;
+using interface1::packedInt32;
+using interface1::PackedLayout;
+using interface1::packedFull;
+using interface1::packedUpperTriangle;
+using interface1::NumericTablePacker;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
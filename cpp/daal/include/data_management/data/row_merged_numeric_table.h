@@ -190,32 +190,34 @@ protected:
     }
 
 private:
+    /* Copies the rows of the nested table to the block of the rows starting from the row idx, the large blocks are copied in parallel */
     template <typename T>
-    void internal_inner_repack(size_t idx, size_t rows, size_t ncols, T * src, T * dst)
-    {
-        size_t i, j;
-
-        for (i = 0; i < rows; i++)
-        {
-            for (j = 0; j < ncols; j++)
-            {
-                dst[(idx + i) * ncols + j] = src[i * ncols + j];
-            }
-        }
-    }
+    void internal_inner_repack(size_t idx, size_t rows, size_t ncols, T * src, T * dst);
 
+    /* Copies the block of the rows starting from the row idx to the rows of the nested table, the large blocks are copied in parallel */
     template <typename T>
-    void internal_outer_repack(size_t idx, size_t rows, size_t ncols, T * src, T * dst)
-    {
-        size_t i, j;
+    void internal_outer_repack(size_t idx, size_t rows, size_t ncols, T * src, T * dst);
 
-        for (i = 0; i < rows; i++)
+    /* Returns the nested table that contains all the rows from idx to idx + nrows and the index of the first row in it,
+       or NULL if the rows belong to several tables */
+    NumericTable * getTableOfRows(size_t idx, size_t nrows, size_t & localIdx) const
+    {
+        size_t rows = 0;
+        for (size_t k = 0; k < _tables->size() && rows <= idx; k++)
         {
-            for (j = 0; j < ncols; j++)
+            NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
+            size_t lrows      = nt->getNumberOfRows();
+
+            if (rows + lrows > idx)
             {
-                dst[i * ncols + j] = src[(i + idx) * ncols + j];
+                if (nrows == 0 || idx + nrows > rows + lrows) return NULL;
+                localIdx = idx - rows;
+                return nt;
             }
+
+            rows += lrows;
         }
+        return NULL;
     }
 
 protected:
@@ -235,6 +237,16 @@ protected:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        /* the rows of one nested table are not copied, the block refers to the memory of the table */
+        size_t localIdx         = 0;
+        NumericTable * nestedNt = getTableOfRows(idx, nrows, localIdx);
+        if (nestedNt)
+        {
+            s = nestedNt->getBlockOfRows(localIdx, nrows, (ReadWriteMode)rwFlag, block);
+            block.setDetails(0, idx, rwFlag);
+            return s;
+        }
+
         if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
         if (rwFlag & (int)readOnly)
@@ -266,6 +278,14 @@ protected:
     template <typename T>
     services::Status releaseTBlock(BlockDescriptor<T> & block)
     {
+        size_t localIdx         = 0;
+        NumericTable * nestedNt = getTableOfRows(block.getRowsOffset(), block.getNumberOfRows(), localIdx);
+        if (nestedNt)
+        {
+            block.setDetails(0, localIdx, (int)block.getRWFlag());
+            return nestedNt->releaseBlockOfRows(block);
+        }
+
         services::Status s;
         if (block.getRWFlag() & (int)writeOnly)
         {
@@ -311,6 +331,16 @@ protected:
         }
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        size_t localIdx         = 0;
+        NumericTable * nestedNt = getTableOfRows(idx, nrows, localIdx);
+        if (nestedNt)
+        {
+            s = nestedNt->getBlockOfColumnValues(feat_idx, localIdx, nrows, (ReadWriteMode)rwFlag, block);
+            block.setDetails(feat_idx, idx, rwFlag);
+            return s;
+        }
+
         if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
         if (rwFlag & (int)readOnly)
@@ -332,7 +362,7 @@ protected:
                     T * location = innerBlock.getBlockPtr();
                     for (size_t i = idxBegin; i < idxEnd; i++)
                     {
-                        buffer[i] = location[i - idxBegin];
+                        buffer[i - idx] = location[i - idxBegin];
                     }
                     s |= nt->releaseBlockOfColumnValues(innerBlock);
                 }
@@ -346,6 +376,14 @@ protected:
     template <typename T>
     services::Status releaseTFeature(BlockDescriptor<T> & block)
     {
+        size_t localIdx         = 0;
+        NumericTable * nestedNt = getTableOfRows(block.getRowsOffset(), block.getNumberOfRows(), localIdx);
+        if (nestedNt)
+        {
+            block.setDetails(block.getColumnsOffset(), localIdx, (int)block.getRWFlag());
+            return nestedNt->releaseBlockOfColumnValues(block);
+        }
+
         services::Status s;
         if (block.getRWFlag() & (int)writeOnly)
         {
@@ -369,7 +407,7 @@ protected:
                     T * location = innerBlock.getBlockPtr();
                     for (size_t i = idxBegin; i < idxEnd; i++)
                     {
-                        location[i - idxBegin] = buffer[i];
+                        location[i - idxBegin] = buffer[i - idx];
                     }
                     s |= nt->releaseBlockOfColumnValues(innerBlock);
                 }
@@ -128,7 +128,8 @@ public:
                 _arraysInitialized--;
             }
 
-            _arrays[idx] = services::reinterpretPointerCast<byte, T>(ptr);
+            _arrays[idx]      = services::reinterpretPointerCast<byte, T>(ptr);
+            _finitenessStatus = finitenessUnknown;
         }
         else
         {
@@ -367,6 +368,7 @@ protected:
         size_t ncols = getNumberOfColumns();
         size_t nobs  = getNumberOfRows();
         block.setDetails(0, idx, rwFlag);
+        resetFinitenessStatus(rwFlag);
 
         if (idx >= nobs)
         {
@@ -397,28 +399,28 @@ protected:
         }
         if (!computed)
         {
-            size_t di = 32;
-            T lbuf[32];
+            /* the consecutive columns of the same type are copied into the rows of the block by one transposition kernel */
+            const void * columns[internal::layoutConversionMaxColumns];
 
-            for (size_t i = 0; i < nrows; i += di)
+            for (size_t i = 0; i < nrows; i += internal::layoutConversionBlockRows)
             {
-                if (i + di > nrows)
-                {
-                    di = nrows - i;
-                }
+                const size_t di = (i + internal::layoutConversionBlockRows < nrows) ? internal::layoutConversionBlockRows : nrows - i;
 
-                for (size_t j = 0; j < ncols; ++j)
+                for (size_t j = 0; j < ncols;)
                 {
                     NumericTableFeature & f = (*_ddict)[j];
 
-                    char * ptr = (char *)_arrays[j].get() + (idx + i) * f.typeSize;
-
-                    internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(di, ptr, lbuf);
-
-                    for (size_t k = 0; k < di; ++k)
+                    size_t nRunCols = 0;
+                    while (j + nRunCols < ncols && nRunCols < internal::layoutConversionMaxColumns
+                           && (*_ddict)[j + nRunCols].indexType == f.indexType)
                     {
-                        buffer[(i + k) * ncols + j] = lbuf[k];
+                        columns[nRunCols] = (char *)_arrays[j + nRunCols].get() + (idx + i) * f.typeSize;
+                        ++nRunCols;
                     }
+
+                    internal::getVectorColumnsToRowsUpCast(f.indexType, internal::getConversionDataType<T>())(di, nRunCols, columns, f.typeSize,
+                                                                                                            buffer + i * ncols + j, ncols);
+                    j += nRunCols;
                 }
             }
         }
@@ -434,31 +436,30 @@ protected:
             size_t ncols = getNumberOfColumns();
             size_t nrows = block.getNumberOfRows();
             size_t idx   = block.getRowsOffset();
-            T lbuf[32];
-
-            size_t di = 32;
+            void * columns[internal::layoutConversionMaxColumns];
 
             T * blockPtr = block.getBlockPtr();
 
-            for (size_t i = 0; i < nrows; i += di)
+            for (size_t i = 0; i < nrows; i += internal::layoutConversionBlockRows)
             {
-                if (i + di > nrows)
-                {
-                    di = nrows - i;
-                }
+                const size_t di = (i + internal::layoutConversionBlockRows < nrows) ? internal::layoutConversionBlockRows : nrows - i;
 
-                for (size_t j = 0; j < ncols; j++)
+                for (size_t j = 0; j < ncols;)
                 {
                     NumericTableFeature & f = (*_ddict)[j];
 
-                    char * ptr = (char *)_arrays[j].get() + (idx + i) * f.typeSize;
-
-                    for (size_t ii = 0; ii < di; ii++)
+                    size_t nRunCols = 0;
+                    while (j + nRunCols < ncols && nRunCols < internal::layoutConversionMaxColumns
+                           && (*_ddict)[j + nRunCols].indexType == f.indexType)
                     {
-                        lbuf[ii] = blockPtr[(i + ii) * ncols + j];
+                        columns[nRunCols] = (char *)_arrays[j + nRunCols].get() + (idx + i) * f.typeSize;
+                        ++nRunCols;
                     }
 
-                    internal::getVectorDownCast(f.indexType, internal::getConversionDataType<T>())(di, lbuf, ptr);
+                    const T * rows = blockPtr + i * ncols + j;
+                    internal::getVectorRowsToColumnsDownCast(f.indexType, internal::getConversionDataType<T>())(di, nRunCols, rows, ncols, columns,
+                                                                                                              f.typeSize);
+                    j += nRunCols;
                 }
             }
         }
@@ -471,6 +472,7 @@ protected:
     {
         size_t nobs = getNumberOfRows();
         block.setDetails(feat_idx, idx, rwFlag);
+        resetFinitenessStatus(rwFlag);
 
         if (idx >= nobs)
         {
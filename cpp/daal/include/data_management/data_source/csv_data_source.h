@@ -30,6 +30,7 @@
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/internal/finiteness_checker.h"
 #include "data_management/data_source/internal/data_source_options.h"
 
 namespace daal
@@ -129,6 +130,7 @@ public:
 
     virtual ~CsvDataSource()
     {
+        this->stopPrefetching();
         daal::services::daal_free(_rawLineBuffer);
         _rawLineBuffer = NULL;
     }
@@ -212,6 +214,17 @@ public:
 
         nt->releaseBlockOfRows(block);
 
+        NumericTable::FinitenessStatus loadedStatus = NumericTable::allFinite;
+        bool statisticsAreActual                    = true;
+        for (size_t i = 0; i < tables.size(); i++)
+        {
+            const NumericTable * ntCurrent = (const NumericTable *)(tables[i].get());
+            loadedStatus                   = internal::combineFinitenessStatus(loadedStatus, ntCurrent->getFinitenessStatus());
+            statisticsAreActual &= (ntCurrent->getBasicStatisticsStatus() == NumericTable::basicStatisticsActual);
+        }
+        setLoadedFinitenessStatus(nt, loadedStatus);
+        setLoadedBasicStatisticsStatus(nt, statisticsAreActual);
+
         if (result)
         {
             this->_status.add(services::throwIfPossible(services::Status(services::ErrorMemoryCopyFailedInternal)));
@@ -223,6 +236,8 @@ public:
     {
         size_t nLines = loadDataBlock(maxRows, 0, maxRows, nt);
         nt->resize(nLines);
+        setLoadedFinitenessStatus(nt, _loadedFinitenessStatus);
+        setLoadedBasicStatisticsStatus(nt, true);
         return nLines;
     }
 
@@ -267,37 +282,67 @@ public:
             _firstRowRead = true;
         }
 
-        size_t j = 0;
+        size_t j                = 0;
+        _loadedFinitenessStatus = NumericTable::allFinite;
 
         BlockDescriptor<DAAL_DATA_TYPE> ntBlock;
         nt->getBlockOfRows(0, nt->getNumberOfRows(), readWrite, ntBlock);
 
-        for (; j < maxRows && !iseof(); j++)
+        const size_t ncols   = nt->getNumberOfColumns();
+        bool isLastLineEmpty = false;
+        while (j < maxRows && !iseof() && !isLastLineEmpty)
         {
-            s = readLine();
+            /* the lines are read one by one and parsed by the blocks */
+            _rowBlock.clear();
+            while (j + _rowBlock.size() < maxRows && _rowBlock.size() < rowsInParsingBlock && !iseof())
+            {
+                s = readLine();
+                if (!s)
+                {
+                    this->_status.add(services::throwIfPossible(s));
+
+                    return 0;
+                }
+                if (!_rawLineLength)
+                {
+                    isLastLineEmpty = true;
+                    break;
+                }
+                s = _rowBlock.addRow(_rawLineBuffer, _rawLineLength);
+                if (!s)
+                {
+                    this->_status.add(services::throwIfPossible(s));
+                    return 0;
+                }
+            }
+
+            DAAL_DATA_TYPE * blockRows = ntBlock.getBlockPtr() + (rowOffset + j) * ncols;
+            s                          = _featureManager.parseRowsIn(_rowBlock, this->_dict.get(), blockRows, ncols, rowOffset + j);
             if (!s)
             {
                 this->_status.add(services::throwIfPossible(s));
-
                 return 0;
             }
-            if (!_rawLineLength)
-            {
-                break;
-            }
 
-            services::BufferView<DAAL_DATA_TYPE> rowBuffer(ntBlock.getBlockPtr() + (rowOffset + j) * nt->getNumberOfColumns(),
-                                                           ntBlock.getNumberOfColumns());
-
-            _featureManager.parseRowIn(_rawLineBuffer, _rawLineLength, this->_dict.get(), rowBuffer, rowOffset + j);
+            for (size_t i = 0; i < _rowBlock.size(); i++, j++)
+            {
+                /* the finiteness of the table is computed while the parsed rows are in cache */
+                _loadedFinitenessStatus =
+                    internal::combineFinitenessStatus(_loadedFinitenessStatus, internal::getFinitenessStatus(blockRows + i * ncols, ncols));
 
-            super::updateStatistics(j, nt, ntBlock.getBlockPtr(), rowOffset);
+                super::updateStatistics(j, nt, ntBlock.getBlockPtr(), rowOffset);
+            }
         }
 
         nt->releaseBlockOfRows(ntBlock);
 
         _featureManager.finalize(this->_dict.get());
 
+        /* the status is known when the loaded rows fill the table */
+        if (rowOffset != 0) _loadedFinitenessStatus = NumericTable::finitenessUnknown;
+        if (j == nt->getNumberOfRows()) setLoadedFinitenessStatus(nt, _loadedFinitenessStatus);
+        setLoadedBasicStatisticsStatus(nt, rowOffset == 0 && j == nt->getNumberOfRows());
+
         return rowOffset + j;
     }
 
@@ -387,6 +432,45 @@ protected:
         return services::Status();
     }
 
+    /**
+     *  Sets the finiteness status of the values parsed into the table. The non-finite values are not kept by the tables
+     *  of integer features, so the status of such tables is set only if all the values are finite
+     */
+    void setLoadedFinitenessStatus(NumericTable * nt, NumericTable::FinitenessStatus status) const
+    {
+        if (status != NumericTable::allFinite)
+        {
+            NumericTableDictionaryPtr ntDict = nt->getDictionarySharedPtr();
+            const size_t nFeatures           = nt->getNumberOfColumns();
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                const features::IndexNumType indexType = (*ntDict)[i].indexType;
+                if (indexType != features::DAAL_FLOAT32 && indexType != features::DAAL_FLOAT64) return;
+            }
+        }
+        nt->setFinitenessStatus(status);
+    }
+
+    /**
+     *  Sets the status of the basic statistics computed while the values were parsed into the table. They are actual if
+     *  they cover all the rows of the table. The tables of integer features keep the truncated values, so the statistics
+     *  of the parsed values are not actual for them
+     */
+    void setLoadedBasicStatisticsStatus(NumericTable * nt, bool allRowsLoaded) const
+    {
+        if (allRowsLoaded)
+        {
+            NumericTableDictionaryPtr ntDict = nt->getDictionarySharedPtr();
+            const size_t nFeatures           = nt->getNumberOfColumns();
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                const features::IndexNumType indexType = (*ntDict)[i].indexType;
+                if (indexType != features::DAAL_FLOAT32 && indexType != features::DAAL_FLOAT64) allRowsLoaded = false;
+            }
+        }
+        nt->setBasicStatisticsStatus(allRowsLoaded ? NumericTable::basicStatisticsActual : NumericTable::basicStatisticsOutdated);
+    }
+
     bool enlargeBuffer()
     {
         int newRawLineBufferLen = _rawLineBufferLen * 2;
@@ -412,6 +496,8 @@ private:
         _rawLineLength   = 0;
         _initialMaxRows  = initialMaxRows;
 
+        _loadedFinitenessStatus = NumericTable::finitenessUnknown;
+
         _rawLineBufferLen = (int)INITIAL_LINE_BUFFER_LENGTH;
         _rawLineBuffer    = (char *)daal::services::daal_malloc(_rawLineBufferLen);
         if (!_rawLineBuffer)
@@ -427,11 +513,16 @@ protected:
     int _rawLineBufferLen;
     int _rawLineLength;
 
+    /* The largest number of the lines parsed together */
+    static const size_t rowsInParsingBlock = 4096;
+    internal::StringRowBlock _rowBlock;
+
 private:
     bool _parseHeader;
     bool _firstRowRead;
     bool _contextDictFlag;
     FeatureManager _featureManager;
+    NumericTable::FinitenessStatus _loadedFinitenessStatus;
 
     static const size_t INITIAL_LINE_BUFFER_LENGTH = 1024;
 };
@@ -479,6 +479,56 @@ public:
         }
     }
 
+    /**
+     *  Parses the strings of the block of feature vectors in parallel if the features are continuous, categorical or
+     *  filtered out, the categorical features are converted to the codes of the categories in their dictionaries.
+     *  Otherwise the strings are parsed one by one by parseRowIn()
+     *  \param[in]  rowBlock     The block of the strings that represent the feature vectors, the strings are modified
+     *  \param[in]  dictionary   Pointer to the dictionary
+     *  \param[out] rows         Array of rowBlock.size() rows of nColumns values to store the result of parsing
+     *  \param[in]  nColumns     Number of values in a row of the result
+     *  \param[in]  ntRowIndex   Position in the Numeric Table at which to store the result of parsing of the first string
+     */
+    virtual services::Status parseRowsIn(internal::StringRowBlock & rowBlock, DataSourceDictionary * dictionary, DAAL_DATA_TYPE * rows,
+                                         size_t nColumns, size_t ntRowIndex) DAAL_C11_OVERRIDE
+    {
+        const size_t nTokens = (_numberOfTokens < funcList.size()) ? _numberOfTokens : funcList.size();
+        if (_modifiersManager || rowBlock.size() < 2 || nTokens == 0)
+        {
+            return StringRowFeatureManagerIface::parseRowsIn(rowBlock, dictionary, rows, nColumns, ntRowIndex);
+        }
+
+        services::Collection<internal::CSVTokenKind> kinds(nTokens);
+        services::Collection<size_t> positions(nTokens);
+        services::Collection<DataSourceFeature *> features(nTokens);
+        if (!kinds.data() || !positions.data() || !features.data()) return services::Status(services::ErrorMemoryAllocationFailed);
+
+        for (size_t i = 0; i < nTokens; i++)
+        {
+            if (funcList[i] == ModifierIface::contFunc)
+            {
+                kinds[i] = internal::csvContinuousToken;
+            }
+            else if (funcList[i] == ModifierIface::catFunc)
+            {
+                kinds[i] = internal::csvCategoricalToken;
+            }
+            else if (funcList[i] == ModifierIface::nullFunc)
+            {
+                kinds[i] = internal::csvSkippedToken;
+            }
+            else
+            {
+                /* The one-hot encoding and the custom modifiers are applied row by row */
+                return StringRowFeatureManagerIface::parseRowsIn(rowBlock, dictionary, rows, nColumns, ntRowIndex);
+            }
+            positions[i] = auxVect[i].idx;
+            features[i]  = auxVect[i].dsFeat;
+        }
+
+        return internal::parseCSVRowBlock(rowBlock, _delimiter, nTokens, kinds.data(), positions.data(), features.data(), rows, nColumns);
+    }
+
     /**
      * Finalizes CSV data parsing
      * \param[in]  dictionary  Pointer to the dictionary
@@ -31,6 +31,7 @@
 #include "data_management/data/soa_numeric_table.h"
 
 #include "data_management/data_source/data_source_utils.h"
+#include "data_management/data_source/internal/data_source_prefetcher.h"
 
 namespace daal
 {
@@ -199,7 +200,8 @@ public:
           _autoNumericTableFlag(doAllocateNumericTable),
           _autoDictionaryFlag(doDictionaryFromContext),
           _errors(new services::ErrorCollection()),
-          _initialMaxRows(10)
+          _initialMaxRows(10),
+          _prefetching(false)
     {}
 
     virtual ~DataSource() {}
@@ -243,9 +245,28 @@ public:
             this->_status.add(services::throwIfPossible(s));
             return 0;
         }
+        if (_prefetching || _prefetcher.isStarted())
+        {
+            return loadPrefetchedDataBlock(maxRows);
+        }
         return loadDataBlock(maxRows, this->DataSource::_spnt.get());
     }
 
+    /**
+     *  Enables or disables the asynchronous mode of loadDataBlock(maxRows). In this mode the next block of maxRows rows
+     *  is loaded into another Numeric Table by a task of the threading layer while the caller processes the current block,
+     *  so getNumericTable() returns a different table after each call of loadDataBlock(maxRows).
+     *  No other method of the Data Source can be called until the next call of loadDataBlock(maxRows).
+     *  The block loaded in background is returned even if the mode is disabled or maxRows is changed
+     *  \param[in] enable  True to load the blocks asynchronously
+     */
+    void setPrefetching(bool enable) { _prefetching = enable; }
+
+    /**
+     *  Returns true if the blocks are loaded asynchronously by loadDataBlock(maxRows)
+     */
+    bool getPrefetching() const { return _prefetching; }
+
     size_t loadDataBlock(size_t /*maxRows*/, NumericTable * /*nt*/) DAAL_C11_OVERRIDE
     {
         this->_status.add(services::throwIfPossible(services::ErrorMethodNotSupported));
@@ -334,6 +355,54 @@ protected:
     services::SharedPtr<services::ErrorCollection> _errors;
     size_t _initialMaxRows;
 
+    bool _prefetching;
+    NumericTablePtr _prefetchedNt;
+    internal::DataSourcePrefetcher _prefetcher;
+
+    /**
+     *  Waits for the block loaded in background, the data sources that use loadDataBlock(maxRows)
+     *  call it in their destructors before their state is destroyed
+     */
+    void stopPrefetching() { _prefetcher.wait(); }
+
+    /**
+     *  Returns the block loaded in background into the Numeric Table of the Data Source and starts loading of the next block
+     */
+    size_t loadPrefetchedDataBlock(size_t maxRows)
+    {
+        size_t nRows = 0;
+        if (_prefetcher.isStarted())
+        {
+            nRows = _prefetcher.wait();
+
+            NumericTablePtr loadedNt = _prefetchedNt;
+            _prefetchedNt            = _spnt;
+            _spnt                    = loadedNt;
+        }
+        else
+        {
+            nRows = loadDataBlock(maxRows, _spnt.get());
+        }
+
+        if (_prefetching && nRows > 0 && getStatus() == readyForLoad)
+        {
+            services::Status s;
+            if (!_prefetchedNt)
+            {
+                NumericTablePtr currentNt = _spnt;
+                _spnt.reset();
+                s             = allocateNumericTable();
+                _prefetchedNt = _spnt;
+                _spnt         = currentNt;
+            }
+            if (s && _prefetchedNt)
+            {
+                _prefetcher.start(*this, maxRows, _prefetchedNt.get());
+            }
+        }
+        return nRows;
+    }
+
     /**
      * Checks a Numeric Table
      */
@@ -26,6 +26,7 @@
 
 #include "data_management/data_source/data_source_dictionary.h"
 #include "data_management/data/numeric_table.h"
+#include "data_management/data_source/internal/string_row_block.h"
 
 namespace daal
 {
@@ -65,6 +66,26 @@ public:
      */
     virtual void parseRowIn(char * rawRowData, size_t rawDataSize, DataSourceDictionary * dict, services::BufferView<DAAL_DATA_TYPE> & rowBuffer,
                             size_t ntRowIndex) = 0;
+
+    /**
+     *  Parses the strings of the block of feature vectors and converts them into a numeric representation.
+     *  The default implementation parses the strings one by one by parseRowIn()
+     *  \param[in]  rowBlock     The block of the strings that represent the feature vectors, the strings can be modified
+     *  \param[in]  dict         Pointer to the dictionary
+     *  \param[out] rows         Array of rowBlock.size() rows of nColumns values to store the result of parsing
+     *  \param[in]  nColumns     Number of values in a row of the result
+     *  \param[in]  ntRowIndex   Position in the Numeric Table at which to store the result of parsing of the first string
+     */
+    virtual services::Status parseRowsIn(internal::StringRowBlock & rowBlock, DataSourceDictionary * dict, DAAL_DATA_TYPE * rows, size_t nColumns,
+                                         size_t ntRowIndex)
+    {
+        for (size_t i = 0; i < rowBlock.size(); i++)
+        {
+            services::BufferView<DAAL_DATA_TYPE> rowBuffer(rows + i * nColumns, nColumns);
+            parseRowIn(rowBlock.getRow(i), rowBlock.getRowSize(i), dict, rowBuffer, ntRowIndex + i);
+        }
+        return services::Status();
+    }
 };
 /** @} */
 } // namespace interface1
@@ -93,6 +93,7 @@ public:
 
     virtual ~FileDataSource()
     {
+        this->stopPrefetching();
         if (_file) fclose(_file);
         daal::services::daal_free(_fileBuffer);
     }
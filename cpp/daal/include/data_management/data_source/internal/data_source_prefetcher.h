@@ -0,0 +1,85 @@
+/* file: data_source_prefetcher.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __DATA_SOURCE_INTERNAL_DATA_SOURCE_PREFETCHER_H__
+#define __DATA_SOURCE_INTERNAL_DATA_SOURCE_PREFETCHER_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+class DataSourceIface;
+class NumericTable;
+} // namespace interface1
+
+namespace internal
+{
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INTERNAL__DATASOURCEPREFETCHER"></a>
+ *  \brief Loads the block of rows from the data source into the numeric table by the task
+ *         of the threading layer, so the block is loaded while the caller processes the previous one
+ */
+class DAAL_EXPORT DataSourcePrefetcher : public Base
+{
+public:
+    DataSourcePrefetcher();
+
+    virtual ~DataSourcePrefetcher();
+
+    /**
+     *  Starts loading of the block of rows, neither the data source nor the numeric table
+     *  can be accessed until wait() returns
+     *  \param[in] source   The data source to load the rows from
+     *  \param[in] maxRows  Maximum number of rows to load
+     *  \param[in] nt       The numeric table to load the rows into
+     */
+    void start(interface1::DataSourceIface & source, size_t maxRows, interface1::NumericTable * nt);
+
+    /**
+     *  Waits for the loading started by start() to finish
+     *  \return The number of loaded rows, zero if the loading was not started
+     */
+    size_t wait();
+
+    /**
+     *  Returns true if the loading was started and was not waited for
+     */
+    bool isStarted() const { return _isStarted; }
+
+    /**
+     *  The copy of the prefetcher does not share the loading started by the original one
+     */
+    DataSourcePrefetcher(const DataSourcePrefetcher &) : Base(), _taskGroup(NULL), _nLoadedRows(0), _isStarted(false) {}
+
+    DataSourcePrefetcher & operator=(const DataSourcePrefetcher &) { return *this; }
+
+private:
+    void * _taskGroup;
+    size_t _nLoadedRows;
+    bool _isStarted;
+};
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -156,7 +156,8 @@ private:
 /**
  * <a name="DAAL-CLASS-DATA_MANAGEMENT__INTERNAL__SQLFETCHBUFFER"></a>
  * \brief Class hold buffer for fetching data from SQL table,
- *        simplifies binding of SQL table columns
+ *        simplifies binding of SQL table columns. The buffer holds the values of
+ *        rowArraySize rows bound by columns, so the rows are fetched by arrays
  */
 class SQLFetchBuffer : public Base
 {
@@ -164,9 +165,17 @@ public:
     static services::SharedPtr<SQLFetchBuffer> create(const SQLFeaturesInfo & featuresInfo, const SQLFetchMode::Value & mode,
                                                       services::Status * status = NULL)
     {
-        return services::internal::wrapSharedAndTryThrow(new SQLFetchBuffer(featuresInfo, mode, status), status);
+        return services::internal::wrapSharedAndTryThrow(new SQLFetchBuffer(featuresInfo, mode, 1, status), status);
     }
 
+    static services::SharedPtr<SQLFetchBuffer> create(const SQLFeaturesInfo & featuresInfo, const SQLFetchMode::Value & mode, size_t rowArraySize,
+                                                      services::Status * status = NULL)
+    {
+        return services::internal::wrapSharedAndTryThrow(new SQLFetchBuffer(featuresInfo, mode, rowArraySize, status), status);
+    }
+
+    size_t getRowArraySize() const { return _rowArraySize; }
+
     size_t getNumberOfFeatures() const
     {
         DAAL_ASSERT(_bufferOffsets.size() > 0);
@@ -182,23 +191,24 @@ public:
 
     SQLLEN * getActualDataSizeBufferForFeature(size_t featureIndex) const
     {
-        DAAL_ASSERT(featureIndex < _actualDataSizes.size());
-        return _actualDataSizes.offset(featureIndex);
+        DAAL_ASSERT(featureIndex * _rowArraySize < _actualDataSizes.size());
+        return _actualDataSizes.offset(featureIndex * _rowArraySize);
     }
 
+    /* Returns the size of the value of the feature in one row */
     SQLLEN getBufferSizeForFeature(size_t featureIndex) const
     {
         DAAL_ASSERT(_bufferOffsets.size() > 0);
         DAAL_ASSERT(featureIndex + 1 < _bufferOffsets.size());
         const size_t begin = _bufferOffsets[featureIndex];
         const size_t end   = _bufferOffsets[featureIndex + 1];
-        return (SQLLEN)(end - begin);
+        return (SQLLEN)((end - begin) / _rowArraySize);
     }
 
     SQLLEN getActualDataSizeForFeature(size_t featureIndex) const
     {
-        DAAL_ASSERT(featureIndex < _actualDataSizes.size());
-        return _actualDataSizes[featureIndex];
+        DAAL_ASSERT(featureIndex * _rowArraySize < _actualDataSizes.size());
+        return _actualDataSizes[featureIndex * _rowArraySize];
     }
 
     SQLFetchBufferFragment getFragment(size_t featureIndex) const
@@ -226,7 +236,25 @@ public:
                 targetBuffer[i] = *((DAAL_DATA_TYPE *)rawFetchBuffer);
             }
 
-            rawFetchBuffer += sizeof(DAAL_DATA_TYPE);
+            rawFetchBuffer += _rowArraySize * sizeof(DAAL_DATA_TYPE);
+        }
+    }
+
+    /* Copies nRows fetched rows starting from the row firstRow to the rows of the buffer with nColumns columns */
+    void copyRowsTo(DAAL_DATA_TYPE * targetBuffer, size_t nColumns, size_t firstRow, size_t nRows) const
+    {
+        DAAL_ASSERT(_mode == SQLFetchMode::castToFloatingPointType);
+        DAAL_ASSERT(firstRow + nRows <= _rowArraySize);
+
+        const size_t nFeatures = services::internal::minValue(nColumns, getNumberOfFeatures());
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const DAAL_DATA_TYPE * values = (const DAAL_DATA_TYPE *)_buffer.offset(_bufferOffsets[j]) + firstRow;
+            const SQLLEN * actualSizes    = _actualDataSizes.offset(j * _rowArraySize) + firstRow;
+            for (size_t i = 0; i < nRows; i++)
+            {
+                targetBuffer[i * nColumns + j] = (actualSizes[i] == SQL_NULL_DATA) ? DAAL_DATA_TYPE(0.0) : values[i];
+            }
         }
     }
 
@@ -234,7 +262,9 @@ private:
     SQLFetchBuffer(const SQLFetchBuffer &);
     SQLFetchBuffer & operator=(const SQLFetchBuffer &);
 
-    explicit SQLFetchBuffer(const SQLFeaturesInfo & featuresInfo, const SQLFetchMode::Value & mode, services::Status * status = NULL) : _mode(mode)
+    explicit SQLFetchBuffer(const SQLFeaturesInfo & featuresInfo, const SQLFetchMode::Value & mode, size_t rowArraySize,
+                            services::Status * status = NULL)
+        : _mode(mode), _rowArraySize(rowArraySize ? rowArraySize : 1)
     {
         services::internal::tryAssignStatusAndThrow(status, prepare(featuresInfo, mode));
     }
@@ -245,15 +275,18 @@ private:
 
         const size_t numberOfFeatures = featuresInfo.getNumberOfFeatures();
         DAAL_CHECK_STATUS(status, _bufferOffsets.reallocate(numberOfFeatures + 1));
-        DAAL_CHECK_STATUS(status, _actualDataSizes.reallocate(numberOfFeatures));
+        DAAL_CHECK_STATUS(status, _actualDataSizes.reallocate(numberOfFeatures * _rowArraySize));
 
         _bufferOffsets[0] = 0;
         for (size_t i = 0; i < numberOfFeatures; i++)
         {
             const size_t bufferStride = (mode == SQLFetchMode::useNativeSQLTypes) ? featuresInfo[i].sqlOctetLength : sizeof(DAAL_DATA_TYPE);
 
-            _bufferOffsets[i + 1] = _bufferOffsets[i] + bufferStride;
-            _actualDataSizes[i]   = 0;
+            _bufferOffsets[i + 1] = _bufferOffsets[i] + bufferStride * _rowArraySize;
+        }
+        for (size_t i = 0; i < numberOfFeatures * _rowArraySize; i++)
+        {
+            _actualDataSizes[i] = 0;
         }
 
         const size_t bufferSize = _bufferOffsets[numberOfFeatures];
@@ -264,6 +297,7 @@ private:
 
 private:
     const SQLFetchMode::Value _mode;
+    const size_t _rowArraySize;
     services::internal::PrimitiveCollection<char> _buffer;
     services::internal::PrimitiveCollection<SQLLEN> _bufferOffsets;
     services::internal::PrimitiveCollection<SQLLEN> _actualDataSizes;
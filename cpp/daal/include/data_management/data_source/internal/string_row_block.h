@@ -0,0 +1,119 @@
+/* file: string_row_block.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __DATA_SOURCE_INTERNAL_STRING_ROW_BLOCK_H__
+#define __DATA_SOURCE_INTERNAL_STRING_ROW_BLOCK_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+#include "data_management/data_source/data_source_dictionary.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INTERNAL__STRINGROWBLOCK"></a>
+ *  \brief Keeps the copies of the strings of the consecutive rows of the data source, so the rows are parsed together
+ */
+class DAAL_EXPORT StringRowBlock : public Base
+{
+public:
+    StringRowBlock();
+
+    virtual ~StringRowBlock();
+
+    /**
+     *  Appends the copy of the string to the block
+     *  \param[in]  rawRowData   Array of characters with the string that represents the row
+     *  \param[in]  rawDataSize  Size of the rawRowData array
+     */
+    services::Status addRow(const char * rawRowData, size_t rawDataSize);
+
+    /**
+     *  Returns the number of the rows in the block
+     */
+    size_t size() const { return _nRows; }
+
+    /**
+     *  Returns the string of the row terminated by the null character, the string can be modified by the parsing
+     */
+    char * getRow(size_t index) { return _data + _offsets[index]; }
+
+    /**
+     *  Returns the size of the string of the row
+     */
+    size_t getRowSize(size_t index) const { return _offsets[index + 1] - _offsets[index] - 1; }
+
+    /**
+     *  Removes the rows from the block, the memory is kept for the next rows
+     */
+    void clear()
+    {
+        _nRows = 0;
+        if (_offsets) _offsets[0] = 0;
+    }
+
+    /**
+     *  The copy of the block is empty, the rows are not shared
+     */
+    StringRowBlock(const StringRowBlock &) : Base(), _data(NULL), _dataCapacity(0), _offsets(NULL), _offsetsCapacity(0), _nRows(0) {}
+
+    StringRowBlock & operator=(const StringRowBlock &) { return *this; }
+
+private:
+    char * _data;
+    size_t _dataCapacity;
+    size_t * _offsets;
+    size_t _offsetsCapacity;
+    size_t _nRows;
+};
+
+/**
+ *  The kinds of the tokens of the row parsed by parseCSVRowBlock()
+ */
+enum CSVTokenKind
+{
+    csvSkippedToken     = 0, /*!< The token is not stored in the row */
+    csvContinuousToken  = 1, /*!< The token is converted to the number */
+    csvCategoricalToken = 2  /*!< The token is converted to the code of the category in the dictionary of the feature */
+};
+
+/**
+ *  Parses the CSV rows of the block in parallel. Every thread parses a range of the rows and collects the new categories
+ *  of the range in its own hash map, the maps are merged into the categorical dictionaries of the features once per block
+ *  in the order of the rows, so the codes and the counts of the categories are the same as of the row by row parsing
+ *  \param[in]  rowBlock    The block of the rows
+ *  \param[in]  delimiter   The delimiter of the tokens
+ *  \param[in]  nTokens     Number of the tokens of a row to parse
+ *  \param[in]  kinds       Array of nTokens kinds of the tokens
+ *  \param[in]  positions   Array of nTokens positions of the values of the tokens in the row of the result
+ *  \param[in]  features    Array of nTokens features of the tokens, the dictionaries of the categorical ones are updated
+ *  \param[out] rows        Array of the rowBlock.size() rows of nColumns values to store the result of parsing
+ *  \param[in]  nColumns    Number of values in a row of the result
+ */
+DAAL_EXPORT services::Status parseCSVRowBlock(StringRowBlock & rowBlock, char delimiter, size_t nTokens, const CSVTokenKind * kinds,
+                                              const size_t * positions, interface1::DataSourceFeature * const * features, DAAL_DATA_TYPE * rows,
+                                              size_t nColumns);
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
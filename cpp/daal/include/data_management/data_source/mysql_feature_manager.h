@@ -50,7 +50,32 @@ namespace interface1
 class SQLFeatureManager
 {
 public:
-    SQLFeatureManager() : _fetchBuffer(), _errors(services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection)) {}
+    SQLFeatureManager()
+        : _fetchBuffer(),
+          _errors(services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection)),
+          _rowArraySize(defaultRowArraySize),
+          _nFetchedRows(0),
+          _nConsumedRows(0)
+    {}
+
+    /**
+     *  Sets the number of rows fetched from the data base by one call, the rows are bound by columns.
+     *  The value is applied to the statements bound on the next creation of the dictionary.
+     *  The rows of the tables with modifiers are fetched one by one
+     *  \param[in] rowArraySize The number of rows fetched by one call
+     *  \return Reference to itself
+     */
+    SQLFeatureManager & setRowArraySize(size_t rowArraySize)
+    {
+        _rowArraySize = rowArraySize ? rowArraySize : 1;
+        return *this;
+    }
+
+    /**
+     *  Returns the number of rows fetched from the data base by one call
+     *  \return The number of rows fetched by one call
+     */
+    size_t getRowArraySize() const { return _rowArraySize; }
 
     /**
      * Adds extended feature modifier
@@ -96,54 +121,32 @@ public:
 
         nt->resize(maxRows);
 
-        nt->getBlockOfRows(0, maxRows, writeOnly, _currentRowBlock);
-        DAAL_DATA_TYPE * ntBuffer = _currentRowBlock.getBlockPtr();
-        const size_t nColumns     = _currentRowBlock.getNumberOfColumns();
-
-        SQLRETURN ret;
-        size_t read = 0;
-        while (SQL_SUCCEEDED(ret = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 1)))
-        {
-            services::BufferView<DAAL_DATA_TYPE> rowBuffer(ntBuffer + read * nColumns, nColumns);
-
-            if (_modifiersManager)
-            {
-                _modifiersManager->applyModifiers(rowBuffer);
-            }
-            else
-            {
-                _fetchBuffer->copyTo(rowBuffer);
-            }
+        size_t read                              = 0;
+        DataSourceIface::DataSourceStatus status = fetchRows(hdlStmt, nt, maxRows, 0, writeOnly, read);
 
-            read++;
-            if (read >= maxRows)
-            {
-                break;
-            }
-        }
-
-        nt->releaseBlockOfRows(_currentRowBlock);
         nt->resize(read);
-
-        DataSourceIface::DataSourceStatus status = DataSourceIface::readyForLoad;
-        if (ret != SQL_NO_DATA)
-        {
-            if (!SQL_SUCCEEDED(ret))
-            {
-                status = DataSourceIface::notReady;
-                _errors->add(services::ErrorODBC);
-            }
-        }
-        else
-        {
-            if (read < maxRows)
-            {
-                status = DataSourceIface::endOfData;
-            }
-        }
         return status;
     }
 
+    /**
+     *  Executes an SQL statement from an ODBC statement handle and writes it to the rows of a Numeric Table starting from rowOffset.
+     *  The Numeric Table is not resized, so the results of the statements of different connections can be written
+     *  to the disjoint rows of one table concurrently
+     *  \param[in]   hdlStmt   ODBC statement handle that contains an SQL query
+     *  \param[out]  nt        Numeric Table to store query results
+     *  \param[in]   maxRows   Maximum number of rows that can be read
+     *  \param[in]   rowOffset Index of the first row of the Numeric Table to write
+     *  \param[out]  nRead     Number of rows read
+     */
+    DataSourceIface::DataSourceStatus statementResultsNumericTable(SQLHSTMT hdlStmt, NumericTable * nt, size_t maxRows, size_t rowOffset,
+                                                                   size_t & nRead)
+    {
+        DAAL_ASSERT(nt);
+        DAAL_ASSERT(hdlStmt);
+
+        return fetchRows(hdlStmt, nt, maxRows, rowOffset, readWrite, nRead);
+    }
+
     /**
      *  Creates a data dictionary from an ODBC statement handle
      *  \param[in]   hdlStmt     ODBC statement handle that contains an SQL query
@@ -184,6 +187,26 @@ public:
         return ss.str();
     }
 
+    /**
+     *  Limits the SELECT query by the range of the key, the queries of the disjoint ranges can be loaded by different connections in parallel
+     *  \param[in]   query  Query to be limited
+     *  \param[in]   key    Name of the column of the key
+     *  \param[in]   begin  The first value of the key to read
+     *  \param[in]   end    The value of the key that follows the last value to read
+     *  \return Full limited query with the ';' symbol at the end
+     */
+    std::string setKeyRangeQuery(const std::string & query, const std::string & key, DAAL_INT64 begin, DAAL_INT64 end)
+    {
+        if (query.find('\0') != std::string::npos || key.find('\0') != std::string::npos)
+        {
+            this->_errors->add(services::ErrorNullByteInjection);
+            return std::string();
+        }
+        std::stringstream ss;
+        ss << "SELECT * FROM (" << query << ") AS daal_key_range WHERE " << key << " >= " << begin << " AND " << key << " < " << end << ";";
+        return ss.str();
+    }
+
     services::ErrorCollectionPtr getErrors() { return services::ErrorCollectionPtr(new services::ErrorCollection()); }
 
 private:
@@ -251,6 +274,66 @@ private:
         return featuresInfo;
     }
 
+    /* Copies the fetched rows to the block of rows, the rows are fetched by arrays when all the fetched rows are copied */
+    DataSourceIface::DataSourceStatus fetchRows(SQLHSTMT hdlStmt, NumericTable * nt, size_t maxRows, size_t rowOffset, ReadWriteMode rwFlag,
+                                                size_t & read)
+    {
+        nt->getBlockOfRows(rowOffset, maxRows, rwFlag, _currentRowBlock);
+        DAAL_DATA_TYPE * ntBuffer = _currentRowBlock.getBlockPtr();
+        const size_t nColumns     = _currentRowBlock.getNumberOfColumns();
+        maxRows                   = _currentRowBlock.getNumberOfRows();
+
+        SQLRETURN ret = SQL_SUCCESS;
+        read          = 0;
+        while (read < maxRows)
+        {
+            if (_nConsumedRows >= _nFetchedRows)
+            {
+                _nFetchedRows  = 0;
+                _nConsumedRows = 0;
+                if (!SQL_SUCCEEDED(ret = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 1))) break;
+                if (_nFetchedRows == 0) break;
+            }
+
+            const size_t nAvailable = (size_t)(_nFetchedRows - _nConsumedRows);
+            const size_t nRows      = (nAvailable < maxRows - read) ? nAvailable : maxRows - read;
+
+            if (_modifiersManager)
+            {
+                /* the rows are fetched one by one for the modifiers */
+                services::BufferView<DAAL_DATA_TYPE> rowBuffer(ntBuffer + read * nColumns, nColumns);
+                _modifiersManager->applyModifiers(rowBuffer);
+            }
+            else
+            {
+                _fetchBuffer->copyRowsTo(ntBuffer + read * nColumns, nColumns, (size_t)_nConsumedRows, nRows);
+            }
+
+            _nConsumedRows += nRows;
+            read += nRows;
+        }
+
+        nt->releaseBlockOfRows(_currentRowBlock);
+
+        DataSourceIface::DataSourceStatus status = DataSourceIface::readyForLoad;
+        if (ret != SQL_NO_DATA)
+        {
+            if (!SQL_SUCCEEDED(ret))
+            {
+                status = DataSourceIface::notReady;
+                _errors->add(services::ErrorODBC);
+            }
+        }
+        else
+        {
+            if (read < maxRows)
+            {
+                status = DataSourceIface::endOfData;
+            }
+        }
+        return status;
+    }
+
     services::Status bindSQLColumns(SQLHSTMT hdlStmt, const internal::SQLFeaturesInfo & featuresInfo)
     {
         DAAL_ASSERT(hdlStmt);
@@ -259,7 +342,8 @@ private:
 
         const internal::SQLFetchMode::Value fetchMode =
             _modifiersManager ? internal::SQLFetchMode::useNativeSQLTypes : internal::SQLFetchMode::castToFloatingPointType;
-        _fetchBuffer = internal::SQLFetchBuffer::create(featuresInfo, fetchMode, &status);
+        const size_t rowArraySize = _modifiersManager ? 1 : _rowArraySize;
+        _fetchBuffer              = internal::SQLFetchBuffer::create(featuresInfo, fetchMode, rowArraySize, &status);
         DAAL_CHECK_STATUS_VAR(status);
 
         SQLRETURN ret = SQLFreeStmt(hdlStmt, SQL_UNBIND);
@@ -268,6 +352,17 @@ private:
             return services::throwIfPossible(services::ErrorODBC);
         }
 
+        _nFetchedRows  = 0;
+        _nConsumedRows = 0;
+
+        ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)SQL_BIND_BY_COLUMN, 0);
+        if (SQL_SUCCEEDED(ret)) ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)rowArraySize, 0);
+        if (SQL_SUCCEEDED(ret)) ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROWS_FETCHED_PTR, (SQLPOINTER)&_nFetchedRows, 0);
+        if (!SQL_SUCCEEDED(ret))
+        {
+            return services::throwIfPossible(services::ErrorODBC);
+        }
+
         const SQLSMALLINT targetSQLType = internal::SQLFetchMode::getTargetType(fetchMode);
         for (size_t i = 0; i < featuresInfo.getNumberOfFeatures(); i++)
         {
@@ -314,10 +409,15 @@ private:
     }
 
 private:
+    static const size_t defaultRowArraySize = 1024;
+
     internal::SQLFetchBufferPtr _fetchBuffer;
     BlockDescriptor<DAAL_DATA_TYPE> _currentRowBlock;
     services::SharedPtr<services::ErrorCollection> _errors;
     modifiers::sql::internal::ModifiersManagerPtr _modifiersManager;
+    size_t _rowArraySize;
+    SQLULEN _nFetchedRows;  /* the number of rows fetched by the last call, it is written by the driver */
+    SQLULEN _nConsumedRows; /* the number of fetched rows copied to the tables */
 };
 
 typedef SQLFeatureManager MySQLFeatureManager;
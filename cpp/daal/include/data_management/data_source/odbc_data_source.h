@@ -350,6 +350,70 @@ public:
         return nRead;
     }
 
+    /**
+     *  Loads a data block of a specified size into the rows of an externally allocated Numeric Table starting from rowOffset.
+     *  The Numeric Table is neither resized nor its statistics are updated if it already has fullRows rows, so the data sources
+     *  of the disjoint ranges of a query, for example the ones limited by SQLFeatureManager::setKeyRangeQuery(),
+     *  can load their data into one Numeric Table concurrently through their own connections
+     *  \param[in] maxRows   Maximum number of rows to load from a Data Source into the Numeric Table
+     *  \param[in] rowOffset Write data starting from rowOffset row
+     *  \param[in] fullRows  Number of rows in the Numeric Table
+     *  \param nt            Externally allocated Numeric Table
+     *  \return The index of the row that follows the last loaded row
+     */
+    size_t loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows, NumericTable * nt) DAAL_C11_OVERRIDE
+    {
+        services::Status s = checkConnection();
+        if (!s)
+        {
+            return 0;
+        }
+
+        s = super::checkDictionary();
+        if (!s)
+        {
+            return 0;
+        }
+
+        if (nt == NULL)
+        {
+            this->_status.add(services::throwIfPossible(services::ErrorNullInputNumericTable));
+            return 0;
+        }
+
+        if (rowOffset + maxRows > fullRows)
+        {
+            this->_status.add(services::throwIfPossible(services::ErrorIncorrectDataRange));
+            return 0;
+        }
+
+        if (nt->getNumberOfRows() != fullRows)
+        {
+            s = super::resizeNumericTableImpl(fullRows, nt);
+            if (!s || nt->getNumberOfRows() != fullRows)
+            {
+                this->_status.add(services::throwIfPossible(services::ErrorIncorrectNumberOfObservations));
+                return 0;
+            }
+        }
+        if (nt->getNumberOfColumns() != _dict->getNumberOfFeatures())
+        {
+            this->_status.add(services::throwIfPossible(services::ErrorIncorrectNumberOfFeatures));
+            return 0;
+        }
+
+        size_t nRead      = 0;
+        _connectionStatus = _featureManager.statementResultsNumericTable(_hdlStmt, nt, maxRows, rowOffset, nRead);
+        _idxLastRead += nRead;
+
+        return rowOffset + nRead;
+    }
+
+    size_t loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows) DAAL_C11_OVERRIDE
+    {
+        return super::loadDataBlock(maxRows, rowOffset, fullRows);
+    }
+
     size_t loadDataBlock() DAAL_C11_OVERRIDE
     {
         services::Status s;
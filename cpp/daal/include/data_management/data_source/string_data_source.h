@@ -77,6 +77,8 @@ public:
         setData(data);
     }
 
+    virtual ~StringDataSource() { this->stopPrefetching(); }
+
     /**
      *  Sets a new string as a source for data
      *  \param[in]  data  Byte array in the C-string format
@@ -208,6 +208,7 @@ const int SERIALIZATION_PACKEDSYMMETRIC_NT_ID     = 11000;
 const int SERIALIZATION_PACKEDTRIANGULAR_NT_ID    = 12000;
 const int SERIALIZATION_MERGE_NT_ID               = 13000;
 const int SERIALIZATION_ROWMERGE_NT_ID            = 14000;
+const int SERIALIZATION_NORMALIZED_NT_ID          = 15000;
 
 const int SERIALIZATION_OPTIONAL_RESULT_ID = 30000;
 const int SERIALIZATION_MEMORY_BLOCK_ID    = 40000;
@@ -322,7 +323,8 @@ const int SERIALIZATION_QR_ONLINE_PARTIAL_RESULT_ID            = 102410;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID       = 102420;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID = 102430;
 
-const int SERIALIZATION_QUANTILES_RESULT_ID = 102500;
+const int SERIALIZATION_QUANTILES_RESULT_ID         = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID = 102510;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID = 102600;
 
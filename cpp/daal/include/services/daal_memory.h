@@ -91,6 +91,78 @@ DAAL_EXPORT int daal_memcpy_s(void * dest, size_t destSize, const void * src, si
  * \param[in]  count              Number of bytes to copy.
  */
 DAAL_EXPORT void daal_memmove_s(void * dest, size_t destSize, const void * src, size_t count);
+
+/**
+ * <a name="DAAL-ENUM-SERVICES__HUGEPAGEMODE"></a>
+ * \brief Kinds of the pages backing the large blocks allocated by daal_malloc
+ */
+enum HugePageMode
+{
+    noHugePages          = 0, /*!< Regular pages */
+    transparentHugePages = 1, /*!< Transparent huge pages requested with madvise */
+    explicitHugePages2M  = 2, /*!< 2 MB pages reserved in hugetlbfs, transparent huge pages if they are not available */
+    explicitHugePages1G  = 3  /*!< 1 GB pages reserved in hugetlbfs, 2 MB and transparent huge pages if they are not available */
+};
+
+/**
+ * <a name="DAAL-STRUCT-SERVICES__HUGEPAGEUSAGE"></a>
+ * \brief Statistics of the blocks backed by the huge pages
+ */
+struct HugePageUsage
+{
+    size_t currentBytes;  /*!< Size of the mapped blocks that are not freed yet */
+    size_t totalBytes;    /*!< Total size of the blocks mapped since the start */
+    size_t hugetlbBytes;  /*!< Part of totalBytes served from hugetlbfs */
+    size_t fallbackCount; /*!< Number of the large blocks served by the less preferred kind of pages */
+};
+
+/**
+ * Sets the kind of the pages for the blocks of at least threshold bytes. The
+ * huge pages are supported on Linux only, the blocks are allocated as usual
+ * if the pages are not available
+ * \param[in] mode      Kind of the pages
+ * \param[in] threshold Minimal size of the block in bytes
+ */
+DAAL_EXPORT void daal_set_huge_pages(HugePageMode mode, size_t threshold = (size_t(64) << 20));
+
+/**
+ * Returns the statistics of the blocks backed by the huge pages
+ * \return Statistics of the huge page blocks
+ */
+DAAL_EXPORT HugePageUsage daal_get_huge_page_usage();
+
+/**
+ * <a name="DAAL-STRUCT-SERVICES__MEMORYUSAGE"></a>
+ * \brief Statistics of the memory allocated by the library while the memory tracking is enabled
+ */
+struct MemoryUsage
+{
+    size_t currentBytes;    /*!< Size of the tracked blocks that are not freed yet */
+    size_t peakBytes;       /*!< Maximal value of currentBytes since the last reset of the peak */
+    size_t allocationCount; /*!< Number of the tracked allocations since the last reset of the peak */
+};
+
+/**
+ * Enables or disables the tracking of the memory allocated by the library.
+ * The blocks allocated while the tracking is enabled are accounted until they
+ * are freed, even if the tracking is disabled meanwhile
+ * \param[in] enable   Flag to enable the tracking
+ */
+DAAL_EXPORT void daal_enable_memory_tracking(bool enable = true);
+
+/**
+ * Returns the statistics of the tracked memory. The statistics are collected
+ * over all the threads and all the algorithms computed in parallel
+ * \return Statistics of the tracked memory
+ */
+DAAL_EXPORT MemoryUsage daal_get_memory_usage();
+
+/**
+ * Sets the peak to the current size of the tracked memory and resets the
+ * allocation count. The peak of the following compute call is its memory
+ * high-water mark
+ */
+DAAL_EXPORT void daal_reset_memory_peak();
 /** @} */
 
 DAAL_EXPORT float daal_string_to_float(const char * nptr, char ** endptr);
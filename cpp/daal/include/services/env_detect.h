@@ -153,6 +153,21 @@ public:
      */
     void enableThreadPinning(bool enableThreadPinningFlag = true);
 
+    /**
+     *  Enables the deterministic mode of the computations. The partial results of the parallel blocked loops are
+     *  computed over the chunks of the blocks that do not depend on the number of threads and are reduced in
+     *  the fixed order, so the results of the same computations on the same CPU are reproducible bitwise with
+     *  any number of threads. It is also enabled by the environment variable DAAL_DETERMINISTIC=1.
+     *  \param[in] enableDeterministicModeFlag   Flag to enable the deterministic mode
+     */
+    void enableDeterministicMode(bool enableDeterministicModeFlag = true);
+
+    /**
+     *  Returns true if the deterministic mode of the computations is enabled
+     *  \return True if the deterministic mode is enabled
+     */
+    bool isDeterministicMode() const;
+
     /**
      *  Returns the number of used threads
      *  \return The number of used threads
@@ -177,7 +192,23 @@ public:
         _executionContext = internal::ImplAccessor::getImplPtr<services::internal::sycl::ExecutionContextIface>(ctx);
     }
 
-    services::internal::sycl::ExecutionContextIface & getDefaultExecutionContext() { return *_executionContext; }
+    /**
+     *  Sets execution context for the algorithms called from the current thread.
+     *  The context of the thread takes precedence over the default one, the empty
+     *  pointer resets it.
+     *  \param[in] ctx Execution context of the current thread
+     */
+    void setThreadExecutionContext(const SharedPtr<services::internal::sycl::ExecutionContextIface> & ctx);
+
+    /**
+     *  Returns the execution context of the current thread, the empty pointer if there is none
+     */
+    SharedPtr<services::internal::sycl::ExecutionContextIface> getThreadExecutionContext() const;
+
+    /**
+     *  Returns the execution context of the current thread if it is set and the default one otherwise
+     */
+    services::internal::sycl::ExecutionContextIface & getDefaultExecutionContext();
 
 private:
     Environment();
@@ -327,6 +327,16 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock      = -9022, /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+
+    ErrorLz4Internal                    = -9023, /*!< LZ4 internal error */
+    ErrorLz4OutputStreamSizeIsNotEnough = -9024, /*!< Size of output stream is not enough to start compression */
+    ErrorLz4DataFormat                  = -9025, /*!< Input compressed stream is in wrong format or corrupted */
+    ErrorLz4DataFormatLessThenHeader    = -9026, /*!< Size of input compressed stream is less then
+                                                                         *   compressed block header size */
+    ErrorLz4DataFormatNotFullBlock      = -9027, /*!< Input compressed stream contains not a whole
+                                                                         *   number of compressed blocks */
+
+    ErrorBlockCompressionDataFormat = -9028, /*!< Input compressed stream has no valid block index or is corrupted */
     // Min-max normalization errors: -9400..-9499
     ErrorLowerBoundGreaterThanOrEqualToUpperBound = -9400, /*!< Lower bound parameter greater than or equal to upper bound */
 
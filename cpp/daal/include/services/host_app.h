@@ -27,6 +27,7 @@
 #include "services/daal_defines.h"
 #include "services/base.h"
 #include "services/daal_shared_ptr.h"
+#include "services/daal_atomic_int.h"
 
 namespace daal
 {
@@ -60,9 +61,57 @@ private:
 };
 typedef services::SharedPtr<HostAppIface> HostAppIfacePtr;
 
+/**
+ *  <a name="DAAL-CLASS-SERVICES__CANCELLATIONTOKEN"></a>
+ *  \brief Host application that cancels the computations on request or when their time limit is exceeded.
+ *         The iterative algorithms check it between the iterations, stop and return 'ErrorUserCancelled' status
+ *         with the results of the finished iterations
+ */
+class DAAL_EXPORT CancellationToken : public HostAppIface
+{
+public:
+    /**
+     * Constructs the token without the time limit
+     */
+    CancellationToken();
+
+    /**
+     * Constructs the token with the time limit
+     * \param[in] timeLimit  Time in seconds since the construction after which the computations are cancelled,
+     *                       zero for no limit
+     */
+    explicit CancellationToken(double timeLimit);
+
+    virtual ~CancellationToken();
+
+    /**
+     * Cancels the computations using the token, can be called from any thread
+     */
+    void cancel();
+
+    /**
+     * Sets the time limit of the computations counted from this call
+     * \param[in] timeLimit  Time in seconds after which the computations are cancelled, zero for no limit
+     */
+    void setTimeLimit(double timeLimit);
+
+    /**
+     * \return True if cancel() was called or the time limit is exceeded
+     */
+    virtual bool isCancelled() DAAL_C11_OVERRIDE;
+
+private:
+    services::Atomic<int> _isCancelled;
+    double _timeLimit;
+    double _startTime;
+};
+typedef services::SharedPtr<CancellationToken> CancellationTokenPtr;
+
 } // namespace interface1
 using interface1::HostAppIface;
 using interface1::HostAppIfacePtr;
+using interface1::CancellationToken;
+using interface1::CancellationTokenPtr;
 
 } // namespace services
 } // namespace daal
@@ -64,6 +64,12 @@ public:
      *  Does not copy the data from the SYCL* buffer
      */
     Buffer(const cl::sycl::buffer<T, 1> & buffer) : _impl(new internal::SyclBuffer<T>(buffer)) {}
+
+    /**
+     *  Creates a Buffer object referencing a SYCL* buffer that belongs to the owner,
+     *  the owner is released when the Buffer object and its sub-buffers are released
+     */
+    Buffer(const cl::sycl::buffer<T, 1> & buffer, const SharedPtr<Base> & owner) : _impl(new internal::SyclBuffer<T>(buffer, owner)) {}
 #endif
 
 #ifdef DAAL_SYCL_INTERFACE_USM
@@ -163,6 +169,19 @@ public:
 
         return internal::SyclBufferConverter<T>().toUSM(*_impl);
     }
+
+    /**
+     *  Returns the USM pointer the buffer references
+     *  \return USM shared pointer or empty pointer if the buffer is not backed by USM
+     */
+    SharedPtr<T> getUSM() const
+    {
+        if (!_impl)
+        {
+            return SharedPtr<T>();
+        }
+        return internal::SyclBufferConverter<T>().getUSM(*_impl);
+    }
 #endif
 
     /**
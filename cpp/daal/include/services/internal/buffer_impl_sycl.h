@@ -100,7 +100,9 @@ public:
     typedef cl::sycl::accessor<T, 1, mode, cl::sycl::access::target::host_buffer> HostAccessorType;
 
 public:
-    explicit SyclHostDeleter(const cl::sycl::buffer<T, 1> & buffer, HostAccessorType * accessor) : _buffer(buffer), _hostAccessor(accessor) {}
+    explicit SyclHostDeleter(const cl::sycl::buffer<T, 1> & buffer, HostAccessorType * accessor, const SharedPtr<Base> & owner = SharedPtr<Base>())
+        : _buffer(buffer), _hostAccessor(accessor), _owner(owner)
+    {}
 
     void operator()(const void * ptr)
     {
@@ -111,6 +113,7 @@ public:
 private:
     HostAccessorType * _hostAccessor;
     cl::sycl::buffer<T, 1> _buffer;
+    SharedPtr<Base> _owner; /*!< The buffer is not reused by its owner while the host accessor is alive */
 };
 
 /**
@@ -128,6 +131,9 @@ public:
 
     explicit SyclBuffer(const BufferType & syclBuffer) : _syclBuffer(syclBuffer) {}
 
+    /* The owner is released with the buffer and its sub-buffers */
+    explicit SyclBuffer(const BufferType & syclBuffer, const SharedPtr<Base> & owner) : _syclBuffer(syclBuffer), _owner(owner) {}
+
     size_t size() const DAAL_C11_OVERRIDE { return _syclBuffer.get_count(); }
 
     void apply(BufferVisitor<T> & visitor) const DAAL_C11_OVERRIDE { visitor(*this); }
@@ -148,9 +154,9 @@ public:
         BufferType & buffer = const_cast<BufferType &>(_syclBuffer);
         if ((offset == 0) && (size == this->size()))
         {
-            return new SyclBuffer<T>(buffer);
+            return new SyclBuffer<T>(buffer, _owner);
         }
-        return new SyclBuffer<T>(BufferType(buffer, offset, size));
+        return new SyclBuffer<T>(BufferType(buffer, offset, size), _owner);
     }
 
     SharedPtr<T> getHostRead(Status * status = nullptr) const DAAL_C11_OVERRIDE { return getHostPtr<cl::sycl::access::mode::read>(); }
@@ -168,10 +174,11 @@ private:
         using DeleterType  = SyclHostDeleter<T, mode>;
         using AccessorType = typename DeleterType::HostAccessorType;
         auto * accessor    = new AccessorType(const_cast<BufferType &>(_syclBuffer));
-        return SharedPtr<T>(accessor->get_pointer(), DeleterType(_syclBuffer, accessor));
+        return SharedPtr<T>(accessor->get_pointer(), DeleterType(_syclBuffer, accessor, _owner));
     }
 
     BufferType _syclBuffer;
+    SharedPtr<Base> _owner;
 };
 
 /**
@@ -236,6 +243,29 @@ private:
 };
 #endif
 
+#ifdef DAAL_SYCL_INTERFACE_USM
+/**
+ *  <a name="DAAL-CLASS-SERVICES-INTERNAL__EXTRACTUSM"></a>
+ *  \brief BufferVisitor that returns the USM pointer of the USM-backed buffer
+ *  and the empty pointer for other buffers, the data is never copied
+ */
+template <typename T>
+class ExtractUsm : public BufferVisitor<T>
+{
+public:
+    void operator()(const HostBuffer<T> & buffer) DAAL_C11_OVERRIDE {}
+
+    void operator()(const UsmBufferIface<T> & buffer) DAAL_C11_OVERRIDE { _data = buffer.get(); }
+
+    void operator()(const SyclBufferIface<T> & buffer) DAAL_C11_OVERRIDE {}
+
+    const SharedPtr<T> & get() const { return _data; }
+
+private:
+    SharedPtr<T> _data;
+};
+#endif
+
 /**
  *  <a name="DAAL-CLASS-SERVICES-INTERNAL__SYCLBUFFERCONVERTER"></a>
  *  \brief Groups high-level conversion methods for SYCL* buffer and USM
@@ -258,6 +288,13 @@ public:
         buffer.apply(action);
         return action.get();
     }
+
+    SharedPtr<T> getUSM(const internal::BufferIface<T> & buffer)
+    {
+        ExtractUsm<T> action;
+        buffer.apply(action);
+        return action.get();
+    }
 #endif
 };
 
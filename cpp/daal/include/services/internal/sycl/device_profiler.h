@@ -0,0 +1,190 @@
+/* file: device_profiler.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef __DAAL_SERVICES_INTERNAL_SYCL_DEVICE_PROFILER_H__
+#define __DAAL_SERVICES_INTERNAL_SYCL_DEVICE_PROFILER_H__
+
+#include "services/daal_defines.h"
+#include "services/collection.h"
+#include "services/daal_string.h"
+
+#ifdef DAAL_SYCL_INTERFACE
+    #include <CL/sycl.hpp>
+#endif
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace sycl
+{
+namespace interface1
+{
+/** @ingroup oneapi_internal
+ * @{
+ */
+
+/**
+ * <a name="DAAL-ENUM-ONEAPI-INTERNAL__DEVICEOPERATIONKIND"></a>
+ * \brief Kinds of the operations recorded by the device profiler
+ */
+enum DeviceOperationKind
+{
+    deviceKernel      = 0, /*!< Kernel launch */
+    deviceTransfer    = 1, /*!< Copy of the buffer data */
+    deviceFill        = 2, /*!< Fill of the buffer with a value */
+    deviceCompilation = 3  /*!< Runtime build of the kernel program */
+};
+
+/**
+ *  <a name="DAAL-STRUCT-ONEAPI-INTERNAL__DEVICEOPERATIONRECORD"></a>
+ *  \brief Timings of a single device operation in nanoseconds
+ */
+struct DeviceOperationRecord
+{
+    DeviceOperationRecord(const char * operationName, DeviceOperationKind operationKind, long long submitTime)
+        : name(operationName),
+          kind(operationKind),
+          dimensions(0),
+          bytes(0),
+          hostSubmitTime(submitTime),
+          queuedTime(submitTime),
+          startTime(submitTime),
+          endTime(submitTime)
+    {
+        for (size_t i = 0; i < 3; i++)
+        {
+            globalRange[i] = 0;
+            localRange[i]  = 0;
+        }
+    }
+
+    const char * name;
+    DeviceOperationKind kind;
+    size_t dimensions;
+    size_t globalRange[3];
+    size_t localRange[3]; /*!< Zeros for the kernels without the local range */
+    size_t bytes;         /*!< Size of the transferred or filled data */
+    long long hostSubmitTime;
+    /* The times of the device clock if the queue is created with the
+     * enable_profiling property, the times of the host clock otherwise */
+    long long queuedTime;
+    long long startTime;
+    long long endTime;
+};
+
+/**
+ *  <a name="DAAL-STRUCT-ONEAPI-INTERNAL__DEVICEOPERATIONSTATISTICS"></a>
+ *  \brief Aggregated timings of the device operations with the same name
+ */
+struct DeviceOperationStatistics
+{
+    DeviceOperationStatistics() : kind(deviceKernel), count(0), bytes(0), totalTime(0), maxTime(0), totalQueueTime(0) {}
+
+    services::String name;
+    DeviceOperationKind kind;
+    size_t count;
+    size_t bytes;
+    long long totalTime;      /*!< Total execution time in nanoseconds */
+    long long maxTime;        /*!< Maximal execution time in nanoseconds */
+    long long totalQueueTime; /*!< Total time from the submission to the start in nanoseconds */
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__DEVICEPROFILER"></a>
+ *  \brief Records the kernels, transfers and program builds of the GPU
+ *  algorithms. The records are enabled by enable() or together with the
+ *  CPU profiler by the DAAL_PROFILER_OUTPUT environment variable, they
+ *  are written to the same trace as the CPU tasks.
+ */
+class DAAL_EXPORT DeviceProfiler
+{
+public:
+    static bool isEnabled();
+    static void enable(bool enable = true);
+
+    /** Current time of the host clock used in the records */
+    static long long now();
+
+    static void record(const DeviceOperationRecord & record);
+
+    /** Statistics of the operations recorded so far ordered by name */
+    static services::Collection<DeviceOperationStatistics> getSummary();
+
+    /** Drops the recorded operations */
+    static void reset();
+};
+
+#ifdef DAAL_SYCL_INTERFACE
+/**
+ * Completes the record by the profiling information of the finished event.
+ * The queues without the enable_profiling property are timed on the host.
+ */
+inline void recordDeviceEvent(const cl::sycl::queue & queue, const cl::sycl::event & event, DeviceOperationRecord & record)
+{
+    bool isTimed = false;
+    if (queue.has_property<cl::sycl::property::queue::enable_profiling>())
+    {
+        try
+        {
+            record.queuedTime = static_cast<long long>(event.get_profiling_info<cl::sycl::info::event_profiling::command_submit>());
+            record.startTime  = static_cast<long long>(event.get_profiling_info<cl::sycl::info::event_profiling::command_start>());
+            record.endTime    = static_cast<long long>(event.get_profiling_info<cl::sycl::info::event_profiling::command_end>());
+            isTimed           = true;
+        }
+        catch (const cl::sycl::exception &)
+        {}
+    }
+    if (!isTimed)
+    {
+        record.queuedTime = record.hostSubmitTime;
+        record.startTime  = record.hostSubmitTime;
+        record.endTime    = DeviceProfiler::now();
+    }
+    DeviceProfiler::record(record);
+}
+
+/** Records the finished transfer or fill of the given size */
+inline void recordDeviceEvent(const cl::sycl::queue & queue, const cl::sycl::event & event, const char * name, DeviceOperationKind kind,
+                              long long submitTime, size_t bytes)
+{
+    DeviceOperationRecord record(name, kind, submitTime);
+    record.bytes = bytes;
+    recordDeviceEvent(queue, event, record);
+}
+#endif
+
+/** @} */
+} // namespace interface1
+
+using interface1::DeviceOperationKind;
+using interface1::DeviceOperationRecord;
+using interface1::DeviceOperationStatistics;
+using interface1::DeviceProfiler;
+#ifdef DAAL_SYCL_INTERFACE
+using interface1::recordDeviceEvent;
+#endif
+
+} // namespace sycl
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
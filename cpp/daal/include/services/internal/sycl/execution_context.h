@@ -344,6 +344,12 @@ public:
     virtual void potrs(math::UpLo uplo, size_t n, size_t ny, UniversalBuffer & a_buffer, size_t lda, UniversalBuffer & b_buffer, size_t ldb,
                        services::Status * status = NULL) = 0;
 
+    virtual void gerqf(size_t m, size_t n, UniversalBuffer & a_buffer, size_t lda, UniversalBuffer & tau_buffer,
+                       services::Status * status = NULL) = 0;
+
+    virtual void ormrq(math::Side side, math::Transpose trans, size_t m, size_t n, size_t k, UniversalBuffer & a_buffer, size_t lda,
+                       UniversalBuffer & tau_buffer, UniversalBuffer & c_buffer, size_t ldc, services::Status * status = NULL) = 0;
+
     virtual void copy(UniversalBuffer dest, size_t desOffset, UniversalBuffer src, size_t srcOffset, size_t count, services::Status * status) = 0;
 
     virtual void fill(UniversalBuffer dest, double value, services::Status * status) = 0;
@@ -355,6 +361,13 @@ public:
     virtual InfoDevice & getInfoDevice() = 0;
 
     virtual void copy(UniversalBuffer dest, size_t desOffset, void * src, size_t srcOffset, size_t count, services::Status * status) = 0;
+
+    /**
+     *  Blocks until all operations submitted to the context are completed.
+     *  The operations may run asynchronously, the errors raised by them are
+     *  reported by this method.
+     */
+    virtual void wait(services::Status * status = NULL) = 0;
 };
 
 /**
@@ -430,6 +443,19 @@ public:
         services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
     }
 
+    void gerqf(size_t /*m*/, size_t /*n*/, UniversalBuffer & /*a_buffer*/, size_t /*lda*/, UniversalBuffer & /*tau_buffer*/,
+               services::Status * status = NULL) DAAL_C11_OVERRIDE
+    {
+        services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
+    }
+
+    void ormrq(math::Side /*side*/, math::Transpose /*trans*/, size_t /*m*/, size_t /*n*/, size_t /*k*/, UniversalBuffer & /*a_buffer*/,
+               size_t /*lda*/, UniversalBuffer & /*tau_buffer*/, UniversalBuffer & /*c_buffer*/, size_t /*ldc*/,
+               services::Status * status = NULL) DAAL_C11_OVERRIDE
+    {
+        services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
+    }
+
     void copy(UniversalBuffer /*dest*/, size_t /*desOffset*/, UniversalBuffer /*src*/, size_t /*srcOffset*/, size_t /*count*/,
               services::Status * status = NULL) DAAL_C11_OVERRIDE
     {
@@ -457,6 +483,8 @@ public:
         services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
     }
 
+    void wait(services::Status * /*status*/ = NULL) DAAL_C11_OVERRIDE {}
+
 private:
     CpuKernelFactory _factory;
     InfoDevice _infoDevice;
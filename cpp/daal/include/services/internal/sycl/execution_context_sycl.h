@@ -23,6 +23,7 @@
         #include "services/internal/hash_table.h"
         #include "services/internal/sycl/execution_context.h"
         #include "services/internal/sycl/kernel_scheduler_sycl.h"
+        #include "services/internal/sycl/memory_pool_sycl.h"
         #include "services/internal/sycl/math/blas_executor.h"
         #include "services/internal/sycl/math/lapack_executor.h"
         #include "services/internal/sycl/error_handling.h"
@@ -60,6 +61,8 @@ public:
         }
         if (!res)
         {
+            const bool isProfiled     = DeviceProfiler::isEnabled();
+            const long long buildTime = isProfiled ? DeviceProfiler::now() : 0;
         #ifndef DAAL_DISABLE_LEVEL_ZERO
             const bool isOpenCLBackendAvailable = !_deviceQueue.get_device().template get_info<cl::sycl::info::device::opencl_c_version>().empty();
             if (isOpenCLBackendAvailable)
@@ -115,6 +118,13 @@ public:
                 _currentProgramRef = programPtr.get();
             }
         #endif // DAAL_DISABLE_LEVEL_ZERO
+            if (isProfiled)
+            {
+                // The program build includes the JIT compilation of all its kernels
+                DeviceOperationRecord record(name, deviceCompilation, buildTime);
+                record.endTime = DeviceProfiler::now();
+                DeviceProfiler::record(record);
+            }
         }
         else
         {
@@ -169,7 +179,7 @@ public:
                     services::internal::tryAssignStatus(status, localStatus);
                     return KernelPtr();
                 }
-                kernel.reset(new OpenClKernelNative(_executionTarget, *_currentProgramRef, kernelRef));
+                kernel.reset(new OpenClKernelNative(_executionTarget, *_currentProgramRef, kernelRef, kernelName));
         #ifndef DAAL_DISABLE_LEVEL_ZERO
             }
             else
@@ -214,7 +224,7 @@ class SyclExecutionContextImpl : public Base, public ExecutionContextIface
 {
 public:
     explicit SyclExecutionContextImpl(const cl::sycl::queue & deviceQueue)
-        : _deviceQueue(deviceQueue), _kernelFactory(_deviceQueue), _kernelScheduler(_deviceQueue)
+        : _deviceQueue(deviceQueue), _kernelFactory(_deviceQueue), _kernelScheduler(_deviceQueue), _memoryPool(new SyclMemoryPool())
     {
         const auto & device          = _deviceQueue.get_device();
         _infoDevice.isCpu            = device.is_cpu() || device.is_host();
@@ -225,8 +235,8 @@ public:
     {
         // TODO: Thread safe?
         // TODO: Check for input arguments
-        // TODO: Need to save reference to kernel to prevent
-        //       releasing in case of asynchronous execution?
+        // The SYCL* kernel object keeps the program alive while the
+        // asynchronously submitted kernel is running
         kernel->schedule(_kernelScheduler, range, args, status);
     }
 
@@ -235,8 +245,8 @@ public:
     {
         // TODO: Thread safe?
         // TODO: Check for input arguments
-        // TODO: Need to save reference to kernel to prevent
-        //       releasing in case of asynchronous execution?
+        // The SYCL* kernel object keeps the program alive while the
+        // asynchronously submitted kernel is running
         kernel->schedule(_kernelScheduler, range, args, status);
     }
 
@@ -281,13 +291,27 @@ public:
         math::PotrsExecutor::run(_deviceQueue, uplo, n, ny, a_buffer, lda, b_buffer, ldb, status);
     }
 
+    void gerqf(size_t m, size_t n, UniversalBuffer & a_buffer, size_t lda, UniversalBuffer & tau_buffer,
+               services::Status * status = nullptr) DAAL_C11_OVERRIDE
+    {
+        DAAL_ASSERT(a_buffer.type() == tau_buffer.type());
+        math::GerqfExecutor::run(_deviceQueue, m, n, a_buffer, lda, tau_buffer, status);
+    }
+
+    void ormrq(math::Side side, math::Transpose trans, size_t m, size_t n, size_t k, UniversalBuffer & a_buffer, size_t lda,
+               UniversalBuffer & tau_buffer, UniversalBuffer & c_buffer, size_t ldc, services::Status * status = nullptr) DAAL_C11_OVERRIDE
+    {
+        DAAL_ASSERT(a_buffer.type() == tau_buffer.type());
+        DAAL_ASSERT(a_buffer.type() == c_buffer.type());
+        math::OrmrqExecutor::run(_deviceQueue, side, trans, m, n, k, a_buffer, lda, tau_buffer, c_buffer, ldc, status);
+    }
+
     UniversalBuffer allocate(TypeId type, size_t bufferSize, services::Status * status = nullptr) DAAL_C11_OVERRIDE
     {
-        // TODO: Thread safe?
         try
         {
-            auto buffer = BufferAllocator::allocate(type, bufferSize);
-            return buffer;
+            // The pool is thread safe, the buffers released by the algorithms are reused
+            return SyclMemoryPool::allocate(_memoryPool, type, bufferSize);
         }
         catch (cl::sycl::exception const & e)
         {
@@ -303,7 +327,7 @@ public:
         // TODO: Thread safe?
         try
         {
-            BufferCopier::copy(_deviceQueue, dest, desOffset, src, srcOffset, count);
+            _kernelScheduler.track(BufferCopier::copy(_deviceQueue, dest, desOffset, src, srcOffset, count, isBlocking()), status);
         }
         catch (cl::sycl::exception const & e)
         {
@@ -316,7 +340,7 @@ public:
         // TODO: Thread safe?
         try
         {
-            BufferFiller::fill(_deviceQueue, dest, value);
+            _kernelScheduler.track(BufferFiller::fill(_deviceQueue, dest, value, isBlocking()), status);
         }
         catch (cl::sycl::exception const & e)
         {
@@ -334,6 +358,7 @@ public:
         // TODO: Thread safe?
         try
         {
+            // The host array may be released right after the call, so the copy is always blocking
             ArrayCopier::copy(_deviceQueue, dest, desOffset, src, srcOffset, count);
         }
         catch (cl::sycl::exception const & e)
@@ -342,11 +367,17 @@ public:
         }
     }
 
+    void wait(services::Status * status = nullptr) DAAL_C11_OVERRIDE { _kernelScheduler.wait(status); }
+
 private:
+    /* The profiled copies are blocking to report the record right away */
+    bool isBlocking() const { return !_kernelScheduler.isAsynchronous() || DeviceProfiler::isEnabled(); }
+
     cl::sycl::queue _deviceQueue;
     OpenClKernelFactory _kernelFactory;
     SyclKernelScheduler _kernelScheduler;
     InfoDevice _infoDevice;
+    SharedPtr<SyclMemoryPool> _memoryPool;
 };
 
 /** } */
@@ -28,11 +28,15 @@
             #include "services/internal/sycl/daal_ze_module_helper.h"
         #endif // DAAL_DISABLE_LEVEL_ZERO
 
+        #include <cstdlib>
         #include <cstring>
+        #include <mutex>
         #include <vector>
 
+        #include "services/internal/sycl/device_profiler.h"
         #include "services/internal/sycl/error_handling.h"
         #include "services/internal/sycl/execution_context.h"
+        #include "services/internal/sycl/program_binary_cache.h"
         #include "services/internal/sycl/types_utils_cxx11.h"
         #include "services/daal_string.h"
 
@@ -236,7 +240,18 @@ private:
     void initOpenClProgramRef(cl_context clContext, cl_device_id clDevice, const char * programName, const char * programSrc, const char * options,
                               services::Status * status = nullptr)
     {
-        _programName           = programName;
+        _programName = programName;
+
+        // The binaries compiled ahead of time are preferred to the on-disk cache
+        const bool isCacheEnabled = ProgramBinaryCache::isEnabled();
+        services::String cacheKey;
+        if (isCacheEnabled || !ProgramBinaryBundle::isEmpty())
+        {
+            cacheKey = getCacheKey(clDevice, programSrc, options);
+            if (initFromBundledBinary(clContext, clDevice, cacheKey.c_str(), options)) return;
+            if (isCacheEnabled && initFromCachedBinary(clContext, clDevice, cacheKey.c_str(), options)) return;
+        }
+
         cl_int err             = 0;
         const char * sources[] = { programSrc };
         const size_t lengths[] = { std::strlen(programSrc) };
@@ -263,6 +278,79 @@ private:
         }
         #endif
         DAAL_CHECK_OPENCL(err, status)
+
+        if (isCacheEnabled) storeCachedBinary(cacheKey.c_str());
+    }
+
+    static services::String getDeviceInfo(cl_device_id clDevice, cl_device_info param)
+    {
+        size_t size = 0;
+        if (clGetDeviceInfo(clDevice, param, 0, nullptr, &size) != CL_SUCCESS || size == 0) return services::String();
+
+        services::Collection<char> value(size + 1);
+        if (value.data() == nullptr || clGetDeviceInfo(clDevice, param, size, value.data(), nullptr) != CL_SUCCESS) return services::String();
+        value[size] = '\0';
+        return services::String(value.data());
+    }
+
+    static services::String getCacheKey(cl_device_id clDevice, const char * programSrc, const char * options)
+    {
+        ProgramBinaryCacheKey key;
+        key.add(getDeviceInfo(clDevice, CL_DEVICE_NAME).c_str())
+            .add(getDeviceInfo(clDevice, CL_DEVICE_VENDOR).c_str())
+            .add(getDeviceInfo(clDevice, CL_DEVICE_VERSION).c_str())
+            .add(getDeviceInfo(clDevice, CL_DRIVER_VERSION).c_str())
+            .add(options)
+            .add(programSrc);
+        return key.getValue();
+    }
+
+    bool initFromBundledBinary(cl_context clContext, cl_device_id clDevice, const char * cacheKey, const char * options)
+    {
+        const unsigned char * binary = nullptr;
+        size_t binarySize            = 0;
+        if (!ProgramBinaryBundle::find(cacheKey, &binary, &binarySize)) return false;
+        return initFromBinary(clContext, clDevice, binary, binarySize, options);
+    }
+
+    bool initFromCachedBinary(cl_context clContext, cl_device_id clDevice, const char * cacheKey, const char * options)
+    {
+        services::Collection<unsigned char> binary;
+        if (!ProgramBinaryCache::load(cacheKey, binary)) return false;
+        return initFromBinary(clContext, clDevice, binary.data(), binary.size(), options);
+    }
+
+    bool initFromBinary(cl_context clContext, cl_device_id clDevice, const unsigned char * binary, size_t binarySize, const char * options)
+    {
+        const unsigned char * binaries[] = { binary };
+        cl_int binaryStatus              = CL_SUCCESS;
+        cl_int err                       = CL_SUCCESS;
+        reset(clCreateProgramWithBinary(clContext, 1, &clDevice, &binarySize, binaries, &binaryStatus, &err));
+        if (err == CL_SUCCESS && binaryStatus == CL_SUCCESS)
+        {
+            err = clBuildProgram(get(), 1, &clDevice, options, nullptr, nullptr);
+        }
+
+        // The binary rejected by the driver is replaced by the build from the source
+        if (err != CL_SUCCESS || binaryStatus != CL_SUCCESS)
+        {
+            reset();
+            return false;
+        }
+        return true;
+    }
+
+    void storeCachedBinary(const char * cacheKey)
+    {
+        size_t binarySize = 0;
+        if (clGetProgramInfo(get(), CL_PROGRAM_BINARY_SIZES, sizeof(size_t), &binarySize, nullptr) != CL_SUCCESS || binarySize == 0) return;
+
+        services::Collection<unsigned char> binary(binarySize);
+        unsigned char * binaryPtr = binary.data();
+        if (binaryPtr == nullptr || clGetProgramInfo(get(), CL_PROGRAM_BINARIES, sizeof(binaryPtr), &binaryPtr, nullptr) != CL_SUCCESS) return;
+
+        // The failure to store is not an error, the program is built next time
+        ProgramBinaryCache::store(cacheKey, binaryPtr, binarySize);
     }
 
         #ifndef DAAL_DISABLE_LEVEL_ZERO
@@ -322,8 +410,8 @@ private:
 class OpenClKernel : public Base, public KernelIface
 {
 public:
-    explicit OpenClKernel(ExecutionTargetId executionTarget, const OpenClProgramRef & programRef)
-        : _executionTarget(executionTarget), _clProgramRef(programRef)
+    explicit OpenClKernel(ExecutionTargetId executionTarget, const OpenClProgramRef & programRef, const char * kernelName)
+        : _executionTarget(executionTarget), _clProgramRef(programRef), _kernelName(kernelName)
     {}
 
     void schedule(KernelSchedulerIface & scheduler, const KernelRange & range, const KernelArguments & args,
@@ -344,16 +432,20 @@ public:
 
     const OpenClProgramRef & getProgramRef() const { return _clProgramRef; }
 
+    const char * getName() const { return _kernelName.c_str(); }
+
 private:
     OpenClProgramRef _clProgramRef;
     ExecutionTargetId _executionTarget;
+    services::String _kernelName;
 };
 
 class OpenClKernelNative : public OpenClKernel
 {
 public:
-    explicit OpenClKernelNative(ExecutionTargetId executionTarget, const OpenClProgramRef & programRef, const OpenClKernelRef & kernelRef)
-        : OpenClKernel(executionTarget, programRef), _clKernelRef(kernelRef)
+    explicit OpenClKernelNative(ExecutionTargetId executionTarget, const OpenClProgramRef & programRef, const OpenClKernelRef & kernelRef,
+                                const char * kernelName)
+        : OpenClKernel(executionTarget, programRef, kernelName), _clKernelRef(kernelRef)
     {}
 
     cl::sycl::kernel toSycl(const cl::sycl::context & ctx) const { return cl::sycl::kernel(_clKernelRef.get(), ctx); }
@@ -367,7 +459,7 @@ class OpenClKernelLevelZero : public OpenClKernel
 {
 public:
     explicit OpenClKernelLevelZero(ExecutionTargetId executionTarget, const OpenClProgramRef & programRef, const OpenClKernelLevelZeroRef & kernelRef)
-        : OpenClKernel(executionTarget, programRef),
+        : OpenClKernel(executionTarget, programRef, kernelRef.getName()),
           _clKernelRef(kernelRef),
           syclKernel(getProgramRef().getProgramLevelZero().get_kernel(_clKernelRef.getName()))
     {}
@@ -389,6 +481,14 @@ public:
         _buffers.push_back(services::internal::Any(buffer));
     }
 
+        #ifdef DAAL_SYCL_INTERFACE_USM
+    template <typename T>
+    void add(const SharedPtr<T> & usmData)
+    {
+        _buffers.push_back(services::internal::Any(usmData));
+    }
+        #endif
+
 private:
     std::vector<services::internal::Any> _buffers;
 };
@@ -417,6 +517,18 @@ private:
     template <typename T>
     void handlePublicBuffer()
     {
+        #ifdef DAAL_SYCL_INTERFACE_USM
+        // The USM pointers are passed as they are, the wrapping into SYCL* buffer
+        // would make the runtime copy the data it treats as host memory
+        const auto usmData = _argument.get<services::internal::Buffer<T> >().getUSM();
+        if (usmData)
+        {
+            _storage.add(usmData);
+            _handler.set_arg((int)_argumentIndex, usmData.get());
+            return;
+        }
+        #endif
+
         auto buffer = _argument.get<services::internal::Buffer<T> >().toSycl();
 
         // Note: we need this storage to keep all sycl buffers alive
@@ -464,6 +576,30 @@ private:
     services::Status _status;
 };
 
+/* Checks whether the argument is the buffer backed by USM */
+class SyclKernelSchedulerUsmArgChecker
+{
+public:
+    explicit SyclKernelSchedulerUsmArgChecker(const KernelArgument & arg) : _argument(arg), _isUsm(false) {}
+
+    template <typename T>
+    void operator()(Typelist<T>)
+    {
+        #ifdef DAAL_SYCL_INTERFACE_USM
+        if (_argument.argType() == KernelArgumentTypes::publicBuffer)
+        {
+            _isUsm = bool(_argument.get<services::internal::Buffer<T> >().getUSM());
+        }
+        #endif
+    }
+
+    bool isUsm() const { return _isUsm; }
+
+private:
+    const KernelArgument & _argument;
+    bool _isUsm;
+};
+
 template <int dim>
 inline cl::sycl::range<dim> convertToSyclRange(const KernelRange &);
 
@@ -528,10 +664,45 @@ inline cl::sycl::nd_range<3> convertToSyclRange<3>(const KernelNDRange & r)
     );
 }
 
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__SYCLKERNELSCHEDULER"></a>
+ *  \brief Submits the kernels to the SYCL* queue. By default the submission
+ *  is asynchronous: the accessors of the arguments order the kernels with the
+ *  other operations on the same buffers, and the host accessors wait for the
+ *  kernels which write to the buffer. The pending events are waited by wait(),
+ *  which reports the errors of the kernels. The USM-backed buffers are passed to
+ *  the kernels as pointers, such kernels are blocking. The DAAL_GPU_SYNCHRONOUS_SUBMISSION
+ *  environment variable makes every submission blocking.
+ */
 class SyclKernelScheduler : public Base, public KernelSchedulerIface
 {
 public:
-    explicit SyclKernelScheduler(cl::sycl::queue & deviceQueue) : _queue(deviceQueue) {}
+    explicit SyclKernelScheduler(cl::sycl::queue & deviceQueue) : _queue(deviceQueue), _isAsynchronous(!isSynchronousSubmissionRequested()) {}
+
+    ~SyclKernelScheduler()
+    {
+        // The errors of the operations which nobody waited for are dropped
+        wait(nullptr);
+    }
+
+    bool isAsynchronous() const { return _isAsynchronous; }
+
+    /** Adds the event of the operation submitted outside of the scheduler to the pending ones */
+    void track(const cl::sycl::event & event, services::Status * status = nullptr)
+    {
+        if (_isAsynchronous) addPending(PendingOperation(event), status);
+    }
+
+    /** Waits for all pending operations */
+    void wait(services::Status * status = nullptr)
+    {
+        std::vector<PendingOperation> operations;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            operations.swap(_pending);
+        }
+        waitFor(operations, status);
+    }
 
     void schedule(const OpenClKernel & kernel, const KernelRange & range, const KernelArguments & args,
                   services::Status * status = nullptr) DAAL_C11_OVERRIDE
@@ -577,27 +748,182 @@ private:
     {
         switch (range.dimensions())
         {
-        case 1: return scheduleSycl(convertToSyclRange<1>(range), kernel, args, status);
-        case 2: return scheduleSycl(convertToSyclRange<2>(range), kernel, args, status);
-        case 3: return scheduleSycl(convertToSyclRange<3>(range), kernel, args, status);
+        case 1: return scheduleSycl(convertToSyclRange<1>(range), range, kernel, args, status);
+        case 2: return scheduleSycl(convertToSyclRange<2>(range), range, kernel, args, status);
+        case 3: return scheduleSycl(convertToSyclRange<3>(range), range, kernel, args, status);
         }
 
         DAAL_ASSERT(!"Unexpected number of dimensions");
     }
 
-    template <typename Range>
-    void scheduleSycl(const Range & range, const OpenClKernel & kernel, const KernelArguments & args, services::Status * status = nullptr)
+    template <typename SyclRange, typename Range>
+    void scheduleSycl(const SyclRange & syclRange, const Range & range, const OpenClKernel & kernel, const KernelArguments & args,
+                      services::Status * status = nullptr)
     {
         SyclBufferStorage bufferStorage;
 
         cl::sycl::kernel syclKernel = kernel.toSycl(_queue.get_context());
 
+        const bool isProfiled      = DeviceProfiler::isEnabled();
+        const long long submitTime = isProfiled ? DeviceProfiler::now() : 0;
+
+        // The runtime does not order the kernels with USM arguments since there
+        // are no accessors, so such kernels wait for all pending operations and
+        // complete before the return as the host may access the USM directly
+        const bool hasUsm = hasUsmArguments(args);
+        const std::vector<cl::sycl::event> dependencies = hasUsm ? getPendingEvents() : std::vector<cl::sycl::event>();
+
         auto event = _queue.submit([&](cl::sycl::handler & cgh) {
+            if (!dependencies.empty())
+            {
+                cgh.depends_on(dependencies);
+            }
             passArguments(cgh, bufferStorage, args);
-            cgh.parallel_for(range, syclKernel);
+            cgh.parallel_for(syclRange, syclKernel);
         });
 
+        if (_isAsynchronous && !hasUsm)
+        {
+            PendingOperation operation(event);
+            if (isProfiled)
+            {
+                operation.isProfiled = true;
+                operation.name       = services::String(kernel.getName());
+                operation.record     = DeviceOperationRecord(nullptr, deviceKernel, submitTime);
+                setProfiledRange(operation.record, range);
+            }
+            addPending(operation, status);
+            return;
+        }
+
         event.wait_and_throw();
+
+        if (isProfiled)
+        {
+            DeviceOperationRecord record(kernel.getName(), deviceKernel, submitTime);
+            setProfiledRange(record, range);
+            recordDeviceEvent(_queue, event, record);
+        }
+    }
+
+    struct PendingOperation
+    {
+        explicit PendingOperation(const cl::sycl::event & operationEvent)
+            : event(operationEvent), isProfiled(false), record(nullptr, deviceKernel, 0)
+        {}
+
+        cl::sycl::event event;
+        bool isProfiled;
+        services::String name; /*!< Copy of the kernel name, the kernel may be released before the wait */
+        DeviceOperationRecord record;
+    };
+
+    /* The completed operations are dropped from the list, so it grows only
+     * while the device is behind the host */
+    void addPending(const PendingOperation & operation, services::Status * status)
+    {
+        std::vector<PendingOperation> completed;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_pending.size() >= maxPendingOperations)
+            {
+                std::vector<PendingOperation> pending;
+                for (size_t i = 0; i < _pending.size(); i++)
+                {
+                    (isCompleted(_pending[i].event) ? completed : pending).push_back(_pending[i]);
+                }
+                // The host waits for the oldest half when the device is too far behind
+                if (pending.size() >= maxPendingOperations)
+                {
+                    const size_t half = pending.size() / 2;
+                    completed.insert(completed.end(), pending.begin(), pending.begin() + half);
+                    pending.erase(pending.begin(), pending.begin() + half);
+                }
+                _pending.swap(pending);
+            }
+            _pending.push_back(operation);
+        }
+        waitFor(completed, status);
+    }
+
+    void waitFor(std::vector<PendingOperation> & operations, services::Status * status)
+    {
+        for (size_t i = 0; i < operations.size(); i++)
+        {
+            PendingOperation & operation = operations[i];
+            try
+            {
+                operation.event.wait_and_throw();
+            }
+            catch (const cl::sycl::exception & e)
+            {
+                convertSyclExceptionToStatus(e, status);
+                continue;
+            }
+            if (operation.isProfiled)
+            {
+                operation.record.name = operation.name.c_str();
+                recordDeviceEvent(_queue, operation.event, operation.record);
+            }
+        }
+    }
+
+    static bool isCompleted(const cl::sycl::event & event)
+    {
+        return event.get_info<cl::sycl::info::event::command_execution_status>() == cl::sycl::info::event_command_status::complete;
+    }
+
+    static bool isSynchronousSubmissionRequested()
+    {
+        const char * value = std::getenv("DAAL_GPU_SYNCHRONOUS_SUBMISSION");
+        return value && value[0] && std::strcmp(value, "0") != 0;
+    }
+
+    static void copyRange(const KernelRange & range, size_t * recordRange)
+    {
+        recordRange[0] = range.upper1();
+        recordRange[1] = range.upper2();
+        recordRange[2] = range.upper3();
+    }
+
+    static void setProfiledRange(DeviceOperationRecord & record, const KernelRange & range)
+    {
+        record.dimensions = range.dimensions();
+        copyRange(range, record.globalRange);
+    }
+
+    static void setProfiledRange(DeviceOperationRecord & record, const KernelNDRange & range)
+    {
+        record.dimensions = range.dimensions();
+        copyRange(range.global(), record.globalRange);
+        copyRange(range.local(), record.localRange);
+    }
+
+    static bool hasUsmArguments(const KernelArguments & args)
+    {
+        for (size_t i = 0; i < args.size(); i++)
+        {
+            const auto & arg = args.get(i);
+            SyclKernelSchedulerUsmArgChecker checker(arg);
+            TypeDispatcher::dispatch(arg.dataType(), checker);
+            if (checker.isUsm())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<cl::sycl::event> getPendingEvents()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<cl::sycl::event> events;
+        events.reserve(_pending.size());
+        for (size_t i = 0; i < _pending.size(); i++)
+        {
+            events.push_back(_pending[i].event);
+        }
+        return events;
     }
 
     void passArguments(cl::sycl::handler & cgh, SyclBufferStorage & storage, const KernelArguments & args) const
@@ -611,7 +937,12 @@ private:
     }
 
 private:
+    static const size_t maxPendingOperations = 256;
+
     cl::sycl::queue & _queue;
+    bool _isAsynchronous;
+    std::mutex _mutex;
+    std::vector<PendingOperation> _pending;
 };
 
 } // namespace interface1
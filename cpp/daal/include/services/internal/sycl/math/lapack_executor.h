@@ -145,9 +145,124 @@ public:
     }
 };
 
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__GERQFEXECUTOR"></a>
+ *  \brief Adapter for GERQF routine
+ */
+class GerqfExecutor
+{
+private:
+    struct Execute
+    {
+        cl::sycl::queue & queue;
+        const size_t m;
+        const size_t n;
+        UniversalBuffer & a_buffer;
+        const size_t lda;
+        UniversalBuffer & tau_buffer;
+        services::Status * status;
+
+        explicit Execute(cl::sycl::queue & queue, const size_t m, const size_t n, UniversalBuffer & a_buffer, const size_t lda,
+                         UniversalBuffer & tau_buffer, services::Status * status)
+            : queue(queue), m(m), n(n), a_buffer(a_buffer), lda(lda), tau_buffer(tau_buffer), status(status)
+        {}
+
+        template <typename T>
+        void operator()(Typelist<T>)
+        {
+            auto a_buffer_t   = a_buffer.template get<T>();
+            auto tau_buffer_t = tau_buffer.template get<T>();
+
+#ifdef ONEAPI_DAAL_NO_MKL_GPU_FUNC
+            ReferenceGerqf<T> functor;
+#else
+            MKLGerqf<T> functor(queue);
+#endif
+
+            services::internal::tryAssignStatus(status, functor(m, n, a_buffer_t, lda, tau_buffer_t));
+        }
+    };
+
+public:
+    static void run(cl::sycl::queue & queue, const size_t m, const size_t n, UniversalBuffer & a_buffer, const size_t lda,
+                    UniversalBuffer & tau_buffer, services::Status * status)
+    {
+        Execute op(queue, m, n, a_buffer, lda, tau_buffer, status);
+        TypeDispatcher::floatDispatch(a_buffer.type(), op);
+    }
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__ORMRQEXECUTOR"></a>
+ *  \brief Adapter for ORMRQ routine
+ */
+class OrmrqExecutor
+{
+private:
+    struct Execute
+    {
+        cl::sycl::queue & queue;
+        const math::Side side;
+        const math::Transpose trans;
+        const size_t m;
+        const size_t n;
+        const size_t k;
+        UniversalBuffer & a_buffer;
+        const size_t lda;
+        UniversalBuffer & tau_buffer;
+        UniversalBuffer & c_buffer;
+        const size_t ldc;
+        services::Status * status;
+
+        explicit Execute(cl::sycl::queue & queue, const math::Side side, const math::Transpose trans, const size_t m, const size_t n, const size_t k,
+                         UniversalBuffer & a_buffer, const size_t lda, UniversalBuffer & tau_buffer, UniversalBuffer & c_buffer, const size_t ldc,
+                         services::Status * status)
+            : queue(queue),
+              side(side),
+              trans(trans),
+              m(m),
+              n(n),
+              k(k),
+              a_buffer(a_buffer),
+              lda(lda),
+              tau_buffer(tau_buffer),
+              c_buffer(c_buffer),
+              ldc(ldc),
+              status(status)
+        {}
+
+        template <typename T>
+        void operator()(Typelist<T>)
+        {
+            auto a_buffer_t   = a_buffer.template get<T>();
+            auto tau_buffer_t = tau_buffer.template get<T>();
+            auto c_buffer_t   = c_buffer.template get<T>();
+
+#ifdef ONEAPI_DAAL_NO_MKL_GPU_FUNC
+            ReferenceOrmrq<T> functor;
+#else
+            MKLOrmrq<T> functor(queue);
+#endif
+
+            services::internal::tryAssignStatus(status, functor(side, trans, m, n, k, a_buffer_t, lda, tau_buffer_t, c_buffer_t, ldc));
+        }
+    };
+
+public:
+    static void run(cl::sycl::queue & queue, const math::Side side, const math::Transpose trans, const size_t m, const size_t n, const size_t k,
+                    UniversalBuffer & a_buffer, const size_t lda, UniversalBuffer & tau_buffer, UniversalBuffer & c_buffer, const size_t ldc,
+                    services::Status * status)
+    {
+        Execute op(queue, side, trans, m, n, k, a_buffer, lda, tau_buffer, c_buffer, ldc, status);
+        TypeDispatcher::floatDispatch(a_buffer.type(), op);
+    }
+};
+
 /** @} */
 } // namespace interface1
 
+using interface1::GerqfExecutor;
+using interface1::OrmrqExecutor;
 using interface1::PotrfExecutor;
 using interface1::PotrsExecutor;
 
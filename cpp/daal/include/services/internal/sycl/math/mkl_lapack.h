@@ -146,10 +146,77 @@ private:
     cl::sycl::queue & _queue;
 };
 
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__MKLGERQF"></a>
+ *  \brief Adapter for MKL GERQF routine
+ */
+template <typename algorithmFPType>
+struct MKLGerqf
+{
+    MKLGerqf(cl::sycl::queue & queue) : _queue(queue) {}
+
+    services::Status operator()(const size_t m, const size_t n, services::internal::Buffer<algorithmFPType> & a, const size_t lda,
+                                services::internal::Buffer<algorithmFPType> & tau)
+    {
+        services::Status status;
+        cl::sycl::buffer<algorithmFPType, 1> a_sycl_buff   = a.toSycl();
+        cl::sycl::buffer<algorithmFPType, 1> tau_sycl_buff = tau.toSycl();
+
+        const std::int64_t scratchpadSize = ::oneapi::fpk::lapack::gerqf_scratchpad_size<algorithmFPType>(_queue, m, n, lda);
+        cl::sycl::buffer<algorithmFPType, 1> scratchpad { cl::sycl::range<1>(scratchpadSize) };
+
+        ::oneapi::fpk::lapack::gerqf(_queue, m, n, a_sycl_buff, lda, tau_sycl_buff, scratchpad, scratchpad.get_count());
+
+        _queue.wait();
+        return status;
+    }
+
+private:
+    cl::sycl::queue & _queue;
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__MKLORMRQ"></a>
+ *  \brief Adapter for MKL ORMRQ routine
+ */
+template <typename algorithmFPType>
+struct MKLOrmrq
+{
+    MKLOrmrq(cl::sycl::queue & queue) : _queue(queue) {}
+
+    services::Status operator()(const math::Side side, const math::Transpose trans, const size_t m, const size_t n, const size_t k,
+                                services::internal::Buffer<algorithmFPType> & a, const size_t lda, services::internal::Buffer<algorithmFPType> & tau,
+                                services::internal::Buffer<algorithmFPType> & c, const size_t ldc)
+    {
+        services::Status status;
+        const ::oneapi::fpk::side sidemkl = side == math::Side::Left ? ::oneapi::fpk::side::left : ::oneapi::fpk::side::right;
+        const ::oneapi::fpk::transpose transmkl =
+            trans == math::Transpose::Trans ? ::oneapi::fpk::transpose::trans : ::oneapi::fpk::transpose::nontrans;
+        cl::sycl::buffer<algorithmFPType, 1> a_sycl_buff   = a.toSycl();
+        cl::sycl::buffer<algorithmFPType, 1> tau_sycl_buff = tau.toSycl();
+        cl::sycl::buffer<algorithmFPType, 1> c_sycl_buff   = c.toSycl();
+
+        const std::int64_t scratchpadSize =
+            ::oneapi::fpk::lapack::ormrq_scratchpad_size<algorithmFPType>(_queue, sidemkl, transmkl, m, n, k, lda, ldc);
+        cl::sycl::buffer<algorithmFPType, 1> scratchpad { cl::sycl::range<1>(scratchpadSize) };
+
+        ::oneapi::fpk::lapack::ormrq(_queue, sidemkl, transmkl, m, n, k, a_sycl_buff, lda, tau_sycl_buff, c_sycl_buff, ldc, scratchpad,
+                                     scratchpad.get_count());
+
+        _queue.wait();
+        return status;
+    }
+
+private:
+    cl::sycl::queue & _queue;
+};
+
 /** @} */
 
 } // namespace interface1
 
+using interface1::MKLGerqf;
+using interface1::MKLOrmrq;
 using interface1::MKLPotrf;
 using interface1::MKLPotrs;
 
@@ -70,9 +70,39 @@ struct DAAL_EXPORT ReferencePotrs
                                 const size_t lda, services::internal::Buffer<algorithmFPType> & b_buffer, const size_t ldb);
 };
 
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__REFERENCEGERQF"></a>
+ *  \brief Adapter for reference GERQF routine
+ */
+template <typename algorithmFPType>
+struct DAAL_EXPORT ReferenceGerqf
+{
+    ReferenceGerqf() {}
+
+    services::Status operator()(const size_t m, const size_t n, services::internal::Buffer<algorithmFPType> & a_buffer, const size_t lda,
+                                services::internal::Buffer<algorithmFPType> & tau_buffer);
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__REFERENCEORMRQ"></a>
+ *  \brief Adapter for reference ORMRQ routine
+ */
+template <typename algorithmFPType>
+struct DAAL_EXPORT ReferenceOrmrq
+{
+    ReferenceOrmrq() {}
+
+    services::Status operator()(const math::Side side, const math::Transpose trans, const size_t m, const size_t n, const size_t k,
+                                services::internal::Buffer<algorithmFPType> & a_buffer, const size_t lda,
+                                services::internal::Buffer<algorithmFPType> & tau_buffer, services::internal::Buffer<algorithmFPType> & c_buffer,
+                                const size_t ldc);
+};
+
 /** @} */
 } // namespace interface1
 
+using interface1::ReferenceGerqf;
+using interface1::ReferenceOrmrq;
 using interface1::ReferencePotrf;
 using interface1::ReferencePotrs;
 
@@ -48,9 +48,16 @@ enum UpLo
     Lower
 };
 
+enum Side
+{
+    Left,
+    Right
+};
+
 } // namespace interface1
 
 using interface1::Layout;
+using interface1::Side;
 using interface1::Transpose;
 using interface1::UpLo;
 
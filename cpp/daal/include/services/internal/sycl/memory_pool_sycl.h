@@ -0,0 +1,253 @@
+/* file: memory_pool_sycl.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef DAAL_SYCL_INTERFACE
+    #ifndef __DAAL_SERVICES_INTERNAL_SYCL_MEMORY_POOL_SYCL_H__
+        #define __DAAL_SERVICES_INTERNAL_SYCL_MEMORY_POOL_SYCL_H__
+
+        #include <CL/sycl.hpp>
+
+        #include <cstdlib>
+        #include <list>
+        #include <mutex>
+        #include <vector>
+
+        #include "services/internal/any.h"
+        #include "services/internal/buffer.h"
+        #include "services/internal/sycl/types.h"
+        #include "services/internal/sycl/types_utils.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace sycl
+{
+namespace interface1
+{
+/** @ingroup oneapi_internal
+ * @{
+ */
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__SYCLMEMORYPOOL"></a>
+ *  \brief Caching pool of the SYCL* buffers allocated by the execution context.
+ *  The buffer released by the algorithm and all its sub-buffers stays in the pool and is given to
+ *  the next allocation of the same type and size, so the iterations of the algorithms do not
+ *  allocate the device memory and the release does not wait for the kernels using the buffer.
+ *  The same SYCL* buffer is reused, so the runtime orders the kernels of the next user of the
+ *  buffer after the kernels of the previous one. The released buffers are kept in the bins of
+ *  the power of two sizes in bytes. The pool keeps at most DAAL_GPU_MEMORY_POOL_LIMIT megabytes
+ *  of the released buffers, the largest buffers are freed first, the zero limit disables the pool.
+ */
+class SyclMemoryPool : public Base
+{
+public:
+    SyclMemoryPool() : _cachedBytes(0), _limit(getLimitFromEnvironment()) {}
+
+    ~SyclMemoryPool() { clear(); }
+
+    /**
+     *  Returns the buffer of the type and the size, the released buffer of the pool is taken if it is available
+     *  \param[in] pool       The pool, the allocated buffer keeps it alive
+     *  \param[in] type       Type of the elements
+     *  \param[in] bufferSize Number of the elements
+     */
+    static UniversalBuffer allocate(const SharedPtr<SyclMemoryPool> & pool, TypeId type, size_t bufferSize)
+    {
+        Allocate allocateOp(pool, bufferSize);
+        TypeDispatcher::dispatch(type, allocateOp);
+        return allocateOp.buffer;
+    }
+
+    /** Returns the number of bytes of the released buffers kept by the pool */
+    size_t getCachedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _cachedBytes;
+    }
+
+    /** Frees the released buffers kept by the pool */
+    void clear()
+    {
+        std::vector<Any> freed;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < binCount; i++)
+            {
+                for (std::list<Entry>::iterator it = _bins[i].begin(); it != _bins[i].end(); ++it)
+                {
+                    freed.push_back(it->buffer);
+                }
+                _bins[i].clear();
+            }
+            _cachedBytes = 0;
+        }
+    }
+
+private:
+    struct Entry
+    {
+        TypeId type;
+        size_t count;
+        size_t bytes;
+        Any buffer; /*!< cl::sycl::buffer<T, 1> */
+    };
+
+    /**
+     *  The owner of the buffer given by the pool, returns the buffer to the pool when the
+     *  buffer and its sub-buffers are released
+     */
+    template <typename T>
+    class Block : public Base
+    {
+    public:
+        Block(const SharedPtr<SyclMemoryPool> & pool, const cl::sycl::buffer<T, 1> & buffer) : _pool(pool), _buffer(buffer) {}
+
+        ~Block() DAAL_C11_OVERRIDE
+        {
+            try
+            {
+                _pool->release(TypeIds::id<T>(), _buffer.get_count(), _buffer.get_count() * sizeof(T), Any(_buffer));
+            }
+            catch (...)
+            {
+                // The buffer is freed if it cannot be returned to the pool
+            }
+        }
+
+    private:
+        SharedPtr<SyclMemoryPool> _pool;
+        cl::sycl::buffer<T, 1> _buffer;
+    };
+
+    struct Allocate
+    {
+        const SharedPtr<SyclMemoryPool> & pool;
+        size_t bufferSize;
+        UniversalBuffer buffer;
+
+        Allocate(const SharedPtr<SyclMemoryPool> & memoryPool, size_t size) : pool(memoryPool), bufferSize(size) {}
+
+        template <typename T>
+        void operator()(Typelist<T>)
+        {
+            typedef cl::sycl::buffer<T, 1> BufferType;
+            if (!pool || pool->_limit == 0 || bufferSize == 0)
+            {
+                buffer = services::internal::Buffer<T>(BufferType(bufferSize));
+                return;
+            }
+
+            Any cached;
+            const BufferType syclBuffer = pool->take(TypeIds::id<T>(), bufferSize, bufferSize * sizeof(T), cached) ?
+                                              cached.get<BufferType>() :
+                                              BufferType(bufferSize);
+            buffer = services::internal::Buffer<T>(syclBuffer, SharedPtr<Base>(new Block<T>(pool, syclBuffer)));
+        }
+    };
+
+    static size_t getBin(size_t bytes)
+    {
+        size_t bin = 0;
+        while (bin + 1 < binCount && (size_t(1) << (bin + 1)) <= bytes) bin++;
+        return bin;
+    }
+
+    /* The most recently released buffer of the type and the size is taken */
+    bool take(TypeId type, size_t count, size_t bytes, Any & buffer)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::list<Entry> & bin = _bins[getBin(bytes)];
+        for (std::list<Entry>::reverse_iterator it = bin.rbegin(); it != bin.rend(); ++it)
+        {
+            if (it->type == type && it->count == count)
+            {
+                buffer.swap(it->buffer);
+                _cachedBytes -= it->bytes;
+                bin.erase(--(it.base()));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void release(TypeId type, size_t count, size_t bytes, const Any & buffer)
+    {
+        std::vector<Any> freed;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (bytes > _limit)
+            {
+                return;
+            }
+
+            Entry entry;
+            entry.type   = type;
+            entry.count  = count;
+            entry.bytes  = bytes;
+            entry.buffer = buffer;
+            _bins[getBin(bytes)].push_back(entry);
+            _cachedBytes += bytes;
+
+            /* The buffers are freed out of the lock since the free waits for their kernels */
+            for (size_t i = binCount; i > 0 && _cachedBytes > _limit; i--)
+            {
+                std::list<Entry> & bin = _bins[i - 1];
+                while (!bin.empty() && _cachedBytes > _limit)
+                {
+                    freed.push_back(bin.front().buffer);
+                    _cachedBytes -= bin.front().bytes;
+                    bin.pop_front();
+                }
+            }
+        }
+    }
+
+    static size_t getLimitFromEnvironment()
+    {
+        const char * value = std::getenv("DAAL_GPU_MEMORY_POOL_LIMIT");
+        if (!value || !value[0])
+        {
+            return defaultLimitInMegabytes << 20;
+        }
+        return size_t(std::strtoull(value, nullptr, 10)) << 20;
+    }
+
+    static const size_t binCount                = 64;
+    static const size_t defaultLimitInMegabytes = 256;
+
+    std::list<Entry> _bins[binCount];
+    size_t _cachedBytes;
+    const size_t _limit;
+    mutable std::mutex _mutex;
+};
+
+/** @} */
+} // namespace interface1
+
+using interface1::SyclMemoryPool;
+
+} // namespace sycl
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+    #endif
+#endif // DAAL_SYCL_INTERFACE
@@ -0,0 +1,170 @@
+/* file: program_binary_cache.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef __DAAL_SERVICES_INTERNAL_SYCL_PROGRAM_BINARY_CACHE_H__
+#define __DAAL_SERVICES_INTERNAL_SYCL_PROGRAM_BINARY_CACHE_H__
+
+#include "services/daal_defines.h"
+#include "services/collection.h"
+#include "services/daal_string.h"
+#include "services/library_version_info.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace sycl
+{
+namespace interface1
+{
+/** @ingroup oneapi_internal
+ * @{
+ */
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__PROGRAMBINARYCACHEKEY"></a>
+ *  \brief Accumulates the 128-bit hash of all inputs which affect the
+ *  compiled program: the device, the driver, the options and the source
+ */
+class ProgramBinaryCacheKey
+{
+public:
+    ProgramBinaryCacheKey() : _low(14695981039346656037ULL), _high(14695981039346656037ULL)
+    {
+        // The binaries of the other library versions are never reused
+        add(__INTEL_DAAL__);
+        add(__INTEL_DAAL_MINOR__);
+        add(__INTEL_DAAL_UPDATE__);
+        add(__INTEL_DAAL_BUILD_DATE);
+    }
+
+    ProgramBinaryCacheKey & add(const char * value)
+    {
+        const char * c = value ? value : "";
+        for (; *c; c++)
+        {
+            addByte(static_cast<unsigned char>(*c));
+        }
+        // The terminator separates the adjacent parts
+        addByte(0);
+        return *this;
+    }
+
+    ProgramBinaryCacheKey & add(unsigned long long value)
+    {
+        for (size_t i = 0; i < sizeof(value); i++)
+        {
+            addByte(static_cast<unsigned char>(value >> (8 * i)));
+        }
+        return *this;
+    }
+
+    /** The hexadecimal representation used as the file name */
+    services::String getValue() const
+    {
+        const char digits[] = "0123456789abcdef";
+        char value[33];
+        for (size_t i = 0; i < 16; i++)
+        {
+            value[i]      = digits[(_high >> (60 - 4 * i)) & 0xF];
+            value[16 + i] = digits[(_low >> (60 - 4 * i)) & 0xF];
+        }
+        value[32] = '\0';
+        return services::String(value);
+    }
+
+private:
+    void addByte(unsigned char byte)
+    {
+        // The FNV-1a and FNV-1 hashes of the same bytes
+        _low  = (_low ^ byte) * 1099511628211ULL;
+        _high = (_high * 1099511628211ULL) ^ byte;
+    }
+
+    unsigned long long _low;
+    unsigned long long _high;
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__PROGRAMBINARYCACHE"></a>
+ *  \brief Persistent storage of the compiled GPU program binaries. The cache
+ *  is located in the directory given by setDirectory() or by the
+ *  DAAL_GPU_PROGRAM_CACHE_DIR environment variable and is disabled if
+ *  neither is set. Every binary is stored in a separate file named by its key.
+ */
+class DAAL_EXPORT ProgramBinaryCache
+{
+public:
+    /** Sets the cache directory, the empty path disables the cache */
+    static void setDirectory(const char * path);
+    static services::String getDirectory();
+
+    static bool isEnabled();
+
+    /** Reads the binary stored with the key, returns false if there is none */
+    static bool load(const char * key, services::Collection<unsigned char> & binary);
+
+    /** Stores the binary with the key, returns false if the file cannot be written */
+    static bool store(const char * key, const unsigned char * binary, size_t size);
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__PROGRAMBINARYBUNDLEENTRY"></a>
+ *  \brief Precompiled program binary embedded into the library
+ */
+struct ProgramBinaryBundleEntry
+{
+    const char * key;             /*!< Key computed by ProgramBinaryCacheKey */
+    const unsigned char * binary; /*!< Program binary for the device of the key */
+    size_t size;                  /*!< Size of the binary in bytes */
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__PROGRAMBINARYBUNDLE"></a>
+ *  \brief Registry of the program binaries compiled ahead of time for the
+ *  known devices. The entries are registered by the sources generated with
+ *  dev/gen_program_bundle.py and are looked up before the on-disk cache.
+ */
+class DAAL_EXPORT ProgramBinaryBundle
+{
+public:
+    /** Registers the static array of entries, the array is not copied */
+    static void registerEntries(const ProgramBinaryBundleEntry * entries, size_t count);
+
+    static bool isEmpty();
+
+    /** Finds the binary by the key, returns false if there is none */
+    static bool find(const char * key, const unsigned char ** binary, size_t * size);
+};
+
+/** @} */
+} // namespace interface1
+
+using interface1::ProgramBinaryBundle;
+using interface1::ProgramBinaryBundleEntry;
+using interface1::ProgramBinaryCache;
+using interface1::ProgramBinaryCacheKey;
+
+} // namespace sycl
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
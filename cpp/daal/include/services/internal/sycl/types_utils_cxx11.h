@@ -18,6 +18,7 @@
 #ifndef __DAAL_SERVICES_INTERNAL_SYCL_TYPES_UTILS_CXX11_H__
 #define __DAAL_SERVICES_INTERNAL_SYCL_TYPES_UTILS_CXX11_H__
 
+#include "services/internal/sycl/device_profiler.h"
 #include "services/internal/sycl/types_utils.h"
 
 namespace daal
@@ -79,30 +80,44 @@ private:
         UniversalBuffer & srcUnivers;
         size_t srcOffset;
         size_t count;
+        bool isBlocking;
+        cl::sycl::event event;
 
-        explicit Execute(cl::sycl::queue & queue, UniversalBuffer & dst, size_t desOffset, UniversalBuffer & src, size_t srcOffset, size_t count)
-            : queue(queue), dstUnivers(dst), dstOffset(desOffset), srcUnivers(src), srcOffset(srcOffset), count(count)
+        explicit Execute(cl::sycl::queue & queue, UniversalBuffer & dst, size_t desOffset, UniversalBuffer & src, size_t srcOffset, size_t count,
+                         bool isBlocking)
+            : queue(queue), dstUnivers(dst), dstOffset(desOffset), srcUnivers(src), srcOffset(srcOffset), count(count), isBlocking(isBlocking)
         {}
 
         template <typename T>
         void operator()(Typelist<T>)
         {
-            auto src              = srcUnivers.get<T>().toSycl();
-            auto dst              = dstUnivers.get<T>().toSycl();
-            cl::sycl::event event = queue.submit([&](cl::sycl::handler & cgh) {
+            auto src                   = srcUnivers.get<T>().toSycl();
+            auto dst                   = dstUnivers.get<T>().toSycl();
+            const bool isProfiled      = DeviceProfiler::isEnabled();
+            const long long submitTime = isProfiled ? DeviceProfiler::now() : 0;
+            event                      = queue.submit([&](cl::sycl::handler & cgh) {
                 auto src_acc = src.template get_access<cl::sycl::access::mode::read>(cgh, cl::sycl::range<1>(count), cl::sycl::id<1>(srcOffset));
                 auto dst_acc = dst.template get_access<cl::sycl::access::mode::write>(cgh, cl::sycl::range<1>(count), cl::sycl::id<1>(dstOffset));
                 cgh.copy(src_acc, dst_acc);
             });
+            if (!isBlocking) return;
             event.wait();
+            if (isProfiled) recordDeviceEvent(queue, event, "copy_buffer", deviceTransfer, submitTime, count * sizeof(T));
         }
     };
 
 public:
-    static void copy(cl::sycl::queue & queue, UniversalBuffer & dest, size_t dstOffset, UniversalBuffer & src, size_t srcOffset, size_t count)
+    /**
+     *  Copies the buffers, the non-blocking copy returns right after the
+     *  submission. The accessors order it with the other operations on the
+     *  same buffers.
+     */
+    static cl::sycl::event copy(cl::sycl::queue & queue, UniversalBuffer & dest, size_t dstOffset, UniversalBuffer & src, size_t srcOffset,
+                                size_t count, bool isBlocking = true)
     {
-        Execute op(queue, dest, dstOffset, src, srcOffset, count);
+        Execute op(queue, dest, dstOffset, src, srcOffset, count, isBlocking);
         TypeDispatcher::dispatch(dest.type(), op);
+        return op.event;
     }
 };
 
@@ -129,13 +144,16 @@ private:
         template <typename T>
         void operator()(Typelist<T>)
         {
-            auto src              = (T *)srcArray;
-            auto dst              = dstUnivers.get<T>().toSycl();
-            cl::sycl::event event = queue.submit([&](cl::sycl::handler & cgh) {
+            auto src                   = (T *)srcArray;
+            auto dst                   = dstUnivers.get<T>().toSycl();
+            const bool isProfiled      = DeviceProfiler::isEnabled();
+            const long long submitTime = isProfiled ? DeviceProfiler::now() : 0;
+            cl::sycl::event event      = queue.submit([&](cl::sycl::handler & cgh) {
                 auto dst_acc = dst.template get_access<cl::sycl::access::mode::write>(cgh, cl::sycl::range<1>(count), cl::sycl::id<1>(dstOffset));
                 cgh.copy(src, dst_acc);
             });
             event.wait();
+            if (isProfiled) recordDeviceEvent(queue, event, "copy_from_host", deviceTransfer, submitTime, count * sizeof(T));
         }
     };
 
@@ -159,26 +177,36 @@ private:
         cl::sycl::queue & queue;
         UniversalBuffer & dstUnivers;
         double value;
+        bool isBlocking;
+        cl::sycl::event event;
 
-        explicit Execute(cl::sycl::queue & queue, UniversalBuffer & dest, double value) : queue(queue), dstUnivers(dest), value(value) {}
+        explicit Execute(cl::sycl::queue & queue, UniversalBuffer & dest, double value, bool isBlocking)
+            : queue(queue), dstUnivers(dest), value(value), isBlocking(isBlocking)
+        {}
 
         template <typename T>
         void operator()(Typelist<T>)
         {
-            auto dst              = dstUnivers.get<T>().toSycl();
-            cl::sycl::event event = queue.submit([&](cl::sycl::handler & cgh) {
+            auto dst                   = dstUnivers.get<T>().toSycl();
+            const bool isProfiled      = DeviceProfiler::isEnabled();
+            const long long submitTime = isProfiled ? DeviceProfiler::now() : 0;
+            event                      = queue.submit([&](cl::sycl::handler & cgh) {
                 auto acc = dst.template get_access<cl::sycl::access::mode::write>(cgh);
                 cgh.fill(acc, static_cast<T>(value));
             });
+            if (!isBlocking) return;
             event.wait();
+            if (isProfiled) recordDeviceEvent(queue, event, "fill_buffer", deviceFill, submitTime, dst.get_count() * sizeof(T));
         }
     };
 
 public:
-    static void fill(cl::sycl::queue & queue, UniversalBuffer & dest, double value)
+    /** Fills the buffer, the non-blocking fill returns right after the submission */
+    static cl::sycl::event fill(cl::sycl::queue & queue, UniversalBuffer & dest, double value, bool isBlocking = true)
     {
-        Execute op(queue, dest, value);
+        Execute op(queue, dest, value, isBlocking);
         TypeDispatcher::dispatch(dest.type(), op);
+        return op.event;
     }
 };
 
@@ -25,6 +25,8 @@
 #include "algorithms/algorithm_base_mode_impl.h"
 #include "src/algorithms/argument_storage.h"
 #include "src/services/service_algo_utils.h"
+#include "src/services/service_arena.h"
+#include "services/internal/execution_context.h"
 
 #include "src/threading/service_thread_pinner.h"
 #include "src/services/service_topo.h"
@@ -178,6 +180,8 @@ services::Status AlgorithmImpl<mode>::computeNoThrow()
     s = setupCompute();
     if (s)
     {
+        // The temporaries of the kernels are released when the call returns
+        services::internal::ScopedArena arena;
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
         daal::services::internal::thread_pinner_t * pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
 
@@ -192,6 +196,8 @@ services::Status AlgorithmImpl<mode>::computeNoThrow()
         {
             s = this->_ac->compute();
         }
+        // The kernels are submitted asynchronously, their errors are reported here
+        services::internal::getDefaultContext().wait(&s);
     }
 
     s |= resetCompute();
@@ -237,6 +243,8 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
 
     if (s)
     {
+        // The temporaries of the kernels are released when the call returns
+        services::internal::ScopedArena arena;
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
         daal::services::internal::thread_pinner_t * pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
 
@@ -251,6 +259,8 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
         {
             s |= this->_ac->compute();
         }
+        // The kernels are submitted asynchronously, their errors are reported here
+        services::internal::getDefaultContext().wait(&s);
     }
 
     if (resetFlag) s |= resetCompute();
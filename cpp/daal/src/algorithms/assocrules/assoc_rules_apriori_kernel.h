@@ -49,8 +49,8 @@ public:
     services::Status compute(const NumericTable * a, NumericTable * r[], const daal::algorithms::Parameter * parameter);
 
 protected:
-    services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
-                                       size_t & L_size);
+    virtual services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                               size_t & L_size);
 
     Status allocateItemsetsTableData(ItemSetList<cpu> * L, size_t L_size, size_t minItemsetSize, NumericTable * largeItemsetsTable,
                                      NumericTable * largeItemsetsSupportTable, size_t & nLargeItemSets, size_t & nItemInLargeItemSets);
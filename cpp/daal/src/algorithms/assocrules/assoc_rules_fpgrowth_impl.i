@@ -0,0 +1,207 @@
+/* file: assoc_rules_fpgrowth_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the search of "large" itemsets for association rules
+//  FP-growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_IMPL_I__
+#define __ASSOC_RULES_FPGROWTH_IMPL_I__
+
+#include "src/algorithms/service_sort.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/assocrules/assoc_rules_fpgrowth_kernel.h"
+
+using namespace daal::algorithms::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  \brief Find "large" itemsets. The frequent items are known from the first pass over the transactions
+ *         made by the data set, the second pass builds FP-tree of the "large" transactions. The conditional
+ *         trees of the frequent items are mined in parallel tasks, the results of the tasks are merged
+ *         in the order of the items, so the output does not depend on the number of threads
+ *
+ *  \param minSupport[in]      minimum support
+ *  \param maxItemsetSize[in]  maximum size of the itemsets
+ *  \param data[in]            input data set
+ *  \param L[out]              lists of "large" itemsets of every size
+ *  \param L_size[out]         number of the lists that contain "large" itemsets
+ *  \return Status object
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::findLargeItemsets(size_t minSupport, size_t maxItemsetSize,
+                                                                                           assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                                                                           size_t & L_size)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->firstPass(minSupport, data, *L));
+    L_size = 1;
+
+    const size_t nUniqueItems = data.numOfUniqueItems;
+    if (nUniqueItems < 2 || data.numOfLargeTransactions == 0) return s;
+
+    /* Apriori method always searches for the itemsets of size 2, the same sizes are found here */
+    const size_t maxSize    = (maxItemsetSize < 2) ? 2 : maxItemsetSize;
+    const size_t bufferSize = (maxSize < nUniqueItems) ? maxSize : nUniqueItems;
+
+    TArray<size_t, cpu> rankToItemArray(nUniqueItems);
+    DAAL_CHECK_MALLOC(rankToItemArray.get());
+    const size_t * rankToItem = rankToItemArray.get();
+
+    FPTree<cpu> tree;
+    DAAL_CHECK_STATUS(s, buildTree(data, rankToItemArray.get(), tree));
+
+    TArray<ItemSetList<cpu>, cpu> resultsArray(nUniqueItems);
+    DAAL_CHECK_MALLOC(resultsArray.get());
+    ItemSetList<cpu> * results = resultsArray.get();
+    for (size_t r = 0; r < nUniqueItems; r++) results[r].setDataOwner(true);
+
+    SafeStatus safeStat;
+    daal::threader_for(nUniqueItems, nUniqueItems, [&](size_t r) {
+        TArray<size_t, cpu> buffer(2 * bufferSize);
+        DAAL_CHECK_MALLOC_THR(buffer.get());
+        size_t * pattern = buffer.get();
+        pattern[0]       = r;
+
+        FPGrowthMiner<cpu> miner(minSupport, maxSize, rankToItem, pattern, pattern + bufferSize, results[r]);
+        FPTree<cpu> condTree;
+        DAAL_CHECK_STATUS_THR(miner.buildConditionalTree(tree, r, condTree));
+        if (condTree.nNodes > 1)
+        {
+            DAAL_CHECK_STATUS_THR(miner.mine(condTree, 1));
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* The itemsets are moved from the lists of the tasks to the lists of their sizes */
+    for (size_t r = 0; r < nUniqueItems; r++)
+    {
+        for (typename ItemSetList<cpu>::Node * node = results[r].start; node; node = node->next())
+        {
+            assocrules_itemset<cpu> * itemset = node->itemSet();
+            if (L[itemset->size - 1].insert(itemset))
+            {
+                L_size = (itemset->size > L_size) ? itemset->size : L_size;
+            }
+            else
+            {
+                delete itemset;
+                s |= services::Status(services::ErrorMemoryAllocationFailed);
+            }
+        }
+        results[r].setDataOwner(false);
+    }
+    return s;
+}
+
+/**
+ *  \brief Build FP-tree of the "large" transactions. The ranks of the items are the positions
+ *         in the order of descending support, so the most frequent items are close to the root
+ *
+ *  \param data[in]         input data set
+ *  \param rankToItem[out]  item IDs of the ranks
+ *  \param tree[out]        FP-tree
+ *  \return Status object
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildTree(assocrules_dataset<cpu> & data, size_t * rankToItem,
+                                                                                   FPTree<cpu> & tree)
+{
+    const size_t nUniqueItems                = data.numOfUniqueItems;
+    const size_t nTransactions               = data.numOfLargeTransactions;
+    const assocRulesUniqueItem<cpu> * unique = data.uniq_items;
+
+    const size_t nItemIDs = unique[nUniqueItems - 1].itemID + 1;
+    TArray<size_t, cpu> orderArray(nUniqueItems);
+    TArray<size_t, cpu> itemToRankArray(nItemIDs);
+    DAAL_CHECK_MALLOC(orderArray.get() && itemToRankArray.get());
+    size_t * order      = orderArray.get();
+    size_t * itemToRank = itemToRankArray.get();
+
+    for (size_t i = 0; i < nUniqueItems; i++)
+    {
+        order[i] = i;
+    }
+    introSort<cpu>(order, order + nUniqueItems, [=](size_t a, size_t b) -> bool {
+        return (unique[a].support != unique[b].support) ? unique[a].support > unique[b].support : unique[a].itemID < unique[b].itemID;
+    });
+    for (size_t r = 0; r < nUniqueItems; r++)
+    {
+        rankToItem[r]                       = unique[order[r]].itemID;
+        itemToRank[unique[order[r]].itemID] = r;
+    }
+
+    size_t nRanks = 0;
+    for (size_t i = 0; i < nTransactions; i++)
+    {
+        nRanks += data.large_tran[i]->size;
+    }
+
+    TArray<size_t, cpu> ranksArray(nRanks);
+    TArray<size_t, cpu> offsetsArray(nTransactions + 1);
+    TArray<size_t, cpu> weightsArray(nTransactions);
+    DAAL_CHECK_MALLOC(ranksArray.get() && offsetsArray.get() && weightsArray.get());
+    size_t * ranks   = ranksArray.get();
+    size_t * offsets = offsetsArray.get();
+    size_t * weights = weightsArray.get();
+
+    /* The items of the "large" transactions are frequent, the repeated items are counted once */
+    size_t pos = 0;
+    offsets[0] = 0;
+    for (size_t i = 0; i < nTransactions; i++)
+    {
+        const assocrules_transaction<cpu> * tran = data.large_tran[i];
+        size_t * tranRanks                       = ranks + pos;
+        for (size_t j = 0; j < tran->size; j++)
+        {
+            tranRanks[j] = itemToRank[tran->items[j]];
+        }
+        qSort<size_t, cpu>(tran->size, tranRanks);
+
+        size_t tranSize = 0;
+        for (size_t j = 0; j < tran->size; j++)
+        {
+            if (tranSize == 0 || tranRanks[tranSize - 1] != tranRanks[j]) tranRanks[tranSize++] = tranRanks[j];
+        }
+        pos += tranSize;
+        offsets[i + 1] = pos;
+        weights[i]     = 1;
+    }
+
+    return tree.build(nUniqueItems, nTransactions, ranks, offsets, weights);
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
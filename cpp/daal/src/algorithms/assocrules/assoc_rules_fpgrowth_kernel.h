@@ -0,0 +1,63 @@
+/* file: assoc_rules_fpgrowth_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  by FP-growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_KERNEL_H__
+#define __ASSOC_RULES_FPGROWTH_KERNEL_H__
+
+#include "src/algorithms/assocrules/assoc_rules_apriori_kernel.h"
+#include "src/algorithms/assocrules/assoc_rules_fpgrowth_tree.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  Structure that contains kernels for FP-growth association rules mining.
+ *  Only the search of "large" item sets differs from Apriori method,
+ *  the result tables and the association rules are built in the same way
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AssociationRulesKernel<fpGrowth, algorithmFPType, cpu> : public AssociationRulesKernel<apriori, algorithmFPType, cpu>
+{
+protected:
+    services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                       size_t & L_size) DAAL_C11_OVERRIDE;
+
+    /** Build FP-tree of the "large" transactions with the items replaced by their ranks in the order of descending support */
+    services::Status buildTree(assocrules_dataset<cpu> & data, size_t * rankToItem, FPTree<cpu> & tree);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
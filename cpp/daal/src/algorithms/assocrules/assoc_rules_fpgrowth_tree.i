@@ -0,0 +1,313 @@
+/* file: assoc_rules_fpgrowth_tree.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declarations of FP-tree structure that is used in FP-growth algorithm
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_TREE_I__
+#define __ASSOC_RULES_FPGROWTH_TREE_I__
+
+#include "src/externals/service_memory.h"
+#include "src/algorithms/service_sort.h"
+#include "src/services/service_arrays.h"
+#include "src/algorithms/assocrules/assoc_rules_apriori_itemset.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+using services::internal::TArray;
+
+const size_t fpTreeNoNode = (size_t)-1;
+
+/**
+ *  \brief FP-tree stored in arrays. The items of the tree are the ranks in [0, nRanks),
+ *         every path from the root goes through the ranks in ascending order.
+ *         The node 0 is the root, the nodes of every rank are linked starting from head[rank]
+ */
+template <CpuType cpu>
+struct FPTree
+{
+    DAAL_NEW_DELETE();
+
+    FPTree() : nRanks(0), nNodes(0) {}
+
+    /**
+     *  \brief Builds the tree from the weighted sequences of distinct ranks sorted in ascending order.
+     *         The sequences are sorted lexicographically, so every sequence shares the longest prefix
+     *         with the previous one, which is kept on the stack of the nodes of the current path
+     *
+     *  \param nRanksTree[in]  number of ranks
+     *  \param nSequences[in]  number of sequences
+     *  \param ranks[in]       ranks of the sequences one after another
+     *  \param offsets[in]     offsets of the sequences in ranks, of length nSequences + 1, offsets[0] = 0
+     *  \param weights[in]     weights of the sequences
+     */
+    services::Status build(size_t nRanksTree, size_t nSequences, const size_t * ranks, const size_t * offsets, const size_t * weights)
+    {
+        nRanks                = nRanksTree;
+        const size_t maxNodes = offsets[nSequences] + 1;
+
+        item.reset(maxNodes);
+        count.reset(maxNodes);
+        parent.reset(maxNodes);
+        next.reset(maxNodes);
+        DAAL_CHECK_MALLOC(item.get() && count.get() && parent.get() && next.get());
+
+        item[0]   = fpTreeNoNode;
+        count[0]  = 0;
+        parent[0] = fpTreeNoNode;
+        next[0]   = fpTreeNoNode;
+        nNodes    = 1;
+        if (nRanks == 0) return services::Status();
+
+        head.reset(nRanks);
+        support.reset(nRanks);
+        TArray<size_t, cpu> orderArray(nSequences);
+        TArray<size_t, cpu> pathArray(nRanks);
+        DAAL_CHECK_MALLOC(head.get() && support.get() && (nSequences == 0 || orderArray.get()) && pathArray.get());
+        size_t * order = orderArray.get();
+        size_t * path  = pathArray.get();
+
+        for (size_t r = 0; r < nRanks; r++)
+        {
+            head[r]    = fpTreeNoNode;
+            support[r] = 0;
+        }
+        if (nSequences == 0) return services::Status();
+
+        for (size_t i = 0; i < nSequences; i++)
+        {
+            order[i] = i;
+        }
+        daal::algorithms::internal::introSort<cpu>(order, order + nSequences, [=](size_t a, size_t b) -> bool {
+            const size_t * sa   = ranks + offsets[a];
+            const size_t * sb   = ranks + offsets[b];
+            const size_t sizeA  = offsets[a + 1] - offsets[a];
+            const size_t sizeB  = offsets[b + 1] - offsets[b];
+            const size_t common = (sizeA < sizeB) ? sizeA : sizeB;
+            for (size_t k = 0; k < common; k++)
+            {
+                if (sa[k] != sb[k]) return sa[k] < sb[k];
+            }
+            return sizeA < sizeB;
+        });
+
+        const size_t * prev = nullptr;
+        size_t prevSize     = 0;
+        for (size_t i = 0; i < nSequences; i++)
+        {
+            const size_t s       = order[i];
+            const size_t * seq   = ranks + offsets[s];
+            const size_t seqSize = offsets[s + 1] - offsets[s];
+            const size_t w       = weights[s];
+
+            const size_t maxCommon = (prevSize < seqSize) ? prevSize : seqSize;
+            size_t common          = 0;
+            while (common < maxCommon && prev[common] == seq[common]) common++;
+
+            for (size_t d = 0; d < common; d++)
+            {
+                count[path[d]] += w;
+            }
+            for (size_t d = common; d < seqSize; d++)
+            {
+                const size_t node = nNodes++;
+                item[node]        = seq[d];
+                count[node]       = w;
+                parent[node]      = (d > 0) ? path[d - 1] : 0;
+                next[node]        = head[seq[d]];
+                head[seq[d]]      = node;
+                path[d]           = node;
+            }
+            prev     = seq;
+            prevSize = seqSize;
+        }
+
+        for (size_t node = 1; node < nNodes; node++)
+        {
+            support[item[node]] += count[node];
+        }
+        return services::Status();
+    }
+
+    size_t nRanks;               /*<! Number of ranks */
+    size_t nNodes;               /*<! Number of nodes including the root */
+    TArray<size_t, cpu> item;    /*<! Ranks of the nodes */
+    TArray<size_t, cpu> count;   /*<! Counts of the nodes */
+    TArray<size_t, cpu> parent;  /*<! Parents of the nodes */
+    TArray<size_t, cpu> next;    /*<! Next nodes of the same rank */
+    TArray<size_t, cpu> head;    /*<! First nodes of the ranks */
+    TArray<size_t, cpu> support; /*<! Supports of the ranks */
+
+private:
+    FPTree(const FPTree &);
+    FPTree & operator=(const FPTree &);
+};
+
+/**
+ *  \brief Mines the frequent itemsets that end with the given prefix pattern
+ *         from the conditional FP-trees of the pattern
+ */
+template <CpuType cpu>
+struct FPGrowthMiner
+{
+    /**
+     *  \param minSupport[in]      minimum support
+     *  \param maxItemsetSize[in]  maximum size of the itemsets
+     *  \param rankToItem[in]      item IDs of the ranks
+     *  \param pattern[in]         buffer for the ranks of the pattern, of length maxItemsetSize
+     *  \param items[in]           buffer for the items of the pattern, of length maxItemsetSize
+     *  \param result[out]         list of the itemsets found
+     */
+    FPGrowthMiner(size_t minSupport, size_t maxItemsetSize, const size_t * rankToItem, size_t * pattern, size_t * items, ItemSetList<cpu> & result)
+        : _minSupport(minSupport), _maxItemsetSize(maxItemsetSize), _rankToItem(rankToItem), _pattern(pattern), _items(items), _result(result)
+    {}
+
+    /** Builds the tree of the prefix paths of the rank r in the tree, the ranks that are not frequent on the paths are skipped */
+    services::Status buildConditionalTree(const FPTree<cpu> & tree, size_t r, FPTree<cpu> & condTree) const
+    {
+        TArray<size_t, cpu> countsArray(r);
+        DAAL_CHECK_MALLOC(r == 0 || countsArray.get());
+        size_t * counts = countsArray.get();
+        for (size_t k = 0; k < r; k++)
+        {
+            counts[k] = 0;
+        }
+
+        size_t nPaths = 0;
+        for (size_t u = tree.head[r]; u != fpTreeNoNode; u = tree.next[u])
+        {
+            for (size_t v = tree.parent[u]; v != 0; v = tree.parent[v])
+            {
+                counts[tree.item[v]] += tree.count[u];
+            }
+            nPaths++;
+        }
+
+        size_t nRanks = 0;
+        for (size_t u = tree.head[r]; u != fpTreeNoNode; u = tree.next[u])
+        {
+            for (size_t v = tree.parent[u]; v != 0; v = tree.parent[v])
+            {
+                nRanks += (counts[tree.item[v]] >= _minSupport);
+            }
+        }
+
+        TArray<size_t, cpu> ranksArray(nRanks);
+        TArray<size_t, cpu> offsetsArray(nPaths + 1);
+        TArray<size_t, cpu> weightsArray(nPaths);
+        DAAL_CHECK_MALLOC((nRanks == 0 || ranksArray.get()) && offsetsArray.get() && (nPaths == 0 || weightsArray.get()));
+        size_t * ranks   = ranksArray.get();
+        size_t * offsets = offsetsArray.get();
+        size_t * weights = weightsArray.get();
+
+        /* The paths go from the leaves to the root, so the ranks are reversed to the ascending order */
+        size_t iPath = 0;
+        size_t pos   = 0;
+        offsets[0]   = 0;
+        for (size_t u = tree.head[r]; u != fpTreeNoNode; u = tree.next[u], iPath++)
+        {
+            const size_t start = pos;
+            for (size_t v = tree.parent[u]; v != 0; v = tree.parent[v])
+            {
+                if (counts[tree.item[v]] >= _minSupport) ranks[pos++] = tree.item[v];
+            }
+            for (size_t i = start, j = pos; i + 1 < j; i++, j--)
+            {
+                const size_t tmp = ranks[i];
+                ranks[i]         = ranks[j - 1];
+                ranks[j - 1]     = tmp;
+            }
+            offsets[iPath + 1] = pos;
+            weights[iPath]     = tree.count[u];
+        }
+
+        return condTree.build(r, nPaths, ranks, offsets, weights);
+    }
+
+    /** Mines the itemsets that consist of the first patternSize ranks of the pattern and frequent ranks of the conditional tree */
+    services::Status mine(const FPTree<cpu> & condTree, size_t patternSize)
+    {
+        services::Status s;
+        for (size_t r = 0; r < condTree.nRanks; r++)
+        {
+            const size_t rankSupport = condTree.support[r];
+            if (rankSupport < _minSupport) continue;
+
+            _pattern[patternSize] = r;
+            const size_t size     = patternSize + 1;
+            DAAL_CHECK_STATUS(s, addItemset(size, rankSupport));
+
+            if (size < _maxItemsetSize)
+            {
+                FPTree<cpu> nextTree;
+                DAAL_CHECK_STATUS(s, buildConditionalTree(condTree, r, nextTree));
+                if (nextTree.nNodes > 1)
+                {
+                    DAAL_CHECK_STATUS(s, mine(nextTree, size));
+                }
+            }
+        }
+        return s;
+    }
+
+protected:
+    /** Adds the itemset of the first size ranks of the pattern, its items are sorted in ascending order */
+    services::Status addItemset(size_t size, size_t itemsetSupport)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            _items[i] = _rankToItem[_pattern[i]];
+        }
+        daal::algorithms::internal::qSort<size_t, cpu>(size, _items);
+
+        assocrules_itemset<cpu> * itemset = new assocrules_itemset<cpu>(size, _items, _items[size - 1], itemsetSupport);
+        DAAL_CHECK_MALLOC(itemset);
+        if (!itemset->ok() || !_result.insert(itemset))
+        {
+            services::Status s = itemset->ok() ? services::Status(services::ErrorMemoryAllocationFailed) : itemset->getLastStatus();
+            delete itemset;
+            return s;
+        }
+        return services::Status();
+    }
+
+    size_t _minSupport;
+    size_t _maxItemsetSize;
+    const size_t * _rankToItem;
+    size_t * _pattern;
+    size_t * _items;
+    ItemSetList<cpu> & _result;
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -74,11 +74,15 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
 
     NumericTableIface::StorageLayout iLayout = inTable->getDataLayout();
 
-    DAAL_CHECK(inTable->getNumberOfColumns() == inTable->getNumberOfRows(), ErrorIncorrectSizeOfInputNumericTable);
+    /* The table of nMatrices * p rows holds the stack of nMatrices p x p matrices */
+    const size_t nRows = inTable->getNumberOfRows();
+    const size_t nCols = inTable->getNumberOfColumns();
+    DAAL_CHECK(nRows % nCols == 0, ErrorIncorrectSizeOfInputNumericTable);
 
     int iLayoutInt = (int)iLayout;
     if (iLayoutInt & data_management::packed_mask)
     {
+        DAAL_CHECK(nRows == nCols, ErrorIncorrectTypeOfInputNumericTable);
         DAAL_CHECK(!(iLayout == NumericTableIface::lowerPackedTriangularMatrix || iLayout == NumericTableIface::upperPackedTriangularMatrix),
                    ErrorIncorrectTypeOfInputNumericTable);
     }
@@ -126,12 +130,13 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
 
     DAAL_CHECK((resTable->getNumberOfColumns() == algInput->get(data)->getNumberOfColumns())
-                   && (resTable->getNumberOfColumns() == resTable->getNumberOfRows()),
+                   && (resTable->getNumberOfRows() == algInput->get(data)->getNumberOfRows()),
                ErrorIncorrectSizeOfOutputNumericTable);
 
     const int rLayoutInt = (int)rLayout;
     if (rLayoutInt & data_management::packed_mask)
     {
+        DAAL_CHECK(resTable->getNumberOfColumns() == resTable->getNumberOfRows(), ErrorIncorrectTypeOfOutputNumericTable);
         DAAL_CHECK(rLayout == NumericTableIface::lowerPackedTriangularMatrix, ErrorIncorrectTypeOfOutputNumericTable);
     }
     return Status();
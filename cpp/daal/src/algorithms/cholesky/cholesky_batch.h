@@ -45,8 +45,9 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
 {
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+    size_t nRows     = algInput->get(data)->getNumberOfRows();
     services::Status status;
-    set(choleskyFactor, HomogenNumericTable<algFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &status));
+    set(choleskyFactor, HomogenNumericTable<algFPType>::create(nFeatures, nRows, NumericTable::doAllocate, &status));
     return status;
 }
 
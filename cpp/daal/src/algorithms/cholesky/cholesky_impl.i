@@ -23,6 +23,10 @@
 
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_lapack.h"
+#include "src/externals/service_math.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/threading/threading.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -41,11 +45,22 @@ bool isFull(NumericTableIface::StorageLayout rLayout);
 /**
  *  \brief Kernel for Cholesky calculation
  */
+/* The matrices of at most this dimension are factorized in groups interleaved element by element */
+const size_t maxInterleavedDim = 32;
+/* Number of the matrices in an interleaved group, the inner loops of the factorization run across the group */
+const size_t interleavedGroupSize = 16;
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status CholeskyKernel<algorithmFPType, method, cpu>::compute(NumericTable * aTable, NumericTable * r, const daal::algorithms::Parameter * par)
 {
     const size_t dim = aTable->getNumberOfColumns(); /* Dimension of input feature vectors */
 
+    const size_t nRows = aTable->getNumberOfRows();
+    if (nRows > dim)
+    {
+        return computeStack(aTable, r, dim, nRows / dim);
+    }
+
     const NumericTableIface::StorageLayout iLayout = aTable->getDataLayout();
     const NumericTableIface::StorageLayout rLayout = r->getDataLayout();
 
@@ -292,6 +307,188 @@ services::Status CholeskyKernel<algorithmFPType, method, cpu>::copyToLowerTriang
     return status;
 }
 
+/**
+ *  \brief Factorizes the stack of nMatrices full dim x dim matrices in parallel
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status CholeskyKernel<algorithmFPType, method, cpu>::computeStack(NumericTable * aTable, NumericTable * r, size_t dim, size_t nMatrices)
+{
+    const bool isInterleaved = (dim <= maxInterleavedDim);
+    const size_t nPerGroup   = isInterleaved ? interleavedGroupSize : 1;
+    const size_t nGroups     = nMatrices / nPerGroup + !!(nMatrices % nPerGroup);
+    const size_t bufferSize  = isInterleaved ? dim * dim * interleavedGroupSize : 1;
+
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(bufferSize);
+    SafeStatus safeStat;
+    daal::threader_for(nGroups, nGroups, [&](size_t iGroup) {
+        const size_t iFirst   = iGroup * nPerGroup;
+        const size_t nInGroup = (iFirst + nPerGroup > nMatrices) ? nMatrices - iFirst : nPerGroup;
+
+        ReadRows<algorithmFPType, cpu> rowsA(*aTable, iFirst * dim, nInGroup * dim);
+        DAAL_CHECK_BLOCK_STATUS_THR(rowsA);
+        WriteOnlyRows<algorithmFPType, cpu> rowsR(*r, iFirst * dim, nInGroup * dim);
+        DAAL_CHECK_BLOCK_STATUS_THR(rowsR);
+
+        if (isInterleaved)
+        {
+            algorithmFPType * buffer = tlsBuffer.local();
+            DAAL_CHECK_THR(buffer, ErrorMemoryAllocationFailed);
+            safeStat |= computeInterleaved(rowsA.get(), rowsR.get(), dim, nInGroup, buffer, iFirst);
+        }
+        else
+        {
+            safeStat |= computeOneByOne(rowsA.get(), rowsR.get(), dim, iFirst);
+        }
+    });
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Factorizes up to interleavedGroupSize small matrices at once. The element (i, j) of the matrix b of the group is kept in
+ *  buffer[(i * dim + j) * interleavedGroupSize + b], so the left-looking factorization updates the same element of all the matrices with
+ *  one vector operation and does not pay the per-call overhead of LAPACK. The group is padded with identity matrices.
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status CholeskyKernel<algorithmFPType, method, cpu>::computeInterleaved(const algorithmFPType * pA, algorithmFPType * pL, size_t dim,
+                                                                        size_t nMatrices, algorithmFPType * buffer, size_t iFirstMatrix)
+{
+    const size_t g      = interleavedGroupSize;
+    const size_t dimSqr = dim * dim;
+
+    for (size_t i = 0; i < dim; i++)
+    {
+        for (size_t j = 0; j <= i; j++)
+        {
+            algorithmFPType * x = buffer + (i * dim + j) * g;
+            for (size_t b = 0; b < nMatrices; b++)
+            {
+                x[b] = pA[b * dimSqr + i * dim + j];
+            }
+            for (size_t b = nMatrices; b < g; b++)
+            {
+                x[b] = (i == j) ? algorithmFPType(1) : algorithmFPType(0);
+            }
+        }
+    }
+
+    algorithmFPType diag[interleavedGroupSize];
+    algorithmFPType invDiag[interleavedGroupSize];
+    size_t failedMinor[interleavedGroupSize] = { 0 };
+
+    for (size_t j = 0; j < dim; j++)
+    {
+        algorithmFPType * ljj = buffer + (j * dim + j) * g;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t b = 0; b < g; b++)
+        {
+            diag[b] = ljj[b];
+        }
+        for (size_t k = 0; k < j; k++)
+        {
+            const algorithmFPType * ljk = buffer + (j * dim + k) * g;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t b = 0; b < g; b++)
+            {
+                diag[b] -= ljk[b] * ljk[b];
+            }
+        }
+        for (size_t b = 0; b < g; b++)
+        {
+            if (!(diag[b] > algorithmFPType(0)))
+            {
+                /* The factorization of the matrix goes on with the unit pivot, the matrix is reported below */
+                failedMinor[b] = failedMinor[b] ? failedMinor[b] : j + 1;
+                diag[b]        = algorithmFPType(1);
+            }
+            ljj[b]     = daal::internal::Math<algorithmFPType, cpu>::sSqrt(diag[b]);
+            invDiag[b] = algorithmFPType(1) / ljj[b];
+        }
+
+        for (size_t i = j + 1; i < dim; i++)
+        {
+            algorithmFPType * lij = buffer + (i * dim + j) * g;
+            for (size_t k = 0; k < j; k++)
+            {
+                const algorithmFPType * lik = buffer + (i * dim + k) * g;
+                const algorithmFPType * ljk = buffer + (j * dim + k) * g;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t b = 0; b < g; b++)
+                {
+                    lij[b] -= lik[b] * ljk[b];
+                }
+            }
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t b = 0; b < g; b++)
+            {
+                lij[b] *= invDiag[b];
+            }
+        }
+    }
+
+    for (size_t b = 0; b < nMatrices; b++)
+    {
+        if (failedMinor[b])
+        {
+            ErrorPtr error = Error::create(services::ErrorInputMatrixHasNonPositiveMinor, services::Minor, (int)failedMinor[b]);
+            error->addIntDetail(services::Row, (int)((iFirstMatrix + b) * dim));
+            return Status(error);
+        }
+        algorithmFPType * l = pL + b * dimSqr;
+        for (size_t i = 0; i < dim; i++)
+        {
+            for (size_t j = 0; j <= i; j++)
+            {
+                l[i * dim + j] = buffer[(i * dim + j) * g + b];
+            }
+            for (size_t j = i + 1; j < dim; j++)
+            {
+                l[i * dim + j] = algorithmFPType(0);
+            }
+        }
+    }
+    return Status();
+}
+
+/**
+ *  \brief Factorizes one matrix of the stack with the sequential LAPACK
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status CholeskyKernel<algorithmFPType, method, cpu>::computeOneByOne(const algorithmFPType * pA, algorithmFPType * pL, size_t dim, size_t iMatrix)
+{
+    for (size_t i = 0; i < dim; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j <= i; j++)
+        {
+            pL[i * dim + j] = pA[i * dim + j];
+        }
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = i + 1; j < dim; j++)
+        {
+            pL[i * dim + j] = algorithmFPType(0);
+        }
+    }
+
+    DAAL_INT info;
+    DAAL_INT dims = static_cast<DAAL_INT>(dim);
+    char uplo     = 'U';
+    Lapack<algorithmFPType, cpu>::xxpotrf(&uplo, &dims, pL, &dims, &info);
+
+    if (info > 0)
+    {
+        ErrorPtr error = Error::create(services::ErrorInputMatrixHasNonPositiveMinor, services::Minor, (int)info);
+        error->addIntDetail(services::Row, (int)(iMatrix * dim));
+        return Status(error);
+    }
+    return info < 0 ? Status(services::ErrorCholeskyInternal) : Status();
+}
+
 } // namespace internal
 } // namespace cholesky
 } // namespace algorithms
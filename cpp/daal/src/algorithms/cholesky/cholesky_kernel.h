@@ -55,6 +55,10 @@ private:
     bool copyToFullMatrix(NumericTableIface::StorageLayout iLayout, const algorithmFPType * pA, algorithmFPType * pL, size_t dim) const;
     services::Status copyToLowerTrianglePacked(NumericTableIface::StorageLayout iLayout, const algorithmFPType * pA, algorithmFPType * pL,
                                                size_t dim) const;
+    services::Status computeStack(NumericTable * aTable, NumericTable * r, size_t dim, size_t nMatrices);
+    services::Status computeInterleaved(const algorithmFPType * pA, algorithmFPType * pL, size_t dim, size_t nMatrices, algorithmFPType * buffer,
+                                        size_t iFirstMatrix);
+    services::Status computeOneByOne(const algorithmFPType * pA, algorithmFPType * pL, size_t dim, size_t iMatrix);
 };
 
 } // namespace internal
@@ -0,0 +1,53 @@
+/* file: concurrent_online.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the lock of the pool of the concurrent online algorithms.
+//--
+*/
+
+#include "algorithms/concurrent_online.h"
+#include "src/algorithms/service_threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace interface1
+{
+ConcurrentOnlineBase::ConcurrentOnlineBase() : _impl(new Mutex()) {}
+
+ConcurrentOnlineBase::~ConcurrentOnlineBase()
+{
+    delete static_cast<Mutex *>(_impl);
+    _impl = nullptr;
+}
+
+void ConcurrentOnlineBase::lock()
+{
+    static_cast<Mutex *>(_impl)->lock();
+}
+
+void ConcurrentOnlineBase::unlock()
+{
+    static_cast<Mutex *>(_impl)->unlock();
+}
+
+} // namespace interface1
+} // namespace algorithms
+} // namespace daal
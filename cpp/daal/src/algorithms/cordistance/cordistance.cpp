@@ -37,6 +37,16 @@ namespace correlation_distance
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_CORRELATION_DISTANCE_RESULT_ID);
+
+Parameter::Parameter(size_t k, double maxDistance) : k(k), maxDistance(maxDistance) {}
+
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(k > 0, services::ErrorIncorrectParameter, services::ParameterName, kStr());
+    DAAL_CHECK_EX(maxDistance >= 0, services::ErrorIncorrectParameter, services::ParameterName, maxDistanceStr());
+    return services::Status();
+}
+
 Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
 
 /**
@@ -102,6 +112,12 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     const Input * algInput = static_cast<const Input *>(input);
 
     size_t nVectors       = algInput->get(data)->getNumberOfRows();
+    if (method == topKDense)
+    {
+        const int expectedLayouts = (int)data_management::NumericTableIface::csrArray;
+        return data_management::checkNumericTable(get(correlationDistance).get(), correlationDistanceStr(), 0, expectedLayouts, nVectors, nVectors);
+    }
+
     int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray | (int)data_management::NumericTableIface::upperPackedTriangularMatrix
                             | (int)data_management::NumericTableIface::lowerPackedTriangularMatrix;
 
@@ -27,6 +27,7 @@
 #include "src/threading/threading.h"
 #include "src/algorithms/service_error_handling.h"
 #include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_top_k_distances.h"
 
 static const int blockSizeDefault = 128;
 #include "src/algorithms/cosdistance/cosdistance_full_impl.i"
@@ -61,6 +62,13 @@ services::Status DistanceKernel<algorithmFPType, method, cpu>::compute(const siz
     NumericTable * rTable                          = const_cast<NumericTable *>(r[0]); /* Output data */
     const NumericTableIface::StorageLayout rLayout = r[0]->getDataLayout();
 
+    if (method == topKDense)
+    {
+        const Parameter * parameter = static_cast<const Parameter *>(par);
+        return daal::algorithms::internal::top_k_distances::compute<algorithmFPType, cpu>(
+            xTable, static_cast<CSRNumericTable *>(rTable), parameter->k, (algorithmFPType)parameter->maxDistance, false);
+    }
+
     if (isFull<algorithmFPType, cpu>(rLayout))
     {
         return cosDistanceFull<algorithmFPType, cpu>(xTable, rTable);
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/distance/cosine_distance_types.h"
+#include "data_management/data/csr_numeric_table.h"
 
 namespace daal
 {
@@ -42,6 +43,20 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
 {
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t dim       = algInput->get(data)->getNumberOfRows();
+    services::Status status;
+    if (method == topKDense)
+    {
+        /* The rows keep their neighbors in the slots of min(k, dim) values until they are packed by the kernel */
+        const size_t k   = static_cast<const Parameter *>(par)->k;
+        const size_t nnz = dim * ((k < dim) ? k : dim);
+
+        using data_management::CSRNumericTable;
+        services::SharedPtr<CSRNumericTable> table = CSRNumericTable::create<float>((float *)0, 0, 0, dim, dim, CSRNumericTable::oneBased, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, table->allocateDataMemory(nnz));
+        Argument::set(cosineDistance, table);
+        return status;
+    }
     Argument::set(cosineDistance,
                   data_management::SerializationIfacePtr(
                       new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>(
@@ -26,6 +26,7 @@
 
 #include "src/algorithms/covariance/covariance_kernel.h"
 #include "src/algorithms/covariance/covariance_impl.i"
+#include "src/algorithms/service_partial_results_merge.h"
 
 namespace daal
 {
@@ -52,27 +53,83 @@ services::Status CovarianceDistributedKernel<algorithmFPType, method, cpu>::comp
     algorithmFPType * crossProduct  = crossProductBlock.get();
     algorithmFPType * nObservations = nObservationsBlock.get();
 
-    algorithmFPType zero = 0.0;
-    daal::services::internal::service_memset<algorithmFPType, cpu>(crossProduct, zero, nFeatures * nFeatures);
-    daal::services::internal::service_memset<algorithmFPType, cpu>(sums, zero, nFeatures);
-    *nObservations = zero;
+    services::Status status;
+    daal::algorithms::internal::PartialTablesReader<algorithmFPType, cpu> partialSums(collectionSize);
+    daal::algorithms::internal::PartialTablesReader<algorithmFPType, cpu> partialCrossProducts(collectionSize);
+    TArray<algorithmFPType, cpu> partialNObservations(collectionSize);
+    DAAL_CHECK_MALLOC(partialSums.isValid() && partialCrossProducts.isValid() && partialNObservations.get());
 
+    /* Only the partial results with observations take part in the merge */
+    size_t nPartials = 0;
+    *nObservations   = 0;
     for (size_t i = 0; i < collectionSize; i++)
     {
         PartialResult * patrialResult            = static_cast<PartialResult *>((*partialResultsCollection)[i].get());
-        NumericTable * partialSumsTable          = patrialResult->get(covariance::sum).get();
-        NumericTable * partialCrossProductTable  = patrialResult->get(covariance::crossProduct).get();
         NumericTable * partialNObservationsTable = patrialResult->get(covariance::nObservations).get();
 
-        DEFINE_TABLE_BLOCK(ReadRows, partialSumsBlock, partialSumsTable);
-        DEFINE_TABLE_BLOCK(ReadRows, partialCrossProductBlock, partialCrossProductTable);
         DEFINE_TABLE_BLOCK(ReadRows, partialNObservationsBlock, partialNObservationsTable);
+        const algorithmFPType partialNObsValue = partialNObservationsBlock.get()[0];
+        if (partialNObsValue == 0)
+        {
+            continue;
+        }
 
-        mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProductBlock.get(), partialSumsBlock.get(),
-                                                       partialNObservationsBlock.get(), crossProduct, sums, nObservations);
+        DAAL_CHECK_STATUS(status, partialSums.set(nPartials, *patrialResult->get(covariance::sum)));
+        DAAL_CHECK_STATUS(status, partialCrossProducts.set(nPartials, *patrialResult->get(covariance::crossProduct)));
+        partialNObservations[nPartials] = partialNObsValue;
+        *nObservations += partialNObsValue;
+        nPartials++;
     }
 
-    return services::Status();
+    /* The sums and the centered cross-products are added pairwise with the blocks merged in parallel */
+    DAAL_CHECK_STATUS(status, (daal::algorithms::internal::pairwiseSum<algorithmFPType, cpu>(nPartials, partialSums.get(), nFeatures, sums)));
+    DAAL_CHECK_STATUS(status, (daal::algorithms::internal::pairwiseSum<algorithmFPType, cpu>(nPartials, partialCrossProducts.get(),
+                                                                                              nFeatures * nFeatures, crossProduct)));
+    if (nPartials < 2)
+    {
+        return status;
+    }
+
+    /* The pairwise merges of the centered cross-products sum up to
+       sum(C_k) + sum(n_k * (m_k - m) * (m_k - m)'), the second term is computed by one SYRK
+       of the deviations of the partial means scaled by sqrt(n_k) */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nPartials, nFeatures);
+    TArray<algorithmFPType, cpu> deviationsArray(nPartials * nFeatures);
+    algorithmFPType * deviations = deviationsArray.get();
+    DAAL_CHECK_MALLOC(deviations);
+
+    const algorithmFPType invNObs = algorithmFPType(1) / *nObservations;
+    daal::threader_for(nPartials, nPartials, [&](size_t k) {
+        const algorithmFPType * partialSum   = partialSums.get()[k];
+        const algorithmFPType invPartialNObs = algorithmFPType(1) / partialNObservations[k];
+        const algorithmFPType scale          = daal::internal::Math<algorithmFPType, cpu>::sSqrt(partialNObservations[k]);
+        algorithmFPType * deviation          = deviations + k * nFeatures;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            deviation[j] = scale * (partialSum[j] * invPartialNObs - sums[j] * invNObs);
+        }
+    });
+
+    char uplo             = 'U';
+    char trans            = 'N';
+    algorithmFPType alpha = 1.0;
+    algorithmFPType beta  = 1.0;
+    DAAL_INT p            = (DAAL_INT)nFeatures;
+    DAAL_INT k            = (DAAL_INT)nPartials;
+    Blas<algorithmFPType, cpu>::xsyrk(&uplo, &trans, &p, &k, &alpha, deviations, &p, &beta, crossProduct, &p);
+
+    daal::threader_for(nFeatures, nFeatures, [=](size_t i) {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < i; j++)
+        {
+            crossProduct[j * nFeatures + i] = crossProduct[i * nFeatures + j];
+        }
+    });
+
+    return status;
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
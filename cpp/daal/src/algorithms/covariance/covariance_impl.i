@@ -35,6 +35,7 @@
 #include "src/algorithms/service_error_handling.h"
 #include "src/threading/threading.h"
 #include "src/externals/service_ittnotify.h"
+#include "src/services/service_tuning.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -124,8 +125,8 @@ struct tls_data_t
     }
 
 private:
-    TArrayScalableCalloc<algorithmFPType, cpu> sumsArray;
-    TArrayScalableCalloc<algorithmFPType, cpu> crossProductArray;
+    TArrayScratchCalloc<algorithmFPType, cpu> sumsArray;
+    TArrayScratchCalloc<algorithmFPType, cpu> crossProductArray;
 };
 
 /* Optimal block size for AVX512 low dimensions case (1024) and other CPU's and cases (140) */
@@ -152,8 +153,9 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
         /* Inverse number of rows (for normalization) */
         algorithmFPType nVectorsInv = 1.0 / (double)(nVectors);
 
-        /* Split rows by blocks */
-        size_t numRowsInBlock = getBlockSize<cpu>(nVectors);
+        /* Split rows by blocks, the block size tuned on the CPU model replaces the heuristic one */
+        TunedBlockSize<algorithmFPType, cpu> tunedBlockSize("covariance::dense", getBlockSize<cpu>(nVectors), 16, 8192, nVectors, nFeatures);
+        size_t numRowsInBlock = tunedBlockSize.get();
         size_t numBlocks      = nVectors / numRowsInBlock;
         if (numBlocks * numRowsInBlock < nVectors)
         {
@@ -163,18 +165,17 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
 
         /* TLS data initialization */
         SafeStatus safeStat;
-        daal::tls<tls_data_t<algorithmFPType, cpu> *> tls_data([=, &safeStat]() {
+        auto createTlsData = [=, &safeStat]() {
             auto tlsData = tls_data_t<algorithmFPType, cpu>::create(isNormalized, nFeatures);
             if (!tlsData)
             {
                 safeStat.add(services::ErrorMemoryAllocationFailed);
             }
             return tlsData;
-        });
+        };
 
-        /* Threaded loop with syrk seq calls */
-        daal::threader_for(numBlocks, numBlocks, [&](int iBlock) {
-            struct tls_data_t<algorithmFPType, cpu> * tls_data_local = tls_data.local();
+        /* Syrk seq call on the block */
+        auto processBlock = [&](int iBlock, tls_data_t<algorithmFPType, cpu> * tls_data_local) {
             if (!tls_data_local)
             {
                 return;
@@ -216,12 +217,48 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
                     }
                 }
             }
-        });
-        DAAL_CHECK_SAFE_STATUS();
+        };
+
+        /* Partial cross products and sums are summed pairwise */
+        auto mergeTlsData = [=](tls_data_t<algorithmFPType, cpu> *& merged, tls_data_t<algorithmFPType, cpu> * tls_data_local) {
+            if (!tls_data_local)
+            {
+                return;
+            }
+            if (!merged)
+            {
+                merged = tls_data_local;
+                return;
+            }
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < (nFeatures * nFeatures); i++)
+            {
+                merged->crossProduct[i] += tls_data_local->crossProduct[i];
+            }
+
+            if (!isNormalized && (method == defaultDense))
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nFeatures; i++)
+                {
+                    merged->sums[i] += tls_data_local->sums[i];
+                }
+            }
+
+            delete tls_data_local;
+        };
 
         /* TLS reduction: sum all partial cross products and sums */
-        tls_data.reduce([=](tls_data_t<algorithmFPType, cpu> * tls_data_local) {
+        auto reduceTlsData = [=](tls_data_t<algorithmFPType, cpu> * tls_data_local) {
             DAAL_ITTNOTIFY_SCOPED_TASK(computeSums.reduce);
+            if (!tls_data_local)
+            {
+                return;
+            }
+
             /* Sum all cross products */
             if (tls_data_local->crossProduct)
             {
@@ -248,7 +285,27 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
             }
 
             delete tls_data_local;
-        });
+        };
+
+        if (__daal_serv_is_deterministic())
+        {
+            /* The blocks are processed by the chunks that do not depend on the number of threads and their partial
+               results are merged along the fixed tree, so the result is reproducible */
+            const size_t partialSize = (nFeatures * nFeatures + nFeatures) * sizeof(algorithmFPType);
+            daal::blocked_tls<tls_data_t<algorithmFPType, cpu> *> tls_data(createTlsData, true, daal::ordered_tls_chunk_count(partialSize));
+            tls_data.for_blocks(numBlocks, processBlock);
+            DAAL_CHECK_SAFE_STATUS();
+            tls_data.reduce(mergeTlsData, reduceTlsData);
+        }
+        else
+        {
+            /* Threaded loop with syrk seq calls, the blocks are processed by the threads of the NUMA node owning them,
+               the partial results of the node are summed on the threads of the node */
+            daal::numa_tls<tls_data_t<algorithmFPType, cpu> *> tls_data(createTlsData);
+            daal::threader_for_numa(numBlocks, [&](int iBlock, int node) { processBlock(iBlock, tls_data.local(node)); });
+            DAAL_CHECK_SAFE_STATUS();
+            tls_data.reduce(mergeTlsData, reduceTlsData);
+        }
 
         /* If data is not normalized, perform subtractions of(sums[i]*sums[j])/n */
         if (!isNormalized)
@@ -93,6 +93,11 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     {
         size_t nFeatures = get(data)->getNumberOfColumns();
 
+        /* the sums computed from the values before their modification are computed again */
+        if (get(data)->getBasicStatisticsStatus() == NumericTable::basicStatisticsOutdated)
+        {
+            DAAL_CHECK_STATUS(s, get(data)->computeBasicStatistics());
+        }
         s |= checkNumericTable(get(data)->basicStatistics.get(NumericTableIface::sum).get(), sumStr(), 0, 0, nFeatures, 1);
     }
     return s;
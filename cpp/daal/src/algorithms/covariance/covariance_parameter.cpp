@@ -35,7 +35,7 @@ namespace covariance
 namespace interface1
 {
 /** Default constructor */
-Parameter::Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix) {}
+Parameter::Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix), packedSymmetricOutput(false) {}
 
 } //namespace interface1
 } //namespace covariance
@@ -26,6 +26,7 @@
 
 #include "algorithms/covariance/covariance_types.h"
 #include "data_management/data/internal/numeric_table_sycl_homogen.h"
+#include "data_management/data/symmetric_matrix.h"
 
 using namespace daal::data_management;
 namespace daal
@@ -34,6 +35,19 @@ namespace algorithms
 {
 namespace covariance
 {
+/* Creates the table of the cross-product or the computed matrix in the layout requested by the parameter */
+template <typename algorithmFPType>
+NumericTablePtr createMatrixTable(size_t nColumns, const daal::algorithms::Parameter * parameter, services::Status & status)
+{
+    const Parameter * algParameter = static_cast<const Parameter *>(parameter);
+    if (algParameter && algParameter->packedSymmetricOutput)
+    {
+        typedef PackedSymmetricMatrix<NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType> PackedMatrix;
+        return PackedMatrix::create(nColumns, NumericTable::doAllocate, &status);
+    }
+    return HomogenNumericTable<algorithmFPType>::create(nColumns, nColumns, NumericTable::doAllocate, &status);
+}
+
 /**
  * Allocates memory to store partial results of the correlation or variance-covariance matrix algorithm
  * \param[in] input     %Input objects of the algorithm
@@ -54,7 +68,7 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     if (deviceInfo.isCpu)
     {
         set(nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &status));
-        set(crossProduct, HomogenNumericTable<algorithmFPType>::create(nColumns, nColumns, NumericTable::doAllocate, &status));
+        set(crossProduct, createMatrixTable<algorithmFPType>(nColumns, parameter, status));
         set(sum, HomogenNumericTable<algorithmFPType>::create(nColumns, 1, NumericTable::doAllocate, &status));
     }
     else
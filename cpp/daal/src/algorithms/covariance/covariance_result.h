@@ -26,6 +26,7 @@
 
 #include "algorithms/covariance/covariance_types.h"
 #include "data_management/data/internal/numeric_table_sycl_homogen.h"
+#include "src/algorithms/covariance/covariance_partialresult.h"
 
 using namespace daal::data_management;
 namespace daal
@@ -52,7 +53,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
 
     if (deviceInfo.isCpu)
     {
-        set(covariance, HomogenNumericTable<algorithmFPType>::create(nColumns, nColumns, NumericTable::doAllocate, &status));
+        set(covariance, createMatrixTable<algorithmFPType>(nColumns, parameter, status));
         DAAL_CHECK_STATUS_VAR(status);
 
         set(mean, HomogenNumericTable<algorithmFPType>::create(nColumns, 1, NumericTable::doAllocate, &status));
@@ -89,7 +90,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialRes
 
     if (deviceInfo.isCpu)
     {
-        set(covariance, HomogenNumericTable<algorithmFPType>::create(nColumns, nColumns, NumericTable::doAllocate, &status));
+        set(covariance, createMatrixTable<algorithmFPType>(nColumns, parameter, status));
         set(mean, HomogenNumericTable<algorithmFPType>::create(nColumns, 1, NumericTable::doAllocate, &status));
     }
     else
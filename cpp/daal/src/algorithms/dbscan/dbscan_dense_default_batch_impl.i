@@ -281,6 +281,40 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const N
     return s;
 }
 
+/* The root of the set is its smallest index, so the clusters are numbered in the order of their first core observations */
+template <CpuType cpu>
+static size_t findRoot(size_t * const parents, size_t i)
+{
+    while (parents[i] != i)
+    {
+        parents[i] = parents[parents[i]];
+        i          = parents[i];
+    }
+    return i;
+}
+
+template <CpuType cpu>
+static void unite(size_t * const parents, size_t i, size_t j)
+{
+    const size_t iRoot = findRoot<cpu>(parents, i);
+    const size_t jRoot = findRoot<cpu>(parents, j);
+    if (iRoot < jRoot)
+    {
+        parents[jRoot] = iRoot;
+    }
+    else if (jRoot < iRoot)
+    {
+        parents[iRoot] = jRoot;
+    }
+}
+
+/**
+ *  The memory saving mode does not keep the neighborhoods. The first pass only sums the weights
+ *  of the neighborhoods to find the core observations. The second one regenerates the neighborhoods
+ *  of the core observations by blocks and joins the adjacent ones with the union-find over their
+ *  indices. The last one assigns the border observations to the first cluster of their core neighbors,
+ *  as the cluster expansion in the order of the observations does.
+ */
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const NumericTable * ntData, const NumericTable * ntWeights,
                                                                        NumericTable * ntAssignments, NumericTable * ntNClusters,
@@ -301,74 +335,92 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
     DAAL_CHECK_BLOCK_STATUS(assignRows);
     int * const assignments = assignRows.get();
 
-    service_memset<int, cpu>(assignments, undefined, nRows);
+    service_memset<int, cpu>(assignments, noise, nRows);
 
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(int));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(size_t));
 
     TArray<int, cpu> isCoreArray(nRows);
-    DAAL_CHECK_MALLOC(isCoreArray.get());
-    int * const isCore = isCoreArray.get();
+    TArray<algorithmFPType, cpu> neighWeightsArray(nRows);
+    TArray<size_t, cpu> parentsArray(nRows);
+    TArray<size_t, cpu> blockIndicesArray(__DBSCAN_PREFETCHED_NEIGHBORHOODS_COUNT);
+    DAAL_CHECK_MALLOC(isCoreArray.get() && neighWeightsArray.get() && parentsArray.get() && blockIndicesArray.get());
+    int * const isCore                   = isCoreArray.get();
+    algorithmFPType * const neighWeights = neighWeightsArray.get();
+    size_t * const parents               = parentsArray.get();
+    size_t * const blockIndices          = blockIndicesArray.get();
 
-    service_memset<int, cpu>(isCore, 0, nRows);
+    DAAL_CHECK_STATUS_VAR(nEngine.queryWeights(neighWeights));
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        isCore[i]  = (neighWeights[i] >= minObservations);
+        parents[i] = i;
+    }
 
     const size_t prefetchBlockSize = __DBSCAN_PREFETCHED_NEIGHBORHOODS_COUNT;
     TArray<Neighborhood<algorithmFPType, cpu>, cpu> prefetchedNeighs(prefetchBlockSize);
     DAAL_CHECK_MALLOC(prefetchedNeighs.get());
 
-    size_t nClusters = 0;
-    Queue<size_t, cpu> qu;
-
-    for (size_t i = 0; i < nRows; i++)
+    /* Joins the core observations within epsilon of each other */
+    for (size_t i = 0; i < nRows;)
     {
-        if (assignments[i] != undefined) continue;
-
-        Neighborhood<algorithmFPType, cpu> curNeigh;
-        nEngine.query(&i, 1, &curNeigh);
-
-        if (curNeigh.weight() < minObservations)
+        size_t blockSize = 0;
+        for (; i < nRows && blockSize < prefetchBlockSize; i++)
         {
-            assignments[i] = noise;
-            continue;
+            if (isCore[i]) blockIndices[blockSize++] = i;
         }
+        if (blockSize == 0) continue;
 
-        nClusters++;
-        isCore[i]      = 1;
-        assignments[i] = nClusters - 1;
-
-        qu.reset();
-
-        DAAL_CHECK_STATUS_VAR(processNeighborhood(nClusters - 1, assignments, curNeigh, qu));
+        DAAL_CHECK_STATUS_VAR(nEngine.query(blockIndices, blockSize, prefetchedNeighs.get(), true));
 
-        size_t firstPrefetchedPos = 0;
-        size_t lastPrefetchedPos  = 0;
-
-        while (!qu.empty())
+        for (size_t k = 0; k < blockSize; k++)
         {
-            const size_t quPos  = qu.head();
-            const size_t curObs = qu.pop();
-
-            if (quPos >= lastPrefetchedPos)
+            const Neighborhood<algorithmFPType, cpu> & curNeigh = prefetchedNeighs[k];
+            for (size_t j = 0; j < curNeigh.size(); j++)
             {
-                firstPrefetchedPos = lastPrefetchedPos = quPos;
+                const size_t nextObs = curNeigh.get(j);
+                if (nextObs > blockIndices[k] && isCore[nextObs])
+                {
+                    unite<cpu>(parents, blockIndices[k], nextObs);
+                }
             }
+        }
+    }
 
-            if (lastPrefetchedPos - firstPrefetchedPos < prefetchBlockSize && lastPrefetchedPos < qu.tail())
-            {
-                const size_t nextPrefetchPos =
-                    firstPrefetchedPos + prefetchBlockSize < qu.tail() ? firstPrefetchedPos + prefetchBlockSize : qu.tail();
-                DAAL_CHECK_STATUS_VAR(nEngine.query(qu.getInternalPtr(lastPrefetchedPos), nextPrefetchPos - lastPrefetchedPos,
-                                                    &(prefetchedNeighs[lastPrefetchedPos - firstPrefetchedPos]), true));
-                lastPrefetchedPos = nextPrefetchPos;
-            }
+    /* The roots precede the other members of their sets, so one ascending pass numbers the clusters */
+    size_t nClusters = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (!isCore[i]) continue;
 
-            Neighborhood<algorithmFPType, cpu> & curNeigh = prefetchedNeighs[quPos - firstPrefetchedPos];
+        const size_t root = findRoot<cpu>(parents, i);
+        assignments[i]    = (root == i) ? static_cast<int>(nClusters++) : assignments[root];
+    }
 
-            assignments[curObs] = nClusters - 1;
-            if (curNeigh.weight() < minObservations) continue;
+    /* Assigns the border observations */
+    for (size_t i = 0; i < nRows;)
+    {
+        size_t blockSize = 0;
+        for (; i < nRows && blockSize < prefetchBlockSize; i++)
+        {
+            if (!isCore[i]) blockIndices[blockSize++] = i;
+        }
+        if (blockSize == 0) continue;
 
-            isCore[curObs] = 1;
+        DAAL_CHECK_STATUS_VAR(nEngine.query(blockIndices, blockSize, prefetchedNeighs.get(), true));
 
-            DAAL_CHECK_STATUS_VAR(processNeighborhood(nClusters - 1, assignments, curNeigh, qu));
+        for (size_t k = 0; k < blockSize; k++)
+        {
+            const Neighborhood<algorithmFPType, cpu> & curNeigh = prefetchedNeighs[k];
+            int & assignment                                    = assignments[blockIndices[k]];
+            for (size_t j = 0; j < curNeigh.size(); j++)
+            {
+                const size_t nextObs = curNeigh.get(j);
+                if (isCore[nextObs] && (assignment == noise || assignments[nextObs] < assignment))
+                {
+                    assignment = assignments[nextObs];
+                }
+            }
         }
     }
 
@@ -1086,6 +1086,30 @@ Status DBSCANDistrStep7Kernel<algorithmFPType, method, cpu>::compute(const DataC
     return Status();
 }
 
+/**
+ *  Follows the parents of the observation within the block to the last one, which is either
+ *  the root of the cluster or refers to another block, and points the passed observations to it.
+ *  The later queries to the same cluster take one step, so the long chains built by the merges
+ *  are traversed only once.
+ */
+template <CpuType cpu>
+static size_t findLocalRoot(int * const clusterStructure, size_t blockIndex, size_t id)
+{
+    size_t root = id;
+    while (clusterStructure[root * 4 + 2] == blockIndex && clusterStructure[root * 4 + 3] != root)
+    {
+        root = clusterStructure[root * 4 + 3];
+    }
+
+    while (id != root)
+    {
+        const size_t next            = clusterStructure[id * 4 + 3];
+        clusterStructure[id * 4 + 3] = root;
+        id                           = next;
+    }
+    return root;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status DBSCANDistrStep8Kernel<algorithmFPType, method, cpu>::addQuery(Vector<int, cpu> * const queries, size_t dstBlockIndex, size_t dstId,
                                                                       size_t srcBlockIndex, size_t srcId)
@@ -1330,10 +1354,7 @@ Status DBSCANDistrStep8Kernel<algorithmFPType, method, cpu>::compute(const Numer
 
                 if (haloblockIndex == blockIndex)
                 {
-                    while (clusterStructure[haloId * 4 + 2] == blockIndex && clusterStructure[haloId * 4 + 3] != haloId)
-                    {
-                        haloId = clusterStructure[haloId * 4 + 3];
-                    }
+                    haloId = findLocalRoot<cpu>(clusterStructure, blockIndex, haloId);
                 }
 
                 if (clusterStructure[id * 4 + 0] == noise)
@@ -1348,10 +1369,7 @@ Status DBSCANDistrStep8Kernel<algorithmFPType, method, cpu>::compute(const Numer
                     continue;
                 }
 
-                while (clusterStructure[id * 4 + 2] == blockIndex && clusterStructure[id * 4 + 3] != id)
-                {
-                    id = clusterStructure[id * 4 + 3];
-                }
+                id = findLocalRoot<cpu>(clusterStructure, blockIndex, id);
 
                 if (haloblockIndex == blockIndex && haloId == id)
                 {
@@ -1688,10 +1706,7 @@ Status DBSCANDistrStep11Kernel<algorithmFPType, method, cpu>::compute(const Nume
                     size_t haloblockIndex = curPartialQueries[i * 4 + 2];
                     size_t haloId         = curPartialQueries[i * 4 + 3];
 
-                    while (clusterStructure[id * 4 + 2] == blockIndex && clusterStructure[id * 4 + 3] != id)
-                    {
-                        id = clusterStructure[id * 4 + 3];
-                    }
+                    id = findLocalRoot<cpu>(clusterStructure, blockIndex, id);
 
                     size_t parentBlockIndex = clusterStructure[id * 4 + 2];
                     size_t parentId         = clusterStructure[id * 4 + 3];
@@ -33,6 +33,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_math.h"
 #include "src/algorithms/service_kernel_math.h"
+#include "src/algorithms/service_sort.h"
 #include "src/algorithms/service_error_handling.h"
 
 using namespace daal::internal;
@@ -399,6 +400,8 @@ public:
 
     services::Status queryFull(Neighborhood<FPType, cpu> * neighs, bool doReset = false);
 
+    services::Status queryWeights(FPType * neighWeights);
+
     services::Status query(size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs, bool doReset = false);
 };
 
@@ -447,6 +450,13 @@ public:
         const size_t outDim = _outTable->getNumberOfColumns();
         DAAL_ASSERT(outDim >= dim);
 
+        if (dim <= gridMaxDim && outRows >= gridMinRows && _eps > 0)
+        {
+            bool isGridUsed = false;
+            DAAL_CHECK_STATUS_VAR(queryFullGrid(neighs, doReset, isGridUsed));
+            if (isGridUsed) return services::Status();
+        }
+
         EuclideanDistances<FPType, cpu> metric(*_inTable, *_outTable);
         DAAL_CHECK_STATUS_VAR(metric.init());
 
@@ -526,6 +536,81 @@ public:
         return safeStat.detach();
     }
 
+    /* Computes the total weight of the neighborhood of every in row without storing the neighbors */
+    services::Status queryWeights(FPType * neighWeights)
+    {
+        SafeStatus safeStat;
+
+        const size_t inRows  = _inTable->getNumberOfRows();
+        const size_t outRows = _outTable->getNumberOfRows();
+
+        service_memset<FPType, cpu>(neighWeights, FPType(0), inRows);
+        if (outRows == 0)
+        {
+            return services::Status();
+        }
+
+        EuclideanDistances<FPType, cpu> metric(*_inTable, *_outTable);
+        DAAL_CHECK_STATUS_VAR(metric.init());
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        const size_t inBlockSize = 128;
+        const size_t nInBlocks   = inRows / inBlockSize + (inRows % inBlockSize > 0);
+
+        const size_t outBlockSize = 128;
+        const size_t nOutBlocks   = outRows / outBlockSize + (outRows % outBlockSize > 0);
+
+        TlsMem<FPType, cpu> tls(inBlockSize * outBlockSize);
+
+        daal::threader_for(nInBlocks, nInBlocks, [&](size_t inBlock) {
+            size_t i1    = inBlock * inBlockSize;
+            size_t i2    = (inBlock + 1 == nInBlocks ? inRows : i1 + inBlockSize);
+            size_t iSize = i2 - i1;
+
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, i2 - i1);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+
+            FPType * local = tls.local();
+            DAAL_CHECK_MALLOC_THR(local);
+
+            for (size_t outBlock = 0; outBlock < nOutBlocks; outBlock++)
+            {
+                size_t j1    = outBlock * outBlockSize;
+                size_t j2    = (outBlock + 1 == nOutBlocks ? outRows : j1 + outBlockSize);
+                size_t jSize = j2 - j1;
+
+                ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), j1, j2 - j1);
+                DAAL_CHECK_BLOCK_STATUS_THR(outDataRows);
+                const FPType * const outData = outDataRows.get();
+
+                ReadRows<FPType, cpu> weightsRows;
+                if (_weights)
+                {
+                    weightsRows.set(const_cast<NumericTable *>(_weights), j1, j2 - j1);
+                    DAAL_CHECK_BLOCK_STATUS_THR(weightsRows);
+                }
+                const FPType * const weights = weightsRows.get();
+
+                metric.computeBatch(inData, outData, i1, iSize, j1, jSize, local);
+
+                for (size_t i = 0; i < iSize; i++)
+                {
+                    const FPType * const dist = local + i * jSize;
+                    FPType sum                = 0;
+                    for (size_t j = 0; j < jSize; j++)
+                    {
+                        sum += (dist[j] <= epsP) ? (weights ? weights[j] : FPType(1)) : FPType(0);
+                    }
+                    neighWeights[i + i1] += sum;
+                }
+            }
+        });
+
+        return safeStat.detach();
+    }
+
     services::Status query(size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs, bool doReset = false)
     {
         SafeStatus safeStat;
@@ -626,6 +711,207 @@ public:
     }
 
 private:
+    static const size_t gridMaxDim     = 4;
+    static const size_t gridMinRows    = 4096;
+    static const size_t gridMinPruning = 16;
+
+    /**
+     *  Finds the neighborhoods with the uniform grid of the cells with the side eps built on
+     *  the rows of the out table. The neighbors of the point lie in its cell and the adjacent
+     *  ones, so only 3^dim cells are scanned instead of all the rows. The out rows are sorted
+     *  by the cells and copied in this order, every cell is a contiguous range of the copy.
+     *  The grid is not used if the rows fall into too few cells to prune the search, then
+     *  isGridUsed is false and the neighborhoods are not changed.
+     */
+    services::Status queryFullGrid(Neighborhood<FPType, cpu> * neighs, bool doReset, bool & isGridUsed)
+    {
+        isGridUsed = false;
+
+        const size_t inRows  = _inTable->getNumberOfRows();
+        const size_t outRows = _outTable->getNumberOfRows();
+        const size_t dim     = _inTable->getNumberOfColumns();
+        const size_t outDim  = _outTable->getNumberOfColumns();
+
+        ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), 0, outRows);
+        DAAL_CHECK_BLOCK_STATUS(outDataRows);
+        const FPType * const outData = outDataRows.get();
+
+        ReadRows<FPType, cpu> weightsRows;
+        if (_weights)
+        {
+            weightsRows.set(const_cast<NumericTable *>(_weights), 0, outRows);
+            DAAL_CHECK_BLOCK_STATUS(weightsRows);
+        }
+        const FPType * const weights = weightsRows.get();
+
+        FPType lower[gridMaxDim];
+        size_t nCells[gridMaxDim];
+        size_t strides[gridMaxDim];
+        for (size_t k = 0; k < dim; k++)
+        {
+            FPType minValue = outData[k];
+            FPType maxValue = outData[k];
+            for (size_t j = 1; j < outRows; j++)
+            {
+                const FPType value = outData[j * outDim + k];
+                minValue           = (value < minValue) ? value : minValue;
+                maxValue           = (value > maxValue) ? value : maxValue;
+            }
+            const FPType extent = (maxValue - minValue) / _eps;
+            if (!(extent < FPType(size_t(1) << 20))) return services::Status();
+            lower[k]  = minValue;
+            nCells[k] = static_cast<size_t>(extent) + 1;
+        }
+
+        /* The cell keys are linear, the product of the numbers of cells is less than 2^(20 * dim) */
+        size_t totalCells = 1;
+        for (size_t k = 0; k < dim; k++)
+        {
+            strides[k] = totalCells;
+            totalCells *= nCells[k];
+        }
+
+        TArray<size_t, cpu> keysArray(outRows);
+        TArray<int, cpu> orderArray(outRows);
+        DAAL_CHECK_MALLOC(keysArray.get() && orderArray.get());
+        size_t * const keys = keysArray.get();
+        int * const order   = orderArray.get();
+
+        for (size_t j = 0; j < outRows; j++)
+        {
+            size_t key = 0;
+            for (size_t k = 0; k < dim; k++)
+            {
+                size_t cell = static_cast<size_t>((outData[j * outDim + k] - lower[k]) / _eps);
+                cell        = (cell < nCells[k]) ? cell : nCells[k] - 1;
+                key += cell * strides[k];
+            }
+            keys[j]  = key;
+            order[j] = static_cast<int>(j);
+        }
+        qSort<size_t, int, cpu>(outRows, keys, order);
+
+        size_t nOccupiedCells = 1;
+        for (size_t j = 1; j < outRows; j++)
+        {
+            nOccupiedCells += (keys[j] != keys[j - 1]);
+        }
+
+        size_t nAdjacentCells = 1;
+        for (size_t k = 0; k < dim; k++)
+        {
+            nAdjacentCells *= 3;
+        }
+
+        /* Scanning the adjacent cells shall be much cheaper than the blocked distances to all the rows */
+        if (nOccupiedCells < gridMinPruning * nAdjacentCells) return services::Status();
+
+        TArray<FPType, cpu> sortedDataArray(outRows * dim);
+        TArray<FPType, cpu> sortedWeightsArray(outRows);
+        DAAL_CHECK_MALLOC(sortedDataArray.get() && sortedWeightsArray.get());
+        FPType * const sortedData    = sortedDataArray.get();
+        FPType * const sortedWeights = sortedWeightsArray.get();
+
+        for (size_t j = 0; j < outRows; j++)
+        {
+            const size_t origin = static_cast<size_t>(order[j]);
+            for (size_t k = 0; k < dim; k++)
+            {
+                sortedData[j * dim + k] = outData[origin * outDim + k];
+            }
+            sortedWeights[j] = weights ? weights[origin] : FPType(1);
+        }
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        const size_t inBlockSize = 128;
+        const size_t nInBlocks   = inRows / inBlockSize + (inRows % inBlockSize > 0);
+
+        SafeStatus safeStat;
+        daal::threader_for(nInBlocks, nInBlocks, [&](size_t inBlock) {
+            const size_t i1    = inBlock * inBlockSize;
+            const size_t i2    = (inBlock + 1 == nInBlocks ? inRows : i1 + inBlockSize);
+            const size_t iSize = i2 - i1;
+
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+
+            for (size_t i = 0; i < iSize; i++)
+            {
+                Neighborhood<FPType, cpu> & neigh = neighs[i + i1];
+                if (doReset)
+                {
+                    neigh.reset();
+                }
+
+                const FPType * const x = inData + i * dim;
+                long long cells[gridMaxDim];
+                for (size_t k = 0; k < dim; k++)
+                {
+                    /* The cells beyond the grid by more than one have no adjacent cells in it */
+                    const FPType position = (x[k] - lower[k]) / _eps;
+                    if (position < FPType(-1))
+                    {
+                        cells[k] = -2;
+                    }
+                    else if (position > FPType(nCells[k] + 1))
+                    {
+                        cells[k] = static_cast<long long>(nCells[k]) + 1;
+                    }
+                    else
+                    {
+                        cells[k] = static_cast<long long>(position + FPType(1)) - 1;
+                    }
+                }
+
+                for (size_t adjacent = 0; adjacent < nAdjacentCells; adjacent++)
+                {
+                    size_t key     = 0;
+                    bool isInRange = true;
+                    size_t code    = adjacent;
+                    for (size_t k = 0; k < dim; k++, code /= 3)
+                    {
+                        const long long cell = cells[k] + static_cast<long long>(code % 3) - 1;
+                        isInRange            = isInRange && (cell >= 0) && (cell < static_cast<long long>(nCells[k]));
+                        key += isInRange ? static_cast<size_t>(cell) * strides[k] : 0;
+                    }
+                    if (!isInRange) continue;
+
+                    /* The first sorted row of the cell */
+                    size_t first = 0;
+                    size_t count = outRows;
+                    while (count > 0)
+                    {
+                        const size_t half = count / 2;
+                        if (keys[first + half] < key)
+                        {
+                            first += half + 1;
+                            count -= half + 1;
+                        }
+                        else
+                        {
+                            count = half;
+                        }
+                    }
+
+                    for (size_t j = first; j < outRows && keys[j] == key; j++)
+                    {
+                        const FPType dist = distancePow2<FPType, cpu>(x, sortedData + j * dim, dim);
+                        if (dist <= epsP)
+                        {
+                            DAAL_CHECK_MALLOC_THR(!neigh.add(static_cast<size_t>(order[j]), sortedWeights[j]));
+                        }
+                    }
+                }
+            }
+        });
+
+        DAAL_CHECK_SAFE_STATUS();
+        isGridUsed = true;
+        return services::Status();
+    }
+
     const NumericTable * _inTable;
     const NumericTable * _outTable;
     const NumericTable * _weights;
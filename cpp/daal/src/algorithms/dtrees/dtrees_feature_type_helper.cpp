@@ -120,9 +120,9 @@ services::Status IndexedFeatures::FeatureEntry::allocBorders()
     return binBorders ? services::Status() : services::Status(services::ErrorMemoryAllocationFailed);
 }
 
-services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
+services::Status IndexedFeatures::alloc(size_t nC, size_t nR, size_t sizeOfIndex)
 {
-    const size_t newCapacity = nC * nR;
+    const size_t newCapacity = nC * nR * sizeOfIndex;
     if (_data)
     {
         if (newCapacity > _capacity)
@@ -130,14 +130,14 @@ services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
             services::daal_free(_data);
             _data     = nullptr;
             _capacity = 0;
-            _data     = (IndexType *)services::daal_calloc(sizeof(IndexType) * newCapacity);
+            _data     = (char *)services::daal_calloc(newCapacity);
             DAAL_CHECK_MALLOC(_data);
             _capacity = newCapacity;
         }
     }
     else
     {
-        _data = (IndexType *)services::daal_calloc(sizeof(IndexType) * newCapacity);
+        _data = (char *)services::daal_calloc(newCapacity);
         DAAL_CHECK_MALLOC(_data);
         _capacity = newCapacity;
     }
@@ -148,8 +148,9 @@ services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
     }
     _entries = new FeatureEntry[nC];
     DAAL_CHECK_MALLOC(_entries);
-    _nCols = nC;
-    _nRows = nR;
+    _nCols       = nC;
+    _nRows       = nR;
+    _sizeOfIndex = sizeOfIndex;
     return services::Status();
 }
 
@@ -82,6 +82,8 @@ struct BinParams
 // IndexedFeatures. Creates and stores index of every feature
 // Sorts every feature and creates the mapping: features value -> index of the value
 // in the sorted array of unique values of the feature in increasing order
+// The indices are stored as uint8_t or uint16_t when the number of indices allows,
+// sizeOfIndex() tells the type of the stored indices
 //////////////////////////////////////////////////////////////////////////////////////////
 class IndexedFeatures
 {
@@ -126,17 +128,31 @@ public:
         return _entries[iCol].binBorders[iBin];
     }
 
-    //for low-level optimization
-    const IndexType * data(size_t iFeature) const { return (IndexType *)(((char *)_data) + _nRows * iFeature * _sizeOfIndex); }
+    //size in bytes of the stored index of a feature value
+    size_t sizeOfIndex() const { return _sizeOfIndex; }
+
+    //for low-level optimization, FeatureBinIndexType shall be of sizeOfIndex() bytes
+    template <typename FeatureBinIndexType>
+    const FeatureBinIndexType * data(size_t iFeature) const
+    {
+        DAAL_ASSERT(sizeof(FeatureBinIndexType) == _sizeOfIndex);
+        return (const FeatureBinIndexType *)(_data + _nRows * iFeature * _sizeOfIndex);
+    }
 
     size_t nRows() const { return _nRows; }
     size_t nCols() const { return _nCols; }
 
 protected:
-    services::Status alloc(size_t nCols, size_t nRows);
+    services::Status alloc(size_t nCols, size_t nRows, size_t sizeOfIndex);
+
+    template <typename algorithmFPType, CpuType cpu>
+    services::Status makeIndices(const NumericTable & nt, const FeatureTypes & featureTypes, const BinParams * pBimPrm, size_t nIndicesBound);
+
+    template <typename FeatureBinIndexType>
+    void storeIndices(size_t iCol, const IndexType * aIdx);
 
 protected:
-    IndexType * _data;
+    char * _data;
     FeatureEntry * _entries;
     size_t _sizeOfIndex;
     size_t _nRows;
@@ -145,6 +161,29 @@ protected:
     size_t _maxNumIndices;
 };
 
+//Executes the statements with FeatureBinIndexType defined as the type of the stored indices of the features
+#define DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(indexedFeatures, ...)                                         \
+    switch ((indexedFeatures).sizeOfIndex())                                                            \
+    {                                                                                                   \
+    case sizeof(uint8_t):                                                                               \
+    {                                                                                                   \
+        typedef uint8_t FeatureBinIndexType;                                                            \
+        __VA_ARGS__;                                                                                    \
+        break;                                                                                          \
+    }                                                                                                   \
+    case sizeof(uint16_t):                                                                              \
+    {                                                                                                   \
+        typedef uint16_t FeatureBinIndexType;                                                           \
+        __VA_ARGS__;                                                                                    \
+        break;                                                                                          \
+    }                                                                                                   \
+    default:                                                                                            \
+    {                                                                                                   \
+        typedef daal::algorithms::dtrees::internal::IndexedFeatures::IndexType FeatureBinIndexType;     \
+        __VA_ARGS__;                                                                                    \
+    }                                                                                                   \
+    }
+
 } /* namespace internal */
 } /* namespace dtrees */
 } /* namespace algorithms */
@@ -35,13 +35,110 @@ namespace dtrees
 {
 namespace internal
 {
+//The nonzero values of the columns of the CSR table, ordered by the rows inside a column.
+//The column iCol occupies [offsets[iCol], offsets[iCol + 1]) of values and rows
+template <typename IndexType, typename algorithmFPType, CpuType cpu>
+struct CSRColumns
+{
+    services::Status init(CSRNumericTableIface & csr, size_t nRows, size_t nCols)
+    {
+        daal::internal::ReadRowsCSR<algorithmFPType, cpu> block(csr, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(block);
+        const algorithmFPType * aValue = block.values();
+        const size_t * aColIdx         = block.cols();
+        const size_t * aRowOffset      = block.rows();
+        const size_t nNonZeros         = aRowOffset[nRows] - aRowOffset[0];
+
+        offsets.reset(nCols + 1);
+        values.reset(nNonZeros);
+        rows.reset(nNonZeros);
+        DAAL_CHECK_MALLOC(offsets.get() && (!nNonZeros || (values.get() && rows.get())));
+
+        size_t * aOffset = offsets.get();
+        services::internal::service_memset_seq<size_t, cpu>(aOffset, 0, nCols + 1);
+        for (size_t k = 0; k < nNonZeros; ++k) ++aOffset[aColIdx[k]];
+        //aOffset[iCol + 1] counts the nonzeros of the column iCol, the counts become the positions to fill
+        for (size_t iCol = 0; iCol < nCols; ++iCol) aOffset[iCol + 1] += aOffset[iCol];
+
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            for (size_t k = aRowOffset[iRow] - aRowOffset[0]; k < aRowOffset[iRow + 1] - aRowOffset[0]; ++k)
+            {
+                const size_t pos = aOffset[aColIdx[k] - 1]++;
+                values[pos]      = aValue[k];
+                rows[pos]        = IndexType(iRow);
+            }
+        }
+        //the positions have moved to the ends of the columns, shift them back to the beginnings
+        for (size_t iCol = nCols; iCol > 0; --iCol) aOffset[iCol] = aOffset[iCol - 1];
+        aOffset[0] = 0;
+        return services::Status();
+    }
+
+    TVector<size_t, cpu, DefaultAllocator<cpu> > offsets;
+    TVector<algorithmFPType, cpu, DefaultAllocator<cpu> > values;
+    TVector<IndexType, cpu, DefaultAllocator<cpu> > rows;
+};
+
+//The values of a group of columns of the table stored by columns. The group is read by blocks of rows,
+//so the table is passed once per group instead of once per column
+template <typename algorithmFPType, CpuType cpu>
+struct ColumnGroup
+{
+    static const size_t s_cRowsInBlock = 1024;
+
+    ColumnGroup(size_t nRows, size_t maxCols) : _nRows(nRows), _iFirstCol(0), _values(nRows * maxCols) {}
+    bool isValid() const { return _values.get(); }
+
+    services::Status read(const NumericTable & nt, size_t iFirstCol, size_t nCols)
+    {
+        _iFirstCol               = iFirstCol;
+        const size_t nColsNT     = nt.getNumberOfColumns();
+        const size_t nBlocks     = _nRows / s_cRowsInBlock + !!(_nRows % s_cRowsInBlock);
+        algorithmFPType * aValue = _values.get();
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iStart = iBlock * s_cRowsInBlock;
+            const size_t n      = (iStart + s_cRowsInBlock > _nRows) ? _nRows - iStart : s_cRowsInBlock;
+            daal::internal::ReadRows<algorithmFPType, cpu> block(const_cast<NumericTable *>(&nt), iStart, n);
+            DAAL_CHECK_BLOCK_STATUS_THR(block);
+            const algorithmFPType * pRows = block.get() + iFirstCol;
+            for (size_t j = 0; j < nCols; ++j)
+            {
+                algorithmFPType * pColumn = aValue + j * _nRows + iStart;
+                for (size_t i = 0; i < n; ++i) pColumn[i] = pRows[i * nColsNT + j];
+            }
+        });
+        return safeStat.detach();
+    }
+
+    const algorithmFPType * column(size_t iCol) const { return _values.get() + (iCol - _iFirstCol) * _nRows; }
+
+private:
+    const size_t _nRows;
+    size_t _iFirstCol;
+    TVector<algorithmFPType, cpu, DefaultAllocator<cpu> > _values;
+};
+
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTask
 {
     DAAL_NEW_DELETE();
-    ColIndexTask(size_t nRows) : _index(nRows), maxNumDiffValues(1) {}
+    ColIndexTask(size_t nRows, bool bBufferIndices)
+        : _index(nRows), _indices(bBufferIndices ? nRows : 0), _bBufferIndices(bBufferIndices), _csrColumns(nullptr), _columnGroup(nullptr),
+          maxNumDiffValues(1)
+    {}
     virtual ~ColIndexTask() {}
-    bool isValid() const { return _index.get(); }
+    bool isValid() const { return _index.get() && (!_bBufferIndices || _indices.get()); }
+
+    //buffer for the indices of a feature which are stored in a narrower type
+    IndexType * indices() { return _indices.get(); }
+
+    //the columns of the CSR table are sorted from their nonzeros instead of reading them densely
+    void setCSRColumns(const CSRColumns<IndexType, algorithmFPType, cpu> * csrColumns) { _csrColumns = csrColumns; }
+    //the columns of the tables stored by rows are taken from the group read by blocks of rows
+    void setColumnGroup(const ColumnGroup<algorithmFPType, cpu> * columnGroup) { _columnGroup = columnGroup; }
 
     struct FeatureIdx
     {
@@ -64,7 +161,7 @@ struct ColIndexTask
     services::Status makeIndexDefault(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                       bool bUnorderedFeature)
     {
-        Status s = this->getSorted(nt, iCol, nRows);
+        services::Status s = this->getSorted(nt, iCol, nRows);
         if (!s) return s;
         const FeatureIdx * index = _index.get();
         if (index[0].key == index[nRows - 1].key)
@@ -97,10 +194,19 @@ public:
     size_t maxNumDiffValues;
 
 protected:
-    Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
+    services::Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
     {
-        const algorithmFPType * pBlock = _block.set(&nt, iCol, 0, nRows);
-        DAAL_CHECK_BLOCK_STATUS(_block);
+        if (_csrColumns) return getSortedCSR(iCol, nRows);
+        const algorithmFPType * pBlock = nullptr;
+        if (_columnGroup)
+        {
+            pBlock = _columnGroup->column(iCol);
+        }
+        else
+        {
+            pBlock = _block.set(&nt, iCol, 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(_block);
+        }
         FeatureIdx * index = _index.get();
         for (size_t i = 0; i < nRows; ++i)
         {
@@ -108,19 +214,59 @@ protected:
             index[i].val = i;
         }
         daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nRows, index);
-        return Status();
+        return services::Status();
+    }
+
+    //Only the nonzeros of the column are sorted, the implicit zeros are placed between the negative and the positive values
+    services::Status getSortedCSR(size_t iCol, size_t nRows)
+    {
+        const size_t iStart            = _csrColumns->offsets[iCol];
+        const size_t nNonZeros         = _csrColumns->offsets[iCol + 1] - iStart;
+        const algorithmFPType * aValue = _csrColumns->values.get() + iStart;
+        const IndexType * aRow         = _csrColumns->rows.get() + iStart;
+        FeatureIdx * index             = _index.get();
+        for (size_t i = 0; i < nNonZeros; ++i)
+        {
+            index[i].key = aValue[i];
+            index[i].val = aRow[i];
+        }
+        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nNonZeros, index);
+
+        size_t nNegative = 0;
+        for (; (nNegative < nNonZeros) && (index[nNegative].key < algorithmFPType(0)); ++nNegative)
+            ;
+        const size_t nZeros = nRows - nNonZeros;
+        for (size_t i = nNonZeros; i > nNegative; --i) index[i - 1 + nZeros] = index[i - 1];
+
+        //the rows of a column are ascending, the missing ones hold the zeros
+        FeatureIdx * zeros = index + nNegative;
+        for (size_t iRow = 0, k = 0, iZero = 0; iRow < nRows; ++iRow)
+        {
+            if ((k < nNonZeros) && (size_t(aRow[k]) == iRow))
+            {
+                ++k;
+                continue;
+            }
+            zeros[iZero].key   = algorithmFPType(0);
+            zeros[iZero++].val = IndexType(iRow);
+        }
+        return services::Status();
     }
 
 protected:
     daal::internal::ReadColumns<algorithmFPType, cpu> _block;
     TVector<FeatureIdx, cpu, DefaultAllocator<cpu> > _index;
+    TVector<IndexType, cpu, DefaultAllocator<cpu> > _indices;
+    bool _bBufferIndices;
+    const CSRColumns<IndexType, algorithmFPType, cpu> * _csrColumns;
+    const ColumnGroup<algorithmFPType, cpu> * _columnGroup;
 };
 
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTaskBins : public ColIndexTask<IndexType, algorithmFPType, cpu>
 {
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> super;
-    ColIndexTaskBins(size_t nRows, const BinParams & prm) : super(nRows), _prm(prm), _bins(_prm.maxBins) {}
+    ColIndexTaskBins(size_t nRows, bool bBufferIndices, const BinParams & prm) : super(nRows, bBufferIndices), _prm(prm), _bins(_prm.maxBins) {}
     virtual services::Status makeIndex(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                        bool bUnorderedFeature) DAAL_C11_OVERRIDE;
 
@@ -174,7 +320,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::assignIndexA
 
         entry.binBorders[0] = index[nRows - 1].key;
         _bins[0]            = nRows;
-        return Status();
+        return services::Status();
     }
     entry.numIndices   = nBins;
     services::Status s = entry.allocBorders();
@@ -196,7 +342,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
 {
     if (bUnorderedFeature || nRows <= _prm.maxBins) return this->makeIndexDefault(nt, entry, aRes, iCol, nRows, bUnorderedFeature);
 
-    Status s = this->getSorted(nt, iCol, nRows);
+    services::Status s = this->getSorted(nt, iCol, nRows);
     if (!s) return s;
 
     const typename super::FeatureIdx * index = this->_index.get();
@@ -294,51 +440,123 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     return assignIndexAccordingToBins(entry, aRes, nBins, nRows);
 }
 
-template <typename algorithmFPType, CpuType cpu>
-services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTypes * featureTypes, const BinParams * pBimPrm)
+template <typename FeatureBinIndexType>
+void IndexedFeatures::storeIndices(size_t iCol, const IndexType * aIdx)
 {
-    dtrees::internal::FeatureTypes autoFT;
-    if (!featureTypes)
-    {
-        DAAL_CHECK_MALLOC(autoFT.init(nt));
-        featureTypes = &autoFT;
-    }
+    FeatureBinIndexType * aRes = (FeatureBinIndexType *)(_data + _nRows * iCol * sizeof(FeatureBinIndexType));
+    for (size_t i = 0; i < _nRows; ++i) aRes[i] = FeatureBinIndexType(aIdx[i]);
+}
 
+//Computes the indices of the features with the size of the stored index chosen for nIndicesBound indices.
+//The indices of a feature with more than nIndicesBound of them are not stored, maxNumIndices() reports that
+template <typename algorithmFPType, CpuType cpu>
+services::Status IndexedFeatures::makeIndices(const NumericTable & nt, const FeatureTypes & featureTypes, const BinParams * pBimPrm,
+                                              size_t nIndicesBound)
+{
+    const size_t sizeOfIndex = (nIndicesBound <= size_t(1) << 8) ? sizeof(uint8_t) :
+                               (nIndicesBound <= size_t(1) << 16) ? sizeof(uint16_t) :
+                                                                    sizeof(IndexType);
     _maxNumIndices     = 0;
-    services::Status s = alloc(nt.getNumberOfColumns(), nt.getNumberOfRows());
+    services::Status s = alloc(nt.getNumberOfColumns(), nt.getNumberOfRows(), sizeOfIndex);
     if (!s) return s;
 
-    const size_t nC = nt.getNumberOfColumns();
+    const size_t nC           = nt.getNumberOfColumns();
+    const bool bBufferIndices = (sizeOfIndex != sizeof(IndexType));
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> TlsTask;
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> DefaultTask;
     typedef ColIndexTaskBins<IndexType, algorithmFPType, cpu> BinningTask;
 
+    //the sparse table is transposed once instead of the dense reading of every column
+    CSRColumns<IndexType, algorithmFPType, cpu> csrColumns;
+    CSRNumericTableIface * csr = (nt.getDataLayout() == NumericTableIface::csrArray) ?
+                                     dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&nt)) :
+                                     nullptr;
+    if (csr)
+    {
+        s = csrColumns.init(*csr, nRows(), nC);
+        if (!s) return s;
+    }
+    const CSRColumns<IndexType, algorithmFPType, cpu> * pCSRColumns = csr ? &csrColumns : nullptr;
+
+    //the tables stored by rows, including the ones which load their rows on demand, are read by groups
+    //of columns with as many columns as the threads that sort them
+    const bool bByColumnGroups = !csr && (nt.getDataLayout() != NumericTableIface::soa) && (nC > 1);
+    const size_t nColsInGroup  = bByColumnGroups ? services::internal::min<cpu, size_t>(nC, 2 * threader_get_threads_number()) : 0;
+    ColumnGroup<algorithmFPType, cpu> columnGroup(nRows(), nColsInGroup);
+    if (bByColumnGroups) DAAL_CHECK_MALLOC(columnGroup.isValid());
+    const ColumnGroup<algorithmFPType, cpu> * pColumnGroup = bByColumnGroups ? &columnGroup : nullptr;
+
     daal::tls<TlsTask *> tlsData([=, &nt]() -> TlsTask * {
         const size_t nRows = nt.getNumberOfRows();
-        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, *pBimPrm) : new DefaultTask(nRows));
+        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, bBufferIndices, *pBimPrm) : new DefaultTask(nRows, bBufferIndices));
         if (res && !res->isValid())
         {
             delete res;
             res = nullptr;
         }
+        if (res)
+        {
+            res->setCSRColumns(pCSRColumns);
+            res->setColumnGroup(pColumnGroup);
+        }
         return res;
     });
 
     SafeStatus safeStat;
-    daal::threader_for(nC, nC, [&](size_t iCol) {
+    auto makeColIndex = [&](size_t iCol) {
         //in case of single thread no need to allocate
         TlsTask * task = tlsData.local();
         DAAL_CHECK_THR(task, services::ErrorMemoryAllocationFailed);
-        safeStat |=
-            task->makeIndex(const_cast<NumericTable &>(nt), _entries[iCol], _data + iCol * nRows(), iCol, nRows(), featureTypes->isUnordered(iCol));
-    });
+        IndexType * aIdx = bBufferIndices ? task->indices() : (IndexType *)_data + iCol * nRows();
+        services::Status st =
+            task->makeIndex(const_cast<NumericTable &>(nt), _entries[iCol], aIdx, iCol, nRows(), featureTypes.isUnordered(iCol));
+        DAAL_CHECK_STATUS_THR(st);
+        if (!bBufferIndices || size_t(_entries[iCol].numIndices) > nIndicesBound) return;
+        if (sizeOfIndex == sizeof(uint8_t))
+            storeIndices<uint8_t>(iCol, aIdx);
+        else
+            storeIndices<uint16_t>(iCol, aIdx);
+    };
+    if (bByColumnGroups)
+    {
+        for (size_t iFirstCol = 0; (iFirstCol < nC) && s; iFirstCol += nColsInGroup)
+        {
+            const size_t nCols = services::internal::min<cpu, size_t>(nColsInGroup, nC - iFirstCol);
+            s                  = columnGroup.read(nt, iFirstCol, nCols);
+            if (s) daal::threader_for(nCols, nCols, [&](size_t i) { makeColIndex(iFirstCol + i); });
+        }
+    }
+    else
+    {
+        daal::threader_for(nC, nC, makeColIndex);
+    }
     tlsData.reduce([&](TlsTask * task) -> void {
         if (_maxNumIndices < task->maxNumDiffValues) _maxNumIndices = task->maxNumDiffValues;
         delete task;
     });
+    if (!s) return s;
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTypes * featureTypes, const BinParams * pBimPrm)
+{
+    dtrees::internal::FeatureTypes autoFT;
+    if (!featureTypes)
+    {
+        DAAL_CHECK_MALLOC(autoFT.init(nt));
+        featureTypes = &autoFT;
+    }
+
+    //the binned features have at most maxBins indices except for the rare cases of the binning and the unordered features,
+    //the indices are computed again with the wider type then
+    const size_t nRows         = nt.getNumberOfRows();
+    const size_t nIndicesBound = (pBimPrm && pBimPrm->maxBins < nRows) ? pBimPrm->maxBins : nRows;
+    services::Status s         = makeIndices<algorithmFPType, cpu>(nt, *featureTypes, pBimPrm, nIndicesBound);
+    if (s && _maxNumIndices > nIndicesBound) s = makeIndices<algorithmFPType, cpu>(nt, *featureTypes, pBimPrm, _maxNumIndices);
+    return s;
+}
+
 } /* namespace internal */
 } /* namespace dtrees */
 } /* namespace algorithms */
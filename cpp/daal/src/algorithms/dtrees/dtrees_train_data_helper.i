@@ -379,14 +379,21 @@ public:
     bool hasDiffFeatureValues(IndexType iFeature, const int * aIdx, size_t n) const
     {
         if (this->indexedFeatures().numIndices(iFeature) == 1) return false; //single value only
-        const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-        const auto aResponse                              = this->_aResponse.get();
-        const IndexedFeatures::IndexType idx0             = indexedFeature[aResponse[aIdx[0]].idx];
-        size_t i                                          = 1;
+        DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(this->indexedFeatures(), return hasDiffFeatureValues<FeatureBinIndexType>(iFeature, aIdx, n));
+        return false;
+    }
+
+    template <typename FeatureBinIndexType>
+    bool hasDiffFeatureValues(IndexType iFeature, const int * aIdx, size_t n) const
+    {
+        const FeatureBinIndexType * indexedFeature = this->indexedFeatures().template data<FeatureBinIndexType>(iFeature);
+        const auto aResponse                       = this->_aResponse.get();
+        const FeatureBinIndexType idx0             = indexedFeature[aResponse[aIdx[0]].idx];
+        size_t i                                   = 1;
         for (; i < n; ++i)
         {
-            const Response & r                   = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
+            const Response & r            = aResponse[aIdx[i]];
+            const FeatureBinIndexType idx = indexedFeature[r.idx];
             if (idx != idx0) break;
         }
         return (i != n);
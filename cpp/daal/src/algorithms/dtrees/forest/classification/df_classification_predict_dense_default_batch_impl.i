@@ -61,6 +61,7 @@ typedef int32_t featureIndexType;
 #define _MIN_TREES_FOR_THREADING                 100
 #define _SCALE_FACTOR_FOR_VECT_PARALLEL_COMPUTE  0.3 /* scale tree size to chose whethever vectorized or not compute path in parallel mode */
 #define _MIN_NUMBER_OF_ROWS_FOR_VECT_SEQ_COMPUTE 32  /* min number of rows to be predicted by vectorized compute path in sequential mode */
+#define _MAX_NUMBER_OF_ROWS_FOR_SEQ_COMPUTE      16  /* max number of rows to be predicted row by row on the calling thread */
 
 template <typename algorithmFPType, CpuType cpu>
 DAAL_FORCEINLINE void fillResults(const size_t nClasses, const enum VotingMethod votingMethod, const size_t blockSize, const double * const probas,
@@ -167,6 +168,8 @@ protected:
 
     Status predictOneRowByAllTrees(const size_t nTreesTotal);
 
+    Status predictSmallBatchByAllTrees(const size_t nTreesTotal);
+
     size_t getMaxClass(const algorithmFPType * const counts) const
     {
         return services::internal::getMaxElementIndex<algorithmFPType, cpu>(counts, _nClasses);
@@ -578,7 +581,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictOneRowByAllTrees(
         _cachedNClasses = _nClasses;
     }
 
-    if (_cachedModel != _model)
+    if (_cachedModel != _model || _probas.size() != nTreesTotal)
     {
         _cachedModel = _model;
         _aTree.reset(nTreesTotal);
@@ -894,6 +897,99 @@ Status PredictClassificationTask<float, avx512>::predictOneRowByAllTrees(size_t
 }
 #endif
 
+/* Predicts the rows one after another on the calling thread without the threading and the TLS setup,
+   the buffers are kept in the task between the calls */
+template <typename algorithmFPType, CpuType cpu>
+Status PredictClassificationTask<algorithmFPType, cpu>::predictSmallBatchByAllTrees(const size_t nTreesTotal)
+{
+    if (_nClasses != _cachedNClasses)
+    {
+        _probas_d.reset(_nClasses);
+        DAAL_CHECK_MALLOC(_probas_d.get());
+        _cachedNClasses = _nClasses;
+    }
+
+    if (_cachedModel != _model || _probas.size() != nTreesTotal)
+    {
+        _cachedModel = _model;
+        _aTree.reset(nTreesTotal);
+        _probas.reset(nTreesTotal);
+        DAAL_CHECK_MALLOC(_aTree.get() && _probas.get());
+        _averageTreeSize         = 0;
+        double ** const prob_ptr = _probas.get();
+        for (size_t i = 0; i < nTreesTotal; ++i)
+        {
+            _aTree[i] = _model->at(i);
+            _averageTreeSize += _aTree[i]->getNumberOfRows();
+            prob_ptr[i] = nullptr;
+        }
+        _averageTreeSize = _averageTreeSize / nTreesTotal;
+        _sumTreeSize     = 0;
+    }
+
+    algorithmFPType * resPtr  = nullptr;
+    algorithmFPType * probPtr = nullptr;
+
+    const HomogenNumericTable<algorithmFPType> * const resNT  = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(_res);
+    const HomogenNumericTable<algorithmFPType> * const probNT = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(_prob);
+    const size_t nRows                                        = _data->getNumberOfRows();
+    const size_t nCols                                        = _data->getNumberOfColumns();
+    if (resNT == nullptr)
+    {
+        _resBD.set(_res, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_resBD);
+        resPtr = _resBD.get();
+    }
+    else
+    {
+        resPtr = resNT->getArray();
+    }
+
+    if (probNT == nullptr)
+    {
+        _probBD.set(_prob, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_probBD);
+        probPtr = _probBD.get();
+    }
+    else
+    {
+        probPtr = probNT->getArray();
+    }
+
+    const HomogenNumericTable<algorithmFPType> * const hmgData = dynamic_cast<const HomogenNumericTable<algorithmFPType> *>(_data);
+    if (hmgData == nullptr)
+    {
+        _xBD.set(const_cast<NumericTable *>(_data), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_xBD);
+    }
+    const algorithmFPType * const x_ptr = hmgData != nullptr ? hmgData->getArray() : _xBD.get();
+
+    double * const prob_d                   = _probas_d.get();
+    const algorithmFPType inverseTreesCount = 1.0 / algorithmFPType(nTreesTotal);
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        services::internal::service_memset_seq<double, cpu>(prob_d, double(0), _nClasses);
+
+        predictByTreesWithoutConversion(0, nTreesTotal, x_ptr + iRow * nCols, prob_d, nTreesTotal);
+
+        if (_res)
+        {
+            resPtr[iRow] = algorithmFPType(services::internal::getMaxElementIndex<double, cpu>(prob_d, _nClasses));
+        }
+        if (probPtr != nullptr)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _nClasses; ++j)
+            {
+                probPtr[iRow * _nClasses + j] = prob_d[j] * inverseTreesCount;
+            }
+        }
+    }
+
+    return Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTrees(size_t nTreesTotal)
 {
@@ -1034,6 +1130,10 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
     {
         return predictOneRowByAllTrees(nTreesTotal);
     }
+    if (_data->getNumberOfRows() <= _MAX_NUMBER_OF_ROWS_FOR_SEQ_COMPUTE)
+    {
+        return predictSmallBatchByAllTrees(nTreesTotal);
+    }
     if (_cachedModel != _model)
     {
         _cachedModel = _model;
@@ -1047,6 +1147,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
         }
         _averageTreeSize = _averageTreeSize / nTreesTotal;
         _sumTreeSize     = 0;
+        _probas.reset();
     }
 
     if (hasUnorderedFeatures
@@ -29,6 +29,7 @@
 #include "algorithms/decision_forest/decision_forest_classification_training_batch.h"
 #include "src/algorithms/dtrees/forest/classification/df_classification_train_kernel.h"
 #include "src/algorithms/dtrees/forest/classification/df_classification_train_dense_default_kernel.h"
+#include "src/algorithms/dtrees/forest/classification/df_classification_train_hist_kernel.h"
 #include "src/algorithms/dtrees/forest/classification/oneapi/df_classification_train_hist_kernel_oneapi.h"
 #include "src/algorithms/dtrees/forest/classification/df_classification_model_impl.h"
 #include "src/services/service_algo_utils.h"
@@ -107,9 +107,15 @@ public:
     int findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart,
                                       const ImpurityData & curImpurity, TSplitData & split, const algorithmFPType minWeightLeaf,
                                       const algorithmFPType totalWeights) const;
+    template <typename FeatureBinIndexType>
     void computeHistFewClassesWithoutWeights(IndexType iFeature, const IndexType * aIdx, size_t n) const;
+    template <typename FeatureBinIndexType>
     void computeHistFewClassesWithWeights(IndexType iFeature, const IndexType * aIdx, size_t n) const;
+    template <typename FeatureBinIndexType>
     void computeHistManyClasses(IndexType iFeature, const IndexType * aIdx, size_t n) const;
+    template <typename FeatureBinIndexType>
+    int splitByBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit, const TSplitData & bestSplit,
+                         IndexType * bestSplitIdx) const;
 
     int findBestSplitbyHistDefault(int nDiffFeatMax, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
                                    const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
@@ -497,10 +503,11 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
 }
 
 template <typename algorithmFPType, CpuType cpu>
+template <typename FeatureBinIndexType>
 void UnorderedRespHelper<algorithmFPType, cpu>::computeHistFewClassesWithoutWeights(IndexType iFeature, const IndexType * aIdx, size_t n) const
 {
-    const IndexedFeatures::IndexType * const indexedFeature = this->indexedFeatures().data(iFeature);
-    const auto aResponse                                    = this->_aResponse.get();
+    const FeatureBinIndexType * const indexedFeature = this->indexedFeatures().template data<FeatureBinIndexType>(iFeature);
+    const auto aResponse                             = this->_aResponse.get();
     const algorithmFPType one(1.0);
     auto nSamplesPerClass = _samplesPerClassBuf.get();
     {
@@ -509,19 +516,20 @@ void UnorderedRespHelper<algorithmFPType, cpu>::computeHistFewClassesWithoutWeig
             const IndexType iSample = aIdx[i];
             const auto & r          = aResponse[aIdx[i]];
 
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
-            const ClassIndexType iClass          = r.val;
+            const IndexType idx         = indexedFeature[r.idx];
+            const ClassIndexType iClass = r.val;
             nSamplesPerClass[idx * _nClasses + iClass] += one;
         }
     }
 }
 
 template <typename algorithmFPType, CpuType cpu>
+template <typename FeatureBinIndexType>
 void UnorderedRespHelper<algorithmFPType, cpu>::computeHistFewClassesWithWeights(IndexType iFeature, const IndexType * aIdx, size_t n) const
 {
-    const IndexedFeatures::IndexType * const indexedFeature = this->indexedFeatures().data(iFeature);
-    const auto aResponse                                    = this->_aResponse.get();
-    const auto aWeights                                     = this->_aWeights.get();
+    const FeatureBinIndexType * const indexedFeature = this->indexedFeatures().template data<FeatureBinIndexType>(iFeature);
+    const auto aResponse                             = this->_aResponse.get();
+    const auto aWeights                              = this->_aWeights.get();
 
     auto nFeatIdx         = _idxFeatureBuf.get();
     auto nSamplesPerClass = _samplesPerClassBuf.get();
@@ -529,9 +537,9 @@ void UnorderedRespHelper<algorithmFPType, cpu>::computeHistFewClassesWithWeights
     {
         for (size_t i = 0; i < n; ++i)
         {
-            const IndexType iSample              = aIdx[i];
-            const auto & r                       = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
+            const IndexType iSample = aIdx[i];
+            const auto & r          = aResponse[aIdx[i]];
+            const IndexType idx     = indexedFeature[r.idx];
             ++nFeatIdx[idx];
             const auto weights          = aWeights[iSample].val;
             const ClassIndexType iClass = r.val;
@@ -541,11 +549,12 @@ void UnorderedRespHelper<algorithmFPType, cpu>::computeHistFewClassesWithWeights
 }
 
 template <typename algorithmFPType, CpuType cpu>
+template <typename FeatureBinIndexType>
 void UnorderedRespHelper<algorithmFPType, cpu>::computeHistManyClasses(IndexType iFeature, const IndexType * aIdx, size_t n) const
 {
-    const IndexedFeatures::IndexType * const indexedFeature = this->indexedFeatures().data(iFeature);
-    const auto aResponse                                    = this->_aResponse.get();
-    const auto aWeights                                     = this->_aWeights.get();
+    const FeatureBinIndexType * const indexedFeature = this->indexedFeatures().template data<FeatureBinIndexType>(iFeature);
+    const auto aResponse                             = this->_aResponse.get();
+    const auto aWeights                              = this->_aWeights.get();
 
     auto nFeatIdx         = _idxFeatureBuf.get();
     auto featWeights      = _weightsFeatureBuf.get();
@@ -554,9 +563,9 @@ void UnorderedRespHelper<algorithmFPType, cpu>::computeHistManyClasses(IndexType
     {
         for (size_t i = 0; i < n; ++i)
         {
-            const IndexType iSample              = aIdx[i];
-            const auto & r                       = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
+            const IndexType iSample = aIdx[i];
+            const auto & r          = aResponse[aIdx[i]];
+            const IndexType idx     = indexedFeature[r.idx];
             ++nFeatIdx[idx];
             const auto weights          = aWeights[iSample].val;
             const ClassIndexType iClass = r.val;
@@ -778,7 +787,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         if (!this->_weights)
         {
             // nSamplesPerClass - computed. nFeatIdx and featWeights - no
-            computeHistFewClassesWithoutWeights(iFeature, aIdx, n);
+            DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(this->indexedFeatures(), computeHistFewClassesWithoutWeights<FeatureBinIndexType>(iFeature, aIdx, n));
             idxFeatureBestSplit =
                 findBestSplitFewClassesDispatch<true>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
         }
@@ -786,7 +795,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         {
             // nSamplesPerClass and nFeatIdx - computed, featWeights - no
             _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-            computeHistFewClassesWithWeights(iFeature, aIdx, n);
+            DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(this->indexedFeatures(), computeHistFewClassesWithWeights<FeatureBinIndexType>(iFeature, aIdx, n));
             idxFeatureBestSplit =
                 findBestSplitFewClassesDispatch<false>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
         }
@@ -796,7 +805,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         // nSamplesPerClass, nFeatIdx and featWeights - computed
         _weightsFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
         _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-        computeHistManyClasses(iFeature, aIdx, n);
+        DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(this->indexedFeatures(), computeHistManyClasses<FeatureBinIndexType>(iFeature, aIdx, n));
         idxFeatureBestSplit = findBestSplitbyHistDefault(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
     }
 
@@ -804,25 +813,20 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
 }
 
 template <typename algorithmFPType, CpuType cpu>
-void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature,
-                                                                  size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
-                                                                  IndexType * bestSplitIdx) const
+template <typename FeatureBinIndexType>
+int UnorderedRespHelper<algorithmFPType, cpu>::splitByBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit,
+                                                                const TSplitData & bestSplit, IndexType * bestSplitIdx) const
 {
-    DAAL_ASSERT(bestSplit.nLeft > 0);
-    DAAL_ASSERT(bestSplit.leftWeights > 0.);
-    const algorithmFPType divL =
-        isZero<algorithmFPType, cpu>(bestSplit.leftWeights) ? algorithmFPType(1.) : (algorithmFPType(1.) / bestSplit.leftWeights);
-    bestSplit.left.var                                      = 1. - bestSplit.left.var * divL * divL; // Gini node impurity
-    IndexType * bestSplitIdxRight                           = bestSplitIdx + bestSplit.nLeft;
-    size_t iLeft                                            = 0;
-    size_t iRight                                           = 0;
-    int iRowSplitVal                                        = -1;
-    const auto aResponse                                    = this->_aResponse.get();
-    const IndexedFeatures::IndexType * const indexedFeature = this->indexedFeatures().data(iFeature);
+    IndexType * bestSplitIdxRight                    = bestSplitIdx + bestSplit.nLeft;
+    size_t iLeft                                     = 0;
+    size_t iRight                                    = 0;
+    int iRowSplitVal                                 = -1;
+    const auto aResponse                             = this->_aResponse.get();
+    const FeatureBinIndexType * const indexedFeature = this->indexedFeatures().template data<FeatureBinIndexType>(iFeature);
     for (size_t i = 0; i < n; ++i)
     {
-        const IndexType iSample              = aIdx[i];
-        const IndexedFeatures::IndexType idx = indexedFeature[aResponse[iSample].idx];
+        const IndexType iSample = aIdx[i];
+        const IndexType idx     = indexedFeature[aResponse[iSample].idx];
         if ((bestSplit.featureUnordered && (idx != idxFeatureValueBestSplit)) || ((!bestSplit.featureUnordered) && (idx > idxFeatureValueBestSplit)))
         {
             DAAL_ASSERT(iRight < n - bestSplit.nLeft);
@@ -837,6 +841,22 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
     }
     DAAL_ASSERT(iRight == n - bestSplit.nLeft);
     DAAL_ASSERT(iLeft == bestSplit.nLeft);
+    return iRowSplitVal;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature,
+                                                                  size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
+                                                                  IndexType * bestSplitIdx) const
+{
+    DAAL_ASSERT(bestSplit.nLeft > 0);
+    DAAL_ASSERT(bestSplit.leftWeights > 0.);
+    const algorithmFPType divL =
+        isZero<algorithmFPType, cpu>(bestSplit.leftWeights) ? algorithmFPType(1.) : (algorithmFPType(1.) / bestSplit.leftWeights);
+    bestSplit.left.var = 1. - bestSplit.left.var * divL * divL; // Gini node impurity
+    int iRowSplitVal   = -1;
+    DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(this->indexedFeatures(), iRowSplitVal = splitByBestSplit<FeatureBinIndexType>(
+                                                                   aIdx, n, iFeature, idxFeatureValueBestSplit, bestSplit, bestSplitIdx));
     bestSplit.iStart = 0;
     DAAL_ASSERT(iRowSplitVal >= 0);
     bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
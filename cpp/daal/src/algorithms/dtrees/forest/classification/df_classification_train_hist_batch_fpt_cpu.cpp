@@ -22,7 +22,7 @@
 */
 
 #include "src/algorithms/dtrees/forest/classification/df_classification_train_container.h"
-#include "src/algorithms/dtrees/forest/classification/df_classification_train_kernel.h"
+#include "src/algorithms/dtrees/forest/classification/df_classification_train_hist_impl.i"
 
 namespace daal
 {
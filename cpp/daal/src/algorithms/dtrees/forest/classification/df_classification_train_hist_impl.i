@@ -0,0 +1,145 @@
+/* file: df_classification_train_hist_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for decision forest classification
+//  train algorithms (hist) method on CPU.
+//--
+*/
+
+#ifndef __DF_CLASSIFICATION_TRAIN_HIST_IMPL_I__
+#define __DF_CLASSIFICATION_TRAIN_HIST_IMPL_I__
+
+#include "src/algorithms/dtrees/forest/df_train_hist_impl.i"
+#include "src/algorithms/dtrees/forest/classification/df_classification_train_kernel.h"
+#include "src/algorithms/dtrees/forest/classification/df_classification_train_hist_kernel.h"
+#include "src/algorithms/dtrees/forest/classification/df_classification_model_impl.h"
+#include "src/algorithms/dtrees/forest/classification/df_classification_training_types_result.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::algorithms::decision_forest::training::internal;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Statistics of the rows of the classification: the number of the rows and
+// the weights of the classes. The impurity is the Gini index.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class HistTaskClassification
+{
+public:
+    typedef decision_forest::classification::internal::ModelImpl::TreeType TreeType;
+
+    HistTaskClassification(size_t nClasses) : _nClasses(nClasses) {}
+
+    size_t getNumberOfClasses() const { return _nClasses; }
+    size_t getNumberOfStats() const { return _nClasses + 1; }
+    size_t getDefaultFeaturesPerNode(size_t nFeatures) const
+    {
+        const size_t nF(daal::internal::Math<algorithmFPType, cpu>::sSqrt(nFeatures));
+        return (nF < 1 ? 1 : nF);
+    }
+
+    bool checkResponse(algorithmFPType y) const { return y >= 0 && y < algorithmFPType(_nClasses) && y == algorithmFPType(size_t(y)); }
+
+    void addRow(double * stats, algorithmFPType y, double count, double weight) const
+    {
+        stats[0] += count;
+        stats[1 + size_t(y)] += weight;
+    }
+
+    double getWeight(const double * stats) const
+    {
+        double weight = 0.;
+        for (size_t i = 0; i < _nClasses; ++i) weight += stats[1 + i];
+        return weight;
+    }
+
+    double getImpurity(const double * stats) const
+    {
+        const double weight = getWeight(stats);
+        if (!(weight > 0.)) return 0.;
+        double impurity = 1.;
+        for (size_t i = 0; i < _nClasses; ++i) impurity -= (stats[1 + i] / weight) * (stats[1 + i] / weight);
+        return (impurity > 0. ? impurity : 0.);
+    }
+
+    //the histogram of the leaf holds the numbers of the rows of the classes
+    //in the proportion of their weights, as the class probabilities are hist / count
+    typename TreeType::NodeType::Leaf * makeLeaf(TreeType & tree, const double * stats) const
+    {
+        typename TreeType::NodeType::Leaf * leaf = tree.allocator().allocLeaf(_nClasses);
+        const double weight                      = getWeight(stats);
+        size_t maxClass                          = 0;
+        for (size_t i = 0; i < _nClasses; ++i)
+        {
+            leaf->hist[i] = (weight > 0. ? stats[0] * stats[1 + i] / weight : 0.);
+            if (stats[1 + i] > stats[1 + maxClass]) maxClass = i;
+        }
+        leaf->response.value = maxClass;
+        return leaf;
+    }
+
+private:
+    const size_t _nClasses;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// ClassificationTrainBatchKernel
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status ClassificationTrainBatchKernel<algorithmFPType, hist, cpu>::compute(HostAppIface * pHostApp, const NumericTable * x,
+                                                                                    const NumericTable * y, const NumericTable * w,
+                                                                                    decision_forest::classification::Model & m, Result & res,
+                                                                                    const Parameter & par)
+{
+    return compute(pHostApp, x, y, w, m, res, par, HistCommunicator());
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status ClassificationTrainBatchKernel<algorithmFPType, hist, cpu>::compute(HostAppIface * pHostApp, const NumericTable * x,
+                                                                                    const NumericTable * y, const NumericTable * w,
+                                                                                    decision_forest::classification::Model & m, Result & res,
+                                                                                    const Parameter & par, const HistCommunicator & comm)
+{
+    engines::EnginePtr updatedEngine;
+    const HistTaskClassification<algorithmFPType, cpu> task(par.nClasses);
+    services::Status s = computeHistImpl<algorithmFPType, cpu>(
+        x, y, w, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl *>(&m), par, task, comm, updatedEngine);
+    if (s.ok()) res.impl()->setEngine(updatedEngine);
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace classification */
+} /* namespace decision_forest */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
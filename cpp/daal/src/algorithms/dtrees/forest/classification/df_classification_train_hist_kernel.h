@@ -0,0 +1,69 @@
+/* file: df_classification_train_hist_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of structure containing kernels for decision forest
+//  training by the hist method on CPU.
+//--
+*/
+
+#ifndef __DF_CLASSIFICATION_TRAIN_HIST_KERNEL_H__
+#define __DF_CLASSIFICATION_TRAIN_HIST_KERNEL_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/algorithm_base_common.h"
+#include "algorithms/decision_forest/decision_forest_classification_training_types.h"
+#include "src/algorithms/dtrees/forest/df_train_hist_communicator.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+class ClassificationTrainBatchKernel<algorithmFPType, hist, cpu> : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const NumericTable * w,
+                             decision_forest::classification::Model & m, Result & res, const Parameter & par);
+
+    /* Trains one forest on the rows of all the processes of comm, x, y and w
+     * are the local rows. The model is the same on every process. */
+    services::Status compute(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const NumericTable * w,
+                             decision_forest::classification::Model & m, Result & res, const Parameter & par,
+                             const decision_forest::training::internal::HistCommunicator & comm);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+
+#endif
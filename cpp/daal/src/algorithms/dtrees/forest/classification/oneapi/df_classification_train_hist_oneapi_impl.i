@@ -35,6 +35,7 @@
 
 #include "src/externals/service_ittnotify.h"
 #include "src/externals/service_rng.h"
+#include "src/sycl/rng_gpu.h"
 #include "src/externals/service_math.h" //will remove after migrating finalize MDA to GPU
 #include "services/internal/buffer.h"
 #include "data_management/data/numeric_table.h"
@@ -77,6 +78,26 @@ static services::String getFPTypeAccuracy()
     return services::String();
 }
 
+/* The accuracy of getFPTypeAccuracy, the impurity decreases are compared on the host as in the kernels */
+template <typename algorithmFPType>
+static algorithmFPType getFPTypeAccuracyValue()
+{
+    return IsSameType<algorithmFPType, float>::value ? algorithmFPType(1e-5) : algorithmFPType(1e-10);
+}
+
+template <typename algorithmFPType>
+static bool fpEq(algorithmFPType a, algorithmFPType b)
+{
+    const algorithmFPType accuracy = getFPTypeAccuracyValue<algorithmFPType>();
+    return a - b <= accuracy && b - a <= accuracy;
+}
+
+template <typename algorithmFPType>
+static bool fpGt(algorithmFPType a, algorithmFPType b)
+{
+    return a - b > getFPTypeAccuracyValue<algorithmFPType>();
+}
+
 static services::String getBuildOptions(size_t nClasses)
 {
     DAAL_ASSERT(nClasses <= static_cast<size_t>(services::internal::MaxVal<int32_t>::get()));
@@ -276,28 +297,58 @@ services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::co
             //_maxLocalHistograms/2 (128) showed better performance than _maxLocalHistograms need to investigate
             int reduceLocalSize = 16; // add logic for its adjustment
 
+            // mul overflow for _nMaxBinsAmongFtrs * _nClasses was checked before kernel call in compute
+            const size_t ftrHistSize = _nMaxBinsAmongFtrs * _nClasses;
+            DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, ftrHistSize, sizeof(algorithmFPType));
+
+            // the partial and reduced histograms of a block of nodes and features fit the memory limit, the features of the nodes
+            // whose histograms exceed it alone are processed by blocks, at least one feature with one partial histogram per block
+            size_t maxFtrHistograms = _maxHistogramsBytes / (ftrHistSize * sizeof(algorithmFPType));
+            maxFtrHistograms        = maxFtrHistograms > 2 ? maxFtrHistograms : 2;
+            nPartialHistograms      = nPartialHistograms < maxFtrHistograms - 1 ? nPartialHistograms : maxFtrHistograms - 1;
+
+            size_t nBlockFtrs = maxFtrHistograms / (nPartialHistograms + 1);
+            nBlockFtrs        = nBlockFtrs < nSelectedFeatures ? (nBlockFtrs > 1 ? nBlockFtrs : 1) : nSelectedFeatures;
+
+            if (nBlockFtrs < nSelectedFeatures)
+            {
+                DAAL_CHECK_STATUS_VAR(computeBestSplitByFeatureBlocks(data, treeOrder, selectedFeatures, nSelectedFeatures, response, nodeList,
+                                                                      nodeIndices, groupIndicesOffset, binOffsets, impList, nodeImpDecreaseList,
+                                                                      updateImpDecreaseRequired, nFeatures, nNodes, nGroupNodes, nBlockFtrs,
+                                                                      nPartialHistograms, reduceLocalSize, minObservationsInLeafNode, impurityThreshold));
+                continue;
+            }
+
             // mul overflow for nSelectedFeatures * _nMaxBinsAmongFtrs and for nHistBins * _nClasses were checked before kernel call in compute
             size_t nHistBins    = nSelectedFeatures * _nMaxBinsAmongFtrs;
             size_t partHistSize = nHistBins * _nClasses;
 
-            DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nGroupNodes, partHistSize);
-            DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nGroupNodes * partHistSize, nPartialHistograms);
+            // the nodes of the group are processed by blocks, so the histograms of a block fit the memory limit
+            size_t nBlockNodes = maxFtrHistograms / ((nPartialHistograms + 1) * nSelectedFeatures);
+            nBlockNodes        = nBlockNodes < nGroupNodes ? (nBlockNodes > 1 ? nBlockNodes : 1) : nGroupNodes;
 
-            auto partialHistograms = context.allocate(TypeIds::id<algorithmFPType>(), nGroupNodes * nPartialHistograms * partHistSize, &status);
+            auto partialHistograms = context.allocate(TypeIds::id<algorithmFPType>(), nBlockNodes * nPartialHistograms * partHistSize, &status);
             DAAL_CHECK_STATUS_VAR(status);
-            auto nodesHistograms = context.allocate(TypeIds::id<algorithmFPType>(), nGroupNodes * partHistSize, &status);
+            auto nodesHistograms = context.allocate(TypeIds::id<algorithmFPType>(), nBlockNodes * partHistSize, &status);
             DAAL_CHECK_STATUS_VAR(status);
 
-            DAAL_CHECK_STATUS_VAR(computePartialHistograms(data, treeOrder, selectedFeatures, nSelectedFeatures, response, nodeList, nodeIndices,
-                                                           groupIndicesOffset, binOffsets, _nMaxBinsAmongFtrs, nFeatures, nGroupNodes,
-                                                           partialHistograms, nPartialHistograms));
+            for (size_t iNode = 0; iNode < nGroupNodes; iNode += nBlockNodes)
+            {
+                const size_t nNodesInBlock      = nGroupNodes - iNode < nBlockNodes ? nGroupNodes - iNode : nBlockNodes;
+                const size_t blockIndicesOffset = groupIndicesOffset + iNode;
+
+                DAAL_CHECK_STATUS_VAR(computePartialHistograms(data, treeOrder, selectedFeatures, nSelectedFeatures, response, nodeList, nodeIndices,
+                                                               blockIndicesOffset, binOffsets, _nMaxBinsAmongFtrs, nFeatures, nNodesInBlock,
+                                                               partialHistograms, nPartialHistograms));
 
-            DAAL_CHECK_STATUS_VAR(reducePartialHistograms(partialHistograms, nodesHistograms, nPartialHistograms, nGroupNodes, nSelectedFeatures,
-                                                          _nMaxBinsAmongFtrs, reduceLocalSize));
+                DAAL_CHECK_STATUS_VAR(reducePartialHistograms(partialHistograms, nodesHistograms, nPartialHistograms, nNodesInBlock,
+                                                              nSelectedFeatures, _nMaxBinsAmongFtrs, reduceLocalSize));
 
-            DAAL_CHECK_STATUS_VAR(computeBestSplitByHistogram(nodesHistograms, selectedFeatures, nSelectedFeatures, nodeList, nodeIndices,
-                                                              groupIndicesOffset, binOffsets, impList, nodeImpDecreaseList, updateImpDecreaseRequired,
-                                                              nGroupNodes, _nMaxBinsAmongFtrs, minObservationsInLeafNode, impurityThreshold));
+                DAAL_CHECK_STATUS_VAR(computeBestSplitByHistogram(nodesHistograms, selectedFeatures, nSelectedFeatures, nodeList, nodeIndices,
+                                                                  blockIndicesOffset, binOffsets, impList, nodeImpDecreaseList,
+                                                                  updateImpDecreaseRequired, nNodesInBlock, _nMaxBinsAmongFtrs,
+                                                                  minObservationsInLeafNode, impurityThreshold));
+            }
         }
         else
         {
@@ -310,6 +361,130 @@ services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::co
     return status;
 }
 
+template <typename algorithmFPType>
+services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::computeBestSplitByFeatureBlocks(
+    const UniversalBuffer & data, UniversalBuffer & treeOrder, UniversalBuffer & selectedFeatures, size_t nSelectedFeatures,
+    const services::internal::Buffer<algorithmFPType> & response, UniversalBuffer & nodeList, UniversalBuffer & nodeIndices, size_t nodeIndicesOffset,
+    UniversalBuffer & binOffsets, UniversalBuffer & impList, UniversalBuffer & nodeImpDecreaseList, bool updateImpDecreaseRequired, size_t nFeatures,
+    size_t nNodes, size_t nGroupNodes, size_t nBlockFtrs, size_t nPartialHistograms, size_t reduceLocalSize, size_t minObservationsInLeafNode,
+    algorithmFPType impurityThreshold)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeBestSplitByFeatureBlocks);
+
+    services::Status status;
+
+    auto & context = services::internal::getDefaultContext();
+
+    typedef TreeLevelRecord<algorithmFPType> TreeLevel;
+    const int leafMark       = -1;
+    const size_t nBlockProps = 3; // the feature, the bin and the rows of the left child of the best split of the node
+
+    // the histograms of the block of features of one node fit the memory limit, so the nodes are processed one by one
+    const size_t partHistSize = nBlockFtrs * _nMaxBinsAmongFtrs * _nClasses;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, partHistSize, nPartialHistograms);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodes, nBlockFtrs);
+
+    auto partialHistograms = context.allocate(TypeIds::id<algorithmFPType>(), nPartialHistograms * partHistSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    auto nodesHistograms = context.allocate(TypeIds::id<algorithmFPType>(), partHistSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    auto blockSelectedFeatures = context.allocate(TypeIds::id<int32_t>(), nNodes * nBlockFtrs, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    auto blockImpDecrease = context.allocate(TypeIds::id<algorithmFPType>(), nNodes, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    // the best splits of the nodes over the blocks of features processed so far
+    daal::services::internal::TArray<int, sse2> nodeIds(nGroupNodes);
+    daal::services::internal::TArray<int, sse2> bestSplits(nGroupNodes * nBlockProps);
+    daal::services::internal::TArray<algorithmFPType, sse2> bestImpDecreases(nGroupNodes);
+    DAAL_CHECK_MALLOC(nodeIds.get() && bestSplits.get() && bestImpDecreases.get());
+    {
+        auto nodeIndicesHost = nodeIndices.template get<int32_t>().toHost(ReadWriteMode::readOnly);
+        DAAL_CHECK_MALLOC(nodeIndicesHost.get());
+        for (size_t i = 0; i < nGroupNodes; i++)
+        {
+            nodeIds[i] = nodeIndicesHost.get()[nodeIndicesOffset + i];
+        }
+    }
+
+    for (size_t iFtr = 0; iFtr < nSelectedFeatures; iFtr += nBlockFtrs)
+    {
+        const size_t nFtrsInBlock = nSelectedFeatures - iFtr < nBlockFtrs ? nSelectedFeatures - iFtr : nBlockFtrs;
+        {
+            auto selectedHost      = selectedFeatures.template get<int32_t>().toHost(ReadWriteMode::readOnly);
+            auto blockSelectedHost = blockSelectedFeatures.template get<int32_t>().toHost(ReadWriteMode::writeOnly);
+            DAAL_CHECK_MALLOC(selectedHost.get() && blockSelectedHost.get());
+            for (size_t i = 0; i < nGroupNodes; i++)
+            {
+                const size_t nodeId = nodeIds[i];
+                for (size_t k = 0; k < nFtrsInBlock; k++)
+                {
+                    blockSelectedHost.get()[nodeId * nFtrsInBlock + k] = selectedHost.get()[nodeId * nSelectedFeatures + iFtr + k];
+                }
+            }
+        }
+
+        for (size_t iNode = 0; iNode < nGroupNodes; iNode++)
+        {
+            DAAL_CHECK_STATUS_VAR(computePartialHistograms(data, treeOrder, blockSelectedFeatures, nFtrsInBlock, response, nodeList, nodeIndices,
+                                                           nodeIndicesOffset + iNode, binOffsets, _nMaxBinsAmongFtrs, nFeatures, 1, partialHistograms,
+                                                           nPartialHistograms));
+
+            DAAL_CHECK_STATUS_VAR(
+                reducePartialHistograms(partialHistograms, nodesHistograms, nPartialHistograms, 1, nFtrsInBlock, _nMaxBinsAmongFtrs, reduceLocalSize));
+
+            DAAL_CHECK_STATUS_VAR(computeBestSplitByHistogram(nodesHistograms, blockSelectedFeatures, nFtrsInBlock, nodeList, nodeIndices,
+                                                              nodeIndicesOffset + iNode, binOffsets, impList, blockImpDecrease, true, 1,
+                                                              _nMaxBinsAmongFtrs, minObservationsInLeafNode, impurityThreshold));
+        }
+
+        // the split of the block replaces the best one if it decreases the impurity more, the ties go to the smaller feature
+        // index as in the kernel
+        auto nodeListHost    = nodeList.template get<int32_t>().toHost(ReadWriteMode::readOnly);
+        auto impDecreaseHost = blockImpDecrease.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly);
+        DAAL_CHECK_MALLOC(nodeListHost.get() && impDecreaseHost.get());
+        for (size_t i = 0; i < nGroupNodes; i++)
+        {
+            const int * nodeProps             = nodeListHost.get() + nodeIds[i] * TreeLevel::_nNodeSplitProps;
+            const algorithmFPType impDecrease = impDecreaseHost.get()[nodeIds[i]];
+            int * bestSplit                   = bestSplits.get() + i * nBlockProps;
+            const bool isBetter               = nodeProps[2] != leafMark
+                                  && (bestSplit[0] == leafMark || fpGt(impDecrease, bestImpDecreases[i])
+                                      || (fpEq(impDecrease, bestImpDecreases[i]) && nodeProps[2] < bestSplit[0]));
+            if (iFtr == 0 || isBetter)
+            {
+                bestSplit[0]        = nodeProps[2];
+                bestSplit[1]        = nodeProps[3];
+                bestSplit[2]        = nodeProps[4];
+                bestImpDecreases[i] = impDecrease;
+            }
+        }
+    }
+
+    {
+        auto nodeListHost = nodeList.template get<int32_t>().toHost(ReadWriteMode::readWrite);
+        DAAL_CHECK_MALLOC(nodeListHost.get());
+        for (size_t i = 0; i < nGroupNodes; i++)
+        {
+            int * nodeProps = nodeListHost.get() + nodeIds[i] * TreeLevel::_nNodeSplitProps;
+            nodeProps[2]    = bestSplits[i * nBlockProps + 0];
+            nodeProps[3]    = bestSplits[i * nBlockProps + 1];
+            nodeProps[4]    = bestSplits[i * nBlockProps + 2];
+        }
+    }
+    if (updateImpDecreaseRequired)
+    {
+        auto impDecreaseHost = nodeImpDecreaseList.template get<algorithmFPType>().toHost(ReadWriteMode::readWrite);
+        DAAL_CHECK_MALLOC(impDecreaseHost.get());
+        for (size_t i = 0; i < nGroupNodes; i++)
+        {
+            impDecreaseHost.get()[nodeIds[i]] = bestImpDecreases[i];
+        }
+    }
+
+    return status;
+}
+
 template <typename algorithmFPType>
 services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::computePartialHistograms(
     const UniversalBuffer & data, UniversalBuffer & treeOrder, UniversalBuffer & selectedFeatures, size_t nSelectedFeatures,
@@ -705,14 +880,38 @@ services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::co
     const size_t nSelectedRows = par.observationsPerTreeFraction * nRows;
     DAAL_CHECK_EX((nSelectedRows > 0), ErrorIncorrectParameter, ParameterName, observationsPerTreeFractionStr());
 
-    daal::services::internal::TArray<int, sse2> selectedRowsHost(nSelectedRows);
-    DAAL_CHECK_MALLOC(selectedRowsHost.get());
+    /* The trees of a batch are built level by level together, so the kernels of a level process the nodes of all of them.
+       The rows of the tree i of the batch are [i * nSelectedRows, (i + 1) * nSelectedRows) of treeOrderLev and its nodes
+       are contiguous in the node lists of the levels */
+    const size_t nTreesInBatch = _treeLevelBuildHelper.getNumOfTreesInBatch(par.nTrees, nSelectedRows);
 
-    auto treeOrderLev = context.allocate(TypeIds::id<int32_t>(), nSelectedRows, &status);
+    auto treeRows = context.allocate(TypeIds::id<int32_t>(), nSelectedRows, &status); // rows of one tree before the partitioning
+    DAAL_CHECK_STATUS_VAR(status);
+    auto treeOrderLev = context.allocate(TypeIds::id<int32_t>(), nTreesInBatch * nSelectedRows, &status);
     DAAL_CHECK_STATUS_VAR(status);
-    auto treeOrderLevBuf = context.allocate(TypeIds::id<int32_t>(), nSelectedRows, &status);
+    auto treeOrderLevBuf = context.allocate(TypeIds::id<int32_t>(), nTreesInBatch * nSelectedRows, &status);
     DAAL_CHECK_STATUS_VAR(status);
 
+    /* The bootstrap rows are generated on the device. The rows of all trees of the batch are sorted at once, the rows
+       of every tree are one segment. The sort takes the values moved with the rows and the temporary buffers, the
+       buffer of the keys is treeOrderLevBuf */
+    UniversalBuffer bootstrapValues, bootstrapValuesBuf, bootstrapOffsets;
+    if (par.bootstrap)
+    {
+        bootstrapValues = context.allocate(TypeIds::id<int32_t>(), nTreesInBatch * nSelectedRows, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        bootstrapValuesBuf = context.allocate(TypeIds::id<int32_t>(), nTreesInBatch * nSelectedRows, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        bootstrapOffsets = context.allocate(TypeIds::id<int32_t>(), nTreesInBatch + 1, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        auto offsets = bootstrapOffsets.template get<int32_t>().toHost(ReadWriteMode::writeOnly);
+        DAAL_CHECK_MALLOC(offsets.get());
+        for (size_t tree = 0; tree <= nTreesInBatch; tree++)
+        {
+            offsets.get()[tree] = static_cast<int32_t>(tree * nSelectedRows);
+        }
+    }
+
     BlockDescriptor<algorithmFPType> dataBlock;
     DAAL_CHECK_STATUS_VAR(const_cast<NumericTable *>(x)->getBlockOfRows(0, nRows, readOnly, dataBlock));
 
@@ -768,53 +967,98 @@ services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::co
 
     if (!par.bootstrap)
     {
-        DAAL_CHECK_STATUS_VAR(_treeLevelBuildHelper.initializeTreeOrder(nSelectedRows, treeOrderLev));
+        DAAL_CHECK_STATUS_VAR(_treeLevelBuildHelper.initializeTreeOrder(nSelectedRows, treeRows));
+    }
+
+    services::Collection<SharedPtr<algorithmFPType> > binValuesHost(nFeatures);
+    DAAL_CHECK_MALLOC(binValuesHost.data());
+    services::Collection<algorithmFPType *> binValues(nFeatures);
+    DAAL_CHECK_MALLOC(binValues.data());
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        binValuesHost[i] = indexedFeatures.binBorders(i).template get<algorithmFPType>().toHost(ReadWriteMode::readOnly);
+        DAAL_CHECK_MALLOC(binValuesHost[i].get());
+        binValues[i] = binValuesHost[i].get();
     }
 
-    for (size_t iter = 0; (iter < par.nTrees) && !algorithms::internal::isCancelled(status, pHostApp); ++iter)
+    for (size_t iter = 0; (iter < par.nTrees) && !algorithms::internal::isCancelled(status, pHostApp); iter += nTreesInBatch)
     {
+        const size_t nTrees = (iter + nTreesInBatch < par.nTrees) ? nTreesInBatch : par.nTrees - iter; // num of trees in the batch
+
         BlockDescriptor<algorithmFPType> responseBlock;
         DAAL_CHECK_STATUS_VAR(const_cast<NumericTable *>(y)->getBlockOfRows(0, nRows, readOnly, responseBlock));
 
-        size_t nNodes   = 1; // num of potential nodes to split on current tree level
-        size_t nOOBRows = 0;
+        size_t nNodes          = nTrees; // num of potential nodes to split on current level of all trees
+        const size_t nImpProps = (TreeLevel::_nNodeImpProps + _nClasses);
+
+        daal::services::internal::TArray<size_t, sse2> treeNodesArr(nTrees); // num of potential nodes to split of each tree
+        daal::services::internal::TArray<size_t, sse2> nOOBRowsArr(nTrees);
+        daal::services::internal::TArray<engines::internal::BatchBaseImpl *, sse2> engineImplsArr(nTrees);
+        DAAL_CHECK_MALLOC(treeNodesArr.get() && nOOBRowsArr.get() && engineImplsArr.get());
+        size_t * treeNodes                              = treeNodesArr.get();
+        size_t * nOOBRows                               = nOOBRowsArr.get();
+        engines::internal::BatchBaseImpl ** engineImpls = engineImplsArr.get();
 
-        Collection<TreeLevel> DFTreeRecords;
+        Collection<Collection<TreeLevel> > DFTreeRecords(nTrees);
         Collection<UniversalBuffer> levelNodeLists;    // lists of nodes int props(rowsOffset, rows, ftrId, ftrVal ... )
         Collection<UniversalBuffer> levelNodeImpLists; // list of nodes fptype props (impurity, mean)
-        UniversalBuffer oobRows;
+        Collection<UniversalBuffer> treeNodeLists;     // the nodes of the trees taken from the lists of the levels
+        Collection<UniversalBuffer> oobRows(nTrees);
+        DAAL_CHECK_MALLOC(DFTreeRecords.data() && oobRows.data());
 
-        // no check for overflow required because nNodes = 1, splitProps and impProps are small constants
+        // no check for overflow required because nTrees * nSelectedRows fits int32_t, splitProps and impProps are small constants
         levelNodeLists.push_back(context.allocate(TypeIds::id<int32_t>(), nNodes * TreeLevel::_nNodeSplitProps, &status));
         DAAL_CHECK_STATUS_VAR(status);
-        levelNodeImpLists.push_back(context.allocate(TypeIds::id<algorithmFPType>(), nNodes * (TreeLevel::_nNodeImpProps + _nClasses), &status));
+        levelNodeImpLists.push_back(context.allocate(TypeIds::id<algorithmFPType>(), nNodes * nImpProps, &status));
         DAAL_CHECK_STATUS_VAR(status);
 
         {
-            auto rootNode = levelNodeLists[0].template get<int32_t>().toHost(ReadWriteMode::writeOnly);
-            DAAL_CHECK_MALLOC(rootNode.get());
-            rootNode.get()[0] = 0;             // rows offset
-            rootNode.get()[1] = nSelectedRows; // num of rows
+            auto rootNodes = levelNodeLists[0].template get<int32_t>().toHost(ReadWriteMode::writeOnly);
+            DAAL_CHECK_MALLOC(rootNodes.get());
+            for (size_t tree = 0; tree < nTrees; tree++)
+            {
+                rootNodes.get()[tree * TreeLevel::_nNodeSplitProps + 0] = tree * nSelectedRows; // rows offset
+                rootNodes.get()[tree * TreeLevel::_nNodeSplitProps + 1] = nSelectedRows;        // num of rows
+                treeNodes[tree]                                         = 1;
+            }
         }
 
-        auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(engines[iter].get());
-        if (!engineImpl) return Status(ErrorEngineNotSupported);
-
-        if (par.bootstrap)
+        for (size_t tree = 0; tree < nTrees; tree++)
         {
-            // TODO migrate to gpu generators and gpu sort version
-            DAAL_ITTNOTIFY_SCOPED_TASK(compute.RNG);
-            daal::internal::RNGs<int, sse2> rng;
-            rng.uniform(nSelectedRows, selectedRowsHost.get(), engineImpl->getState(), 0, nRows);
-            daal::algorithms::internal::qSort<int, sse2>(nSelectedRows, selectedRowsHost.get());
+            engineImpls[tree] = dynamic_cast<engines::internal::BatchBaseImpl *>(engines[iter + tree].get());
+            if (!engineImpls[tree]) return Status(ErrorEngineNotSupported);
 
-            context.copy(treeOrderLev, 0, (void *)selectedRowsHost.get(), 0, nSelectedRows, &status);
+            if (par.bootstrap)
+            {
+                DAAL_ITTNOTIFY_SCOPED_TASK(compute.RNG);
+                // The key of the device stream is drawn from the engine of the tree, so the rows follow the seed of the engine
+                // and the engine state advances for the feature sampling as before
+                int keyParts[2];
+                daal::internal::RNGs<int, sse2> rng;
+                rng.uniform(2, keyParts, engineImpls[tree]->getState(), 0, services::internal::MaxVal<int>::get());
+                const DAAL_UINT64 key = (static_cast<DAAL_UINT64>(keyParts[1]) << 31) | static_cast<DAAL_UINT64>(keyParts[0]);
+
+                DAAL_CHECK_STATUS_VAR(RngGpu::uniform(treeRows, nSelectedRows, 0, nRows, key));
+            }
+
+            context.copy(treeOrderLev, tree * nSelectedRows, treeRows, 0, nSelectedRows, &status);
             DAAL_CHECK_STATUS_VAR(status);
+
+            nOOBRows[tree] = 0;
+            if (oobRequired)
+            {
+                // nOOBRows and oobRows are the output
+                DAAL_CHECK_STATUS_VAR(_treeLevelBuildHelper.getOOBRows(treeRows, nSelectedRows, nOOBRows[tree], oobRows[tree]));
+            }
         }
 
-        if (oobRequired)
+        if (par.bootstrap)
         {
-            _treeLevelBuildHelper.getOOBRows(treeOrderLev, nSelectedRows, nOOBRows, oobRows); // nOOBRows and oobRows are the output
+            // The out-of-bag rows do not depend on the order, so the rows of the trees are sorted after they are taken
+            DAAL_ITTNOTIFY_SCOPED_TASK(compute.sortBootstrapRows);
+            DAAL_CHECK_STATUS_VAR(
+                sort::RadixSort::sortSegments(treeOrderLev, bootstrapValues, treeOrderLevBuf, bootstrapValuesBuf, bootstrapOffsets, nTrees));
         }
 
         for (size_t level = 0; nNodes > 0; level++)
@@ -832,11 +1076,16 @@ services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::co
 
             if (nSelectedFeatures != nFeatures)
             {
+                // the features of the nodes of a tree are generated by its engine
                 daal::internal::RNGs<int, sse2> rng;
-                for (size_t node = 0; node < nNodes; node++)
+                for (size_t tree = 0, node = 0; tree < nTrees; tree++)
                 {
-                    rng.uniformWithoutReplacement(nSelectedFeatures, selectedFeaturesHost.get() + node * nSelectedFeatures,
-                                                  selectedFeaturesHost.get() + (node + 1) * nSelectedFeatures, engineImpl->getState(), 0, nFeatures);
+                    for (size_t i = 0; i < treeNodes[tree]; i++, node++)
+                    {
+                        rng.uniformWithoutReplacement(nSelectedFeatures, selectedFeaturesHost.get() + node * nSelectedFeatures,
+                                                      selectedFeaturesHost.get() + (node + 1) * nSelectedFeatures, engineImpls[tree]->getState(), 0,
+                                                      nFeatures);
+                    }
                 }
             }
             else
@@ -863,18 +1112,31 @@ services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::co
                                                    responseBlock.getBuffer(), nodeList, indexedFeatures.binOffsets(), impList, nodeImpDecreaseList,
                                                    mdiRequired, nFeatures, nNodes, par.minObservationsInLeafNode, par.impurityThreshold));
 
-            if (par.maxTreeDepth > 0 && par.maxTreeDepth == level)
+            const bool isLastLevel = (par.maxTreeDepth > 0 && par.maxTreeDepth == level);
+            if (isLastLevel)
             {
                 DAAL_CHECK_STATUS_VAR(_treeLevelBuildHelper.convertSplitToLeaf(nodeList, nNodes));
+            }
+
+            for (size_t tree = 0, iNode = 0; tree < nTrees; iNode += treeNodes[tree], tree++)
+            {
+                if (!treeNodes[tree]) continue;
+
+                UniversalBuffer treeNodeList;
+                UniversalBuffer treeImpList;
+                DAAL_CHECK_STATUS_VAR(_treeLevelBuildHelper.template getTreeNodes<int32_t>(nodeList, iNode, treeNodes[tree],
+                                                                                           TreeLevel::_nNodeSplitProps, treeNodeList));
+                DAAL_CHECK_STATUS_VAR(
+                    _treeLevelBuildHelper.template getTreeNodes<algorithmFPType>(impList, iNode, treeNodes[tree], nImpProps, treeImpList));
+                treeNodeLists.push_back(treeNodeList);
+                treeNodeLists.push_back(treeImpList);
+
                 TreeLevel levelRecord;
-                DAAL_CHECK_STATUS_VAR(levelRecord.init(nodeList, impList, nNodes, _nClasses));
-                DFTreeRecords.push_back(levelRecord);
-                break;
+                DAAL_CHECK_STATUS_VAR(levelRecord.init(treeNodeList, treeImpList, treeNodes[tree], _nClasses));
+                DFTreeRecords[tree].push_back(levelRecord);
             }
 
-            TreeLevel levelRecord;
-            DAAL_CHECK_STATUS_VAR(levelRecord.init(nodeList, impList, nNodes, _nClasses));
-            DFTreeRecords.push_back(levelRecord);
+            if (isLastLevel) break;
 
             if (mdiRequired)
             {
@@ -884,19 +1146,20 @@ services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::co
             }
 
             size_t nNodesNewLevel;
-            DAAL_CHECK_STATUS_VAR(_treeLevelBuildHelper.getNumOfSplitNodes(nodeList, nNodes, nNodesNewLevel));
+            DAAL_CHECK_STATUS_VAR(
+                _treeLevelBuildHelper.getNumOfSplitNodesOfTrees(nodeList, nTrees, TreeLevel::_nNodeSplitProps, treeNodes, nNodesNewLevel));
 
             if (nNodesNewLevel)
             {
                 /*there are split nodes -> next level is required*/
                 nNodesNewLevel *= 2;
+                for (size_t tree = 0; tree < nTrees; tree++) treeNodes[tree] *= 2;
 
                 DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodesNewLevel, TreeLevel::_nNodeSplitProps);
-                DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodesNewLevel, (TreeLevel::_nNodeImpProps + _nClasses));
+                DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodesNewLevel, nImpProps);
                 auto nodeListNewLevel = context.allocate(TypeIds::id<int32_t>(), nNodesNewLevel * TreeLevel::_nNodeSplitProps, &status);
                 DAAL_CHECK_STATUS_VAR(status);
-                auto impListNewLevel =
-                    context.allocate(TypeIds::id<algorithmFPType>(), nNodesNewLevel * (TreeLevel::_nNodeImpProps + _nClasses), &status);
+                auto impListNewLevel = context.allocate(TypeIds::id<algorithmFPType>(), nNodesNewLevel * nImpProps, &status);
                 DAAL_CHECK_STATUS_VAR(status);
 
                 DAAL_CHECK_STATUS_VAR(_treeLevelBuildHelper.doNodesSplit(nodeList, nNodes, nodeListNewLevel));
@@ -905,34 +1168,25 @@ services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::co
                 levelNodeImpLists.push_back(impListNewLevel);
 
                 DAAL_CHECK_STATUS_VAR(_treeLevelBuildHelper.doLevelPartition(indexedFeatures.getFullData(), nodeList, nNodes, treeOrderLev,
-                                                                             treeOrderLevBuf, nSelectedRows, nFeatures));
+                                                                             treeOrderLevBuf, nTrees * nSelectedRows, nFeatures));
             }
 
             nNodes = nNodesNewLevel;
         } // for level
 
-        services::Collection<SharedPtr<algorithmFPType> > binValuesHost(nFeatures);
-        DAAL_CHECK_MALLOC(binValuesHost.data());
-        services::Collection<algorithmFPType *> binValues(nFeatures);
-        DAAL_CHECK_MALLOC(binValues.data());
-
-        for (size_t i = 0; i < nFeatures; i++)
+        for (size_t tree = 0; tree < nTrees; tree++)
         {
-            binValuesHost[i] = indexedFeatures.binBorders(i).template get<algorithmFPType>().toHost(ReadWriteMode::readOnly);
-            DAAL_CHECK_MALLOC(binValuesHost[i].get());
-            binValues[i] = binValuesHost[i].get();
-        }
-
-        typename DFTreeConverterType::TreeHelperType mTreeHelper;
+            typename DFTreeConverterType::TreeHelperType mTreeHelper;
 
-        DFTreeConverterType converter;
-        DAAL_CHECK_STATUS_VAR(converter.convertToDFDecisionTree(DFTreeRecords, binValues.data(), mTreeHelper, _nClasses));
+            DFTreeConverterType converter;
+            DAAL_CHECK_STATUS_VAR(converter.convertToDFDecisionTree(DFTreeRecords[tree], binValues.data(), mTreeHelper, _nClasses));
 
-        mdImpl.add(mTreeHelper._tree, _nClasses);
+            mdImpl.add(mTreeHelper._tree, _nClasses);
 
-        DAAL_CHECK_STATUS_VAR(computeResults(mTreeHelper._tree, dataBlock.getBlockPtr(), responseBlock.getBlockPtr(), nSelectedRows, nFeatures,
-                                             oobRows, nOOBRows, oobBufferPerObs, varImpBlock.getBlockPtr(), varImpVariance.get(), iter + 1,
-                                             engines[iter], par));
+            DAAL_CHECK_STATUS_VAR(computeResults(mTreeHelper._tree, dataBlock.getBlockPtr(), responseBlock.getBlockPtr(), nSelectedRows, nFeatures,
+                                                 oobRows[tree], nOOBRows[tree], oobBufferPerObs, varImpBlock.getBlockPtr(), varImpVariance.get(),
+                                                 iter + tree + 1, engines[iter + tree], par));
+        }
 
         DAAL_CHECK_STATUS_VAR(const_cast<NumericTable *>(y)->releaseBlockOfRows(responseBlock));
     }
@@ -532,7 +532,7 @@ protected:
     void featureValuesToBuf(size_t iFeature, algorithmFPType * featureVal, IndexType * aIdx, size_t n)
     {
         _helper.getColumnValues(iFeature, aIdx, n, featureVal);
-        daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, featureVal, aIdx);
+        daal::algorithms::internal::parallelSortByKey<algorithmFPType, int, cpu>(n, featureVal, aIdx);
     }
 
     //find features to check in the current split node
@@ -0,0 +1,72 @@
+/* file: df_train_hist_communicator.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the collective operations of the decision forest training
+//  by the hist method on the data split by rows between the processes.
+//--
+*/
+
+#ifndef __DF_TRAIN_HIST_COMMUNICATOR_H__
+#define __DF_TRAIN_HIST_COMMUNICATOR_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Collective operations of the processes that train one forest on their rows.
+ * Every process calls them in the same order. The default implementation is
+ * the one of the single process that has all the rows.
+ */
+class HistCommunicator
+{
+public:
+    virtual ~HistCommunicator() {}
+
+    virtual size_t getRankCount() const { return 1; }
+    virtual size_t getRank() const { return 0; }
+
+    /* Replaces the values by their sums over the processes */
+    virtual void allreduce(double * values, size_t n) const {}
+
+    /* Puts the n values of every process into recv in the order of the ranks */
+    virtual void allgather(const double * send, size_t n, double * recv) const
+    {
+        for (size_t i = 0; i < n; ++i) recv[i] = send[i];
+    }
+
+    /* Replaces the values by the ones of the process with rank 0 */
+    virtual void bcast(double * values, size_t n) const {}
+};
+
+} // namespace internal
+} // namespace training
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,873 @@
+/* file: df_train_hist_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for decision forest train algorithms
+//  (hist) method on CPU. The trees are grown level by level from the binned
+//  features, so the rows can be split between several processes.
+//--
+*/
+
+#ifndef __DF_TRAIN_HIST_IMPL_I__
+#define __DF_TRAIN_HIST_IMPL_I__
+
+#include "src/algorithms/dtrees/forest/df_train_dense_default_impl.i"
+#include "src/algorithms/dtrees/forest/df_train_hist_communicator.h"
+#include "src/algorithms/service_sort.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_rng.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace training
+{
+namespace internal
+{
+/* The histograms of the nodes of a level are summed over the processes by
+ * blocks of nodes of at most this many values */
+const size_t histMaxBlockSize = 1 << 23;
+
+/* The rows of the nodes are processed by the chunks of at least this many
+ * rows, the smaller nodes are processed by one task */
+const size_t histMinChunkSize = 1 << 10;
+
+/* The number of the histogram values one task of the reduction of the
+ * per-chunk histograms sums */
+const size_t histReduceBlockSize = 1 << 12;
+
+/* The number of the bootstrap indices drawn at once */
+const size_t histBootstrapBlockSize = 1 << 16;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Bins of the feature values. Every process samples maxBins order statistics
+// of its column, the borders are the weighted quantiles of the samples of all
+// the processes, so they are the same on every process. The value falls into
+// the bin of the first border not less than it, the values above the last
+// border fall into the last bin.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class HistFeatureBins
+{
+public:
+    typedef uint32_t BinType;
+
+    HistFeatureBins() : _nRows(0), _nFeatures(0), _maxBins(0), _nTotalRows(0), _rowOffset(0) {}
+
+    services::Status init(const NumericTable & x, size_t maxBins, size_t minBinSize, const HistCommunicator & comm);
+
+    size_t getNumberOfBins(size_t iFeature) const { return _nBorders[iFeature] + 1; }
+    size_t getMaxNumberOfBins() const { return _maxBins; }
+    algorithmFPType getBorder(size_t iFeature, size_t iBin) const { return _borders[iFeature * _maxBins + iBin]; }
+    const BinType * getBins(size_t iFeature) const { return _bins.get() + iFeature * _nRows; }
+
+    /* The number of the rows of all the processes and the index of the first local row among them */
+    size_t getTotalNumberOfRows() const { return _nTotalRows; }
+    size_t getRowOffset() const { return _rowOffset; }
+
+private:
+    services::Status computeBorders(const NumericTable & x, size_t minBinSize, const double * rowCounts, const HistCommunicator & comm);
+    services::Status computeBins(const NumericTable & x);
+
+    size_t _nRows;
+    size_t _nFeatures;
+    size_t _maxBins;
+    size_t _nTotalRows;
+    size_t _rowOffset;
+    TArray<algorithmFPType, cpu> _borders; //at most maxBins - 1 borders of every feature
+    TArray<size_t, cpu> _nBorders;
+    TArray<BinType, cpu> _bins; //bins of the local rows, column by column
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status HistFeatureBins<algorithmFPType, cpu>::init(const NumericTable & x, size_t maxBins, size_t minBinSize,
+                                                              const HistCommunicator & comm)
+{
+    _nRows     = x.getNumberOfRows();
+    _nFeatures = x.getNumberOfColumns();
+    _maxBins   = (maxBins < 2 ? 2 : maxBins);
+
+    const size_t nRanks = comm.getRankCount();
+    TArray<double, cpu> rowCounts(nRanks);
+    DAAL_CHECK_MALLOC(rowCounts.get());
+    const double nRows = double(_nRows);
+    comm.allgather(&nRows, 1, rowCounts.get());
+
+    _nTotalRows = 0;
+    _rowOffset  = 0;
+    for (size_t r = 0; r < nRanks; ++r)
+    {
+        if (r < comm.getRank()) _rowOffset += size_t(rowCounts[r]);
+        _nTotalRows += size_t(rowCounts[r]);
+    }
+
+    services::Status s = computeBorders(x, minBinSize, rowCounts.get(), comm);
+    DAAL_CHECK_STATUS_VAR(s);
+    return computeBins(x);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status HistFeatureBins<algorithmFPType, cpu>::computeBorders(const NumericTable & x, size_t minBinSize, const double * rowCounts,
+                                                                        const HistCommunicator & comm)
+{
+    const size_t nRanks = comm.getRankCount();
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nFeatures, _maxBins);
+    const size_t sketchSize = _nFeatures * _maxBins;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, sketchSize, nRanks);
+
+    TArrayCalloc<double, cpu> sketch(sketchSize);
+    TArray<double, cpu> sketches(sketchSize * nRanks);
+    TArray<size_t, cpu> heads(_nFeatures * nRanks);
+    _borders.reset(sketchSize);
+    _nBorders.reset(_nFeatures);
+    DAAL_CHECK_MALLOC(sketch.get() && sketches.get() && heads.get() && _borders.get() && _nBorders.get());
+
+    daal::SafeStatus safeStat;
+    if (_nRows)
+    {
+        daal::tls<algorithmFPType *> tlsColumn([=]() -> algorithmFPType * { return service_scalable_malloc<algorithmFPType, cpu>(_nRows); });
+        daal::threader_for(_nFeatures, _nFeatures, [&](size_t j) {
+            algorithmFPType * column = tlsColumn.local();
+            DAAL_CHECK_MALLOC_THR(column);
+            ReadColumns<algorithmFPType, cpu> colBD(const_cast<NumericTable *>(&x), j, 0, _nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(colBD);
+            const algorithmFPType * values = colBD.get();
+            for (size_t i = 0; i < _nRows; ++i) column[i] = values[i];
+            daal::algorithms::internal::qSort<algorithmFPType, cpu>(_nRows, column);
+
+            double * featureSketch = sketch.get() + j * _maxBins;
+            for (size_t k = 0; k < _maxBins; ++k) featureSketch[k] = column[(2 * k + 1) * _nRows / (2 * _maxBins)];
+        });
+        tlsColumn.reduce([](algorithmFPType * column) -> void { service_scalable_free<algorithmFPType, cpu>(column); });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+    comm.allgather(sketch.get(), sketchSize, sketches.get());
+
+    //the sketches are sorted, they are merged by taking the least of their heads,
+    //the sample of a process stands for rowCount / maxBins of its rows
+    daal::threader_for(_nFeatures, _nFeatures, [&](size_t j) {
+        size_t * head = heads.get() + j * nRanks;
+        for (size_t r = 0; r < nRanks; ++r) head[r] = (rowCounts[r] > 0 ? 0 : _maxBins);
+        const auto getSample = [&](size_t r) -> double { return sketches[(r * _nFeatures + j) * _maxBins + head[r]]; };
+
+        algorithmFPType * borders = _borders.get() + j * _maxBins;
+        size_t nBorders           = 0;
+        size_t iQuantile          = 1;
+        double rankWeight         = 0.;
+        double binWeight          = 0.;
+        for (;;)
+        {
+            size_t best = nRanks;
+            for (size_t r = 0; r < nRanks; ++r)
+            {
+                if (head[r] < _maxBins && (best == nRanks || getSample(r) < getSample(best))) best = r;
+            }
+            if (best == nRanks) break;
+
+            const algorithmFPType value = algorithmFPType(getSample(best));
+            const double weight         = rowCounts[best] / double(_maxBins);
+            ++head[best];
+            rankWeight += weight;
+            binWeight += weight;
+
+            bool bQuantile = false;
+            for (; iQuantile < _maxBins && rankWeight * _maxBins >= double(iQuantile) * _nTotalRows; ++iQuantile) bQuantile = true;
+            if (bQuantile && binWeight >= double(minBinSize) && (!nBorders || borders[nBorders - 1] < value))
+            {
+                borders[nBorders++] = value;
+                binWeight           = 0.;
+            }
+        }
+        _nBorders[j] = nBorders;
+    });
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status HistFeatureBins<algorithmFPType, cpu>::computeBins(const NumericTable & x)
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nFeatures, _nRows);
+    _bins.reset(_nFeatures * _nRows);
+    DAAL_CHECK_MALLOC(_bins.get() || !_nRows);
+    if (!_nRows) return services::Status();
+
+    daal::SafeStatus safeStat;
+    daal::threader_for(_nFeatures, _nFeatures, [&](size_t j) {
+        ReadColumns<algorithmFPType, cpu> colBD(const_cast<NumericTable *>(&x), j, 0, _nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(colBD);
+        const algorithmFPType * values  = colBD.get();
+        const algorithmFPType * borders = _borders.get() + j * _maxBins;
+        const size_t nBorders           = _nBorders[j];
+        BinType * bins                  = _bins.get() + j * _nRows;
+        for (size_t i = 0; i < _nRows; ++i)
+        {
+            size_t first = 0;
+            size_t last  = nBorders;
+            while (first < last)
+            {
+                const size_t middle = (first + last) / 2;
+                if (borders[middle] < values[i])
+                    first = middle + 1;
+                else
+                    last = middle;
+            }
+            bins[i] = BinType(first);
+        }
+    });
+    return safeStat.detach();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Grows the trees level by level. The histograms of the nodes of a level are
+// summed over the processes, the splits found by the process with rank 0 are
+// broadcast, so the trees are the same on every process. TaskType defines the
+// statistics of the rows, the first of them is the number of the rows.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+class HistTreeBuilder
+{
+public:
+    typedef HistFeatureBins<algorithmFPType, cpu> FeatureBins;
+    typedef typename FeatureBins::BinType BinType;
+    typedef typename TaskType::TreeType TreeType;
+    typedef typename TreeType::NodeType NodeType;
+
+    HistTreeBuilder(const TaskType & task, const FeatureBins & bins, const algorithmFPType * y, const algorithmFPType * w, size_t nRows,
+                    size_t nFeatures, const Parameter & par, const HistCommunicator & comm)
+        : _task(task),
+          _bins(bins),
+          _y(y),
+          _w(w),
+          _nRows(nRows),
+          _nFeatures(nFeatures),
+          _par(par),
+          _comm(comm),
+          _nStats(task.getNumberOfStats()),
+          _nSelected(par.featuresPerNode ? par.featuresPerNode : task.getDefaultFeaturesPerNode(nFeatures)),
+          _minLeaf(par.minObservationsInLeafNode ? par.minObservationsInLeafNode : 1),
+          _nSampledRows(0),
+          _nNodes(0),
+          _chunkSize(0),
+          _nChunks(0)
+    {
+        if (_nSelected > _nFeatures) _nSelected = _nFeatures;
+    }
+
+    services::Status init();
+    services::Status build(engines::internal::BatchBaseImpl * engineImpl, TreeType & tree, size_t & numElems);
+
+private:
+    struct Node
+    {
+        size_t rowBegin;
+        size_t rowEnd;
+        size_t featureIdx;
+        size_t bin;
+        size_t left; //the right kid follows the left one, 0 for a leaf
+    };
+
+    //range of the rows of the node with the index in the block of nodes,
+    //the chunks of a node follow one another in the order of the rows
+    struct RowChunk
+    {
+        size_t node;
+        size_t rowBegin;
+        size_t rowEnd;
+        size_t partial; //index of the per-chunk histogram, size_t(-1) if the node has one chunk
+    };
+
+    const double * getStats(size_t id) const { return _stats.get() + id * _nStats; }
+    size_t getNodeHistogramSize() const { return _nSelected * _bins.getMaxNumberOfBins() * _nStats; }
+
+    services::Status drawSamples(engines::internal::BatchBaseImpl * engineImpl, size_t & numElems);
+    services::Status addNodes(size_t nNodes);
+    bool canSplit(size_t id, size_t level) const;
+    void chooseFeatures(engines::internal::BatchBaseImpl * engineImpl, int * selected, size_t & numElems);
+    services::Status splitBlock(const size_t * ids, const int * selected, size_t nNodes, size_t * nextLevel, size_t & nNextLevel);
+    services::Status makeRowChunks(const size_t * ids, size_t nNodes);
+    void computeHistograms(const int * selected, size_t nNodes, double * histograms);
+    void findSplit(size_t id, const double * histogram, const int * selected, double * decision, double * buf) const;
+    void partitionRows(const double * decisions, size_t decisionSize, size_t nNodes);
+    typename NodeType::Base * makeNode(TreeType & tree, size_t id) const;
+
+    const TaskType & _task;
+    const FeatureBins & _bins;
+    const algorithmFPType * _y;
+    const algorithmFPType * _w;
+    const size_t _nRows;
+    const size_t _nFeatures;
+    const Parameter & _par;
+    const HistCommunicator & _comm;
+    const size_t _nStats;
+    size_t _nSelected;
+    const size_t _minLeaf;
+
+    TArray<double, cpu> _sampleCounts; //number of times the local row is drawn to the tree
+    TArray<double, cpu> _rowWeights;   //weight of the row multiplied by its number of draws
+    TArray<size_t, cpu> _rows;         //drawn local rows ordered by the nodes
+    TArray<size_t, cpu> _rowBuffer;
+    TArray<int, cpu> _sampleBuf;
+    TArray<int, cpu> _featureBuf;
+    size_t _nSampledRows;
+
+    TArray<Node, cpu> _nodes;
+    TArray<double, cpu> _stats;
+    size_t _nNodes;
+
+    TArray<size_t, cpu> _levelNodes;
+    TArray<size_t, cpu> _splitNodes;
+    TArray<size_t, cpu> _nextLevelNodes;
+    TArray<int, cpu> _selected;
+    TArray<double, cpu> _histograms;
+    TArray<double, cpu> _decisions;
+    TArray<double, cpu> _splitBuf;
+
+    size_t _chunkSize;
+    size_t _nChunks;
+    TArray<RowChunk, cpu> _chunks;
+    TArray<size_t, cpu> _partialOffsets;
+    TArray<double, cpu> _partials;
+    TArray<size_t, cpu> _chunkLeftCounts;
+    TArray<size_t, cpu> _leftPositions;
+    TArray<size_t, cpu> _rightPositions;
+    TArray<size_t, cpu> _leftCounts;
+};
+
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+services::Status HistTreeBuilder<algorithmFPType, TaskType, cpu>::init()
+{
+    _sampleCounts.reset(_nRows);
+    _rowWeights.reset(_nRows);
+    _rows.reset(_nRows);
+    _rowBuffer.reset(_nRows);
+    _sampleBuf.reset(histBootstrapBlockSize);
+    _featureBuf.reset(_nFeatures);
+    _levelNodes.reset(1);
+    DAAL_CHECK_MALLOC((!_nRows || (_sampleCounts.get() && _rowWeights.get() && _rows.get() && _rowBuffer.get())) && _sampleBuf.get()
+                      && _featureBuf.get() && _levelNodes.get());
+    return services::Status();
+}
+
+//reserves the space for nNodes more nodes, the arrays grow twice to keep the cost of the copying linear
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+services::Status HistTreeBuilder<algorithmFPType, TaskType, cpu>::addNodes(size_t nNodes)
+{
+    const size_t nRequired = _nNodes + nNodes;
+    if (nRequired <= _nodes.size()) return services::Status();
+
+    TArray<Node, cpu> nodes(_nNodes);
+    TArray<double, cpu> stats(_nNodes * _nStats);
+    DAAL_CHECK_MALLOC(!_nNodes || (nodes.get() && stats.get()));
+    for (size_t i = 0; i < _nNodes; ++i) nodes[i] = _nodes[i];
+    for (size_t i = 0; i < _nNodes * _nStats; ++i) stats[i] = _stats[i];
+
+    const size_t capacity = (nRequired > 2 * _nodes.size() ? nRequired : 2 * _nodes.size());
+    _nodes.reset(capacity);
+    _stats.reset(capacity * _nStats);
+    DAAL_CHECK_MALLOC(_nodes.get() && _stats.get());
+    for (size_t i = 0; i < _nNodes; ++i) _nodes[i] = nodes[i];
+    for (size_t i = 0; i < _nNodes * _nStats; ++i) _stats[i] = stats[i];
+    return services::Status();
+}
+
+//draws the rows of the tree from all the processes, every process counts
+//the draws of its rows, so the engine is in the same state everywhere
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+services::Status HistTreeBuilder<algorithmFPType, TaskType, cpu>::drawSamples(engines::internal::BatchBaseImpl * engineImpl, size_t & numElems)
+{
+    const size_t nTotalRows = _bins.getTotalNumberOfRows();
+    const size_t rowOffset  = _bins.getRowOffset();
+    const size_t nSamples   = _par.observationsPerTreeFraction * nTotalRows;
+
+    for (size_t i = 0; i < _nRows; ++i) _sampleCounts[i] = 0.;
+    if (_par.bootstrap)
+    {
+        numElems += nSamples;
+        RNGs<int, cpu> rng;
+        for (size_t first = 0; first < nSamples; first += histBootstrapBlockSize)
+        {
+            const size_t n = (nSamples - first < histBootstrapBlockSize ? nSamples - first : histBootstrapBlockSize);
+            DAAL_CHECK(!rng.uniform(n, _sampleBuf.get(), engineImpl->getState(), 0, int(nTotalRows)), ErrorIncorrectErrorcodeFromGenerator);
+            for (size_t i = 0; i < n; ++i)
+            {
+                const size_t row = size_t(_sampleBuf[i]);
+                if (row >= rowOffset && row < rowOffset + _nRows) _sampleCounts[row - rowOffset] += 1.;
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < _nRows && rowOffset + i < nSamples; ++i) _sampleCounts[i] = 1.;
+    }
+
+    _nSampledRows = 0;
+    for (size_t i = 0; i < _nRows; ++i)
+    {
+        if (_sampleCounts[i] > 0.)
+        {
+            _rows[_nSampledRows++] = i;
+            _rowWeights[i]         = _sampleCounts[i] * (_w ? double(_w[i]) : 1.);
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+bool HistTreeBuilder<algorithmFPType, TaskType, cpu>::canSplit(size_t id, size_t level) const
+{
+    const double * stats = getStats(id);
+    return (!_par.maxTreeDepth || level < _par.maxTreeDepth) && stats[0] >= double(_par.minObservationsInSplitNode)
+           && stats[0] >= double(2 * _minLeaf) && _task.getImpurity(stats) > _par.impurityThreshold;
+}
+
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+void HistTreeBuilder<algorithmFPType, TaskType, cpu>::chooseFeatures(engines::internal::BatchBaseImpl * engineImpl, int * selected,
+                                                                     size_t & numElems)
+{
+    if (_nSelected == _nFeatures)
+    {
+        for (size_t i = 0; i < _nFeatures; ++i) selected[i] = int(i);
+    }
+    else
+    {
+        numElems += _nFeatures;
+        RNGs<int, cpu> rng;
+        rng.uniformWithoutReplacement(_nSelected, selected, _featureBuf.get(), engineImpl->getState(), 0, int(_nFeatures));
+    }
+}
+
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+services::Status HistTreeBuilder<algorithmFPType, TaskType, cpu>::build(engines::internal::BatchBaseImpl * engineImpl, TreeType & tree,
+                                                                         size_t & numElems)
+{
+    services::Status s = drawSamples(engineImpl, numElems);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    _nNodes = 0;
+    s       = addNodes(1);
+    DAAL_CHECK_STATUS_VAR(s);
+    _nodes[0] = Node { 0, _nSampledRows, 0, 0, 0 };
+    _nNodes   = 1;
+
+    //the statistics of the root decide the splits, so all the processes take
+    //the ones of the process with rank 0 in spite of the rounding of the sums
+    double * rootStats = _stats.get();
+    for (size_t p = 0; p < _nStats; ++p) rootStats[p] = 0.;
+    for (size_t k = 0; k < _nSampledRows; ++k)
+    {
+        const size_t row = _rows[k];
+        _task.addRow(rootStats, _y[row], _sampleCounts[row], _rowWeights[row]);
+    }
+    _comm.allreduce(rootStats, _nStats);
+    _comm.bcast(rootStats, _nStats);
+
+    _levelNodes[0]          = 0;
+    size_t nLevelNodes      = 1;
+    const size_t blockNodes = (getNodeHistogramSize() < histMaxBlockSize ? histMaxBlockSize / getNodeHistogramSize() : 1);
+    for (size_t level = 0; nLevelNodes; ++level)
+    {
+        if (_splitNodes.size() < nLevelNodes) _splitNodes.reset(nLevelNodes);
+        DAAL_CHECK_MALLOC(_splitNodes.get());
+        size_t nSplitNodes = 0;
+        for (size_t i = 0; i < nLevelNodes; ++i)
+        {
+            if (canSplit(_levelNodes[i], level)) _splitNodes[nSplitNodes++] = _levelNodes[i];
+        }
+        if (!nSplitNodes) break;
+
+        if (_selected.size() < nSplitNodes * _nSelected) _selected.reset(nSplitNodes * _nSelected);
+        if (_nextLevelNodes.size() < 2 * nSplitNodes) _nextLevelNodes.reset(2 * nSplitNodes);
+        DAAL_CHECK_MALLOC(_selected.get() && _nextLevelNodes.get());
+        for (size_t i = 0; i < nSplitNodes; ++i) chooseFeatures(engineImpl, _selected.get() + i * _nSelected, numElems);
+
+        size_t nNextLevelNodes = 0;
+        for (size_t first = 0; first < nSplitNodes; first += blockNodes)
+        {
+            const size_t nBlockNodes = (nSplitNodes - first < blockNodes ? nSplitNodes - first : blockNodes);
+            s = splitBlock(_splitNodes.get() + first, _selected.get() + first * _nSelected, nBlockNodes, _nextLevelNodes.get(), nNextLevelNodes);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        if (_levelNodes.size() < nNextLevelNodes) _levelNodes.reset(nNextLevelNodes);
+        DAAL_CHECK_MALLOC(_levelNodes.get());
+        for (size_t i = 0; i < nNextLevelNodes; ++i) _levelNodes[i] = _nextLevelNodes[i];
+        nLevelNodes = nNextLevelNodes;
+    }
+
+    tree.reset(makeNode(tree, 0), false);
+    return s;
+}
+
+//splits the rows of the block of nodes into the chunks of about the same size,
+//one per thread for the large nodes of the first levels
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+services::Status HistTreeBuilder<algorithmFPType, TaskType, cpu>::makeRowChunks(const size_t * ids, size_t nNodes)
+{
+    size_t nBlockRows = 0;
+    for (size_t i = 0; i < nNodes; ++i) nBlockRows += _nodes[ids[i]].rowEnd - _nodes[ids[i]].rowBegin;
+    const size_t nThreads = threader_get_max_threads_number();
+    _chunkSize            = (nBlockRows + nThreads - 1) / nThreads;
+    if (_chunkSize < histMinChunkSize) _chunkSize = histMinChunkSize;
+
+    size_t nChunks = 0;
+    for (size_t i = 0; i < nNodes; ++i)
+    {
+        const size_t nNodeRows = _nodes[ids[i]].rowEnd - _nodes[ids[i]].rowBegin;
+        nChunks += (nNodeRows ? (nNodeRows + _chunkSize - 1) / _chunkSize : 0);
+    }
+    if (_chunks.size() < nChunks) _chunks.reset(nChunks);
+    if (_chunkLeftCounts.size() < nChunks) _chunkLeftCounts.reset(nChunks);
+    if (_leftPositions.size() < nChunks) _leftPositions.reset(nChunks);
+    if (_rightPositions.size() < nChunks) _rightPositions.reset(nChunks);
+    if (_partialOffsets.size() < nNodes + 1) _partialOffsets.reset(nNodes + 1);
+    if (_leftCounts.size() < nNodes) _leftCounts.reset(nNodes);
+    DAAL_CHECK_MALLOC((!nChunks || (_chunks.get() && _chunkLeftCounts.get() && _leftPositions.get() && _rightPositions.get()))
+                      && _partialOffsets.get() && _leftCounts.get());
+
+    _nChunks           = 0;
+    size_t nPartials   = 0;
+    _partialOffsets[0] = 0;
+    for (size_t i = 0; i < nNodes; ++i)
+    {
+        const Node & node   = _nodes[ids[i]];
+        const bool bOneTask = (node.rowEnd - node.rowBegin <= _chunkSize);
+        for (size_t begin = node.rowBegin; begin < node.rowEnd; begin += _chunkSize)
+        {
+            RowChunk & chunk = _chunks[_nChunks++];
+            chunk.node       = i;
+            chunk.rowBegin   = begin;
+            chunk.rowEnd     = (node.rowEnd - begin < _chunkSize ? node.rowEnd : begin + _chunkSize);
+            chunk.partial    = (bOneTask ? size_t(-1) : nPartials++);
+        }
+        _partialOffsets[i + 1] = nPartials;
+    }
+
+    const size_t nodeHistogramSize = getNodeHistogramSize();
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nPartials, nodeHistogramSize);
+    if (_partials.size() < nPartials * nodeHistogramSize) _partials.reset(nPartials * nodeHistogramSize);
+    DAAL_CHECK_MALLOC(!nPartials || _partials.get());
+    return services::Status();
+}
+
+//accumulates the local histograms of the block of nodes, the chunks of the
+//nodes with several chunks fill the per-chunk histograms, which are summed
+//into the histograms of their nodes
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+void HistTreeBuilder<algorithmFPType, TaskType, cpu>::computeHistograms(const int * selected, size_t nNodes, double * histograms)
+{
+    const size_t nodeHistogramSize = getNodeHistogramSize();
+    const size_t featureStride     = _bins.getMaxNumberOfBins() * _nStats;
+    const size_t nPartials         = _partialOffsets[nNodes];
+    for (size_t i = 0; i < nPartials * nodeHistogramSize; ++i) _partials[i] = 0.;
+
+    daal::threader_for(_nChunks, _nChunks, [&](size_t c) {
+        const RowChunk & chunk   = _chunks[c];
+        double * histogram       = (chunk.partial == size_t(-1) ? histograms + chunk.node * nodeHistogramSize :
+                                                                   _partials.get() + chunk.partial * nodeHistogramSize);
+        const int * nodeSelected = selected + chunk.node * _nSelected;
+        for (size_t f = 0; f < _nSelected; ++f)
+        {
+            const BinType * featureBins = _bins.getBins(nodeSelected[f]);
+            double * featureHistogram   = histogram + f * featureStride;
+            for (size_t k = chunk.rowBegin; k < chunk.rowEnd; ++k)
+            {
+                const size_t row = _rows[k];
+                _task.addRow(featureHistogram + featureBins[row] * _nStats, _y[row], _sampleCounts[row], _rowWeights[row]);
+            }
+        }
+    });
+    if (!nPartials) return;
+
+    const size_t nReduceBlocks = (nodeHistogramSize + histReduceBlockSize - 1) / histReduceBlockSize;
+    daal::threader_for(nNodes * nReduceBlocks, nNodes * nReduceBlocks, [&](size_t t) {
+        const size_t i = t / nReduceBlocks;
+        if (_partialOffsets[i + 1] == _partialOffsets[i]) return;
+        const size_t first = (t % nReduceBlocks) * histReduceBlockSize;
+        const size_t last  = (nodeHistogramSize - first < histReduceBlockSize ? nodeHistogramSize : first + histReduceBlockSize);
+        double * histogram = histograms + i * nodeHistogramSize;
+        for (size_t p = _partialOffsets[i]; p < _partialOffsets[i + 1]; ++p)
+        {
+            const double * partial = _partials.get() + p * nodeHistogramSize;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t e = first; e < last; ++e) histogram[e] += partial[e];
+        }
+    });
+}
+
+//finds the best split of the node by the histogram summed over the processes,
+//the decision is the feature, the bin and the statistics of the left kid
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+void HistTreeBuilder<algorithmFPType, TaskType, cpu>::findSplit(size_t id, const double * histogram, const int * selected, double * decision,
+                                                                double * buf) const
+{
+    const double * stats = getStats(id);
+    const double weight  = _task.getWeight(stats);
+    if (!(weight > 0.)) return;
+    const double impurity      = _task.getImpurity(stats);
+    const size_t featureStride = _bins.getMaxNumberOfBins() * _nStats;
+
+    double * left       = buf;
+    double * right      = buf + _nStats;
+    double bestDecrease = 0.;
+    for (size_t f = 0; f < _nSelected; ++f)
+    {
+        const size_t iFeature = size_t(selected[f]);
+        const size_t nBins    = _bins.getNumberOfBins(iFeature);
+        for (size_t p = 0; p < _nStats; ++p) left[p] = 0.;
+        for (size_t bin = 0; bin + 1 < nBins; ++bin)
+        {
+            const double * binStats = histogram + f * featureStride + bin * _nStats;
+            for (size_t p = 0; p < _nStats; ++p)
+            {
+                left[p] += binStats[p];
+                right[p] = stats[p] - left[p];
+            }
+            if (left[0] < double(_minLeaf)) continue;
+            if (right[0] < double(_minLeaf)) break;
+
+            const double leftWeight  = _task.getWeight(left);
+            const double rightWeight = weight - leftWeight;
+            const double decrease = impurity - (leftWeight * _task.getImpurity(left) + rightWeight * _task.getImpurity(right)) / weight;
+            if (decrease > bestDecrease && decrease >= _par.minImpurityDecreaseInSplitNode)
+            {
+                bestDecrease = decrease;
+                decision[0]  = double(iFeature);
+                decision[1]  = double(bin);
+                for (size_t p = 0; p < _nStats; ++p) decision[2 + p] = left[p];
+            }
+        }
+    }
+}
+
+//partitions the local rows of the split nodes of the block stably, the rows of
+//the left kid come first. Every chunk counts its left rows, then scatters its
+//rows to the positions given by the counts of the preceding chunks of its node.
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+void HistTreeBuilder<algorithmFPType, TaskType, cpu>::partitionRows(const double * decisions, size_t decisionSize, size_t nNodes)
+{
+    daal::threader_for(_nChunks, _nChunks, [&](size_t c) {
+        const RowChunk & chunk  = _chunks[c];
+        const double * decision = decisions + chunk.node * decisionSize;
+        _chunkLeftCounts[c]     = 0;
+        if (decision[0] < 0.) return;
+        const BinType * featureBins = _bins.getBins(size_t(decision[0]));
+        const BinType bin           = BinType(decision[1]);
+        size_t nLeft                = 0;
+        for (size_t k = chunk.rowBegin; k < chunk.rowEnd; ++k) nLeft += (featureBins[_rows[k]] <= bin);
+        _chunkLeftCounts[c] = nLeft;
+    });
+
+    for (size_t i = 0; i < nNodes; ++i) _leftCounts[i] = 0;
+    for (size_t c = 0; c < _nChunks; ++c) _leftCounts[_chunks[c].node] += _chunkLeftCounts[c];
+    for (size_t c = 0; c < _nChunks; ++c)
+    {
+        const RowChunk & chunk = _chunks[c];
+        const bool bFirst      = (!c || _chunks[c - 1].node != chunk.node);
+        _leftPositions[c]      = (bFirst ? chunk.rowBegin : _leftPositions[c - 1] + _chunkLeftCounts[c - 1]);
+        _rightPositions[c]     = (bFirst ? chunk.rowBegin + _leftCounts[chunk.node] :
+                                           _rightPositions[c - 1] + (_chunks[c - 1].rowEnd - _chunks[c - 1].rowBegin - _chunkLeftCounts[c - 1]));
+    }
+
+    daal::threader_for(_nChunks, _nChunks, [&](size_t c) {
+        const RowChunk & chunk  = _chunks[c];
+        const double * decision = decisions + chunk.node * decisionSize;
+        if (decision[0] < 0.) return;
+        const BinType * featureBins = _bins.getBins(size_t(decision[0]));
+        const BinType bin           = BinType(decision[1]);
+        size_t leftPosition         = _leftPositions[c];
+        size_t rightPosition        = _rightPositions[c];
+        for (size_t k = chunk.rowBegin; k < chunk.rowEnd; ++k)
+        {
+            const size_t row = _rows[k];
+            if (featureBins[row] <= bin)
+                _rowBuffer[leftPosition++] = row;
+            else
+                _rowBuffer[rightPosition++] = row;
+        }
+    });
+
+    daal::threader_for(_nChunks, _nChunks, [&](size_t c) {
+        const RowChunk & chunk = _chunks[c];
+        if (decisions[chunk.node * decisionSize] < 0.) return;
+        for (size_t k = chunk.rowBegin; k < chunk.rowEnd; ++k) _rows[k] = _rowBuffer[k];
+    });
+}
+
+//finds the splits of the block of nodes by the histograms summed over the
+//processes, partitions the local rows of the split nodes and adds their kids
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+services::Status HistTreeBuilder<algorithmFPType, TaskType, cpu>::splitBlock(const size_t * ids, const int * selected, size_t nNodes,
+                                                                              size_t * nextLevel, size_t & nNextLevel)
+{
+    const size_t nodeHistogramSize = getNodeHistogramSize();
+    const size_t decisionSize      = 2 + _nStats;
+    if (_histograms.size() < nNodes * nodeHistogramSize) _histograms.reset(nNodes * nodeHistogramSize);
+    if (_decisions.size() < nNodes * decisionSize) _decisions.reset(nNodes * decisionSize);
+    if (_splitBuf.size() < nNodes * 2 * _nStats) _splitBuf.reset(nNodes * 2 * _nStats);
+    DAAL_CHECK_MALLOC(_histograms.get() && _decisions.get() && _splitBuf.get());
+
+    services::Status s = makeRowChunks(ids, nNodes);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    double * histograms = _histograms.get();
+    double * decisions  = _decisions.get();
+    for (size_t i = 0; i < nNodes * nodeHistogramSize; ++i) histograms[i] = 0.;
+    for (size_t i = 0; i < nNodes * decisionSize; ++i) decisions[i] = -1.;
+
+    computeHistograms(selected, nNodes, histograms);
+    _comm.allreduce(histograms, nNodes * nodeHistogramSize);
+
+    daal::threader_for(nNodes, nNodes, [&](size_t i) {
+        findSplit(ids[i], histograms + i * nodeHistogramSize, selected + i * _nSelected, decisions + i * decisionSize,
+                  _splitBuf.get() + i * 2 * _nStats);
+    });
+    _comm.bcast(decisions, nNodes * decisionSize);
+
+    partitionRows(decisions, decisionSize, nNodes);
+
+    for (size_t i = 0; i < nNodes; ++i)
+    {
+        const double * decision = decisions + i * decisionSize;
+        if (decision[0] < 0.) continue;
+
+        s = addNodes(2);
+        DAAL_CHECK_STATUS_VAR(s);
+        const size_t id   = ids[i];
+        const size_t left = _nNodes;
+        Node & node       = _nodes[id];
+        node.featureIdx   = size_t(decision[0]);
+        node.bin          = size_t(decision[1]);
+        node.left         = left;
+        _nodes[left]      = Node { node.rowBegin, node.rowBegin + _leftCounts[i], 0, 0, 0 };
+        _nodes[left + 1]  = Node { node.rowBegin + _leftCounts[i], node.rowEnd, 0, 0, 0 };
+        _nNodes += 2;
+
+        const double * parentStats = getStats(id);
+        double * leftStats         = _stats.get() + left * _nStats;
+        double * rightStats        = leftStats + _nStats;
+        for (size_t p = 0; p < _nStats; ++p)
+        {
+            leftStats[p]  = decision[2 + p];
+            rightStats[p] = parentStats[p] - decision[2 + p];
+        }
+        nextLevel[nNextLevel++] = left;
+        nextLevel[nNextLevel++] = left + 1;
+    }
+    return s;
+}
+
+template <typename algorithmFPType, typename TaskType, CpuType cpu>
+typename HistTreeBuilder<algorithmFPType, TaskType, cpu>::NodeType::Base * HistTreeBuilder<algorithmFPType, TaskType, cpu>::makeNode(
+    TreeType & tree, size_t id) const
+{
+    const Node & node             = _nodes[id];
+    const double * stats          = getStats(id);
+    typename NodeType::Base * res = nullptr;
+    if (!node.left)
+    {
+        res = _task.makeLeaf(tree, stats);
+    }
+    else
+    {
+        typename NodeType::Split * split = tree.allocator().allocSplit();
+        split->set(int(node.featureIdx), _bins.getBorder(node.featureIdx, node.bin), false);
+        split->kid[0] = makeNode(tree, node.left);
+        split->kid[1] = makeNode(tree, node.left + 1);
+        res           = split;
+    }
+    res->count    = size_t(stats[0]);
+    res->impurity = _task.getImpurity(stats);
+    return res;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// compute() implementation. The trees are built one after another, the rows
+// and the nodes of every level are processed in parallel.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu, typename ModelType, typename TaskType>
+services::Status computeHistImpl(const NumericTable * x, const NumericTable * y, const NumericTable * w, ModelType & md, const Parameter & par,
+                                 const TaskType & task, const HistCommunicator & comm, engines::EnginePtr & updatedEngine)
+{
+    if (par.resultsToCompute || par.varImportance != decision_forest::training::none || par.maxLeafNodes || par.minWeightFractionInLeafNode > 0.)
+    {
+        return services::Status(ErrorMethodNotImplemented);
+    }
+
+    const size_t nRows     = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    ReadRows<algorithmFPType, cpu> yBD(const_cast<NumericTable *>(y), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yBD);
+    ReadRows<algorithmFPType, cpu> wBD(const_cast<NumericTable *>(w), 0, nRows);
+    if (w) DAAL_CHECK_BLOCK_STATUS(wBD);
+
+    //the responses are checked by all the processes, so none of them is left
+    //waiting in a collective operation
+    double nInvalidResponses = 0.;
+    for (size_t i = 0; i < nRows; ++i) nInvalidResponses += !task.checkResponse(yBD.get()[i]);
+    comm.allreduce(&nInvalidResponses, 1);
+    if (nInvalidResponses > 0.) return services::Status(ErrorIncorrectClassLabels);
+
+    HistFeatureBins<algorithmFPType, cpu> bins;
+    services::Status s = bins.init(*x, par.maxBins, par.minBinSize, comm);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    DAAL_CHECK(md.resize(par.nTrees), ErrorMemoryAllocationFailed);
+    HistTreeBuilder<algorithmFPType, TaskType, cpu> builder(task, bins, yBD.get(), wBD.get(), nRows, nFeatures, par, comm);
+    s = builder.init();
+    DAAL_CHECK_STATUS_VAR(s);
+
+    engines::internal::ParallelizationTechnique technique = engines::internal::family;
+    selectParallelizationTechnique<cpu>(par, technique);
+    engines::internal::Params<cpu> params(par.nTrees);
+    for (size_t i = 0; i < par.nTrees; i++)
+    {
+        params.nSkip[i] = i * par.nTrees * bins.getTotalNumberOfRows() * (par.featuresPerNode + 1);
+    }
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, par.nTrees, sizeof(engines::EnginePtr));
+    TArray<engines::EnginePtr, cpu> engines(par.nTrees);
+    engines::internal::EnginesCollection<cpu> enginesCollection(par.engine, technique, params, engines, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    TArray<size_t, cpu> numElems(par.nTrees);
+    DAAL_CHECK_MALLOC(numElems.get());
+    for (size_t i = 0; i < par.nTrees; ++i)
+    {
+        numElems[i]     = 0;
+        auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(engines[i].get());
+        DAAL_CHECK(engineImpl, ErrorEngineNotSupported);
+
+        typename ModelType::TreeType tree;
+        s = builder.build(engineImpl, tree, numElems[i]);
+        DAAL_CHECK_STATUS_VAR(s);
+        DAAL_CHECK_MALLOC(md.add(tree, task.getNumberOfClasses()));
+    }
+
+    updatedEngine = enginesCollection.getUpdatedEngine(par.engine, engines, numElems);
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace decision_forest */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -75,6 +75,19 @@ public:
 
     services::Status getNumOfSplitNodes(const services::internal::sycl::UniversalBuffer & nodeList, size_t nNodes, size_t & nSplitNodes);
 
+    /* The trees of a batch are built level by level together, the nodes of a tree are the treeNodes[i] nodes of the level
+       after the nodes of the previous trees. Replaces treeNodes[i] by the number of the split nodes of the tree i */
+    services::Status getNumOfSplitNodesOfTrees(const services::internal::sycl::UniversalBuffer & nodeList, size_t nTrees, size_t nNodeProps,
+                                               size_t * treeNodes, size_t & nSplitNodes);
+
+    /* Copies the nNodes nodes of one tree from the node iNode of the level list of the batch of trees, nProps values per node */
+    template <typename T>
+    services::Status getTreeNodes(const services::internal::sycl::UniversalBuffer & levelList, size_t iNode, size_t nNodes, size_t nProps,
+                                  services::internal::sycl::UniversalBuffer & treeList);
+
+    /* The number of the trees built together, their rows fill the GPU till _maxRowsInTreesBatch */
+    size_t getNumOfTreesInBatch(size_t nTrees, size_t nRows) const;
+
     services::Status doNodesSplit(const services::internal::sycl::UniversalBuffer & nodeList, size_t nNodes,
                                   services::internal::sycl::UniversalBuffer & nodeListNew);
 
@@ -82,6 +95,7 @@ public:
                                                  services::internal::sycl::UniversalBuffer & bigNodesGroups,
                                                  services::internal::sycl::UniversalBuffer & nodeIndeces);
 
+    /* Repartitions the rows of all split nodes of the level in one launch, a sub-group per node, and copies them back in another one */
     services::Status doLevelPartition(const services::internal::sycl::UniversalBuffer & data, services::internal::sycl::UniversalBuffer & nodeList,
                                       size_t nNodes, services::internal::sycl::UniversalBuffer & treeOrder,
                                       services::internal::sycl::UniversalBuffer & treeOrderBuf, size_t nRows, size_t nFeatures);
@@ -111,8 +125,9 @@ private:
     services::internal::sycl::KernelPtr kernelUpdateMDIVarImportance;
     services::internal::sycl::KernelPtr kernelPartitionCopy;
 
-    const size_t _maxLocalSums = 256;
-    const size_t _minRowsBlock = 256;
+    const size_t _maxLocalSums        = 256;
+    const size_t _maxRowsInTreesBatch = 1 << 20;
+    const size_t _minRowsBlock        = 256;
 
     const size_t _preferableGroupSize  = 256;
     const size_t _maxWorkItemsPerGroup = 256; // should be a power of two for interal needs
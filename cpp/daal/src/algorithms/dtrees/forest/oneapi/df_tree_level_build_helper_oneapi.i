@@ -319,6 +319,59 @@ services::Status TreeLevelBuildHelperOneAPI<algorithmFPType>::getNumOfSplitNodes
     return status;
 }
 
+template <typename algorithmFPType>
+services::Status TreeLevelBuildHelperOneAPI<algorithmFPType>::getNumOfSplitNodesOfTrees(const UniversalBuffer & nodeList, size_t nTrees,
+                                                                                        size_t nNodeProps, size_t * treeNodes, size_t & nSplitNodes)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.getNumOfSplitNodesOfTrees);
+    const int badVal = -1;
+
+    auto nodeListHost = nodeList.template get<int>().toHost(ReadWriteMode::readOnly);
+    DAAL_CHECK_MALLOC(nodeListHost.get());
+    const int * nodes = nodeListHost.get();
+
+    nSplitNodes = 0;
+    for (size_t tree = 0, iNode = 0; tree < nTrees; tree++)
+    {
+        size_t nTreeSplitNodes = 0;
+        for (size_t i = 0; i < treeNodes[tree]; i++, iNode++)
+        {
+            nTreeSplitNodes += (nodes[iNode * nNodeProps + 2] != badVal); // featId != -1
+        }
+        treeNodes[tree] = nTreeSplitNodes;
+        nSplitNodes += nTreeSplitNodes;
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType>
+template <typename T>
+services::Status TreeLevelBuildHelperOneAPI<algorithmFPType>::getTreeNodes(const UniversalBuffer & levelList, size_t iNode, size_t nNodes,
+                                                                           size_t nProps, UniversalBuffer & treeList)
+{
+    if (iNode == 0 && nNodes * nProps == levelList.template get<T>().size())
+    {
+        treeList = levelList; // the level has the nodes of one tree only
+        return services::Status();
+    }
+
+    services::Status status;
+    auto & context = services::internal::getDefaultContext();
+    treeList       = context.allocate(TypeIds::id<T>(), nNodes * nProps, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    context.copy(treeList, 0, levelList, iNode * nProps, nNodes * nProps, &status);
+    return status;
+}
+
+template <typename algorithmFPType>
+size_t TreeLevelBuildHelperOneAPI<algorithmFPType>::getNumOfTreesInBatch(size_t nTrees, size_t nRows) const
+{
+    // the row offsets of the nodes of all trees of the batch are int32_t
+    size_t nTreesInBatch = (nRows < _maxRowsInTreesBatch) ? _maxRowsInTreesBatch / nRows : 1;
+    nTreesInBatch        = (nTreesInBatch * nRows > _int32max) ? _int32max / nRows : nTreesInBatch;
+    return (nTreesInBatch < nTrees) ? nTreesInBatch : nTrees;
+}
+
 template <typename algorithmFPType>
 services::Status TreeLevelBuildHelperOneAPI<algorithmFPType>::convertSplitToLeaf(UniversalBuffer & nodeList, size_t nNodes)
 {
@@ -59,9 +59,25 @@ class PredictRegressionTask : public dtrees::regression::prediction::internal::P
 {
 public:
     typedef dtrees::regression::prediction::internal::PredictRegressionTaskBase<algorithmFPType, cpu> super;
+    typedef int32_t featureIndexType;
+    typedef int32_t leftIndexType; /* tree size fits in to 2^31 */
     PredictRegressionTask(const NumericTable * x, NumericTable * y) : super(x, y) {}
 
     services::Status run(const decision_forest::regression::internal::ModelImpl * m, services::HostAppIface * pHostApp);
+
+protected:
+    services::Status convertTrees();
+    services::Status predictByBlocksOfRows(services::HostAppIface * pHostApp, algorithmFPType factor);
+    void predictByTreeVector(size_t iTree, size_t nRows, size_t nCols, const algorithmFPType * x, algorithmFPType * val) const;
+
+    /* Number of rows which go down the tree together */
+    static const size_t s_cVectorBlockSize = 32;
+
+    /* The trees converted to the struct of arrays layout, the nodes of the tree iTree start at _displaces[iTree] */
+    TArray<featureIndexType, cpu> _tFI;
+    TArray<leftIndexType, cpu> _tLI;
+    TArray<ModelFPType, cpu> _tFV;
+    TArray<size_t, cpu> _displaces;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -87,7 +103,124 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const decision
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
     const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nTreesTotal);
-    return super::run(pHostApp, div);
+    if (this->_featHelper.hasUnorderedFeatures() || this->_data->getNumberOfRows() < s_cVectorBlockSize * daal::threader_get_threads_number())
+    {
+        return super::run(pHostApp, div);
+    }
+    DAAL_CHECK_STATUS_VAR(convertTrees());
+    return predictByBlocksOfRows(pHostApp, div);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::convertTrees()
+{
+    const size_t nTreesTotal = this->_aTree.size();
+    _displaces.reset(nTreesTotal);
+    DAAL_CHECK_MALLOC(_displaces.get());
+    size_t sumTreeSize = 0;
+    for (size_t iTree = 0; iTree < nTreesTotal; ++iTree)
+    {
+        _displaces[iTree] = sumTreeSize;
+        sumTreeSize += this->_aTree[iTree]->getNumberOfRows();
+    }
+    _tFI.reset(sumTreeSize);
+    _tLI.reset(sumTreeSize);
+    _tFV.reset(sumTreeSize);
+    DAAL_CHECK_MALLOC(_tFI.get() && _tLI.get() && _tFV.get());
+
+    daal::threader_for(nTreesTotal, nTreesTotal, [&](size_t iTree) {
+        const size_t treeSize                                  = this->_aTree[iTree]->getNumberOfRows();
+        const dtrees::internal::DecisionTreeNode * const aNode = (const dtrees::internal::DecisionTreeNode *)(*this->_aTree[iTree]).getArray();
+        featureIndexType * const fi                            = _tFI.get() + _displaces[iTree];
+        leftIndexType * const li                               = _tLI.get() + _displaces[iTree];
+        ModelFPType * const fv                                 = _tFV.get() + _displaces[iTree];
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < treeSize; ++i)
+        {
+            fi[i] = aNode[i].featureIndex;
+            li[i] = aNode[i].leftIndexOrClass;
+            fv[i] = aNode[i].featureValueOrResponse;
+        }
+    });
+    return services::Status();
+}
+
+/* Moves the block of rows down the tree one level per iteration without data-dependent branches,
+   the rows which reached the leaves stay in place */
+template <typename algorithmFPType, CpuType cpu>
+void PredictRegressionTask<algorithmFPType, cpu>::predictByTreeVector(const size_t iTree, const size_t nRows, const size_t nCols,
+                                                                      const algorithmFPType * const x, algorithmFPType * const val) const
+{
+    const featureIndexType * const fi = _tFI.get() + _displaces[iTree];
+    const leftIndexType * const li    = _tLI.get() + _displaces[iTree];
+    const ModelFPType * const fv      = _tFV.get() + _displaces[iTree];
+
+    uint32_t currentNodes[s_cVectorBlockSize];
+    bool isSplits[s_cVectorBlockSize];
+    services::internal::service_memset_seq<uint32_t, cpu>(currentNodes, uint32_t(0), nRows);
+    services::internal::service_memset_seq<bool, cpu>(isSplits, bool(fi[0] != -1), nRows);
+
+    for (size_t check = isSplits[0]; check > 0;)
+    {
+        check = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const uint32_t cnIdx = currentNodes[i];
+            const size_t idx     = isSplits[i] * fi[cnIdx];
+            const bool sn        = x[i * nCols + idx] > fv[cnIdx];
+            currentNodes[i] -= isSplits[i] * (cnIdx - li[cnIdx] - sn);
+            isSplits[i] = (fi[currentNodes[i]] != -1);
+            check += isSplits[i];
+        }
+    }
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        val[i] += fv[currentNodes[i]];
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::predictByBlocksOfRows(services::HostAppIface * pHostApp, algorithmFPType factor)
+{
+    const size_t nTreesTotal = this->_aTree.size();
+    const size_t treeSize    = (_tFV.size() / nTreesTotal) * (sizeof(featureIndexType) + sizeof(leftIndexType) + sizeof(ModelFPType));
+
+    dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*this->_data, nTreesTotal, treeSize);
+    const size_t nBlocks = dim.nRowsTotal / s_cVectorBlockSize + !!(dim.nRowsTotal % s_cVectorBlockSize);
+
+    WriteOnlyRows<algorithmFPType, cpu> resBD(this->_res, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
+    SafeStatus safeStat;
+    services::Status s;
+    HostAppHelper host(pHostApp, 100);
+    for (size_t iTree = 0; iTree < nTreesTotal; iTree += dim.nTreesInBlock)
+    {
+        if (!s || host.isCancelled(s, 1)) return s;
+        const size_t iLastTree = ((iTree + dim.nTreesInBlock) < nTreesTotal ? iTree + dim.nTreesInBlock : nTreesTotal);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iStartRow      = iBlock * s_cVectorBlockSize;
+            const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? dim.nRowsTotal - iStartRow : s_cVectorBlockSize;
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(this->_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+
+            algorithmFPType val[s_cVectorBlockSize];
+            services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nRowsToProcess);
+            for (size_t i = iTree; i < iLastTree; ++i) predictByTreeVector(i, nRowsToProcess, dim.nCols, xBD.get(), val);
+
+            algorithmFPType * const res = resBD.get() + iStartRow;
+            for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow) res[iRow] += factor * val[iRow];
+        });
+        s = safeStat.detach();
+    }
+    return s;
 }
 
 } /* namespace internal */
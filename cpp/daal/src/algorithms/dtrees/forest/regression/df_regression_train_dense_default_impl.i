@@ -117,7 +117,9 @@ public:
                                       const algorithmFPType totalWeights) const;
 
     typedef double intermSummFPType;
+    template <typename FeatureBinIndexType>
     void computeHistWithWeights(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx, size_t n, intermSummFPType & sumTotal) const;
+    template <typename FeatureBinIndexType>
     void computeHistWithoutWeights(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx, size_t n, intermSummFPType & sumTotal) const;
 
     template <bool noWeights, bool featureUnordered>
@@ -127,6 +129,9 @@ public:
 
     void finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
                            IndexType * bestSplitIdx) const;
+    template <typename FeatureBinIndexType>
+    int splitByBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
+                         IndexType * bestSplitIdx) const;
     void simpleSplit(const algorithmFPType * featureVal, const IndexType * aIdx, TSplitData & split) const;
     bool terminateCriteria(ImpurityData & imp, algorithmFPType impurityThreshold, size_t nSamples) const { return imp.value() < impurityThreshold; }
 
@@ -308,26 +313,21 @@ bool OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeature(const algo
 }
 
 template <typename algorithmFPType, CpuType cpu>
-void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit,
-                                                                TSplitData & bestSplit, IndexType * bestSplitIdx) const
+template <typename FeatureBinIndexType>
+int OrderedRespHelper<algorithmFPType, cpu>::splitByBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit,
+                                                              TSplitData & bestSplit, IndexType * bestSplitIdx) const
 {
-    DAAL_ASSERT(bestSplit.nLeft > 0);
-    DAAL_ASSERT(bestSplit.leftWeights > 0.);
-    const algorithmFPType divL =
-        isZero<algorithmFPType, cpu>(bestSplit.leftWeights) ? algorithmFPType(1.) : (algorithmFPType(1.) / bestSplit.leftWeights);
-    bestSplit.left.mean *= divL;
-    bestSplit.left.var                                      = 0;
-    IndexType * bestSplitIdxRight                           = bestSplitIdx + bestSplit.nLeft;
-    size_t iLeft                                            = 0;
-    size_t iRight                                           = 0;
-    int iRowSplitVal                                        = -1;
-    const auto aResponse                                    = this->_aResponse.get();
-    const auto aWeights                                     = this->_aWeights.get();
-    const IndexedFeatures::IndexType * const indexedFeature = this->indexedFeatures().data(iFeature);
+    IndexType * bestSplitIdxRight                    = bestSplitIdx + bestSplit.nLeft;
+    size_t iLeft                                     = 0;
+    size_t iRight                                    = 0;
+    int iRowSplitVal                                 = -1;
+    const auto aResponse                             = this->_aResponse.get();
+    const auto aWeights                              = this->_aWeights.get();
+    const FeatureBinIndexType * const indexedFeature = this->indexedFeatures().template data<FeatureBinIndexType>(iFeature);
     for (size_t i = 0; i < n; ++i)
     {
-        const auto iSample = aIdx[i];
-        const auto idx     = indexedFeature[aResponse[iSample].idx];
+        const auto iSample  = aIdx[i];
+        const IndexType idx = indexedFeature[aResponse[iSample].idx];
         if ((bestSplit.featureUnordered && (idx != idxFeatureValueBestSplit)) || ((!bestSplit.featureUnordered) && (idx > idxFeatureValueBestSplit)))
         {
             DAAL_ASSERT(iRight < n - bestSplit.nLeft);
@@ -345,6 +345,22 @@ void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType
     }
     DAAL_ASSERT(iRight == n - bestSplit.nLeft);
     DAAL_ASSERT(iLeft == bestSplit.nLeft);
+    return iRowSplitVal;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit,
+                                                                TSplitData & bestSplit, IndexType * bestSplitIdx) const
+{
+    DAAL_ASSERT(bestSplit.nLeft > 0);
+    DAAL_ASSERT(bestSplit.leftWeights > 0.);
+    const algorithmFPType divL =
+        isZero<algorithmFPType, cpu>(bestSplit.leftWeights) ? algorithmFPType(1.) : (algorithmFPType(1.) / bestSplit.leftWeights);
+    bestSplit.left.mean *= divL;
+    bestSplit.left.var = 0;
+    int iRowSplitVal   = -1;
+    DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(this->indexedFeatures(), iRowSplitVal = splitByBestSplit<FeatureBinIndexType>(
+                                                                   aIdx, n, iFeature, idxFeatureValueBestSplit, bestSplit, bestSplitIdx));
     bestSplit.left.var *= divL;
     bestSplit.iStart = 0;
     DAAL_ASSERT(iRowSplitVal >= 0);
@@ -352,19 +368,20 @@ void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType
 }
 
 template <typename algorithmFPType, CpuType cpu>
+template <typename FeatureBinIndexType>
 void OrderedRespHelper<algorithmFPType, cpu>::computeHistWithoutWeights(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx, size_t n,
                                                                         intermSummFPType & sumTotal) const
 {
-    auto nFeatIdx                                           = _idxFeatureBuf.get(); //number of indexed feature values, array
-    auto aResponse                                          = this->_aResponse.get();
-    const IndexedFeatures::IndexType * const indexedFeature = this->indexedFeatures().data(iFeature);
-    sumTotal                                                = 0; //total sum of responses in the set being split
+    auto nFeatIdx                                    = _idxFeatureBuf.get(); //number of indexed feature values, array
+    auto aResponse                                   = this->_aResponse.get();
+    const FeatureBinIndexType * const indexedFeature = this->indexedFeatures().template data<FeatureBinIndexType>(iFeature);
+    sumTotal                                         = 0; //total sum of responses in the set being split
     {
         for (size_t i = 0; i < n; ++i)
         {
-            const IndexType iSample              = aIdx[i];
-            const typename super::Response & r   = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
+            const IndexType iSample            = aIdx[i];
+            const typename super::Response & r = aResponse[aIdx[i]];
+            const IndexType idx                = indexedFeature[r.idx];
             ++nFeatIdx[idx];
             buf[idx] += aResponse[iSample].val;
             sumTotal += aResponse[iSample].val;
@@ -373,22 +390,23 @@ void OrderedRespHelper<algorithmFPType, cpu>::computeHistWithoutWeights(algorith
 }
 
 template <typename algorithmFPType, CpuType cpu>
+template <typename FeatureBinIndexType>
 void OrderedRespHelper<algorithmFPType, cpu>::computeHistWithWeights(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx, size_t n,
                                                                      intermSummFPType & sumTotal) const
 {
-    auto nFeatIdx                                           = _idxFeatureBuf.get(); //number of indexed feature values, array
-    auto featWeights                                        = _weightsFeatureBuf.get();
-    auto aResponse                                          = this->_aResponse.get();
-    auto aWeights                                           = this->_aWeights.get();
-    const IndexedFeatures::IndexType * const indexedFeature = this->indexedFeatures().data(iFeature);
-    sumTotal                                                = 0; //total sum of responses in the set being split
+    auto nFeatIdx                                    = _idxFeatureBuf.get(); //number of indexed feature values, array
+    auto featWeights                                 = _weightsFeatureBuf.get();
+    auto aResponse                                   = this->_aResponse.get();
+    auto aWeights                                    = this->_aWeights.get();
+    const FeatureBinIndexType * const indexedFeature = this->indexedFeatures().template data<FeatureBinIndexType>(iFeature);
+    sumTotal                                         = 0; //total sum of responses in the set being split
     {
         for (size_t i = 0; i < n; ++i)
         {
-            const IndexType iSample              = aIdx[i];
-            const typename super::Response & r   = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
-            const auto weights                   = aWeights[iSample].val;
+            const IndexType iSample            = aIdx[i];
+            const typename super::Response & r = aResponse[aIdx[i]];
+            const IndexType idx                = indexedFeature[r.idx];
+            const auto weights                 = aWeights[iSample].val;
             ++nFeatIdx[idx];
             featWeights[idx] += weights;
             buf[idx] += aResponse[iSample].val * weights;
@@ -464,7 +482,7 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algor
 
     if (noWeights)
     {
-        computeHistWithoutWeights(buf, iFeature, aIdx, n, sumTotal);
+        DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(this->indexedFeatures(), computeHistWithoutWeights<FeatureBinIndexType>(buf, iFeature, aIdx, n, sumTotal));
 
         if (split.featureUnordered)
         {
@@ -478,7 +496,7 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algor
     else
     {
         _weightsFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-        computeHistWithWeights(buf, iFeature, aIdx, n, sumTotal);
+        DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(this->indexedFeatures(), computeHistWithWeights<FeatureBinIndexType>(buf, iFeature, aIdx, n, sumTotal));
 
         if (split.featureUnordered)
         {
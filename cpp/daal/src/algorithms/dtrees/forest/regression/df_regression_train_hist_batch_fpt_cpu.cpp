@@ -22,7 +22,7 @@
 */
 
 #include "src/algorithms/dtrees/forest/regression/df_regression_train_container.h"
-#include "src/algorithms/dtrees/forest/regression/df_regression_train_kernel.h"
+#include "src/algorithms/dtrees/forest/regression/df_regression_train_hist_impl.i"
 
 namespace daal
 {
@@ -40,7 +40,7 @@ template class BatchContainer<DAAL_FPTYPE, hist, DAAL_CPU>;
 } // namespace interface2
 namespace internal
 {
-template class RegressionTrainBatchKernel<DAAL_FPTYPE, hist, DAAL_CPU>;
+template class DAAL_EXPORT RegressionTrainBatchKernel<DAAL_FPTYPE, hist, DAAL_CPU>;
 }
 
 } // namespace training
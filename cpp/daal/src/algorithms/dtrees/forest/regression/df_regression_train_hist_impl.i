@@ -0,0 +1,130 @@
+/* file: df_regression_train_hist_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for decision forest regression
+//  train algorithms (hist) method on CPU.
+//--
+*/
+
+#ifndef __DF_REGRESSION_TRAIN_HIST_IMPL_I__
+#define __DF_REGRESSION_TRAIN_HIST_IMPL_I__
+
+#include "src/algorithms/dtrees/forest/df_train_hist_impl.i"
+#include "src/algorithms/dtrees/forest/regression/df_regression_train_kernel.h"
+#include "src/algorithms/dtrees/forest/regression/df_regression_train_hist_kernel.h"
+#include "src/algorithms/dtrees/forest/regression/df_regression_model_impl.h"
+#include "src/algorithms/dtrees/forest/regression/df_regression_training_types_result.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::algorithms::decision_forest::training::internal;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Statistics of the rows of the regression: the number of the rows, their
+// weight, the weighted sum of the responses and of their squares. The impurity
+// is the variance of the responses.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class HistTaskRegression
+{
+public:
+    typedef decision_forest::regression::internal::ModelImpl::TreeType TreeType;
+
+    size_t getNumberOfClasses() const { return 0; }
+    size_t getNumberOfStats() const { return 4; }
+    size_t getDefaultFeaturesPerNode(size_t nFeatures) const
+    {
+        const size_t nF = nFeatures / 3;
+        return (nF < 1 ? 1 : nF);
+    }
+
+    bool checkResponse(algorithmFPType y) const { return true; }
+
+    void addRow(double * stats, algorithmFPType y, double count, double weight) const
+    {
+        stats[0] += count;
+        stats[1] += weight;
+        stats[2] += weight * y;
+        stats[3] += weight * y * y;
+    }
+
+    double getWeight(const double * stats) const { return stats[1]; }
+
+    double getImpurity(const double * stats) const
+    {
+        if (!(stats[1] > 0.)) return 0.;
+        const double mean     = stats[2] / stats[1];
+        const double impurity = stats[3] / stats[1] - mean * mean;
+        return (impurity > 0. ? impurity : 0.);
+    }
+
+    //the node without the weight, e.g. the root of the rows with zero weights,
+    //predicts zero
+    typename TreeType::NodeType::Leaf * makeLeaf(TreeType & tree, const double * stats) const
+    {
+        typename TreeType::NodeType::Leaf * leaf = tree.allocator().allocLeaf();
+        leaf->response                           = (stats[1] > 0. ? stats[2] / stats[1] : 0.);
+        return leaf;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// RegressionTrainBatchKernel
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status RegressionTrainBatchKernel<algorithmFPType, hist, cpu>::compute(HostAppIface * pHostApp, const NumericTable * x,
+                                                                                const NumericTable * y, const NumericTable * w,
+                                                                                decision_forest::regression::Model & m, Result & res,
+                                                                                const Parameter & par)
+{
+    return compute(pHostApp, x, y, w, m, res, par, HistCommunicator());
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status RegressionTrainBatchKernel<algorithmFPType, hist, cpu>::compute(HostAppIface * pHostApp, const NumericTable * x,
+                                                                                const NumericTable * y, const NumericTable * w,
+                                                                                decision_forest::regression::Model & m, Result & res,
+                                                                                const Parameter & par, const HistCommunicator & comm)
+{
+    engines::EnginePtr updatedEngine;
+    const HistTaskRegression<algorithmFPType, cpu> task;
+    services::Status s = computeHistImpl<algorithmFPType, cpu>(
+        x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), par, task, comm, updatedEngine);
+    if (s.ok()) res.impl()->setEngine(updatedEngine);
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace regression */
+} /* namespace decision_forest */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -94,6 +94,15 @@ private:
         services::internal::sycl::UniversalBuffer & nodeImpDecreaseList, bool updateImpDecreaseRequired, size_t nNodes, size_t nMaxBinsAmongFtrs,
         size_t minObservationsInLeafNode, algorithmFPType impurityThreshold);
 
+    services::Status computeBestSplitByFeatureBlocks(
+        const services::internal::sycl::UniversalBuffer & data, services::internal::sycl::UniversalBuffer & treeOrder,
+        services::internal::sycl::UniversalBuffer & selectedFeatures, size_t nSelectedFeatures,
+        const services::internal::Buffer<algorithmFPType> & response, services::internal::sycl::UniversalBuffer & nodeList,
+        services::internal::sycl::UniversalBuffer & nodeIndices, size_t nodeIndicesOffset, services::internal::sycl::UniversalBuffer & binOffsets,
+        services::internal::sycl::UniversalBuffer & splitInfo, services::internal::sycl::UniversalBuffer & nodeImpDecreaseList,
+        bool updateImpDecreaseRequired, size_t nFeatures, size_t nNodes, size_t nGroupNodes, size_t nBlockFtrs, size_t nPartialHistograms,
+        size_t reduceLocalSize, size_t minObservationsInLeafNode, algorithmFPType impurityThreshold);
+
     services::Status computePartialHistograms(const services::internal::sycl::UniversalBuffer & data,
                                               services::internal::sycl::UniversalBuffer & treeOrder,
                                               services::internal::sycl::UniversalBuffer & selectedFeatures, size_t nSelectedFeatures,
@@ -133,15 +142,16 @@ private:
 
     decision_forest::internal::TreeLevelBuildHelperOneAPI<algorithmFPType> _treeLevelBuildHelper;
 
-    const size_t _maxWorkItemsPerGroup = 256;   // should be a power of two for interal needs
-    const size_t _maxLocalBuffer       = 30000; // should be less than a half of local memory (two buffers)
-    const size_t _preferableSubGroup   = 16;    // preferable maximal sub-group size
+    const size_t _maxWorkItemsPerGroup = 256;               // should be a power of two for interal needs
+    const size_t _maxLocalBuffer       = 30000;             // should be less than a half of local memory (two buffers)
+    const size_t _preferableSubGroup   = 16;                // preferable maximal sub-group size
     const size_t _maxLocalSize         = 128;
     const size_t _maxLocalSums         = 256;
     const size_t _maxLocalHistograms   = 256;
     const size_t _preferableGroupSize  = 256;
     const size_t _minRowsBlock         = 256;
     const size_t _maxBins              = 256;
+    const size_t _maxHistogramsBytes   = 512 * 1024 * 1024; // memory limit for the histograms of a block of nodes or features
 
     const size_t _nHistProps     = 3; // number of properties in bins histogram (i.e. n, mean and var)
     const size_t _nNodesGroups   = 3; // all nodes are split on groups (big, medium, small)
@@ -89,7 +89,7 @@ public:
             TArray<algorithmFPType, cpu> expValPtr(nRows);
             algorithmFPType * expVal = expValPtr.get();
             DAAL_CHECK_MALLOC(expVal);
-            s = super::runInternal(pHostApp, this->_res);
+            s = super::runInternal(pHostApp, this->_data, this->_res);
             if (!s) return s;
 
             auto nBlocks           = daal::threader_get_threads_number();
@@ -121,7 +121,7 @@ public:
             algorithmFPType * expVal = expValPtr.get();
             NumericTablePtr expNT    = HomogenNumericTableCPU<algorithmFPType, cpu>::create(expVal, 1, nRows, &s);
             DAAL_CHECK_MALLOC(expVal);
-            s = super::runInternal(pHostApp, expNT.get());
+            s = super::runInternal(pHostApp, this->_data, expNT.get());
             if (!s) return s;
 
             auto nBlocks           = daal::threader_get_threads_number();
@@ -144,7 +144,7 @@ public:
             DAAL_CHECK_BLOCK_STATUS(resBD);
             const algorithmFPType label[2] = { algorithmFPType(1.), algorithmFPType(0.) };
             algorithmFPType * res          = resBD.get();
-            s                              = super::runInternal(pHostApp, this->_res);
+            s                              = super::runInternal(pHostApp, this->_data, this->_res);
             if (!s) return s;
 
             for (size_t iRow = 0; iRow < nRows; ++iRow)
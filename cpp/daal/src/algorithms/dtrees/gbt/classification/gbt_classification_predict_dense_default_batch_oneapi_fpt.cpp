@@ -0,0 +1,45 @@
+/* file: gbt_classification_predict_dense_default_batch_oneapi_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of prediction stage of gradient boosted trees classification algorithm for GPU.
+//--
+*/
+
+#include "src/algorithms/dtrees/gbt/classification/oneapi/gbt_classification_predict_dense_kernel_oneapi.h"
+#include "src/algorithms/dtrees/gbt/classification/oneapi/gbt_classification_predict_dense_oneapi_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+template class DAAL_EXPORT PredictKernelOneAPI<DAAL_FPTYPE, defaultDense>;
+}
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
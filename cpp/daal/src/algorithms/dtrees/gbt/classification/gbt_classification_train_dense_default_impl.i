@@ -118,6 +118,27 @@ public:
             }
         });
     }
+
+    //L(y,f) = ln(1 + exp(-f)) for y = 1 and ln(1 + exp(f)) for y = 0
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType * y, const algorithmFPType * f) DAAL_C11_OVERRIDE
+    {
+        TVector<algorithmFPType, cpu, ScalableAllocator<cpu> > aExp(n);
+        auto exp = aExp.get();
+        if (!exp) return algorithmFPType(0);
+        const algorithmFPType expThreshold = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; i++)
+        {
+            exp[i] = (y[i] > algorithmFPType(0.5)) ? -f[i] : f[i];
+            if (exp[i] < expThreshold) exp[i] = expThreshold;
+        }
+        daal::internal::Math<algorithmFPType, cpu>::vExp(n, exp, exp);
+        daal::internal::Math<algorithmFPType, cpu>::vLog1p(n, exp, exp);
+        algorithmFPType val = 0;
+        for (size_t i = 0; i < n; i++) val += exp[i];
+        return val / algorithmFPType(n);
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +176,26 @@ public:
         });
     }
 
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType * y, const algorithmFPType * f) DAAL_C11_OVERRIDE
+    {
+        static const size_t s_cMaxClassesBufSize = 12;
+        const bool bUseTLS(_nClasses > s_cMaxClassesBufSize);
+        daal::TlsMem<algorithmFPType, cpu> lsData(_nClasses);
+        TVector<algorithmFPType, cpu, ScalableAllocator<cpu> > aProb(n);
+        auto prob = aProb.get();
+        if (!prob) return algorithmFPType(0);
+        daal::threader_for(n, n, [&](size_t i) {
+            algorithmFPType buf[s_cMaxClassesBufSize];
+            algorithmFPType * p = bUseTLS ? lsData.local() : buf;
+            getSoftmax(f + _nClasses * i, p);
+            prob[i] = p[size_t(y[i])];
+        });
+        daal::internal::Math<algorithmFPType, cpu>::vLog(n, prob, prob);
+        algorithmFPType val = 0;
+        for (size_t i = 0; i < n; i++) val -= prob[i];
+        return val / algorithmFPType(n);
+    }
+
 protected:
     void getSoftmax(const algorithmFPType * arg, algorithmFPType * res) const
     {
@@ -388,22 +429,22 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>(
-                pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
-                indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHost, x, y, nullptr, nullptr, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine,
+                par.nClasses, indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu>, Result>(
-                pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
-                indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHost, x, y, nullptr, nullptr, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine,
+                par.nClasses, indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-                pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
-                indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHost, x, y, nullptr, nullptr, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine,
+                par.nClasses, indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-            pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses, indexedFeatures,
-            featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+            pHost, x, y, nullptr, nullptr, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine,
+            par.nClasses, indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
 }
 
@@ -0,0 +1,82 @@
+/* file: gbt_classification_predict_dense_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that computes gradient boosted trees classification
+//  prediction results on GPU.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_PREDICT_DENSE_KERNEL_ONEAPI_H__
+#define __GBT_CLASSIFICATION_PREDICT_DENSE_KERNEL_ONEAPI_H__
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_predict.h"
+#include "algorithms/algorithm_base_common.h"
+#include "data_management/data/numeric_table.h"
+#include "src/algorithms/dtrees/gbt/oneapi/gbt_predict_dense_kernel_oneapi.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+template <typename algorithmFPType, prediction::Method method>
+class PredictKernelOneAPI : public algorithms::Kernel
+{
+public:
+    PredictKernelOneAPI() {};
+    PredictKernelOneAPI(const PredictKernelOneAPI &) = delete;
+    PredictKernelOneAPI & operator=(const PredictKernelOneAPI &) = delete;
+    ~PredictKernelOneAPI() {};
+
+    /**
+     *  \brief Compute gradient boosted trees prediction results on GPU.
+     *
+     *  \param a[in]    Matrix of input variables X
+     *  \param m[in]    Gradient boosted trees model obtained on training stage
+     *  \param r[out]   Prediction results, nullptr if the labels are not computed
+     *  \param prob[out]        Class probabilities, nullptr if the probabilities are not computed
+     *  \param nClasses[in]     Number of classes in gradient boosted trees algorithm parameter
+     *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     */
+    services::Status compute(services::HostAppIface * const pHostApp, const data_management::NumericTable * a,
+                             const classification::Model * const m, data_management::NumericTable * const r,
+                             data_management::NumericTable * const prob, size_t nClasses, size_t nIterations);
+
+private:
+    services::Status postProcess(const char * kernelName, const services::internal::sycl::UniversalBuffer & margins,
+                                 data_management::NumericTable * const res, size_t nRows, size_t nClasses);
+
+    gbt::prediction::internal::PredictByTreesOneAPI<algorithmFPType> _predictByTrees;
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,148 @@
+/* file: gbt_classification_predict_dense_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees classification prediction on GPU.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_PREDICT_DENSE_ONEAPI_IMPL_I__
+#define __GBT_CLASSIFICATION_PREDICT_DENSE_ONEAPI_IMPL_I__
+
+#include "src/algorithms/dtrees/gbt/classification/oneapi/gbt_classification_predict_dense_kernel_oneapi.h"
+#include "src/algorithms/dtrees/gbt/oneapi/gbt_predict_dense_oneapi_impl.i"
+#include "src/algorithms/dtrees/gbt/classification/gbt_classification_model_impl.h"
+
+#include "src/externals/service_ittnotify.h"
+#include "services/internal/buffer.h"
+#include "data_management/data/numeric_table.h"
+#include "src/data_management/service_numeric_table.h"
+#include "services/error_indexes.h"
+
+using namespace daal::data_management;
+using namespace daal::services::internal::sycl;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+template <typename algorithmFPType, prediction::Method method>
+services::Status PredictKernelOneAPI<algorithmFPType, method>::compute(services::HostAppIface * const pHostApp, const NumericTable * const x,
+                                                                       const classification::Model * const m, NumericTable * const res,
+                                                                       NumericTable * const prob, size_t nClasses, size_t nIterations)
+{
+    services::Status status;
+
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nCols = x->getNumberOfColumns();
+
+    const daal::algorithms::gbt::classification::internal::ModelImpl * const pModel =
+        static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(m);
+
+    // the binary model has a tree per iteration, the multiclass one has a tree per class
+    const size_t nResponses = (nClasses == 2 ? 1 : nClasses);
+    DAAL_ASSERT(!nIterations || nIterations * nResponses <= pModel->size());
+    const size_t nTrees = (nIterations ? nIterations * nResponses : pModel->size());
+
+    auto & context = services::internal::getDefaultContext();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nResponses);
+    auto margins = context.allocate(TypeIds::id<algorithmFPType>(), nRows * nResponses, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    {
+        BlockDescriptor<algorithmFPType> dataBlock;
+        DAAL_CHECK_STATUS_VAR(const_cast<NumericTable *>(x)->getBlockOfRows(0, nRows, readOnly, dataBlock));
+
+        auto dataBuffer   = dataBlock.getBuffer();
+        auto marginBuffer = margins.template get<algorithmFPType>();
+
+        DAAL_CHECK_STATUS_VAR(_predictByTrees.predict(dataBuffer, *x, *pModel, nTrees, nResponses, marginBuffer, nRows, nCols));
+
+        DAAL_CHECK_STATUS_VAR(const_cast<NumericTable *>(x)->releaseBlockOfRows(dataBlock));
+    }
+
+    if (res)
+    {
+        DAAL_CHECK_STATUS_VAR(postProcess(nClasses == 2 ? "computeBinaryClasses" : "computeMulticlassClasses", margins, res, nRows, nClasses));
+    }
+    if (prob)
+    {
+        DAAL_CHECK_STATUS_VAR(
+            postProcess(nClasses == 2 ? "computeBinaryProbabilities" : "computeMulticlassProbabilities", margins, prob, nRows, nClasses));
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, prediction::Method method>
+services::Status PredictKernelOneAPI<algorithmFPType, method>::postProcess(const char * kernelName, const UniversalBuffer & margins,
+                                                                           NumericTable * const res, size_t nRows, size_t nClasses)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.postProcess);
+
+    services::Status status;
+
+    auto & context        = services::internal::getDefaultContext();
+    auto & kernel_factory = context.getClKernelFactory();
+
+    // the program is built by the prediction of the trees, so the kernels are taken from the cache
+    DAAL_CHECK_STATUS_VAR(gbt::prediction::internal::PredictByTreesOneAPI<algorithmFPType>::buildProgram(kernel_factory));
+    auto kernel = kernel_factory.getKernel(kernelName, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    BlockDescriptor<algorithmFPType> resBlock;
+    DAAL_CHECK_STATUS_VAR(res->getBlockOfRows(0, nRows, writeOnly, resBlock));
+    auto resBuffer = resBlock.getBuffer();
+
+    {
+        KernelArguments args(nClasses == 2 ? 3 : 4);
+        args.set(0, margins, AccessModeIds::read);
+        args.set(1, resBuffer, AccessModeIds::write);
+        args.set(2, static_cast<int32_t>(nRows));
+        if (nClasses != 2)
+        {
+            args.set(3, static_cast<int32_t>(nClasses));
+        }
+
+        KernelRange range(nRows);
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    DAAL_CHECK_STATUS_VAR(res->releaseBlockOfRows(resBlock));
+
+    return status;
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace classification */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
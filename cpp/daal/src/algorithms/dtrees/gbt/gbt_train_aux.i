@@ -116,13 +116,20 @@ public:
     bool hasDiffFeatureValues(IndexType iFeature, const int * aIdx, size_t n) const
     {
         if (this->indexedFeatures().numIndices(iFeature) == 1) return false; //single value only
-        const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-        size_t i                                          = 1;
+        DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(this->indexedFeatures(), return hasDiffFeatureValues<FeatureBinIndexType>(iFeature, aIdx, n));
+        return false;
+    }
+
+    template <typename FeatureBinIndexType>
+    bool hasDiffFeatureValues(IndexType iFeature, const int * aIdx, size_t n) const
+    {
+        const FeatureBinIndexType * indexedFeature = this->indexedFeatures().template data<FeatureBinIndexType>(iFeature);
+        size_t i                                   = 1;
 
-        const IndexedFeatures::IndexType idx0 = indexedFeature[aIdx[0]];
+        const FeatureBinIndexType idx0 = indexedFeature[aIdx[0]];
         for (; i < n; ++i)
         {
-            const IndexedFeatures::IndexType idx = indexedFeature[aIdx[i]];
+            const FeatureBinIndexType idx = indexedFeature[aIdx[i]];
             if (idx != idx0) break;
         }
         return (i != n);
@@ -181,6 +188,8 @@ class LossFunction : public Base
 public:
     virtual void getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
                               algorithmFPType * gh) = 0;
+    //the mean value of the loss function over n rows
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType * y, const algorithmFPType * f) = 0;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 #include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_internal.h"
 #include "src/algorithms/dtrees/gbt/gbt_train_aux.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
 
 namespace daal
 {
@@ -164,7 +165,7 @@ protected:
     virtual services::Status buildTrees(gbt::internal::GbtDecisionTree ** aTbl, HomogenNumericTable<double> ** aTblImp,
                                         HomogenNumericTable<int> ** aTblSmplCnt,
                                         GlobalStorages<algorithmFPType, BinIndexType, cpu> & GH_SUMS_BUF) = 0;
-    virtual void step(const algorithmFPType * y)                                                          = 0;
+    virtual services::Status step(const algorithmFPType * y)                                              = 0;
     virtual bool getInitialF(algorithmFPType & val) { return false; }
 
     //loss function arguments (current estimation of y)
@@ -299,7 +300,8 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
         }
         daal::algorithms::internal::qSort<RowIndexType, cpu>(nSamples(), aSampleToF);
     }
-    step(this->_dataHelper.y());
+    services::Status s = step(this->_dataHelper.y());
+    DAAL_CHECK_STATUS_VAR(s);
     _nParallelNodes.set(0);
     return buildTrees(aTbl, aTblImp, aTblSmplCnt, GH_SUMS_BUF);
 }
@@ -342,29 +344,248 @@ public:
 
     //loss function gradient and hessian values calculated in f() points
     ghType * grad(size_t iTree) { return _aGH.get() + iTree * this->_data->getNumberOfRows(); }
-    void step(const algorithmFPType * y) DAAL_C11_OVERRIDE
+    //quantized gradient and hessian values, grad(iTree)[i].g == quantizedGrad(iTree)[2 * i] * gradScale(iTree)
+    const int16_t * quantizedGrad(size_t iTree) const { return _aGHQ.get() + 2 * iTree * this->_data->getNumberOfRows(); }
+    algorithmFPType gradScale(size_t iTree) const { return _aGHScale[2 * iTree]; }
+    algorithmFPType hessScale(size_t iTree) const { return _aGHScale[2 * iTree + 1]; }
+    //true if the GHSums of n rows are accumulated as the integer sums of the quantized values, they fit int32_t
+    bool isQuantizedGHSums(size_t n) const
+    {
+        return _aGHQ.get() && (n <= size_t(services::internal::MaxVal<int>::get()) / size_t(quantizedMax()));
+    }
+
+    services::Status step(const algorithmFPType * y) DAAL_C11_OVERRIDE
     {
         this->lossFunc()->getGradients(this->_nSamples, this->_data->getNumberOfRows(), y, this->f(), this->aSampleToF(),
                                        (algorithmFPType *)_aGH.get());
+        return _aGHQ.get() ? quantizeGradients() : services::Status();
     }
     virtual services::Status init() DAAL_C11_OVERRIDE
     {
         auto s = super::init();
         if (s)
         {
-            _aGH.reset(this->_data->getNumberOfRows() * this->_nTrees);
+            const size_t nRows = this->_data->getNumberOfRows();
+            _aGH.reset(nRows * this->_nTrees);
             DAAL_CHECK_MALLOC(_aGH.get());
+            if (this->_par.gradientQuantizationBits)
+            {
+                _aGHQ.reset(2 * nRows * this->_nTrees);
+                _aGHScale.reset(2 * this->_nTrees);
+                _aUniform.reset(2 * this->_nSamples);
+                DAAL_CHECK_MALLOC(_aGHQ.get() && _aGHScale.get() && _aUniform.get());
+            }
         }
         return s;
     }
 
 protected:
-    TVector<ghType, cpu> _aGH; //loss function first and second order derivatives
+    //the largest absolute quantized value
+    int quantizedMax() const { return (1 << (this->_par.gradientQuantizationBits - 1)) - 1; }
+    services::Status quantizeGradients();
+
+    TVector<ghType, cpu> _aGH;               //loss function first and second order derivatives
+    TVector<int16_t, cpu> _aGHQ;             //quantized derivatives
+    TVector<algorithmFPType, cpu> _aGHScale; //scales of the quantized derivatives of the trees
+    TVector<algorithmFPType, cpu> _aUniform; //random numbers of the stochastic rounding
     HostAppIface * _hostApp;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Stochastic rounding of the derivatives of the samples to the quantizedMax() integers.
+// The largest absolute gradient and hessian of the tree become quantizedMax(), the value x/scale is
+// rounded up with the probability of its fractional part, so the sums stay unbiased.
+// The derivatives are replaced by the rounded ones times the scale, so every split
+// and leaf value is computed of the same values as the integer histograms.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status TrainBatchTaskBaseXBoost<algorithmFPType, BinIndexType, cpu>::quantizeGradients()
+{
+    const size_t nRows         = this->_data->getNumberOfRows();
+    const size_t nSamples      = this->_nSamples;
+    const int * aSampleToF     = this->aSampleToF();
+    const algorithmFPType qMax = algorithmFPType(quantizedMax());
+
+    const size_t nThreads  = this->numAvailableThreads();
+    const size_t nBlocks   = getNBlocksForOpt<cpu>(nThreads, nSamples);
+    const bool inParallel  = nBlocks > 1;
+    const size_t nPerBlock = nSamples / nBlocks;
+    const size_t nSurplus  = nSamples % nBlocks;
+    daal::services::internal::TArray<algorithmFPType, cpu> maxArr(2 * nBlocks);
+    algorithmFPType * const aMax = maxArr.get();
+    DAAL_CHECK_MALLOC(aMax);
+    algorithmFPType * const aUniform = _aUniform.get();
+
+    for (size_t iTree = 0; iTree < this->_nTrees; ++iTree)
+    {
+        algorithmFPType * const pgh = (algorithmFPType *)grad(iTree);
+        int16_t * const pq          = _aGHQ.get() + 2 * iTree * nRows;
+
+        LoopHelper<cpu>::run(inParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock + 1 > nSurplus ? nPerBlock * iBlock + nSurplus : (nPerBlock + 1) * iBlock;
+            const size_t end   = iBlock + 1 > nSurplus ? start + nPerBlock : start + (nPerBlock + 1);
+            algorithmFPType gMax(0), hMax(0);
+            for (size_t i = start; i < end; i++)
+            {
+                const size_t iRow       = aSampleToF ? aSampleToF[i] : i;
+                const algorithmFPType g = pgh[2 * iRow];
+                const algorithmFPType h = pgh[2 * iRow + 1];
+                gMax                    = services::internal::max<cpu, algorithmFPType>(gMax, g < 0 ? -g : g);
+                hMax                    = services::internal::max<cpu, algorithmFPType>(hMax, h < 0 ? -h : h);
+            }
+            aMax[2 * iBlock]     = gMax;
+            aMax[2 * iBlock + 1] = hMax;
+        });
+        algorithmFPType gMax(0), hMax(0);
+        for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+        {
+            gMax = services::internal::max<cpu, algorithmFPType>(gMax, aMax[2 * iBlock]);
+            hMax = services::internal::max<cpu, algorithmFPType>(hMax, aMax[2 * iBlock + 1]);
+        }
+        const algorithmFPType gScale = (gMax > 0) ? gMax / qMax : algorithmFPType(1);
+        const algorithmFPType hScale = (hMax > 0) ? hMax / qMax : algorithmFPType(1);
+        _aGHScale[2 * iTree]         = gScale;
+        _aGHScale[2 * iTree + 1]     = hScale;
+
+        const int errorcode = RNGs<algorithmFPType, cpu>().uniform(2 * nSamples, aUniform, this->_engine.getState(), 0, 1);
+        DAAL_CHECK(!errorcode, ErrorIncorrectErrorcodeFromGenerator);
+
+        LoopHelper<cpu>::run(inParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock + 1 > nSurplus ? nPerBlock * iBlock + nSurplus : (nPerBlock + 1) * iBlock;
+            const size_t end   = iBlock + 1 > nSurplus ? start + nPerBlock : start + (nPerBlock + 1);
+            PRAGMA_IVDEP
+            for (size_t i = start; i < end; i++)
+            {
+                const size_t iRow = aSampleToF ? aSampleToF[i] : i;
+                for (size_t k = 0; k < 2; ++k)
+                {
+                    const algorithmFPType scale = k ? hScale : gScale;
+                    //the shifted value is not negative, so the truncation is the floor
+                    const algorithmFPType shifted = pgh[2 * iRow + k] / scale + aUniform[2 * i + k] + qMax;
+                    const int q                   = services::internal::min<cpu, int>(int(shifted) - int(qMax), int(qMax));
+                    pq[2 * iRow + k]              = int16_t(q);
+                    pgh[2 * iRow + k]             = algorithmFPType(q) * scale;
+                }
+            }
+        });
+    }
+    return services::Status();
+}
+
+//Stores the indexed features by rows to the bins of BinIndexType
+template <typename BinIndexType, typename FeatureBinIndexType, CpuType cpu>
+void transposeIndexedFeatures(const FeatureBinIndexType * fi, BinIndexType * newFI, size_t nRows, size_t nCols)
+{
+    size_t nThreads    = threader_get_threads_number();
+    size_t nBlocks     = ((nThreads < nRows) ? nThreads : 1);
+    size_t sizeOfBlock = nRows / nBlocks + !!(nRows % nBlocks);
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * sizeOfBlock;
+        const size_t iEnd   = (((iBlock + 1) * sizeOfBlock > nRows) ? nRows : iStart + sizeOfBlock);
+
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nCols; ++j)
+            {
+                newFI[nCols * i + j] = fi[nRows * j + i];
+            }
+        }
+    });
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Early stopping by the loss on the validation set. The responses of the ensemble on the
+// validation set are cached and updated by the trees of every iteration only
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class EarlyStopping
+{
+public:
+    typedef LossFunction<algorithmFPType, cpu> LossFunctionType;
+
+    EarlyStopping(const NumericTable * x, const NumericTable * y, const FeatureTypes & featTypes, size_t nTrees, size_t nIterationsNoImprovement)
+        : _x(x), _y(y), _featTypes(featTypes), _nTrees(nTrees), _nIterationsNoImprovement(nIterationsNoImprovement), _nNoImprovement(0)
+    {}
+
+    bool isEnabled() const { return _x && _nIterationsNoImprovement; }
+
+    services::Status init()
+    {
+        if (!isEnabled()) return services::Status();
+        const size_t nRows = _x->getNumberOfRows();
+        _aF.reset(nRows * _nTrees);
+        DAAL_CHECK_MALLOC(_aF.get());
+        services::internal::service_memset<algorithmFPType, cpu>(_aF.get(), algorithmFPType(0), nRows * _nTrees);
+        ReadRows<algorithmFPType, cpu> yRows(const_cast<NumericTable *>(_y), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(yRows);
+        _aY.reset(nRows);
+        DAAL_CHECK_MALLOC(_aY.get());
+        services::internal::tmemcpy<algorithmFPType, cpu>(_aY.get(), yRows.get(), nRows);
+        return services::Status();
+    }
+
+    //Adds the responses of the trees of the iteration, bStop is set when the loss
+    //has not improved during nIterationsNoImprovement iterations
+    services::Status update(gbt::internal::GbtDecisionTree ** aTbl, LossFunctionType & loss, bool & bStop)
+    {
+        typedef gbt::internal::GbtDecisionTree TreeType;
+        const size_t nRows         = _x->getNumberOfRows();
+        const size_t nCols         = _x->getNumberOfColumns();
+        const size_t nPerBlock     = 256;
+        const size_t nBlocks       = nRows / nPerBlock + !!(nRows % nPerBlock);
+        algorithmFPType * const pf = _aF.get();
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iStart       = iBlock * nPerBlock;
+            const size_t nRowsInBlock = (iStart + nPerBlock > nRows) ? nRows - iStart : nPerBlock;
+            ReadRows<algorithmFPType, cpu> xRows(const_cast<NumericTable *>(_x), iStart, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+            const algorithmFPType * const px = xRows.get();
+            for (size_t i = 0; i < nRowsInBlock; ++i)
+            {
+                algorithmFPType * const pfRow = pf + (iStart + i) * _nTrees;
+                const algorithmFPType * const pxRow = px + i * nCols;
+                for (size_t iTree = 0; iTree < _nTrees; ++iTree)
+                    pfRow[iTree] += gbt::prediction::internal::predictForTree<algorithmFPType, TreeType, cpu>(*aTbl[iTree], _featTypes, pxRow);
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        const algorithmFPType curLoss = loss.getLoss(nRows, _aY.get(), pf);
+        if (!_bestLossSet || curLoss < _bestLoss)
+        {
+            _bestLoss       = curLoss;
+            _bestLossSet    = true;
+            _nNoImprovement = 0;
+        }
+        else
+        {
+            ++_nNoImprovement;
+        }
+        bStop = (_nNoImprovement >= _nIterationsNoImprovement);
+        return services::Status();
+    }
+
+protected:
+    const NumericTable * _x;
+    const NumericTable * _y;
+    const FeatureTypes & _featTypes;
+    const size_t _nTrees;
+    const size_t _nIterationsNoImprovement;
+    size_t _nNoImprovement;
+    algorithmFPType _bestLoss = 0;
+    bool _bestLossSet         = false;
+    TVector<algorithmFPType, cpu> _aF; //responses of the ensemble on the validation set
+    TVector<algorithmFPType, cpu> _aY;
+};
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu, typename TaskType, typename ResultType>
-services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::internal::ModelImpl & md,
+services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const NumericTable * xValid,
+                                 const NumericTable * yValid, gbt::internal::ModelImpl & md,
                                  const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses,
                                  dtrees::internal::IndexedFeatures & indexedFeatures, dtrees::internal::FeatureTypes & featTypes, ResultType * res,
                                  algorithmFPType * ptrWeight, algorithmFPType * ptrCover, algorithmFPType * ptrTotalCover, algorithmFPType * ptrGain,
@@ -380,6 +601,8 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
     DAAL_CHECK_STATUS(s, task.init());
 
     const size_t nTrees = task.nTrees();
+    EarlyStopping<algorithmFPType, cpu> earlyStopping(xValid, yValid, featTypes, nTrees, par.nIterationsNoImprovement);
+    DAAL_CHECK_STATUS(s, earlyStopping.init());
     DAAL_CHECK_MALLOC(md.reserve(par.maxIterations * nTrees));
 
     TVector<gbt::internal::GbtDecisionTree *, cpu> aTables;
@@ -445,32 +668,15 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 
     if (inexactWithHistMethod)
     {
-        size_t nThreads    = threader_get_threads_number();
-        size_t nRows       = x->getNumberOfRows();
-        size_t nCols       = x->getNumberOfColumns();
-        size_t nBlocks     = ((nThreads < nRows) ? nThreads : 1);
-        size_t sizeOfBlock = nRows / nBlocks + !!(nRows % nBlocks);
+        size_t nRows = x->getNumberOfRows();
+        size_t nCols = x->getNumberOfColumns();
 
         newFIArr.resize(nRows * nCols);
         BinIndexType * newFI = newFIArr.get();
         DAAL_CHECK_MALLOC(newFI);
 
-        const dtrees::internal::IndexedFeatures::IndexType * fi = indexedFeatures.data(0);
-
-        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
-            const size_t iStart = iBlock * sizeOfBlock;
-            const size_t iEnd   = (((iBlock + 1) * sizeOfBlock > nRows) ? nRows : iStart + sizeOfBlock);
-
-            for (size_t i = iStart; i < iEnd; ++i)
-            {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < nCols; ++j)
-                {
-                    newFI[nCols * i + j] = fi[nRows * j + i];
-                }
-            }
-        });
+        DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(indexedFeatures, transposeIndexedFeatures<BinIndexType, FeatureBinIndexType, cpu>(
+                                                               indexedFeatures.data<FeatureBinIndexType>(0), newFI, nRows, nCols));
         storage.newFI = newFI;
     }
 
@@ -539,6 +745,12 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
             md.add(aTbl[iTree], aTblImp[iTree], aTblSmplCnt[iTree]);
         }
 
+        if (earlyStopping.isEnabled())
+        {
+            bool bStop = false;
+            s          = earlyStopping.update(aTbl, *task.lossFunc(), bStop);
+            if (!s || bStop) break;
+        }
         if ((i + 1 < par.maxIterations) && task.done()) break;
     }
 
@@ -557,16 +769,17 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 // compute() implementation
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename BinIndexType, typename TaskType, typename ResultType>
-services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::internal::ModelImpl & md,
+services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const NumericTable * xValid,
+                             const NumericTable * yValid, gbt::internal::ModelImpl & md,
                              const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses,
                              dtrees::internal::IndexedFeatures & indexedFeatures, dtrees::internal::FeatureTypes & featTypes, ResultType * res,
                              algorithmFPType * ptrWeight, algorithmFPType * ptrCover, algorithmFPType * ptrTotalCover, algorithmFPType * ptrGain,
                              algorithmFPType * ptrTotalGain)
 
 {
-    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, md, par, engine, nClasses, indexedFeatures, featTypes,
-                                                                              res, ptrWeight, ptrCover, ptrTotalCover, ptrGain,
-                                                                              ptrTotalGain); // TODO: remove int
+    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, xValid, yValid, md, par, engine, nClasses,
+                                                                              indexedFeatures, featTypes, res, ptrWeight, ptrCover, ptrTotalCover,
+                                                                              ptrGain, ptrTotalGain); // TODO: remove int
 }
 
 } /* namespace internal */
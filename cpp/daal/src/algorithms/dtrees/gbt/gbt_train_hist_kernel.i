@@ -151,7 +151,8 @@ template <typename algorithmFPType, typename RowIndexType, typename BinIndexType
 class GHSumsHelper
 {
 public:
-    static void compute(const size_t iStart, const size_t n, const RowIndexType * const indexedFeature, const RowIndexType * aIdx,
+    template <typename FeatureBinIndexType>
+    static void compute(const size_t iStart, const size_t n, const FeatureBinIndexType * const indexedFeature, const RowIndexType * aIdx,
                         const RowIndexType * aSampleToSourceRow, const algorithmFPType * const pgh, GHSumType * const aGHSum,
                         algorithmFPType & gTotal, algorithmFPType & hTotal, size_t level)
     {
@@ -168,7 +169,8 @@ public:
         }
     }
 
-    static void computeCommon(const size_t iStart, const size_t n, const RowIndexType * const indexedFeature, const RowIndexType * aIdx,
+    template <typename FeatureBinIndexType>
+    static void computeCommon(const size_t iStart, const size_t n, const FeatureBinIndexType * const indexedFeature, const RowIndexType * aIdx,
                               const algorithmFPType * const pgh, GHSumType * const aGHSum, algorithmFPType & gTotal, algorithmFPType & hTotal)
     {
         aIdx = aIdx + iStart;
@@ -186,7 +188,8 @@ public:
         }
     }
 
-    static void computeRoot(const size_t iStart, const size_t n, const RowIndexType * const indexedFeature, const RowIndexType * aIdx,
+    template <typename FeatureBinIndexType>
+    static void computeRoot(const size_t iStart, const size_t n, const FeatureBinIndexType * const indexedFeature, const RowIndexType * aIdx,
                             const algorithmFPType * const pgh, GHSumType * const aGHSum, algorithmFPType & gTotal, algorithmFPType & hTotal)
     {
         aIdx = aIdx + iStart;
@@ -307,6 +310,91 @@ struct MergeGHSums
     }
 };
 
+// The GHSums of the quantized gradients and hessians are 4 int32_t per bin: g, h, n and the padding,
+// so they take a half of the double GHSums and the sums are exact
+template <typename RowIndexType, typename BinIndexType, CpuType cpu>
+struct ComputeQuantizedGHSumByRows
+{
+    static void run(int32_t * aGHSumQ, const BinIndexType * indexedFeature, const RowIndexType * aIdx, const int16_t * pq, size_t nFeatures,
+                    size_t iStart, size_t iEnd, size_t nRows, size_t * UniquesArr)
+    {
+        const size_t cacheLineSize       = 64; // bytes
+        const size_t prefetchOffset      = 10; // heuristic, prefetch on 10 rows ahead
+        const size_t elementsInCacheLine = cacheLineSize / sizeof(BinIndexType);
+
+        const size_t noPrefetchSize              = services::internal::min<cpu, size_t>(prefetchOffset + elementsInCacheLine, nRows);
+        const size_t iEndWithPrefetch            = services::internal::min<cpu, size_t>(nRows - noPrefetchSize, iEnd);
+        const size_t nCacheLinesToPrefetchOneRow = nFeatures / elementsInCacheLine + !!(nFeatures % elementsInCacheLine);
+
+        RowIndexType i = iStart;
+        PRAGMA_IVDEP
+        for (; i < iEndWithPrefetch; ++i)
+        {
+            DAAL_PREFETCH_READ_T0(pq + 2 * aIdx[i + prefetchOffset]);
+            const BinIndexType * ptr = indexedFeature + aIdx[i + prefetchOffset] * nFeatures;
+            for (RowIndexType j = 0; j < nCacheLinesToPrefetchOneRow; j++) DAAL_PREFETCH_READ_T0(ptr + elementsInCacheLine * j);
+
+            const BinIndexType * featIdx = indexedFeature + aIdx[i] * nFeatures;
+            const int32_t g              = pq[2 * aIdx[i]];
+            const int32_t h              = pq[2 * aIdx[i] + 1];
+
+            PRAGMA_IVDEP
+            for (RowIndexType j = 0; j < nFeatures; j++)
+            {
+                const size_t idx = 4 * (UniquesArr[j] + (size_t)featIdx[j]);
+                aGHSumQ[idx + 0] += g;
+                aGHSumQ[idx + 1] += h;
+                aGHSumQ[idx + 2] += 1;
+            }
+        }
+
+        PRAGMA_IVDEP
+        for (; i < iEnd; ++i)
+        {
+            const BinIndexType * featIdx = indexedFeature + aIdx[i] * nFeatures;
+            const int32_t g              = pq[2 * aIdx[i]];
+            const int32_t h              = pq[2 * aIdx[i] + 1];
+
+            PRAGMA_IVDEP
+            for (RowIndexType j = 0; j < nFeatures; j++)
+            {
+                const size_t idx = 4 * (UniquesArr[j] + (size_t)featIdx[j]);
+                aGHSumQ[idx + 0] += g;
+                aGHSumQ[idx + 1] += h;
+                aGHSumQ[idx + 2] += 1;
+            }
+        }
+    }
+};
+
+// Merges the integer GHSums of the blocks and rescales them to the GHSums of the feature
+template <typename algorithmFPType, CpuType cpu>
+struct MergeQuantizedGHSums
+{
+    static void run(const size_t nUnique, const size_t iStart, algorithmFPType ** results, const size_t nBlocks, const algorithmFPType gScale,
+                    const algorithmFPType hScale, Result<algorithmFPType, cpu> & res)
+    {
+        for (size_t i = 0; i < nUnique; ++i)
+        {
+            int32_t g = 0, h = 0, n = 0;
+            for (size_t iB = 0; iB < nBlocks; ++iB)
+            {
+                const int32_t * ptr = (const int32_t *)results[iB] + 4 * (iStart + i);
+                g += ptr[0];
+                h += ptr[1];
+                n += ptr[2];
+            }
+            auto & sum = res.ghSums[i];
+            sum.g      = algorithmFPType(g) * gScale;
+            sum.h      = algorithmFPType(h) * hScale;
+            sum.n      = algorithmFPType(n);
+            sum.dummy  = 0;
+            res.gTotal += sum.g;
+            res.hTotal += sum.h;
+        }
+    }
+};
+
 #if defined(__INTEL_COMPILER)
     #if __CPUID__(DAAL_CPU) >= __sse42__
         #define SSE42_ALL DAAL_CPU
@@ -115,7 +115,7 @@ protected:
         buildRightnode(newTasks, nTask, res, impRight);
     }
 
-    void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res)
+    virtual void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res)
     {
         NodeInfoType node(_node.iStart, _split.nLeft, _node.level + 1, _split.left, res->kid[0]);
         newTasks[nTask++] = new (services::internal::service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(_data, node);
@@ -126,7 +126,7 @@ protected:
         }
     }
 
-    void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
+    virtual void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
     {
         NodeInfoType node(_node.iStart + _split.nLeft, _node.n - _split.nLeft, _node.level + 1, impRight, res->kid[1]);
         newTasks[nTask++] = new (services::internal::service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(_data, node);
@@ -202,6 +202,35 @@ protected:
             MergedUpdaterType(super::_data, node1, node2, super::_prevRes);
     }
 
+    // The right kid is a leaf: if it is the smaller one, GHSums are computed for its rows only
+    // and the ones of the left kid are taken as the difference with the parent
+    virtual void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res)
+    {
+        const size_t nRight = super::_node.n - super::_split.nLeft;
+        if (!super::_prevRes || nRight >= super::_split.nLeft) return super::buildLeftnode(newTasks, nTask, res);
+
+        typename super::ImpurityType impRight;
+        impRight.g = super::_node.imp.g - super::_split.left.g;
+        impRight.h = super::_node.imp.h - super::_split.left.h;
+
+        typename super::NodeInfoType node1(super::_node.iStart, super::_split.nLeft, super::_node.level + 1, super::_split.left, res->kid[0]);
+        typename super::NodeInfoType node2(super::_node.iStart + super::_split.nLeft, nRight, super::_node.level + 1, impRight, res->kid[1]);
+        newTasks[nTask++] = new (services::internal::service_scalable_calloc<MergedUpdaterType, cpu>(1))
+            MergedUpdaterType(super::_data, node1, node2, super::_prevRes, true, false);
+    }
+
+    // The left kid is a leaf, the same as above with the sides swapped
+    virtual void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res, typename super::ImpurityType & impRight)
+    {
+        const size_t nRight = super::_node.n - super::_split.nLeft;
+        if (!super::_prevRes || super::_split.nLeft >= nRight) return super::buildRightnode(newTasks, nTask, res, impRight);
+
+        typename super::NodeInfoType node1(super::_node.iStart, super::_split.nLeft, super::_node.level + 1, super::_split.left, res->kid[0]);
+        typename super::NodeInfoType node2(super::_node.iStart + super::_split.nLeft, nRight, super::_node.level + 1, impRight, res->kid[1]);
+        newTasks[nTask++] = new (services::internal::service_scalable_calloc<MergedUpdaterType, cpu>(1))
+            MergedUpdaterType(super::_data, node1, node2, super::_prevRes, false, true);
+    }
+
     using super::_data;
     using super::_split;
     using super::_node;
@@ -151,11 +151,16 @@ protected:
 
     DAAL_INT doPartition(size_t n, size_t iStart, SplitDataType & split, DAAL_INT iFeature, size_t idxFeatureValueBestSplit)
     {
-        return doPartitionIdx(n, _sharedData.aIdx + iStart, _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature), split.featureUnordered,
-                              idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _sharedData.ctx.dataHelper().indexedFeatures();
+        DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(indexedFeatures, return doPartitionIdx(n, _sharedData.aIdx + iStart,
+                                                                                 indexedFeatures.data<FeatureBinIndexType>(iFeature),
+                                                                                 split.featureUnordered, idxFeatureValueBestSplit,
+                                                                                 _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft));
+        return -1;
     }
 
-    DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const RowIndexType * indexedFeature, bool featureUnordered,
+    template <typename FeatureBinIndexType>
+    DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const FeatureBinIndexType * indexedFeature, bool featureUnordered,
                             RowIndexType idxFeatureValueBestSplit, RowIndexType * buffer, RowIndexType nLeft)
     {
         DAAL_INT iRowSplitVal = -1;
@@ -107,8 +107,8 @@ public:
 
     virtual void computeGHSums()
     {
-        const size_t nUnique                = _data.ctx.dataHelper().indexedFeatures().numIndices(_iFeature);
-        const RowIndexType * indexedFeature = (RowIndexType *)_data.ctx.dataHelper().indexedFeatures().data(_iFeature);
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _data.ctx.dataHelper().indexedFeatures();
+        const size_t nUnique                                      = indexedFeatures.numIndices(_iFeature);
 
         auto * aGHSum = _data.GH_SUMS_BUF->singleGHSums.get(_iFeature).getBlockFromStorage();
         DAAL_ASSERT(aGHSum); //TODO: return status
@@ -116,8 +116,10 @@ public:
         GHSums::fillByZero(nUnique, aGHSum);
         algorithmFPType gTotal = 0, hTotal = 0;
 
-        GHSums::compute(_node.iStart, _node.n, indexedFeature, _data.aIdx, _data.ctx.aSampleToF(), (algorithmFPType *)_data.ctx.grad(_data.iTree),
-                        aGHSum, gTotal, hTotal, _node.level);
+        DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(indexedFeatures,
+                                          GHSums::compute(_node.iStart, _node.n, indexedFeatures.data<FeatureBinIndexType>(_iFeature), _data.aIdx,
+                                                          _data.ctx.aSampleToF(), (algorithmFPType *)_data.ctx.grad(_data.iTree), aGHSum, gTotal,
+                                                          hTotal, _node.level));
 
         _res.ghSums   = aGHSum;
         _res.iFeature = _iFeature;
@@ -182,7 +184,11 @@ public:
         const size_t iStart = _data.GH_SUMS_BUF->nUniquesArr[_iFeature];
         const size_t iEnd   = iStart + nUnique;
 
-        MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+        if (_data.ctx.isQuantizedGHSums(_node1.n))
+            MergeQuantizedGHSums<algorithmFPType, cpu>::run(nUnique, iStart, _results, _size, _data.ctx.gradScale(_data.iTree),
+                                                            _data.ctx.hessScale(_data.iTree), _res1);
+        else
+            MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
 
         daal::threader_for(2, 2, [&](size_t iBlock) {
             if (iBlock == 0)
@@ -302,7 +308,11 @@ public:
         const size_t iStart = _data.GH_SUMS_BUF->nUniquesArr[_iFeature];
         const size_t iEnd   = iStart + nUnique;
 
-        MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+        if (_data.ctx.isQuantizedGHSums(_node1.n))
+            MergeQuantizedGHSums<algorithmFPType, cpu>::run(nUnique, iStart, _results, _size, _data.ctx.gradScale(_data.iTree),
+                                                            _data.ctx.hessScale(_data.iTree), _res1);
+        else
+            MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
 
         // TODO: check for hasDiffFeatureValues()
 
@@ -364,13 +374,25 @@ public:
         auto * local               = _res->local();
         GHSumType * aGHSum         = local->ghSum;
         algorithmFPType * aGHSumFP = (algorithmFPType *)local->ghSum;
+        const bool bQuantized      = _data.ctx.isQuantizedGHSums(_node.n);
 
         if (!local->isInitilized)
         {
-            GHSums::fillByZero(_data.GH_SUMS_BUF->nDiffFeatMax, aGHSum);
+            if (bQuantized)
+                services::internal::service_memset_seq<int32_t, cpu>((int32_t *)aGHSum, int32_t(0), _data.GH_SUMS_BUF->nDiffFeatMax * 4);
+            else
+                GHSums::fillByZero(_data.GH_SUMS_BUF->nDiffFeatMax, aGHSum);
             local->isInitilized = true;
         }
 
+        if (bQuantized)
+        {
+            ComputeQuantizedGHSumByRows<RowIndexType, BinIndexType, cpu>::run((int32_t *)aGHSum, indexedFeature, aIdx,
+                                                                              _data.ctx.quantizedGrad(_data.iTree), nFeatures, iStart, iEnd,
+                                                                              _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
+            return nullptr;
+        }
+
         algorithmFPType * pgh = (algorithmFPType *)_data.ctx.grad(_data.iTree);
         ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, iStart, iEnd,
                                                                                   _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
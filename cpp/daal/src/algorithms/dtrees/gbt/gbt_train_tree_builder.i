@@ -26,6 +26,7 @@
 #define __GBT_TRAIN_TREE_BUILDER_I__
 
 #include "src/algorithms/dtrees/dtrees_model_impl.h"
+#include "src/algorithms/service_heap.h"
 #include "src/algorithms/dtrees/dtrees_train_data_helper.i"
 #include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_train_aux.i"
@@ -232,19 +233,19 @@ protected:
         {
             using Mode    = MemorySafetySplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildTree<Updater>(data, job);
         }
         else if (_ctx.par().splitMethod == gbt::training::exact || _ctx.nFeatures() != _ctx.nFeaturesPerNode())
         {
             using Mode    = ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildTree<Updater>(data, job);
         }
         else
         {
             using Mode    = InexactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildTree<Updater>(data, job);
         }
 
         if (taskGroup()) taskGroup()->wait();
@@ -325,7 +326,33 @@ protected:
         pNode->impurity = imp.value(_ctx.par().lambda);
         return pNode;
     }
+    typename NodeType::Split * makeSplit(size_t iFeature, algorithmFPType featureValue, bool bUnordered)
+    {
+        typename NodeType::Split * pNode = nullptr;
+        if (_ctx.isThreaded())
+        {
+            _mtAlloc.lock();
+            pNode = _tree.allocator().allocSplit();
+            _mtAlloc.unlock();
+        }
+        else
+            pNode = _tree.allocator().allocSplit();
+        pNode->set(iFeature, featureValue, bUnordered);
+        return pNode;
+    }
+
+    template <typename UpdaterType>
+    void buildTree(typename UpdaterType::DataType & data, SplitJobType & job)
+    {
+        if (_ctx.par().maxLeafNodes)
+            buildLeafWise<UpdaterType>(data, job);
+        else
+            buildSplit(new (service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(data, job));
+    }
+
     void buildSplit(GbtTask * task);
+    template <typename UpdaterType>
+    void buildLeafWise(typename UpdaterType::DataType & data, SplitJobType & job);
 
 protected:
     CommonCtx & _ctx;
@@ -417,6 +444,98 @@ void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildSplit(G
     }
 }
 
+template <typename UpdaterType, CpuType cpu>
+struct LeafWiseCandidateLess
+{
+    bool operator()(const UpdaterType * a, const UpdaterType * b) const { return a->impurityDecrease() < b->impurityDecrease(); }
+};
+
+// Grows the tree best-first: the leaves with found splits are kept in the max-heap by the impurity decrease,
+// the best one is split and the splits of its kids are searched in parallel. The tree stops growing
+// when there are maxLeafNodes leaves, the rest of the candidates become leaves.
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+template <typename UpdaterType>
+void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildLeafWise(typename UpdaterType::DataType & data, SplitJobType & job)
+{
+    const size_t maxLeafNodes = _ctx.par().maxLeafNodes;
+    const algorithmFPType lambda(_ctx.par().lambda);
+    LeafWiseCandidateLess<UpdaterType, cpu> less;
+
+    // every candidate is a leaf of the tree, so there are at most maxLeafNodes of them
+    services::internal::TArray<UpdaterType *, cpu> heapArr(maxLeafNodes);
+    UpdaterType ** const heap = heapArr.get();
+    if (!heap) return;
+    size_t nCandidates = 0;
+    size_t nLeaves     = 1;
+
+    UpdaterType * kids[2] = { new (service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(data, job), nullptr };
+    bool bFound[2]        = { kids[0]->evaluateSplit(), false };
+    for (;;)
+    {
+        for (size_t i = 0; i < 2; ++i)
+        {
+            if (!kids[i]) continue;
+            if (bFound[i] && nCandidates < maxLeafNodes)
+            {
+                heap[nCandidates++] = kids[i];
+                daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + nCandidates, less);
+                continue;
+            }
+            SplitJobType & node = kids[i]->node();
+            node.res            = makeLeaf(data.aIdx + node.iStart, node.n, node.imp);
+            kids[i]->~UpdaterType();
+            service_scalable_free<UpdaterType, cpu>(kids[i]);
+        }
+        if (!nCandidates) break;
+
+        daal::algorithms::internal::popMaxHeap<cpu>(heap, heap + nCandidates, less);
+        UpdaterType * const best = heap[--nCandidates];
+        SplitJobType & node      = best->node();
+        if (nLeaves >= maxLeafNodes)
+        {
+            node.res = makeLeaf(data.aIdx + node.iStart, node.n, node.imp);
+            best->~UpdaterType();
+            service_scalable_free<UpdaterType, cpu>(best);
+            continue;
+        }
+
+        best->partition();
+        const SplitDataType & split = best->bestSplit();
+        ImpurityType impRight;
+        impRight.g = node.imp.g - split.left.g;
+        impRight.h = node.imp.h - split.left.h;
+
+        typename NodeType::Split * res = makeSplit(best->iFeature(), split.featureValue, split.featureUnordered);
+        res->count                     = node.n;
+        res->impurity                  = node.imp.value(lambda);
+        res->kid[0]                    = buildLeaf(node.iStart, split.nLeft, node.level + 1, split.left);
+        res->kid[1]                    = buildLeaf(node.iStart + split.nLeft, node.n - split.nLeft, node.level + 1, impRight);
+        node.res                       = res;
+        ++nLeaves;
+
+        kids[0] = kids[1] = nullptr;
+        bFound[0] = bFound[1] = false;
+        if (!res->kid[0])
+        {
+            SplitJobType left(node.iStart, split.nLeft, node.level + 1, split.left, res->kid[0]);
+            kids[0] = new (service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(data, left);
+        }
+        if (!res->kid[1])
+        {
+            SplitJobType right(node.iStart + split.nLeft, node.n - split.nLeft, node.level + 1, impRight, res->kid[1]);
+            kids[1] = new (service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(data, right);
+        }
+        best->~UpdaterType();
+        service_scalable_free<UpdaterType, cpu>(best);
+
+        if (nLeaves == maxLeafNodes) continue; // the kids become leaves
+
+        LoopHelper<cpu>::run(_ctx.isParallelNodes() && kids[0] && kids[1], 2, [&](size_t i) {
+            if (kids[i]) bFound[i] = kids[i]->evaluateSplit();
+        });
+    }
+}
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu> * TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::create(CommonCtx & ctx)
 {
@@ -129,6 +129,27 @@ public:
         kidsCreator.create(_iFeature, newTasks, nTasks);
     }
 
+    // Used by the leaf-wise growth: the best split of the node is found when the node is created,
+    // the node is partitioned later, when it is chosen to be split
+    bool evaluateSplit()
+    {
+        findBestSplit(_bestSplit, _iFeature, _idxFeatureValueBestSplit);
+        _result->release(_data);
+        _result = nullptr;
+        return _iFeature >= 0;
+    }
+
+    void partition()
+    {
+        PartitionTaskType partion(_iFeature, _idxFeatureValueBestSplit, _data, _node, _bestSplit);
+        partion.execute();
+    }
+
+    DAAL_INT iFeature() const { return _iFeature; }
+    const SplitDataType & bestSplit() const { return _bestSplit; }
+    NodeInfoType & node() { return _node; }
+    algorithmFPType impurityDecrease() const { return _bestSplit.impurityDecrease; }
+
 protected:
     const IndexType * chooseFeatures()
     {
@@ -171,6 +192,7 @@ protected:
     DataType & _data;
     NodeInfoType _node;
     DAAL_INT _iFeature;
+    DAAL_INT _idxFeatureValueBestSplit = -1;
     SplitDataType _bestSplit;
     MergedResultType * _result;
 };
@@ -251,8 +273,11 @@ public:
 
     using GHSumType = ghSum<algorithmFPType, cpu>;
 
-    MergedUpdaterByRows(DataType & data, NodeInfoType & node1, NodeInfoType & node2, MergedResult<ResultType, cpu> * _prevResult)
-        : super(data, node1), _node2(node2), _prevRes(_prevResult)
+    // bSplit1/bSplit2 are false for the kid which is already a leaf, its GHSums are only needed
+    // to get the ones of the sibling as the difference with the parent
+    MergedUpdaterByRows(DataType & data, NodeInfoType & node1, NodeInfoType & node2, MergedResult<ResultType, cpu> * _prevResult,
+                        bool bSplit1 = true, bool bSplit2 = true)
+        : super(data, node1), _node2(node2), _prevRes(_prevResult), _bSplit1(bSplit1), _bSplit2(bSplit2)
     {}
 
     virtual void findSplit(const RowIndexType * featureSample, BestSplitType & bestSplit) DAAL_C11_OVERRIDE {}
@@ -274,6 +299,9 @@ public:
             findBestSplit(_node2, _node1, _bestSplit2, _bestSplit1, _iFeature2, _iFeature1, idxFeatureValueBestSplit2, idxFeatureValueBestSplit1,
                           _result2, _result1);
 
+        if (!_bSplit1) _iFeature1 = -1;
+        if (!_bSplit2) _iFeature2 = -1;
+
         LoopHelper<cpu>::run(true, 2, [&](size_t i) {
             if (_iFeature1 >= 0 && i == 0)
             {
@@ -292,11 +320,25 @@ public:
 
     virtual void getNextTasks(GbtTask ** newTasks, size_t & nTasks) DAAL_C11_OVERRIDE
     {
-        NodesCreatorType kidsCreatorLeft(_data, _bestSplit1, _node1, _result1); // spawns 0 or 1 tasks
-        kidsCreatorLeft.create(_iFeature1, newTasks, nTasks);
+        if (_bSplit1)
+        {
+            NodesCreatorType kidsCreatorLeft(_data, _bestSplit1, _node1, _result1); // spawns 0 or 1 tasks
+            kidsCreatorLeft.create(_iFeature1, newTasks, nTasks);
+        }
+        else
+        {
+            _result1->release(_data);
+        }
 
-        NodesCreatorType kidsCreatorRight(_data, _bestSplit2, _node2, _result2); // spawns 0 or 1 tasks
-        kidsCreatorRight.create(_iFeature2, newTasks, nTasks);
+        if (_bSplit2)
+        {
+            NodesCreatorType kidsCreatorRight(_data, _bestSplit2, _node2, _result2); // spawns 0 or 1 tasks
+            kidsCreatorRight.create(_iFeature2, newTasks, nTasks);
+        }
+        else
+        {
+            _result2->release(_data);
+        }
 
         if (_prevRes)
         {
@@ -378,6 +420,9 @@ protected:
     MergedResult<ResultType, cpu> * _prevRes;
     MergedResult<ResultType, cpu> * _result1;
     MergedResult<ResultType, cpu> * _result2;
+
+    const bool _bSplit1;
+    const bool _bSplit2;
 };
 
 } /* namespace internal */
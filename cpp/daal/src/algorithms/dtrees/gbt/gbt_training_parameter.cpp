@@ -54,6 +54,9 @@ Parameter::Parameter()
       engine(engines::mt19937::Batch<>::create()),
       minBinSize(5),
       maxBins(256),
+      maxLeafNodes(0),
+      nIterationsNoImprovement(0),
+      gradientQuantizationBits(0),
       internalOptions(gbt::internal::parallelAll)
 {}
 
@@ -66,6 +69,8 @@ Status checkImpl(const gbt::training::Parameter & prm)
     DAAL_CHECK_EX((prm.observationsPerTreeFraction > 0) && (prm.observationsPerTreeFraction <= 1), ErrorIncorrectParameter, ParameterName,
                   observationsPerTreeFractionStr());
     DAAL_CHECK_EX(prm.minObservationsInLeafNode, ErrorIncorrectParameter, ParameterName, minObservationsInLeafNodeStr());
+    DAAL_CHECK_EX((prm.gradientQuantizationBits == 0) || (prm.gradientQuantizationBits == 8) || (prm.gradientQuantizationBits == 16),
+                  ErrorIncorrectParameter, ParameterName, gradientQuantizationBitsStr());
     if (prm.splitMethod == inexact)
     {
         DAAL_CHECK_EX((prm.maxBins >= 2), ErrorIncorrectParameter, ParameterName, maxBinsStr());
@@ -0,0 +1,177 @@
+/* file: gbt_batch_predict_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees prediction OpenCL kernels.
+//--
+*/
+
+#ifndef __GBT_BATCH_PREDICT_KERNELS_CL__
+#define __GBT_BATCH_PREDICT_KERNELS_CL__
+
+#include <string.h>
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    gbt_batch_predict_kernels,
+
+    // The trees are complete binary trees of maxLvl levels stored by levels,
+    // the node i has the kids 2 * i and 2 * i + 1 in 1-based numbering and
+    // the split points of the leaves hold their responses
+    __kernel void predictByTreesGroup(const __global algorithmFPType * data, const __global int * ftrIdx,
+                                      const __global algorithmFPType * splitPointOrResponse, const __global int * treeLvls,
+                                      const __global int * unorderedFtr, __global algorithmFPType * obsResponses, int nRows, int nCols, int nTrees,
+                                      int maxTreeSize, int treeOffset) {
+        const int local_id      = get_local_id(0);
+        const int local_size    = get_local_size(0);
+        const int n_groups      = get_num_groups(0);
+        const int group_id      = get_group_id(0);
+        const int n_tree_groups = get_num_groups(1);
+        const int tree_group_id = get_group_id(1);
+        const int tree_id       = treeOffset + tree_group_id;
+
+        const int nElementsForGroup = nRows / n_groups + !!(nRows % n_groups);
+
+        const int iStart = group_id * nElementsForGroup;
+        int iEnd         = (group_id + 1) * nElementsForGroup;
+
+        iEnd = (iEnd > nRows) ? nRows : iEnd;
+
+        if (tree_id < nTrees)
+        {
+            const __global int * ftrIdxForTree                           = ftrIdx + tree_id * maxTreeSize;
+            const __global algorithmFPType * splitPointOrResponseForTree = splitPointOrResponse + tree_id * maxTreeSize;
+            const int maxLvl                                             = treeLvls[tree_id];
+
+            for (int i = iStart + local_id; i < iEnd; i += local_size)
+            {
+                const __global algorithmFPType * x = data + i * nCols;
+                uint node                          = 1;
+                for (int lvl = 0; lvl < maxLvl; lvl++)
+                {
+                    const int ftr               = ftrIdxForTree[node - 1];
+                    const algorithmFPType split = splitPointOrResponseForTree[node - 1];
+                    const uint goRight          = unorderedFtr[ftr] ? (uint)((int)x[ftr] != (int)split) : (uint)(x[ftr] > split);
+                    node                        = node * 2 + goRight;
+                }
+                obsResponses[i * n_tree_groups + tree_group_id] += splitPointOrResponseForTree[node - 1];
+            }
+        }
+    }
+
+    // The tree groups are assigned to the responses cyclically, the response k
+    // of the row is the sum of the tree groups k, k + nResponses, ...
+    __kernel void reduceResponse(const __global algorithmFPType * obsResponses, __global algorithmFPType * resObsResponse, int nRows,
+                                 int nTreeGroups, int nResponses) {
+        const int group_id           = get_group_id(0);
+        const int n_groups           = get_num_groups(0);
+        const int sub_group_local_id = get_sub_group_local_id();
+        const int sub_group_size     = get_sub_group_size();
+
+        const int nElementsForGroup = nRows / n_groups + !!(nRows % n_groups);
+
+        const int iStart = group_id * nElementsForGroup;
+        int iEnd         = (group_id + 1) * nElementsForGroup;
+
+        iEnd = (iEnd > nRows) ? nRows : iEnd;
+
+        for (int rowIdx = iStart; rowIdx < iEnd; rowIdx++)
+        {
+            const int resp_offset = rowIdx * nTreeGroups;
+            for (int k = 0; k < nResponses; k++)
+            {
+                algorithmFPType resp_val = (algorithmFPType)0;
+                for (int i = k + sub_group_local_id * nResponses; i < nTreeGroups; i += sub_group_size * nResponses)
+                {
+                    resp_val += obsResponses[resp_offset + i];
+                }
+
+                resp_val = sub_group_reduce_add(resp_val);
+
+                if (0 == sub_group_local_id)
+                {
+                    resObsResponse[rowIdx * nResponses + k] = resp_val;
+                }
+            }
+        }
+    }
+
+    // The probability of the class 1 is sigmoid(f), so the label is given by the sign of f
+    __kernel void computeBinaryClasses(const __global algorithmFPType * responses, __global algorithmFPType * labels, int nRows) {
+        const int id = get_global_id(0);
+        if (id < nRows)
+        {
+            labels[id] = (responses[id] < (algorithmFPType)0) ? (algorithmFPType)0 : (algorithmFPType)1;
+        }
+    }
+
+    __kernel void computeBinaryProbabilities(const __global algorithmFPType * responses, __global algorithmFPType * probabilities, int nRows) {
+        const int id = get_global_id(0);
+        if (id < nRows)
+        {
+            const algorithmFPType prob1 = (algorithmFPType)1 / ((algorithmFPType)1 + exp(-responses[id]));
+            probabilities[2 * id]       = (algorithmFPType)1 - prob1;
+            probabilities[2 * id + 1]   = prob1;
+        }
+    }
+
+    // The first class with the largest response is chosen as in the CPU version
+    __kernel void computeMulticlassClasses(const __global algorithmFPType * responses, __global algorithmFPType * labels, int nRows,
+                                           int nClasses) {
+        const int id = get_global_id(0);
+        if (id < nRows)
+        {
+            const __global algorithmFPType * resp = responses + id * nClasses;
+            int maxClass                          = 0;
+            for (int k = 1; k < nClasses; k++)
+            {
+                maxClass = (resp[k] > resp[maxClass]) ? k : maxClass;
+            }
+            labels[id] = (algorithmFPType)maxClass;
+        }
+    }
+
+    __kernel void computeMulticlassProbabilities(const __global algorithmFPType * responses, __global algorithmFPType * probabilities, int nRows,
+                                                 int nClasses) {
+        const int id = get_global_id(0);
+        if (id < nRows)
+        {
+            const __global algorithmFPType * resp = responses + id * nClasses;
+            __global algorithmFPType * prob       = probabilities + id * nClasses;
+            algorithmFPType maxResp               = resp[0];
+            for (int k = 1; k < nClasses; k++)
+            {
+                maxResp = fmax(maxResp, resp[k]);
+            }
+            algorithmFPType sum = (algorithmFPType)0;
+            for (int k = 0; k < nClasses; k++)
+            {
+                prob[k] = exp(resp[k] - maxResp);
+                sum += prob[k];
+            }
+            for (int k = 0; k < nClasses; k++)
+            {
+                prob[k] /= sum;
+            }
+        }
+    }
+
+);
+
+#endif
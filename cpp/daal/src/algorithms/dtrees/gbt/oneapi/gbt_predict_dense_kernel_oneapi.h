@@ -0,0 +1,108 @@
+/* file: gbt_predict_dense_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that computes the responses of the gradient
+//  boosted trees on GPU.
+//--
+*/
+
+#ifndef __GBT_PREDICT_DENSE_KERNEL_ONEAPI_H__
+#define __GBT_PREDICT_DENSE_KERNEL_ONEAPI_H__
+
+#include "services/internal/sycl/types.h"
+#include "services/internal/sycl/execution_context.h"
+#include "data_management/data/numeric_table.h"
+#include "src/algorithms/dtrees/gbt/gbt_model_impl.h"
+#include "src/services/service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// PredictByTreesOneAPI. Computes the sums of the responses of the trees for every row,
+// the tree iTree contributes to the response iTree % nResponses of the row
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType>
+class PredictByTreesOneAPI
+{
+public:
+    PredictByTreesOneAPI() : _nTreeGroups(0) {}
+    PredictByTreesOneAPI(const PredictByTreesOneAPI &) = delete;
+    PredictByTreesOneAPI & operator=(const PredictByTreesOneAPI &) = delete;
+
+    static services::Status buildProgram(services::internal::sycl::ClKernelFactoryIface & factory);
+
+    services::Status predict(const services::internal::Buffer<algorithmFPType> & srcBuffer, const data_management::NumericTable & x,
+                             const gbt::internal::ModelImpl & model, size_t nTrees, size_t nResponses,
+                             services::internal::Buffer<algorithmFPType> & resObsResponse, size_t nRows, size_t nCols);
+
+protected:
+    services::Status predictByTreesGroup(const services::internal::Buffer<algorithmFPType> & srcBuffer,
+                                         const services::internal::sycl::UniversalBuffer & featureIndexList,
+                                         const services::internal::sycl::UniversalBuffer & featureValueList,
+                                         const services::internal::sycl::UniversalBuffer & treeLvlList,
+                                         const services::internal::sycl::UniversalBuffer & unorderedFeatureList,
+                                         services::internal::sycl::UniversalBuffer & obsResponses, size_t nRows, size_t nCols, size_t nTrees,
+                                         size_t maxTreeSize);
+    services::Status reduceResponse(const services::internal::sycl::UniversalBuffer & obsResponses,
+                                    services::internal::Buffer<algorithmFPType> & resObsResponse, size_t nRows, size_t nResponses);
+
+private:
+    static const uint32_t _preferableSubGroup = 16; // preferable maximal sub-group size
+    static const uint32_t _maxLocalSize       = 128;
+    static const uint32_t _maxGroupsNum       = 256;
+
+    // the same row blocking and tree groups as in the decision forest prediction
+    static const size_t _nRowsLarge  = 500000;
+    static const size_t _nRowsMedium = 100000;
+
+    static const size_t _nRowsBlocksForLarge  = 16;
+    static const size_t _nRowsBlocksForMedium = 8;
+
+    static const size_t _nTreesLarge  = 192;
+    static const size_t _nTreesMedium = 48;
+    static const size_t _nTreesSmall  = 12;
+
+    static const size_t _nTreeGroupsForLarge  = 128;
+    static const size_t _nTreeGroupsForMedium = 32;
+    static const size_t _nTreeGroupsForSmall  = 16;
+    static const size_t _nTreeGroupsMin       = 8;
+
+    static constexpr size_t _int32max = static_cast<size_t>(services::internal::MaxVal<int32_t>::get());
+
+    size_t _nTreeGroups;
+
+    services::internal::sycl::KernelPtr kernelPredictByTreesGroup;
+    services::internal::sycl::KernelPtr kernelReduceResponse;
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
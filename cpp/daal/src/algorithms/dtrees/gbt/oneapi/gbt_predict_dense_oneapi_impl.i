@@ -0,0 +1,323 @@
+/* file: gbt_predict_dense_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class that computes the responses of the gradient
+//  boosted trees on GPU.
+//--
+*/
+
+#ifndef __GBT_PREDICT_DENSE_ONEAPI_IMPL_I__
+#define __GBT_PREDICT_DENSE_ONEAPI_IMPL_I__
+
+#include "src/algorithms/dtrees/gbt/oneapi/gbt_predict_dense_kernel_oneapi.h"
+#include "src/algorithms/dtrees/gbt/oneapi/cl_kernels/gbt_batch_predict_kernels.cl"
+
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
+#include "src/externals/service_ittnotify.h"
+#include "services/internal/buffer.h"
+#include "data_management/data/numeric_table.h"
+#include "src/data_management/service_numeric_table.h"
+#include "services/env_detect.h"
+#include "services/error_indexes.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_algo_utils.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_utils.h"
+#include "services/internal/sycl/types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::services::internal::sycl;
+
+template <typename algorithmFPType>
+services::Status PredictByTreesOneAPI<algorithmFPType>::buildProgram(ClKernelFactoryIface & factory)
+{
+    services::Status status;
+
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.buildProgram);
+    {
+        auto fptype_name   = services::internal::sycl::getKeyFPType<algorithmFPType>();
+        auto build_options = fptype_name;
+        build_options.add(" -cl-std=CL1.2 ");
+
+        services::String cachekey("__daal_algorithms_gbt_batch_predict_");
+        cachekey.add(build_options);
+        cachekey.add("predict_kernels");
+
+        factory.build(ExecutionTargetIds::device, cachekey.c_str(), gbt_batch_predict_kernels, build_options.c_str());
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status PredictByTreesOneAPI<algorithmFPType>::predict(const services::internal::Buffer<algorithmFPType> & srcBuffer,
+                                                                const data_management::NumericTable & x, const gbt::internal::ModelImpl & model,
+                                                                size_t nTrees, size_t nResponses,
+                                                                services::internal::Buffer<algorithmFPType> & resObsResponse, size_t nRows,
+                                                                size_t nCols)
+{
+    services::Status status;
+
+    DAAL_ASSERT(nTrees <= model.size());
+    DAAL_ASSERT(nResponses > 0);
+
+    if (nRows > _int32max)
+    {
+        return services::Status(services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+    }
+    if (nCols > _int32max)
+    {
+        return services::Status(services::ErrorIncorrectNumberOfColumnsInInputNumericTable);
+    }
+    if (nTrees > _int32max)
+    {
+        return services::Status(services::ErrorIncorrectSizeOfModel);
+    }
+
+    auto & context        = services::internal::getDefaultContext();
+    auto & kernel_factory = context.getClKernelFactory();
+
+    DAAL_CHECK_STATUS_VAR(buildProgram(kernel_factory));
+
+    kernelPredictByTreesGroup = kernel_factory.getKernel("predictByTreesGroup", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    kernelReduceResponse = kernel_factory.getKernel("reduceResponse", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    _nTreeGroups = _nTreeGroupsMin;
+
+    if (nTrees > _nTreesLarge)
+    {
+        _nTreeGroups = _nTreeGroupsForLarge;
+    }
+    else if (nTrees > _nTreesMedium)
+    {
+        _nTreeGroups = _nTreeGroupsForMedium;
+    }
+    else if (nTrees > _nTreesSmall)
+    {
+        _nTreeGroups = _nTreeGroupsForSmall;
+    }
+    // every tree group shall contribute to the single response
+    _nTreeGroups = ((_nTreeGroups + nResponses - 1) / nResponses) * nResponses;
+
+    size_t maxTreeSize = 0;
+    for (size_t i = 0; i < nTrees; ++i)
+    {
+        const size_t treeSize = model.at(i)->getNumberOfNodes();
+        maxTreeSize           = maxTreeSize < treeSize ? treeSize : maxTreeSize;
+    }
+    if (maxTreeSize > _int32max)
+    {
+        return services::Status(services::ErrorIncorrectSizeOfModel);
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, maxTreeSize, nTrees);
+    const size_t treeBlockSize = maxTreeSize * nTrees;
+
+    daal::internal::TArray<int32_t, sse2> tFI(treeBlockSize);
+    daal::internal::TArray<algorithmFPType, sse2> tFV(treeBlockSize);
+    daal::internal::TArray<int32_t, sse2> tLvl(nTrees);
+    daal::internal::TArray<int32_t, sse2> tUnordered(nCols);
+    DAAL_CHECK_MALLOC(tFI.get() && tFV.get() && tLvl.get() && tUnordered.get());
+
+    for (size_t iTree = 0; iTree < nTrees; iTree++)
+    {
+        const gbt::internal::GbtDecisionTree * const tree = model.at(iTree);
+        const size_t treeSize                             = tree->getNumberOfNodes();
+        const FeatureIndexType * const featureIndexes     = tree->getFeatureIndexesForSplit();
+        const ModelFPType * const splitPoints             = tree->getSplitPoints();
+
+        int32_t * const fi         = tFI.get() + iTree * maxTreeSize;
+        algorithmFPType * const fv = tFV.get() + iTree * maxTreeSize;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < treeSize; i++)
+        {
+            fi[i] = static_cast<int32_t>(featureIndexes[i]);
+            fv[i] = static_cast<algorithmFPType>(splitPoints[i]);
+        }
+        for (size_t i = treeSize; i < maxTreeSize; i++)
+        {
+            fi[i] = 0;
+            fv[i] = algorithmFPType(0);
+        }
+        tLvl[iTree] = static_cast<int32_t>(tree->getMaxLvl());
+    }
+
+    dtrees::internal::FeatureTypes featTypes;
+    DAAL_CHECK_MALLOC(featTypes.init(x));
+    for (size_t i = 0; i < nCols; i++)
+    {
+        tUnordered[i] = featTypes.isUnordered(i) ? 1 : 0;
+    }
+
+    auto ftrIdxArr = context.allocate(TypeIds::id<int>(), treeBlockSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    auto ftrValueOrResponseArr = context.allocate(TypeIds::id<algorithmFPType>(), treeBlockSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    auto treeLvlArr = context.allocate(TypeIds::id<int>(), nTrees, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    auto unorderedFtrArr = context.allocate(TypeIds::id<int>(), nCols, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    context.copy(ftrIdxArr, 0, (void *)tFI.get(), 0, treeBlockSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    context.copy(ftrValueOrResponseArr, 0, (void *)tFV.get(), 0, treeBlockSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    context.copy(treeLvlArr, 0, (void *)tLvl.get(), 0, nTrees, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    context.copy(unorderedFtrArr, 0, (void *)tUnordered.get(), 0, nCols, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, _nTreeGroups);
+    auto obsResponses = context.allocate(TypeIds::id<algorithmFPType>(), nRows * _nTreeGroups, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    context.fill(obsResponses, (algorithmFPType)0, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    DAAL_CHECK_STATUS_VAR(predictByTreesGroup(srcBuffer, ftrIdxArr, ftrValueOrResponseArr, treeLvlArr, unorderedFtrArr, obsResponses, nRows, nCols,
+                                              nTrees, maxTreeSize));
+    DAAL_CHECK_STATUS_VAR(reduceResponse(obsResponses, resObsResponse, nRows, nResponses));
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status PredictByTreesOneAPI<algorithmFPType>::predictByTreesGroup(const services::internal::Buffer<algorithmFPType> & srcBuffer,
+                                                                            const UniversalBuffer & featureIndexList,
+                                                                            const UniversalBuffer & featureValueList,
+                                                                            const UniversalBuffer & treeLvlList,
+                                                                            const UniversalBuffer & unorderedFeatureList,
+                                                                            UniversalBuffer & obsResponses, size_t nRows, size_t nCols,
+                                                                            size_t nTrees, size_t maxTreeSize)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.predictByTreesGroup);
+
+    services::Status status;
+
+    auto & context = services::internal::getDefaultContext();
+    auto & kernel  = kernelPredictByTreesGroup;
+
+    size_t localSize   = _maxLocalSize;
+    size_t nRowsBlocks = 1;
+    if (nRows > _nRowsLarge)
+    {
+        nRowsBlocks = _nRowsBlocksForLarge;
+    }
+    else if (nRows > _nRowsMedium)
+    {
+        nRowsBlocks = _nRowsBlocksForMedium;
+    }
+    {
+        KernelRange local_range(localSize, 1);
+        KernelRange global_range(nRowsBlocks * localSize, _nTreeGroups);
+
+        KernelNDRange range(2);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        DAAL_ASSERT(nRows <= _int32max);
+        DAAL_ASSERT(nCols <= _int32max);
+        DAAL_ASSERT(nTrees <= _int32max);
+        DAAL_ASSERT(maxTreeSize <= _int32max);
+
+        for (size_t procTrees = 0; procTrees < nTrees; procTrees += _nTreeGroups)
+        {
+            KernelArguments args(11);
+            args.set(0, srcBuffer, AccessModeIds::read);
+            args.set(1, featureIndexList, AccessModeIds::read);
+            args.set(2, featureValueList, AccessModeIds::read);
+            args.set(3, treeLvlList, AccessModeIds::read);
+            args.set(4, unorderedFeatureList, AccessModeIds::read);
+            args.set(5, obsResponses, AccessModeIds::readwrite);
+            args.set(6, static_cast<int32_t>(nRows));
+            args.set(7, static_cast<int32_t>(nCols));
+            args.set(8, static_cast<int32_t>(nTrees));
+            args.set(9, static_cast<int32_t>(maxTreeSize));
+            args.set(10, static_cast<int32_t>(procTrees));
+
+            context.run(range, kernel, args, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+        }
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status PredictByTreesOneAPI<algorithmFPType>::reduceResponse(const UniversalBuffer & obsResponses,
+                                                                       services::internal::Buffer<algorithmFPType> & resObsResponse, size_t nRows,
+                                                                       size_t nResponses)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.reduceResponse);
+
+    services::Status status;
+
+    auto & context = services::internal::getDefaultContext();
+    auto & kernel  = kernelReduceResponse;
+
+    size_t localSize = _preferableSubGroup;
+    size_t nGroups   = _maxGroupsNum;
+    {
+        DAAL_ASSERT(nRows <= _int32max);
+        DAAL_ASSERT(_nTreeGroups <= _int32max);
+
+        KernelArguments args(5);
+        args.set(0, obsResponses, AccessModeIds::read);
+        args.set(1, resObsResponse, AccessModeIds::write);
+        args.set(2, static_cast<int32_t>(nRows));
+        args.set(3, static_cast<int32_t>(_nTreeGroups));
+        args.set(4, static_cast<int32_t>(nResponses));
+
+        KernelRange local_range(localSize);
+        KernelRange global_range(nGroups * localSize);
+
+        KernelNDRange range(1);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -25,7 +25,10 @@
 
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict.h"
 #include "src/algorithms/dtrees/gbt/regression/gbt_regression_predict_kernel.h"
+#include "src/algorithms/dtrees/gbt/regression/gbt_regression_model_impl.h"
+#include "src/algorithms/dtrees/gbt/regression/oneapi/gbt_regression_predict_dense_kernel_oneapi.h"
 #include "src/services/service_algo_utils.h"
+#include "src/algorithms/prepared_prediction_container.h"
 
 namespace daal
 {
@@ -40,7 +43,17 @@ namespace prediction
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv) : PredictionContainerIface()
 {
-    __DAAL_INITIALIZE_KERNELS(internal::PredictKernel, algorithmFPType, method);
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (!deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::PredictKernelOneAPI, algorithmFPType, method);
+    }
+    else
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::PredictKernel, algorithmFPType, method);
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -52,6 +65,9 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
     Input * input   = static_cast<Input *>(_in);
     Result * result = static_cast<Result *>(_res);
 
@@ -61,10 +77,78 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     const gbt::regression::prediction::Parameter * par = static_cast<gbt::regression::prediction::Parameter *>(_par);
 
     daal::services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+
+    if (!deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL_SYCL(env, internal::PredictKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                                daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+    }
+    else
+    {
+        __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                           daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+    }
 }
 
+namespace internal
+{
+/**
+ *  \brief Container of the gradient boosted trees prediction prepared for one model
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class PreparedPredictionContainer : public algorithms::internal::PreparedPredictionContainerIface<algorithmFPType>
+{
+public:
+    typedef algorithms::internal::PreparedRowsTable<algorithmFPType, cpu> RowsTable;
+
+    PreparedPredictionContainer(daal::services::Environment::env * daalEnv)
+        : algorithms::internal::PreparedPredictionContainerIface<algorithmFPType>(daalEnv), _nFeatures(0)
+    {
+        __DAAL_REGISTER_ISA_CONTAINER
+    }
+
+    /* Checks the model and the parameter as Input::check() does and collects the trees of the model */
+    services::Status setupCompute() DAAL_C11_OVERRIDE
+    {
+        const Input * input               = static_cast<const Input *>(this->_in);
+        const Parameter * par             = static_cast<const Parameter *>(this->_par);
+        const gbt::regression::ModelPtr m = input->get(model);
+        DAAL_CHECK(m.get(), services::ErrorNullModel);
+        const gbt::regression::internal::ModelImpl * pModel = static_cast<const gbt::regression::internal::ModelImpl *>(m.get());
+        DAAL_CHECK(pModel->getNumberOfTrees(), services::ErrorNullModel);
+        DAAL_CHECK((par->nIterations == 0) || (par->nIterations <= pModel->getNumberOfTrees()),
+                   services::ErrorGbtPredictIncorrectNumberOfIterations);
+        _nFeatures = pModel->getNumberOfFeatures();
+        DAAL_CHECK(_nFeatures, services::ErrorIncorrectNumberOfFeatures);
+
+        services::Status s;
+        _xDictionary = RowsTable::createDictionary(_nFeatures, s);
+        _yDictionary = RowsTable::createDictionary(1, s);
+        DAAL_CHECK_STATUS_VAR(s);
+        RowsTable x(_xDictionary, nullptr, 0, s);
+        DAAL_CHECK_STATUS_VAR(s);
+        return _kernel.init(pModel, par->nIterations, x);
+    }
+
+    services::Status predict(const algorithmFPType * x, size_t nRows, algorithmFPType * y) const DAAL_C11_OVERRIDE
+    {
+        if (!nRows) return services::Status();
+        DAAL_CHECK(x && y, services::ErrorNullPtr);
+        services::Status s;
+        const RowsTable xTable(_xDictionary, x, nRows, s);
+        RowsTable yTable(_yDictionary, y, nRows, s);
+        DAAL_CHECK_STATUS_VAR(s);
+        return _kernel.compute(&xTable, &yTable);
+    }
+
+private:
+    size_t _nFeatures;
+    data_management::NumericTableDictionaryPtr _xDictionary;
+    data_management::NumericTableDictionaryPtr _yDictionary;
+    PreparedPredictKernel<algorithmFPType, method, cpu> _kernel;
+};
+
+} // namespace internal
 } // namespace prediction
 } // namespace regression
 } // namespace gbt
@@ -42,6 +42,8 @@ template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 namespace internal
 {
 template class PredictKernel<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class PreparedPredictKernel<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class PreparedPredictionContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 }
 } // namespace prediction
 } // namespace regression
@@ -30,6 +30,8 @@ namespace daal
 namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(gbt::regression::prediction::BatchContainer, batch, DAAL_FPTYPE, gbt::regression::prediction::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(gbt::regression::prediction::internal::PreparedPredictionContainer, batch, DAAL_FPTYPE,
+                                      gbt::regression::prediction::defaultDense)
 namespace gbt
 {
 namespace regression
@@ -52,6 +54,64 @@ Batch<DAAL_FPTYPE, gbt::regression::prediction::defaultDense>::Batch(const Batch
     _par = new ParameterType(other.parameter());
     initialize();
 }
+
+typedef algorithms::internal::PreparedPredictionDispatcher<__DAAL_ALGORITHM_CONTAINER(batch, internal::PreparedPredictionContainer, DAAL_FPTYPE,
+                                                                                      gbt::regression::prediction::defaultDense),
+                                                           DAAL_FPTYPE>
+    PreparedDispatcherType;
+using PreparedPredictorType = PreparedPredictor<DAAL_FPTYPE, gbt::regression::prediction::defaultDense>;
+
+template <>
+PreparedPredictorType::PreparedPredictor(const gbt::regression::ModelPtr & model, const ParameterType & parameter, services::Status & st)
+    : _model(model), _parameter(parameter), _ac(nullptr)
+{
+    const int cpuid = (int)daal::services::Environment::getInstance()->getCpuId();
+    if (cpuid < 0)
+    {
+        st |= services::Status(services::ErrorCpuNotSupported);
+        return;
+    }
+    _env.cpuid           = cpuid;
+    _env.cpuid_init_flag = true;
+
+    _ac = new PreparedDispatcherType(&_env);
+    if (!_ac)
+    {
+        st |= services::Status(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    Input input;
+    input.set(prediction::model, _model);
+    _ac->setArguments(&input, nullptr, &_parameter);
+    st |= _ac->setupCompute();
+    /* the container keeps no pointers to the input after the preparation */
+    _ac->setArguments(nullptr, nullptr, &_parameter);
+}
+
+template <>
+PreparedPredictorType::~PreparedPredictor()
+{
+    delete _ac;
+}
+
+template <>
+PreparedPredictorType::PreparedPredictorPtr PreparedPredictorType::create(const gbt::regression::ModelPtr & model, const ParameterType & parameter,
+                                                                          services::Status * stat)
+{
+    if (!model.get())
+    {
+        if (stat) stat->add(services::ErrorNullModel);
+        return PreparedPredictorPtr();
+    }
+    DAAL_DEFAULT_CREATE_IMPL_EX(PreparedPredictor, model, parameter);
+}
+
+template <>
+services::Status PreparedPredictorType::predict(const DAAL_FPTYPE * x, size_t nRows, DAAL_FPTYPE * y) const
+{
+    return static_cast<const PreparedDispatcherType *>(_ac)->get()->predict(x, nRows, y);
+}
 } // namespace interface1
 } // namespace prediction
 } // namespace regression
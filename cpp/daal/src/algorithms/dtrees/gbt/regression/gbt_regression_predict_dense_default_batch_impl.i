@@ -64,10 +64,13 @@ public:
     PredictRegressionTask(const NumericTable * x, NumericTable * y) : _data(x), _res(y) {}
     services::Status run(const gbt::regression::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp);
 
+    /* Collects the trees and the types of the features of the data, x is used only for its dictionary */
+    services::Status init(const gbt::regression::internal::ModelImpl * m, size_t nIterations, const NumericTable & x);
+    services::Status runInternal(services::HostAppIface * pHostApp, const NumericTable * data, NumericTable * result) const;
+
 protected:
-    services::Status runInternal(services::HostAppIface * pHostApp, NumericTable * result);
-    algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x);
-    void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, algorithmFPType * res);
+    algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x) const;
+    void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, algorithmFPType * res) const;
 
 protected:
     dtrees::internal::FeatureTypes _featHelper;
@@ -89,25 +92,61 @@ services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::
     return task.run(pModel, nIterations, pHostApp);
 }
 
+template <typename algorithmFPType, prediction::Method method, CpuType cpu>
+PreparedPredictKernel<algorithmFPType, method, cpu>::PreparedPredictKernel() : _task(nullptr)
+{}
+
+template <typename algorithmFPType, prediction::Method method, CpuType cpu>
+PreparedPredictKernel<algorithmFPType, method, cpu>::~PreparedPredictKernel()
+{
+    delete _task;
+}
+
+template <typename algorithmFPType, prediction::Method method, CpuType cpu>
+services::Status PreparedPredictKernel<algorithmFPType, method, cpu>::init(const regression::Model * m, size_t nIterations, const NumericTable & x)
+{
+    delete _task;
+    _task = new PredictRegressionTask<algorithmFPType, cpu>(nullptr, nullptr);
+    DAAL_CHECK_MALLOC(_task);
+    return _task->init(static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m), nIterations, x);
+}
+
+template <typename algorithmFPType, prediction::Method method, CpuType cpu>
+services::Status PreparedPredictKernel<algorithmFPType, method, cpu>::compute(const NumericTable * x, NumericTable * r) const
+{
+    DAAL_ASSERT(_task);
+    return _task->runInternal(nullptr, x, r);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::regression::internal::ModelImpl * m, size_t nIterations,
                                                                   services::HostAppIface * pHostApp)
+{
+    services::Status s = init(m, nIterations, *this->_data);
+    if (!s) return s;
+    return runInternal(pHostApp, this->_data, this->_res);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::init(const gbt::regression::internal::ModelImpl * m, size_t nIterations,
+                                                                   const NumericTable & x)
 {
     DAAL_ASSERT(nIterations || nIterations <= m->size());
-    DAAL_CHECK_MALLOC(this->_featHelper.init(*this->_data));
+    DAAL_CHECK_MALLOC(this->_featHelper.init(x));
     const auto nTreesTotal = (nIterations ? nIterations : m->size());
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
-    return runInternal(pHostApp, this->_res);
+    return services::Status();
 }
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(services::HostAppIface * pHostApp, NumericTable * result)
+services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(services::HostAppIface * pHostApp, const NumericTable * data,
+                                                                          NumericTable * result) const
 {
     const auto nTreesTotal = this->_aTree.size();
 
-    gbt::prediction::internal::TileDimensions<algorithmFPType> dim(*this->_data, nTreesTotal);
+    gbt::prediction::internal::TileDimensions<algorithmFPType> dim(*data, nTreesTotal);
     WriteOnlyRows<algorithmFPType, cpu> resBD(result, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(resBD);
     services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
@@ -122,7 +161,7 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
         daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
-            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(this->_data), iStartRow, nRowsToProcess);
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
             algorithmFPType * res = resBD.get() + iStartRow;
 
@@ -144,7 +183,7 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
 }
 
 template <typename algorithmFPType, CpuType cpu>
-algorithmFPType PredictRegressionTask<algorithmFPType, cpu>::predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x)
+algorithmFPType PredictRegressionTask<algorithmFPType, cpu>::predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x) const
 {
     algorithmFPType val = 0;
     for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
@@ -154,7 +193,7 @@ algorithmFPType PredictRegressionTask<algorithmFPType, cpu>::predictByTrees(size
 
 template <typename algorithmFPType, CpuType cpu>
 void PredictRegressionTask<algorithmFPType, cpu>::predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x,
-                                                                       algorithmFPType * res)
+                                                                       algorithmFPType * res) const
 {
     algorithmFPType v[VECTOR_BLOCK_SIZE];
     for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
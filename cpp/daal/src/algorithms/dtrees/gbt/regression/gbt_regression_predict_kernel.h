@@ -60,6 +60,38 @@ public:
                              size_t nIterations);
 };
 
+template <typename algorithmFpType, CpuType cpu>
+class PredictRegressionTask;
+
+/**
+ *  \brief Gradient boosted trees prediction prepared for one model: the trees and the types of the features are collected
+ *         once by init(), then compute() only runs the trees on the rows. compute() changes no state of the kernel and
+ *         is called by many threads concurrently
+ */
+template <typename algorithmFpType, gbt::regression::prediction::Method method, CpuType cpu>
+class PreparedPredictKernel : public daal::algorithms::Kernel
+{
+public:
+    PreparedPredictKernel();
+    ~PreparedPredictKernel();
+
+    /**
+     *  \param m[in]            gradient boosted trees model obtained on training stage
+     *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param x[in]            Table with the dictionary of the rows passed to compute(), its values are not used
+     */
+    services::Status init(const regression::Model * m, size_t nIterations, const NumericTable & x);
+
+    /**
+     *  \param a[in]    Matrix of input variables X with the dictionary passed to init()
+     *  \param r[out]   Prediction results
+     */
+    services::Status compute(const NumericTable * a, NumericTable * r) const;
+
+private:
+    PredictRegressionTask<algorithmFpType, cpu> * _task;
+};
+
 } // namespace internal
 } // namespace prediction
 } // namespace regression
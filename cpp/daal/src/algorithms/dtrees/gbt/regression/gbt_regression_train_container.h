@@ -88,6 +88,9 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     const NumericTable * x = input->get(data).get();
     const NumericTable * y = input->get(dependentVariable).get();
 
+    const NumericTable * xValid = input->get(validationData).get();
+    const NumericTable * yValid = input->get(validationDependentVariable).get();
+
     gbt::regression::Model * m = result->get(model).get();
 
     const Parameter * par                  = static_cast<gbt::regression::training::Parameter *>(_par);
@@ -98,7 +101,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     if (deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::RegressionTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                           daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+                           daal::services::internal::hostApp(*input), x, y, xValid, yValid, *m, *result, *par, *engine);
     }
     else
     {
@@ -85,6 +85,30 @@ public:
             }
         });
     }
+
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType * y, const algorithmFPType * f) DAAL_C11_OVERRIDE
+    {
+        const algorithmFPType div = algorithmFPType(0.5) / algorithmFPType(n);
+        const size_t nThreads     = daal::threader_get_threads_number();
+        const size_t nBlocks      = getNBlocksForOpt<cpu>(nThreads, n);
+        const size_t nPerBlock    = n / nBlocks;
+        const size_t nSurplus     = n % nBlocks;
+        const bool inParallel     = nBlocks > 1;
+        services::internal::TArray<algorithmFPType, cpu> pvalsArr(nBlocks);
+        algorithmFPType * const pvals = pvalsArr.get();
+        if (!pvals) return algorithmFPType(0);
+        LoopHelper<cpu>::run(inParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start    = iBlock + 1 > nSurplus ? nPerBlock * iBlock + nSurplus : (nPerBlock + 1) * iBlock;
+            const size_t end      = iBlock + 1 > nSurplus ? start + nPerBlock : start + (nPerBlock + 1);
+            algorithmFPType lpval = 0;
+            PRAGMA_ICC_NO16(omp simd reduction(+ : lpval))
+            for (size_t i = start; i < end; i++) lpval += div * (f[i] - y[i]) * (f[i] - y[i]);
+            pvals[iBlock] = lpval;
+        });
+        algorithmFPType val = 0;
+        for (size_t i = 0; i < nBlocks; i++) val += pvals[i];
+        return val;
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -166,8 +190,10 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
 services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(HostAppIface * pHostApp, const NumericTable * x,
-                                                                                   const NumericTable * y, gbt::regression::Model & m, Result & res,
-                                                                                   const Parameter & par, engines::internal::BatchBaseImpl & engine)
+                                                                                   const NumericTable * y, const NumericTable * xValid,
+                                                                                   const NumericTable * yValid, gbt::regression::Model & m,
+                                                                                   Result & res, const Parameter & par,
+                                                                                   engines::internal::BatchBaseImpl & engine)
 {
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod =
@@ -218,22 +244,22 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
-                featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHostApp, x, y, xValid, yValid, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1,
+                indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
-                featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHostApp, x, y, xValid, yValid, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1,
+                indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
-                featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHostApp, x, y, xValid, yValid, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1,
+                indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-            pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures, featTypes,
-            &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+            pHostApp, x, y, xValid, yValid, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1,
+            indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
 }
 
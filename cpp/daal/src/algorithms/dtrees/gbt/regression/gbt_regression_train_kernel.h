@@ -49,8 +49,9 @@ template <typename algorithmFPType, Method method, CpuType cpu>
 class RegressionTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::regression::Model & m, Result & res,
-                             const Parameter & par, engines::internal::BatchBaseImpl & engine);
+    services::Status compute(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const NumericTable * xValid,
+                             const NumericTable * yValid, gbt::regression::Model & m, Result & res, const Parameter & par,
+                             engines::internal::BatchBaseImpl & engine);
 };
 
 } // namespace internal
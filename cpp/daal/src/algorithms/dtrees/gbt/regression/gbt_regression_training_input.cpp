@@ -94,6 +94,19 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
     DAAL_CHECK_EX(nSamplesPerTree > 0, ErrorIncorrectParameter, ParameterName, observationsPerTreeFractionStr());
     const auto nFeatures = dataTable->getNumberOfColumns();
     DAAL_CHECK_EX(parameter->featuresPerNode <= nFeatures, ErrorIncorrectParameter, ParameterName, featuresPerNodeStr());
+
+    const NumericTablePtr validationDataTable = get(validationData);
+    if (validationDataTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(validationDataTable.get(), validationDataStr(), 0, 0, nFeatures));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(validationDependentVariable).get(), validationDependentVariableStr(), 0, 0, 1,
+                                               validationDataTable->getNumberOfRows()));
+    }
+    else
+    {
+        DAAL_CHECK_EX(get(validationDependentVariable).get() == nullptr, ErrorIncorrectOptionalInput, ArgumentName,
+                      validationDependentVariableStr());
+    }
     return s;
 }
 
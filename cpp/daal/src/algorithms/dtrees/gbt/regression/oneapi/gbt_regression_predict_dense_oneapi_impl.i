@@ -0,0 +1,91 @@
+/* file: gbt_regression_predict_dense_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees regression prediction on GPU.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_PREDICT_DENSE_ONEAPI_IMPL_I__
+#define __GBT_REGRESSION_PREDICT_DENSE_ONEAPI_IMPL_I__
+
+#include "src/algorithms/dtrees/gbt/regression/oneapi/gbt_regression_predict_dense_kernel_oneapi.h"
+#include "src/algorithms/dtrees/gbt/oneapi/gbt_predict_dense_oneapi_impl.i"
+#include "src/algorithms/dtrees/gbt/regression/gbt_regression_model_impl.h"
+
+#include "src/externals/service_ittnotify.h"
+#include "services/internal/buffer.h"
+#include "data_management/data/numeric_table.h"
+#include "src/data_management/service_numeric_table.h"
+#include "services/error_indexes.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace prediction
+{
+namespace internal
+{
+template <typename algorithmFPType, prediction::Method method>
+services::Status PredictKernelOneAPI<algorithmFPType, method>::compute(services::HostAppIface * const pHostApp, const NumericTable * const x,
+                                                                       const regression::Model * const m, NumericTable * const res,
+                                                                       size_t nIterations)
+{
+    services::Status status;
+
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nCols = x->getNumberOfColumns();
+
+    const daal::algorithms::gbt::regression::internal::ModelImpl * const pModel =
+        static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m);
+
+    DAAL_ASSERT(!nIterations || nIterations <= pModel->size());
+    const size_t nTrees = (nIterations ? nIterations : pModel->size());
+
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS_VAR(const_cast<NumericTable *>(x)->getBlockOfRows(0, nRows, readOnly, dataBlock));
+
+    BlockDescriptor<algorithmFPType> resBlock;
+    DAAL_CHECK_STATUS_VAR(const_cast<NumericTable *>(res)->getBlockOfRows(0, nRows, writeOnly, resBlock));
+
+    auto dataBuffer = dataBlock.getBuffer();
+    auto resBuffer  = resBlock.getBuffer();
+
+    DAAL_CHECK_STATUS_VAR(_predictByTrees.predict(dataBuffer, *x, *pModel, nTrees, 1, resBuffer, nRows, nCols));
+
+    DAAL_CHECK_STATUS_VAR(const_cast<NumericTable *>(x)->releaseBlockOfRows(dataBlock));
+    DAAL_CHECK_STATUS_VAR(const_cast<NumericTable *>(res)->releaseBlockOfRows(resBlock));
+
+    return status;
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace regression */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -27,6 +27,7 @@
 #include "algorithms/em/em_gmm.h"
 #include "src/algorithms/em/em_gmm_dense_default_batch_kernel.h"
 #include "src/data_management/service_numeric_table.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -81,8 +82,9 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     daal::services::Environment::env & env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::EMKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *dataTable, *initialWeights, *initialMeans,
-                       initialCovariances, *resultWeights, *resultMeans, resultCovariances, *resultNIterations, *resultGoalFunction, *emPar)
+    __DAAL_CALL_KERNEL(env, internal::EMKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input),
+                       *dataTable, *initialWeights, *initialMeans, initialCovariances, *resultWeights, *resultMeans, resultCovariances,
+                       *resultNIterations, *resultGoalFunction, *emPar)
 }
 
 } // namespace em_gmm
@@ -29,6 +29,7 @@
 #include "src/algorithms/em/em_gmm_dense_default_batch_task.h"
 #include "src/threading/threading.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/services/service_algo_utils.h"
 #include "src/services/service_utils.h"
 
 using namespace daal::internal;
@@ -47,14 +48,15 @@ namespace internal
  * Function computes expectation-maximization algorithm for Gaussian Mixture Model.
  */
 template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status EMKernel<algorithmFPType, method, cpu>::compute(NumericTable & dataTable, NumericTable & initialWeights, NumericTable & initialMeans,
+services::Status EMKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHost, NumericTable & dataTable,
+                                                                 NumericTable & initialWeights, NumericTable & initialMeans,
                                                                  NumericTable ** initialCovariances, NumericTable & resultWeights,
                                                                  NumericTable & resultMeans, NumericTable ** resultCovariances,
                                                                  NumericTable & resultNIterations, NumericTable & resultGoalFunction,
                                                                  const Parameter & par)
 {
-    EMKernelTask<algorithmFPType, method, cpu> kernelTask(dataTable, initialWeights, initialMeans, initialCovariances, resultWeights, resultMeans,
-                                                          resultCovariances, resultNIterations, resultGoalFunction, par);
+    EMKernelTask<algorithmFPType, method, cpu> kernelTask(pHost, dataTable, initialWeights, initialMeans, initialCovariances, resultWeights,
+                                                          resultMeans, resultCovariances, resultNIterations, resultGoalFunction, par);
     return kernelTask.compute();
 };
 
@@ -78,6 +80,10 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
         DAAL_CHECK_STATUS(s, covs->computeSigmaInverse(iterCounter))
         algorithmFPType * sqrtInvDetSigma = covs->getLogSqrtInvDetSigma();
         Math<algorithmFPType, cpu>::vLog(nComponents, sqrtInvDetSigma, covs->getLogSqrtInvDetSigma());
+        if (par.covarianceStorage == diagonal)
+        {
+            DAAL_CHECK_STATUS(s, static_cast<GmmModelDiagType *>(covs.get())->computeQuadraticForms(means))
+        }
 
         Math<algorithmFPType, cpu>::vLog(nComponents, alpha, logAlpha); // inplace: same memory as alpha
 
@@ -134,6 +140,9 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
         oldLogLikelyhood = logLikelyhood;
 
         iterCounter++;
+
+        /* The parameters of the finished iterations are the result of the cancelled training */
+        if (services::internal::isCancelled(s, hostApp)) break;
     }
     threadBuffer.reduce([=](Task<algorithmFPType, cpu> * v) -> void { delete (v); });
     return s;
@@ -169,24 +178,48 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
 
     if (covType == diagonal)
     {
+        const GmmModelDiag<algorithmFPType, cpu> * diagCovs = static_cast<const GmmModelDiag<algorithmFPType, cpu> *>(t.covs);
+        const algorithmFPType * shift                      = diagCovs->getShift();
+        const algorithmFPType * formConstants              = diagCovs->getQuadraticFormConstants();
+
+        /* Every row holds (x - c)^2 followed by x - c, x_mu and Ax_mu are contiguous and fit the block */
+        algorithmFPType * shiftedData = t.x_mu;
+        for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+        {
+            const algorithmFPType * x = &t.dataBlock[i * nFeatures];
+            algorithmFPType * row     = &shiftedData[i * 2 * nFeatures];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType x_c = x[j] - shift[j];
+                row[j]                    = x_c * x_c;
+                row[nFeatures + j]        = x_c;
+            }
+        }
+
+        /* t.p[k * nVectorsInCurrentBlock + i] is the quadratic form of the component k without its constant */
+        char transa           = 'T';
+        char transb           = 'N';
+        DAAL_INT m            = nVectorsInCurrentBlock;
+        DAAL_INT n            = nComponents;
+        DAAL_INT kDim         = 2 * nFeatures;
+        algorithmFPType one   = 1.0;
+        algorithmFPType zero  = 0.0;
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &n, &kDim, &one, shiftedData, &kDim, diagCovs->getQuadraticForms(), &kDim, &zero,
+                                           t.p, &m);
+
         for (size_t k = 0; k < nComponents; k++)
         {
-            const algorithmFPType * curMean  = &t.means[k * nFeatures];
-            const algorithmFPType * invSigma = (t.covs->getSigma())[k];
-            const algorithmFPType addition   = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
+            const algorithmFPType addition = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
+            const algorithmFPType constant = formConstants[k];
+            algorithmFPType * pk           = &t.p[k * nVectorsInCurrentBlock];
 
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
             for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
             {
-                algorithmFPType tp = 0;
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < nFeatures; j++)
-                {
-                    algorithmFPType x_mu = t.dataBlock[i * nFeatures + j] - curMean[j];
-                    tp += x_mu * x_mu * invSigma[j];
-                }
-
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * tp;
+                pk[i] = addition + -0.5 * (pk[i] + constant);
             }
         }
     }
@@ -408,10 +441,10 @@ Status EMKernelTask<algorithmFPType, method, cpu>::stepM_merge(size_t iteration)
  * Sets constants and values
  */
 template <typename algorithmFPType, Method method, CpuType cpu>
-EMKernelTask<algorithmFPType, method, cpu>::EMKernelTask(NumericTable & dataTable, NumericTable & initialWeights, NumericTable & initialMeans,
-                                                         NumericTable ** initialCovariances, NumericTable & resultWeights, NumericTable & resultMeans,
-                                                         NumericTable ** resultCovariances, NumericTable & resultNIterations,
-                                                         NumericTable & resultGoalFunction, const Parameter & par)
+EMKernelTask<algorithmFPType, method, cpu>::EMKernelTask(services::HostAppIface * pHost, NumericTable & dataTable, NumericTable & initialWeights,
+                                                         NumericTable & initialMeans, NumericTable ** initialCovariances,
+                                                         NumericTable & resultWeights, NumericTable & resultMeans, NumericTable ** resultCovariances,
+                                                         NumericTable & resultNIterations, NumericTable & resultGoalFunction, const Parameter & par)
     : dataTable(dataTable),
       initialWeights(initialWeights),
       initialMeans(initialMeans),
@@ -422,6 +455,7 @@ EMKernelTask<algorithmFPType, method, cpu>::EMKernelTask(NumericTable & dataTabl
       resultNIterations(resultNIterations),
       resultGoalFunction(resultGoalFunction),
       par(par),
+      hostApp(pHost),
       blockSizeDefault(512),
       nFeatures(dataTable.getNumberOfColumns()),
       nVectors(dataTable.getNumberOfRows()),
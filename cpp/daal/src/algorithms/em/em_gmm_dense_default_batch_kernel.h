@@ -27,6 +27,7 @@
 #include "algorithms/em/em_gmm.h"
 #include "src/algorithms/kernel.h"
 #include "data_management/data/numeric_table.h"
+#include "services/host_app.h"
 #include "src/externals/service_blas.h"
 #include "src/algorithms/em/em_gmm_dense_default_batch_task.h"
 
@@ -47,9 +48,11 @@ public:
     typedef SharedPtr<GmmModel<algorithmFPType, cpu> > GmmModelPtr;
     EMKernel() {};
 
-    services::Status compute(NumericTable & dataTable, NumericTable & initialWeights, NumericTable & initialMeans, NumericTable ** initialCovariances,
-                             NumericTable & resultWeights, NumericTable & resultMeans, NumericTable ** resultCovariances,
-                             NumericTable & resultNIterations, NumericTable & resultGoalFunction, const Parameter & par);
+    /* The cancelled training returns the parameters of the finished iterations with ErrorUserCancelled status */
+    services::Status compute(services::HostAppIface * pHost, NumericTable & dataTable, NumericTable & initialWeights, NumericTable & initialMeans,
+                             NumericTable ** initialCovariances, NumericTable & resultWeights, NumericTable & resultMeans,
+                             NumericTable ** resultCovariances, NumericTable & resultNIterations, NumericTable & resultGoalFunction,
+                             const Parameter & par);
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -66,9 +69,9 @@ class EMKernelTask
     SharedPtr<GmmModel<algorithmFPType, cpu> > initializeCovariances();
 
 public:
-    EMKernelTask(NumericTable & dataTable, NumericTable & initialWeights, NumericTable & initialMeans, NumericTable ** initialCovariances,
-                 NumericTable & resultWeights, NumericTable & resultMeans, NumericTable ** resultCovariances, NumericTable & resultNIterations,
-                 NumericTable & resultGoalFunction, const Parameter & par);
+    EMKernelTask(services::HostAppIface * pHost, NumericTable & dataTable, NumericTable & initialWeights, NumericTable & initialMeans,
+                 NumericTable ** initialCovariances, NumericTable & resultWeights, NumericTable & resultMeans, NumericTable ** resultCovariances,
+                 NumericTable & resultNIterations, NumericTable & resultGoalFunction, const Parameter & par);
 
     services::Status compute();
 
@@ -116,6 +119,7 @@ public:
     NumericTable & resultNIterations;
     NumericTable & resultGoalFunction;
     const Parameter & par;
+    services::HostAppIface * hostApp;
 };
 
 } // namespace internal
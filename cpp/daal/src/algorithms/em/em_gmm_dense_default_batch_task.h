@@ -173,7 +173,12 @@ public:
     using GmmModel<algorithmFPType, cpu>::logSqrtInvDetSigma;
     using GmmModel<algorithmFPType, cpu>::covRegularizer;
     using GmmModel<algorithmFPType, cpu>::EIGENVALUE_THRESHOLD;
-    GmmModelDiag(size_t _nFeatures, size_t _nComponents) : GmmModel<algorithmFPType, cpu>(_nFeatures, _nComponents) {}
+    GmmModelDiag(size_t _nFeatures, size_t _nComponents)
+        : GmmModel<algorithmFPType, cpu>(_nFeatures, _nComponents),
+          shiftPtr(_nFeatures),
+          formsPtr(_nComponents * 2 * _nFeatures),
+          formConstantsPtr(_nComponents)
+    {}
     size_t getOneCovSize() { return nFeatures; }
     size_t getNumberOfRowsInCov() { return 1; }
     void multiplyByInverseMatrix(size_t nVectorsInCurrentBlock, size_t k, algorithmFPType * X, algorithmFPType * CovX)
@@ -278,6 +283,61 @@ public:
 
     void stepM_mergeCovs(algorithmFPType * cp_n, algorithmFPType * cp_m, algorithmFPType * mean_n, algorithmFPType * mean_m, algorithmFPType & w_n,
                          algorithmFPType & w_m, size_t nFeatures);
+
+    /**
+     * Computes the quadratic forms of the components in the data shifted by the average of the means c.
+     * The form of the component k is (x - c)^2 * s_k - 2 (x - c) * ((mu_k - c) s_k) + constant_k, where
+     * s_k are the inverse variances, so the forms of all the components are given by one matrix product.
+     * The shift keeps the terms of the expanded form small for the data far from the origin.
+     */
+    Status computeQuadraticForms(const algorithmFPType * means)
+    {
+        algorithmFPType * shift         = shiftPtr.get();
+        algorithmFPType * forms         = formsPtr.get();
+        algorithmFPType * formConstants = formConstantsPtr.get();
+        DAAL_CHECK(shift && forms && formConstants, ErrorMemoryAllocationFailed);
+
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            shift[j] = 0;
+        }
+        for (size_t k = 0; k < nComponents; k++)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                shift[j] += means[k * nFeatures + j];
+            }
+        }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            shift[j] /= (algorithmFPType)nComponents;
+        }
+
+        for (size_t k = 0; k < nComponents; k++)
+        {
+            const algorithmFPType * invSigma = sigma[k];
+            algorithmFPType * form           = forms + k * 2 * nFeatures;
+            algorithmFPType constant         = 0;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType mu_c = means[k * nFeatures + j] - shift[j];
+                form[j]                    = invSigma[j];
+                form[nFeatures + j]        = -2.0 * mu_c * invSigma[j];
+                constant += mu_c * mu_c * invSigma[j];
+            }
+            formConstants[k] = constant;
+        }
+        return Status();
+    }
+
+    const algorithmFPType * getShift() const { return shiftPtr.get(); }
+    const algorithmFPType * getQuadraticForms() const { return formsPtr.get(); }
+    const algorithmFPType * getQuadraticFormConstants() const { return formConstantsPtr.get(); }
+
+private:
+    TArray<algorithmFPType, cpu> shiftPtr;
+    TArray<algorithmFPType, cpu> formsPtr;
+    TArray<algorithmFPType, cpu> formConstantsPtr;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -37,7 +37,8 @@ namespace internal
 template <typename algorithmFPType>
 ErrorID EMforKernel<algorithmFPType>::run(data_management::NumericTable & inputData, data_management::NumericTable & inputWeights,
                                           data_management::NumericTable & inputMeans, data_management::DataCollectionPtr & inputCov,
-                                          const em_gmm::CovarianceStorageId covType, algorithmFPType & loglikelyhood)
+                                          const em_gmm::CovarianceStorageId covType, algorithmFPType & loglikelyhood,
+                                          size_t & nIterationsDone)
 {
     this->input.set(daal::algorithms::em_gmm::data, NumericTablePtr(&inputData, EmptyDeleter()));
     this->input.set(daal::algorithms::em_gmm::inputWeights, NumericTablePtr(&inputWeights, EmptyDeleter()));
@@ -58,7 +59,7 @@ ErrorID EMforKernel<algorithmFPType>::run(data_management::NumericTable & inputD
         return ErrorMemoryAllocationFailed;
     }
 
-    NumericTablePtr nIterationsValueTable = HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, &status);
+    SharedPtr<HomogenNumericTable<int> > nIterationsValueTable = HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, &status);
     if (!status)
     {
         return ErrorMemoryAllocationFailed;
@@ -72,7 +73,8 @@ ErrorID EMforKernel<algorithmFPType>::run(data_management::NumericTable & inputD
     {
         return ErrorEMInitNoTrialConverges;
     }
-    loglikelyhood = loglikelyhoodValueTable->getArray()[0];
+    loglikelyhood   = loglikelyhoodValueTable->getArray()[0];
+    nIterationsDone = nIterationsValueTable->getArray()[0];
     return ErrorID(0);
 }
 
@@ -26,6 +26,8 @@
 #include "src/services/service_data_utils.h"
 #include "src/externals/service_stat.h"
 #include "src/algorithms/distributions/uniform/uniform_impl.i"
+#include "src/algorithms/service_sort.h"
+#include "src/threading/threading.h"
 
 using namespace daal::data_management;
 using namespace daal::internal;
@@ -54,31 +56,37 @@ services::Status EMInitKernel<algorithmFPType, method, cpu>::compute(NumericTabl
     return Status();
 }
 
+/* The trials run concurrently, the EM runs of the trials are parallel inside, so the threads left by the trials go to their EM runs.
+   All trials run the first half of the iterations, then the ones behind the better half of the trials are stopped and the others
+   run the rest of the iterations. */
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status EMInitKernelTask<algorithmFPType, method, cpu>::compute()
 {
     Status s;
     DAAL_CHECK_STATUS(s, initialize())
 
-    bool isInitialized = false;
-    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
-    {
-        DAAL_CHECK_STATUS(s, generateSelectedSet())
-
-        DAAL_CHECK_STATUS(s, setSelectedSetAsInitialValues())
+    const size_t nFirstIterations = (nIterations + 1) / 2;
+    runTrials(nFirstIterations);
 
-        ErrorID errorId = runEM();
+    if (nFirstIterations < nIterations)
+    {
+        DAAL_CHECK_STATUS(s, stopLaggingTrials())
+        runTrials(nIterations - nFirstIterations);
+    }
 
-        if (!errorId && (loglikelyhood > maxLoglikelyhood))
+    /* The first trial among the ones of the largest log-likelihood, as in the sequential runs of the trials */
+    Trial * bestTrial = nullptr;
+    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
+    {
+        Trial & trial = *trials[idxTry];
+        if (!trial.errorId && (!bestTrial || trial.loglikelyhood > bestTrial->loglikelyhood))
         {
-            isInitialized    = true;
-            maxLoglikelyhood = loglikelyhood;
-            DAAL_CHECK_STATUS(s, writeValuesToTables())
+            bestTrial = &trial;
         }
     }
 
-    DAAL_CHECK(isInitialized, ErrorEMInitNoTrialConverges)
-    return Status();
+    DAAL_CHECK(bestTrial, ErrorEMInitNoTrialConverges)
+    return writeValuesToTables(*bestTrial);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -94,29 +102,77 @@ EMInitKernelTask<algorithmFPType, method, cpu>::EMInitKernelTask(NumericTable &
       nTrials(parameter.nTrials),
       nIterations(parameter.nIterations),
       accuracyThreshold(parameter.accuracyThreshold),
-      maxLoglikelyhood(-MaxVal<algorithmFPType>::get()),
       nFeatures(data.getNumberOfColumns()),
       nVectors(data.getNumberOfRows()),
-      covs(parameter.covarianceStorage, parameter.nComponents, data.getNumberOfColumns(), status),
       varianceArrayPtr(data.getNumberOfColumns()),
-      selectedSetPtr(parameter.nComponents),
+      trials(parameter.nTrials),
       engine(engine)
 {}
 
+/* The starting points of all trials are generated from the engine before the trials run, in the order of the sequential runs,
+   so the trials do not share the engine and the result does not depend on the number of threads */
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status EMInitKernelTask<algorithmFPType, method, cpu>::initialize()
 {
     Status st;
-    alpha = HomogenNT::create(nComponents, 1, &st);
-    DAAL_CHECK_STATUS_VAR(st);
-    means = HomogenNT::create(nFeatures, nComponents, &st);
-    DAAL_CHECK_STATUS_VAR(st);
     varianceArray = varianceArrayPtr.get();
-    selectedSet   = selectedSetPtr.get();
+    DAAL_CHECK(varianceArray && trials.data(), ErrorMemoryAllocationFailed);
+
+    DAAL_CHECK_STATUS(st, computeVariance())
 
-    DAAL_CHECK(alpha && means && varianceArray && selectedSet, ErrorMemoryAllocationFailed);
+    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
+    {
+        trials[idxTry] = TrialPtr(new Trial(parameter.covarianceStorage, nComponents, nFeatures, st));
+        DAAL_CHECK_MALLOC(trials[idxTry].get())
+        DAAL_CHECK_STATUS_VAR(st)
+
+        DAAL_CHECK_STATUS(st, generateSelectedSet(trials[idxTry]->selectedSet()))
+        DAAL_CHECK_STATUS(st, setSelectedSetAsInitialValues(*trials[idxTry]))
+    }
+    return st;
+}
 
-    return computeVariance();
+template <typename algorithmFPType, Method method, CpuType cpu>
+void EMInitKernelTask<algorithmFPType, method, cpu>::runTrials(size_t nTrialIterations)
+{
+    daal::threader_for(nTrials, nTrials, [&](size_t idxTry) {
+        Trial & trial = *trials[idxTry];
+        if (!trial.isStopped)
+        {
+            runEM(trial, nTrialIterations);
+        }
+    });
+}
+
+/* EM does not decrease the log-likelihood and gains the most of it in the first iterations, so the trials behind the better half
+   of the trials after the first half of the iterations are not likely to catch up with the best one */
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status EMInitKernelTask<algorithmFPType, method, cpu>::stopLaggingTrials()
+{
+    TArray<algorithmFPType, cpu> loglikelyhoodsPtr(nTrials);
+    DAAL_CHECK_MALLOC(loglikelyhoodsPtr.get())
+    algorithmFPType * loglikelyhoods = loglikelyhoodsPtr.get();
+
+    size_t nRunning = 0;
+    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
+    {
+        if (!trials[idxTry]->isStopped)
+        {
+            loglikelyhoods[nRunning++] = trials[idxTry]->loglikelyhood;
+        }
+    }
+    if (nRunning < 2) return Status();
+
+    daal::algorithms::internal::qSort<algorithmFPType, cpu>(nRunning, loglikelyhoods);
+    const size_t nKept               = (nRunning + 1) / 2;
+    const algorithmFPType lowestKept = loglikelyhoods[nRunning - nKept];
+
+    for (size_t idxTry = 0; idxTry < nTrials; idxTry++)
+    {
+        Trial & trial = *trials[idxTry];
+        trial.isStopped |= (trial.loglikelyhood < lowestKept);
+    }
+    return Status();
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -132,7 +188,7 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::computeVariance()
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
-Status EMInitKernelTask<algorithmFPType, method, cpu>::writeValuesToTables()
+Status EMInitKernelTask<algorithmFPType, method, cpu>::writeValuesToTables(Trial & trial)
 {
     {
         WriteOnlyRows<algorithmFPType, cpu, NumericTable> weightsBlock(weightsToInit, 0, 1);
@@ -140,7 +196,7 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::writeValuesToTables()
         algorithmFPType * weightsArray = weightsBlock.get();
         for (size_t i = 0; i < nComponents; i++)
         {
-            weightsArray[i] = alpha->getArray()[i];
+            weightsArray[i] = trial.alpha->getArray()[i];
         }
     }
 
@@ -150,24 +206,24 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::writeValuesToTables()
         algorithmFPType * meansArray = meansBlock.get();
         for (size_t i = 0; i < nFeatures * nComponents; i++)
         {
-            meansArray[i] = means->getArray()[i];
+            meansArray[i] = trial.means->getArray()[i];
         }
     }
 
-    covs.writeToTables(covariancesToInit);
-    return Status();
+    return trial.covs.writeToTables(covariancesToInit);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
-Status EMInitKernelTask<algorithmFPType, method, cpu>::setSelectedSetAsInitialValues()
+Status EMInitKernelTask<algorithmFPType, method, cpu>::setSelectedSetAsInitialValues(Trial & trial)
 {
-    algorithmFPType * alphaArray = alpha->getArray();
+    const int * selectedSet      = trial.selectedSet();
+    algorithmFPType * alphaArray = trial.alpha->getArray();
     for (size_t k = 0; k < nComponents; k++)
     {
         alphaArray[k] = 1.0 / nComponents;
     }
 
-    algorithmFPType * meansArray = means->getArray();
+    algorithmFPType * meansArray = trial.means->getArray();
     ReadRows<algorithmFPType, cpu, NumericTable> block;
     for (size_t k = 0; k < nComponents; k++)
     {
@@ -179,26 +235,29 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::setSelectedSetAsInitialVa
         }
     }
 
-    covs.setVariance(varianceArray);
+    trial.covs.setVariance(varianceArray);
     return Status();
 }
 
+/* Continues the EM run of the trial for nTrialIterations more iterations from its current state */
 template <typename algorithmFPType, Method method, CpuType cpu>
-ErrorID EMInitKernelTask<algorithmFPType, method, cpu>::runEM()
+void EMInitKernelTask<algorithmFPType, method, cpu>::runEM(Trial & trial, size_t nTrialIterations)
 {
     EMforKernel<algorithmFPType> em(nComponents);
-    em.parameter.maxIterations     = nIterations;
+    em.parameter.maxIterations     = nTrialIterations;
     em.parameter.accuracyThreshold = accuracyThreshold;
-    ErrorID returnErrorId          = em.run(data, *alpha, *means, covs.getSigma(), parameter.covarianceStorage, loglikelyhood);
-    if (returnErrorId != 0)
+    size_t nIterationsDone         = 0;
+    trial.errorId =
+        em.run(data, *trial.alpha, *trial.means, trial.covs.getSigma(), parameter.covarianceStorage, trial.loglikelyhood, nIterationsDone);
+    if (trial.errorId != 0)
     {
-        loglikelyhood = -MaxVal<algorithmFPType>::get();
+        trial.loglikelyhood = -MaxVal<algorithmFPType>::get();
     }
-    return returnErrorId;
+    trial.isStopped = (trial.errorId != 0) || (nIterationsDone < nTrialIterations);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
-Status EMInitKernelTask<algorithmFPType, method, cpu>::generateSelectedSet()
+Status EMInitKernelTask<algorithmFPType, method, cpu>::generateSelectedSet(int * selectedSet)
 {
     int number;
     Status s;
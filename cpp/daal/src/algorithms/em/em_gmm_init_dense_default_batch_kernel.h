@@ -29,6 +29,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "src/externals/service_memory.h"
+#include "src/services/service_data_utils.h"
 #include "algorithms/em/em_gmm_init_types.h"
 #include "algorithms/em/em_gmm_init_batch.h"
 #include "algorithms/em/em_gmm.h"
@@ -130,22 +131,58 @@ public:
                              const Parameter & par, engines::BatchBase & engine);
 };
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-class EMInitKernelTask
+/* The state of one trial of the short EM runs, the EM runs of the trials update it in place */
+template <typename algorithmFPType, CpuType cpu>
+class EMInitTrial
 {
     typedef HomogenNumericTableCPU<algorithmFPType, cpu> HomogenNT;
     typedef SharedPtr<HomogenNT> HomogenNTPtr;
 
+public:
+    EMInitTrial(em_gmm::CovarianceStorageId covType, size_t nComponents, size_t nFeatures, Status & st)
+        : covs(covType, nComponents, nFeatures, st),
+          selectedSetPtr(nComponents),
+          loglikelyhood(-services::internal::MaxVal<algorithmFPType>::get()),
+          errorId(ErrorID(0)),
+          isStopped(false)
+    {
+        if (!st) return;
+        alpha = HomogenNT::create(nComponents, 1, &st);
+        if (!st) return;
+        means = HomogenNT::create(nFeatures, nComponents, &st);
+        if (!st) return;
+        if (!selectedSetPtr.get()) st.add(ErrorMemoryAllocationFailed);
+    }
+
+    int * selectedSet() { return selectedSetPtr.get(); }
+
+    HomogenNTPtr alpha;
+    HomogenNTPtr means;
+    GmmSigma<algorithmFPType, cpu> covs;
+    TArray<int, cpu> selectedSetPtr;
+    algorithmFPType loglikelyhood;
+    ErrorID errorId;
+    bool isStopped; /* the trial failed, converged or fell behind the others */
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class EMInitKernelTask
+{
+    typedef EMInitTrial<algorithmFPType, cpu> Trial;
+    typedef SharedPtr<Trial> TrialPtr;
+
 public:
     EMInitKernelTask(NumericTable & data, NumericTable & weightsToInit, NumericTable & meansToInit, DataCollectionPtr & covariancesToInit,
                      const Parameter & parameter, engines::BatchBase & engine, Status & status);
     Status compute();
 
 private:
-    Status writeValuesToTables();
-    Status setSelectedSetAsInitialValues();
-    ErrorID runEM();
-    Status generateSelectedSet();
+    Status writeValuesToTables(Trial & trial);
+    Status setSelectedSetAsInitialValues(Trial & trial);
+    void runEM(Trial & trial, size_t nTrialIterations);
+    void runTrials(size_t nTrialIterations);
+    Status stopLaggingTrials();
+    Status generateSelectedSet(int * selectedSet);
     Status initialize();
     Status computeVariance();
 
@@ -160,15 +197,9 @@ private:
     const size_t nTrials;
     const size_t nIterations;
     double accuracyThreshold;
-    HomogenNTPtr alpha;
-    HomogenNTPtr means;
-    algorithmFPType loglikelyhood;
-    algorithmFPType maxLoglikelyhood;
     algorithmFPType * varianceArray;
     TArray<algorithmFPType, cpu> varianceArrayPtr;
-    TArray<int, cpu> selectedSetPtr;
-    int * selectedSet;
-    GmmSigma<algorithmFPType, cpu> covs;
+    Collection<TrialPtr> trials;
     engines::BatchBase & engine;
 };
 
@@ -180,7 +211,8 @@ public:
     virtual ~EMforKernel() {}
 
     ErrorID run(data_management::NumericTable & inputData, data_management::NumericTable & inputWeights, data_management::NumericTable & inputMeans,
-                data_management::DataCollectionPtr & inputCov, const em_gmm::CovarianceStorageId covType, algorithmFPType & loglikelyhood);
+                data_management::DataCollectionPtr & inputCov, const em_gmm::CovarianceStorageId covType, algorithmFPType & loglikelyhood,
+                size_t & nIterationsDone);
 };
 
 } // namespace internal
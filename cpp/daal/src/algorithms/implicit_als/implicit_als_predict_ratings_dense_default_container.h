@@ -26,6 +26,7 @@
 
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "src/algorithms/implicit_als/implicit_als_predict_ratings_dense_default_kernel.h"
+#include "src/algorithms/implicit_als/oneapi/implicit_als_predict_ratings_kernel_oneapi.h"
 
 namespace daal
 {
@@ -44,7 +45,17 @@ namespace ratings
 template <typename algorithmFPType, prediction::ratings::Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv) : PredictionContainerIface()
 {
-    __DAAL_INITIALIZE_KERNELS(internal::ImplicitALSPredictKernel, algorithmFPType);
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::ImplicitALSPredictKernel, algorithmFPType);
+    }
+    else
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::ImplicitALSPredictKernelOneAPI, algorithmFPType);
+    }
 }
 
 template <typename algorithmFPType, prediction::ratings::Method method, CpuType cpu>
@@ -68,8 +79,20 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::services::Environment::env & env = *_env;
 
     NumericTable * ratingsTable = static_cast<NumericTable *>(result->get(prediction).get());
-    __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute, usersFactorsTable,
-                       itemsFactorsTable, ratingsTable, par);
+
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute, usersFactorsTable,
+                           itemsFactorsTable, ratingsTable, par);
+    }
+    else
+    {
+        __DAAL_CALL_KERNEL_SYCL(env, internal::ImplicitALSPredictKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute, usersFactorsTable,
+                                itemsFactorsTable, ratingsTable, par);
+    }
 }
 
 /**
@@ -27,6 +27,8 @@
 #include "algorithms/implicit_als/implicit_als_training_batch.h"
 #include "algorithms/implicit_als/implicit_als_training_distributed.h"
 #include "src/algorithms/implicit_als/implicit_als_train_kernel.h"
+#include "src/algorithms/implicit_als/oneapi/implicit_als_train_kernel_oneapi.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -43,7 +45,17 @@ namespace training
 template <typename algorithmFPType, training::Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv) : TrainingContainerIface<batch>()
 {
-    __DAAL_INITIALIZE_KERNELS(internal::ImplicitALSTrainBatchKernel, algorithmFPType, method);
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::ImplicitALSTrainBatchKernel, algorithmFPType, method);
+    }
+    else
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::ImplicitALSTrainBatchKernelOneAPI, algorithmFPType, method);
+    }
 }
 
 template <typename algorithmFPType, training::Method method, CpuType cpu>
@@ -65,7 +77,19 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Parameter * par                        = static_cast<Parameter *>(_par);
     daal::services::Environment::env & env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::ImplicitALSTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a0, a1, r, par);
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::ImplicitALSTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                           daal::services::internal::hostApp(*input), a0, a1, r, par);
+    }
+    else
+    {
+        __DAAL_CALL_KERNEL_SYCL(env, internal::ImplicitALSTrainBatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a0, a1,
+                                r, par);
+    }
 }
 
 /**
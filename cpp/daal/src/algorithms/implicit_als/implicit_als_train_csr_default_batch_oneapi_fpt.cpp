@@ -0,0 +1,42 @@
+/* file: implicit_als_train_csr_default_batch_oneapi_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of implicit ALS training functions for the fastCSR method for GPU.
+//--
+*/
+
+#include "src/algorithms/implicit_als/oneapi/implicit_als_train_kernel_oneapi.h"
+#include "src/algorithms/implicit_als/oneapi/implicit_als_train_oneapi_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace training
+{
+namespace internal
+{
+template class ImplicitALSTrainBatchKernelOneAPI<DAAL_FPTYPE, fastCSR>;
+}
+} // namespace training
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
@@ -176,7 +176,7 @@ template <typename algorithmFPType, CpuType cpu>
 struct AlsTls
 {
     DAAL_NEW_DELETE();
-    AlsTls(size_t nBlocks, const Parameter & parameter) : _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nFactors * parameter.nFactors) {}
+    AlsTls(size_t nBlocks, const Parameter & parameter) : _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nFactors * (parameter.nFactors + 4)) {}
     bool isValid() const { return _lhs.get(); }
 
     Status run(NumericTable & dstFactors, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, const algorithmFPType * xtx,
@@ -210,8 +210,27 @@ Status AlsTls<algorithmFPType, cpu>::run(NumericTable & dstFactors, ReadRowsCSR<
     Status s = formSystem(mtData, i, aSrcFactors, nColFactorsRows, indices);
     s |= (result) ? services::Status(services::ErrorMemoryCopyFailedInternal) : s;
 
-    /* Solve system of normal equations */
-    if (s.ok() && !ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solve(_prm.nFactors, _lhs.get(), rhs)) return Status(ErrorALSInternal);
+    if (!s.ok()) return s;
+
+    /* Solve system of normal equations, the conjugate gradient method starts from zero as the row factors are new */
+    if (_prm.nConjugateGradientIterations)
+    {
+        algorithmFPType * x = _lhs.get() + _prm.nFactors * _prm.nFactors;
+        service_memset_seq<algorithmFPType, cpu>(x, 0.0, _prm.nFactors);
+        if (!ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveConjugateGradient(_prm.nFactors, _lhs.get(), rhs, x,
+                                                                                      _prm.nConjugateGradientIterations, x + _prm.nFactors))
+        {
+            return Status(ErrorALSInternal);
+        }
+        for (size_t f = 0; f < _prm.nFactors; f++)
+        {
+            rhs[f] = x[f];
+        }
+    }
+    else if (!ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solve(_prm.nFactors, _lhs.get(), rhs))
+    {
+        return Status(ErrorALSInternal);
+    }
     return s;
 }
 
@@ -28,6 +28,8 @@
 #include "src/externals/service_blas.h"
 #include "src/externals/service_lapack.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -86,6 +88,74 @@ bool ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solve(size_t nCols, algor
     return (info == 0);
 }
 
+/**
+ * Solves a * x = b by the conjugate gradient method started from x. The matrix is given by its upper triangle,
+ * the lower one is filled to multiply by the matrix with GEMV. The buffer holds 3 * nCols values.
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveConjugateGradient(size_t nCols, algorithmFPType * a, const algorithmFPType * b,
+                                                                              algorithmFPType * x, size_t nIterations, algorithmFPType * buffer)
+{
+    for (size_t j = 0; j < nCols; j++)
+    {
+        for (size_t i = 0; i < j; i++)
+        {
+            a[j + i * nCols] = a[i + j * nCols];
+        }
+    }
+
+    algorithmFPType * r  = buffer;
+    algorithmFPType * p  = r + nCols;
+    algorithmFPType * ap = p + nCols;
+
+    const char trans     = 'N';
+    const DAAL_INT n     = nCols;
+    const DAAL_INT iOne  = 1;
+    algorithmFPType one  = 1.0;
+    algorithmFPType zero = 0.0;
+
+    /* r = b - a * x */
+    Blas<algorithmFPType, cpu>::xxgemv(&trans, &n, &n, &one, a, &n, x, &iOne, &zero, ap, &iOne);
+    algorithmFPType rr = 0.0;
+    algorithmFPType bb = 0.0;
+    for (size_t k = 0; k < nCols; k++)
+    {
+        r[k] = b[k] - ap[k];
+        p[k] = r[k];
+        rr += r[k] * r[k];
+        bb += b[k] * b[k];
+    }
+
+    const algorithmFPType tolerance = bb * services::internal::EpsilonVal<algorithmFPType>::get();
+    for (size_t iter = 0; iter < nIterations && rr > tolerance; iter++)
+    {
+        Blas<algorithmFPType, cpu>::xxgemv(&trans, &n, &n, &one, a, &n, p, &iOne, &zero, ap, &iOne);
+        algorithmFPType pap = 0.0;
+        for (size_t k = 0; k < nCols; k++)
+        {
+            pap += p[k] * ap[k];
+        }
+        if (!(pap > 0.0)) return false;
+
+        const algorithmFPType step = rr / pap;
+        algorithmFPType rrNew      = 0.0;
+        for (size_t k = 0; k < nCols; k++)
+        {
+            x[k] += step * p[k];
+            r[k] -= step * ap[k];
+            rrNew += r[k] * r[k];
+        }
+
+        const algorithmFPType ratio = rrNew / rr;
+        for (size_t k = 0; k < nCols; k++)
+        {
+            p[k] = r[k] + ratio * p[k];
+        }
+        rr = rrNew;
+    }
+    return true;
+}
+
 static inline void getSizes(size_t nRows, size_t nCols, size_t & nBlocks, size_t & blockSize, size_t & tailSize)
 {
     const size_t nThreads       = threader_get_threads_number();
@@ -111,7 +181,7 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(size_t n
                                                                         const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
                                                                         algorithmFPType * colFactors, algorithmFPType * rowFactors,
                                                                         algorithmFPType alpha, algorithmFPType lambda, algorithmFPType * xtx,
-                                                                        daal::tls<algorithmFPType *> & lhs)
+                                                                        daal::tls<algorithmFPType *> & lhs, size_t nCGIterations, bool warmStart)
 {
     SafeStatus safeStat;
     size_t nBlocks, blockSize, tailSize;
@@ -128,6 +198,16 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(size_t n
             algorithmFPType * lhs_local = lhs.local();
             algorithmFPType * rhs       = rowFactors + (offset + j) * nFactors;
 
+            /* The conjugate gradient buffers follow the matrix, the method starts from the previous factors */
+            algorithmFPType * x = lhs_local + nFactors * nFactors;
+            if (nCGIterations)
+            {
+                for (size_t f = 0; f < nFactors; f++)
+                {
+                    x[f] = warmStart ? rhs[f] : 0.0;
+                }
+            }
+
             for (size_t f = 0; f < nFactors; f++)
             {
                 rhs[f] = 0.0;
@@ -138,7 +218,18 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(size_t n
             formSystem(offset + j, nCols, data, colIndices, rowOffsets, nFactors, colFactors, alpha, lhs_local, rhs, lambda);
 
             /* Solve system of normal equations */
-            if (!solve(nFactors, lhs_local, rhs)) safeStat.add(ErrorALSInternal);
+            if (nCGIterations)
+            {
+                if (!solveConjugateGradient(nFactors, lhs_local, rhs, x, nCGIterations, x + nFactors)) safeStat.add(ErrorALSInternal);
+                for (size_t f = 0; f < nFactors; f++)
+                {
+                    rhs[f] = x[f];
+                }
+            }
+            else if (!solve(nFactors, lhs_local, rhs))
+            {
+                safeStat.add(ErrorALSInternal);
+            }
         } /* for(size_t j = 0; j < curBlockSize; j++) */
         if (result) safeStat.add(services::Status(services::ErrorMemoryCopyFailedInternal));
     }); /* daal::threader_for(nBlocks, nBlocks, [ & ](size_t i) */
@@ -295,8 +386,9 @@ void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formSystem(size
 }
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::compute(const NumericTable * dataTable, implicit_als::Model * initModel,
-                                                                                     implicit_als::Model * model, const Parameter * parameter)
+services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::compute(services::HostAppIface * pHost, const NumericTable * dataTable,
+                                                                                     implicit_als::Model * initModel, implicit_als::Model * model,
+                                                                                     const Parameter * parameter)
 {
     Status s;
     ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu> task(dataTable, model, parameter);
@@ -304,6 +396,7 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
 
     const algorithmFPType alpha(parameter->alpha);
     const algorithmFPType lambda(parameter->lambda);
+    const size_t nCGIterations = parameter->nConjugateGradientIterations;
 
     size_t nItems                  = task.nItems;
     size_t nUsers                  = task.nUsers;
@@ -325,11 +418,11 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
                         alpha, lambda, &costFunction);
 #endif
 
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * parameter->nFactors, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors + 4);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * (parameter->nFactors + 4), sizeof(algorithmFPType));
 
     daal::tls<algorithmFPType *> lhs([=]() -> algorithmFPType * {
-        return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->nFactors * parameter->nFactors
+        return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->nFactors * (parameter->nFactors + 4)
                                                                                                  * sizeof(algorithmFPType));
     });
 
@@ -338,14 +431,19 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs);
+        s = this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs,
+                                 nCGIterations, i > 0);
         if (!s) break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs);
+        s = this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs,
+                                 nCGIterations, true);
         if (!s) break;
 
+        /* The factors of the finished iterations are the result of the cancelled training */
+        if (services::internal::isCancelled(s, pHost)) break;
+
 #if 0
         computeCostFunction(nUsers, nItems, nFactors, data, colIndices, rowOffsets, itemsFactors, usersFactors,
                             alpha, lambda, &costFunction);
@@ -362,7 +460,8 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
 }
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>::compute(const NumericTable * dataTable,
+services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>::compute(services::HostAppIface * pHost,
+                                                                                          const NumericTable * dataTable,
                                                                                           implicit_als::Model * initModel,
                                                                                           implicit_als::Model * model, const Parameter * parameter)
 {
@@ -372,6 +471,7 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>
 
     const algorithmFPType alpha(parameter->alpha);
     const algorithmFPType lambda(parameter->lambda);
+    const size_t nCGIterations = parameter->nConjugateGradientIterations;
 
     size_t nItems                  = task.nItems;
     size_t nUsers                  = task.nUsers;
@@ -389,11 +489,11 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>
                         alpha, lambda, &costFunction);
 #endif
 
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * parameter->nFactors, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors + 4);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * (parameter->nFactors + 4), sizeof(algorithmFPType));
 
     daal::tls<algorithmFPType *> lhs([=]() -> algorithmFPType * {
-        return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->nFactors * parameter->nFactors
+        return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->nFactors * (parameter->nFactors + 4)
                                                                                                  * sizeof(algorithmFPType));
     });
     algorithmFPType beta = 0.0;
@@ -401,14 +501,19 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs);
+        s = this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs, nCGIterations,
+                                 i > 0);
         if (!s) break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs);
+        s = this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs, nCGIterations,
+                                 true);
         if (!s) break;
 
+        /* The factors of the finished iterations are the result of the cancelled training */
+        if (services::internal::isCancelled(s, pHost)) break;
+
 #if 0
         computeCostFunction(nUsers, nItems, nFactors, data, NULL, NULL, itemsFactors, usersFactors,
                             alpha, lambda, &costFunction);
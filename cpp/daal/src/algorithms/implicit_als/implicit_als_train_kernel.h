@@ -28,6 +28,7 @@
 #include "algorithms/implicit_als/implicit_als_training_batch.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "src/algorithms/kernel.h"
+#include "services/host_app.h"
 #include "src/threading/threading.h"
 
 #include "src/data_management/service_numeric_table.h"
@@ -67,6 +68,9 @@ public:
 
     static bool solve(size_t nCols, algorithmFPType * a, algorithmFPType * b);
 
+    static bool solveConjugateGradient(size_t nCols, algorithmFPType * a, const algorithmFPType * b, algorithmFPType * x, size_t nIterations,
+                                       algorithmFPType * buffer);
+
 protected:
     friend struct ImplicitALSTrainTaskBase<algorithmFPType, cpu>;
     friend struct ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>;
@@ -74,7 +78,8 @@ protected:
 
     services::Status computeFactors(size_t nRows, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                                     size_t nFactors, algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha,
-                                    algorithmFPType lambda, algorithmFPType * xtx, daal::tls<algorithmFPType *> & lhs);
+                                    algorithmFPType lambda, algorithmFPType * xtx, daal::tls<algorithmFPType *> & lhs, size_t nCGIterations,
+                                    bool warmStart);
 
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
@@ -123,14 +128,18 @@ template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu> : public ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>
 {
 public:
-    services::Status compute(const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model, const Parameter * parameter);
+    /* The cancelled training returns the factors of the finished iterations with ErrorUserCancelled status */
+    services::Status compute(services::HostAppIface * pHost, const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model,
+                             const Parameter * parameter);
 };
 
 template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu> : public ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>
 {
 public:
-    services::Status compute(const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model, const Parameter * parameter);
+    /* The cancelled training returns the factors of the finished iterations with ErrorUserCancelled status */
+    services::Status compute(services::HostAppIface * pHost, const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model,
+                             const Parameter * parameter);
 };
 
 template <typename algorithmFPType, CpuType cpu>
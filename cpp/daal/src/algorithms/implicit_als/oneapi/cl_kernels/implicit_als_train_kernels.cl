@@ -0,0 +1,245 @@
+/* file: implicit_als_train_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of implicit ALS training OpenCL kernels.
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_TRAIN_KERNELS_CL__
+#define __IMPLICIT_ALS_TRAIN_KERNELS_CL__
+
+#include <string.h>
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    implicit_als_train_kernels,
+
+    // The sum of the values of the work-group, the local size is a power of 2
+    algorithmFPType groupSum(__local algorithmFPType * partial, algorithmFPType value) {
+        const int local_id   = get_local_id(0);
+        const int local_size = get_local_size(0);
+
+        partial[local_id] = value;
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (int stride = local_size / 2; stride > 0; stride /= 2)
+        {
+            if (local_id < stride)
+            {
+                partial[local_id] += partial[local_id + stride];
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+        const algorithmFPType sum = partial[0];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        return sum;
+    }
+
+    // The work-group i forms the normal equations of the row rowStart + i:
+    // lhs = xtx + sum(c1 * y * y') + gamma * I and rhs = sum(c * y) over the
+    // non-zero ratings of the row. Only the upper triangle of xtx is given
+    __kernel void formSystems(const __global algorithmFPType * values, const __global int * colIndices, const __global int * rowOffsets,
+                              const __global algorithmFPType * colFactors, const __global algorithmFPType * xtx, __global algorithmFPType * lhs,
+                              __global algorithmFPType * rhs, int rowStart, int nFactors, algorithmFPType alpha, algorithmFPType lambda,
+                              algorithmFPType gammaShift) {
+        const int i          = get_group_id(0);
+        const int local_id   = get_local_id(0);
+        const int local_size = get_local_size(0);
+
+        const int start             = rowOffsets[rowStart + i];
+        const int end               = rowOffsets[rowStart + i + 1];
+        const algorithmFPType gamma = lambda * ((algorithmFPType)(end - start) + gammaShift);
+
+        __global algorithmFPType * a = lhs + (size_t)i * nFactors * nFactors;
+        __global algorithmFPType * b = rhs + (size_t)i * nFactors;
+
+        for (int idx = local_id; idx < nFactors * nFactors; idx += local_size)
+        {
+            const int k         = idx / nFactors;
+            const int l         = idx % nFactors;
+            algorithmFPType sum = (k <= l) ? xtx[l * nFactors + k] : xtx[k * nFactors + l];
+            for (int j = start; j < end; j++)
+            {
+                const __global algorithmFPType * y = colFactors + (size_t)colIndices[j] * nFactors;
+                sum += alpha * values[j] * y[k] * y[l];
+            }
+            a[idx] = (k == l) ? sum + gamma : sum;
+        }
+
+        for (int k = local_id; k < nFactors; k += local_size)
+        {
+            algorithmFPType sum = (algorithmFPType)0;
+            for (int j = start; j < end; j++)
+            {
+                const algorithmFPType c1 = alpha * values[j];
+                if (c1 > (algorithmFPType)0)
+                {
+                    sum += (c1 + (algorithmFPType)1) * colFactors[(size_t)colIndices[j] * nFactors + k];
+                }
+            }
+            b[k] = sum;
+        }
+    }
+
+    // Solves the system of the row rowStart + i by the Cholesky decomposition
+    // in place, the lower triangle of lhs is replaced with the factor
+    __kernel void solveCholesky(__global algorithmFPType * lhs, const __global algorithmFPType * rhs, __global algorithmFPType * rowFactors,
+                                __global int * failed, int rowStart, int nRows, int nFactors) {
+        const int i = get_global_id(0);
+        if (i >= nRows) return;
+
+        __global algorithmFPType * a       = lhs + (size_t)i * nFactors * nFactors;
+        const __global algorithmFPType * b = rhs + (size_t)i * nFactors;
+        __global algorithmFPType * x       = rowFactors + (size_t)(rowStart + i) * nFactors;
+
+        for (int k = 0; k < nFactors; k++)
+        {
+            algorithmFPType d = a[k * nFactors + k];
+            for (int m = 0; m < k; m++)
+            {
+                d -= a[k * nFactors + m] * a[k * nFactors + m];
+            }
+            if (!(d > (algorithmFPType)0))
+            {
+                failed[0] = 1;
+                return;
+            }
+            d                   = sqrt(d);
+            a[k * nFactors + k] = d;
+            for (int j = k + 1; j < nFactors; j++)
+            {
+                algorithmFPType s = a[j * nFactors + k];
+                for (int m = 0; m < k; m++)
+                {
+                    s -= a[j * nFactors + m] * a[k * nFactors + m];
+                }
+                a[j * nFactors + k] = s / d;
+            }
+        }
+
+        for (int k = 0; k < nFactors; k++)
+        {
+            algorithmFPType s = b[k];
+            for (int m = 0; m < k; m++)
+            {
+                s -= a[k * nFactors + m] * x[m];
+            }
+            x[k] = s / a[k * nFactors + k];
+        }
+        for (int k = nFactors - 1; k >= 0; k--)
+        {
+            algorithmFPType s = x[k];
+            for (int m = k + 1; m < nFactors; m++)
+            {
+                s -= a[m * nFactors + k] * x[m];
+            }
+            x[k] = s / a[k * nFactors + k];
+        }
+    }
+
+    // The work-group i solves the system of the row rowStart + i by the
+    // conjugate gradient method as the host kernel does, the components are
+    // distributed over the work-items. The buffer holds 3 * nFactors values
+    // of every row of the batch
+    __kernel void solveConjugateGradient(const __global algorithmFPType * lhs, const __global algorithmFPType * rhs,
+                                         __global algorithmFPType * rowFactors, __global algorithmFPType * buffer, __global int * failed,
+                                         int rowStart, int nFactors, int nIterations, int warmStart, algorithmFPType epsilon) {
+        __local algorithmFPType partial[32];
+
+        const int i          = get_group_id(0);
+        const int local_id   = get_local_id(0);
+        const int local_size = get_local_size(0);
+
+        const __global algorithmFPType * a = lhs + (size_t)i * nFactors * nFactors;
+        const __global algorithmFPType * b = rhs + (size_t)i * nFactors;
+        __global algorithmFPType * x       = rowFactors + (size_t)(rowStart + i) * nFactors;
+        __global algorithmFPType * r       = buffer + (size_t)i * 3 * nFactors;
+        __global algorithmFPType * p       = r + nFactors;
+        __global algorithmFPType * ap      = p + nFactors;
+
+        if (!warmStart)
+        {
+            for (int k = local_id; k < nFactors; k += local_size)
+            {
+                x[k] = (algorithmFPType)0;
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+
+        algorithmFPType rrLocal = (algorithmFPType)0;
+        algorithmFPType bbLocal = (algorithmFPType)0;
+        for (int k = local_id; k < nFactors; k += local_size)
+        {
+            algorithmFPType s = b[k];
+            for (int l = 0; l < nFactors; l++)
+            {
+                s -= a[k * nFactors + l] * x[l];
+            }
+            r[k] = s;
+            p[k] = s;
+            rrLocal += s * s;
+            bbLocal += b[k] * b[k];
+        }
+        algorithmFPType rr              = groupSum(partial, rrLocal);
+        const algorithmFPType bb        = groupSum(partial, bbLocal);
+        const algorithmFPType tolerance = bb * epsilon;
+        barrier(CLK_GLOBAL_MEM_FENCE);
+
+        for (int iter = 0; iter < nIterations && rr > tolerance; iter++)
+        {
+            algorithmFPType papLocal = (algorithmFPType)0;
+            for (int k = local_id; k < nFactors; k += local_size)
+            {
+                algorithmFPType s = (algorithmFPType)0;
+                for (int l = 0; l < nFactors; l++)
+                {
+                    s += a[k * nFactors + l] * p[l];
+                }
+                ap[k] = s;
+                papLocal += p[k] * s;
+            }
+            const algorithmFPType pap = groupSum(partial, papLocal);
+            if (!(pap > (algorithmFPType)0))
+            {
+                if (local_id == 0) failed[0] = 1;
+                return;
+            }
+
+            const algorithmFPType step = rr / pap;
+            algorithmFPType rrNewLocal = (algorithmFPType)0;
+            for (int k = local_id; k < nFactors; k += local_size)
+            {
+                x[k] += step * p[k];
+                r[k] -= step * ap[k];
+                rrNewLocal += r[k] * r[k];
+            }
+            const algorithmFPType rrNew = groupSum(partial, rrNewLocal);
+            const algorithmFPType ratio = rrNew / rr;
+            for (int k = local_id; k < nFactors; k += local_size)
+            {
+                p[k] = r[k] + ratio * p[k];
+            }
+            rr = rrNew;
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+    }
+
+);
+
+#endif
@@ -0,0 +1,87 @@
+/* file: implicit_als_predict_ratings_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of implicit ALS prediction for GPU.
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_PREDICT_RATINGS_ONEAPI_IMPL_I__
+#define __IMPLICIT_ALS_PREDICT_RATINGS_ONEAPI_IMPL_I__
+
+#include "src/externals/service_ittnotify.h"
+DAAL_ITTNOTIFY_DOMAIN(implicit_als.prediction.ratings.batch.oneapi);
+
+#include "src/sycl/blas_gpu.h"
+
+using namespace daal::services;
+using namespace daal::services::internal::sycl;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace prediction
+{
+namespace ratings
+{
+namespace internal
+{
+template <typename algorithmFPType>
+services::Status ImplicitALSPredictKernelOneAPI<algorithmFPType>::compute(const NumericTable * usersFactorsTable,
+                                                                          const NumericTable * itemsFactorsTable, NumericTable * ratingsTable,
+                                                                          const Parameter * parameter)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    services::Status st;
+
+    const size_t nUsers   = usersFactorsTable->getNumberOfRows();
+    const size_t nItems   = itemsFactorsTable->getNumberOfRows();
+    const size_t nFactors = parameter->nFactors;
+
+    NumericTable & usersTable = *const_cast<NumericTable *>(usersFactorsTable);
+    NumericTable & itemsTable = *const_cast<NumericTable *>(itemsFactorsTable);
+    BlockDescriptor<algorithmFPType> usersBlock;
+    BlockDescriptor<algorithmFPType> itemsBlock;
+    BlockDescriptor<algorithmFPType> ratingsBlock;
+    DAAL_CHECK_STATUS(st, usersTable.getBlockOfRows(0, nUsers, readOnly, usersBlock));
+    DAAL_CHECK_STATUS(st, itemsTable.getBlockOfRows(0, nItems, readOnly, itemsBlock));
+    DAAL_CHECK_STATUS(st, ratingsTable->getBlockOfRows(0, nUsers, writeOnly, ratingsBlock));
+
+    /* ratings[i * nItems + j] is the dot product of the factors of the user i and the item j as in the host kernel */
+    DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::ColMajor, math::Transpose::Trans, math::Transpose::NoTrans, nItems, nUsers,
+                                                          nFactors, algorithmFPType(1), itemsBlock.getBuffer(), nFactors, 0, usersBlock.getBuffer(),
+                                                          nFactors, 0, algorithmFPType(0), ratingsBlock.getBuffer(), nItems, 0));
+
+    DAAL_CHECK_STATUS(st, ratingsTable->releaseBlockOfRows(ratingsBlock));
+    DAAL_CHECK_STATUS(st, itemsTable.releaseBlockOfRows(itemsBlock));
+    DAAL_CHECK_STATUS(st, usersTable.releaseBlockOfRows(usersBlock));
+    return st;
+}
+
+} // namespace internal
+} // namespace ratings
+} // namespace prediction
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,97 @@
+/* file: implicit_als_train_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that trains implicit ALS on GPU.
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_TRAIN_KERNEL_ONEAPI_H__
+#define __IMPLICIT_ALS_TRAIN_KERNEL_ONEAPI_H__
+
+#include "algorithms/implicit_als/implicit_als_training_batch.h"
+#include "algorithms/implicit_als/implicit_als_model.h"
+#include "services/internal/sycl/types.h"
+#include "services/internal/sycl/execution_context.h"
+#include "src/algorithms/kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * The ratings and their transpose are uploaded once as 0-based CSR arrays,
+ * the factors stay on the device for all the iterations. Every half-iteration
+ * computes the Gram matrix of the fixed factors with SYRK, then forms and
+ * solves the normal equations of a batch of rows at a time on the device.
+ */
+template <typename algorithmFPType, Method method>
+class ImplicitALSTrainBatchKernelOneAPI : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const data_management::NumericTable * dataTable, implicit_als::Model * initModel, implicit_als::Model * model,
+                             const Parameter * parameter);
+
+private:
+    /* Uploads the ratings of the users and of the items in the 0-based CSR format */
+    services::Status uploadData(const data_management::NumericTable * dataTable, size_t nUsers, size_t nItems);
+
+    /* xtx = x' * x for the nRows x nFactors factors x, only the upper triangle is computed */
+    services::Status computeXtX(const services::internal::sycl::UniversalBuffer & x, uint32_t nRows, uint32_t nFactors,
+                                services::internal::sycl::UniversalBuffer & xtx);
+
+    services::Status computeFactors(const services::internal::sycl::UniversalBuffer & values,
+                                    const services::internal::sycl::UniversalBuffer & colIndices,
+                                    const services::internal::sycl::UniversalBuffer & rowOffsets, uint32_t nRows, uint32_t nFactors,
+                                    const services::internal::sycl::UniversalBuffer & colFactors,
+                                    services::internal::sycl::UniversalBuffer & rowFactors,
+                                    const services::internal::sycl::UniversalBuffer & xtx, algorithmFPType alpha, algorithmFPType lambda,
+                                    uint32_t nCGIterations, bool warmStart);
+
+private:
+    services::internal::sycl::UniversalBuffer _values;
+    services::internal::sycl::UniversalBuffer _colIndices;
+    services::internal::sycl::UniversalBuffer _rowOffsets;
+    services::internal::sycl::UniversalBuffer _tValues;
+    services::internal::sycl::UniversalBuffer _rowIndices;
+    services::internal::sycl::UniversalBuffer _colOffsets;
+
+    services::internal::sycl::UniversalBuffer _lhs;
+    services::internal::sycl::UniversalBuffer _rhs;
+    services::internal::sycl::UniversalBuffer _cgBuffer;
+    services::internal::sycl::UniversalBuffer _failed;
+    uint32_t _batchSize;
+
+    services::internal::sycl::KernelPtr _formSystemsKernel;
+    services::internal::sycl::KernelPtr _solveCholeskyKernel;
+    services::internal::sycl::KernelPtr _solveConjugateGradientKernel;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,380 @@
+/* file: implicit_als_train_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of implicit ALS training for GPU.
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_TRAIN_ONEAPI_IMPL_I__
+#define __IMPLICIT_ALS_TRAIN_ONEAPI_IMPL_I__
+
+#include "src/externals/service_ittnotify.h"
+DAAL_ITTNOTIFY_DOMAIN(implicit_als.training.batch.oneapi);
+
+#include "src/algorithms/implicit_als/oneapi/cl_kernels/implicit_als_train_kernels.cl"
+#include "src/sycl/blas_gpu.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_data_utils.h"
+#include "data_management/data/csr_numeric_table.h"
+
+using namespace daal::services;
+using namespace daal::internal;
+using namespace daal::services::internal::sycl;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace training
+{
+namespace internal
+{
+/* The work-group size of the kernels that process one row per work-group, a power of 2 not greater
+   than the size of the local reduction buffer of the conjugate gradient kernel */
+const uint32_t rowLocalSize = 32;
+
+/* The batch of systems is limited by the number of their values */
+const size_t maxBatchValues = size_t(1) << 24;
+
+template <typename T>
+static services::Status uploadArray(const T * data, size_t n, UniversalBuffer & buffer)
+{
+    services::Status st;
+    auto & context = services::internal::getDefaultContext();
+    buffer         = context.allocate(TypeIds::id<T>(), n ? n : 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    if (n)
+    {
+        context.copy(buffer, 0, (void *)data, 0, n, &st);
+    }
+    return st;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status ImplicitALSTrainBatchKernelOneAPI<algorithmFPType, method>::uploadData(const NumericTable * dataTable, size_t nUsers, size_t nItems)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.uploadData);
+    services::Status st;
+
+    services::internal::TArray<int, sse2> rowOffsetsArray(nUsers + 1);
+    services::internal::TArray<int, sse2> colOffsetsArray(nItems + 1);
+    DAAL_CHECK_MALLOC(rowOffsetsArray.get() && colOffsetsArray.get());
+    int * rowOffsets = rowOffsetsArray.get();
+    int * colOffsets = colOffsetsArray.get();
+
+    services::internal::TArray<algorithmFPType, sse2> valuesArray;
+    services::internal::TArray<int, sse2> colIndicesArray;
+    size_t nNonZeros = 0;
+
+    if (method == fastCSR)
+    {
+        CSRNumericTableIface * csrTable = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(dataTable));
+        DAAL_CHECK(csrTable, ErrorIncorrectTypeOfInputNumericTable);
+        ReadRowsCSR<algorithmFPType, sse2> mtData(csrTable, 0, nUsers);
+        DAAL_CHECK_BLOCK_STATUS(mtData);
+        const size_t * rows = mtData.rows();
+        nNonZeros           = rows[nUsers] - rows[0];
+        DAAL_CHECK(nNonZeros <= static_cast<size_t>(services::internal::MaxVal<int>::get()), ErrorBufferSizeIntegerOverflow);
+
+        valuesArray.reset(nNonZeros);
+        colIndicesArray.reset(nNonZeros);
+        DAAL_CHECK_MALLOC(nNonZeros == 0 || (valuesArray.get() && colIndicesArray.get()));
+        for (size_t i = 0; i <= nUsers; i++)
+        {
+            rowOffsets[i] = static_cast<int>(rows[i] - rows[0]);
+        }
+        for (size_t j = 0; j < nNonZeros; j++)
+        {
+            valuesArray[j]     = mtData.values()[j];
+            colIndicesArray[j] = static_cast<int>(mtData.cols()[j] - 1);
+        }
+    }
+    else
+    {
+        /* The positive ratings of the dense table are the non-zero values as in the host kernel */
+        ReadRows<algorithmFPType, sse2> mtData(*const_cast<NumericTable *>(dataTable), 0, nUsers);
+        DAAL_CHECK_BLOCK_STATUS(mtData);
+        const algorithmFPType * data = mtData.get();
+        for (size_t i = 0; i < nUsers * nItems; i++)
+        {
+            nNonZeros += (data[i] > 0);
+        }
+        DAAL_CHECK(nNonZeros <= static_cast<size_t>(services::internal::MaxVal<int>::get()), ErrorBufferSizeIntegerOverflow);
+
+        valuesArray.reset(nNonZeros);
+        colIndicesArray.reset(nNonZeros);
+        DAAL_CHECK_MALLOC(nNonZeros == 0 || (valuesArray.get() && colIndicesArray.get()));
+        size_t pos    = 0;
+        rowOffsets[0] = 0;
+        for (size_t i = 0; i < nUsers; i++)
+        {
+            for (size_t j = 0; j < nItems; j++)
+            {
+                if (data[i * nItems + j] > 0)
+                {
+                    valuesArray[pos]     = data[i * nItems + j];
+                    colIndicesArray[pos] = static_cast<int>(j);
+                    pos++;
+                }
+            }
+            rowOffsets[i + 1] = static_cast<int>(pos);
+        }
+    }
+
+    /* The ratings of the items are the transposed ratings of the users */
+    services::internal::TArray<algorithmFPType, sse2> tValuesArray(nNonZeros);
+    services::internal::TArray<int, sse2> rowIndicesArray(nNonZeros);
+    services::internal::TArray<int, sse2> positionsArray(nItems);
+    DAAL_CHECK_MALLOC((nNonZeros == 0 || (tValuesArray.get() && rowIndicesArray.get())) && positionsArray.get());
+    for (size_t j = 0; j <= nItems; j++)
+    {
+        colOffsets[j] = 0;
+    }
+    for (size_t k = 0; k < nNonZeros; k++)
+    {
+        colOffsets[colIndicesArray[k] + 1]++;
+    }
+    for (size_t j = 0; j < nItems; j++)
+    {
+        colOffsets[j + 1] += colOffsets[j];
+        positionsArray[j] = colOffsets[j];
+    }
+    for (size_t i = 0; i < nUsers; i++)
+    {
+        for (int k = rowOffsets[i]; k < rowOffsets[i + 1]; k++)
+        {
+            const int pos        = positionsArray[colIndicesArray[k]]++;
+            tValuesArray[pos]    = valuesArray[k];
+            rowIndicesArray[pos] = static_cast<int>(i);
+        }
+    }
+
+    DAAL_CHECK_STATUS(st, uploadArray<algorithmFPType>(valuesArray.get(), nNonZeros, _values));
+    DAAL_CHECK_STATUS(st, uploadArray<int>(colIndicesArray.get(), nNonZeros, _colIndices));
+    DAAL_CHECK_STATUS(st, uploadArray<int>(rowOffsets, nUsers + 1, _rowOffsets));
+    DAAL_CHECK_STATUS(st, uploadArray<algorithmFPType>(tValuesArray.get(), nNonZeros, _tValues));
+    DAAL_CHECK_STATUS(st, uploadArray<int>(rowIndicesArray.get(), nNonZeros, _rowIndices));
+    DAAL_CHECK_STATUS(st, uploadArray<int>(colOffsets, nItems + 1, _colOffsets));
+    return st;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status ImplicitALSTrainBatchKernelOneAPI<algorithmFPType, method>::computeXtX(const UniversalBuffer & x, uint32_t nRows, uint32_t nFactors,
+                                                                                        UniversalBuffer & xtx)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeXtX);
+    return BlasGpu<algorithmFPType>::xsyrk(math::Layout::ColMajor, math::UpLo::Upper, math::Transpose::NoTrans, nFactors, nRows,
+                                           algorithmFPType(1), x, nFactors, 0, algorithmFPType(0), xtx, nFactors, 0);
+}
+
+template <typename algorithmFPType, Method method>
+services::Status ImplicitALSTrainBatchKernelOneAPI<algorithmFPType, method>::computeFactors(
+    const UniversalBuffer & values, const UniversalBuffer & colIndices, const UniversalBuffer & rowOffsets, uint32_t nRows, uint32_t nFactors,
+    const UniversalBuffer & colFactors, UniversalBuffer & rowFactors, const UniversalBuffer & xtx, algorithmFPType alpha, algorithmFPType lambda,
+    uint32_t nCGIterations, bool warmStart)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeFactors);
+    services::Status st;
+    auto & context = services::internal::getDefaultContext();
+
+    /* The dense ratings give the regularization lambda * (1 + n) to the row with n positive ratings */
+    const algorithmFPType gammaShift = (method == defaultDense) ? algorithmFPType(1) : algorithmFPType(0);
+
+    for (uint32_t rowStart = 0; rowStart < nRows; rowStart += _batchSize)
+    {
+        const uint32_t nBatch = (nRows - rowStart < _batchSize) ? nRows - rowStart : _batchSize;
+
+        KernelRange localRange(rowLocalSize);
+        KernelRange globalRange(nBatch * rowLocalSize);
+        KernelNDRange rowRange(1);
+        rowRange.global(globalRange, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        rowRange.local(localRange, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeFactors.formSystems);
+            KernelArguments args(12);
+            args.set(0, values, AccessModeIds::read);
+            args.set(1, colIndices, AccessModeIds::read);
+            args.set(2, rowOffsets, AccessModeIds::read);
+            args.set(3, colFactors, AccessModeIds::read);
+            args.set(4, xtx, AccessModeIds::read);
+            args.set(5, _lhs, AccessModeIds::write);
+            args.set(6, _rhs, AccessModeIds::write);
+            args.set(7, static_cast<int>(rowStart));
+            args.set(8, static_cast<int>(nFactors));
+            args.set(9, alpha);
+            args.set(10, lambda);
+            args.set(11, gammaShift);
+
+            context.run(rowRange, _formSystemsKernel, args, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+
+        if (nCGIterations)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeFactors.solveConjugateGradient);
+            KernelArguments args(10);
+            args.set(0, _lhs, AccessModeIds::read);
+            args.set(1, _rhs, AccessModeIds::read);
+            args.set(2, rowFactors, AccessModeIds::readwrite);
+            args.set(3, _cgBuffer, AccessModeIds::readwrite);
+            args.set(4, _failed, AccessModeIds::write);
+            args.set(5, static_cast<int>(rowStart));
+            args.set(6, static_cast<int>(nFactors));
+            args.set(7, static_cast<int>(nCGIterations));
+            args.set(8, static_cast<int>(warmStart));
+            args.set(9, services::internal::EpsilonVal<algorithmFPType>::get());
+
+            context.run(rowRange, _solveConjugateGradientKernel, args, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+        else
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeFactors.solveCholesky);
+            KernelArguments args(7);
+            args.set(0, _lhs, AccessModeIds::readwrite);
+            args.set(1, _rhs, AccessModeIds::read);
+            args.set(2, rowFactors, AccessModeIds::write);
+            args.set(3, _failed, AccessModeIds::write);
+            args.set(4, static_cast<int>(rowStart));
+            args.set(5, static_cast<int>(nBatch));
+            args.set(6, static_cast<int>(nFactors));
+
+            KernelRange range(nBatch);
+            context.run(range, _solveCholeskyKernel, args, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+    }
+    return st;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status ImplicitALSTrainBatchKernelOneAPI<algorithmFPType, method>::compute(const NumericTable * dataTable, implicit_als::Model * initModel,
+                                                                                     implicit_als::Model * model, const Parameter * parameter)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    services::Status st;
+
+    auto & context        = services::internal::getDefaultContext();
+    auto & kernel_factory = context.getClKernelFactory();
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.buildProgram);
+        auto fptype_name   = getKeyFPType<algorithmFPType>();
+        auto build_options = fptype_name;
+        build_options.add("-cl-std=CL1.2");
+
+        services::String cachekey("__daal_algorithms_implicit_als_train_batch_");
+        cachekey.add(fptype_name);
+        kernel_factory.build(ExecutionTargetIds::device, cachekey.c_str(), implicit_als_train_kernels, build_options.c_str(), &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+    _formSystemsKernel = kernel_factory.getKernel("formSystems", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _solveCholeskyKernel = kernel_factory.getKernel("solveCholesky", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _solveConjugateGradientKernel = kernel_factory.getKernel("solveConjugateGradient", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    const size_t nUsers        = dataTable->getNumberOfRows();
+    const size_t nItems        = dataTable->getNumberOfColumns();
+    const size_t nFactors      = parameter->nFactors;
+    const size_t nCGIterations = parameter->nConjugateGradientIterations;
+    const algorithmFPType alpha(parameter->alpha);
+    const algorithmFPType lambda(parameter->lambda);
+
+    const size_t maxInt  = static_cast<size_t>(services::internal::MaxVal<int>::get());
+    const size_t maxRows = nUsers > nItems ? nUsers : nItems;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFactors, nFactors);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, maxRows, nFactors);
+    DAAL_CHECK(maxRows <= maxInt && nFactors * nFactors <= maxInt && nCGIterations <= maxInt, ErrorBufferSizeIntegerOverflow);
+
+    DAAL_CHECK_STATUS(st, uploadData(dataTable, nUsers, nItems));
+
+    const size_t nSystemValues = nFactors * nFactors;
+    const size_t batchSize     = maxBatchValues / nSystemValues ? maxBatchValues / nSystemValues : 1;
+    _batchSize                 = static_cast<uint32_t>(maxRows < batchSize ? maxRows : batchSize);
+
+    _lhs = context.allocate(TypeIds::id<algorithmFPType>(), _batchSize * nSystemValues, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _rhs = context.allocate(TypeIds::id<algorithmFPType>(), _batchSize * nFactors, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _cgBuffer = context.allocate(TypeIds::id<algorithmFPType>(), nCGIterations ? _batchSize * 3 * nFactors : 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _failed = context.allocate(TypeIds::id<int>(), 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    context.fill(_failed, 0.0, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto xtx = context.allocate(TypeIds::id<algorithmFPType>(), nSystemValues, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    /* The factors of the model stay on the device for all the iterations */
+    NumericTable & itemsTable = *model->getItemsFactors();
+    NumericTable & usersTable = *model->getUsersFactors();
+    BlockDescriptor<algorithmFPType> itemsBlock;
+    BlockDescriptor<algorithmFPType> usersBlock;
+    DAAL_CHECK_STATUS(st, itemsTable.getBlockOfRows(0, nItems, readWrite, itemsBlock));
+    DAAL_CHECK_STATUS(st, usersTable.getBlockOfRows(0, nUsers, readWrite, usersBlock));
+    UniversalBuffer itemsFactors = itemsBlock.getBuffer();
+    UniversalBuffer usersFactors = usersBlock.getBuffer();
+
+    if (initModel->getItemsFactors().get() != model->getItemsFactors().get())
+    {
+        NumericTable & initItemsTable = *initModel->getItemsFactors();
+        BlockDescriptor<algorithmFPType> initItemsBlock;
+        DAAL_CHECK_STATUS(st, initItemsTable.getBlockOfRows(0, nItems, readOnly, initItemsBlock));
+        context.copy(itemsFactors, 0, initItemsBlock.getBuffer(), 0, nItems * nFactors, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK_STATUS(st, initItemsTable.releaseBlockOfRows(initItemsBlock));
+    }
+
+    for (size_t i = 0; i < parameter->maxIterations; i++)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.iteration);
+        DAAL_CHECK_STATUS(st, computeXtX(itemsFactors, nItems, nFactors, xtx));
+        DAAL_CHECK_STATUS(st, computeFactors(_values, _colIndices, _rowOffsets, nUsers, nFactors, itemsFactors, usersFactors, xtx, alpha, lambda,
+                                             nCGIterations, i > 0));
+
+        DAAL_CHECK_STATUS(st, computeXtX(usersFactors, nUsers, nFactors, xtx));
+        DAAL_CHECK_STATUS(st, computeFactors(_tValues, _rowIndices, _colOffsets, nItems, nFactors, usersFactors, itemsFactors, xtx, alpha, lambda,
+                                             nCGIterations, true));
+
+        auto failedHost = _failed.template get<int>().toHost(ReadWriteMode::readOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK(failedHost.get()[0] == 0, ErrorALSInternal);
+    }
+
+    DAAL_CHECK_STATUS(st, itemsTable.releaseBlockOfRows(itemsBlock));
+    DAAL_CHECK_STATUS(st, usersTable.releaseBlockOfRows(usersBlock));
+    return st;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,351 @@
+/* file: bf_knn_classification_ivf_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of the inverted file index of the approximate k nearest
+//  neighbors classification.
+//
+//  The rows of the training data are grouped into the inverted lists of their
+//  closest centroids. The query is compared with the rows of the nProbes lists
+//  of its closest centroids only, so the search costs about nProbes / nLists of
+//  the brute force search.
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_IVF_IMPL_I__
+#define __BF_KNN_CLASSIFICATION_IVF_IMPL_I__
+
+#include "src/algorithms/k_nearest_neighbors/bf_knn_classification_ivf_kernel.h"
+#include "src/algorithms/service_heap.h"
+#include "src/algorithms/service_kernel_math.h"
+#include "src/algorithms/service_threading.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_defines.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+using daal::algorithms::internal::EuclideanDistances;
+
+const size_t ivfRowBlockSize      = 128;
+const size_t ivfCentroidBlockSize = 128;
+
+template <typename algorithmFPType>
+struct IVFNeighbor
+{
+    algorithmFPType distance;
+    int index;
+};
+
+template <typename algorithmFPType>
+struct IVFNeighborLess
+{
+    bool operator()(const IVFNeighbor<algorithmFPType> & a, const IVFNeighbor<algorithmFPType> & b) const { return a.distance < b.distance; }
+};
+
+template <typename algorithmFPType, CpuType cpu>
+DAAL_FORCEINLINE void resetNeighbors(IVFNeighbor<algorithmFPType> * heap, const size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        heap[i].distance = MaxVal<algorithmFPType>::get();
+        heap[i].index    = -1;
+    }
+}
+
+/* Replaces the farthest neighbor in the max-heap of the neighbors if the candidate is closer */
+template <typename algorithmFPType, CpuType cpu>
+DAAL_FORCEINLINE void insertNeighbor(IVFNeighbor<algorithmFPType> * heap, const size_t size, const algorithmFPType distance, const int index)
+{
+    if (distance < heap[0].distance)
+    {
+        heap[0].distance = distance;
+        heap[0].index    = index;
+        daal::algorithms::internal::internalAdjustMaxHeap<cpu>(heap, heap + size, size, size_t(0), IVFNeighborLess<algorithmFPType>());
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+DAAL_FORCEINLINE algorithmFPType ivfSquaredDistance(const algorithmFPType * x, const algorithmFPType * y, const size_t p)
+{
+    algorithmFPType sum = algorithmFPType(0);
+    PRAGMA_IVDEP
+    PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+    for (size_t j = 0; j < p; j++)
+    {
+        const algorithmFPType diff = x[j] - y[j];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+/* Finds the nClosest closest centroids of every row of the block, the centroids of the row i
+   are the max-heap closest[i * nClosest, (i + 1) * nClosest) */
+template <typename algorithmFPType, CpuType cpu>
+services::Status findClosestCentroids(EuclideanDistances<algorithmFPType, cpu> & distances, const algorithmFPType * rows, const size_t rowOffset,
+                                      const size_t blockSize, const algorithmFPType * centroids, const size_t nLists, const size_t p,
+                                      const size_t nClosest, algorithmFPType * buffer, IVFNeighbor<algorithmFPType> * closest)
+{
+    resetNeighbors<algorithmFPType, cpu>(closest, blockSize * nClosest);
+
+    const size_t nCentroidBlocks = nLists / ivfCentroidBlockSize + !!(nLists % ivfCentroidBlockSize);
+    for (size_t iBlock = 0; iBlock < nCentroidBlocks; iBlock++)
+    {
+        const size_t start = iBlock * ivfCentroidBlockSize;
+        const size_t size  = (iBlock + 1 == nCentroidBlocks) ? nLists - start : ivfCentroidBlockSize;
+
+        DAAL_CHECK_STATUS_VAR(distances.computeBatch(rows, centroids + start * p, rowOffset, blockSize, start, size, buffer));
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                insertNeighbor<algorithmFPType, cpu>(closest + i * nClosest, nClosest, buffer[i * size + j], (int)(start + j));
+            }
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status IVFTrainKernel<algorithmFPType, cpu>::compute(const NumericTable * data, const NumericTable * labels, const NumericTable * centroids,
+                                                               NumericTable * listOffsets, NumericTable * indexData, NumericTable * indexLabels)
+{
+    const size_t n      = data->getNumberOfRows();
+    const size_t p      = data->getNumberOfColumns();
+    const size_t nLists = centroids->getNumberOfRows();
+    DAAL_CHECK(n <= static_cast<size_t>(MaxVal<int>::get()), services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+
+    ReadRows<algorithmFPType, cpu> centroidRows(const_cast<NumericTable *>(centroids), 0, nLists);
+    DAAL_CHECK_BLOCK_STATUS(centroidRows);
+    const algorithmFPType * const centroidData = centroidRows.get();
+
+    TArray<int, cpu> assignments(n);
+    TArray<int, cpu> offsets(nLists + 1);
+    DAAL_CHECK_MALLOC(assignments.get() && offsets.get());
+
+    EuclideanDistances<algorithmFPType, cpu> distances(*data, *centroids, true);
+    DAAL_CHECK_STATUS_VAR(distances.init());
+
+    TlsMem<algorithmFPType, cpu> tlsDistances(ivfRowBlockSize * ivfCentroidBlockSize);
+    TlsMem<IVFNeighbor<algorithmFPType>, cpu> tlsClosest(ivfRowBlockSize);
+
+    const size_t nBlocks = n / ivfRowBlockSize + !!(n % ivfRowBlockSize);
+    int * const assigned = assignments.get();
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        const size_t start     = iBlock * ivfRowBlockSize;
+        const size_t blockSize = (iBlock + 1 == nBlocks) ? n - start : ivfRowBlockSize;
+
+        algorithmFPType * const buffer            = tlsDistances.local();
+        IVFNeighbor<algorithmFPType> * const best = tlsClosest.local();
+        DAAL_CHECK_MALLOC_THR(buffer && best);
+
+        ReadRows<algorithmFPType, cpu> rows(const_cast<NumericTable *>(data), start, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(rows);
+
+        DAAL_CHECK_STATUS_THR(
+            (findClosestCentroids<algorithmFPType, cpu>(distances, rows.get(), start, blockSize, centroidData, nLists, p, 1, buffer, best)));
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            assigned[start + i] = best[i].index;
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* The counting sort by the lists, the rows keep their order within every list */
+    int * const offset = offsets.get();
+    service_memset_seq<int, cpu>(offset, 0, nLists + 1);
+    for (size_t i = 0; i < n; i++)
+    {
+        offset[assigned[i] + 1]++;
+    }
+    for (size_t i = 0; i < nLists; i++)
+    {
+        offset[i + 1] += offset[i];
+    }
+    {
+        TArray<int, cpu> cursors(nLists);
+        DAAL_CHECK_MALLOC(cursors.get());
+        int * const cursor = cursors.get();
+        for (size_t i = 0; i < nLists; i++)
+        {
+            cursor[i] = offset[i];
+        }
+        /* Every row is replaced by its position in the grouped data */
+        for (size_t i = 0; i < n; i++)
+        {
+            assigned[i] = cursor[assigned[i]]++;
+        }
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> indexDataRows(indexData, 0, n);
+    DAAL_CHECK_BLOCK_STATUS(indexDataRows);
+    WriteOnlyRows<algorithmFPType, cpu> indexLabelRows(indexLabels, 0, n);
+    DAAL_CHECK_BLOCK_STATUS(indexLabelRows);
+    algorithmFPType * const groupedData   = indexDataRows.get();
+    algorithmFPType * const groupedLabels = indexLabelRows.get();
+
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        const size_t start     = iBlock * ivfRowBlockSize;
+        const size_t blockSize = (iBlock + 1 == nBlocks) ? n - start : ivfRowBlockSize;
+
+        ReadRows<algorithmFPType, cpu> rows(const_cast<NumericTable *>(data), start, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(rows);
+        ReadRows<algorithmFPType, cpu> labelRows(const_cast<NumericTable *>(labels), start, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(labelRows);
+        const algorithmFPType * const x = rows.get();
+        const algorithmFPType * const y = labelRows.get();
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t position = assigned[start + i];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                groupedData[position * p + j] = x[i * p + j];
+            }
+            groupedLabels[position] = y[i];
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    WriteOnlyRows<int, cpu> offsetRows(listOffsets, 0, nLists + 1);
+    DAAL_CHECK_BLOCK_STATUS(offsetRows);
+    const size_t offsetsSize = (nLists + 1) * sizeof(int);
+    DAAL_CHECK(!services::internal::daal_memcpy_s(offsetRows.get(), offsetsSize, offset, offsetsSize), services::ErrorMemoryCopyFailedInternal);
+
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status IVFPredictKernel<algorithmFPType, cpu>::compute(const NumericTable * data, const NumericTable * centroids,
+                                                                 const NumericTable * listOffsets, const NumericTable * indexData,
+                                                                 const NumericTable * indexLabels, NumericTable * labels, const IVFParameter & par)
+{
+    const size_t nQueries = data->getNumberOfRows();
+    const size_t p        = data->getNumberOfColumns();
+    const size_t nLists   = centroids->getNumberOfRows();
+    const size_t n        = indexData->getNumberOfRows();
+    const size_t k        = par.k;
+    const size_t nClasses = par.nClasses;
+    const size_t nProbes  = (par.nProbes < nLists) ? par.nProbes : nLists;
+
+    ReadRows<algorithmFPType, cpu> centroidRows(const_cast<NumericTable *>(centroids), 0, nLists);
+    DAAL_CHECK_BLOCK_STATUS(centroidRows);
+    ReadRows<int, cpu> offsetRows(const_cast<NumericTable *>(listOffsets), 0, nLists + 1);
+    DAAL_CHECK_BLOCK_STATUS(offsetRows);
+    ReadRows<algorithmFPType, cpu> indexDataRows(const_cast<NumericTable *>(indexData), 0, n);
+    DAAL_CHECK_BLOCK_STATUS(indexDataRows);
+    ReadRows<algorithmFPType, cpu> indexLabelRows(const_cast<NumericTable *>(indexLabels), 0, n);
+    DAAL_CHECK_BLOCK_STATUS(indexLabelRows);
+
+    const algorithmFPType * const centroidData  = centroidRows.get();
+    const int * const offset                    = offsetRows.get();
+    const algorithmFPType * const groupedData   = indexDataRows.get();
+    const algorithmFPType * const groupedLabels = indexLabelRows.get();
+
+    EuclideanDistances<algorithmFPType, cpu> distances(*data, *centroids, true);
+    DAAL_CHECK_STATUS_VAR(distances.init());
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, ivfRowBlockSize, nProbes);
+    TlsMem<algorithmFPType, cpu> tlsDistances(ivfRowBlockSize * ivfCentroidBlockSize);
+    TlsMem<IVFNeighbor<algorithmFPType>, cpu> tlsProbes(ivfRowBlockSize * nProbes);
+    TlsMem<IVFNeighbor<algorithmFPType>, cpu> tlsNeighbors(k);
+    TlsMem<size_t, cpu> tlsVotes(nClasses);
+
+    const size_t nBlocks = nQueries / ivfRowBlockSize + !!(nQueries % ivfRowBlockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        const size_t start     = iBlock * ivfRowBlockSize;
+        const size_t blockSize = (iBlock + 1 == nBlocks) ? nQueries - start : ivfRowBlockSize;
+
+        algorithmFPType * const buffer                 = tlsDistances.local();
+        IVFNeighbor<algorithmFPType> * const probes    = tlsProbes.local();
+        IVFNeighbor<algorithmFPType> * const neighbors = tlsNeighbors.local();
+        size_t * const votes                           = tlsVotes.local();
+        DAAL_CHECK_MALLOC_THR(buffer && probes && neighbors && votes);
+
+        ReadRows<algorithmFPType, cpu> rows(const_cast<NumericTable *>(data), start, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(rows);
+        WriteOnlyRows<algorithmFPType, cpu> labelRows(labels, start, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(labelRows);
+        const algorithmFPType * const queries = rows.get();
+        algorithmFPType * const result        = labelRows.get();
+
+        DAAL_CHECK_STATUS_THR(
+            (findClosestCentroids<algorithmFPType, cpu>(distances, queries, start, blockSize, centroidData, nLists, p, nProbes, buffer, probes)));
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const algorithmFPType * const query = queries + i * p;
+            resetNeighbors<algorithmFPType, cpu>(neighbors, k);
+            for (size_t j = 0; j < nProbes; j++)
+            {
+                const int list = probes[i * nProbes + j].index;
+                if (list < 0)
+                {
+                    continue;
+                }
+                for (int row = offset[list]; row < offset[list + 1]; row++)
+                {
+                    const algorithmFPType distance = ivfSquaredDistance<algorithmFPType, cpu>(query, groupedData + row * p, p);
+                    insertNeighbor<algorithmFPType, cpu>(neighbors, k, distance, row);
+                }
+            }
+
+            service_memset_seq<size_t, cpu>(votes, 0, nClasses);
+            for (size_t j = 0; j < k; j++)
+            {
+                if (neighbors[j].index >= 0)
+                {
+                    const size_t label = (size_t)groupedLabels[neighbors[j].index];
+                    votes[(label < nClasses) ? label : 0]++;
+                }
+            }
+            size_t winner = 0;
+            for (size_t c = 1; c < nClasses; c++)
+            {
+                winner = (votes[c] > votes[winner]) ? c : winner;
+            }
+            result[i] = (algorithmFPType)winner;
+        }
+    });
+
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
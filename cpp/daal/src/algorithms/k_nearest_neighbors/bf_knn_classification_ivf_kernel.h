@@ -0,0 +1,86 @@
+/* file: bf_knn_classification_ivf_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Declaration of template functions that build and search the inverted file
+//  index of the approximate k nearest neighbors classification.
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_IVF_KERNEL_H__
+#define __BF_KNN_CLASSIFICATION_IVF_KERNEL_H__
+
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+struct IVFParameter
+{
+    IVFParameter(size_t _nClasses, size_t _k, size_t _nProbes) : nClasses(_nClasses), k(_k), nProbes(_nProbes) {}
+
+    size_t nClasses; /* Number of the classes */
+    size_t k;        /* Number of the neighbors */
+    size_t nProbes;  /* Number of the inverted lists of the closest centroids searched for every query */
+};
+
+/*
+ *  Builds the inverted file index: assigns every row of the data to the closest centroid and
+ *  groups the rows and the labels by the centroids keeping their order within every list.
+ *
+ *  Inputs:  n x p data, n x 1 labels, nLists x p centroids.
+ *  Results: (nLists + 1) x 1 offsets of the lists, the rows of the list i occupy
+ *           [offsets[i], offsets[i + 1]) of the n x p grouped data and the n x 1 grouped labels.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class IVFTrainKernel : public Kernel
+{
+public:
+    services::Status compute(const NumericTable * data, const NumericTable * labels, const NumericTable * centroids, NumericTable * listOffsets,
+                             NumericTable * indexData, NumericTable * indexLabels);
+};
+
+/*
+ *  Searches the k nearest neighbors of every query in the nProbes inverted lists of the closest
+ *  centroids and assigns the query to the most frequent class of the neighbors.
+ *
+ *  Inputs:  m x p queries, the centroids, the offsets of the lists, the grouped data and labels.
+ *  Results: m x 1 labels.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class IVFPredictKernel : public Kernel
+{
+public:
+    services::Status compute(const NumericTable * data, const NumericTable * centroids, const NumericTable * listOffsets,
+                             const NumericTable * indexData, const NumericTable * indexLabels, NumericTable * labels, const IVFParameter & par);
+};
+
+} // namespace internal
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
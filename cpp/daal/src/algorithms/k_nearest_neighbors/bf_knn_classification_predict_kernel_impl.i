@@ -53,12 +53,11 @@ services::Status KNNClassificationPredictKernel<algorithmFPType, cpu>::compute(c
     const VoteWeights voteWeights       = parameter->voteWeights;
     const DAAL_UINT64 resultsToEvaluate = parameter->resultsToEvaluate;
     const DAAL_UINT64 resultsToCompute  = parameter->resultsToCompute;
+    const DistancePrecision precision   = parameter->distancePrecision;
 
     daal::algorithms::bf_knn_classification::internal::BruteForceNearestNeighbors<algorithmFPType, cpu> bfnn;
-    bfnn.kNeighbors(k, nClasses, voteWeights, resultsToCompute, resultsToEvaluate, trainDataTable.get(), data, trainLabelTable.get(), label, indices,
-                    distances);
-
-    return services::Status();
+    return bfnn.kNeighbors(k, nClasses, voteWeights, resultsToCompute, resultsToEvaluate, trainDataTable.get(), data, trainLabelTable.get(), label,
+                           indices, distances, precision);
 }
 
 } // namespace internal
@@ -30,6 +30,7 @@
 #include "src/services/service_data_utils.h"
 #include "src/services/service_utils.h"
 #include "src/services/service_defines.h"
+#include "src/services/service_tuning.h"
 #include "src/threading/threading.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/service_kernel_math.h"
@@ -55,8 +56,14 @@ public:
     services::Status kNeighbors(const size_t k, const size_t nClasses, VoteWeights voteWeights, DAAL_UINT64 resultsToCompute,
                                 DAAL_UINT64 resultsToEvaluate, const NumericTable * trainTable, const NumericTable * testTable,
                                 const NumericTable * trainLabelTable, NumericTable * testLabelTable, NumericTable * indicesTable,
-                                NumericTable * distancesTable)
+                                NumericTable * distancesTable, DistancePrecision distancePrecision = fullPrecision)
     {
+        if (distancePrecision == reducedPrecision && sizeof(FPType) > sizeof(float) && 2 * k < trainTable->getNumberOfRows())
+        {
+            return kNeighborsReducedPrecision(k, nClasses, voteWeights, resultsToCompute, resultsToEvaluate, trainTable, testTable, trainLabelTable,
+                                              testLabelTable, indicesTable, distancesTable);
+        }
+
         const size_t nDims  = trainTable->getNumberOfColumns();
         const size_t nTrain = trainTable->getNumberOfRows();
         const size_t nTest  = testTable->getNumberOfRows();
@@ -75,7 +82,9 @@ public:
         daal::algorithms::internal::EuclideanDistances<FPType, cpu> euclDist(*testTable, *trainTable, true);
         euclDist.init();
 
-        const size_t outBlockSize = 128;
+        /* the number of the test rows in the block tuned on the CPU model replaces the default one, the tuning run measures the whole search */
+        services::internal::TunedBlockSize<FPType, cpu> tunedBlockSize("bf_knn::testBlock", 128, 16, 2048, nTest, nTrain, nDims);
+        const size_t outBlockSize = tunedBlockSize.get();
         const size_t inBlockSize  = 128;
         const size_t nOuterBlocks = nTest / outBlockSize + !!(nTest % outBlockSize);
 
@@ -106,6 +115,215 @@ public:
     }
 
 protected:
+    /* Converts the rows of the table to single precision and returns the largest squared norm of the rows */
+    services::Status convertToSinglePrecision(const NumericTable * src, NumericTable * dst, FPType & maxNormSq)
+    {
+        const size_t nDims     = src->getNumberOfColumns();
+        const size_t nRows     = src->getNumberOfRows();
+        const size_t blockSize = 512;
+        const size_t nBlocks   = nRows / blockSize + !!(nRows % blockSize);
+
+        TArray<FPType, cpu> blockMaxNormSq(nBlocks);
+        DAAL_CHECK_MALLOC(blockMaxNormSq.get());
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock * blockSize;
+            const size_t size  = iBlock + 1 == nBlocks ? nRows - start : blockSize;
+
+            ReadRows<FPType, cpu> srcRows(const_cast<NumericTable *>(src), start, size);
+            DAAL_CHECK_BLOCK_STATUS_THR(srcRows);
+            const FPType * const srcData = srcRows.get();
+
+            WriteOnlyRows<float, cpu> dstRows(dst, start, size);
+            DAAL_CHECK_BLOCK_STATUS_THR(dstRows);
+            float * const dstData = dstRows.get();
+
+            FPType localMax = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                FPType normSq = 0;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nDims; ++j)
+                {
+                    dstData[i * nDims + j] = static_cast<float>(srcData[i * nDims + j]);
+                    normSq += srcData[i * nDims + j] * srcData[i * nDims + j];
+                }
+                localMax = normSq > localMax ? normSq : localMax;
+            }
+            blockMaxNormSq[iBlock] = localMax;
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        maxNormSq = 0;
+        for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+        {
+            maxNormSq = blockMaxNormSq[iBlock] > maxNormSq ? blockMaxNormSq[iBlock] : maxNormSq;
+        }
+        return services::Status();
+    }
+
+    static FPType squaredDistance(const FPType * x, const FPType * y, const size_t nDims)
+    {
+        FPType sum = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nDims; ++j)
+        {
+            const FPType diff = x[j] - y[j];
+            sum += diff * diff;
+        }
+        return sum;
+    }
+
+    /* Chooses 2 * k < nTrain candidate neighbors by the distances in single precision and re-ranks them in the precision of the data.
+       The k-th exact distance is proven by the bound of the rounding error in the single precision distances,
+       the queries with the unproven neighbors are recomputed over the whole training set */
+    services::Status kNeighborsReducedPrecision(const size_t k, const size_t nClasses, VoteWeights voteWeights, DAAL_UINT64 resultsToCompute,
+                                                DAAL_UINT64 resultsToEvaluate, const NumericTable * trainTable, const NumericTable * testTable,
+                                                const NumericTable * trainLabelTable, NumericTable * testLabelTable, NumericTable * indicesTable,
+                                                NumericTable * distancesTable)
+    {
+        const size_t nDims       = trainTable->getNumberOfColumns();
+        const size_t nTrain      = trainTable->getNumberOfRows();
+        const size_t nTest       = testTable->getNumberOfRows();
+        const size_t nCandidates = 2 * k;
+
+        services::Status st;
+        NumericTablePtr trainSingle = HomogenNumericTableCPU<float, cpu>::create(nDims, nTrain, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        NumericTablePtr testSingle = HomogenNumericTableCPU<float, cpu>::create(nDims, nTest, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        NumericTablePtr candidateIndices = HomogenNumericTableCPU<int, cpu>::create(nCandidates, nTest, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        NumericTablePtr candidateDistances = HomogenNumericTableCPU<float, cpu>::create(nCandidates, nTest, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        FPType maxTrainNormSq = 0;
+        FPType maxTestNormSq  = 0;
+        DAAL_CHECK_STATUS(st, convertToSinglePrecision(trainTable, trainSingle.get(), maxTrainNormSq));
+        DAAL_CHECK_STATUS(st, convertToSinglePrecision(testTable, testSingle.get(), maxTestNormSq));
+
+        BruteForceNearestNeighbors<float, cpu> singlePrecision;
+        DAAL_CHECK_STATUS(st, singlePrecision.kNeighbors(nCandidates, nClasses, voteWeights, computeIndicesOfNeighbors | computeDistances, 0,
+                                                         trainSingle.get(), testSingle.get(), nullptr, nullptr, candidateIndices.get(),
+                                                         candidateDistances.get()));
+
+        ReadRows<FPType, cpu> trainRows(const_cast<NumericTable *>(trainTable), 0, nTrain);
+        DAAL_CHECK_BLOCK_STATUS(trainRows);
+        const FPType * const trainData = trainRows.get();
+
+        ReadRows<FPType, cpu> trainLabelRows;
+        const FPType * trainLabel = nullptr;
+        if (resultsToEvaluate & daal::algorithms::classifier::computeClassLabels)
+        {
+            trainLabelRows.set(const_cast<NumericTable *>(trainLabelTable), 0, nTrain);
+            DAAL_CHECK_BLOCK_STATUS(trainLabelRows);
+            trainLabel = trainLabelRows.get();
+        }
+
+        /* The bound of the rounding error in the single precision squared distance ||x||^2 + ||y||^2 - 2 * <x, y> */
+        const FPType errorFactor = FPType(nDims + 8) * services::internal::EpsilonVal<float>::get();
+
+        const size_t blockSize = 128;
+        const size_t nBlocks   = nTest / blockSize + !!(nTest % blockSize);
+
+        TlsMem<FPType, cpu> tlsKDistances(blockSize * k);
+        TlsMem<int, cpu> tlsKIndexes(blockSize * k);
+        TlsMem<FPType, cpu> tlsCandidateDistances(nCandidates);
+        TlsMem<int, cpu> tlsCandidateIndexes(nCandidates);
+        TlsMem<FPType, cpu> tlsVoting(nClasses);
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock * blockSize;
+            const size_t size  = iBlock + 1 == nBlocks ? nTest - start : blockSize;
+
+            ReadRows<FPType, cpu> testRows(const_cast<NumericTable *>(testTable), start, size);
+            DAAL_CHECK_BLOCK_STATUS_THR(testRows);
+            const FPType * const testData = testRows.get();
+
+            ReadRows<int, cpu> candidateIndicesRows(candidateIndices.get(), start, size);
+            DAAL_CHECK_BLOCK_STATUS_THR(candidateIndicesRows);
+            const int * const candidates = candidateIndicesRows.get();
+
+            ReadRows<float, cpu> candidateDistancesRows(candidateDistances.get(), start, size);
+            DAAL_CHECK_BLOCK_STATUS_THR(candidateDistancesRows);
+            const float * const singleDistances = candidateDistancesRows.get();
+
+            FPType * kDistances     = tlsKDistances.local();
+            int * kIndexes          = tlsKIndexes.local();
+            FPType * exactDistances = tlsCandidateDistances.local();
+            int * exactIndexes      = tlsCandidateIndexes.local();
+            DAAL_CHECK_MALLOC_THR(kDistances && kIndexes && exactDistances && exactIndexes);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                const FPType * const x = testData + i * nDims;
+
+                FPType normSq = 0;
+                for (size_t j = 0; j < nDims; ++j)
+                {
+                    normSq += x[j] * x[j];
+                }
+
+                FPType maxSingleDistance = 0;
+                for (size_t c = 0; c < nCandidates; ++c)
+                {
+                    const int j       = candidates[i * nCandidates + c];
+                    exactIndexes[c]   = j;
+                    exactDistances[c] = squaredDistance(x, trainData + j * nDims, nDims);
+
+                    const FPType d    = singleDistances[i * nCandidates + c];
+                    maxSingleDistance = d > maxSingleDistance ? d : maxSingleDistance;
+                }
+                daal::algorithms::internal::qSort<FPType, int, cpu>(nCandidates, exactDistances, exactIndexes);
+
+                FPType * const rowDistances = kDistances + i * k;
+                int * const rowIndexes      = kIndexes + i * k;
+                for (size_t kk = 0; kk < k; ++kk)
+                {
+                    rowDistances[kk] = exactDistances[kk];
+                    rowIndexes[kk]   = exactIndexes[kk];
+                }
+
+                /* Every training row out of the candidates is not closer than the farthest candidate up to the rounding error */
+                const FPType bound = errorFactor * (normSq + maxTrainNormSq);
+                if (!(maxSingleDistance * maxSingleDistance - bound >= rowDistances[k - 1]))
+                {
+                    for (size_t kk = 0; kk < k; ++kk)
+                    {
+                        rowDistances[kk] = MaxVal<FPType>::get();
+                    }
+                    for (size_t j = 0; j < nTrain; ++j)
+                    {
+                        const FPType d = squaredDistance(x, trainData + j * nDims, nDims);
+
+                        size_t maxIdx = 0;
+                        for (size_t kk = 1; kk < k; ++kk)
+                        {
+                            maxIdx = rowDistances[kk] > rowDistances[maxIdx] ? kk : maxIdx;
+                        }
+                        if (d < rowDistances[maxIdx])
+                        {
+                            rowDistances[maxIdx] = d;
+                            rowIndexes[maxIdx]   = static_cast<int>(j);
+                        }
+                    }
+                    daal::algorithms::internal::qSort<FPType, int, cpu>(k, rowDistances, rowIndexes);
+                }
+            }
+
+            Math<FPType, cpu>::vSqrt(size * k, kDistances, kDistances);
+
+            DAAL_CHECK_STATUS_THR(writeBlockResults(size, start, nTrain, resultsToEvaluate, resultsToCompute, nClasses, k, voteWeights, trainLabel,
+                                                    kIndexes, kDistances, testLabelTable, indicesTable, distancesTable, tlsVoting));
+        });
+
+        return safeStat.detach();
+    }
+
     struct BruteForceTask
     {
     public:
@@ -246,6 +464,15 @@ protected:
             daal::algorithms::internal::qSort<FPType, int, cpu>(k, kDistances + i * k, kIndexes + i * k);
         }
 
+        return writeBlockResults(blockSize, startTestIdx, nTrain, resultsToEvaluate, resultsToCompute, nClasses, k, voteWeights, trainLabel, kIndexes,
+                                 kDistances, testLabelTable, indicesTable, distancesTable, tlsVoting);
+    }
+
+    services::Status writeBlockResults(const size_t blockSize, const size_t startTestIdx, const size_t nTrain, DAAL_UINT64 resultsToEvaluate,
+                                       DAAL_UINT64 resultsToCompute, const size_t nClasses, const size_t k, VoteWeights voteWeights,
+                                       const FPType * trainLabel, int * kIndexes, FPType * kDistances, NumericTable * testLabelTable,
+                                       NumericTable * indicesTable, NumericTable * distancesTable, TlsMem<FPType, cpu> & tlsVoting)
+    {
         if (resultsToCompute & computeIndicesOfNeighbors)
         {
             daal::internal::WriteOnlyRows<int, cpu> indexesBlock(indicesTable, startTestIdx, blockSize);
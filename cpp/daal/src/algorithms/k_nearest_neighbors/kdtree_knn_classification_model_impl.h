@@ -26,6 +26,7 @@
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h"
 #include "src/services/service_data_utils.h"
+#include "src/services/service_defines.h"
 
 namespace daal
 {
@@ -122,7 +123,7 @@ public:
     data_management::NumericTablePtr getData() { return _data; }
 
     template <typename Archive, bool onDeserialize>
-    services::Status serialImpl(Archive * arch)
+    services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
         arch->set(_nFeatures);
         arch->set(_rootNodeIndex);
@@ -131,6 +132,13 @@ public:
         arch->setSharedPtrObj(_data);
         arch->setSharedPtrObj(_labels);
 
+        // The original indices of the rearranged training data make the restored model ready for the
+        // search of the neighbors without the rebuild of the tree
+        if (daalVersion >= COMPUTE_DAAL_VERSION(2021, 2, 0))
+        {
+            arch->setSharedPtrObj(_indices);
+        }
+
         return services::Status();
     }
 
@@ -189,6 +189,17 @@ public:
 
     size_t size() const { return _count; }
 
+    // Orders the elements by increasing distance, the heap should be reset
+    // before it is used for the search again
+    void sort()
+    {
+        makeMaxHeap<cpu>(_elements, _elements + _count);
+        for (size_t i = _count; i > 1; --i)
+        {
+            popMaxHeap<cpu>(_elements, _elements + i);
+        }
+    }
+
     T * getMax() { return _elements; }
 
     const T & operator[](size_t index) const { return *(_elements + index); }
@@ -416,6 +427,10 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
                 {
                     findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
                                          isHomogenSOA, soa_arrays);
+                    if (indices || distances)
+                    {
+                        local->heap.sort();
+                    }
                     s = predict(&(dy[i * yColumnCount]), local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
                     DAAL_CHECK_STATUS_THR(s)
                 }
@@ -429,6 +444,10 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
                 {
                     findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
                                          isHomogenSOA, soa_arrays);
+                    if (indices || distances)
+                    {
+                        local->heap.sort();
+                    }
                     s = predict(nullptr, local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
                     DAAL_CHECK_STATUS_THR(s)
                 }
@@ -951,8 +951,10 @@ Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
     KDTreeTablePtr kdTreeTablePtr = r.impl()->getKDTreeTable();
     KDTreeTable & kdTreeTable     = *kdTreeTablePtr;
 
-    const auto rowsPerBlock = (posQ + maxThreads - 1) / maxThreads;
-    const auto blockCount   = (posQ + rowsPerBlock - 1) / rowsPerBlock;
+    // Every subtree is a block of its own: the subtrees differ in size, so the dynamic scheduling of
+    // the single subtrees keeps the threads busy, while the static chunks of subtrees per thread do not.
+    const size_t rowsPerBlock = 1;
+    const size_t blockCount   = posQ;
 
     const size_t lastNodeIndex  = r.impl()->getLastNodeIndex();
     const size_t maxNodeCount   = kdTreeTable.getNumberOfRows();
@@ -1503,235 +1505,9 @@ void KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense,
                                                                                                 size_t valueCount,
                                                                                                 IndexValuePair<algorithmFpType, cpu> * outValues)
 {
-#if (__FPTYPE__(DAAL_FPTYPE) == __float__)
     typedef IndexValuePair<algorithmFpType, cpu> Item;
-    typedef unsigned int IntegerType;
-    const size_t histogramSize = 256;
-    int histogram[histogramSize], histogramPS[histogramSize + 1];
-    Item * first       = inValues;
-    Item * second      = outValues;
-    size_t valueCount4 = valueCount / 4 * 4;
-    for (unsigned int pass = 0; pass < 3; ++pass)
-    {
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            histogram[i] = 0;
-        }
-        for (size_t i = 0; i < valueCount4; i += 4)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            IntegerType val2 = *reinterpret_cast<IntegerType *>(&first[i + 1].value);
-            IntegerType val3 = *reinterpret_cast<IntegerType *>(&first[i + 2].value);
-            IntegerType val4 = *reinterpret_cast<IntegerType *>(&first[i + 3].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-            ++histogram[(val2 >> (pass * 8)) & 0xFF];
-            ++histogram[(val3 >> (pass * 8)) & 0xFF];
-            ++histogram[(val4 >> (pass * 8)) & 0xFF];
-        }
-        for (size_t i = valueCount4; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-        }
-
-        int sum = 0, prevSum = 0;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            sum += histogram[i];
-            histogramPS[i] = prevSum;
-            prevSum        = sum;
-        }
-        histogramPS[histogramSize] = prevSum;
-
-        for (size_t i = 0; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            const int pos    = histogramPS[(val1 >> (pass * 8)) & 0xFF]++;
-            second[pos]      = first[i];
-        }
-
-        Item * temp = first;
-        first       = second;
-        second      = temp;
-    }
-    {
-        unsigned int pass = 3;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            histogram[i] = 0;
-        }
-        for (size_t i = 0; i < valueCount4; i += 4)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            IntegerType val2 = *reinterpret_cast<IntegerType *>(&first[i + 1].value);
-            IntegerType val3 = *reinterpret_cast<IntegerType *>(&first[i + 2].value);
-            IntegerType val4 = *reinterpret_cast<IntegerType *>(&first[i + 3].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-            ++histogram[(val2 >> (pass * 8)) & 0xFF];
-            ++histogram[(val3 >> (pass * 8)) & 0xFF];
-            ++histogram[(val4 >> (pass * 8)) & 0xFF];
-        }
-        for (size_t i = valueCount4; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-        }
-
-        int sum = 0, prevSum = 0;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            sum += histogram[i];
-            histogramPS[i] = prevSum;
-            prevSum        = sum;
-        }
-        histogramPS[histogramSize] = prevSum;
-
-        // Handle negative values.
-        const size_t indexOfNegatives = histogramSize / 2;
-        int countOfNegatives          = histogramPS[histogramSize] - histogramPS[indexOfNegatives];
-        // Fixes offsets for positive values.
-        for (size_t i = 0; i < indexOfNegatives - 1; ++i)
-        {
-            histogramPS[i] += countOfNegatives;
-        }
-        // Fixes offsets for negative values.
-        histogramPS[histogramSize - 1] = histogram[histogramSize - 1];
-        for (size_t i = 0; i < indexOfNegatives - 1; ++i)
-        {
-            histogramPS[histogramSize - 2 - i] = histogramPS[histogramSize - 1 - i] + histogram[histogramSize - 2 - i];
-        }
-
-        for (size_t i = 0; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            const int bin    = (val1 >> (pass * 8)) & 0xFF;
-            int pos;
-            if (bin >= indexOfNegatives)
-            {
-                pos = --histogramPS[bin];
-            }
-            else
-            {
-                pos = histogramPS[bin]++;
-            }
-            second[pos] = first[i];
-        }
-    }
-#else  // #if (__FPTYPE__(DAAL_FPTYPE) == __float__)
-    typedef IndexValuePair<algorithmFpType, cpu> Item;
-    typedef DAAL_UINT64 IntegerType;
-    const size_t histogramSize = 256;
-    int histogram[histogramSize], histogramPS[histogramSize + 1];
-    Item * first       = inValues;
-    Item * second      = outValues;
-    size_t valueCount4 = valueCount / 4 * 4;
-    for (unsigned int pass = 0; pass < 7; ++pass)
-    {
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            histogram[i] = 0;
-        }
-        for (size_t i = 0; i < valueCount4; i += 4)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            IntegerType val2 = *reinterpret_cast<IntegerType *>(&first[i + 1].value);
-            IntegerType val3 = *reinterpret_cast<IntegerType *>(&first[i + 2].value);
-            IntegerType val4 = *reinterpret_cast<IntegerType *>(&first[i + 3].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-            ++histogram[(val2 >> (pass * 8)) & 0xFF];
-            ++histogram[(val3 >> (pass * 8)) & 0xFF];
-            ++histogram[(val4 >> (pass * 8)) & 0xFF];
-        }
-        for (size_t i = valueCount4; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-        }
-
-        int sum = 0, prevSum = 0;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            sum += histogram[i];
-            histogramPS[i] = prevSum;
-            prevSum        = sum;
-        }
-        histogramPS[histogramSize] = prevSum;
-
-        for (size_t i = 0; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            const int pos    = histogramPS[(val1 >> (pass * 8)) & 0xFF]++;
-            second[pos]      = first[i];
-        }
-
-        Item * temp = first;
-        first       = second;
-        second      = temp;
-    }
-    {
-        unsigned int pass = 7;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            histogram[i] = 0;
-        }
-        for (size_t i = 0; i < valueCount4; i += 4)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            IntegerType val2 = *reinterpret_cast<IntegerType *>(&first[i + 1].value);
-            IntegerType val3 = *reinterpret_cast<IntegerType *>(&first[i + 2].value);
-            IntegerType val4 = *reinterpret_cast<IntegerType *>(&first[i + 3].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-            ++histogram[(val2 >> (pass * 8)) & 0xFF];
-            ++histogram[(val3 >> (pass * 8)) & 0xFF];
-            ++histogram[(val4 >> (pass * 8)) & 0xFF];
-        }
-        for (size_t i = valueCount4; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-        }
-
-        int sum = 0, prevSum = 0;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            sum += histogram[i];
-            histogramPS[i] = prevSum;
-            prevSum        = sum;
-        }
-        histogramPS[histogramSize] = prevSum;
-
-        // Handle negative values.
-        const size_t indexOfNegatives = histogramSize / 2;
-        int countOfNegatives          = histogramPS[histogramSize] - histogramPS[indexOfNegatives];
-        // Fixes offsets for positive values.
-        for (size_t i = 0; i < indexOfNegatives - 1; ++i)
-        {
-            histogramPS[i] += countOfNegatives;
-        }
-        // Fixes offsets for negative values.
-        histogramPS[histogramSize - 1] = histogram[histogramSize - 1];
-        for (size_t i = 0; i < indexOfNegatives - 1; ++i)
-        {
-            histogramPS[histogramSize - 2 - i] = histogramPS[histogramSize - 1 - i] + histogram[histogramSize - 2 - i];
-        }
-
-        for (size_t i = 0; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            const int bin    = (val1 >> (pass * 8)) & 0xFF;
-            int pos;
-            if (bin >= indexOfNegatives)
-            {
-                pos = --histogramPS[bin];
-            }
-            else
-            {
-                pos = histogramPS[bin]++;
-            }
-            second[pos] = first[i];
-        }
-    }
-#endif // #if (__FPTYPE__(DAAL_FPTYPE) == __float__)
+    daal::algorithms::internal::radixSort<algorithmFpType, cpu>(inValues, outValues, valueCount,
+                                                                [](const Item & item) -> algorithmFpType { return item.value; });
 }
 
 } // namespace internal
@@ -38,7 +38,7 @@ namespace internal
 {
 #define __KDTREE_MAX_NODE_COUNT_MULTIPLICATION_FACTOR 3
 #define __KDTREE_LEAF_BUCKET_SIZE                     31 // Must be ((power of 2) minus 1).
-#define __KDTREE_FIRST_PART_LEAF_NODES_PER_THREAD     3
+#define __KDTREE_FIRST_PART_LEAF_NODES_PER_THREAD     8
 #define __KDTREE_DIMENSION_SELECTION_SIZE             128
 #define __KDTREE_MEDIAN_RANDOM_SAMPLE_COUNT           1024
 #define __KDTREE_DEPTH_MULTIPLICATION_FACTOR          4
@@ -42,7 +42,20 @@ class KNNClassificationPredictKernelUCAPI : public daal::algorithms::Kernel
 public:
     services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
 
+    // Writes the indices of the neighbors in the training data and the distances to them instead
+    // of the labels if y is null, a null table of the indices or the distances is not computed
+    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices,
+                             NumericTable * distances, const daal::algorithms::Parameter * par);
+
 private:
+    services::Status initRowIndices(services::internal::sycl::UniversalBuffer & rowIndices, uint32_t startIndex, uint32_t count);
+
+    services::Status finalizeSearch(services::internal::sycl::ExecutionContextIface & context,
+                                    const services::internal::sycl::UniversalBuffer & selectedDistances,
+                                    const services::internal::sycl::UniversalBuffer & selectedIndices,
+                                    const services::internal::sycl::UniversalBuffer & querySumOfSquares, uint32_t queryBlockRowCount, uint32_t k,
+                                    services::internal::sycl::UniversalBuffer distancesOut, services::internal::sycl::UniversalBuffer indicesOut);
+
     services::Status copyPartialDistancesAndLabels(services::internal::sycl::ExecutionContextIface & context,
                                                    const services::internal::sycl::UniversalBuffer & distances,
                                                    const services::internal::sycl::UniversalBuffer & labels,
@@ -72,6 +72,14 @@ private:
 template <typename algorithmFpType>
 Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const NumericTable * x, const classifier::Model * m, NumericTable * y,
                                                                      const daal::algorithms::Parameter * par)
+{
+    return compute(x, m, y, nullptr, nullptr, par);
+}
+
+template <typename algorithmFpType>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const NumericTable * x, const classifier::Model * m, NumericTable * y,
+                                                                     NumericTable * indices, NumericTable * distancesOut,
+                                                                     const daal::algorithms::Parameter * par)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(compute);
 
@@ -88,8 +96,12 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const Numer
     const Parameter * const parameter = static_cast<const Parameter *>(par);
     const uint32_t k                  = parameter->k;
 
+    // The neighbors carry their indices in the training data instead of the labels through the selection
+    const bool searchOnly = (y == nullptr);
+    DAAL_CHECK(searchOnly || labels, ErrorNullInputNumericTable);
+
     const size_t nQueryRows  = ntData->getNumberOfRows();
-    const size_t nLabelRows  = labels->getNumberOfRows();
+    const size_t nLabelRows  = searchOnly ? points->getNumberOfRows() : labels->getNumberOfRows();
     const size_t nDataRows   = points->getNumberOfRows() < nLabelRows ? points->getNumberOfRows() : nLabelRows;
     const uint32_t nFeatures = points->getNumberOfColumns();
 
@@ -122,6 +134,20 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const Numer
     auto radixBuffer = context.allocate(TypeIds::id<int>(), maxQueryBlockRowCount * histogramSize, &st);
     DAAL_CHECK_STATUS_VAR(st);
 
+    UniversalBuffer rowIndices;
+    UniversalBuffer searchDistances;
+    UniversalBuffer searchIndices;
+    if (searchOnly)
+    {
+        rowIndices = context.allocate(TypeIds::id<int>(), maxDataBlockRowCount, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        // The neighbors are written to the scratch buffers if their tables are not requested
+        searchDistances = context.allocate(TypeIds::id<algorithmFpType>(), distancesOut ? 1 : maxQueryBlockRowCount * k, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        searchIndices = context.allocate(TypeIds::id<int>(), indices ? 1 : maxQueryBlockRowCount * k, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
     const uint32_t nDataBlockCount      = nDataRows / maxDataBlockRowCount + uint32_t(nDataRows % maxDataBlockRowCount != 0);
     const uint32_t nQueryBlockCount     = nQueryRows / maxQueryBlockRowCount + uint32_t(nQueryRows % maxQueryBlockRowCount != 0);
     const uint32_t nSelectionBlockCount = nDataBlockCount / selectionMaxNumberOfChunks + uint32_t(nDataBlockCount % selectionMaxNumberOfChunks != 0);
@@ -148,7 +174,14 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const Numer
             {
                 Range curDataRange = Range::createFromBlock(dblock, maxDataBlockRowCount, nDataRows);
                 BlockDescriptor<int> labelRows;
-                DAAL_CHECK_STATUS_VAR(labels->getBlockOfRows(curDataRange.startIndex, curDataRange.count, readOnly, labelRows));
+                if (searchOnly)
+                {
+                    DAAL_CHECK_STATUS_VAR(initRowIndices(rowIndices, curDataRange.startIndex, curDataRange.count));
+                }
+                else
+                {
+                    DAAL_CHECK_STATUS_VAR(labels->getBlockOfRows(curDataRange.startIndex, curDataRange.count, readOnly, labelRows));
+                }
                 BlockDescriptor<algorithmFpType> dataRows;
                 DAAL_CHECK_STATUS_VAR(points->getBlockOfRows(curDataRange.startIndex, curDataRange.count, readOnly, dataRows));
                 // Collect sums of squares from train data
@@ -160,15 +193,19 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const Numer
                 DAAL_CHECK_STATUS_VAR(
                     computeDistances(context, dataRows.getBuffer(), curQuery, distances, curDataRange.count, curQueryRange.count, nFeatures));
                 // Select k smallest distances and their labels from every row of the [curQueryRange.count]x[curDataRange.count] block
-                selector->selectNearestDistancesAndLabels(distances, labelRows.getBuffer(), k, curQueryRange.count, curDataRange.count,
-                                                          curDataRange.count, 0, selectResult, &st);
+                const UniversalBuffer payload = searchOnly ? rowIndices : UniversalBuffer(labelRows.getBuffer());
+                selector->selectNearestDistancesAndLabels(distances, payload, k, curQueryRange.count, curDataRange.count, curDataRange.count, 0,
+                                                          selectResult, &st);
                 DAAL_CHECK_STATUS_VAR(st);
                 // copy block results to buffer in order to get merged with the same selection algorithm (up to selectionMaxNumberOfChunks of partial results)
                 // and keep the first part containing previously merged result if exists
                 DAAL_CHECK_STATUS_VAR(copyPartialDistancesAndLabels(context, selectResult.values, selectResult.indices, partialDistances,
                                                                     partialLabels, curQueryRange.count, k, selectionChunkCount,
                                                                     selectionMaxNumberOfChunks));
-                DAAL_CHECK_STATUS_VAR(labels->releaseBlockOfRows(labelRows));
+                if (!searchOnly)
+                {
+                    DAAL_CHECK_STATUS_VAR(labels->releaseBlockOfRows(labelRows));
+                }
                 DAAL_CHECK_STATUS_VAR(points->releaseBlockOfRows(dataRows));
                 selectionChunkCount++;
             }
@@ -177,6 +214,36 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const Numer
                                                       k * selectionMaxNumberOfChunks, k * selectionMaxNumberOfChunks, selectResult, &st);
         }
         DAAL_CHECK_STATUS_VAR(st);
+        if (searchOnly)
+        {
+            // The selected distances lack the squared norm of the query
+            auto querySumResult = math::SumReducer::sum(math::Layout::RowMajor, curQuery, curQueryRange.count, nFeatures, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            BlockDescriptor<int> indicesBlock;
+            BlockDescriptor<algorithmFpType> distancesBlock;
+            if (indices)
+            {
+                DAAL_CHECK_STATUS_VAR(indices->getBlockOfRows(curQueryRange.startIndex, curQueryRange.count, writeOnly, indicesBlock));
+            }
+            if (distancesOut)
+            {
+                DAAL_CHECK_STATUS_VAR(distancesOut->getBlockOfRows(curQueryRange.startIndex, curQueryRange.count, writeOnly, distancesBlock));
+            }
+            DAAL_CHECK_STATUS_VAR(finalizeSearch(context, selectResult.values, selectResult.indices, querySumResult.sumOfSquares,
+                                                 curQueryRange.count, k,
+                                                 distancesOut ? UniversalBuffer(distancesBlock.getBuffer()) : searchDistances,
+                                                 indices ? UniversalBuffer(indicesBlock.getBuffer()) : searchIndices));
+            if (indices)
+            {
+                DAAL_CHECK_STATUS_VAR(indices->releaseBlockOfRows(indicesBlock));
+            }
+            if (distancesOut)
+            {
+                DAAL_CHECK_STATUS_VAR(distancesOut->releaseBlockOfRows(distancesBlock));
+            }
+            DAAL_CHECK_STATUS_VAR(ntData->releaseBlockOfRows(queryRows));
+            continue;
+        }
         // sort labels of closest neighbors
         RadixSort::sort(selectResult.indices, sortedLabels, radixBuffer, curQueryRange.count, k, k, &st);
         DAAL_CHECK_STATUS_VAR(st);
@@ -189,6 +256,54 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const Numer
     }
     return st;
 }
+template <typename algorithmFpType>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::initRowIndices(UniversalBuffer & rowIndices, uint32_t startIndex, uint32_t count)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.initRowIndices);
+    // The selection maps the indices to the labels on the host, so the indices are filled there as well
+    Status st;
+    auto rowIndicesHost = rowIndices.template get<int>().toHost(ReadWriteMode::writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    int * const rowIndicesPtr = rowIndicesHost.get();
+    DAAL_CHECK_MALLOC(rowIndicesPtr);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        rowIndicesPtr[i] = static_cast<int>(startIndex + i);
+    }
+    return st;
+}
+
+template <typename algorithmFpType>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::finalizeSearch(ExecutionContextIface & context,
+                                                                            const UniversalBuffer & selectedDistances,
+                                                                            const UniversalBuffer & selectedIndices,
+                                                                            const UniversalBuffer & querySumOfSquares, uint32_t queryBlockRowCount,
+                                                                            uint32_t k, UniversalBuffer distancesOut, UniversalBuffer indicesOut)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.finalizeSearch);
+    if (k > static_cast<uint32_t>(INT_MAX))
+    {
+        return services::Status(services::ErrorBufferSizeIntegerOverflow);
+    }
+    Status st;
+    auto & kernel_factory = context.getClKernelFactory();
+    DAAL_CHECK_STATUS_VAR(buildProgram(kernel_factory));
+    auto kernel_finalize_search = kernel_factory.getKernel("finalize_search", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    KernelArguments args(6);
+    args.set(0, selectedDistances, AccessModeIds::read);
+    args.set(1, selectedIndices, AccessModeIds::read);
+    args.set(2, querySumOfSquares, AccessModeIds::read);
+    args.set(3, distancesOut, AccessModeIds::readwrite);
+    args.set(4, indicesOut, AccessModeIds::readwrite);
+    args.set(5, k);
+
+    KernelRange global_range(queryBlockRowCount);
+    context.run(global_range, kernel_finalize_search, args, &st);
+    return st;
+}
+
 template <typename algorithmFpType>
 Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::copyPartialDistancesAndLabels(
     ExecutionContextIface & context, const UniversalBuffer & distances, const UniversalBuffer & labels, UniversalBuffer & partialDistances,
@@ -77,6 +77,37 @@ DECLARE_SOURCE(
         result[global_id_0] = maxVal;
     }
 
+    // Adds the squared norm of the query to the partial distances of its
+    // neighbors and writes the neighbors in the order of the distances
+    __kernel void finalize_search(__global const algorithmFPType * selectedDistances, __global const int * selectedIndices,
+                                  __global const algorithmFPType * querySq, __global algorithmFPType * distances, __global int * indices, int K) {
+        const int global_id_0 = get_global_id(0);
+
+        __global const algorithmFPType * inDistances = &selectedDistances[global_id_0 * K];
+        __global const int * inIndices               = &selectedIndices[global_id_0 * K];
+        __global algorithmFPType * outDistances      = &distances[global_id_0 * K];
+        __global int * outIndices                    = &indices[global_id_0 * K];
+
+        for (int i = 0; i < K; i++)
+        {
+            const algorithmFPType dist = fmax(inDistances[i] + querySq[global_id_0], (algorithmFPType)0.0);
+            const int index            = inIndices[i];
+            int j                      = i;
+            while (j > 0 && outDistances[j - 1] > dist)
+            {
+                outDistances[j] = outDistances[j - 1];
+                outIndices[j]   = outIndices[j - 1];
+                j--;
+            }
+            outDistances[j] = dist;
+            outIndices[j]   = index;
+        }
+        for (int i = 0; i < K; i++)
+        {
+            outDistances[i] = sqrt(outDistances[i]);
+        }
+    }
+
 );
 
 #endif
@@ -0,0 +1,314 @@
+/* file: kdtree_knn_cl_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of KD-tree KNN OpenCL kernels.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CL_KERNELS_CL__
+#define __KDTREE_KNN_CL_KERNELS_CL__
+
+#include <string.h>
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    kdtree_knn_cl_kernels,
+
+    // Returns the index of the segment which contains the position, the
+    // segment s occupies [offsets[s], offsets[s + 1])
+    int __find_segment(__global const int * offsets, int nSegments, int position) {
+        int lo = 0;
+        int hi = nSegments;
+        while (hi - lo > 1)
+        {
+            const int mid = (lo + hi) / 2;
+            if (offsets[mid] <= position)
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    __kernel void init_permutation(__global int * perm, int N) {
+        const int id = get_global_id(0);
+        if (id < N)
+        {
+            perm[id] = id;
+        }
+    }
+
+    // Chooses the dimension of the largest extent of every segment, a work-group
+    // per segment
+    __kernel void compute_split_dims(__global const algorithmFPType * data, __global const int * perm, __global const int * offsets,
+                                     __global int * splitDims, int P, int firstNode) {
+        const int segment    = get_group_id(0);
+        const int local_id   = get_local_id(0);
+        const int local_size = get_local_size(0);
+        const int start      = offsets[segment];
+        const int end        = offsets[segment + 1];
+
+        __local algorithmFPType local_min[LOCAL_SIZE];
+        __local algorithmFPType local_max[LOCAL_SIZE];
+
+        int bestDim                = 0;
+        algorithmFPType bestExtent = -1.0;
+        for (int j = 0; j < P; j++)
+        {
+            algorithmFPType minVal = data[perm[start] * P + j];
+            algorithmFPType maxVal = minVal;
+            for (int i = start + local_id; i < end; i += local_size)
+            {
+                const algorithmFPType value = data[perm[i] * P + j];
+                minVal                      = fmin(minVal, value);
+                maxVal                      = fmax(maxVal, value);
+            }
+            local_min[local_id] = minVal;
+            local_max[local_id] = maxVal;
+            for (int stride = local_size / 2; stride > 0; stride /= 2)
+            {
+                barrier(CLK_LOCAL_MEM_FENCE);
+                if (local_id < stride)
+                {
+                    local_min[local_id] = fmin(local_min[local_id], local_min[local_id + stride]);
+                    local_max[local_id] = fmax(local_max[local_id], local_max[local_id + stride]);
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+            const algorithmFPType extent = local_max[0] - local_min[0];
+            if (extent > bestExtent)
+            {
+                bestExtent = extent;
+                bestDim    = j;
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+        if (local_id == 0)
+        {
+            splitDims[firstNode + segment] = bestDim;
+        }
+    }
+
+    // Writes the values of the rows on the split dimensions of their segments
+    // and the positions of the rows. The values are written as they are, the
+    // radix sort maps the floating-point bits to the ordered ones itself
+    __kernel void gather_split_keys(__global const algorithmFPType * data, __global const int * perm, __global const int * offsets,
+                                    __global const int * splitDims, __global algorithmFPType * keys, __global int * positions, int N, int P,
+                                    int nSegments, int firstNode) {
+        const int id = get_global_id(0);
+        if (id < N)
+        {
+            const int dim = splitDims[firstNode + __find_segment(offsets, nSegments, id)];
+            keys[id]      = data[perm[id] * P + dim];
+            positions[id] = id;
+        }
+    }
+
+    // Replaces the keys with the segments of the positions, so the stable sort
+    // groups the rows sorted by the split values back into their segments. The
+    // segment numbers have the sign bit clear, so the floating-point order of
+    // the radix sort keeps their order
+    __kernel void gather_segment_keys(__global const int * offsets, __global const int * positions, __global radixUIntType * keys, int N,
+                                      int nSegments) {
+        const int id = get_global_id(0);
+        if (id < N)
+        {
+            keys[id] = (radixUIntType)__find_segment(offsets, nSegments, positions[id]);
+        }
+    }
+
+    __kernel void permute_indices(__global const int * perm, __global const int * positions, __global int * permOut, int N) {
+        const int id = get_global_id(0);
+        if (id < N)
+        {
+            permOut[id] = perm[positions[id]];
+        }
+    }
+
+    // Takes the median of every sorted segment as the cut point, the left
+    // child gets the rows before the median
+    __kernel void set_cut_points(__global const algorithmFPType * data, __global const int * perm, __global const int * offsets,
+                                 __global const int * splitDims, __global algorithmFPType * cutPoints, int P, int nSegments, int firstNode) {
+        const int segment = get_global_id(0);
+        if (segment < nSegments)
+        {
+            const int start  = offsets[segment];
+            const int middle = start + (offsets[segment + 1] - start) / 2;
+            const int node   = firstNode + segment;
+            cutPoints[node]  = data[perm[middle] * P + splitDims[node]];
+        }
+    }
+
+    __kernel void gather_rows(__global const algorithmFPType * data, __global const int * perm, __global algorithmFPType * out, int N, int P) {
+        const int id = get_global_id(0);
+        if (id < N)
+        {
+            const int row = perm[id];
+            for (int j = 0; j < P; j++)
+            {
+                out[id * P + j] = data[row * P + j];
+            }
+        }
+    }
+
+    // Searches the k nearest neighbors of every query with the stackless
+    // traversal of the tree: the work-item returns to the parent of the node
+    // and decides on the far child by the node it came from. The leaves have
+    // the negative split dimension and keep the range of rows in left and right.
+    __kernel void search_kd_tree(__global const algorithmFPType * data, __global const algorithmFPType * queries, __global const int * nodeDims,
+                                 __global const algorithmFPType * nodeCuts, __global const int * nodeLeft, __global const int * nodeRight,
+                                 __global const int * nodeParent, __global algorithmFPType * kDistances, __global int * kIndices, int root, int N,
+                                 int P, int K, algorithmFPType maxDistance) {
+        const int id = get_global_id(0);
+        if (id >= N) return;
+
+        __global const algorithmFPType * query = queries + id * P;
+        __global algorithmFPType * distances   = kDistances + id * K;
+        __global int * indices                 = kIndices + id * K;
+
+        for (int i = 0; i < K; i++)
+        {
+            distances[i] = maxDistance;
+            indices[i]   = 0;
+        }
+        algorithmFPType worst = maxDistance;
+        int worstPos          = 0;
+
+        int prev = -1;
+        int node = root;
+        while (node >= 0)
+        {
+            const int parent = nodeParent[node];
+            const int dim    = nodeDims[node];
+            int next         = parent;
+            if (dim < 0)
+            {
+                for (int i = nodeLeft[node]; i < nodeRight[node]; i++)
+                {
+                    algorithmFPType dist = 0.0;
+                    for (int j = 0; j < P; j++)
+                    {
+                        const algorithmFPType diff = query[j] - data[i * P + j];
+                        dist += diff * diff;
+                    }
+                    if (dist < worst)
+                    {
+                        distances[worstPos] = dist;
+                        indices[worstPos]   = i;
+                        worst               = distances[0];
+                        worstPos            = 0;
+                        for (int kk = 1; kk < K; kk++)
+                        {
+                            if (distances[kk] > worst)
+                            {
+                                worst    = distances[kk];
+                                worstPos = kk;
+                            }
+                        }
+                    }
+                }
+            }
+            else
+            {
+                const algorithmFPType diff = query[dim] - nodeCuts[node];
+                const int nearChild        = (diff < 0) ? nodeLeft[node] : nodeRight[node];
+                const int farChild         = (diff < 0) ? nodeRight[node] : nodeLeft[node];
+                if (prev == parent)
+                {
+                    next = nearChild;
+                }
+                else if (prev == nearChild && diff * diff < worst)
+                {
+                    next = farChild;
+                }
+            }
+            prev = node;
+            node = next;
+        }
+    }
+
+    // Chooses the most frequent label of the neighbors, the smallest one on ties
+    __kernel void vote(__global const algorithmFPType * labels, __global const int * kIndices, __global algorithmFPType * result, int N, int K) {
+        const int id = get_global_id(0);
+        if (id >= N) return;
+
+        __global const int * indices = kIndices + id * K;
+
+        algorithmFPType bestLabel = labels[indices[0]];
+        int bestCount             = 0;
+        for (int i = 0; i < K; i++)
+        {
+            const algorithmFPType label = labels[indices[i]];
+            int count                   = 0;
+            for (int j = 0; j < K; j++)
+            {
+                count += (labels[indices[j]] == label) ? 1 : 0;
+            }
+            if (count > bestCount || (count == bestCount && label < bestLabel))
+            {
+                bestCount = count;
+                bestLabel = label;
+            }
+        }
+        result[id] = bestLabel;
+    }
+
+    // Writes the neighbors of every query in the increasing order of the
+    // distances with their indices in the training data, the missing neighbors
+    // of the queries get the negative index and distance
+    __kernel void write_neighbors(__global const algorithmFPType * kDistances, __global const int * kIndices, __global const int * modelIndices,
+                                  __global algorithmFPType * distances, __global int * indices, int N, int K, algorithmFPType maxDistance) {
+        const int id = get_global_id(0);
+        if (id >= N) return;
+
+        __global const algorithmFPType * inDistances = kDistances + id * K;
+        __global const int * inIndices               = kIndices + id * K;
+        __global algorithmFPType * outDistances      = distances + id * K;
+        __global int * outIndices                    = indices + id * K;
+
+        for (int i = 0; i < K; i++)
+        {
+            const algorithmFPType dist = inDistances[i];
+            const int index            = inIndices[i];
+            int j                      = i;
+            while (j > 0 && outDistances[j - 1] > dist)
+            {
+                outDistances[j] = outDistances[j - 1];
+                outIndices[j]   = outIndices[j - 1];
+                j--;
+            }
+            outDistances[j] = dist;
+            outIndices[j]   = index;
+        }
+        for (int i = 0; i < K; i++)
+        {
+            const int missing = outDistances[i] >= maxDistance;
+            outIndices[i]     = missing ? -1 : modelIndices[outIndices[i]];
+            outDistances[i]   = missing ? (algorithmFPType)-1.0 : sqrt(outDistances[i]);
+        }
+    }
+
+);
+
+#endif
@@ -0,0 +1,92 @@
+/* file: kdtree_knn_classification_predict_kernel_ucapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the GPU kernel searching the KD-tree for K-Nearest Neighbors.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_KERNEL_UCAPI_H__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_KERNEL_UCAPI_H__
+
+#include "data_management/data/numeric_table.h"
+#include "src/algorithms/kernel.h"
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
+#include "src/algorithms/k_nearest_neighbors/kdtree_knn_classification_model_impl.h"
+#include "services/internal/sycl/execution_context.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+/*
+ * Searches the nearest neighbors in the KD-tree of the model built either on CPU or on GPU.
+ * Every work-item traverses the tree for one query without a stack by returning to the parent
+ * of the node, the work-groups process the consecutive batches of the queries.
+ */
+template <typename algorithmFpType>
+class KNNClassificationPredictKernelUCAPI : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
+
+    /*
+     * Writes the indices of the neighbors in the training data and the distances to them in the
+     * increasing order of the distances, the labels are not voted if y is null
+     */
+    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices,
+                             NumericTable * distances, const daal::algorithms::Parameter * par);
+
+private:
+    services::Status searchTree(services::internal::sycl::ExecutionContextIface & context, const services::internal::Buffer<algorithmFpType> & data,
+                                const services::internal::Buffer<algorithmFpType> & queries, const services::internal::sycl::UniversalBuffer & nodeDims,
+                                const services::internal::sycl::UniversalBuffer & nodeCuts, const services::internal::sycl::UniversalBuffer & nodeLeft,
+                                const services::internal::sycl::UniversalBuffer & nodeRight,
+                                const services::internal::sycl::UniversalBuffer & nodeParent, services::internal::sycl::UniversalBuffer & kDistances,
+                                services::internal::sycl::UniversalBuffer & kIndices, uint32_t root, uint32_t nQueries, uint32_t nFeatures,
+                                uint32_t k);
+
+    services::Status vote(services::internal::sycl::ExecutionContextIface & context, const services::internal::Buffer<algorithmFpType> & labels,
+                          const services::internal::sycl::UniversalBuffer & kIndices, const services::internal::Buffer<algorithmFpType> & result,
+                          uint32_t nQueries, uint32_t k);
+
+    services::Status writeNeighbors(services::internal::sycl::ExecutionContextIface & context,
+                                    const services::internal::sycl::UniversalBuffer & kDistances,
+                                    const services::internal::sycl::UniversalBuffer & kIndices,
+                                    const services::internal::sycl::UniversalBuffer & modelIndices,
+                                    const services::internal::sycl::UniversalBuffer & distances,
+                                    const services::internal::sycl::UniversalBuffer & indices, uint32_t nQueries, uint32_t k);
+
+    static const uint32_t _queriesPerGroup = 64;
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,335 @@
+/* file: kdtree_knn_classification_predict_kernel_ucapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the GPU kernel searching the KD-tree for K-Nearest Neighbors.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_KERNEL_UCAPI_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_KERNEL_UCAPI_IMPL_I__
+
+#include "src/algorithms/k_nearest_neighbors/oneapi/kdtree_knn_classification_predict_kernel_ucapi.h"
+#include "src/algorithms/k_nearest_neighbors/oneapi/kdtree_knn_classification_program_ucapi.h"
+#include "src/externals/service_memory.h"
+#include "src/algorithms/k_nearest_neighbors/kdtree_knn_impl.i"
+#include "src/services/service_data_utils.h"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(kdtree_knn.prediction.batch.oneapi);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::services::internal::sycl;
+using namespace services;
+
+template <typename algorithmFpType>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const NumericTable * x, const classifier::Model * m, NumericTable * y,
+                                                                     const daal::algorithms::Parameter * par)
+{
+    return compute(x, m, y, nullptr, nullptr, par);
+}
+
+template <typename algorithmFpType>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const NumericTable * x, const classifier::Model * m, NumericTable * y,
+                                                                     NumericTable * indices, NumericTable * distances,
+                                                                     const daal::algorithms::Parameter * par)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+
+    Status st;
+
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+    DAAL_CHECK_STATUS_VAR(kdtree_knn_classification::internal::buildKDTreeProgram<algorithmFpType>(context.getClKernelFactory()));
+
+    const Model * const model         = static_cast<const Model *>(m);
+    const Parameter * const parameter = static_cast<const Parameter *>(par);
+    const uint32_t k                  = parameter->k;
+
+    NumericTable * const ntData   = const_cast<NumericTable *>(x);
+    NumericTable * const points   = const_cast<NumericTable *>(model->impl()->getData().get());
+    NumericTable * const labels   = const_cast<NumericTable *>(model->impl()->getLabels().get());
+    const KDTreeTable & treeTable = *(model->impl()->getKDTreeTable());
+    DAAL_CHECK(!y || labels, ErrorNullInputNumericTable);
+    const bool writeSearch = indices || distances;
+
+    const size_t nQueryRows  = ntData->getNumberOfRows();
+    const size_t nDataRows   = points->getNumberOfRows();
+    const uint32_t nFeatures = points->getNumberOfColumns();
+    const size_t nNodes      = model->impl()->getLastNodeIndex();
+    const size_t root        = model->impl()->getRootNodeIndex();
+    DAAL_CHECK(nDataRows <= static_cast<size_t>(INT_MAX) && nNodes <= static_cast<size_t>(INT_MAX), services::ErrorBufferSizeIntegerOverflow);
+
+    /* The nodes are copied into the separate arrays with the parents of the nodes for the stackless traversal */
+    auto nodeDims = context.allocate(TypeIds::id<int>(), nNodes, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto nodeCuts = context.allocate(TypeIds::id<algorithmFpType>(), nNodes, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto nodeLeft = context.allocate(TypeIds::id<int>(), nNodes, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto nodeRight = context.allocate(TypeIds::id<int>(), nNodes, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto nodeParent = context.allocate(TypeIds::id<int>(), nNodes, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    {
+        auto dimsHostPtr = nodeDims.get<int>().toHost(data_management::writeOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        auto cutsHostPtr = nodeCuts.template get<algorithmFpType>().toHost(data_management::writeOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        auto leftHostPtr = nodeLeft.get<int>().toHost(data_management::writeOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        auto rightHostPtr = nodeRight.get<int>().toHost(data_management::writeOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        auto parentHostPtr = nodeParent.get<int>().toHost(data_management::writeOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        int * const parents = parentHostPtr.get();
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            parents[i] = -1;
+        }
+
+        const KDTreeNode * const nodes = static_cast<const KDTreeNode *>(treeTable.getArray());
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            const KDTreeNode & node = nodes[i];
+            const bool isLeaf       = node.dimension == __KDTREE_NULLDIMENSION;
+            dimsHostPtr.get()[i]    = isLeaf ? -1 : static_cast<int>(node.dimension);
+            cutsHostPtr.get()[i]    = static_cast<algorithmFpType>(node.cutPoint);
+            leftHostPtr.get()[i]    = static_cast<int>(node.leftIndex);
+            rightHostPtr.get()[i]   = static_cast<int>(node.rightIndex);
+            if (!isLeaf)
+            {
+                parents[node.leftIndex]  = static_cast<int>(i);
+                parents[node.rightIndex] = static_cast<int>(i);
+            }
+        }
+        parents[root] = -1;
+    }
+
+    const uint32_t maxQueryBlockRowCount = 1 << 16;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, maxQueryBlockRowCount, k);
+
+    auto kDistances = context.allocate(TypeIds::id<algorithmFpType>(), maxQueryBlockRowCount * k, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto kIndices = context.allocate(TypeIds::id<int>(), maxQueryBlockRowCount * k, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    /* The tree stores the rows in the order of the leaves, the neighbors are reported by their original indices */
+    UniversalBuffer modelIndices;
+    UniversalBuffer searchDistances;
+    UniversalBuffer searchIndices;
+    if (writeSearch)
+    {
+        modelIndices = context.allocate(TypeIds::id<int>(), nDataRows, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        {
+            auto modelIndicesHostPtr = modelIndices.get<int>().toHost(data_management::writeOnly, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            const size_t * const permutation =
+                static_cast<const data_management::HomogenNumericTable<size_t> *>(model->impl()->getIndices().get())->getArray();
+            DAAL_CHECK(permutation, ErrorNullModel);
+            for (size_t i = 0; i < nDataRows; ++i)
+            {
+                modelIndicesHostPtr.get()[i] = static_cast<int>(permutation[i]);
+            }
+        }
+        /* The neighbors are written to the scratch buffers if their tables are not requested */
+        searchDistances = context.allocate(TypeIds::id<algorithmFpType>(), distances ? 1 : maxQueryBlockRowCount * k, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        searchIndices = context.allocate(TypeIds::id<int>(), indices ? 1 : maxQueryBlockRowCount * k, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    BlockDescriptor<algorithmFpType> dataRows;
+    DAAL_CHECK_STATUS_VAR(points->getBlockOfRows(0, nDataRows, readOnly, dataRows));
+    BlockDescriptor<algorithmFpType> labelRows;
+    if (y)
+    {
+        DAAL_CHECK_STATUS_VAR(labels->getBlockOfRows(0, nDataRows, readOnly, labelRows));
+    }
+
+    for (size_t start = 0; start < nQueryRows; start += maxQueryBlockRowCount)
+    {
+        const uint32_t nQueries = static_cast<uint32_t>(nQueryRows - start < maxQueryBlockRowCount ? nQueryRows - start : maxQueryBlockRowCount);
+
+        BlockDescriptor<algorithmFpType> queryRows;
+        DAAL_CHECK_STATUS_VAR(ntData->getBlockOfRows(start, nQueries, readOnly, queryRows));
+        DAAL_CHECK_STATUS_VAR(searchTree(context, dataRows.getBuffer(), queryRows.getBuffer(), nodeDims, nodeCuts, nodeLeft, nodeRight, nodeParent,
+                                         kDistances, kIndices, static_cast<uint32_t>(root), nQueries, nFeatures, k));
+        DAAL_CHECK_STATUS_VAR(ntData->releaseBlockOfRows(queryRows));
+
+        if (y)
+        {
+            BlockDescriptor<algorithmFpType> resultRows;
+            DAAL_CHECK_STATUS_VAR(y->getBlockOfRows(start, nQueries, writeOnly, resultRows));
+            DAAL_CHECK_STATUS_VAR(vote(context, labelRows.getBuffer(), kIndices, resultRows.getBuffer(), nQueries, k));
+            DAAL_CHECK_STATUS_VAR(y->releaseBlockOfRows(resultRows));
+        }
+
+        if (writeSearch)
+        {
+            BlockDescriptor<int> indexRows;
+            BlockDescriptor<algorithmFpType> distanceRows;
+            if (indices)
+            {
+                DAAL_CHECK_STATUS_VAR(indices->getBlockOfRows(start, nQueries, writeOnly, indexRows));
+            }
+            if (distances)
+            {
+                DAAL_CHECK_STATUS_VAR(distances->getBlockOfRows(start, nQueries, writeOnly, distanceRows));
+            }
+            DAAL_CHECK_STATUS_VAR(writeNeighbors(context, kDistances, kIndices, modelIndices,
+                                                 distances ? UniversalBuffer(distanceRows.getBuffer()) : searchDistances,
+                                                 indices ? UniversalBuffer(indexRows.getBuffer()) : searchIndices, nQueries, k));
+            if (indices)
+            {
+                DAAL_CHECK_STATUS_VAR(indices->releaseBlockOfRows(indexRows));
+            }
+            if (distances)
+            {
+                DAAL_CHECK_STATUS_VAR(distances->releaseBlockOfRows(distanceRows));
+            }
+        }
+    }
+
+    if (y)
+    {
+        DAAL_CHECK_STATUS_VAR(labels->releaseBlockOfRows(labelRows));
+    }
+    DAAL_CHECK_STATUS_VAR(points->releaseBlockOfRows(dataRows));
+    return st;
+}
+
+template <typename algorithmFpType>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::searchTree(ExecutionContextIface & context,
+                                                                        const services::internal::Buffer<algorithmFpType> & data,
+                                                                        const services::internal::Buffer<algorithmFpType> & queries,
+                                                                        const UniversalBuffer & nodeDims, const UniversalBuffer & nodeCuts,
+                                                                        const UniversalBuffer & nodeLeft, const UniversalBuffer & nodeRight,
+                                                                        const UniversalBuffer & nodeParent, UniversalBuffer & kDistances,
+                                                                        UniversalBuffer & kIndices, uint32_t root, uint32_t nQueries,
+                                                                        uint32_t nFeatures, uint32_t k)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.searchTree);
+
+    Status st;
+    auto & kernelFactory = context.getClKernelFactory();
+    auto search_kd_tree  = kernelFactory.getKernel("search_kd_tree", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    KernelArguments args(14);
+    args.set(0, data, AccessModeIds::read);
+    args.set(1, queries, AccessModeIds::read);
+    args.set(2, nodeDims, AccessModeIds::read);
+    args.set(3, nodeCuts, AccessModeIds::read);
+    args.set(4, nodeLeft, AccessModeIds::read);
+    args.set(5, nodeRight, AccessModeIds::read);
+    args.set(6, nodeParent, AccessModeIds::read);
+    args.set(7, kDistances, AccessModeIds::readwrite);
+    args.set(8, kIndices, AccessModeIds::readwrite);
+    args.set(9, root);
+    args.set(10, nQueries);
+    args.set(11, nFeatures);
+    args.set(12, k);
+    args.set(13, services::internal::MaxVal<algorithmFpType>::get());
+
+    const uint32_t nGroups = nQueries / _queriesPerGroup + uint32_t(nQueries % _queriesPerGroup != 0);
+    KernelRange local_range(_queriesPerGroup);
+    KernelRange global_range(nGroups * _queriesPerGroup);
+
+    KernelNDRange range(1);
+    range.global(global_range, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    range.local(local_range, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    context.run(range, search_kd_tree, args, &st);
+    return st;
+}
+
+template <typename algorithmFpType>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::vote(ExecutionContextIface & context,
+                                                                  const services::internal::Buffer<algorithmFpType> & labels,
+                                                                  const UniversalBuffer & kIndices,
+                                                                  const services::internal::Buffer<algorithmFpType> & result, uint32_t nQueries,
+                                                                  uint32_t k)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.vote);
+
+    Status st;
+    auto & kernelFactory = context.getClKernelFactory();
+    auto vote_kernel     = kernelFactory.getKernel("vote", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    KernelArguments args(5);
+    args.set(0, labels, AccessModeIds::read);
+    args.set(1, kIndices, AccessModeIds::read);
+    args.set(2, result, AccessModeIds::write);
+    args.set(3, nQueries);
+    args.set(4, k);
+
+    KernelRange global_range(nQueries);
+    context.run(global_range, vote_kernel, args, &st);
+    return st;
+}
+
+template <typename algorithmFpType>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::writeNeighbors(ExecutionContextIface & context, const UniversalBuffer & kDistances,
+                                                                            const UniversalBuffer & kIndices, const UniversalBuffer & modelIndices,
+                                                                            const UniversalBuffer & distances, const UniversalBuffer & indices,
+                                                                            uint32_t nQueries, uint32_t k)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.writeNeighbors);
+
+    Status st;
+    auto & kernelFactory  = context.getClKernelFactory();
+    auto write_neighbors = kernelFactory.getKernel("write_neighbors", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    KernelArguments args(8);
+    args.set(0, kDistances, AccessModeIds::read);
+    args.set(1, kIndices, AccessModeIds::read);
+    args.set(2, modelIndices, AccessModeIds::read);
+    args.set(3, distances, AccessModeIds::readwrite);
+    args.set(4, indices, AccessModeIds::readwrite);
+    args.set(5, nQueries);
+    args.set(6, k);
+    args.set(7, services::internal::MaxVal<algorithmFpType>::get());
+
+    KernelRange global_range(nQueries);
+    context.run(global_range, write_neighbors, args, &st);
+    return st;
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
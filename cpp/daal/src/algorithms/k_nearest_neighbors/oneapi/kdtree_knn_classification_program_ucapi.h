@@ -0,0 +1,63 @@
+/* file: kdtree_knn_classification_program_ucapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Building of the OpenCL program shared by the GPU KD-tree kernels.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PROGRAM_UCAPI_H__
+#define __KDTREE_KNN_CLASSIFICATION_PROGRAM_UCAPI_H__
+
+#include "services/internal/sycl/execution_context.h"
+#include "services/internal/sycl/types_utils.h"
+#include "src/algorithms/k_nearest_neighbors/oneapi/cl_kernels/kdtree_knn_cl_kernels.cl"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace internal
+{
+/* The number of work-items in the work-groups reducing over the rows of the node */
+const uint32_t kdTreeLocalSize = 256;
+
+template <typename algorithmFpType>
+services::Status buildKDTreeProgram(services::internal::sycl::ClKernelFactoryIface & kernelFactory)
+{
+    auto fptype_name   = services::internal::sycl::getKeyFPType<algorithmFpType>();
+    auto build_options = fptype_name;
+    build_options.add(sizeof(algorithmFpType) == sizeof(float) ? " -D radixUIntType=uint " : " -D radixUIntType=ulong ");
+    build_options.add(" -D LOCAL_SIZE=256 "); // should be equal to kdTreeLocalSize
+
+    services::String cachekey("__daal_algorithms_kdtree_knn_");
+    cachekey.add(fptype_name);
+
+    services::Status st;
+    kernelFactory.build(services::internal::sycl::ExecutionTargetIds::device, cachekey.c_str(), kdtree_knn_cl_kernels, build_options.c_str(), &st);
+    return st;
+}
+
+} // namespace internal
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,78 @@
+/* file: kdtree_knn_classification_train_kernel_ucapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the GPU kernel building the KD-tree for K-Nearest Neighbors.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_TRAIN_KERNEL_UCAPI_H__
+#define __KDTREE_KNN_CLASSIFICATION_TRAIN_KERNEL_UCAPI_H__
+
+#include "data_management/data/numeric_table.h"
+#include "src/algorithms/kernel.h"
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_training_types.h"
+#include "src/algorithms/k_nearest_neighbors/kdtree_knn_classification_model_impl.h"
+#include "services/internal/sycl/execution_context.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::services;
+
+/*
+ * Builds the balanced KD-tree level by level: the rows of every node of the level are sorted
+ * on the dimension of the largest extent of the node with the radix sort and split at the median.
+ * The tree is stored in the model in the same layout as the CPU kernel stores it, the children
+ * of the node i are 2 * i + 1 and 2 * i + 2.
+ */
+template <typename algorithmFpType>
+class KNNClassificationTrainKernelUCAPI : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(NumericTable * x, NumericTable * y, Model * r, const Parameter & par);
+
+private:
+    services::Status splitLevel(services::internal::sycl::ExecutionContextIface & context, const services::internal::Buffer<algorithmFpType> & data,
+                                services::internal::sycl::UniversalBuffer & perm, services::internal::sycl::UniversalBuffer & permOut,
+                                const services::internal::sycl::UniversalBuffer & offsets, services::internal::sycl::UniversalBuffer & splitDims,
+                                services::internal::sycl::UniversalBuffer & cutPoints, services::internal::sycl::UniversalBuffer & keys,
+                                services::internal::sycl::UniversalBuffer & keysBuffer, services::internal::sycl::UniversalBuffer & positions,
+                                services::internal::sycl::UniversalBuffer & positionsBuffer, uint32_t nRows, uint32_t nFeatures,
+                                uint32_t nSegments, uint32_t firstNode);
+
+    services::Status gatherRows(services::internal::sycl::ExecutionContextIface & context, const services::internal::Buffer<algorithmFpType> & data,
+                                const services::internal::sycl::UniversalBuffer & perm, const services::internal::Buffer<algorithmFpType> & out,
+                                uint32_t nRows, uint32_t nFeatures);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
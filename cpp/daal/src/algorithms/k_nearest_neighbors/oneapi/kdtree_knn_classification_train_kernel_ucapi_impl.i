@@ -0,0 +1,373 @@
+/* file: kdtree_knn_classification_train_kernel_ucapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the GPU kernel building the KD-tree for K-Nearest Neighbors.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_TRAIN_KERNEL_UCAPI_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_TRAIN_KERNEL_UCAPI_IMPL_I__
+
+#include "data_management/data/internal/numeric_table_sycl_homogen.h"
+#include "src/algorithms/k_nearest_neighbors/oneapi/kdtree_knn_classification_train_kernel_ucapi.h"
+#include "src/algorithms/k_nearest_neighbors/oneapi/kdtree_knn_classification_program_ucapi.h"
+#include "src/externals/service_memory.h"
+#include "src/algorithms/k_nearest_neighbors/kdtree_knn_impl.i"
+#include "src/sycl/sorter.h"
+#include "src/services/service_arrays.h"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(kdtree_knn.training.batch.oneapi);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::services::internal::sycl;
+using sort::RadixSort;
+
+template <typename algorithmFpType>
+Status KNNClassificationTrainKernelUCAPI<algorithmFpType>::compute(NumericTable * x, NumericTable * y, Model * r, const Parameter & par)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+
+    Status st;
+
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+    DAAL_CHECK_STATUS_VAR(kdtree_knn_classification::internal::buildKDTreeProgram<algorithmFpType>(context.getClKernelFactory()));
+
+    const size_t nRows     = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    DAAL_CHECK(nRows <= static_cast<size_t>(INT_MAX), services::ErrorBufferSizeIntegerOverflow);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nRows, nFeatures);
+    r->setNFeatures(nFeatures);
+
+    /* The depth of the tree is the smallest one that leaves at most __KDTREE_LEAF_BUCKET_SIZE rows in every leaf */
+    size_t depth = 0;
+    while (((nRows + (size_t(1) << depth) - 1) >> depth) > __KDTREE_LEAF_BUCKET_SIZE)
+    {
+        ++depth;
+    }
+    const size_t nLeaves    = size_t(1) << depth;
+    const size_t nNodes     = 2 * nLeaves - 1;
+    const size_t nInternals = nLeaves - 1;
+
+    /* The ranges of the nodes are defined by the halving of the rows, so they are known before the build */
+    services::internal::TArray<size_t, sse2> nodeStart(nNodes);
+    services::internal::TArray<size_t, sse2> nodeEnd(nNodes);
+    DAAL_CHECK_MALLOC(nodeStart.get() && nodeEnd.get());
+    nodeStart[0] = 0;
+    nodeEnd[0]   = nRows;
+    for (size_t i = 0; i < nInternals; ++i)
+    {
+        const size_t middle  = nodeStart[i] + (nodeEnd[i] - nodeStart[i]) / 2;
+        nodeStart[2 * i + 1] = nodeStart[i];
+        nodeEnd[2 * i + 1]   = middle;
+        nodeStart[2 * i + 2] = middle;
+        nodeEnd[2 * i + 2]   = nodeEnd[i];
+    }
+
+    BlockDescriptor<algorithmFpType> dataRows;
+    DAAL_CHECK_STATUS_VAR(x->getBlockOfRows(0, nRows, readOnly, dataRows));
+    const services::internal::Buffer<algorithmFpType> data = dataRows.getBuffer();
+
+    auto perm = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto permOut = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto positions = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto positionsBuffer = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    /* The keys keep the split values, then the segment numbers as the unsigned integers of the size of algorithmFpType */
+    auto keys = context.allocate(TypeIds::id<algorithmFpType>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto keysBuffer = context.allocate(TypeIds::id<algorithmFpType>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto splitDims = context.allocate(TypeIds::id<int>(), nInternals + 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto cutPoints = context.allocate(TypeIds::id<algorithmFpType>(), nInternals + 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto offsets = context.allocate(TypeIds::id<int>(), nLeaves / 2 + 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    {
+        auto & kernelFactory  = context.getClKernelFactory();
+        auto init_permutation = kernelFactory.getKernel("init_permutation", &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        KernelArguments args(2);
+        args.set(0, perm, AccessModeIds::write);
+        args.set(1, static_cast<int32_t>(nRows));
+
+        KernelRange global_range(nRows);
+        context.run(global_range, init_permutation, args, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    for (size_t level = 0; level < depth; ++level)
+    {
+        const size_t nSegments = size_t(1) << level;
+        const size_t firstNode = nSegments - 1;
+        {
+            auto offsetsHostPtr = offsets.get<int>().toHost(data_management::writeOnly, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            int * const offsetsHost = offsetsHostPtr.get();
+            for (size_t i = 0; i < nSegments; ++i)
+            {
+                offsetsHost[i] = static_cast<int>(nodeStart[firstNode + i]);
+            }
+            offsetsHost[nSegments] = static_cast<int>(nRows);
+        }
+        DAAL_CHECK_STATUS_VAR(splitLevel(context, data, perm, permOut, offsets, splitDims, cutPoints, keys, keysBuffer, positions, positionsBuffer,
+                                         nRows, nFeatures, nSegments, firstNode));
+    }
+
+    /* The model keeps the rows and the labels in the order of the leaves as the CPU kernel does */
+    auto modelData = data_management::internal::SyclHomogenNumericTable<algorithmFpType>::create(nFeatures, nRows, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    {
+        BlockDescriptor<algorithmFpType> modelDataRows;
+        DAAL_CHECK_STATUS_VAR(modelData->getBlockOfRows(0, nRows, writeOnly, modelDataRows));
+        DAAL_CHECK_STATUS_VAR(gatherRows(context, data, perm, modelDataRows.getBuffer(), nRows, nFeatures));
+        DAAL_CHECK_STATUS_VAR(modelData->releaseBlockOfRows(modelDataRows));
+    }
+    DAAL_CHECK_STATUS_VAR(x->releaseBlockOfRows(dataRows));
+    DAAL_CHECK_STATUS(st, r->impl()->setData<algorithmFpType>(modelData, false));
+
+    if (y)
+    {
+        auto modelLabels = data_management::internal::SyclHomogenNumericTable<algorithmFpType>::create(1, nRows, NumericTable::doAllocate, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        BlockDescriptor<algorithmFpType> labelRows;
+        DAAL_CHECK_STATUS_VAR(y->getBlockOfRows(0, nRows, readOnly, labelRows));
+        BlockDescriptor<algorithmFpType> modelLabelRows;
+        DAAL_CHECK_STATUS_VAR(modelLabels->getBlockOfRows(0, nRows, writeOnly, modelLabelRows));
+        DAAL_CHECK_STATUS_VAR(gatherRows(context, labelRows.getBuffer(), perm, modelLabelRows.getBuffer(), nRows, 1));
+        DAAL_CHECK_STATUS_VAR(modelLabels->releaseBlockOfRows(modelLabelRows));
+        DAAL_CHECK_STATUS_VAR(y->releaseBlockOfRows(labelRows));
+        DAAL_CHECK_STATUS(st, r->impl()->setLabels<algorithmFpType>(modelLabels, false));
+    }
+
+    /* The tree and the original indices of the rows are copied to the host */
+    KDTreeTablePtr kdTreeTable(new KDTreeTable(nNodes, st));
+    DAAL_CHECK_MALLOC(kdTreeTable.get());
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS(st, r->impl()->resetIndices(nRows));
+    {
+        auto splitDimsHostPtr = splitDims.get<int>().toHost(data_management::readOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        auto cutPointsHostPtr = cutPoints.template get<algorithmFpType>().toHost(data_management::readOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        auto permHostPtr = perm.get<int>().toHost(data_management::readOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        KDTreeNode * const nodes = static_cast<KDTreeNode *>(kdTreeTable->getArray());
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            KDTreeNode & node = nodes[i];
+            if (i < nInternals)
+            {
+                node.dimension  = static_cast<size_t>(splitDimsHostPtr.get()[i]);
+                node.leftIndex  = 2 * i + 1;
+                node.rightIndex = 2 * i + 2;
+                node.cutPoint   = cutPointsHostPtr.get()[i];
+            }
+            else
+            {
+                node.dimension  = __KDTREE_NULLDIMENSION;
+                node.leftIndex  = nodeStart[i];
+                node.rightIndex = nodeEnd[i];
+                node.cutPoint   = 0;
+            }
+        }
+
+        size_t * const indices = static_cast<data_management::HomogenNumericTable<size_t> *>(r->impl()->getIndices().get())->getArray();
+        const int * const permHost = permHostPtr.get();
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            indices[i] = static_cast<size_t>(permHost[i]);
+        }
+    }
+    r->impl()->setKDTreeTable(kdTreeTable);
+    r->impl()->setRootNodeIndex(0);
+    r->impl()->setLastNodeIndex(nNodes);
+
+    return st;
+}
+
+template <typename algorithmFpType>
+Status KNNClassificationTrainKernelUCAPI<algorithmFpType>::splitLevel(ExecutionContextIface & context,
+                                                                      const services::internal::Buffer<algorithmFpType> & data, UniversalBuffer & perm,
+                                                                      UniversalBuffer & permOut, const UniversalBuffer & offsets,
+                                                                      UniversalBuffer & splitDims, UniversalBuffer & cutPoints, UniversalBuffer & keys,
+                                                                      UniversalBuffer & keysBuffer, UniversalBuffer & positions,
+                                                                      UniversalBuffer & positionsBuffer, uint32_t nRows, uint32_t nFeatures,
+                                                                      uint32_t nSegments, uint32_t firstNode)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.splitLevel);
+
+    Status st;
+    auto & kernelFactory = context.getClKernelFactory();
+
+    {
+        auto compute_split_dims = kernelFactory.getKernel("compute_split_dims", &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        KernelArguments args(6);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, perm, AccessModeIds::read);
+        args.set(2, offsets, AccessModeIds::read);
+        args.set(3, splitDims, AccessModeIds::readwrite);
+        args.set(4, nFeatures);
+        args.set(5, firstNode);
+
+        KernelRange local_range(kdtree_knn_classification::internal::kdTreeLocalSize);
+        KernelRange global_range(nSegments * kdtree_knn_classification::internal::kdTreeLocalSize);
+
+        KernelNDRange range(1);
+        range.global(global_range, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        range.local(local_range, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        context.run(range, compute_split_dims, args, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    {
+        auto gather_split_keys = kernelFactory.getKernel("gather_split_keys", &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        KernelArguments args(10);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, perm, AccessModeIds::read);
+        args.set(2, offsets, AccessModeIds::read);
+        args.set(3, splitDims, AccessModeIds::read);
+        args.set(4, keys, AccessModeIds::write);
+        args.set(5, positions, AccessModeIds::write);
+        args.set(6, nRows);
+        args.set(7, nFeatures);
+        args.set(8, nSegments);
+        args.set(9, firstNode);
+
+        KernelRange global_range(nRows);
+        context.run(global_range, gather_split_keys, args, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    /* The rows are sorted by the split values, then the stable sort by the segments groups them back into the segments */
+    DAAL_CHECK_STATUS_VAR(RadixSort::sortIndices(keys, positions, keysBuffer, positionsBuffer, nRows));
+
+    {
+        auto gather_segment_keys = kernelFactory.getKernel("gather_segment_keys", &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        KernelArguments args(5);
+        args.set(0, offsets, AccessModeIds::read);
+        args.set(1, positions, AccessModeIds::read);
+        args.set(2, keys, AccessModeIds::write);
+        args.set(3, nRows);
+        args.set(4, nSegments);
+
+        KernelRange global_range(nRows);
+        context.run(global_range, gather_segment_keys, args, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    DAAL_CHECK_STATUS_VAR(RadixSort::sortIndices(keys, positions, keysBuffer, positionsBuffer, nRows));
+
+    {
+        auto permute_indices = kernelFactory.getKernel("permute_indices", &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        KernelArguments args(4);
+        args.set(0, perm, AccessModeIds::read);
+        args.set(1, positions, AccessModeIds::read);
+        args.set(2, permOut, AccessModeIds::write);
+        args.set(3, nRows);
+
+        KernelRange global_range(nRows);
+        context.run(global_range, permute_indices, args, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+    const UniversalBuffer permPrev = perm;
+    perm                           = permOut;
+    permOut                        = permPrev;
+
+    {
+        auto set_cut_points = kernelFactory.getKernel("set_cut_points", &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        KernelArguments args(8);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, perm, AccessModeIds::read);
+        args.set(2, offsets, AccessModeIds::read);
+        args.set(3, splitDims, AccessModeIds::read);
+        args.set(4, cutPoints, AccessModeIds::readwrite);
+        args.set(5, nFeatures);
+        args.set(6, nSegments);
+        args.set(7, firstNode);
+
+        KernelRange global_range(nSegments);
+        context.run(global_range, set_cut_points, args, &st);
+    }
+    return st;
+}
+
+template <typename algorithmFpType>
+Status KNNClassificationTrainKernelUCAPI<algorithmFpType>::gatherRows(ExecutionContextIface & context,
+                                                                      const services::internal::Buffer<algorithmFpType> & data,
+                                                                      const UniversalBuffer & perm, const services::internal::Buffer<algorithmFpType> & out,
+                                                                      uint32_t nRows, uint32_t nFeatures)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.gatherRows);
+
+    Status st;
+    auto & kernelFactory = context.getClKernelFactory();
+    auto gather_rows     = kernelFactory.getKernel("gather_rows", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    KernelArguments args(5);
+    args.set(0, data, AccessModeIds::read);
+    args.set(1, perm, AccessModeIds::read);
+    args.set(2, out, AccessModeIds::write);
+    args.set(3, nRows);
+    args.set(4, nFeatures);
+
+    KernelRange global_range(nRows);
+    context.run(global_range, gather_rows, args, &st);
+    return st;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -29,15 +29,103 @@
 #include "services/internal/daal_kernel_defines.h"
 #include "services/internal/gpu_support_checker.h"
 
+#if defined(DAAL_KERNEL_SPLIT_ISA)
+    #include <type_traits>
+    #include <typeinfo>
+
+namespace daal
+{
+namespace internal
+{
+/* The kernels of the CPU types other than sse2 are built into the separate libraries loaded by the dispatchers on the
+   first use. The containers built into such library register their factories when it is loaded, the registration is
+   instantiated by the constructor of the container */
+template <typename Container>
+struct IsaContainerRegistrar
+{
+    static void * create(void * env)
+    {
+        algorithms::AlgorithmContainerIface * container = new Container(static_cast<daal::services::Environment::env *>(env));
+        return container;
+    }
+
+    static bool registerContainer()
+    {
+        __daal_serv_isa_container_register(typeid(Container).name(), &IsaContainerRegistrar<Container>::create);
+        return true;
+    }
+
+    static volatile bool isRegistered;
+};
+
+template <typename Container>
+volatile bool IsaContainerRegistrar<Container>::isRegistered = IsaContainerRegistrar<Container>::registerContainer();
+
+} // namespace internal
+} // namespace daal
+
+    #define __DAAL_REGISTER_ISA_CONTAINER \
+        (void)daal::internal::IsaContainerRegistrar<typename std::remove_cv<typename std::remove_pointer<decltype(this)>::type>::type>::isRegistered;
+
+    /* The containers of the CPU types other than sse2 are created by the loaded libraries, the factories return the
+       pointers to the interface of the containers */
+    #define __DAAL_CREATE_ISA_CONTAINER(cpuType, ContainerType) \
+        static_cast<daal::algorithms::AlgorithmContainerIface *>(__daal_serv_isa_container_create(cpuType, typeid(ContainerType).name(), daalEnv))
+
+    #undef DAAL_KERNEL_CONTAINER_CASE
+    #define DAAL_KERNEL_CONTAINER_CASE(ContainerTemplate, cpuType, ...)                                                                 \
+    case cpuType:                                                                                                                       \
+    {                                                                                                                                   \
+        using contTemplType = DAAL_KERNEL_CONTAINER_TEMPL(ContainerTemplate, cpuType, __VA_ARGS__);                                     \
+        _cntr               = static_cast<decltype(_cntr)>(__DAAL_CREATE_ISA_CONTAINER(cpuType, contTemplType));                        \
+        if (!_cntr) _cntr = (new DAAL_KERNEL_CONTAINER_TEMPL(ContainerTemplate, sse2, __VA_ARGS__)(daalEnv));                           \
+        break;                                                                                                                          \
+    }
+
+    /* The containers of the CPU types other than sse2 are not instantiated in the core library */
+    #undef DAAL_KERNEL_SSSE3_CONTAINER1
+    #undef DAAL_KERNEL_SSE42_CONTAINER1
+    #undef DAAL_KERNEL_AVX_CONTAINER1
+    #undef DAAL_KERNEL_AVX2_CONTAINER1
+    #undef DAAL_KERNEL_AVX512_MIC_CONTAINER1
+    #undef DAAL_KERNEL_AVX512_CONTAINER1
+    #define DAAL_KERNEL_SSSE3_CONTAINER1(ContainerTemplate, ...)
+    #define DAAL_KERNEL_SSE42_CONTAINER1(ContainerTemplate, ...)
+    #define DAAL_KERNEL_AVX_CONTAINER1(ContainerTemplate, ...)
+    #define DAAL_KERNEL_AVX2_CONTAINER1(ContainerTemplate, ...)
+    #define DAAL_KERNEL_AVX512_MIC_CONTAINER1(ContainerTemplate, ...)
+    #define DAAL_KERNEL_AVX512_CONTAINER1(ContainerTemplate, ...)
+
+    #undef DAAL_KERNEL_CONTAINER_CASE_SYCL
+    #define DAAL_KERNEL_CONTAINER_CASE_SYCL(ContainerTemplate, cpuType, ...)                                                            \
+    case cpuType:                                                                                                                       \
+    {                                                                                                                                   \
+        using contTemplType = DAAL_KERNEL_CONTAINER_TEMPL(ContainerTemplate, cpuType, __VA_ARGS__);                                     \
+        static volatile daal::services::internal::GpuSupportRegistrar<contTemplType> registrar;                                         \
+        _cntr = static_cast<decltype(_cntr)>(__DAAL_CREATE_ISA_CONTAINER(cpuType, contTemplType));                                    \
+        if (!_cntr)                                                                                                                     \
+        {                                                                                                                               \
+            static volatile daal::services::internal::GpuSupportRegistrar<DAAL_KERNEL_CONTAINER_TEMPL(ContainerTemplate, sse2,          \
+                                                                                                      __VA_ARGS__)> sse2Registrar;      \
+            _cntr = (new DAAL_KERNEL_CONTAINER_TEMPL(ContainerTemplate, sse2, __VA_ARGS__)(daalEnv));                                   \
+        }                                                                                                                               \
+        break;                                                                                                                          \
+    }
+#else
+    #define __DAAL_REGISTER_ISA_CONTAINER
+#endif
+
 #undef __DAAL_INITIALIZE_KERNELS
 #define __DAAL_INITIALIZE_KERNELS(KernelClass, ...)    \
     {                                                  \
+        __DAAL_REGISTER_ISA_CONTAINER                  \
         _kernel = (new KernelClass<__VA_ARGS__, cpu>); \
     }
 
 #undef __DAAL_INITIALIZE_KERNELS_SYCL
 #define __DAAL_INITIALIZE_KERNELS_SYCL(KernelClass, ...) \
     {                                                    \
+        __DAAL_REGISTER_ISA_CONTAINER                    \
         _kernel = (new KernelClass<__VA_ARGS__>);        \
     }
 
@@ -93,7 +181,8 @@
                             DAAL_KERNEL_AVX512_CONTAINER(ContainerTemplate, __VA_ARGS__)>::ClassName(daal::services::Environment::env * daalEnv)    \
         : BaseClassName(daalEnv), _cntr(nullptr)                                                                                                    \
     {                                                                                                                                               \
-        GetCpuid switch (cpuid)                                                                                                                     \
+        GetCpuid cpuid = __daal_serv_cpu_dispatch(cpuid, #ContainerTemplate "<" #__VA_ARGS__ ">");                                                  \
+        switch (cpuid)                                                                                                                              \
         {                                                                                                                                           \
             DAAL_KERNEL_SSSE3_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                                                                        \
             DAAL_KERNEL_SSE42_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                                                                        \
@@ -122,7 +211,8 @@
                             DAAL_KERNEL_AVX512_CONTAINER(ContainerTemplate, __VA_ARGS__)>::ClassName(daal::services::Environment::env * daalEnv)    \
         : BaseClassName(daalEnv), _cntr(nullptr)                                                                                                    \
     {                                                                                                                                               \
-        switch (daalEnv->cpuid)                                                                                                                     \
+        const int cpuid = __daal_serv_cpu_dispatch(daalEnv->cpuid, #ContainerTemplate "<" #__VA_ARGS__ ">");                                        \
+        switch (cpuid)                                                                                                                              \
         {                                                                                                                                           \
             DAAL_KERNEL_SSSE3_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                                                                        \
             DAAL_KERNEL_SSE42_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                                                                        \
@@ -179,7 +269,8 @@
                             DAAL_KERNEL_AVX512_CONTAINER(ContainerTemplate, __VA_ARGS__)>::ClassName(daal::services::Environment::env * daalEnv)    \
         : BaseClassName(daalEnv), _cntr(NULL)                                                                                                       \
     {                                                                                                                                               \
-        GetCpuid switch (cpuid)                                                                                                                     \
+        GetCpuid cpuid = __daal_serv_cpu_dispatch(cpuid, #ContainerTemplate "<" #__VA_ARGS__ ">");                                                  \
+        switch (cpuid)                                                                                                                              \
         {                                                                                                                                           \
             DAAL_KERNEL_SSSE3_CONTAINER_CASE_SYCL(ContainerTemplate, __VA_ARGS__)                                                                   \
             DAAL_KERNEL_SSE42_CONTAINER_CASE_SYCL(ContainerTemplate, __VA_ARGS__)                                                                   \
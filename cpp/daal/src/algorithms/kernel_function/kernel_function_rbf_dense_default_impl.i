@@ -49,12 +49,10 @@ struct KernelRBFTask
 public:
     DAAL_NEW_DELETE();
     algorithmFPType * mklBuff;
-    algorithmFPType * sqrDataA1;
-    algorithmFPType * sqrDataA2;
 
-    static KernelRBFTask * create(const size_t blockSize, const bool isEqualMatrix)
+    static KernelRBFTask * create(const size_t blockSize)
     {
-        auto object = new KernelRBFTask(blockSize, isEqualMatrix);
+        auto object = new KernelRBFTask(blockSize);
         if (object && object->isValid()) return object;
         delete object;
         return nullptr;
@@ -63,19 +61,42 @@ public:
     bool isValid() const { return _buff.get(); }
 
 private:
-    KernelRBFTask(const size_t blockSize, const bool isEqualMatrix)
+    KernelRBFTask(const size_t blockSize)
     {
-        const size_t buffASize = isEqualMatrix ? blockSize : 2 * blockSize;
-        _buff.reset(blockSize * blockSize + buffASize);
-
-        mklBuff   = &_buff[0];
-        sqrDataA1 = &_buff[blockSize * blockSize];
-        sqrDataA2 = isEqualMatrix ? sqrDataA1 : &sqrDataA1[blockSize];
+        _buff.reset(blockSize * blockSize);
+        mklBuff = _buff.get();
     }
 
     TArrayScalable<algorithmFPType, cpu> _buff;
 };
 
+/* Computes the squared norms of all rows of the table block by block */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeSqrNorms(const NumericTable * a, const size_t blockSize, algorithmFPType * const sqrNorms)
+{
+    const size_t nVectors  = a->getNumberOfRows();
+    const size_t nFeatures = a->getNumberOfColumns();
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        const size_t startRow     = iBlock * blockSize;
+        const size_t nRowsInBlock = (iBlock != nBlocks - 1) ? blockSize : nVectors - startRow;
+
+        ReadRows<algorithmFPType, cpu> mtA(*const_cast<NumericTable *>(a), startRow, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtA);
+        const algorithmFPType * const dataA = mtA.get();
+
+        DAAL_INT one = 1;
+        for (size_t i = 0; i < nRowsInBlock; ++i)
+        {
+            const algorithmFPType * dataAi = dataA + i * nFeatures;
+            sqrNorms[startRow + i]         = Blas<algorithmFPType, cpu>::xxdot((DAAL_INT *)&nFeatures, dataAi, &one, dataAi, &one);
+        }
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInternalVectorVector(const NumericTable * a1, const NumericTable * a2,
                                                                                                 NumericTable * r, const ParameterBase * par)
@@ -284,7 +305,6 @@ services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInter
     const algorithmFPType coeff = static_cast<algorithmFPType>(-0.5 / (rbfPar->sigma * rbfPar->sigma));
 
     char trans = 'T', notrans = 'N';
-    DAAL_INT one         = 1;
     algorithmFPType zero = 0.0, negTwo = -2.0;
 
     const bool isSOARes = r->getDataLayout() & NumericTableIface::soa;
@@ -297,8 +317,24 @@ services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInter
     const size_t nBlocks2                 = nVectors2 / blockSize + !!(nVectors2 % blockSize);
     const algorithmFPType expExpThreshold = Math<algorithmFPType, cpu>::vExpThreshold();
 
+    /* The squared norms of the rows are computed once instead of for every pair of blocks,
+       separate arrays keep the norms of every block aligned as postGemmPart loads them */
+    TArrayScalable<algorithmFPType, cpu> sqrNormsA1(nVectors1);
+    TArrayScalable<algorithmFPType, cpu> sqrNormsA2(isEqualMatrix ? 0 : nVectors2);
+    DAAL_CHECK_MALLOC(sqrNormsA1.get() && (isEqualMatrix || sqrNormsA2.get()));
+    algorithmFPType * const sqrDataA1All = sqrNormsA1.get();
+    algorithmFPType * const sqrDataA2All = isEqualMatrix ? sqrDataA1All : sqrNormsA2.get();
+
+    services::Status status = computeSqrNorms<algorithmFPType, cpu>(a1, blockSize, sqrDataA1All);
+    DAAL_CHECK_STATUS_VAR(status);
+    if (!isEqualMatrix)
+    {
+        status = computeSqrNorms<algorithmFPType, cpu>(a2, blockSize, sqrDataA2All);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
     daal::tls<KernelRBFTask<algorithmFPType, cpu> *> tslTask([=, &safeStat]() {
-        auto tlsData = KernelRBFTask<algorithmFPType, cpu>::create(blockSize, isEqualMatrix);
+        auto tlsData = KernelRBFTask<algorithmFPType, cpu>::create(blockSize);
         if (!tlsData)
         {
             safeStat.add(services::ErrorMemoryAllocationFailed);
@@ -325,30 +361,16 @@ services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInter
             DAAL_INT startRow2     = iBlock2 * blockSize;
 
             KernelRBFTask<algorithmFPType, cpu> * const tlsLocal = tslTask.local();
+            DAAL_CHECK_MALLOC_THR(tlsLocal);
 
-            algorithmFPType * const mklBuff   = tlsLocal->mklBuff;
-            algorithmFPType * const sqrDataA1 = tlsLocal->sqrDataA1;
-            algorithmFPType * const sqrDataA2 = tlsLocal->sqrDataA2;
-
-            if (!isEqualMatrix)
-            {
-                for (size_t i = 0; i < nRowsInBlock1; ++i)
-                {
-                    const algorithmFPType * dataA1i = dataA1 + i * nFeatures;
-                    sqrDataA1[i]                    = Blas<algorithmFPType, cpu>::xxdot((DAAL_INT *)&nFeatures, dataA1i, &one, dataA1i, &one);
-                }
-            }
+            algorithmFPType * const mklBuff         = tlsLocal->mklBuff;
+            const algorithmFPType * const sqrDataA1 = sqrDataA1All + startRow1;
+            const algorithmFPType * const sqrDataA2 = sqrDataA2All + startRow2;
 
             ReadRows<algorithmFPType, cpu> mtA2(*const_cast<NumericTable *>(a2), startRow2, nRowsInBlock2);
             DAAL_CHECK_BLOCK_STATUS_THR(mtA2);
             const algorithmFPType * const dataA2 = const_cast<algorithmFPType *>(mtA2.get());
 
-            for (size_t i = 0; i < nRowsInBlock2; ++i)
-            {
-                const algorithmFPType * dataA2i = dataA2 + i * nFeatures;
-                sqrDataA2[i]                    = Blas<algorithmFPType, cpu>::xxdot((DAAL_INT *)&nFeatures, dataA2i, &one, dataA2i, &one);
-            }
-
             DAAL_INT lda = nFeatures;
             DAAL_INT ldb = nFeatures;
             DAAL_INT ldc = blockSize;
@@ -386,7 +408,7 @@ services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInter
 
     tslTask.reduce([](KernelRBFTask<algorithmFPType, cpu> * tlsLocal) { delete tlsLocal; });
 
-    return services::Status();
+    return safeStat.detach();
 }
 
 } // namespace internal
@@ -129,8 +129,6 @@ services::Status KernelImplRBFOneAPI<defaultDense, algorithmFPType>::computeInte
 {
     services::Status status;
 
-    auto & context = services::internal::getDefaultContext();
-
     const size_t nMatLeft  = matLeft->getNumberOfRows();
     const size_t nMatRight = matRight->getNumberOfRows();
 
@@ -155,22 +153,27 @@ services::Status KernelImplRBFOneAPI<defaultDense, algorithmFPType>::computeInte
 
     services::internal::Buffer<algorithmFPType> rBuf = resultBlock.getBuffer();
 
-    DAAL_CHECK_STATUS(status, lazyAllocate(_sqrMatLeft, nMatLeft));
-    DAAL_CHECK_STATUS(status, lazyAllocate(_sqrMatRight, nMatRight));
+    /* The squared norms of the rows of the same table are computed once */
+    const bool isEqualMatrix = matLeft == matRight;
 
-    UniversalBuffer sqrA1U = context.allocate(TypeIds::id<algorithmFPType>(), nMatLeft, &status);
-    DAAL_CHECK_STATUS_VAR(status);
-    UniversalBuffer sqrA2U = context.allocate(TypeIds::id<algorithmFPType>(), nMatRight, &status);
-    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_STATUS(status, lazyAllocate(_sqrMatLeft, nMatLeft));
+    if (!isEqualMatrix)
+    {
+        DAAL_CHECK_STATUS(status, lazyAllocate(_sqrMatRight, nMatRight));
+    }
 
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(KernelRBF.sumOfSquares);
 
         Reducer::reduce(Reducer::BinaryOp::SUM_OF_SQUARES, Layout::RowMajor, matLeftBuf, _sqrMatLeft, nMatLeft, pMatLeft, &status);
         DAAL_CHECK_STATUS_VAR(status);
-        Reducer::reduce(Reducer::BinaryOp::SUM_OF_SQUARES, Layout::RowMajor, matRightBuf, _sqrMatRight, nMatRight, pMatRight, &status);
-        DAAL_CHECK_STATUS_VAR(status);
+        if (!isEqualMatrix)
+        {
+            Reducer::reduce(Reducer::BinaryOp::SUM_OF_SQUARES, Layout::RowMajor, matRightBuf, _sqrMatRight, nMatRight, pMatRight, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+        }
     }
+    const UniversalBuffer & sqrMatRight = isEqualMatrix ? _sqrMatLeft : _sqrMatRight;
 
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(KernelRBF.gemm);
@@ -180,7 +183,7 @@ services::Status KernelImplRBFOneAPI<defaultDense, algorithmFPType>::computeInte
     }
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nMatLeft, nMatRight);
-    DAAL_CHECK_STATUS(status, computeRBF(_sqrMatLeft, _sqrMatRight, nMatRight, coeff, rBuf, nMatLeft, nMatRight));
+    DAAL_CHECK_STATUS(status, computeRBF(_sqrMatLeft, sqrMatRight, nMatRight, coeff, rBuf, nMatLeft, nMatRight));
 
     DAAL_CHECK_STATUS(status, matLeft->releaseBlockOfRows(matLeftBlock));
     DAAL_CHECK_STATUS(status, matRight->releaseBlockOfRows(matRightBlock));
@@ -0,0 +1,67 @@
+/* file: kernel_function_polynomial.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of polynomial kernel function algorithm and types methods.
+//--
+*/
+
+#include "src/algorithms/kernel_function/polynomial/kernel_function_types_polynomial.h"
+#include "src/services/service_defines.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kernel_function
+{
+namespace polynomial
+{
+namespace internal
+{
+Parameter::Parameter(double scale, double shift, size_t degree, KernelType kernelType)
+    : ParameterBase(), scale(scale), shift(shift), degree(degree), kernelType(kernelType)
+{}
+
+Input::Input() : kernel_function::Input() {}
+Input::Input(const Input & other) : kernel_function::Input(other) {}
+
+/**
+ * Checks input objects of the polynomial kernel function algorithm
+ * \param[in] par     %Input objects of the algorithm
+ * \param[in] method  Computation method of the algorithm
+ */
+Status Input::check(const daal::algorithms::Parameter * par, int method) const
+{
+    switch (method)
+    {
+    case defaultDense: return checkDense();
+    default: DAAL_ASSERT(false); break;
+    }
+
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace polynomial
+} // namespace kernel_function
+} // namespace algorithms
+} // namespace daal
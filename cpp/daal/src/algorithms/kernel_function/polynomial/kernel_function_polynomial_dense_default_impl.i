@@ -0,0 +1,198 @@
+/* file: kernel_function_polynomial_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Polynomial kernel functions implementation
+//--
+*/
+
+#ifndef __KERNEL_FUNCTION_POLYNOMIAL_DENSE_DEFAULT_IMPL_I__
+#define __KERNEL_FUNCTION_POLYNOMIAL_DENSE_DEFAULT_IMPL_I__
+
+#include "src/algorithms/kernel_function/polynomial/kernel_function_types_polynomial.h"
+
+#include "src/externals/service_blas.h"
+#include "src/externals/service_math.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/service_error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kernel_function
+{
+namespace polynomial
+{
+namespace internal
+{
+/* Turns the scaled dot products into the values of the kernel function in place */
+template <typename algorithmFPType, CpuType cpu>
+void applyKernelFunction(algorithmFPType * values, const size_t n, const Parameter * par)
+{
+    const algorithmFPType shift = (algorithmFPType)(par->shift);
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        values[i] += shift;
+    }
+
+    if (par->kernelType == sigmoid)
+    {
+        Math<algorithmFPType, cpu>::vTanh(n, values, values);
+        return;
+    }
+
+    const size_t degree = par->degree;
+    if (degree == 1) return;
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        const algorithmFPType base = values[i];
+        algorithmFPType res        = 1.0;
+        for (size_t d = 0; d < degree; d++)
+        {
+            res *= base;
+        }
+        values[i] = res;
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status KernelImplPolynomial<defaultDense, algorithmFPType, cpu>::computeInternalVectorVector(const NumericTable * a1,
+                                                                                                       const NumericTable * a2, NumericTable * r,
+                                                                                                       const ParameterBase * par)
+{
+    //prepareData
+    const size_t nFeatures = a1->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> mtA1(*const_cast<NumericTable *>(a1), par->rowIndexX, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtA1);
+    const algorithmFPType * dataA1 = mtA1.get();
+
+    ReadRows<algorithmFPType, cpu> mtA2(*const_cast<NumericTable *>(a2), par->rowIndexY, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtA2);
+    const algorithmFPType * dataA2 = mtA2.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> mtR(r, par->rowIndexResult, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtR);
+    algorithmFPType * dataR = mtR.get();
+
+    //compute
+    const Parameter * polyPar = static_cast<const Parameter *>(par);
+    algorithmFPType dot       = 0.0;
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        dot += dataA1[i] * dataA2[i];
+    }
+    dataR[0] = dot * (algorithmFPType)(polyPar->scale);
+    applyKernelFunction<algorithmFPType, cpu>(dataR, 1, polyPar);
+
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status KernelImplPolynomial<defaultDense, algorithmFPType, cpu>::computeInternalMatrixVector(const NumericTable * a1,
+                                                                                                       const NumericTable * a2, NumericTable * r,
+                                                                                                       const ParameterBase * par)
+{
+    //prepareData
+    const size_t nVectors1 = a1->getNumberOfRows();
+    const size_t nFeatures = a1->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> mtA1(*const_cast<NumericTable *>(a1), 0, nVectors1);
+    DAAL_CHECK_BLOCK_STATUS(mtA1);
+    const algorithmFPType * dataA1 = mtA1.get();
+
+    ReadRows<algorithmFPType, cpu> mtA2(*const_cast<NumericTable *>(a2), par->rowIndexY, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtA2);
+    const algorithmFPType * dataA2 = mtA2.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> mtR(r, 0, nVectors1);
+    DAAL_CHECK_BLOCK_STATUS(mtR);
+    algorithmFPType * dataR = mtR.get();
+
+    //compute
+    const Parameter * polyPar   = static_cast<const Parameter *>(par);
+    const algorithmFPType scale = (algorithmFPType)(polyPar->scale);
+    for (size_t i = 0; i < nVectors1; i++)
+    {
+        algorithmFPType dot = 0.0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            dot += dataA1[i * nFeatures + j] * dataA2[j];
+        }
+        dataR[i] = scale * dot;
+    }
+    applyKernelFunction<algorithmFPType, cpu>(dataR, nVectors1, polyPar);
+
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status KernelImplPolynomial<defaultDense, algorithmFPType, cpu>::computeInternalMatrixMatrix(const NumericTable * a1,
+                                                                                                       const NumericTable * a2, NumericTable * r,
+                                                                                                       const ParameterBase * par)
+{
+    char trans   = 'T';
+    char notrans = 'N';
+
+    const size_t nFeatures = a1->getNumberOfColumns();
+    const size_t nVectors1 = a1->getNumberOfRows();
+    const size_t nVectors2 = a2->getNumberOfRows();
+
+    const Parameter * polyPar = static_cast<const Parameter *>(par);
+    algorithmFPType alpha     = (algorithmFPType)(polyPar->scale);
+    algorithmFPType beta      = 0.0;
+
+    const services::Status retStat =
+        Blas<algorithmFPType, cpu>::xgemm_blocked(&trans, &notrans, (DAAL_INT *)&nVectors2, (DAAL_INT *)&nVectors1, (DAAL_INT *)&nFeatures, &alpha,
+                                                  a2, (DAAL_INT *)&nFeatures, a1, (DAAL_INT *)&nFeatures, &beta, r, (DAAL_INT *)&nVectors2);
+    if (!retStat) return retStat;
+
+    WriteRows<algorithmFPType, cpu> mtR(r, 0, nVectors1);
+    DAAL_CHECK_BLOCK_STATUS(mtR);
+    algorithmFPType * dataR = mtR.get();
+
+    /* The elementwise pass is threaded by the blocks of rows of the result, tanh and
+       the powers cost much more than the shift of the linear kernel */
+    const size_t blockSize = 256;
+    const size_t nBlocks   = nVectors1 / blockSize + !!(nVectors1 % blockSize);
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (iBlock == nBlocks - 1) ? nVectors1 - startRow : blockSize;
+        applyKernelFunction<algorithmFPType, cpu>(dataR + startRow * nVectors2, nRows * nVectors2, polyPar);
+    });
+
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace polynomial
+} // namespace kernel_function
+} // namespace algorithms
+} // namespace daal
+
+#endif
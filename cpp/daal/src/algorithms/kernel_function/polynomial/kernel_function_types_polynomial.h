@@ -0,0 +1,93 @@
+/* file: kernel_function_types_polynomial.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Polynomial kernel function parameter structure
+//--
+*/
+
+#ifndef __KERNEL_FUNCTION_TYPES_POLYNOMIAL_H__
+#define __KERNEL_FUNCTION_TYPES_POLYNOMIAL_H__
+
+#include "algorithms/kernel_function/kernel_function_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kernel_function
+{
+namespace polynomial
+{
+namespace internal
+{
+/**
+ * Method of the kernel function
+ */
+enum Method
+{
+    defaultDense = 0 /*!< Default method for computing polynomial kernel functions */
+};
+
+/**
+ * Kind of the function applied to the scaled and shifted dot product
+ */
+enum KernelType
+{
+    poly    = 0, /*!< (scale * <X,Y> + shift)^degree */
+    sigmoid = 1  /*!< tanh(scale * <X,Y> + shift) */
+};
+
+/**
+ * \brief Parameters for the polynomial kernel function (scale * <X,Y> + shift)^degree
+ *        and the sigmoid kernel function tanh(scale * <X,Y> + shift)
+ */
+struct DAAL_EXPORT Parameter : public ParameterBase
+{
+    Parameter(double scale = 1.0, double shift = 0.0, size_t degree = 3, KernelType kernelType = poly);
+    double scale;          /*!< Coefficient of the dot product */
+    double shift;          /*!< Term added to the scaled dot product */
+    size_t degree;         /*!< Degree of the polynomial kernel */
+    KernelType kernelType; /*!< Kind of the kernel function */
+};
+
+/**
+ * \brief %Input objects for the polynomial kernel function algorithm
+ */
+class DAAL_EXPORT Input : public kernel_function::Input
+{
+public:
+    Input();
+    Input(const Input & other);
+
+    virtual ~Input() {}
+
+    /**
+    * Checks input objects of the polynomial kernel function algorithm
+    * \param[in] par     %Input objects of the algorithm
+    * \param[in] method  Computation method of the algorithm
+    */
+    services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+};
+
+} // namespace internal
+} // namespace polynomial
+} // namespace kernel_function
+} // namespace algorithms
+} // namespace daal
+#endif
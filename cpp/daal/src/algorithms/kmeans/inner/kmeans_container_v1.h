@@ -32,6 +32,7 @@
 #include "src/algorithms/kmeans/inner/kmeans_types_v1.h"
 #include "services/internal/sycl/execution_context.h"
 #include "src/data_management/service_numeric_table.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -99,7 +100,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     if (deviceInfo.isCpu || method != lloydDense)
     {
-        __DAAL_CALL_KERNEL(env, internal::KMeansBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, a, r, &par2);
+        __DAAL_CALL_KERNEL(env, internal::KMeansBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                           daal::services::internal::hostApp(*input), a, r, &par2);
     }
     else
     {
@@ -35,6 +35,7 @@
 #include "services/internal/sycl/execution_context.h"
 
 #include "src/data_management/service_numeric_table.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -50,7 +51,7 @@ BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Env
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    if (deviceInfo.isCpu || method != lloydDense)
     {
         __DAAL_INITIALIZE_KERNELS(internal::KMeansBatchKernel, method, algorithmFPType);
     }
@@ -85,7 +86,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     if (deviceInfo.isCpu || method != lloydDense)
     {
-        __DAAL_CALL_KERNEL(env, internal::KMeansBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, a, r, par);
+        __DAAL_CALL_KERNEL(env, internal::KMeansBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                           daal::services::internal::hostApp(*input), a, r, par);
     }
     else
     {
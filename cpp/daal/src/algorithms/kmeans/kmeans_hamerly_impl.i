@@ -0,0 +1,260 @@
+/* file: kmeans_hamerly_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions used in the Lloyd method
+//  of K-means algorithm accelerated with the bounds of Hamerly.
+//
+//  Every observation keeps the exact distance to its centroid and the lower
+//  bound of the distance to the second closest centroid. The distances to
+//  all the centroids are computed only for the observations whose distance
+//  to the own centroid exceeds both the lower bound and the half of the
+//  distance between the own centroid and the closest other centroid.
+//--
+*/
+
+#include "src/externals/service_math.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+inline algorithmFPType kmeansSquaredDistance(const algorithmFPType * x, const algorithmFPType * y, const size_t p)
+{
+    algorithmFPType sum = algorithmFPType(0);
+    PRAGMA_IVDEP
+    PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+    for (size_t j = 0; j < p; j++)
+    {
+        const algorithmFPType diff = x[j] - y[j];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+struct HamerlyBounds
+{
+    typedef Math<algorithmFPType, cpu> MathT;
+
+    Status init(const size_t nRows, const size_t dim, const size_t clNum, const algorithmFPType * const centroids)
+    {
+        n     = nRows;
+        p     = dim;
+        k     = clNum;
+        lower.reset(n);
+        assignments.reset(n);
+        halfDistances.reset(k);
+        prevCentroids.reset(k * p);
+        DAAL_CHECK_MALLOC(lower.get() && assignments.get() && halfDistances.get() && prevCentroids.get());
+
+        /* Zero lower bounds force the distances to all the centroids on the first iteration */
+        service_memset<algorithmFPType, cpu>(lower.get(), algorithmFPType(0), n);
+        service_memset<int, cpu>(assignments.get(), 0, n);
+        computeHalfDistances(centroids);
+        return Status();
+    }
+
+    /* Computes the half of the distance from every centroid to the closest other centroid */
+    void computeHalfDistances(const algorithmFPType * const centroids)
+    {
+        const size_t nClusters    = k;
+        const size_t dim          = p;
+        algorithmFPType * const s = halfDistances.get();
+        daal::threader_for(nClusters, nClusters, [=](const size_t i) {
+            algorithmFPType minDist = services::internal::MaxVal<algorithmFPType>::get();
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                if (j != i)
+                {
+                    const algorithmFPType dist = kmeansSquaredDistance<algorithmFPType, cpu>(&centroids[i * dim], &centroids[j * dim], dim);
+                    minDist                    = (dist < minDist) ? dist : minDist;
+                }
+            }
+            s[i] = (nClusters > 1) ? algorithmFPType(0.5) * MathT::sSqrt(minDist) : minDist;
+        });
+    }
+
+    void saveCentroids(const algorithmFPType * const centroids)
+    {
+        daal::services::internal::daal_memcpy_s(prevCentroids.get(), k * p * sizeof(algorithmFPType), centroids, k * p * sizeof(algorithmFPType));
+    }
+
+    /* Moves the lower bounds by the largest shift of the other centroids and recomputes the half distances */
+    Status update(const algorithmFPType * const centroids, const size_t blockSizeDefault)
+    {
+        TArray<algorithmFPType, cpu> shifts(k);
+        DAAL_CHECK_MALLOC(shifts.get());
+
+        algorithmFPType maxShift    = algorithmFPType(0);
+        algorithmFPType secondShift = algorithmFPType(0);
+        size_t maxShiftIdx          = 0;
+        for (size_t i = 0; i < k; i++)
+        {
+            shifts[i] = MathT::sSqrt(kmeansSquaredDistance<algorithmFPType, cpu>(&prevCentroids[i * p], &centroids[i * p], p));
+            if (shifts[i] > maxShift)
+            {
+                secondShift = maxShift;
+                maxShift    = shifts[i];
+                maxShiftIdx = i;
+            }
+            else if (shifts[i] > secondShift)
+            {
+                secondShift = shifts[i];
+            }
+        }
+
+        const size_t nBlocks    = n / blockSizeDefault + !!(n % blockSizeDefault);
+        const size_t nRows      = n;
+        algorithmFPType * l     = lower.get();
+        const int * const assig = assignments.get();
+        daal::threader_for(nBlocks, nBlocks, [=](const size_t iBlock) {
+            const size_t end = (iBlock + 1 == nBlocks) ? nRows : (iBlock + 1) * blockSizeDefault;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = iBlock * blockSizeDefault; i < end; i++)
+            {
+                l[i] -= ((size_t)assig[i] == maxShiftIdx) ? secondShift : maxShift;
+            }
+        });
+
+        computeHalfDistances(centroids);
+        return Status();
+    }
+
+    size_t n = 0;
+    size_t p = 0;
+    size_t k = 0;
+    TArray<algorithmFPType, cpu> lower;
+    TArray<int, cpu> assignments;
+    TArray<algorithmFPType, cpu> halfDistances;
+    TArray<algorithmFPType, cpu> prevCentroids;
+};
+
+/* Assigns the observations to the centroids of the task and accumulates the partial sums
+   in the TLS of the task in the same way as TaskKMeansLloyd::addNTToTaskThreadedDense does */
+template <typename algorithmFPType, CpuType cpu>
+Status addNTToTaskThreadedHamerly(TaskKMeansLloyd<algorithmFPType, cpu> & task, const NumericTable * const ntData, const size_t blockSizeDefault,
+                                  HamerlyBounds<algorithmFPType, cpu> & bounds, NumericTable * ntAssign = nullptr)
+{
+    typedef Math<algorithmFPType, cpu> MathT;
+
+    const size_t n = ntData->getNumberOfRows();
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    const size_t p                          = task.dim;
+    const size_t nClusters                  = task.clNum;
+    const algorithmFPType * const centroids = task.cCenters;
+    const algorithmFPType * const s         = bounds.halfDistances.get();
+    algorithmFPType * const lower           = bounds.lower.get();
+    int * const assig                       = bounds.assignments.get();
+
+    SafeStatus safeStat;
+    task.tls_task->for_blocks(nBlocks, [&](const int k, TlsTask<algorithmFPType, cpu> * tt) {
+        DAAL_CHECK_MALLOC_THR(tt);
+        const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), k * blockSizeDefault, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType * const data = mtData.get();
+
+        int * assignments = nullptr;
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, k * blockSizeDefault, blockSize);
+        if (ntAssign)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+            assignments = assignBlock.get();
+        }
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+
+        algorithmFPType goal = algorithmFPType(0);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t iRow            = k * blockSizeDefault + i;
+            const algorithmFPType * xRow = &data[i * p];
+
+            const size_t ownIdx        = assig[iRow];
+            size_t minIdx              = ownIdx;
+            algorithmFPType minGoalVal = kmeansSquaredDistance<algorithmFPType, cpu>(xRow, &centroids[minIdx * p], p);
+
+            const algorithmFPType bound = (s[minIdx] > lower[iRow]) ? s[minIdx] : lower[iRow];
+            if (MathT::sSqrt(minGoalVal) > bound)
+            {
+                /* The bounds do not guarantee the centroid is the closest one */
+                algorithmFPType secondGoalVal = services::internal::MaxVal<algorithmFPType>::get();
+                for (size_t j = 0; j < nClusters; j++)
+                {
+                    if (j == ownIdx)
+                    {
+                        continue;
+                    }
+                    const algorithmFPType localGoalVal = kmeansSquaredDistance<algorithmFPType, cpu>(xRow, &centroids[j * p], p);
+                    if (localGoalVal < minGoalVal || (localGoalVal == minGoalVal && j < minIdx))
+                    {
+                        secondGoalVal = minGoalVal;
+                        minGoalVal    = localGoalVal;
+                        minIdx        = j;
+                    }
+                    else if (localGoalVal < secondGoalVal)
+                    {
+                        secondGoalVal = localGoalVal;
+                    }
+                }
+                lower[iRow] = MathT::sSqrt(secondGoalVal);
+                assig[iRow] = (int)minIdx;
+            }
+
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[minIdx * p + j] += xRow[j];
+            }
+
+            task.kmeansInsertCandidate(tt, minGoalVal, iRow);
+            cS0[minIdx]++;
+
+            goal += minGoalVal;
+
+            if (ntAssign)
+            {
+                assignments[i] = (int)minIdx;
+            }
+        }
+
+        tt->goalFunc += goal;
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
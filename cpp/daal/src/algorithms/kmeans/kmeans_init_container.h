@@ -47,7 +47,7 @@ BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Env
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu || (method != deterministicDense && method != randomDense))
+    if (deviceInfo.isCpu || (method != deterministicDense && method != randomDense && method != plusPlusDense && method != parallelPlusDense))
     {
         __DAAL_INITIALIZE_KERNELS(internal::KMeansInitKernel, method, algorithmFPType);
     }
@@ -84,7 +84,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     daal::services::Environment::env & env = *_env;
 
-    if (deviceInfo.isCpu || (method != deterministicDense && method != randomDense))
+    if (deviceInfo.isCpu || (method != deterministicDense && method != randomDense && method != plusPlusDense && method != parallelPlusDense))
     {
         __DAAL_CALL_KERNEL(env, internal::KMeansInitKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, na, a, nr, r, par,
                            *par->engine);
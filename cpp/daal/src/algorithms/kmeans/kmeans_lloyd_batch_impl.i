@@ -28,8 +28,11 @@
 #include "src/externals/service_memory.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/services/service_defines.h"
+#include "src/services/service_algo_utils.h"
 
 #include "src/algorithms/kmeans/kmeans_lloyd_impl.i"
+#include "src/algorithms/kmeans/kmeans_hamerly_impl.i"
+#include "src/algorithms/kmeans/kmeans_reduced_precision_impl.i"
 #include "src/algorithms/kmeans/kmeans_lloyd_postprocessing.h"
 
 #include "src/externals/service_ittnotify.h"
@@ -48,7 +51,8 @@ namespace kmeans
 namespace internal
 {
 template <Method method, typename algorithmFPType, CpuType cpu>
-Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par)
+Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(services::HostAppIface * pHost, const NumericTable * const * a,
+                                                               const NumericTable * const * r, const Parameter * par)
 {
     Status s;
     NumericTable * ntData  = const_cast<NumericTable *>(a[0]);
@@ -124,8 +128,9 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
 
-    TArray<double, cpu> dS1(method == defaultDense ? p : 0);
-    if (method == defaultDense)
+    const bool isDoubleReduction = (method == defaultDense || method == hamerlyDense);
+    TArray<double, cpu> dS1(isDoubleReduction ? p : 0);
+    if (isDoubleReduction)
     {
         DAAL_CHECK(dS1.get(), services::ErrorMemoryAllocationFailed);
     }
@@ -140,18 +145,49 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
     size_t blockSize = 0;
     DAAL_SAFE_CPU_CALL((blockSize = BSHelper<method, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (blockSize = 512))
+    /* the block size tuned on the CPU model replaces the heuristic one, the tuning run measures the whole computation */
+    TunedBlockSize<algorithmFPType, cpu> tunedBlockSize(getTunedBlockSizeName(method), blockSize, minTunedBlockSize, maxTunedBlockSize, n, p,
+                                                        nClusters);
+    blockSize = tunedBlockSize.get();
+
+    HamerlyBounds<algorithmFPType, cpu> bounds;
+    if (method == hamerlyDense && nIter != 0)
+    {
+        DAAL_CHECK_STATUS(s, bounds.init(n, p, nClusters, inClusters));
+    }
+
+    /* The cross products in single precision are faster for the data in double precision only, the ones in bfloat16 are
+       faster for both precisions on the CPUs with the bfloat16 dot products */
+    const bool isBf16 =
+        (method == lloydDense && par->distancePrecision == bfloat16Precision && cpu == daal::avx512 && bf16_gemm::isAvailable());
+    const bool isReducedPrecision =
+        isBf16
+        || (method == lloydDense && par->distancePrecision != fullPrecision && sizeof(algorithmFPType) > sizeof(float));
 
     size_t kIter;
+    services::Status cancelStatus;
 
     for (kIter = 0; kIter < nIter; kIter++)
     {
-        auto task = TaskKMeansLloyd<algorithmFPType, cpu>::create(p, nClusters, inClusters, blockSize);
+        /* The bounded assignment computes the distances directly and does not need the buffer for the GEMM results */
+        auto task = TaskKMeansLloyd<algorithmFPType, cpu>::create(p, nClusters, inClusters, method == hamerlyDense ? 1 : blockSize);
         DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
             /* For the last iteration we do not need to recount of assignmets */
-            s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize,
-                                                           assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr);
+            NumericTable * const lastAssignments = assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr;
+            if (method == hamerlyDense)
+            {
+                s = addNTToTaskThreadedHamerly<algorithmFPType, cpu>(*task, ntData, blockSize, bounds, lastAssignments);
+            }
+            else if (isReducedPrecision)
+            {
+                s = addNTToTaskThreadedReducedPrecision<algorithmFPType, cpu>(*task, ntData, blockSize, lastAssignments, isBf16);
+            }
+            else
+            {
+                s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize, lastAssignments);
+            }
         }
 
         if (!s)
@@ -171,6 +207,11 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
         algorithmFPType newCentersGoalFunc = (algorithmFPType)0.0;
 
+        if (method == hamerlyDense)
+        {
+            bounds.saveCentroids(inClusters);
+        }
+
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(kmeansMergeReduceCentroids);
 
@@ -200,6 +241,12 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
             }
         }
 
+        if (method == hamerlyDense && kIter + 1 < nIter)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(kmeansUpdateBounds);
+            DAAL_CHECK_STATUS(s, bounds.update(clusters, blockSize));
+        }
+
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(kmeansUpdateObjectiveFunction);
             if (par->accuracyThreshold > (algorithmFPType)0.0)
@@ -224,6 +271,13 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
             }
         }
         inClusters = clusters;
+
+        /* The centroids of the finished iterations are the result of the cancelled training */
+        if (services::internal::isCancelled(cancelStatus, pHost))
+        {
+            kIter++;
+            break;
+        }
     }
 
     if (!nIter)
@@ -234,7 +288,16 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     if ((kIter != nIter || nIter == 0)
         && (par->resultsToEvaluate & computeAssignments || par->assignFlag || par->resultsToEvaluate & computeExactObjectiveFunction))
     {
-        PostProcessing<method, algorithmFPType, cpu>::computeAssignments(p, nClusters, clusters, ntData, catCoef.get(), assignmetsNT, blockSize);
+        if (isReducedPrecision)
+        {
+            DAAL_CHECK_STATUS(
+                s, (computeAssignmentsReducedPrecision<algorithmFPType, cpu>(p, nClusters, clusters, ntData, assignmetsNT, blockSize, isBf16)));
+        }
+        else
+        {
+            PostProcessing<method, algorithmFPType, cpu>::computeAssignments(p, nClusters, clusters, ntData, catCoef.get(), assignmetsNT,
+                                                                             blockSize);
+        }
     }
 
     WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[2]), 0, 1);
@@ -255,6 +318,7 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[3]), 0, 1);
     DAAL_CHECK_BLOCK_STATUS(mtIterations);
     *mtIterations.get() = kIter;
+    s |= cancelStatus;
     return (!result) ? s : services::Status(services::ErrorMemoryCopyFailedInternal);
 }
 
@@ -56,6 +56,10 @@ Status KMeansDistributedStep1Kernel<method, algorithmFPType, cpu>::compute(size_
     int result             = 0;
     size_t blockSize       = 0;
     DAAL_SAFE_CPU_CALL((blockSize = BSHelper<method, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (blockSize = 512))
+    /* the block size tuned on the CPU model replaces the heuristic one, the tuning run measures the whole computation */
+    TunedBlockSize<algorithmFPType, cpu> tunedBlockSize(getTunedBlockSizeName(method), blockSize, minTunedBlockSize, maxTunedBlockSize, n, p,
+                                                        nClusters);
+    blockSize = tunedBlockSize.get();
 
     ReadRows<algorithmFPType, cpu> mtInitClusters(*const_cast<NumericTable *>(a[1]), 0, nClusters);
     DAAL_CHECK_BLOCK_STATUS(mtInitClusters);
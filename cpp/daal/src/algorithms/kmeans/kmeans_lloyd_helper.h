@@ -35,6 +35,7 @@
 #include "src/externals/service_spblas.h"
 #include "src/services/service_data_utils.h"
 #include "src/services/service_environment.h"
+#include "src/services/service_tuning.h"
 
 namespace daal
 {
@@ -55,34 +56,34 @@ struct TlsTask
 
     TlsTask(int dim, int clNum, int maxBlockSize)
     {
-        mklBuff  = service_scalable_calloc<algorithmFPType, cpu>(maxBlockSize * clNum);
-        cS1      = service_scalable_calloc<algorithmFPType, cpu>(clNum * dim);
-        cS0      = service_scalable_calloc<int, cpu>(clNum);
-        cValues  = service_scalable_calloc<algorithmFPType, cpu>(clNum);
-        cIndices = service_scalable_calloc<size_t, cpu>(clNum);
+        mklBuff  = service_scratch_calloc<algorithmFPType, cpu>(maxBlockSize * clNum);
+        cS1      = service_scratch_calloc<algorithmFPType, cpu>(clNum * dim);
+        cS0      = service_scratch_calloc<int, cpu>(clNum);
+        cValues  = service_scratch_calloc<algorithmFPType, cpu>(clNum);
+        cIndices = service_scratch_calloc<size_t, cpu>(clNum);
     }
 
     ~TlsTask()
     {
         if (mklBuff)
         {
-            service_scalable_free<algorithmFPType, cpu>(mklBuff);
+            service_scratch_free<algorithmFPType, cpu>(mklBuff);
         }
         if (cS1)
         {
-            service_scalable_free<algorithmFPType, cpu>(cS1);
+            service_scratch_free<algorithmFPType, cpu>(cS1);
         }
         if (cS0)
         {
-            service_scalable_free<int, cpu>(cS0);
+            service_scratch_free<int, cpu>(cS0);
         }
         if (cValues)
         {
-            service_scalable_free<algorithmFPType, cpu>(cValues);
+            service_scratch_free<algorithmFPType, cpu>(cValues);
         }
         if (cIndices)
         {
-            service_scalable_free<size_t, cpu>(cIndices);
+            service_scratch_free<size_t, cpu>(cIndices);
         }
     }
 
@@ -151,6 +152,25 @@ struct BSHelper<lloydCSR, algorithmFPType, cpu>
     static size_t kmeansGetBlockSize(const size_t nRows, const size_t dim, const size_t clNum) { return 512; }
 };
 
+template <typename algorithmFPType, CpuType cpu>
+struct BSHelper<hamerlyDense, algorithmFPType, cpu> : public BSHelper<lloydDense, algorithmFPType, cpu>
+{};
+
+/* The bounds of the block sizes tried by the tuning run */
+const size_t minTunedBlockSize = 8;
+const size_t maxTunedBlockSize = 4096;
+
+/* Returns the name of the block size of the method in the tuning profile */
+inline const char * getTunedBlockSizeName(const Method method)
+{
+    switch (method)
+    {
+    case lloydCSR: return "kmeans::lloydCSR";
+    case hamerlyDense: return "kmeans::hamerlyDense";
+    default: return "kmeans::lloydDense";
+    }
+}
+
 template <typename algorithmFPType>
 struct Fp2IntSize
 {};
@@ -57,10 +57,12 @@ struct TaskKMeansLloyd
         clNum    = _clNum;
         cCenters = _centroids;
 
-        /* Allocate memory for all arrays inside TLS */
-        tls_task = new daal::tls<TlsTask<algorithmFPType, cpu> *>([=]() -> TlsTask<algorithmFPType, cpu> * {
-            return TlsTask<algorithmFPType, cpu>::create(dim, clNum, max_block_size);
-        }); /* Allocate memory for all arrays inside TLS: end */
+        /* Allocate memory for all arrays inside TLS, the partial sums of the clusters are computed by the fixed chunks
+           of the blocks and merged in their order in the deterministic mode */
+        const size_t taskSize = (max_block_size * clNum + clNum * dim + 3 * clNum) * sizeof(algorithmFPType);
+        tls_task              = new daal::blocked_tls<TlsTask<algorithmFPType, cpu> *>(
+            [=]() -> TlsTask<algorithmFPType, cpu> * { return TlsTask<algorithmFPType, cpu>::create(dim, clNum, max_block_size); },
+            __daal_serv_is_deterministic(), daal::ordered_tls_chunk_count(taskSize)); /* Allocate memory for all arrays inside TLS: end */
 
         clSq = service_scalable_calloc<algorithmFPType, cpu>(clNum);
         if (clSq)
@@ -124,7 +126,7 @@ struct TaskKMeansLloyd
 
     void kmeansClearClusters(algorithmFPType * goalFunc);
 
-    daal::tls<TlsTask<algorithmFPType, cpu> *> * tls_task;
+    daal::blocked_tls<TlsTask<algorithmFPType, cpu> *> * tls_task;
     algorithmFPType * clSq;
     algorithmFPType * cCenters;
 
@@ -144,8 +146,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const Num
     nBlocks += (nBlocks * blockSizeDefault != n);
 
     SafeStatus safeStat;
-    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int k) {
-        struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local();
+    tls_task->for_blocks(nBlocks, [=, &safeStat](const int k, TlsTask<algorithmFPType, cpu> * tt) {
         DAAL_CHECK_MALLOC_THR(tt);
         const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
 
@@ -259,8 +260,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
     nBlocks += (nBlocks * blockSizeDefault != n);
 
     SafeStatus safeStat;
-    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int k) {
-        struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local();
+    tls_task->for_blocks(nBlocks, [=, &safeStat](const int k, TlsTask<algorithmFPType, cpu> * tt) {
         DAAL_CHECK_MALLOC_THR(tt);
 
         const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
@@ -385,7 +385,7 @@ template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 void TaskKMeansLloyd<algorithmFPType, cpu>::kmeansComputeCentroids(int * clusterS0, algorithmFPType * clusterS1, double * auxData)
 {
-    if (method == defaultDense && auxData)
+    if ((method == defaultDense || method == hamerlyDense) && auxData)
     {
         for (size_t i = 0; i < clNum; i++)
         {
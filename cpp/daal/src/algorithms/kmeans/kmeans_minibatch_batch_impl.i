@@ -0,0 +1,233 @@
+/* file: kmeans_minibatch_batch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of mini-batch method for K-means algorithm.
+//--
+*/
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "src/threading/threading.h"
+#include "services/daal_defines.h"
+#include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_defines.h"
+
+#include "src/algorithms/kmeans/kmeans_lloyd_impl.i"
+#include "src/algorithms/kmeans/kmeans_lloyd_postprocessing.h"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(kmeans.dense.minibatch.batch);
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+Status KMeansMiniBatchKernel<algorithmFPType, cpu>::compute(const NumericTable * const * a, const NumericTable * const * r,
+                                                            const MiniBatchParameter * par)
+{
+    Status s;
+    NumericTable * ntData  = const_cast<NumericTable *>(a[0]);
+    const size_t nIter     = par->maxIterations;
+    const size_t n         = ntData->getNumberOfRows();
+    const size_t p         = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    const size_t batchSize = (par->batchSize < n) ? par->batchSize : n;
+    DAAL_CHECK(batchSize > 0, services::ErrorIncorrectParameter);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(int));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+
+    TArray<int, cpu> clusterS0(nClusters);
+    TArray<algorithmFPType, cpu> clusterS1(nClusters * p);
+    TArray<double, cpu> dS1(p);
+    TArray<algorithmFPType, cpu> cValues(nClusters);
+    TArray<size_t, cpu> cIndices(nClusters);
+    TArray<algorithmFPType, cpu> counts(nClusters);
+    DAAL_CHECK(clusterS0.get() && clusterS1.get() && dS1.get() && cValues.get() && cIndices.get() && counts.get(),
+               services::ErrorMemoryAllocationFailed);
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    algorithmFPType * clusters = mtClusters.get();
+    {
+        ReadRows<algorithmFPType, cpu> mtInClusters(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+        DAAL_CHECK_BLOCK_STATUS(mtInClusters);
+        int result = daal::services::internal::daal_memcpy_s(clusters, nClusters * p * sizeof(algorithmFPType), mtInClusters.get(),
+                                                             nClusters * p * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    }
+
+    if (a[2])
+    {
+        ReadRows<algorithmFPType, cpu> mtInCounts(*const_cast<NumericTable *>(a[2]), 0, nClusters);
+        DAAL_CHECK_BLOCK_STATUS(mtInCounts);
+        const algorithmFPType * inCounts = mtInCounts.get();
+        for (size_t i = 0; i < nClusters; i++)
+        {
+            counts[i] = inCounts[i];
+        }
+    }
+    else
+    {
+        service_memset_seq<algorithmFPType, cpu>(counts.get(), algorithmFPType(0), nClusters);
+    }
+
+    size_t blockSize = 0;
+    DAAL_SAFE_CPU_CALL((blockSize = BSHelper<lloydDense, algorithmFPType, cpu>::kmeansGetBlockSize(batchSize, p, nClusters)), (blockSize = 512))
+
+    size_t batchStart = 0;
+    size_t kIter;
+    for (kIter = 0; kIter < nIter; kIter++)
+    {
+        const size_t batchRows = (batchSize < n - batchStart) ? batchSize : n - batchStart;
+
+        ReadRows<algorithmFPType, cpu> mtBatch(ntData, batchStart, batchRows);
+        DAAL_CHECK_BLOCK_STATUS(mtBatch);
+        const algorithmFPType * batch = mtBatch.get();
+        NumericTablePtr ntBatch       = HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType *>(batch), p, batchRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        auto task = TaskKMeansLloyd<algorithmFPType, cpu>::create(p, nClusters, clusters, blockSize);
+        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
+            DAAL_CHECK_STATUS(s, task->template addNTToTaskThreaded<lloydDense>(ntBatch.get(), nullptr, blockSize));
+        }
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(kmeansPartialReduceCentroids);
+            task->template kmeansComputeCentroids<lloydDense>(clusterS0.get(), clusterS1.get(), dS1.get());
+        }
+
+        size_t cNum;
+        DAAL_CHECK_STATUS(s, task->kmeansComputeCentroidsCandidates(cValues.get(), cIndices.get(), cNum));
+        task->kmeansClearClusters(nullptr);
+
+        algorithmFPType maxCount = algorithmFPType(0);
+        for (size_t i = 0; i < nClusters; i++)
+        {
+            maxCount = (counts[i] > maxCount) ? counts[i] : maxCount;
+        }
+        const algorithmFPType reassignmentBound = par->reassignmentRatio * maxCount;
+
+        algorithmFPType shift = algorithmFPType(0);
+        size_t cPos           = 0;
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(kmeansUpdateCentroids);
+            for (size_t i = 0; i < nClusters; i++)
+            {
+                algorithmFPType * centroid = &clusters[i * p];
+                if (clusterS0[i] > 0)
+                {
+                    counts[i] += clusterS0[i];
+                    const algorithmFPType rate =
+                        (par->learningSchedule == inverseCount) ? clusterS0[i] / counts[i] : (algorithmFPType)par->learningRate;
+                    const algorithmFPType coeff = 1.0 / clusterS0[i];
+
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        const algorithmFPType delta = rate * (clusterS1[i * p + j] * coeff - centroid[j]);
+                        centroid[j] += delta;
+                        shift += delta * delta;
+                    }
+                }
+                else if (counts[i] <= reassignmentBound && cPos < cNum)
+                {
+                    /* Move the centroid to the observation of the batch which is the farthest from its centroid */
+                    const algorithmFPType * row = &batch[cIndices[cPos] * p];
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        const algorithmFPType delta = row[j] - centroid[j];
+                        centroid[j]                 = row[j];
+                        shift += delta * delta;
+                    }
+                    cPos++;
+                }
+            }
+        }
+
+        batchStart += batchRows;
+        if (batchStart == n)
+        {
+            batchStart = 0;
+        }
+
+        if (par->accuracyThreshold > 0.0 && shift < par->accuracyThreshold)
+        {
+            kIter++;
+            break;
+        }
+    }
+
+    NumericTable * assignmetsNT = const_cast<NumericTable *>(r[1]);
+    NumericTablePtr assignmentsPtr;
+    if (!assignmetsNT)
+    {
+        assignmentsPtr = HomogenNumericTableCPU<int, cpu>::create(1, n, &s);
+        DAAL_CHECK_MALLOC(s);
+        assignmetsNT = assignmentsPtr.get();
+    }
+
+    size_t fullBlockSize = 0;
+    DAAL_SAFE_CPU_CALL((fullBlockSize = BSHelper<lloydDense, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (fullBlockSize = 512))
+
+    DAAL_CHECK_STATUS(s, (PostProcessing<lloydDense, algorithmFPType, cpu>::computeAssignments(p, nClusters, clusters, ntData, nullptr, assignmetsNT,
+                                                                                                 fullBlockSize)));
+
+    WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+    algorithmFPType exactTargetFunc = algorithmFPType(0);
+    DAAL_CHECK_STATUS(s, (PostProcessing<lloydDense, algorithmFPType, cpu>::computeExactObjectiveFunction(
+                             p, nClusters, clusters, ntData, nullptr, assignmetsNT, exactTargetFunc, fullBlockSize)));
+    *mtTarget.get() = exactTargetFunc;
+
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[3]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+    *mtIterations.get() = kIter;
+
+    if (r[4])
+    {
+        WriteOnlyRows<algorithmFPType, cpu> mtCounts(*const_cast<NumericTable *>(r[4]), 0, nClusters);
+        DAAL_CHECK_BLOCK_STATUS(mtCounts);
+        algorithmFPType * outCounts = mtCounts.get();
+        for (size_t i = 0; i < nClusters; i++)
+        {
+            outCounts[i] = counts[i];
+        }
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
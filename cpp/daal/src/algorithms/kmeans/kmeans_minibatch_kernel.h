@@ -0,0 +1,83 @@
+/* file: kmeans_minibatch_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes mini-batch K-means.
+//--
+*/
+
+#ifndef _KMEANS_MINIBATCH_KERNEL_H
+#define _KMEANS_MINIBATCH_KERNEL_H
+
+#include "algorithms/kmeans/kmeans_types.h"
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+/* Rate of the move of the centroid towards the mean of its observations in the mini-batch */
+enum LearningRateSchedule
+{
+    inverseCount = 0, /* The number of the observations in the batch divided by the total number of the observations of the centroid */
+    constantRate = 1  /* Constant learningRate */
+};
+
+struct MiniBatchParameter : public Parameter
+{
+    MiniBatchParameter(size_t _nClusters, size_t _maxIterations) : Parameter(_nClusters, _maxIterations) {}
+
+    size_t batchSize                      = 1024;         /* Number of the consecutive observations in the mini-batch */
+    LearningRateSchedule learningSchedule = inverseCount; /* Learning rate schedule */
+    double learningRate                   = 0.1;          /* Learning rate of the constantRate schedule */
+    double reassignmentRatio              = 0.01;         /* The centroid without the observations in the mini-batch is moved
+                                                             to the farthest observation of the mini-batch if its total number
+                                                             of observations does not exceed this ratio of the largest one */
+};
+
+/*
+ *  Mini-batch K-means. Every iteration assigns the next mini-batch of consecutive rows of the data
+ *  to the centroids, wrapping around at the end of the data, and moves the centroids towards the
+ *  means of their observations.
+ *
+ *  Inputs:  data, initial centroids, optional k x 1 table of the numbers of the observations
+ *           already accumulated in the initial centroids.
+ *  Results: centroids, assignments (optional), objective function, number of iterations,
+ *           k x 1 table of the numbers of the observations accumulated in the centroids (optional).
+ */
+template <typename algorithmFPType, CpuType cpu>
+class KMeansMiniBatchKernel : public Kernel
+{
+public:
+    services::Status compute(const NumericTable * const * a, const NumericTable * const * r, const MiniBatchParameter * par);
+};
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -47,6 +47,7 @@ Parameter::Parameter(size_t _nClusters, size_t _maxIterations)
       accuracyThreshold(0.0),
       gamma(1.0),
       distanceType(euclidean),
+      distancePrecision(fullPrecision),
       resultsToEvaluate(computeCentroids | computeAssignments | computeExactObjectiveFunction),
       assignFlag(false)
 {}
@@ -61,6 +62,7 @@ Parameter::Parameter(const Parameter & other)
       accuracyThreshold(other.accuracyThreshold),
       gamma(other.gamma),
       distanceType(other.distanceType),
+      distancePrecision(other.distancePrecision),
       resultsToEvaluate(other.resultsToEvaluate),
       assignFlag(other.assignFlag)
 {}
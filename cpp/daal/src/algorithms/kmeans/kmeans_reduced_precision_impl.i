@@ -0,0 +1,372 @@
+/* file: kmeans_reduced_precision_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the assignment of the observations to the centroids
+//  used in the Lloyd method of K-means algorithm with the cross products
+//  computed in single precision.
+//
+//  The rounding error of the single precision value 0.5 * ||c||^2 - <x, c>
+//  does not exceed (p + 2) * u * (0.5 * ||x||^2 + ||c||^2), where u is the
+//  unit roundoff of single precision. The observation is assigned to the
+//  closest centroid in single precision if the gap to the second closest one
+//  exceeds twice the bound, otherwise the distances to all the centroids are
+//  recomputed in the precision of the data. The assignments are therefore the
+//  same as the full precision ones, and the objective function is computed
+//  in the precision of the data for the chosen centroids.
+//
+//  The cross products in bfloat16 round both operands with the unit roundoff
+//  u_b = 2^-8, so their bound is (3 * u_b + (p + 4) * u) times the same sum
+//  of the norms plus the values flushed to zero by the instructions.
+//--
+*/
+
+#include "src/externals/service_blas.h"
+#include "src/algorithms/service_threading.h"
+#include "src/algorithms/service_bf16_gemm.h"
+#include "src/services/service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+struct ReducedPrecisionCentroids
+{
+    /* halfNormsSq are the halves of the squared norms of the centroids in the precision of the data, the cross products
+       are computed in bfloat16 if isBf16 */
+    Status init(const size_t dim, const size_t clNum, const algorithmFPType * const centroids, const algorithmFPType * const halfNormsSq,
+                const bool isBf16 = false)
+    {
+        p       = dim;
+        k       = clNum;
+        useBf16 = isBf16;
+        halfNormsSqF.reset(k);
+        DAAL_CHECK_MALLOC(halfNormsSqF.get());
+        if (useBf16)
+        {
+            centroidsB.reset(bf16_gemm::paddedRows(k) * bf16_gemm::paddedCols(p));
+            DAAL_CHECK_MALLOC(centroidsB.get());
+            bf16_gemm::packRight<algorithmFPType>(centroids, k, p, centroidsB.get());
+        }
+        else
+        {
+            centroidsF.reset(k * p);
+            DAAL_CHECK_MALLOC(centroidsF.get());
+        }
+
+        maxNormSq = algorithmFPType(0);
+        for (size_t j = 0; j < k; j++)
+        {
+            if (!useBf16)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < p; i++)
+                {
+                    centroidsF[j * p + i] = static_cast<float>(centroids[j * p + i]);
+                }
+            }
+            halfNormsSqF[j] = static_cast<float>(halfNormsSq[j]);
+            maxNormSq       = (2 * halfNormsSq[j] > maxNormSq) ? 2 * halfNormsSq[j] : maxNormSq;
+        }
+        errorFactor = algorithmFPType(p + 4) * services::internal::EpsilonVal<float>::get();
+        errorAbs    = algorithmFPType(0);
+        if (useBf16)
+        {
+            /* the flushed values of the data and the products are below the smallest normal float */
+            errorFactor += algorithmFPType(3) / algorithmFPType(256);
+            errorAbs = algorithmFPType(2 * p + 2) * services::internal::MinVal<float>::get() * (algorithmFPType(1) + maxNormSq);
+        }
+        return Status();
+    }
+
+    /* The size of the scratch buffer of assignBlock() */
+    size_t bufferSize(const size_t blockSize) const
+    {
+        if (!useBf16)
+        {
+            return blockSize * (p + k);
+        }
+        const size_t nRows = bf16_gemm::paddedRows(blockSize);
+        return nRows * bf16_gemm::paddedRows(k) + (nRows * bf16_gemm::paddedCols(p) + 1) / 2;
+    }
+
+    /* Assigns the rows of the block to the closest centroids and returns 0.5 * ||c||^2 - <x, c> of the chosen
+       centroids in the precision of the data */
+    void assignBlock(const algorithmFPType * const data, const size_t blockSize, const algorithmFPType * const centroids,
+                     const algorithmFPType * const halfNormsSq, float * const buffer, size_t * const minIdx, algorithmFPType * const minGoalVal) const
+    {
+        size_t ldDots = k;
+        float * dotsF = buffer;
+        if (useBf16)
+        {
+            ldDots                 = bf16_gemm::paddedRows(k);
+            uint16_t * const dataB = reinterpret_cast<uint16_t *>(buffer + bf16_gemm::paddedRows(blockSize) * ldDots);
+            bf16_gemm::packLeft<algorithmFPType>(data, blockSize, p, dataB);
+            bf16_gemm::compute(dataB, blockSize, centroidsB.get(), k, p, dotsF);
+        }
+        else
+        {
+            float * const dataF = buffer;
+            dotsF               = buffer + blockSize * p;
+
+            for (size_t i = 0; i < blockSize * p; i++)
+            {
+                dataF[i] = static_cast<float>(data[i]);
+            }
+
+            char transa    = 't';
+            char transb    = 'n';
+            DAAL_INT _m    = k;
+            DAAL_INT _n    = blockSize;
+            DAAL_INT _k    = p;
+            float alpha    = 1.0f;
+            DAAL_INT lda   = p;
+            DAAL_INT ldy   = p;
+            float beta     = 0.0f;
+            DAAL_INT ldaty = k;
+
+            Blas<float, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, centroidsF.get(), &lda, dataF, &ldy, &beta, dotsF, &ldaty);
+        }
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const float * const dots = dotsF + i * ldDots;
+
+            float firstVal  = halfNormsSqF[0] - dots[0];
+            float secondVal = services::internal::MaxVal<float>::get();
+            size_t firstIdx = 0;
+            for (size_t j = 1; j < k; j++)
+            {
+                const float val = halfNormsSqF[j] - dots[j];
+                if (val < firstVal)
+                {
+                    secondVal = firstVal;
+                    firstVal  = val;
+                    firstIdx  = j;
+                }
+                else if (val < secondVal)
+                {
+                    secondVal = val;
+                }
+            }
+
+            const algorithmFPType * const x = data + i * p;
+
+            algorithmFPType normSq = algorithmFPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_ICC_NO16(omp simd reduction(+ : normSq))
+            for (size_t l = 0; l < p; l++)
+            {
+                normSq += x[l] * x[l];
+            }
+
+            const algorithmFPType bound = errorFactor * (algorithmFPType(0.5) * normSq + maxNormSq) + errorAbs;
+            const algorithmFPType gap   = algorithmFPType(secondVal) - algorithmFPType(firstVal);
+
+            /* The negated comparison also sends the overflowed values to the full precision */
+            if (k > 1 && !(gap > 2 * bound))
+            {
+                algorithmFPType bestVal = services::internal::MaxVal<algorithmFPType>::get();
+                for (size_t j = 0; j < k; j++)
+                {
+                    const algorithmFPType val = halfNormsSq[j] - dot(x, centroids + j * p);
+                    if (val < bestVal)
+                    {
+                        bestVal  = val;
+                        firstIdx = j;
+                    }
+                }
+                minIdx[i]     = firstIdx;
+                minGoalVal[i] = bestVal;
+            }
+            else
+            {
+                minIdx[i]     = firstIdx;
+                minGoalVal[i] = halfNormsSq[firstIdx] - dot(x, centroids + firstIdx * p);
+            }
+        }
+    }
+
+    algorithmFPType dot(const algorithmFPType * const x, const algorithmFPType * const c) const
+    {
+        algorithmFPType sum = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+        for (size_t l = 0; l < p; l++)
+        {
+            sum += x[l] * c[l];
+        }
+        return sum;
+    }
+
+    size_t p                    = 0;
+    size_t k                    = 0;
+    algorithmFPType maxNormSq   = 0;
+    algorithmFPType errorFactor = 0;
+    algorithmFPType errorAbs    = 0;
+    bool useBf16                = false;
+    TArray<float, cpu> centroidsF;
+    TArray<uint16_t, cpu> centroidsB;
+    TArray<float, cpu> halfNormsSqF;
+};
+
+/* Assigns the observations to the centroids of the task and accumulates the partial sums
+   in the TLS of the task in the same way as TaskKMeansLloyd::addNTToTaskThreadedDense does */
+template <typename algorithmFPType, CpuType cpu>
+Status addNTToTaskThreadedReducedPrecision(TaskKMeansLloyd<algorithmFPType, cpu> & task, const NumericTable * const ntData,
+                                           const size_t blockSizeDefault, NumericTable * ntAssign = nullptr, const bool isBf16 = false)
+{
+    const size_t n         = ntData->getNumberOfRows();
+    const size_t p         = task.dim;
+    const size_t nClusters = task.clNum;
+
+    const size_t nBlocks = n / blockSizeDefault + !!(n % blockSizeDefault);
+
+    ReducedPrecisionCentroids<algorithmFPType, cpu> reduced;
+    DAAL_CHECK_STATUS_VAR(reduced.init(p, nClusters, task.cCenters, task.clSq, isBf16));
+
+    TlsMem<float, cpu> tlsBuffer(reduced.bufferSize(blockSizeDefault));
+    TlsMem<size_t, cpu> tlsMinIdx(blockSizeDefault);
+    TlsMem<algorithmFPType, cpu> tlsMinGoalVal(blockSizeDefault);
+
+    SafeStatus safeStat;
+    task.tls_task->for_blocks(nBlocks, [&](const int k, TlsTask<algorithmFPType, cpu> * tt) {
+        DAAL_CHECK_MALLOC_THR(tt);
+        float * const buffer               = tlsBuffer.local();
+        size_t * const minIdx              = tlsMinIdx.local();
+        algorithmFPType * const minGoalVal = tlsMinGoalVal.local();
+        DAAL_CHECK_MALLOC_THR(buffer && minIdx && minGoalVal);
+
+        const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), k * blockSizeDefault, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType * const data = mtData.get();
+
+        int * assignments = nullptr;
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, k * blockSizeDefault, blockSize);
+        if (ntAssign)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+            assignments = assignBlock.get();
+        }
+
+        reduced.assignBlock(data, blockSize, task.cCenters, task.clSq, buffer, minIdx, minGoalVal);
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+
+        algorithmFPType goal = algorithmFPType(0);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t idx      = minIdx[i];
+            algorithmFPType value = minGoalVal[i] * 2.0;
+
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[idx * p + j] += data[i * p + j];
+                value += data[i * p + j] * data[i * p + j];
+            }
+
+            task.kmeansInsertCandidate(tt, value, k * blockSizeDefault + i);
+            cS0[idx]++;
+
+            goal += value;
+
+            if (ntAssign)
+            {
+                assignments[i] = (int)idx;
+            }
+        }
+
+        tt->goalFunc += goal;
+    });
+    return safeStat.detach();
+}
+
+/* Assigns the observations to the centroids in the same way as PostProcessing<lloydDense>::computeAssignments does */
+template <typename algorithmFPType, CpuType cpu>
+Status computeAssignmentsReducedPrecision(const size_t p, const size_t nClusters, const algorithmFPType * const inClusters,
+                                          const NumericTable * ntData, NumericTable * ntAssign, const size_t blockSizeDefault,
+                                          const bool isBf16 = false)
+{
+    const size_t n       = ntData->getNumberOfRows();
+    const size_t nBlocks = n / blockSizeDefault + !!(n % blockSizeDefault);
+
+    TArray<algorithmFPType, cpu> clSq(nClusters);
+    DAAL_CHECK_MALLOC(clSq.get());
+    for (size_t k = 0; k < nClusters; k++)
+    {
+        algorithmFPType sum = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+        for (size_t j = 0; j < p; j++)
+        {
+            sum += inClusters[k * p + j] * inClusters[k * p + j] * 0.5;
+        }
+        clSq[k] = sum;
+    }
+
+    ReducedPrecisionCentroids<algorithmFPType, cpu> reduced;
+    DAAL_CHECK_STATUS_VAR(reduced.init(p, nClusters, inClusters, clSq.get(), isBf16));
+
+    TlsMem<float, cpu> tlsBuffer(reduced.bufferSize(blockSizeDefault));
+    TlsMem<size_t, cpu> tlsMinIdx(blockSizeDefault);
+    TlsMem<algorithmFPType, cpu> tlsMinGoalVal(blockSizeDefault);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](const int iBlock) {
+        float * const buffer               = tlsBuffer.local();
+        size_t * const minIdx              = tlsMinIdx.local();
+        algorithmFPType * const minGoalVal = tlsMinGoalVal.local();
+        DAAL_CHECK_MALLOC_THR(buffer && minIdx && minGoalVal);
+
+        const size_t blockSize = (iBlock == nBlocks - 1) ? n - iBlock * blockSizeDefault : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), iBlock * blockSizeDefault, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, iBlock * blockSizeDefault, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+        int * assignments = assignBlock.get();
+
+        reduced.assignBlock(mtData.get(), blockSize, inClusters, clSq.get(), buffer, minIdx, minGoalVal);
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            assignments[i] = (int)minIdx[i];
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
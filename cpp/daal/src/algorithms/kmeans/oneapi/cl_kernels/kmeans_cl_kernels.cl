@@ -210,7 +210,9 @@ DECLARE_SOURCE(
     __kernel void partial_candidates(__global const int * assignments, __global const algorithmFPType * mindistances,
                                      __global const algorithmFPType * distSq, __global const int * candidates,
                                      __global const algorithmFPType * candidateDistances, __global int * candidates_tmp,
-                                     __global algorithmFPType * candidateDistances_tmp, int N, int K, int Reset) {
+                                     __global algorithmFPType * candidateDistances_tmp, __global const int * numEmptyClusters, int N,
+                                     int K, int Reset, int Offset) {
+        if (numEmptyClusters[0] == 0) return;
         const int global_id  = get_global_id(0);
         const int gsize      = get_global_size(0);
         const int lsize      = get_sub_group_size();
@@ -243,8 +245,8 @@ DECLARE_SOURCE(
         {
             algorithmFPType newVal = 2.0 * (mindistances[iblock] + distSq[iblock]);
             if (newVal <= maxDist[K - 1]) continue;
-            int valCentroid = assignments[iblock];
-            int maxInd      = -1;
+            int valIndex = iblock + Offset;
+            int maxInd   = -1;
             for (int i = 0; i < numgrp; i++)
             {
                 algorithmFPType curVal = HUGE;
@@ -260,7 +262,7 @@ DECLARE_SOURCE(
             if (maxInd > -1)
             {
                 insert_shift_right_fp(maxDist, maxInd, 0, newVal, numgrp, rem, local_id, lsize);
-                insert_shift_right(maxItem, maxInd, 0, valCentroid, numgrp, rem, local_id, lsize);
+                insert_shift_right(maxItem, maxInd, 0, valIndex, numgrp, rem, local_id, lsize);
             }
         }
 
@@ -275,7 +277,8 @@ DECLARE_SOURCE(
     }
 
     __kernel void merge_candidates(__global int * candidates, __global algorithmFPType * candidateDistances, __global const int * candidates_tmp,
-                                   __global const algorithmFPType * candidateDistances_tmp, int K) {
+                                   __global const algorithmFPType * candidateDistances_tmp, __global const int * numEmptyClusters, int K) {
+        if (numEmptyClusters[0] == 0) return;
         const int global_id = get_global_id(0);
         const int local_id  = get_sub_group_local_id();
 
@@ -346,7 +349,8 @@ DECLARE_SOURCE(
     }
 
     __kernel void merge_reduce_centroids(__global algorithmFPType * partialCentroids, __global int * partialCentroidsCounters,
-                                         __global algorithmFPType * centroids, int K, int P, int parts) {
+                                         __global algorithmFPType * centroids, __global const int * iterationFlags, int K, int P, int parts) {
+        if (iterationFlags[0]) return;
         const int local_id   = get_local_id(0);
         const int local_size = get_local_size(0);
 
@@ -402,7 +406,7 @@ DECLARE_SOURCE(
     }
 
     __kernel void update_objective_function(__global const algorithmFPType * dataSq, __global const algorithmFPType * distances, int N, int K,
-                                            __global algorithmFPType * objFunction) {
+                                            __global algorithmFPType * objFunction, int doReset) {
         const int local_id   = get_local_id(0);
         const int local_size = get_local_size(0);
 
@@ -419,10 +423,51 @@ DECLARE_SOURCE(
 
         if (local_id == 0)
         {
-            objFunction[0] = local_sum[0];
+            objFunction[0] = doReset ? local_sum[0] : objFunction[0] + local_sum[0];
         }
     }
 
+    __kernel void fill_empty_clusters(__global const algorithmFPType * data, __global const int * partialCentroidsCounters,
+                                      __global const int * candidates, __global const algorithmFPType * candidateDistances,
+                                      __global algorithmFPType * centroids, __global const int * numEmptyClusters,
+                                      __global algorithmFPType * iterationState, __global const int * iterationFlags, int N, int K, int P) {
+        const int local_id   = get_local_id(0);
+        const int local_size = get_local_size(0);
+
+        if (iterationFlags[0]) return;
+        if (local_id == 0) iterationState[1] = 0.0;
+        if (numEmptyClusters[0] == 0) return;
+
+        algorithmFPType correction = 0.0;
+        int cPos                   = 0;
+        for (int iCl = 0; iCl < K && cPos < K; iCl++)
+        {
+            if (partialCentroidsCounters[iCl] != 0) continue;
+            const int id = candidates[cPos];
+            if (id < 0 || id >= N) continue;
+            for (int j = local_id; j < P; j += local_size)
+            {
+                centroids[iCl * P + j] = data[id * P + j];
+            }
+            correction += candidateDistances[cPos];
+            cPos++;
+        }
+        if (local_id == 0) iterationState[1] = correction;
+    }
+
+    __kernel void update_iteration_state(__global const algorithmFPType * objFunction, __global algorithmFPType * iterationState,
+                                         __global int * iterationFlags, algorithmFPType accuracyThreshold) {
+        if (get_global_id(0) > 0 || iterationFlags[0]) return;
+
+        const algorithmFPType curObjFunction = objFunction[0] - iterationState[1];
+        iterationFlags[1]++;
+        if (accuracyThreshold > 0.0 && fabs(curObjFunction - iterationState[0]) < accuracyThreshold)
+        {
+            iterationFlags[0] = 1;
+        }
+        iterationState[0] = curObjFunction;
+    }
+
 );
 
 #endif
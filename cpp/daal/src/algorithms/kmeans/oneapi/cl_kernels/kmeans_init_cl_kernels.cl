@@ -49,6 +49,195 @@ DECLARE_SOURCE(
         }
     }
 
+    void __block_sum_reduce(__local algorithmFPType * local_sum, __global algorithmFPType * blockSums) {
+        const int local_id   = get_local_id(0);
+        const int local_size = get_local_size(0);
+        for (int stride = local_size / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (local_id < stride)
+            {
+                local_sum[local_id] += local_sum[local_id + stride];
+            }
+        }
+        if (local_id == 0)
+        {
+            blockSums[get_group_id(0)] = local_sum[0];
+        }
+    }
+
+    // Sets the sampling weights of the rows before the first centroid is chosen
+    // and computes their sums over the blocks of LOCAL_SUM_SIZE rows
+    __kernel void init_min_distances(__global algorithmFPType * minDist, __global algorithmFPType * blockSums, __global const int * weights, int N,
+                                     int hasWeights) {
+        const int global_id = get_global_id(0);
+        const int local_id  = get_local_id(0);
+
+        __local algorithmFPType local_sum[LOCAL_SUM_SIZE];
+
+        algorithmFPType value = 0.0;
+        if (global_id < N)
+        {
+            value              = hasWeights ? (algorithmFPType)weights[global_id] : 1.0;
+            minDist[global_id] = value;
+        }
+        local_sum[local_id] = value;
+
+        __block_sum_reduce(local_sum, blockSums);
+    }
+
+    // Updates the weighted squared distances from the rows to the closest
+    // chosen centroid with the centroids data[indices[first]], ...,
+    // data[indices[first + count - 1]] and recomputes the block sums
+    __kernel void update_min_distances(__global const algorithmFPType * data, __global const int * indices, __global algorithmFPType * minDist,
+                                       __global int * nearest, __global algorithmFPType * blockSums, __global const int * weights, int N, int P,
+                                       int first, int count, int hasWeights, int isFirst) {
+        const int global_id = get_global_id(0);
+        const int local_id  = get_local_id(0);
+
+        __local algorithmFPType local_sum[LOCAL_SUM_SIZE];
+
+        algorithmFPType value = 0.0;
+        if (global_id < N)
+        {
+            const algorithmFPType weight = hasWeights ? (algorithmFPType)weights[global_id] : 1.0;
+
+            value       = isFirst ? -1.0 : minDist[global_id];
+            int closest = isFirst ? first : nearest[global_id];
+            for (int c = first; c < first + count; c++)
+            {
+                const int centroid   = indices[c];
+                algorithmFPType dist = 0.0;
+                for (int j = 0; j < P; j++)
+                {
+                    const algorithmFPType diff = data[global_id * P + j] - data[centroid * P + j];
+                    dist += diff * diff;
+                }
+                dist *= weight;
+                if (value < 0.0 || dist < value)
+                {
+                    value   = dist;
+                    closest = c;
+                }
+            }
+            minDist[global_id] = value;
+            nearest[global_id] = closest;
+        }
+        local_sum[local_id] = value;
+
+        __block_sum_reduce(local_sum, blockSums);
+    }
+
+    // Chooses the row with the probability proportional to its weighted
+    // squared distance to the closest centroid by the uniform random number
+    // randoms[iter] and stores it to indices[iter]. The block sums are summed
+    // over the chunks by all the work items, the chunk, the block and the row
+    // are then found by the first work item.
+    __kernel void select_weighted(__global const algorithmFPType * minDist, __global const algorithmFPType * blockSums,
+                                  __global const algorithmFPType * randoms, __global int * indices, int N, int nBlocks, int iter) {
+        const int local_id   = get_local_id(0);
+        const int local_size = get_local_size(0);
+        const int chunkSize  = (nBlocks + local_size - 1) / local_size;
+        const int nChunks    = (nBlocks + chunkSize - 1) / chunkSize;
+        const int blockSize  = LOCAL_SUM_SIZE;
+
+        __local algorithmFPType chunkSums[LOCAL_SUM_SIZE];
+
+        algorithmFPType sum  = 0.0;
+        const int chunkStart = local_id * chunkSize;
+        const int chunkEnd   = min(chunkStart + chunkSize, nBlocks);
+        for (int i = chunkStart; i < chunkEnd; i++)
+        {
+            sum += blockSums[i];
+        }
+        chunkSums[local_id] = sum;
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (local_id > 0) return;
+
+        algorithmFPType total = 0.0;
+        for (int i = 0; i < nChunks; i++)
+        {
+            total += chunkSums[i];
+        }
+
+        // All the rows coincide with the chosen centroids, so any row fits
+        if (total <= 0.0)
+        {
+            indices[iter] = min((int)(randoms[iter] * N), N - 1);
+            return;
+        }
+
+        algorithmFPType threshold = randoms[iter] * total;
+
+        int chunk = 0;
+        for (; chunk < nChunks - 1 && threshold >= chunkSums[chunk]; chunk++)
+        {
+            threshold -= chunkSums[chunk];
+        }
+
+        int block          = chunk * chunkSize;
+        const int blockEnd = min(block + chunkSize, nBlocks);
+        for (; block < blockEnd - 1 && threshold >= blockSums[block]; block++)
+        {
+            threshold -= blockSums[block];
+        }
+
+        int row          = block * blockSize;
+        const int rowEnd = min(row + blockSize, N);
+        for (; row < rowEnd - 1 && threshold >= minDist[row]; row++)
+        {
+            threshold -= minDist[row];
+        }
+
+        indices[iter] = row;
+    }
+
+    // Sums the block sums of the weighted squared distances
+    __kernel void sum_blocks(__global const algorithmFPType * blockSums, __global algorithmFPType * total, int nBlocks) {
+        const int local_id   = get_local_id(0);
+        const int local_size = get_local_size(0);
+
+        __local algorithmFPType local_sum[LOCAL_SUM_SIZE];
+
+        algorithmFPType sum = 0.0;
+        for (int i = local_id; i < nBlocks; i += local_size)
+        {
+            sum += blockSums[i];
+        }
+        local_sum[local_id] = sum;
+
+        __block_sum_reduce(local_sum, total);
+    }
+
+    // Marks every row as a candidate of k-means|| independently with the
+    // probability L * minDist / total
+    __kernel void sample_candidates(__global const algorithmFPType * minDist, __global const algorithmFPType * total,
+                                    __global const algorithmFPType * randoms, __global int * mask, int N, algorithmFPType L) {
+        const int global_id = get_global_id(0);
+        if (global_id < N)
+        {
+            mask[global_id] = (L * minDist[global_id] > randoms[global_id] * total[0]) ? 1 : 0;
+        }
+    }
+
+    __kernel void fill_range(__global int * indices, int N) {
+        const int global_id = get_global_id(0);
+        if (global_id < N)
+        {
+            indices[global_id] = global_id;
+        }
+    }
+
+    // Counts the rows closest to every candidate of k-means||
+    __kernel void count_nearest(__global const int * nearest, __global int * weights, int N) {
+        const int global_id = get_global_id(0);
+        if (global_id < N)
+        {
+            atomic_inc(&weights[nearest[global_id]]);
+        }
+    }
+
 );
 
 #endif
@@ -46,6 +46,19 @@ class KMeansDenseLloydBatchKernelUCAPI : public KMeansDenseLloydKernelBaseUCAPI<
 {
 public:
     services::Status compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par);
+
+private:
+    services::Status computeByBlocks(NumericTable * const ntData, NumericTable * const ntAssignments,
+                                     services::internal::Buffer<algorithmFPType> & inCentroids,
+                                     services::internal::Buffer<algorithmFPType> & outCentroids,
+                                     services::internal::Buffer<algorithmFPType> & objFunction, uint32_t nRows, uint32_t nFeatures,
+                                     uint32_t nClusters, uint32_t nIter, uint32_t blockSize, algorithmFPType accuracyThreshold, uint32_t & iter);
+
+    services::Status computeOnDevice(NumericTable * const ntData, NumericTable * const ntAssignments,
+                                     services::internal::Buffer<algorithmFPType> & inCentroids,
+                                     services::internal::Buffer<algorithmFPType> & outCentroids,
+                                     services::internal::Buffer<algorithmFPType> & objFunction, uint32_t nRows, uint32_t nFeatures,
+                                     uint32_t nClusters, uint32_t nIter, algorithmFPType accuracyThreshold, uint32_t & iter);
 };
 
 } // namespace internal
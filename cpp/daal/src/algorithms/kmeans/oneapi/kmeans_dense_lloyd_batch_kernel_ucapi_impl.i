@@ -96,9 +96,49 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
         return Status(ErrorNullPtr);
     }
 
+    uint32_t iter = 0;
+    if (blockSize == nRows)
+    {
+        DAAL_CHECK_STATUS_VAR(computeOnDevice(ntData, ntAssignments, inCentroids, outCentroids, objFunction, nRows, nFeatures, nClusters, nIter,
+                                              par->accuracyThreshold, iter));
+    }
+    else
+    {
+        DAAL_CHECK_STATUS_VAR(computeByBlocks(ntData, ntAssignments, inCentroids, outCentroids, objFunction, nRows, nFeatures, nClusters, nIter,
+                                              blockSize, par->accuracyThreshold, iter));
+    }
+
+    DAAL_CHECK_STATUS_VAR(ntInCentroids->releaseBlockOfRows(inCentroidsRows));
+    DAAL_CHECK_STATUS_VAR(ntOutCentroids->releaseBlockOfRows(outCentroidsRows));
+    DAAL_CHECK_STATUS_VAR(ntObjFunction->releaseBlockOfRows(objFunctionRows));
+    {
+        BlockDescriptor<int> nIterationsRows;
+        DAAL_CHECK_STATUS_VAR(ntNIterations->getBlockOfRows(0, 1, writeOnly, nIterationsRows));
+        auto nIterationsHostPtr = nIterationsRows.getBlockSharedPtr();
+        int * nIterations       = nIterationsHostPtr.get();
+        if (!nIterations)
+        {
+            return Status(ErrorNullPtr);
+        }
+        nIterations[0] = iter;
+        DAAL_CHECK_STATUS_VAR(ntNIterations->releaseBlockOfRows(nIterationsRows));
+    }
+
+    return st;
+}
+
+template <typename algorithmFPType>
+Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::computeByBlocks(NumericTable * const ntData, NumericTable * const ntAssignments,
+                                                                          services::internal::Buffer<algorithmFPType> & inCentroids,
+                                                                          services::internal::Buffer<algorithmFPType> & outCentroids,
+                                                                          services::internal::Buffer<algorithmFPType> & objFunction, uint32_t nRows,
+                                                                          uint32_t nFeatures, uint32_t nClusters, uint32_t nIter, uint32_t blockSize,
+                                                                          algorithmFPType accuracyThreshold, uint32_t & iter)
+{
+    Status st;
+
     algorithmFPType prevObjFunction = (algorithmFPType)0.0;
 
-    uint32_t iter    = 0;
     uint32_t nBlocks = nRows / blockSize + int32_t(nRows % blockSize != 0);
 
     for (; iter < nIter; iter++)
@@ -146,7 +186,7 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
                 bool hasEmptyClusters = numEmpty > 0;
                 if (hasEmptyClusters)
                 {
-                    this->computePartialCandidates(assignments, range.count, nClusters, int(block == 0), &st);
+                    this->computePartialCandidates(assignments, range.count, nClusters, int(block == 0), range.startIndex, &st);
                     DAAL_CHECK_STATUS_VAR(st);
                     this->mergePartialCandidates(nClusters, &st);
                     DAAL_CHECK_STATUS_VAR(st);
@@ -178,11 +218,11 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
             curObjFunction -= objFuncCorrection;
         }
 
-        if (par->accuracyThreshold > (algorithmFPType)0.0)
+        if (accuracyThreshold > (algorithmFPType)0.0)
         {
             algorithmFPType objFuncDiff =
                 curObjFunction - prevObjFunction > 0 ? curObjFunction - prevObjFunction : -(curObjFunction - prevObjFunction);
-            if (objFuncDiff < par->accuracyThreshold)
+            if (objFuncDiff < accuracyThreshold)
             {
                 iter++;
                 break;
@@ -222,25 +262,104 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
         DAAL_CHECK_STATUS_VAR(ntAssignments->releaseBlockOfRows(assignmentsRows));
     }
 
-    DAAL_CHECK_STATUS_VAR(ntInCentroids->releaseBlockOfRows(inCentroidsRows));
-    DAAL_CHECK_STATUS_VAR(ntOutCentroids->releaseBlockOfRows(outCentroidsRows));
-    DAAL_CHECK_STATUS_VAR(ntObjFunction->releaseBlockOfRows(objFunctionRows));
+    return st;
+}
+
+
+/* Runs the iterations without the host synchronization when the whole data set fits into a single block.
+   The convergence check and the empty clusters handling are done on the device, the host reads
+   the convergence flag once in several iterations only. */
+template <typename algorithmFPType>
+Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::computeOnDevice(NumericTable * const ntData, NumericTable * const ntAssignments,
+                                                                          services::internal::Buffer<algorithmFPType> & inCentroids,
+                                                                          services::internal::Buffer<algorithmFPType> & outCentroids,
+                                                                          services::internal::Buffer<algorithmFPType> & objFunction, uint32_t nRows,
+                                                                          uint32_t nFeatures, uint32_t nClusters, uint32_t nIter,
+                                                                          algorithmFPType accuracyThreshold, uint32_t & iter)
+{
+    Status st;
+
+    BlockDescriptor<algorithmFPType> dataRows;
+    DAAL_CHECK_STATUS_VAR(ntData->getBlockOfRows(0, nRows, readOnly, dataRows));
+    auto data = dataRows.getBuffer();
+    BlockDescriptor<int> assignmentsRows;
+    DAAL_CHECK_STATUS_VAR(ntAssignments->getBlockOfRows(0, nRows, writeOnly, assignmentsRows));
+    auto assignments = assignmentsRows.getBuffer();
+    if (!data || !assignments)
     {
-        BlockDescriptor<int> nIterationsRows;
-        DAAL_CHECK_STATUS_VAR(ntNIterations->getBlockOfRows(0, 1, writeOnly, nIterationsRows));
-        auto nIterationsHostPtr = nIterationsRows.getBlockSharedPtr();
-        int * nIterations       = nIterationsHostPtr.get();
-        if (!nIterations)
+        return Status(ErrorNullPtr);
+    }
+
+    /* The squares of the observations do not change between the iterations */
+    this->computeSquares(data, this->_dataSq, nRows, nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    for (uint32_t i = 0; i < nIter; i++)
+    {
+        this->computeSquares(inCentroids, this->_centroidsSq, nClusters, nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->computeDistances(data, inCentroids, nRows, nClusters, nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->computeAssignments(assignments, nRows, nClusters, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->partialReduceCentroids(data, assignments, nRows, nClusters, nFeatures, 1, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->getNumEmptyClusters(nClusters, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->computePartialCandidates(assignments, nRows, nClusters, 1, 0, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->mergePartialCandidates(nClusters, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->updateObjectiveFunction(objFunction, nRows, nClusters, 1, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->mergeReduceCentroids(outCentroids, nClusters, nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->fillEmptyClusters(data, outCentroids, nRows, nClusters, nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        this->updateIterationState(objFunction, accuracyThreshold, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        inCentroids = outCentroids;
+
+        /* The kernels skip the updates after the convergence, so the host checks the flag rarely */
+        if (accuracyThreshold > (algorithmFPType)0.0 && (i + 1) % this->_nSyncIterations == 0 && i + 1 < nIter)
+        {
+            auto flags = this->_iterationFlags.template get<int>().toHost(ReadWriteMode::readOnly);
+            if (!flags.get())
+            {
+                return Status(ErrorNullPtr);
+            }
+            if (flags.get()[0])
+            {
+                break;
+            }
+        }
+    }
+
+    this->computeSquares(inCentroids, this->_centroidsSq, nClusters, nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    this->computeDistances(data, inCentroids, nRows, nClusters, nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    this->computeAssignments(assignments, nRows, nClusters, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    this->updateObjectiveFunction(objFunction, nRows, nClusters, 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS_VAR(ntData->releaseBlockOfRows(dataRows));
+    DAAL_CHECK_STATUS_VAR(ntAssignments->releaseBlockOfRows(assignmentsRows));
+
+    {
+        auto flags = this->_iterationFlags.template get<int>().toHost(ReadWriteMode::readOnly);
+        if (!flags.get())
         {
             return Status(ErrorNullPtr);
         }
-        nIterations[0] = iter;
-        DAAL_CHECK_STATUS_VAR(ntNIterations->releaseBlockOfRows(nIterationsRows));
+        iter = static_cast<uint32_t>(flags.get()[1]);
     }
 
     return st;
 }
 
+
 } // namespace internal
 } // namespace kmeans
 } // namespace algorithms
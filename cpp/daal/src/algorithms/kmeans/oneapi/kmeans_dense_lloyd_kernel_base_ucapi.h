@@ -72,7 +72,7 @@ protected:
                             services::Status * st);
 
     void computePartialCandidates(const services::internal::sycl::UniversalBuffer & assignments, uint32_t blockSize, uint32_t nClusters,
-                                  uint32_t reset, services::Status * st);
+                                  uint32_t reset, uint32_t rowOffset, services::Status * st);
 
     void mergePartialCandidates(uint32_t nClusters, services::Status * st);
 
@@ -86,6 +86,10 @@ protected:
     void updateObjectiveFunction(const services::internal::Buffer<algorithmFPType> & objFunction, uint32_t blockSize, uint32_t nClusters,
                                  uint32_t doReset, services::Status * st);
     void getNumEmptyClusters(uint32_t nClusters, services::Status * st);
+    void fillEmptyClusters(const services::internal::Buffer<algorithmFPType> & data, const services::internal::Buffer<algorithmFPType> & centroids,
+                           uint32_t blockSize, uint32_t nClusters, uint32_t nFeatures, services::Status * st);
+    void updateIterationState(const services::internal::Buffer<algorithmFPType> & objFunction, algorithmFPType accuracyThreshold,
+                              services::Status * st);
     void buildProgram(services::internal::sycl::ClKernelFactoryIface & kernelFactory, uint32_t nClusters, daal::services::Status * st);
     services::Status setEmptyClusters(NumericTable * const ntData, uint32_t nRows, uint32_t nClusters, uint32_t nFeatures,
                                       services::internal::Buffer<algorithmFPType> & outCentroids, algorithmFPType & objFuncCorrection);
@@ -108,6 +112,8 @@ protected:
     services::internal::sycl::UniversalBuffer _partialCentroids;
     services::internal::sycl::UniversalBuffer _partialCentroidsCounters;
     services::internal::sycl::UniversalBuffer _numEmptyClusters;
+    services::internal::sycl::UniversalBuffer _iterationState; // previous objective function, empty clusters correction
+    services::internal::sycl::UniversalBuffer _iterationFlags; // convergence flag, number of iterations
 
     const uint32_t _maxWorkItemsPerGroup = 128;                                          // should be a power of two for interal needs
     const uint32_t _maxLocalBuffer       = 30000;                                        // should be less than a half of local memory (two buffers)
@@ -115,6 +121,7 @@ protected:
     const uint32_t _nPartialCentroids    = 128;                                          // Recommended number of partial centroids
     const uint32_t _nValuesInBlock       = 1024 * 1024 * 1024 / sizeof(algorithmFPType); // Max block size is 1GB
     const uint32_t _nMinRows             = 1;                                            // At least a single row should fit into block
+    const uint32_t _nSyncIterations      = 8;                                            // Iterations between the convergence checks on host
 };
 
 } // namespace internal
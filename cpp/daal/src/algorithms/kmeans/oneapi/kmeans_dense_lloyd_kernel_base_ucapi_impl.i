@@ -78,6 +78,14 @@ Status KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::initializeBuffers(uint3
     DAAL_CHECK_STATUS_VAR(st);
     _numEmptyClusters = context.allocate(TypeIds::id<int>(), 1, &st);
     DAAL_CHECK_STATUS_VAR(st);
+    _iterationState = context.allocate(TypeIds::id<algorithmFPType>(), 2, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    context.fill(_iterationState, 0.0, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _iterationFlags = context.allocate(TypeIds::id<int>(), 2, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    context.fill(_iterationFlags, 0.0, &st);
+    DAAL_CHECK_STATUS_VAR(st);
     return Status();
 }
 
@@ -275,7 +283,7 @@ void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::computeAssignments(const
 
 template <typename algorithmFPType>
 void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::computePartialCandidates(const UniversalBuffer & assignments, uint32_t blockSize,
-                                                                                uint32_t nClusters, uint32_t reset, Status * st)
+                                                                                uint32_t nClusters, uint32_t reset, uint32_t rowOffset, Status * st)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(compute.computePartialCandidates);
 
@@ -284,7 +292,7 @@ void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::computePartialCandidates(
     auto kernel           = kernel_factory.getKernel("partial_candidates", st);
     DAAL_CHECK_STATUS_PTR(st);
 
-    KernelArguments args(10);
+    KernelArguments args(12);
     args.set(0, assignments, AccessModeIds::read);
     args.set(1, _mindistances, AccessModeIds::read);
     args.set(2, _dataSq, AccessModeIds::read);
@@ -292,9 +300,11 @@ void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::computePartialCandidates(
     args.set(4, _candidateDistances, AccessModeIds::read);
     args.set(5, _partialCandidates, AccessModeIds::write);
     args.set(6, _partialCandidateDistances, AccessModeIds::write);
-    args.set(7, blockSize);
-    args.set(8, nClusters);
-    args.set(9, reset);
+    args.set(7, _numEmptyClusters, AccessModeIds::read);
+    args.set(8, blockSize);
+    args.set(9, nClusters);
+    args.set(10, reset);
+    args.set(11, rowOffset);
 
     int num_parts = getCandidatePartNum(nClusters);
     if (num_parts > _preferableSubGroup) num_parts = _preferableSubGroup;
@@ -319,12 +329,13 @@ void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::mergePartialCandidates(ui
     auto kernel           = kernel_factory.getKernel("merge_candidates", st);
     DAAL_CHECK_STATUS_PTR(st);
 
-    KernelArguments args(5);
+    KernelArguments args(6);
     args.set(0, _candidates, AccessModeIds::write);
     args.set(1, _candidateDistances, AccessModeIds::write);
     args.set(2, _partialCandidates, AccessModeIds::read);
     args.set(3, _partialCandidateDistances, AccessModeIds::read);
-    args.set(4, nClusters);
+    args.set(4, _numEmptyClusters, AccessModeIds::read);
+    args.set(5, nClusters);
 
     int num_parts = getCandidatePartNum(nClusters);
     if (num_parts > _preferableSubGroup) num_parts = _preferableSubGroup;
@@ -378,13 +389,14 @@ void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::mergeReduceCentroids(cons
     auto kernel           = kernel_factory.getKernel("merge_reduce_centroids", st);
     DAAL_CHECK_STATUS_PTR(st);
 
-    KernelArguments args(6);
+    KernelArguments args(7);
     args.set(0, _partialCentroids, AccessModeIds::readwrite);
     args.set(1, _partialCentroidsCounters, AccessModeIds::readwrite);
     args.set(2, centroids, AccessModeIds::write);
-    args.set(3, nClusters);
-    args.set(4, nFeatures);
-    args.set(5, _nPartialCentroids);
+    args.set(3, _iterationFlags, AccessModeIds::read);
+    args.set(4, nClusters);
+    args.set(5, nFeatures);
+    args.set(6, _nPartialCentroids);
 
     KernelRange local_range(_nPartialCentroids);
     KernelRange global_range(_nPartialCentroids * nClusters);
@@ -403,31 +415,54 @@ void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::updateObjectiveFunction(c
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(compute.updateObjectiveFunction);
 
-    if (doReset)
-    {
-        auto hostPtr = objFunction.toHost(data_management::writeOnly);
-        if (hostPtr.get() == NULL)
-        {
-            if (st)
-            {
-                st->add(Status(ErrorNullPtr));
-            }
-            return;
-        }
-        *hostPtr = 0.0f;
-    }
-
     auto & context        = Environment::getInstance()->getDefaultExecutionContext();
     auto & kernel_factory = context.getClKernelFactory();
     auto kernel           = kernel_factory.getKernel("update_objective_function", st);
     DAAL_CHECK_STATUS_PTR(st);
 
-    KernelArguments args(5);
+    KernelArguments args(6);
     args.set(0, _dataSq, AccessModeIds::read);
     args.set(1, _mindistances, AccessModeIds::read);
     args.set(2, blockSize);
     args.set(3, nClusters);
-    args.set(4, objFunction, AccessModeIds::write);
+    args.set(4, objFunction, AccessModeIds::readwrite);
+    args.set(5, doReset);
+
+    KernelRange local_range(_maxWorkItemsPerGroup);
+    KernelRange global_range(_maxWorkItemsPerGroup);
+
+    KernelNDRange range(1);
+    range.global(global_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+    range.local(local_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+    context.run(range, kernel, args, st);
+}
+
+template <typename algorithmFPType>
+void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::fillEmptyClusters(const services::internal::Buffer<algorithmFPType> & data,
+                                                                         const services::internal::Buffer<algorithmFPType> & centroids,
+                                                                         uint32_t blockSize, uint32_t nClusters, uint32_t nFeatures, Status * st)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.fillEmptyClusters);
+
+    auto & context        = Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernel_factory = context.getClKernelFactory();
+    auto kernel           = kernel_factory.getKernel("fill_empty_clusters", st);
+    DAAL_CHECK_STATUS_PTR(st);
+
+    KernelArguments args(11);
+    args.set(0, data, AccessModeIds::read);
+    args.set(1, _partialCentroidsCounters, AccessModeIds::read);
+    args.set(2, _candidates, AccessModeIds::read);
+    args.set(3, _candidateDistances, AccessModeIds::read);
+    args.set(4, centroids, AccessModeIds::readwrite);
+    args.set(5, _numEmptyClusters, AccessModeIds::read);
+    args.set(6, _iterationState, AccessModeIds::readwrite);
+    args.set(7, _iterationFlags, AccessModeIds::read);
+    args.set(8, blockSize);
+    args.set(9, nClusters);
+    args.set(10, nFeatures);
 
     KernelRange local_range(_maxWorkItemsPerGroup);
     KernelRange global_range(_maxWorkItemsPerGroup);
@@ -440,6 +475,27 @@ void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::updateObjectiveFunction(c
     context.run(range, kernel, args, st);
 }
 
+template <typename algorithmFPType>
+void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::updateIterationState(const services::internal::Buffer<algorithmFPType> & objFunction,
+                                                                            algorithmFPType accuracyThreshold, Status * st)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.updateIterationState);
+
+    auto & context        = Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernel_factory = context.getClKernelFactory();
+    auto kernel           = kernel_factory.getKernel("update_iteration_state", st);
+    DAAL_CHECK_STATUS_PTR(st);
+
+    KernelArguments args(4);
+    args.set(0, objFunction, AccessModeIds::read);
+    args.set(1, _iterationState, AccessModeIds::readwrite);
+    args.set(2, _iterationFlags, AccessModeIds::readwrite);
+    args.set(3, accuracyThreshold);
+
+    KernelRange global_range(1);
+    context.run(global_range, kernel, args, st);
+}
+
 template <typename algorithmFPType>
 void KMeansDenseLloydKernelBaseUCAPI<algorithmFPType>::buildProgram(ClKernelFactoryIface & kernelFactory, uint32_t nClusters, Status * st)
 {
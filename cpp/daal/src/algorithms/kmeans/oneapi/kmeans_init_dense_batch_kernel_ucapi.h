@@ -52,7 +52,33 @@ public:
 
 private:
     services::Status init(size_t p, size_t n, size_t nRowsTotal, size_t nClusters, NumericTable * ntClusters, NumericTable * ntData,
-                          unsigned int seed, engines::BatchBase & engine, size_t & clustersFound);
+                          const Parameter * par, engines::BatchBase & engine, size_t & clustersFound);
+
+    services::Status computePlusPlus(services::internal::sycl::ExecutionContextIface & context,
+                                     const services::internal::Buffer<algorithmFPType> & data, services::internal::sycl::UniversalBuffer & weights,
+                                     bool hasWeights, uint32_t nRows, uint32_t nFeatures, uint32_t nClusters, engines::BatchBase & engine,
+                                     services::internal::sycl::UniversalBuffer & indices);
+
+    services::Status computeParallelPlus(services::internal::sycl::ExecutionContextIface & context,
+                                         const services::internal::Buffer<algorithmFPType> & data, uint32_t nRows, uint32_t nFeatures,
+                                         uint32_t nClusters, double oversamplingFactor, size_t nRounds, engines::BatchBase & engine,
+                                         const services::internal::Buffer<algorithmFPType> & clusters);
+
+    void initMinDistances(services::internal::sycl::ExecutionContextIface & context, services::internal::sycl::UniversalBuffer & minDist,
+                          services::internal::sycl::UniversalBuffer & blockSums, services::internal::sycl::UniversalBuffer & weights,
+                          bool hasWeights, uint32_t nRows, services::Status * st);
+
+    void updateMinDistances(services::internal::sycl::ExecutionContextIface & context, const services::internal::Buffer<algorithmFPType> & data,
+                            services::internal::sycl::UniversalBuffer & indices, services::internal::sycl::UniversalBuffer & minDist,
+                            services::internal::sycl::UniversalBuffer & nearest, services::internal::sycl::UniversalBuffer & blockSums,
+                            services::internal::sycl::UniversalBuffer & weights, bool hasWeights, uint32_t nRows, uint32_t nFeatures,
+                            uint32_t first, uint32_t count, bool isFirst, services::Status * st);
+
+    void selectWeighted(services::internal::sycl::ExecutionContextIface & context, services::internal::sycl::UniversalBuffer & minDist,
+                        services::internal::sycl::UniversalBuffer & blockSums, services::internal::sycl::UniversalBuffer & randoms,
+                        services::internal::sycl::UniversalBuffer & indices, uint32_t nRows, uint32_t iter, services::Status * st);
+
+    services::Status generateUniform(services::internal::sycl::UniversalBuffer & randoms, size_t n, engines::BatchBase & engine);
 
     void gatherRandom(services::internal::sycl::ExecutionContextIface & context, const services::internal::sycl::KernelPtr & kernel_gather_random,
                       const services::internal::Buffer<algorithmFPType> & data, const services::internal::Buffer<algorithmFPType> & clusters,
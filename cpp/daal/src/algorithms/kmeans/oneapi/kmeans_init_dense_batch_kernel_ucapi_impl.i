@@ -31,6 +31,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/distributions/uniform/uniform_kernel.h"
 #include "src/algorithms/distributions/uniform/uniform_impl.i"
+#include "src/sycl/partition.h"
 
 namespace daal
 {
@@ -50,7 +51,7 @@ using namespace daal::algorithms::distributions::uniform::internal;
 
 template <Method method, typename algorithmFPType>
 Status KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::init(size_t p, size_t n, size_t nRowsTotal, size_t nClusters,
-                                                                      NumericTable * ntClusters, NumericTable * ntData, unsigned int seed,
+                                                                      NumericTable * ntClusters, NumericTable * ntData, const Parameter * par,
                                                                       engines::BatchBase & engine, size_t & clustersFound)
 {
     Status st;
@@ -138,10 +139,365 @@ Status KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::init(size_t p,
         return st;
     }
 
+    if (method == plusPlusDense || method == parallelPlusDense)
+    {
+        DAAL_CHECK(nClusters <= n, ErrorKMeansNumberOfClustersIsTooLarge);
+
+        BlockDescriptor<algorithmFPType> dataRows;
+        ntData->getBlockOfRows(0, n, readOnly, dataRows);
+        auto data = dataRows.getBuffer();
+
+        BlockDescriptor<algorithmFPType> clustersRows;
+        ntClusters->getBlockOfRows(0, nClusters, writeOnly, clustersRows);
+        auto clusters = clustersRows.getBuffer();
+
+        if (method == plusPlusDense)
+        {
+            auto indices = context.allocate(TypeIds::id<int>(), nClusters, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            UniversalBuffer noWeights;
+
+            DAAL_CHECK_STATUS(st, computePlusPlus(context, data, noWeights, false, n, p, nClusters, engine, indices));
+
+            auto gather_random = kernel_factory.getKernel("gather_random");
+            gatherRandom(context, gather_random, data, clusters, indices, n, nClusters, p, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+        else
+        {
+            DAAL_CHECK_STATUS(st, computeParallelPlus(context, data, n, p, nClusters, par->oversamplingFactor, par->nRounds, engine, clusters));
+        }
+
+        ntData->releaseBlockOfRows(dataRows);
+        ntClusters->releaseBlockOfRows(clustersRows);
+
+        clustersFound = nClusters;
+
+        return st;
+    }
+
     DAAL_ASSERT(false && "should never happen");
     return Status();
 }
 
+/* Chooses nClusters rows of k-means++ one by one with the probabilities
+   proportional to the squared distances to the closest chosen centroid
+   multiplied by the weights of the rows. The random numbers are generated on
+   the host in advance, so the rows are chosen on the device without the
+   synchronization with the host. */
+template <Method method, typename algorithmFPType>
+Status KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::computePlusPlus(ExecutionContextIface & context,
+                                                                                 const services::internal::Buffer<algorithmFPType> & data,
+                                                                                 UniversalBuffer & weights, bool hasWeights, uint32_t nRows,
+                                                                                 uint32_t nFeatures, uint32_t nClusters,
+                                                                                 engines::BatchBase & engine, UniversalBuffer & indices)
+{
+    Status st;
+
+    const uint32_t nBlocks = getWorkgroupsCount(nRows);
+
+    auto minDist = context.allocate(TypeIds::id<algorithmFPType>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto nearest = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto blockSums = context.allocate(TypeIds::id<algorithmFPType>(), nBlocks, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto randoms = context.allocate(TypeIds::id<algorithmFPType>(), nClusters, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    DAAL_CHECK_STATUS(st, generateUniform(randoms, nClusters, engine));
+
+    initMinDistances(context, minDist, blockSums, weights, hasWeights, nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    for (uint32_t iter = 0; iter < nClusters; iter++)
+    {
+        selectWeighted(context, minDist, blockSums, randoms, indices, nRows, iter, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        if (iter + 1 < nClusters)
+        {
+            updateMinDistances(context, data, indices, minDist, nearest, blockSums, weights, hasWeights, nRows, nFeatures, iter, 1, iter == 0,
+                               &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+    }
+
+    return st;
+}
+
+/* k-means|| chooses the first candidate uniformly and then oversamples about
+   oversamplingFactor * nClusters candidates in each of nRounds rounds. The
+   candidates weighted by the numbers of the rows closest to them are reduced
+   to nClusters centroids with k-means++. */
+template <Method method, typename algorithmFPType>
+Status KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::computeParallelPlus(
+    ExecutionContextIface & context, const services::internal::Buffer<algorithmFPType> & data, uint32_t nRows, uint32_t nFeatures,
+    uint32_t nClusters, double oversamplingFactor, size_t nRounds, engines::BatchBase & engine,
+    const services::internal::Buffer<algorithmFPType> & clusters)
+{
+    Status st;
+
+    auto & kernel_factory = context.getClKernelFactory();
+
+    const uint32_t nBlocks = getWorkgroupsCount(nRows);
+
+    auto minDist = context.allocate(TypeIds::id<algorithmFPType>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto nearest = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto blockSums = context.allocate(TypeIds::id<algorithmFPType>(), nBlocks, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto total = context.allocate(TypeIds::id<algorithmFPType>(), 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto randoms = context.allocate(TypeIds::id<algorithmFPType>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto mask = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto rowIndices = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto sampled = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    /* Every row becomes a candidate once at most, as its distance to the closest candidate is zero afterwards */
+    auto candidates = context.allocate(TypeIds::id<int>(), nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    UniversalBuffer noWeights;
+
+    DAAL_CHECK_STATUS(st, generateUniform(randoms, 1, engine));
+    initMinDistances(context, minDist, blockSums, noWeights, false, nRows, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    selectWeighted(context, minDist, blockSums, randoms, candidates, nRows, 0, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    updateMinDistances(context, data, candidates, minDist, nearest, blockSums, noWeights, false, nRows, nFeatures, 0, 1, true, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    {
+        auto fill_range = kernel_factory.getKernel("fill_range");
+
+        KernelArguments args(2);
+        args.set(0, rowIndices, AccessModeIds::write);
+        args.set(1, nRows);
+
+        KernelRange global_range(nBlocks * _maxWorkItemsPerGroup);
+        context.run(global_range, fill_range, args, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    auto sum_blocks        = kernel_factory.getKernel("sum_blocks");
+    auto sample_candidates = kernel_factory.getKernel("sample_candidates");
+
+    const algorithmFPType L = algorithmFPType(oversamplingFactor * nClusters);
+    uint32_t nCandidates    = 1;
+    for (size_t round = 0; round < nRounds; round++)
+    {
+        {
+            KernelArguments args(3);
+            args.set(0, blockSums, AccessModeIds::read);
+            args.set(1, total, AccessModeIds::write);
+            args.set(2, nBlocks);
+
+            KernelRange local_range(_maxWorkItemsPerGroup);
+            KernelNDRange range(1);
+            range.global(local_range, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            range.local(local_range, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+
+            context.run(range, sum_blocks, args, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+
+        DAAL_CHECK_STATUS(st, generateUniform(randoms, nRows, engine));
+
+        {
+            KernelArguments args(6);
+            args.set(0, minDist, AccessModeIds::read);
+            args.set(1, total, AccessModeIds::read);
+            args.set(2, randoms, AccessModeIds::read);
+            args.set(3, mask, AccessModeIds::write);
+            args.set(4, nRows);
+            args.set(5, L);
+
+            KernelRange global_range(nBlocks * _maxWorkItemsPerGroup);
+            context.run(global_range, sample_candidates, args, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+
+        size_t nSampled = 0;
+        DAAL_CHECK_STATUS(st, Partition::flagged(mask, rowIndices, sampled, nRows, nSampled));
+        if (nSampled == 0) continue;
+
+        context.copy(candidates, nCandidates, sampled, 0, nSampled, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        updateMinDistances(context, data, candidates, minDist, nearest, blockSums, noWeights, false, nRows, nFeatures, nCandidates, nSampled,
+                           false, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        nCandidates += nSampled;
+    }
+
+    auto gather_random = kernel_factory.getKernel("gather_random");
+
+    auto centroidIndices = context.allocate(TypeIds::id<int>(), nClusters, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    if (nCandidates < nClusters)
+    {
+        /* Too few candidates are sampled, so the centroids are chosen from all the rows */
+        DAAL_CHECK_STATUS(st, computePlusPlus(context, data, noWeights, false, nRows, nFeatures, nClusters, engine, centroidIndices));
+        gatherRandom(context, gather_random, data, clusters, centroidIndices, nRows, nClusters, nFeatures, &st);
+        return st;
+    }
+
+    auto weights = context.allocate(TypeIds::id<int>(), nCandidates, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    context.fill(weights, 0.0, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    {
+        auto count_nearest = kernel_factory.getKernel("count_nearest");
+
+        KernelArguments args(3);
+        args.set(0, nearest, AccessModeIds::read);
+        args.set(1, weights, AccessModeIds::readwrite);
+        args.set(2, nRows);
+
+        KernelRange global_range(nBlocks * _maxWorkItemsPerGroup);
+        context.run(global_range, count_nearest, args, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    auto candidateData = context.allocate(TypeIds::id<algorithmFPType>(), nCandidates * nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    const auto candidateBuffer = candidateData.get<algorithmFPType>();
+
+    gatherRandom(context, gather_random, data, candidateBuffer, candidates, nRows, nCandidates, nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    DAAL_CHECK_STATUS(st, computePlusPlus(context, candidateBuffer, weights, true, nCandidates, nFeatures, nClusters, engine, centroidIndices));
+
+    gatherRandom(context, gather_random, candidateBuffer, clusters, centroidIndices, nCandidates, nClusters, nFeatures, &st);
+    return st;
+}
+
+template <Method method, typename algorithmFPType>
+void KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::initMinDistances(ExecutionContextIface & context, UniversalBuffer & minDist,
+                                                                                UniversalBuffer & blockSums, UniversalBuffer & weights,
+                                                                                bool hasWeights, uint32_t nRows, Status * st)
+{
+    auto & kernel_factory   = context.getClKernelFactory();
+    auto init_min_distances = kernel_factory.getKernel("init_min_distances");
+
+    KernelArguments args(5);
+    args.set(0, minDist, AccessModeIds::write);
+    args.set(1, blockSums, AccessModeIds::write);
+    /* The weights are not read by the kernel without them, so the minimal distances are passed instead */
+    if (hasWeights)
+    {
+        args.set(2, weights, AccessModeIds::read);
+    }
+    else
+    {
+        args.set(2, minDist, AccessModeIds::read);
+    }
+    args.set(3, nRows);
+    args.set(4, (int)hasWeights);
+
+    KernelRange local_range(_maxWorkItemsPerGroup);
+    KernelRange global_range(getWorkgroupsCount(nRows) * _maxWorkItemsPerGroup);
+
+    KernelNDRange range(1);
+    range.global(global_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+    range.local(local_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+
+    context.run(range, init_min_distances, args, st);
+}
+
+template <Method method, typename algorithmFPType>
+void KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::updateMinDistances(
+    ExecutionContextIface & context, const services::internal::Buffer<algorithmFPType> & data, UniversalBuffer & indices, UniversalBuffer & minDist,
+    UniversalBuffer & nearest, UniversalBuffer & blockSums, UniversalBuffer & weights, bool hasWeights, uint32_t nRows, uint32_t nFeatures,
+    uint32_t first, uint32_t count, bool isFirst, Status * st)
+{
+    auto & kernel_factory     = context.getClKernelFactory();
+    auto update_min_distances = kernel_factory.getKernel("update_min_distances");
+
+    KernelArguments args(12);
+    args.set(0, data, AccessModeIds::read);
+    args.set(1, indices, AccessModeIds::read);
+    args.set(2, minDist, AccessModeIds::readwrite);
+    args.set(3, nearest, AccessModeIds::readwrite);
+    args.set(4, blockSums, AccessModeIds::write);
+    if (hasWeights)
+    {
+        args.set(5, weights, AccessModeIds::read);
+    }
+    else
+    {
+        args.set(5, nearest, AccessModeIds::read);
+    }
+    args.set(6, nRows);
+    args.set(7, nFeatures);
+    args.set(8, first);
+    args.set(9, count);
+    args.set(10, (int)hasWeights);
+    args.set(11, (int)isFirst);
+
+    KernelRange local_range(_maxWorkItemsPerGroup);
+    KernelRange global_range(getWorkgroupsCount(nRows) * _maxWorkItemsPerGroup);
+
+    KernelNDRange range(1);
+    range.global(global_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+    range.local(local_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+
+    context.run(range, update_min_distances, args, st);
+}
+
+template <Method method, typename algorithmFPType>
+void KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::selectWeighted(ExecutionContextIface & context, UniversalBuffer & minDist,
+                                                                              UniversalBuffer & blockSums, UniversalBuffer & randoms,
+                                                                              UniversalBuffer & indices, uint32_t nRows, uint32_t iter, Status * st)
+{
+    auto & kernel_factory = context.getClKernelFactory();
+    auto select_weighted  = kernel_factory.getKernel("select_weighted");
+
+    KernelArguments args(7);
+    args.set(0, minDist, AccessModeIds::read);
+    args.set(1, blockSums, AccessModeIds::read);
+    args.set(2, randoms, AccessModeIds::read);
+    args.set(3, indices, AccessModeIds::readwrite);
+    args.set(4, nRows);
+    args.set(5, getWorkgroupsCount(nRows));
+    args.set(6, iter);
+
+    KernelRange local_range(_maxWorkItemsPerGroup);
+
+    KernelNDRange range(1);
+    range.global(local_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+    range.local(local_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+
+    context.run(range, select_weighted, args, st);
+}
+
+template <Method method, typename algorithmFPType>
+Status KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::generateUniform(UniversalBuffer & randoms, size_t n, engines::BatchBase & engine)
+{
+    Status st;
+    auto randomsHostPtr = randoms.get<algorithmFPType>().toHost(data_management::writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_MALLOC(randomsHostPtr.get());
+    return UniformKernelDefault<algorithmFPType, sse2>::compute(algorithmFPType(0), algorithmFPType(1), engine, n, randomsHostPtr.get());
+}
+
 template <Method method, typename algorithmFPType>
 services::Status KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::compute(size_t na, const NumericTable * const * a, size_t nr,
                                                                                    const NumericTable * const * r, const Parameter * par,
@@ -156,7 +512,9 @@ services::Status KMeansInitDenseBatchKernelUCAPI<method, algorithmFPType>::compu
 
     size_t clustersFound = 0;
 
-    return init(p, n, n, nClusters, ntClusters, ntData, par->seed, engine, clustersFound);
+    DAAL_CHECK(method != plusPlusDense || par->nTrials == 1, ErrorMethodNotImplemented);
+
+    return init(p, n, n, nClusters, ntClusters, ntData, par, engine, clustersFound);
 }
 
 template <Method method, typename algorithmFPType>
@@ -149,7 +149,7 @@ Status KMeansDistributedStep1KernelUCAPI<algorithmFPType>::compute(size_t na, co
             bool hasEmptyClusters = numEmpty > 0;
             if (hasEmptyClusters)
             {
-                this->computePartialCandidates(assignments, range.count, nClusters, int(block == 0), &st);
+                this->computePartialCandidates(assignments, range.count, nClusters, int(block == 0), range.startIndex, &st);
                 DAAL_CHECK_STATUS_VAR(st);
                 this->mergePartialCandidates(nClusters, &st);
                 DAAL_CHECK_STATUS_VAR(st);
@@ -31,6 +31,8 @@
 #include "src/algorithms/lasso_regression/lasso_regression_model_impl.h"
 #include "algorithms/optimization_solver/sgd/sgd_batch.h"
 #include "src/services/service_algo_utils.h"
+#include "services/internal/execution_context.h"
+#include "src/algorithms/linear_model/oneapi/linear_model_train_cd_kernel_oneapi.h"
 
 namespace daal
 {
@@ -63,6 +65,17 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     lasso_regression::Model * m                       = result->get(model).get();
     const lasso_regression::training::Parameter * par = static_cast<lasso_regression::training::Parameter *>(_par);
     daal::services::Environment::env & env            = *_env;
+
+    /* The default solver is run on GPU over the Gram matrix of the data, the solvers of the user and the Gram matrix
+       in the result are computed by the CPU kernel */
+    typedef linear_model::coordinate_descent::training::internal::TrainBatchKernelOneAPI<algorithmFPType> GpuKernelType;
+    auto & deviceInfo = services::internal::getDefaultContext().getInfoDevice();
+    if (!deviceInfo.isCpu && !par->optimizationSolver && !(par->optResultToCompute & computeGramMatrix)
+        && GpuKernelType::isSupported(x->getNumberOfColumns()))
+    {
+        return GpuKernelType::compute(*x, *y, *m->getBeta(), par->lassoParameters.get(), nullptr, par->interceptFlag);
+    }
+
     services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> > objFunc(
         new daal::algorithms::optimization_solver::mse::Batch<algorithmFPType>(x->getNumberOfRows()));
     __DAAL_CALL_KERNEL(env, internal::TrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
@@ -122,9 +122,12 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(cons
         numBlocks++;
     }
 
+    /* The small inputs are predicted in the calling thread */
+    const size_t blockCost = numRowsInBlock * numResponses * (dataTable->getNumberOfColumns() + 1);
+
     SafeStatus safeStat;
     /* Loop over input data blocks */
-    daal::threader_for(numBlocks, numBlocks, [=, &safeStat](int iBlock) {
+    daal::threader_for(numBlocks, numBlocks, blockCost, [=, &safeStat](int iBlock) {
         size_t startRow = iBlock * numRowsInBlock;
         size_t endRow   = startRow + numRowsInBlock;
         if (endRow > numVectors)
@@ -195,6 +195,21 @@ public:
      */
     static Status compute(const NumericTable & x, const NumericTable & y, NumericTable & xtx, NumericTable & xty, bool initializeResult,
                           bool interceptFlag);
+
+protected:
+    /**
+     * Updates normal equations model with the new block of data in the CSR layout,
+     * it takes the memory proportional to the number of non-zero values of the block
+     * \param[in]  x               Input data set of size N x P in the CSR layout
+     * \param[in]  y               Input responses of size N x Ny
+     * \param[out] xtx             Array with the matrix \f$X'^T \times X'\f$ of size P' x P'
+     * \param[out] xty             Array with the matrix \f$X'^T \times Y\f$ of size Ny x P'
+     * \param[in]  nBetasIntercept P' - number of columns in the partial result
+     * \param[in]  nResponses      Ny - number of responses
+     * \return Status of the computations
+     */
+    static Status updateCSR(const NumericTable & x, const NumericTable & y, algorithmFPType * xtx, algorithmFPType * xty, DAAL_INT nBetasIntercept,
+                            DAAL_INT nResponses);
 };
 
 /**
@@ -217,16 +232,6 @@ public:
      * \return Status of the computations
      */
     static Status compute(size_t n, NumericTable ** partialxtx, NumericTable ** partialxty, NumericTable & xtx, NumericTable & xty);
-
-protected:
-    /**
-     * Adds input numeric table to the partial result
-     * \param[in]  partialTable       Numeric table with partial sums
-     * \param[out] result             Resulting array with full sums
-     * \param[in]  threadingCondition Flag. If true, then the operation is performed in parallel
-     * \return Status of the computations
-     */
-    static Status merge(const NumericTable & partialTable, algorithmFPType * result, bool threadingCondition);
 };
 
 } // namespace internal
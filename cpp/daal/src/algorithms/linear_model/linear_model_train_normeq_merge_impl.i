@@ -22,7 +22,7 @@
 */
 
 #include "src/algorithms/linear_model/linear_model_train_normeq_kernel.h"
-#include "src/threading/threading.h"
+#include "src/algorithms/service_partial_results_merge.h"
 
 namespace daal
 {
@@ -40,36 +40,7 @@ using namespace daal::services;
 using namespace daal::data_management;
 using namespace daal::internal;
 using namespace daal::services::internal;
-
-template <CpuType cpu, typename F>
-void conditional_threader_for(bool condition, size_t n, size_t threadsRequest, const F & processIteration)
-{
-    if (condition)
-    {
-        daal::threader_for(n, threadsRequest, processIteration);
-    }
-    else
-    {
-        for (size_t i = 0; i < n; i++)
-        {
-            processIteration(i);
-        }
-    }
-}
-
-template <typename algorithmFPType, CpuType cpu>
-Status MergeKernel<algorithmFPType, cpu>::merge(const NumericTable & partialTable, algorithmFPType * result, bool threadingCondition)
-{
-    const size_t nRows = partialTable.getNumberOfRows();
-
-    ReadRowsType block(const_cast<NumericTable &>(partialTable), 0, nRows);
-    DAAL_CHECK_BLOCK_STATUS(block);
-    algorithmFPType * partialResult = const_cast<algorithmFPType *>(block.get());
-
-    size_t resultSize = nRows * partialTable.getNumberOfColumns();
-    conditional_threader_for<cpu>(threadingCondition, resultSize, resultSize, [=](size_t i) { result[i] += partialResult[i]; });
-    return Status();
-}
+using namespace daal::algorithms::internal;
 
 template <typename algorithmFPType, CpuType cpu>
 Status MergeKernel<algorithmFPType, cpu>::compute(size_t n, NumericTable ** partialxtx, NumericTable ** partialxty, NumericTable & xtxTable,
@@ -86,19 +57,20 @@ Status MergeKernel<algorithmFPType, cpu>::compute(size_t n, NumericTable ** part
     DAAL_CHECK_BLOCK_STATUS(xtyBlock);
     algorithmFPType * xty = xtyBlock.get();
 
-    service_memset<algorithmFPType, cpu>(xtx, 0, nBetas * nBetas);
-    service_memset<algorithmFPType, cpu>(xty, 0, nBetas * nResponses);
+    PartialTablesReader<algorithmFPType, cpu> xtxPartials(n);
+    PartialTablesReader<algorithmFPType, cpu> xtyPartials(n);
+    DAAL_CHECK_MALLOC(xtxPartials.isValid() && xtyPartials.isValid());
 
-    const size_t minThreadingSize = 512 * 1024;
     Status st;
     for (size_t i = 0; i < n; i++)
     {
-        st |= MergeKernel<algorithmFPType, cpu>::merge(*partialxtx[i], xtx, nBetas * nBetas * sizeof(algorithmFPType) > minThreadingSize);
-        DAAL_CHECK_STATUS_VAR(st);
-        st |= MergeKernel<algorithmFPType, cpu>::merge(*partialxty[i], xty, nBetas * nResponses * sizeof(algorithmFPType) > minThreadingSize);
-        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK_STATUS(st, xtxPartials.set(i, *partialxtx[i]));
+        DAAL_CHECK_STATUS(st, xtyPartials.set(i, *partialxty[i]));
     }
-    return st;
+
+    /* The partial results are added pairwise with the blocks of the result merged in parallel */
+    DAAL_CHECK_STATUS(st, (pairwiseSum<algorithmFPType, cpu>(n, xtxPartials.get(), nBetas * nBetas, xtx)));
+    return pairwiseSum<algorithmFPType, cpu>(n, xtyPartials.get(), nBetas * nResponses, xty);
 }
 
 } // namespace internal
@@ -23,6 +23,7 @@
 
 #include "src/algorithms/linear_model/linear_model_train_normeq_kernel.h"
 #include "src/externals/service_blas.h"
+#include "src/externals/service_spblas.h"
 #include "src/algorithms/service_error_handling.h"
 #include "src/threading/threading.h"
 #include "src/externals/service_ittnotify.h"
@@ -190,6 +191,11 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
         service_memset<algorithmFPType, cpu>(xty, 0, nResponses * nBetasIntercept);
     }
 
+    if (xTable.getDataLayout() == NumericTableIface::csrArray)
+    {
+        return updateCSR(xTable, yTable, xtx, xty, nBetasIntercept, nResponses);
+    }
+
     /* Split rows by blocks */
     size_t nRowsInBlock = 128;
 
@@ -199,13 +205,13 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
         nBlocks++;
     }
 
-    /* Create TLS */
-    daal::tls<ThreadingTaskType *> tls([=]() -> ThreadingTaskType * { return ThreadingTaskType::create(nBetasIntercept, nResponses); });
+    /* Create TLS, by the fixed chunks of the blocks summed in their order in the deterministic mode */
+    const size_t partialSize = (nBetasIntercept * nBetasIntercept + nBetasIntercept * nResponses) * sizeof(algorithmFPType);
+    daal::blocked_tls<ThreadingTaskType *> tls([=]() -> ThreadingTaskType * { return ThreadingTaskType::create(nBetasIntercept, nResponses); },
+                                               __daal_serv_is_deterministic(), daal::ordered_tls_chunk_count(partialSize));
 
     SafeStatus safeStat;
-    daal::threader_for(nBlocks, nBlocks, [=, &tls, &xTable, &yTable, &safeStat](int iBlock) {
-        ThreadingTaskType * tlsLocal = tls.local();
-
+    tls.for_blocks(nBlocks, [=, &xTable, &yTable, &safeStat](int iBlock, ThreadingTaskType * tlsLocal) {
         if (!tlsLocal)
         {
             safeStat.add(services::ErrorMemoryAllocationFailed);
@@ -233,6 +239,88 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable & xTable,
     return st;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status UpdateKernel<algorithmFPType, cpu>::updateCSR(const NumericTable & xTable, const NumericTable & yTable, algorithmFPType * xtx,
+                                                     algorithmFPType * xty, DAAL_INT nBetasIntercept, DAAL_INT nResponses)
+{
+    DAAL_INT nRows(xTable.getNumberOfRows());
+    DAAL_INT nFeatures(xTable.getNumberOfColumns());
+
+    CSRNumericTableIface * csrTable = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&xTable));
+    DAAL_CHECK(csrTable, ErrorIncorrectTypeOfInputNumericTable);
+
+    ReadRowsCSR<algorithmFPType, cpu> xBlock(csrTable, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xBlock);
+    const algorithmFPType * x = xBlock.values();
+    const size_t * colIdx     = xBlock.cols();
+    const size_t * rowIdx     = xBlock.rows();
+
+    ReadRowsType yBlock(const_cast<NumericTable &>(yTable), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yBlock);
+    const algorithmFPType * y = yBlock.get();
+
+    Status st;
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.syrkX);
+        st = SpBlas<algorithmFPType, cpu>::xsyrk_at_a(x, colIdx, rowIdx, nRows, nFeatures, xtx, nBetasIntercept);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    const char transa       = 'T';
+    const char matdescra[6] = { 'G', 0, 0, 'F', 0, 0 };
+    const algorithmFPType one(1.0);
+
+    /* The column sums of X are the products of X^T with the vector of 1's */
+    TArray<algorithmFPType, cpu> onesArray;
+    if (nFeatures < nBetasIntercept)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.gemm1X);
+        onesArray.reset(nRows);
+        algorithmFPType * ones = onesArray.get();
+        DAAL_CHECK_MALLOC(ones);
+        service_memset<algorithmFPType, cpu>(ones, one, nRows);
+
+        algorithmFPType * xtxPtr = xtx + nFeatures * nBetasIntercept;
+        SpBlas<algorithmFPType, cpu>::xcsrmv(&transa, &nRows, &nFeatures, &one, matdescra, x, (const DAAL_INT *)colIdx, (const DAAL_INT *)rowIdx,
+                                             (const DAAL_INT *)rowIdx + 1, ones, &one, xtxPtr);
+        xtxPtr[nFeatures] += algorithmFPType(nRows);
+    }
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.gemmXY);
+        TArray<algorithmFPType, cpu> yColumnArray(nResponses > 1 ? nRows : 0);
+        algorithmFPType * yColumn = yColumnArray.get();
+        DAAL_CHECK_MALLOC(nResponses == 1 || yColumn);
+
+        for (DAAL_INT j = 0; j < nResponses; j++)
+        {
+            if (nResponses > 1)
+            {
+                for (DAAL_INT i = 0; i < nRows; i++)
+                {
+                    yColumn[i] = y[i * nResponses + j];
+                }
+            }
+            SpBlas<algorithmFPType, cpu>::xcsrmv(&transa, &nRows, &nFeatures, &one, matdescra, x, (const DAAL_INT *)colIdx, (const DAAL_INT *)rowIdx,
+                                                 (const DAAL_INT *)rowIdx + 1, (nResponses > 1 ? yColumn : y), &one, xty + j * nBetasIntercept);
+        }
+    }
+
+    if (nFeatures < nBetasIntercept)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.gemm1Y);
+        const algorithmFPType * yPtr = y;
+        for (DAAL_INT i = 0; i < nRows; i++, yPtr += nResponses)
+        {
+            for (DAAL_INT j = 0; j < nResponses; j++)
+            {
+                xty[j * nBetasIntercept + nFeatures] += yPtr[j];
+            }
+        }
+    }
+    return st;
+}
+
 } // namespace internal
 } // namespace training
 } // namespace normal_equations
@@ -23,6 +23,9 @@
 
 #include "src/algorithms/linear_model/linear_model_train_qr_kernel.h"
 #include "src/externals/service_lapack.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/threading/threading.h"
 
 namespace daal
 {
@@ -45,11 +48,11 @@ template <typename algorithmFPType, CpuType cpu>
 Status MergeKernel<algorithmFPType, cpu>::compute(size_t n, NumericTable ** partialr, NumericTable ** partialqty, NumericTable & rTable,
                                                   NumericTable & qtyTable)
 {
-    size_t nBetas(rTable.getNumberOfRows());
-    size_t nBetas2(2 * nBetas);
-    size_t nResponses(qtyTable.getNumberOfRows());
-    Status st;
-    int result = 0;
+    const size_t nBetas(rTable.getNumberOfRows());
+    const size_t nBetas2(2 * nBetas);
+    const size_t nResponses(qtyTable.getNumberOfRows());
+    const size_t rSize(nBetas * nBetas);
+    const size_t qtySize(nResponses * nBetas);
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBetas, 2);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBetas, nBetas2);
@@ -57,59 +60,76 @@ Status MergeKernel<algorithmFPType, cpu>::compute(size_t n, NumericTable ** part
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nResponses, nBetas2);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nResponses * nBetas2, sizeof(algorithmFPType));
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBetas, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, rSize + qtySize);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * (rSize + qtySize), sizeof(algorithmFPType));
 
-    TArray<algorithmFPType, cpu> rMerge(nBetas * nBetas2);
-    DAAL_CHECK_MALLOC(rMerge.get());
-
-    TArray<algorithmFPType, cpu> qtyMerge(nResponses * nBetas2);
-    DAAL_CHECK_MALLOC(qtyMerge.get());
+    DAAL_INT lwork;
+    Status st = CommonKernel<algorithmFPType, cpu>::computeWorkSize(nBetas2, nBetas, nResponses, lwork);
+    DAAL_CHECK_STATUS_VAR(st);
 
-    TArray<algorithmFPType, cpu> tau(nBetas);
-    DAAL_CHECK_MALLOC(tau.get());
+    /* The partial results are merged pairwise along a binary tree, the node k of the level l is kept
+     * in the slot k << l, so the pairs of one level write to disjoint slots and are merged in parallel */
+    TArrayScalable<algorithmFPType, cpu> rAll(n * rSize);
+    TArrayScalable<algorithmFPType, cpu> qtyAll(n * qtySize);
+    DAAL_CHECK_MALLOC(rAll.get() && qtyAll.get());
+
+    SafeStatus safeStat;
+    daal::threader_for(n, n, [&](size_t i) {
+        ReadRowsType rBlock(partialr[i], 0, nBetas);
+        DAAL_CHECK_BLOCK_STATUS_THR(rBlock);
+        ReadRowsType qtyBlock(partialqty[i], 0, nResponses);
+        DAAL_CHECK_BLOCK_STATUS_THR(qtyBlock);
+
+        const size_t rSizeInBytes   = rSize * sizeof(algorithmFPType);
+        const size_t qtySizeInBytes = qtySize * sizeof(algorithmFPType);
+        int result                  = 0;
+        result |= daal::services::internal::daal_memcpy_s(rAll.get() + i * rSize, rSizeInBytes, rBlock.get(), rSizeInBytes);
+        result |= daal::services::internal::daal_memcpy_s(qtyAll.get() + i * qtySize, qtySizeInBytes, qtyBlock.get(), qtySizeInBytes);
+        DAAL_CHECK_THR(!result, ErrorMemoryCopyFailedInternal);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Scratch of a merge: R12 [2P][P], QTY12 [2P][Ny], tau [P] and the LAPACK work buffer */
+    const size_t scratchSize = 2 * rSize + 2 * qtySize + nBetas + lwork;
+    daal::TlsMem<algorithmFPType, cpu> tlsScratch(scratchSize);
+
+    for (size_t step = 1; step < n; step *= 2)
+    {
+        const size_t nPairs = (n + step - 1) / (2 * step);
+        daal::threader_for(nPairs, nPairs, [&](size_t iPair) {
+            algorithmFPType * scratch = tlsScratch.local();
+            DAAL_CHECK_THR(scratch, ErrorMemoryAllocationFailed);
+
+            algorithmFPType * rMerge   = scratch;
+            algorithmFPType * qtyMerge = rMerge + 2 * rSize;
+            algorithmFPType * tau      = qtyMerge + 2 * qtySize;
+            algorithmFPType * work     = tau + nBetas;
+
+            const size_t k1              = iPair * 2 * step;
+            const size_t k2              = k1 + step;
+            algorithmFPType * r1         = rAll.get() + k1 * rSize;
+            algorithmFPType * qty1       = qtyAll.get() + k1 * qtySize;
+            const algorithmFPType * r2   = rAll.get() + k2 * rSize;
+            const algorithmFPType * qty2 = qtyAll.get() + k2 * qtySize;
+
+            const Status mergeStatus =
+                CommonKernel<algorithmFPType, cpu>::merge(nBetas, nResponses, r2, qty2, r1, qty1, rMerge, qtyMerge, r1, qty1, tau, work, lwork);
+            DAAL_CHECK_STATUS_THR(mergeStatus);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
 
     WriteRowsType rFinalBlock(rTable, 0, nBetas);
     DAAL_CHECK_BLOCK_STATUS(rFinalBlock);
-    algorithmFPType * rFinal = rFinalBlock.get();
-
     WriteRowsType qtyFinalBlock(qtyTable, 0, nResponses);
     DAAL_CHECK_BLOCK_STATUS(qtyFinalBlock);
-    algorithmFPType * qtyFinal = qtyFinalBlock.get();
-
-    ReadRowsType rBlock(partialr[0], 0, nBetas);
-    DAAL_CHECK_BLOCK_STATUS(rBlock);
-    const algorithmFPType * r = rBlock.get();
-
-    ReadRowsType qtyBlock(partialqty[0], 0, nResponses);
-    DAAL_CHECK_BLOCK_STATUS(qtyBlock);
-    const algorithmFPType * qty = qtyBlock.get();
-
-    const size_t rSizeInBytes   = nBetas * nBetas * sizeof(algorithmFPType);
-    const size_t qtySizeInBytes = nResponses * nBetas * sizeof(algorithmFPType);
-    result |= daal::services::internal::daal_memcpy_s(rFinal, rSizeInBytes, r, rSizeInBytes);
-    result |= daal::services::internal::daal_memcpy_s(qtyFinal, qtySizeInBytes, qty, qtySizeInBytes);
 
-    DAAL_INT lwork;
-    st = (!result) ? CommonKernel<algorithmFPType, cpu>::computeWorkSize(nBetas2, nBetas, nResponses, lwork) : Status(ErrorMemoryCopyFailedInternal);
-    DAAL_CHECK_STATUS_VAR(st);
-
-    TArray<algorithmFPType, cpu> work(lwork);
-    DAAL_CHECK_MALLOC(work.get());
-
-    for (size_t i = 1; i < n; i++)
-    {
-        rBlock.set(partialr[i], 0, nBetas);
-        DAAL_CHECK_BLOCK_STATUS(rBlock);
-        r = rBlock.get();
-
-        qtyBlock.set(partialqty[i], 0, nResponses);
-        DAAL_CHECK_BLOCK_STATUS(qtyBlock);
-        qty = qtyBlock.get();
-
-        st |= CommonKernel<algorithmFPType, cpu>::merge(nBetas, nResponses, r, qty, rFinal, qtyFinal, rMerge.get(), qtyMerge.get(), rFinal, qtyFinal,
-                                                        tau.get(), work.get(), lwork);
-        DAAL_CHECK_STATUS_VAR(st);
-    }
-    return st;
+    const size_t rSizeInBytes   = rSize * sizeof(algorithmFPType);
+    const size_t qtySizeInBytes = qtySize * sizeof(algorithmFPType);
+    int result                  = 0;
+    result |= daal::services::internal::daal_memcpy_s(rFinalBlock.get(), rSizeInBytes, rAll.get(), rSizeInBytes);
+    result |= daal::services::internal::daal_memcpy_s(qtyFinalBlock.get(), qtySizeInBytes, qtyAll.get(), qtySizeInBytes);
+    return (!result) ? st : Status(ErrorMemoryCopyFailedInternal);
 }
 
 } // namespace internal
@@ -0,0 +1,158 @@
+/* file: coordinate_descent_gram.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the kernels of the coordinate descent over the Gram matrix.
+//--
+*/
+
+#ifndef __COORDINATE_DESCENT_GRAM_CL__
+#define __COORDINATE_DESCENT_GRAM_CL__
+
+#include <string.h>
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    clKernelCoordinateDescentGram,
+
+    /* The upper triangle of X'X of the data with the optional column of 1's, centered if intercept is computed */
+    __kernel void computeGram(const __global algorithmFPType * xtx, uint nBetas, uint nFeatures, uint intercept, __global algorithmFPType * gram) {
+        const uint i = get_global_id(0);
+        const uint j = get_global_id(1);
+
+        algorithmFPType value = (i <= j) ? xtx[i * nBetas + j] : xtx[j * nBetas + i];
+        if (intercept == 1)
+        {
+            const __global algorithmFPType * sums = xtx + nFeatures * nBetas;
+            value -= sums[i] * sums[j] / sums[nFeatures];
+        }
+        gram[i * nFeatures + j] = value;
+    }
+
+    /* The correlations X'(y - X * beta) of the zero coefficients */
+    __kernel void initCorrelations(const __global algorithmFPType * xtx, const __global algorithmFPType * xty, uint nBetas, uint nFeatures,
+                                   uint intercept, __global algorithmFPType * correlations, __global algorithmFPType * beta) {
+        const uint r = get_global_id(0);
+        const uint j = get_global_id(1);
+
+        algorithmFPType value = xty[r * nBetas + j];
+        if (intercept == 1)
+        {
+            const __global algorithmFPType * sums = xtx + nFeatures * nBetas;
+            value -= sums[j] * xty[r * nBetas + nFeatures] / sums[nFeatures];
+        }
+        correlations[r * nFeatures + j] = value;
+        beta[r * nFeatures + j]         = (algorithmFPType)0;
+    }
+
+    /* The work group updates the coefficients of one response in turn, its work items update the correlations with the
+       column of the Gram matrix of the updated coefficient. The sweep goes over all the coefficients or the active ones,
+       which are non-zero after the last full sweep */
+    __kernel void sweep(const __global algorithmFPType * gram, __global algorithmFPType * correlations, __global algorithmFPType * beta,
+                        __global int * activeIds, __global int * activeCounts, __global algorithmFPType * stats, uint nFeatures,
+                        algorithmFPType invNRows, algorithmFPType l1, algorithmFPType l2, uint fullSweep) {
+        const uint r          = get_group_id(0);
+        const uint local_id   = get_local_id(0);
+        const uint local_size = get_local_size(0);
+
+        __global algorithmFPType * c = correlations + r * nFeatures;
+        __global algorithmFPType * b = beta + r * nFeatures;
+        __global int * active        = activeIds + r * nFeatures;
+
+        const uint count = (fullSweep == 1) ? nFeatures : (uint)activeCounts[r];
+
+        algorithmFPType maxDiff  = (algorithmFPType)0;
+        algorithmFPType maxValue = (algorithmFPType)0;
+        for (uint k = 0; k < count; k++)
+        {
+            const uint j                  = (fullSweep == 1) ? k : (uint)active[k];
+            const algorithmFPType hessian = gram[j * nFeatures + j] * invNRows;
+            const algorithmFPType prev    = b[j];
+
+            algorithmFPType next = prev;
+            if (hessian != (algorithmFPType)0)
+            {
+                const algorithmFPType z = c[j] * invNRows + hessian * prev;
+                const algorithmFPType s = (z > l1) ? z - l1 : ((z < -l1) ? z + l1 : (algorithmFPType)0);
+                next                    = s / (hessian + l2);
+            }
+            const algorithmFPType delta = next - prev;
+            barrier(CLK_GLOBAL_MEM_FENCE);
+
+            if (delta != (algorithmFPType)0)
+            {
+                for (uint i = local_id; i < nFeatures; i += local_size)
+                {
+                    c[i] -= gram[j * nFeatures + i] * delta;
+                }
+            }
+            if (local_id == 0)
+            {
+                b[j]     = next;
+                maxDiff  = fmax(maxDiff, fabs(delta));
+                maxValue = fmax(maxValue, fabs(next));
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+
+        if (local_id == 0)
+        {
+            stats[2 * r]     = maxDiff;
+            stats[2 * r + 1] = maxValue;
+            if (fullSweep == 1)
+            {
+                int nActive = 0;
+                for (uint j = 0; j < nFeatures; j++)
+                {
+                    if (b[j] != (algorithmFPType)0) active[nActive++] = j;
+                }
+                activeCounts[r] = nActive;
+            }
+        }
+    }
+
+    /* The coefficients of the model with the intercept computed from the means of the data */
+    __kernel void copyBeta(const __global algorithmFPType * xtx, const __global algorithmFPType * xty, const __global algorithmFPType * beta,
+                           uint nBetas, uint nFeatures, uint intercept, __global algorithmFPType * dst) {
+        const uint r = get_global_id(0);
+        const uint j = get_global_id(1);
+
+        if (j > 0)
+        {
+            dst[r * (nFeatures + 1) + j] = beta[r * nFeatures + j - 1];
+        }
+        else if (intercept == 1)
+        {
+            const __global algorithmFPType * sums = xtx + nFeatures * nBetas;
+            algorithmFPType value                 = xty[r * nBetas + nFeatures];
+            for (uint k = 0; k < nFeatures; k++)
+            {
+                value -= sums[k] * beta[r * nFeatures + k];
+            }
+            dst[r * (nFeatures + 1)] = value / sums[nFeatures];
+        }
+        else
+        {
+            dst[r * (nFeatures + 1)] = (algorithmFPType)0;
+        }
+    }
+
+);
+
+#endif // __COORDINATE_DESCENT_GRAM_CL__
@@ -0,0 +1,53 @@
+/* file: qr_update.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of the QR method update kernels.
+//--
+*/
+
+#ifndef __QR_UPDATE_CL__
+#define __QR_UPDATE_CL__
+
+#include <string.h>
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    clKernelQRUpdate,
+
+    // Copies the rows of the data and appends the column of 1's for the intercept term
+    __kernel void copyDataWithIntercept(const __global algorithmFPType * x, uint nCols, __global algorithmFPType * dst, uint dstOffset,
+                                        uint nBetasIntercept) {
+        const uint i = get_global_id(0);
+        const uint j = get_global_id(1);
+
+        dst[dstOffset + i * nBetasIntercept + j] = (j < nCols) ? x[i * nCols + j] : (algorithmFPType)1;
+    }
+
+    // Copies the triangular factor of the RQ decomposition, the elements above the
+    // diagonal hold the elementary reflectors and are replaced by zeros
+    __kernel void extractR(const __global algorithmFPType * a, uint offset, __global algorithmFPType * r, uint nBetasIntercept) {
+        const uint i = get_global_id(0);
+        const uint j = get_global_id(1);
+
+        r[i * nBetasIntercept + j] = (j <= i) ? a[offset + i * nBetasIntercept + j] : (algorithmFPType)0;
+    }
+
+);
+
+#endif // __QR_UPDATE_CL__
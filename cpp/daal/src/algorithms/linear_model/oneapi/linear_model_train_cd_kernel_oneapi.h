@@ -0,0 +1,84 @@
+/* file: linear_model_train_cd_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the coordinate descent training of the L1 and L2 penalized
+//  linear models on GPU.
+//--
+*/
+
+#ifndef __LINEAR_MODEL_TRAIN_CD_KERNEL_ONEAPI_H__
+#define __LINEAR_MODEL_TRAIN_CD_KERNEL_ONEAPI_H__
+
+#include "services/env_detect.h"
+#include "data_management/data/numeric_table.h"
+#include "src/data_management/service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_model
+{
+namespace coordinate_descent
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Trains the linear model with the penalty
+ *      l1 * |beta|_1 + l2 * |beta|^2 / 2
+ * of the mean squared error by the coordinate descent over the Gram matrix X'X of the data. The only pass over the data
+ * computes X'X and X'Y by the normal equations kernel, then the coordinate descent updates the correlations X'(Y - X * beta)
+ * by the columns of X'X on the device, so the host reads only the convergence measures of the sweeps
+ */
+template <typename algorithmFPType>
+class TrainBatchKernelOneAPI
+{
+public:
+    /** The largest number of the features of the Gram matrix kept on the device */
+    static const size_t maxNFeatures = 4096;
+
+    static bool isSupported(const size_t nFeatures) { return nFeatures <= maxNFeatures; }
+
+    /**
+     * Computes the regression coefficients
+     * \param[in]  x            Input data set of size N x P
+     * \param[in]  y            Input responses of size N x Ny
+     * \param[out] beta         Matrix with regression coefficients of size Ny x (P + 1)
+     * \param[in]  penaltyL1    Table with the L1 penalty in the first value, no penalty if it is null
+     * \param[in]  penaltyL2    Table with the L2 penalty in the first value, no penalty if it is null
+     * \param[in]  interceptFlag    Flag. True if intercept term is not zero, false otherwise
+     * \return Status of the computations
+     */
+    static services::Status compute(NumericTable & x, NumericTable & y, NumericTable & beta, NumericTable * penaltyL1, NumericTable * penaltyL2,
+                                    bool interceptFlag);
+
+private:
+    static services::Status getPenalty(NumericTable * penalty, algorithmFPType & value);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace coordinate_descent
+} // namespace linear_model
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,265 @@
+/* file: linear_model_train_cd_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the coordinate descent training of the L1 and L2
+//  penalized linear models on GPU.
+//--
+*/
+
+#ifndef __LINEAR_MODEL_TRAIN_CD_ONEAPI_IMPL_I__
+#define __LINEAR_MODEL_TRAIN_CD_ONEAPI_IMPL_I__
+
+#include "src/algorithms/linear_model/oneapi/linear_model_train_cd_kernel_oneapi.h"
+#include "src/algorithms/linear_model/oneapi/linear_model_train_normeq_kernel_oneapi.h"
+#include "data_management/data/internal/numeric_table_sycl_homogen.h"
+#include "services/internal/execution_context.h"
+#include "src/externals/service_ittnotify.h"
+#include "src/algorithms/linear_model/oneapi/cl_kernel/coordinate_descent_gram.cl"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_model
+{
+namespace coordinate_descent
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::services::internal::sycl;
+
+template <typename algorithmFPType>
+services::Status TrainBatchKernelOneAPI<algorithmFPType>::getPenalty(NumericTable * penalty, algorithmFPType & value)
+{
+    services::Status status;
+    value = 0;
+    if (!penalty) return status;
+
+    BlockDescriptor<algorithmFPType> penaltyBlock;
+    DAAL_CHECK_STATUS(status, penalty->getBlockOfRows(0, 1, ReadWriteMode::readOnly, penaltyBlock));
+    value = penaltyBlock.getBlockPtr()[0];
+    return penalty->releaseBlockOfRows(penaltyBlock);
+}
+
+template <typename algorithmFPType>
+services::Status TrainBatchKernelOneAPI<algorithmFPType>::compute(NumericTable & x, NumericTable & y, NumericTable & beta, NumericTable * penaltyL1,
+                                                                  NumericTable * penaltyL2, bool interceptFlag)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeCoordinateDescent);
+    services::Status status;
+
+    /* The ones of the default coordinate descent solver of the CPU kernels */
+    const size_t maxIterations              = 10000;
+    const algorithmFPType accuracyThreshold = 0.00001;
+    const uint32_t maxWorkItemsPerGroup     = 256;
+
+    const size_t nRows      = x.getNumberOfRows();
+    const size_t nFeatures  = x.getNumberOfColumns();
+    const size_t nResponses = y.getNumberOfColumns();
+    const size_t nBetas     = interceptFlag ? nFeatures + 1 : nFeatures;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nBetas, nBetas);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nResponses, nBetas + 1);
+
+    algorithmFPType l1 = 0;
+    algorithmFPType l2 = 0;
+    DAAL_CHECK_STATUS(status, getPenalty(penaltyL1, l1));
+    DAAL_CHECK_STATUS(status, getPenalty(penaltyL2, l2));
+
+    ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    const TypeIds::Id idType       = TypeIds::id<algorithmFPType>();
+
+    /* X'X and X'Y of the data with the column of 1's, the sums of the data are the last row of X'X */
+    UniversalBuffer xtxBuf = ctx.allocate(idType, nBetas * nBetas, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ctx.fill(xtxBuf, 0.0, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer xtyBuf = ctx.allocate(idType, nResponses * nBetas, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ctx.fill(xtyBuf, 0.0, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    {
+        NumericTablePtr xtx = SyclHomogenNumericTable<algorithmFPType>::create(xtxBuf.get<algorithmFPType>(), nBetas, nBetas, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        NumericTablePtr xty = SyclHomogenNumericTable<algorithmFPType>::create(xtyBuf.get<algorithmFPType>(), nBetas, nResponses, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        typedef normal_equations::training::internal::UpdateKernelOneAPI<algorithmFPType> UpdateKernelType;
+        DAAL_CHECK_STATUS(status, UpdateKernelType::compute(x, y, *xtx, *xty, interceptFlag));
+    }
+
+    const services::String options = getKeyFPType<algorithmFPType>();
+    services::String cachekey("__daal_algorithms_linear_model_coordinate_descent_");
+    cachekey.add(options);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), clKernelCoordinateDescentGram, options.c_str(), &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    UniversalBuffer gram = ctx.allocate(idType, nFeatures * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer correlations = ctx.allocate(idType, nResponses * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer coefficients = ctx.allocate(idType, nResponses * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer activeIds = ctx.allocate(TypeIds::id<int>(), nResponses * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer activeCounts = ctx.allocate(TypeIds::id<int>(), nResponses, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer stats = ctx.allocate(idType, 2 * nResponses, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(computeCoordinateDescent.computeGram);
+        KernelPtr kernel = factory.getKernel("computeGram", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        KernelArguments args(5);
+        args.set(0, xtxBuf, AccessModeIds::read);
+        args.set(1, static_cast<uint32_t>(nBetas));
+        args.set(2, static_cast<uint32_t>(nFeatures));
+        args.set(3, static_cast<uint32_t>(interceptFlag));
+        args.set(4, gram, AccessModeIds::write);
+
+        KernelRange range(nFeatures, nFeatures);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    {
+        KernelPtr kernel = factory.getKernel("initCorrelations", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        KernelArguments args(7);
+        args.set(0, xtxBuf, AccessModeIds::read);
+        args.set(1, xtyBuf, AccessModeIds::read);
+        args.set(2, static_cast<uint32_t>(nBetas));
+        args.set(3, static_cast<uint32_t>(nFeatures));
+        args.set(4, static_cast<uint32_t>(interceptFlag));
+        args.set(5, correlations, AccessModeIds::write);
+        args.set(6, coefficients, AccessModeIds::write);
+
+        KernelRange range(nResponses, nFeatures);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    /* The sweeps over all the coefficients alternate with the sweeps over the active ones as in the CPU solver, the
+       convergence is checked on the host after every sweep */
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(computeCoordinateDescent.sweeps);
+        KernelPtr kernel = factory.getKernel("sweep", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        const uint32_t workItemsPerGroup = (nFeatures > maxWorkItemsPerGroup) ? maxWorkItemsPerGroup : nFeatures;
+        KernelRange localRange(workItemsPerGroup);
+        KernelRange globalRange(workItemsPerGroup * nResponses);
+        KernelNDRange range(1);
+        range.global(globalRange, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.local(localRange, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        const algorithmFPType invNRows = algorithmFPType(1.0) / algorithmFPType(nRows);
+
+        bool fullSweep = true;
+        bool allActive = false;
+        for (size_t itr = 0; itr < maxIterations; itr++)
+        {
+            KernelArguments args(11);
+            args.set(0, gram, AccessModeIds::read);
+            args.set(1, correlations, AccessModeIds::readwrite);
+            args.set(2, coefficients, AccessModeIds::readwrite);
+            args.set(3, activeIds, AccessModeIds::readwrite);
+            args.set(4, activeCounts, AccessModeIds::readwrite);
+            args.set(5, stats, AccessModeIds::write);
+            args.set(6, static_cast<uint32_t>(nFeatures));
+            args.set(7, invNRows);
+            args.set(8, l1);
+            args.set(9, l2);
+            args.set(10, static_cast<uint32_t>(fullSweep));
+
+            ctx.run(range, kernel, args, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+
+            algorithmFPType maxDiff  = 0;
+            algorithmFPType maxValue = 0;
+            {
+                auto statsHost = stats.get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+                DAAL_CHECK_STATUS_VAR(status);
+                for (size_t r = 0; r < nResponses; r++)
+                {
+                    maxDiff  = statsHost.get()[2 * r] > maxDiff ? statsHost.get()[2 * r] : maxDiff;
+                    maxValue = statsHost.get()[2 * r + 1] > maxValue ? statsHost.get()[2 * r + 1] : maxValue;
+                }
+            }
+
+            const bool converged = (maxDiff <= accuracyThreshold * maxValue);
+            if (fullSweep && converged)
+            {
+                break;
+            }
+            if (fullSweep)
+            {
+                auto activeCountsHost = activeCounts.get<int>().toHost(ReadWriteMode::readOnly, &status);
+                DAAL_CHECK_STATUS_VAR(status);
+                allActive = true;
+                for (size_t r = 0; r < nResponses; r++)
+                {
+                    allActive &= (static_cast<size_t>(activeCountsHost.get()[r]) == nFeatures);
+                }
+            }
+            fullSweep = converged || allActive;
+        }
+    }
+
+    {
+        BlockDescriptor<algorithmFPType> betaBlock;
+        DAAL_CHECK_STATUS(status, beta.getBlockOfRows(0, nResponses, ReadWriteMode::writeOnly, betaBlock));
+        services::internal::Buffer<algorithmFPType> betaBuf = betaBlock.getBuffer();
+
+        KernelPtr kernel = factory.getKernel("copyBeta", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        KernelArguments args(7);
+        args.set(0, xtxBuf, AccessModeIds::read);
+        args.set(1, xtyBuf, AccessModeIds::read);
+        args.set(2, coefficients, AccessModeIds::read);
+        args.set(3, static_cast<uint32_t>(nBetas));
+        args.set(4, static_cast<uint32_t>(nFeatures));
+        args.set(5, static_cast<uint32_t>(interceptFlag));
+        args.set(6, betaBuf, AccessModeIds::write);
+
+        KernelRange range(nResponses, nFeatures + 1);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        DAAL_CHECK_STATUS(status, beta.releaseBlockOfRows(betaBlock));
+    }
+
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace coordinate_descent
+} // namespace linear_model
+} // namespace algorithms
+} // namespace daal
+
+#endif
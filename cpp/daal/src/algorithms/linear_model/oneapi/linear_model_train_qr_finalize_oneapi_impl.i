@@ -0,0 +1,129 @@
+/* file: linear_model_train_qr_finalize_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of common base classes for QR decomposition model training on GPU.
+//--
+*/
+
+#include "src/algorithms/linear_model/oneapi/linear_model_train_qr_kernel_oneapi.h"
+#include "src/externals/service_lapack.h"
+#include "src/externals/service_ittnotify.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_model
+{
+namespace qr
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+
+template <typename algorithmFPType>
+services::Status FinalizeKernelOneAPI<algorithmFPType>::compute(NumericTable & rTable, NumericTable & qtyTable, NumericTable & rFinalTable,
+                                                                NumericTable & qtyFinalTable, NumericTable & betaTable, bool interceptFlag)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeFinalize);
+    services::Status status;
+
+    const DAAL_INT nBetas(betaTable.getNumberOfColumns());
+    const DAAL_INT nResponses(betaTable.getNumberOfRows());
+    const DAAL_INT nBetasIntercept = (interceptFlag ? nBetas : (nBetas - 1));
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nResponses, nBetasIntercept);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nResponses * nBetasIntercept, sizeof(algorithmFPType));
+
+    services::internal::TArray<algorithmFPType, sse2> betaBufferArray(nResponses * nBetasIntercept);
+    algorithmFPType * betaBuffer = betaBufferArray.get();
+    DAAL_CHECK_MALLOC(betaBuffer);
+
+    BlockDescriptor<algorithmFPType> rBlock;
+    BlockDescriptor<algorithmFPType> qtyBlock;
+    DAAL_CHECK_STATUS(status, rTable.getBlockOfRows(0, nBetasIntercept, ReadWriteMode::readOnly, rBlock));
+    DAAL_CHECK_STATUS(status, qtyTable.getBlockOfRows(0, nResponses, ReadWriteMode::readOnly, qtyBlock));
+    const algorithmFPType * r   = rBlock.getBlockPtr();
+    const algorithmFPType * qty = qtyBlock.getBlockPtr();
+
+    if (&rTable != &rFinalTable || &qtyTable != &qtyFinalTable)
+    {
+        BlockDescriptor<algorithmFPType> rFinalBlock;
+        BlockDescriptor<algorithmFPType> qtyFinalBlock;
+        DAAL_CHECK_STATUS(status, rFinalTable.getBlockOfRows(0, nBetasIntercept, ReadWriteMode::writeOnly, rFinalBlock));
+        DAAL_CHECK_STATUS(status, qtyFinalTable.getBlockOfRows(0, nResponses, ReadWriteMode::writeOnly, qtyFinalBlock));
+
+        const size_t rSizeInBytes(sizeof(algorithmFPType) * nBetasIntercept * nBetasIntercept);
+        const size_t qtySizeInBytes(sizeof(algorithmFPType) * nBetasIntercept * nResponses);
+
+        int result = 0;
+        result |= daal::services::internal::daal_memcpy_s(rFinalBlock.getBlockPtr(), rSizeInBytes, r, rSizeInBytes);
+        result |= daal::services::internal::daal_memcpy_s(qtyFinalBlock.getBlockPtr(), qtySizeInBytes, qty, qtySizeInBytes);
+
+        DAAL_CHECK_STATUS(status, rFinalTable.releaseBlockOfRows(rFinalBlock));
+        DAAL_CHECK_STATUS(status, qtyFinalTable.releaseBlockOfRows(qtyFinalBlock));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    }
+
+    for (size_t i = 0; i < nResponses; i++)
+    {
+        for (size_t j = 0; j < nBetasIntercept; j++)
+        {
+            betaBuffer[i * nBetasIntercept + j] = qty[j * nResponses + i];
+        }
+    }
+
+    /* Solve triangular linear system R'*beta = Y*Q' */
+    DAAL_INT info(0);
+    char up     = 'U';
+    char trans  = 'T';
+    char nodiag = 'N';
+    LapackAutoDispatch<algorithmFPType>::xtrtrs(&up, &trans, &nodiag, const_cast<DAAL_INT *>(&nBetasIntercept), const_cast<DAAL_INT *>(&nResponses),
+                                                const_cast<algorithmFPType *>(r), const_cast<DAAL_INT *>(&nBetasIntercept), betaBuffer,
+                                                const_cast<DAAL_INT *>(&nBetasIntercept), &info);
+
+    DAAL_CHECK_STATUS(status, rTable.releaseBlockOfRows(rBlock));
+    DAAL_CHECK_STATUS(status, qtyTable.releaseBlockOfRows(qtyBlock));
+    DAAL_CHECK(info == 0, services::ErrorLinearRegressionInternal);
+
+    BlockDescriptor<algorithmFPType> betaBlock;
+    DAAL_CHECK_STATUS(status, betaTable.getBlockOfRows(0, nResponses, ReadWriteMode::writeOnly, betaBlock));
+    algorithmFPType * beta = betaBlock.getBlockPtr();
+
+    /* The intercept term is the last column of R and the first column of beta */
+    for (size_t i = 0; i < nResponses; i++)
+    {
+        for (size_t j = 1; j < nBetas; j++)
+        {
+            beta[i * nBetas + j] = betaBuffer[i * nBetasIntercept + j - 1];
+        }
+        beta[i * nBetas] = (nBetasIntercept == nBetas) ? betaBuffer[i * nBetas + nBetas - 1] : algorithmFPType(0);
+    }
+
+    return betaTable.releaseBlockOfRows(betaBlock);
+}
+
+} // namespace internal
+} // namespace training
+} // namespace qr
+} // namespace linear_model
+} // namespace algorithms
+} // namespace daal
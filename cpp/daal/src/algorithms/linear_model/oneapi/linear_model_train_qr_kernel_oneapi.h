@@ -0,0 +1,110 @@
+/* file: linear_model_train_qr_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Declaration of common base classes for QR decomposition model training on GPU.
+//--
+*/
+
+#ifndef __LINEAR_MODEL_TRAIN_QR_KERNEL_ONEAPI_H__
+#define __LINEAR_MODEL_TRAIN_QR_KERNEL_ONEAPI_H__
+
+#include "services/env_detect.h"
+#include "data_management/data/numeric_table.h"
+#include "src/data_management/service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_model
+{
+namespace qr
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Implements the common part of the partial results update with new block of input data.
+ * The partial results have the same layout as on CPU, so the models trained on CPU and GPU
+ * can be merged and finalized by each other.
+ */
+template <typename algorithmFPType>
+class UpdateKernelOneAPI
+{
+public:
+    /**
+     * Updates the partial results of the QR method with the new block of data.
+     * The rows of the data are processed by blocks, the RQ decomposition of every block
+     * stacked under the current matrix R gives the updated R, so the accuracy of the
+     * QR method does not depend on the number of blocks.
+     *      - X' - matrix of size N x P' that contains input data set of size N x P
+     *             and optionally a column of 1's.
+     *             Column of 1's is added when it is required to compute an intercept term
+     *      - P' - number of columns in X'.
+     *             P' = P + 1, when it is required to compute an intercept term;
+     *             P' = P, otherwise
+     * \param[in]  x                Input data set of size N x P
+     * \param[in]  y                Input responses of size N x Ny
+     * \param[in,out] r             Matrix R of size P' x P'
+     * \param[in,out] qty           Matrix Q^T * Y of size Ny x P'
+     * \param[in]  initializeResult Flag. True if the partial results are initialized by zeros
+     * \param[in]  interceptFlag    Flag. True if it is required to compute an intercept term
+     * \return Status of the computations
+     */
+    static services::Status compute(NumericTable & x, NumericTable & y, NumericTable & r, NumericTable & qty, bool initializeResult,
+                                    bool interceptFlag);
+
+private:
+    static services::Status copyDataWithIntercept(const services::internal::Buffer<algorithmFPType> & x, size_t nRows, size_t nCols,
+                                                  services::internal::Buffer<algorithmFPType> & dst, size_t dstOffset, size_t nBetasIntercept);
+
+    static services::Status extractR(const services::internal::Buffer<algorithmFPType> & a, size_t offset,
+                                     services::internal::Buffer<algorithmFPType> & r, size_t nBetasIntercept);
+};
+
+/**
+ * Implements the common part of the regression coefficients computation from partial result
+ */
+template <typename algorithmFPType>
+class FinalizeKernelOneAPI
+{
+public:
+    /**
+     * Computes regression coefficients by solving the triangular system of linear equations.
+     * The system is of size P', so it is solved on the host.
+     * \param[in]  r        Matrix R of size P' x P'
+     * \param[in]  qty      Matrix Q^T * Y of size Ny x P'
+     * \param[out] rFinal   Resulting matrix R of size P' x P'
+     * \param[out] qtyFinal Resulting matrix Q^T * Y of size Ny x P'
+     * \param[out] beta     Matrix with regression coefficients of size Ny x (P + 1)
+     * \param[in]  interceptFlag    Flag. True if intercept term is not zero, false otherwise
+     * \return Status of the computations
+     */
+    static services::Status compute(NumericTable & r, NumericTable & qty, NumericTable & rFinal, NumericTable & qtyFinal, NumericTable & beta,
+                                    bool interceptFlag);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace qr
+} // namespace linear_model
+} // namespace algorithms
+} // namespace daal
+
+#endif
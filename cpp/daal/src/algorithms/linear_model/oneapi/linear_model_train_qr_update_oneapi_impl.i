@@ -0,0 +1,234 @@
+/* file: linear_model_train_qr_update_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of common base classes for QR decomposition model training on GPU.
+//--
+*/
+
+#include "src/algorithms/linear_model/oneapi/linear_model_train_qr_kernel_oneapi.h"
+#include "services/internal/sycl/math/types.h"
+#include "src/sycl/lapack_gpu.h"
+#include "services/internal/execution_context.h"
+#include "src/externals/service_ittnotify.h"
+#include "src/algorithms/linear_model/oneapi/cl_kernel/qr_update.cl"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_model
+{
+namespace qr
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::services::internal::sycl;
+
+template <typename algorithmFPType>
+services::Status UpdateKernelOneAPI<algorithmFPType>::compute(NumericTable & xTable, NumericTable & yTable, NumericTable & rTable,
+                                                              NumericTable & qtyTable, bool initializeResult, bool interceptFlag)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate);
+    services::Status status;
+
+    const size_t nRows           = xTable.getNumberOfRows();
+    const size_t nCols           = xTable.getNumberOfColumns();
+    const size_t nResponses      = yTable.getNumberOfColumns();
+    const size_t nBetasIntercept = (interceptFlag ? nCols + 1 : nCols);
+
+    BlockDescriptor<algorithmFPType> rBlock;
+    BlockDescriptor<algorithmFPType> qtyBlock;
+
+    DAAL_CHECK_STATUS(status, rTable.getBlockOfRows(0, nBetasIntercept, ReadWriteMode::readWrite, rBlock));
+    DAAL_CHECK_STATUS(status, qtyTable.getBlockOfRows(0, nResponses, ReadWriteMode::readWrite, qtyBlock));
+
+    auto & context                                      = services::internal::getDefaultContext();
+    services::internal::Buffer<algorithmFPType> rBuff   = rBlock.getBuffer();
+    services::internal::Buffer<algorithmFPType> qtyBuff = qtyBlock.getBuffer();
+
+    DAAL_CHECK_STATUS(status, rTable.releaseBlockOfRows(rBlock));
+    DAAL_CHECK_STATUS(status, qtyTable.releaseBlockOfRows(qtyBlock));
+
+    if (initializeResult)
+    {
+        context.fill(rBuff, 0.0, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        context.fill(qtyBuff, 0.0, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    const size_t nRowsPerBlock = (nBetasIntercept > 8192 ? nBetasIntercept : 8192);
+    const size_t nBlocks       = nRows / nRowsPerBlock + !!(nRows % nRowsPerBlock);
+    const size_t nStackedMax   = nBetasIntercept + (nRows < nRowsPerBlock ? nRows : nRowsPerBlock);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nStackedMax, nBetasIntercept);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nStackedMax, nResponses);
+
+    /* The matrix R and the block of X' stacked by rows, and the same for Q^T * Y and the block of Y */
+    const TypeIds::Id idType = TypeIds::id<algorithmFPType>();
+    UniversalBuffer aBuffTmp = context.allocate(idType, nStackedMax * nBetasIntercept, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    services::internal::Buffer<algorithmFPType> aBuff = aBuffTmp.get<algorithmFPType>();
+
+    UniversalBuffer cBuffTmp = context.allocate(idType, nStackedMax * nResponses, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    services::internal::Buffer<algorithmFPType> cBuff = cBuffTmp.get<algorithmFPType>();
+
+    UniversalBuffer tauBuffTmp = context.allocate(idType, nBetasIntercept, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    services::internal::Buffer<algorithmFPType> tauBuff = tauBuffTmp.get<algorithmFPType>();
+
+    const size_t rSize   = nBetasIntercept * nBetasIntercept;
+    const size_t qtySize = nBetasIntercept * nResponses;
+
+    for (size_t blockIdx = 0; blockIdx < nBlocks; ++blockIdx)
+    {
+        const size_t startRow = blockIdx * nRowsPerBlock;
+        const size_t endRow   = (startRow + nRowsPerBlock > nRows) ? nRows : startRow + nRowsPerBlock;
+        const size_t xNRows   = endRow - startRow;
+        const size_t nStacked = nBetasIntercept + xNRows;
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.stackBlock);
+
+            BlockDescriptor<algorithmFPType> xBlock;
+            BlockDescriptor<algorithmFPType> yBlock;
+
+            DAAL_CHECK_STATUS(status, xTable.getBlockOfRows(startRow, xNRows, ReadWriteMode::readOnly, xBlock));
+            DAAL_CHECK_STATUS(status, yTable.getBlockOfRows(startRow, xNRows, ReadWriteMode::readOnly, yBlock));
+
+            const services::internal::Buffer<algorithmFPType> xBuf = xBlock.getBuffer();
+            const services::internal::Buffer<algorithmFPType> yBuf = yBlock.getBuffer();
+
+            context.copy(aBuff, 0, rBuff, 0, rSize, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            if (interceptFlag)
+            {
+                DAAL_CHECK_STATUS(status, copyDataWithIntercept(xBuf, xNRows, nCols, aBuff, rSize, nBetasIntercept));
+            }
+            else
+            {
+                context.copy(aBuff, rSize, xBuf, 0, xNRows * nCols, &status);
+                DAAL_CHECK_STATUS_VAR(status);
+            }
+
+            context.copy(cBuff, 0, qtyBuff, 0, qtySize, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            context.copy(cBuff, qtySize, yBuf, 0, xNRows * nResponses, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+
+            DAAL_CHECK_STATUS(status, xTable.releaseBlockOfRows(xBlock));
+            DAAL_CHECK_STATUS(status, yTable.releaseBlockOfRows(yBlock));
+        }
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.gerqf);
+            /* The rows of the stacked matrix are the columns of the column-major matrix for lapack,
+             * the triangular factor is stored in its last P' rows */
+            DAAL_CHECK_STATUS(status, LapackGpu<algorithmFPType>::xgerqf(nBetasIntercept, nStacked, aBuff, nBetasIntercept, tauBuff));
+        }
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.ormrq);
+            DAAL_CHECK_STATUS(status, LapackGpu<algorithmFPType>::xormrq(math::Side::Right, math::Transpose::Trans, nResponses, nStacked,
+                                                                         nBetasIntercept, aBuff, nBetasIntercept, tauBuff, cBuff, nResponses));
+        }
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(computeUpdate.copyResults);
+            DAAL_CHECK_STATUS(status, extractR(aBuff, xNRows * nBetasIntercept, rBuff, nBetasIntercept));
+            context.copy(qtyBuff, 0, cBuff, xNRows * nResponses, qtySize, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+        }
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status UpdateKernelOneAPI<algorithmFPType>::copyDataWithIntercept(const services::internal::Buffer<algorithmFPType> & x, size_t nRows,
+                                                                            size_t nCols, services::internal::Buffer<algorithmFPType> & dst,
+                                                                            size_t dstOffset, size_t nBetasIntercept)
+{
+    services::Status status;
+
+    ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+
+    const services::String options = getKeyFPType<algorithmFPType>();
+    services::String cachekey("__daal_algorithms_linear_model_qr_update_");
+    cachekey.add(options);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), clKernelQRUpdate, options.c_str(), &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelPtr kernel = factory.getKernel("copyDataWithIntercept", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(5);
+    args.set(0, x, AccessModeIds::read);
+    args.set(1, static_cast<uint32_t>(nCols));
+    args.set(2, dst, AccessModeIds::write);
+    args.set(3, static_cast<uint32_t>(dstOffset));
+    args.set(4, static_cast<uint32_t>(nBetasIntercept));
+
+    KernelRange range(nRows, nBetasIntercept);
+
+    ctx.run(range, kernel, args, &status);
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status UpdateKernelOneAPI<algorithmFPType>::extractR(const services::internal::Buffer<algorithmFPType> & a, size_t offset,
+                                                               services::internal::Buffer<algorithmFPType> & r, size_t nBetasIntercept)
+{
+    services::Status status;
+
+    ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+
+    const services::String options = getKeyFPType<algorithmFPType>();
+    services::String cachekey("__daal_algorithms_linear_model_qr_update_");
+    cachekey.add(options);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), clKernelQRUpdate, options.c_str(), &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelPtr kernel = factory.getKernel("extractR", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(4);
+    args.set(0, a, AccessModeIds::read);
+    args.set(1, static_cast<uint32_t>(offset));
+    args.set(2, r, AccessModeIds::write);
+    args.set(3, static_cast<uint32_t>(nBetasIntercept));
+
+    KernelRange range(nBetasIntercept, nBetasIntercept);
+
+    ctx.run(range, kernel, args, &status);
+
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace qr
+} // namespace linear_model
+} // namespace algorithms
+} // namespace daal
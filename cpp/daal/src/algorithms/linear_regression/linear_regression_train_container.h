@@ -62,6 +62,10 @@ BatchContainer<algorithmFPType, method, cpu>::BatchContainer(Environment::env *
     {
         __DAAL_INITIALIZE_KERNELS_SYCL(internal::BatchKernelOneAPI, algorithmFPType, training::normEqDense);
     }
+    else if ((method == training::qrDense) && (!deviceInfo.isCpu))
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::BatchKernelOneAPI, algorithmFPType, training::qrDense);
+    }
     else
     {
         __DAAL_INITIALIZE_KERNELS(internal::BatchKernel, algorithmFPType, method);
@@ -115,8 +119,17 @@ Status BatchContainer<algorithmFPType, method, cpu>::compute()
     {
         linear_regression::ModelQRPtr m = linear_regression::ModelQR::cast(result->get(model));
 
-        __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense), compute, *(input->get(data)),
-                           *(input->get(dependentVariables)), *(m->getRTable()), *(m->getQTYTable()), *(m->getBeta()), par->interceptFlag);
+        if (deviceInfo.isCpu)
+        {
+            __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense), compute, *(input->get(data)),
+                               *(input->get(dependentVariables)), *(m->getRTable()), *(m->getQTYTable()), *(m->getBeta()), par->interceptFlag);
+        }
+        else
+        {
+            __DAAL_CALL_KERNEL_SYCL(env, internal::BatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense), compute,
+                                    *(input->get(data)), *(input->get(dependentVariables)), *(m->getRTable()), *(m->getQTYTable()), *(m->getBeta()),
+                                    par->interceptFlag);
+        }
     }
 }
 
@@ -134,6 +147,10 @@ OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(Environment::env
     {
         __DAAL_INITIALIZE_KERNELS_SYCL(internal::OnlineKernelOneAPI, algorithmFPType, training::normEqDense);
     }
+    else if ((method == training::qrDense) && (!deviceInfo.isCpu))
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::OnlineKernelOneAPI, algorithmFPType, training::qrDense);
+    }
     else
     {
         __DAAL_INITIALIZE_KERNELS(internal::OnlineKernel, algorithmFPType, method);
@@ -186,8 +203,17 @@ Status OnlineContainer<algorithmFPType, method, cpu>::compute()
     {
         linear_regression::ModelQRPtr m = linear_regression::ModelQR::cast(partialResult->get(training::partialModel));
 
-        __DAAL_CALL_KERNEL(env, internal::OnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense), compute, *(input->get(data)),
-                           *(input->get(dependentVariables)), *(m->getRTable()), *(m->getQTYTable()), par->interceptFlag);
+        if (deviceInfo.isCpu)
+        {
+            __DAAL_CALL_KERNEL(env, internal::OnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense), compute, *(input->get(data)),
+                               *(input->get(dependentVariables)), *(m->getRTable()), *(m->getQTYTable()), par->interceptFlag);
+        }
+        else
+        {
+            __DAAL_CALL_KERNEL_SYCL(env, internal::OnlineKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense), compute,
+                                    *(input->get(data)), *(input->get(dependentVariables)), *(m->getRTable()), *(m->getQTYTable()),
+                                    par->interceptFlag);
+        }
     }
 }
 
@@ -232,8 +258,19 @@ Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
     {
         linear_regression::ModelQRPtr pm = linear_regression::ModelQR::cast(partialResult->get(training::partialModel));
         linear_regression::ModelQRPtr m  = linear_regression::ModelQR::cast(result->get(training::model));
-        __DAAL_CALL_KERNEL(env, internal::OnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense), finalizeCompute,
-                           *(pm->getRTable()), *(pm->getQTYTable()), *(m->getRTable()), *(m->getQTYTable()), *(m->getBeta()), par->interceptFlag);
+
+        if (deviceInfo.isCpu)
+        {
+            __DAAL_CALL_KERNEL(env, internal::OnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense), finalizeCompute,
+                               *(pm->getRTable()), *(pm->getQTYTable()), *(m->getRTable()), *(m->getQTYTable()), *(m->getBeta()),
+                               par->interceptFlag);
+        }
+        else
+        {
+            __DAAL_CALL_KERNEL_SYCL(env, internal::OnlineKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense), finalizeCompute,
+                                    *(pm->getRTable()), *(pm->getQTYTable()), *(m->getRTable()), *(m->getQTYTable()), *(m->getBeta()),
+                                    par->interceptFlag);
+        }
     }
 }
 
@@ -29,6 +29,7 @@
 #include "algorithms/algorithm_base_common.h"
 #include "algorithms/linear_regression/linear_regression_training_types.h"
 #include "src/algorithms/linear_model/oneapi/linear_model_train_normeq_kernel_oneapi.h"
+#include "src/algorithms/linear_model/oneapi/linear_model_train_qr_kernel_oneapi.h"
 #include "algorithms/algorithm_kernel.h"
 
 namespace daal
@@ -67,6 +68,16 @@ public:
                              bool interceptFlag) const;
 };
 
+template <typename algorithmFPType>
+class BatchKernelOneAPI<algorithmFPType, training::qrDense> : public daal::algorithms::Kernel
+{
+    typedef linear_model::qr::training::internal::UpdateKernelOneAPI<algorithmFPType> UpdateKernelType;
+    typedef linear_model::qr::training::internal::FinalizeKernelOneAPI<algorithmFPType> FinalizeKernelType;
+
+public:
+    services::Status compute(NumericTable & x, NumericTable & y, NumericTable & r, NumericTable & qty, NumericTable & beta, bool interceptFlag) const;
+};
+
 template <typename algorithmFPType, training::Method method>
 class OnlineKernelOneAPI
 {};
@@ -83,6 +94,18 @@ public:
                                      bool interceptFlag) const;
 };
 
+template <typename algorithmFPType>
+class OnlineKernelOneAPI<algorithmFPType, training::qrDense> : public daal::algorithms::Kernel
+{
+    typedef linear_model::qr::training::internal::UpdateKernelOneAPI<algorithmFPType> UpdateKernelType;
+    typedef linear_model::qr::training::internal::FinalizeKernelOneAPI<algorithmFPType> FinalizeKernelType;
+
+public:
+    services::Status compute(NumericTable & x, NumericTable & y, NumericTable & r, NumericTable & qty, bool interceptFlag) const;
+    services::Status finalizeCompute(NumericTable & r, NumericTable & qty, NumericTable & rFinal, NumericTable & qtyFinal, NumericTable & beta,
+                                     bool interceptFlag) const;
+};
+
 } // namespace internal
 } // namespace training
 } // namespace linear_regression
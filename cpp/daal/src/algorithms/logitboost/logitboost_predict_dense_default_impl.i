@@ -63,8 +63,8 @@ services::Status LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::co
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nc, sizeof(algorithmFPType));
 
     /* Allocate memory */
-    TArray<algorithmFPType, cpu> pred(n * nc);
-    TArray<algorithmFPType, cpu> F(n * nc); /* Additive function values */
+    TArrayArena<algorithmFPType, cpu> pred(n * nc);
+    TArrayArena<algorithmFPType, cpu> F(n * nc); /* Additive function values */
     DAAL_CHECK(pred.get() && F.get(), services::ErrorMemoryAllocationFailed);
 
     daal::services::internal::service_memset<algorithmFPType, cpu>(F.get(), 0, n * nc);
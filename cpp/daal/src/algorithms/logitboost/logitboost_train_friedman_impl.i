@@ -46,6 +46,9 @@
 #include "src/algorithms/service_error_handling.h"
 #include "src/algorithms/logitboost/logitboost_impl.i"
 #include "src/algorithms/logitboost/logitboost_train_friedman_aux.i"
+#include "src/algorithms/stump/stump_regression_train_histogram_impl.i"
+#include "algorithms/stump/stump_regression_training_batch.h"
+#include "algorithms/stump/stump_regression_predict.h"
 
 using namespace daal::algorithms::logitboost::internal;
 using namespace daal::internal;
@@ -236,6 +239,27 @@ services::Status UpdateFPNew(size_t nc, size_t n, algorithmFPType * F, algorithm
     return safeStat.detach();
 }
 
+/* Returns the parameter of the weak learner if the weak learners are the decision stumps of the library, they are
+   trained by the data set presorted or binned once for all classes and iterations instead of calling the weak learner
+   algorithms. Returns null otherwise */
+inline const stump::regression::Parameter * getStumpLearnerParameter(regression::training::Batch * train,
+                                                                    const regression::prediction::Batch * predict)
+{
+    const bool isStumpPredict = dynamic_cast<const stump::regression::prediction::Batch<double> *>(predict)
+                                || dynamic_cast<const stump::regression::prediction::Batch<float> *>(predict);
+    if (!isStumpPredict) return nullptr;
+
+    if (stump::regression::training::Batch<double> * stumpTrain = dynamic_cast<stump::regression::training::Batch<double> *>(train))
+    {
+        return &stumpTrain->parameter();
+    }
+    if (stump::regression::training::Batch<float> * stumpTrain = dynamic_cast<stump::regression::training::Batch<float> *>(train))
+    {
+        return &stumpTrain->parameter();
+    }
+    return nullptr;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t na, NumericTablePtr a[], Model * r,
                                                                                 const Parameter * par)
@@ -304,6 +328,19 @@ services::Status LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(
     r->clearWeakLearnerModels();
     data_management::DataCollection models(nc);
 
+    /* The data set is sorted or binned once for the stumps of all classes and iterations, the weak learner algorithms
+       are used if the data set can not be prepared */
+    typedef stump::regression::training::internal::PresortedStumpTrainer<algorithmFPType, cpu> PresortedStumpTrainer;
+    typedef stump::regression::training::internal::HistogramStumpTrainer<algorithmFPType, cpu> HistogramStumpTrainer;
+    PresortedStumpTrainer presortedTrainer;
+    HistogramStumpTrainer histogramTrainer;
+    const stump::regression::Parameter * stumpPar = getStumpLearnerParameter(learnerTrain.get(), learnerPredict.get());
+    const bool useHistogramStumps = stumpPar && stumpPar->maxBins && HistogramStumpTrainer::isSupported(*x)
+                                    && histogramTrainer.init(*x, stumpPar->maxBins, stumpPar->minBinSize).ok();
+    const bool usePresortedStumps =
+        stumpPar && !stumpPar->maxBins && PresortedStumpTrainer::isSupported(*x) && presortedTrainer.init(*x).ok();
+    const bool useStumpTrainer = useHistogramStumps || usePresortedStumps;
+
     SafeStatus safeStat;
     daal::ls<LogitBoostLs<algorithmFPType, cpu> *> lsData([&]() {
         auto ptr = new LogitBoostLs<algorithmFPType, cpu>(n);
@@ -324,13 +361,28 @@ services::Status LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(
             struct LogitBoostLs<algorithmFPType, cpu> * lsLocal = lsData.local();
             if (!lsLocal) return;
 
-            services::Status localStatus = lsLocal->allocate(x, learnerTrain, learnerPredict);
+            services::Status localStatus = useStumpTrainer ? lsLocal->allocate() : lsLocal->allocate(x, learnerTrain, learnerPredict);
             DAAL_CHECK_STATUS_THR(localStatus);
 
             initWZ<algorithmFPType, cpu>(n, nc, j, y_label, P.get(), thrW, lsLocal->wArray->getArray(), thrZ, lsLocal->zArray->getArray());
 
-            localStatus = lsLocal->run(j, models, pred);
-            DAAL_CHECK_STATUS_THR(localStatus);
+            if (useStumpTrainer)
+            {
+                stump::regression::ModelPtr stumpModel = stump::regression::Model::create(&localStatus);
+                DAAL_CHECK_STATUS_THR(localStatus);
+
+                const algorithmFPType * z = lsLocal->zArray->getArray();
+                const algorithmFPType * w = lsLocal->wArray->getArray();
+                localStatus = useHistogramStumps ? histogramTrainer.train(z, w, *stumpModel, pred.get() + j * n) :
+                                                   presortedTrainer.train(z, w, *stumpModel, pred.get() + j * n);
+                DAAL_CHECK_STATUS_THR(localStatus);
+                models[j] = stumpModel;
+            }
+            else
+            {
+                localStatus = lsLocal->run(j, models, pred);
+                DAAL_CHECK_STATUS_THR(localStatus);
+            }
         });
         DAAL_CHECK_SAFE_STATUS();
 
@@ -45,6 +45,8 @@ services::Status LowOrderMomentsBatchKernel<algorithmFPType, method, cpu>::compu
         {
         case estimatesMinMax: return estimates_batch_minmax::compute_estimates<algorithmFPType, cpu>(dataTable, result);
         case estimatesMeanVariance: return estimates_batch_meanvariance::compute_estimates<algorithmFPType, cpu>(dataTable, result);
+        case estimatesMean: return estimates_batch_mean::compute_estimates<algorithmFPType, cpu>(dataTable, result);
+        case estimatesMinMaxMeanVariance: return estimates_batch_minmaxmeanvariance::compute_estimates<algorithmFPType, cpu>(dataTable, result);
         default /* estimatesAll */: break;
         }
         return estimates_batch_all::compute_estimates<algorithmFPType, cpu>(dataTable, result);
@@ -248,15 +248,17 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
     const size_t numRowsInLastBlock = numRowsInBlock + (_cd.nVectors - numRowsBlocks * numRowsInBlock);
 
     DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.compute);
-    /* TLS buffers initialization */
-    daal::tls<tls_moments_data_t<algorithmFPType, cpu> *> tls_data([&]() { return new tls_moments_data_t<algorithmFPType, cpu>(_cd.nFeatures); });
+    /* TLS buffers initialization, by the fixed chunks of the blocks merged in their order in the deterministic mode,
+       the buffers have at most six arrays of the features */
+    daal::blocked_tls<tls_moments_data_t<algorithmFPType, cpu> *> tls_data(
+        [&]() { return new tls_moments_data_t<algorithmFPType, cpu>(_cd.nFeatures); }, __daal_serv_is_deterministic(),
+        daal::ordered_tls_chunk_count(6 * _cd.nFeatures * sizeof(algorithmFPType)));
 
     SafeStatus safeStat;
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.ProcessBlocks);
         /* Compute partial results for each TLS buffer */
-        daal::threader_for(numRowsBlocks, numRowsBlocks, [&](int iBlock) {
-            struct tls_moments_data_t<algorithmFPType, cpu> * _td = tls_data.local();
+        tls_data.for_blocks(numRowsBlocks, [&](int iBlock, tls_moments_data_t<algorithmFPType, cpu> * _td) {
             if (_td->malloc_errors)
             {
                 return;
@@ -27,6 +27,7 @@
 #include "src/algorithms/low_order_moments/low_order_moments_kernel.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_partial_results_merge.h"
 
 #include "src/externals/service_stat.h"
 #include "src/externals/service_math.h"
@@ -56,7 +57,7 @@ inline size_t getDefaultBatchModeBlockSize(size_t numberOfRows)
 }
 
 /* Multiple instances for defaultDense method optimized implementations */
-/* for different estimates sets: all, minmax, meanvariance */
+/* for different estimates sets: all, minmax, meanvariance, mean, minmaxmeanvariance */
 /* Batch and Online(Distributed) variants */
 
 namespace estimates_batch_all
@@ -119,6 +120,46 @@ namespace estimates_batch_meanvariance
 
 } // namespace estimates_batch_meanvariance
 
+namespace estimates_batch_mean
+{
+#define _THREAD_REDUCTION_
+#define _THREAD_FINAL_
+
+#undef _MIN_ENABLE_
+#undef _MAX_ENABLE_
+#undef _SUM_ENABLE_
+#undef _SUM2_ENABLE_
+#undef _SUM2C_ENABLE_
+#define _MEAN_ENABLE_ /*+*/
+#undef _SORM_ENABLE_
+#undef _VARC_ENABLE_
+#undef _STDEV_ENABLE_
+#undef _VART_ENABLE_
+
+#include "src/algorithms/low_order_moments/low_order_moments_estimates_batch.i"
+
+} // namespace estimates_batch_mean
+
+namespace estimates_batch_minmaxmeanvariance
+{
+#define _THREAD_REDUCTION_
+#define _THREAD_FINAL_
+
+#define _MIN_ENABLE_  /*+*/
+#define _MAX_ENABLE_  /*+*/
+#undef _SUM_ENABLE_
+#undef _SUM2_ENABLE_
+#undef _SUM2C_ENABLE_
+#define _MEAN_ENABLE_ /*+*/
+#undef _SORM_ENABLE_
+#define _VARC_ENABLE_ /*+*/
+#undef _STDEV_ENABLE_
+#undef _VART_ENABLE_
+
+#include "src/algorithms/low_order_moments/low_order_moments_estimates_batch.i"
+
+} // namespace estimates_batch_minmaxmeanvariance
+
 namespace estimates_online_all
 {
 #define _MIN_ENABLE_   /*+*/
@@ -170,6 +211,40 @@ namespace estimates_online_meanvariance
 
 } // namespace estimates_online_meanvariance
 
+namespace estimates_online_mean
+{
+#undef _MIN_ENABLE_
+#undef _MAX_ENABLE_
+#undef _SUM_ENABLE_
+#undef _SUM2_ENABLE_
+#undef _SUM2C_ENABLE_
+#define _MEAN_ENABLE_ /*+*/
+#undef _SORM_ENABLE_
+#undef _VARC_ENABLE_
+#undef _STDEV_ENABLE_
+#undef _VART_ENABLE_
+
+#include "src/algorithms/low_order_moments/low_order_moments_estimates_online.i"
+
+} // namespace estimates_online_mean
+
+namespace estimates_online_minmaxmeanvariance
+{
+#define _MIN_ENABLE_  /*+*/
+#define _MAX_ENABLE_  /*+*/
+#undef _SUM_ENABLE_
+#undef _SUM2_ENABLE_
+#undef _SUM2C_ENABLE_
+#define _MEAN_ENABLE_ /*+*/
+#undef _SORM_ENABLE_
+#define _VARC_ENABLE_ /*+*/
+#undef _STDEV_ENABLE_
+#undef _VART_ENABLE_
+
+#include "src/algorithms/low_order_moments/low_order_moments_estimates_online.i"
+
+} // namespace estimates_online_minmaxmeanvariance
+
 /****************************************************************************************************************************/
 template <Method method>
 __int64 getMKLMethod()
@@ -503,17 +578,18 @@ Status computeMinMaxAndSumOfSquared(const size_t nFeatures, const size_t nVector
 
     /* TLS data initialization */
     SafeStatus safeStat;
-    daal::tls<TslData *> tslData([nFeatures, &safeStat]() {
-        auto tlsData = TslData::create(nFeatures);
-        if (!tlsData)
-        {
-            safeStat.add(services::ErrorMemoryAllocationFailed);
-        }
-        return tlsData;
-    });
+    daal::blocked_tls<TslData *> tslData(
+        [nFeatures, &safeStat]() {
+            auto tlsData = TslData::create(nFeatures);
+            if (!tlsData)
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+            }
+            return tlsData;
+        },
+        __daal_serv_is_deterministic(), daal::ordered_tls_chunk_count(3 * nFeatures * sizeof(algorithmFPType)));
 
-    daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
-        struct TslData * localTslData = tslData.local();
+    tslData.for_blocks(nBlocks, [&](int iBlock, TslData * localTslData) {
         if (!localTslData)
         {
             return;
@@ -722,123 +798,76 @@ Status mergeMinAndMax(data_management::DataCollection * partialResultsCollection
     return Status();
 }
 
-/****************************************************************************************************************************/
-template <typename algorithmFPType, CpuType cpu>
-void getThreeTables(ReadWriteMode rwMode, NumericTable * table1, NumericTable * table2, NumericTable * table3, BlockDescriptor<algorithmFPType> & bd1,
-                    BlockDescriptor<algorithmFPType> & bd2, BlockDescriptor<algorithmFPType> & bd3, algorithmFPType ** array1,
-                    algorithmFPType ** array2, algorithmFPType ** array3)
-{
-    table1->getBlockOfRows(0, 1, rwMode, bd1);
-    table2->getBlockOfRows(0, 1, rwMode, bd2);
-    table3->getBlockOfRows(0, 1, rwMode, bd3);
-    *array1 = bd1.getBlockPtr();
-    *array2 = bd2.getBlockPtr();
-    *array3 = bd3.getBlockPtr();
-}
-
-/****************************************************************************************************************************/
-template <typename algorithmFPType, CpuType cpu>
-void releaseThreeTables(NumericTable * table1, NumericTable * table2, NumericTable * table3, BlockDescriptor<algorithmFPType> & bd1,
-                        BlockDescriptor<algorithmFPType> & bd2, BlockDescriptor<algorithmFPType> & bd3)
-{
-    table1->releaseBlockOfRows(bd1);
-    table2->releaseBlockOfRows(bd2);
-    table3->releaseBlockOfRows(bd3);
-}
-
 /****************************************************************************************************************************/
 template <typename algorithmFPType, CpuType cpu>
 Status mergeSums(data_management::DataCollection * partialResultsCollection, PartialResult * partialResult, int * partialNObservations)
 {
-    ///merge first block
-    size_t nMergedObservations   = partialNObservations[0];
     NumericTable * sumTable      = partialResult->get(partialSum).get();
     NumericTable * sumSqTable    = partialResult->get(partialSumSquares).get();
     NumericTable * sumSqCenTable = partialResult->get(partialSumSquaresCentered).get();
 
-    size_t nFeatures = sumTable->getNumberOfColumns();
-
-    BlockDescriptor<algorithmFPType> sumBD, sumSqBD, sumSqCenBD;
-    algorithmFPType *sums, *sumSq, *sumSqCen;
-    int result = 0;
-
-    getThreeTables<algorithmFPType, cpu>(writeOnly, sumTable, sumSqTable, sumSqCenTable, sumBD, sumSqBD, sumSqCenBD, &sums, &sumSq, &sumSqCen);
-
-    PartialResult * inputPartialResult = static_cast<PartialResult *>((*partialResultsCollection)[0].get());
-
-    NumericTable * inputSumTable      = inputPartialResult->get(partialSum).get();
-    NumericTable * inputSumSqTable    = inputPartialResult->get(partialSumSquares).get();
-    NumericTable * inputSumSqCenTable = inputPartialResult->get(partialSumSquaresCentered).get();
-
-    BlockDescriptor<algorithmFPType> inputSumBD, inputSumSqBD, inputSumSqCenBD;
-    algorithmFPType *inputSums, *inputSumSq, *inputSumSqCen;
-
-    getThreeTables<algorithmFPType, cpu>(readOnly, inputSumTable, inputSumSqTable, inputSumSqCenTable, inputSumBD, inputSumSqBD, inputSumSqCenBD,
-                                         &inputSums, &inputSumSq, &inputSumSqCen);
-
-    size_t rowSize = nFeatures * sizeof(algorithmFPType);
-    result |= daal::services::internal::daal_memcpy_s(sums, rowSize, inputSums, rowSize);
-    result |= daal::services::internal::daal_memcpy_s(sumSq, rowSize, inputSumSq, rowSize);
-    result |= daal::services::internal::daal_memcpy_s(sumSqCen, rowSize, inputSumSqCen, rowSize);
-    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
-
-    releaseThreeTables<algorithmFPType, cpu>(inputSumTable, inputSumSqTable, inputSumSqCenTable, inputSumBD, inputSumSqBD, inputSumSqCenBD);
-
-    size_t collectionSize = partialResultsCollection->size();
-
-    BlockDescriptor<int> inputNObsBD;
-    for (size_t block = 1; block < collectionSize; ++block)
+    const size_t nFeatures      = sumTable->getNumberOfColumns();
+    const size_t collectionSize = partialResultsCollection->size();
+
+    daal::algorithms::internal::PartialTablesReader<algorithmFPType, cpu> inputSums(collectionSize);
+    daal::algorithms::internal::PartialTablesReader<algorithmFPType, cpu> inputSumSq(collectionSize);
+    daal::algorithms::internal::PartialTablesReader<algorithmFPType, cpu> inputSumSqCen(collectionSize);
+    TArray<algorithmFPType, cpu> inputNObsArray(collectionSize);
+    algorithmFPType * inputNObs = inputNObsArray.get();
+    DAAL_CHECK_MALLOC(inputSums.isValid() && inputSumSq.isValid() && inputSumSqCen.isValid() && inputNObs);
+
+    /* Only the partial results with observations take part in the merge */
+    Status s;
+    size_t nPartials                    = 0;
+    algorithmFPType nMergedObservations = 0;
+    for (size_t block = 0; block < collectionSize; ++block)
     {
-        inputPartialResult = static_cast<PartialResult *>((*partialResultsCollection)[block].get());
-
-        inputSumTable      = inputPartialResult->get(partialSum).get();
-        inputSumSqTable    = inputPartialResult->get(partialSumSquares).get();
-        inputSumSqCenTable = inputPartialResult->get(partialSumSquaresCentered).get();
-
-        getThreeTables<algorithmFPType, cpu>(readOnly, inputSumTable, inputSumSqTable, inputSumSqCenTable, inputSumBD, inputSumSqBD, inputSumSqCenBD,
-                                             &inputSums, &inputSumSq, &inputSumSqCen);
-
-        int n1 = nMergedObservations;
-        int n2 = partialNObservations[block];
-
-        if (n2 == 0)
+        if (partialNObservations[block] == 0)
         {
             continue;
         }
 
-        if (n1 == 0)
+        PartialResult * inputPartialResult = static_cast<PartialResult *>((*partialResultsCollection)[block].get());
+        DAAL_CHECK_STATUS(s, inputSums.set(nPartials, *inputPartialResult->get(partialSum)));
+        DAAL_CHECK_STATUS(s, inputSumSq.set(nPartials, *inputPartialResult->get(partialSumSquares)));
+        DAAL_CHECK_STATUS(s, inputSumSqCen.set(nPartials, *inputPartialResult->get(partialSumSquaresCentered)));
+        inputNObs[nPartials] = (algorithmFPType)partialNObservations[block];
+        nMergedObservations += inputNObs[nPartials];
+        nPartials++;
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> sumRows(sumTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumRows);
+    WriteOnlyRows<algorithmFPType, cpu> sumSqRows(sumSqTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSqRows);
+    WriteOnlyRows<algorithmFPType, cpu> sumSqCenRows(sumSqCenTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSqCenRows);
+    algorithmFPType * sums     = sumRows.get();
+    algorithmFPType * sumSq    = sumSqRows.get();
+    algorithmFPType * sumSqCen = sumSqCenRows.get();
+
+    DAAL_CHECK_STATUS(s, (daal::algorithms::internal::pairwiseSum<algorithmFPType, cpu>(nPartials, inputSums.get(), nFeatures, sums)));
+    DAAL_CHECK_STATUS(s, (daal::algorithms::internal::pairwiseSum<algorithmFPType, cpu>(nPartials, inputSumSq.get(), nFeatures, sumSq)));
+    DAAL_CHECK_STATUS(s, (daal::algorithms::internal::pairwiseSum<algorithmFPType, cpu>(nPartials, inputSumSqCen.get(), nFeatures, sumSqCen)));
+
+    /* The pairwise merges of the centered sums of squares sum up to sum(S_k) + sum(n_k * (m_k - m)^2) */
+    if (nPartials > 1)
+    {
+        const algorithmFPType invNObs = 1.0 / nMergedObservations;
+        for (size_t k = 0; k < nPartials; k++)
         {
+            const algorithmFPType * partialSums  = inputSums.get()[k];
+            const algorithmFPType invPartialNObs = 1.0 / inputNObs[k];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
             for (size_t i = 0; i < nFeatures; i++)
             {
-                sumSqCen[i] += inputSumSqCen[i];
-                sumSq[i] += inputSumSq[i];
-                sums[i] += inputSums[i];
+                const algorithmFPType deviation = partialSums[i] * invPartialNObs - sums[i] * invNObs;
+                sumSqCen[i] += inputNObs[k] * deviation * deviation;
             }
-            nMergedObservations += n2;
-            continue;
-        }
-
-        algorithmFPType coeff = (algorithmFPType)(n1 * n2) / (algorithmFPType)(n1 + n2);
-        algorithmFPType invN1 = 1.0 / (algorithmFPType)n1;
-        algorithmFPType invN2 = 1.0 / (algorithmFPType)n2;
-
-        for (size_t i = 0; i < nFeatures; i++)
-        {
-            algorithmFPType mean1 = sums[i] * invN1;
-            algorithmFPType mean2 = inputSums[i] * invN2;
-
-            sumSqCen[i] += (inputSumSqCen[i] + coeff * (mean1 * mean1 + mean2 * mean2 - 2 * mean1 * mean2));
-
-            sums[i] += inputSums[i];
-            sumSq[i] += inputSumSq[i];
         }
-        nMergedObservations += n2;
-
-        releaseThreeTables<algorithmFPType, cpu>(inputSumTable, inputSumSqTable, inputSumSqCenTable, inputSumBD, inputSumSqBD, inputSumSqCenBD);
     }
-
-    releaseThreeTables<algorithmFPType, cpu>(sumTable, sumSqTable, sumSqCenTable, sumBD, sumSqBD, sumSqCenBD);
-    return Status();
+    return s;
 }
 
 /****************************************************************************************************************************/
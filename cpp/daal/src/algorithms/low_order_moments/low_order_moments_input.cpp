@@ -89,6 +89,11 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     }
     if (method == sumDense || method == sumCSR)
     {
+        /* the sums computed from the values before their modification are computed again */
+        if (dataTable->getBasicStatisticsStatus() == NumericTable::basicStatisticsOutdated)
+        {
+            DAAL_CHECK_STATUS(s, dataTable->computeBasicStatistics());
+        }
         NumericTablePtr sum = dataTable->basicStatistics.get(NumericTableIface::sum);
         DAAL_CHECK_STATUS(s, checkNumericTable(sum.get(), basicStatisticsSumStr(), 0, 0, dataTable->getNumberOfColumns(), 1));
     }
@@ -47,6 +47,9 @@ services::Status LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::comp
         case estimatesMinMax: return estimates_online_minmax::compute_estimates<algorithmFPType, method, cpu>(dataTable, partialResult, isOnline);
         case estimatesMeanVariance:
             return estimates_online_meanvariance::compute_estimates<algorithmFPType, method, cpu>(dataTable, partialResult, isOnline);
+        case estimatesMean: return estimates_online_mean::compute_estimates<algorithmFPType, method, cpu>(dataTable, partialResult, isOnline);
+        case estimatesMinMaxMeanVariance:
+            return estimates_online_minmaxmeanvariance::compute_estimates<algorithmFPType, method, cpu>(dataTable, partialResult, isOnline);
         default /* estimatesAll */: break;
         }
         return estimates_online_all::compute_estimates<algorithmFPType, method, cpu>(dataTable, partialResult, isOnline);
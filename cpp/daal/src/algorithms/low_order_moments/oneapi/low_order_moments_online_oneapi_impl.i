@@ -177,9 +177,9 @@ services::Status LowOrderMomentsOnlineKernelOneAPI<algorithmFPType, method>::fin
             DAAL_CHECK_STATUS_VAR(status);
             return task.compute();
         }
-        else if (parameter->estimatesToCompute == estimatesAll)
+        else if (parameter->estimatesToCompute != estimatesMinMax)
         {
-            /* estimatesAll */
+            /* estimatesAll, the other sets of estimates are computed with all moments on GPU */
             LowOrderMomentsOnlineFinalizeTaskOneAPI<algorithmFPType, estimatesAll> task(context, partialResult, result, &status);
             DAAL_CHECK_STATUS_VAR(status);
             return task.compute();
@@ -64,7 +64,7 @@ services::Status MultiClassClassifierPredictKernel<multiClassClassifierWu, train
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClasses, sizeof(size_t));
 
-    TArray<size_t, cpu> nonEmptyClassMapBuffer(nClasses);
+    TArrayArena<size_t, cpu> nonEmptyClassMapBuffer(nClasses);
     DAAL_CHECK_MALLOC(nonEmptyClassMapBuffer.get());
 
     size_t * nonEmptyClassMap = (size_t *)nonEmptyClassMapBuffer.get();
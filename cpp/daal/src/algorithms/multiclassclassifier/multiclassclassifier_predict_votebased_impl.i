@@ -29,6 +29,11 @@
 #include "src/threading/threading.h"
 #include "src/algorithms/service_error_handling.h"
 #include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_sort.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_memory.h"
+#include "algorithms/svm/svm_model.h"
+#include "services/internal/execution_context.h"
 
 namespace daal
 {
@@ -51,6 +56,40 @@ struct MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, alg
                    const daal::algorithms::Parameter * par);
 };
 
+/**
+ * Computes resulting labels as indices of the maximum vote values
+ * \param[in] startRow  Index of the starting row in the block
+ * \param[in] nRows     Number of rows in the block
+ * \param[in] nClasses  Number of classes
+ * \param[in] votes     Array of size nRows x nClasses with the votes of two-class classifiers
+ * \param[out] pred     Numeric table of size n x 1 with resulting labels
+ * \param[in] nonEmptyClassMap Array that contains indices of non-empty classes
+ * \return Status of the computations
+ */
+template <CpuType cpu>
+Status computeLabelsByVotes(size_t startRow, size_t nRows, size_t nClasses, const int * votes, NumericTable * pred, const size_t * nonEmptyClassMap)
+{
+    WriteOnlyRows<int, cpu> res(pred, startRow, nRows);
+    int * labels = res.get();
+    DAAL_CHECK_MALLOC(labels);
+
+    const int * votesPtr = votes;
+    for (size_t i = 0; i < nRows; i++, votesPtr += nClasses)
+    {
+        labels[i]   = nonEmptyClassMap[0];
+        int maxVote = votesPtr[0];
+        for (size_t iClass = 1; iClass < nClasses; iClass++)
+        {
+            if (votesPtr[iClass] > maxVote)
+            {
+                maxVote   = votesPtr[iClass];
+                labels[i] = nonEmptyClassMap[iClass];
+            }
+        }
+    }
+    return Status();
+}
+
 /** Base class for threading subtask */
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
 class SubTaskVoteBased
@@ -126,28 +165,7 @@ public:
             }
         }
 
-        if (pred)
-        {
-            /* Compute resulting labels as indices of the maximum vote values */
-            WriteOnlyRows<int, cpu> res(pred, startRow, nRows);
-            int * labels = res.get();
-            DAAL_CHECK_MALLOC(labels);
-
-            int * votesPtr = votes;
-            for (size_t i = 0; i < nRows; i++, votesPtr += _nClasses)
-            {
-                labels[i]   = nonEmptyClassMap[0];
-                int maxVote = votesPtr[0];
-                for (size_t iClass = 1; iClass < _nClasses; iClass++)
-                {
-                    if (votesPtr[iClass] > maxVote)
-                    {
-                        maxVote   = votesPtr[iClass];
-                        labels[i] = nonEmptyClassMap[iClass];
-                    }
-                }
-            }
-        }
+        if (pred) s |= computeLabelsByVotes<cpu>(startRow, nRows, _nClasses, votes, pred, nonEmptyClassMap);
         return s;
     }
 
@@ -296,6 +314,294 @@ private:
     ReadRowsCSR<algorithmFPType, cpu> _xRows;
 };
 
+/**
+ * Support vectors of all two-class SVM models merged into the set of unique vectors
+ * with the matrix of classification coefficients of every model for every unique vector,
+ * so the decision functions of all models are computed from one block of kernel values
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVMVoteBasedModel
+{
+public:
+    SVMVoteBasedModel() : _nModels(0), _nUniqueSV(0), _isApplicable(false) {}
+
+    /**
+     * Merges the support vectors of two-class models if all of them are dense SVM models
+     * \param[in] model     Model of the multi-class classifier
+     * \param[in] nModels   Number of two-class models
+     * \param[in] nFeatures Number of features in the input data set
+     * \param[in] svmPar    Parameter of the SVM prediction algorithm
+     * \return Status of the computations
+     */
+    Status init(Model * model, size_t nModels, size_t nFeatures, const svm::Parameter * svmPar)
+    {
+        if (!svmPar || !svmPar->kernel) return Status();
+
+        TArray<svm::Model *, cpu> modelsArr(nModels);
+        TArray<size_t, cpu> svOffsetsArr(nModels + 1);
+        DAAL_CHECK_MALLOC(modelsArr.get() && svOffsetsArr.get());
+
+        svm::Model ** models = modelsArr.get();
+        size_t * svOffsets   = svOffsetsArr.get();
+        svOffsets[0]       = 0;
+        for (size_t imodel = 0; imodel < nModels; ++imodel)
+        {
+            svm::Model * svmModel = dynamic_cast<svm::Model *>(model->getTwoClassClassifierModel(imodel).get());
+            if (!svmModel) return Status();
+            NumericTable * svTable = svmModel->getSupportVectors().get();
+            if (!svTable || !svmModel->getClassificationCoefficients()) return Status();
+            if (svTable->getDataLayout() == NumericTableIface::csrArray || svTable->getNumberOfColumns() != nFeatures) return Status();
+            models[imodel]       = svmModel;
+            svOffsets[imodel + 1] = svOffsets[imodel] + svTable->getNumberOfRows();
+        }
+        const size_t nSV = svOffsets[nModels];
+        if (nSV == 0) return Status();
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nSV, nFeatures);
+        TArray<algorithmFPType, cpu> svDataArr(nSV * nFeatures);
+        TArray<size_t, cpu> hashArr(nSV);
+        TArray<size_t, cpu> orderArr(nSV);
+        TArray<size_t, cpu> uniqueIdxArr(nSV);
+        DAAL_CHECK_MALLOC(svDataArr.get() && hashArr.get() && orderArr.get() && uniqueIdxArr.get());
+        algorithmFPType * svData = svDataArr.get();
+        size_t * hash            = hashArr.get();
+        size_t * order           = orderArr.get();
+        size_t * uniqueIdx       = uniqueIdxArr.get();
+
+        for (size_t imodel = 0; imodel < nModels; ++imodel)
+        {
+            NumericTable * svTable = models[imodel]->getSupportVectors().get();
+            const size_t nModelSV  = svOffsets[imodel + 1] - svOffsets[imodel];
+            ReadRows<algorithmFPType, cpu> svRows(svTable, 0, nModelSV);
+            DAAL_CHECK_BLOCK_STATUS(svRows);
+            const algorithmFPType * svRowsData = svRows.get();
+            algorithmFPType * dst              = svData + svOffsets[imodel] * nFeatures;
+            for (size_t i = 0; i < nModelSV * nFeatures; ++i) dst[i] = svRowsData[i];
+        }
+
+        /* Support vectors shared by the models are found among the vectors with equal hashes of their bytes */
+        daal::threader_for(nSV, nSV, [&](size_t i) {
+            const unsigned char * bytes = reinterpret_cast<const unsigned char *>(svData + i * nFeatures);
+            size_t h                    = 14695981039346656037ull;
+            for (size_t j = 0; j < nFeatures * sizeof(algorithmFPType); ++j) h = (h ^ bytes[j]) * 1099511628211ull;
+            hash[i]  = h;
+            order[i] = i;
+        });
+        daal::algorithms::internal::qSort<size_t, size_t, cpu>(nSV, hash, order);
+
+        size_t nUniqueSV = 0;
+        for (size_t start = 0, end = 0; start < nSV; start = end)
+        {
+            for (end = start + 1; end < nSV && hash[end] == hash[start]; ++end)
+                ;
+            for (size_t i = start; i < end; ++i)
+            {
+                uniqueIdx[order[i]] = nUniqueSV;
+                for (size_t j = start; j < i; ++j)
+                {
+                    if (isEqualRows(svData + order[i] * nFeatures, svData + order[j] * nFeatures, nFeatures))
+                    {
+                        uniqueIdx[order[i]] = uniqueIdx[order[j]];
+                        break;
+                    }
+                }
+                if (uniqueIdx[order[i]] == nUniqueSV) ++nUniqueSV;
+            }
+        }
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nUniqueSV, nModels);
+        _uniqueSV.reset(nUniqueSV * nFeatures);
+        _coeffs.reset(nUniqueSV * nModels);
+        _biases.reset(nModels);
+        DAAL_CHECK_MALLOC(_uniqueSV.get() && _coeffs.get() && _biases.get());
+        service_memset<algorithmFPType, cpu>(_coeffs.get(), algorithmFPType(0), nUniqueSV * nModels);
+
+        for (size_t i = 0; i < nSV; ++i)
+        {
+            const algorithmFPType * src = svData + i * nFeatures;
+            algorithmFPType * dst       = _uniqueSV.get() + uniqueIdx[i] * nFeatures;
+            for (size_t j = 0; j < nFeatures; ++j) dst[j] = src[j];
+        }
+
+        for (size_t imodel = 0; imodel < nModels; ++imodel)
+        {
+            const size_t nModelSV = svOffsets[imodel + 1] - svOffsets[imodel];
+            ReadColumns<algorithmFPType, cpu> svCoeffBlock(models[imodel]->getClassificationCoefficients().get(), 0, 0, nModelSV);
+            DAAL_CHECK_BLOCK_STATUS(svCoeffBlock);
+            const algorithmFPType * svCoeff = svCoeffBlock.get();
+            for (size_t i = 0; i < nModelSV; ++i)
+            {
+                _coeffs[uniqueIdx[svOffsets[imodel] + i] * nModels + imodel] += svCoeff[i];
+            }
+            _biases[imodel] = algorithmFPType(models[imodel]->getBias());
+        }
+
+        Status s;
+        _uniqueSVTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_uniqueSV.get(), nFeatures, nUniqueSV, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        _kernel       = svmPar->kernel;
+        _nModels      = nModels;
+        _nUniqueSV    = nUniqueSV;
+        _isApplicable = true;
+        return s;
+    }
+
+    bool isApplicable() const { return _isApplicable; }
+    size_t getNumberOfModels() const { return _nModels; }
+    size_t getNumberOfUniqueSV() const { return _nUniqueSV; }
+    const NumericTablePtr & getUniqueSV() const { return _uniqueSVTable; }
+    const algorithmFPType * getCoefficients() const { return _coeffs.get(); }
+    const algorithmFPType * getBiases() const { return _biases.get(); }
+    const kernel_function::KernelIfacePtr & getKernel() const { return _kernel; }
+
+private:
+    static bool isEqualRows(const algorithmFPType * a, const algorithmFPType * b, size_t nFeatures)
+    {
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            if (a[j] != b[j]) return false;
+        }
+        return true;
+    }
+
+    size_t _nModels;
+    size_t _nUniqueSV;
+    bool _isApplicable;
+    TArray<algorithmFPType, cpu> _uniqueSV;
+    TArray<algorithmFPType, cpu> _coeffs; /* Matrix of size nUniqueSV x nModels */
+    TArray<algorithmFPType, cpu> _biases;
+    NumericTablePtr _uniqueSVTable;
+    kernel_function::KernelIfacePtr _kernel;
+};
+
+/** Class for threading subtask that computes the decision functions of all two-class SVM models at once */
+template <typename algorithmFPType, CpuType cpu>
+class SubTaskVoteBasedSVM
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /**
+     * Constructs a threading subtask that works with the merged SVM models and dense input data
+     * \param[in] nClasses  Number of classes
+     * \param[in] nRows     Maximum number of rows processed in the iteration of a threader_for loop
+     * \param[in] svmModel  Support vectors and coefficients of all two-class SVM models
+     * \return Pointer to the newly constructed subtask in case of success; NULL pointer in case of failure
+     */
+    static SubTaskVoteBasedSVM * create(size_t nClasses, size_t nRows, const SVMVoteBasedModel<algorithmFPType, cpu> & svmModel)
+    {
+        SubTaskVoteBasedSVM * res = new SubTaskVoteBasedSVM(nClasses, nRows, svmModel);
+        if (res && res->isValid()) return res;
+        delete res;
+        return nullptr;
+    }
+
+    /**
+     * Computes a block of predictions
+     * \param[in] startRow  Index of the starting row in the block
+     * \param[in] nRows     Number of rows in the block
+     * \param[in] a         Numeric table of size n x p with input data set
+     * \param[out] pred     Numeric table of size n x 1 with resulting labels
+     * \param[out] df       Numeric table of size n x (nClasses * (nClasses - 1) / 2) with decision function values
+     * \param[in] nonEmptyClassMap Array that contains indices of non-empty classes
+     * \return Status of the computations
+     */
+    Status predict(size_t startRow, size_t nRows, const NumericTable * a, NumericTable * pred, NumericTable * df, const size_t * nonEmptyClassMap)
+    {
+        const size_t nModels   = _svmModel.getNumberOfModels();
+        const size_t nUniqueSV = _svmModel.getNumberOfUniqueSV();
+        const size_t nFeatures = a->getNumberOfColumns();
+
+        _xRows.set(const_cast<NumericTable *>(a), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_xRows);
+
+        Status s;
+        NumericTablePtr xTable =
+            HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType *>(_xRows.get()), nFeatures, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        NumericTablePtr kernelValuesTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_kernelValues.get(), nUniqueSV, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        _kernelRes->set(kernel_function::values, kernelValuesTable);
+        _kernel->getInput()->set(kernel_function::X, xTable);
+        _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+        s = _kernel->computeNoThrow();
+        if (!s) return Status(ErrorMultiClassFailedToComputeTwoClassPrediction).add(s);
+
+        /* Decision functions of all models for the block of input observations: y = K(x, SV) * coeffs + biases */
+        algorithmFPType * y            = _y.get();
+        const algorithmFPType * biases = _svmModel.getBiases();
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            for (size_t imodel = 0; imodel < nModels; ++imodel) y[i * nModels + imodel] = biases[imodel];
+        }
+
+        const char trans = 'N';
+        DAAL_INT m       = nModels;
+        DAAL_INT n       = nRows;
+        DAAL_INT k       = nUniqueSV;
+        algorithmFPType alpha(1.0);
+        algorithmFPType beta(1.0);
+        Blas<algorithmFPType, cpu>::xxgemm(&trans, &trans, &m, &n, &k, &alpha, _svmModel.getCoefficients(), &m, _kernelValues.get(), &k, &beta, y,
+                                           &m);
+
+        int * votes = _votes.get();
+        daal::services::internal::service_memset_seq<int, cpu>(votes, 0, _nClasses * nRows);
+        for (size_t iClass = 1, imodel = 0; iClass < _nClasses; ++iClass)
+        {
+            for (size_t jClass = 0; jClass < iClass; ++jClass, ++imodel)
+            {
+                if (df)
+                {
+                    const size_t iClassesForDF = (jClass * (2 * _nClasses - jClass - 1)) / 2 + (iClass - jClass - 1);
+                    WriteOnlyColumns<algorithmFPType, cpu> dfBlock(df, iClassesForDF, startRow, nRows);
+                    DAAL_CHECK_BLOCK_STATUS(dfBlock);
+                    algorithmFPType * dfData = dfBlock.get();
+                    for (size_t i = 0; i < nRows; ++i) dfData[i] = y[i * nModels + imodel];
+                }
+
+                for (size_t i = 0; i < nRows; ++i)
+                {
+                    if (y[i * nModels + imodel] >= 0)
+                        votes[i * _nClasses + iClass]++;
+                    else
+                        votes[i * _nClasses + jClass]++;
+                }
+            }
+        }
+
+        if (pred) s |= computeLabelsByVotes<cpu>(startRow, nRows, _nClasses, votes, pred, nonEmptyClassMap);
+        return s;
+    }
+
+private:
+    SubTaskVoteBasedSVM(size_t nClasses, size_t nRows, const SVMVoteBasedModel<algorithmFPType, cpu> & svmModel)
+        : _nClasses(nClasses),
+          _svmModel(svmModel),
+          _votes(nClasses * nRows),
+          _y(svmModel.getNumberOfModels() * nRows),
+          _kernelValues(svmModel.getNumberOfUniqueSV() * nRows),
+          _kernelRes(new kernel_function::Result())
+    {
+        _kernel = svmModel.getKernel()->clone();
+        if (!_kernel || !_kernelRes) return;
+        _kernel->setResult(_kernelRes);
+        _kernel->getInput()->set(kernel_function::Y, svmModel.getUniqueSV());
+    }
+
+    bool isValid() const { return _votes.get() && _y.get() && _kernelValues.get() && _kernel && _kernelRes; }
+
+    size_t _nClasses;
+    const SVMVoteBasedModel<algorithmFPType, cpu> & _svmModel;
+    TArray<int, cpu> _votes;
+    TArray<algorithmFPType, cpu> _y;
+    TArrayScalable<algorithmFPType, cpu> _kernelValues;
+    kernel_function::KernelIfacePtr _kernel;
+    kernel_function::ResultPtr _kernelRes;
+    ReadRows<algorithmFPType, cpu> _xRows;
+};
+
 template <typename algorithmFPType, typename ClsType, typename MultiClsParam, CpuType cpu>
 Status MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, algorithmFPType, ClsType, MultiClsParam, cpu>::compute(
     const NumericTable * a, const daal::algorithms::Model * m, NumericTable * pred, NumericTable * df, const daal::algorithms::Parameter * par)
@@ -306,7 +612,7 @@ Status MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, alg
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClasses, sizeof(size_t));
 
-    TArray<size_t, cpu> nonEmptyClassMapBuffer(nClasses);
+    TArrayArena<size_t, cpu> nonEmptyClassMapBuffer(nClasses);
     DAAL_CHECK_MALLOC(nonEmptyClassMapBuffer.get());
 
     size_t * nonEmptyClassMap = (size_t *)nonEmptyClassMapBuffer.get();
@@ -321,6 +627,38 @@ Status MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, alg
     size_t nBlocks            = nVectors / nRowsInBlock;
     if (nBlocks * nRowsInBlock < nVectors) nBlocks++;
 
+    /* Two-class SVM models share the support vectors, so their decision functions are computed
+       from one block of kernel values between the input observations and the unique support vectors */
+    SVMVoteBasedModel<algorithmFPType, cpu> svmModel;
+    if (a->getDataLayout() != NumericTableIface::csrArray && services::internal::getDefaultContext().getInfoDevice().isCpu)
+    {
+        const svm::Parameter * svmPar = dynamic_cast<const svm::Parameter *>(simplePrediction->getBaseParameter());
+        s = svmModel.init(model, nClasses * (nClasses - 1) / 2, a->getNumberOfColumns(), svmPar);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    if (svmModel.isApplicable())
+    {
+        typedef SubTaskVoteBasedSVM<algorithmFPType, cpu> TSVMSubTask;
+        daal::ls<TSVMSubTask *> lsSVMTask([=, &svmModel]() { return TSVMSubTask::create(nClasses, nRowsInBlock, svmModel); });
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            TSVMSubTask * local = lsSVMTask.local();
+            DAAL_CHECK_MALLOC_THR(local);
+            DAAL_LS_RELEASE(TSVMSubTask, lsSVMTask, local); //releases local storage when leaving this scope
+
+            const size_t startRow = iBlock * nRowsInBlock;
+            const size_t nRows    = (startRow + nRowsInBlock > nVectors) ? nVectors - startRow : nRowsInBlock;
+
+            Status s = local->predict(startRow, nRows, a, pred, df, nonEmptyClassMap);
+            DAAL_CHECK_STATUS_THR(s);
+        });
+
+        lsSVMTask.reduce([=](TSVMSubTask * local) { delete local; });
+        return safeStat.detach();
+    }
+
     typedef SubTaskVoteBased<algorithmFPType, ClsType, cpu> TSubTask;
     daal::ls<TSubTask *> lsTask([=, &simplePrediction]() {
         if (a->getDataLayout() == NumericTableIface::csrArray)
@@ -76,6 +76,17 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
         DAAL_CHECK_STATUS(s, computeDataSize(nVectors, nFeatures, nClasses, xTable, y, nSubsetVectors, dataSize));
     }
 
+    /* Group the observations by the classes once, so the subsets of the class pairs are gathered
+       without the passes over all observations */
+    TArray<size_t, cpu> classRows(nVectors);
+    DAAL_CHECK_MALLOC(classRows.get());
+    TArray<size_t, cpu> classOffsets(nClasses + 1);
+    DAAL_CHECK_MALLOC(classOffsets.get());
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, groupRowsByClasses(nVectors, nClasses, y, classRows.get(), classOffsets.get()));
+    }
+
     typedef SubTask<algorithmFPType, ClsType, cpu> TSubTask;
     /* Allocate memory for storing subsets of input data */
     daal::ls<TSubTask *> lsTask([=, &simpleTrainingInit]() {
@@ -109,7 +120,7 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
         DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
 
         size_t nRowsInSubset = 0;
-        Status s             = local->getDataSubset(nFeatures, nVectors, i, j, y, nRowsInSubset);
+        Status s             = local->getDataSubset(nFeatures, classRows.get(), classOffsets.get(), i, j, nRowsInSubset);
         DAAL_CHECK_STATUS_THR(s);
         classifier::ModelPtr pModel;
         if (nRowsInSubset)
@@ -181,13 +192,40 @@ Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType,
     return Status();
 }
 
+template <typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
+Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType, MccParType, cpu>::groupRowsByClasses(
+    size_t nVectors, size_t nClasses, const algorithmFPType * y, size_t * classRows, size_t * classOffsets)
+{
+    daal::services::internal::service_memset_seq<size_t, cpu>(classOffsets, 0, nClasses + 1);
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        ++classOffsets[size_t(y[i]) + 1];
+    }
+    for (size_t i = 0; i < nClasses; ++i)
+    {
+        classOffsets[i + 1] += classOffsets[i];
+    }
+
+    TArray<size_t, cpu> classPos(nClasses);
+    DAAL_CHECK_MALLOC(classPos.get());
+    for (size_t i = 0; i < nClasses; ++i)
+    {
+        classPos[i] = classOffsets[i];
+    }
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        classRows[classPos[size_t(y[i])]++] = i;
+    }
+    return Status();
+}
+
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                                                                         const algorithmFPType * y, size_t & nRows)
+Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows,
+                                                                         algorithmFPType label, size_t & nRows)
 {
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t iRow = 0; iRow < nClassRows; iRow++)
     {
-        if (size_t(y[ix]) != classIdx) continue;
+        const size_t ix = rows[iRow];
         _mtX.next(ix, 1);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
         PRAGMA_IVDEP
@@ -204,14 +242,14 @@ Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t
 }
 
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                                                                       const algorithmFPType * y, size_t & nRows)
+Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows,
+                                                                       algorithmFPType label, size_t & nRows)
 {
     _rowOffsetsX[0]  = 1;
     size_t dataIndex = (nRows ? _rowOffsetsX[nRows] - _rowOffsetsX[0] : 0);
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t iRow = 0; iRow < nClassRows; iRow++)
     {
-        if (size_t(y[ix]) != classIdx) continue;
+        const size_t ix = rows[iRow];
         _mtX.next(ix, 1);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
         const size_t nNonZeroValuesInRow = _mtX.rows()[1] - _mtX.rows()[0];
@@ -52,14 +52,18 @@ public:
     DAAL_NEW_DELETE();
     virtual ~SubTask() {}
 
-    services::Status getDataSubset(size_t nFeatures, size_t nVectors, int classIdxPositive, int classIdxNegative, const algorithmFPType * y,
-                                   size_t & nRows)
+    /* classRows contains the indices of the observations grouped by the classes,
+       the observations of the class i are in the positions [classOffsets[i], classOffsets[i + 1]) */
+    services::Status getDataSubset(size_t nFeatures, const size_t * classRows, const size_t * classOffsets, int classIdxPositive,
+                                   int classIdxNegative, size_t & nRows)
     {
         nRows = 0;
         /* Prepare "positive" observations of the training subset */
-        services::Status s = copyDataIntoSubtable(nFeatures, nVectors, classIdxPositive, 1, y, nRows);
+        services::Status s = copyDataIntoSubtable(nFeatures, classRows + classOffsets[classIdxPositive],
+                                                  classOffsets[classIdxPositive + 1] - classOffsets[classIdxPositive], 1, nRows);
         if (s) /* Prepare "negative" observations of the training subset */
-            s = copyDataIntoSubtable(nFeatures, nVectors, classIdxNegative, -1, y, nRows);
+            s = copyDataIntoSubtable(nFeatures, classRows + classOffsets[classIdxNegative],
+                                     classOffsets[classIdxNegative + 1] - classOffsets[classIdxNegative], -1, nRows);
         return s;
     }
 
@@ -106,7 +110,7 @@ protected:
 
     bool isValid() const { return _subsetX.get() && _subsetYTable.get() && _simpleTraining.get(); }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows, algorithmFPType label,
                                                   size_t & nRows) = 0;
 
 protected:
@@ -155,7 +159,7 @@ private:
         }
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows, algorithmFPType label,
                                                   size_t & nRows) DAAL_C11_OVERRIDE;
 
 private:
@@ -194,7 +198,7 @@ private:
         if (!status) return;
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows, algorithmFPType label,
                                                   size_t & nRows) DAAL_C11_OVERRIDE;
 
 private:
@@ -211,6 +215,8 @@ public:
 protected:
     services::Status computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses, const NumericTable * xTable, const algorithmFPType * y,
                                      size_t & nSubsetVectors, size_t & dataSize);
+
+    services::Status groupRowsByClasses(size_t nVectors, size_t nClasses, const algorithmFPType * y, size_t * classRows, size_t * classOffsets);
 };
 
 } // namespace internal
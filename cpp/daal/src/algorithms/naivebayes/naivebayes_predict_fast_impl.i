@@ -72,6 +72,15 @@ namespace prediction
 {
 namespace internal
 {
+/* The number of classes in one product of the block of rows by the log-likelihoods. The classes are tiled, so the
+   scores of the block stay in the cache and the argmax is updated right after the product of every tile */
+const size_t maxClassBlockSize = 256;
+
+inline size_t getClassBlockSize(const size_t c)
+{
+    return (c < maxClassBlockSize) ? c : maxClassBlockSize;
+}
+
 template <Method method, typename algorithmFPType, CpuType cpu>
 struct methodSpecific
 {};
@@ -123,10 +132,11 @@ services::Status NaiveBayesPredictKernel<algorithmFPType, method, cpu>::compute(
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks * blockSizeDeafult != n);
 
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSizeDeafult, c);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSizeDeafult * c, sizeof(algorithmFPType));
+    /* the running maxima of the rows of the block followed by the scores of one tile of the classes */
+    const size_t buffSize = blockSizeDeafult * (getClassBlockSize(c) + 1);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, buffSize, sizeof(algorithmFPType));
 
-    daal::tls<algorithmFPType *> mkl_buff([=]() -> algorithmFPType * { return _CALLOC_<algorithmFPType, cpu>(blockSizeDeafult * c); });
+    daal::tls<algorithmFPType *> mkl_buff([=]() -> algorithmFPType * { return _CALLOC_<algorithmFPType, cpu>(buffSize); });
 
     SafeStatus safeStat;
     daal::threader_for(nBlocks, nBlocks, [=, &mkl_buff, &safeStat](int k) {
@@ -163,39 +173,55 @@ services::Status methodSpecific<defaultDense, algorithmFPType, cpu>::getPredicti
     DAAL_CHECK_BLOCK_STATUS(rrData);
     const algorithmFPType * data = rrData.get();
 
+    const size_t classBlockSize = getClassBlockSize(c);
+    algorithmFPType * maxVal    = buff;
+    algorithmFPType * scores    = buff + n;
+
+    for (size_t j = 0; j < n; j++)
     {
+        maxVal[j]  = -(services::internal::MaxVal<algorithmFPType>::get());
+        classes[j] = 0;
+    }
+
+    for (size_t c0 = 0; c0 < c; c0 += classBlockSize)
+    {
+        const size_t cn = (c - c0 < classBlockSize) ? c - c0 : classBlockSize;
+
+        /* scores[j * cn + cl] = <x_j, log-likelihoods of the class c0 + cl> */
         const char transa           = 't';
         const char transb           = 'n';
-        const DAAL_INT _m           = c;
+        const DAAL_INT _m           = cn;
         const DAAL_INT _n           = n;
         const DAAL_INT _k           = p;
         const algorithmFPType alpha = 1.0;
         const DAAL_INT lda          = p;
         const DAAL_INT ldy          = p;
         const algorithmFPType beta  = 0.0;
-        const DAAL_INT ldaty        = c;
+        const DAAL_INT ldaty        = cn;
 
-        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, aux_table, &lda, data, &ldy, &beta, buff, &ldaty);
-    }
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, aux_table + c0 * p, &lda, data, &ldy, &beta, scores, &ldaty);
 
-    for (size_t j = 0; j < n; j++)
-    {
-        int max_c                 = 0;
-        algorithmFPType max_c_val = -(services::internal::MaxVal<algorithmFPType>::get());
-
-        PRAGMA_IVDEP
-        for (size_t cl = 0; cl < c; cl++)
+        for (size_t j = 0; j < n; j++)
         {
-            algorithmFPType val = buff[j * c + cl];
+            const algorithmFPType * row = scores + j * cn;
+            int max_c                   = -1;
+            algorithmFPType max_c_val   = maxVal[j];
 
-            if (val > max_c_val)
+            for (size_t cl = 0; cl < cn; cl++)
             {
-                max_c_val = val;
-                max_c     = cl;
+                if (row[cl] > max_c_val)
+                {
+                    max_c_val = row[cl];
+                    max_c     = cl;
+                }
             }
-        }
 
-        classes[j] = max_c;
+            if (max_c >= 0)
+            {
+                maxVal[j]  = max_c_val;
+                classes[j] = c0 + max_c;
+            }
+        }
     }
 
     return services::Status();
@@ -213,37 +239,48 @@ services::Status methodSpecific<fastCSR, algorithmFPType, cpu>::getPredictionDat
     const size_t * colIdx          = rrData.cols();
     const size_t * rowIdx          = rrData.rows();
 
+    const size_t classBlockSize = getClassBlockSize(c);
+    algorithmFPType * maxVal    = buff;
+    algorithmFPType * scores    = buff + n;
+
+    for (size_t j = 0; j < n; j++)
+    {
+        maxVal[j]  = -(services::internal::MaxVal<algorithmFPType>::get());
+        classes[j] = 0;
+    }
+
+    for (size_t c0 = 0; c0 < c; c0 += classBlockSize)
     {
+        const size_t cn = (c - c0 < classBlockSize) ? c - c0 : classBlockSize;
+
+        /* scores[j + cl * n] = <x_j, log-likelihoods of the class c0 + cl>. The log-likelihoods of the tile are the
+           consecutive columns of the p x c column-major matrix */
         const char transa           = 'n';
         const DAAL_INT _n           = n;
         const DAAL_INT _p           = p;
-        const DAAL_INT _c           = c;
+        const DAAL_INT _c           = cn;
         const algorithmFPType alpha = 1.0;
         const algorithmFPType beta  = 0.0;
         const char matdescra[6]     = { 'G', 0, 0, 'F', 0, 0 };
 
-        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &_n, &_c, &_p, &alpha, matdescra, values, (DAAL_INT *)colIdx, (DAAL_INT *)rowIdx, aux_table,
-                                              &_p, &beta, buff, &_n);
-    }
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &_n, &_c, &_p, &alpha, matdescra, values, (DAAL_INT *)colIdx, (DAAL_INT *)rowIdx,
+                                              aux_table + c0 * p, &_p, &beta, scores, &_n);
 
-    for (size_t j = 0; j < n; j++)
-    {
-        int max_c                 = 0;
-        algorithmFPType max_c_val = -(services::internal::MaxVal<algorithmFPType>::get());
-
-        PRAGMA_IVDEP
-        for (size_t cl = 0; cl < c; cl++)
+        /* the scores are stored by the classes, so the maxima of all rows are updated by one class at a time */
+        for (size_t cl = 0; cl < cn; cl++)
         {
-            algorithmFPType val = buff[j + cl * n];
+            const algorithmFPType * col = scores + cl * n;
+            const int classIndex        = c0 + cl;
 
-            if (val > max_c_val)
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < n; j++)
             {
-                max_c_val = val;
-                max_c     = cl;
+                const bool isGreater = col[j] > maxVal[j];
+                maxVal[j]            = isGreater ? col[j] : maxVal[j];
+                classes[j]           = isGreater ? classIndex : classes[j];
             }
         }
-
-        classes[j] = max_c;
     }
 
     return services::Status();
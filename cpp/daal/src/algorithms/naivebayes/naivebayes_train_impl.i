@@ -39,6 +39,7 @@
 #include "src/services/service_data_utils.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_partial_results_merge.h"
 
 #if (__CPUID__(DAAL_CPU) >= __avx512_mic__)
 
@@ -220,32 +221,31 @@ Status mergeModels(const Parameter * nbPar, size_t p, size_t nModels, PartialMod
 {
     size_t c = nbPar->nClasses;
 
-    ReadRows<algorithmFPType, cpu> rrC;
-    ReadRows<algorithmFPType, cpu> rrCi;
+    /* The current sums of the output model are added as the first partial result */
+    const size_t nPartials = nModels + 1;
+    TArray<const algorithmFPType *, cpu> classSizes(nPartials);
+    TArray<const algorithmFPType *, cpu> classGroupSums(nPartials);
+    DAAL_CHECK_MALLOC(classSizes.get() && classGroupSums.get());
+    classSizes[0]     = n_c;
+    classGroupSums[0] = n_ci;
 
+    daal::algorithms::internal::PartialTablesReader<algorithmFPType, cpu> rrC(nModels);
+    daal::algorithms::internal::PartialTablesReader<algorithmFPType, cpu> rrCi(nModels);
+    DAAL_CHECK_MALLOC(rrC.isValid() && rrCi.isValid());
+
+    Status s;
     for (size_t i = 0; i < nModels; i++)
     {
-        const algorithmFPType * in_n_c = rrC.set(models[i]->getClassSize().get(), 0, c);
-        DAAL_CHECK_BLOCK_STATUS(rrC);
-        const algorithmFPType * in_n_ci = rrCi.set(models[i]->getClassGroupSum().get(), 0, c);
-        DAAL_CHECK_BLOCK_STATUS(rrCi);
-
-        PRAGMA_IVDEP
-        for (size_t j = 0; j < c; j++)
-        {
-            n_c[j] += in_n_c[j];
-        }
-
-        PRAGMA_IVDEP
-        for (size_t j = 0; j < p * c; j++)
-        {
-            n_ci[j] += in_n_ci[j];
-        }
+        DAAL_CHECK_STATUS(s, rrC.set(i, *models[i]->getClassSize()));
+        DAAL_CHECK_STATUS(s, rrCi.set(i, *models[i]->getClassGroupSum()));
+        classSizes[i + 1]     = rrC.get()[i];
+        classGroupSums[i + 1] = rrCi.get()[i];
 
         merged_n += models[i]->getNObservations();
     }
 
-    return Status();
+    DAAL_CHECK_STATUS(s, (daal::algorithms::internal::pairwiseSum<algorithmFPType, cpu>(nPartials, classSizes.get(), c, n_c)));
+    return daal::algorithms::internal::pairwiseSum<algorithmFPType, cpu>(nPartials, classGroupSums.get(), p * c, n_ci);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
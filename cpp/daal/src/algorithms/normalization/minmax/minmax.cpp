@@ -75,9 +75,9 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
     Status s;
     DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr()));
 
-    NumericTable::BasicStatisticsDataCollection & basicStatistics = dataTable->basicStatistics;
-    NumericTablePtr minimumsTable                                 = basicStatistics.get(NumericTableIface::minimum);
-    NumericTablePtr maximumsTable                                 = basicStatistics.get(NumericTableIface::maximum);
+    /* the outdated statistics are not used, so they are not checked */
+    NumericTablePtr minimumsTable = dataTable->getActualBasicStatistics(NumericTableIface::minimum);
+    NumericTablePtr maximumsTable = dataTable->getActualBasicStatistics(NumericTableIface::maximum);
 
     size_t nColumns = dataTable->getNumberOfColumns();
     if (minimumsTable)
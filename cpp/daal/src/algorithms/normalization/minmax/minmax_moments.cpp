@@ -33,8 +33,8 @@ namespace internal
 Status computeMinimumsAndMaximums(low_order_moments::BatchImpl * moments, NumericTablePtr & dataTable, NumericTablePtr & minimums,
                                   NumericTablePtr & maximums)
 {
-    minimums = dataTable->basicStatistics.get(NumericTableIface::minimum);
-    maximums = dataTable->basicStatistics.get(NumericTableIface::maximum);
+    minimums = dataTable->getActualBasicStatistics(NumericTableIface::minimum);
+    maximums = dataTable->getActualBasicStatistics(NumericTableIface::maximum);
 
     if (!minimums || !maximums)
     {
@@ -76,6 +76,11 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
     if (method == sumDense)
     {
         const size_t nFeatures = get(data)->getNumberOfColumns();
+        /* the sums computed from the values before their modification are computed again */
+        if (get(data)->getBasicStatisticsStatus() == NumericTable::basicStatisticsOutdated)
+        {
+            DAAL_CHECK_STATUS(s, get(data)->computeBasicStatistics());
+        }
         DAAL_CHECK_STATUS(
             s, checkNumericTable(get(data)->basicStatistics.get(NumericTableIface::sum).get(), basicStatisticsSumStr(), 0, 0, nFeatures, 1));
     }
@@ -147,65 +147,109 @@ services::Status CoordinateDescentKernel<algorithmFPType, method, cpu>::compute(
     DAAL_CHECK_MALLOC(steps);
     DAAL_CHECK_MALLOC(proxs);
 
+    TArray<size_t, cpu> activeIdsT(nRowsArgument);
+    size_t * const activeIds = activeIdsT.get();
+    DAAL_CHECK_MALLOC(activeIds);
+
     const bool positive    = parameter->positive;
     const size_t startedId = parameter->skipTheFirstComponents ? 1 : 0;
-    size_t itr             = 0;
-    for (itr = 0; itr < maxIterations; itr++)
-    {
-        for (size_t id = startedId; id < (nRowsArgument); id++)
+
+    auto updateComponent = [&](size_t id) {
+        for (size_t ic = 0; ic < nColsArgument; ic++)
         {
-            //const algorithmFPType prew = workValue[id];
-            for (size_t ic = 0; ic < nColsArgument; ic++)
-            {
-                prews[ic] = workValue[id * nColsArgument + ic];
-            }
-            gradientHessianFunction->sumOfFunctionsParameter->featureId = id;
-            gradientHessianFunction->computeNoThrow();
+            prews[ic] = workValue[id * nColsArgument + ic];
+        }
+        gradientHessianFunction->sumOfFunctionsParameter->featureId = id;
+        gradientHessianFunction->computeNoThrow();
 
-            for (size_t ic = 0; ic < nColsArgument; ic++)
-            {
-                steps[ic] = (algorithmFPType)1.0 / (iHes[ic] == 0 ? 1 : iHes[ic]);
-            }
+        for (size_t ic = 0; ic < nColsArgument; ic++)
+        {
+            steps[ic] = (algorithmFPType)1.0 / (iHes[ic] == 0 ? 1 : iHes[ic]);
+        }
 
+        for (size_t ic = 0; ic < nColsArgument; ic++)
+        {
+            proxs[ic] = prews[ic] - steps[ic] * iGr[ic];
+        }
+        if (positive)
+        {
             for (size_t ic = 0; ic < nColsArgument; ic++)
             {
-                proxs[ic] = prews[ic] - steps[ic] * iGr[ic];
-            }
-            if (positive)
-            {
-                for (size_t ic = 0; ic < nColsArgument; ic++)
-                {
-                    proxs[ic] = proxs[ic] < 0 ? 0 : proxs[ic];
-                }
+                proxs[ic] = proxs[ic] < 0 ? 0 : proxs[ic];
             }
+        }
 
-            proximalProjectionFunction->sumOfFunctionsParameter->featureId = id;
-            for (size_t ic = 0; ic < nColsArgument; ic++)
-            {
-                const algorithmFPType inversStep             = (algorithmFPType)1.0 / (steps[ic]);
-                argumentForProximal[id * nColsArgument + ic] = inversStep * proxs[ic];
-            }
-            proximalProjectionFunction->computeNoThrow();
+        proximalProjectionFunction->sumOfFunctionsParameter->featureId = id;
+        for (size_t ic = 0; ic < nColsArgument; ic++)
+        {
+            const algorithmFPType inversStep             = (algorithmFPType)1.0 / (steps[ic]);
+            argumentForProximal[id * nColsArgument + ic] = inversStep * proxs[ic];
+        }
+        proximalProjectionFunction->computeNoThrow();
 
-            for (size_t ic = 0; ic < nColsArgument; ic++)
+        for (size_t ic = 0; ic < nColsArgument; ic++)
+        {
+            workValue[id * nColsArgument + ic] = (iHes[ic] == 0) ? workValue[id * nColsArgument + ic] : iPr[ic] * steps[ic];
+        }
+
+        for (size_t ic = 0; ic < nColsArgument; ic++)
+        {
+            const algorithmFPType diff         = daal::internal::Math<algorithmFPType, cpu>::sFabs(prews[ic] - workValue[id * nColsArgument + ic]);
+            const algorithmFPType maxValueCurr = daal::internal::Math<algorithmFPType, cpu>::sFabs(workValue[id * nColsArgument + ic]);
+            maxDiff                            = diff > maxDiff ? diff : maxDiff;
+            maxValue                           = maxValueCurr > maxValue ? maxValueCurr : maxValue;
+        }
+    };
+
+    /* The iterations alternate the sweeps over all the components with the sweeps over the active
+       components, which are non-zero after the last full sweep. The zero components of the L1 penalized
+       problems mostly stay zero, so the active sweeps are much cheaper on the wide data. The full sweep
+       checks the optimality conditions of the zero components: the solution is found when the full sweep
+       converges, the components which leave zero are added to the active set otherwise. */
+    bool fullSweep = true;
+    size_t nActive = 0;
+    size_t itr     = 0;
+    for (itr = 0; itr < maxIterations; itr++)
+    {
+        if (fullSweep)
+        {
+            for (size_t id = startedId; id < nRowsArgument; id++)
             {
-                workValue[id * nColsArgument + ic] = (iHes[ic] == 0) ? workValue[id * nColsArgument + ic] : iPr[ic] * steps[ic];
+                updateComponent(id);
             }
-
-            for (size_t ic = 0; ic < nColsArgument; ic++)
+        }
+        else
+        {
+            for (size_t i = 0; i < nActive; i++)
             {
-                const algorithmFPType diff = daal::internal::Math<algorithmFPType, cpu>::sFabs(prews[ic] - workValue[id * nColsArgument + ic]);
-                const algorithmFPType maxValueCurr = daal::internal::Math<algorithmFPType, cpu>::sFabs(workValue[id * nColsArgument + ic]);
-                maxDiff                            = diff > maxDiff ? diff : maxDiff;
-                maxValue                           = maxValueCurr > maxValue ? maxValueCurr : maxValue;
+                updateComponent(activeIds[i]);
             }
         }
-        if (maxDiff <= accuracyThreshold * maxValue)
+
+        const bool converged = (maxDiff <= accuracyThreshold * maxValue);
+        if (fullSweep && converged)
         {
             break;
         }
-        maxValue = 0;
-        maxDiff  = 0;
+        if (fullSweep)
+        {
+            nActive = 0;
+            for (size_t id = startedId; id < nRowsArgument; id++)
+            {
+                bool isActive = false;
+                for (size_t ic = 0; ic < nColsArgument; ic++)
+                {
+                    isActive |= (workValue[id * nColsArgument + ic] != 0);
+                }
+                if (isActive)
+                {
+                    activeIds[nActive++] = id;
+                }
+            }
+        }
+        fullSweep = converged || (nActive == nRowsArgument - startedId);
+        maxValue  = 0;
+        maxDiff   = 0;
     }
     *nIter = itr + 1;
     return s;
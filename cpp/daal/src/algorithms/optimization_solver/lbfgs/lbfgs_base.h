@@ -184,8 +184,16 @@ private:
     */
     void twoLoopRecursion(size_t m, size_t correctionIndex, algorithmFPType * gradient);
 
+    /*
+    * Writes the value and the gradient computed by the line search at the accepted argument
+    * to the results of the objective function instead of computing them again
+    */
+    Status setLineSearchResult(NumericTable * ntGradient, NumericTable * ntValue);
+
 public:
     bool continueLineSearch;
+    bool lineSearchResultReady;                     /*!< Flag that indicates the line search result is kept for the next iteration */
+    algorithmFPType lineSearchValue;                /*!< Value of the objective function at the argument accepted by the line search */
     IndicesStatus batchIndicesStatus;               /*!< Status of the objective function indices for gradient computation */
     IndicesStatus correctionPairBatchIndicesStatus; /*!< Status of the objective function indices for Hessian computation */
     int * batchIndices;                             /*!< Array that contains the batch indices */
@@ -194,6 +202,7 @@ public:
     algorithmFPType * argumentLPrev; /*!< Average of objective function arguments for previous L iterations. See formula (2.1) in [1] */
     TArray<algorithmFPType, cpu> _gradientPrevPtr;
     TArray<algorithmFPType, cpu> _gradientCurrPtr;
+    TArray<algorithmFPType, cpu> _lineSearchGradientPtr;
     /** Numeric table that stores the batch indices */
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<int, cpu> > ntBatchIndices;
     /** Numeric table that stores the correction pair batch indices */
@@ -25,6 +25,7 @@
 #include "src/algorithms/optimization_solver/lbfgs/lbfgs_base.h"
 #include "src/algorithms/optimization_solver/lbfgs/lbfgs_dense_default_kernel.h"
 #include "src/services/service_algo_utils.h"
+#include "src/algorithms/optimization_solver/lbfgs/oneapi/lbfgs_dense_kernel_oneapi.h"
 
 namespace daal
 {
@@ -70,6 +71,18 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * averageArgLIterResult      = result->get(averageArgumentLIterations).get();
     OptionalArgument * optionalArgumentResult = result->get(iterative_solver::optionalResult).get();
 
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    /* The full-batch computation runs on the device, the stochastic modes keep the CPU kernel
+       that reads the device data through the numeric tables */
+    typedef internal::LBFGSKernelOneAPI<algorithmFPType, method> KernelOneAPI;
+    if (!deviceInfo.isCpu && KernelOneAPI::isSupported(parameter, optionalArgumentInput, optionalArgumentResult))
+    {
+        KernelOneAPI kernel;
+        return kernel.compute(daal::services::internal::hostApp(*input), inputArgument, minimum, nIterations, parameter);
+    }
+
     __DAAL_CALL_KERNEL(env, internal::LBFGSKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                        daal::services::internal::hostApp(*input), correctionPairsInput, correctionIndicesInput, inputArgument, averageArgLIterInput,
                        optionalArgumentInput, correctionPairsResult, correctionIndicesResult, minimum, nIterations, averageArgLIterResult,
@@ -461,6 +461,11 @@ algorithmFPType LBFGSTask<algorithmFPType, cpu>::lineSearch(algorithmFPType * x,
             algorithmFPType fgNewXdn = dotProduct<algorithmFPType, cpu>(n, fgNew.get(), dn);
             if (daal::internal::Math<algorithmFPType, cpu>::sFabs(fgNewXdn) <= c2 * daal::internal::Math<algorithmFPType, cpu>::sFabs(term1))
             {
+                // the next iteration starts at the accepted argument, keep the fused value and gradient for it
+                int result = daal::services::internal::daal_memcpy_s(_lineSearchGradientPtr.get(), n * sizeof(algorithmFPType), fgNew.get(),
+                                                                     n * sizeof(algorithmFPType));
+                this->lineSearchResultReady = !result;
+                this->lineSearchValue       = fvNew.get()[0];
                 break;
             }
         }
@@ -543,6 +548,11 @@ algorithmFPType LBFGSTask<algorithmFPType, cpu>::lineSearch1(algorithmFPType * x
             algorithmFPType fgNewXdn = dotProduct<algorithmFPType, cpu>(n, fgNew.get(), dn);
             if (daal::internal::Math<algorithmFPType, cpu>::sFabs(fgNewXdn) <= c2 * daal::internal::Math<algorithmFPType, cpu>::sFabs(term1))
             {
+                // the next iteration starts at the accepted argument, keep the fused value and gradient for it
+                int result = daal::services::internal::daal_memcpy_s(_lineSearchGradientPtr.get(), n * sizeof(algorithmFPType), fgNew.get(),
+                                                                     n * sizeof(algorithmFPType));
+                this->lineSearchResultReady = !result;
+                this->lineSearchValue       = fvNew.get()[0];
                 break;
             }
         }
@@ -604,7 +614,12 @@ Status LBFGSTask<algorithmFPType, cpu>::updateArgument(size_t iIteration, size_t
                                                           this->argumentSize * sizeof(algorithmFPType));
         DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
     }
-    DAAL_CHECK_STATUS(s, gradientFunction->compute());
+    const bool useLineSearchResult = useWolfeConditions && this->lineSearchResultReady;
+    this->lineSearchResultReady    = false;
+    if (!useLineSearchResult)
+    {
+        DAAL_CHECK_STATUS(s, gradientFunction->compute());
+    }
     if (batchIndicesStatus == user)
     {
         mtBatchIndices.release();
@@ -615,6 +630,10 @@ Status LBFGSTask<algorithmFPType, cpu>::updateArgument(size_t iIteration, size_t
     {
         ntValue = gradientFunction->getResult()->get(objective_function::valueIdx);
     }
+    if (useLineSearchResult)
+    {
+        DAAL_CHECK_STATUS(s, setLineSearchResult(ntGradient.get(), ntValue.get()));
+    }
     mtGradient.set(*ntGradient, 0, this->argumentSize);
     DAAL_CHECK_BLOCK_STATUS(mtGradient);
     algorithmFPType * gradient = mtGradient.get();
@@ -697,7 +716,12 @@ Status LBFGSTask<algorithmFPType, cpu>::updateArgument1(size_t iIteration, size_
                                                           this->argumentSize * sizeof(algorithmFPType));
         DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
     }
-    DAAL_CHECK_STATUS(s, gradientFunction->compute());
+    const bool useLineSearchResult = useWolfeConditions && this->lineSearchResultReady;
+    this->lineSearchResultReady    = false;
+    if (!useLineSearchResult)
+    {
+        DAAL_CHECK_STATUS(s, gradientFunction->compute());
+    }
     if (batchIndicesStatus == user)
     {
         mtBatchIndices.release();
@@ -708,6 +732,10 @@ Status LBFGSTask<algorithmFPType, cpu>::updateArgument1(size_t iIteration, size_
     {
         ntValue = gradientFunction->getResult()->get(objective_function::valueIdx);
     }
+    if (useLineSearchResult)
+    {
+        DAAL_CHECK_STATUS(s, setLineSearchResult(ntGradient.get(), ntValue.get()));
+    }
     mtGradient.set(*ntGradient, 0, this->argumentSize);
     DAAL_CHECK_BLOCK_STATUS(mtGradient);
     algorithmFPType * gradient = mtGradient.get();
@@ -805,6 +833,28 @@ Status LBFGSTask<algorithmFPType, cpu>::updateBatchIndices(size_t iPredefinedInd
     return Status();
 }
 
+/**
+ * Writes the value and the gradient of the objective function kept by the line search
+ * at the accepted argument to the results of the objective function
+ *
+ * \param[out] ntGradient Numeric table that stores the gradient of the objective function
+ * \param[out] ntValue    Numeric table that stores the value of the objective function
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status LBFGSTask<algorithmFPType, cpu>::setLineSearchResult(NumericTable * ntGradient, NumericTable * ntValue)
+{
+    WriteOnlyRows<algorithmFPType, cpu> gradientRows(*ntGradient, 0, this->argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(gradientRows);
+    WriteOnlyRows<algorithmFPType, cpu> valueRows(*ntValue, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(valueRows);
+
+    int result = daal::services::internal::daal_memcpy_s(gradientRows.get(), this->argumentSize * sizeof(algorithmFPType),
+                                                         _lineSearchGradientPtr.get(), this->argumentSize * sizeof(algorithmFPType));
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    valueRows.get()[0] = lineSearchValue;
+    return Status();
+}
+
 /**
  * Two-loop recursion algorithm that computes approximation of inverse Hessian matrix
  * multiplied by input gradient vector from a set of correction pairs (s(j), y(j)), j = 1,...,m.
@@ -1030,7 +1080,8 @@ Status LBFGSTask<algorithmFPType, cpu>::init(NumericTable * inputArgument, Numer
                                              size_t batchSize, size_t correctionPairBatchSize)
 {
     Status s;
-    this->continueLineSearch = true;
+    this->continueLineSearch    = true;
+    this->lineSearchResultReady = false;
     /* Initialize work value with a start value provided by user */
     DAAL_CHECK_STATUS(s, this->setStartArgument(inputArgument));
     DAAL_CHECK_STATUS(s, initArgumentL(averageArgLIterInput, averageArgLIterResult, parameter));
@@ -1068,6 +1119,8 @@ Status LBFGSTask<algorithmFPType, cpu>::init(NumericTable * inputArgument, Numer
     {
         _gradientPrevPtr.reset(this->argumentSize);
         _gradientCurrPtr.reset(this->argumentSize);
+        _lineSearchGradientPtr.reset(this->argumentSize);
+        DAAL_CHECK_MALLOC(_gradientPrevPtr.get() && _gradientCurrPtr.get() && _lineSearchGradientPtr.get());
     }
 
     return s;
@@ -1080,7 +1133,8 @@ Status LBFGSTask<algorithmFPType, cpu>::init(NumericTable * inputArgument, Numer
                                              size_t nTerms, size_t batchSize, size_t correctionPairBatchSize)
 {
     Status s;
-    this->continueLineSearch = true;
+    this->continueLineSearch    = true;
+    this->lineSearchResultReady = false;
     /* Initialize work value with a start value provided by user */
     DAAL_CHECK_STATUS(s, this->setStartArgument(inputArgument));
     DAAL_CHECK_STATUS(s, initArgumentL(averageArgLIterInput, averageArgLIterResult, parameter));
@@ -1118,6 +1172,8 @@ Status LBFGSTask<algorithmFPType, cpu>::init(NumericTable * inputArgument, Numer
     {
         _gradientPrevPtr.reset(this->argumentSize);
         _gradientCurrPtr.reset(this->argumentSize);
+        _lineSearchGradientPtr.reset(this->argumentSize);
+        DAAL_CHECK_MALLOC(_gradientPrevPtr.get() && _gradientCurrPtr.get() && _lineSearchGradientPtr.get());
     }
 
     return s;
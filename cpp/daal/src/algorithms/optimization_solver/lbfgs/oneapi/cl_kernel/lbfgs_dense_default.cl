@@ -0,0 +1,76 @@
+/* file: lbfgs_dense_default.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of LBFGS dense default OpenCL kernels.
+//--
+*/
+
+#ifndef __LBFGS_DENSE_DEFAULT_KERNELS_CL__
+#define __LBFGS_DENSE_DEFAULT_KERNELS_CL__
+
+#include <string.h>
+
+#define DECLARE_SOURCE_DAAL(name, src) static const char *(name) = #src;
+
+DECLARE_SOURCE_DAAL(
+    clKernelLBFGS,
+
+    // The row of the correction pairs is the difference of the current and previous vectors
+    __kernel void computeDifference(const __global algorithmFPType * const current, const __global algorithmFPType * const previous,
+                                    __global algorithmFPType * difference, const uint offset) {
+        const uint j = get_global_id(0);
+
+        difference[offset + j] = current[j] - previous[j];
+    }
+
+    __kernel void invertDotProduct(const __global algorithmFPType * const dotProduct, __global algorithmFPType * rho, const uint index) {
+        const algorithmFPType value = dotProduct[0];
+
+        rho[index] = (value != (algorithmFPType)0) ? (algorithmFPType)1 / value : (algorithmFPType)0;
+    }
+
+    // The first loop of the two-loop recursion: alpha = rho * s' * q, q = q - alpha * y
+    __kernel void updateFirstLoop(const __global algorithmFPType * const correctionY, const __global algorithmFPType * const dotProduct,
+                                  const __global algorithmFPType * const rho, __global algorithmFPType * alpha, __global algorithmFPType * q,
+                                  const uint index, const uint argumentSize) {
+        const uint j            = get_global_id(0);
+        const algorithmFPType a = rho[index] * dotProduct[0];
+
+        if (j == 0)
+        {
+            alpha[index] = a;
+        }
+        q[j] -= a * correctionY[index * argumentSize + j];
+    }
+
+    // The second loop of the two-loop recursion: beta = rho * y' * r, r = r + (alpha - beta) * s
+    __kernel void updateSecondLoop(const __global algorithmFPType * const correctionS, const __global algorithmFPType * const dotProduct,
+                                   const __global algorithmFPType * const rho, const __global algorithmFPType * const alpha,
+                                   __global algorithmFPType * r, const uint index, const uint argumentSize) {
+        const uint j                = get_global_id(0);
+        const algorithmFPType coeff = alpha[index] - rho[index] * dotProduct[0];
+
+        r[j] += coeff * correctionS[index * argumentSize + j];
+    }
+
+);
+
+#undef DECLARE_SOURCE_DAAL
+
+#endif
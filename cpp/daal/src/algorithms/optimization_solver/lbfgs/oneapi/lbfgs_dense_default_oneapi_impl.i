@@ -0,0 +1,408 @@
+/* file: lbfgs_dense_default_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of LBFGS dense default Batch algorithm on GPU.
+//--
+*/
+
+#include "src/algorithms/optimization_solver/lbfgs/oneapi/cl_kernel/lbfgs_dense_default.cl"
+#include "data_management/data/internal/numeric_table_sycl_homogen.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/sycl/blas_gpu.h"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(optimization_solver.lbfgs.batch.oneapi);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace lbfgs
+{
+namespace internal
+{
+using namespace daal::services::internal::sycl;
+using namespace daal::data_management;
+using namespace daal::internal;
+
+using daal::services::internal::Buffer;
+using daal::data_management::internal::SyclHomogenNumericTable;
+
+template <typename algorithmFPType>
+bool LBFGSKernelOneAPI<algorithmFPType, defaultDense>::isSupported(const Parameter * parameter, const OptionalArgument * optionalArgumentInput,
+                                                                   const OptionalArgument * optionalArgumentResult)
+{
+    const size_t nTerms = parameter->function->sumOfFunctionsParameter->numberOfTerms;
+    return parameter->batchSize >= nTerms && parameter->correctionPairBatchSize >= nTerms && parameter->L == 1 && !optionalArgumentInput
+           && !optionalArgumentResult;
+}
+
+template <typename algorithmFPType>
+void LBFGSKernelOneAPI<algorithmFPType, defaultDense>::buildProgram(ClKernelFactoryIface & factory)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(buildProgram);
+    services::String options = getKeyFPType<algorithmFPType>();
+
+    services::String cachekey("__daal_algorithms_optimization_solver_lbfgs_");
+    cachekey.add(options);
+
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), clKernelLBFGS, options.c_str());
+}
+
+// Writes x' * y to the element of the result, the dot product stays on the device
+template <typename algorithmFPType>
+services::Status LBFGSKernelOneAPI<algorithmFPType, defaultDense>::dotProduct(const Buffer<algorithmFPType> & x, const Buffer<algorithmFPType> & y,
+                                                                              const uint32_t n, Buffer<algorithmFPType> & result,
+                                                                              const uint32_t offset)
+{
+    return BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::Trans, 1, 1, n, algorithmFPType(1), x,
+                                           n, 0, y, n, 0, algorithmFPType(0), result, 1, offset);
+}
+
+template <typename algorithmFPType>
+services::Status LBFGSKernelOneAPI<algorithmFPType, defaultDense>::readScalars(const Buffer<algorithmFPType> & scalars, const uint32_t nScalars,
+                                                                               algorithmFPType * values)
+{
+    services::Status status;
+    auto scalarsHostPtr = scalars.toHost(data_management::readOnly, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    const algorithmFPType * scalarsHost = scalarsHostPtr.get();
+    for (uint32_t i = 0; i < nScalars; i++)
+    {
+        values[i] = scalarsHost[i];
+    }
+    return status;
+}
+
+// Sets the row index of the correction pairs to s = x - xPrev, y = g - gPrev and rho[index] = 1 / (s' * y)
+template <typename algorithmFPType>
+services::Status LBFGSKernelOneAPI<algorithmFPType, defaultDense>::computeCorrectionPair(
+    const uint32_t argumentSize, const uint32_t index, const Buffer<algorithmFPType> & argument, const Buffer<algorithmFPType> & argumentPrev,
+    const Buffer<algorithmFPType> & gradient, const Buffer<algorithmFPType> & gradientPrev, Buffer<algorithmFPType> & correctionS,
+    Buffer<algorithmFPType> & correctionY, Buffer<algorithmFPType> & rho, Buffer<algorithmFPType> & scalars)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeCorrectionPair);
+    services::Status status;
+
+    ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+
+    buildProgram(factory);
+
+    KernelPtr differenceKernel = factory.getKernel("computeDifference", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    KernelRange range(argumentSize);
+    {
+        KernelArguments args(4);
+        args.set(0, argument, AccessModeIds::read);
+        args.set(1, argumentPrev, AccessModeIds::read);
+        args.set(2, correctionS, AccessModeIds::readwrite);
+        args.set(3, index * argumentSize);
+
+        ctx.run(range, differenceKernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+    {
+        KernelArguments args(4);
+        args.set(0, gradient, AccessModeIds::read);
+        args.set(1, gradientPrev, AccessModeIds::read);
+        args.set(2, correctionY, AccessModeIds::readwrite);
+        args.set(3, index * argumentSize);
+
+        ctx.run(range, differenceKernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    const Buffer<algorithmFPType> s = correctionS.getSubBuffer(index * argumentSize, argumentSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    const Buffer<algorithmFPType> y = correctionY.getSubBuffer(index * argumentSize, argumentSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_STATUS(status, dotProduct(s, y, argumentSize, scalars, 0));
+
+    KernelPtr invertKernel = factory.getKernel("invertDotProduct", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(3);
+    args.set(0, scalars, AccessModeIds::read);
+    args.set(1, rho, AccessModeIds::readwrite);
+    args.set(2, index);
+
+    ctx.run(KernelRange(1), invertKernel, args, &status);
+    return status;
+}
+
+// Multiplies the direction by the approximation of the inverse Hessian matrix, all the
+// scalars of the recursion stay on the device. See Algorithm 7.4 in [2].
+template <typename algorithmFPType>
+services::Status LBFGSKernelOneAPI<algorithmFPType, defaultDense>::twoLoopRecursion(
+    const uint32_t argumentSize, const uint32_t m, const uint32_t nPairs, const uint32_t lastIndex, const Buffer<algorithmFPType> & correctionS,
+    const Buffer<algorithmFPType> & correctionY, const Buffer<algorithmFPType> & rho, Buffer<algorithmFPType> & alpha,
+    Buffer<algorithmFPType> & scalars, Buffer<algorithmFPType> & direction)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(twoLoopRecursion);
+    services::Status status;
+
+    ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+
+    buildProgram(factory);
+
+    KernelPtr firstLoopKernel = factory.getKernel("updateFirstLoop", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    KernelPtr secondLoopKernel = factory.getKernel("updateSecondLoop", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelRange range(argumentSize);
+    for (uint32_t k = 0; k < nPairs; k++)
+    {
+        const uint32_t index            = (lastIndex + m - k) % m;
+        const Buffer<algorithmFPType> s = correctionS.getSubBuffer(index * argumentSize, argumentSize, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, dotProduct(s, direction, argumentSize, scalars, 0));
+
+        KernelArguments args(7);
+        args.set(0, correctionY, AccessModeIds::read);
+        args.set(1, scalars, AccessModeIds::read);
+        args.set(2, rho, AccessModeIds::read);
+        args.set(3, alpha, AccessModeIds::readwrite);
+        args.set(4, direction, AccessModeIds::readwrite);
+        args.set(5, index);
+        args.set(6, argumentSize);
+
+        ctx.run(range, firstLoopKernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    for (uint32_t k = 0; k < nPairs; k++)
+    {
+        const uint32_t index            = (lastIndex + m + 1 - nPairs + k) % m;
+        const Buffer<algorithmFPType> y = correctionY.getSubBuffer(index * argumentSize, argumentSize, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, dotProduct(y, direction, argumentSize, scalars, 0));
+
+        KernelArguments args(7);
+        args.set(0, correctionS, AccessModeIds::read);
+        args.set(1, scalars, AccessModeIds::read);
+        args.set(2, rho, AccessModeIds::read);
+        args.set(3, alpha, AccessModeIds::read);
+        args.set(4, direction, AccessModeIds::readwrite);
+        args.set(5, index);
+        args.set(6, argumentSize);
+
+        ctx.run(range, secondLoopKernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status LBFGSKernelOneAPI<algorithmFPType, defaultDense>::compute(HostAppIface * pHost, NumericTable * inputArgument,
+                                                                           NumericTable * minimum, NumericTable * nIterations,
+                                                                           Parameter * parameter)
+{
+    services::Status status;
+
+    ExecutionContextIface & ctx = services::internal::getDefaultContext();
+    const TypeIds::Id idType    = TypeIds::id<algorithmFPType>();
+
+    const uint32_t argumentSize             = inputArgument->getNumberOfRows();
+    const size_t nIter                      = parameter->nIterations;
+    const uint32_t m                        = parameter->m;
+    const algorithmFPType accuracyThreshold = parameter->accuracyThreshold;
+
+    WriteRows<int, sse2> nIterationsBD(*nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsBD);
+    int * nProceededIterations = nIterationsBD.get();
+
+    BlockDescriptor<algorithmFPType> argumentBD;
+    DAAL_CHECK_STATUS(status, minimum->getBlockOfRows(0, argumentSize, ReadWriteMode::readWrite, argumentBD));
+    Buffer<algorithmFPType> argumentBuff = argumentBD.getBuffer();
+    {
+        BlockDescriptor<algorithmFPType> startValueBD;
+        DAAL_CHECK_STATUS(status, inputArgument->getBlockOfRows(0, argumentSize, ReadWriteMode::readOnly, startValueBD));
+        ctx.copy(argumentBuff, 0, startValueBD.getBuffer(), 0, argumentSize, &status);
+        DAAL_CHECK_STATUS(status, inputArgument->releaseBlockOfRows(startValueBD));
+    }
+
+    *nProceededIterations = 0;
+    if (nIter == 0 || m == 0)
+    {
+        return minimum->releaseBlockOfRows(argumentBD);
+    }
+
+    UniversalBuffer gradientU                = ctx.allocate(idType, argumentSize, &status);
+    UniversalBuffer argumentPrevU            = ctx.allocate(idType, argumentSize, &status);
+    UniversalBuffer gradientPrevU            = ctx.allocate(idType, argumentSize, &status);
+    UniversalBuffer directionU               = ctx.allocate(idType, argumentSize, &status);
+    UniversalBuffer correctionSU             = ctx.allocate(idType, m * argumentSize, &status);
+    UniversalBuffer correctionYU             = ctx.allocate(idType, m * argumentSize, &status);
+    UniversalBuffer rhoU                     = ctx.allocate(idType, m, &status);
+    UniversalBuffer alphaU                   = ctx.allocate(idType, m, &status);
+    UniversalBuffer scalarsU                 = ctx.allocate(idType, 2, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    Buffer<algorithmFPType> gradientBuff     = gradientU.get<algorithmFPType>();
+    Buffer<algorithmFPType> argumentPrevBuff = argumentPrevU.get<algorithmFPType>();
+    Buffer<algorithmFPType> gradientPrevBuff = gradientPrevU.get<algorithmFPType>();
+    Buffer<algorithmFPType> directionBuff    = directionU.get<algorithmFPType>();
+    Buffer<algorithmFPType> correctionSBuff  = correctionSU.get<algorithmFPType>();
+    Buffer<algorithmFPType> correctionYBuff  = correctionYU.get<algorithmFPType>();
+    Buffer<algorithmFPType> rhoBuff          = rhoU.get<algorithmFPType>();
+    Buffer<algorithmFPType> alphaBuff        = alphaU.get<algorithmFPType>();
+    Buffer<algorithmFPType> scalarsBuff      = scalarsU.get<algorithmFPType>();
+
+    sum_of_functions::BatchPtr function              = parameter->function;
+    NumericTablePtr previousArgument                 = function->sumOfFunctionsInput->get(sum_of_functions::argument);
+    NumericTablePtr previousBatchIndices             = function->sumOfFunctionsParameter->batchIndices;
+    const DAAL_UINT64 previousResultsToCompute       = function->sumOfFunctionsParameter->resultsToCompute;
+    function->sumOfFunctionsParameter->batchIndices     = NumericTablePtr();
+    function->sumOfFunctionsParameter->resultsToCompute = objective_function::gradient | objective_function::value;
+
+    auto argumentSNT = SyclHomogenNumericTable<algorithmFPType>::create(argumentBuff, 1, argumentSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, argumentSNT);
+    auto gradientSNT = SyclHomogenNumericTable<algorithmFPType>::create(gradientBuff, 1, argumentSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    function->getResult()->set(objective_function::gradientIdx, gradientSNT);
+
+    const algorithmFPType c1            = 0.0001; // Nocendal recomendations
+    const algorithmFPType c2            = 0.9;
+    const algorithmFPType minStepLength = 0.0000001;
+
+    bool continueLineSearch = true;
+    bool gradientReady      = false;
+    uint32_t nPairs         = 0;
+    uint32_t lastIndex      = m - 1;
+    algorithmFPType value   = 0;
+
+    *nProceededIterations = static_cast<int>(nIter);
+    services::internal::HostAppHelper host(pHost, 10);
+    for (size_t iter = 0; iter < nIter; iter++)
+    {
+        /* The line search leaves the value and the gradient at the accepted argument */
+        if (!gradientReady)
+        {
+            DAAL_CHECK_STATUS(status, function->computeNoThrow());
+            ReadRows<algorithmFPType, sse2> valueBD(*function->getResult()->get(objective_function::valueIdx), 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(valueBD);
+            value = valueBD.get()[0];
+        }
+        gradientReady = false;
+
+        if (host.isCancelled(status, 1))
+        {
+            *nProceededIterations = static_cast<int>(iter);
+            break;
+        }
+
+        if (iter > 0)
+        {
+            lastIndex = (lastIndex + 1) % m;
+            nPairs    = (nPairs < m) ? nPairs + 1 : m;
+            DAAL_CHECK_STATUS(status, computeCorrectionPair(argumentSize, lastIndex, argumentBuff, argumentPrevBuff, gradientBuff, gradientPrevBuff,
+                                                            correctionSBuff, correctionYBuff, rhoBuff, scalarsBuff));
+        }
+
+        /* Check accuracy, the only synchronization with the host unless the line search runs */
+        algorithmFPType norms[2];
+        DAAL_CHECK_STATUS(status, dotProduct(gradientBuff, gradientBuff, argumentSize, scalarsBuff, 0));
+        DAAL_CHECK_STATUS(status, dotProduct(argumentBuff, argumentBuff, argumentSize, scalarsBuff, 1));
+        DAAL_CHECK_STATUS(status, readScalars(scalarsBuff, 2, norms));
+        if (norms[0] < accuracyThreshold * daal::internal::Math<algorithmFPType, sse2>::sMax(algorithmFPType(1), norms[1]))
+        {
+            *nProceededIterations = static_cast<int>(iter);
+            break;
+        }
+
+        /* Compute the direction -H * gradient */
+        ctx.fill(directionU, 0.0, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xaxpy(argumentSize, -1.0, gradientBuff, 1, directionBuff, 1));
+        DAAL_CHECK_STATUS(status,
+                          twoLoopRecursion(argumentSize, m, nPairs, lastIndex, correctionSBuff, correctionYBuff, rhoBuff, alphaBuff, scalarsBuff,
+                                           directionBuff));
+
+        ctx.copy(argumentPrevBuff, 0, argumentBuff, 0, argumentSize, &status);
+        ctx.copy(gradientPrevBuff, 0, gradientBuff, 0, argumentSize, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        algorithmFPType stepLength = 1;
+        if (continueLineSearch)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(lineSearch);
+            continueLineSearch = false;
+
+            algorithmFPType term1 = 0;
+            DAAL_CHECK_STATUS(status, dotProduct(gradientBuff, directionBuff, argumentSize, scalarsBuff, 0));
+            DAAL_CHECK_STATUS(status, readScalars(scalarsBuff, 1, &term1));
+
+            const algorithmFPType stepLengthZero  = 0.5;
+            const algorithmFPType stepLengthScale = 0.4;
+            size_t it                             = 0;
+            while (daal::internal::Math<algorithmFPType, sse2>::sFabs(stepLength) > minStepLength)
+            {
+                DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xaxpy(argumentSize, stepLength, directionBuff, 1, argumentBuff, 1));
+                DAAL_CHECK_STATUS(status, function->computeNoThrow());
+                DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xaxpy(argumentSize, -stepLength, directionBuff, 1, argumentBuff, 1));
+
+                algorithmFPType newValue = 0;
+                {
+                    ReadRows<algorithmFPType, sse2> valueBD(*function->getResult()->get(objective_function::valueIdx), 0, 1);
+                    DAAL_CHECK_BLOCK_STATUS(valueBD);
+                    newValue = valueBD.get()[0];
+                }
+
+                /* Wolfe conditions */
+                if (newValue - value <= c1 * stepLength * term1)
+                {
+                    algorithmFPType newTerm = 0;
+                    DAAL_CHECK_STATUS(status, dotProduct(gradientBuff, directionBuff, argumentSize, scalarsBuff, 0));
+                    DAAL_CHECK_STATUS(status, readScalars(scalarsBuff, 1, &newTerm));
+                    if (daal::internal::Math<algorithmFPType, sse2>::sFabs(newTerm)
+                        <= c2 * daal::internal::Math<algorithmFPType, sse2>::sFabs(term1))
+                    {
+                        value         = newValue;
+                        gradientReady = true;
+                        break;
+                    }
+                }
+                it += 1;
+                continueLineSearch = true;
+                stepLength *= (stepLengthZero + stepLengthScale / (algorithmFPType)it); // 0.9, 0.7, 0.63, 0.6, ...
+            }
+        }
+
+        /* Update argument */
+        DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xaxpy(argumentSize, stepLength, directionBuff, 1, argumentBuff, 1));
+    }
+
+    function->sumOfFunctionsParameter->batchIndices     = previousBatchIndices;
+    function->sumOfFunctionsParameter->resultsToCompute = previousResultsToCompute;
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, previousArgument);
+    return minimum->releaseBlockOfRows(argumentBD);
+}
+
+} // namespace internal
+} // namespace lbfgs
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,114 @@
+/* file: lbfgs_dense_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template function that computes LBFGS on GPU.
+//--
+
+#ifndef __LBFGS_DENSE_KERNEL_ONEAPI_H__
+#define __LBFGS_DENSE_KERNEL_ONEAPI_H__
+
+#include "algorithms/optimization_solver/lbfgs/lbfgs_batch.h"
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "services/internal/sycl/execution_context.h"
+#include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
+#include "src/services/service_algo_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace lbfgs
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+template <typename algorithmFPType, Method method>
+class LBFGSKernelOneAPI : public Kernel
+{
+public:
+    services::Status compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum, NumericTable * nIterations,
+                             Parameter * parameter)
+    {
+        return services::ErrorMethodNotImplemented;
+    }
+
+    static bool isSupported(const Parameter * parameter, const OptionalArgument * optionalArgumentInput,
+                            const OptionalArgument * optionalArgumentResult)
+    {
+        return false;
+    }
+};
+
+/**
+ *  \brief Kernel for LBFGS computation on GPU. The arguments, the gradients and the correction
+ *  pairs stay on the device, the host only reads the scalars that drive the line search and
+ *  the convergence check.
+ */
+template <typename algorithmFPType>
+class LBFGSKernelOneAPI<algorithmFPType, defaultDense> : public Kernel
+{
+public:
+    services::Status compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum, NumericTable * nIterations,
+                             Parameter * parameter);
+
+    /*
+     * Returns true if the computation with the parameter is supported on GPU: the full gradient
+     * with the Wolfe line search and no optional input or result
+     */
+    static bool isSupported(const Parameter * parameter, const OptionalArgument * optionalArgumentInput,
+                            const OptionalArgument * optionalArgumentResult);
+
+private:
+    static services::Status dotProduct(const services::internal::Buffer<algorithmFPType> & x, const services::internal::Buffer<algorithmFPType> & y,
+                                       const uint32_t n, services::internal::Buffer<algorithmFPType> & result, const uint32_t offset);
+
+    static services::Status readScalars(const services::internal::Buffer<algorithmFPType> & scalars, const uint32_t nScalars,
+                                        algorithmFPType * values);
+
+    static services::Status computeCorrectionPair(const uint32_t argumentSize, const uint32_t index,
+                                                  const services::internal::Buffer<algorithmFPType> & argument,
+                                                  const services::internal::Buffer<algorithmFPType> & argumentPrev,
+                                                  const services::internal::Buffer<algorithmFPType> & gradient,
+                                                  const services::internal::Buffer<algorithmFPType> & gradientPrev,
+                                                  services::internal::Buffer<algorithmFPType> & correctionS,
+                                                  services::internal::Buffer<algorithmFPType> & correctionY,
+                                                  services::internal::Buffer<algorithmFPType> & rho,
+                                                  services::internal::Buffer<algorithmFPType> & scalars);
+
+    static services::Status twoLoopRecursion(const uint32_t argumentSize, const uint32_t m, const uint32_t nPairs, const uint32_t lastIndex,
+                                             const services::internal::Buffer<algorithmFPType> & correctionS,
+                                             const services::internal::Buffer<algorithmFPType> & correctionY,
+                                             const services::internal::Buffer<algorithmFPType> & rho,
+                                             services::internal::Buffer<algorithmFPType> & alpha,
+                                             services::internal::Buffer<algorithmFPType> & scalars,
+                                             services::internal::Buffer<algorithmFPType> & direction);
+
+    static void buildProgram(services::internal::sycl::ClKernelFactoryIface & factory);
+};
+
+} // namespace internal
+} // namespace lbfgs
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
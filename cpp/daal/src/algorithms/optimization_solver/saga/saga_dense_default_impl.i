@@ -32,6 +32,7 @@
 #include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
 #include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
 #include "algorithms/optimization_solver/saga/saga_types.h"
+#include "services/daal_atomic_int.h"
 
 namespace daal
 {
@@ -230,6 +231,15 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
     NumericTablePtr batchIndicesNT = parameter->batchIndices;
     ReadRows<algorithmFPType, cpu> batchIndicesBD;
 
+    if (parameter->asynchronous && !batchIndicesNT)
+    {
+        size_t nIterationsDone = 0;
+        s = computeAsynchronous(function, proximaProjection, workValue, savedGradients, summGrads, sizeArgument, n, maxIterations, tolerance,
+                                learningRateArray, learningRateLength, auto_step, engine, nIterationsDone);
+        *nIterationsPerformed.get() = nIterationsDone;
+        return (!result) ? s : Status(ErrorMemoryCopyFailedInternal);
+    }
+
     if (batchIndicesNT)
     {
         batchIndicesBD.set(*batchIndicesNT, 0, batchIndicesNT->getNumberOfRows());
@@ -343,6 +353,180 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
     return (!result) ? s : Status(ErrorMemoryCopyFailedInternal);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+AsyncTask<algorithmFPType, cpu> * AsyncTask<algorithmFPType, cpu>::create(const sum_of_functions::BatchPtr & function,
+                                                                          const sum_of_functions::BatchPtr & proximalProjection, size_t sizeArgument,
+                                                                          size_t maxIndices)
+{
+    AsyncTask<algorithmFPType, cpu> * task = new AsyncTask<algorithmFPType, cpu>();
+    if (!task) return nullptr;
+
+    task->function           = function->clone();
+    task->proximalProjection = proximalProjection->clone();
+    task->previous.reset(sizeArgument);
+    task->argument.reset(sizeArgument);
+    task->summGradsDelta.reset(sizeArgument);
+    task->indices.reset(maxIndices);
+    if (!task->function || !task->proximalProjection || !task->previous.get() || !task->argument.get() || !task->summGradsDelta.get()
+        || !task->indices.get())
+    {
+        delete task;
+        return nullptr;
+    }
+    daal::services::internal::service_memset<algorithmFPType, cpu>(task->summGradsDelta.get(), 0, sizeArgument);
+
+    Status st;
+    task->function->sumOfFunctionsParameter->batchIndices = HomogenNumericTableCPU<int, cpu>::create(&task->batchIndex, 1, 1, &st);
+    NumericTablePtr argumentTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(task->argument.get(), 1, sizeArgument, &st);
+    if (!st)
+    {
+        delete task;
+        return nullptr;
+    }
+    task->proximalProjection->sumOfFunctionsInput->set(sum_of_functions::argument, argumentTable);
+
+    task->function->enableChecks(false);
+    task->proximalProjection->enableChecks(false);
+    return task;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status SagaKernel<algorithmFPType, method, cpu>::computeAsynchronous(
+    const sum_of_functions::BatchPtr & function, const sum_of_functions::BatchPtr & proximalProjection, algorithmFPType * workValue,
+    algorithmFPType * savedGradients, algorithmFPType * summGrads, size_t sizeArgument, size_t n, size_t maxIterations, algorithmFPType tolerance,
+    const algorithmFPType * learningRateArray, size_t learningRateLength, algorithmFPType step, engines::BatchBase & engine, size_t & nIterationsDone)
+{
+    typedef AsyncTask<algorithmFPType, cpu> AsyncTaskType;
+    typedef daal::internal::Math<algorithmFPType, cpu> MathType;
+
+    nIterationsDone = 0;
+
+    engines::internal::BatchBaseImpl * engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(&engine);
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    const size_t nMaxThreads = daal::threader_get_max_threads_number();
+    const size_t nThreads    = (nMaxThreads < n) ? nMaxThreads : n;
+    const size_t maxIndices  = n / nThreads + 1;
+
+    TArray<AsyncTaskType *, cpu> tasksArray(nThreads);
+    AsyncTaskType ** tasks = tasksArray.get();
+    DAAL_CHECK_MALLOC(tasks);
+
+    Status s;
+    for (size_t t = 0; t < nThreads; t++)
+    {
+        tasks[t] = AsyncTaskType::create(function, proximalProjection, sizeArgument, maxIndices);
+        if (!tasks[t]) s = Status(ErrorMemoryAllocationFailed);
+    }
+
+    const algorithmFPType inverse_n = algorithmFPType(1) / algorithmFPType(n);
+    daal::services::Atomic<int> isConverged(0);
+
+    /* Every round is one pass over the terms: the sum of the saved gradients is
+       stale within the round and the thread corrects it with its own changes */
+    while (s && !isConverged.get() && nIterationsDone < maxIterations)
+    {
+        const size_t nItersInRound = (maxIterations - nIterationsDone < n) ? maxIterations - nIterationsDone : n;
+
+        for (size_t t = 0; t < nThreads && s; t++)
+        {
+            const size_t nLocalIters = ((t + 1) * nItersInRound) / nThreads - (t * nItersInRound) / nThreads;
+            const int firstTerm      = (int)((t * n) / nThreads);
+            const int endTerm        = (int)(((t + 1) * n) / nThreads);
+            if (nLocalIters > 0
+                && daal::internal::RNGs<int, cpu>().uniform((int)nLocalIters, tasks[t]->indices.get(), engineImpl->getState(), firstTerm, endTerm))
+            {
+                s = Status(ErrorIncorrectErrorcodeFromGenerator);
+            }
+        }
+        if (!s) break;
+
+        SafeStatus safeStat;
+        const size_t firstIteration = nIterationsDone;
+        daal::threader_for(nThreads, nThreads, [&](size_t t) {
+            AsyncTaskType * task     = tasks[t];
+            algorithmFPType * prev   = task->previous.get();
+            algorithmFPType * arg    = task->argument.get();
+            algorithmFPType * delta  = task->summGradsDelta.get();
+            const size_t nLocalIters = ((t + 1) * nItersInRound) / nThreads - (t * nItersInRound) / nThreads;
+
+            for (size_t k = 0; k < nLocalIters && !isConverged.get(); k++)
+            {
+                task->batchIndex = task->indices.get()[k];
+                Status st        = task->function->computeNoThrow();
+                DAAL_CHECK_STATUS_THR(st);
+
+                NumericTable * gradientTable = task->function->getResult()->get(objective_function::gradientIdx).get();
+                ReadRows<algorithmFPType, cpu> gradientBD(*gradientTable, 0, sizeArgument);
+                DAAL_CHECK_BLOCK_STATUS_THR(gradientBD);
+                const algorithmFPType * gradient = gradientBD.get();
+
+                algorithmFPType * saved                  = savedGradients + task->batchIndex * sizeArgument;
+                const size_t iter                        = firstIteration + k * nThreads + t;
+                const algorithmFPType stepLength         = learningRateLength ? learningRateArray[iter % learningRateLength] : step;
+                const algorithmFPType inverse_stepLength = algorithmFPType(1.0) / stepLength;
+
+                for (size_t j = 0; j < sizeArgument; j++)
+                {
+                    prev[j]                    = workValue[j];
+                    const algorithmFPType diff = gradient[j] - saved[j];
+                    delta[j] += diff;
+                    arg[j] = (prev[j] - stepLength * (diff + (summGrads[j] + delta[j]) * inverse_n)) * inverse_stepLength;
+                }
+
+                st = task->proximalProjection->computeNoThrow();
+                DAAL_CHECK_STATUS_THR(st);
+
+                NumericTable * proxTable = task->proximalProjection->getResult()->get(objective_function::proximalProjectionIdx).get();
+                ReadRows<algorithmFPType, cpu> proxBD(*proxTable, 0, sizeArgument);
+                DAAL_CHECK_BLOCK_STATUS_THR(proxBD);
+                const algorithmFPType * prox = proxBD.get();
+
+                /* The argument is changed by the increments, so the concurrent updates of the other threads are kept */
+                bool continueCheck = false;
+                for (size_t j = 0; j < sizeArgument; j++)
+                {
+                    const algorithmFPType value     = stepLength * prox[j];
+                    const algorithmFPType increment = value - prev[j];
+                    if (increment != 0) workValue[j] += increment;
+                    continueCheck |= (MathType::sFabs(increment) >= tolerance * MathType::sMax(1, MathType::sFabs(value)));
+                }
+                task->nIterations++;
+
+                if (!continueCheck)
+                {
+                    isConverged.set(1);
+                    break;
+                }
+
+                for (size_t j = 0; j < sizeArgument; j++)
+                {
+                    saved[j] = gradient[j];
+                }
+            }
+        });
+        s |= safeStat.detach();
+
+        for (size_t t = 0; t < nThreads; t++)
+        {
+            algorithmFPType * delta = tasks[t]->summGradsDelta.get();
+            for (size_t j = 0; j < sizeArgument; j++)
+            {
+                summGrads[j] += delta[j];
+                delta[j] = 0;
+            }
+            nIterationsDone += tasks[t]->nIterations;
+            tasks[t]->nIterations = 0;
+        }
+    }
+
+    for (size_t t = 0; t < nThreads; t++)
+    {
+        delete tasks[t];
+    }
+    return s;
+}
+
 } // namespace internal
 
 } // namespace saga
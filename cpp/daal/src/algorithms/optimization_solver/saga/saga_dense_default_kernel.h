@@ -27,6 +27,7 @@
 #include "data_management/data/numeric_table.h"
 #include "src/externals/service_math.h"
 #include "src/data_management/service_micro_table.h"
+#include "src/services/service_arrays.h"
 
 using namespace daal::data_management;
 using namespace daal::internal;
@@ -49,6 +50,61 @@ public:
     services::Status compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum, NumericTable * nIterations,
                              NumericTable * gradientsTableInput, NumericTable * gradientsTableResult, Parameter * parameter,
                              engines::BatchBase & engine);
+
+protected:
+    /**
+     * Runs the lock-free (Hogwild) iterations. The terms of the objective function
+     * are split between the threads, every thread samples its own terms, so the
+     * rows of the table of the saved gradients have the single writer. The threads
+     * update the shared argument without synchronization, the sum of the saved
+     * gradients is updated with the thread local changes after every pass over the terms.
+     * \param[in]     function           Objective function with the argument set to workValue
+     * \param[in]     proximalProjection Proximal projection of the objective function
+     * \param[in,out] workValue          Argument updated in place
+     * \param[in,out] savedGradients     Table of the saved gradients of size n x sizeArgument
+     * \param[in,out] summGrads          Sum of the saved gradients
+     * \param[in]     sizeArgument       Size of the argument
+     * \param[in]     n                  Number of terms of the objective function
+     * \param[in]     maxIterations      Maximal number of iterations
+     * \param[in]     tolerance          Accuracy of the algorithm
+     * \param[in]     learningRateArray  Learning rate sequence, the constant step is used if it is null
+     * \param[in]     learningRateLength Length of the learning rate sequence
+     * \param[in]     step               Constant step
+     * \param[in]     engine             Engine for the generation of the indices of the terms
+     * \param[out]    nIterationsDone    Number of performed iterations
+     * \return Status of the computations
+     */
+    services::Status computeAsynchronous(const sum_of_functions::BatchPtr & function, const sum_of_functions::BatchPtr & proximalProjection,
+                                         algorithmFPType * workValue, algorithmFPType * savedGradients, algorithmFPType * summGrads,
+                                         size_t sizeArgument, size_t n, size_t maxIterations, algorithmFPType tolerance,
+                                         const algorithmFPType * learningRateArray, size_t learningRateLength, algorithmFPType step,
+                                         engines::BatchBase & engine, size_t & nIterationsDone);
+};
+
+/**
+ * Thread local data of the asynchronous iterations
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AsyncTask
+{
+public:
+    DAAL_NEW_DELETE();
+
+    static AsyncTask<algorithmFPType, cpu> * create(const sum_of_functions::BatchPtr & function,
+                                                    const sum_of_functions::BatchPtr & proximalProjection, size_t sizeArgument,
+                                                    size_t maxIndices);
+
+    sum_of_functions::BatchPtr function;                             /*!< Copy of the objective function which computes the gradients */
+    sum_of_functions::BatchPtr proximalProjection;                   /*!< Copy of the proximal projection with the local argument */
+    services::internal::TArray<algorithmFPType, cpu> previous;       /*!< Argument read by the thread before the update */
+    services::internal::TArray<algorithmFPType, cpu> argument;       /*!< Argument of the proximal projection */
+    services::internal::TArray<algorithmFPType, cpu> summGradsDelta; /*!< Changes of the sum of the saved gradients made by the thread */
+    services::internal::TArray<int, cpu> indices;                    /*!< Indices of the terms sampled by the thread */
+    size_t nIterations;                                              /*!< Number of iterations performed by the thread */
+    int batchIndex;                                                  /*!< Index of the current term */
+
+protected:
+    AsyncTask() : nIterations(0), batchIndex(0) {}
 };
 
 } // namespace internal
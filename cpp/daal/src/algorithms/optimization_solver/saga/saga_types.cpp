@@ -46,7 +46,8 @@ Parameter::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterat
       batchIndices(batchIndices),
       learningRateSequence(learningRateSequence),
       seed(seed),
-      engine(engines::mt19937::Batch<>::create())
+      engine(engines::mt19937::Batch<>::create()),
+      asynchronous(false)
 {}
 
 services::Status Parameter::check() const
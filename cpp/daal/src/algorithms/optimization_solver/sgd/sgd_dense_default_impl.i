@@ -31,6 +31,7 @@
 #include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
 #include "src/threading/threading.h"
 #include "src/services/service_data_utils.h"
+#include "services/daal_atomic_int.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -134,60 +135,81 @@ services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::compute(HostAppI
         startIteration                      = lastIterationInputArray[0];
     }
 
-    services::internal::HostAppHelper host(pHost, 10);
-    for (epoch = startIteration; s.ok() && (epoch < (startIteration + nIter)); epoch++)
+    HomogenNumericTable<algorithmFPType> * hmgMinimum = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(minimum);
+    if (parameter->asynchronous && predefinedBatchIndices && hmgMinimum)
     {
-        const int * pValues = nullptr;
-        s                   = rngTask.get(pValues);
-        if (s)
-        {
-            ntBatchIndices->setArray(const_cast<int *>(pValues), ntBatchIndices->getNumberOfRows());
-            s = function->computeNoThrow();
-        }
-        if (!s || host.isCancelled(s, 1))
+        /* The threads update the memory of the minimum in place, so it is accessed directly */
+        bool converged = false;
+        s = computeAsynchronous(function, hmgMinimum->getArray(), nRows, predefinedBatchIndices, nIter, startIteration, learningRateArray,
+                                learningRateLength, accuracyThreshold, nProceededIters, converged);
+        if (!s)
         {
             nProceededIterations[0] = nProceededIters;
             return s;
         }
-
-        NumericTable * gradient = function->getResult()->get(objective_function::gradientIdx).get();
-        if (nIter != 1)
+        if (converged)
         {
-            algorithmFPType pointNorm, gradientNorm;
-            s = vectorNorm(minimum, pointNorm);
-            s |= vectorNorm(gradient, gradientNorm);
-            DAAL_CHECK_BREAK(!s);
-
-            const algorithmFPType one(1.0);
-            const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, pointNorm);
-            if (gradientNorm < gradientThreshold)
+            DAAL_ASSERT(nProceededIters <= services::internal::MaxVal<int>::get())
+            nProceededIterations[0] = (int)nProceededIters;
+        }
+    }
+    else
+    {
+        services::internal::HostAppHelper host(pHost, 10);
+        for (epoch = startIteration; s.ok() && (epoch < (startIteration + nIter)); epoch++)
+        {
+            const int * pValues = nullptr;
+            s                   = rngTask.get(pValues);
+            if (s)
             {
-                DAAL_ASSERT(nProceededIters <= services::internal::MaxVal<int>::get())
-                nProceededIterations[0] = (int)nProceededIters;
-                break;
+                ntBatchIndices->setArray(const_cast<int *>(pValues), ntBatchIndices->getNumberOfRows());
+                s = function->computeNoThrow();
+            }
+            if (!s || host.isCancelled(s, 1))
+            {
+                nProceededIterations[0] = nProceededIters;
+                return s;
             }
-        }
 
-        const algorithmFPType learningRate = learningRateArray[epoch % learningRateLength];
-
-        processByBlocks<cpu>(
-            nRows,
-            [=, &safeStat](size_t startOffset, size_t nRowsInBlock) {
-                WriteRows<algorithmFPType, cpu, NumericTable> workValueBD(*minimum, startOffset, nRowsInBlock);
-                DAAL_CHECK_BLOCK_STATUS_THR(workValueBD);
-                algorithmFPType * workLocal = workValueBD.get();
-                ReadRows<algorithmFPType, cpu, NumericTable> ntGradientBD(*gradient, startOffset, nRowsInBlock);
-                DAAL_CHECK_BLOCK_STATUS_THR(ntGradientBD);
-                const algorithmFPType * gradientLocal = ntGradientBD.get();
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < nRowsInBlock; j++)
+            NumericTable * gradient = function->getResult()->get(objective_function::gradientIdx).get();
+            if (nIter != 1)
+            {
+                algorithmFPType pointNorm, gradientNorm;
+                s = vectorNorm(minimum, pointNorm);
+                s |= vectorNorm(gradient, gradientNorm);
+                DAAL_CHECK_BREAK(!s);
+
+                const algorithmFPType one(1.0);
+                const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, pointNorm);
+                if (gradientNorm < gradientThreshold)
                 {
-                    workLocal[j] = workLocal[j] - learningRate * gradientLocal[j];
+                    DAAL_ASSERT(nProceededIters <= services::internal::MaxVal<int>::get())
+                    nProceededIterations[0] = (int)nProceededIters;
+                    break;
                 }
-            },
-            256);
-        if (!safeStat) s |= safeStat.detach();
-        nProceededIters++;
+            }
+
+            const algorithmFPType learningRate = learningRateArray[epoch % learningRateLength];
+
+            processByBlocks<cpu>(
+                nRows,
+                [=, &safeStat](size_t startOffset, size_t nRowsInBlock) {
+                    WriteRows<algorithmFPType, cpu, NumericTable> workValueBD(*minimum, startOffset, nRowsInBlock);
+                    DAAL_CHECK_BLOCK_STATUS_THR(workValueBD);
+                    algorithmFPType * workLocal = workValueBD.get();
+                    ReadRows<algorithmFPType, cpu, NumericTable> ntGradientBD(*gradient, startOffset, nRowsInBlock);
+                    DAAL_CHECK_BLOCK_STATUS_THR(ntGradientBD);
+                    const algorithmFPType * gradientLocal = ntGradientBD.get();
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nRowsInBlock; j++)
+                    {
+                        workLocal[j] = workLocal[j] - learningRate * gradientLocal[j];
+                    }
+                },
+                256);
+            if (!safeStat) s |= safeStat.detach();
+            nProceededIters++;
+        }
     }
     if (lastIterationResult)
     {
@@ -198,6 +220,85 @@ services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::compute(HostAppI
     return s;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::computeAsynchronous(const sum_of_functions::BatchPtr & function,
+                                                                                    algorithmFPType * workValue, size_t nRows,
+                                                                                    const int * batchIndices, size_t nIter, size_t startIteration,
+                                                                                    const algorithmFPType * learningRateArray,
+                                                                                    size_t learningRateLength, double accuracyThreshold,
+                                                                                    size_t & nProceededIters, bool & converged)
+{
+    const size_t nMaxThreads  = daal::threader_get_max_threads_number();
+    const size_t nThreads     = (nMaxThreads < nIter) ? nMaxThreads : nIter;
+    const size_t nItersInPart = nIter / nThreads + !!(nIter % nThreads);
+
+    TArray<size_t, cpu> nProceededItersArray(nThreads);
+    size_t * nProceededItersPerThread = nProceededItersArray.get();
+    DAAL_CHECK_MALLOC(nProceededItersPerThread);
+    daal::services::internal::service_memset<size_t, cpu>(nProceededItersPerThread, 0, nThreads);
+
+    daal::services::Atomic<int> isConverged(0);
+    SafeStatus safeStat;
+    daal::threader_for(nThreads, nThreads, [&](size_t iThread) {
+        const size_t first = iThread * nItersInPart;
+        const size_t last  = (first + nItersInPart < nIter) ? first + nItersInPart : nIter;
+        if (first >= last) return;
+
+        sum_of_functions::BatchPtr localFunction = function->clone();
+        DAAL_CHECK_THR(localFunction, ErrorMemoryAllocationFailed);
+
+        Status st;
+        int batchIndex = 0;
+        localFunction->sumOfFunctionsParameter->batchIndices = HomogenNumericTableCPU<int, cpu>::create(&batchIndex, 1, 1, &st);
+        DAAL_CHECK_STATUS_THR(st);
+
+        for (size_t iter = first; iter < last && !isConverged.get(); iter++)
+        {
+            batchIndex = batchIndices[iter];
+            st         = localFunction->computeNoThrow();
+            DAAL_CHECK_STATUS_THR(st);
+
+            NumericTable * gradientTable = localFunction->getResult()->get(objective_function::gradientIdx).get();
+            ReadRows<algorithmFPType, cpu, NumericTable> gradientBD(*gradientTable, 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(gradientBD);
+            const algorithmFPType * gradient = gradientBD.get();
+
+            if (nIter != 1)
+            {
+                algorithmFPType pointNorm, gradientNorm;
+                st = vectorNorm(workValue, nRows, pointNorm);
+                st |= vectorNorm(gradient, nRows, gradientNorm);
+                DAAL_CHECK_STATUS_THR(st);
+
+                const algorithmFPType one(1.0);
+                const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, pointNorm);
+                if (gradientNorm < gradientThreshold)
+                {
+                    isConverged.set(1);
+                    break;
+                }
+            }
+
+            /* Only the non-zero components of the gradient are written, so the threads rarely touch the same memory
+               when the gradients are sparse */
+            const algorithmFPType learningRate = learningRateArray[(startIteration + iter) % learningRateLength];
+            for (size_t j = 0; j < nRows; j++)
+            {
+                if (gradient[j] != 0) workValue[j] -= learningRate * gradient[j];
+            }
+            nProceededItersPerThread[iThread]++;
+        }
+    });
+
+    nProceededIters = 0;
+    for (size_t i = 0; i < nThreads; i++)
+    {
+        nProceededIters += nProceededItersPerThread[i];
+    }
+    converged = isConverged.get();
+    return safeStat.detach();
+}
+
 } // namespace internal
 
 } // namespace sgd
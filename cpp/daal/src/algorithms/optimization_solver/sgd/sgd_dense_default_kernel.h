@@ -50,6 +50,28 @@ public:
 
     using iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm;
     using iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>::getRandom;
+
+protected:
+    /**
+     * Runs the lock-free (Hogwild) iterations: the threads process their own
+     * parts of the sequence of the batch indices with their own copies of the
+     * objective function and update the shared argument without synchronization
+     * \param[in]  function           Objective function with the argument set to the minimum
+     * \param[out] workValue          Array with the argument updated in place
+     * \param[in]  nRows              Size of the argument
+     * \param[in]  batchIndices       Sequence of nIter batch indices
+     * \param[in]  nIter              Number of iterations
+     * \param[in]  startIteration     Index of the first iteration in the learning rate sequence
+     * \param[in]  learningRateArray  Learning rate sequence
+     * \param[in]  learningRateLength Length of the learning rate sequence
+     * \param[in]  accuracyThreshold  Accuracy of the algorithm
+     * \param[out] nProceededIters    Number of the performed iterations
+     * \param[out] converged          Flag. True if the accuracy has been reached
+     * \return Status of the computations
+     */
+    services::Status computeAsynchronous(const sum_of_functions::BatchPtr & function, algorithmFPType * workValue, size_t nRows,
+                                         const int * batchIndices, size_t nIter, size_t startIteration, const algorithmFPType * learningRateArray,
+                                         size_t learningRateLength, double accuracyThreshold, size_t & nProceededIters, bool & converged);
 };
 
 } // namespace internal
@@ -72,7 +72,8 @@ Parameter<defaultDense>::Parameter(const sum_of_functions::BatchPtr & function,
                                    NumericTablePtr batchIndices, NumericTablePtr learningRateSequence, size_t seed)
     : BaseParameter(function, nIterations, accuracyThreshold, batchIndices, learningRateSequence,
                     1, // batchSize
-                    seed)
+                    seed),
+      asynchronous(false)
 {}
 /**
  * Checks the correctness of the parameter
@@ -0,0 +1,69 @@
+/* file: outlierdetection_bacon_cl_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the kernels of the BACON outlier detection.
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_BACON_CL_KERNELS_CL__
+#define __OUTLIERDETECTION_BACON_CL_KERNELS_CL__
+
+#include <string.h>
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    clKernelOutlierDetectionBacon,
+
+    /* The centered rows of the block multiplied by their weights, the rows out of the basic subset are zeros */
+    __kernel void centerMasked(const __global algorithmFPType * data, const __global algorithmFPType * mean,
+                               const __global algorithmFPType * weights, uint nFeatures, uint offset, __global algorithmFPType * centered) {
+        const uint i = get_global_id(0);
+        const uint j = get_global_id(1);
+
+        const algorithmFPType w     = weights[offset + i];
+        const algorithmFPType value = data[(offset + i) * nFeatures + j] - mean[j];
+        centered[i * nFeatures + j] = (w != (algorithmFPType)0) ? w * value : (algorithmFPType)0;
+    }
+
+    /* counts[j] += the number of the values of the column j of the row-major matrix not greater than bounds[j], the work
+       groups of the dimension 1 go over the columns */
+    __kernel void countLessEqual(const __global algorithmFPType * data, uint nRows, uint nColumns, const __global algorithmFPType * bounds,
+                                 __global int * counts) {
+        const uint j          = get_global_id(1);
+        const uint global_id  = get_global_id(0);
+        const uint range_size = get_global_size(0);
+
+        const algorithmFPType bound = bounds[j];
+        int count                   = 0;
+        for (uint i = global_id; i < nRows; i += range_size)
+        {
+            count += (data[i * nColumns + j] <= bound) ? 1 : 0;
+        }
+
+        count = sub_group_reduce_add(count);
+        if (get_sub_group_local_id() == 0)
+        {
+            atomic_add(&counts[j], count);
+        }
+    }
+
+);
+
+#endif
@@ -0,0 +1,502 @@
+/* file: outlierdetection_bacon_dense_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of BACON outlier detection on GPU
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_BACON_DENSE_ONEAPI_IMPL_I__
+#define __OUTLIERDETECTION_BACON_DENSE_ONEAPI_IMPL_I__
+
+#include "src/algorithms/outlierdetection_bacon/oneapi/outlierdetection_bacon_kernel_oneapi.h"
+#include "src/algorithms/outlierdetection_bacon/oneapi/cl_kernels/outlierdetection_bacon_cl_kernels.cl"
+#include "src/algorithms/outlierdetection_multivariate/oneapi/outlierdetection_multivariate_distance_oneapi_impl.i"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_ittnotify.h"
+#include "src/externals/service_math.h"
+#include "src/services/service_arrays.h"
+#include "src/sycl/blas_gpu.h"
+#include "src/sycl/reducer.h"
+
+DAAL_ITTNOTIFY_DOMAIN(outlier_detection.bacon.batch.oneapi);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::data_management;
+using namespace daal::services::internal::sycl;
+using daal::services::internal::TArray;
+
+const uint32_t subsetFactor         = 4; /* The initial basic subset has subsetFactor * p rows */
+const size_t maxIterations          = 100;
+const uint32_t maxWorkItemsPerGroup = 256;
+const uint32_t maxGroupsPerColumn   = 64; /* Number of the work groups counting the values of one column */
+
+/* The keys of the floating-point values in the same order as the values, the adjacent keys are the adjacent values */
+template <typename algorithmFPType>
+struct OrderKey;
+
+template <>
+struct OrderKey<float>
+{
+    static uint64_t get(const float value)
+    {
+        union
+        {
+            float f;
+            uint32_t u;
+        } bits;
+        bits.f              = value;
+        const uint32_t sign = 0x80000000u;
+        return (bits.u & sign) ? ~bits.u : (bits.u | sign);
+    }
+
+    static float value(const uint64_t key)
+    {
+        union
+        {
+            float f;
+            uint32_t u;
+        } bits;
+        const uint32_t k    = static_cast<uint32_t>(key);
+        const uint32_t sign = 0x80000000u;
+        bits.u              = (k & sign) ? (k & ~sign) : ~k;
+        return bits.f;
+    }
+};
+
+template <>
+struct OrderKey<double>
+{
+    static uint64_t get(const double value)
+    {
+        union
+        {
+            double f;
+            uint64_t u;
+        } bits;
+        bits.f              = value;
+        const uint64_t sign = 0x8000000000000000ull;
+        return (bits.u & sign) ? ~bits.u : (bits.u | sign);
+    }
+
+    static double value(const uint64_t key)
+    {
+        union
+        {
+            double f;
+            uint64_t u;
+        } bits;
+        const uint64_t sign = 0x8000000000000000ull;
+        bits.u              = (key & sign) ? (key & ~sign) : ~key;
+        return bits.f;
+    }
+};
+
+template <typename algorithmFPType, Method method>
+services::Status OutlierDetectionKernelOneAPI<algorithmFPType, method>::buildProgram(ClKernelFactoryIface & factory)
+{
+    services::Status status;
+    const services::String options = getKeyFPType<algorithmFPType>();
+    services::String cachekey("__daal_algorithms_outlier_detection_bacon_");
+    cachekey.add(options);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), clKernelOutlierDetectionBacon, options.c_str(), &status);
+    return status;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status OutlierDetectionKernelOneAPI<algorithmFPType, method>::compute(NumericTable & dataTable, const NumericTable * initialMeanTable,
+                                                                                const NumericTable * initialCovarianceTable,
+                                                                                NumericTable & resultTable, NumericTable * meanTable,
+                                                                                NumericTable * covarianceTable, const Parameter & par)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    typedef multivariate_outlier_detection::internal::MahalanobisDistanceOneAPI<algorithmFPType> Distance;
+
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    DAAL_CHECK(nVectors > nFeatures, services::ErrorIncorrectNumberOfObservations);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nVectors, nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nFeatures, nFeatures);
+
+    services::Status s;
+    ExecutionContextIface & ctx = services::internal::getDefaultContext();
+
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS(s, dataTable.getBlockOfRows(0, nVectors, ReadWriteMode::readOnly, dataBlock));
+    BlockDescriptor<algorithmFPType> resultBlock;
+    DAAL_CHECK_STATUS(s, resultTable.getBlockOfRows(0, nVectors, ReadWriteMode::writeOnly, resultBlock));
+    const UniversalBuffer data = dataBlock.getBuffer();
+    UniversalBuffer weight     = resultBlock.getBuffer();
+
+    UniversalBuffer distances = ctx.allocate(TypeIds::id<algorithmFPType>(), nVectors, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    TArray<algorithmFPType, sse2> meanArray(nFeatures);
+    TArray<algorithmFPType, sse2> covarianceArray(nFeatures * nFeatures);
+    TArray<algorithmFPType, sse2> whiteningArray(nFeatures * nFeatures);
+    DAAL_CHECK_MALLOC(meanArray.get() && covarianceArray.get() && whiteningArray.get());
+    algorithmFPType * mean       = meanArray.get();
+    algorithmFPType * covariance = covarianceArray.get();
+    algorithmFPType * whitening  = whiteningArray.get();
+
+    /* The (1 - alpha) quantile of the chi-square distribution with p degrees of freedom by the Wilson-Hilferty approximation */
+    const algorithmFPType p    = (algorithmFPType)nFeatures;
+    const algorithmFPType n    = (algorithmFPType)nVectors;
+    const algorithmFPType z    = Math<algorithmFPType, sse2>::sCdfNormInv((algorithmFPType)(1.0 - par.alpha));
+    const algorithmFPType a    = (algorithmFPType)2.0 / ((algorithmFPType)9.0 * p);
+    const algorithmFPType base = (algorithmFPType)1.0 - a + z * Math<algorithmFPType, sse2>::sSqrt(a);
+    const algorithmFPType chi2 = p * base * base * base;
+
+    /* The correction factor c_np = 1 + (p + 1) / (n - p) + 1 / (n - h - p) of the threshold of Billor, Hadi and Velleman */
+    const size_t h            = (nVectors + nFeatures + 1) / 2;
+    const algorithmFPType cHp = (nVectors > h + nFeatures) ? (algorithmFPType)1.0 / (algorithmFPType)(nVectors - h - nFeatures) : 0;
+    const algorithmFPType cnp = (algorithmFPType)1.0 + (p + (algorithmFPType)1.0) / (n - p) + cHp;
+
+    /* Squared threshold of the distances for the basic subset of r rows */
+    auto squaredThreshold = [=](size_t r) -> algorithmFPType {
+        const algorithmFPType chr = (h > r) ? (algorithmFPType)(h - r) / (algorithmFPType)(h + r) : 0;
+        return (cnp + chr) * (cnp + chr) * chi2;
+    };
+    auto selectByThreshold = [&](algorithmFPType threshold, size_t & nSelected) -> services::Status {
+        services::Status status = Distance::selectWeights(distances, nVectors, threshold, true, weight);
+        DAAL_CHECK_STATUS_VAR(status);
+        return countSubset(weight, nVectors, nSelected);
+    };
+
+    size_t nSubset = 0;
+    if (initialMeanTable && initialCovarianceTable)
+    {
+        /* The basic subset of the previous window selects the rows of this one */
+        ReadRows<algorithmFPType, sse2> initialMeanBlock(*const_cast<NumericTable *>(initialMeanTable), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(initialMeanBlock)
+        ReadRows<algorithmFPType, sse2> initialCovarianceBlock(*const_cast<NumericTable *>(initialCovarianceTable), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(initialCovarianceBlock)
+
+        if (Distance::computeWhitening(initialCovarianceBlock.get(), nFeatures, whitening))
+        {
+            DAAL_CHECK_STATUS(s, Distance::computeDistances(data, nVectors, nFeatures, initialMeanBlock.get(), whitening, distances));
+            DAAL_CHECK_STATUS(s, selectByThreshold(squaredThreshold(h), nSubset));
+        }
+    }
+
+    /* The initialization is used if the rows of the previous basic subset are too few */
+    size_t nInitial = (subsetFactor * nFeatures < nVectors) ? subsetFactor * nFeatures : nVectors;
+    if (nSubset <= nFeatures)
+    {
+        if (par.initMethod == baconMahalanobis)
+        {
+            ctx.fill(weight, 1.0, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            DAAL_CHECK_STATUS(s, computeSubsetStatistics(data, nVectors, nFeatures, weight, mean, covariance, nSubset));
+            DAAL_CHECK(Distance::computeWhitening(covariance, nFeatures, whitening), services::ErrorOutlierDetectionInternal);
+            DAAL_CHECK_STATUS(s, Distance::computeDistances(data, nVectors, nFeatures, mean, whitening, distances));
+        }
+        else
+        {
+            DAAL_CHECK_STATUS(s, computeMedian(data, nVectors, nFeatures, mean));
+            DAAL_CHECK_STATUS(s, Distance::computeDistances(data, nVectors, nFeatures, mean, nullptr, distances));
+        }
+        DAAL_CHECK_STATUS(s, selectSmallest(distances, nVectors, nInitial, weight));
+    }
+
+    for (size_t iter = 0; iter < maxIterations; iter++)
+    {
+        DAAL_CHECK_STATUS(s, computeSubsetStatistics(data, nVectors, nFeatures, weight, mean, covariance, nSubset));
+        if (!Distance::computeWhitening(covariance, nFeatures, whitening))
+        {
+            /* The basic subset is extended by the rows with the smallest distances while its covariance is singular */
+            DAAL_CHECK(nSubset < nVectors, services::ErrorOutlierDetectionInternal);
+            nInitial = (2 * nSubset > nFeatures + 1) ? 2 * nSubset : nFeatures + 1;
+            nInitial = (nInitial < nVectors) ? nInitial : nVectors;
+            DAAL_CHECK_STATUS(s, selectSmallest(distances, nVectors, nInitial, weight));
+            continue;
+        }
+
+        DAAL_CHECK_STATUS(s, Distance::computeDistances(data, nVectors, nFeatures, mean, whitening, distances));
+        size_t nSelected = 0;
+        DAAL_CHECK_STATUS(s, selectByThreshold(squaredThreshold(nSubset), nSelected));
+        const size_t change = (nSelected > nSubset) ? nSelected - nSubset : nSubset - nSelected;
+        if ((algorithmFPType)change <= (algorithmFPType)par.toleranceToConverge * (algorithmFPType)nSubset) break;
+    }
+
+    DAAL_CHECK_STATUS(s, resultTable.releaseBlockOfRows(resultBlock));
+    DAAL_CHECK_STATUS(s, dataTable.releaseBlockOfRows(dataBlock));
+
+    if (meanTable && covarianceTable)
+    {
+        WriteOnlyRows<algorithmFPType, sse2> meanBlock(*meanTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(meanBlock)
+        WriteOnlyRows<algorithmFPType, sse2> covarianceBlock(*covarianceTable, 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(covarianceBlock)
+        algorithmFPType * meanOut       = meanBlock.get();
+        algorithmFPType * covarianceOut = covarianceBlock.get();
+        for (size_t j = 0; j < nFeatures; j++) meanOut[j] = mean[j];
+        for (size_t j = 0; j < nFeatures * nFeatures; j++) covarianceOut[j] = covariance[j];
+    }
+    return s;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status OutlierDetectionKernelOneAPI<algorithmFPType, method>::countSubset(const UniversalBuffer & weights, uint32_t nVectors,
+                                                                                    size_t & nSubset)
+{
+    services::Status status;
+    math::SumReducer::Result result = math::SumReducer::sum(math::Layout::RowMajor, weights, 1, nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    auto sumHost = result.sum.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    nSubset = (size_t)sumHost.get()[0];
+    return status;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status OutlierDetectionKernelOneAPI<algorithmFPType, method>::computeSubsetStatistics(const UniversalBuffer & data, uint32_t nVectors,
+                                                                                                uint32_t nFeatures, const UniversalBuffer & weights,
+                                                                                                algorithmFPType * mean, algorithmFPType * covariance,
+                                                                                                size_t & nSubset)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.subsetStatistics);
+    services::Status status;
+
+    ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    DAAL_CHECK_STATUS(status, buildProgram(factory));
+    DAAL_CHECK_STATUS(status, countSubset(weights, nVectors, nSubset));
+
+    /* The sums of the rows of the subset are the product of the weights and the data */
+    UniversalBuffer sums = ctx.allocate(TypeIds::id<algorithmFPType>(), nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::NoTrans, 1,
+                                                             nFeatures, nVectors, algorithmFPType(1), weights, nVectors, 0, data, nFeatures, 0,
+                                                             algorithmFPType(0), sums, nFeatures, 0));
+
+    const algorithmFPType invN  = nSubset ? (algorithmFPType)1.0 / (algorithmFPType)nSubset : 0;
+    const algorithmFPType invN1 = (nSubset > 1) ? (algorithmFPType)1.0 / (algorithmFPType)(nSubset - 1) : 0;
+    {
+        auto sumsHost = sums.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            mean[j] = sumsHost.get()[j] * invN;
+        }
+    }
+    UniversalBuffer meanBuffer = ctx.allocate(TypeIds::id<algorithmFPType>(), nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ctx.copy(meanBuffer, 0, (void *)mean, 0, nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    /* The cross-products of the centered rows of the subset are accumulated by SYRK of the masked blocks */
+    UniversalBuffer crossProduct = ctx.allocate(TypeIds::id<algorithmFPType>(), nFeatures * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ctx.fill(crossProduct, 0.0, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    typedef multivariate_outlier_detection::internal::MahalanobisDistanceOneAPI<algorithmFPType> Distance;
+    const uint32_t maxRowsInBlock = (Distance::maxBlockSize / nFeatures > 0) ? Distance::maxBlockSize / nFeatures : 1;
+    const uint32_t rowsInBlock    = (nVectors < maxRowsInBlock) ? nVectors : maxRowsInBlock;
+    UniversalBuffer centered      = ctx.allocate(TypeIds::id<algorithmFPType>(), rowsInBlock * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelPtr kernel = factory.getKernel("centerMasked", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    for (uint32_t start = 0; start < nVectors; start += rowsInBlock)
+    {
+        const uint32_t nRows = (start + rowsInBlock > nVectors) ? nVectors - start : rowsInBlock;
+
+        KernelArguments args(6);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, meanBuffer, AccessModeIds::read);
+        args.set(2, weights, AccessModeIds::read);
+        args.set(3, nFeatures);
+        args.set(4, start);
+        args.set(5, centered, AccessModeIds::write);
+
+        KernelRange range(nRows, nFeatures);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xsyrk(math::Layout::RowMajor, math::UpLo::Upper, math::Transpose::Trans, nFeatures,
+                                                                 nRows, algorithmFPType(1), centered, nFeatures, 0, algorithmFPType(1),
+                                                                 crossProduct, nFeatures, 0));
+    }
+
+    /* SYRK fills the upper triangle of the row-major matrix */
+    auto crossProductHost = crossProduct.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    const algorithmFPType * cp = crossProductHost.get();
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        for (size_t j = i; j < nFeatures; j++)
+        {
+            covariance[i * nFeatures + j] = cp[i * nFeatures + j] * invN1;
+            covariance[j * nFeatures + i] = covariance[i * nFeatures + j];
+        }
+    }
+    return status;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status OutlierDetectionKernelOneAPI<algorithmFPType, method>::computeOrderStatistics(const UniversalBuffer & data, uint32_t nRows,
+                                                                                               uint32_t nColumns, uint32_t k,
+                                                                                               algorithmFPType * values)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.orderStatistics);
+    services::Status status;
+
+    ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    DAAL_CHECK_STATUS(status, buildProgram(factory));
+
+    KernelPtr kernel = factory.getKernel("countLessEqual", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    TArray<uint64_t, sse2> lowArray(nColumns);
+    TArray<uint64_t, sse2> highArray(nColumns);
+    TArray<algorithmFPType, sse2> boundsArray(nColumns);
+    DAAL_CHECK_MALLOC(lowArray.get() && highArray.get() && boundsArray.get());
+    uint64_t * low           = lowArray.get();
+    uint64_t * high          = highArray.get();
+    algorithmFPType * bounds = boundsArray.get();
+
+    /* The value of the rank k is in (low, high]: less than k + 1 values are not greater than low, at least k + 1 are not
+       greater than high */
+    {
+        math::StatisticsReducer::Result range = math::StatisticsReducer::reduce(math::Layout::ColMajor, data, nColumns, nRows, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        auto minHost = range.min.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        auto maxHost = range.max.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            low[j]  = OrderKey<algorithmFPType>::get(minHost.get()[j]) - 1;
+            high[j] = OrderKey<algorithmFPType>::get(maxHost.get()[j]);
+        }
+    }
+
+    UniversalBuffer boundsBuffer = ctx.allocate(TypeIds::id<algorithmFPType>(), nColumns, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer counts = ctx.allocate(TypeIds::id<int>(), nColumns, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    const uint32_t nGroups = (nRows / maxWorkItemsPerGroup < maxGroupsPerColumn) ? nRows / maxWorkItemsPerGroup + 1 : maxGroupsPerColumn;
+    KernelRange localRange(maxWorkItemsPerGroup, 1);
+    KernelRange globalRange(maxWorkItemsPerGroup * nGroups, nColumns);
+    KernelNDRange range(2);
+    range.global(globalRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    range.local(localRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    /* Every step halves the number of the keys in (low, high], so it is done in the number of the bits of the keys */
+    for (;;)
+    {
+        bool isDone = true;
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            const bool isColumnDone = (high[j] - low[j] <= 1);
+            bounds[j]               = OrderKey<algorithmFPType>::value(isColumnDone ? high[j] : low[j] + (high[j] - low[j]) / 2);
+            isDone                  = isDone && isColumnDone;
+        }
+        if (isDone) break;
+
+        ctx.copy(boundsBuffer, 0, (void *)bounds, 0, nColumns, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        ctx.fill(counts, 0.0, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        KernelArguments args(5);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, nRows);
+        args.set(2, nColumns);
+        args.set(3, boundsBuffer, AccessModeIds::read);
+        args.set(4, counts, AccessModeIds::readwrite);
+
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        auto countsHost = counts.template get<int>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            if (high[j] - low[j] <= 1) continue;
+            const uint64_t middle = low[j] + (high[j] - low[j]) / 2;
+            if ((uint32_t)countsHost.get()[j] > k)
+            {
+                high[j] = middle;
+            }
+            else
+            {
+                low[j] = middle;
+            }
+        }
+    }
+
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        values[j] = OrderKey<algorithmFPType>::value(high[j]);
+    }
+    return status;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status OutlierDetectionKernelOneAPI<algorithmFPType, method>::computeMedian(const UniversalBuffer & data, uint32_t nVectors,
+                                                                                      uint32_t nFeatures, algorithmFPType * median)
+{
+    services::Status status;
+    const uint32_t k = nVectors / 2;
+    DAAL_CHECK_STATUS(status, computeOrderStatistics(data, nVectors, nFeatures, k, median));
+    if (nVectors % 2) return status;
+
+    TArray<algorithmFPType, sse2> lowArray(nFeatures);
+    DAAL_CHECK_MALLOC(lowArray.get());
+    DAAL_CHECK_STATUS(status, computeOrderStatistics(data, nVectors, nFeatures, k - 1, lowArray.get()));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        median[j] = (lowArray.get()[j] + median[j]) * (algorithmFPType)0.5;
+    }
+    return status;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status OutlierDetectionKernelOneAPI<algorithmFPType, method>::selectSmallest(const UniversalBuffer & distances, uint32_t nVectors,
+                                                                                       uint32_t nSubset, UniversalBuffer & weights)
+{
+    services::Status status;
+    algorithmFPType threshold = 0;
+    DAAL_CHECK_STATUS(status, computeOrderStatistics(distances, nVectors, 1, nSubset - 1, &threshold));
+    return multivariate_outlier_detection::internal::MahalanobisDistanceOneAPI<algorithmFPType>::selectWeights(distances, nVectors, threshold, false,
+                                                                                                              weights);
+}
+
+} // namespace internal
+} // namespace bacon_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
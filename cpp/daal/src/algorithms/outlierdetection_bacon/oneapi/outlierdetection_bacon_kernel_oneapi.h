@@ -0,0 +1,87 @@
+/* file: outlierdetection_bacon_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs for BACON outlier detection on GPU
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_BACON_KERNEL_ONEAPI_H__
+#define __OUTLIERDETECTION_BACON_KERNEL_ONEAPI_H__
+
+#include "algorithms/outlier_detection/outlier_detection_bacon.h"
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "services/internal/sycl/types.h"
+#include "services/internal/sycl/execution_context.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace internal
+{
+/**
+ *  The data, the distances and the weights of the rows stay on the device. The sums of the basic subset are the product
+ *  of its weights and the data by GEMM, its cross-products are accumulated by SYRK of the centered rows masked by the
+ *  weights, so only the p x p covariance is read to the host for its Cholesky factorization. The distances are computed
+ *  by MahalanobisDistanceOneAPI. The order statistics of the distances and the coordinate-wise medians are found by the
+ *  bisection over the order of the floating-point values, every step of which counts the values not greater than the
+ *  middle on the device.
+ */
+template <typename algorithmFPType, Method method>
+class OutlierDetectionKernelOneAPI : public Kernel
+{
+public:
+    services::Status compute(data_management::NumericTable & data, const data_management::NumericTable * initialMean,
+                             const data_management::NumericTable * initialCovariance, data_management::NumericTable & weights,
+                             data_management::NumericTable * mean, data_management::NumericTable * covariance, const Parameter & par);
+
+protected:
+    /* Mean and covariance of the rows with the weight 1, nSubset is the number of such rows */
+    services::Status computeSubsetStatistics(const services::internal::sycl::UniversalBuffer & data, uint32_t nVectors, uint32_t nFeatures,
+                                             const services::internal::sycl::UniversalBuffer & weights, algorithmFPType * mean,
+                                             algorithmFPType * covariance, size_t & nSubset);
+
+    /* Number of the rows with the weight 1 */
+    services::Status countSubset(const services::internal::sycl::UniversalBuffer & weights, uint32_t nVectors, size_t & nSubset);
+
+    /* values[j] = the value of the rank k (starting from 0) in the ascending order of the column j of the row-major matrix */
+    services::Status computeOrderStatistics(const services::internal::sycl::UniversalBuffer & data, uint32_t nRows, uint32_t nColumns,
+                                            uint32_t k, algorithmFPType * values);
+
+    /* Coordinate-wise median of the rows */
+    services::Status computeMedian(const services::internal::sycl::UniversalBuffer & data, uint32_t nVectors, uint32_t nFeatures,
+                                   algorithmFPType * median);
+
+    /* Sets the weights of the nSubset rows with the smallest distances to 1 and of the other rows to 0 */
+    services::Status selectSmallest(const services::internal::sycl::UniversalBuffer & distances, uint32_t nVectors, uint32_t nSubset,
+                                    services::internal::sycl::UniversalBuffer & weights);
+
+private:
+    services::Status buildProgram(services::internal::sycl::ClKernelFactoryIface & factory);
+};
+
+} // namespace internal
+} // namespace bacon_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -38,8 +38,8 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_OUTLIER_DETECTION_BACON_RESULT_ID);
 
-Parameter::Parameter(InitializationMethod initMethod, double alpha, double toleranceToConverge)
-    : initMethod(initMethod), alpha(alpha), toleranceToConverge(toleranceToConverge)
+Parameter::Parameter(InitializationMethod initMethod, double alpha, double toleranceToConverge, bool optionalResultRequired)
+    : initMethod(initMethod), alpha(alpha), toleranceToConverge(toleranceToConverge), optionalResultRequired(optionalResultRequired)
 {}
 
 services::Status Parameter::check() const
@@ -55,7 +55,7 @@ services::Status Parameter::check() const
     return services::Status();
 }
 
-Input::Input() : daal::algorithms::Input(1) {}
+Input::Input() : daal::algorithms::Input(lastOptionalInputId + 1) {}
 Input::Input(const Input & other) : daal::algorithms::Input(other) {}
 
 /**
@@ -78,6 +78,26 @@ void Input::set(InputId id, const NumericTablePtr & ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns optional input object for the multivariate outlier detection algorithm
+ * \param[in] id    Identifier of the optional %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(OptionalInputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets optional input object for the multivariate outlier detection algorithm
+ * \param[in] id    Identifier of the optional %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(OptionalInputId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Checks input object for the multivariate outlier detection algorithm
  * \param[in] par     Algorithm parameters
@@ -85,10 +105,20 @@ void Input::set(InputId id, const NumericTablePtr & ptr)
       */
 services::Status Input::check(const daal::algorithms::Parameter * par, int method) const
 {
-    return checkNumericTable(get(data).get(), dataStr());
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr()));
+
+    NumericTable * meanTable       = get(initialBasicSubsetMean).get();
+    NumericTable * covarianceTable = get(initialBasicSubsetCovariance).get();
+    if (!meanTable && !covarianceTable) return s;
+
+    /* The statistics of the basic subset are given together */
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+    DAAL_CHECK_STATUS(s, checkNumericTable(meanTable, initialBasicSubsetMeanStr(), 0, 0, nFeatures, 1));
+    return checkNumericTable(covarianceTable, initialBasicSubsetCovarianceStr(), 0, 0, nFeatures, nFeatures);
 }
 
-Result::Result() : daal::algorithms::Result(1) {}
+Result::Result() : daal::algorithms::Result(lastOptionalResultId + 1) {}
 
 /**
  * Returns result of the multivariate outlier detection algorithm
@@ -108,6 +138,24 @@ void Result::set(ResultId id, const NumericTablePtr & ptr)
 {
     Argument::set(id, ptr);
 }
+/**
+ * Returns optional result of the multivariate outlier detection algorithm
+ * \param[in] id   Identifier of the optional result
+ * \return         Optional result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(OptionalResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+/**
+ * Sets optional result of the multivariate outlier detection algorithm
+ * \param[in] id    Identifier of the optional result
+ * \param[in] ptr   Pointer to the optional result
+ */
+void Result::set(OptionalResultId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
 /**
  * Checks the result object of the multivariate outlier detection algorithm
  * \param[in] input   Pointer to %Input objects of the algorithm
@@ -119,7 +167,15 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     Input * algInput      = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t nVectors       = algInput->get(data)->getNumberOfRows();
     int unexpectedLayouts = packed_mask;
-    return checkNumericTable(get(weights).get(), weightsStr(), unexpectedLayouts, 0, 1, nVectors);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(weights).get(), weightsStr(), unexpectedLayouts, 0, 1, nVectors));
+
+    const Parameter * algParameter = static_cast<const Parameter *>(par);
+    if (!algParameter || !algParameter->optionalResultRequired) return s;
+
+    const size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(basicSubsetMean).get(), basicSubsetMeanStr(), unexpectedLayouts, 0, nFeatures, 1));
+    return checkNumericTable(get(basicSubsetCovariance).get(), basicSubsetCovarianceStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
 }
 
 } // namespace interface1
@@ -50,6 +50,14 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t nVectors  = algInput->get(data)->getNumberOfRows();
     set(weights, HomogenNumericTable<algorithmFPType>::create(1, nVectors, NumericTable::doAllocate, &s));
+
+    const Parameter * algParameter = static_cast<const Parameter *>(parameter);
+    if (s && algParameter && algParameter->optionalResultRequired)
+    {
+        const size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+        set(basicSubsetMean, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+        set(basicSubsetCovariance, HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &s));
+    }
     return s;
 }
 
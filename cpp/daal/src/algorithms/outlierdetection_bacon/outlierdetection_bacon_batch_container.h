@@ -23,6 +23,8 @@
 
 #include "algorithms/outlier_detection/outlier_detection_bacon.h"
 #include "src/algorithms/outlierdetection_bacon/outlierdetection_bacon_kernel.h"
+#include "src/algorithms/outlierdetection_bacon/oneapi/outlierdetection_bacon_kernel_oneapi.h"
+#include "services/internal/execution_context.h"
 
 namespace daal
 {
@@ -35,7 +37,17 @@ namespace interface1
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionKernel, algorithmFPType, method);
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionKernel, algorithmFPType, method);
+    }
+    else
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::OutlierDetectionKernelOneAPI, algorithmFPType, method);
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -54,8 +66,26 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable & data    = *(static_cast<NumericTable *>(input->get(InputId::data).get()));
     NumericTable & weights = *(static_cast<NumericTable *>(result->get(ResultId::weights).get()));
 
+    const NumericTable * initialMean       = input->get(initialBasicSubsetMean).get();
+    const NumericTable * initialCovariance = input->get(initialBasicSubsetCovariance).get();
+    NumericTable * mean                    = par->optionalResultRequired ? result->get(basicSubsetMean).get() : nullptr;
+    NumericTable * covariance              = par->optionalResultRequired ? result->get(basicSubsetCovariance).get() : nullptr;
+
     daal::services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute, data, weights, *par);
+
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute, data,
+                           initialMean, initialCovariance, weights, mean, covariance, *par);
+    }
+    else
+    {
+        __DAAL_CALL_KERNEL_SYCL(env, internal::OutlierDetectionKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute,
+                                data, initialMean, initialCovariance, weights, mean, covariance, *par);
+    }
 }
 
 } // namespace interface1
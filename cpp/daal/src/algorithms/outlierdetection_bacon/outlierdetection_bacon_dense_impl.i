@@ -28,7 +28,12 @@
 #include "algorithms/outlier_detection/outlier_detection_bacon_types.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_math.h"
-#include "src/externals/service_stat.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_lapack.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/services/service_arrays.h"
+#include "src/threading/threading.h"
 
 namespace daal
 {
@@ -41,33 +46,53 @@ namespace internal
 using namespace daal::internal;
 using namespace daal::data_management;
 using namespace daal::services;
+using daal::services::internal::TArray;
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTable & dataTable, NumericTable & resultTable,
-                                                                               const Parameter & par)
-{
-    const __int64 nBaconParams = 3;
-    algorithmFPType baconParams[nBaconParams];
+const size_t blockSize     = 256; /* Number of rows processed by a thread at once */
+const size_t subsetFactor  = 4;   /* The initial basic subset has subsetFactor * p rows */
+const size_t maxIterations = 100;
 
-    switch (par.initMethod)
-    {
-    case baconMedian:
-    default:
-    {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MEDIAN_INIT;
-        break;
-    }
-    case baconMahalanobis:
+/* Reorders x so that x[k] is the k-th smallest value, the values before it are not greater */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType kthSmallest(algorithmFPType * x, size_t n, size_t k)
+{
+    DAAL_INT64 left  = 0;
+    DAAL_INT64 right = (DAAL_INT64)n - 1;
+    while (left < right)
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MAHALANOBIS_INIT;
-        break;
-    }
+        const algorithmFPType pivot = x[left + (right - left) / 2];
+        DAAL_INT64 i                = left;
+        DAAL_INT64 j                = right;
+        while (i <= j)
+        {
+            while (x[i] < pivot) i++;
+            while (pivot < x[j]) j--;
+            if (i <= j)
+            {
+                const algorithmFPType tmp = x[i];
+                x[i++]                    = x[j];
+                x[j--]                    = tmp;
+            }
+        }
+        if ((DAAL_INT64)k <= j)
+            right = j;
+        else if ((DAAL_INT64)k >= i)
+            left = i;
+        else
+            break;
     }
-    baconParams[1] = (algorithmFPType)(par.alpha);
-    baconParams[2] = (algorithmFPType)(par.toleranceToConverge);
+    return x[k];
+}
 
-    size_t nFeatures = dataTable.getNumberOfColumns();
-    size_t nVectors  = dataTable.getNumberOfRows();
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTable & dataTable, const NumericTable * initialMeanTable,
+                                                                               const NumericTable * initialCovarianceTable,
+                                                                               NumericTable & resultTable, NumericTable * meanTable,
+                                                                               NumericTable * covarianceTable, const Parameter & par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    DAAL_CHECK(nVectors > nFeatures, ErrorIncorrectNumberOfObservations);
 
     ReadRows<algorithmFPType, cpu> dataBlock(dataTable, 0, nVectors);
     DAAL_CHECK_BLOCK_STATUS(dataBlock)
@@ -78,9 +103,343 @@ services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(N
     const algorithmFPType * data = dataBlock.get();
     algorithmFPType * weight     = resultBlock.get();
 
-    Statistics<algorithmFPType, cpu>::xoutlierdetection(data, (__int64)nFeatures, (__int64)nVectors, nBaconParams, baconParams, weight);
+    TArray<algorithmFPType, cpu> meanArray(nFeatures);
+    TArray<algorithmFPType, cpu> covarianceArray(nFeatures * nFeatures);
+    TArray<algorithmFPType, cpu> whiteningArray(nFeatures * nFeatures);
+    TArray<algorithmFPType, cpu> distancesArray(nVectors);
+    DAAL_CHECK_MALLOC(meanArray.get() && covarianceArray.get() && whiteningArray.get() && distancesArray.get());
+    algorithmFPType * mean       = meanArray.get();
+    algorithmFPType * covariance = covarianceArray.get();
+    algorithmFPType * whitening  = whiteningArray.get();
+    algorithmFPType * distances  = distancesArray.get();
+
+    /* The (1 - alpha) quantile of the chi-square distribution with p degrees of freedom by the Wilson-Hilferty approximation */
+    const algorithmFPType p    = (algorithmFPType)nFeatures;
+    const algorithmFPType n    = (algorithmFPType)nVectors;
+    const algorithmFPType z    = Math<algorithmFPType, cpu>::sCdfNormInv((algorithmFPType)(1.0 - par.alpha));
+    const algorithmFPType a    = (algorithmFPType)2.0 / ((algorithmFPType)9.0 * p);
+    const algorithmFPType base = (algorithmFPType)1.0 - a + z * Math<algorithmFPType, cpu>::sSqrt(a);
+    const algorithmFPType chi2 = p * base * base * base;
+
+    /* The correction factor c_np = 1 + (p + 1) / (n - p) + 1 / (n - h - p) of the threshold of Billor, Hadi and Velleman */
+    const size_t h            = (nVectors + nFeatures + 1) / 2;
+    const algorithmFPType cHp = (nVectors > h + nFeatures) ? (algorithmFPType)1.0 / (algorithmFPType)(nVectors - h - nFeatures) : 0;
+    const algorithmFPType cnp = (algorithmFPType)1.0 + (p + (algorithmFPType)1.0) / (n - p) + cHp;
+
+    /* Squared threshold of the distances for the basic subset of r rows */
+    auto squaredThreshold = [=](size_t r) -> algorithmFPType {
+        const algorithmFPType chr = (h > r) ? (algorithmFPType)(h - r) / (algorithmFPType)(h + r) : 0;
+        return (cnp + chr) * (cnp + chr) * chi2;
+    };
+    auto selectByThreshold = [=](algorithmFPType threshold) -> size_t {
+        size_t nSelected = 0;
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            weight[i] = (distances[i] < threshold) ? (algorithmFPType)1.0 : (algorithmFPType)0.0;
+            nSelected += (distances[i] < threshold);
+        }
+        return nSelected;
+    };
+
+    services::Status s;
+    size_t nSubset = 0;
+    if (initialMeanTable && initialCovarianceTable)
+    {
+        /* The basic subset of the previous window selects the rows of this one */
+        ReadRows<algorithmFPType, cpu> initialMeanBlock(*const_cast<NumericTable *>(initialMeanTable), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(initialMeanBlock)
+        ReadRows<algorithmFPType, cpu> initialCovarianceBlock(*const_cast<NumericTable *>(initialCovarianceTable), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(initialCovarianceBlock)
+
+        if (computeWhitening(initialCovarianceBlock.get(), nFeatures, whitening))
+        {
+            DAAL_CHECK_STATUS(s, computeDistances(data, nVectors, nFeatures, initialMeanBlock.get(), whitening, distances));
+            nSubset = selectByThreshold(squaredThreshold(h));
+        }
+    }
+
+    /* The initialization is used if the rows of the previous basic subset are too few */
+    size_t nInitial = (subsetFactor * nFeatures < nVectors) ? subsetFactor * nFeatures : nVectors;
+    if (nSubset <= nFeatures)
+    {
+        if (par.initMethod == baconMahalanobis)
+        {
+            for (size_t i = 0; i < nVectors; i++) weight[i] = (algorithmFPType)1.0;
+            DAAL_CHECK_STATUS(s, computeSubsetStatistics(data, nVectors, nFeatures, weight, mean, covariance, nSubset));
+            DAAL_CHECK(computeWhitening(covariance, nFeatures, whitening), ErrorOutlierDetectionInternal);
+            DAAL_CHECK_STATUS(s, computeDistances(data, nVectors, nFeatures, mean, whitening, distances));
+        }
+        else
+        {
+            DAAL_CHECK_STATUS(s, computeMedian(data, nVectors, nFeatures, mean));
+            DAAL_CHECK_STATUS(s, computeDistances(data, nVectors, nFeatures, mean, nullptr, distances));
+        }
+        DAAL_CHECK_STATUS(s, selectSmallest(distances, nVectors, nInitial, weight));
+    }
+
+    for (size_t iter = 0; iter < maxIterations; iter++)
+    {
+        DAAL_CHECK_STATUS(s, computeSubsetStatistics(data, nVectors, nFeatures, weight, mean, covariance, nSubset));
+        if (!computeWhitening(covariance, nFeatures, whitening))
+        {
+            /* The basic subset is extended by the rows with the smallest distances while its covariance is singular */
+            DAAL_CHECK(nSubset < nVectors, ErrorOutlierDetectionInternal);
+            nInitial = (2 * nSubset > nFeatures + 1) ? 2 * nSubset : nFeatures + 1;
+            nInitial = (nInitial < nVectors) ? nInitial : nVectors;
+            DAAL_CHECK_STATUS(s, selectSmallest(distances, nVectors, nInitial, weight));
+            continue;
+        }
+
+        DAAL_CHECK_STATUS(s, computeDistances(data, nVectors, nFeatures, mean, whitening, distances));
+        const size_t nSelected = selectByThreshold(squaredThreshold(nSubset));
+        const size_t change    = (nSelected > nSubset) ? nSelected - nSubset : nSubset - nSelected;
+        if ((algorithmFPType)change <= (algorithmFPType)par.toleranceToConverge * (algorithmFPType)nSubset) break;
+    }
+
+    if (meanTable && covarianceTable)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> meanBlock(*meanTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(meanBlock)
+        WriteOnlyRows<algorithmFPType, cpu> covarianceBlock(*covarianceTable, 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(covarianceBlock)
+        algorithmFPType * meanOut       = meanBlock.get();
+        algorithmFPType * covarianceOut = covarianceBlock.get();
+        for (size_t j = 0; j < nFeatures; j++) meanOut[j] = mean[j];
+        for (size_t j = 0; j < nFeatures * nFeatures; j++) covarianceOut[j] = covariance[j];
+    }
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::computeSubsetStatistics(const algorithmFPType * data, size_t nVectors,
+                                                                                               size_t nFeatures, const algorithmFPType * weights,
+                                                                                               algorithmFPType * mean, algorithmFPType * covariance,
+                                                                                               size_t & nSubset)
+{
+    const size_t nBlocks = nVectors / blockSize + !!(nVectors % blockSize);
+
+    /* The sums of the rows of the subset and their number in the last element */
+    TlsSum<algorithmFPType, cpu> tlsSums(nFeatures + 1);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * sums = tlsSums.local();
+        DAAL_CHECK_MALLOC_THR(sums);
+
+        const size_t end = (iBlock + 1) * blockSize < nVectors ? (iBlock + 1) * blockSize : nVectors;
+        for (size_t i = iBlock * blockSize; i < end; i++)
+        {
+            if (weights[i] == 0) continue;
+            const algorithmFPType * x = data + i * nFeatures;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sums[j] += x[j];
+            }
+            sums[nFeatures] += 1;
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    TArray<algorithmFPType, cpu> sumsArray(nFeatures + 1);
+    DAAL_CHECK_MALLOC(sumsArray.get());
+    algorithmFPType * sums = sumsArray.get();
+    tlsSums.reduceTo(sums, nFeatures + 1);
+
+    nSubset                     = (size_t)sums[nFeatures];
+    const algorithmFPType invN  = nSubset ? (algorithmFPType)1.0 / (algorithmFPType)nSubset : 0;
+    const algorithmFPType invN1 = (nSubset > 1) ? (algorithmFPType)1.0 / (algorithmFPType)(nSubset - 1) : 0;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        mean[j] = sums[j] * invN;
+    }
 
-    return Status();
+    /* The cross-products of the centered rows of the subset are accumulated by SYRK of the gathered blocks */
+    TlsSum<algorithmFPType, cpu> tlsCrossProducts(nFeatures * nFeatures);
+    daal::TlsMem<algorithmFPType, cpu> tlsBlocks(blockSize * nFeatures);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * crossProduct = tlsCrossProducts.local();
+        algorithmFPType * block        = tlsBlocks.local();
+        DAAL_CHECK_MALLOC_THR(crossProduct && block);
+
+        const size_t end = (iBlock + 1) * blockSize < nVectors ? (iBlock + 1) * blockSize : nVectors;
+        DAAL_INT nRows   = 0;
+        for (size_t i = iBlock * blockSize; i < end; i++)
+        {
+            if (weights[i] == 0) continue;
+            const algorithmFPType * x = data + i * nFeatures;
+            algorithmFPType * y       = block + nRows * nFeatures;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                y[j] = x[j] - mean[j];
+            }
+            nRows++;
+        }
+        if (nRows == 0) return;
+
+        char uplo             = 'U';
+        char trans            = 'N';
+        DAAL_INT dim          = static_cast<DAAL_INT>(nFeatures);
+        algorithmFPType alpha = 1.0;
+        algorithmFPType beta  = 1.0;
+        Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &dim, &nRows, &alpha, block, &dim, &beta, crossProduct, &dim);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* SYRK fills the lower triangle of the row-major matrix */
+    tlsCrossProducts.reduceTo(covariance, nFeatures * nFeatures);
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        for (size_t j = 0; j <= i; j++)
+        {
+            covariance[i * nFeatures + j] *= invN1;
+            covariance[j * nFeatures + i] = covariance[i * nFeatures + j];
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+bool OutlierDetectionKernel<algorithmFPType, method, cpu>::computeWhitening(const algorithmFPType * covariance, size_t nFeatures,
+                                                                            algorithmFPType * whitening)
+{
+    TArray<algorithmFPType, cpu> factorArray(nFeatures * nFeatures);
+    if (!factorArray.get()) return false;
+    algorithmFPType * factor = factorArray.get();
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            factor[i * nFeatures + j]    = covariance[i * nFeatures + j];
+            whitening[i * nFeatures + j] = (i == j) ? (algorithmFPType)1.0 : (algorithmFPType)0.0;
+        }
+    }
+
+    /* covariance = L * L', the upper factor of the column-major matrix is L' */
+    char uplo     = 'U';
+    char trans    = 'N';
+    char diag     = 'N';
+    DAAL_INT dim  = static_cast<DAAL_INT>(nFeatures);
+    DAAL_INT info = 0;
+    Lapack<algorithmFPType, cpu>::xxpotrf(&uplo, &dim, factor, &dim, &info);
+    if (info != 0) return false;
+
+    /* The column-major inverse of L' is the row-major inverse of L */
+    Lapack<algorithmFPType, cpu>::xxtrtrs(&uplo, &trans, &diag, &dim, &dim, factor, &dim, whitening, &dim, &info);
+    return info == 0;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::computeDistances(const algorithmFPType * data, size_t nVectors,
+                                                                                        size_t nFeatures, const algorithmFPType * mean,
+                                                                                        const algorithmFPType * whitening,
+                                                                                        algorithmFPType * distances)
+{
+    const size_t nBlocks = nVectors / blockSize + !!(nVectors % blockSize);
+
+    daal::TlsMem<algorithmFPType, cpu> tlsBlocks(2 * blockSize * nFeatures);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * centered = tlsBlocks.local();
+        DAAL_CHECK_MALLOC_THR(centered);
+        algorithmFPType * whitened = centered + blockSize * nFeatures;
+
+        const size_t start = iBlock * blockSize;
+        const size_t nRows = (start + blockSize > nVectors) ? nVectors - start : blockSize;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType * x = data + (start + i) * nFeatures;
+            algorithmFPType * y       = centered + i * nFeatures;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                y[j] = x[j] - mean[j];
+            }
+        }
+
+        /* whitened row i = L^-1 * centered row i */
+        const algorithmFPType * y = centered;
+        if (whitening)
+        {
+            char transa           = 'T';
+            char transb           = 'N';
+            DAAL_INT dim          = static_cast<DAAL_INT>(nFeatures);
+            DAAL_INT nRowsInt     = static_cast<DAAL_INT>(nRows);
+            algorithmFPType alpha = 1.0;
+            algorithmFPType beta  = 0.0;
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &dim, &nRowsInt, &dim, &alpha, whitening, &dim, centered, &dim, &beta, whitened,
+                                               &dim);
+            y = whitened;
+        }
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType * yi = y + i * nFeatures;
+            algorithmFPType sum        = 0;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sum += yi[j] * yi[j];
+            }
+            distances[start + i] = sum;
+        }
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::computeMedian(const algorithmFPType * data, size_t nVectors, size_t nFeatures,
+                                                                                     algorithmFPType * median)
+{
+    daal::TlsMem<algorithmFPType, cpu> tlsColumns(nVectors);
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+        algorithmFPType * column = tlsColumns.local();
+        DAAL_CHECK_MALLOC_THR(column);
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            column[i] = data[i * nFeatures + j];
+        }
+
+        const size_t k           = nVectors / 2;
+        const algorithmFPType up = kthSmallest<algorithmFPType, cpu>(column, nVectors, k);
+        if (nVectors % 2)
+        {
+            median[j] = up;
+            return;
+        }
+        algorithmFPType low = column[0];
+        for (size_t i = 1; i < k; i++)
+        {
+            low = (column[i] > low) ? column[i] : low;
+        }
+        median[j] = (low + up) * (algorithmFPType)0.5;
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::selectSmallest(const algorithmFPType * distances, size_t nVectors,
+                                                                                      size_t nSubset, algorithmFPType * weights)
+{
+    TArray<algorithmFPType, cpu> bufferArray(nVectors);
+    DAAL_CHECK_MALLOC(bufferArray.get());
+    algorithmFPType * buffer = bufferArray.get();
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        buffer[i] = distances[i];
+    }
+
+    const algorithmFPType threshold = kthSmallest<algorithmFPType, cpu>(buffer, nVectors, nSubset - 1);
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        weights[i] = (distances[i] <= threshold) ? (algorithmFPType)1.0 : (algorithmFPType)0.0;
+    }
+    return services::Status();
 }
 
 } // namespace internal
@@ -40,10 +40,35 @@ namespace bacon_outlier_detection
 {
 namespace internal
 {
+/**
+ *  The rows are processed by blocks in parallel. The statistics of the basic subset
+ *  are accumulated by SYRK per thread, the Mahalanobis distances of a block are the
+ *  squared norms of its centered rows multiplied by the inverse of the Cholesky factor
+ *  of the covariance with GEMM. The weights of the rows mark the basic subset.
+ */
 template <typename algorithmFPType, Method method, CpuType cpu>
 struct OutlierDetectionKernel : public Kernel
 {
-    services::Status compute(NumericTable & data, NumericTable & weights, const Parameter & par);
+    services::Status compute(NumericTable & data, const NumericTable * initialMean, const NumericTable * initialCovariance, NumericTable & weights,
+                             NumericTable * mean, NumericTable * covariance, const Parameter & par);
+
+protected:
+    /* Mean and covariance of the rows with the weight 1, nSubset is the number of such rows */
+    services::Status computeSubsetStatistics(const algorithmFPType * data, size_t nVectors, size_t nFeatures, const algorithmFPType * weights,
+                                             algorithmFPType * mean, algorithmFPType * covariance, size_t & nSubset);
+
+    /* whitening = inverse of the lower Cholesky factor of the covariance, false if the covariance is singular */
+    bool computeWhitening(const algorithmFPType * covariance, size_t nFeatures, algorithmFPType * whitening);
+
+    /* Squared Mahalanobis distances of the rows, or squared Euclidean distances if whitening is null */
+    services::Status computeDistances(const algorithmFPType * data, size_t nVectors, size_t nFeatures, const algorithmFPType * mean,
+                                      const algorithmFPType * whitening, algorithmFPType * distances);
+
+    /* Coordinate-wise median of the rows */
+    services::Status computeMedian(const algorithmFPType * data, size_t nVectors, size_t nFeatures, algorithmFPType * median);
+
+    /* Sets the weights of the nSubset rows with the smallest distances to 1 and of the other rows to 0 */
+    services::Status selectSmallest(const algorithmFPType * distances, size_t nVectors, size_t nSubset, algorithmFPType * weights);
 };
 
 } // namespace internal
@@ -0,0 +1,60 @@
+/* file: outlierdetection_multivariate_cl_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the kernels of the Mahalanobis distances of the rows.
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_MULTIVARIATE_CL_KERNELS_CL__
+#define __OUTLIERDETECTION_MULTIVARIATE_CL_KERNELS_CL__
+
+#include <string.h>
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    clKernelOutlierDetectionDistance,
+
+    /* distances[offset + i] = |rows[i] + bias|^2 of the rows of the block */
+    __kernel void biasedRowSquaredNorms(const __global algorithmFPType * rows, const __global algorithmFPType * bias, uint nFeatures, uint offset,
+                                        __global algorithmFPType * distances) {
+        const uint i = get_global_id(0);
+
+        const __global algorithmFPType * row = rows + i * nFeatures;
+        algorithmFPType sum                  = (algorithmFPType)0;
+        for (uint j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType value = row[j] + bias[j];
+            sum += value * value;
+        }
+        distances[offset + i] = sum;
+    }
+
+    __kernel void selectWeights(const __global algorithmFPType * distances, algorithmFPType threshold, uint strict,
+                                __global algorithmFPType * weights) {
+        const uint i = get_global_id(0);
+
+        const algorithmFPType d = distances[i];
+        const int selected      = (strict == 1) ? (d < threshold) : (d <= threshold);
+        weights[i]              = selected ? (algorithmFPType)1 : (algorithmFPType)0;
+    }
+
+);
+
+#endif
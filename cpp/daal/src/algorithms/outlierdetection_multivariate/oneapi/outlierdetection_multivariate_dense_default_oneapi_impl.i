@@ -0,0 +1,116 @@
+/* file: outlierdetection_multivariate_dense_default_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of multivariate outlier detection on GPU
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_MULTIVARIATE_DENSE_DEFAULT_ONEAPI_IMPL_I__
+#define __OUTLIERDETECTION_MULTIVARIATE_DENSE_DEFAULT_ONEAPI_IMPL_I__
+
+#include "src/algorithms/outlierdetection_multivariate/oneapi/outlierdetection_multivariate_kernel_oneapi.h"
+#include "src/algorithms/outlierdetection_multivariate/oneapi/outlierdetection_multivariate_distance_oneapi_impl.i"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(outlier_detection.multivariate.batch.oneapi);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multivariate_outlier_detection
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::data_management;
+using namespace daal::services::internal::sycl;
+using daal::services::internal::TArray;
+
+template <typename algorithmFPType, Method method>
+services::Status OutlierDetectionKernelOneAPI<algorithmFPType, method>::compute(NumericTable & dataTable, NumericTable * locationTable,
+                                                                                NumericTable * scatterTable, NumericTable * thresholdTable,
+                                                                                NumericTable & resultTable)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    services::Status status;
+
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nVectors, nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nFeatures, nFeatures);
+
+    TArray<algorithmFPType, sse2> locationPtr, scatterPtr, thresholdPtr;
+    ReadRows<algorithmFPType, sse2> locationBlock(locationTable), scatterBlock(scatterTable), thresholdBlock(thresholdTable);
+
+    algorithmFPType * locationArray = (locationTable) ? const_cast<algorithmFPType *>(locationBlock.next(0, 1)) : locationPtr.reset(nFeatures);
+    algorithmFPType * scatterArray =
+        (scatterTable) ? const_cast<algorithmFPType *>(scatterBlock.next(0, nFeatures)) : scatterPtr.reset(nFeatures * nFeatures);
+    algorithmFPType * thresholdArray = (thresholdTable) ? const_cast<algorithmFPType *>(thresholdBlock.next(0, 1)) : thresholdPtr.reset(1);
+
+    DAAL_CHECK(locationArray && scatterArray && thresholdArray, services::ErrorMemoryAllocationFailed)
+
+    /* The defaults of the CPU kernel: zero location, identity scatter and the threshold 3 */
+    if (!locationTable || !scatterTable || !thresholdTable)
+    {
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            locationArray[i] = 0.0;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                scatterArray[i * nFeatures + j] = 0.0;
+            }
+            scatterArray[i * nFeatures + i] = 1.0;
+        }
+        thresholdArray[0] = 3.0;
+    }
+
+    TArray<algorithmFPType, sse2> whiteningArray(nFeatures * nFeatures);
+    DAAL_CHECK_MALLOC(whiteningArray.get());
+    DAAL_CHECK(MahalanobisDistanceOneAPI<algorithmFPType>::computeWhitening(scatterArray, nFeatures, whiteningArray.get()),
+               services::ErrorOutlierDetectionInternal);
+
+    ExecutionContextIface & ctx = services::internal::getDefaultContext();
+    UniversalBuffer distances   = ctx.allocate(TypeIds::id<algorithmFPType>(), nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS(status, dataTable.getBlockOfRows(0, nVectors, ReadWriteMode::readOnly, dataBlock));
+    DAAL_CHECK_STATUS(status, MahalanobisDistanceOneAPI<algorithmFPType>::computeDistances(dataBlock.getBuffer(), nVectors, nFeatures, locationArray,
+                                                                                            whiteningArray.get(), distances));
+    DAAL_CHECK_STATUS(status, dataTable.releaseBlockOfRows(dataBlock));
+
+    /* The row is the outlier if the square root of its distance is greater than the threshold, none is kept by the negative one */
+    const algorithmFPType threshold        = thresholdArray[0];
+    const algorithmFPType squaredThreshold = (threshold < 0) ? algorithmFPType(-1) : threshold * threshold;
+
+    BlockDescriptor<algorithmFPType> resultBlock;
+    DAAL_CHECK_STATUS(status, resultTable.getBlockOfRows(0, nVectors, ReadWriteMode::writeOnly, resultBlock));
+    UniversalBuffer weights = resultBlock.getBuffer();
+    DAAL_CHECK_STATUS(status, MahalanobisDistanceOneAPI<algorithmFPType>::selectWeights(distances, nVectors, squaredThreshold, false, weights));
+    return resultTable.releaseBlockOfRows(resultBlock);
+}
+
+} // namespace internal
+} // namespace multivariate_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
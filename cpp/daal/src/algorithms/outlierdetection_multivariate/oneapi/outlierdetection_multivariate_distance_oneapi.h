@@ -0,0 +1,74 @@
+/* file: outlierdetection_multivariate_distance_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the Mahalanobis distances of the rows on GPU, shared by
+//  the outlier detection methods.
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_MULTIVARIATE_DISTANCE_ONEAPI_H__
+#define __OUTLIERDETECTION_MULTIVARIATE_DISTANCE_ONEAPI_H__
+
+#include "services/internal/sycl/types.h"
+#include "services/internal/sycl/execution_context.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multivariate_outlier_detection
+{
+namespace internal
+{
+/**
+ *  The squared Mahalanobis distance of the row x is |W * (x - m)|^2, W is the inverse of the lower Cholesky factor of
+ *  the scatter matrix. The whitening W is computed on the host, then the whitened rows of a block are X * W' + b with
+ *  b = -W * m by GEMM on the device and the distances are their squared norms. Only the p x p matrices are moved
+ *  between the host and the device.
+ */
+template <typename algorithmFPType>
+class MahalanobisDistanceOneAPI
+{
+public:
+    /** The largest number of the values of the whitened rows of a block */
+    static const uint32_t maxBlockSize = 1 << 22;
+
+    /* whitening = inverse of the lower Cholesky factor of the row-major scatter matrix, false if it is singular */
+    static bool computeWhitening(const algorithmFPType * scatter, size_t nFeatures, algorithmFPType * whitening);
+
+    /* Squared Mahalanobis distances of the rows of the data on the device, or squared Euclidean distances if whitening is null */
+    static services::Status computeDistances(const services::internal::sycl::UniversalBuffer & data, uint32_t nVectors, uint32_t nFeatures,
+                                             const algorithmFPType * mean, const algorithmFPType * whitening,
+                                             services::internal::sycl::UniversalBuffer & distances);
+
+    /* Sets the weights of the rows with the distances less than the threshold, or not greater if strict is false, to 1 and
+       of the other rows to 0 */
+    static services::Status selectWeights(const services::internal::sycl::UniversalBuffer & distances, uint32_t nVectors, algorithmFPType threshold,
+                                          bool strict, services::internal::sycl::UniversalBuffer & weights);
+
+private:
+    static services::Status buildProgram(services::internal::sycl::ClKernelFactoryIface & factory);
+};
+
+} // namespace internal
+} // namespace multivariate_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,196 @@
+/* file: outlierdetection_multivariate_distance_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the Mahalanobis distances of the rows on GPU.
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_MULTIVARIATE_DISTANCE_ONEAPI_IMPL_I__
+#define __OUTLIERDETECTION_MULTIVARIATE_DISTANCE_ONEAPI_IMPL_I__
+
+#include "src/algorithms/outlierdetection_multivariate/oneapi/outlierdetection_multivariate_distance_oneapi.h"
+#include "src/algorithms/outlierdetection_multivariate/oneapi/cl_kernels/outlierdetection_multivariate_cl_kernels.cl"
+#include "src/externals/service_lapack.h"
+#include "src/services/service_arrays.h"
+#include "src/sycl/blas_gpu.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multivariate_outlier_detection
+{
+namespace internal
+{
+using namespace daal::services::internal::sycl;
+using daal::services::internal::TArray;
+
+template <typename algorithmFPType>
+services::Status MahalanobisDistanceOneAPI<algorithmFPType>::buildProgram(ClKernelFactoryIface & factory)
+{
+    services::Status status;
+    const services::String options = getKeyFPType<algorithmFPType>();
+    services::String cachekey("__daal_algorithms_outlier_detection_distance_");
+    cachekey.add(options);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), clKernelOutlierDetectionDistance, options.c_str(), &status);
+    return status;
+}
+
+template <typename algorithmFPType>
+bool MahalanobisDistanceOneAPI<algorithmFPType>::computeWhitening(const algorithmFPType * scatter, size_t nFeatures, algorithmFPType * whitening)
+{
+    TArray<algorithmFPType, sse2> factorArray(nFeatures * nFeatures);
+    if (!factorArray.get()) return false;
+    algorithmFPType * factor = factorArray.get();
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            factor[i * nFeatures + j]    = scatter[i * nFeatures + j];
+            whitening[i * nFeatures + j] = (i == j) ? (algorithmFPType)1.0 : (algorithmFPType)0.0;
+        }
+    }
+
+    /* scatter = L * L', the upper factor of the column-major matrix is L' */
+    char uplo     = 'U';
+    char trans    = 'N';
+    char diag     = 'N';
+    DAAL_INT dim  = static_cast<DAAL_INT>(nFeatures);
+    DAAL_INT info = 0;
+    daal::internal::Lapack<algorithmFPType, sse2>::xxpotrf(&uplo, &dim, factor, &dim, &info);
+    if (info != 0) return false;
+
+    /* The column-major inverse of L' is the row-major inverse of L */
+    daal::internal::Lapack<algorithmFPType, sse2>::xxtrtrs(&uplo, &trans, &diag, &dim, &dim, factor, &dim, whitening, &dim, &info);
+    return info == 0;
+}
+
+template <typename algorithmFPType>
+services::Status MahalanobisDistanceOneAPI<algorithmFPType>::computeDistances(const UniversalBuffer & data, uint32_t nVectors, uint32_t nFeatures,
+                                                                              const algorithmFPType * mean, const algorithmFPType * whitening,
+                                                                              UniversalBuffer & distances)
+{
+    services::Status status;
+
+    ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    DAAL_CHECK_STATUS(status, buildProgram(factory));
+
+    KernelPtr kernel = factory.getKernel("biasedRowSquaredNorms", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    /* bias = -W * m, or -m for the Euclidean distances */
+    TArray<algorithmFPType, sse2> biasArray(nFeatures);
+    DAAL_CHECK_MALLOC(biasArray.get());
+    algorithmFPType * biasValues = biasArray.get();
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        algorithmFPType value = whitening ? 0 : mean[i];
+        if (whitening)
+        {
+            for (size_t j = 0; j <= i; j++)
+            {
+                value += whitening[i * nFeatures + j] * mean[j];
+            }
+        }
+        biasValues[i] = -value;
+    }
+    UniversalBuffer bias = ctx.allocate(TypeIds::id<algorithmFPType>(), nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ctx.copy(bias, 0, (void *)biasValues, 0, nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    if (!whitening)
+    {
+        KernelArguments args(5);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, bias, AccessModeIds::read);
+        args.set(2, nFeatures);
+        args.set(3, uint32_t(0));
+        args.set(4, distances, AccessModeIds::write);
+
+        KernelRange range(nVectors);
+        ctx.run(range, kernel, args, &status);
+        return status;
+    }
+
+    UniversalBuffer whiteningBuffer = ctx.allocate(TypeIds::id<algorithmFPType>(), nFeatures * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ctx.copy(whiteningBuffer, 0, (void *)whitening, 0, nFeatures * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    const uint32_t maxRowsInBlock = (maxBlockSize / nFeatures > 0) ? maxBlockSize / nFeatures : 1;
+    const uint32_t rowsInBlock    = (nVectors < maxRowsInBlock) ? nVectors : maxRowsInBlock;
+    UniversalBuffer whitened      = ctx.allocate(TypeIds::id<algorithmFPType>(), rowsInBlock * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    for (uint32_t start = 0; start < nVectors; start += rowsInBlock)
+    {
+        const uint32_t nRows = (start + rowsInBlock > nVectors) ? nVectors - start : rowsInBlock;
+
+        /* The whitened rows of the block are X * W' */
+        DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::Trans, nRows,
+                                                                 nFeatures, nFeatures, algorithmFPType(1), data, nFeatures, start * nFeatures,
+                                                                 whiteningBuffer, nFeatures, 0, algorithmFPType(0), whitened, nFeatures, 0));
+
+        KernelArguments args(5);
+        args.set(0, whitened, AccessModeIds::read);
+        args.set(1, bias, AccessModeIds::read);
+        args.set(2, nFeatures);
+        args.set(3, start);
+        args.set(4, distances, AccessModeIds::readwrite);
+
+        KernelRange range(nRows);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status MahalanobisDistanceOneAPI<algorithmFPType>::selectWeights(const UniversalBuffer & distances, uint32_t nVectors,
+                                                                           algorithmFPType threshold, bool strict, UniversalBuffer & weights)
+{
+    services::Status status;
+
+    ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    DAAL_CHECK_STATUS(status, buildProgram(factory));
+
+    KernelPtr kernel = factory.getKernel("selectWeights", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(4);
+    args.set(0, distances, AccessModeIds::read);
+    args.set(1, threshold);
+    args.set(2, uint32_t(strict));
+    args.set(3, weights, AccessModeIds::write);
+
+    KernelRange range(nVectors);
+    ctx.run(range, kernel, args, &status);
+    return status;
+}
+
+} // namespace internal
+} // namespace multivariate_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,57 @@
+/* file: outlierdetection_multivariate_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs for multivariate outlier detection on GPU
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_MULTIVARIATE_KERNEL_ONEAPI_H__
+#define __OUTLIERDETECTION_MULTIVARIATE_KERNEL_ONEAPI_H__
+
+#include "algorithms/outlier_detection/outlier_detection_multivariate.h"
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multivariate_outlier_detection
+{
+namespace internal
+{
+/**
+ *  The distances of the rows are computed by MahalanobisDistanceOneAPI and compared to the threshold on the device,
+ *  only the weights of the rows are written to the result table
+ */
+template <typename algorithmFPType, Method method>
+class OutlierDetectionKernelOneAPI : public Kernel
+{
+public:
+    services::Status compute(data_management::NumericTable & dataTable, data_management::NumericTable * locationTable,
+                             data_management::NumericTable * scatterTable, data_management::NumericTable * thresholdTable,
+                             data_management::NumericTable & resultTable);
+};
+
+} // namespace internal
+} // namespace multivariate_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -23,6 +23,8 @@
 
 #include "algorithms/outlier_detection/outlier_detection_multivariate.h"
 #include "src/algorithms/outlierdetection_multivariate/outlierdetection_multivariate_kernel.h"
+#include "src/algorithms/outlierdetection_multivariate/oneapi/outlierdetection_multivariate_kernel_oneapi.h"
+#include "services/internal/execution_context.h"
 
 namespace daal
 {
@@ -35,7 +37,18 @@ namespace interface1
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionKernel, algorithmFPType, method);
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionKernel, algorithmFPType, method);
+    }
+    else
+    {
+        /* The kernel is called with defaultDense for the deprecated baconDense value as on CPU */
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::OutlierDetectionKernelOneAPI, algorithmFPType, defaultDense);
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -58,8 +71,20 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * thresholdTable = static_cast<NumericTable *>(input->get(threshold).get());
 
     daal::services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute, dataTable,
-                       locationTable, scatterTable, thresholdTable, weightsTable);
+
+    auto & context    = services::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute, dataTable,
+                           locationTable, scatterTable, thresholdTable, weightsTable);
+    }
+    else
+    {
+        __DAAL_CALL_KERNEL_SYCL(env, internal::OutlierDetectionKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute,
+                                dataTable, locationTable, scatterTable, thresholdTable, weightsTable);
+    }
 }
 } // namespace interface1
 } // namespace multivariate_outlier_detection
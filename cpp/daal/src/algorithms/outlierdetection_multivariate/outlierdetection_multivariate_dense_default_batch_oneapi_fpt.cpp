@@ -0,0 +1,39 @@
+/* file: outlierdetection_multivariate_dense_default_batch_oneapi_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of multivariate outlier detection kernel on GPU.
+//--
+*/
+
+#include "src/algorithms/outlierdetection_multivariate/oneapi/outlierdetection_multivariate_dense_default_oneapi_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multivariate_outlier_detection
+{
+namespace internal
+{
+template class OutlierDetectionKernelOneAPI<DAAL_FPTYPE, defaultDense>;
+
+} // namespace internal
+} // namespace multivariate_outlier_detection
+} // namespace algorithms
+} // namespace daal
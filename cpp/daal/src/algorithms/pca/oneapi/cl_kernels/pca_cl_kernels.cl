@@ -38,6 +38,31 @@ DECLARE_SOURCE(
         variances[tid] = covariance[tid * nFeatures + tid];
     }
 
+    // The work-item per feature, the neighbouring work-items read the
+    // neighbouring values of the rows
+    __kernel void calculateMeansAndVariances(const __global algorithmFPType * data, __global algorithmFPType * means,
+                                             __global algorithmFPType * variances, uint nObservations, uint nFeatures) {
+        const uint j = get_global_id(0);
+        if (j >= nFeatures) return;
+
+        algorithmFPType sum = (algorithmFPType)0;
+        for (uint i = 0; i < nObservations; i++)
+        {
+            sum += data[i * nFeatures + j];
+        }
+        const algorithmFPType mean = sum / (algorithmFPType)nObservations;
+
+        algorithmFPType sumSq = (algorithmFPType)0;
+        for (uint i = 0; i < nObservations; i++)
+        {
+            const algorithmFPType delta = data[i * nFeatures + j] - mean;
+            sumSq += delta * delta;
+        }
+
+        means[j]     = mean;
+        variances[j] = (nObservations > 1) ? sumSq / (algorithmFPType)(nObservations - 1) : (algorithmFPType)0;
+    }
+
 );
 
 #endif
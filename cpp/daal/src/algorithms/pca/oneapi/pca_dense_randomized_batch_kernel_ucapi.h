@@ -0,0 +1,82 @@
+/* file: pca_dense_randomized_batch_kernel_ucapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Declaration of PCA with the randomized SVD for GPU.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_KERNEL_UCAPI_H__
+#define __PCA_DENSE_RANDOMIZED_BATCH_KERNEL_UCAPI_H__
+
+#include "src/algorithms/pca/pca_dense_randomized_batch_kernel.h"
+#include "services/internal/sycl/types.h"
+#include "services/internal/sycl/execution_context.h"
+#include "algorithms/pca/pca_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+/**
+ * The products with the data run on the device, the bases of the n x l
+ * products are orthonormalized on the device with the RQ decomposition.
+ * The small p x l problems are solved on the host with the host kernel.
+ */
+template <typename algorithmFPType>
+class PCARandomizedKernelBatchUCAPI : public Kernel
+{
+public:
+    using PCARandomizedBaseIfacePtr = services::SharedPtr<PCARandomizedBaseIface<algorithmFPType> >;
+
+public:
+    PCARandomizedKernelBatchUCAPI(const PCARandomizedBaseIfacePtr & host_impl);
+
+    services::Status compute(bool isDeterministic, data_management::NumericTable & dataTable, const svd::internal::RandomizedParameter & par,
+                             data_management::NumericTable & eigenvectors, data_management::NumericTable & eigenvalues,
+                             data_management::NumericTable & means, data_management::NumericTable & variances);
+
+private:
+    /* y' = (As * w)' for the host p x l matrix w, y' is l x n */
+    services::Status multiply(const services::internal::Buffer<algorithmFPType> & data, uint32_t nObservations, uint32_t nFeatures,
+                              const algorithmFPType * means, const algorithmFPType * invSigmas, uint32_t l, const algorithmFPType * w,
+                              const services::internal::Buffer<algorithmFPType> & ones, services::internal::Buffer<algorithmFPType> & yt);
+
+    /* Replaces the rows of y' with the orthonormal basis of them */
+    services::Status orthonormalize(uint32_t nObservations, uint32_t l, services::internal::Buffer<algorithmFPType> & yt,
+                                    services::internal::Buffer<algorithmFPType> & qt);
+
+    /* z = As' * q for the l x n matrix q', z is written to the host */
+    services::Status multiplyTransposed(const services::internal::Buffer<algorithmFPType> & data, uint32_t nObservations, uint32_t nFeatures,
+                                        const algorithmFPType * means, const algorithmFPType * invSigmas, uint32_t l,
+                                        const services::internal::Buffer<algorithmFPType> & qt,
+                                        const services::internal::Buffer<algorithmFPType> & ones, algorithmFPType * z);
+
+private:
+    PCARandomizedBaseIfacePtr _host_impl;
+};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
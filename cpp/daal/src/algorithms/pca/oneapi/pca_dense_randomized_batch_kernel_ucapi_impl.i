@@ -0,0 +1,360 @@
+/* file: pca_dense_randomized_batch_kernel_ucapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of PCA with the randomized SVD for GPU.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_KERNEL_UCAPI_IMPL__
+#define __PCA_DENSE_RANDOMIZED_BATCH_KERNEL_UCAPI_IMPL__
+
+#include "src/externals/service_ittnotify.h"
+DAAL_ITTNOTIFY_DOMAIN(pca.dense.randomized.batch.oneapi);
+
+#include "services/env_detect.h"
+#include "src/algorithms/pca/oneapi/cl_kernels/pca_cl_kernels.cl"
+#include "src/sycl/blas_gpu.h"
+#include "src/sycl/lapack_gpu.h"
+#include "src/services/service_arrays.h"
+#include "src/externals/service_math.h"
+
+using namespace daal::services;
+using namespace daal::internal;
+using namespace daal::services::internal::sycl;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+template <typename algorithmFPType>
+PCARandomizedKernelBatchUCAPI<algorithmFPType>::PCARandomizedKernelBatchUCAPI(const PCARandomizedBaseIfacePtr & host_impl)
+{
+    _host_impl = host_impl;
+}
+
+template <typename algorithmFPType>
+Status PCARandomizedKernelBatchUCAPI<algorithmFPType>::compute(bool isDeterministic, NumericTable & dataTable,
+                                                               const svd::internal::RandomizedParameter & par, NumericTable & eigenvectors,
+                                                               NumericTable & eigenvalues, NumericTable & means, NumericTable & variances)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    Status st;
+
+    auto & context        = Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernel_factory = context.getClKernelFactory();
+
+    auto fptype_name   = services::internal::sycl::getKeyFPType<algorithmFPType>();
+    auto build_options = fptype_name;
+    build_options.add("-cl-std=CL1.2");
+
+    services::String cachekey("__daal_algorithms_pca_randomized_dense_batch_");
+    cachekey.add(fptype_name);
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.buildProgram);
+        kernel_factory.build(ExecutionTargetIds::device, cachekey.c_str(), pca_cl_kernels, build_options.c_str(), &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    auto calculateMeansAndVariancesKernel = kernel_factory.getKernel("calculateMeansAndVariances", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    const uint32_t N           = dataTable.getNumberOfRows();
+    const uint32_t p           = dataTable.getNumberOfColumns();
+    const uint32_t nComponents = par.nComponents;
+    DAAL_CHECK(nComponents > 0 && nComponents <= p, services::ErrorIncorrectParameter);
+    const uint32_t l = (par.nComponents + par.nOversamples < p) ? par.nComponents + par.nOversamples : p;
+
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS(st, dataTable.getBlockOfRows(0, N, readOnly, dataBlock));
+    const services::internal::Buffer<algorithmFPType> data = dataBlock.getBuffer();
+
+    services::internal::TArray<algorithmFPType, sse2> meansArray(p);
+    services::internal::TArray<algorithmFPType, sse2> invSigmasArray(p);
+    DAAL_CHECK_MALLOC(meansArray.get() && invSigmasArray.get());
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.meansAndVariances);
+
+        BlockDescriptor<algorithmFPType> meansBlock;
+        BlockDescriptor<algorithmFPType> varBlock;
+        DAAL_CHECK_STATUS(st, means.getBlockOfRows(0, 1, writeOnly, meansBlock));
+        DAAL_CHECK_STATUS(st, variances.getBlockOfRows(0, 1, writeOnly, varBlock));
+
+        KernelArguments args(5);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, meansBlock.getBuffer(), AccessModeIds::write);
+        args.set(2, varBlock.getBuffer(), AccessModeIds::write);
+        args.set(3, N);
+        args.set(4, p);
+
+        KernelRange range(p);
+        context.run(range, calculateMeansAndVariancesKernel, args, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        /* The standardization is applied on the fly, the constant features
+           do not contribute to the correlation matrix */
+        auto meansHost = meansBlock.getBuffer().toHost(readOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        auto varHost = varBlock.getBuffer().toHost(readOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        for (uint32_t j = 0; j < p; ++j)
+        {
+            const algorithmFPType variance = varHost.get()[j];
+            meansArray[j]                  = meansHost.get()[j];
+            invSigmasArray[j]              = (variance > 0) ? algorithmFPType(1) / daal::internal::Math<algorithmFPType, sse2>::sSqrt(variance) : 0;
+        }
+
+        DAAL_CHECK_STATUS(st, means.releaseBlockOfRows(meansBlock));
+        DAAL_CHECK_STATUS(st, variances.releaseBlockOfRows(varBlock));
+    }
+
+    auto onesBuff = context.allocate(TypeIds::id<algorithmFPType>(), N, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    context.fill(onesBuff, 1.0, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto ytBuff = context.allocate(TypeIds::id<algorithmFPType>(), size_t(N) * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto qtBuff = context.allocate(TypeIds::id<algorithmFPType>(), size_t(N) * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto ones = onesBuff.template get<algorithmFPType>();
+    auto yt   = ytBuff.template get<algorithmFPType>();
+    auto qt   = qtBuff.template get<algorithmFPType>();
+
+    services::internal::TArray<algorithmFPType, sse2> omegaArray(size_t(p) * l);
+    services::internal::TArray<algorithmFPType, sse2> zArray(size_t(p) * l);
+    services::internal::TArray<algorithmFPType, sse2> sigmaArray(nComponents);
+    services::internal::TArray<algorithmFPType, sse2> vectorsArray(size_t(nComponents) * p);
+    DAAL_CHECK_MALLOC(omegaArray.get() && zArray.get() && sigmaArray.get() && vectorsArray.get());
+    algorithmFPType * z = zArray.get();
+
+    DAAL_CHECK_STATUS(st, _host_impl->generateTestMatrix(p, l, par.seed, omegaArray.get()));
+
+    /* The same power iterations as the ones of the host kernel */
+    const algorithmFPType * w = omegaArray.get();
+    for (size_t it = 0;; ++it)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.powerIteration);
+        DAAL_CHECK_STATUS(st, multiply(data, N, p, meansArray.get(), invSigmasArray.get(), l, w, ones, yt));
+        DAAL_CHECK_STATUS(st, orthonormalize(N, l, yt, qt));
+        DAAL_CHECK_STATUS(st, multiplyTransposed(data, N, p, meansArray.get(), invSigmasArray.get(), l, qt, ones, z));
+        if (it == par.nPowerIterations) break;
+
+        DAAL_CHECK_STATUS(st, _host_impl->orthonormalize(p, l, z));
+        w = z;
+    }
+    DAAL_CHECK_STATUS(st, dataTable.releaseBlockOfRows(dataBlock));
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.singularVectors);
+        DAAL_CHECK_STATUS(st, _host_impl->computeSingularVectors(p, l, z, nComponents, sigmaArray.get(), vectorsArray.get()));
+    }
+
+    {
+        BlockDescriptor<algorithmFPType> eigenvectorsBlock;
+        DAAL_CHECK_STATUS(st, eigenvectors.getBlockOfRows(0, nComponents, writeOnly, eigenvectorsBlock));
+        context.copy(eigenvectorsBlock.getBuffer(), 0, (void *)vectorsArray.get(), 0, size_t(nComponents) * p, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK_STATUS(st, eigenvectors.releaseBlockOfRows(eigenvectorsBlock));
+    }
+
+    /* The eigenvalues of the correlation matrix are sigma^2 / (n - 1) */
+    {
+        const algorithmFPType factor = (N > 1) ? algorithmFPType(1) / algorithmFPType(N - 1) : algorithmFPType(0);
+        for (uint32_t j = 0; j < nComponents; ++j)
+        {
+            sigmaArray[j] = sigmaArray[j] * sigmaArray[j] * factor;
+        }
+
+        BlockDescriptor<algorithmFPType> eigenvaluesBlock;
+        DAAL_CHECK_STATUS(st, eigenvalues.getBlockOfRows(0, 1, writeOnly, eigenvaluesBlock));
+        context.copy(eigenvaluesBlock.getBuffer(), 0, (void *)sigmaArray.get(), 0, nComponents, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK_STATUS(st, eigenvalues.releaseBlockOfRows(eigenvaluesBlock));
+    }
+
+    if (isDeterministic)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.signFlipEigenvectors);
+        DAAL_CHECK_STATUS(st, _host_impl->signFlipEigenvectors(eigenvectors));
+    }
+
+    return st;
+}
+
+template <typename algorithmFPType>
+Status PCARandomizedKernelBatchUCAPI<algorithmFPType>::multiply(const services::internal::Buffer<algorithmFPType> & data, uint32_t nObservations,
+                                                                uint32_t nFeatures, const algorithmFPType * means, const algorithmFPType * invSigmas,
+                                                                uint32_t l, const algorithmFPType * w,
+                                                                const services::internal::Buffer<algorithmFPType> & ones,
+                                                                services::internal::Buffer<algorithmFPType> & yt)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.multiply);
+    Status st;
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+
+    /* As * w = A * (diag(invSigmas) * w) - 1 * (means' * diag(invSigmas) * w) */
+    services::internal::TArray<algorithmFPType, sse2> wsArray(size_t(nFeatures) * l);
+    services::internal::TArray<algorithmFPType, sse2> cArray(l);
+    DAAL_CHECK_MALLOC(wsArray.get() && cArray.get());
+    algorithmFPType * ws = wsArray.get();
+    for (uint32_t j = 0; j < l; ++j)
+    {
+        algorithmFPType sum = 0;
+        for (uint32_t i = 0; i < nFeatures; ++i)
+        {
+            ws[j * nFeatures + i] = w[j * nFeatures + i] * invSigmas[i];
+            sum += means[i] * ws[j * nFeatures + i];
+        }
+        cArray[j] = sum;
+    }
+
+    auto wsBuff = context.allocate(TypeIds::id<algorithmFPType>(), size_t(nFeatures) * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto cBuff = context.allocate(TypeIds::id<algorithmFPType>(), l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    context.copy(wsBuff, 0, (void *)ws, 0, size_t(nFeatures) * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    context.copy(cBuff, 0, (void *)cArray.get(), 0, l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    /* The row-major data is the column-major p x n matrix */
+    DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::ColMajor, math::Transpose::Trans, math::Transpose::NoTrans, l, nObservations,
+                                                          nFeatures, algorithmFPType(1), wsBuff, nFeatures, 0, data, nFeatures, 0,
+                                                          algorithmFPType(0), yt, l, 0));
+    return BlasGpu<algorithmFPType>::xgemm(math::Layout::ColMajor, math::Transpose::NoTrans, math::Transpose::NoTrans, l, nObservations, 1,
+                                           algorithmFPType(-1), cBuff, l, 0, ones, 1, 0, algorithmFPType(1), yt, l, 0);
+}
+
+template <typename algorithmFPType>
+Status PCARandomizedKernelBatchUCAPI<algorithmFPType>::orthonormalize(uint32_t nObservations, uint32_t l,
+                                                                      services::internal::Buffer<algorithmFPType> & yt,
+                                                                      services::internal::Buffer<algorithmFPType> & qt)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.orthonormalize);
+    Status st;
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+
+    const size_t size = size_t(nObservations) * l;
+
+    /* The small data has less rows than the subspace columns, it is done on the host */
+    if (nObservations < l)
+    {
+        services::internal::TArray<algorithmFPType, sse2> yArray(size);
+        DAAL_CHECK_MALLOC(yArray.get());
+        {
+            auto ytHost = yt.toHost(readOnly, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            for (uint32_t i = 0; i < nObservations; ++i)
+            {
+                for (uint32_t j = 0; j < l; ++j)
+                {
+                    yArray[j * nObservations + i] = ytHost.get()[i * l + j];
+                }
+            }
+        }
+        DAAL_CHECK_STATUS(st, _host_impl->orthonormalize(nObservations, l, yArray.get()));
+
+        auto qtHost = qt.toHost(writeOnly, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        for (uint32_t i = 0; i < nObservations; ++i)
+        {
+            for (uint32_t j = 0; j < l; ++j)
+            {
+                qtHost.get()[i * l + j] = yArray[j * nObservations + i];
+            }
+        }
+        return st;
+    }
+
+    /* y' = R * Q for the RQ decomposition, the rows of Q of the last l rows of
+       the orthogonal n x n matrix span the rows of y'. They are formed as
+       [0 I] * Q of the identity in the last l columns. */
+    auto tauBuff = context.allocate(TypeIds::id<algorithmFPType>(), l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS(st, LapackGpu<algorithmFPType>::xgerqf(l, nObservations, yt, l, tauBuff));
+
+    services::internal::TArray<algorithmFPType, sse2> identityArray(size_t(l) * l);
+    DAAL_CHECK_MALLOC(identityArray.get());
+    for (uint32_t i = 0; i < l; ++i)
+    {
+        for (uint32_t j = 0; j < l; ++j)
+        {
+            identityArray[i * l + j] = (i == j) ? algorithmFPType(1) : algorithmFPType(0);
+        }
+    }
+    context.fill(qt, 0.0, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    context.copy(qt, size - size_t(l) * l, (void *)identityArray.get(), 0, size_t(l) * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    return LapackGpu<algorithmFPType>::xormrq(math::Side::Right, math::Transpose::NoTrans, l, nObservations, l, yt, l, tauBuff, qt, l);
+}
+
+template <typename algorithmFPType>
+Status PCARandomizedKernelBatchUCAPI<algorithmFPType>::multiplyTransposed(const services::internal::Buffer<algorithmFPType> & data,
+                                                                          uint32_t nObservations, uint32_t nFeatures, const algorithmFPType * means,
+                                                                          const algorithmFPType * invSigmas, uint32_t l,
+                                                                          const services::internal::Buffer<algorithmFPType> & qt,
+                                                                          const services::internal::Buffer<algorithmFPType> & ones,
+                                                                          algorithmFPType * z)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.multiplyTransposed);
+    Status st;
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+
+    /* As' * q = diag(invSigmas) * (A' * q - means * (1' * q)) */
+    auto zBuff = context.allocate(TypeIds::id<algorithmFPType>(), size_t(nFeatures) * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto sBuff = context.allocate(TypeIds::id<algorithmFPType>(), l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::ColMajor, math::Transpose::NoTrans, math::Transpose::Trans, nFeatures, l,
+                                                          nObservations, algorithmFPType(1), data, nFeatures, 0, qt, l, 0, algorithmFPType(0), zBuff,
+                                                          nFeatures, 0));
+    DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::ColMajor, math::Transpose::NoTrans, math::Transpose::NoTrans, l, 1,
+                                                          nObservations, algorithmFPType(1), qt, l, 0, ones, nObservations, 0, algorithmFPType(0),
+                                                          sBuff, l, 0));
+
+    auto zHost = zBuff.template get<algorithmFPType>().toHost(readOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto sHost = sBuff.template get<algorithmFPType>().toHost(readOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    const algorithmFPType * product = zHost.get();
+    const algorithmFPType * sums    = sHost.get();
+    for (uint32_t j = 0; j < l; ++j)
+    {
+        for (uint32_t i = 0; i < nFeatures; ++i)
+        {
+            z[j * nFeatures + i] = (product[j * nFeatures + i] - means[i] * sums[j]) * invSigmas[i];
+        }
+    }
+    return st;
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
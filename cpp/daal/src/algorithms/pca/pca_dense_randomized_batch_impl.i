@@ -0,0 +1,207 @@
+/* file: pca_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of PCA with the randomized SVD.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+
+#include "src/algorithms/pca/pca_dense_randomized_batch_kernel.h"
+#include "src/algorithms/svd/svd_dense_randomized_impl.i"
+#include "src/externals/service_math.h"
+#include "src/services/service_arrays.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/threading/threading.h"
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(pca.dense.randomized.batch);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<algorithmFPType, cpu>::compute(bool isDeterministic, const data_management::NumericTable & dataTable,
+                                                                    const svd::internal::RandomizedParameter & par, NumericTable & eigenvectors,
+                                                                    NumericTable & eigenvalues, NumericTable & means, NumericTable & variances)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    services::Status status;
+
+    const size_t nObservations = dataTable.getNumberOfRows();
+    const size_t nFeatures     = dataTable.getNumberOfColumns();
+    const size_t nComponents   = par.nComponents;
+
+    TArray<algorithmFPType, cpu> meansArray(nFeatures);
+    TArray<algorithmFPType, cpu> variancesArray(nFeatures);
+    TArray<algorithmFPType, cpu> invSigmasArray(nFeatures);
+    TArray<algorithmFPType, cpu> sigmaArray(nComponents);
+    DAAL_CHECK_MALLOC(meansArray.get() && variancesArray.get() && invSigmasArray.get() && sigmaArray.get());
+    algorithmFPType * invSigmas = invSigmasArray.get();
+
+    DAAL_CHECK_STATUS(status, computeMeansAndVariances(dataTable, meansArray.get(), variancesArray.get()));
+
+    /* The constant features do not contribute to the correlation matrix */
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        invSigmas[j] = (variancesArray[j] > 0) ? algorithmFPType(1) / Math<algorithmFPType, cpu>::sSqrt(variancesArray[j]) : algorithmFPType(0);
+    }
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> eigenvectorsBlock(eigenvectors, 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(eigenvectorsBlock);
+        DAAL_CHECK_STATUS(status, _svdKernel.compute(dataTable, meansArray.get(), invSigmas, par, sigmaArray.get(), eigenvectorsBlock.get()));
+    }
+
+    /* The eigenvalues of the correlation matrix are sigma^2 / (n - 1) */
+    {
+        WriteOnlyRows<algorithmFPType, cpu> eigenvaluesBlock(eigenvalues, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(eigenvaluesBlock);
+        algorithmFPType * eigenvaluesData = eigenvaluesBlock.get();
+        const algorithmFPType factor      = (nObservations > 1) ? algorithmFPType(1) / algorithmFPType(nObservations - 1) : algorithmFPType(0);
+        for (size_t j = 0; j < nComponents; ++j)
+        {
+            eigenvaluesData[j] = sigmaArray[j] * sigmaArray[j] * factor;
+        }
+    }
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> meansBlock(means, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(meansBlock);
+        WriteOnlyRows<algorithmFPType, cpu> variancesBlock(variances, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(variancesBlock);
+        algorithmFPType * meansData     = meansBlock.get();
+        algorithmFPType * variancesData = variancesBlock.get();
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            meansData[j]     = meansArray[j];
+            variancesData[j] = variancesArray[j];
+        }
+    }
+
+    if (isDeterministic)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.signFlipEigenvectors);
+        DAAL_CHECK_STATUS(status, signFlipEigenvectors(eigenvectors));
+    }
+    return status;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<algorithmFPType, cpu>::computeMeansAndVariances(const data_management::NumericTable & dataTable,
+                                                                                     algorithmFPType * means, algorithmFPType * variances) const
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.meansAndVariances);
+
+    const size_t nObservations = dataTable.getNumberOfRows();
+    const size_t nFeatures     = dataTable.getNumberOfColumns();
+
+    const size_t blockSize = 512;
+    const size_t nBlocks   = nObservations / blockSize + !!(nObservations % blockSize);
+
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        means[j]     = 0;
+        variances[j] = 0;
+    }
+
+    /* Two passes over the data: the sums of the values and then the sums of
+       the squared deviations from the means */
+    for (size_t pass = 0; pass < 2; ++pass)
+    {
+        TlsSum<algorithmFPType, cpu> tlsSums(nFeatures);
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            algorithmFPType * sums = tlsSums.local();
+            DAAL_CHECK_THR(sums, services::ErrorMemoryAllocationFailed);
+
+            const size_t startRow = iBlock * blockSize;
+            const size_t nRows    = (startRow + blockSize > nObservations) ? nObservations - startRow : blockSize;
+
+            ReadRows<algorithmFPType, cpu> dataBlock(const_cast<NumericTable &>(dataTable), startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+            const algorithmFPType * data = dataBlock.get();
+
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; ++j)
+                {
+                    const algorithmFPType value = (pass == 0) ? data[i * nFeatures + j] : data[i * nFeatures + j] - means[j];
+                    sums[j] += (pass == 0) ? value : value * value;
+                }
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        algorithmFPType * result = (pass == 0) ? means : variances;
+        tlsSums.reduceTo(result, nFeatures);
+
+        const size_t divisor         = (pass == 0) ? nObservations : nObservations - 1;
+        const algorithmFPType factor = (divisor > 0) ? algorithmFPType(1) / algorithmFPType(divisor) : algorithmFPType(0);
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            result[j] *= factor;
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<algorithmFPType, cpu>::generateTestMatrix(size_t p, size_t l, size_t seed, algorithmFPType * omega) const
+{
+    return _svdKernel.generateTestMatrix(p, l, seed, omega);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<algorithmFPType, cpu>::orthonormalize(size_t m, size_t l, algorithmFPType * a) const
+{
+    return _svdKernel.orthonormalize(m, l, a);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<algorithmFPType, cpu>::computeSingularVectors(size_t p, size_t l, algorithmFPType * z, size_t nComponents,
+                                                                                   algorithmFPType * sigma, algorithmFPType * vectors) const
+{
+    return _svdKernel.computeSingularVectors(p, l, z, nComponents, sigma, vectors);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<algorithmFPType, cpu>::signFlipEigenvectors(NumericTable & eigenvectors) const
+{
+    return PCADenseBase<algorithmFPType, cpu>::signFlipEigenvectors(eigenvectors);
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,76 @@
+/* file: pca_dense_randomized_batch_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Declaration of template structs that calculate PCA with the randomized SVD.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_KERNEL_H__
+#define __PCA_DENSE_RANDOMIZED_BATCH_KERNEL_H__
+
+#include "algorithms/pca/pca_types.h"
+#include "src/algorithms/pca/pca_dense_base.h"
+#include "src/algorithms/svd/svd_dense_randomized_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+template <typename algorithmFPType>
+class PCARandomizedBaseIface : public svd::internal::RandomizedSVDBaseIface<algorithmFPType>
+{
+public:
+    virtual services::Status signFlipEigenvectors(NumericTable & eigenvectors) const = 0;
+};
+
+/**
+ * Computes the principal components of the correlation matrix as the right
+ * singular vectors of the standardized data found with the randomized SVD,
+ * the data are standardized on the fly
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedKernel : public PCARandomizedBaseIface<algorithmFPType>, public PCADenseBase<algorithmFPType, cpu>
+{
+public:
+    services::Status compute(bool isDeterministic, const data_management::NumericTable & dataTable, const svd::internal::RandomizedParameter & par,
+                             data_management::NumericTable & eigenvectors, data_management::NumericTable & eigenvalues,
+                             data_management::NumericTable & means, data_management::NumericTable & variances);
+
+    services::Status generateTestMatrix(size_t p, size_t l, size_t seed, algorithmFPType * omega) const DAAL_C11_OVERRIDE;
+    services::Status orthonormalize(size_t m, size_t l, algorithmFPType * a) const DAAL_C11_OVERRIDE;
+    services::Status computeSingularVectors(size_t p, size_t l, algorithmFPType * z, size_t nComponents, algorithmFPType * sigma,
+                                            algorithmFPType * vectors) const DAAL_C11_OVERRIDE;
+    services::Status signFlipEigenvectors(NumericTable & eigenvectors) const DAAL_C11_OVERRIDE;
+
+private:
+    services::Status computeMeansAndVariances(const data_management::NumericTable & dataTable, algorithmFPType * means,
+                                              algorithmFPType * variances) const;
+
+    svd::internal::RandomizedSVDKernel<algorithmFPType, cpu> _svdKernel;
+};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
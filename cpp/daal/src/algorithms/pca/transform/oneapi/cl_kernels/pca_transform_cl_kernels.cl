@@ -31,50 +31,8 @@
 DECLARE_SOURCE(
     pca_transform_cl_kernels,
 
-    __kernel void computeInvSigmas(__global const algorithmFPType * rawVariances, __global algorithmFPType * invSigmas) {
-        const int tid                 = get_global_id(0);
-        const algorithmFPType epsilon = 1e-10;
-
-        /*Case when rawVariances[tid] < 0 is handled inside compute method*/
-        if (rawVariances[tid] > epsilon)
-        {
-            invSigmas[tid] = (algorithmFPType)1 / (algorithmFPType)sqrt(rawVariances[tid]);
-        }
-        else
-        {
-            invSigmas[tid] = (algorithmFPType)0;
-        }
-    }
-
-    __kernel void normalize(__global algorithmFPType * copyBlock, __global const algorithmFPType * rawMeans,
-                            __global const algorithmFPType * invSigmas, const char hasMeans, const char hasInvSigmas, const uint maxWorkItemsPerGroup,
-                            const uint numFeatures) {
-        const int glid                 = get_global_id(0);
-        const int numWorkItemsPerGroup = get_local_size(0);
-        const int numVec               = get_num_groups(0);
-
-        uint numOfDataItemsProcessedByWI = numFeatures / maxWorkItemsPerGroup;
-
-        for (uint i = 0; i < numOfDataItemsProcessedByWI + 1; i++)
-        {
-            const int dataId  = glid + numVec * numWorkItemsPerGroup * i;
-            const int meansId = dataId % numFeatures;
-            if (dataId < numFeatures * numVec)
-            {
-                if (hasMeans)
-                {
-                    copyBlock[dataId] = copyBlock[dataId] - rawMeans[meansId];
-                }
-                if (hasInvSigmas)
-                {
-                    copyBlock[dataId] = copyBlock[dataId] * invSigmas[meansId];
-                }
-            }
-        }
-    }
-
-    __kernel void whitening(__global algorithmFPType * transformedBlock, __global const algorithmFPType * invEigenValues,
-                            const uint maxWorkItemsPerGroup, const uint numComponents) {
+    __kernel void initByBias(__global algorithmFPType * transformedBlock, __global const algorithmFPType * bias, const uint maxWorkItemsPerGroup,
+                             const uint numComponents) {
         const int glid                 = get_global_id(0);
         const int numWorkItemsPerGroup = get_local_size(0);
         const int numVec               = get_num_groups(0);
@@ -82,11 +40,11 @@ DECLARE_SOURCE(
         uint numOfDataItemsProcessedByWI = numComponents / maxWorkItemsPerGroup;
         for (uint i = 0; i < numOfDataItemsProcessedByWI + 1; i++)
         {
-            const int dataId   = glid + numVec * numWorkItemsPerGroup * i;
-            const int eigValId = dataId % numComponents;
+            const int dataId      = glid + numVec * numWorkItemsPerGroup * i;
+            const int componentId = dataId % numComponents;
             if (dataId < numComponents * numVec)
             {
-                transformedBlock[dataId] = transformedBlock[dataId] * invEigenValues[eigValId];
+                transformedBlock[dataId] = bias[componentId];
             }
         }
     }
@@ -25,6 +25,8 @@
 #define __PCA_TRANSFORM_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
 
 #include "src/externals/service_ittnotify.h"
+#include "src/externals/service_math.h"
+#include "src/services/service_arrays.h"
 DAAL_ITTNOTIFY_DOMAIN(pca.transform.batch.oneapi);
 
 #include "src/algorithms/pca/transform/oneapi/cl_kernels/pca_transform_cl_kernels.cl"
@@ -49,96 +51,133 @@ using namespace daal::services::internal::sycl;
 
 template <typename algorithmFPType, transform::Method method>
 void TransformKernelOneAPI<algorithmFPType, method>::computeTransformedBlock(const uint32_t numRows, const uint32_t numFeatures,
-                                                                             const uint32_t numComponents, UniversalBuffer & dataBlock,
+                                                                             const uint32_t numComponents,
+                                                                             const services::internal::Buffer<algorithmFPType> & dataBlock,
                                                                              const services::internal::Buffer<algorithmFPType> & eigenvectors,
+                                                                             const algorithmFPType beta,
                                                                              const services::internal::Buffer<algorithmFPType> & resultBlock)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.gemm);
     BlasGpu<algorithmFPType>::xgemm(math::Layout::ColMajor, math::Transpose::Trans, math::Transpose::NoTrans, numComponents, numRows, numFeatures,
-                                    1.0, eigenvectors, numFeatures, 0, dataBlock, numFeatures, 0, 0.0, resultBlock, numComponents, 0);
+                                    1.0, eigenvectors, numFeatures, 0, dataBlock, numFeatures, 0, beta, resultBlock, numComponents, 0);
 }
 
 template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::computeInvSigmas(ExecutionContextIface & ctx, NumericTable * variances,
-                                                                                  const services::internal::Buffer<algorithmFPType> & invSigmas,
+services::Status TransformKernelOneAPI<algorithmFPType, method>::computeInvSigmas(NumericTable * variances, algorithmFPType * invSigmas,
                                                                                   const uint32_t numFeatures)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.computeInvSigmas);
     services::Status status;
 
-    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
-    buildKernel(ctx, factory);
-
-    const char * const computeInvSigmasKernel = "computeInvSigmas";
-    KernelPtr kernel                          = factory.getKernel(computeInvSigmasKernel);
+    const algorithmFPType epsilon = 1e-10;
     BlockDescriptor<algorithmFPType> varBlock;
-    variances->getBlockOfRows(0, numFeatures, readOnly, varBlock);
-
-    KernelArguments args(2);
-    args.set(0, varBlock.getBuffer(), AccessModeIds::read);
-    args.set(1, invSigmas, AccessModeIds::write);
-    KernelRange range(numFeatures);
-    ctx.run(range, kernel, args, &status);
-    variances->releaseBlockOfRows(varBlock);
+    DAAL_CHECK_STATUS(status, variances->getBlockOfRows(0, numFeatures, readOnly, varBlock));
+    const algorithmFPType * rawVariances = varBlock.getBlockPtr();
+    for (uint32_t i = 0; i < numFeatures; i++)
+    {
+        invSigmas[i] = (rawVariances[i] > epsilon) ? algorithmFPType(1) / daal::internal::Math<algorithmFPType, sse2>::sSqrt(rawVariances[i]) :
+                                                     algorithmFPType(0);
+    }
+    DAAL_CHECK_STATUS(status, variances->releaseBlockOfRows(varBlock));
     return status;
 }
 
 template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::normalize(ExecutionContextIface & ctx, UniversalBuffer & copyBlock,
-                                                                           UniversalBuffer & rawMeans, UniversalBuffer & invSigmas, bool hasMeans,
-                                                                           bool hasInvSigmas, const uint32_t numFeatures, const uint32_t numVectors)
+services::Status TransformKernelOneAPI<algorithmFPType, method>::foldNormalization(
+    ExecutionContextIface & ctx, NumericTable & eigenvectors, NumericTable * pMeans, NumericTable * pVariances, NumericTable * pEigenvalues,
+    const uint32_t numFeatures, const uint32_t numComponents, UniversalBuffer & foldedBasis, UniversalBuffer & bias)
 {
-    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.normalize);
+    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.foldNormalization);
     services::Status status;
 
-    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
-    buildKernel(ctx, factory);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, numFeatures, numComponents);
+    const size_t basisSize = size_t(numFeatures) * size_t(numComponents);
 
-    const char * const normalizeKernel = "normalize";
-    KernelPtr kernel                   = factory.getKernel(normalizeKernel);
+    services::internal::TArray<algorithmFPType, sse2> foldedArray(basisSize);
+    services::internal::TArray<algorithmFPType, sse2> invSigmasArray(pVariances ? numFeatures : 0);
+    services::internal::TArray<algorithmFPType, sse2> invEigenvaluesArray(pEigenvalues ? numComponents : 0);
+    algorithmFPType * folded         = foldedArray.get();
+    algorithmFPType * invSigmas      = invSigmasArray.get();
+    algorithmFPType * invEigenvalues = invEigenvaluesArray.get();
+    DAAL_CHECK_MALLOC(folded);
+    DAAL_CHECK_MALLOC(!pVariances || invSigmas);
+    DAAL_CHECK_MALLOC(!pEigenvalues || invEigenvalues);
 
-    const unsigned int workItemsPerGroup = (numFeatures > maxWorkItemsPerGroup) ? maxWorkItemsPerGroup : numFeatures;
-    KernelArguments args(7);
-    args.set(0, copyBlock, AccessModeIds::readwrite);
-    args.set(1, rawMeans, AccessModeIds::read);
-    args.set(2, invSigmas, AccessModeIds::read);
-    args.set(3, static_cast<unsigned char>(hasMeans));
-    args.set(4, static_cast<unsigned char>(hasInvSigmas));
-    args.set(5, maxWorkItemsPerGroup);
-    args.set(6, numFeatures);
+    if (pVariances)
+    {
+        DAAL_CHECK_STATUS(status, computeInvSigmas(pVariances, invSigmas, numFeatures));
+    }
+    if (pEigenvalues)
+    {
+        DAAL_CHECK_STATUS(status, computeInvSigmas(pEigenvalues, invEigenvalues, numComponents));
+    }
 
-    KernelRange local_range(workItemsPerGroup);
-    KernelRange global_range(workItemsPerGroup * numVectors);
-    KernelNDRange range(1);
-    range.global(global_range, &status);
+    BlockDescriptor<algorithmFPType> basisBlock;
+    DAAL_CHECK_STATUS(status, eigenvectors.getBlockOfRows(0, numComponents, readOnly, basisBlock));
+    const algorithmFPType * basis = basisBlock.getBlockPtr();
+    for (uint32_t i = 0; i < numComponents; i++)
+    {
+        const algorithmFPType scale = invEigenvalues ? invEigenvalues[i] : algorithmFPType(1);
+        for (uint32_t j = 0; j < numFeatures; j++)
+        {
+            folded[i * numFeatures + j] = basis[i * numFeatures + j] * scale * (invSigmas ? invSigmas[j] : algorithmFPType(1));
+        }
+    }
+    DAAL_CHECK_STATUS(status, eigenvectors.releaseBlockOfRows(basisBlock));
+
+    foldedBasis = ctx.allocate(TypeIds::id<algorithmFPType>(), basisSize, &status);
     DAAL_CHECK_STATUS_VAR(status);
-    range.local(local_range, &status);
+    ctx.copy(foldedBasis, 0, (void *)folded, 0, basisSize, &status);
     DAAL_CHECK_STATUS_VAR(status);
 
-    ctx.run(range, kernel, args, &status);
+    if (pMeans)
+    {
+        services::internal::TArray<algorithmFPType, sse2> biasArray(numComponents);
+        algorithmFPType * biasValues = biasArray.get();
+        DAAL_CHECK_MALLOC(biasValues);
+
+        BlockDescriptor<algorithmFPType> meansBlock;
+        DAAL_CHECK_STATUS(status, pMeans->getBlockOfRows(0, 1, readOnly, meansBlock));
+        const algorithmFPType * means = meansBlock.getBlockPtr();
+        for (uint32_t i = 0; i < numComponents; i++)
+        {
+            algorithmFPType sum = 0;
+            for (uint32_t j = 0; j < numFeatures; j++)
+            {
+                sum += means[j] * folded[i * numFeatures + j];
+            }
+            biasValues[i] = -sum;
+        }
+        DAAL_CHECK_STATUS(status, pMeans->releaseBlockOfRows(meansBlock));
+
+        bias = ctx.allocate(TypeIds::id<algorithmFPType>(), numComponents, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        ctx.copy(bias, 0, (void *)biasValues, 0, numComponents, &status);
+    }
 
     return status;
 }
 
 template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::whitening(ExecutionContextIface & ctx,
-                                                                           const services::internal::Buffer<algorithmFPType> & transformedBlock,
-                                                                           UniversalBuffer & invEigenvalues, const uint32_t numComponents,
-                                                                           const uint32_t numVectors)
+services::Status TransformKernelOneAPI<algorithmFPType, method>::initByBias(ExecutionContextIface & ctx,
+                                                                            const services::internal::Buffer<algorithmFPType> & transformedBlock,
+                                                                            UniversalBuffer & bias, const uint32_t numComponents,
+                                                                            const uint32_t numVectors)
 {
-    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.whitening);
+    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.initByBias);
     services::Status status;
 
     ClKernelFactoryIface & factory = ctx.getClKernelFactory();
-    buildKernel(ctx, factory);
+    DAAL_CHECK_STATUS(status, buildKernel(ctx, factory));
 
-    const char * const whiteningKernel = "whitening";
-    KernelPtr kernel                   = factory.getKernel(whiteningKernel);
+    const char * const initByBiasKernel = "initByBias";
+    KernelPtr kernel                    = factory.getKernel(initByBiasKernel, &status);
+    DAAL_CHECK_STATUS_VAR(status);
 
     const unsigned int workItemsPerGroup = (numComponents > maxWorkItemsPerGroup) ? maxWorkItemsPerGroup : numComponents;
     KernelArguments args(4);
-    args.set(0, transformedBlock, AccessModeIds::readwrite);
-    args.set(1, invEigenvalues, AccessModeIds::read);
+    args.set(0, transformedBlock, AccessModeIds::write);
+    args.set(1, bias, AccessModeIds::read);
     args.set(2, maxWorkItemsPerGroup);
     args.set(3, numComponents);
 
@@ -156,38 +195,6 @@ services::Status TransformKernelOneAPI<algorithmFPType, method>::whitening(Execu
     return status;
 }
 
-template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::allocateBuffer(ExecutionContextIface & ctx, UniversalBuffer & returnBuffer,
-                                                                                uint32_t bufferSize)
-{
-    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.allocateBuffer);
-    services::Status status;
-
-    const algorithmFPType zero = 0.0;
-    returnBuffer               = ctx.allocate(TypeIds::id<algorithmFPType>(), bufferSize, &status);
-    DAAL_CHECK_STATUS_VAR(status);
-    ctx.fill(returnBuffer, zero, &status);
-
-    return status;
-}
-
-template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::copyBuffer(ExecutionContextIface & ctx, UniversalBuffer & returnBuffer,
-                                                                            NumericTable & data, uint32_t nRows, uint32_t nCols)
-
-{
-    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.copyBuffer);
-    services::Status status;
-
-    BlockDescriptor<algorithmFPType> dataBlock;
-    DAAL_CHECK_STATUS(status, data.getBlockOfRows(0, nRows, ReadWriteMode::readOnly, dataBlock));
-
-    ctx.copy(returnBuffer, 0, dataBlock.getBuffer(), 0, nRows * nCols, &status);
-    data.releaseBlockOfRows(dataBlock);
-
-    return status;
-}
-
 template <typename algorithmFPType, transform::Method method>
 services::Status TransformKernelOneAPI<algorithmFPType, method>::checkVariances(NumericTable & pVariances, uint32_t numRows)
 {
@@ -220,27 +227,16 @@ services::Status TransformKernelOneAPI<algorithmFPType, method>::buildKernel(Exe
     const services::String options = getKeyFPType<algorithmFPType>();
     services::String cachekey("__daal_algorithms_pca_transform");
     cachekey.add(fptype_name);
-    factory.build(ExecutionTargetIds::device, cachekey.c_str(), pca_transform_cl_kernels, build_options.c_str());
-
-    return status;
-}
-
-template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::initBuffers(ExecutionContextIface & ctx, NumericTable & data,
-                                                                             const uint32_t numFeatures, const uint32_t numComponents,
-                                                                             const uint32_t numVectors)
-{
-    services::Status status;
-
-    DAAL_CHECK_STATUS(status, allocateBuffer(ctx, invSigmas, numFeatures));
-    DAAL_CHECK_STATUS(status, allocateBuffer(ctx, invEigenvalues, numComponents));
-    DAAL_CHECK_STATUS(status, allocateBuffer(ctx, rawMeans, numFeatures));
-    copyBlock = ctx.allocate(TypeIds::id<algorithmFPType>(), numVectors * numFeatures, &status);
-    copyBuffer(ctx, copyBlock, data, numVectors, numFeatures);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), pca_transform_cl_kernels, build_options.c_str(), &status);
 
     return status;
 }
 
+/*
+ *  The normalization and the whitening are folded into the basis and the bias of the transformation:
+ *      y = ((x - m) / s) V^T / sqrt(l) = x B + b,  B = diag(1 / s) V^T diag(1 / sqrt(l)),  b = -m B,
+ *  so the data is read once by GEMM with no normalized copy on the device
+ */
 template <typename algorithmFPType, transform::Method method>
 services::Status TransformKernelOneAPI<algorithmFPType, method>::compute(NumericTable & data, NumericTable & eigenvectors, NumericTable * pMeans,
                                                                          NumericTable * pVariances, NumericTable * pEigenvalues,
@@ -254,50 +250,33 @@ services::Status TransformKernelOneAPI<algorithmFPType, method>::compute(Numeric
     const uint32_t numFeatures   = data.getNumberOfColumns();
     const uint32_t numComponents = transformedData.getNumberOfColumns();
 
-    initBuffers(ctx, data, numFeatures, numComponents, numVectors);
-
-    bool hasInvSigmas = false;
     if (pVariances != nullptr)
     {
-        hasInvSigmas = true;
         DAAL_CHECK_STATUS(status, checkVariances(*pVariances, numFeatures));
-        DAAL_CHECK_STATUS(status, computeInvSigmas(ctx, pVariances, invSigmas.template get<algorithmFPType>(), numFeatures));
     }
 
-    if (pEigenvalues != nullptr)
-    {
-        DAAL_CHECK_STATUS(status, computeInvSigmas(ctx, pEigenvalues, invEigenvalues.template get<algorithmFPType>(), numComponents));
-    }
-
-    bool hasMeans = false;
-    if (pMeans != nullptr)
-    {
-        hasMeans = true;
-        DAAL_CHECK_STATUS(status, copyBuffer(ctx, rawMeans, *pMeans, numFeatures, 1));
-    }
-
-    bool isWhitening = pEigenvalues != nullptr;
-    bool isNormalize = pMeans != nullptr || pVariances != nullptr;
-
-    if (isNormalize)
-    {
-        DAAL_CHECK_STATUS(status, normalize(ctx, copyBlock, rawMeans, invSigmas, hasMeans, hasInvSigmas, numFeatures, numVectors));
-    }
+    UniversalBuffer foldedBasis;
+    UniversalBuffer bias;
+    DAAL_CHECK_STATUS(status,
+                      foldNormalization(ctx, eigenvectors, pMeans, pVariances, pEigenvalues, numFeatures, numComponents, foldedBasis, bias));
 
     BlockDescriptor<algorithmFPType> transformedBlock;
-    DAAL_CHECK_STATUS(status, transformedData.getBlockOfRows(0, transformedData.getNumberOfRows(), ReadWriteMode::readWrite, transformedBlock));
-
-    BlockDescriptor<algorithmFPType> basis;
-    DAAL_CHECK_STATUS(status, eigenvectors.getBlockOfRows(0, numComponents, ReadWriteMode::readOnly, basis));
+    DAAL_CHECK_STATUS(status, transformedData.getBlockOfRows(0, numVectors, ReadWriteMode::writeOnly, transformedBlock));
 
-    computeTransformedBlock(numVectors, numFeatures, numComponents, copyBlock, basis.getBuffer(), transformedBlock.getBuffer());
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS(status, data.getBlockOfRows(0, numVectors, ReadWriteMode::readOnly, dataBlock));
 
-    if (isWhitening)
+    /* the centering is the bias the GEMM adds to the projections */
+    const bool hasBias = pMeans != nullptr;
+    if (hasBias)
     {
-        DAAL_CHECK_STATUS(status, whitening(ctx, transformedBlock.getBuffer(), invEigenvalues, numComponents, numVectors));
+        DAAL_CHECK_STATUS(status, initByBias(ctx, transformedBlock.getBuffer(), bias, numComponents, numVectors));
     }
-    transformedData.releaseBlockOfRows(transformedBlock);
-    eigenvectors.releaseBlockOfRows(basis);
+    computeTransformedBlock(numVectors, numFeatures, numComponents, dataBlock.getBuffer(), foldedBasis.template get<algorithmFPType>(),
+                            hasBias ? algorithmFPType(1) : algorithmFPType(0), transformedBlock.getBuffer());
+
+    DAAL_CHECK_STATUS(status, data.releaseBlockOfRows(dataBlock));
+    DAAL_CHECK_STATUS(status, transformedData.releaseBlockOfRows(transformedBlock));
 
     return status;
 }
@@ -51,16 +51,15 @@ using namespace daal::services;
 template <typename algorithmFPType, transform::Method method, CpuType cpu>
 void TransformKernel<algorithmFPType, method, cpu>::computeTransformedBlock(DAAL_INT * numRows, DAAL_INT * numFeatures, DAAL_INT * numComponents,
                                                                             const algorithmFPType * dataBlock, const algorithmFPType * eigenvectors,
-                                                                            algorithmFPType * resultBlock)
+                                                                            algorithmFPType beta, algorithmFPType * resultBlock)
 {
     /* GEMM parameters */
-    char trans           = 'T';
-    char notrans         = 'N';
-    algorithmFPType one  = 1.0;
-    algorithmFPType zero = 0.0;
+    char trans          = 'T';
+    char notrans        = 'N';
+    algorithmFPType one = 1.0;
 
     Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, numComponents, numRows, numFeatures, &one, eigenvectors, numFeatures, dataBlock, numFeatures,
-                                       &zero, resultBlock, numComponents);
+                                       &beta, resultBlock, numComponents);
 
 } /* void TransformKernel<algorithmFPType, defaultDense, cpu>::computeTransformedBlock */
 
@@ -90,6 +89,52 @@ services::Status ComputeInvSigmas(NumericTable * pVariances, TArray<algorithmFPT
     return status;
 }
 
+/*
+ *  Folds the normalization and the whitening into the basis and the bias of the transformation:
+ *      y = ((x - m) / s) V^T / sqrt(l) = x B + b,  B = diag(1 / s) V^T diag(1 / sqrt(l)),  b = -m B,
+ *  so the blocks of the data are read once by GEMM with no normalized copy
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status FoldNormalization(const algorithmFPType * pBasis, const algorithmFPType * pRawMeans, const algorithmFPType * pInvSigmas,
+                                   const algorithmFPType * pInvEigenvalues, size_t numFeatures, size_t numComponents,
+                                   TArray<algorithmFPType, cpu> & foldedBasis, TArray<algorithmFPType, cpu> & bias)
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, numFeatures, numComponents);
+    algorithmFPType * pFoldedBasis = foldedBasis.reset(numFeatures * numComponents);
+    DAAL_CHECK_MALLOC(pFoldedBasis);
+
+    for (size_t componentId = 0; componentId < numComponents; ++componentId)
+    {
+        const algorithmFPType scale     = pInvEigenvalues ? pInvEigenvalues[componentId] : algorithmFPType(1.0);
+        const algorithmFPType * pVector = pBasis + componentId * numFeatures;
+        algorithmFPType * pFolded       = pFoldedBasis + componentId * numFeatures;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t featureId = 0; featureId < numFeatures; ++featureId)
+        {
+            pFolded[featureId] = pVector[featureId] * scale * (pInvSigmas ? pInvSigmas[featureId] : algorithmFPType(1.0));
+        }
+    }
+
+    if (pRawMeans)
+    {
+        algorithmFPType * pBias = bias.reset(numComponents);
+        DAAL_CHECK_MALLOC(pBias);
+        for (size_t componentId = 0; componentId < numComponents; ++componentId)
+        {
+            const algorithmFPType * pFolded = pFoldedBasis + componentId * numFeatures;
+            algorithmFPType sum             = 0;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t featureId = 0; featureId < numFeatures; ++featureId)
+            {
+                sum += pRawMeans[featureId] * pFolded[featureId];
+            }
+            pBias[componentId] = -sum;
+        }
+    }
+    return services::Status();
+}
+
 template <typename algorithmFPType, transform::Method method, CpuType cpu>
 services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericTable & data, NumericTable & eigenvectors, NumericTable * pMeans,
                                                                         NumericTable * pVariances, NumericTable * pEigenvalues,
@@ -125,40 +170,29 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
     TArray<algorithmFPType, cpu> invEigenvalues(0);
     DAAL_CHECK_STATUS(status, ComputeInvSigmas(pEigenvalues, invEigenvalues, numComponents));
 
-    const algorithmFPType * pInvSigmas      = invSigmas.get();
-    const algorithmFPType * pInvEigenvalues = invEigenvalues.get();
-
-    size_t numInvSigmas = invSigmas.size();
-    size_t numMeans     = 0;
-
     const algorithmFPType * pRawMeans = nullptr;
     ReadRows<algorithmFPType, cpu> meansRows;
     if (pMeans != nullptr)
     {
-        numMeans = numFeatures;
         meansRows.set(*pMeans, 0, numFeatures);
         DAAL_CHECK_BLOCK_STATUS(meansRows);
         pRawMeans = meansRows.get();
     }
 
-    bool isWhitening = pEigenvalues != nullptr;
-    bool isNormalize = pMeans != nullptr || pVariances != nullptr;
-
-    UniquePtr<daal::tls<algorithmFPType *>, cpu> tls;
-    if (isNormalize)
+    TArray<algorithmFPType, cpu> foldedBasis(0);
+    TArray<algorithmFPType, cpu> bias(0);
+    if (pMeans != nullptr || pVariances != nullptr || pEigenvalues != nullptr)
     {
-        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, numRowsInBlock * numFeatures * sizeof(algorithmFPType), sizeof(algorithmFPType));
-        tls.reset(new daal::tls<algorithmFPType *>([=]() {
-            return (algorithmFPType *)daal::services::internal::service_malloc<algorithmFPType, cpu>(numRowsInBlock * numFeatures
-                                                                                                     * sizeof(algorithmFPType));
-        }));
-        DAAL_CHECK_MALLOC(tls.get());
+        DAAL_CHECK_STATUS(status, (FoldNormalization<algorithmFPType, cpu>(pBasis, pRawMeans, invSigmas.get(), invEigenvalues.get(), numFeatures,
+                                                                         numComponents, foldedBasis, bias)));
+        pBasis = foldedBasis.get();
     }
+    const algorithmFPType * pBias = bias.get();
 
     SafeStatus safeStat;
 
     /* Loop over input data blocks */
-    daal::threader_for(numBlocks, numBlocks, [=, &tls, &transformedData, &data, &safeStat](int iBlock) {
+    daal::threader_for(numBlocks, numBlocks, [=, &transformedData, &data, &safeStat](int iBlock) {
         size_t startRow = iBlock * numRowsInBlock;
         size_t endRow   = startRow + numRowsInBlock;
         if (endRow > numVectors)
@@ -169,7 +203,7 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
         DAAL_INT numRows     = endRow - startRow;
         DAAL_INT numFeatures = data.getNumberOfColumns();
 
-        WriteRows<algorithmFPType, cpu> blockRows(transformedData, startRow, numRows);
+        WriteOnlyRows<algorithmFPType, cpu> blockRows(transformedData, startRow, numRows);
         DAAL_CHECK_BLOCK_STATUS_THR(blockRows);
         algorithmFPType * pTransformedBlock = blockRows.get();
 
@@ -177,33 +211,8 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
         DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
         const algorithmFPType * pDataBlock = dataRows.get();
 
-        if (isNormalize)
-        {
-            algorithmFPType * pCopyBlock       = tls->local();
-            const algorithmFPType * pNormBlock = numMeans ? pCopyBlock : pDataBlock;
-            DAAL_CHECK_MALLOC_THR(pCopyBlock);
-            for (size_t rowId = 0; rowId < numRows; ++rowId)
-            {
-                /* compute centering if numMeans != 0 */
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t colId = 0; colId < numMeans; ++colId)
-                {
-                    pCopyBlock[rowId * numMeans + colId] = pDataBlock[rowId * numMeans + colId] - pRawMeans[colId];
-                }
-                /* compute normalization to unit variance if numInvSigmas!= 0 */
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t colId = 0; colId < numInvSigmas; ++colId)
-                {
-                    pCopyBlock[rowId * numInvSigmas + colId] = pNormBlock[rowId * numInvSigmas + colId] * pInvSigmas[colId];
-                }
-            }
-            pDataBlock = pCopyBlock;
-        }
-        computeTransformedBlock(&numRows, &numFeatures, (DAAL_INT *)&numComponents, pDataBlock, pBasis, pTransformedBlock);
-        /* compute whitening to unit variance of transformed data if required */
-        if (isWhitening)
+        /* the centering is the bias the GEMM adds to the projections */
+        if (pBias)
         {
             for (size_t rowId = 0; rowId < numRows; ++rowId)
             {
@@ -211,17 +220,14 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
                 PRAGMA_VECTOR_ALWAYS
                 for (size_t colId = 0; colId < numComponents; ++colId)
                 {
-                    pTransformedBlock[rowId * numComponents + colId] = pTransformedBlock[rowId * numComponents + colId] * pInvEigenvalues[colId];
+                    pTransformedBlock[rowId * numComponents + colId] = pBias[colId];
                 }
             }
         }
+        const algorithmFPType beta = pBias ? algorithmFPType(1.0) : algorithmFPType(0.0);
+        computeTransformedBlock(&numRows, &numFeatures, (DAAL_INT *)&numComponents, pDataBlock, pBasis, beta, pTransformedBlock);
     }); /* daal::threader_for */
 
-    if (isNormalize)
-    {
-        tls->reduce([&](algorithmFPType * pCopyBlock) { daal_free(pCopyBlock); });
-    }
-
     return safeStat.detach();
 } /* void TransformKernel<algorithmFPType, defaultDense, cpu>::compute */
 
@@ -68,10 +68,11 @@ public:
     *  \param numComponents[in]    Number of components
     *  \param dataBlock[in]        Block of input data rows
     *  \param eigenvectors[in]     Eigenvectors
-    *  \param resultBlock[out]     Resulting block of responses
+    *  \param beta[in]             Multiplier of the initial values of the resulting block
+    *  \param resultBlock[in,out]  Resulting block of responses
     */
     void computeTransformedBlock(DAAL_INT * numRows, DAAL_INT * numFeatures, DAAL_INT * numComponents, const algorithmFPType * dataBlock,
-                                 const algorithmFPType * eigenvectors, algorithmFPType * resultBlock);
+                                 const algorithmFPType * eigenvectors, algorithmFPType beta, algorithmFPType * resultBlock);
 
     static const size_t _numRowsInBlock = 256;
 };
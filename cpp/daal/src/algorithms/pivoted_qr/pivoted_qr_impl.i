@@ -28,7 +28,11 @@
 #include "src/externals/service_memory.h"
 #include "src/externals/service_math.h"
 #include "src/services/service_defines.h"
+#include "src/externals/service_blas.h"
 #include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/qr/qr_dense_default_kernel.h"
+#include "src/threading/threading.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -104,6 +108,89 @@ ServiceStatus compute_pivoted_QR_on_one_node(const DAAL_INT m, const DAAL_INT n,
     return SERV_ERR_OK;
 }
 
+/*
+    assumed m >= 2 * n
+    Tall-skinny pivoted QR: the QR of TSQR gives A = Q1 * R1, then the pivots are selected by the pivoted QR of the small
+    R1 * P = Q2 * R, so A * P = (Q1 * Q2) * R. The pivots of R1 are the ones of A as R1'R1 = A'A, so the column norms
+    downdated by xgeqp3 are the same, while the passes over the m rows of A are the blocked and parallel ones of TSQR
+    and of the product Q1 * Q2.
+  Output:
+    QTable       : Q (m x n)
+    r            : r[n][n] -> R (n x n) as the one of compute_pivoted_QR_on_one_node
+*/
+template <typename algorithmFPType, CpuType cpu>
+services::Status compute_pivoted_QR_tall_skinny(const NumericTable & dataTable, NumericTable & QTable, algorithmFPType * r, DAAL_INT * jpvt)
+{
+    const size_t n = dataTable.getNumberOfColumns();
+    const size_t m = dataTable.getNumberOfRows();
+
+    Status st;
+    NumericTablePtr R1Table = HomogenNumericTableCPU<algorithmFPType, cpu>::create(n, n, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    {
+        const NumericTable * a[] = { &dataTable };
+        NumericTable * qr[]      = { &QTable, R1Table.get() };
+        st = qr::internal::QRBatchKernel<algorithmFPType, qr::defaultDense, cpu>().compute(1, a, 2, qr);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    /* Q2 is computed in place of R1 stored by columns */
+    TArray<algorithmFPType, cpu> Q2Ptr(n * n);
+    algorithmFPType * Q2 = Q2Ptr.get();
+    DAAL_CHECK_MALLOC(Q2);
+    {
+        ReadRows<algorithmFPType, cpu> blockR1(R1Table.get(), 0, n);
+        DAAL_CHECK_BLOCK_STATUS(blockR1);
+        const algorithmFPType * R1 = blockR1.get();
+        for (size_t i = 0; i < n; i++)
+        {
+            for (size_t j = 0; j < n; j++)
+            {
+                Q2[j * n + i] = R1[i * n + j];
+            }
+        }
+    }
+
+    const ServiceStatus status = compute_pivoted_QR_on_one_node<algorithmFPType, cpu>(n, n, Q2, n, r, n, jpvt);
+    if (status != SERV_ERR_OK)
+    {
+        return status == SERV_ERR_MALLOC ? Status(ErrorMemoryAllocationFailed) : Status(ErrorPivotedQRInternal);
+    }
+
+    /* Q = Q1 * Q2 by the blocks of rows, the block of Q1 stored by rows is the one of Q1' stored by columns */
+    const size_t blockSize = 256;
+    const size_t nBlocks   = m / blockSize + !!(m % blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (startRow + blockSize > m) ? m - startRow : blockSize;
+
+        WriteRows<algorithmFPType, cpu> blockQ(QTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(blockQ);
+        algorithmFPType * Q = blockQ.get();
+
+        TArrayScalable<algorithmFPType, cpu> Q1Ptr(nRows * n);
+        algorithmFPType * Q1 = Q1Ptr.get();
+        DAAL_CHECK_THR(Q1, ErrorMemoryAllocationFailed);
+        for (size_t i = 0; i < nRows * n; i++)
+        {
+            Q1[i] = Q[i];
+        }
+
+        const char transa          = 'T';
+        const char transb          = 'N';
+        const DAAL_INT nCols       = n;
+        const DAAL_INT nBlockRows  = nRows;
+        const algorithmFPType one  = 1.0;
+        const algorithmFPType zero = 0.0;
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &nCols, &nBlockRows, &nCols, &one, Q2, &nCols, Q1, &nCols, &zero, Q, &nCols);
+    });
+
+    return safeStat.detach();
+}
+
 /**
  *  \brief Kernel for Pivoted QR calculation
  */
@@ -136,44 +223,50 @@ services::Status PivotedQRKernel<method, algorithmFPType, cpu>::compute(const Nu
         }
     }
 
-    DAAL_INT ldAi = m;
-    DAAL_INT ldRi = n;
-
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, m);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * m, sizeof(algorithmFPType));
-    TArray<algorithmFPType, cpu> QiTPtr(n * m);
-    algorithmFPType * QiT = QiTPtr.get();
-    DAAL_CHECK_MALLOC(QiT);
-
-    {
-        ReadRows<algorithmFPType, cpu> blockAi(const_cast<NumericTable &>(dataTable), 0, m);
-        DAAL_CHECK_BLOCK_STATUS(blockAi);
-        const algorithmFPType * Ai = blockAi.get();
-        for (size_t i = 0; i < n; i++)
-        {
-            for (size_t j = 0; j < m; j++)
-            {
-                QiT[i * m + j] = Ai[i + j * n];
-            }
-        }
-    }
-
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, n);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * n, sizeof(algorithmFPType));
     TArray<algorithmFPType, cpu> RiTPtr(n * n);
     algorithmFPType * RiT = RiTPtr.get();
     DAAL_CHECK_MALLOC(RiT);
 
-    ServiceStatus status = compute_pivoted_QR_on_one_node<algorithmFPType, cpu>(m, n, QiT, ldAi, RiT, ldRi, jpvt);
-    if (status != SERV_ERR_OK)
+    if (m >= 2 * n)
     {
-        if (status == SERV_ERR_MALLOC)
-            return Status(ErrorMemoryAllocationFailed);
-        else
-            return Status(ErrorPivotedQRInternal);
+        Status st = compute_pivoted_QR_tall_skinny<algorithmFPType, cpu>(dataTable, QTable, RiT, jpvt);
+        DAAL_CHECK_STATUS_VAR(st);
     }
-
+    else
     {
+        DAAL_INT ldAi = m;
+        DAAL_INT ldRi = n;
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, m);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * m, sizeof(algorithmFPType));
+        TArray<algorithmFPType, cpu> QiTPtr(n * m);
+        algorithmFPType * QiT = QiTPtr.get();
+        DAAL_CHECK_MALLOC(QiT);
+
+        {
+            ReadRows<algorithmFPType, cpu> blockAi(const_cast<NumericTable &>(dataTable), 0, m);
+            DAAL_CHECK_BLOCK_STATUS(blockAi);
+            const algorithmFPType * Ai = blockAi.get();
+            for (size_t i = 0; i < n; i++)
+            {
+                for (size_t j = 0; j < m; j++)
+                {
+                    QiT[i * m + j] = Ai[i + j * n];
+                }
+            }
+        }
+
+        ServiceStatus status = compute_pivoted_QR_on_one_node<algorithmFPType, cpu>(m, n, QiT, ldAi, RiT, ldRi, jpvt);
+        if (status != SERV_ERR_OK)
+        {
+            if (status == SERV_ERR_MALLOC)
+                return Status(ErrorMemoryAllocationFailed);
+            else
+                return Status(ErrorPivotedQRInternal);
+        }
+
         WriteOnlyRows<algorithmFPType, cpu> blockQi(QTable, 0, m);
         DAAL_CHECK_BLOCK_STATUS(blockQi);
         algorithmFPType * Qi = blockQi.get();
@@ -0,0 +1,119 @@
+/* file: prepared_prediction_container.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Containers of the predictions prepared for one model.
+//
+//  The prepared prediction is dispatched to the container of the CPU type
+//  once, as the Batch algorithms are. setupCompute() of the container checks
+//  the model and builds its structures, then predict() only wraps the rows
+//  of the caller into the numeric tables on the stack and runs the kernel.
+//  predict() changes no state of the container, so the prediction of one
+//  model is computed by many threads concurrently.
+//--
+*/
+
+#ifndef __PREPARED_PREDICTION_CONTAINER_H__
+#define __PREPARED_PREDICTION_CONTAINER_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "src/data_management/service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+/**
+ *  \brief Interface of the containers of the prepared predictions of the CPU types
+ */
+template <typename algorithmFPType>
+class PreparedPredictionContainerIface : public AlgorithmContainerImpl<batch>
+{
+public:
+    PreparedPredictionContainerIface(daal::services::Environment::env * daalEnv) : AlgorithmContainerImpl<batch>(daalEnv) {}
+    virtual ~PreparedPredictionContainerIface() {}
+
+    /* The prepared prediction is computed by predict() only */
+    virtual services::Status compute() DAAL_C11_OVERRIDE { return services::Status(services::ErrorMethodNotImplemented); }
+
+    /**
+     *  \brief Computes the predictions of the rows, thread-safe
+     *
+     *  \param x[in]      Array of nRows rows of the values of the features
+     *  \param nRows[in]  Number of the rows
+     *  \param y[out]     Array of the predictions of the rows
+     */
+    virtual services::Status predict(const algorithmFPType * x, size_t nRows, algorithmFPType * y) const = 0;
+};
+
+/**
+ *  \brief Dispatcher of the prepared prediction that gives the access to the container of the CPU type
+ */
+template <typename DispatchContainer, typename algorithmFPType>
+class PreparedPredictionDispatcher : public DispatchContainer
+{
+public:
+    PreparedPredictionDispatcher(daal::services::Environment::env * daalEnv) : DispatchContainer(daalEnv) {}
+
+    const PreparedPredictionContainerIface<algorithmFPType> * get() const
+    {
+        return static_cast<const PreparedPredictionContainerIface<algorithmFPType> *>(this->_cntr);
+    }
+};
+
+/**
+ *  \brief Numeric table of the rows of the caller, the dictionary is shared by the tables of all the calls
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PreparedRowsTable : public data_management::HomogenNumericTable<algorithmFPType>
+{
+public:
+    PreparedRowsTable(const data_management::NumericTableDictionaryPtr & dictionary, const algorithmFPType * rows, size_t nRows,
+                      services::Status & st)
+        : data_management::HomogenNumericTable<algorithmFPType>(dictionary, st)
+    {
+        this->_ptr       = services::SharedPtr<byte>((byte *)rows, services::EmptyDeleter());
+        this->_memStatus = data_management::NumericTableIface::userAllocated;
+        st |= this->setNumberOfRows(nRows);
+    }
+
+    /* Creates the dictionary of the continuous features of the rows */
+    static data_management::NumericTableDictionaryPtr createDictionary(size_t nFeatures, services::Status & st)
+    {
+        services::SharedPtr<daal::internal::NumericTableDictionaryCPU<cpu> > dictionary(
+            new daal::internal::NumericTableDictionaryCPU<cpu>(nFeatures));
+        if (!dictionary.get())
+        {
+            st |= services::Status(services::ErrorMemoryAllocationFailed);
+            return data_management::NumericTableDictionaryPtr();
+        }
+        data_management::NumericTableFeature feature;
+        feature.setType<algorithmFPType>();
+        st |= dictionary->setAllFeatures(feature);
+        return dictionary;
+    }
+};
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -44,8 +44,17 @@ namespace interface1
 template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method)
 {
-    const Input * in = static_cast<const Input *>(input);
-    return allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), in->get(data)->getNumberOfRows());
+    const Input * in       = static_cast<const Input *>(input);
+    const size_t nFeatures = in->get(data)->getNumberOfColumns();
+    Status s               = allocateImpl<algorithmFPType>(nFeatures, in->get(data)->getNumberOfRows());
+
+    const size_t nMatrices = parameter ? static_cast<const Parameter *>(parameter)->nMatrices : 1;
+    if (s && nMatrices > 1)
+    {
+        Argument::set(matrixR, data_management::HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures * nMatrices,
+                                                                                             data_management::NumericTable::doAllocate, &s));
+    }
+    return s;
 }
 
 /**
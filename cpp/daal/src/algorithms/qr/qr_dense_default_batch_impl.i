@@ -30,6 +30,7 @@
 #include "src/services/service_defines.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
 
 #include "src/algorithms/qr/qr_dense_default_impl.i"
 
@@ -62,6 +63,12 @@ Status QRBatchKernel<algorithmFPType, method, cpu>::compute(const size_t na, con
     const size_t m = ntAi->getNumberOfRows();
     const size_t t = threader_get_threads_number();
 
+    const size_t nMatrices = par ? static_cast<const Parameter *>(par)->nMatrices : 1;
+    if (nMatrices > 1)
+    {
+        return QRBatchKernel<algorithmFPType, method, cpu>::compute_stack(nMatrices, a, r);
+    }
+
     if (m >= 2 * n)
     {
         if ((m > n * t) && (n > 10) && (!(n >= 200 && m <= 100000)))
@@ -146,6 +153,81 @@ Status QRBatchKernel<algorithmFPType, method, cpu>::compute_seq(const size_t na,
     return Status();
 }
 
+/**
+ *  \brief Decomposes the nMatrices matrices stacked in the input table independently, a matrix per task with the sequential LAPACK,
+ *  so the small matrices do not pay the threading overhead of the LAPACK calls
+ */
+template <typename algorithmFPType, daal::algorithms::qr::Method method, CpuType cpu>
+Status QRBatchKernel<algorithmFPType, method, cpu>::compute_stack(const size_t nMatrices, const NumericTable * const * a, NumericTable * r[])
+{
+    NumericTable * ntA = const_cast<NumericTable *>(a[0]);
+    NumericTable * ntQ = r[0];
+    NumericTable * ntR = r[1];
+
+    const size_t n = ntA->getNumberOfColumns();
+    const size_t m = ntA->getNumberOfRows() / nMatrices; /* Number of rows of a matrix */
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, m + n);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * (m + n), sizeof(algorithmFPType));
+
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(n * (m + n));
+
+    SafeStatus safeStat;
+    daal::threader_for(nMatrices, nMatrices, [&](size_t iMatrix) {
+        algorithmFPType * QiT = tlsBuffer.local(); /* QiT [n][m] */
+        DAAL_CHECK_THR(QiT, ErrorMemoryAllocationFailed);
+        algorithmFPType * RiT = QiT + n * m; /* RiT [n][n] */
+
+        {
+            ReadRows<algorithmFPType, cpu, NumericTable> aiBlock(ntA, iMatrix * m, m);
+            DAAL_CHECK_BLOCK_STATUS_THR(aiBlock);
+            const algorithmFPType * Ai = aiBlock.get();
+            for (size_t i = 0; i < n; i++)
+            {
+                for (size_t j = 0; j < m; j++)
+                {
+                    QiT[i * m + j] = Ai[i + j * n];
+                }
+            }
+        }
+
+        const auto ec = compute_QR_on_one_node_seq<algorithmFPType, cpu>(m, n, QiT, m, RiT, n);
+        DAAL_CHECK_STATUS_THR(ec);
+
+        {
+            WriteOnlyRows<algorithmFPType, cpu, NumericTable> qiBlock(ntQ, iMatrix * m, m);
+            DAAL_CHECK_BLOCK_STATUS_THR(qiBlock);
+            algorithmFPType * Qi = qiBlock.get();
+            for (size_t i = 0; i < n; i++)
+            {
+                for (size_t j = 0; j < m; j++)
+                {
+                    Qi[i + j * n] = QiT[i * m + j];
+                }
+            }
+        }
+
+        {
+            WriteOnlyRows<algorithmFPType, cpu, NumericTable> riBlock(ntR, iMatrix * n, n);
+            DAAL_CHECK_BLOCK_STATUS_THR(riBlock);
+            algorithmFPType * Ri = riBlock.get();
+            for (size_t i = 0; i < n; i++)
+            {
+                size_t j = 0;
+                for (; j <= i; j++)
+                {
+                    Ri[i + j * n] = RiT[i * n + j];
+                }
+                for (; j < n; j++)
+                {
+                    Ri[i + j * n] = 0.0;
+                }
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
 /* Max number of blocks depending on arch */
 #if (__CPUID__(DAAL_CPU) >= __avx512_mic__)
     #define DEF_MAX_BLOCKS 256
@@ -30,6 +30,7 @@
 #include "src/services/service_defines.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_tree_qr.h"
 
 #include "src/algorithms/qr/qr_dense_default_impl.i"
 
@@ -67,7 +68,7 @@ Status QRDistributedStep2Kernel<algorithmFPType, method, cpu>::compute(const siz
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, n);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * n, sizeof(algorithmFPType));
     TArray<algorithmFPType, cpu> aAux2T(n * nxb);
-    algorithmFPType * Aux2T = aAux2T.get();
+    algorithmFPType * Aux2T = aAux2T.get(); /* nBlocks column-major blocks R_k [n][n] */
     TArray<algorithmFPType, cpu> aRT(n * n);
     algorithmFPType * RT = aRT.get();
     DAAL_CHECK(Aux2T && RT, ErrorMemoryAllocationFailed);
@@ -76,37 +77,32 @@ Status QRDistributedStep2Kernel<algorithmFPType, method, cpu>::compute(const siz
     daal::threader_for(nBlocks, nBlocks, [=, &safeStat](int k) {
         ReadRows<algorithmFPType, cpu, NumericTable> mtAux2(*const_cast<NumericTable *>(a[k]), 0, n);
         DAAL_CHECK_BLOCK_STATUS_THR(mtAux2);
-        const algorithmFPType * Aux2 = mtAux2.get(); /* Aux2  [nxb][n] */
+        const algorithmFPType * Aux2 = mtAux2.get(); /* Aux2  [n][n] */
+        algorithmFPType * Aux2Tk     = Aux2T + k * n * n;
         for (size_t i = 0; i < n; i++)
         {
             for (size_t j = 0; j < n; j++)
             {
-                Aux2T[j * nxb + k * n + i] = Aux2[i * n + j];
+                Aux2Tk[j * n + i] = Aux2[i * n + j];
             }
         }
     });
     DAAL_CHECK_SAFE_STATUS();
 
-    {
-        /* By some reason, there was this part in Sample */
-        for (size_t i = 0; i < n * n; i++)
-        {
-            RT[i] = 0.0;
-        }
-    }
-
-    const auto ec = compute_QR_on_one_node<algorithmFPType, cpu>(nxb, n, Aux2T, nxb, RT, n);
+    /* The R factors of the nodes are merged pairwise along a binary tree, Aux2T gets the blocks Q_k of the nodes */
+    const auto ec = daal::algorithms::internal::treeQR<algorithmFPType, cpu>(nBlocks, n, Aux2T, RT, true);
     DAAL_CHECK_STATUS_VAR(ec);
 
     daal::threader_for(nBlocks, nBlocks, [=, &safeStat](int k) {
         WriteOnlyRows<algorithmFPType, cpu, NumericTable> mtAux3(r[k], 0, n);
         DAAL_CHECK_BLOCK_STATUS_THR(mtAux3);
-        algorithmFPType * Aux3 = mtAux3.get(); /* Aux2  [nxb][n] */
+        algorithmFPType * Aux3        = mtAux3.get(); /* Aux3  [n][n] */
+        const algorithmFPType * Aux2Tk = Aux2T + k * n * n;
         for (size_t i = 0; i < n; i++)
         {
             for (size_t j = 0; j < n; j++)
             {
-                Aux3[i * n + j] = Aux2T[j * nxb + k * n + i];
+                Aux3[i * n + j] = Aux2Tk[j * n + i];
             }
         }
     });
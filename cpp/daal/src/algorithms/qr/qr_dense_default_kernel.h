@@ -48,6 +48,7 @@ public:
     services::Status compute_seq(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[],
                                  const daal::algorithms::Parameter * par = 0);
 
+    services::Status compute_stack(const size_t nMatrices, const NumericTable * const * a, NumericTable * r[]);
     services::Status compute_thr(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[],
                                  const daal::algorithms::Parameter * par = 0);
 
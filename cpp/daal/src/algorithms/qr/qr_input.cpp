@@ -101,7 +101,10 @@ Status Input::check(const daal::algorithms::Parameter * parameter, int method) c
         return s;
     }
 
-    DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows(), ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
+    const size_t nMatrices = parameter ? static_cast<const Parameter *>(parameter)->nMatrices : 1;
+    DAAL_CHECK_EX(nMatrices > 0, ErrorIncorrectParameter, ParameterName, nMatricesStr());
+    DAAL_CHECK_EX(dataTable->getNumberOfRows() % nMatrices == 0, ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
+    DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows() / nMatrices, ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
     return Status();
 }
 
@@ -74,13 +74,15 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
     size_t nFeatures       = algInput->get(data)->getNumberOfColumns();
     int unexpectedLayouts  = (int)packed_mask;
 
+    const size_t nMatrices = par ? static_cast<const Parameter *>(par)->nMatrices : 1;
+
     Status s = checkNumericTable(get(matrixQ).get(), matrixQStr(), unexpectedLayouts, 0, nFeatures, nVectors);
     if (!s)
     {
         return s;
     }
 
-    s |= checkNumericTable(get(matrixR).get(), matrixRStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
+    s |= checkNumericTable(get(matrixR).get(), matrixRStr(), unexpectedLayouts, 0, nFeatures, nFeatures * nMatrices);
     return s;
 }
 
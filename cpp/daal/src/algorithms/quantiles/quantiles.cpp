@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_kll_sketch.h"
 #include "src/services/serialization_utils.h"
 #include "src/services/daal_strings.h"
 
@@ -37,7 +38,10 @@ namespace quantiles
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_QUANTILES_RESULT_ID);
-Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID);
+
+Parameter::Parameter(const NumericTablePtr quantileOrders, size_t sketchSize)
+    : daal::algorithms::Parameter(), quantileOrders(quantileOrders), sketchSize(sketchSize)
 {
     Status s;
     if (quantileOrders.get() == NULL)
@@ -47,8 +51,16 @@ Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::P
     }
 }
 
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
-Input::Input(const Input & other) : daal::algorithms::Input(other) {}
+Input::Input() : InputIface(lastInputId + 1) {}
+Input::Input(const Input & other) : InputIface(other) {}
+
+Status Input::getNumberOfFeatures(size_t & nFeatures) const
+{
+    NumericTablePtr dataTable = get(data);
+    DAAL_CHECK_EX(dataTable, ErrorNullNumericTable, ArgumentName, dataStr());
+    nFeatures = dataTable->getNumberOfColumns();
+    return Status();
+}
 
 /**
  * Returns an input object for the quantiles algorithm
@@ -82,6 +94,50 @@ Status Input::check(const daal::algorithms::Parameter * parameter, int method) c
     Status s = checkNumericTable(algParameter->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
 
     s |= checkNumericTable(get(data).get(), dataStr());
+    if (s && method == kllSketch)
+    {
+        DAAL_CHECK_EX(algParameter->sketchSize >= 2, ErrorIncorrectParameter, ParameterName, sketchSizeStr());
+    }
+    return s;
+}
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return services::staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void PartialResult::set(PartialResultId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+Status PartialResult::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(sketchValues).get(), sketchValuesStr(), (int)packed_mask));
+    return checkImpl(get(sketchValues)->getNumberOfRows(), parameter);
+}
+
+Status PartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfFeatures(nFeatures));
+    return checkImpl(nFeatures, parameter);
+}
+
+/* The sketches of a feature take a row of the capacity for the sketch size */
+Status PartialResult::checkImpl(size_t nFeatures, const daal::algorithms::Parameter * parameter) const
+{
+    const Parameter * algParameter = static_cast<const Parameter *>(parameter);
+    const size_t capacity          = internal::kll::getCapacity(algParameter->sketchSize);
+    const int unexpectedLayouts    = (int)packed_mask;
+
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(sketchValues).get(), sketchValuesStr(), unexpectedLayouts, 0, capacity, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(sketchWeights).get(), sketchWeightsStr(), unexpectedLayouts, 0, capacity, nFeatures));
     return s;
 }
 
@@ -115,13 +171,23 @@ void Result::set(ResultId id, const NumericTablePtr & value)
  */
 Status Result::check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const
 {
-    const Input * input         = static_cast<const Input *>(in);
+    const Input * input = static_cast<const Input *>(in);
+    return checkImpl(input->get(data)->getNumberOfColumns(), par);
+}
+
+Status Result::check(const daal::algorithms::PartialResult * pres, const daal::algorithms::Parameter * par, int method) const
+{
+    const PartialResult * partialResult = static_cast<const PartialResult *>(pres);
+    return checkImpl(partialResult->get(sketchValues)->getNumberOfRows(), par);
+}
+
+Status Result::checkImpl(size_t nVectors, const daal::algorithms::Parameter * par) const
+{
     const Parameter * parameter = static_cast<const Parameter *>(par);
 
     Status s = checkNumericTable(parameter->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
     if (!s) return s;
 
-    size_t nVectors  = input->get(data)->getNumberOfColumns();
     size_t nFeatures = parameter->quantileOrders->getNumberOfColumns();
 
     int unexpectedLayouts = (int)NumericTableIface::csrArray | (int)NumericTableIface::upperPackedTriangularMatrix
@@ -132,6 +198,69 @@ Status Result::check(const daal::algorithms::Input * in, const daal::algorithms:
     return s;
 }
 
+template <>
+DistributedInput<step2Master>::DistributedInput() : InputIface(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+template <>
+DistributedInput<step2Master>::DistributedInput(const DistributedInput<step2Master> & other) : InputIface(other)
+{}
+
+template <>
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+template <>
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+template <>
+Status DistributedInput<step2Master>::getNumberOfFeatures(size_t & nFeatures) const
+{
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+    DAAL_CHECK(collection->size(), ErrorIncorrectNumberOfInputNumericTables);
+
+    PartialResultPtr partialResult = PartialResult::cast((*collection)[0]);
+    DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+
+    NumericTablePtr sketchValuesTable = partialResult->get(sketchValues);
+    Status s                          = checkNumericTable(sketchValuesTable.get(), sketchValuesStr());
+    nFeatures                         = s ? sketchValuesTable->getNumberOfRows() : 0;
+    return s;
+}
+
+template <>
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr & partialResult)
+{
+    DataCollectionPtr collection = staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/* The partial results of the local nodes shall have the sketches of the same size and number of features */
+template <>
+Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfFeatures(nFeatures));
+
+    DataCollectionPtr collection = get(partialResults);
+    for (size_t i = 0; i < collection->size(); ++i)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[i]);
+        DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+        DAAL_CHECK_STATUS(s, partialResult->check(this, parameter, method));
+    }
+    return s;
+}
+
 } // namespace interface1
 } // namespace quantiles
 } // namespace algorithms
@@ -38,7 +38,7 @@ namespace quantiles
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::QuantilesKernel, defaultDense, algorithmFPType);
+    __DAAL_INITIALIZE_KERNELS(internal::QuantilesKernel, method, algorithmFPType);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -59,8 +59,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * quantileOrdersTable = par->quantileOrders.get();
 
     daal::services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::QuantilesKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), compute, *dataTable,
-                       *quantileOrdersTable, *quantilesTable);
+    __DAAL_CALL_KERNEL(env, internal::QuantilesKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, *dataTable, *quantileOrdersTable,
+                       *quantilesTable, *par);
 }
 
 } // namespace quantiles
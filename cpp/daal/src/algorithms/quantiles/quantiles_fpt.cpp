@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_kll_sketch.h"
 
 namespace daal
 {
@@ -52,8 +53,76 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     return s;
 }
 
+/**
+ * Allocates memory to store final results of the quantile algorithms in the online and distributed processing modes
+ * \param[in] partialResult Partial results of the quantiles algorithm
+ * \param[in] parameter     Parameters of the quantiles algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                              const int method)
+{
+    services::Status s;
+    const PartialResult * pres = static_cast<const PartialResult *>(partialResult);
+    const Parameter * par      = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures       = pres->get(sketchValues)->getNumberOfRows();
+    size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+    set(quantiles,
+        data_management::HomogenNumericTable<algorithmFPType>::create(nQuantileOrders, nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Allocates memory to store the sketches of the features, a row of the sketch capacity per feature
+ * \param[in] input     Input objects for the quantiles algorithm
+ * \param[in] parameter Parameters of the quantiles algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                     const int method)
+{
+    services::Status s;
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfFeatures(nFeatures));
+    const size_t capacity = internal::kll::getCapacity(par->sketchSize);
+
+    set(sketchValues,
+        data_management::HomogenNumericTable<algorithmFPType>::create(capacity, nFeatures, data_management::NumericTable::doAllocate, &s));
+    set(sketchWeights,
+        data_management::HomogenNumericTable<algorithmFPType>::create(capacity, nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Initializes the partial results with the empty sketches
+ * \param[in] input     Input objects for the quantiles algorithm
+ * \param[in] parameter Parameters of the quantiles algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, get(sketchValues)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(s, get(sketchWeights)->assign((algorithmFPType)0.0));
+    return s;
+}
+
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
                                                                     const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult * partialResult,
+                                                                    const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                           const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                             const daal::algorithms::Parameter * par, const int method);
 
 } // namespace interface1
 } // namespace quantiles
@@ -25,6 +25,7 @@
 #define __QUANTILES_KERNEL_H__
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
 #include "algorithms/quantiles/quantiles_batch.h"
 
 #include "src/services/service_defines.h"
@@ -44,7 +45,47 @@ template <Method method, typename algorithmFPType, CpuType cpu>
 struct QuantilesKernel : public Kernel
 {
     virtual ~QuantilesKernel() {}
-    services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
+    services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable,
+                             const Parameter & par);
+};
+
+/**
+ * Computes the approximate quantiles with the KLL sketches built by the
+ * threads on the blocks of rows and merged at the end
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct QuantilesKernel<kllSketch, algorithmFPType, cpu> : public Kernel
+{
+    virtual ~QuantilesKernel() {}
+    services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable,
+                             const Parameter & par);
+};
+
+/**
+ * Updates the sketches of the partial result with the block of the data in
+ * the online processing mode and the first step of the distributed one
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+    services::Status compute(const NumericTable & dataTable, NumericTable & sketchValuesTable, NumericTable & sketchWeightsTable,
+                             const Parameter & par);
+    services::Status finalizeCompute(const NumericTable & sketchValuesTable, const NumericTable & sketchWeightsTable,
+                                     const NumericTable & quantileOrdersTable, NumericTable & quantilesTable, const Parameter & par);
+};
+
+/**
+ * Merges the sketches of the local nodes into the partial result of the master node
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public Kernel
+{
+    virtual ~QuantilesDistributedKernel() {}
+    services::Status compute(DataCollection & partialResults, NumericTable & sketchValuesTable, NumericTable & sketchWeightsTable,
+                             const Parameter & par);
+    services::Status finalizeCompute(const NumericTable & sketchValuesTable, const NumericTable & sketchWeightsTable,
+                                     const NumericTable & quantileOrdersTable, NumericTable & quantilesTable, const Parameter & par);
 };
 
 } // namespace internal
@@ -0,0 +1,43 @@
+/* file: quantiles_kll_distr_step2_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of the kernels of the distributed processing mode of the approximate quantiles.
+//--
+*/
+
+#include "src/algorithms/quantiles/quantiles_distributed_container.h"
+#include "src/algorithms/quantiles/quantiles_kll_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+template class DistributedContainer<step2Master, DAAL_FPTYPE, kllSketch, DAAL_CPU>;
+}
+namespace internal
+{
+template class QuantilesDistributedKernel<kllSketch, DAAL_FPTYPE, DAAL_CPU>;
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,232 @@
+/* file: quantiles_kll_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate quantiles with the KLL sketches.
+//--
+*/
+
+#ifndef __QUANTILES_KLL_IMPL_I__
+#define __QUANTILES_KLL_IMPL_I__
+
+#include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_kernel.h"
+#include "src/algorithms/quantiles/quantiles_kll_sketch.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/threading/threading.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/* Adds the rows of the data table to the sketches, every thread builds its
+   own sketches on the blocks of rows, they are merged at the end */
+template <typename algorithmFPType, CpuType cpu>
+services::Status updateSketches(const NumericTable & dataTable, KllSketches<algorithmFPType, cpu> & sketches, size_t sketchSize)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    const size_t blockSize = 1024;
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    SafeStatus safeStat;
+    daal::tls<KllSketches<algorithmFPType, cpu> *> tlsSketches([=, &safeStat]() {
+        auto ptr = new KllSketches<algorithmFPType, cpu>(nFeatures, sketchSize);
+        if (!ptr || !ptr->isValid())
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        KllSketches<algorithmFPType, cpu> * local = tlsSketches.local();
+        if (!local) return;
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (startRow + blockSize > nVectors) ? nVectors - startRow : blockSize;
+
+        ReadRows<algorithmFPType, cpu> dataBlock(const_cast<NumericTable &>(dataTable), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+        const algorithmFPType * data = dataBlock.get();
+
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            local->insert(j, data + j, nRows, nFeatures);
+        }
+    });
+
+    tlsSketches.reduce([&](KllSketches<algorithmFPType, cpu> * local) {
+        if (!local) return;
+        sketches.merge(*local);
+        delete local;
+    });
+    return safeStat.detach();
+}
+
+/* Adds the sketches stored in the rows of the partial result tables */
+template <typename algorithmFPType, CpuType cpu>
+services::Status loadSketches(const NumericTable & sketchValuesTable, const NumericTable & sketchWeightsTable,
+                              KllSketches<algorithmFPType, cpu> & sketches)
+{
+    const size_t nFeatures = sketchValuesTable.getNumberOfRows();
+    const size_t width     = sketchValuesTable.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> valuesBlock(const_cast<NumericTable &>(sketchValuesTable), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(valuesBlock);
+    ReadRows<algorithmFPType, cpu> weightsBlock(const_cast<NumericTable &>(sketchWeightsTable), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(weightsBlock);
+
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        sketches.merge(j, valuesBlock.get() + j * width, weightsBlock.get() + j * width, width);
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status storeSketches(const KllSketches<algorithmFPType, cpu> & sketches, NumericTable & sketchValuesTable,
+                               NumericTable & sketchWeightsTable)
+{
+    const size_t nFeatures = sketchValuesTable.getNumberOfRows();
+    const size_t width     = sketchValuesTable.getNumberOfColumns();
+
+    WriteOnlyRows<algorithmFPType, cpu> valuesBlock(sketchValuesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(valuesBlock);
+    WriteOnlyRows<algorithmFPType, cpu> weightsBlock(sketchWeightsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(weightsBlock);
+
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        sketches.store(j, valuesBlock.get() + j * width, weightsBlock.get() + j * width);
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeQuantilesFromSketches(KllSketches<algorithmFPType, cpu> & sketches, const NumericTable & quantileOrdersTable,
+                                              NumericTable & quantilesTable)
+{
+    const size_t nFeatures       = quantilesTable.getNumberOfRows();
+    const size_t nQuantileOrders = quantilesTable.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> quantileOrdersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(quantileOrdersBlock);
+    const algorithmFPType * quantileOrders = quantileOrdersBlock.get();
+    for (size_t o = 0; o < nQuantileOrders; ++o)
+    {
+        DAAL_CHECK(quantileOrders[o] >= algorithmFPType(0) && quantileOrders[o] <= algorithmFPType(1), services::ErrorQuantileOrderValueIsInvalid);
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock);
+    algorithmFPType * quantiles = quantilesBlock.get();
+
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        sketches.computeQuantiles(j, quantileOrders, nQuantileOrders, quantiles + j * nQuantileOrders);
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<kllSketch, algorithmFPType, cpu>::compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable,
+                                                                           NumericTable & quantilesTable, const Parameter & par)
+{
+    KllSketches<algorithmFPType, cpu> sketches(dataTable.getNumberOfColumns(), par.sketchSize);
+    DAAL_CHECK_MALLOC(sketches.isValid());
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (updateSketches<algorithmFPType, cpu>(dataTable, sketches, par.sketchSize)));
+    return computeQuantilesFromSketches<algorithmFPType, cpu>(sketches, quantileOrdersTable, quantilesTable);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable & dataTable, NumericTable & sketchValuesTable,
+                                                                              NumericTable & sketchWeightsTable, const Parameter & par)
+{
+    KllSketches<algorithmFPType, cpu> sketches(dataTable.getNumberOfColumns(), par.sketchSize);
+    DAAL_CHECK_MALLOC(sketches.isValid());
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (loadSketches<algorithmFPType, cpu>(sketchValuesTable, sketchWeightsTable, sketches)));
+    DAAL_CHECK_STATUS(s, (updateSketches<algorithmFPType, cpu>(dataTable, sketches, par.sketchSize)));
+    return storeSketches<algorithmFPType, cpu>(sketches, sketchValuesTable, sketchWeightsTable);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable & sketchValuesTable,
+                                                                                      const NumericTable & sketchWeightsTable,
+                                                                                      const NumericTable & quantileOrdersTable,
+                                                                                      NumericTable & quantilesTable, const Parameter & par)
+{
+    KllSketches<algorithmFPType, cpu> sketches(sketchValuesTable.getNumberOfRows(), par.sketchSize);
+    DAAL_CHECK_MALLOC(sketches.isValid());
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (loadSketches<algorithmFPType, cpu>(sketchValuesTable, sketchWeightsTable, sketches)));
+    return computeQuantilesFromSketches<algorithmFPType, cpu>(sketches, quantileOrdersTable, quantilesTable);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(DataCollection & partialResults, NumericTable & sketchValuesTable,
+                                                                                   NumericTable & sketchWeightsTable, const Parameter & par)
+{
+    KllSketches<algorithmFPType, cpu> sketches(sketchValuesTable.getNumberOfRows(), par.sketchSize);
+    DAAL_CHECK_MALLOC(sketches.isValid());
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (loadSketches<algorithmFPType, cpu>(sketchValuesTable, sketchWeightsTable, sketches)));
+    for (size_t i = 0; i < partialResults.size(); ++i)
+    {
+        PartialResult * partialResult = static_cast<PartialResult *>(partialResults[i].get());
+        DAAL_CHECK_STATUS(s, (loadSketches<algorithmFPType, cpu>(*partialResult->get(sketchValues), *partialResult->get(sketchWeights), sketches)));
+    }
+    return storeSketches<algorithmFPType, cpu>(sketches, sketchValuesTable, sketchWeightsTable);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable & sketchValuesTable,
+                                                                                           const NumericTable & sketchWeightsTable,
+                                                                                           const NumericTable & quantileOrdersTable,
+                                                                                           NumericTable & quantilesTable, const Parameter & par)
+{
+    KllSketches<algorithmFPType, cpu> sketches(sketchValuesTable.getNumberOfRows(), par.sketchSize);
+    DAAL_CHECK_MALLOC(sketches.isValid());
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (loadSketches<algorithmFPType, cpu>(sketchValuesTable, sketchWeightsTable, sketches)));
+    return computeQuantilesFromSketches<algorithmFPType, cpu>(sketches, quantileOrdersTable, quantilesTable);
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
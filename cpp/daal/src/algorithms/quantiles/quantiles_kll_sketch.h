@@ -0,0 +1,385 @@
+/* file: quantiles_kll_sketch.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration and implementation of the mergeable KLL sketches of the
+//  quantiles algorithm.
+//--
+*/
+
+#ifndef __QUANTILES_KLL_SKETCH_H__
+#define __QUANTILES_KLL_SKETCH_H__
+
+#include "services/daal_defines.h"
+#include "src/services/service_arrays.h"
+#include "src/algorithms/service_sort.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+namespace kll
+{
+/* The weights of the items are 2^level, the 64 levels cover any number of
+   observations that fits size_t */
+const size_t maxLevels = 64;
+
+/* Number of the items the compressed sketch of the given size keeps at most */
+inline size_t getCapacity(size_t sketchSize)
+{
+    return 3 * sketchSize + 2 * maxLevels;
+}
+} // namespace kll
+
+/**
+ * The KLL sketches (Karnin, Lang, Liberty) of nFeatures features. The sketch
+ * is the hierarchy of the compactors: the items of the level h have the weight
+ * 2^h, the level h keeps at most max(2, k * (2/3)^(H - 1 - h)) items of H
+ * levels. The full level is sorted and every other item is promoted to the
+ * next level with the doubled weight, so the sketch keeps O(k) items and
+ * the rank error is O(1 / k) regardless of the number of observations. The
+ * sketches of the same size are merged by concatenating the levels.
+ *
+ * The items of a sketch are stored sorted by the levels and by the values
+ * inside the levels.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class KllSketches
+{
+public:
+    DAAL_NEW_DELETE();
+
+    KllSketches(size_t nFeatures, size_t sketchSize)
+        : _nFeatures(nFeatures),
+          _sketchSize(sketchSize),
+          _capacity(kll::getCapacity(sketchSize)),
+          _bufferSize(2 * kll::getCapacity(sketchSize)),
+          _nCompactions(0),
+          _values(nFeatures * 2 * kll::getCapacity(sketchSize)),
+          _weights(nFeatures * 2 * kll::getCapacity(sketchSize)),
+          _sizes(nFeatures),
+          _tmpValues(2 * kll::getCapacity(sketchSize)),
+          _tmpWeights(2 * kll::getCapacity(sketchSize))
+    {
+        if (isValid())
+        {
+            for (size_t j = 0; j < nFeatures; ++j)
+            {
+                _sizes[j] = 0;
+            }
+        }
+    }
+
+    bool isValid() const { return _values.get() && _weights.get() && _sizes.get() && _tmpValues.get() && _tmpWeights.get(); }
+
+    /* Maximal number of the items of the compressed sketch */
+    size_t capacity() const { return _capacity; }
+
+    size_t size(size_t j) const { return _sizes[j]; }
+    const algorithmFPType * values(size_t j) const { return _values.get() + j * _bufferSize; }
+    const algorithmFPType * weights(size_t j) const { return _weights.get() + j * _bufferSize; }
+
+    /* Adds n observations of the feature j taken with the given stride */
+    void insert(size_t j, const algorithmFPType * x, size_t n, size_t stride)
+    {
+        algorithmFPType * v = _values.get() + j * _bufferSize;
+        algorithmFPType * w = _weights.get() + j * _bufferSize;
+        for (size_t i = 0; i < n;)
+        {
+            size_t & size = _sizes[j];
+            for (; i < n && size < _bufferSize; ++i, ++size)
+            {
+                v[size] = x[i * stride];
+                w[size] = algorithmFPType(1);
+            }
+            compress(j);
+        }
+    }
+
+    /* Adds n items of another sketch of the feature j, the items of the zero weights are skipped */
+    void merge(size_t j, const algorithmFPType * values, const algorithmFPType * weights, size_t n)
+    {
+        algorithmFPType * v = _values.get() + j * _bufferSize;
+        algorithmFPType * w = _weights.get() + j * _bufferSize;
+        for (size_t i = 0; i < n;)
+        {
+            size_t & size = _sizes[j];
+            for (; i < n && size < _bufferSize; ++i)
+            {
+                if (weights[i] > algorithmFPType(0))
+                {
+                    v[size] = values[i];
+                    w[size] = weights[i];
+                    ++size;
+                }
+            }
+            compress(j);
+        }
+    }
+
+    void merge(const KllSketches & other)
+    {
+        for (size_t j = 0; j < _nFeatures; ++j)
+        {
+            merge(j, other.values(j), other.weights(j), other.size(j));
+        }
+    }
+
+    /* Writes the sketch of the feature j padded with the zero weights up to the capacity */
+    void store(size_t j, algorithmFPType * values, algorithmFPType * weights) const
+    {
+        const algorithmFPType * v = this->values(j);
+        const algorithmFPType * w = this->weights(j);
+        const size_t size         = _sizes[j];
+        for (size_t i = 0; i < size; ++i)
+        {
+            values[i]  = v[i];
+            weights[i] = w[i];
+        }
+        for (size_t i = size; i < _capacity; ++i)
+        {
+            values[i]  = algorithmFPType(0);
+            weights[i] = algorithmFPType(0);
+        }
+    }
+
+    /* Returns the items of the feature j whose cumulative weights first reach
+       the orders of the total weight, the empty sketch gives zeros */
+    void computeQuantiles(size_t j, const algorithmFPType * orders, size_t nOrders, algorithmFPType * quantiles)
+    {
+        const size_t size   = _sizes[j];
+        algorithmFPType * v = _tmpValues.get();
+        algorithmFPType * w = _tmpWeights.get();
+        for (size_t i = 0; i < size; ++i)
+        {
+            v[i] = values(j)[i];
+            w[i] = weights(j)[i];
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, algorithmFPType, cpu>(size, v, w);
+
+        algorithmFPType total = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            total += w[i];
+            w[i] = total;
+        }
+
+        for (size_t o = 0; o < nOrders; ++o)
+        {
+            if (size == 0)
+            {
+                quantiles[o] = algorithmFPType(0);
+                continue;
+            }
+            const algorithmFPType rank = orders[o] * total;
+            size_t lo                  = 0;
+            size_t hi                  = size - 1;
+            while (lo < hi)
+            {
+                const size_t mid = (lo + hi) / 2;
+                if (w[mid] < rank)
+                {
+                    lo = mid + 1;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+            quantiles[o] = v[lo];
+        }
+    }
+
+private:
+    static size_t getLevel(algorithmFPType weight)
+    {
+        size_t iw = static_cast<size_t>(weight);
+        size_t h  = 0;
+        while (iw > 1)
+        {
+            iw >>= 1;
+            ++h;
+        }
+        return h;
+    }
+
+    size_t getLevelCapacity(size_t h, size_t nLevels) const
+    {
+        size_t c = _sketchSize;
+        for (size_t i = h + 1; i < nLevels; ++i)
+        {
+            c = (2 * c) / 3;
+        }
+        return (c < 2) ? 2 : c;
+    }
+
+    size_t getTotalCapacity(size_t nLevels) const
+    {
+        size_t c = 0;
+        for (size_t h = 0; h < nLevels; ++h)
+        {
+            c += getLevelCapacity(h, nLevels);
+        }
+        return c;
+    }
+
+    /* Compacts the levels from the lowest one while the sketch exceeds its capacity */
+    void compress(size_t j)
+    {
+        size_t counts[kll::maxLevels + 1];
+        size_t nLevels = sortByLevels(j, counts);
+
+        while (_sizes[j] > getTotalCapacity(nLevels))
+        {
+            size_t h = 0;
+            while (h + 2 < kll::maxLevels && counts[h] < getLevelCapacity(h, nLevels))
+            {
+                ++h;
+            }
+            compact(j, h, counts);
+            nLevels = (h + 2 > nLevels) ? h + 2 : nLevels;
+        }
+    }
+
+    /* Sorts the items by the levels with the counting sort and by the values
+       inside the levels, returns the number of the levels */
+    size_t sortByLevels(size_t j, size_t * counts)
+    {
+        algorithmFPType * v = _values.get() + j * _bufferSize;
+        algorithmFPType * w = _weights.get() + j * _bufferSize;
+        const size_t size   = _sizes[j];
+
+        size_t starts[kll::maxLevels + 1];
+        for (size_t h = 0; h <= kll::maxLevels; ++h)
+        {
+            counts[h] = 0;
+        }
+        size_t nLevels = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const size_t h = getLevel(w[i]);
+            ++counts[h];
+            nLevels = (h + 1 > nLevels) ? h + 1 : nLevels;
+        }
+
+        starts[0] = 0;
+        for (size_t h = 1; h <= kll::maxLevels; ++h)
+        {
+            starts[h] = starts[h - 1] + counts[h - 1];
+        }
+        for (size_t i = 0; i < size; ++i)
+        {
+            const size_t pos = starts[getLevel(w[i])]++;
+            _tmpValues[pos]  = v[i];
+            _tmpWeights[pos] = w[i];
+        }
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            v[i] = _tmpValues[i];
+            w[i] = _tmpWeights[i];
+        }
+        for (size_t h = 0, start = 0; h < nLevels; start += counts[h], ++h)
+        {
+            daal::algorithms::internal::qSort<algorithmFPType, cpu>(counts[h], v + start);
+        }
+        return nLevels;
+    }
+
+    /* Promotes every other item of the level h to the level h + 1, the odd
+       item stays. The offsets alternate, so the compactions are unbiased on
+       average. */
+    void compact(size_t j, size_t h, size_t * counts)
+    {
+        algorithmFPType * v = _values.get() + j * _bufferSize;
+        algorithmFPType * w = _weights.get() + j * _bufferSize;
+        size_t & size       = _sizes[j];
+
+        size_t b = 0;
+        for (size_t i = 0; i < h; ++i)
+        {
+            b += counts[i];
+        }
+        const size_t e         = b + counts[h];
+        const size_t f         = e + counts[h + 1];
+        const size_t nOdd      = counts[h] & 1;
+        const size_t nPromoted = (counts[h] - nOdd) / 2;
+        const size_t offset    = (_nCompactions++) & 1;
+        const algorithmFPType promotedWeight = 2 * w[b];
+
+        algorithmFPType * tv = _tmpValues.get();
+        size_t pos           = 0;
+        if (nOdd)
+        {
+            tv[pos++] = v[b];
+        }
+
+        /* Merges the promoted items with the sorted level h + 1 */
+        size_t iPromoted = 0;
+        size_t iNext     = e;
+        while (iPromoted < nPromoted || iNext < f)
+        {
+            const size_t src = b + nOdd + offset + 2 * iPromoted;
+            if (iNext == f || (iPromoted < nPromoted && v[src] <= v[iNext]))
+            {
+                tv[pos++] = v[src];
+                ++iPromoted;
+            }
+            else
+            {
+                tv[pos++] = v[iNext++];
+            }
+        }
+
+        for (size_t i = 0; i < pos; ++i)
+        {
+            v[b + i] = tv[i];
+            w[b + i] = (i < nOdd) ? w[b] : promotedWeight;
+        }
+        for (size_t i = f; i < size; ++i)
+        {
+            v[i - nPromoted] = v[i];
+            w[i - nPromoted] = w[i];
+        }
+        size -= nPromoted;
+        counts[h] = nOdd;
+        counts[h + 1] += nPromoted;
+    }
+
+    size_t _nFeatures;
+    size_t _sketchSize;
+    size_t _capacity;
+    size_t _bufferSize;
+    size_t _nCompactions;
+    daal::services::internal::TArray<algorithmFPType, cpu> _values;
+    daal::services::internal::TArray<algorithmFPType, cpu> _weights;
+    daal::services::internal::TArray<size_t, cpu> _sizes;
+    daal::services::internal::TArray<algorithmFPType, cpu> _tmpValues;
+    daal::services::internal::TArray<algorithmFPType, cpu> _tmpWeights;
+};
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
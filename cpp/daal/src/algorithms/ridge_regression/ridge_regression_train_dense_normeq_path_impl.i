@@ -0,0 +1,198 @@
+/* file: ridge_regression_train_dense_normeq_path_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the regularization path of ridge regression for the
+//  method of normal equations.
+//--
+*/
+
+#ifndef __RIDGE_REGRESSION_TRAIN_DENSE_NORMEQ_PATH_IMPL_I__
+#define __RIDGE_REGRESSION_TRAIN_DENSE_NORMEQ_PATH_IMPL_I__
+
+#include "src/algorithms/ridge_regression/ridge_regression_train_kernel.h"
+#include "src/externals/service_lapack.h"
+#include "src/services/service_arrays.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+/**
+ *  The intercept is not regularized, so the data and the responses are
+ *  centered with the sums in the intercept row of XtX and XtY and the
+ *  centered cross products A and B give the coefficients
+ *  beta(alpha) = V (L + alpha I)^-1 V^T B of A = V L V^T for every alpha.
+ *  The intercept is the mean response less the product of the means and beta.
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status PathKernel<algorithmFPType, cpu>::compute(const NumericTable & xtxTable, const NumericTable & xtyTable, const NumericTable & alphasTable,
+                                                 NumericTable & betaTable, bool interceptFlag) const
+{
+    const size_t nBetasIntercept = xtxTable.getNumberOfRows();
+    const size_t nFeatures       = interceptFlag ? nBetasIntercept - 1 : nBetasIntercept;
+    const size_t nBetas          = nFeatures + 1;
+    const size_t nResponses      = xtyTable.getNumberOfRows();
+    const size_t nAlphas         = alphasTable.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> xtxRows(const_cast<NumericTable &>(xtxTable), 0, nBetasIntercept);
+    DAAL_CHECK_BLOCK_STATUS(xtxRows);
+    const algorithmFPType * xtx = xtxRows.get();
+
+    ReadRows<algorithmFPType, cpu> xtyRows(const_cast<NumericTable &>(xtyTable), 0, nResponses);
+    DAAL_CHECK_BLOCK_STATUS(xtyRows);
+    const algorithmFPType * xty = xtyRows.get();
+
+    ReadRows<algorithmFPType, cpu> alphasRows(const_cast<NumericTable &>(alphasTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(alphasRows);
+    const algorithmFPType * alphas = alphasRows.get();
+    for (size_t i = 0; i < nAlphas; ++i)
+    {
+        DAAL_CHECK(alphas[i] > 0, ErrorIncorrectParameter);
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> betaRows(betaTable, 0, nAlphas * nResponses);
+    DAAL_CHECK_BLOCK_STATUS(betaRows);
+    algorithmFPType * beta = betaRows.get();
+
+    TArray<algorithmFPType, cpu> aArray(nFeatures * nFeatures);
+    TArray<algorithmFPType, cpu> bArray(nResponses * nFeatures);
+    TArray<algorithmFPType, cpu> meansArray(nFeatures);
+    TArray<algorithmFPType, cpu> responseMeansArray(nResponses);
+    TArray<algorithmFPType, cpu> eigenvaluesArray(nFeatures);
+    TArray<algorithmFPType, cpu> projectionsArray(nResponses * nFeatures);
+    DAAL_CHECK_MALLOC(aArray.get() && bArray.get() && meansArray.get() && responseMeansArray.get() && eigenvaluesArray.get()
+                      && projectionsArray.get());
+    algorithmFPType * a             = aArray.get();
+    algorithmFPType * b             = bArray.get();
+    algorithmFPType * means         = meansArray.get();
+    algorithmFPType * responseMeans = responseMeansArray.get();
+    algorithmFPType * eigenvalues   = eigenvaluesArray.get();
+    algorithmFPType * projections   = projectionsArray.get();
+
+    const algorithmFPType nRows = interceptFlag ? xtx[nFeatures * nBetasIntercept + nFeatures] : algorithmFPType(0);
+    DAAL_CHECK(!interceptFlag || nRows > 0, ErrorRidgeRegressionInternal);
+
+    for (size_t i = 0; i < nFeatures; ++i)
+    {
+        means[i] = interceptFlag ? xtx[nFeatures * nBetasIntercept + i] / nRows : algorithmFPType(0);
+    }
+    for (size_t j = 0; j < nResponses; ++j)
+    {
+        responseMeans[j] = interceptFlag ? xty[j * nBetasIntercept + nFeatures] / nRows : algorithmFPType(0);
+    }
+    for (size_t i = 0; i < nFeatures; ++i)
+    {
+        for (size_t k = 0; k < nFeatures; ++k)
+        {
+            a[i * nFeatures + k] = xtx[i * nBetasIntercept + k] - nRows * means[i] * means[k];
+        }
+    }
+    for (size_t j = 0; j < nResponses; ++j)
+    {
+        for (size_t i = 0; i < nFeatures; ++i)
+        {
+            b[j * nFeatures + i] = xty[j * nBetasIntercept + i] - nRows * responseMeans[j] * means[i];
+        }
+    }
+
+    /* A is symmetric, so the rows of the row-major result are the eigenvectors */
+    char jobz       = 'V';
+    char uplo       = 'U';
+    DAAL_INT p      = (DAAL_INT)nFeatures;
+    DAAL_INT lwork  = 2 * p * p + 6 * p + 1;
+    DAAL_INT liwork = 5 * p + 3;
+    DAAL_INT info   = 0;
+
+    TArray<algorithmFPType, cpu> work(lwork);
+    TArray<DAAL_INT, cpu> iwork(liwork);
+    DAAL_CHECK_MALLOC(work.get() && iwork.get());
+
+    Lapack<algorithmFPType, cpu>::xsyevd(&jobz, &uplo, &p, a, &p, eigenvalues, work.get(), &lwork, iwork.get(), &liwork, &info);
+    DAAL_CHECK(info == 0, ErrorRidgeRegressionInternal);
+
+    for (size_t k = 0; k < nFeatures; ++k)
+    {
+        /* The rounding errors of the centering can make the zero eigenvalues negative */
+        eigenvalues[k] = (eigenvalues[k] < 0) ? algorithmFPType(0) : eigenvalues[k];
+    }
+
+    for (size_t j = 0; j < nResponses; ++j)
+    {
+        for (size_t k = 0; k < nFeatures; ++k)
+        {
+            algorithmFPType sum = 0;
+            for (size_t i = 0; i < nFeatures; ++i)
+            {
+                sum += a[k * nFeatures + i] * b[j * nFeatures + i];
+            }
+            projections[j * nFeatures + k] = sum;
+        }
+    }
+
+    daal::threader_for(nAlphas, nAlphas, [&](size_t iAlpha) {
+        const algorithmFPType alpha = alphas[iAlpha];
+        for (size_t j = 0; j < nResponses; ++j)
+        {
+            algorithmFPType * betaRow = beta + (iAlpha * nResponses + j) * nBetas;
+            for (size_t i = 0; i < nBetas; ++i)
+            {
+                betaRow[i] = 0;
+            }
+            for (size_t k = 0; k < nFeatures; ++k)
+            {
+                const algorithmFPType coeff = projections[j * nFeatures + k] / (eigenvalues[k] + alpha);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nFeatures; ++i)
+                {
+                    betaRow[i + 1] += coeff * a[k * nFeatures + i];
+                }
+            }
+            if (interceptFlag)
+            {
+                algorithmFPType intercept = responseMeans[j];
+                for (size_t i = 0; i < nFeatures; ++i)
+                {
+                    intercept -= means[i] * betaRow[i + 1];
+                }
+                betaRow[0] = intercept;
+            }
+        }
+    });
+
+    return Status();
+}
+
+} // namespace internal
+} // namespace training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
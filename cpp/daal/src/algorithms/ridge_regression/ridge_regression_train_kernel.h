@@ -104,6 +104,25 @@ public:
                            bool interceptFlag, const NumericTable & ridge) const;
 };
 
+/**
+ * Computes the ridge regression coefficients for many values of the ridge
+ * parameter from the cross products of the batch, online or distributed
+ * training by a single eigendecomposition of XtX
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PathKernel : public daal::algorithms::Kernel
+{
+public:
+    /**
+     * \param[in]  xtx           Matrix X'^T X' of size P' x P', the last row and column correspond to the intercept if it is computed
+     * \param[in]  xty           Matrix X'^T Y of size Ny x P'
+     * \param[in]  alphas        Values of the ridge parameter of size 1 x nAlphas, shall be positive
+     * \param[out] beta          Coefficients of size (nAlphas * Ny) x (P + 1), the rows of the alpha i are i * Ny, ..., i * Ny + Ny - 1
+     * \param[in]  interceptFlag True if X' has the column of ones, the intercept is not regularized
+     */
+    Status compute(const NumericTable & xtx, const NumericTable & xty, const NumericTable & alphas, NumericTable & beta, bool interceptFlag) const;
+};
+
 } // namespace internal
 } // namespace training
 } // namespace ridge_regression
@@ -0,0 +1,324 @@
+/* file: service_bf16_gemm.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Cross products of the rows of two matrices rounded to bfloat16 with the
+//  accumulation in single precision. The products are computed by the tiles
+//  of Intel(R) Advanced Matrix Extensions (Intel(R) AMX) if the CPU has them,
+//  otherwise by the Intel(R) AVX-512 BF16 dot products.
+//
+//  The instructions are enabled by the target attributes of the functions,
+//  so the functions are available in the kernels of every CPU type, but are
+//  called only if __daal_serv_cpu_feature_detect() reports the features.
+//--
+*/
+
+#ifndef __SERVICE_BF16_GEMM_H__
+#define __SERVICE_BF16_GEMM_H__
+
+#include "src/services/service_defines.h"
+
+#if defined(__x86_64__) && !defined(__INTEL_COMPILER) && !defined(_MSC_VER) && !defined(__APPLE__) \
+    && ((defined(__clang__) && __clang_major__ >= 12) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11))
+    #define DAAL_BF16_GEMM_ENABLED
+    #include <immintrin.h>
+    #define DAAL_TARGET_AVX512_BF16 __attribute__((target("avx512f,avx512bw,avx512bf16")))
+    #define DAAL_TARGET_AMX_BF16    __attribute__((target("avx512f,amx-tile,amx-bf16")))
+#endif
+
+namespace daal
+{
+namespace internal
+{
+namespace bf16_gemm
+{
+/* The packed rows are padded with zeros to the multiple of the rows of the tile, and the packed columns to the multiple
+   of the bfloat16 values in the row of the tile */
+const size_t rowBlock = 16;
+const size_t colBlock = 32;
+
+inline size_t paddedRows(const size_t n)
+{
+    return (n + rowBlock - 1) / rowBlock * rowBlock;
+}
+
+inline size_t paddedCols(const size_t p)
+{
+    return (p + colBlock - 1) / colBlock * colBlock;
+}
+
+/* Returns true if the CPU has the AMX tiles of bfloat16 enabled by the OS */
+inline bool hasAmx()
+{
+#if defined(DAAL_BF16_GEMM_ENABLED)
+    return (__daal_serv_cpu_feature_detect() & DAAL_CPU_FEATURE_AMX_BF16) != 0;
+#else
+    return false;
+#endif
+}
+
+/* Returns true if the CPU has the bfloat16 dot products */
+inline bool isAvailable()
+{
+#if defined(DAAL_BF16_GEMM_ENABLED)
+    return (__daal_serv_cpu_feature_detect() & (DAAL_CPU_FEATURE_AVX512_BF16 | DAAL_CPU_FEATURE_AMX_BF16)) != 0;
+#else
+    return false;
+#endif
+}
+
+/* Rounds the value to the nearest bfloat16 value, the ties are rounded to even */
+inline uint16_t toBf16(const float value)
+{
+    union
+    {
+        float f;
+        uint32_t u;
+    } bits;
+    bits.f = value;
+    if ((bits.u & 0x7fffffffu) > 0x7f800000u)
+    {
+        /* quiet NaN */
+        return uint16_t((bits.u >> 16) | 0x40u);
+    }
+    return uint16_t((bits.u + 0x7fffu + ((bits.u >> 16) & 1u)) >> 16);
+}
+
+/* Packs n rows of p values into paddedRows(n) rows of paddedCols(p) bfloat16 values, it is the layout of the left
+   matrix of compute() */
+template <typename FPType>
+void packLeft(const FPType * const src, const size_t n, const size_t p, uint16_t * const dst)
+{
+    const size_t nPadded = paddedRows(n);
+    const size_t pPadded = paddedCols(p);
+    for (size_t i = 0; i < nPadded; i++)
+    {
+        uint16_t * const row = dst + i * pPadded;
+        size_t j             = 0;
+        if (i < n)
+        {
+            for (; j < p; j++)
+            {
+                row[j] = toBf16(static_cast<float>(src[i * p + j]));
+            }
+        }
+        for (; j < pPadded; j++)
+        {
+            row[j] = 0;
+        }
+    }
+}
+
+/* Packs n rows of p values into the layout of the right matrix of compute(). The AMX tiles take the panels of 16 rows
+   and 32 columns with the pairs of the consecutive values of one row interleaved by the rows, the dot products take
+   the same layout as the left matrix */
+template <typename FPType>
+void packRight(const FPType * const src, const size_t n, const size_t p, uint16_t * const dst)
+{
+    if (!hasAmx())
+    {
+        packLeft<FPType>(src, n, p, dst);
+        return;
+    }
+
+    const size_t nPadded = paddedRows(n);
+    const size_t pPadded = paddedCols(p);
+    const size_t nChunks = pPadded / colBlock;
+    for (size_t iPanel = 0; iPanel < nPadded / rowBlock; iPanel++)
+    {
+        for (size_t iChunk = 0; iChunk < nChunks; iChunk++)
+        {
+            uint16_t * const tile = dst + (iPanel * nChunks + iChunk) * rowBlock * colBlock;
+            for (size_t r = 0; r < colBlock / 2; r++)
+            {
+                for (size_t c = 0; c < rowBlock; c++)
+                {
+                    const size_t row = iPanel * rowBlock + c;
+                    for (size_t t = 0; t < 2; t++)
+                    {
+                        const size_t col           = iChunk * colBlock + 2 * r + t;
+                        tile[r * colBlock + 2 * c + t] = (row < n && col < p) ? toBf16(static_cast<float>(src[row * p + col])) : uint16_t(0);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#if defined(DAAL_BF16_GEMM_ENABLED)
+
+/* The configuration of the tiles: 0-3 accumulate the 2x2 blocks of the result, 4-5 hold the rows of the left matrix,
+   6-7 the panels of the right one */
+struct alignas(64) TileConfig
+{
+    uint8_t paletteId;
+    uint8_t startRow;
+    uint8_t reserved[14];
+    uint16_t colsb[16];
+    uint8_t rows[16];
+};
+
+DAAL_TARGET_AMX_BF16 inline void computeAmx(const uint16_t * const a, const size_t m, const uint16_t * const b, const size_t n, const size_t p,
+                                            float * const c)
+{
+    const size_t mPadded = paddedRows(m);
+    const size_t nPadded = paddedRows(n);
+    const size_t pPadded = paddedCols(p);
+    const size_t nChunks = pPadded / colBlock;
+
+    TileConfig config = {};
+    config.paletteId  = 1;
+    for (size_t t = 0; t < 8; t++)
+    {
+        config.rows[t]  = rowBlock;
+        config.colsb[t] = colBlock * sizeof(uint16_t);
+    }
+    _tile_loadconfig(&config);
+
+    const size_t lda         = pPadded * sizeof(uint16_t);
+    const size_t ldc         = nPadded * sizeof(float);
+    const size_t panelStride = colBlock * sizeof(uint16_t);
+    const size_t mBlocks     = mPadded / rowBlock;
+    const size_t nBlocks     = nPadded / rowBlock;
+
+    for (size_t ib = 0; ib < mBlocks; ib += 2)
+    {
+        const uint16_t * const a0 = a + ib * rowBlock * pPadded;
+        float * const c0          = c + ib * rowBlock * nPadded;
+        for (size_t jb = 0; jb < nBlocks; jb += 2)
+        {
+            const uint16_t * const b0 = b + jb * nChunks * rowBlock * colBlock;
+            if (ib + 1 < mBlocks && jb + 1 < nBlocks)
+            {
+                const uint16_t * const a1 = a0 + rowBlock * pPadded;
+                const uint16_t * const b1 = b0 + nChunks * rowBlock * colBlock;
+                _tile_zero(0);
+                _tile_zero(1);
+                _tile_zero(2);
+                _tile_zero(3);
+                for (size_t iChunk = 0; iChunk < nChunks; iChunk++)
+                {
+                    _tile_loadd(4, a0 + iChunk * colBlock, lda);
+                    _tile_loadd(5, a1 + iChunk * colBlock, lda);
+                    _tile_loadd(6, b0 + iChunk * rowBlock * colBlock, panelStride);
+                    _tile_loadd(7, b1 + iChunk * rowBlock * colBlock, panelStride);
+                    _tile_dpbf16ps(0, 4, 6);
+                    _tile_dpbf16ps(1, 4, 7);
+                    _tile_dpbf16ps(2, 5, 6);
+                    _tile_dpbf16ps(3, 5, 7);
+                }
+                _tile_stored(0, c0 + jb * rowBlock, ldc);
+                _tile_stored(1, c0 + (jb + 1) * rowBlock, ldc);
+                _tile_stored(2, c0 + rowBlock * nPadded + jb * rowBlock, ldc);
+                _tile_stored(3, c0 + rowBlock * nPadded + (jb + 1) * rowBlock, ldc);
+            }
+            else
+            {
+                /* the last row or column of the blocks */
+                for (size_t ii = ib; ii < mBlocks && ii < ib + 2; ii++)
+                {
+                    for (size_t jj = jb; jj < nBlocks && jj < jb + 2; jj++)
+                    {
+                        _tile_zero(0);
+                        for (size_t iChunk = 0; iChunk < nChunks; iChunk++)
+                        {
+                            _tile_loadd(4, a + ii * rowBlock * pPadded + iChunk * colBlock, lda);
+                            _tile_loadd(6, b + (jj * nChunks + iChunk) * rowBlock * colBlock, panelStride);
+                            _tile_dpbf16ps(0, 4, 6);
+                        }
+                        _tile_stored(0, c + ii * rowBlock * nPadded + jj * rowBlock, ldc);
+                    }
+                }
+            }
+        }
+    }
+    _tile_release();
+}
+
+DAAL_TARGET_AVX512_BF16 inline void computeAvx512Bf16(const uint16_t * const a, const size_t m, const uint16_t * const b, const size_t n,
+                                                      const size_t p, float * const c)
+{
+    const size_t mPadded = paddedRows(m);
+    const size_t nPadded = paddedRows(n);
+    const size_t pPadded = paddedCols(p);
+
+    /* the padded sizes are the multiples of the 4x4 blocks of the accumulators */
+    for (size_t i = 0; i < mPadded; i += 4)
+    {
+        for (size_t j = 0; j < nPadded; j += 4)
+        {
+            __m512 acc[4][4];
+            for (size_t ii = 0; ii < 4; ii++)
+            {
+                for (size_t jj = 0; jj < 4; jj++)
+                {
+                    acc[ii][jj] = _mm512_setzero_ps();
+                }
+            }
+            for (size_t l = 0; l < pPadded; l += colBlock)
+            {
+                __m512bh av[4];
+                __m512bh bv[4];
+                for (size_t ii = 0; ii < 4; ii++)
+                {
+                    av[ii] = (__m512bh)_mm512_loadu_si512(a + (i + ii) * pPadded + l);
+                    bv[ii] = (__m512bh)_mm512_loadu_si512(b + (j + ii) * pPadded + l);
+                }
+                for (size_t ii = 0; ii < 4; ii++)
+                {
+                    for (size_t jj = 0; jj < 4; jj++)
+                    {
+                        acc[ii][jj] = _mm512_dpbf16_ps(acc[ii][jj], av[ii], bv[jj]);
+                    }
+                }
+            }
+            for (size_t ii = 0; ii < 4; ii++)
+            {
+                for (size_t jj = 0; jj < 4; jj++)
+                {
+                    c[(i + ii) * nPadded + j + jj] = _mm512_reduce_add_ps(acc[ii][jj]);
+                }
+            }
+        }
+    }
+}
+
+#endif
+
+/* Computes c[i * paddedRows(n) + j] = <a_i, b_j> for the paddedRows(m) rows of a packed by packLeft() and the
+   paddedRows(n) rows of b packed by packRight(). The products of bfloat16 values are exact, the sums are rounded to
+   single precision. Must be called only if isAvailable() */
+inline void compute(const uint16_t * const a, const size_t m, const uint16_t * const b, const size_t n, const size_t p, float * const c)
+{
+#if defined(DAAL_BF16_GEMM_ENABLED)
+    if (hasAmx())
+    {
+        computeAmx(a, m, b, n, p, c);
+    }
+    else
+    {
+        computeAvx512Bf16(a, m, b, n, p, c);
+    }
+#endif
+}
+
+} // namespace bf16_gemm
+} // namespace internal
+} // namespace daal
+
+#endif
@@ -0,0 +1,147 @@
+/* file: service_partial_results_merge.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Parallel pairwise merge of the partial results of the distributed and online algorithms.
+//--
+*/
+
+#ifndef __SERVICE_PARTIAL_RESULTS_MERGE_H__
+#define __SERVICE_PARTIAL_RESULTS_MERGE_H__
+
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+/*
+ * Computes result = partials[0] + ... + partials[nPartials - 1] for the arrays of the given size.
+ * The blocks of the result are processed in parallel, within a block the partial results are
+ * added pairwise along a binary tree, so every partial result is read once and the round-off
+ * error grows as log(nPartials). The result may be one of the partial results.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status pairwiseSum(size_t nPartials, const algorithmFPType * const * partials, size_t size, algorithmFPType * result)
+{
+    const size_t blockSize = 512;
+    const size_t nBlocks   = size / blockSize + !!(size % blockSize);
+
+    /* Level l of the tree holds the sum of 2^l partial results */
+    size_t nLevels = 1;
+    while ((size_t(1) << nLevels) <= nPartials)
+    {
+        ++nLevels;
+    }
+
+    TlsMem<algorithmFPType, cpu> tlsLevels(nLevels * blockSize);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * levels = tlsLevels.local();
+        DAAL_CHECK_THR(levels, services::ErrorMemoryAllocationFailed);
+
+        const size_t start = iBlock * blockSize;
+        const size_t n     = (iBlock + 1 < nBlocks) ? blockSize : size - start;
+
+        for (size_t k = 0; k < nPartials; k++)
+        {
+            /* The trailing ones of k are the occupied levels merged with the new partial result */
+            size_t level = 0;
+            for (size_t bits = k; bits & 1; bits >>= 1)
+            {
+                ++level;
+            }
+
+            algorithmFPType * sum           = levels + level * blockSize;
+            const algorithmFPType * partial = partials[k] + start;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < n; i++)
+            {
+                sum[i] = partial[i];
+            }
+            for (size_t l = 0; l < level; l++)
+            {
+                const algorithmFPType * levelSum = levels + l * blockSize;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < n; i++)
+                {
+                    sum[i] += levelSum[i];
+                }
+            }
+        }
+
+        algorithmFPType * blockResult = result + start;
+        for (size_t i = 0; i < n; i++)
+        {
+            blockResult[i] = algorithmFPType(0);
+        }
+        for (size_t l = 0; l < nLevels; l++)
+        {
+            if (nPartials & (size_t(1) << l))
+            {
+                const algorithmFPType * levelSum = levels + l * blockSize;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < n; i++)
+                {
+                    blockResult[i] += levelSum[i];
+                }
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+/*
+ * Holds the blocks of the numeric tables of the partial results acquired for reading
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PartialTablesReader
+{
+public:
+    PartialTablesReader(size_t nTables) : _rows(nTables), _data(nTables) {}
+
+    bool isValid() const { return _rows.get() && _data.get(); }
+
+    services::Status set(size_t i, data_management::NumericTable & table)
+    {
+        _data[i] = _rows[i].set(table, 0, table.getNumberOfRows());
+        return _rows[i].status();
+    }
+
+    const algorithmFPType * const * get() const { return _data.get(); }
+
+private:
+    services::internal::TArray<daal::internal::ReadRows<algorithmFPType, cpu>, cpu> _rows;
+    services::internal::TArray<const algorithmFPType *, cpu> _data;
+};
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -25,7 +25,9 @@
 #define __SERVICE_SORT_H__
 
 #include "src/services/service_utils.h"
+#include "src/services/service_arrays.h"
 #include "src/algorithms/service_heap.h"
+#include "src/threading/threading.h"
 #include "services/collection.h"
 
 #if defined(__INTEL_COMPILER_BUILD_DATE)
@@ -784,6 +786,331 @@ DAAL_FORCEINLINE bool isSorted(ForwardIterator first, ForwardIterator last, Comp
     return (isSortedUntil<cpu>(first, last, compare) == last);
 }
 
+/* The arrays shorter than this are sorted by one thread */
+const size_t parallelSortThreshold = 1 << 16;
+/* The minimal number of the elements sorted by one task of the parallel sorts */
+const size_t parallelSortBlockSize = 1 << 14;
+
+/* The number of the blocks the parallel sorts split n elements into */
+template <CpuType cpu>
+size_t getNumberOfSortBlocks(const size_t n)
+{
+    if (n < parallelSortThreshold) return 1;
+    const size_t nBlocks = services::internal::min<cpu, size_t>(4 * threader_get_threads_number(), n / parallelSortBlockSize);
+    return services::internal::max<cpu, size_t>(nBlocks, 1);
+}
+
+/**
+ * \brief The unsigned integer representation of the key of the radix sort, the order of the representations is the
+ *        order of the keys. The negative floating-point values have all the bits flipped, the others the sign bit,
+ *        so the negative NaNs go first and the positive ones last
+ */
+template <typename KeyType>
+struct RadixSortKey;
+
+template <>
+struct RadixSortKey<float>
+{
+    typedef unsigned int BitsType;
+    static DAAL_FORCEINLINE BitsType get(const float value)
+    {
+        union
+        {
+            float f;
+            BitsType u;
+        } bits;
+        bits.f = value;
+        return bits.u ^ ((bits.u >> 31) ? 0xFFFFFFFFu : 0x80000000u);
+    }
+};
+
+template <>
+struct RadixSortKey<double>
+{
+    typedef DAAL_UINT64 BitsType;
+    static DAAL_FORCEINLINE BitsType get(const double value)
+    {
+        union
+        {
+            double f;
+            BitsType u;
+        } bits;
+        bits.f = value;
+        return bits.u ^ ((bits.u >> 63) ? ~BitsType(0) : (BitsType(1) << 63));
+    }
+};
+
+template <>
+struct RadixSortKey<int>
+{
+    typedef unsigned int BitsType;
+    static DAAL_FORCEINLINE BitsType get(const int value) { return BitsType(value) ^ 0x80000000u; }
+};
+
+template <>
+struct RadixSortKey<unsigned int>
+{
+    typedef unsigned int BitsType;
+    static DAAL_FORCEINLINE BitsType get(const unsigned int value) { return value; }
+};
+
+template <>
+struct RadixSortKey<DAAL_INT64>
+{
+    typedef DAAL_UINT64 BitsType;
+    static DAAL_FORCEINLINE BitsType get(const DAAL_INT64 value) { return BitsType(value) ^ (BitsType(1) << 63); }
+};
+
+template <>
+struct RadixSortKey<DAAL_UINT64>
+{
+    typedef DAAL_UINT64 BitsType;
+    static DAAL_FORCEINLINE BitsType get(const DAAL_UINT64 value) { return value; }
+};
+
+/**
+ * \brief Stable LSD radix sort of the items by their keys, the items are split into the blocks histogrammed and
+ *        scattered in parallel. The passes over the digits equal for all the keys are skipped
+ *
+ * \param items[in,out] Array of n items to sort
+ * \param buffer[in]    Array of n items used as the temporary storage
+ * \param n[in]         Number of the items
+ * \param keyOf[in]     Returns the key of type KeyType of the item
+ */
+template <typename KeyType, CpuType cpu, typename Item, typename KeyOf>
+services::Status radixSort(Item * items, Item * buffer, const size_t n, const KeyOf & keyOf)
+{
+    typedef RadixSortKey<KeyType> Key;
+    const size_t nBins     = 256;
+    const size_t nDigits   = sizeof(typename Key::BitsType);
+    const size_t nBlocks   = getNumberOfSortBlocks<cpu>(n);
+    const size_t blockSize = n / nBlocks + !!(n % nBlocks);
+    const bool isParallel  = nBlocks > 1;
+
+    /* the offsets of one block are on the stack, so the sort by one thread does not fail */
+    size_t blockOffsets[nBins];
+    services::internal::TArray<size_t, cpu> offsetsArr(isParallel ? nBlocks * nBins : 0);
+    size_t * offsets = isParallel ? offsetsArr.get() : blockOffsets;
+    DAAL_CHECK_MALLOC(offsets);
+
+    Item * src = items;
+    Item * dst = buffer;
+    for (size_t iDigit = 0; iDigit < nDigits; ++iDigit)
+    {
+        const size_t shift = iDigit * 8;
+        conditional_threader_for(isParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start   = iBlock * blockSize;
+            const size_t end     = services::internal::min<cpu, size_t>(start + blockSize, n);
+            size_t * blockCounts = offsets + iBlock * nBins;
+            for (size_t iBin = 0; iBin < nBins; ++iBin) blockCounts[iBin] = 0;
+            for (size_t i = start; i < end; ++i)
+            {
+                ++blockCounts[(Key::get(keyOf(src[i])) >> shift) & 0xFF];
+            }
+        });
+
+        /* the items of one bin go in the order of the blocks */
+        bool isSingleBin = false;
+        size_t offset    = 0;
+        for (size_t iBin = 0; iBin < nBins; ++iBin)
+        {
+            const size_t binStart = offset;
+            for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+            {
+                const size_t count             = offsets[iBlock * nBins + iBin];
+                offsets[iBlock * nBins + iBin] = offset;
+                offset += count;
+            }
+            isSingleBin |= (offset - binStart == n);
+        }
+        if (isSingleBin) continue;
+
+        conditional_threader_for(isParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start   = iBlock * blockSize;
+            const size_t end     = services::internal::min<cpu, size_t>(start + blockSize, n);
+            size_t * binOffsets = offsets + iBlock * nBins;
+            for (size_t i = start; i < end; ++i)
+            {
+                dst[binOffsets[(Key::get(keyOf(src[i])) >> shift) & 0xFF]++] = src[i];
+            }
+        });
+
+        Item * tmp = src;
+        src        = dst;
+        dst        = tmp;
+    }
+
+    if (src != items)
+    {
+        conditional_threader_for(isParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock * blockSize;
+            const size_t end   = services::internal::min<cpu, size_t>(start + blockSize, n);
+            for (size_t i = start; i < end; ++i)
+            {
+                items[i] = src[i];
+            }
+        });
+    }
+    return services::Status();
+}
+
+/**
+ * \brief Radix sort of the array of the values
+ *
+ * \param n[in]         Length of the input array
+ * \param x[in,out]     Array to sort
+ * \param buffer[in]    Array of n values used as the temporary storage
+ */
+template <typename T, CpuType cpu>
+services::Status radixSort(const size_t n, T * x, T * buffer)
+{
+    return radixSort<T, cpu>(x, buffer, n, [](const T & value) -> T { return value; });
+}
+
+/**
+ * \brief Sorts the array x of the keys and permutes the array index in the same way, by the parallel radix sort of
+ *        the pairs for the long arrays and by the quick sort for the short ones or if the pairs are not allocated
+ *
+ * \param n[in]         Length of the input arrays
+ * \param x[in,out]     Array of the keys to sort
+ * \param index[in,out] Array of the values to permute
+ */
+template <typename KeyType, typename IndexType, CpuType cpu>
+void parallelSortByKey(const size_t n, KeyType * x, IndexType * index)
+{
+    struct Pair
+    {
+        KeyType key;
+        IndexType index;
+    };
+    services::internal::TArray<Pair, cpu> pairsArr(n < parallelSortThreshold ? 0 : 2 * n);
+    Pair * pairs = pairsArr.get();
+    if (!pairs)
+    {
+        qSort<KeyType, IndexType, cpu>(n, x, index);
+        return;
+    }
+
+    const size_t nBlocks   = getNumberOfSortBlocks<cpu>(n);
+    const size_t blockSize = n / nBlocks + !!(n % nBlocks);
+    threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t end = services::internal::min<cpu, size_t>((iBlock + 1) * blockSize, n);
+        for (size_t i = iBlock * blockSize; i < end; ++i)
+        {
+            pairs[i].key   = x[i];
+            pairs[i].index = index[i];
+        }
+    });
+
+    if (!radixSort<KeyType, cpu>(pairs, pairs + n, n, [](const Pair & pair) -> KeyType { return pair.key; }))
+    {
+        qSort<KeyType, IndexType, cpu>(n, x, index);
+        return;
+    }
+
+    threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t end = services::internal::min<cpu, size_t>((iBlock + 1) * blockSize, n);
+        for (size_t i = iBlock * blockSize; i < end; ++i)
+        {
+            x[i]     = pairs[i].key;
+            index[i] = pairs[i].index;
+        }
+    });
+}
+
+/* Returns the number of the items of a in the first k items of the stable merge of a and b */
+template <CpuType cpu, typename Item, typename Compare>
+size_t mergePathSplit(const Item * a, const size_t na, const Item * b, const size_t nb, const size_t k, Compare compare)
+{
+    size_t lo = k > nb ? k - nb : 0;
+    size_t hi = services::internal::min<cpu, size_t>(k, na);
+    while (lo < hi)
+    {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (compare(b[k - mid - 1], a[mid]))
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+/**
+ * \brief Parallel merge sort of the items that have no keys for the radix sort. The blocks are sorted by one thread
+ *        each, then the pairs of the sorted runs are merged, every merge is split between the threads by the merge path
+ *
+ * \param items[in,out] Array of n items to sort
+ * \param buffer[in]    Array of n items used as the temporary storage
+ * \param n[in]         Number of the items
+ * \param compare[in]   Returns true if the first item goes before the second one
+ */
+template <CpuType cpu, typename Item, typename Compare>
+void parallelMergeSort(Item * items, Item * buffer, const size_t n, Compare compare)
+{
+    const size_t nBlocks   = getNumberOfSortBlocks<cpu>(n);
+    const size_t blockSize = n / nBlocks + !!(n % nBlocks);
+    const bool isParallel  = nBlocks > 1;
+
+    conditional_threader_for(isParallel, nBlocks, [&](size_t iBlock) {
+        const size_t start = iBlock * blockSize;
+        const size_t end   = services::internal::min<cpu, size_t>(start + blockSize, n);
+        if (start < end) introSort<cpu>(items + start, items + end, compare);
+    });
+
+    Item * src = items;
+    Item * dst = buffer;
+    for (size_t runSize = blockSize; runSize < n; runSize *= 2)
+    {
+        /* every block of the output belongs to one merge, the runs are the multiples of the blocks */
+        conditional_threader_for(isParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock * blockSize;
+            if (start >= n) return;
+            const size_t end      = services::internal::min<cpu, size_t>(start + blockSize, n);
+            const size_t runStart = start / (2 * runSize) * (2 * runSize);
+            const size_t mid      = services::internal::min<cpu, size_t>(runStart + runSize, n);
+            const size_t runEnd   = services::internal::min<cpu, size_t>(runStart + 2 * runSize, n);
+
+            const Item * a  = src + runStart;
+            const Item * b  = src + mid;
+            const size_t na = mid - runStart;
+            const size_t nb = runEnd - mid;
+            size_t ia       = mergePathSplit<cpu>(a, na, b, nb, start - runStart, compare);
+            size_t ib       = start - runStart - ia;
+            for (size_t i = start; i < end; ++i)
+            {
+                if (ib == nb || (ia < na && !compare(b[ib], a[ia])))
+                {
+                    dst[i] = a[ia++];
+                }
+                else
+                {
+                    dst[i] = b[ib++];
+                }
+            }
+        });
+
+        Item * tmp = src;
+        src        = dst;
+        dst        = tmp;
+    }
+
+    if (src != items)
+    {
+        conditional_threader_for(isParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock * blockSize;
+            const size_t end   = services::internal::min<cpu, size_t>(start + blockSize, n);
+            for (size_t i = start; i < end; ++i)
+            {
+                items[i] = src[i];
+            }
+        });
+    }
+}
+
 } // namespace internal
 } // namespace algorithms
 } // namespace daal
@@ -0,0 +1,246 @@
+/* file: service_top_k_distances.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the k smallest cosine and correlation distances of
+//  every row computed by the tiles of the distance matrix.
+//--
+*/
+
+#ifndef __SERVICE_TOP_K_DISTANCES_H__
+#define __SERVICE_TOP_K_DISTANCES_H__
+
+#include "data_management/data/csr_numeric_table.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_math.h"
+#include "src/algorithms/service_heap.h"
+#include "src/algorithms/service_threading.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+namespace top_k_distances
+{
+const size_t tileSize = 128;
+
+template <typename algorithmFPType>
+struct Neighbor
+{
+    algorithmFPType distance;
+    size_t index;
+};
+
+/* Scales the rows to the unit norm, the correlation distance centers them first */
+template <typename algorithmFPType, CpuType cpu>
+services::Status normalizeRows(const data_management::NumericTable * xTable, algorithmFPType * z, bool centerRows)
+{
+    const size_t p       = xTable->getNumberOfColumns();
+    const size_t n       = xTable->getNumberOfRows();
+    const size_t nBlocks = n / tileSize + !!(n % tileSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t start = iBlock * tileSize;
+        const size_t nRows = (start + tileSize > n) ? n - start : tileSize;
+
+        daal::internal::ReadRows<algorithmFPType, cpu> xBlock(*const_cast<data_management::NumericTable *>(xTable), start, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock);
+        const algorithmFPType * x = xBlock.get();
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType * xi = x + i * p;
+            algorithmFPType * zi       = z + (start + i) * p;
+
+            algorithmFPType mean = 0;
+            if (centerRows)
+            {
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    mean += xi[j];
+                }
+                mean /= (algorithmFPType)p;
+            }
+
+            algorithmFPType norm2 = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                zi[j] = xi[j] - mean;
+                norm2 += zi[j] * zi[j];
+            }
+
+            const algorithmFPType invNorm = (norm2 > 0) ? (algorithmFPType)1.0 / daal::internal::Math<algorithmFPType, cpu>::sSqrt(norm2) : 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                zi[j] *= invNorm;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+/**
+ *  Computes the k smallest distances within maxDistance of every row to the other rows of the table.
+ *  The rows are normalized once, then every thread takes a tile of the rows, multiplies it by all
+ *  the tiles with GEMM and filters the products into the max-heaps of its rows while they are in
+ *  cache. The result is the CSR table of n x n float distances with the column indices sorted in
+ *  every row, its arrays shall have the space for n * min(k, n) values.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status compute(const data_management::NumericTable * xTable, data_management::CSRNumericTable * rTable, size_t k,
+                         algorithmFPType maxDistance, bool centerRows)
+{
+    typedef Neighbor<algorithmFPType> NeighborType;
+
+    const size_t p       = xTable->getNumberOfColumns();
+    const size_t n       = xTable->getNumberOfRows();
+    const size_t nSlots  = (k < n) ? k : n;
+    const size_t nBlocks = n / tileSize + !!(n % tileSize);
+
+    float * values      = nullptr;
+    size_t * colIndices = nullptr;
+    size_t * rowOffsets = nullptr;
+    rTable->getArrays<float>(&values, &colIndices, &rowOffsets);
+    DAAL_CHECK(values && colIndices && rowOffsets, services::ErrorNullOutputNumericTable);
+
+    TArray<algorithmFPType, cpu> zArray(n * p);
+    TArray<size_t, cpu> countsArray(n);
+    DAAL_CHECK_MALLOC(zArray.get() && countsArray.get());
+    algorithmFPType * z = zArray.get();
+    size_t * counts     = countsArray.get();
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (normalizeRows<algorithmFPType, cpu>(xTable, z, centerRows)));
+
+    auto byDistance = [](const NeighborType & a, const NeighborType & b) -> bool { return a.distance < b.distance; };
+    auto byIndex    = [](const NeighborType & a, const NeighborType & b) -> bool { return a.index < b.index; };
+
+    daal::TlsMem<algorithmFPType, cpu> tlsTile(tileSize * tileSize);
+    daal::TlsMem<NeighborType, cpu> tlsHeaps(tileSize * nSlots);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * tile = tlsTile.local();
+        NeighborType * heaps   = tlsHeaps.local();
+        DAAL_CHECK_THR(tile && heaps, services::ErrorMemoryAllocationFailed);
+
+        const size_t iStart        = iBlock * tileSize;
+        const DAAL_INT nRows       = static_cast<DAAL_INT>((iStart + tileSize > n) ? n - iStart : tileSize);
+        const algorithmFPType * zi = z + iStart * p;
+
+        for (DAAL_INT i = 0; i < nRows; i++)
+        {
+            counts[iStart + i] = 0;
+        }
+
+        for (size_t jBlock = 0; jBlock < nBlocks; jBlock++)
+        {
+            const size_t jStart        = jBlock * tileSize;
+            const algorithmFPType * zj = z + jStart * p;
+            DAAL_INT nCols             = static_cast<DAAL_INT>((jStart + tileSize > n) ? n - jStart : tileSize);
+            DAAL_INT dim               = static_cast<DAAL_INT>(p);
+            DAAL_INT nRowsInt          = nRows;
+
+            /* tile[i * nCols + j] is the dot product of the rows iStart + i and jStart + j */
+            char transa = 'T', transb = 'N';
+            algorithmFPType alpha = 1.0, beta = 0.0;
+            daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &nCols, &nRowsInt, &dim, &alpha, zj, &dim, zi, &dim, &beta, tile,
+                                                               &nCols);
+
+            for (DAAL_INT i = 0; i < nRows; i++)
+            {
+                const size_t row             = iStart + i;
+                const algorithmFPType * sims = tile + i * nCols;
+                NeighborType * heap          = heaps + i * nSlots;
+                size_t & count               = counts[row];
+
+                for (DAAL_INT j = 0; j < nCols; j++)
+                {
+                    const size_t col               = jStart + j;
+                    const algorithmFPType distance = (algorithmFPType)1.0 - sims[j];
+                    if (col == row || distance > maxDistance) continue;
+
+                    if (count < nSlots)
+                    {
+                        heap[count].distance = distance;
+                        heap[count].index    = col;
+                        if (++count == nSlots) makeMaxHeap<cpu>(heap, heap + nSlots, byDistance);
+                    }
+                    else if (distance < heap[0].distance)
+                    {
+                        heap[0].distance = distance;
+                        heap[0].index    = col;
+                        internalAdjustMaxHeap<cpu>(heap, heap + nSlots, nSlots, size_t(0), byDistance);
+                    }
+                }
+            }
+        }
+
+        /* Writes the neighbors of every row to its slots sorted by the column indices */
+        for (DAAL_INT i = 0; i < nRows; i++)
+        {
+            const size_t row    = iStart + i;
+            NeighborType * heap = heaps + i * nSlots;
+            makeMaxHeap<cpu>(heap, heap + counts[row], byIndex);
+            sortMaxHeap<cpu>(heap, heap + counts[row], byIndex);
+
+            float * rowValues   = values + row * nSlots;
+            size_t * rowIndices = colIndices + row * nSlots;
+            for (size_t t = 0; t < counts[row]; t++)
+            {
+                rowValues[t]  = (float)heap[t].distance;
+                rowIndices[t] = heap[t].index + 1;
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Packs the rows to the beginning of the arrays */
+    size_t nnz    = 0;
+    rowOffsets[0] = 1;
+    for (size_t row = 0; row < n; row++)
+    {
+        const size_t slot = row * nSlots;
+        for (size_t t = 0; t < counts[row]; t++)
+        {
+            values[nnz + t]     = values[slot + t];
+            colIndices[nnz + t] = colIndices[slot + t];
+        }
+        nnz += counts[row];
+        rowOffsets[row + 1] = nnz + 1;
+    }
+    return s;
+}
+
+} // namespace top_k_distances
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
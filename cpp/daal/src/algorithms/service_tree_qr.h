@@ -0,0 +1,283 @@
+/* file: service_tree_qr.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Tree reduction QR decomposition (TSQR) of the stacked R factors of the distributed algorithms.
+//--
+*/
+
+#ifndef __SERVICE_TREE_QR_H__
+#define __SERVICE_TREE_QR_H__
+
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_lapack.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_utils.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+namespace tree_qr
+{
+/* Levels of the tree, enough for any number of blocks addressable by size_t */
+const size_t maxLevels = 8 * sizeof(size_t) + 1;
+
+/* The pairs of a level are processed in parallel with the sequential LAPACK when there are enough of them
+ * to load all the threads, otherwise one by one with the threaded LAPACK */
+inline bool isParallelLevel(size_t nPairs)
+{
+    return nPairs > 1 && nPairs >= daal::threader_get_threads_number();
+}
+
+/*
+ * Computes the QR decomposition of the 2n x n matrix a = [R_a; R_b]
+ *   a at output: Q (2n x n) if computeQ is set
+ *   r at output: R (n x n), upper triangular
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status decomposePair(DAAL_INT n, algorithmFPType * a, algorithmFPType * r, bool computeQ, bool sequential)
+{
+    typedef daal::internal::Lapack<algorithmFPType, cpu> lapack;
+
+    const DAAL_INT m = 2 * n;
+    services::internal::TArrayScalable<algorithmFPType, cpu> tau(n);
+    DAAL_CHECK_MALLOC(tau.get());
+
+    DAAL_INT info             = 0;
+    algorithmFPType workQuery = 0;
+    if (sequential)
+    {
+        lapack::xxgeqrf(m, n, a, m, tau.get(), &workQuery, -1, &info);
+    }
+    else
+    {
+        lapack::xgeqrf(m, n, a, m, tau.get(), &workQuery, -1, &info);
+    }
+    DAAL_CHECK(info == 0, services::ErrorQRInternal);
+
+    const DAAL_INT workDim = services::internal::max<cpu, DAAL_INT>(static_cast<DAAL_INT>(workQuery), n);
+    services::internal::TArrayScalable<algorithmFPType, cpu> work(workDim);
+    DAAL_CHECK_MALLOC(work.get());
+
+    if (sequential)
+    {
+        lapack::xxgeqrf(m, n, a, m, tau.get(), work.get(), workDim, &info);
+    }
+    else
+    {
+        lapack::xgeqrf(m, n, a, m, tau.get(), work.get(), workDim, &info);
+    }
+    DAAL_CHECK(info == 0, services::ErrorQRInternal);
+
+    for (DAAL_INT j = 0; j < n; j++)
+    {
+        for (DAAL_INT i = 0; i <= j; i++)
+        {
+            r[j * n + i] = a[j * m + i];
+        }
+        for (DAAL_INT i = j + 1; i < n; i++)
+        {
+            r[j * n + i] = algorithmFPType(0);
+        }
+    }
+
+    if (computeQ)
+    {
+        if (sequential)
+        {
+            lapack::xxorgqr(m, n, n, a, m, tau.get(), work.get(), workDim, &info);
+        }
+        else
+        {
+            lapack::xorgqr(m, n, n, a, m, tau.get(), work.get(), workDim, &info);
+        }
+        DAAL_CHECK(info == 0, services::ErrorQRInternal);
+    }
+    return services::Status();
+}
+
+/* Runs body(i) for i in [0, n) in parallel or one by one and collects the statuses */
+template <typename Body>
+services::Status forEachPair(size_t n, bool parallel, const Body & body)
+{
+    if (!parallel)
+    {
+        services::Status status;
+        for (size_t i = 0; i < n && status.ok(); i++)
+        {
+            status |= body(i, false);
+        }
+        return status;
+    }
+
+    SafeStatus safeStat;
+    daal::threader_for(n, n, [&](size_t i) {
+        const services::Status status = body(i, true);
+        DAAL_CHECK_STATUS_THR(status);
+    });
+    return safeStat.detach();
+}
+
+} // namespace tree_qr
+
+/*
+ * Computes the QR decomposition A = Q R of A = [R_0; R_1; ...; R_{nBlocks - 1}], the stack of the n x n R factors
+ * of nBlocks nodes, along a binary tree (TSQR): every level stacks the pairs of R factors of the level below and
+ * decomposes them, the pairs of a level are independent, so the master makes log2(nBlocks) steps of 2n x n
+ * decompositions instead of one decomposition of the nBlocks * n x n matrix.
+ * The block Q_k of Q matching R_k is the product of the halves of the Q factors of the pairs on the path from
+ * the leaf k to the root, the products are formed from the root down, a level at a time.
+ *
+ * All matrices are in column-major order.
+ *   blocks at input : [nBlocks][n * n] -> R_k
+ *   blocks at output: [nBlocks][n * n] -> Q_k if computeQ is set, otherwise overwritten
+ *   r      at output: [n * n]          -> R, upper triangular
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status treeQR(size_t nBlocks, size_t n, algorithmFPType * blocks, algorithmFPType * r, bool computeQ)
+{
+    typedef daal::internal::Blas<algorithmFPType, cpu> blas;
+
+    const DAAL_INT nInt = static_cast<DAAL_INT>(n);
+    const size_t nn     = n * n;
+
+    /* The node j of the level l keeps its R factor in the slot j << l of the blocks, so the pairs write to disjoint
+     * slots and the unpaired last node of a level stays in place */
+    size_t counts[tree_qr::maxLevels];
+    size_t nLevels = 0;
+    counts[0]      = nBlocks;
+    while (counts[nLevels] > 1)
+    {
+        counts[nLevels + 1] = counts[nLevels] / 2 + counts[nLevels] % 2;
+        ++nLevels;
+    }
+
+    /* The Q factors of all nBlocks - 1 pairs of the tree, the pairs of the level l start at qOffsets[l] */
+    size_t qOffsets[tree_qr::maxLevels];
+    size_t nPairsTotal = 0;
+    for (size_t l = 0; l < nLevels; l++)
+    {
+        qOffsets[l] = nPairsTotal;
+        nPairsTotal += counts[l] / 2;
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, 2 * nn, nPairsTotal + 1);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, 2 * nn * (nPairsTotal + 1), sizeof(algorithmFPType));
+
+    /* Without Q one pair buffer is enough, with Q the multipliers need one more n x n buffer */
+    const size_t pairsSize = computeQ ? 2 * nn * nPairsTotal + nn : 2 * nn;
+    services::internal::TArrayScalable<algorithmFPType, cpu> pairsArr(pairsSize);
+    DAAL_CHECK_MALLOC(pairsArr.get());
+    algorithmFPType * pairs = pairsArr.get();
+
+    daal::TlsMem<algorithmFPType, cpu> tlsPair(2 * nn);
+
+    services::Status status;
+    for (size_t l = 0; l < nLevels && status.ok(); l++)
+    {
+        const size_t nPairs   = counts[l] / 2;
+        const bool isParallel = tree_qr::isParallelLevel(nPairs);
+        status |= tree_qr::forEachPair(nPairs, isParallel, [&](size_t j, bool sequential) -> services::Status {
+            algorithmFPType * rTop    = blocks + ((2 * j) << l) * nn;
+            algorithmFPType * rBottom = blocks + ((2 * j + 1) << l) * nn;
+            algorithmFPType * a       = computeQ ? pairs + (qOffsets[l] + j) * 2 * nn : (sequential ? tlsPair.local() : pairs);
+            DAAL_CHECK_MALLOC(a);
+
+            for (size_t c = 0; c < n; c++)
+            {
+                for (size_t i = 0; i < n; i++)
+                {
+                    a[c * 2 * n + i]     = rTop[c * n + i];
+                    a[c * 2 * n + n + i] = rBottom[c * n + i];
+                }
+            }
+            return tree_qr::decomposePair<algorithmFPType, cpu>(nInt, a, rTop, computeQ, sequential);
+        });
+    }
+    DAAL_CHECK_STATUS_VAR(status);
+
+    for (size_t i = 0; i < nn; i++)
+    {
+        r[i] = blocks[i];
+    }
+
+    if (!computeQ)
+    {
+        return status;
+    }
+
+    /* The root multiplier is the identity, the node j of the level l gets its multiplier in the slot j << l.
+     * The top child shares the slot with the parent, so it is formed in a buffer after the bottom one. */
+    for (size_t i = 0; i < nn; i++)
+    {
+        blocks[i] = algorithmFPType(0);
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        blocks[i * n + i] = algorithmFPType(1);
+    }
+
+    const char notrans         = 'N';
+    const algorithmFPType one  = algorithmFPType(1);
+    const algorithmFPType zero = algorithmFPType(0);
+    const DAAL_INT ldPair      = 2 * nInt;
+
+    for (size_t l = nLevels; l-- > 0 && status.ok();)
+    {
+        const size_t nPairs   = counts[l] / 2;
+        const bool isParallel = tree_qr::isParallelLevel(nPairs);
+        status |= tree_qr::forEachPair(nPairs, isParallel, [&](size_t j, bool sequential) -> services::Status {
+            const algorithmFPType * q = pairs + (qOffsets[l] + j) * 2 * nn;
+            algorithmFPType * mTop    = blocks + ((2 * j) << l) * nn;
+            algorithmFPType * mBottom = blocks + ((2 * j + 1) << l) * nn;
+            algorithmFPType * buffer  = sequential ? tlsPair.local() : pairs + nPairsTotal * 2 * nn;
+            DAAL_CHECK_MALLOC(buffer);
+
+            if (sequential)
+            {
+                blas::xxgemm(&notrans, &notrans, &nInt, &nInt, &nInt, &one, q + n, &ldPair, mTop, &nInt, &zero, mBottom, &nInt);
+                blas::xxgemm(&notrans, &notrans, &nInt, &nInt, &nInt, &one, q, &ldPair, mTop, &nInt, &zero, buffer, &nInt);
+            }
+            else
+            {
+                blas::xgemm(&notrans, &notrans, &nInt, &nInt, &nInt, &one, q + n, &ldPair, mTop, &nInt, &zero, mBottom, &nInt);
+                blas::xgemm(&notrans, &notrans, &nInt, &nInt, &nInt, &one, q, &ldPair, mTop, &nInt, &zero, buffer, &nInt);
+            }
+            for (size_t i = 0; i < nn; i++)
+            {
+                mTop[i] = buffer[i];
+            }
+            return services::Status();
+        });
+    }
+    return status;
+}
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
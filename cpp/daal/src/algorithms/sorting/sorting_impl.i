@@ -32,6 +32,44 @@ namespace sorting
 {
 namespace internal
 {
+/* Sorts the columns one by one with the parallel radix sort, the columns of the row-major data are gathered into
+   the contiguous buffer and scattered back */
+template <typename algorithmFPType, CpuType cpu>
+Status sortColumnsInParallel(const algorithmFPType * data, const size_t nFeatures, const size_t nVectors, algorithmFPType * sortedData)
+{
+    daal::services::internal::TArray<algorithmFPType, cpu> columnArr(nFeatures > 1 ? nVectors : 0);
+    daal::services::internal::TArray<algorithmFPType, cpu> bufferArr(nVectors);
+    algorithmFPType * column = nFeatures > 1 ? columnArr.get() : sortedData;
+    algorithmFPType * buffer = bufferArr.get();
+    DAAL_CHECK_MALLOC(column && buffer);
+
+    const size_t nBlocks   = daal::algorithms::internal::getNumberOfSortBlocks<cpu>(nVectors);
+    const size_t blockSize = nVectors / nBlocks + !!(nVectors % nBlocks);
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t end = daal::services::internal::min<cpu, size_t>((iBlock + 1) * blockSize, nVectors);
+            for (size_t i = iBlock * blockSize; i < end; ++i)
+            {
+                column[i] = data[i * nFeatures + j];
+            }
+        });
+
+        Status s = daal::algorithms::internal::radixSort<algorithmFPType, cpu>(nVectors, column, buffer);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        if (nFeatures == 1) break;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t end = daal::services::internal::min<cpu, size_t>((iBlock + 1) * blockSize, nVectors);
+            for (size_t i = iBlock * blockSize; i < end; ++i)
+            {
+                sortedData[i * nFeatures + j] = column[i];
+            }
+        });
+    }
+    return Status();
+}
+
 template <Method method, typename algorithmFPType, CpuType cpu>
 Status SortingKernel<method, algorithmFPType, cpu>::compute(const NumericTable & inputTable, NumericTable & outputTable)
 {
@@ -46,6 +84,12 @@ Status SortingKernel<method, algorithmFPType, cpu>::compute(const NumericTable &
     DAAL_CHECK_BLOCK_STATUS(otputBlock);
     algorithmFPType * sortedData = otputBlock.get();
 
+    /* the tall tables with less columns than threads get no speedup from sorting the columns in parallel */
+    if (nVectors >= daal::algorithms::internal::parallelSortThreshold && nFeatures < daal::threader_get_threads_number())
+    {
+        return sortColumnsInParallel<algorithmFPType, cpu>(data, nFeatures, nVectors, sortedData);
+    }
+
     DAAL_CHECK(!(Statistics<algorithmFPType, cpu>::xSort(const_cast<algorithmFPType *>(data), nFeatures, nVectors, sortedData)), ErrorSorting);
     return Status();
 }
@@ -28,6 +28,7 @@
 #include "algorithms/sorting/sorting_batch.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_stat.h"
+#include "src/algorithms/service_sort.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -33,6 +33,7 @@
 #include "algorithms/regression/regression_training_types.h"
 #include "algorithms/stump/stump_regression_model.h"
 #include "src/algorithms/decision_tree/decision_tree_regression_model_impl.h"
+#include "src/algorithms/stump/stump_regression_train_histogram_impl.i"
 
 using namespace daal::data_management;
 using namespace daal::algorithms;
@@ -64,6 +65,20 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t
 
     services::Status s;
 
+    /* The binned values of the features are used only if they are requested, the split may differ from the exact one */
+    if (par && par->maxBins && HistogramStumpTrainer<algorithmFPtype, cpu>::isSupported(*xTable))
+    {
+        const size_t nVectors = xTable->getNumberOfRows();
+        ReadColumns<algorithmFPtype, cpu> y(yTable, 0, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(y);
+        ReadColumns<algorithmFPtype, cpu> w(const_cast<NumericTable *>(wTable), 0, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(w);
+
+        HistogramStumpTrainer<algorithmFPtype, cpu> trainer;
+        DAAL_CHECK_STATUS(s, trainer.init(*xTable, par->maxBins, par->minBinSize));
+        return trainer.train(y.get(), w.get(), *stumpModel, nullptr);
+    }
+
     /* Create an algorithm object to train the Decision tree model */
     decision_tree::regression::training::Batch<> treeAlgorithm;
     treeAlgorithm.enableChecks(false);
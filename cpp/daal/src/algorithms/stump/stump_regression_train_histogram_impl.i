@@ -0,0 +1,337 @@
+/* file: stump_regression_train_histogram_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Training of the decision stumps for regression on the binned data set.
+//
+//  The values of every feature are mapped to at most maxBins bins once by
+//  dtrees::internal::IndexedFeatures, then every stump is trained by one pass
+//  over the bin indices of every feature that accumulates the weighted
+//  histogram of the responses, and one pass over the bins. The split is made
+//  only between the bins, so it is the exact split of the MSE if the feature
+//  has at most maxBins different values.
+//--
+*/
+
+#ifndef __STUMP_REGRESSION_TRAIN_HISTOGRAM_IMPL_I__
+#define __STUMP_REGRESSION_TRAIN_HISTOGRAM_IMPL_I__
+
+#include "src/algorithms/stump/stump_regression_train_presorted_impl.i"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+/**
+ *  \brief Trains the decision stumps on one data set binned by init()
+ */
+template <typename algorithmFPType, CpuType cpu>
+class HistogramStumpTrainer
+{
+public:
+    typedef typename PresortedStumpTrainer<algorithmFPType, cpu>::DataStatistics DataStatistics;
+
+    HistogramStumpTrainer() : _nRows(0), _nFeatures(0) {}
+
+    static bool isSupported(const NumericTable & x) { return PresortedStumpTrainer<algorithmFPType, cpu>::isSupported(x); }
+
+    /**
+     *  \brief Maps the values of every feature of the data set to the bins and computes the ranges of the values in
+     *         the bins
+     */
+    services::Status init(const NumericTable & x, const size_t maxBins, const size_t minBinSize)
+    {
+        _nRows     = x.getNumberOfRows();
+        _nFeatures = x.getNumberOfColumns();
+
+        const dtrees::internal::BinParams prm(maxBins, minBinSize);
+        services::Status status = _indexedFeatures.template init<double, cpu>(x, nullptr, &prm);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        _binOffsets.reset(_nFeatures + 1);
+        _isOrdinal.reset(_nFeatures);
+        DAAL_CHECK_MALLOC(_binOffsets.get() && _isOrdinal.get());
+        _binOffsets[0] = 0;
+        for (size_t j = 0; j < _nFeatures; j++)
+        {
+            _binOffsets[j + 1] = _binOffsets[j] + _indexedFeatures.numIndices(j);
+            _isOrdinal[j]      = (x.getFeatureType(j) == features::DAAL_ORDINAL);
+        }
+
+        _binMin.reset(_binOffsets[_nFeatures]);
+        _binMax.reset(_binOffsets[_nFeatures]);
+        DAAL_CHECK_MALLOC(_binMin.get() && _binMax.get());
+
+        SafeStatus safeStat;
+        daal::threader_for(_nFeatures, _nFeatures, [&](size_t j) {
+            ReadColumns<double, cpu> xCol(const_cast<NumericTable &>(x), j, 0, _nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(xCol);
+            DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(_indexedFeatures, computeBinRanges<FeatureBinIndexType>(j, xCol.get()));
+        });
+        return safeStat.detach();
+    }
+
+    /**
+     *  \brief Trains the stump on the responses z with the weights w and writes its predictions on the data set
+     *
+     *  \param z[in]        Array of the responses of size n
+     *  \param w[in]        Array of the weights of size n, the weights are equal to one if it is null
+     *  \param model[out]   Trained stump, the nodes of the model are replaced
+     *  \param pred[out]    Array of the predictions of the stump of size n, not computed if it is null
+     */
+    services::Status train(const algorithmFPType * z, const algorithmFPType * w, stump::regression::Model & model, algorithmFPType * pred) const
+    {
+        const size_t n = _nRows;
+
+        DataStatistics total;
+        Bin totalBin = {};
+        for (size_t i = 0; i < n; i++)
+        {
+            const double wi = w ? static_cast<double>(w[i]) : 1.0;
+            const double zi = static_cast<double>(z[i]);
+            total.update(zi, wi);
+            totalBin.add(zi, wi);
+        }
+
+        double pureValue;
+        if (n < 2 || total.isPure(pureValue))
+        {
+            return makeLeafModel(total, model, pred);
+        }
+
+        services::internal::TArray<Split, cpu> splits(_nFeatures);
+        DAAL_CHECK_MALLOC(splits.get());
+
+        SafeStatus safeStat;
+        daal::threader_for(_nFeatures, _nFeatures, [&](size_t j) {
+            DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(_indexedFeatures, safeStat |= findSplit<FeatureBinIndexType>(j, z, w, totalBin, splits[j]));
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        const double epsilon = services::internal::EpsilonVal<double>::get();
+        size_t winner        = _nFeatures;
+        for (size_t j = 0; j < _nFeatures; j++)
+        {
+            if (splits[j].isFound
+                && (winner == _nFeatures || splits[j].criterion < splits[winner].criterion
+                    || (daal::internal::Math<double, cpu>::sFabs(splits[j].criterion - splits[winner].criterion) <= epsilon && winner > j)))
+            {
+                winner = j;
+            }
+        }
+
+        /* every feature has one bin */
+        if (winner == _nFeatures)
+        {
+            return makeLeafModel(total, model, pred);
+        }
+
+        const Split & split = splits[winner];
+        Bin right           = totalBin;
+        right.subtract(split.left);
+
+        const double leftValue  = split.left.mean();
+        const double rightValue = right.mean();
+        if (pred)
+        {
+            DAAL_DTREES_BIN_INDEX_TYPE_SWITCH(_indexedFeatures,
+                                              predict<FeatureBinIndexType>(winner, split.lastLeftBin, leftValue, rightValue, pred));
+        }
+
+        const size_t nLeft  = split.left.count;
+        const size_t nRight = n - nLeft;
+        decision_tree::regression::DecisionTreeNode nodes[3] = { { winner, 1, split.cutPoint },
+                                                                 { static_cast<size_t>(-1), 0, leftValue },
+                                                                 { static_cast<size_t>(-1), 0, rightValue } };
+        const double impurities[3] = { total.mse() / n, split.left.mse() / nLeft, right.mse() / nRight };
+        const int counts[3]        = { static_cast<int>(n), static_cast<int>(nLeft), static_cast<int>(nRight) };
+        return makeStumpModel<cpu>(nodes, impurities, counts, 3, _nFeatures, model);
+    }
+
+private:
+    /* Weighted sums of the responses of the observations in a bin */
+    struct Bin
+    {
+        double sumW;
+        double sumWZ;
+        double sumWZ2;
+        size_t count;
+
+        void add(const double z, const double w)
+        {
+            sumW += w;
+            sumWZ += w * z;
+            sumWZ2 += w * z * z;
+            ++count;
+        }
+
+        void add(const Bin & other)
+        {
+            sumW += other.sumW;
+            sumWZ += other.sumWZ;
+            sumWZ2 += other.sumWZ2;
+            count += other.count;
+        }
+
+        void subtract(const Bin & other)
+        {
+            sumW -= other.sumW;
+            sumWZ -= other.sumWZ;
+            sumWZ2 -= other.sumWZ2;
+            count -= other.count;
+        }
+
+        double mean() const { return (sumW > 0) ? sumWZ / sumW : 0.0; }
+
+        /* the weighted sum of the squared deviations from the mean, as the mse() of the Decision tree statistics */
+        double mse() const
+        {
+            const double value = (sumW > 0) ? sumWZ2 - sumWZ * sumWZ / sumW : 0.0;
+            return (value > 0) ? value : 0.0;
+        }
+    };
+
+    struct Split
+    {
+        double criterion;
+        double cutPoint;
+        size_t lastLeftBin;
+        Bin left;
+        bool isFound;
+    };
+
+    template <typename BinIndexType>
+    void computeBinRanges(const size_t j, const double * x)
+    {
+        const BinIndexType * const index = _indexedFeatures.data<BinIndexType>(j);
+        double * const binMin            = _binMin.get() + _binOffsets[j];
+        double * const binMax            = _binMax.get() + _binOffsets[j];
+        const size_t nBins               = _binOffsets[j + 1] - _binOffsets[j];
+        for (size_t b = 0; b < nBins; b++)
+        {
+            binMin[b] = services::internal::MaxVal<double>::get();
+            binMax[b] = -services::internal::MaxVal<double>::get();
+        }
+        for (size_t i = 0; i < _nRows; i++)
+        {
+            const size_t b = index[i];
+            binMin[b]      = (x[i] < binMin[b]) ? x[i] : binMin[b];
+            binMax[b]      = (x[i] > binMax[b]) ? x[i] : binMax[b];
+        }
+    }
+
+    /* Finds the best split between the bins of the feature j by the weighted MSE */
+    template <typename BinIndexType>
+    services::Status findSplit(const size_t j, const algorithmFPType * z, const algorithmFPType * w, const Bin & total, Split & split) const
+    {
+        split.isFound      = false;
+        const size_t nBins = _binOffsets[j + 1] - _binOffsets[j];
+        if (nBins < 2) return services::Status();
+
+        services::internal::TArrayCalloc<Bin, cpu> hist(nBins);
+        DAAL_CHECK_MALLOC(hist.get());
+
+        const BinIndexType * const index = _indexedFeatures.data<BinIndexType>(j);
+        if (w)
+        {
+            for (size_t i = 0; i < _nRows; i++)
+            {
+                hist[index[i]].add(static_cast<double>(z[i]), static_cast<double>(w[i]));
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < _nRows; i++)
+            {
+                hist[index[i]].add(static_cast<double>(z[i]), 1.0);
+            }
+        }
+
+        const double * const binMin = _binMin.get() + _binOffsets[j];
+        const double * const binMax = _binMax.get() + _binOffsets[j];
+        Bin left                    = {};
+        for (size_t b = 0; b + 1 < nBins; b++)
+        {
+            left.add(hist[b]);
+            Bin right = total;
+            right.subtract(left);
+
+            const double criterion = left.mse() + right.mse();
+            if (!split.isFound || criterion < split.criterion)
+            {
+                split.isFound     = true;
+                split.criterion   = criterion;
+                split.cutPoint    = _isOrdinal[j] ? binMin[b + 1] : (binMax[b] + binMin[b + 1]) / 2;
+                split.lastLeftBin = b;
+                split.left        = left;
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename BinIndexType>
+    void predict(const size_t j, const size_t lastLeftBin, const double leftValue, const double rightValue, algorithmFPType * pred) const
+    {
+        const BinIndexType * const index = _indexedFeatures.data<BinIndexType>(j);
+        for (size_t i = 0; i < _nRows; i++)
+        {
+            pred[i] = static_cast<algorithmFPType>((static_cast<size_t>(index[i]) <= lastLeftBin) ? leftValue : rightValue);
+        }
+    }
+
+    /* Makes the stump of one leaf with the mean of the responses */
+    services::Status makeLeafModel(const DataStatistics & total, stump::regression::Model & model, algorithmFPType * pred) const
+    {
+        const double value = total.getBestDependentVariableValue();
+        for (size_t i = 0; pred && i < _nRows; i++)
+        {
+            pred[i] = static_cast<algorithmFPType>(value);
+        }
+
+        decision_tree::regression::DecisionTreeNode node = { static_cast<size_t>(-1), 0, value };
+        const double impurity                            = total.mse() / _nRows;
+        const int count                                  = static_cast<int>(_nRows);
+        return makeStumpModel<cpu>(&node, &impurity, &count, 1, _nFeatures, model);
+    }
+
+    size_t _nRows;
+    size_t _nFeatures;
+    dtrees::internal::IndexedFeatures _indexedFeatures;
+    services::internal::TArray<size_t, cpu> _binOffsets; /* offsets of the bins of the features in _binMin and _binMax */
+    services::internal::TArray<double, cpu> _binMin;     /* minimal values of the features in the bins */
+    services::internal::TArray<double, cpu> _binMax;     /* maximal values of the features in the bins */
+    services::internal::TArray<bool, cpu> _isOrdinal;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace regression
+} // namespace stump
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,309 @@
+/* file: stump_regression_train_presorted_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Training of the decision stumps for regression on the presorted data set.
+//
+//  The boosting algorithms train many stumps on the same data set with the
+//  different responses and weights. The values of every feature are sorted
+//  once, then every stump is trained by one pass over the sorted values of
+//  every feature instead of sorting them on every training. The stumps are
+//  the same as trained by StumpTrainKernel: the split minimizes the weighted
+//  MSE computed by the statistics of the Decision tree training.
+//--
+*/
+
+#ifndef __STUMP_REGRESSION_TRAIN_PRESORTED_IMPL_I__
+#define __STUMP_REGRESSION_TRAIN_PRESORTED_IMPL_I__
+
+#include "services/daal_defines.h"
+#include "src/threading/threading.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_data_utils.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_sort.h"
+#include "src/algorithms/service_error_handling.h"
+#include "algorithms/stump/stump_regression_model.h"
+#include "src/algorithms/decision_tree/decision_tree_regression_model_impl.h"
+#include "src/algorithms/decision_tree/decision_tree_regression_split_criterion.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::internal;
+
+/* Makes the stump model of the nodes stored in the layout of the Decision tree */
+template <CpuType cpu>
+services::Status makeStumpModel(const decision_tree::regression::DecisionTreeNode * nodes, const double * impurities, const int * counts,
+                                const size_t nodeCount, const size_t nFeatures, stump::regression::Model & model)
+{
+    services::Status status;
+    decision_tree::regression::DecisionTreeTablePtr treeTable(new decision_tree::regression::DecisionTreeTable(nodeCount, status));
+    DAAL_CHECK_MALLOC(treeTable.get());
+    DAAL_CHECK_STATUS_VAR(status);
+    services::SharedPtr<HomogenNumericTableCPU<double, cpu> > impTbl(new HomogenNumericTableCPU<double, cpu>(1, nodeCount, status));
+    DAAL_CHECK_MALLOC(impTbl.get());
+    DAAL_CHECK_STATUS_VAR(status);
+    services::SharedPtr<HomogenNumericTableCPU<int, cpu> > smplCntTbl(new HomogenNumericTableCPU<int, cpu>(1, nodeCount, status));
+    DAAL_CHECK_MALLOC(smplCntTbl.get());
+    DAAL_CHECK_STATUS_VAR(status);
+
+    typedef decision_tree::regression::DecisionTreeNode DecisionTreeNode;
+    DecisionTreeNode * const treeNodes = static_cast<DecisionTreeNode *>(treeTable->getArray());
+    double * const impVals             = impTbl->getArray();
+    int * const smplCntVals            = smplCntTbl->getArray();
+    for (size_t i = 0; i < nodeCount; i++)
+    {
+        treeNodes[i]   = nodes[i];
+        impVals[i]     = impurities[i];
+        smplCntVals[i] = counts[i];
+    }
+
+    model.impl()->setNumberOfFeatures(nFeatures);
+    model.impl()->setTreeTable(treeTable);
+    model.impl()->setImpTable(impTbl);
+    model.impl()->setNodeSmplCntTable(smplCntTbl);
+    return status;
+}
+
+/**
+ *  \brief Trains the decision stumps on one data set presorted by init()
+ *
+ *  The stumps are computed in double precision as the Decision tree used by StumpTrainKernel
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PresortedStumpTrainer
+{
+public:
+    typedef decision_tree::regression::training::internal::MSEWeightedDataStatistics<double, cpu> DataStatistics;
+
+    PresortedStumpTrainer() : _nRows(0), _nFeatures(0) {}
+
+    /**
+     *  \brief Returns true if the stumps on the data set can be trained by the presorted values: the categorical
+     *         features are split by the categories and need the Decision tree
+     */
+    static bool isSupported(const NumericTable & x)
+    {
+        if (x.getNumberOfRows() > static_cast<size_t>(services::internal::MaxVal<int>::get())) return false;
+        for (size_t j = 0; j < x.getNumberOfColumns(); j++)
+        {
+            if (x.getFeatureType(j) == features::DAAL_CATEGORICAL) return false;
+        }
+        return true;
+    }
+
+    /**
+     *  \brief Sorts the values of every feature of the data set and keeps the indices of their rows
+     */
+    services::Status init(const NumericTable & x)
+    {
+        _nRows     = x.getNumberOfRows();
+        _nFeatures = x.getNumberOfColumns();
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nRows, _nFeatures);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nRows * _nFeatures, sizeof(double));
+
+        _x.reset(_nRows * _nFeatures);
+        _order.reset(_nRows * _nFeatures);
+        _isOrdinal.reset(_nFeatures);
+        DAAL_CHECK_MALLOC(_x.get() && _order.get() && _isOrdinal.get());
+
+        for (size_t j = 0; j < _nFeatures; j++)
+        {
+            _isOrdinal[j] = (x.getFeatureType(j) == features::DAAL_ORDINAL);
+        }
+
+        const size_t n = _nRows;
+        SafeStatus safeStat;
+        daal::threader_for(_nFeatures, _nFeatures, [&](size_t j) {
+            ReadColumns<double, cpu> xCol(const_cast<NumericTable &>(x), j, 0, n);
+            DAAL_CHECK_BLOCK_STATUS_THR(xCol);
+            const double * const src = xCol.get();
+
+            double * const xj = _x.get() + j * n;
+            int * const order = _order.get() + j * n;
+            for (size_t i = 0; i < n; i++)
+            {
+                xj[i]    = src[i];
+                order[i] = static_cast<int>(i);
+            }
+            daal::algorithms::internal::parallelSortByKey<double, int, cpu>(n, xj, order);
+        });
+        return safeStat.detach();
+    }
+
+    /**
+     *  \brief Trains the stump on the responses z with the weights w and writes its predictions on the data set
+     *
+     *  \param z[in]        Array of the responses of size n
+     *  \param w[in]        Array of the weights of size n
+     *  \param model[out]   Trained stump, the nodes of the model are replaced
+     *  \param pred[out]    Array of the predictions of the stump of size n
+     */
+    services::Status train(const algorithmFPType * z, const algorithmFPType * w, stump::regression::Model & model, algorithmFPType * pred) const
+    {
+        const size_t n = _nRows;
+
+        DataStatistics total;
+        for (size_t i = 0; i < n; i++)
+        {
+            total.update(static_cast<double>(z[i]), static_cast<double>(w[i]));
+        }
+
+        double pureValue;
+        if (n < 2 || total.isPure(pureValue))
+        {
+            return makeLeafModel(total, model, pred);
+        }
+
+        services::internal::TArray<Split, cpu> splits(_nFeatures);
+        DAAL_CHECK_MALLOC(splits.get());
+
+        daal::threader_for(_nFeatures, _nFeatures, [&](size_t j) { findSplit(j, z, w, total, splits[j]); });
+
+        const double epsilon = services::internal::EpsilonVal<double>::get();
+        size_t winner        = _nFeatures;
+        for (size_t j = 0; j < _nFeatures; j++)
+        {
+            if (splits[j].isFound
+                && (winner == _nFeatures || splits[j].criterion < splits[winner].criterion
+                    || (daal::internal::Math<double, cpu>::sFabs(splits[j].criterion - splits[winner].criterion) <= epsilon && winner > j)))
+            {
+                winner = j;
+            }
+        }
+
+        /* all features are constant */
+        if (winner == _nFeatures)
+        {
+            return makeLeafModel(total, model, pred);
+        }
+
+        const Split & split = splits[winner];
+        DataStatistics right(total);
+        right -= split.left;
+
+        const double leftValue  = split.left.getBestDependentVariableValue();
+        const double rightValue = right.getBestDependentVariableValue();
+
+        const double * const xj = _x.get() + winner * n;
+        const int * const order = _order.get() + winner * n;
+        for (size_t i = 0; i < n; i++)
+        {
+            /* the same comparison as in the Decision tree prediction */
+            pred[order[i]] = static_cast<algorithmFPType>((xj[i] <= split.cutPoint) ? leftValue : rightValue);
+        }
+
+        const size_t nRight = n - split.nLeft;
+        decision_tree::regression::DecisionTreeNode nodes[3] = { { winner, 1, split.cutPoint },
+                                                                 { static_cast<size_t>(-1), 0, leftValue },
+                                                                 { static_cast<size_t>(-1), 0, rightValue } };
+        const double impurities[3] = { total.mse() / n, split.left.mse() / split.nLeft, right.mse() / nRight };
+        const int counts[3]        = { static_cast<int>(n), static_cast<int>(split.nLeft), static_cast<int>(nRight) };
+        return makeStumpModel<cpu>(nodes, impurities, counts, 3, _nFeatures, model);
+    }
+
+private:
+    struct Split
+    {
+        double criterion;
+        double cutPoint;
+        size_t nLeft;
+        DataStatistics left;
+        bool isFound;
+    };
+
+    /* Finds the best split by the feature j in the same way as the Decision tree: the split is made only between the
+       groups of equal values */
+    void findSplit(const size_t j, const algorithmFPType * z, const algorithmFPType * w, const DataStatistics & total, Split & split) const
+    {
+        const size_t n           = _nRows;
+        const double * const xj  = _x.get() + j * n;
+        const int * const order  = _order.get() + j * n;
+        const double totalWeight = total[0];
+
+        split.isFound = false;
+        DataStatistics left;
+        for (size_t i = 0;;)
+        {
+            size_t next = i + 1;
+            while (next < n && !(xj[i] < xj[next])) ++next;
+            if (next == n) break;
+
+            for (size_t k = i; k < next; k++)
+            {
+                left.update(static_cast<double>(z[order[k]]), static_cast<double>(w[order[k]]));
+            }
+
+            const double leftWeight  = left[0];
+            const double rightWeight = totalWeight - leftWeight;
+            const double criterion =
+                left.mse() + DataStatistics::subtractMSE(total.mse(), left.mse(), totalWeight, total.mean(), leftWeight, rightWeight, left.mean());
+
+            if (!split.isFound || criterion < split.criterion)
+            {
+                split.isFound   = true;
+                split.criterion = criterion;
+                split.cutPoint  = _isOrdinal[j] ? xj[next] : (xj[i] + xj[next]) / 2;
+                split.nLeft     = next;
+                split.left      = left;
+            }
+            i = next;
+        }
+    }
+
+    /* Makes the stump of one leaf with the mean of the responses */
+    services::Status makeLeafModel(const DataStatistics & total, stump::regression::Model & model, algorithmFPType * pred) const
+    {
+        const double value = total.getBestDependentVariableValue();
+        for (size_t i = 0; i < _nRows; i++)
+        {
+            pred[i] = static_cast<algorithmFPType>(value);
+        }
+
+        decision_tree::regression::DecisionTreeNode node = { static_cast<size_t>(-1), 0, value };
+        const double impurity                            = total.mse() / _nRows;
+        const int count                                  = static_cast<int>(_nRows);
+        return makeStumpModel<cpu>(&node, &impurity, &count, 1, _nFeatures, model);
+    }
+
+    size_t _nRows;
+    size_t _nFeatures;
+    services::internal::TArray<double, cpu> _x;     /* sorted values of the features, n values per feature */
+    services::internal::TArray<int, cpu> _order;    /* indices of the rows of the sorted values */
+    services::internal::TArray<bool, cpu> _isOrdinal;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace regression
+} // namespace stump
+} // namespace algorithms
+} // namespace daal
+
+#endif
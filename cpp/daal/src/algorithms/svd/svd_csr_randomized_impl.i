@@ -0,0 +1,241 @@
+/* file: svd_csr_randomized_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the truncated SVD of the CSR data.
+//--
+*/
+
+#ifndef __SVD_CSR_RANDOMIZED_IMPL_I__
+#define __SVD_CSR_RANDOMIZED_IMPL_I__
+
+#include "src/algorithms/svd/svd_csr_randomized_kernel.h"
+#include "src/algorithms/svd/svd_dense_randomized_impl.i"
+#include "src/externals/service_spblas.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedCSR, cpu>::compute(const size_t na, const NumericTable * const * a, const size_t nr,
+                                                                    NumericTable * r[], const daal::algorithms::Parameter * par)
+{
+    const Parameter * svdPar   = static_cast<const Parameter *>(par);
+    NumericTable * ntA         = const_cast<NumericTable *>(a[0]);
+    CSRNumericTableIface * csr = dynamic_cast<CSRNumericTableIface *>(ntA);
+    DAAL_CHECK(csr, ErrorIncorrectTypeOfInputNumericTable);
+
+    const size_t n           = ntA->getNumberOfRows();
+    const size_t p           = ntA->getNumberOfColumns();
+    const size_t nComponents = svdPar->nComponents;
+    const size_t rank        = (n < p) ? n : p;
+    DAAL_CHECK(nComponents > 0 && nComponents <= rank, ErrorIncorrectParameter);
+
+    /* The subspace has the oversampled vectors for the accuracy of the last triples */
+    const size_t l = (nComponents + svdPar->nOversamples < rank) ? nComponents + svdPar->nOversamples : rank;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, l);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * l, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, l);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p * l, sizeof(algorithmFPType));
+
+    TArray<algorithmFPType, cpu> yArray(n * l);
+    TArray<algorithmFPType, cpu> zArray(p * l);
+    TArray<algorithmFPType, cpu> uArray(p * l);
+    TArray<algorithmFPType, cpu> vtArray(l * l);
+    TArray<algorithmFPType, cpu> sigmaArray(l);
+    DAAL_CHECK_MALLOC(yArray.get() && zArray.get() && uArray.get() && vtArray.get() && sigmaArray.get());
+    algorithmFPType * y = yArray.get();
+    algorithmFPType * z = zArray.get();
+
+    /* The range finder is shared with the dense randomized SVD, only the products with A are sparse */
+    RandomizedSVDKernel<algorithmFPType, cpu> rangeFinder;
+
+    Status status;
+    DAAL_CHECK_STATUS(status, rangeFinder.generateTestMatrix(p, l, svdPar->seed, z));
+    DAAL_CHECK_STATUS(status, multiply(*csr, n, p, l, z, y));
+    DAAL_CHECK_STATUS(status, rangeFinder.orthonormalize(n, l, y));
+    for (size_t it = 0; it < svdPar->nPowerIterations; ++it)
+    {
+        DAAL_CHECK_STATUS(status, multiplyTransposed(*csr, n, p, l, y, z));
+        DAAL_CHECK_STATUS(status, rangeFinder.orthonormalize(p, l, z));
+        DAAL_CHECK_STATUS(status, multiply(*csr, n, p, l, z, y));
+        DAAL_CHECK_STATUS(status, rangeFinder.orthonormalize(n, l, y));
+    }
+    DAAL_CHECK_STATUS(status, multiplyTransposed(*csr, n, p, l, y, z));
+
+    /* A ~ Y * Y' * A = Y * z' = (Y * vt') * diag(sigma) * u', so the right
+       singular vectors of A are the left ones of z */
+    const algorithmFPType * u  = uArray.get();
+    const algorithmFPType * vt = vtArray.get();
+    DAAL_CHECK_STATUS(status, decompose(p, l, z, sigmaArray.get(), uArray.get(), vtArray.get()));
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> sigmaBlock(r[0], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(sigmaBlock);
+        algorithmFPType * sigma = sigmaBlock.get();
+        for (size_t j = 0; j < nComponents; ++j)
+        {
+            sigma[j] = sigmaArray[j];
+        }
+    }
+
+    if (svdPar->rightSingularMatrix == requiredInPackedForm)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> vBlock(r[2], 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(vBlock);
+        algorithmFPType * v = vBlock.get();
+        for (size_t j = 0; j < nComponents; ++j)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < p; ++i)
+            {
+                v[j * p + i] = u[j * p + i];
+            }
+        }
+    }
+
+    if (svdPar->leftSingularMatrix == requiredInPackedForm)
+    {
+        const size_t blockSize = 512;
+        const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t startRow = iBlock * blockSize;
+            const size_t nRows    = (startRow + blockSize > n) ? n - startRow : blockSize;
+
+            WriteOnlyRows<algorithmFPType, cpu> uBlock(r[1], startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(uBlock);
+
+            /* The row-major block of U is the column-major nComponents x nRows matrix vt * Y' */
+            const char transa          = 'N';
+            const char transb          = 'T';
+            const DAAL_INT m           = nComponents;
+            const DAAL_INT nCols       = nRows;
+            const DAAL_INT k           = l;
+            const DAAL_INT ldvt        = l;
+            const DAAL_INT ldy         = n;
+            const algorithmFPType one  = 1;
+            const algorithmFPType zero = 0;
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nCols, &k, &one, vt, &ldvt, y + startRow, &ldy, &zero, uBlock.get(), &m);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+    return status;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedCSR, cpu>::multiply(CSRNumericTableIface & csr, size_t n, size_t p, size_t l,
+                                                                     const algorithmFPType * w, algorithmFPType * y) const
+{
+    const size_t blockSize = 512;
+    const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (startRow + blockSize > n) ? n - startRow : blockSize;
+
+        ReadRowsCSR<algorithmFPType, cpu> aBlock(csr, startRow, nRows, true);
+        DAAL_CHECK_BLOCK_STATUS_THR(aBlock);
+
+        const char transa          = 'N';
+        const char matdescra[6]    = { 'G', 0, 0, 'F', 0, 0 };
+        const DAAL_INT m           = nRows;
+        const DAAL_INT nCols       = l;
+        const DAAL_INT k           = p;
+        const DAAL_INT ldy         = n;
+        const algorithmFPType one  = 1;
+        const algorithmFPType zero = 0;
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &m, &nCols, &k, &one, matdescra, aBlock.values(), (const DAAL_INT *)aBlock.cols(),
+                                              (const DAAL_INT *)aBlock.rows(), w, &k, &zero, y + startRow, &ldy);
+    });
+
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedCSR, cpu>::multiplyTransposed(CSRNumericTableIface & csr, size_t n, size_t p, size_t l,
+                                                                               const algorithmFPType * y, algorithmFPType * z) const
+{
+    ReadRowsCSR<algorithmFPType, cpu> aBlock(csr, 0, n);
+    DAAL_CHECK_BLOCK_STATUS(aBlock);
+
+    /* The threads take the blocks of the vectors, so every thread writes its
+       own columns of z instead of accumulating the p x l partial products */
+    const size_t nThreads  = threader_get_threads_number();
+    const size_t blockSize = l / nThreads + !!(l % nThreads);
+    const size_t nBlocks   = l / blockSize + !!(l % blockSize);
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t startCol = iBlock * blockSize;
+        const size_t nCols    = (startCol + blockSize > l) ? l - startCol : blockSize;
+
+        const char transa          = 'T';
+        const char matdescra[6]    = { 'G', 0, 0, 'F', 0, 0 };
+        const DAAL_INT m           = n;
+        const DAAL_INT nVectors    = nCols;
+        const DAAL_INT k           = p;
+        const algorithmFPType one  = 1;
+        const algorithmFPType zero = 0;
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &m, &nVectors, &k, &one, matdescra, aBlock.values(), (const DAAL_INT *)aBlock.cols(),
+                                              (const DAAL_INT *)aBlock.rows(), y + startCol * n, &m, &zero, z + startCol * p, &k);
+    });
+
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedCSR, cpu>::decompose(size_t p, size_t l, algorithmFPType * z, algorithmFPType * sigma,
+                                                                      algorithmFPType * u, algorithmFPType * vt) const
+{
+    typedef Lapack<algorithmFPType, cpu> lapack;
+
+    const DAAL_INT nRows = p;
+    const DAAL_INT nCols = l;
+
+    DAAL_INT info             = 0;
+    algorithmFPType workQuery = 0;
+    lapack::xgesvd('S', 'S', nRows, nCols, z, nRows, sigma, u, nRows, vt, nCols, &workQuery, -1, &info);
+
+    const DAAL_INT workSize = static_cast<DAAL_INT>(workQuery);
+    TArray<algorithmFPType, cpu> work(workSize);
+    DAAL_CHECK_MALLOC(work.get());
+
+    lapack::xgesvd('S', 'S', nRows, nCols, z, nRows, sigma, u, nRows, vt, nCols, work.get(), workSize, &info);
+    DAAL_CHECK(info >= 0, ErrorSvdIthParamIllegalValue);
+    DAAL_CHECK(info == 0, ErrorSvdXBDSQRDidNotConverge);
+    return Status();
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,67 @@
+/* file: svd_csr_randomized_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate the truncated SVD of the CSR data.
+//--
+*/
+
+#ifndef __SVD_CSR_RANDOMIZED_KERNEL_H__
+#define __SVD_CSR_RANDOMIZED_KERNEL_H__
+
+#include "src/algorithms/svd/svd_dense_default_kernel.h"
+#include "data_management/data/csr_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+/**
+ * Computes the nComponents largest singular triples of the n x p CSR matrix A
+ * with the randomized subspace iteration: the block of l = nComponents +
+ * nOversamples vectors is multiplied by A * A' nPowerIterations times with
+ * the orthonormalization in between. The matrix is never densified, the cost
+ * is O(nnz * l) per multiplication and O((n + p) * l^2) for the bases.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVDBatchKernel<algorithmFPType, randomizedCSR, cpu> : public Kernel
+{
+public:
+    Status compute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const daal::algorithms::Parameter * par = 0);
+
+private:
+    /* y = A * w for the p x l matrix w, y is n x l */
+    Status multiply(CSRNumericTableIface & csr, size_t n, size_t p, size_t l, const algorithmFPType * w, algorithmFPType * y) const;
+
+    /* z = A' * y for the n x l matrix y, z is p x l */
+    Status multiplyTransposed(CSRNumericTableIface & csr, size_t n, size_t p, size_t l, const algorithmFPType * y, algorithmFPType * z) const;
+
+    /* Computes the thin SVD z = u * diag(sigma) * vt of the p x l matrix z */
+    Status decompose(size_t p, size_t l, algorithmFPType * z, algorithmFPType * sigma, algorithmFPType * u, algorithmFPType * vt) const;
+};
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -45,8 +45,23 @@ namespace interface1
 template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method)
 {
-    const Input * in = static_cast<const Input *>(input);
-    return allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), in->get(data)->getNumberOfRows());
+    const Input * in       = static_cast<const Input *>(input);
+    const size_t nFeatures = in->get(data)->getNumberOfColumns();
+    if (method == randomizedCSR)
+    {
+        const Parameter * svdPar = static_cast<const Parameter *>(parameter);
+        return allocateImpl<algorithmFPType>(nFeatures, in->get(data)->getNumberOfRows(), svdPar->nComponents);
+    }
+
+    Status st              = allocateImpl<algorithmFPType>(nFeatures, in->get(data)->getNumberOfRows());
+
+    const size_t nMatrices = parameter ? static_cast<const Parameter *>(parameter)->nMatrices : 1;
+    if (st && nMatrices > 1)
+    {
+        set(singularValues, HomogenNumericTable<algorithmFPType>::create(nFeatures, nMatrices, NumericTable::doAllocate, &st));
+        set(rightSingularMatrix, HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures * nMatrices, NumericTable::doAllocate, &st));
+    }
+    return st;
 }
 
 /**
@@ -70,13 +85,26 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::PartialResult * part
  */
 template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocateImpl(size_t m, size_t n)
+{
+    return allocateImpl<algorithmFPType>(m, n, m);
+}
+
+/**
+ * Allocates memory to store the nComponents largest singular triples
+ * \tparam     algorithmFPType  Data type to use for storage in the resulting HomogenNumericTable
+ * \param[in]  m            Number of columns in the input data set
+ * \param[in]  n            Number of rows in the input data set
+ * \param[in]  nComponents  Number of the singular triples
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status Result::allocateImpl(size_t m, size_t n, size_t nComponents)
 {
     Status st;
-    set(singularValues, HomogenNumericTable<algorithmFPType>::create(m, 1, NumericTable::doAllocate, &st));
-    set(rightSingularMatrix, HomogenNumericTable<algorithmFPType>::create(m, m, NumericTable::doAllocate, &st));
+    set(singularValues, HomogenNumericTable<algorithmFPType>::create(nComponents, 1, NumericTable::doAllocate, &st));
+    set(rightSingularMatrix, HomogenNumericTable<algorithmFPType>::create(m, nComponents, NumericTable::doAllocate, &st));
     if (n != 0)
     {
-        set(leftSingularMatrix, HomogenNumericTable<algorithmFPType>::create(m, n, NumericTable::doAllocate, &st));
+        set(leftSingularMatrix, HomogenNumericTable<algorithmFPType>::create(nComponents, n, NumericTable::doAllocate, &st));
     }
     return st;
 }
@@ -33,6 +33,7 @@
 #include "src/algorithms/svd/svd_dense_default_impl.i"
 
 #include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -69,6 +70,8 @@ Status SVDBatchKernel<algorithmFPType, method, cpu>::compute(const size_t na, co
     const size_t m = ntAi->getNumberOfRows();
     const size_t t = threader_get_threads_number();
 
+    if (svdPar->nMatrices > 1) return SVDBatchKernel<algorithmFPType, method, cpu>::compute_stack(svdPar->nMatrices, a, r, svdPar);
+
     if (m < 2 * n) return SVDBatchKernel<algorithmFPType, method, cpu>::compute_seq(na, a, nr, r, svdPar);
 
     if ((m > n * t) && (n > 10) && (!(n >= 200 && m <= 100000)))
@@ -167,6 +170,93 @@ Status SVDBatchKernel<algorithmFPType, method, cpu>::compute_seq(const size_t na
     return Status();
 }
 
+/**
+ *  \brief Decomposes the nMatrices matrices stacked in the input table independently, a matrix per task with the sequential LAPACK,
+ *  so the small matrices do not pay the threading overhead of the LAPACK calls
+ */
+template <typename algorithmFPType, daal::algorithms::svd::Method method, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, method, cpu>::compute_stack(const size_t nMatrices, const NumericTable * const * a, NumericTable * r[],
+                                                                   const Parameter * svdPar)
+{
+    NumericTable * ntA     = const_cast<NumericTable *>(a[0]);
+    NumericTable * ntSigma = const_cast<NumericTable *>(r[0]);
+
+    const size_t n = ntA->getNumberOfColumns();
+    const size_t m = ntA->getNumberOfRows() / nMatrices; /* Number of rows of a matrix */
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, 2 * m + n + 1);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * (2 * m + n + 1), sizeof(algorithmFPType));
+
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(n * (2 * m + n + 1));
+
+    SafeStatus safeStat;
+    daal::threader_for(nMatrices, nMatrices, [&](size_t iMatrix) {
+        algorithmFPType * AT = tlsBuffer.local(); /* AT [n][m] */
+        DAAL_CHECK_THR(AT, ErrorMemoryAllocationFailed);
+        algorithmFPType * QT    = AT + n * m; /* QT [n][m] */
+        algorithmFPType * VT    = QT + n * m; /* VT [n][n] */
+        algorithmFPType * Sigma = VT + n * n; /* Sigma [n] */
+
+        {
+            ReadRows<algorithmFPType, cpu, NumericTable> aBlock(ntA, iMatrix * m, m);
+            DAAL_CHECK_BLOCK_STATUS_THR(aBlock);
+            const algorithmFPType * A = aBlock.get();
+            for (size_t i = 0; i < n; i++)
+            {
+                for (size_t j = 0; j < m; j++)
+                {
+                    AT[i * m + j] = A[i + j * n];
+                }
+            }
+        }
+
+        const algorithmFPType zero(0.0);
+        service_memset_seq<algorithmFPType, cpu>(Sigma, zero, n);
+
+        const auto ecSvd = compute_svd_on_one_node_seq<algorithmFPType, cpu>(m, n, AT, m, Sigma, QT, m, VT, n);
+        DAAL_CHECK_STATUS_THR(ecSvd);
+
+        {
+            WriteOnlyRows<algorithmFPType, cpu, NumericTable> sigmaBlock(ntSigma, iMatrix, 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(sigmaBlock);
+            algorithmFPType * tSigma = sigmaBlock.get();
+            for (size_t i = 0; i < n; i++)
+            {
+                tSigma[i] = Sigma[i];
+            }
+        }
+
+        if (svdPar->leftSingularMatrix == requiredInPackedForm)
+        {
+            WriteOnlyRows<algorithmFPType, cpu, NumericTable> qBlock(r[1], iMatrix * m, m);
+            DAAL_CHECK_BLOCK_STATUS_THR(qBlock);
+            algorithmFPType * Q = qBlock.get();
+            for (size_t i = 0; i < n; i++)
+            {
+                for (size_t j = 0; j < m; j++)
+                {
+                    Q[i + j * n] = QT[i * m + j];
+                }
+            }
+        }
+
+        if (svdPar->rightSingularMatrix == requiredInPackedForm)
+        {
+            WriteOnlyRows<algorithmFPType, cpu, NumericTable> vBlock(r[2], iMatrix * n, n);
+            DAAL_CHECK_BLOCK_STATUS_THR(vBlock);
+            algorithmFPType * V = vBlock.get();
+            for (size_t i = 0; i < n; i++)
+            {
+                for (size_t j = 0; j < n; j++)
+                {
+                    V[i + j * n] = VT[i * n + j];
+                }
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
 /* Max number of blocks depending on arch */
 #if (__CPUID__(DAAL_CPU) >= __avx512_mic__)
     #define DEF_MAX_BLOCKS 256
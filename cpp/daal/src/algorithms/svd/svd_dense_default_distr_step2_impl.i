@@ -29,6 +29,7 @@
 #include "src/services/service_defines.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_tree_qr.h"
 
 #include "src/algorithms/svd/svd_dense_default_impl.i"
 
@@ -75,83 +76,69 @@ Status SVDDistributedStep2Kernel<algorithmFPType, method, cpu>::compute(const si
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * n, sizeof(algorithmFPType));
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nxb, sizeof(algorithmFPType));
 
+    const bool computeU = (svdPar->leftSingularMatrix == requiredInPackedForm);
+
     TArray<algorithmFPType, cpu> Aux2TPtr(n * nxb);
     TArray<algorithmFPType, cpu> VTPtr(n * n);
-    TArray<algorithmFPType, cpu> Aux3TPtr(n * nxb);
-    algorithmFPType * Aux2T = Aux2TPtr.get();
+    algorithmFPType * Aux2T = Aux2TPtr.get(); /* nBlocks column-major blocks R_k [n][n] */
     algorithmFPType * VT    = VTPtr.get();
-    algorithmFPType * Aux3T = Aux3TPtr.get();
 
-    DAAL_CHECK(Aux2T && VT && Aux3T, ErrorMemoryAllocationFailed);
+    DAAL_CHECK(Aux2T && VT, ErrorMemoryAllocationFailed);
 
     SafeStatus safeStat;
 
     daal::threader_for(nBlocks, nBlocks, [=, &safeStat](int k) {
-        ReadRows<algorithmFPType, cpu, NumericTable> aux2Block(const_cast<NumericTable *>(a[k]), 0, n); /* Aux2  [nxb][n] */
+        ReadRows<algorithmFPType, cpu, NumericTable> aux2Block(const_cast<NumericTable *>(a[k]), 0, n); /* Aux2  [n][n] */
         DAAL_CHECK_BLOCK_STATUS_THR(aux2Block);
         const algorithmFPType * Aux2 = aux2Block.get();
+        algorithmFPType * Aux2Tk     = Aux2T + k * n * n;
 
         for (size_t i = 0; i < n; i++)
         {
             for (size_t j = 0; j < n; j++)
             {
-                Aux2T[j * nxb + k * n + i] = Aux2[i * n + j];
+                Aux2Tk[j * n + i] = Aux2[i * n + j];
             }
         }
     });
 
     if (!safeStat) return safeStat.detach();
 
-    {
-        DAAL_INT ldAux2 = nxb;
-        DAAL_INT ldAux3 = nxb;
-        DAAL_INT ldV    = n;
+    DAAL_INT ldU = n;
+    TArray<algorithmFPType, cpu> UPtr(n * ldU);
+    algorithmFPType * U = UPtr.get();
+    DAAL_CHECK(U, ErrorMemoryAllocationFailed);
 
+    {
+        DAAL_INT ldV = n;
         DAAL_INT ldR = n;
-        DAAL_INT ldU = n;
 
         TArray<algorithmFPType, cpu> RPtr(n * ldR);
-        TArray<algorithmFPType, cpu> UPtr(n * ldU);
         algorithmFPType * R = RPtr.get();
-        algorithmFPType * U = UPtr.get();
-
-        DAAL_CHECK(U && R, ErrorMemoryAllocationFailed);
-
-        /* By some reason, there was this part in Sample */
-        for (size_t i = 0; i < n * ldR; i++)
-        {
-            R[i] = 0.0;
-        }
+        DAAL_CHECK(R, ErrorMemoryAllocationFailed);
 
-        // Rc = P*R
-        const auto ecQr = compute_QR_on_one_node<algorithmFPType, cpu>(nxb, n, Aux2T, ldAux2, R, ldR);
+        // Rc = P*R, the R factors of the nodes are merged pairwise along a binary tree, Aux2T gets the blocks of P
+        const auto ecQr = daal::algorithms::internal::treeQR<algorithmFPType, cpu>(nBlocks, n, Aux2T, R, computeU);
         if (!ecQr) return ecQr;
 
         // Qn*R -> Qn*(U*Sigma*V) -> (Qn*U)*Sigma*V
         const auto ecSvd = compute_svd_on_one_node<algorithmFPType, cpu>(n, n, R, ldR, Sigma, U, ldU, VT, ldV);
         if (!ecSvd) return ecSvd;
-
-        if (svdPar->leftSingularMatrix == requiredInPackedForm)
-        {
-            const auto ecGemm = compute_gemm_on_one_node<algorithmFPType, cpu>(nxb, n, Aux2T, ldAux2, U, ldU, Aux3T, ldAux3);
-            if (!ecGemm) return ecGemm;
-        }
     }
 
-    if (svdPar->leftSingularMatrix == requiredInPackedForm)
+    if (computeU)
     {
         daal::threader_for(nBlocks, nBlocks, [=, &safeStat](int k) {
-            WriteOnlyRows<algorithmFPType, cpu, NumericTable> aux3Block(r[2 + k], 0, n); /* Aux3  [nxb][n] */
+            WriteOnlyRows<algorithmFPType, cpu, NumericTable> aux3Block(r[2 + k], 0, n); /* Aux3  [n][n] */
             DAAL_CHECK_BLOCK_STATUS_THR(aux3Block);
             algorithmFPType * Aux3 = aux3Block.get();
 
-            for (size_t i = 0; i < n; i++)
-            {
-                for (size_t j = 0; j < n; j++)
-                {
-                    Aux3[i * n + j] = Aux3T[j * nxb + k * n + i];
-                }
-            }
+            // Aux3 is row-major, so it gets (Pk*U)^T = U^T * Pk^T in column-major order
+            const char trans           = 'T';
+            const algorithmFPType one  = 1.0;
+            const algorithmFPType zero = 0.0;
+            DAAL_INT nInt              = n;
+            Blas<algorithmFPType, cpu>::xxgemm(&trans, &trans, &nInt, &nInt, &nInt, &one, U, &ldU, Aux2T + k * n * n, &nInt, &zero, Aux3, &nInt);
         });
         if (!safeStat) return safeStat.detach();
     }
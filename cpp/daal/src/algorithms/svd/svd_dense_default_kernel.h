@@ -46,6 +46,7 @@ public:
     Status compute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const daal::algorithms::Parameter * par = 0);
 
     Status compute_seq(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const Parameter * par = 0);
+    Status compute_stack(const size_t nMatrices, const NumericTable * const * a, NumericTable * r[], const Parameter * par);
 
     Status compute_thr(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const Parameter * par = 0);
 
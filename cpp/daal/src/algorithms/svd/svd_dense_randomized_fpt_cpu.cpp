@@ -0,0 +1,38 @@
+/* file: svd_dense_randomized_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Instantiation of the randomized truncated SVD.
+//--
+*/
+
+#include "src/algorithms/svd/svd_dense_randomized_kernel.h"
+#include "src/algorithms/svd/svd_dense_randomized_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+template class DAAL_EXPORT RandomizedSVDKernel<DAAL_FPTYPE, DAAL_CPU>;
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,320 @@
+/* file: svd_dense_randomized_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of the randomized truncated SVD.
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_IMPL_I__
+
+#include "src/algorithms/svd/svd_dense_randomized_kernel.h"
+#include "src/externals/service_blas.h"
+#include "src/externals/service_lapack.h"
+#include "src/externals/service_rng.h"
+#include "src/services/service_arrays.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status RandomizedSVDKernel<algorithmFPType, cpu>::compute(const data_management::NumericTable & a, const algorithmFPType * shift,
+                                                                    const algorithmFPType * scale, const RandomizedParameter & par,
+                                                                    algorithmFPType * sigma, algorithmFPType * vectors) const
+{
+    const size_t n = a.getNumberOfRows();
+    const size_t p = a.getNumberOfColumns();
+    DAAL_CHECK(par.nComponents > 0 && par.nComponents <= p, services::ErrorIncorrectParameter);
+
+    /* The subspace has the oversampled columns for the accuracy of the last components */
+    const size_t l = (par.nComponents + par.nOversamples < p) ? par.nComponents + par.nOversamples : p;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, l);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * l, sizeof(algorithmFPType));
+
+    TArray<algorithmFPType, cpu> omegaArray(p * l);
+    TArray<algorithmFPType, cpu> yArray(n * l);
+    TArray<algorithmFPType, cpu> zArray(p * l);
+    DAAL_CHECK_MALLOC(omegaArray.get() && yArray.get() && zArray.get());
+    algorithmFPType * y = yArray.get();
+    algorithmFPType * z = zArray.get();
+
+    services::Status status;
+    DAAL_CHECK_STATUS(status, generateTestMatrix(p, l, par.seed, omegaArray.get()));
+
+    /* Every power iteration multiplies the basis by As * As' which makes the
+       components of the larger singular values dominate the subspace. The
+       bases are orthonormalized in between to keep the smaller ones. */
+    const algorithmFPType * w = omegaArray.get();
+    for (size_t it = 0;; ++it)
+    {
+        DAAL_CHECK_STATUS(status, multiply(a, shift, scale, l, w, y));
+        DAAL_CHECK_STATUS(status, orthonormalize(n, l, y));
+        DAAL_CHECK_STATUS(status, multiplyTransposed(a, shift, scale, l, y, z));
+        if (it == par.nPowerIterations) break;
+
+        DAAL_CHECK_STATUS(status, orthonormalize(p, l, z));
+        w = z;
+    }
+
+    /* As ~ Q * Q' * As = Q * z', so the right singular vectors of As are the
+       left singular vectors of z */
+    return computeSingularVectors(p, l, z, par.nComponents, sigma, vectors);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status RandomizedSVDKernel<algorithmFPType, cpu>::multiply(const data_management::NumericTable & a, const algorithmFPType * shift,
+                                                                     const algorithmFPType * scale, size_t l, const algorithmFPType * w,
+                                                                     algorithmFPType * y) const
+{
+    const size_t n = a.getNumberOfRows();
+    const size_t p = a.getNumberOfColumns();
+
+    /* As * w = A * (diag(scale) * w) - 1 * (shift' * diag(scale) * w) */
+    TArray<algorithmFPType, cpu> wsArray(p * l);
+    TArray<algorithmFPType, cpu> cArray(l);
+    DAAL_CHECK_MALLOC(wsArray.get() && cArray.get());
+    algorithmFPType * ws = wsArray.get();
+    algorithmFPType * c  = cArray.get();
+
+    for (size_t j = 0; j < l; ++j)
+    {
+        algorithmFPType sum = 0;
+        for (size_t i = 0; i < p; ++i)
+        {
+            ws[j * p + i] = scale ? w[j * p + i] * scale[i] : w[j * p + i];
+            sum += shift ? shift[i] * ws[j * p + i] : algorithmFPType(0);
+        }
+        c[j] = sum;
+    }
+
+    const size_t blockSize = 512;
+    const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (startRow + blockSize > n) ? n - startRow : blockSize;
+
+        ReadRows<algorithmFPType, cpu> aBlock(const_cast<NumericTable &>(a), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(aBlock);
+
+        /* The row-major block of A is the column-major p x nRows matrix */
+        const char transa          = 'T';
+        const char transb          = 'N';
+        const DAAL_INT m           = nRows;
+        const DAAL_INT nCols       = l;
+        const DAAL_INT k           = p;
+        const DAAL_INT ldy         = n;
+        const algorithmFPType one  = 1;
+        const algorithmFPType zero = 0;
+        algorithmFPType * yBlock   = y + startRow;
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nCols, &k, &one, aBlock.get(), &k, ws, &k, &zero, yBlock, &ldy);
+
+        if (shift)
+        {
+            for (size_t j = 0; j < l; ++j)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRows; ++i)
+                {
+                    yBlock[j * n + i] -= c[j];
+                }
+            }
+        }
+    });
+
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status RandomizedSVDKernel<algorithmFPType, cpu>::multiplyTransposed(const data_management::NumericTable & a, const algorithmFPType * shift,
+                                                                               const algorithmFPType * scale, size_t l, const algorithmFPType * y,
+                                                                               algorithmFPType * z) const
+{
+    const size_t n = a.getNumberOfRows();
+    const size_t p = a.getNumberOfColumns();
+
+    /* As' * y = diag(scale) * (A' * y - shift * (1' * y)), the partial products
+       and the column sums of y are accumulated by the threads */
+    const size_t blockSize = 512;
+    const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+
+    TlsSum<algorithmFPType, cpu> tlsSums(p * l + l);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * local = tlsSums.local();
+        DAAL_CHECK_THR(local, services::ErrorMemoryAllocationFailed);
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (startRow + blockSize > n) ? n - startRow : blockSize;
+
+        ReadRows<algorithmFPType, cpu> aBlock(const_cast<NumericTable &>(a), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(aBlock);
+
+        const char trans               = 'N';
+        const DAAL_INT m               = p;
+        const DAAL_INT nCols           = l;
+        const DAAL_INT k               = nRows;
+        const DAAL_INT ldy             = n;
+        const algorithmFPType one      = 1;
+        const algorithmFPType * yBlock = y + startRow;
+        Blas<algorithmFPType, cpu>::xxgemm(&trans, &trans, &m, &nCols, &k, &one, aBlock.get(), &m, yBlock, &ldy, &one, local, &m);
+
+        algorithmFPType * sums = local + p * l;
+        for (size_t j = 0; j < l; ++j)
+        {
+            algorithmFPType sum = 0;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                sum += yBlock[j * n + i];
+            }
+            sums[j] += sum;
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    TArray<algorithmFPType, cpu> sumsArray(p * l + l);
+    DAAL_CHECK_MALLOC(sumsArray.get());
+    algorithmFPType * product = sumsArray.get();
+    for (size_t i = 0; i < p * l + l; ++i)
+    {
+        product[i] = 0;
+    }
+    tlsSums.reduceTo(product, p * l + l);
+
+    const algorithmFPType * sums = product + p * l;
+    for (size_t j = 0; j < l; ++j)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < p; ++i)
+        {
+            const algorithmFPType value = shift ? product[j * p + i] - shift[i] * sums[j] : product[j * p + i];
+            z[j * p + i]                = scale ? value * scale[i] : value;
+        }
+    }
+
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status RandomizedSVDKernel<algorithmFPType, cpu>::generateTestMatrix(size_t p, size_t l, size_t seed, algorithmFPType * omega) const
+{
+    daal::internal::BaseRNGs<cpu> brng(seed);
+    daal::internal::RNGs<algorithmFPType, cpu> rng;
+    DAAL_CHECK(!rng.gaussian(p * l, omega, brng, algorithmFPType(0), algorithmFPType(1)), services::ErrorIncorrectErrorcodeFromGenerator);
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status RandomizedSVDKernel<algorithmFPType, cpu>::orthonormalize(size_t m, size_t l, algorithmFPType * a) const
+{
+    typedef Lapack<algorithmFPType, cpu> lapack;
+
+    /* The matrix of less rows than columns gets the basis of m columns, the rest are zero */
+    const DAAL_INT nRows       = m;
+    const DAAL_INT nCols       = l;
+    const DAAL_INT nReflectors = (m < l) ? m : l;
+
+    TArray<algorithmFPType, cpu> tau(nReflectors);
+    DAAL_CHECK_MALLOC(tau.get());
+
+    DAAL_INT info             = 0;
+    algorithmFPType workQuery = 0;
+    lapack::xgeqrf(nRows, nCols, a, nRows, tau.get(), &workQuery, -1, &info);
+    DAAL_INT workSize = static_cast<DAAL_INT>(workQuery);
+    lapack::xorgqr(nRows, nReflectors, nReflectors, a, nRows, tau.get(), &workQuery, -1, &info);
+    workSize = (static_cast<DAAL_INT>(workQuery) > workSize) ? static_cast<DAAL_INT>(workQuery) : workSize;
+
+    TArray<algorithmFPType, cpu> work(workSize);
+    DAAL_CHECK_MALLOC(work.get());
+
+    lapack::xgeqrf(nRows, nCols, a, nRows, tau.get(), work.get(), workSize, &info);
+    DAAL_CHECK(info == 0, services::ErrorQRInternal);
+    lapack::xorgqr(nRows, nReflectors, nReflectors, a, nRows, tau.get(), work.get(), workSize, &info);
+    DAAL_CHECK(info == 0, services::ErrorQRInternal);
+
+    for (size_t i = m * nReflectors; i < m * l; ++i)
+    {
+        a[i] = 0;
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status RandomizedSVDKernel<algorithmFPType, cpu>::computeSingularVectors(size_t p, size_t l, algorithmFPType * z, size_t nComponents,
+                                                                                   algorithmFPType * sigma, algorithmFPType * vectors) const
+{
+    typedef Lapack<algorithmFPType, cpu> lapack;
+
+    const DAAL_INT nRows = p;
+    const DAAL_INT nCols = l;
+    const DAAL_INT ldvt  = 1;
+
+    TArray<algorithmFPType, cpu> sArray(l);
+    TArray<algorithmFPType, cpu> uArray(p * l);
+    DAAL_CHECK_MALLOC(sArray.get() && uArray.get());
+
+    DAAL_INT info             = 0;
+    algorithmFPType workQuery = 0;
+    algorithmFPType vt        = 0;
+    lapack::xgesvd('S', 'N', nRows, nCols, z, nRows, sArray.get(), uArray.get(), nRows, &vt, ldvt, &workQuery, -1, &info);
+
+    const DAAL_INT workSize = static_cast<DAAL_INT>(workQuery);
+    TArray<algorithmFPType, cpu> work(workSize);
+    DAAL_CHECK_MALLOC(work.get());
+
+    lapack::xgesvd('S', 'N', nRows, nCols, z, nRows, sArray.get(), uArray.get(), nRows, &vt, ldvt, work.get(), workSize, &info);
+    DAAL_CHECK(info >= 0, services::ErrorSvdIthParamIllegalValue);
+    DAAL_CHECK(info == 0, services::ErrorSvdXBDSQRDidNotConverge);
+
+    /* The singular values are in the descending order */
+    const algorithmFPType * u = uArray.get();
+    for (size_t j = 0; j < nComponents; ++j)
+    {
+        sigma[j] = sArray[j];
+        for (size_t i = 0; i < p; ++i)
+        {
+            vectors[j * p + i] = u[j * p + i];
+        }
+    }
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,110 @@
+/* file: svd_dense_randomized_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Declaration of template structs that calculate the randomized truncated SVD.
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_KERNEL_H__
+#define __SVD_DENSE_RANDOMIZED_KERNEL_H__
+
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+/**
+ * Parameters of the randomized range finder, the subspace has
+ * nComponents + nOversamples columns
+ */
+struct RandomizedParameter
+{
+    RandomizedParameter(size_t nComponents_ = 1, size_t nOversamples_ = 10, size_t nPowerIterations_ = 4, size_t seed_ = 777)
+        : nComponents(nComponents_), nOversamples(nOversamples_), nPowerIterations(nPowerIterations_), seed(seed_)
+    {}
+
+    size_t nComponents;
+    size_t nOversamples;
+    size_t nPowerIterations;
+    size_t seed;
+};
+
+/**
+ * The host steps of the randomized SVD, the matrices are column-major
+ */
+template <typename algorithmFPType>
+class RandomizedSVDBaseIface
+{
+public:
+    virtual ~RandomizedSVDBaseIface() {}
+
+    /* Fills the p x l matrix with the standard normal numbers */
+    virtual services::Status generateTestMatrix(size_t p, size_t l, size_t seed, algorithmFPType * omega) const = 0;
+
+    /* Replaces the m x l matrix with the orthonormal basis of its columns */
+    virtual services::Status orthonormalize(size_t m, size_t l, algorithmFPType * a) const = 0;
+
+    /* Computes the nComponents largest singular values and the left singular
+       vectors of the p x l matrix z, the vectors are written as the rows */
+    virtual services::Status computeSingularVectors(size_t p, size_t l, algorithmFPType * z, size_t nComponents, algorithmFPType * sigma,
+                                                    algorithmFPType * vectors) const = 0;
+};
+
+/**
+ * Computes the nComponents largest singular values and the right singular
+ * vectors of the n x p matrix As = (A - 1 * shift') * diag(scale) with the
+ * randomized range finder with power iterations (Halko et al.). The shift and
+ * the scale are applied on the fly, the null ones are not applied. The cost
+ * is O(n * p * l) for the subspace of l columns against O(n * p^2) of the full
+ * decomposition.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class RandomizedSVDKernel : public Kernel, public RandomizedSVDBaseIface<algorithmFPType>
+{
+public:
+    services::Status compute(const data_management::NumericTable & a, const algorithmFPType * shift, const algorithmFPType * scale,
+                             const RandomizedParameter & par, algorithmFPType * sigma, algorithmFPType * vectors) const;
+
+    services::Status generateTestMatrix(size_t p, size_t l, size_t seed, algorithmFPType * omega) const DAAL_C11_OVERRIDE;
+    services::Status orthonormalize(size_t m, size_t l, algorithmFPType * a) const DAAL_C11_OVERRIDE;
+    services::Status computeSingularVectors(size_t p, size_t l, algorithmFPType * z, size_t nComponents, algorithmFPType * sigma,
+                                            algorithmFPType * vectors) const DAAL_C11_OVERRIDE;
+
+private:
+    /* y = As * w for the p x l matrix w, y is n x l */
+    services::Status multiply(const data_management::NumericTable & a, const algorithmFPType * shift, const algorithmFPType * scale, size_t l,
+                              const algorithmFPType * w, algorithmFPType * y) const;
+
+    /* z = As' * y for the n x l matrix y, z is p x l */
+    services::Status multiplyTransposed(const data_management::NumericTable & a, const algorithmFPType * shift, const algorithmFPType * scale,
+                                        size_t l, const algorithmFPType * y, algorithmFPType * z) const;
+};
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -99,7 +99,30 @@ Status Input::getNumberOfRows(size_t * nRows) const
 Status Input::check(const daal::algorithms::Parameter * parameter, int method) const
 {
     NumericTablePtr dataTable = get(data);
-    return checkNumericTable(dataTable.get(), dataStr());
+    Status s                  = checkNumericTable(dataTable.get(), dataStr());
+    if (!s)
+    {
+        return s;
+    }
+
+    if (method == randomizedCSR)
+    {
+        DAAL_CHECK_EX(dataTable->getDataLayout() == NumericTableIface::csrArray, ErrorIncorrectTypeOfInputNumericTable, ArgumentName, dataStr());
+        const size_t nComponents = parameter ? static_cast<const Parameter *>(parameter)->nComponents : 1;
+        DAAL_CHECK_EX(nComponents > 0 && nComponents <= dataTable->getNumberOfColumns() && nComponents <= dataTable->getNumberOfRows(),
+                      ErrorIncorrectParameter, ParameterName, nComponentsStr());
+        return s;
+    }
+
+    const size_t nMatrices = parameter ? static_cast<const Parameter *>(parameter)->nMatrices : 1;
+    if (nMatrices != 1)
+    {
+        DAAL_CHECK_EX(nMatrices > 0, ErrorIncorrectParameter, ParameterName, nMatricesStr());
+        DAAL_CHECK_EX(dataTable->getNumberOfRows() % nMatrices == 0, ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
+        DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows() / nMatrices, ErrorIncorrectNumberOfRows, ArgumentName,
+                      dataStr());
+    }
+    return s;
 }
 
 } // namespace interface1
@@ -74,11 +74,27 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
     size_t nVectors        = algInput->get(data)->getNumberOfRows();
     size_t nFeatures       = algInput->get(data)->getNumberOfColumns();
     int unexpectedLayouts  = (int)packed_mask;
+    const size_t nMatrices = svdPar->nMatrices;
 
-    Status s = checkNumericTable(get(singularValues).get(), singularValuesStr(), unexpectedLayouts, 0, nFeatures, 1);
+    if (method == randomizedCSR)
+    {
+        const size_t nComponents = svdPar->nComponents;
+        Status s = checkNumericTable(get(singularValues).get(), singularValuesStr(), unexpectedLayouts, 0, nComponents, 1);
+        if (svdPar->rightSingularMatrix == requiredInPackedForm)
+        {
+            s |= checkNumericTable(get(rightSingularMatrix).get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nComponents);
+        }
+        if (svdPar->leftSingularMatrix == requiredInPackedForm)
+        {
+            s |= checkNumericTable(get(leftSingularMatrix).get(), leftSingularMatrixStr(), unexpectedLayouts, 0, nComponents, nVectors);
+        }
+        return s;
+    }
+
+    Status s = checkNumericTable(get(singularValues).get(), singularValuesStr(), unexpectedLayouts, 0, nFeatures, nMatrices);
     if (svdPar->rightSingularMatrix == requiredInPackedForm)
     {
-        s |= checkNumericTable(get(rightSingularMatrix).get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
+        s |= checkNumericTable(get(rightSingularMatrix).get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nFeatures * nMatrices);
     }
     if (svdPar->leftSingularMatrix == requiredInPackedForm)
     {
@@ -25,6 +25,7 @@
 #include "src/algorithms/svm/svm_train_kernel.h"
 #include "src/algorithms/svm/svm_train_boser_kernel.h"
 #include "algorithms/classifier/classifier_training_types.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -82,7 +83,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     par2.cacheSize         = par1->cacheSize;
 
     services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, x, weights, *y, r, &par2);
+    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       daal::services::internal::hostApp(*input), x, weights, *y, r, &par2);
 }
 } // namespace interface1
 } // namespace training
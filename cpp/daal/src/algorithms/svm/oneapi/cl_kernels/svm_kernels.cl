@@ -76,8 +76,21 @@ DECLARE_SOURCE_DAAL(
 
         const uint iRow = xInd[index];
 
-        const __global algorithmFPType * const xi = &x[iRow * ldx];
-        __global algorithmFPType * newXi          = &newX[index * ldx];
+        const __global algorithmFPType * const xi = &x[(ulong)iRow * ldx];
+        __global algorithmFPType * newXi          = &newX[(ulong)index * ldx];
+
+        newXi[jCol] = xi[jCol];
+    }
+
+    __kernel void copyDataToIndices(const __global algorithmFPType * const x, const __global uint * const newXInd, const uint ldx,
+                                    __global algorithmFPType * newX) {
+        const uint index = get_global_id(1);
+        const uint jCol  = get_global_id(0);
+
+        const uint iRow = newXInd[index];
+
+        const __global algorithmFPType * const xi = &x[(ulong)index * ldx];
+        __global algorithmFPType * newXi          = &newX[(ulong)iRow * ldx];
 
         newXi[jCol] = xi[jCol];
     }
@@ -173,6 +173,34 @@ struct HelperSVM
         return status;
     }
 
+    static services::Status copyDataToIndices(const services::internal::Buffer<algorithmFPType> & x,
+                                              const services::internal::Buffer<uint32_t> & indNewX,
+                                              services::internal::Buffer<algorithmFPType> & newX, const size_t nWS, const size_t p)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(copyDataToIndices);
+        services::Status status;
+
+        services::internal::sycl::ExecutionContextIface & ctx    = services::internal::getDefaultContext();
+        services::internal::sycl::ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+
+        buildProgram(factory);
+
+        const char * const kernelName              = "copyDataToIndices";
+        services::internal::sycl::KernelPtr kernel = factory.getKernel(kernelName);
+
+        services::internal::sycl::KernelArguments args(4);
+        args.set(0, x, services::internal::sycl::AccessModeIds::read);
+        args.set(1, indNewX, services::internal::sycl::AccessModeIds::read);
+        DAAL_ASSERT(p <= uint32max);
+        args.set(2, static_cast<uint32_t>(p));
+        args.set(3, newX, services::internal::sycl::AccessModeIds::write);
+
+        services::internal::sycl::KernelRange range(p, nWS);
+
+        ctx.run(range, kernel, args, &status);
+        return status;
+    }
+
     static services::Status copyDataByIndices(const services::internal::Buffer<algorithmFPType> & x, const services::internal::Buffer<int> & indX,
                                               services::internal::Buffer<algorithmFPType> & newX, const size_t nWS, const size_t p)
     {
@@ -25,6 +25,7 @@
 #define __SVM_TRAIN_CACHE_ONEAPI_H__
 
 #include "src/services/service_utils.h"
+#include "src/services/service_arrays.h"
 #include "src/externals/service_memory.h"
 #include "src/data_management/service_micro_table.h"
 #include "src/data_management/service_numeric_table.h"
@@ -237,6 +238,273 @@ protected:
     services::internal::Buffer<algorithmFPType> _cacheBuff;
 };
 
+/**
+ * Least recently used replacement of the cache lines: the lines form the doubly linked list
+ * in the order of their last use
+ */
+class LRUCacheOneAPI
+{
+public:
+    LRUCacheOneAPI(const size_t capacity, const size_t nKeys) : _capacity(capacity), _nKeys(nKeys), _count(0), _head(-1), _tail(-1) {}
+
+    services::Status init()
+    {
+        _lineOfKey.reset(_nKeys);
+        DAAL_CHECK_MALLOC(_lineOfKey.get());
+        _keyOfLine.reset(_capacity);
+        DAAL_CHECK_MALLOC(_keyOfLine.get());
+        _prev.reset(_capacity);
+        DAAL_CHECK_MALLOC(_prev.get());
+        _next.reset(_capacity);
+        DAAL_CHECK_MALLOC(_next.get());
+        for (size_t i = 0; i < _nKeys; ++i)
+        {
+            _lineOfKey[i] = -1;
+        }
+        return services::Status();
+    }
+
+    /* Returns the line of the key and makes it the most recently used one, -1 if the key is not cached */
+    int64_t get(const uint32_t key)
+    {
+        const int64_t line = _lineOfKey[key];
+        if (line != -1)
+        {
+            unlink(line);
+            pushFront(line);
+        }
+        return line;
+    }
+
+    /* Puts the key into the free line or into the least recently used one and returns the line */
+    int64_t put(const uint32_t key)
+    {
+        int64_t line = -1;
+        if (_count < _capacity)
+        {
+            line = _count++;
+        }
+        else
+        {
+            line = _tail;
+            unlink(line);
+            _lineOfKey[_keyOfLine[line]] = -1;
+        }
+        _keyOfLine[line] = key;
+        _lineOfKey[key]  = line;
+        pushFront(line);
+        return line;
+    }
+
+private:
+    void unlink(const int64_t line)
+    {
+        const int64_t prev = _prev[line];
+        const int64_t next = _next[line];
+        (prev != -1 ? _next[prev] : _head) = next;
+        (next != -1 ? _prev[next] : _tail) = prev;
+    }
+
+    void pushFront(const int64_t line)
+    {
+        _prev[line] = -1;
+        _next[line] = _head;
+        (_head != -1 ? _prev[_head] : _tail) = line;
+        _head = line;
+    }
+
+    const size_t _capacity;
+    const size_t _nKeys;
+    size_t _count;
+    int64_t _head;
+    int64_t _tail;
+    services::internal::TArray<int64_t, sse2> _lineOfKey;
+    services::internal::TArray<uint32_t, sse2> _keyOfLine;
+    services::internal::TArray<int64_t, sse2> _prev;
+    services::internal::TArray<int64_t, sse2> _next;
+};
+
+/**
+ * LRU cache: kernel function values of the recently used rows are kept in the device memory,
+ * only the rows that are absent in the cache are computed
+ */
+template <typename algorithmFPType>
+class SVMCacheOneAPI<lruCache, algorithmFPType> : public SVMCacheOneAPIIface<algorithmFPType>
+{
+    using Helper   = utils::internal::HelperSVM<algorithmFPType>;
+    using super    = SVMCacheOneAPIIface<algorithmFPType>;
+    using thisType = SVMCacheOneAPI<lruCache, algorithmFPType>;
+    using super::_kernel;
+    using super::_lineSize;
+    using super::_blockSize;
+
+public:
+    ~SVMCacheOneAPI() {}
+
+    DAAL_NEW_DELETE();
+
+    static SVMCacheOneAPIPtr<algorithmFPType> create(const size_t cacheSize, const size_t blockSize, const size_t lineSize,
+                                                     const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel,
+                                                     services::Status & status)
+    {
+        status.clear();
+        services::SharedPtr<thisType> res = services::SharedPtr<thisType>(new thisType(cacheSize, blockSize, lineSize, kernel));
+        if (!res)
+        {
+            status.add(ErrorMemoryAllocationFailed);
+        }
+        else
+        {
+            status = res->init(xTable);
+            if (!status)
+            {
+                res.reset();
+            }
+        }
+        return SVMCacheOneAPIPtr<algorithmFPType>(res);
+    }
+
+    const services::internal::Buffer<algorithmFPType> & getRowsBlock() const override { return _blockBuff; }
+
+    services::Status compute(const NumericTablePtr & xTable, const services::internal::Buffer<uint32_t> & wsIndices, const size_t p) override
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(cacheCompute);
+
+        services::Status status;
+
+        size_t nMissed = 0;
+        {
+            auto wsIndicesHostPtr = wsIndices.toHost(ReadWriteMode::readOnly, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            auto cacheLinesHostPtr = _cacheLinesBuff.toHost(ReadWriteMode::writeOnly, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            auto missedIndicesHostPtr = _missedIndicesBuff.toHost(ReadWriteMode::writeOnly, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            auto missedLinesHostPtr = _missedLinesBuff.toHost(ReadWriteMode::writeOnly, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+
+            const uint32_t * const wsIndicesHost = wsIndicesHostPtr.get();
+            uint32_t * const cacheLinesHost      = cacheLinesHostPtr.get();
+            uint32_t * const missedIndicesHost   = missedIndicesHostPtr.get();
+            uint32_t * const missedLinesHost     = missedLinesHostPtr.get();
+
+            /* The cache holds at least _blockSize lines, so the rows of the working set
+               are never evicted by the other rows of it */
+            for (size_t i = 0; i < _blockSize; ++i)
+            {
+                const uint32_t wsIndex = wsIndicesHost[i];
+                int64_t cacheIndex     = _lruCache.get(wsIndex);
+                if (cacheIndex == -1)
+                {
+                    cacheIndex                 = _lruCache.put(wsIndex);
+                    missedIndicesHost[nMissed] = wsIndex;
+                    missedLinesHost[nMissed]   = static_cast<uint32_t>(cacheIndex);
+                    ++nMissed;
+                }
+                DAAL_ASSERT(cacheIndex < _cacheSize);
+                cacheLinesHost[i] = static_cast<uint32_t>(cacheIndex);
+            }
+        }
+
+        if (nMissed > 0)
+        {
+            BlockDescriptor<algorithmFPType> xBlock;
+            DAAL_CHECK_STATUS(status, xTable->getBlockOfRows(0, xTable->getNumberOfRows(), ReadWriteMode::readOnly, xBlock));
+            const services::internal::Buffer<algorithmFPType> & xBuff = xBlock.getBuffer();
+            DAAL_CHECK_STATUS(status, Helper::copyDataByIndices(xBuff, _missedIndicesBuff, _xBlockBuff, nMissed, p));
+            DAAL_CHECK_STATUS(status, xTable->releaseBlockOfRows(xBlock));
+
+            /* The block of the working set rows is the buffer for the rows computed before they are put into the cache */
+            DAAL_CHECK_STATUS(status, initKernel(nMissed, xTable));
+            DAAL_CHECK_STATUS(status, _kernel->computeNoThrow());
+            DAAL_CHECK_STATUS(status, Helper::copyDataToIndices(_blockBuff, _missedLinesBuff, _cacheBuff, nMissed, _lineSize));
+        }
+
+        DAAL_CHECK_STATUS(status, Helper::copyDataByIndices(_cacheBuff, _cacheLinesBuff, _blockBuff, _blockSize, _lineSize));
+        return status;
+    }
+
+    /* The rows of the previous working set stay in the cache */
+    services::Status copyLastToFirst() override { return services::Status(); }
+
+protected:
+    SVMCacheOneAPI(const size_t cacheSize, const size_t blockSize, const size_t lineSize, const kernel_function::KernelIfacePtr & kernel)
+        : super(blockSize, lineSize, kernel), _cacheSize(cacheSize), _lruCache(cacheSize, lineSize)
+    {}
+
+    services::Status init(const NumericTablePtr & xTable)
+    {
+        services::Status status;
+        auto & context = services::internal::getDefaultContext();
+
+        DAAL_CHECK_STATUS(status, _lruCache.init());
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _lineSize, _cacheSize);
+        _cache = context.allocate(TypeIds::id<algorithmFPType>(), _lineSize * _cacheSize, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        _cacheBuff = _cache.get<algorithmFPType>();
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _lineSize, _blockSize);
+        _block = context.allocate(TypeIds::id<algorithmFPType>(), _lineSize * _blockSize, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        _blockBuff = _block.get<algorithmFPType>();
+
+        const size_t p = xTable->getNumberOfColumns();
+        _xBlock        = context.allocate(TypeIds::id<algorithmFPType>(), _blockSize * p, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        _xBlockBuff = _xBlock.get<algorithmFPType>();
+
+        auto cacheLines = context.allocate(TypeIds::id<uint32_t>(), _blockSize, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        _cacheLinesBuff = cacheLines.template get<uint32_t>();
+
+        auto missedIndices = context.allocate(TypeIds::id<uint32_t>(), _blockSize, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        _missedIndicesBuff = missedIndices.template get<uint32_t>();
+
+        auto missedLines = context.allocate(TypeIds::id<uint32_t>(), _blockSize, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        _missedLinesBuff = missedLines.template get<uint32_t>();
+
+        return status;
+    }
+
+    /* Sets up the kernel function to compute the nRows rows of the kernel matrix for the first rows of _xBlockBuff */
+    services::Status initKernel(const size_t nRows, const NumericTablePtr & xTable)
+    {
+        services::Status status;
+        auto blockTable = SyclHomogenNumericTable<algorithmFPType>::create(_blockBuff, _lineSize, nRows, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        const size_t p                 = xTable->getNumberOfColumns();
+        const NumericTablePtr xWSTable = SyclHomogenNumericTable<algorithmFPType>::create(_xBlockBuff, p, nRows, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+        _kernel->getInput()->set(kernel_function::X, xWSTable);
+        _kernel->getInput()->set(kernel_function::Y, xTable);
+
+        kernel_function::ResultPtr shRes(new kernel_function::Result());
+        shRes->set(kernel_function::values, blockTable);
+        _kernel->setResult(shRes);
+
+        return status;
+    }
+
+protected:
+    const size_t _cacheSize; /*!< Number of cache lines */
+    LRUCacheOneAPI _lruCache;
+    UniversalBuffer _cache;
+    UniversalBuffer _block;
+    UniversalBuffer _xBlock;
+    services::internal::Buffer<algorithmFPType> _cacheBuff;
+    services::internal::Buffer<algorithmFPType> _blockBuff;
+    services::internal::Buffer<algorithmFPType> _xBlockBuff;
+    services::internal::Buffer<uint32_t> _cacheLinesBuff;
+    services::internal::Buffer<uint32_t> _missedIndicesBuff;
+    services::internal::Buffer<uint32_t> _missedLinesBuff;
+};
+
 } // namespace internal
 } // namespace training
 } // namespace svm
@@ -215,8 +215,18 @@ services::Status SVMTrainOneAPI<algorithmFPType, thunder>::compute(const Numeric
     size_t sameLocalDiff = 0;
     SVMCacheOneAPIPtr<algorithmFPType> cachePtr;
 
-    // TODO: support caching for thunder method
-    cachePtr = SVMCacheOneAPI<noCache, algorithmFPType>::create(cacheSize, nWS, nVectors, xTable, kernel, status);
+    /* The cache keeps the kernel matrix rows of the previous working sets if cacheSize
+       is enough for the rows of the whole working set */
+    const size_t nCacheLines = utils::internal::min(nVectors, cacheSize / nVectors / sizeof(algorithmFPType));
+    if (nCacheLines >= nWS)
+    {
+        cachePtr = SVMCacheOneAPI<lruCache, algorithmFPType>::create(nCacheLines, nWS, nVectors, xTable, kernel, status);
+    }
+    else
+    {
+        cachePtr = SVMCacheOneAPI<noCache, algorithmFPType>::create(cacheSize, nWS, nVectors, xTable, kernel, status);
+    }
+    DAAL_CHECK_STATUS_VAR(status);
 
     size_t iter = 0;
     for (; iter < maxIterations; iter++)
@@ -26,6 +26,7 @@
 #include "src/algorithms/svm/svm_train_boser_kernel.h"
 #include "algorithms/classifier/classifier_training_types.h"
 #include "src/algorithms/svm/oneapi/svm_train_thunder_kernel_oneapi.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -86,7 +87,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     }
     else
     {
-        __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, x, weights, *y, r, par);
+        __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                           daal::services::internal::hostApp(*input), x, weights, *y, r, par);
     }
 }
 } // namespace interface2
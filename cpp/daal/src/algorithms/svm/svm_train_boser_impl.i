@@ -63,8 +63,9 @@ using namespace daal::internal;
 using namespace daal::services::internal;
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status SVMTrainImpl<boser, algorithmFPType, cpu>::compute(const NumericTablePtr & xTable, const NumericTablePtr & wTable,
-                                                                    NumericTable & yTable, daal::algorithms::Model * r, const svm::Parameter * svmPar)
+services::Status SVMTrainImpl<boser, algorithmFPType, cpu>::compute(services::HostAppIface * pHost, const NumericTablePtr & xTable,
+                                                                    const NumericTablePtr & wTable, NumericTable & yTable,
+                                                                    daal::algorithms::Model * r, const svm::Parameter * svmPar)
 {
     SVMTrainTask<algorithmFPType, cpu> task(xTable->getNumberOfRows());
     services::Status s = task.setup(*svmPar, xTable);
@@ -46,8 +46,10 @@ namespace internal
 template <typename algorithmFPType, CpuType cpu>
 struct SVMTrainImpl<boser, algorithmFPType, cpu> : public Kernel
 {
-    services::Status compute(const data_management::NumericTablePtr & xTable, const data_management::NumericTablePtr & wTable,
-                             data_management::NumericTable & yTable, algorithms::Model * r, const svm::Parameter * par);
+    /* The pairs of the coefficients updated by the iterations of the Boser method are too small to check the cancellation */
+    services::Status compute(services::HostAppIface * pHost, const data_management::NumericTablePtr & xTable,
+                             const data_management::NumericTablePtr & wTable, data_management::NumericTable & yTable, algorithms::Model * r,
+                             const svm::Parameter * par);
 };
 
 } // namespace internal
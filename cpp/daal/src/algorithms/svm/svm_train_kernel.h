@@ -27,6 +27,7 @@
 #include "data_management/data/numeric_table.h"
 #include "algorithms/model.h"
 #include "services/daal_defines.h"
+#include "services/host_app.h"
 #include "algorithms/svm/svm_train_types.h"
 #include "src/algorithms/kernel.h"
 #include "src/data_management/service_numeric_table.h"
@@ -101,8 +102,8 @@ protected:
 template <Method method, typename algorithmFPType, CpuType cpu>
 struct SVMTrainImpl : public Kernel
 {
-    services::Status compute(const NumericTablePtr & xTable, const NumericTablePtr & wTable, NumericTable & yTable, daal::algorithms::Model * r,
-                             const svm::Parameter * par)
+    services::Status compute(services::HostAppIface * pHost, const NumericTablePtr & xTable, const NumericTablePtr & wTable, NumericTable & yTable,
+                             daal::algorithms::Model * r, const svm::Parameter * par)
     {
         return services::ErrorMethodNotImplemented;
     }
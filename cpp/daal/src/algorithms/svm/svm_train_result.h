@@ -57,6 +57,12 @@ public:
     {}
 
     services::Status compute(const NumericTable & xTable, Model & model, const algorithmFPType * cw) const
+    {
+        return compute(xTable, model, calculateBias(cw));
+    }
+
+    /* Writes the model with the bias computed by the caller */
+    services::Status compute(const NumericTable & xTable, Model & model, const algorithmFPType bias) const
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(saveResult);
 
@@ -80,8 +86,7 @@ public:
         {
             DAAL_CHECK_STATUS(s, setSV_Dense(model, xTable, nSV));
         }
-        /* Calculate bias and write it into model */
-        model.setBias(double(calculateBias(cw)));
+        model.setBias(double(bias));
         return s;
     }
 
@@ -262,6 +267,7 @@ protected:
         return s;
     }
 
+public:
     /**
      * \brief Calculate SVM model bias
      *
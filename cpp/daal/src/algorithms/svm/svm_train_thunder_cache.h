@@ -30,6 +30,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/svm/svm_train_cache.h"
 #include "src/externals/service_service.h"
+#include "src/threading/threading.h"
 #include "data_management/data/soa_numeric_table.h"
 
 namespace daal
@@ -243,6 +244,119 @@ protected:
     TArrayScalable<algorithmFPType *, cpu> _soaData;
 };
 
+/**
+ * Cache for the epsilon-SVR task: the variables i and i + nSamples of the task refer to the observation i,
+ * the rows of the task are the rows of the underlying cache repeated twice
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVMRegressionCache : public SVMCacheIface<thunder, algorithmFPType, cpu>
+{
+    using super    = SVMCacheIface<thunder, algorithmFPType, cpu>;
+    using thisType = SVMRegressionCache<algorithmFPType, cpu>;
+    using super::_lineSize;
+
+public:
+    ~SVMRegressionCache() {}
+
+    DAAL_NEW_DELETE();
+
+    static SVMCachePtr<thunder, algorithmFPType, cpu> create(const SVMCachePtr<thunder, algorithmFPType, cpu> & samplesCache, const size_t nSize,
+                                                             const size_t nSamples, const kernel_function::KernelIfacePtr & kernel,
+                                                             services::Status & status)
+    {
+        services::SharedPtr<thisType> res = services::SharedPtr<thisType>(new thisType(samplesCache, nSize, nSamples, kernel));
+        if (!res)
+        {
+            status.add(ErrorMemoryAllocationFailed);
+        }
+        else
+        {
+            status = res->init();
+            if (!status)
+            {
+                res.reset();
+            }
+        }
+        return SVMCachePtr<thunder, algorithmFPType, cpu>(res);
+    }
+
+    services::Status clear() override
+    {
+        _samplesIndices.reset();
+        _rows.reset();
+        _rowsData.reset();
+        return _samplesCache->clear();
+    }
+
+    virtual size_t getDataRowIndex(size_t rowIndex) const override { return rowIndex < _nSamples ? rowIndex : rowIndex - _nSamples; }
+
+    services::Status getRowsBlock(const uint32_t * const indices, const size_t n, algorithmFPType **& soablock) override
+    {
+        DAAL_ASSERT(n <= _nSize)
+        services::Status status;
+        for (size_t i = 0; i < n; ++i)
+        {
+            _samplesIndices[i] = static_cast<uint32_t>(getDataRowIndex(indices[i]));
+        }
+
+        /* Both variables of the observation may be in the block, the underlying cache keeps the row of it once */
+        algorithmFPType ** samplesRows = nullptr;
+        DAAL_CHECK_STATUS(status, _samplesCache->getRowsBlock(_samplesIndices.get(), n, samplesRows));
+
+        daal::threader_for(n, n, [&](const size_t i) {
+            const algorithmFPType * const samplesRow = samplesRows[i];
+            algorithmFPType * const row              = _rows[i];
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _nSamples; ++j)
+            {
+                row[j]             = samplesRow[j];
+                row[j + _nSamples] = samplesRow[j];
+            }
+        });
+
+        soablock = _rows.get();
+        return status;
+    }
+
+protected:
+    SVMRegressionCache(const SVMCachePtr<thunder, algorithmFPType, cpu> & samplesCache, const size_t nSize, const size_t nSamples,
+                       const kernel_function::KernelIfacePtr & kernel)
+        : super(nSize, 2 * nSamples, kernel), _samplesCache(samplesCache), _nSize(nSize), _nSamples(nSamples)
+    {}
+
+    services::Status init()
+    {
+        DAAL_CHECK(_samplesCache, ErrorMemoryAllocationFailed);
+        _samplesIndices.reset(_nSize);
+        DAAL_CHECK_MALLOC(_samplesIndices.get());
+
+        const size_t bytes            = _lineSize * sizeof(algorithmFPType);
+        const size_t alignedBytesSize = bytes & 63 ? (bytes & (~63)) + 64 : bytes;  // nearest number aligned on 64
+        const size_t newLineSize      = alignedBytesSize / sizeof(algorithmFPType); // to elements
+
+        _rowsData.reset(newLineSize * _nSize);
+        DAAL_CHECK_MALLOC(_rowsData.get());
+
+        _rows.reset(_nSize);
+        DAAL_CHECK_MALLOC(_rows.get());
+        for (size_t i = 0; i < _nSize; ++i)
+        {
+            _rows[i] = &_rowsData[i * newLineSize];
+        }
+        return services::Status();
+    }
+
+protected:
+    const SVMCachePtr<thunder, algorithmFPType, cpu> _samplesCache; /*!< Cache of the kernel function values of the observations */
+    const size_t _nSize;                                            /*!< Maximal number of the rows in the block */
+    const size_t _nSamples;                                         /*!< Number of the observations */
+    TArray<uint32_t, cpu> _samplesIndices;
+    TArrayScalable<algorithmFPType *, cpu> _rows;
+    TArrayScalable<algorithmFPType, cpu> _rowsData;
+};
+
 } // namespace internal
 } // namespace training
 } // namespace svm
@@ -48,6 +48,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/services/service_utils.h"
 #include "src/services/service_data_utils.h"
+#include "src/services/service_algo_utils.h"
 #include "src/externals/service_ittnotify.h"
 #include "src/externals/service_blas.h"
 #include "src/externals/service_math.h"
@@ -70,9 +71,10 @@ namespace training
 namespace internal
 {
 template <typename algorithmFPType, CpuType cpu>
-services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const NumericTablePtr & xTable, const NumericTablePtr & wTable,
-                                                                      NumericTable & yTable, daal::algorithms::Model * r,
-                                                                      const svm::Parameter * svmPar)
+services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(services::HostAppIface * pHost, const NumericTablePtr & xTable,
+                                                                      const NumericTablePtr & wTable, NumericTable & yTable,
+                                                                      daal::algorithms::Model * r, const svm::Parameter * svmPar,
+                                                                      const NumericTablePtr & alphaTable, const SvmType svmType, const double epsilon)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(COMPUTE);
 
@@ -83,9 +85,15 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
     const algorithmFPType tau(svmPar->tau);
     const size_t maxIterations(svmPar->maxIterations);
     const size_t cacheSize(svmPar->cacheSize);
+    const bool doShrinking(svmPar->doShrinking);
     kernel_function::KernelIfacePtr kernel = svmPar->kernel->clone();
+    const bool isRegression = (svmType == regression);
+    DAAL_CHECK(!(isRegression && alphaTable), services::ErrorMethodNotSupported);
 
-    const size_t nVectors = xTable->getNumberOfRows();
+    /* The epsilon-SVR task has the coefficients alpha and alpha* of the observation i in the positions i and i + nSamples,
+       so the working set selection, the solver and the gradient update handle it as the task with 2 * nSamples vectors */
+    const size_t nSamples = xTable->getNumberOfRows();
+    const size_t nVectors = isRegression ? 2 * nSamples : nSamples;
 
     TArray<algorithmFPType, cpu> alphaTArray(nVectors);
     DAAL_CHECK_MALLOC(alphaTArray.get());
@@ -110,13 +118,13 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
         /* The operation copy is lightweight, therefore a large size is chosen
             so that the number of blocks is a reasonable number. */
         const size_t blockSize = 16384;
-        const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+        const size_t nBlocks   = nSamples / blockSize + !!(nSamples % blockSize);
 
         DAAL_ITTNOTIFY_SCOPED_TASK(init.set);
         TlsSum<size_t, cpu> weightsCounter(1);
         daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
             const size_t startRow     = iBlock * blockSize;
-            const size_t nRowsInBlock = (iBlock != nBlocks - 1) ? blockSize : nVectors - iBlock * blockSize;
+            const size_t nRowsInBlock = (iBlock != nBlocks - 1) ? blockSize : nSamples - iBlock * blockSize;
 
             ReadColumns<algorithmFPType, cpu> mtY(yTable, 0, startRow, nRowsInBlock);
             DAAL_CHECK_BLOCK_STATUS_THR(mtY);
@@ -133,10 +141,26 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
             }
             for (size_t i = 0; i < nRowsInBlock; ++i)
             {
-                y[i + startRow]     = yIn[i] == algorithmFPType(0) ? algorithmFPType(-1) : yIn[i];
-                grad[i + startRow]  = -y[i + startRow];
-                alpha[i + startRow] = algorithmFPType(0);
-                cw[i + startRow]    = weights ? weights[i] * C : C;
+                if (isRegression)
+                {
+                    /* grad = y * (Q * alpha + p) with p = (epsilon - z, epsilon + z) */
+                    const size_t j      = i + startRow + nSamples;
+                    y[i + startRow]     = algorithmFPType(1);
+                    y[j]                = algorithmFPType(-1);
+                    grad[i + startRow]  = algorithmFPType(epsilon) - yIn[i];
+                    grad[j]             = -algorithmFPType(epsilon) - yIn[i];
+                    alpha[i + startRow] = algorithmFPType(0);
+                    alpha[j]            = algorithmFPType(0);
+                    cw[i + startRow]    = weights ? weights[i] * C : C;
+                    cw[j]               = cw[i + startRow];
+                }
+                else
+                {
+                    y[i + startRow]     = yIn[i] == algorithmFPType(0) ? algorithmFPType(-1) : yIn[i];
+                    grad[i + startRow]  = -y[i + startRow];
+                    alpha[i + startRow] = algorithmFPType(0);
+                    cw[i + startRow]    = weights ? weights[i] * C : C;
+                }
                 if (weights)
                 {
                     *wc += static_cast<size_t>(weights[i] != algorithmFPType(0));
@@ -147,6 +171,7 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
         if (wTable.get())
         {
             weightsCounter.reduceTo(&nNonZeroWeights, 1);
+            nNonZeroWeights = isRegression ? 2 * nNonZeroWeights : nNonZeroWeights;
         }
     }
 
@@ -169,23 +194,66 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors * sizeof(algorithmFPType), nVectors);
 
-    size_t defaultCacheSize = services::internal::min<cpu, size_t>(nVectors, cacheSize / nVectors / sizeof(algorithmFPType));
+    /* The cache lines keep the kernel function values of the observations */
+    size_t defaultCacheSize = services::internal::min<cpu, size_t>(nSamples, cacheSize / nSamples / sizeof(algorithmFPType));
     defaultCacheSize        = services::internal::max<cpu, size_t>(nWS, defaultCacheSize);
-    auto cachePtr           = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nVectors, xTable, kernel, status);
+    auto cachePtr           = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nSamples, xTable, kernel, status);
+    if (isRegression)
+    {
+        DAAL_CHECK_STATUS_VAR(status);
+        cachePtr = SVMRegressionCache<algorithmFPType, cpu>::create(cachePtr, nWS, nSamples, kernel, status);
+    }
+    DAAL_CHECK_STATUS_VAR(status);
 
     _blockSizeWS = services::internal::min<cpu, algorithmFPType>(nWS, 256);
     TArrayScalable<algorithmFPType, cpu> gradBuff((nWS / _blockSizeWS) * nVectors);
     DAAL_CHECK_MALLOC(gradBuff.get());
 
+    if (alphaTable)
+    {
+        DAAL_CHECK_STATUS(status, initGrad(cachePtr.get(), *alphaTable, y, cw, alpha, grad, gradBuff.get(), deltaAlpha.get(), nVectors, nWS));
+    }
+
+    /* The vectors in the positions [0, nActive) of activeIndices take part in the optimization,
+       the rest of them are shrunk and their gradients are not updated */
+    TArray<uint32_t, cpu> activeIndicesTArray(nVectors);
+    DAAL_CHECK_MALLOC(activeIndicesTArray.get());
+    uint32_t * const activeIndices = activeIndicesTArray.get();
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        activeIndices[i] = i;
+    }
+    size_t nActive = nVectors;
+
+    TArray<uint32_t, cpu> shrinkingBuffer;
+    if (doShrinking)
+    {
+        shrinkingBuffer.reset(nVectors);
+        DAAL_CHECK_MALLOC(shrinkingBuffer.get());
+    }
+
+    /* The shrinking step counts the updates of the pairs of the coefficients as in the Boser method,
+       the iteration of the Thunder method updates up to the working set size pairs of them */
+    const size_t shrinkingStep   = services::internal::max<cpu, size_t>(svmPar->shrinkingStep / nWS, 1);
+    size_t shrinkingIter         = 0;
+    bool isGradientReconstructed = false;
+    bool isWSReset               = false;
+
+    services::Status cancelStatus;
     size_t iter = 0;
     for (; iter < maxIterations; ++iter)
     {
-        if (iter != 0)
+        if (isWSReset)
+        {
+            DAAL_CHECK_STATUS(status, workSet.reset());
+            isWSReset = false;
+        }
+        else if (iter != 0)
         {
             DAAL_CHECK_STATUS(status, workSet.copyLastToFirst());
         }
 
-        DAAL_CHECK_STATUS(status, workSet.select(y, alpha, grad, cw));
+        DAAL_CHECK_STATUS(status, workSet.select(y, alpha, grad, cw, activeIndices, nActive));
         const uint32_t * const wsIndices = workSet.getIndices();
         algorithmFPType ** kernelSOARes  = nullptr;
         {
@@ -196,16 +264,73 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
         DAAL_CHECK_STATUS(status, SMOBlockSolver(y, grad, wsIndices, kernelSOARes, nVectors, nWS, cw, eps, tau, buffer.get(), I.get(), alpha,
                                                  deltaAlpha.get(), diff));
 
-        DAAL_CHECK_STATUS(status, updateGrad(kernelSOARes, deltaAlpha.get(), gradBuff.get(), grad, nVectors, nWS));
+        DAAL_CHECK_STATUS(status, updateGrad(kernelSOARes, deltaAlpha.get(), gradBuff.get(), grad, nVectors, nWS,
+                                             nActive < nVectors ? activeIndices : nullptr, nActive));
 
-        if (checkStopCondition(diff, diffPrev, eps, sameLocalDiff) && iter >= nNoChanges) break;
+        if (checkStopCondition(diff, diffPrev, eps, sameLocalDiff) && iter >= nNoChanges)
+        {
+            if (nActive == nVectors) break;
+
+            /* Check the optimality condition for the task with the shrunk vectors */
+            DAAL_CHECK_STATUS(status, reconstructGradient(cachePtr.get(), y, alpha, grad, activeIndices, shrinkingBuffer.get(), nVectors, nActive,
+                                                          nWS));
+            nActive = nVectors;
+            if (computeDiff(y, grad, alpha, cw, nVectors) < eps) break;
+            sameLocalDiff = 0;
+            shrinkingIter = 0;
+        }
+        else if (doShrinking && (++shrinkingIter % shrinkingStep) == 0)
+        {
+            /* The gradients of the shrunk vectors are restored once near the optimum,
+               so the later shrinking relies on the exact values of them */
+            if (!isGradientReconstructed && diff < algorithmFPType(10) * eps)
+            {
+                isGradientReconstructed = true;
+                if (nActive < nVectors)
+                {
+                    DAAL_CHECK_STATUS(status, reconstructGradient(cachePtr.get(), y, alpha, grad, activeIndices, shrinkingBuffer.get(), nVectors,
+                                                                  nActive, nWS));
+                    nActive = nVectors;
+                }
+            }
+            const size_t nActiveNew = updateShrinking(y, grad, alpha, cw, activeIndices, shrinkingBuffer.get(), nActive, nWS);
+            isWSReset |= (nActiveNew != nActive);
+            nActive = nActiveNew;
+        }
         diffPrev = diff;
+
+        /* The coefficients of the finished iterations make the model of the cancelled training */
+        if (services::internal::isCancelled(cancelStatus, pHost)) break;
+    }
+
+    if (nActive < nVectors)
+    {
+        DAAL_CHECK_STATUS(status,
+                          reconstructGradient(cachePtr.get(), y, alpha, grad, activeIndices, shrinkingBuffer.get(), nVectors, nActive, nWS));
     }
 
     cachePtr->clear();
-    SaveResultTask<algorithmFPType, cpu> saveResult(nVectors, y, alpha, grad, cachePtr.get());
-    DAAL_CHECK_STATUS(status, saveResult.compute(*xTable, *static_cast<Model *>(r), cw));
+    if (isRegression)
+    {
+        const algorithmFPType bias = SaveResultTask<algorithmFPType, cpu>(nVectors, y, alpha, grad, cachePtr.get()).calculateBias(cw);
+
+        /* The coefficient of the observation i is alpha[i] - alpha[i + nSamples], it is kept as y[i] * alpha[i] */
+        for (size_t i = 0; i < nSamples; ++i)
+        {
+            const algorithmFPType coeff = alpha[i] - alpha[i + nSamples];
+            y[i]                        = coeff < algorithmFPType(0) ? algorithmFPType(-1) : algorithmFPType(1);
+            alpha[i]                    = coeff < algorithmFPType(0) ? -coeff : coeff;
+        }
+        SaveResultTask<algorithmFPType, cpu> saveResult(nSamples, y, alpha, grad, cachePtr.get());
+        DAAL_CHECK_STATUS(status, saveResult.compute(*xTable, *static_cast<Model *>(r), bias));
+    }
+    else
+    {
+        SaveResultTask<algorithmFPType, cpu> saveResult(nVectors, y, alpha, grad, cachePtr.get());
+        DAAL_CHECK_STATUS(status, saveResult.compute(*xTable, *static_cast<Model *>(r), cw));
+    }
 
+    status |= cancelStatus;
     return status;
 }
 
@@ -347,17 +472,78 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::SMOBlockSolver(con
     return status;
 }
 
+/**
+ * \brief Starts the optimization from the given coefficients: clips them to the box constraints
+ *        and adds their contribution to the gradients with updateGrad by the blocks of nWS vectors.
+ *        The coefficients shall satisfy sum(alpha[i] * y[i]) = 0, for example the coefficients
+ *        of the model trained on a part of the rows with zeros for the rest of them.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::initGrad(SVMCacheIface<thunder, algorithmFPType, cpu> * cache,
+                                                                       NumericTable & alphaTable, const algorithmFPType * y,
+                                                                       const algorithmFPType * cw, algorithmFPType * alpha, algorithmFPType * grad,
+                                                                       algorithmFPType * gradBuff, algorithmFPType * deltaAlpha,
+                                                                       const size_t nVectors, const size_t nWS)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(initGrad);
+    services::Status status;
+    {
+        ReadColumns<algorithmFPType, cpu> mtAlpha(alphaTable, 0, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(mtAlpha);
+        const algorithmFPType * const alphaIn = mtAlpha.get();
+        for (size_t i = 0; i < nVectors; ++i)
+        {
+            alpha[i] = services::internal::min<cpu, algorithmFPType>(services::internal::max<cpu, algorithmFPType>(alphaIn[i], 0), cw[i]);
+        }
+    }
+
+    /* The support vectors go first, the blocks are padded with the other vectors
+       with zero deltas, so the indices in a block are distinct */
+    TArray<uint32_t, cpu> orderTArray(nVectors);
+    DAAL_CHECK_MALLOC(orderTArray.get());
+    uint32_t * const order = orderTArray.get();
+    size_t nSV             = 0;
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        if (alpha[i] != algorithmFPType(0)) order[nSV++] = i;
+    }
+    if (nSV == 0) return status;
+    for (size_t i = 0, pos = nSV; i < nVectors; ++i)
+    {
+        if (alpha[i] == algorithmFPType(0)) order[pos++] = i;
+    }
+
+    for (size_t startSV = 0; startSV < nSV; startSV += nWS)
+    {
+        /* The last block is shifted back to fit into nVectors,
+           the deltas of its already processed vectors are zero */
+        const size_t start = services::internal::min<cpu, size_t>(startSV, nVectors - nWS);
+        for (size_t k = 0; k < nWS; ++k)
+        {
+            const size_t pos = start + k;
+            deltaAlpha[k]    = (pos >= startSV && pos < nSV) ? alpha[order[pos]] * y[order[pos]] : algorithmFPType(0);
+        }
+
+        algorithmFPType ** kernelWS = nullptr;
+        DAAL_CHECK_STATUS(status, cache->getRowsBlock(order + start, nWS, kernelWS));
+        DAAL_CHECK_STATUS(status, updateGrad(kernelWS, deltaAlpha, gradBuff, grad, nVectors, nWS, nullptr, nVectors));
+    }
+    return status;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::updateGrad(algorithmFPType ** kernelWS, const algorithmFPType * deltaalpha,
                                                                          algorithmFPType * gradBuff, algorithmFPType * grad, const size_t nVectors,
-                                                                         const size_t nWS)
+                                                                         const size_t nWS, const uint32_t * activeIndices, const size_t nActive)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(updateGrad);
 
     SafeStatus safeStat;
     const size_t nBlocksWS = nWS / _blockSizeWS;
     const size_t blockSize = 128;
-    size_t nBlocksGrad     = (nVectors / blockSize) + !!(nVectors % blockSize);
+    /* Only the gradients of the active vectors are updated, activeIndices is nullptr if all vectors are active */
+    const size_t nRows = activeIndices ? nActive : nVectors;
+    size_t nBlocksGrad = (nRows / blockSize) + !!(nRows % blockSize);
 
     DAAL_INT incX(1);
     DAAL_INT incY(1);
@@ -367,10 +553,34 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::updateGrad(algorit
         const algorithmFPType deltaalphai = deltaalpha[startRowWS];
 
         daal::threader_for(nBlocksGrad, nBlocksGrad, [&](const size_t iBlockGrad) {
-            const size_t nRowsInBlockGrad = (iBlockGrad != nBlocksGrad - 1) ? blockSize : nVectors - iBlockGrad * blockSize;
+            const size_t nRowsInBlockGrad = (iBlockGrad != nBlocksGrad - 1) ? blockSize : nRows - iBlockGrad * blockSize;
             const size_t startRowGrad     = iBlockGrad * blockSize;
             algorithmFPType * gradi       = &gradBuff[nVectors * iBlock + startRowGrad];
 
+            if (activeIndices)
+            {
+                const uint32_t * const activeBlock = activeIndices + startRowGrad;
+                const algorithmFPType * kernelI    = kernelWS[startRowWS];
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nRowsInBlockGrad; j++)
+                {
+                    gradi[j] = deltaalphai * kernelI[activeBlock[j]];
+                }
+                for (size_t i = 1; i < _blockSizeWS; i++)
+                {
+                    const algorithmFPType * kernelI   = kernelWS[startRowWS + i];
+                    const algorithmFPType deltaalphai = deltaalpha[startRowWS + i];
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nRowsInBlockGrad; j++)
+                    {
+                        gradi[j] += deltaalphai * kernelI[activeBlock[j]];
+                    }
+                }
+                return;
+            }
+
             const algorithmFPType * kernelBlockI = kernelWS[startRowWS] + startRowGrad;
             {
                 PRAGMA_IVDEP
@@ -389,6 +599,24 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::updateGrad(algorit
         });
     });
 
+    if (activeIndices)
+    {
+        daal::threader_for(nBlocksGrad, nBlocksGrad, [&](const size_t iBlockGrad) {
+            const size_t startRowGrad = iBlockGrad * blockSize;
+            const size_t endRowGrad   = (iBlockGrad != nBlocksGrad - 1) ? startRowGrad + blockSize : nRows;
+            for (size_t i = 0; i < nBlocksWS; i++)
+            {
+                const algorithmFPType * const gradi = &gradBuff[i * nVectors];
+                PRAGMA_IVDEP
+                for (size_t j = startRowGrad; j < endRowGrad; j++)
+                {
+                    grad[activeIndices[j]] += gradi[j];
+                }
+            }
+        });
+        return services::Status();
+    }
+
     algorithmFPType one = algorithmFPType(1);
     for (size_t i = 0; i < nBlocksWS; i++)
     {
@@ -398,6 +626,154 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::updateGrad(algorit
     return services::Status();
 }
 
+/**
+ * \brief Moves the vectors that are not expected to violate the optimality conditions
+ *        to the end of the active part of activeIndices, the shrinking is skipped
+ *        if less than nWS vectors remain active
+ *
+ * \return Number of the vectors that remain active after shrinking
+ */
+template <typename algorithmFPType, CpuType cpu>
+size_t SVMTrainImpl<thunder, algorithmFPType, cpu>::updateShrinking(const algorithmFPType * y, const algorithmFPType * grad,
+                                                                    const algorithmFPType * alpha, const algorithmFPType * cw,
+                                                                    uint32_t * activeIndices, uint32_t * shrunkIndices, const size_t nActive,
+                                                                    const size_t nWS)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(updateShrinking);
+
+    /* GMin = min(grad[i]): i belongs to I_UP, GMax = max(grad[i]): i belongs to I_LOW */
+    algorithmFPType GMin = MaxVal<algorithmFPType>::get();
+    algorithmFPType GMax = -MaxVal<algorithmFPType>::get();
+    for (size_t k = 0; k < nActive; ++k)
+    {
+        const size_t i = activeIndices[k];
+        if (HelperTrainSVM<algorithmFPType, cpu>::isUpper(y[i], alpha[i], cw[i]) && grad[i] < GMin)
+        {
+            GMin = grad[i];
+        }
+        if (HelperTrainSVM<algorithmFPType, cpu>::isLower(y[i], alpha[i], cw[i]) && grad[i] > GMax)
+        {
+            GMax = grad[i];
+        }
+    }
+
+    const auto isShrunk = [&](const size_t i) -> bool {
+        const bool isUp  = HelperTrainSVM<algorithmFPType, cpu>::isUpper(y[i], alpha[i], cw[i]);
+        const bool isLow = HelperTrainSVM<algorithmFPType, cpu>::isLower(y[i], alpha[i], cw[i]);
+        return (!isUp && grad[i] < GMin) || (!isLow && grad[i] > GMax);
+    };
+
+    size_t nShrunk = 0;
+    for (size_t k = 0; k < nActive; ++k)
+    {
+        nShrunk += isShrunk(activeIndices[k]);
+    }
+    if (nShrunk == 0 || nActive - nShrunk < nWS) return nActive;
+
+    size_t nKept = 0;
+    nShrunk      = 0;
+    for (size_t k = 0; k < nActive; ++k)
+    {
+        const uint32_t i = activeIndices[k];
+        if (isShrunk(i))
+        {
+            shrunkIndices[nShrunk++] = i;
+        }
+        else
+        {
+            activeIndices[nKept++] = i;
+        }
+    }
+
+    services::internal::daal_memcpy_s(activeIndices + nKept, nShrunk * sizeof(uint32_t), shrunkIndices, nShrunk * sizeof(uint32_t));
+    return nKept;
+}
+
+/**
+ * \brief Recomputes the gradients of the shrunk vectors from the support vectors and makes all vectors active
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::reconstructGradient(SVMCacheIface<thunder, algorithmFPType, cpu> * cache,
+                                                                                  const algorithmFPType * y, const algorithmFPType * alpha,
+                                                                                  algorithmFPType * grad, uint32_t * activeIndices,
+                                                                                  uint32_t * svIndices, const size_t nVectors, const size_t nActive,
+                                                                                  const size_t nWS)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(reconstructGradient);
+    services::Status status;
+
+    const uint32_t * const shrunkIndices = activeIndices + nActive;
+    const size_t nShrunk                 = nVectors - nActive;
+    for (size_t k = 0; k < nShrunk; ++k)
+    {
+        grad[shrunkIndices[k]] = -y[shrunkIndices[k]];
+    }
+
+    size_t nSV = 0;
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        if (alpha[i] != algorithmFPType(0))
+        {
+            svIndices[nSV++] = i;
+        }
+    }
+
+    const size_t blockSize = 128;
+    const size_t nBlocks   = nShrunk / blockSize + !!(nShrunk % blockSize);
+    for (size_t startSV = 0; startSV < nSV; startSV += nWS)
+    {
+        const size_t nSVInBlock        = services::internal::min<cpu, size_t>(nWS, nSV - startSV);
+        const uint32_t * const svBlock = svIndices + startSV;
+        algorithmFPType ** kernelSV    = nullptr;
+        DAAL_CHECK_STATUS(status, cache->getRowsBlock(svBlock, nSVInBlock, kernelSV));
+
+        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+            const size_t start = iBlock * blockSize;
+            const size_t end   = (iBlock != nBlocks - 1) ? start + blockSize : nShrunk;
+            for (size_t j = 0; j < nSVInBlock; ++j)
+            {
+                const algorithmFPType * const kernelJ = kernelSV[j];
+                const algorithmFPType coeff           = alpha[svBlock[j]] * y[svBlock[j]];
+                PRAGMA_IVDEP
+                for (size_t k = start; k < end; ++k)
+                {
+                    grad[shrunkIndices[k]] += coeff * kernelJ[shrunkIndices[k]];
+                }
+            }
+        });
+    }
+
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        activeIndices[i] = i;
+    }
+    return status;
+}
+
+/**
+ * \brief Computes the maximal violation of the optimality conditions over all vectors
+ */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType SVMTrainImpl<thunder, algorithmFPType, cpu>::computeDiff(const algorithmFPType * y, const algorithmFPType * grad,
+                                                                         const algorithmFPType * alpha, const algorithmFPType * cw,
+                                                                         const size_t nVectors)
+{
+    algorithmFPType GMin = MaxVal<algorithmFPType>::get();
+    algorithmFPType GMax = -MaxVal<algorithmFPType>::get();
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        if (HelperTrainSVM<algorithmFPType, cpu>::isUpper(y[i], alpha[i], cw[i]) && grad[i] < GMin)
+        {
+            GMin = grad[i];
+        }
+        if (HelperTrainSVM<algorithmFPType, cpu>::isLower(y[i], alpha[i], cw[i]) && grad[i] > GMax)
+        {
+            GMax = grad[i];
+        }
+    }
+    return GMax - GMin;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 bool SVMTrainImpl<thunder, algorithmFPType, cpu>::checkStopCondition(const algorithmFPType diff, const algorithmFPType diffPrev,
                                                                      const algorithmFPType eps, size_t & sameLocalDiff)
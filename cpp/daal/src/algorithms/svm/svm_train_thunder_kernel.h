@@ -43,11 +43,27 @@ namespace training
 {
 namespace internal
 {
+/**
+ * Optimization problems solved by the Thunder method
+ */
+enum SvmType
+{
+    classification = 0, /*!< Two-class classification */
+    regression     = 1  /*!< Epsilon-SVR, the problem has two coefficients per observation */
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct SVMTrainImpl<thunder, algorithmFPType, cpu> : public Kernel
 {
-    services::Status compute(const data_management::NumericTablePtr & xTable, const data_management::NumericTablePtr & wTable,
-                             data_management::NumericTable & yTable, daal::algorithms::Model * r, const svm::Parameter * par);
+    /* alphaTable is the optional nVectors x 1 table of the coefficients the optimization starts from,
+       it is empty for the training from zero coefficients. For the regression yTable holds the responses
+       and epsilon is the width of the insensitive tube, the regression does not support alphaTable. The cancelled training
+       returns the model of the coefficients of the finished iterations with ErrorUserCancelled status */
+    services::Status compute(services::HostAppIface * pHost, const data_management::NumericTablePtr & xTable,
+                             const data_management::NumericTablePtr & wTable, data_management::NumericTable & yTable, daal::algorithms::Model * r,
+                             const svm::Parameter * par,
+                             const data_management::NumericTablePtr & alphaTable = data_management::NumericTablePtr(),
+                             const SvmType svmType = classification, const double epsilon = 0.1);
 
 private:
     services::Status SMOBlockSolver(const algorithmFPType * y, const algorithmFPType * grad, const uint32_t * wsIndices, algorithmFPType ** kernelWS,
@@ -55,8 +71,21 @@ private:
                                     algorithmFPType * buffer, char * I, algorithmFPType * alpha, algorithmFPType * deltaAlpha,
                                     algorithmFPType & localDiff) const;
 
+    services::Status initGrad(SVMCacheIface<thunder, algorithmFPType, cpu> * cache, data_management::NumericTable & alphaTable,
+                              const algorithmFPType * y, const algorithmFPType * cw, algorithmFPType * alpha, algorithmFPType * grad,
+                              algorithmFPType * gradBuff, algorithmFPType * deltaAlpha, const size_t nVectors, const size_t nWS);
     services::Status updateGrad(algorithmFPType ** kernelWS, const algorithmFPType * deltaalpha, algorithmFPType * tmpgrad, algorithmFPType * grad,
-                                const size_t nVectors, const size_t nWS);
+                                const size_t nVectors, const size_t nWS, const uint32_t * activeIndices, const size_t nActive);
+
+    size_t updateShrinking(const algorithmFPType * y, const algorithmFPType * grad, const algorithmFPType * alpha, const algorithmFPType * cw,
+                           uint32_t * activeIndices, uint32_t * shrunkIndices, const size_t nActive, const size_t nWS);
+
+    services::Status reconstructGradient(SVMCacheIface<thunder, algorithmFPType, cpu> * cache, const algorithmFPType * y,
+                                         const algorithmFPType * alpha, algorithmFPType * grad, uint32_t * activeIndices, uint32_t * svIndices,
+                                         const size_t nVectors, const size_t nActive, const size_t nWS);
+
+    algorithmFPType computeDiff(const algorithmFPType * y, const algorithmFPType * grad, const algorithmFPType * alpha, const algorithmFPType * cw,
+                                const size_t nVectors);
 
     bool checkStopCondition(const algorithmFPType diff, const algorithmFPType diffPrev, const algorithmFPType eps, size_t & sameLocalDiff);
 
@@ -96,46 +96,60 @@ struct TaskWorkingSet
         return status;
     }
 
-    services::Status select(const algorithmFPType * y, const algorithmFPType * alpha, const algorithmFPType * f, const algorithmFPType * cw)
+    /* Drops the selected indices, so the next selection starts from the empty working set */
+    services::Status reset()
+    {
+        services::internal::service_memset_seq<bool, cpu>(_indicator.get(), false, _nVectors);
+        _nSelected = 0;
+        return services::Status();
+    }
+
+    /* Selects the working set from the nActive vectors with the indices activeIndices,
+       nActive should not be less than the size of the working set */
+    services::Status select(const algorithmFPType * y, const algorithmFPType * alpha, const algorithmFPType * f, const algorithmFPType * cw,
+                            const IndexType * activeIndices, const size_t nActive)
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(select);
+        DAAL_ASSERT(nActive >= _nWS);
         services::Status status;
         IdxValType * sortedFIndices = _sortedFIndices.get();
+        const int64_t nSorted       = nActive;
 
         /* The operation copy is lightweight, therefore a large size is chosen
             so that the number of blocks is a reasonable number. */
         const size_t blockSize = 16384;
-        const size_t nBlocks   = _nVectors / blockSize + !!(_nVectors % blockSize);
+        const size_t nBlocks   = nActive / blockSize + !!(nActive % blockSize);
         daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
             const size_t startRow = iBlock * blockSize;
-            const size_t endRow   = (iBlock != nBlocks - 1) ? startRow + blockSize : _nVectors;
+            const size_t endRow   = (iBlock != nBlocks - 1) ? startRow + blockSize : nActive;
             for (size_t i = startRow; i < endRow; ++i)
             {
-                sortedFIndices[i].key = f[i];
-                sortedFIndices[i].val = i;
+                const IndexType index = activeIndices[i];
+                sortedFIndices[i].key = f[index];
+                sortedFIndices[i].val = index;
             }
         });
 
-        algorithms::internal::qSortByKey<IdxValType, cpu>(_nVectors, sortedFIndices);
+        algorithms::internal::qSortByKey<IdxValType, cpu>(nActive, sortedFIndices);
 
         {
             int64_t pLeft  = 0;
-            int64_t pRight = _nVectors - 1;
-            while (_nSelected < _nWS && (pRight >= 0 || pLeft < _nVectors))
+            int64_t pRight = nSorted - 1;
+            while (_nSelected < _nWS && (pRight >= 0 || pLeft < nSorted))
             {
-                if (pLeft < _nVectors)
+                if (pLeft < nSorted)
                 {
                     IndexType i = sortedFIndices[pLeft].val;
                     while (_indicator[i] || !HelperTrainSVM<algorithmFPType, cpu>::isUpper(y[i], alpha[i], cw[i]))
                     {
                         pLeft++;
-                        if (pLeft == _nVectors)
+                        if (pLeft == nSorted)
                         {
                             break;
                         }
                         i = sortedFIndices[pLeft].val;
                     }
-                    if (pLeft < _nVectors)
+                    if (pLeft < nSorted)
                     {
                         _wsIndices[_nSelected] = i;
                         _indicator[i]          = true;
@@ -169,10 +183,11 @@ struct TaskWorkingSet
         int64_t pLeft = 0;
         while (_nSelected < _nWS)
         {
-            if (!_indicator[pLeft])
+            const IndexType i = activeIndices[pLeft];
+            if (!_indicator[i])
             {
-                _wsIndices[_nSelected] = pLeft;
-                _indicator[pLeft]      = true;
+                _wsIndices[_nSelected] = i;
+                _indicator[i]          = true;
                 ++_nSelected;
             }
             ++pLeft;
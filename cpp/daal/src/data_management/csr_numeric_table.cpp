@@ -16,6 +16,8 @@
 *******************************************************************************/
 
 #include "data_management/data/csr_numeric_table.h"
+#include "src/threading/threading.h"
+#include "src/services/service_defines.h"
 
 namespace daal
 {
@@ -41,6 +43,304 @@ DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR(short)
 DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR(unsigned short)
 DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR(unsigned long)
 
+namespace
+{
+/* The largest number of the counters of the blocks of the rows, nBlocks x nColumns */
+const size_t maxTransposeCounters = (size_t)1 << 24;
+
+template <typename T>
+void scatterValues(size_t iStart, size_t iEnd, size_t indexBase, const byte * values, const size_t * colIndices, const size_t * rowOffsets,
+                   size_t * positions, byte * tValues, size_t * tRowIndices)
+{
+    const T * src = (const T *)values;
+    T * dst       = (T *)tValues;
+    for (size_t i = iStart; i < iEnd; i++)
+    {
+        for (size_t k = rowOffsets[i] - indexBase; k < rowOffsets[i + 1] - indexBase; k++)
+        {
+            const size_t pos = positions[colIndices[k] - indexBase]++;
+            dst[pos]         = src[k];
+            tRowIndices[pos] = i + indexBase;
+        }
+    }
+}
+} // namespace
+
+services::Status CSRNumericTable::transposeSparse(size_t nRows, size_t nColumns, size_t typeSize, size_t indexBase, const byte * values,
+                                                  const size_t * colIndices, const size_t * rowOffsets, byte * tValues, size_t * tRowIndices,
+                                                  size_t * tColOffsets)
+{
+    if (typeSize != 1 && typeSize != 2 && typeSize != 4 && typeSize != 8) return services::Status(services::ErrorDataTypeNotSupported);
+    if (nRows == 0 || nColumns == 0)
+    {
+        for (size_t j = 0; j <= nColumns; j++) tColOffsets[j] = indexBase;
+        return services::Status();
+    }
+
+    size_t nBlocks = daal::threader_get_threads_number();
+    if (nBlocks > nRows) nBlocks = nRows;
+    if (nBlocks * nColumns > maxTransposeCounters) nBlocks = (maxTransposeCounters / nColumns > 0) ? maxTransposeCounters / nColumns : 1;
+    const size_t blockSize = nRows / nBlocks + !!(nRows % nBlocks);
+    nBlocks                = nRows / blockSize + !!(nRows % blockSize);
+
+    /* counts[b * nColumns + j] is the number of the values of the column j in the block b */
+    services::SharedPtr<size_t> countsPtr((size_t *)daal::services::daal_calloc(nBlocks * nColumns * sizeof(size_t)), services::ServiceDeleter());
+    services::SharedPtr<int> badIndexPtr((int *)daal::services::daal_calloc(nBlocks * sizeof(int)), services::ServiceDeleter());
+    if (!countsPtr || !badIndexPtr) return services::Status(services::ErrorMemoryAllocationFailed);
+    size_t * counts = countsPtr.get();
+    int * badIndex  = badIndexPtr.get();
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t b) {
+        const size_t iStart  = b * blockSize;
+        const size_t iEnd    = (iStart + blockSize > nRows) ? nRows : iStart + blockSize;
+        size_t * blockCounts = counts + b * nColumns;
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            for (size_t k = rowOffsets[i] - indexBase; k < rowOffsets[i + 1] - indexBase; k++)
+            {
+                const size_t j = colIndices[k] - indexBase;
+                if (j >= nColumns)
+                {
+                    badIndex[b] = 1;
+                    return;
+                }
+                blockCounts[j]++;
+            }
+        }
+    });
+    for (size_t b = 0; b < nBlocks; b++)
+    {
+        if (badIndex[b]) return services::Status(services::ErrorIncorrectIndex);
+    }
+
+    /* The counts of the columns become the offsets of the blocks within the columns, tColOffsets[j + 1] gets the totals */
+    const size_t columnsInChunk = 1024;
+    const size_t nChunks        = nColumns / columnsInChunk + !!(nColumns % columnsInChunk);
+    daal::threader_for(nChunks, nChunks, [&](size_t c) {
+        const size_t jStart = c * columnsInChunk;
+        const size_t jEnd   = (jStart + columnsInChunk > nColumns) ? nColumns : jStart + columnsInChunk;
+        for (size_t j = jStart; j < jEnd; j++)
+        {
+            size_t sum = 0;
+            for (size_t b = 0; b < nBlocks; b++)
+            {
+                const size_t count       = counts[b * nColumns + j];
+                counts[b * nColumns + j] = sum;
+                sum += count;
+            }
+            tColOffsets[j + 1] = sum;
+        }
+    });
+
+    tColOffsets[0] = indexBase;
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        tColOffsets[j + 1] += tColOffsets[j];
+    }
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t b) {
+        const size_t iStart = b * blockSize;
+        const size_t iEnd   = (iStart + blockSize > nRows) ? nRows : iStart + blockSize;
+        size_t * positions  = counts + b * nColumns;
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            positions[j] += tColOffsets[j] - indexBase;
+        }
+        switch (typeSize)
+        {
+        case 1: scatterValues<unsigned char>(iStart, iEnd, indexBase, values, colIndices, rowOffsets, positions, tValues, tRowIndices); break;
+        case 2: scatterValues<unsigned short>(iStart, iEnd, indexBase, values, colIndices, rowOffsets, positions, tValues, tRowIndices); break;
+        case 4: scatterValues<unsigned int>(iStart, iEnd, indexBase, values, colIndices, rowOffsets, positions, tValues, tRowIndices); break;
+        default: scatterValues<DAAL_UINT64>(iStart, iEnd, indexBase, values, colIndices, rowOffsets, positions, tValues, tRowIndices); break;
+        }
+    });
+    return services::Status();
+}
+
+services::Status CSRNumericTable::getCSCArraysImpl(int indexType)
+{
+    if (_cscColOffsets) return services::Status();
+    if (!_ddict || _ddict->getNumberOfFeatures() == 0) return services::Status(services::ErrorIncorrectNumberOfFeatures);
+
+    const NumericTableFeature & f = (*_ddict)[0];
+    if (f.indexType != indexType) return services::Status(services::ErrorDataTypeNotSupported);
+    if (!_ptr || !_colIndices || !_rowOffsets) return services::Status(services::ErrorNullPtr);
+
+    const size_t nRows     = getNumberOfRows();
+    const size_t nColumns  = getNumberOfColumns();
+    const size_t indexBase = (_indexing == oneBased) ? 1 : 0;
+    const size_t nValues   = _rowOffsets.get()[nRows] - _rowOffsets.get()[0];
+
+    services::SharedPtr<byte> values((byte *)daal::services::daal_malloc(nValues * f.typeSize + 1), services::ServiceDeleter());
+    services::SharedPtr<size_t> rowIndices((size_t *)daal::services::daal_malloc(nValues * sizeof(size_t) + 1), services::ServiceDeleter());
+    services::SharedPtr<size_t> colOffsets((size_t *)daal::services::daal_malloc((nColumns + 1) * sizeof(size_t)), services::ServiceDeleter());
+    if (!values || !rowIndices || !colOffsets) return services::Status(services::ErrorMemoryAllocationFailed);
+
+    services::Status s = transposeSparse(nRows, nColumns, f.typeSize, indexBase, _ptr.get(), _colIndices.get(), _rowOffsets.get(), values.get(),
+                                         rowIndices.get(), colOffsets.get());
+    if (!s) return s;
+
+    _cscValues     = values;
+    _cscRowIndices = rowIndices;
+    _cscColOffsets = colOffsets;
+    return s;
+}
+
 } // namespace interface1
+
+namespace
+{
+const size_t rowsInOneHotBlock = 1024;
+
+template <typename T>
+CSRNumericTablePtr convertToOneHotCSRImpl(NumericTable & src, services::Status & s)
+{
+    const size_t nRows                = src.getNumberOfRows();
+    const size_t nColumns             = src.getNumberOfColumns();
+    NumericTableDictionaryPtr srcDict = src.getDictionarySharedPtr();
+    if (!srcDict || nColumns == 0)
+    {
+        s = services::Status(services::ErrorIncorrectNumberOfFeatures);
+        return CSRNumericTablePtr();
+    }
+
+    /* The categorical feature j is expanded to the columns [firstColumns[j], firstColumns[j + 1]) */
+    services::Collection<size_t> firstColumns(nColumns + 1);
+    services::Collection<bool> isCategorical(nColumns);
+    if (!firstColumns.data() || !isCategorical.data())
+    {
+        s = services::Status(services::ErrorMemoryAllocationFailed);
+        return CSRNumericTablePtr();
+    }
+    firstColumns[0] = 0;
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        const NumericTableFeature & f = (*srcDict)[j];
+        isCategorical[j]              = (f.featureType == features::DAAL_CATEGORICAL);
+        firstColumns[j + 1]           = firstColumns[j] + (isCategorical[j] ? f.categoryNumber : 1);
+    }
+    const size_t nOutColumns = firstColumns[nColumns];
+
+    services::SharedPtr<size_t> rowOffsets((size_t *)daal::services::daal_malloc((nRows + 1) * sizeof(size_t)), services::ServiceDeleter());
+    if (!rowOffsets)
+    {
+        s = services::Status(services::ErrorMemoryAllocationFailed);
+        return CSRNumericTablePtr();
+    }
+    size_t * offsets = rowOffsets.get();
+
+    const size_t nBlocks = nRows / rowsInOneHotBlock + !!(nRows % rowsInOneHotBlock);
+    services::SharedPtr<int> blockErrorsPtr((int *)daal::services::daal_calloc((nBlocks + 1) * sizeof(int)), services::ServiceDeleter());
+    if (!blockErrorsPtr)
+    {
+        s = services::Status(services::ErrorMemoryAllocationFailed);
+        return CSRNumericTablePtr();
+    }
+    int * blockErrors = blockErrorsPtr.get();
+
+    /* offsets[i + 1] gets the number of the values of the row i, the codes of the categories are checked */
+    daal::threader_for(nBlocks, nBlocks, [&](size_t b) {
+        const size_t iStart     = b * rowsInOneHotBlock;
+        const size_t nBlockRows = (iStart + rowsInOneHotBlock > nRows) ? nRows - iStart : rowsInOneHotBlock;
+        BlockDescriptor<T> block;
+        src.getBlockOfRows(iStart, nBlockRows, readOnly, block);
+        const T * x = block.getBlockPtr();
+        if (!x)
+        {
+            blockErrors[b] = 1;
+            return;
+        }
+        for (size_t i = 0; i < nBlockRows; i++)
+        {
+            size_t nValues = 0;
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                const T value = x[i * nColumns + j];
+                if (isCategorical[j])
+                {
+                    if (!(value >= 0 && value < (T)(firstColumns[j + 1] - firstColumns[j]))) blockErrors[b] = 1;
+                    nValues++;
+                }
+                else
+                {
+                    nValues += (value != 0);
+                }
+            }
+            offsets[iStart + i + 1] = nValues;
+        }
+        src.releaseBlockOfRows(block);
+    });
+    for (size_t b = 0; b < nBlocks; b++)
+    {
+        if (blockErrors[b])
+        {
+            s = services::Status(services::ErrorIncorrectIndex);
+            return CSRNumericTablePtr();
+        }
+    }
+
+    offsets[0] = 1;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+    const size_t nValues = offsets[nRows] - 1;
+
+    services::SharedPtr<T> values((T *)daal::services::daal_malloc(nValues * sizeof(T) + 1), services::ServiceDeleter());
+    services::SharedPtr<size_t> colIndices((size_t *)daal::services::daal_malloc(nValues * sizeof(size_t) + 1), services::ServiceDeleter());
+    if (!values || !colIndices)
+    {
+        s = services::Status(services::ErrorMemoryAllocationFailed);
+        return CSRNumericTablePtr();
+    }
+    T * outValues       = values.get();
+    size_t * outColumns = colIndices.get();
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t b) {
+        const size_t iStart     = b * rowsInOneHotBlock;
+        const size_t nBlockRows = (iStart + rowsInOneHotBlock > nRows) ? nRows - iStart : rowsInOneHotBlock;
+        BlockDescriptor<T> block;
+        src.getBlockOfRows(iStart, nBlockRows, readOnly, block);
+        const T * x = block.getBlockPtr();
+        for (size_t i = 0; i < nBlockRows; i++)
+        {
+            size_t pos = offsets[iStart + i] - 1;
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                const T value = x[i * nColumns + j];
+                if (isCategorical[j])
+                {
+                    outValues[pos]  = T(1);
+                    outColumns[pos] = firstColumns[j] + (size_t)value + 1;
+                    pos++;
+                }
+                else if (value != 0)
+                {
+                    outValues[pos]  = value;
+                    outColumns[pos] = firstColumns[j] + 1;
+                    pos++;
+                }
+            }
+        }
+        src.releaseBlockOfRows(block);
+    });
+
+    return CSRNumericTable::create<T>(values, colIndices, rowOffsets, nOutColumns, nRows, CSRNumericTableIface::oneBased, &s);
+}
+} // namespace
+
+#define DAAL_IMPL_CONVERTTOONEHOTCSR(T)                                                               \
+    template <>                                                                                       \
+    DAAL_EXPORT CSRNumericTablePtr convertToOneHotCSR<T>(NumericTable & src, services::Status * stat) \
+    {                                                                                                 \
+        services::Status s;                                                                           \
+        CSRNumericTablePtr result = convertToOneHotCSRImpl<T>(src, s);                                \
+        if (stat) stat->add(s);                                                                       \
+        return result;                                                                                \
+    }
+
+DAAL_IMPL_CONVERTTOONEHOTCSR(float)
+DAAL_IMPL_CONVERTTOONEHOTCSR(double)
+
 } // namespace data_management
 } // namespace daal
@@ -28,6 +28,7 @@
 #include "data_management/data/csr_numeric_table.h"
 #include "data_management/data/merged_numeric_table.h"
 #include "data_management/data/row_merged_numeric_table.h"
+#include "data_management/data/normalized_numeric_table.h"
 #include "data_management/data/symmetric_matrix.h"
 #include "data_management/data/matrix.h"
 #include "data_management/data/data_collection.h"
@@ -151,6 +152,7 @@ Factory::Factory() : _impl(nullptr)
     registerObject(new Creator<SOANumericTable>());
     registerObject(new Creator<MergedNumericTable>());
     registerObject(new Creator<RowMergedNumericTable>());
+    registerObject(new Creator<NormalizedNumericTable>());
     registerObject(new Creator<NumericTableDictionary>());
     registerObject(new Creator<data_management::DataCollection>());
     registerObject(new Creator<data_management::KeyValueDataCollection>());
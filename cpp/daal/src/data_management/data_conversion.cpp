@@ -87,6 +87,26 @@ static void vectorStrideConvertFunc(size_t n, const void * src, size_t srcByteSt
 #undef DAAL_VECTOR_STRIDE_CONVERT_CPU
 }
 
+template <typename T1, typename T2>
+static void vectorColumnsToRowsFunc(size_t nrows, size_t ncols, const void * const * columns, size_t srcByteStride, void * dst, size_t dstRowSize)
+{
+#define DAAL_VECTOR_COLUMNS_TO_ROWS_CPU(cpuId, ...) vectorColumnsToRowsFuncCpu<T1, T2, cpuId>(__VA_ARGS__);
+
+    DAAL_DISPATCH_FUNCTION_BY_CPU(DAAL_VECTOR_COLUMNS_TO_ROWS_CPU, nrows, ncols, columns, srcByteStride, dst, dstRowSize);
+
+#undef DAAL_VECTOR_COLUMNS_TO_ROWS_CPU
+}
+
+template <typename T1, typename T2>
+static void vectorRowsToColumnsFunc(size_t nrows, size_t ncols, const void * src, size_t srcRowSize, void * const * columns, size_t dstByteStride)
+{
+#define DAAL_VECTOR_ROWS_TO_COLUMNS_CPU(cpuId, ...) vectorRowsToColumnsFuncCpu<T1, T2, cpuId>(__VA_ARGS__);
+
+    DAAL_DISPATCH_FUNCTION_BY_CPU(DAAL_VECTOR_ROWS_TO_COLUMNS_CPU, nrows, ncols, src, srcRowSize, columns, dstByteStride);
+
+#undef DAAL_VECTOR_ROWS_TO_COLUMNS_CPU
+}
+
 template <typename T>
 DAAL_EXPORT void vectorAssignValueToArray(T * const dataPtr, const size_t n, const T value)
 {
@@ -177,6 +197,18 @@ DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideDownCast(int idx1, int id
     return table[idx1][idx2];
 }
 
+DAAL_EXPORT vectorColumnsToRowsFuncType getVectorColumnsToRowsUpCast(int idx1, int idx2)
+{
+    static vectorColumnsToRowsFuncType table[][3] = DAAL_CONVERT_UP_TABLE(vectorColumnsToRowsFunc);
+    return table[idx1][idx2];
+}
+
+DAAL_EXPORT vectorRowsToColumnsFuncType getVectorRowsToColumnsDownCast(int idx1, int idx2)
+{
+    static vectorRowsToColumnsFuncType table[][3] = DAAL_CONVERT_DOWN_TABLE(vectorRowsToColumnsFunc);
+    return table[idx1][idx2];
+}
+
 } // namespace internal
 namespace data_feature_utils
 {
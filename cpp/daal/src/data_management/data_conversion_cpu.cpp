@@ -134,6 +134,73 @@ void vectorStrideConvertFuncCpu(size_t n, const void * src, size_t srcByteStride
     }
 }
 
+/* The rows are transposed by the blocks that fit in L1 cache together with the columns they are copied from */
+const size_t conversionBlockRows = 64;
+
+template <typename T1, typename T2, CpuType cpu>
+void vectorColumnsToRowsFuncCpu(size_t nrows, size_t ncols, const void * const * columns, size_t srcByteStride, void * dst, size_t dstRowSize)
+{
+    for (size_t i0 = 0; i0 < nrows; i0 += conversionBlockRows)
+    {
+        const size_t nBlockRows = (i0 + conversionBlockRows < nrows) ? conversionBlockRows : nrows - i0;
+        T2 * rows               = (T2 *)dst + i0 * dstRowSize;
+
+        for (size_t j = 0; j < ncols; j++)
+        {
+            const char * column = (const char *)columns[j] + i0 * srcByteStride;
+            if (srcByteStride == sizeof(T1))
+            {
+                const T1 * values = (const T1 *)column;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nBlockRows; i++)
+                {
+                    rows[i * dstRowSize + j] = static_cast<T2>(values[i]);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < nBlockRows; i++)
+                {
+                    rows[i * dstRowSize + j] = static_cast<T2>(*(const T1 *)(column + i * srcByteStride));
+                }
+            }
+        }
+    }
+}
+
+template <typename T1, typename T2, CpuType cpu>
+void vectorRowsToColumnsFuncCpu(size_t nrows, size_t ncols, const void * src, size_t srcRowSize, void * const * columns, size_t dstByteStride)
+{
+    for (size_t i0 = 0; i0 < nrows; i0 += conversionBlockRows)
+    {
+        const size_t nBlockRows = (i0 + conversionBlockRows < nrows) ? conversionBlockRows : nrows - i0;
+        const T1 * rows         = (const T1 *)src + i0 * srcRowSize;
+
+        for (size_t j = 0; j < ncols; j++)
+        {
+            char * column = (char *)columns[j] + i0 * dstByteStride;
+            if (dstByteStride == sizeof(T2))
+            {
+                T2 * values = (T2 *)column;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nBlockRows; i++)
+                {
+                    values[i] = static_cast<T2>(rows[i * srcRowSize + j]);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < nBlockRows; i++)
+                {
+                    *(T2 *)(column + i * dstByteStride) = static_cast<T2>(rows[i * srcRowSize + j]);
+                }
+            }
+        }
+    }
+}
+
 #undef DAAL_FUNCS_UP_ENTRY
 #define DAAL_FUNCS_UP_ENTRY(F, T, A)        \
     template void F<T, float, DAAL_CPU> A;  \
@@ -175,6 +242,19 @@ DAAL_CONVERT_DOWN_FUNCS(vectorConvertFuncCpu, (size_t n, const void * src, void
 DAAL_CONVERT_UP_FUNCS(vectorStrideConvertFuncCpu, (size_t n, const void * src, size_t srcByteStride, void * dst, size_t dstByteStride))
 DAAL_CONVERT_DOWN_FUNCS(vectorStrideConvertFuncCpu, (size_t n, const void * src, size_t srcByteStride, void * dst, size_t dstByteStride))
 
+DAAL_CONVERT_UP_FUNCS(vectorColumnsToRowsFuncCpu,
+                      (size_t nrows, size_t ncols, const void * const * columns, size_t srcByteStride, void * dst, size_t dstRowSize))
+
+/* the functions from the rows to the columns are not instantiated by the up conversions, so all the types are listed */
+DAAL_FUNCS_DOWN_ENTRY(vectorRowsToColumnsFuncCpu, float,
+                      (size_t nrows, size_t ncols, const void * src, size_t srcRowSize, void * const * columns, size_t dstByteStride))
+DAAL_FUNCS_DOWN_ENTRY(vectorRowsToColumnsFuncCpu, double,
+                      (size_t nrows, size_t ncols, const void * src, size_t srcRowSize, void * const * columns, size_t dstByteStride))
+DAAL_FUNCS_DOWN_ENTRY(vectorRowsToColumnsFuncCpu, int,
+                      (size_t nrows, size_t ncols, const void * src, size_t srcRowSize, void * const * columns, size_t dstByteStride))
+DAAL_CONVERT_DOWN_FUNCS(vectorRowsToColumnsFuncCpu,
+                        (size_t nrows, size_t ncols, const void * src, size_t srcRowSize, void * const * columns, size_t dstByteStride))
+
 template <typename T, CpuType cpu>
 void vectorAssignValueToArrayCpu(void * const ptr, const size_t n, const void * const value)
 {
@@ -41,6 +41,12 @@ void vectorConvertFuncCpu(size_t n, const void * src, void * dst);
 template <typename T1, typename T2, CpuType cpu>
 void vectorStrideConvertFuncCpu(size_t n, const void * src, size_t srcByteStride, void * dst, size_t dstByteStride);
 
+template <typename T1, typename T2, CpuType cpu>
+void vectorColumnsToRowsFuncCpu(size_t nrows, size_t ncols, const void * const * columns, size_t srcByteStride, void * dst, size_t dstRowSize);
+
+template <typename T1, typename T2, CpuType cpu>
+void vectorRowsToColumnsFuncCpu(size_t nrows, size_t ncols, const void * src, size_t srcRowSize, void * const * columns, size_t dstByteStride);
+
 template <typename T, CpuType cpu>
 void vectorAssignValueToArrayCpu(void * const ptr, const size_t n, const void * const value);
 
@@ -0,0 +1,64 @@
+/* file: data_source_prefetcher.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data_source/internal/data_source_prefetcher.h"
+#include "data_management/data_source/data_source.h"
+#include "src/algorithms/service_threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+DataSourcePrefetcher::DataSourcePrefetcher() : _taskGroup(NULL), _nLoadedRows(0), _isStarted(false) {}
+
+DataSourcePrefetcher::~DataSourcePrefetcher()
+{
+    wait();
+    delete (daal::task_group *)_taskGroup;
+}
+
+void DataSourcePrefetcher::start(interface1::DataSourceIface & source, size_t maxRows, interface1::NumericTable * nt)
+{
+    wait();
+
+    if (!_taskGroup)
+    {
+        _taskGroup = new daal::task_group();
+    }
+
+    _nLoadedRows = 0;
+    _isStarted   = true;
+
+    size_t * nLoadedRows = &_nLoadedRows;
+    auto load            = [&source, maxRows, nt, nLoadedRows]() { *nLoadedRows = source.loadDataBlock(maxRows, nt); };
+    ((daal::task_group *)_taskGroup)->run(load);
+}
+
+size_t DataSourcePrefetcher::wait()
+{
+    if (!_isStarted) return 0;
+
+    ((daal::task_group *)_taskGroup)->wait();
+    _isStarted = false;
+    return _nLoadedRows;
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
@@ -523,6 +523,19 @@ services::Status allValuesAreFiniteImpl(NumericTable & table, bool allowNaN, boo
     const size_t nElements = nRows * nColumns;
     const NTLayout layout  = table.getDataLayout();
 
+    // the finiteness could be already known from the loading or the filling of the data
+    const NumericTable::FinitenessStatus knownStatus = table.getFinitenessStatus();
+    if (knownStatus == NumericTable::allFinite || knownStatus == NumericTable::notFinite)
+    {
+        *finiteness = (knownStatus == NumericTable::allFinite);
+        return s;
+    }
+    if (knownStatus == NumericTable::finiteOrNaN)
+    {
+        *finiteness = allowNaN;
+        return s;
+    }
+
     // first stage: compute sum of all values and check its finiteness
     double sum       = 0;
     bool sumIsFinite = true;
@@ -16,6 +16,8 @@
 *******************************************************************************/
 
 #include "data_management/data/merged_numeric_table.h"
+#include "src/threading/threading.h"
+#include "src/services/service_defines.h"
 
 namespace daal
 {
@@ -23,6 +25,60 @@ namespace data_management
 {
 namespace interface1
 {
+namespace
+{
+const size_t repackBlockSize       = 16384;
+const size_t repackThreadingBorder = 262144;
+
+/* Copies the block of rows x cols values between the arrays with the given row sizes */
+template <typename T>
+void copyValues(size_t rows, size_t cols, const T * src, size_t srcRowSize, T * dst, size_t dstRowSize)
+{
+    if (cols == 0) return;
+    const size_t blockRows = (repackBlockSize / cols) ? repackBlockSize / cols : 1;
+    const size_t nBlocks   = rows / blockRows + !!(rows % blockRows);
+    daal::conditional_threader_for(rows * cols > repackThreadingBorder, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * blockRows;
+        const size_t end   = (begin + blockRows < rows) ? begin + blockRows : rows;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            const T * srcRow = src + i * srcRowSize;
+            T * dstRow       = dst + i * dstRowSize;
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < cols; j++)
+            {
+                dstRow[j] = srcRow[j];
+            }
+        }
+    });
+}
+} // namespace
+
+template <typename T>
+void MergedNumericTable::internal_inner_repack(size_t pos, size_t cols, size_t rows, size_t ncols, T * src, T * dst)
+{
+    copyValues<T>(rows, cols, src, cols, dst + pos, ncols);
+}
+
+template <typename T>
+void MergedNumericTable::internal_outer_repack(size_t pos, size_t cols, size_t rows, size_t ncols, T * src, T * dst)
+{
+    copyValues<T>(rows, cols, src + pos, ncols, dst, cols);
+}
+
+#define DAAL_INSTANTIATE_REPACK(T)                                                                                    \
+    template DAAL_EXPORT void MergedNumericTable::internal_inner_repack<T>(size_t, size_t, size_t, size_t, T *, T *); \
+    template DAAL_EXPORT void MergedNumericTable::internal_outer_repack<T>(size_t, size_t, size_t, size_t, T *, T *);
+
+DAAL_INSTANTIATE_REPACK(double)
+DAAL_INSTANTIATE_REPACK(float)
+DAAL_INSTANTIATE_REPACK(int)
+
+#undef DAAL_INSTANTIATE_REPACK
+
 MergedNumericTable::MergedNumericTable() : NumericTable(0, 0), _tables(new DataCollection) {}
 
 MergedNumericTable::MergedNumericTable(NumericTablePtr table) : NumericTable(0, 0), _tables(new DataCollection)
@@ -0,0 +1,68 @@
+/* file: normalized_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data/normalized_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+NormalizedNumericTable::NormalizedNumericTable() : NumericTable(0, 0) {}
+
+services::SharedPtr<NormalizedNumericTable> NormalizedNumericTable::create(const NumericTablePtr & nestedTable, const NumericTablePtr & shift,
+                                                                           const NumericTablePtr & scale, services::Status * stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(NormalizedNumericTable, nestedTable, shift, scale);
+}
+
+NormalizedNumericTable::NormalizedNumericTable(const NumericTablePtr & nestedTable, const NumericTablePtr & shift, const NumericTablePtr & scale,
+                                               services::Status & st)
+    : NumericTable(0, 0), _table(nestedTable), _shift(shift), _scale(scale)
+{
+    if (!nestedTable || !shift || !scale)
+    {
+        st.add(services::ErrorNullInputNumericTable);
+    }
+    else if (nestedTable->getDataLayout() & csrArray)
+    {
+        st.add(services::ErrorIncorrectTypeOfInputNumericTable);
+    }
+    else
+    {
+        const size_t ncols = nestedTable->getNumberOfColumns();
+        if (shift->getNumberOfColumns() != ncols || scale->getNumberOfColumns() != ncols)
+        {
+            st.add(services::ErrorIncorrectNumberOfFeatures);
+        }
+        else if (shift->getNumberOfRows() != 1 || scale->getNumberOfRows() != 1)
+        {
+            st.add(services::ErrorIncorrectNumberOfObservations);
+        }
+        else
+        {
+            _ddict  = nestedTable->getDictionarySharedPtr();
+            _obsnum = nestedTable->getNumberOfRows();
+        }
+    }
+    this->_status |= st;
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
@@ -24,6 +24,7 @@
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/merged_numeric_table.h"
 #include "data_management/data/row_merged_numeric_table.h"
+#include "data_management/data/normalized_numeric_table.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
@@ -213,6 +214,7 @@ IMPLEMENT_SERIALIZABLE_TAG(CSRNumericTable, SERIALIZATION_CSR_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(AOSNumericTable, SERIALIZATION_AOS_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(MergedNumericTable, SERIALIZATION_MERGE_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(RowMergedNumericTable, SERIALIZATION_ROWMERGE_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG(NormalizedNumericTable, SERIALIZATION_NORMALIZED_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(DataCollection, SERIALIZATION_DATACOLLECTION_ID)
 IMPLEMENT_SERIALIZABLE_TAG(MemoryBlock, SERIALIZATION_MEMORY_BLOCK_ID)
 
@@ -0,0 +1,170 @@
+/** file numeric_table_basic_statistics.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Computation of the basic statistics of the columns of the numeric table.
+//--
+*/
+
+#include "data_management/data/numeric_table.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_defines.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/service_error_handling.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace
+{
+const size_t basicStatisticsRowsInBlock = 1024;
+
+/* Minimums, maximums, sums and sums of squares of the columns of the rows processed by one chunk */
+struct BasicStatisticsPartial
+{
+    explicit BasicStatisticsPartial(size_t nColumns) : values(new double[4 * nColumns]), nColumns(nColumns)
+    {
+        const double maxValue = services::internal::MaxVal<double>::get();
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            values[j]                = maxValue;
+            values[nColumns + j]     = -maxValue;
+            values[2 * nColumns + j] = 0;
+            values[3 * nColumns + j] = 0;
+        }
+    }
+
+    ~BasicStatisticsPartial() { delete[] values; }
+
+    void update(const double * rows, size_t nRows)
+    {
+        double * minimum    = values;
+        double * maximum    = values + nColumns;
+        double * sum        = values + 2 * nColumns;
+        double * sumSquares = values + 3 * nColumns;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const double * row = rows + i * nColumns;
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                const double value = row[j];
+                minimum[j]         = (value < minimum[j]) ? value : minimum[j];
+                maximum[j]         = (value > maximum[j]) ? value : maximum[j];
+                sum[j] += value;
+                sumSquares[j] += value * value;
+            }
+        }
+    }
+
+    void merge(const BasicStatisticsPartial & other)
+    {
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            values[j]            = (other.values[j] < values[j]) ? other.values[j] : values[j];
+            values[nColumns + j] = (other.values[nColumns + j] > values[nColumns + j]) ? other.values[nColumns + j] : values[nColumns + j];
+            values[2 * nColumns + j] += other.values[2 * nColumns + j];
+            values[3 * nColumns + j] += other.values[3 * nColumns + j];
+        }
+    }
+
+    double * values;
+    size_t nColumns;
+};
+
+services::Status writeBasicStatistics(NumericTable & table, const double * values)
+{
+    BlockDescriptor<double> block;
+    DAAL_CHECK_STATUS_OK(table.getBlockOfRows(0, 1, writeOnly, block), services::ErrorMemoryAllocationFailed);
+    double * dst   = block.getBlockPtr();
+    const size_t n = table.getNumberOfColumns();
+    for (size_t j = 0; j < n; j++)
+    {
+        dst[j] = values[j];
+    }
+    return table.releaseBlockOfRows(block);
+}
+
+} // namespace
+
+services::Status NumericTable::computeBasicStatistics()
+{
+    if (_basicStatisticsStatus == basicStatisticsActual) return services::Status();
+
+    const size_t nRows    = getNumberOfRows();
+    const size_t nColumns = getNumberOfColumns();
+    DAAL_CHECK(nRows > 0 && nColumns > 0, services::ErrorEmptyInputNumericTable);
+
+    services::Status status;
+    DAAL_CHECK_STATUS(status, allocateBasicStatistics());
+    const BasicStatisticsId ids[] = { minimum, maximum, sum, sumSquares };
+    for (size_t k = 0; k < 4; k++)
+    {
+        NumericTablePtr statistics = basicStatistics.get(ids[k]);
+        if (statistics->getNumberOfRows() != 1) DAAL_CHECK_STATUS(status, statistics->resize(1));
+    }
+
+    /* The partial statistics are merged in the order of the chunks of the rows, so the statistics do not depend on the number of the threads */
+    const size_t nBlocks = (nRows + basicStatisticsRowsInBlock - 1) / basicStatisticsRowsInBlock;
+    daal::blocked_tls<BasicStatisticsPartial *> partials([=]() { return new BasicStatisticsPartial(nColumns); }, true,
+                                                         daal::ordered_tls_chunk_count(4 * nColumns * sizeof(double)));
+
+    SafeStatus safeStat;
+    partials.for_blocks(nBlocks, [&](int iBlock, BasicStatisticsPartial * partial) {
+        const size_t startRow   = iBlock * basicStatisticsRowsInBlock;
+        const size_t nBlockRows = (startRow + basicStatisticsRowsInBlock < nRows) ? basicStatisticsRowsInBlock : nRows - startRow;
+
+        BlockDescriptor<double> block;
+        services::Status localStatus = getBlockOfRows(startRow, nBlockRows, readOnly, block);
+        if (localStatus && block.getBlockPtr())
+        {
+            partial->update(block.getBlockPtr(), nBlockRows);
+        }
+        else
+        {
+            safeStat.add(localStatus ? services::Status(services::ErrorMemoryAllocationFailed) : localStatus);
+        }
+        safeStat |= releaseBlockOfRows(block);
+    });
+
+    BasicStatisticsPartial total(nColumns);
+    partials.reduce([&](BasicStatisticsPartial * partial) {
+        total.merge(*partial);
+        delete partial;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    for (size_t k = 0; k < 4; k++)
+    {
+        DAAL_CHECK_STATUS(status, writeBasicStatistics(*basicStatistics.get(ids[k]), total.values + k * nColumns));
+    }
+    _basicStatisticsStatus = basicStatisticsActual;
+
+    /* The sums of squares are finite only if all the values are finite */
+    bool sumSquaresAreFinite = true;
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        sumSquaresAreFinite &= (getValueFiniteness(total.values[3 * nColumns + j]) == allFinite);
+    }
+    if (sumSquaresAreFinite) _finitenessStatus = allFinite;
+
+    return status;
+}
+
+} // namespace data_management
+} // namespace daal
@@ -0,0 +1,168 @@
+/* file: numeric_table_packer.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data/numeric_table_packer.h"
+#include "services/daal_memory.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+namespace
+{
+size_t getValueSize(PackedValueType type)
+{
+    return (type == packedFloat64) ? sizeof(double) : sizeof(float);
+}
+
+template <typename T>
+services::Status packValues(NumericTable & table, PackedLayout layout, byte * buffer)
+{
+    const size_t nRows = table.getNumberOfRows();
+    const size_t nCols = table.getNumberOfColumns();
+    if (!nRows) return services::Status();
+
+    BlockDescriptor<T> block;
+    services::Status s = table.getBlockOfRows(0, nRows, readOnly, block);
+    DAAL_CHECK_STATUS_VAR(s);
+    const T * values = block.getBlockPtr();
+    DAAL_CHECK(values, services::ErrorMemoryAllocationFailed);
+
+    if (layout == packedFull)
+    {
+        const size_t size = nRows * nCols * sizeof(T);
+        services::internal::daal_memcpy_s(buffer, size, values, size);
+    }
+    else
+    {
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const size_t size = (nCols - i) * sizeof(T);
+            services::internal::daal_memcpy_s(buffer, size, values + i * nCols + i, size);
+            buffer += size;
+        }
+    }
+    return table.releaseBlockOfRows(block);
+}
+
+template <typename T>
+services::Status unpackValues(NumericTable & table, PackedLayout layout, const byte * buffer)
+{
+    const size_t nRows = table.getNumberOfRows();
+    const size_t nCols = table.getNumberOfColumns();
+    if (!nRows) return services::Status();
+
+    BlockDescriptor<T> block;
+    services::Status s = table.getBlockOfRows(0, nRows, writeOnly, block);
+    DAAL_CHECK_STATUS_VAR(s);
+    T * values = block.getBlockPtr();
+    DAAL_CHECK(values, services::ErrorMemoryAllocationFailed);
+
+    if (layout == packedFull)
+    {
+        const size_t size = nRows * nCols * sizeof(T);
+        services::internal::daal_memcpy_s(values, size, buffer, size);
+    }
+    else
+    {
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const size_t size = (nCols - i) * sizeof(T);
+            services::internal::daal_memcpy_s(values + i * nCols + i, size, buffer, size);
+            buffer += size;
+            for (size_t j = i + 1; j < nCols; ++j)
+            {
+                values[j * nCols + i] = values[i * nCols + j];
+            }
+        }
+    }
+    return table.releaseBlockOfRows(block);
+}
+
+} // namespace
+
+services::Status NumericTablePacker::add(const NumericTablePtr & table, PackedValueType type, PackedLayout layout)
+{
+    DAAL_CHECK(table, services::ErrorNullNumericTable);
+    DAAL_CHECK(type == packedFloat64 || type == packedFloat32 || type == packedInt32, services::ErrorIncorrectParameter);
+    DAAL_CHECK(layout == packedFull || layout == packedUpperTriangle, services::ErrorIncorrectParameter);
+
+    const size_t nRows = table->getNumberOfRows();
+    const size_t nCols = table->getNumberOfColumns();
+    DAAL_CHECK(layout == packedFull || nRows == nCols, services::ErrorIncorrectSizeOfInputNumericTable);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nCols);
+
+    Entry entry;
+    entry.table   = table;
+    entry.type    = type;
+    entry.layout  = layout;
+    entry.nValues = (layout == packedFull) ? nRows * nCols : nRows * (nRows + 1) / 2;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, entry.nValues, getValueSize(type));
+
+    const size_t tableSize = entry.nValues * getValueSize(type);
+    DAAL_OVERFLOW_CHECK_BY_ADDING(size_t, _packedSize, tableSize);
+
+    DAAL_CHECK(_entries.safe_push_back(entry), services::ErrorMemoryAllocationFailed);
+    _packedSize += tableSize;
+    return services::Status();
+}
+
+services::Status NumericTablePacker::pack(byte * buffer, size_t size) const
+{
+    DAAL_CHECK(size == _packedSize, services::ErrorIncorrectSizeOfArray);
+    DAAL_CHECK(buffer || !size, services::ErrorNullPtr);
+
+    services::Status s;
+    for (size_t i = 0; i < _entries.size() && s; ++i)
+    {
+        const Entry & entry = _entries[i];
+        switch (entry.type)
+        {
+        case packedFloat64: s |= packValues<double>(*entry.table, entry.layout, buffer); break;
+        case packedFloat32: s |= packValues<float>(*entry.table, entry.layout, buffer); break;
+        default: s |= packValues<int>(*entry.table, entry.layout, buffer); break;
+        }
+        buffer += entry.nValues * getValueSize(entry.type);
+    }
+    return s;
+}
+
+services::Status NumericTablePacker::unpack(const byte * buffer, size_t size) const
+{
+    DAAL_CHECK(size == _packedSize, services::ErrorIncorrectSizeOfArray);
+    DAAL_CHECK(buffer || !size, services::ErrorNullPtr);
+
+    services::Status s;
+    for (size_t i = 0; i < _entries.size() && s; ++i)
+    {
+        const Entry & entry = _entries[i];
+        switch (entry.type)
+        {
+        case packedFloat64: s |= unpackValues<double>(*entry.table, entry.layout, buffer); break;
+        case packedFloat32: s |= unpackValues<float>(*entry.table, entry.layout, buffer); break;
+        default: s |= unpackValues<int>(*entry.table, entry.layout, buffer); break;
+        }
+        buffer += entry.nValues * getValueSize(entry.type);
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
@@ -16,6 +16,8 @@
 *******************************************************************************/
 
 #include "data_management/data/row_merged_numeric_table.h"
+#include "src/threading/threading.h"
+#include "src/services/service_defines.h"
 
 namespace daal
 {
@@ -23,6 +25,51 @@ namespace data_management
 {
 namespace interface1
 {
+namespace
+{
+const size_t repackBlockSize       = 16384;
+const size_t repackThreadingBorder = 262144;
+
+template <typename T>
+void copyValues(size_t n, const T * src, T * dst)
+{
+    const size_t nBlocks = n / repackBlockSize + !!(n % repackBlockSize);
+    daal::conditional_threader_for(n > repackThreadingBorder, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * repackBlockSize;
+        const size_t end   = (begin + repackBlockSize < n) ? begin + repackBlockSize : n;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = begin; i < end; i++)
+        {
+            dst[i] = src[i];
+        }
+    });
+}
+} // namespace
+
+template <typename T>
+void RowMergedNumericTable::internal_inner_repack(size_t idx, size_t rows, size_t ncols, T * src, T * dst)
+{
+    copyValues<T>(rows * ncols, src, dst + idx * ncols);
+}
+
+template <typename T>
+void RowMergedNumericTable::internal_outer_repack(size_t idx, size_t rows, size_t ncols, T * src, T * dst)
+{
+    copyValues<T>(rows * ncols, src + idx * ncols, dst);
+}
+
+#define DAAL_INSTANTIATE_REPACK(T)                                                                               \
+    template DAAL_EXPORT void RowMergedNumericTable::internal_inner_repack<T>(size_t, size_t, size_t, T *, T *); \
+    template DAAL_EXPORT void RowMergedNumericTable::internal_outer_repack<T>(size_t, size_t, size_t, T *, T *);
+
+DAAL_INSTANTIATE_REPACK(double)
+DAAL_INSTANTIATE_REPACK(float)
+DAAL_INSTANTIATE_REPACK(int)
+
+#undef DAAL_INSTANTIATE_REPACK
+
 RowMergedNumericTable::RowMergedNumericTable() : NumericTable(0, 0), _tables(new DataCollection) {}
 
 RowMergedNumericTable::RowMergedNumericTable(NumericTablePtr table) : NumericTable(0, 0), _tables(new DataCollection)
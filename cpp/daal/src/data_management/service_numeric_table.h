@@ -510,6 +510,8 @@ using daal::services::internal::TArray;
 using daal::services::internal::TArrayCalloc;
 using daal::services::internal::TArrayScalable;
 using daal::services::internal::TArrayScalableCalloc;
+using daal::services::internal::TArrayArena;
+using daal::services::internal::TArrayArenaCalloc;
 
 using daal::services::internal::TNArray;
 
@@ -0,0 +1,227 @@
+/* file: string_row_block.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data_source/internal/string_row_block.h"
+#include "data_management/data_source/internal/csv_feature_utils.h"
+#include "services/daal_memory.h"
+#include "src/threading/threading.h"
+#include "src/services/service_defines.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+StringRowBlock::StringRowBlock() : _data(NULL), _dataCapacity(0), _offsets(NULL), _offsetsCapacity(0), _nRows(0) {}
+
+StringRowBlock::~StringRowBlock()
+{
+    daal::services::daal_free(_data);
+    daal::services::daal_free(_offsets);
+}
+
+services::Status StringRowBlock::addRow(const char * rawRowData, size_t rawDataSize)
+{
+    if (_nRows + 2 > _offsetsCapacity)
+    {
+        const size_t newCapacity = (_offsetsCapacity > 0) ? 2 * _offsetsCapacity : 1024;
+        size_t * newOffsets      = (size_t *)daal::services::daal_malloc(newCapacity * sizeof(size_t));
+        DAAL_CHECK_MALLOC(newOffsets);
+        if (_offsets)
+        {
+            daal::services::internal::daal_memcpy_s(newOffsets, newCapacity * sizeof(size_t), _offsets, (_nRows + 1) * sizeof(size_t));
+        }
+        else
+        {
+            newOffsets[0] = 0;
+        }
+        daal::services::daal_free(_offsets);
+        _offsets         = newOffsets;
+        _offsetsCapacity = newCapacity;
+    }
+
+    const size_t dataSize = _offsets[_nRows];
+    if (dataSize + rawDataSize + 1 > _dataCapacity)
+    {
+        size_t newCapacity = (_dataCapacity > 0) ? 2 * _dataCapacity : 65536;
+        while (newCapacity < dataSize + rawDataSize + 1) newCapacity *= 2;
+        char * newData = (char *)daal::services::daal_malloc(newCapacity);
+        DAAL_CHECK_MALLOC(newData);
+        if (_data && dataSize)
+        {
+            daal::services::internal::daal_memcpy_s(newData, newCapacity, _data, dataSize);
+        }
+        daal::services::daal_free(_data);
+        _data         = newData;
+        _dataCapacity = newCapacity;
+    }
+
+    if (rawDataSize)
+    {
+        daal::services::internal::daal_memcpy_s(_data + dataSize, _dataCapacity - dataSize, rawRowData, rawDataSize);
+    }
+    _data[dataSize + rawDataSize] = '\0';
+    _offsets[_nRows + 1]          = dataSize + rawDataSize + 1;
+    _nRows++;
+    return services::Status();
+}
+
+namespace
+{
+/* The categories met first in a range of the rows in the order of the rows, with the numbers of their occurrences */
+struct RangeCategories
+{
+    std::unordered_map<std::string, int> codes;
+    std::vector<std::string> names;
+    std::vector<int> counts;
+};
+
+/* The smallest number of the rows parsed by a thread */
+const size_t minRowsInRange = 256;
+} // namespace
+
+services::Status parseCSVRowBlock(StringRowBlock & rowBlock, char delimiter, size_t nTokens, const CSVTokenKind * kinds, const size_t * positions,
+                                  interface1::DataSourceFeature * const * features, DAAL_DATA_TYPE * rows, size_t nColumns)
+{
+    const size_t nRows = rowBlock.size();
+    if (nRows == 0) return services::Status();
+
+    std::vector<size_t> categoricalTokens;
+    for (size_t i = 0; i < nTokens; i++)
+    {
+        if (kinds[i] == csvCategoricalToken) categoricalTokens.push_back(i);
+    }
+    const size_t nCategorical = categoricalTokens.size();
+
+    const size_t nThreads = daal::threader_get_threads_number();
+    size_t nRanges        = nRows / minRowsInRange + !!(nRows % minRowsInRange);
+    if (nRanges > 4 * nThreads) nRanges = 4 * nThreads;
+    const size_t rowsInRange = nRows / nRanges + !!(nRows % nRanges);
+    nRanges                  = nRows / rowsInRange + !!(nRows % rowsInRange);
+
+    /* categories[r * nCategorical + c] are the categories of the categorical token c in the range r, the rows keep the codes
+       of the categories within the range till the merge */
+    std::vector<RangeCategories> categories(nRanges * nCategorical);
+    std::vector<size_t> nParsedTokens(nRows);
+
+    daal::threader_for(nRanges, nRanges, [&](size_t r) {
+        const size_t iStart = r * rowsInRange;
+        const size_t iEnd   = (iStart + rowsInRange > nRows) ? nRows : iStart + rowsInRange;
+
+        RangeCategories * rangeCategories = categories.data() + r * nCategorical;
+        std::string name;
+
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            DAAL_DATA_TYPE * row = rows + i * nColumns;
+            CSVRowTokenizer tokenizer(rowBlock.getRow(i), rowBlock.getRowSize(i), delimiter);
+
+            size_t k = 0;
+            size_t c = 0;
+            for (tokenizer.reset(); tokenizer.good() && k < nTokens; tokenizer.next(), k++)
+            {
+                if (kinds[k] == csvContinuousToken)
+                {
+                    row[positions[k]] = (DAAL_DATA_TYPE)daal::services::daal_string_to_float(tokenizer.getCurrentToken().c_str(), 0);
+                }
+                else if (kinds[k] == csvCategoricalToken)
+                {
+                    while (categoricalTokens[c] < k) c++;
+                    RangeCategories & tokenCategories = rangeCategories[c];
+
+                    name.assign(tokenizer.getCurrentToken().c_str());
+                    std::unordered_map<std::string, int>::iterator it = tokenCategories.codes.find(name);
+                    int code                                          = 0;
+                    if (it != tokenCategories.codes.end())
+                    {
+                        code = it->second;
+                        tokenCategories.counts[code]++;
+                    }
+                    else
+                    {
+                        code = (int)tokenCategories.names.size();
+                        tokenCategories.codes.insert(std::make_pair(name, code));
+                        tokenCategories.names.push_back(name);
+                        tokenCategories.counts.push_back(1);
+                    }
+                    row[positions[k]] = (DAAL_DATA_TYPE)code;
+                }
+            }
+            nParsedTokens[i] = k;
+        }
+    });
+
+    if (nCategorical == 0) return services::Status();
+
+    /* The codes of the ranges are mapped to the codes of the dictionaries, the ranges are merged in the order of the rows */
+    std::vector<std::vector<int> > globalCodes(nRanges * nCategorical);
+    for (size_t c = 0; c < nCategorical; c++)
+    {
+        interface1::DataSourceFeature * feature         = features[categoricalTokens[c]];
+        interface1::CategoricalFeatureDictionary * dict = feature->getCategoricalDictionary();
+        DAAL_CHECK(dict, services::ErrorMemoryAllocationFailed);
+
+        for (size_t r = 0; r < nRanges; r++)
+        {
+            const RangeCategories & rangeCategories = categories[r * nCategorical + c];
+            std::vector<int> & codes                = globalCodes[r * nCategorical + c];
+            codes.resize(rangeCategories.names.size());
+
+            for (size_t k = 0; k < rangeCategories.names.size(); k++)
+            {
+                interface1::CategoricalFeatureDictionary::iterator it = dict->find(rangeCategories.names[k]);
+                if (it != dict->end())
+                {
+                    codes[k] = it->second.first;
+                    it->second.second += rangeCategories.counts[k];
+                }
+                else
+                {
+                    const int index = (int)dict->size();
+                    dict->insert(std::make_pair(rangeCategories.names[k], std::make_pair(index, rangeCategories.counts[k])));
+                    codes[k]                          = index;
+                    feature->ntFeature.categoryNumber = index + 1;
+                }
+            }
+        }
+    }
+
+    daal::threader_for(nRanges, nRanges, [&](size_t r) {
+        const size_t iStart = r * rowsInRange;
+        const size_t iEnd   = (iStart + rowsInRange > nRows) ? nRows : iStart + rowsInRange;
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            DAAL_DATA_TYPE * row = rows + i * nColumns;
+            for (size_t c = 0; c < nCategorical && categoricalTokens[c] < nParsedTokens[i]; c++)
+            {
+                const std::vector<int> & codes = globalCodes[r * nCategorical + c];
+                DAAL_DATA_TYPE & value         = row[positions[categoricalTokens[c]]];
+                value                          = (DAAL_DATA_TYPE)codes[(size_t)value];
+            }
+        }
+    });
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
@@ -29,6 +29,7 @@
 #include "src/algorithms/service_error_handling.h"
 #include "src/externals/service_rng.h"
 #include "src/externals/service_rng_mkl.h"
+#include "src/externals/service_memory.h"
 
 namespace daal
 {
@@ -41,6 +42,14 @@ typedef daal::data_management::NumericTable::StorageLayout NTLayout;
 const size_t BLOCK_CONST      = 2048;
 const size_t THREADING_BORDER = 8388608;
 
+/* the indices are shuffled by the buckets of about SHUFFLE_BUCKET_SIZE indices that fit in L2 cache */
+const size_t SHUFFLE_BY_BUCKETS_BORDER = THREADING_BORDER / 16;
+const size_t SHUFFLE_BUCKET_SIZE       = 262144;
+const size_t SHUFFLE_MAX_BUCKETS_LOG   = 16;
+const size_t SHUFFLE_RNG_BLOCK_SIZE    = BLOCK_CONST;
+/* distance between the subsequences of the buckets in the Philox4x32-10 sequence */
+const size_t PHILOX_BUCKET_SUBSEQUENCE = size_t(1) << 40;
+
 const size_t MT19937_NUMBERS        = 624;
 const size_t MT19937_SIZE           = 631;
 const size_t MT19937_NUMBERS_OFFSET = 5;
@@ -65,10 +74,8 @@ size_t genSwapIdx(size_t i, unsigned int * randomNumbers, size_t & rnIdx)
 }
 
 template <daal::CpuType cpu>
-services::Status generateRandomNumbers(const int * rngState, unsigned int * randomNumbers, const size_t nSkip, const size_t n)
+services::Status loadMT19937State(daal::internal::mkl::BaseRNG<cpu> & baseRng, const int * rngState, const size_t nSkip)
 {
-    // initialize baseRNG
-    daal::internal::mkl::BaseRNG<cpu> baseRng(0, VSL_BRNG_MT19937);
     // check that it has correct size
     DAAL_CHECK(baseRng.getStateSize() / 4 == MT19937_SIZE, daal::services::ErrorEngineNotSupported);
     daal::services::internal::TArray<unsigned int, cpu> baseRngStateArr(baseRng.getStateSize() / 4);
@@ -79,15 +86,173 @@ services::Status generateRandomNumbers(const int * rngState, unsigned int * rand
     services::internal::daal_memcpy_s(baseRngState + MT19937_NUMBERS_OFFSET, MT19937_NUMBERS * sizeof(unsigned int), rngState,
                                       MT19937_NUMBERS * sizeof(unsigned int));
     baseRng.loadState(baseRngState);
-    daal::internal::RNGs<unsigned int, cpu> rng;
 
     if (nSkip != 0) baseRng.skipAhead(nSkip);
 
+    return services::Status();
+}
+
+template <daal::CpuType cpu>
+services::Status generateRandomNumbers(const int * rngState, unsigned int * randomNumbers, const size_t nSkip, const size_t n)
+{
+    // initialize baseRNG
+    daal::internal::mkl::BaseRNG<cpu> baseRng(0, VSL_BRNG_MT19937);
+    services::Status s = loadMT19937State<cpu>(baseRng, rngState, nSkip);
+    DAAL_CHECK_STATUS_VAR(s);
+    daal::internal::RNGs<unsigned int, cpu> rng;
+
     rng.uniformBits32(n, randomNumbers + nSkip, baseRng.getState());
 
     return services::Status();
 }
 
+/* Assigns the buckets to the indices from start to end, the bucket of the index i is given by the highest bits of the
+   i-th number of the MT19937 sequence */
+template <daal::CpuType cpu>
+services::Status assignBuckets(const int * rngState, unsigned short * buckets, size_t * bucketCounts, const size_t nBucketsLog, const size_t start,
+                               const size_t end)
+{
+    daal::internal::mkl::BaseRNG<cpu> baseRng(0, VSL_BRNG_MT19937);
+    services::Status s = loadMT19937State<cpu>(baseRng, rngState, start);
+    DAAL_CHECK_STATUS_VAR(s);
+    daal::internal::RNGs<unsigned int, cpu> rng;
+
+    daal::services::internal::TArray<unsigned int, cpu> randomUIntsArr(SHUFFLE_RNG_BLOCK_SIZE);
+    unsigned int * randomUInts = randomUIntsArr.get();
+    DAAL_CHECK_MALLOC(randomUInts);
+
+    const size_t nBuckets = size_t(1) << nBucketsLog;
+    daal::services::internal::service_memset_seq<size_t, cpu>(bucketCounts, 0, nBuckets);
+
+    for (size_t iStart = start; iStart < end; iStart += SHUFFLE_RNG_BLOCK_SIZE)
+    {
+        const size_t nNumbers = daal::services::internal::min<cpu, size_t>(SHUFFLE_RNG_BLOCK_SIZE, end - iStart);
+        DAAL_CHECK(!rng.uniformBits32(nNumbers, randomUInts, baseRng.getState()), ErrorIncorrectErrorcodeFromGenerator);
+
+        unsigned short * blockBuckets = buckets + iStart;
+        for (size_t i = 0; i < nNumbers; ++i)
+        {
+            const size_t bucket = nBucketsLog ? (randomUInts[i] >> (32 - nBucketsLog)) : 0;
+            blockBuckets[i]     = (unsigned short)bucket;
+            ++bucketCounts[bucket];
+        }
+    }
+
+    return services::Status();
+}
+
+/* Shuffles the indices of the bucket in place with the subsequence of the bucket in the Philox4x32-10 sequence */
+template <typename IdxType, daal::CpuType cpu>
+services::Status shuffleBucket(const unsigned int seed, const size_t iBucket, IdxType * idx, const size_t n)
+{
+    if (n < 2) return services::Status();
+
+    daal::internal::mkl::BaseRNG<cpu> baseRng(seed, __DAAL_BRNG_PHILOX4X32X10);
+    DAAL_CHECK(!baseRng.skipAhead(iBucket * PHILOX_BUCKET_SUBSEQUENCE), ErrorIncorrectErrorcodeFromGenerator);
+    daal::internal::RNGs<unsigned int, cpu> rng;
+
+    daal::services::internal::TArray<unsigned int, cpu> randomUIntsArr(SHUFFLE_RNG_BLOCK_SIZE);
+    unsigned int * randomUInts = randomUIntsArr.get();
+    DAAL_CHECK_MALLOC(randomUInts);
+
+    size_t rnIdx = SHUFFLE_RNG_BLOCK_SIZE;
+    for (size_t i = n - 1; i > 0; --i)
+    {
+        uint32_t bitMask = i;
+        bitMask |= bitMask >> 1;
+        bitMask |= bitMask >> 2;
+        bitMask |= bitMask >> 4;
+        bitMask |= bitMask >> 8;
+        bitMask |= bitMask >> 16;
+
+        size_t j = i + 1;
+        while (j > i)
+        {
+            if (rnIdx == SHUFFLE_RNG_BLOCK_SIZE)
+            {
+                DAAL_CHECK(!rng.uniformBits32(SHUFFLE_RNG_BLOCK_SIZE, randomUInts, baseRng.getState()), ErrorIncorrectErrorcodeFromGenerator);
+                rnIdx = 0;
+            }
+            j = randomUInts[rnIdx++] & bitMask;
+        }
+        daal::services::internal::swap<cpu, IdxType>(idx[i], idx[j]);
+    }
+
+    return services::Status();
+}
+
+/* Generates the permutation in parallel: every index is moved to the random bucket keeping the order of the indices,
+   then the buckets are shuffled independently. The buckets and their subsequences of random numbers do not depend on
+   the partitioning of the indices between the threads, so neither does the permutation */
+template <typename IdxType, daal::CpuType cpu>
+services::Status shuffleIndicesByBuckets(const int * rngState, IdxType * idx, const size_t n, const size_t nThreads)
+{
+    size_t nBucketsLog = 0;
+    while ((SHUFFLE_BUCKET_SIZE << nBucketsLog) < n && nBucketsLog < SHUFFLE_MAX_BUCKETS_LOG) ++nBucketsLog;
+    const size_t nBuckets = size_t(1) << nBucketsLog;
+
+    const size_t nChunks   = daal::services::internal::max<cpu, size_t>(daal::services::internal::min<cpu, size_t>(4 * nThreads, n / BLOCK_CONST), 1);
+    const size_t chunkSize = n / nChunks + !!(n % nChunks);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nChunks, nBuckets);
+
+    daal::services::internal::TArray<unsigned short, cpu> bucketsArr(n);
+    daal::services::internal::TArray<size_t, cpu> offsetsArr(nChunks * nBuckets);
+    daal::services::internal::TArray<size_t, cpu> bucketStartsArr(nBuckets + 1);
+    unsigned short * buckets = bucketsArr.get();
+    size_t * offsets         = offsetsArr.get();
+    size_t * bucketStarts    = bucketStartsArr.get();
+    DAAL_CHECK_MALLOC(buckets && offsets && bucketStarts);
+
+    /* the seed of the bucket subsequences follows the numbers used for the buckets in the MT19937 sequence */
+    unsigned int philoxSeed = 0;
+    {
+        daal::internal::mkl::BaseRNG<cpu> baseRng(0, VSL_BRNG_MT19937);
+        services::Status st = loadMT19937State<cpu>(baseRng, rngState, n);
+        DAAL_CHECK_STATUS_VAR(st);
+        daal::internal::RNGs<unsigned int, cpu> rng;
+        DAAL_CHECK(!rng.uniformBits32(1, &philoxSeed, baseRng.getState()), ErrorIncorrectErrorcodeFromGenerator);
+    }
+
+    daal::SafeStatus safeStat;
+    daal::threader_for(nChunks, nChunks, [&](size_t iChunk) {
+        const size_t start = iChunk * chunkSize;
+        const size_t end   = daal::services::internal::min<cpu, size_t>(start + chunkSize, n);
+        safeStat |= assignBuckets<cpu>(rngState, buckets, offsets + iChunk * nBuckets, nBucketsLog, start, end);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* the indices of the bucket go in the order of the chunks */
+    size_t offset = 0;
+    for (size_t iBucket = 0; iBucket < nBuckets; ++iBucket)
+    {
+        bucketStarts[iBucket] = offset;
+        for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            const size_t count                   = offsets[iChunk * nBuckets + iBucket];
+            offsets[iChunk * nBuckets + iBucket] = offset;
+            offset += count;
+        }
+    }
+    bucketStarts[nBuckets] = offset;
+
+    daal::threader_for(nChunks, nChunks, [&](size_t iChunk) {
+        const size_t start    = iChunk * chunkSize;
+        const size_t end      = daal::services::internal::min<cpu, size_t>(start + chunkSize, n);
+        size_t * chunkOffsets = offsets + iChunk * nBuckets;
+        for (size_t i = start; i < end; ++i)
+        {
+            idx[chunkOffsets[buckets[i]]++] = (IdxType)i;
+        }
+    });
+
+    daal::threader_for(nBuckets, nBuckets, [&](size_t iBucket) {
+        const size_t start = bucketStarts[iBucket];
+        safeStat |= shuffleBucket<IdxType, cpu>(philoxSeed, iBucket, idx + start, bucketStarts[iBucket + 1] - start);
+    });
+
+    return safeStat.detach();
+}
+
 template <typename IdxType, daal::CpuType cpu>
 services::Status generateShuffledIndicesImpl(const NumericTablePtr & idxTable, const NumericTablePtr & rngStateTable)
 {
@@ -95,9 +260,6 @@ services::Status generateShuffledIndicesImpl(const NumericTablePtr & idxTable, c
     const size_t nThreads  = threader_get_threads_number();
     const size_t n         = idxTable->getNumberOfRows();
     const size_t stateSize = rngStateTable->getNumberOfRows();
-    // number of generated uints: 1.5x of n for reserve
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n / 2lu, 3lu);
-    const size_t nRandomUInts = n / 2lu * 3lu;
 
     daal::internal::WriteColumns<IdxType, cpu> idxBlock(*idxTable, 0, 0, n);
     IdxType * idx = idxBlock.get();
@@ -110,6 +272,16 @@ services::Status generateShuffledIndicesImpl(const NumericTablePtr & idxTable, c
     const int * rngState = rngStateBlock.get();
     DAAL_CHECK_MALLOC(rngState);
 
+    // the choice of the method depends only on the number of indices, so the permutation does not depend on the number of threads
+    if (n > SHUFFLE_BY_BUCKETS_BORDER)
+    {
+        return shuffleIndicesByBuckets<IdxType, cpu>(rngState, idx, n, nThreads);
+    }
+
+    // number of generated uints: 1.5x of n for reserve
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n / 2lu, 3lu);
+    const size_t nRandomUInts = n / 2lu * 3lu;
+
     daal::services::internal::TArray<unsigned int, cpu> randomUIntsArr(nRandomUInts);
     unsigned int * randomUInts = randomUIntsArr.get();
     DAAL_CHECK_MALLOC(randomUInts);
@@ -181,107 +353,111 @@ services::Status assignColumnValues(const DataType * origDataPtr, const NumericT
     return services::Status();
 }
 
-template <typename DataType, typename IdxType, daal::CpuType cpu>
-services::Status assignColumnSubset(const DataType * origDataPtr, const NumericTablePtr & dataTable, const IdxType * idxPtr, const size_t nRows,
-                                    const size_t iCol, const size_t nThreads)
+/* The blocks of the rows of the train and test tables that are filled by one parallel loop */
+struct SplitBlocks
 {
-    if (nRows > THREADING_BORDER && nThreads > 1)
+    SplitBlocks(const size_t nTrain, const size_t nTest, const size_t size)
+        : nTrainRows(nTrain),
+          nTestRows(nTest),
+          blockSize(size),
+          nTrainBlocks(nTrain / size + !!(nTrain % size)),
+          nBlocks(nTrainBlocks + nTest / size + !!(nTest % size))
+    {}
+
+    bool isTrain(const size_t iBlock) const { return iBlock < nTrainBlocks; }
+    size_t startRow(const size_t iBlock) const { return (isTrain(iBlock) ? iBlock : iBlock - nTrainBlocks) * blockSize; }
+    size_t nRows(const size_t iBlock) const
     {
-        daal::SafeStatus s;
-        const size_t nBlocks = nRows / BLOCK_CONST + !!(nRows % BLOCK_CONST);
-
-        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
-            const size_t start = iBlock * BLOCK_CONST;
-            const size_t end   = daal::services::internal::min<cpu, size_t>(start + BLOCK_CONST, nRows);
-
-            s |= assignColumnValues<DataType, IdxType, cpu>(origDataPtr, dataTable, idxPtr, start, end - start, iCol);
-        });
-        return s.detach();
+        const size_t nTableRows = isTrain(iBlock) ? nTrainRows : nTestRows;
+        const size_t start      = startRow(iBlock);
+        return (start + blockSize < nTableRows) ? blockSize : nTableRows - start;
     }
-    else
-    {
-        return assignColumnValues<DataType, IdxType, cpu>(origDataPtr, dataTable, idxPtr, 0, nRows, iCol);
-    }
-}
+
+    const size_t nTrainRows;
+    const size_t nTestRows;
+    const size_t blockSize;
+    const size_t nTrainBlocks;
+    const size_t nBlocks;
+};
 
 template <typename DataType, typename IdxType, daal::CpuType cpu>
 services::Status splitColumn(const NumericTablePtr & inputTable, const NumericTablePtr & trainTable, const NumericTablePtr & testTable,
                              const IdxType * trainIdx, const IdxType * testIdx, const size_t nTrainRows, const size_t nTestRows, const size_t iCol,
                              const size_t nThreads)
 {
-    services::Status s;
     daal::internal::ReadColumns<DataType, cpu> origDataBlock(*inputTable, iCol, 0, nTrainRows + nTestRows);
     const DataType * origDataPtr = origDataBlock.get();
     DAAL_CHECK_MALLOC(origDataPtr);
 
-    s |= assignColumnSubset<DataType, IdxType, cpu>(origDataPtr, trainTable, trainIdx, nTrainRows, iCol, nThreads);
-    s |= assignColumnSubset<DataType, IdxType, cpu>(origDataPtr, testTable, testIdx, nTestRows, iCol, nThreads);
+    daal::SafeStatus s;
+    const SplitBlocks blocks(nTrainRows, nTestRows, BLOCK_CONST);
+    daal::conditional_threader_for(nTrainRows + nTestRows > THREADING_BORDER && nThreads > 1, blocks.nBlocks, [&](size_t iBlock) {
+        const bool isTrain  = blocks.isTrain(iBlock);
+        const size_t start  = blocks.startRow(iBlock);
+        const IdxType * idx = (isTrain ? trainIdx : testIdx) + start;
+
+        s |= assignColumnValues<DataType, IdxType, cpu>(origDataPtr, isTrain ? trainTable : testTable, idx, start, blocks.nRows(iBlock), iCol);
+    });
 
-    return s;
+    return s.detach();
 }
 
 template <typename DataType, typename IdxType, daal::CpuType cpu>
-services::Status assignRows(const DataType * origDataPtr, const NumericTablePtr & dataTable, const NumericTablePtr & idxTable, const size_t startRow,
+services::Status assignRows(const DataType * origDataPtr, const NumericTablePtr & dataTable, const IdxType * idxPtr, const size_t startRow,
                             const size_t nRows, const size_t nColumns)
 {
     daal::internal::WriteRows<DataType, cpu> dataBlock(*dataTable, startRow, nRows);
-    daal::internal::ReadColumns<IdxType, cpu> idxBlock(*idxTable, 0, startRow, nRows);
-    DataType * dataPtr     = dataBlock.get();
-    const IdxType * idxPtr = idxBlock.get();
+    DataType * dataPtr = dataBlock.get();
     DAAL_CHECK_MALLOC(dataPtr);
-    DAAL_CHECK_MALLOC(idxPtr);
 
-    for (size_t i = 0; i < nRows; ++i)
+    if (nColumns == 1)
     {
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
-        for (size_t j = 0; j < nColumns; ++j)
+        for (size_t i = 0; i < nRows; ++i)
         {
-            dataPtr[i * nColumns + j] = origDataPtr[idxPtr[i] * nColumns + j];
+            dataPtr[i] = origDataPtr[idxPtr[i]];
         }
+        return services::Status();
     }
 
-    return services::Status();
-}
-
-template <typename DataType, typename IdxType, daal::CpuType cpu>
-services::Status assignRowsSubset(const DataType * origDataPtr, const NumericTablePtr & dataTable, const NumericTablePtr & idxTable,
-                                  const size_t nRows, const size_t nColumns, const size_t nThreads, const size_t blockSize)
-{
-    if (nRows * nColumns > THREADING_BORDER && nThreads > 1)
+    for (size_t i = 0; i < nRows; ++i)
     {
-        daal::SafeStatus s;
-        const size_t nBlocks = nRows / blockSize + !!(nRows % blockSize);
-
-        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
-            const size_t start = iBlock * blockSize;
-            const size_t end   = daal::services::internal::min<cpu, size_t>(start + blockSize, nRows);
+        const DataType * origRow = origDataPtr + idxPtr[i] * nColumns;
+        DataType * row           = dataPtr + i * nColumns;
 
-            s |= assignRows<DataType, IdxType, cpu>(origDataPtr, dataTable, idxTable, start, end - start, nColumns);
-        });
-        return s.detach();
-    }
-    else
-    {
-        return assignRows<DataType, IdxType, cpu>(origDataPtr, dataTable, idxTable, 0, nRows, nColumns);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nColumns; ++j)
+        {
+            row[j] = origRow[j];
+        }
     }
+
+    return services::Status();
 }
 
 template <typename DataType, typename IdxType, daal::CpuType cpu>
 services::Status splitRows(const NumericTablePtr & inputTable, const NumericTablePtr & trainTable, const NumericTablePtr & testTable,
-                           const NumericTablePtr & trainIdxTable, const NumericTablePtr & testIdxTable, const size_t nTrainRows,
-                           const size_t nTestRows, const size_t nColumns, const size_t nThreads)
+                           const IdxType * trainIdx, const IdxType * testIdx, const size_t nTrainRows, const size_t nTestRows, const size_t nColumns,
+                           const size_t nThreads)
 {
-    services::Status s;
     const size_t blockSize = daal::services::internal::max<cpu, size_t>(BLOCK_CONST / nColumns, 1);
     daal::internal::ReadRows<DataType, cpu> origBlock(*inputTable, 0, nTrainRows + nTestRows);
     const DataType * origDataPtr = origBlock.get();
     DAAL_CHECK_MALLOC(origDataPtr);
 
-    s |= assignRowsSubset<DataType, IdxType, cpu>(origDataPtr, trainTable, trainIdxTable, nTrainRows, nColumns, nThreads, blockSize);
-    s |= assignRowsSubset<DataType, IdxType, cpu>(origDataPtr, testTable, testIdxTable, nTestRows, nColumns, nThreads, blockSize);
+    daal::SafeStatus s;
+    const SplitBlocks blocks(nTrainRows, nTestRows, blockSize);
+    daal::conditional_threader_for((nTrainRows + nTestRows) * nColumns > THREADING_BORDER && nThreads > 1, blocks.nBlocks, [&](size_t iBlock) {
+        const bool isTrain  = blocks.isTrain(iBlock);
+        const size_t start  = blocks.startRow(iBlock);
+        const IdxType * idx = (isTrain ? trainIdx : testIdx) + start;
+
+        s |= assignRows<DataType, IdxType, cpu>(origDataPtr, isTrain ? trainTable : testTable, idx, start, blocks.nRows(iBlock), nColumns);
+    });
 
-    return s;
+    return s.detach();
 }
 
 template <typename IdxType, daal::CpuType cpu>
@@ -300,16 +476,16 @@ services::Status trainTestSplitImpl(const NumericTablePtr & inputTable, const Nu
 
     NumericTableDictionaryPtr tableFeaturesDict = inputTable->getDictionarySharedPtr();
 
+    daal::internal::ReadColumns<IdxType, cpu> trainIdxBlock(*trainIdxTable, 0, 0, nTrainRows);
+    daal::internal::ReadColumns<IdxType, cpu> testIdxBlock(*testIdxTable, 0, 0, nTestRows);
+    const IdxType * trainIdx = trainIdxBlock.get();
+    const IdxType * testIdx  = testIdxBlock.get();
+    DAAL_CHECK_MALLOC(trainIdx);
+    DAAL_CHECK_MALLOC(testIdx);
+
     if (layout == NTLayout::soa)
     {
         daal::SafeStatus s;
-        daal::internal::ReadColumns<IdxType, cpu> trainIdxBlock(*trainIdxTable, 0, 0, nTrainRows);
-        daal::internal::ReadColumns<IdxType, cpu> testIdxBlock(*testIdxTable, 0, 0, nTestRows);
-        const IdxType * trainIdx = trainIdxBlock.get();
-        const IdxType * testIdx  = testIdxBlock.get();
-        DAAL_CHECK_MALLOC(trainIdx);
-        DAAL_CHECK_MALLOC(testIdx);
-
         daal::conditional_threader_for(
             nColumns > 1 && nColumns * (nTrainRows + nTestRows) > THREADING_BORDER && nThreads > 1, nColumns, [&](size_t iCol) {
                 switch ((*tableFeaturesDict)[iCol].getIndexType())
@@ -333,15 +509,15 @@ services::Status trainTestSplitImpl(const NumericTablePtr & inputTable, const Nu
         switch ((*tableFeaturesDict)[0].getIndexType())
         {
         case daal::data_management::features::IndexNumType::DAAL_FLOAT32:
-            return splitRows<float, IdxType, cpu>(inputTable, trainTable, testTable, trainIdxTable, testIdxTable, nTrainRows, nTestRows, nColumns,
+            return splitRows<float, IdxType, cpu>(inputTable, trainTable, testTable, trainIdx, testIdx, nTrainRows, nTestRows, nColumns,
                                                   nThreads);
             break;
         case daal::data_management::features::IndexNumType::DAAL_FLOAT64:
-            return splitRows<double, IdxType, cpu>(inputTable, trainTable, testTable, trainIdxTable, testIdxTable, nTrainRows, nTestRows, nColumns,
+            return splitRows<double, IdxType, cpu>(inputTable, trainTable, testTable, trainIdx, testIdx, nTrainRows, nTestRows, nColumns,
                                                    nThreads);
             break;
         default:
-            return splitRows<int, IdxType, cpu>(inputTable, trainTable, testTable, trainIdxTable, testIdxTable, nTrainRows, nTestRows, nColumns,
+            return splitRows<int, IdxType, cpu>(inputTable, trainTable, testTable, trainIdx, testIdx, nTrainRows, nTestRows, nColumns,
                                                 nThreads);
         }
     }
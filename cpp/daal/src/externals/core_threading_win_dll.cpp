@@ -234,11 +234,17 @@ FARPROC load_daal_thr_func(char * ordinal)
 
 typedef void * (*_threaded_malloc_t)(const size_t, const size_t);
 typedef void (*_threaded_free_t)(void *);
+typedef void (*_daal_scratch_trim_t)(void);
 
 typedef void (*_daal_threader_for_t)(int, int, const void *, daal::functype);
 typedef void (*_daal_threader_for_blocked_t)(int, int, const void *, daal::functype2);
+typedef void (*_daal_threader_for_cost_t)(int, int, size_t, const void *, daal::functype);
 typedef int (*_daal_threader_get_max_threads_t)(void);
 typedef void (*_daal_threader_for_break_t)(int, int, const void *, daal::functype_break);
+typedef void (*_daal_execute_in_arena_t)(int, int, const void *, daal::functype_arena);
+typedef int (*_daal_threader_get_numa_node_count_t)(void);
+typedef void (*_daal_threader_for_numa_t)(int, const void *, daal::functype_numa);
+typedef void (*_daal_threader_for_numa_nodes_t)(const void *, daal::functype);
 
 typedef void * (*_daal_get_tls_ptr_t)(void *, daal::tls_functype);
 typedef void (*_daal_del_tls_ptr_t)(void *);
@@ -281,12 +287,20 @@ typedef void * (*_getThreadPinner_t)(bool create_pinner, void (*read_topo)(int &
 
 static _threaded_malloc_t _threaded_malloc_ptr = NULL;
 static _threaded_free_t _threaded_free_ptr     = NULL;
+static _threaded_malloc_t _daal_scratch_malloc_ptr = NULL;
+static _threaded_free_t _daal_scratch_free_ptr     = NULL;
+static _daal_scratch_trim_t _daal_scratch_trim_ptr = NULL;
 
 static _daal_threader_for_t _daal_threader_for_ptr                         = NULL;
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr         = NULL;
+static _daal_threader_for_cost_t _daal_threader_for_cost_ptr               = NULL;
 static _daal_threader_for_t _daal_threader_for_optional_ptr                = NULL;
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr = NULL;
 static _daal_threader_for_break_t _daal_threader_for_break_ptr             = NULL;
+static _daal_execute_in_arena_t _daal_execute_in_arena_ptr                 = NULL;
+static _daal_threader_get_numa_node_count_t _daal_threader_get_numa_node_count_ptr = NULL;
+static _daal_threader_for_numa_t _daal_threader_for_numa_ptr               = NULL;
+static _daal_threader_for_numa_nodes_t _daal_threader_for_numa_nodes_ptr   = NULL;
 
 static _daal_get_tls_ptr_t _daal_get_tls_ptr_ptr                 = NULL;
 static _daal_del_tls_ptr_t _daal_del_tls_ptr_ptr                 = NULL;
@@ -347,6 +361,36 @@ DAAL_EXPORT void _threaded_scalable_free(void * ptr)
     _threaded_free_ptr(ptr);
 }
 
+DAAL_EXPORT void * _daal_scratch_malloc(const size_t size, const size_t alignment)
+{
+    load_daal_thr_dll();
+    if (_daal_scratch_malloc_ptr == NULL)
+    {
+        _daal_scratch_malloc_ptr = (_threaded_malloc_t)load_daal_thr_func("_daal_scratch_malloc");
+    }
+    return _daal_scratch_malloc_ptr(size, alignment);
+}
+
+DAAL_EXPORT void _daal_scratch_free(void * ptr)
+{
+    load_daal_thr_dll();
+    if (_daal_scratch_free_ptr == NULL)
+    {
+        _daal_scratch_free_ptr = (_threaded_free_t)load_daal_thr_func("_daal_scratch_free");
+    }
+    _daal_scratch_free_ptr(ptr);
+}
+
+DAAL_EXPORT void _daal_scratch_trim()
+{
+    load_daal_thr_dll();
+    if (_daal_scratch_trim_ptr == NULL)
+    {
+        _daal_scratch_trim_ptr = (_daal_scratch_trim_t)load_daal_thr_func("_daal_scratch_trim");
+    }
+    _daal_scratch_trim_ptr();
+}
+
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func)
 {
     load_daal_thr_dll();
@@ -367,6 +411,16 @@ DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const vo
     _daal_threader_for_blocked_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_for_cost(int n, int threads_request, size_t iterationCost, const void * a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_cost_ptr == NULL)
+    {
+        _daal_threader_for_cost_ptr = (_daal_threader_for_cost_t)load_daal_thr_func("_daal_threader_for_cost");
+    }
+    _daal_threader_for_cost_ptr(n, threads_request, iterationCost, a, func);
+}
+
 DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func)
 {
     load_daal_thr_dll();
@@ -387,6 +441,46 @@ DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void
     _daal_threader_for_break_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_execute_in_arena(int max_concurrency, int numa_node, const void * a, daal::functype_arena func)
+{
+    load_daal_thr_dll();
+    if (_daal_execute_in_arena_ptr == NULL)
+    {
+        _daal_execute_in_arena_ptr = (_daal_execute_in_arena_t)load_daal_thr_func("_daal_execute_in_arena");
+    }
+    _daal_execute_in_arena_ptr(max_concurrency, numa_node, a, func);
+}
+
+DAAL_EXPORT int _daal_threader_get_numa_node_count()
+{
+    load_daal_thr_dll();
+    if (_daal_threader_get_numa_node_count_ptr == NULL)
+    {
+        _daal_threader_get_numa_node_count_ptr = (_daal_threader_get_numa_node_count_t)load_daal_thr_func("_daal_threader_get_numa_node_count");
+    }
+    return _daal_threader_get_numa_node_count_ptr();
+}
+
+DAAL_EXPORT void _daal_threader_for_numa(int n, const void * a, daal::functype_numa func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_numa_ptr == NULL)
+    {
+        _daal_threader_for_numa_ptr = (_daal_threader_for_numa_t)load_daal_thr_func("_daal_threader_for_numa");
+    }
+    _daal_threader_for_numa_ptr(n, a, func);
+}
+
+DAAL_EXPORT void _daal_threader_for_numa_nodes(const void * a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_numa_nodes_ptr == NULL)
+    {
+        _daal_threader_for_numa_nodes_ptr = (_daal_threader_for_numa_nodes_t)load_daal_thr_func("_daal_threader_for_numa_nodes");
+    }
+    _daal_threader_for_numa_nodes_ptr(a, func);
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
     load_daal_thr_dll();
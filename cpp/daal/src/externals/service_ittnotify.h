@@ -24,6 +24,16 @@
 #ifndef __SERVICE_ITTNOTIFY_H__
 #define __SERVICE_ITTNOTIFY_H__
 
+#include "src/externals/service_profiler.h"
+
+#define DAAL_ITTNOTIFY_CONCAT2(x, y) x##y
+#define DAAL_ITTNOTIFY_CONCAT(x, y)  DAAL_ITTNOTIFY_CONCAT2(x, y)
+
+#define DAAL_ITTNOTIFY_UNIQUE_ID __LINE__
+
+#define DAAL_PROFILER_SCOPED_TASK(name) \
+    daal::internal::ProfilerTask DAAL_ITTNOTIFY_CONCAT(__profiler_taks__, DAAL_ITTNOTIFY_UNIQUE_ID) = daal::internal::Profiler::startTask(#name);
+
 #ifdef __DAAL_ITTNOTIFY_ENABLE__
     #include <ittnotify.h>
 
@@ -93,21 +103,15 @@ private:
     // There must be only one domain on the translation unit regarding to this macro
     #define DAAL_ITTNOTIFY_DOMAIN(name) static daal::internal::ittnotify::Domain __ittnotify_domain(#name)
 
-    #define DAAL_ITTNOTIFY_SCOPED_TASK(name)                                            \
-        static daal::internal::ittnotify::StringHandle __ittnotify_stringhandle(#name); \
-        daal::internal::ittnotify::ScopedTask __ittnotify_task(__ittnotify_domain, __ittnotify_stringhandle)
+    // The tasks are recorded by the built-in profiler too
+    #define DAAL_ITTNOTIFY_SCOPED_TASK(name)                                                                      \
+        static daal::internal::ittnotify::StringHandle __ittnotify_stringhandle(#name);                             \
+        daal::internal::ittnotify::ScopedTask __ittnotify_task(__ittnotify_domain, __ittnotify_stringhandle); \
+        DAAL_PROFILER_SCOPED_TASK(name)
 
 #else
-    #include "src/externals/service_profiler.h"
-
-    #define DAAL_ITTNOTIFY_CONCAT2(x, y) x##y
-    #define DAAL_ITTNOTIFY_CONCAT(x, y)  DAAL_ITTNOTIFY_CONCAT2(x, y)
-
-    #define DAAL_ITTNOTIFY_UNIQUE_ID __LINE__
-
     #define DAAL_ITTNOTIFY_DOMAIN(name)
-    #define DAAL_ITTNOTIFY_SCOPED_TASK(name) \
-        daal::internal::ProfilerTask DAAL_ITTNOTIFY_CONCAT(__profiler_taks__, DAAL_ITTNOTIFY_UNIQUE_ID) = daal::internal::Profiler::startTask(#name);
+    #define DAAL_ITTNOTIFY_SCOPED_TASK(name) DAAL_PROFILER_SCOPED_TASK(name)
 
 #endif // __DAAL_ITTNOTIFY_ENABLE__
 #endif // __SERVICE_ITTNOTIFY_H__
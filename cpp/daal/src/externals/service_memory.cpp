@@ -24,9 +24,301 @@
 #include "src/externals/service_memory.h"
 #include "src/externals/service_service.h"
 
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+namespace
+{
+/* Sizes of the tracked blocks are kept in the sharded hash map, so nothing is
+ * looked up when the tracking has never been enabled */
+class MemoryTracker
+{
+public:
+    // The tracker is never destroyed: the blocks are freed by the static
+    // objects too
+    static MemoryTracker & instance()
+    {
+        static MemoryTracker * tracker = new MemoryTracker();
+        return *tracker;
+    }
+
+    void enable(bool enable) { _enabled.store(enable, std::memory_order_relaxed); }
+
+    void add(const void * ptr, size_t size)
+    {
+        if (!ptr || !_enabled.load(std::memory_order_relaxed)) return;
+        {
+            Shard & shard = getShard(ptr);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.sizes[ptr] = size;
+        }
+        _trackedCount.fetch_add(1, std::memory_order_relaxed);
+        _allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        const size_t current = _currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        size_t peak          = _peakBytes.load(std::memory_order_relaxed);
+        while (current > peak && !_peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+        {}
+    }
+
+    void remove(const void * ptr)
+    {
+        if (!ptr || _trackedCount.load(std::memory_order_relaxed) == 0) return;
+        size_t size = 0;
+        {
+            Shard & shard = getShard(ptr);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            std::unordered_map<const void *, size_t>::iterator it = shard.sizes.find(ptr);
+            if (it == shard.sizes.end()) return;
+            size = it->second;
+            shard.sizes.erase(it);
+        }
+        _trackedCount.fetch_sub(1, std::memory_order_relaxed);
+        _currentBytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    daal::services::MemoryUsage getUsage() const
+    {
+        daal::services::MemoryUsage usage;
+        usage.currentBytes    = _currentBytes.load(std::memory_order_relaxed);
+        usage.peakBytes       = _peakBytes.load(std::memory_order_relaxed);
+        usage.allocationCount = _allocationCount.load(std::memory_order_relaxed);
+        return usage;
+    }
+
+    void resetPeak()
+    {
+        _peakBytes.store(_currentBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        _allocationCount.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    MemoryTracker() : _enabled(false), _trackedCount(0), _currentBytes(0), _peakBytes(0), _allocationCount(0) {}
+
+    static const size_t shardCount = 64;
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<const void *, size_t> sizes;
+    };
+
+    Shard & getShard(const void * ptr)
+    {
+        // The low bits of the aligned pointers are zeros
+        const unsigned long long hash = (unsigned long long)ptr * 0x9E3779B97F4A7C15ULL;
+        return _shards[hash >> 58];
+    }
+
+    std::atomic<bool> _enabled;
+    std::atomic<size_t> _trackedCount;
+    std::atomic<size_t> _currentBytes;
+    std::atomic<size_t> _peakBytes;
+    std::atomic<size_t> _allocationCount;
+    Shard _shards[shardCount];
+};
+
+/* The large blocks are mapped directly and backed by the huge pages. The
+ * mappings are aligned to 2 MB, so the other blocks are told apart by their
+ * address without looking into the map. */
+class HugePageAllocator
+{
+public:
+    static HugePageAllocator & instance()
+    {
+        static HugePageAllocator * allocator = new HugePageAllocator();
+        return *allocator;
+    }
+
+    void configure(daal::services::HugePageMode mode, size_t threshold)
+    {
+        _threshold.store(threshold, std::memory_order_relaxed);
+        _mode.store(mode, std::memory_order_relaxed);
+    }
+
+    void * allocate(size_t size, size_t alignment)
+    {
+        const int mode = _mode.load(std::memory_order_relaxed);
+        if (mode == daal::services::noHugePages || size < _threshold.load(std::memory_order_relaxed) || alignment > hugePageSize) return NULL;
+
+        bool isHugetlb = true;
+        size_t length  = 0;
+        void * ptr     = NULL;
+        if (mode == daal::services::explicitHugePages1G) ptr = mapHugetlb(size, size_t(1) << 30, true, length);
+        if (!ptr && mode >= daal::services::explicitHugePages2M) ptr = mapHugetlb(size, hugePageSize, false, length);
+        if (!ptr)
+        {
+            isHugetlb = false;
+            ptr       = mapTransparent(size, length);
+        }
+        if (!ptr)
+        {
+            _fallbackCount.fetch_add(1, std::memory_order_relaxed);
+            return NULL;
+        }
+        if (mode >= daal::services::explicitHugePages2M && !isHugetlb) _fallbackCount.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _mappings[ptr] = Mapping { length, isHugetlb };
+        }
+        _mappingCount.fetch_add(1, std::memory_order_relaxed);
+        _currentBytes.fetch_add(length, std::memory_order_relaxed);
+        _totalBytes.fetch_add(length, std::memory_order_relaxed);
+        if (isHugetlb) _hugetlbBytes.fetch_add(length, std::memory_order_relaxed);
+        return ptr;
+    }
+
+    bool deallocate(void * ptr)
+    {
+        if (!ptr || ((size_t)ptr & (hugePageSize - 1)) || _mappingCount.load(std::memory_order_relaxed) == 0) return false;
+        Mapping mapping;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            std::map<void *, Mapping>::iterator it = _mappings.find(ptr);
+            if (it == _mappings.end()) return false;
+            mapping = it->second;
+            _mappings.erase(it);
+        }
+        _mappingCount.fetch_sub(1, std::memory_order_relaxed);
+        _currentBytes.fetch_sub(mapping.length, std::memory_order_relaxed);
+#if defined(__linux__)
+        munmap(ptr, mapping.length);
+#endif
+        return true;
+    }
+
+    daal::services::HugePageUsage getUsage() const
+    {
+        daal::services::HugePageUsage usage;
+        usage.currentBytes  = _currentBytes.load(std::memory_order_relaxed);
+        usage.totalBytes    = _totalBytes.load(std::memory_order_relaxed);
+        usage.hugetlbBytes  = _hugetlbBytes.load(std::memory_order_relaxed);
+        usage.fallbackCount = _fallbackCount.load(std::memory_order_relaxed);
+        return usage;
+    }
+
+private:
+    static const size_t hugePageSize = size_t(2) << 20;
+
+    struct Mapping
+    {
+        size_t length;
+        bool isHugetlb;
+    };
+
+    HugePageAllocator()
+        : _mode(daal::services::noHugePages),
+          _threshold(size_t(64) << 20),
+          _mappingCount(0),
+          _currentBytes(0),
+          _totalBytes(0),
+          _hugetlbBytes(0),
+          _fallbackCount(0)
+    {}
+
+    static size_t roundUp(size_t size, size_t pageSize) { return (size + pageSize - 1) / pageSize * pageSize; }
+
+    /* Maps the explicit huge pages reserved in hugetlbfs */
+    static void * mapHugetlb(size_t size, size_t pageSize, bool is1G, size_t & length)
+    {
+#if defined(__linux__) && defined(MAP_HUGETLB)
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+    #if defined(MAP_HUGE_SHIFT)
+        flags |= (is1G ? 30 : 21) << MAP_HUGE_SHIFT;
+    #else
+        if (is1G) return NULL;
+    #endif
+        length    = roundUp(size, pageSize);
+        void * ptr = mmap(NULL, length, PROT_READ | PROT_WRITE, flags, -1, 0);
+        return ptr == MAP_FAILED ? NULL : ptr;
+#else
+        return NULL;
+#endif
+    }
+
+    /* Maps the regular pages aligned to the huge page and asks the kernel to
+     * back them by the transparent huge pages */
+    static void * mapTransparent(size_t size, size_t & length)
+    {
+#if defined(__linux__)
+        length                = roundUp(size, hugePageSize);
+        const size_t extended = length + hugePageSize;
+        char * base           = static_cast<char *>(mmap(NULL, extended, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if ((void *)base == MAP_FAILED) return NULL;
+
+        char * ptr        = reinterpret_cast<char *>(roundUp((size_t)base, hugePageSize));
+        const size_t head = ptr - base;
+        if (head) munmap(base, head);
+        if (extended - head > length) munmap(ptr + length, extended - head - length);
+    #if defined(MADV_HUGEPAGE)
+        madvise(ptr, length, MADV_HUGEPAGE);
+    #endif
+        return ptr;
+#else
+        return NULL;
+#endif
+    }
+
+    std::atomic<int> _mode;
+    std::atomic<size_t> _threshold;
+    std::atomic<size_t> _mappingCount;
+    std::atomic<size_t> _currentBytes;
+    std::atomic<size_t> _totalBytes;
+    std::atomic<size_t> _hugetlbBytes;
+    std::atomic<size_t> _fallbackCount;
+    std::mutex _mutex;
+    std::map<void *, Mapping> _mappings;
+};
+} // namespace
+
+void daal::services::internal::trackAllocation(const void * ptr, size_t size)
+{
+    MemoryTracker::instance().add(ptr, size);
+}
+
+void daal::services::internal::trackDeallocation(const void * ptr)
+{
+    MemoryTracker::instance().remove(ptr);
+}
+
+void daal::services::daal_enable_memory_tracking(bool enable)
+{
+    MemoryTracker::instance().enable(enable);
+}
+
+daal::services::MemoryUsage daal::services::daal_get_memory_usage()
+{
+    return MemoryTracker::instance().getUsage();
+}
+
+void daal::services::daal_reset_memory_peak()
+{
+    MemoryTracker::instance().resetPeak();
+}
+
+void daal::services::daal_set_huge_pages(HugePageMode mode, size_t threshold)
+{
+    HugePageAllocator::instance().configure(mode, threshold);
+}
+
+daal::services::HugePageUsage daal::services::daal_get_huge_page_usage()
+{
+    return HugePageAllocator::instance().getUsage();
+}
+
 void * daal::services::daal_malloc(size_t size, size_t alignment)
 {
-    return daal::internal::Service<>::serv_malloc(size, alignment);
+    void * ptr = HugePageAllocator::instance().allocate(size, alignment);
+    if (!ptr) ptr = daal::internal::Service<>::serv_malloc(size, alignment);
+    daal::services::internal::trackAllocation(ptr, size);
+    return ptr;
 }
 
 void * daal::services::daal_calloc(size_t size, size_t alignment)
@@ -49,7 +341,8 @@ void * daal::services::daal_calloc(size_t size, size_t alignment)
 
 void daal::services::daal_free(void * ptr)
 {
-    daal::internal::Service<>::serv_free(ptr);
+    daal::services::internal::trackDeallocation(ptr);
+    if (!HugePageAllocator::instance().deallocate(ptr)) daal::internal::Service<>::serv_free(ptr);
 }
 
 void daal::services::daal_memmove_s(void * dest, size_t destSize, const void * src, size_t smax)
@@ -64,6 +357,7 @@ namespace services
 void daal_free_buffers()
 {
     daal::internal::Service<>::serv_free_buffers();
+    _daal_scratch_trim();
 }
 } // namespace services
 } // namespace daal
@@ -27,6 +27,7 @@
 #include "services/daal_defines.h"
 #include "services/daal_memory.h"
 #include "src/services/service_defines.h"
+#include "src/services/service_arena.h"
 #include "src/threading/threading.h"
 
 namespace daal
@@ -35,6 +36,11 @@ namespace services
 {
 namespace internal
 {
+/* Accounts the memory block if the memory tracking is enabled */
+DAAL_EXPORT void trackAllocation(const void * ptr, size_t size);
+/* Removes the block from the accounting if it was tracked */
+DAAL_EXPORT void trackDeallocation(const void * ptr);
+
 template <typename T, CpuType cpu>
 T * service_calloc(size_t size, size_t alignment = 64)
 {
@@ -76,6 +82,7 @@ T * service_scalable_calloc(size_t size, size_t alignment = 64)
     {
         return NULL;
     }
+    trackAllocation(ptr, size * sizeof(T));
 
     char * const cptr        = (char *)ptr;
     const size_t sizeInBytes = size * sizeof(T);
@@ -91,15 +98,90 @@ T * service_scalable_calloc(size_t size, size_t alignment = 64)
 template <typename T, CpuType cpu>
 T * service_scalable_malloc(size_t size, size_t alignment = 64)
 {
-    return (T *)threaded_scalable_malloc(size * sizeof(T), alignment);
+    T * ptr = (T *)threaded_scalable_malloc(size * sizeof(T), alignment);
+    trackAllocation(ptr, size * sizeof(T));
+    return ptr;
 }
 
 template <typename T, CpuType cpu>
 void service_scalable_free(T * ptr)
 {
+    trackDeallocation(ptr);
     threaded_scalable_free(ptr);
 }
 
+/* The scratch buffers are cached by the calling thread between the compute calls */
+template <typename T, CpuType cpu>
+T * service_scratch_malloc(size_t size, size_t alignment = 64)
+{
+    T * ptr = (T *)threaded_scratch_malloc(size * sizeof(T), alignment);
+    trackAllocation(ptr, size * sizeof(T));
+    return ptr;
+}
+
+template <typename T, CpuType cpu>
+T * service_scratch_calloc(size_t size, size_t alignment = 64)
+{
+    T * ptr = (T *)threaded_scratch_malloc(size * sizeof(T), alignment);
+
+    if (ptr == NULL)
+    {
+        return NULL;
+    }
+    trackAllocation(ptr, size * sizeof(T));
+
+    char * const cptr        = (char *)ptr;
+    const size_t sizeInBytes = size * sizeof(T);
+
+    for (size_t i = 0; i < sizeInBytes; i++)
+    {
+        cptr[i] = '\0';
+    }
+
+    return ptr;
+}
+
+template <typename T, CpuType cpu>
+void service_scratch_free(T * ptr)
+{
+    trackDeallocation(ptr);
+    threaded_scratch_free(ptr);
+}
+
+/* The arena buffers are released at once when the current compute call returns */
+template <typename T, CpuType cpu>
+T * service_arena_malloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT)
+{
+    return (T *)services::internal::arena_malloc(size * sizeof(T), alignment);
+}
+
+template <typename T, CpuType cpu>
+T * service_arena_calloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT)
+{
+    T * ptr = (T *)services::internal::arena_malloc(size * sizeof(T), alignment);
+
+    if (ptr == NULL)
+    {
+        return NULL;
+    }
+
+    char * const cptr        = (char *)ptr;
+    const size_t sizeInBytes = size * sizeof(T);
+
+    for (size_t i = 0; i < sizeInBytes; i++)
+    {
+        cptr[i] = '\0';
+    }
+
+    return ptr;
+}
+
+template <typename T, CpuType cpu>
+void service_arena_free(T * ptr)
+{
+    services::internal::arena_free(ptr);
+}
+
 template <typename T, CpuType cpu>
 T * service_memset(T * const ptr, const T value, const size_t num)
 {
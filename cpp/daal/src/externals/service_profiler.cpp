@@ -16,11 +16,347 @@
 *******************************************************************************/
 
 #include "src/externals/service_profiler.h"
+#include "services/internal/sycl/device_profiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
 
 namespace daal
 {
 namespace internal
 {
+namespace
+{
+// The timeline keeps the first events only, the statistics are always complete
+const size_t maxEventsPerThread = size_t(1) << 20;
+
+long long now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct Event
+{
+    const char * name;
+    long long start;
+    long long duration;
+    int depth;
+};
+
+struct Statistics
+{
+    Statistics() : count(0), totalTime(0), maxTime(0) {}
+
+    long long count;
+    long long totalTime;
+    long long maxTime;
+};
+
+struct DeviceEvent
+{
+    std::string name;
+    services::internal::sycl::DeviceOperationKind kind;
+    long long start; // Host clock
+    long long duration;
+    long long queueTime;
+    size_t dimensions;
+    size_t globalRange[3];
+    size_t localRange[3];
+    size_t bytes;
+};
+
+const char * getKindName(services::internal::sycl::DeviceOperationKind kind)
+{
+    using namespace services::internal::sycl::interface1;
+    switch (kind)
+    {
+    case deviceKernel: return "kernel";
+    case deviceTransfer: return "transfer";
+    case deviceFill: return "fill";
+    case deviceCompilation: return "compilation";
+    }
+    return "unknown";
+}
+
+/* The device operations are recorded from the host thread which waits for
+ * them, the shared timeline is enough for them */
+class DeviceTimeline
+{
+public:
+    void add(const services::internal::sycl::DeviceOperationRecord & record)
+    {
+        DeviceEvent event;
+        event.name       = record.name ? record.name : "";
+        event.kind       = record.kind;
+        event.duration   = record.endTime - record.startTime;
+        event.queueTime  = record.startTime - record.queuedTime;
+        event.start      = record.hostSubmitTime + event.queueTime;
+        event.dimensions = record.dimensions;
+        event.bytes      = record.bytes;
+        for (size_t i = 0; i < 3; i++)
+        {
+            event.globalRange[i] = record.globalRange[i];
+            event.localRange[i]  = record.localRange[i];
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        services::internal::sycl::DeviceOperationStatistics & stats = _statistics[event.name];
+        stats.kind = event.kind;
+        stats.count++;
+        stats.bytes += event.bytes;
+        stats.totalTime += event.duration;
+        stats.totalQueueTime += event.queueTime;
+        if (event.duration > stats.maxTime) stats.maxTime = event.duration;
+        if (_events.size() < maxEventsPerThread) _events.push_back(event);
+    }
+
+    template <typename Func>
+    void read(Func func)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        func(_events, _statistics);
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _events.clear();
+        _statistics.clear();
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<DeviceEvent> _events;
+    std::map<std::string, services::internal::sycl::DeviceOperationStatistics> _statistics;
+};
+
+class ThreadTimeline
+{
+public:
+    explicit ThreadTimeline(size_t id) : _id(id), _depth(0) {}
+
+    size_t getId() const { return _id; }
+
+    int begin() { return _depth++; }
+
+    void end(const char * name, long long start, long long duration)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        --_depth;
+        if (_events.size() < maxEventsPerThread)
+        {
+            Event event = { name, start, duration, _depth };
+            _events.push_back(event);
+        }
+        Statistics & stats = _statistics[name];
+        stats.count++;
+        stats.totalTime += duration;
+        if (duration > stats.maxTime) stats.maxTime = duration;
+    }
+
+    template <typename Func>
+    void read(Func func)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        func(_events, _statistics);
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _events.clear();
+        _statistics.clear();
+    }
+
+private:
+    size_t _id;
+    int _depth; // Changed by the owning thread only
+    std::mutex _mutex;
+    std::vector<Event> _events;
+    std::map<const char *, Statistics> _statistics;
+};
+
+class ProfilerState
+{
+public:
+    // The state is never destroyed: the worker threads may record the tasks
+    // after the static objects are destroyed
+    static ProfilerState & instance()
+    {
+        static ProfilerState * state = new ProfilerState();
+        return *state;
+    }
+
+    bool isEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    void enable(bool enable) { _enabled.store(enable, std::memory_order_relaxed); }
+
+    bool isDeviceEnabled() const { return isEnabled() || _deviceEnabled.load(std::memory_order_relaxed); }
+
+    void enableDevice(bool enable) { _deviceEnabled.store(enable, std::memory_order_relaxed); }
+
+    DeviceTimeline & getDeviceTimeline() { return _deviceTimeline; }
+
+    ThreadTimeline & getLocalTimeline()
+    {
+        static thread_local ThreadTimeline * timeline = NULL;
+        if (!timeline)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            timeline = new ThreadTimeline(_timelines.size());
+            _timelines.push_back(timeline);
+        }
+        return *timeline;
+    }
+
+    long long getOrigin() const { return _origin; }
+
+    bool dump(const char * fileName);
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 0; i < _timelines.size(); i++)
+        {
+            _timelines[i]->clear();
+        }
+        _deviceTimeline.clear();
+    }
+
+private:
+    ProfilerState() : _enabled(false), _deviceEnabled(false), _origin(now())
+    {
+        const char * output = std::getenv("DAAL_PROFILER_OUTPUT");
+        if (output && output[0])
+        {
+            _output = output;
+            _enabled.store(true, std::memory_order_relaxed);
+            std::atexit(dumpAtExit);
+        }
+    }
+
+    static void dumpAtExit()
+    {
+        ProfilerState & state = instance();
+        state.dump(state._output.c_str());
+    }
+
+    std::atomic<bool> _enabled;
+    std::atomic<bool> _deviceEnabled;
+    long long _origin;
+    std::string _output;
+    std::mutex _mutex;
+    std::vector<ThreadTimeline *> _timelines;
+    DeviceTimeline _deviceTimeline;
+};
+
+void writeName(FILE * file, const char * name)
+{
+    std::fputc('"', file);
+    for (const char * c = name; *c; c++)
+    {
+        if (*c == '"' || *c == '\\') std::fputc('\\', file);
+        std::fputc(*c, file);
+    }
+    std::fputc('"', file);
+}
+
+bool ProfilerState::dump(const char * fileName)
+{
+    FILE * file = std::fopen(fileName, "w");
+    if (!file) return false;
+
+    std::map<std::string, Statistics> summary;
+    bool isFirst = true;
+    std::fprintf(file, "{\"traceEvents\":[");
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 0; i < _timelines.size(); i++)
+    {
+        ThreadTimeline & timeline = *_timelines[i];
+        timeline.read([&](const std::vector<Event> & events, const std::map<const char *, Statistics> & statistics) {
+            for (size_t j = 0; j < events.size(); j++)
+            {
+                const Event & event = events[j];
+                std::fprintf(file, "%s\n{\"name\":", isFirst ? "" : ",");
+                writeName(file, event.name);
+                std::fprintf(file, ",\"ph\":\"X\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%d}}", timeline.getId(),
+                             (event.start - _origin) * 1e-3, event.duration * 1e-3, event.depth);
+                isFirst = false;
+            }
+            for (std::map<const char *, Statistics>::const_iterator it = statistics.begin(); it != statistics.end(); ++it)
+            {
+                Statistics & stats = summary[it->first];
+                stats.count += it->second.count;
+                stats.totalTime += it->second.totalTime;
+                if (it->second.maxTime > stats.maxTime) stats.maxTime = it->second.maxTime;
+            }
+        });
+    }
+
+    // The device operations are shown as the separate process with a track per kind
+    std::vector<services::internal::sycl::DeviceOperationStatistics> deviceSummary;
+    _deviceTimeline.read([&](const std::vector<DeviceEvent> & events,
+                             const std::map<std::string, services::internal::sycl::DeviceOperationStatistics> & statistics) {
+        if (!events.empty())
+        {
+            std::fprintf(file, "%s\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"device\"}}", isFirst ? "" : ",");
+            isFirst = false;
+        }
+        for (size_t j = 0; j < events.size(); j++)
+        {
+            const DeviceEvent & event = events[j];
+            std::fprintf(file, ",\n{\"name\":");
+            writeName(file, event.name.c_str());
+            std::fprintf(file, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"queue_us\":%.3f,\"bytes\":%zu",
+                         getKindName(event.kind), static_cast<int>(event.kind), (event.start - _origin) * 1e-3, event.duration * 1e-3,
+                         event.queueTime * 1e-3, event.bytes);
+            if (event.dimensions > 0)
+            {
+                std::fprintf(file, ",\"global\":[%zu,%zu,%zu],\"local\":[%zu,%zu,%zu]", event.globalRange[0], event.globalRange[1],
+                             event.globalRange[2], event.localRange[0], event.localRange[1], event.localRange[2]);
+            }
+            std::fprintf(file, "}}");
+        }
+        for (std::map<std::string, services::internal::sycl::DeviceOperationStatistics>::const_iterator it = statistics.begin();
+             it != statistics.end(); ++it)
+        {
+            deviceSummary.push_back(it->second);
+            deviceSummary.back().name = it->first.c_str();
+        }
+    });
+
+    std::fprintf(file, "\n],\"displayTimeUnit\":\"ms\",\"summary\":[");
+    isFirst = true;
+    for (std::map<std::string, Statistics>::const_iterator it = summary.begin(); it != summary.end(); ++it)
+    {
+        std::fprintf(file, "%s\n{\"name\":", isFirst ? "" : ",");
+        writeName(file, it->first.c_str());
+        std::fprintf(file, ",\"count\":%lld,\"total_us\":%.3f,\"max_us\":%.3f}", it->second.count, it->second.totalTime * 1e-3,
+                     it->second.maxTime * 1e-3);
+        isFirst = false;
+    }
+    std::fprintf(file, "\n],\"device_summary\":[");
+    for (size_t i = 0; i < deviceSummary.size(); i++)
+    {
+        const services::internal::sycl::DeviceOperationStatistics & stats = deviceSummary[i];
+        std::fprintf(file, "%s\n{\"name\":", i == 0 ? "" : ",");
+        writeName(file, stats.name.c_str());
+        std::fprintf(file, ",\"kind\":\"%s\",\"count\":%zu,\"bytes\":%zu,\"total_us\":%.3f,\"max_us\":%.3f,\"queue_us\":%.3f}",
+                     getKindName(stats.kind), stats.count, stats.bytes, stats.totalTime * 1e-3, stats.maxTime * 1e-3, stats.totalQueueTime * 1e-3);
+    }
+    std::fprintf(file, "\n]}\n");
+    return std::fclose(file) == 0;
+}
+} // namespace
+
 ProfilerTask Profiler::startTask(const char * taskName)
 {
     return ProfilerTask(taskName);
@@ -28,12 +364,104 @@ ProfilerTask Profiler::startTask(const char * taskName)
 
 void Profiler::endTask(const char * taskName) {}
 
-ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
+bool Profiler::isEnabled()
+{
+    return ProfilerState::instance().isEnabled();
+}
+
+void Profiler::enable(bool enable)
+{
+    ProfilerState::instance().enable(enable);
+}
+
+bool Profiler::dump(const char * fileName)
+{
+    return ProfilerState::instance().dump(fileName);
+}
+
+void Profiler::reset()
+{
+    ProfilerState::instance().reset();
+}
+
+ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName), _start(-1), _isOwner(true)
+{
+    ProfilerState & state = ProfilerState::instance();
+    if (state.isEnabled())
+    {
+        state.getLocalTimeline().begin();
+        _start = now();
+    }
+}
+
+ProfilerTask::ProfilerTask(const ProfilerTask & other) : _taskName(other._taskName), _start(other._start), _isOwner(other._isOwner)
+{
+    other._isOwner = false;
+}
 
 ProfilerTask::~ProfilerTask()
 {
+    if (!_isOwner) return;
+    if (_start >= 0)
+    {
+        const long long end = now();
+        ProfilerState::instance().getLocalTimeline().end(_taskName, _start, end - _start);
+    }
     Profiler::endTask(_taskName);
 }
 
 } // namespace internal
+
+namespace services
+{
+namespace internal
+{
+namespace sycl
+{
+namespace interface1
+{
+bool DeviceProfiler::isEnabled()
+{
+    return daal::internal::ProfilerState::instance().isDeviceEnabled();
+}
+
+void DeviceProfiler::enable(bool enable)
+{
+    daal::internal::ProfilerState::instance().enableDevice(enable);
+}
+
+long long DeviceProfiler::now()
+{
+    return daal::internal::now();
+}
+
+void DeviceProfiler::record(const DeviceOperationRecord & record)
+{
+    daal::internal::ProfilerState::instance().getDeviceTimeline().add(record);
+}
+
+services::Collection<DeviceOperationStatistics> DeviceProfiler::getSummary()
+{
+    services::Collection<DeviceOperationStatistics> summary;
+    daal::internal::ProfilerState::instance().getDeviceTimeline().read(
+        [&](const std::vector<daal::internal::DeviceEvent> &, const std::map<std::string, DeviceOperationStatistics> & statistics) {
+            for (std::map<std::string, DeviceOperationStatistics>::const_iterator it = statistics.begin(); it != statistics.end(); ++it)
+            {
+                DeviceOperationStatistics stats = it->second;
+                stats.name                      = it->first.c_str();
+                summary.push_back(stats);
+            }
+        });
+    return summary;
+}
+
+void DeviceProfiler::reset()
+{
+    daal::internal::ProfilerState::instance().getDeviceTimeline().clear();
+}
+
+} // namespace interface1
+} // namespace sycl
+} // namespace internal
+} // namespace services
 } // namespace daal
@@ -21,27 +21,53 @@
 //--
 */
 
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
+#include "services/daal_defines.h"
+
 namespace daal
 {
 namespace internal
 {
-class ProfilerTask
+class DAAL_EXPORT ProfilerTask
 {
 public:
     ProfilerTask(const char * taskName);
+    ProfilerTask(const ProfilerTask & other);
     ~ProfilerTask();
 
 private:
+    ProfilerTask & operator=(const ProfilerTask &);
+
     const char * _taskName;
+    long long _start; // Negative if the profiler is disabled
+    mutable bool _isOwner;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
-class Profiler
+/* Records the nested tasks of DAAL_ITTNOTIFY_SCOPED_TASK sites in the
+ * per-thread timelines. The profiler is disabled by default, it is enabled
+ * by the DAAL_PROFILER_OUTPUT environment variable or by enable(). The file
+ * given in the variable receives the Chrome trace of the tasks and the
+ * aggregated statistics per task name at the exit of the process. */
+class DAAL_EXPORT Profiler
 {
 public:
     static ProfilerTask startTask(const char * taskName);
     static void endTask(const char * taskName);
+
+    static bool isEnabled();
+    static void enable(bool enable = true);
+
+    /* Writes the tasks recorded so far as the Chrome trace JSON, returns
+     * false if the file cannot be written */
+    static bool dump(const char * fileName);
+
+    /* Drops the recorded tasks */
+    static void reset();
 };
 
 } // namespace internal
 } // namespace daal
+
+#endif
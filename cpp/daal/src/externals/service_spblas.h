@@ -246,6 +246,44 @@ public:
         return services::Status();
     }
 
+    /* Adds the lower triangle of A^T * A to the row-major matrix c with the leading dimension ldc, where A is
+       the m x n CSR matrix with one-based indices. The rows of c are independent and computed in parallel
+       from the columns of A, so no thread local copies of c are needed. */
+    static services::Status xsyrk_at_a(const fpType * a, const size_t * ja, const size_t * ia, size_t m, size_t n, fpType * c, size_t ldc)
+    {
+        const size_t nnzTotal = ia[m] - ia[0];
+
+        TArray<uint32_t, cpu> rowIdxCSCArr(nnzTotal);
+        uint32_t * rowIdxCSC = rowIdxCSCArr.get();
+
+        TArray<uint32_t, cpu> colIdxCSCArr(n + 1);
+        uint32_t * colIdxCSC = colIdxCSCArr.get();
+
+        TArray<fpType, cpu> valuesCSCArr(nnzTotal);
+        fpType * valuesCSC = valuesCSCArr.get();
+
+        DAAL_CHECK(rowIdxCSC && colIdxCSC && valuesCSC, services::ErrorMemoryAllocationFailed);
+
+        csr2csc(m, n, a, ja, ia, valuesCSC, rowIdxCSC, colIdxCSC);
+
+        daal::threader_for(n, n, [=](size_t j) {
+            fpType * cRow = c + j * ldc;
+            for (uint32_t l = colIdxCSC[j]; l < colIdxCSC[j + 1]; ++l)
+            {
+                const size_t i     = rowIdxCSC[l];
+                const fpType value = valuesCSC[l];
+                const size_t end   = ia[i + 1] - ia[0];
+                for (size_t t = ia[i] - ia[0]; t < end; ++t)
+                {
+                    const size_t k = ja[t] - 1;
+                    if (k <= j) cRow[k] += value * a[t];
+                }
+            }
+        });
+
+        return services::Status();
+    }
+
     static services::Status xgemm_a_bt(const fpType * a, const size_t * ja, const size_t * ia, const fpType * b, const size_t * jb, const size_t * ib,
                                        size_t ma, size_t mb, size_t n, fpType * c)
     {
@@ -0,0 +1,294 @@
+/* file: block_size_tuning.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Empirical tuning of the block sizes of the kernels.
+//
+//  DAAL_TUNING_PROFILE is the path of the tuning profile, the text file of
+//  the lines
+//      <cpu model>/<cpu type> <kernel> <shape class> <block size>
+//  e.g. "GenuineIntel-6-106/avx512 kmeans::lloydDense<float> 14,5,3 256".
+//  The kernel is named with the precision of its computations. The shape
+//  class is the binary logarithm of every dimension of the data, so the
+//  block size tuned on the data of 20000 rows is used for 16384..32767 rows.
+//  The kernels use the block size of the profile for their CPU model, CPU
+//  type and shape class, otherwise their heuristics.
+//
+//  DAAL_TUNING_RUN=<repeats> makes the tuning run: every kernel call with a
+//  new shape class tries the next candidate block size, the heuristic one
+//  and the powers of two accepted by the kernel, and measures the time of
+//  the call. Every candidate is measured <repeats> times (3 by default),
+//  then the fastest one by the time per element of the data is used. The
+//  results are merged into the profile at the exit of the process, the
+//  lines of the other CPU models are kept.
+//--
+*/
+
+#include "services/env_detect.h"
+#include "src/services/service_defines.h"
+#include "src/services/service_tuning.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+const size_t defaultRepeats = 3;
+
+const char * getCpuName(const int cpuid)
+{
+    switch (cpuid)
+    {
+    case daal::sse2: return "sse2";
+    case daal::ssse3: return "ssse3";
+    case daal::sse42: return "sse42";
+    case daal::avx: return "avx";
+    case daal::avx2: return "avx2";
+    case daal::avx512_mic: return "avx512_mic";
+    case daal::avx512: return "avx512";
+    case daal::avx512_mic_e1: return "avx512_mic_e1";
+    default: return "unknown";
+    }
+}
+
+size_t log2Floor(size_t value)
+{
+    size_t result = 0;
+    while (value >>= 1) ++result;
+    return result;
+}
+
+/* The measurements of the candidate block sizes of one kernel, CPU type and shape class */
+struct TuningEntry
+{
+    std::vector<size_t> candidates;
+    std::vector<size_t> nMeasured;
+    std::vector<double> bestTime; /* the smallest time per element of the data, in seconds */
+
+    bool isDone(const size_t repeats) const
+    {
+        for (size_t i = 0; i < nMeasured.size(); i++)
+        {
+            if (nMeasured[i] < repeats) return false;
+        }
+        return true;
+    }
+
+    /* Returns the index of the fastest measured candidate, candidates.size() if none is measured */
+    size_t best() const
+    {
+        size_t result = candidates.size();
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            if (nMeasured[i] && (result == candidates.size() || bestTime[i] < bestTime[result])) result = i;
+        }
+        return result;
+    }
+};
+
+struct Trial
+{
+    std::string key;
+    size_t candidate;
+    double nElements;
+    std::chrono::steady_clock::time_point start;
+};
+
+class TuningProfile
+{
+public:
+    static TuningProfile & instance()
+    {
+        static TuningProfile profile;
+        return profile;
+    }
+
+    bool isEnabled() const { return !_path.empty(); }
+
+    size_t get(const int cpuid, const char * kernel, const size_t fpSize, const size_t * shape, const size_t shapeSize, const size_t defaultSize,
+               const size_t minSize, const size_t maxSize, int * trial)
+    {
+        std::ostringstream key;
+        key << __daal_serv_cpu_model() << '/' << getCpuName(cpuid) << ' ' << kernel << (fpSize == sizeof(float) ? "<float> " : "<double> ");
+        double nElements = 1.0;
+        for (size_t i = 0; i < shapeSize; i++)
+        {
+            key << (i ? "," : "") << log2Floor(shape[i]);
+            if (shape[i]) nElements *= static_cast<double>(shape[i]);
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        /* the candidates of the tuning run change the blocks of the reductions, the deterministic mode keeps the profile sizes */
+        if (_repeats && !__daal_serv_is_deterministic())
+        {
+            return nextCandidate(key.str(), defaultSize, minSize, maxSize, nElements, trial);
+        }
+
+        std::map<std::string, size_t>::const_iterator it = _sizes.find(key.str());
+        /* the profile of the other build may have the sizes outside of the bounds of this one */
+        if (it == _sizes.end() || it->second < minSize || it->second > maxSize) return defaultSize;
+        return it->second;
+    }
+
+    void endTrial(const int trial)
+    {
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::map<int, Trial>::iterator it = _trials.find(trial);
+        if (it == _trials.end()) return;
+
+        const double time      = std::chrono::duration<double>(end - it->second.start).count() / it->second.nElements;
+        TuningEntry & entry    = _entries[it->second.key];
+        const size_t candidate = it->second.candidate;
+        if (!entry.nMeasured[candidate] || time < entry.bestTime[candidate]) entry.bestTime[candidate] = time;
+        ++entry.nMeasured[candidate];
+        _trials.erase(it);
+    }
+
+private:
+    TuningProfile() : _repeats(0), _nextTrial(0)
+    {
+        const char * path = std::getenv("DAAL_TUNING_PROFILE");
+        if (path) _path = path;
+
+        const char * run = std::getenv("DAAL_TUNING_RUN");
+        if (run && run[0] && std::strcmp(run, "0") != 0)
+        {
+            const long repeats = std::strtol(run, nullptr, 10);
+            _repeats           = repeats > 0 ? static_cast<size_t>(repeats) : defaultRepeats;
+            if (_path.empty())
+            {
+                std::fprintf(stderr, "oneDAL: DAAL_TUNING_RUN is ignored, DAAL_TUNING_PROFILE is not set\n");
+                _repeats = 0;
+            }
+        }
+        if (!_path.empty()) read();
+    }
+
+    ~TuningProfile()
+    {
+        if (_repeats) write();
+    }
+
+    size_t nextCandidate(const std::string & key, const size_t defaultSize, const size_t minSize, const size_t maxSize, const double nElements,
+                         int * trial)
+    {
+        std::map<std::string, TuningEntry>::iterator it = _entries.find(key);
+        if (it == _entries.end())
+        {
+            TuningEntry entry;
+            entry.candidates.push_back(defaultSize);
+            for (size_t size = 1; size && size <= maxSize; size <<= 1)
+            {
+                if (size >= minSize && size != defaultSize) entry.candidates.push_back(size);
+            }
+            entry.nMeasured.assign(entry.candidates.size(), 0);
+            entry.bestTime.assign(entry.candidates.size(), 0.0);
+            it = _entries.insert(std::make_pair(key, entry)).first;
+        }
+
+        const TuningEntry & entry = it->second;
+        if (entry.isDone(_repeats)) return entry.candidates[entry.best()];
+
+        /* the candidates are measured in turn, so the warming up of the first calls is spread over them */
+        size_t candidate = 0;
+        for (size_t i = 1; i < entry.candidates.size(); i++)
+        {
+            if (entry.nMeasured[i] < entry.nMeasured[candidate]) candidate = i;
+        }
+
+        Trial started;
+        started.key       = key;
+        started.candidate = candidate;
+        started.nElements = nElements;
+        started.start     = std::chrono::steady_clock::now();
+        *trial            = _nextTrial++;
+        _trials[*trial]   = started;
+        return entry.candidates[candidate];
+    }
+
+    void read()
+    {
+        FILE * file = std::fopen(_path.c_str(), "r");
+        if (!file) return;
+
+        char line[1024];
+        while (std::fgets(line, sizeof(line), file))
+        {
+            if (line[0] == '#') continue;
+            char model[256], kernel[256], shape[256];
+            unsigned long long size = 0;
+            if (std::sscanf(line, "%255s %255s %255s %llu", model, kernel, shape, &size) != 4 || !size) continue;
+            _sizes[std::string(model) + ' ' + kernel + ' ' + shape] = static_cast<size_t>(size);
+        }
+        std::fclose(file);
+    }
+
+    void write()
+    {
+        for (std::map<std::string, TuningEntry>::const_iterator it = _entries.begin(); it != _entries.end(); ++it)
+        {
+            const size_t best = it->second.best();
+            if (best < it->second.candidates.size()) _sizes[it->first] = it->second.candidates[best];
+        }
+
+        FILE * file = std::fopen(_path.c_str(), "w");
+        if (!file)
+        {
+            std::fprintf(stderr, "oneDAL: the tuning profile %s is not written\n", _path.c_str());
+            return;
+        }
+        std::fprintf(file, "# <cpu model>/<cpu type> <kernel> <shape class> <block size>\n");
+        for (std::map<std::string, size_t>::const_iterator it = _sizes.begin(); it != _sizes.end(); ++it)
+        {
+            std::fprintf(file, "%s %llu\n", it->first.c_str(), static_cast<unsigned long long>(it->second));
+        }
+        std::fclose(file);
+    }
+
+    std::string _path;
+    size_t _repeats;
+    int _nextTrial;
+    std::mutex _mutex;
+    std::map<std::string, size_t> _sizes;
+    std::map<std::string, TuningEntry> _entries;
+    std::map<int, Trial> _trials;
+};
+
+} // namespace
+
+DAAL_EXPORT size_t __daal_serv_tuned_block_size(int cpuid, const char * kernel, size_t fpSize, const size_t * shape, size_t shapeSize,
+                                                size_t defaultSize, size_t minSize, size_t maxSize, int * trial)
+{
+    if (trial) *trial = -1;
+    TuningProfile & profile = TuningProfile::instance();
+    if (!profile.isEnabled() || !kernel || !trial || (shapeSize && !shape)) return defaultSize;
+    return profile.get(cpuid, kernel, fpSize, shape, shapeSize, defaultSize, minSize, maxSize, trial);
+}
+
+DAAL_EXPORT void __daal_serv_tuning_trial_end(int trial)
+{
+    if (trial >= 0) TuningProfile::instance().endTrial(trial);
+}
@@ -30,6 +30,7 @@
 #include "src/threading/threading.h"
 
 #include <stdint.h>
+#include <stdio.h>
 #if defined(_MSC_VER)
     #if (_MSC_FULL_VER >= 160040219)
         #include <intrin.h>
@@ -38,6 +39,11 @@
     #endif
 #endif
 
+#if defined(__linux__)
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
 #if defined(__APPLE__)
 void __daal_serv_CPUHasAVX512f_enable_it_mac();
 #endif
@@ -251,6 +257,122 @@ static int check_ssse3_features()
     return 1;
 }
 
+static int check_avx512_vnni_features()
+{
+    /* CPUID.(EAX=07H, ECX=0H):ECX.AVX512_VNNI[bit 11]==1 */
+    uint32_t avx512_vnni_mask = (1 << 11);
+
+    return check_cpuid(7, 0, 2, avx512_vnni_mask);
+}
+
+static int check_avx512_bf16_features()
+{
+    /* CPUID.(EAX=07H, ECX=0H):EAX is the maximal subleaf */
+    uint32_t abcd[4];
+    run_cpuid(7, 0, abcd);
+    if (abcd[0] < 1)
+    {
+        return 0;
+    }
+
+    /* CPUID.(EAX=07H, ECX=1H):EAX.AVX512_BF16[bit 5]==1 */
+    uint32_t avx512_bf16_mask = (1 << 5);
+
+    return check_cpuid(7, 1, 0, avx512_bf16_mask);
+}
+
+static int check_amx_bf16_features()
+{
+    /*
+    CPUID.(EAX=07H, ECX=0H):EDX.AMX-BF16[bit 22]==1 &&
+    CPUID.(EAX=07H, ECX=0H):EDX.AMX-TILE[bit 24]==1
+    */
+    uint32_t amx_mask = (1 << 22) | (1 << 24);
+
+    /* 60000H - XTILECFG and XTILEDATA state are enabled by OS */
+    uint32_t xtile_mask = 0x60000;
+
+    if (!check_cpuid(7, 0, 3, amx_mask))
+    {
+        return 0;
+    }
+    if (!check_xgetbv_xcr0_ymm(xtile_mask))
+    {
+        return 0;
+    }
+#if defined(__linux__)
+    /* Linux allocates the state of the tile data only for the processes that request it by
+       arch_prctl(ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA) */
+    if (syscall(SYS_arch_prctl, 0x1023, 18) != 0)
+    {
+        return 0;
+    }
+#endif
+
+    return 1;
+}
+
+static uint64_t detect_cpu_features()
+{
+    uint64_t features = 0;
+    if (!check_avx512_features() || !daal_check_is_intel_cpu())
+    {
+        return features;
+    }
+
+    if (check_avx512_vnni_features())
+    {
+        features |= DAAL_CPU_FEATURE_AVX512_VNNI;
+    }
+    if (check_avx512_bf16_features())
+    {
+        features |= DAAL_CPU_FEATURE_AVX512_BF16;
+    }
+    if (check_amx_bf16_features())
+    {
+        features |= DAAL_CPU_FEATURE_AMX_BF16;
+    }
+    return features;
+}
+
+DAAL_EXPORT uint64_t __daal_serv_cpu_feature_detect()
+{
+    static const uint64_t features = detect_cpu_features();
+    return features;
+}
+
+/* The model is vendor-family-model, e.g. GenuineIntel-6-106, with the display family and model of CPUID.01H */
+static void detect_cpu_model(char * model, const size_t size)
+{
+    uint32_t abcd[4];
+    run_cpuid(0, 0, abcd);
+    char vendor[13];
+    const uint32_t vendorRegs[3] = { abcd[1], abcd[3], abcd[2] };
+    for (int i = 0; i < 12; i++)
+    {
+        vendor[i] = static_cast<char>((vendorRegs[i / 4] >> (8 * (i % 4))) & 0xFF);
+    }
+    vendor[12] = '\0';
+
+    run_cpuid(1, 0, abcd);
+    const uint32_t family    = (abcd[0] >> 8) & 0xF;
+    const uint32_t extFamily = (abcd[0] >> 20) & 0xFF;
+    const uint32_t baseModel = (abcd[0] >> 4) & 0xF;
+    const uint32_t extModel  = (abcd[0] >> 16) & 0xF;
+
+    const uint32_t displayFamily = (family == 0xF) ? family + extFamily : family;
+    const uint32_t displayModel  = (family == 0x6 || family == 0xF) ? (extModel << 4) + baseModel : baseModel;
+    snprintf(model, size, "%s-%u-%u", vendor, displayFamily, displayModel);
+}
+
+DAAL_EXPORT const char * __daal_serv_cpu_model()
+{
+    static char model[64] = { 0 };
+    static const bool isDetected = (detect_cpu_model(model, sizeof(model)), true);
+    (void)isDetected;
+    return model;
+}
+
 DAAL_EXPORT int __daal_serv_cpu_detect(int enable)
 {
     if ((enable & daal::services::Environment::avx512_mic_e1) == daal::services::Environment::avx512_mic_e1)
@@ -0,0 +1,566 @@
+/* file: block_compression_stream.cpp */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the parallel compression and decompression of independent blocks.
+//--
+*/
+
+#include "data_management/compression/compression_stream.h"
+#include "data_management/compression/zlibcompression.h"
+#include "data_management/compression/lzocompression.h"
+#include "data_management/compression/rlecompression.h"
+#include "data_management/compression/bzip2compression.h"
+#include "data_management/compression/lz4compression.h"
+#include "services/daal_memory.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace
+{
+/* Signature of the block index, the bytes "DAALBLK1" in the little-endian order */
+const DAAL_UINT64 blockIndexSignature = 0x314B4C424C414144ULL;
+
+/* Size of the block index header of nBlocks blocks: the signature, the number of blocks and two sizes per block */
+inline size_t blockIndexSize(size_t nBlocks)
+{
+    return (2 + 2 * nBlocks) * sizeof(DAAL_UINT64);
+}
+
+/* Byte array that grows by doubling its capacity */
+class ByteBuffer
+{
+public:
+    ByteBuffer() : _ptr(NULL), _size(0), _capacity(0) {}
+    ~ByteBuffer() { daal::services::daal_free(_ptr); }
+
+    byte * get() { return _ptr; }
+    size_t size() const { return _size; }
+
+    bool resize(size_t size)
+    {
+        if (size > _capacity)
+        {
+            size_t capacity = (_capacity * 2 > size) ? _capacity * 2 : size;
+            byte * ptr      = (byte *)daal::services::daal_malloc(capacity);
+            if (!ptr) return false;
+            if (_size && daal::services::internal::daal_memcpy_s(ptr, capacity, _ptr, _size))
+            {
+                daal::services::daal_free(ptr);
+                return false;
+            }
+            daal::services::daal_free(_ptr);
+            _ptr      = ptr;
+            _capacity = capacity;
+        }
+        _size = size;
+        return true;
+    }
+
+    bool append(const byte * ptr, size_t size)
+    {
+        const size_t offset = _size;
+        if (!resize(_size + size)) return false;
+        return !daal::services::internal::daal_memcpy_s(_ptr + offset, size, ptr, size);
+    }
+
+    void clear()
+    {
+        daal::services::daal_free(_ptr);
+        _ptr      = NULL;
+        _size     = 0;
+        _capacity = 0;
+    }
+
+private:
+    byte * _ptr;
+    size_t _size;
+    size_t _capacity;
+
+    ByteBuffer(const ByteBuffer &);
+    ByteBuffer & operator=(const ByteBuffer &);
+};
+
+/* Compressed block and its uncompressed size */
+struct CompressedBlock
+{
+    CompressedBlock() : rawSize(0) {}
+    size_t rawSize;
+    ByteBuffer data;
+};
+
+typedef services::Collection<services::SharedPtr<CompressedBlock> > CompressedBlockCollection;
+
+template <CompressionMethod method>
+CompressorImpl * createCompressor(CompressionLevel level)
+{
+    Compressor<method> * compressor = new Compressor<method>();
+    if (compressor) compressor->parameter.level = level;
+    return compressor;
+}
+
+CompressorImpl * createCompressor(CompressionMethod method, CompressionLevel level)
+{
+    switch (method)
+    {
+    case zlib: return createCompressor<zlib>(level);
+    case lzo: return createCompressor<lzo>(level);
+    case rle: return createCompressor<rle>(level);
+    case bzip2: return createCompressor<bzip2>(level);
+    case lz4: return createCompressor<lz4>(level);
+    default: return NULL;
+    }
+}
+
+DecompressorImpl * createDecompressor(CompressionMethod method)
+{
+    switch (method)
+    {
+    case zlib: return new Decompressor<zlib>();
+    case lzo: return new Decompressor<lzo>();
+    case rle: return new Decompressor<rle>();
+    case bzip2: return new Decompressor<bzip2>();
+    case lz4: return new Decompressor<lz4>();
+    default: return NULL;
+    }
+}
+
+/* Copies the errors of the block with the smallest index, so the reported error does not depend on the threads scheduling */
+void addFirstErrors(services::ErrorCollection & errors, services::Collection<services::SharedPtr<services::ErrorCollection> > & blockErrors)
+{
+    for (size_t i = 0; i < blockErrors.size(); i++)
+    {
+        if (blockErrors[i] && blockErrors[i]->size() != 0)
+        {
+            errors.add(*blockErrors[i]);
+            return;
+        }
+    }
+}
+
+} // namespace
+
+BlockCompressionStream::BlockCompressionStream(CompressionMethod method, CompressionLevel level, size_t blockSize)
+    : _method(method),
+      _level(level),
+      _blockSize(blockSize),
+      _rawData(NULL),
+      _blocks(NULL),
+      _readPos(0),
+      _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+    if (blockSize == 0 || method > lz4)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _rawData = (void *)new ByteBuffer;
+    _blocks  = (void *)new CompressedBlockCollection;
+    if (!_rawData || !_blocks)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+BlockCompressionStream::~BlockCompressionStream()
+{
+    delete (ByteBuffer *)_rawData;
+    delete (CompressedBlockCollection *)_blocks;
+}
+
+void BlockCompressionStream::push_back(DataBlock * block)
+{
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+    if (block == NULL || block->getPtr() == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if (block->getSize() == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    if (!((ByteBuffer *)_rawData)->append(block->getPtr(), block->getSize()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+void BlockCompressionStream::compressBlocks()
+{
+    ByteBuffer & rawData               = *(ByteBuffer *)_rawData;
+    CompressedBlockCollection & blocks = *(CompressedBlockCollection *)_blocks;
+
+    const size_t nRawBytes = rawData.size();
+    if (nRawBytes == 0)
+    {
+        return;
+    }
+    const size_t nBlocks    = nRawBytes / _blockSize + !!(nRawBytes % _blockSize);
+    const size_t firstBlock = blocks.size();
+
+    services::Collection<services::SharedPtr<services::ErrorCollection> > blockErrors(nBlocks);
+    if (!blockErrors.data())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        blocks.push_back(services::SharedPtr<CompressedBlock>(new CompressedBlock));
+        if (!blocks[firstBlock + i])
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+    }
+
+    byte * raw = rawData.get();
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t offset   = iBlock * _blockSize;
+        const size_t size     = (offset + _blockSize > nRawBytes) ? nRawBytes - offset : _blockSize;
+        CompressedBlock & out = *blocks[firstBlock + iBlock];
+
+        CompressorImpl * compressor = createCompressor(_method, _level);
+        if (!compressor)
+        {
+            blockErrors[iBlock] = services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection());
+            blockErrors[iBlock]->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        {
+            CompressionStream stream(compressor, _blockSize);
+            DataBlock inBlock(raw + offset, size);
+            stream.push_back(&inBlock);
+            const size_t compressedSize = stream.getCompressedDataSize();
+            if (stream.getErrors()->size() == 0)
+            {
+                if (out.data.resize(compressedSize))
+                {
+                    stream.copyCompressedArray(out.data.get(), compressedSize);
+                    out.rawSize = size;
+                }
+                else
+                {
+                    stream.getErrors()->add(services::ErrorMemoryAllocationFailed);
+                }
+            }
+            if (stream.getErrors()->size() != 0)
+            {
+                blockErrors[iBlock] = stream.getErrors();
+            }
+        }
+        delete compressor;
+    });
+
+    addFirstErrors(*this->_errors, blockErrors);
+    rawData.clear();
+}
+
+size_t BlockCompressionStream::getCompressedDataSize()
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    compressBlocks();
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+
+    CompressedBlockCollection & blocks = *(CompressedBlockCollection *)_blocks;
+    size_t size                        = blockIndexSize(blocks.size());
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        size += blocks[i]->data.size();
+    }
+    return size;
+}
+
+size_t BlockCompressionStream::copyCompressedArray(byte * ptr, size_t size)
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    if (ptr == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+
+    const size_t totalSize = getCompressedDataSize();
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+
+    /* The block index and the blocks are copied starting from the read position left by the previous call */
+    CompressedBlockCollection & blocks = *(CompressedBlockCollection *)_blocks;
+    const size_t nBlocks               = blocks.size();
+    const size_t indexSize             = blockIndexSize(nBlocks);
+
+    size_t copied = 0;
+    if (_readPos < indexSize)
+    {
+        services::Collection<DAAL_UINT64> index(2 + 2 * nBlocks);
+        if (!index.data())
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return 0;
+        }
+        index[0] = blockIndexSignature;
+        index[1] = (DAAL_UINT64)nBlocks;
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            index[2 + 2 * i]     = (DAAL_UINT64)blocks[i]->rawSize;
+            index[2 + 2 * i + 1] = (DAAL_UINT64)blocks[i]->data.size();
+        }
+        const size_t n = (indexSize - _readPos < size) ? indexSize - _readPos : size;
+        if (daal::services::internal::daal_memcpy_s(ptr, size, (byte *)index.data() + _readPos, n))
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return 0;
+        }
+        copied += n;
+        _readPos += n;
+    }
+
+    size_t blockStart = indexSize;
+    for (size_t i = 0; i < nBlocks && copied < size && _readPos < totalSize; i++)
+    {
+        const size_t blockSize = blocks[i]->data.size();
+        if (_readPos < blockStart + blockSize)
+        {
+            const size_t offset = _readPos - blockStart;
+            const size_t avail  = blockSize - offset;
+            const size_t n      = (avail < size - copied) ? avail : size - copied;
+            if (daal::services::internal::daal_memcpy_s(ptr + copied, size - copied, blocks[i]->data.get() + offset, n))
+            {
+                this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+                return copied;
+            }
+            copied += n;
+            _readPos += n;
+        }
+        blockStart += blockSize;
+    }
+    return copied;
+}
+
+BlockDecompressionStream::BlockDecompressionStream(CompressionMethod method)
+    : _method(method), _compressedData(NULL), _decompressedData(NULL), _readPos(0), _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+    if (method > lz4)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _compressedData   = (void *)new ByteBuffer;
+    _decompressedData = (void *)new ByteBuffer;
+    if (!_compressedData || !_decompressedData)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+BlockDecompressionStream::~BlockDecompressionStream()
+{
+    delete (ByteBuffer *)_compressedData;
+    delete (ByteBuffer *)_decompressedData;
+}
+
+void BlockDecompressionStream::push_back(DataBlock * block)
+{
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+    if (block == NULL || block->getPtr() == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if (block->getSize() == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    if (!((ByteBuffer *)_compressedData)->append(block->getPtr(), block->getSize()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+void BlockDecompressionStream::decompressBlocks()
+{
+    ByteBuffer & compressedData   = *(ByteBuffer *)_compressedData;
+    ByteBuffer & decompressedData = *(ByteBuffer *)_decompressedData;
+    if (compressedData.size() == 0)
+    {
+        return;
+    }
+
+    /* The block index is validated before any block is decompressed */
+    const DAAL_UINT64 * header = (const DAAL_UINT64 *)compressedData.get();
+    if (compressedData.size() < blockIndexSize(0) || header[0] != blockIndexSignature
+        || header[1] > (compressedData.size() - blockIndexSize(0)) / (2 * sizeof(DAAL_UINT64)))
+    {
+        this->_errors->add(services::ErrorBlockCompressionDataFormat);
+        return;
+    }
+    const size_t nBlocks   = (size_t)header[1];
+    const size_t indexSize = blockIndexSize(nBlocks);
+
+    services::Collection<size_t> rawOffsets(nBlocks + 1);
+    services::Collection<size_t> compressedOffsets(nBlocks + 1);
+    services::Collection<services::SharedPtr<services::ErrorCollection> > blockErrors(nBlocks);
+    if (!rawOffsets.data() || !compressedOffsets.data() || (nBlocks && !blockErrors.data()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    rawOffsets[0]        = decompressedData.size();
+    compressedOffsets[0] = indexSize;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        const DAAL_UINT64 rawSize        = header[2 + 2 * i];
+        const DAAL_UINT64 compressedSize = header[2 + 2 * i + 1];
+        if (compressedSize > compressedData.size() - compressedOffsets[i])
+        {
+            this->_errors->add(services::ErrorBlockCompressionDataFormat);
+            return;
+        }
+        rawOffsets[i + 1]        = rawOffsets[i] + (size_t)rawSize;
+        compressedOffsets[i + 1] = compressedOffsets[i] + (size_t)compressedSize;
+    }
+    if (compressedOffsets[nBlocks] != compressedData.size())
+    {
+        this->_errors->add(services::ErrorBlockCompressionDataFormat);
+        return;
+    }
+    if (!decompressedData.resize(rawOffsets[nBlocks]))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    byte * in  = compressedData.get();
+    byte * out = decompressedData.get();
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t rawSize        = rawOffsets[iBlock + 1] - rawOffsets[iBlock];
+        const size_t compressedSize = compressedOffsets[iBlock + 1] - compressedOffsets[iBlock];
+        if (rawSize == 0 && compressedSize == 0) return;
+
+        DecompressorImpl * decompressor = createDecompressor(_method);
+        if (!decompressor)
+        {
+            blockErrors[iBlock] = services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection());
+            blockErrors[iBlock]->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        {
+            DecompressionStream stream(decompressor, rawSize ? rawSize : 1);
+            DataBlock inBlock(in + compressedOffsets[iBlock], compressedSize);
+            stream.push_back(&inBlock);
+            if (stream.getDecompressedDataSize() != rawSize && stream.getErrors()->size() == 0)
+            {
+                stream.getErrors()->add(services::ErrorBlockCompressionDataFormat);
+            }
+            if (stream.getErrors()->size() == 0 && rawSize)
+            {
+                stream.copyDecompressedArray(out + rawOffsets[iBlock], rawSize);
+            }
+            if (stream.getErrors()->size() != 0)
+            {
+                blockErrors[iBlock] = stream.getErrors();
+            }
+        }
+        delete decompressor;
+    });
+
+    addFirstErrors(*this->_errors, blockErrors);
+    compressedData.clear();
+}
+
+size_t BlockDecompressionStream::getDecompressedDataSize()
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    decompressBlocks();
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    return ((ByteBuffer *)_decompressedData)->size() - _readPos;
+}
+
+size_t BlockDecompressionStream::copyDecompressedArray(byte * ptr, size_t size)
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    if (ptr == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+
+    const size_t avail = getDecompressedDataSize();
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+
+    const size_t n = (avail < size) ? avail : size;
+    if (n && daal::services::internal::daal_memcpy_s(ptr, size, ((ByteBuffer *)_decompressedData)->get() + _readPos, n))
+    {
+        this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+        return 0;
+    }
+    _readPos += n;
+    return n;
+}
+
+} //namespace data_management
+} //namespace daal
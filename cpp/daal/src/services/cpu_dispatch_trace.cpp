@@ -0,0 +1,211 @@
+/* file: cpu_dispatch_trace.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Tracing and overriding of the CPU type chosen by the dispatchers of the
+//  algorithm containers and of the oneAPI kernels.
+//
+//  DAAL_CPU_DISPATCH_TRACE=1 writes the CPU type chosen by every dispatcher
+//  to stderr, once per dispatcher and CPU type.
+//
+//  DAAL_CPU_DISPATCH_OVERRIDE is the comma-separated list of the rules
+//  pattern=cpu, where cpu is one of sse2, ssse3, sse42, avx, avx2, avx512.
+//  The first rule whose pattern is a substring of the name of the dispatcher
+//  lowers its CPU type, e.g. "kmeans=avx2,svm::training=sse42". The rules
+//  above the detected CPU type are ignored, their kernels would fail with the
+//  illegal instruction.
+//--
+*/
+
+#include "services/daal_defines.h"
+#include "services/env_detect.h"
+#include "services/internal/daal_kernel_defines.h"
+#include "src/services/service_defines.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct OverrideRule
+{
+    std::string pattern;
+    int cpuid;
+};
+
+const char * getCpuName(const int cpuid)
+{
+    switch (cpuid)
+    {
+    case daal::sse2: return "sse2";
+    case daal::ssse3: return "ssse3";
+    case daal::sse42: return "sse42";
+    case daal::avx: return "avx";
+    case daal::avx2: return "avx2";
+    case daal::avx512_mic: return "avx512_mic";
+    case daal::avx512: return "avx512";
+    case daal::avx512_mic_e1: return "avx512_mic_e1";
+    default: return "unknown";
+    }
+}
+
+/* The Xeon Phi CPU types are not accepted, they are not the subsets of avx512 */
+int parseCpuName(const std::string & name)
+{
+    const int cpus[] = { daal::sse2, daal::ssse3, daal::sse42, daal::avx, daal::avx2, daal::avx512 };
+    for (size_t i = 0; i < sizeof(cpus) / sizeof(cpus[0]); i++)
+    {
+        if (name == getCpuName(cpus[i])) return cpus[i];
+    }
+    return -1;
+}
+
+/* Returns true if the library has the kernels of the CPU type, otherwise the dispatchers choose sse2 */
+bool isKernelBuilt(const int cpuid)
+{
+    switch (cpuid)
+    {
+    case daal::sse2: return true;
+#if defined(DAAL_KERNEL_SSSE3)
+    case daal::ssse3: return true;
+#endif
+#if defined(DAAL_KERNEL_SSE42)
+    case daal::sse42: return true;
+#endif
+#if defined(DAAL_KERNEL_AVX)
+    case daal::avx: return true;
+#endif
+#if defined(DAAL_KERNEL_AVX2)
+    case daal::avx2: return true;
+#endif
+#if defined(DAAL_KERNEL_AVX512_MIC)
+    case daal::avx512_mic: return true;
+#endif
+#if defined(DAAL_KERNEL_AVX512)
+    case daal::avx512: return true;
+#endif
+    default: return false;
+    }
+}
+
+class DispatchConfig
+{
+public:
+    static DispatchConfig & instance()
+    {
+        static DispatchConfig config;
+        return config;
+    }
+
+    bool isEnabled() const { return _isTraced || !_rules.empty(); }
+
+    int dispatch(const int cpuid, const char * name)
+    {
+        int result                  = cpuid;
+        const OverrideRule * chosen = nullptr;
+        for (size_t i = 0; i < _rules.size(); i++)
+        {
+            if (std::strstr(name, _rules[i].pattern.c_str()))
+            {
+                chosen = &_rules[i];
+                if (chosen->cpuid < cpuid) result = chosen->cpuid;
+                break;
+            }
+        }
+        if (!isKernelBuilt(result)) result = daal::sse2;
+
+        if (_isTraced) trace(name, cpuid, result, chosen);
+        return result;
+    }
+
+private:
+    DispatchConfig() : _isTraced(false)
+    {
+        const char * trace = std::getenv("DAAL_CPU_DISPATCH_TRACE");
+        _isTraced          = trace && trace[0] && std::strcmp(trace, "0") != 0;
+
+        const char * rules = std::getenv("DAAL_CPU_DISPATCH_OVERRIDE");
+        if (rules) parseRules(rules);
+    }
+
+    void parseRules(const char * rules)
+    {
+        std::string text(rules);
+        size_t start = 0;
+        while (start <= text.size())
+        {
+            size_t end = text.find(',', start);
+            if (end == std::string::npos) end = text.size();
+            const std::string rule = text.substr(start, end - start);
+            start                  = end + 1;
+            if (rule.empty()) continue;
+
+            const size_t eq = rule.rfind('=');
+            const int cpuid = (eq == std::string::npos || eq == 0) ? -1 : parseCpuName(rule.substr(eq + 1));
+            if (cpuid < 0)
+            {
+                std::fprintf(stderr, "oneDAL: the rule '%s' of DAAL_CPU_DISPATCH_OVERRIDE is ignored\n", rule.c_str());
+                continue;
+            }
+            OverrideRule parsed;
+            parsed.pattern = rule.substr(0, eq);
+            parsed.cpuid   = cpuid;
+            _rules.push_back(parsed);
+        }
+    }
+
+    void trace(const char * name, const int cpuid, const int result, const OverrideRule * chosen)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_traced.insert(std::string(name) + '/' + getCpuName(result)).second) return;
+
+        if (result == cpuid)
+        {
+            std::fprintf(stderr, "oneDAL dispatch: %s: %s\n", name, getCpuName(result));
+        }
+        else if (chosen && chosen->cpuid == result)
+        {
+            std::fprintf(stderr, "oneDAL dispatch: %s: %s (detected %s, overridden by %s)\n", name, getCpuName(result), getCpuName(cpuid),
+                         chosen->pattern.c_str());
+        }
+        else
+        {
+            std::fprintf(stderr, "oneDAL dispatch: %s: %s (detected %s, no kernels for %s)\n", name, getCpuName(result), getCpuName(cpuid),
+                         getCpuName((chosen && chosen->cpuid < cpuid) ? chosen->cpuid : cpuid));
+        }
+    }
+
+    bool _isTraced;
+    std::vector<OverrideRule> _rules;
+    std::mutex _mutex;
+    std::set<std::string> _traced;
+};
+
+} // namespace
+
+DAAL_EXPORT int __daal_serv_cpu_dispatch(int cpuid, const char * name)
+{
+    DispatchConfig & config = DispatchConfig::instance();
+    if (!config.isEnabled() || !name) return cpuid;
+    return config.dispatch(cpuid, name);
+}
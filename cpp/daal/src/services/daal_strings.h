@@ -70,6 +70,9 @@
     DECLARE_DAAL_STRING_CONST(cosineDistance)                    \
     DECLARE_DAAL_STRING_CONST(quantiles)                         \
     DECLARE_DAAL_STRING_CONST(quantileOrders)                    \
+    DECLARE_DAAL_STRING_CONST(sketchSize)                        \
+    DECLARE_DAAL_STRING_CONST(sketchValues)                      \
+    DECLARE_DAAL_STRING_CONST(sketchWeights)                     \
     DECLARE_DAAL_STRING_CONST(covariance)                        \
     DECLARE_DAAL_STRING_CONST(correlation)                       \
     DECLARE_DAAL_STRING_CONST(mean)                              \
@@ -78,6 +81,7 @@
     DECLARE_DAAL_STRING_CONST(minWeightFractionInLeafNode)       \
     DECLARE_DAAL_STRING_CONST(minImpurityDecreaseInSplitNode)    \
     DECLARE_DAAL_STRING_CONST(maxLeafNodes)                      \
+    DECLARE_DAAL_STRING_CONST(gradientQuantizationBits)          \
     DECLARE_DAAL_STRING_CONST(sum)                               \
     DECLARE_DAAL_STRING_CONST(penaltyL1)                         \
     DECLARE_DAAL_STRING_CONST(penaltyL2)                         \
@@ -123,6 +127,7 @@
     DECLARE_DAAL_STRING_CONST(nUniqueItems)                      \
     DECLARE_DAAL_STRING_CONST(nTransactions)                     \
     DECLARE_DAAL_STRING_CONST(maxBins)                           \
+    DECLARE_DAAL_STRING_CONST(maxDistance)                       \
     DECLARE_DAAL_STRING_CONST(minBinSize)                        \
     DECLARE_DAAL_STRING_CONST(maxItemsetSize)                    \
     DECLARE_DAAL_STRING_CONST(minItemsetSize)                    \
@@ -291,6 +296,8 @@
     DECLARE_DAAL_STRING_CONST(dataForPruning)                    \
     DECLARE_DAAL_STRING_CONST(labelsForPruning)                  \
     DECLARE_DAAL_STRING_CONST(dependentVariablesForPruning)      \
+    DECLARE_DAAL_STRING_CONST(validationData)                    \
+    DECLARE_DAAL_STRING_CONST(validationDependentVariable)       \
     DECLARE_DAAL_STRING_CONST(partition)                         \
     DECLARE_DAAL_STRING_CONST(transposedData)                    \
     DECLARE_DAAL_STRING_CONST(optimizationSolver)                \
@@ -378,7 +385,12 @@
     DECLARE_DAAL_STRING_CONST(step13Assignments)                 \
     DECLARE_DAAL_STRING_CONST(step13AssignmentQueries)           \
     DECLARE_DAAL_STRING_CONST(gramMatrix)                        \
-    DECLARE_DAAL_STRING_CONST(lassoParameters)
+    DECLARE_DAAL_STRING_CONST(lassoParameters)                   \
+    DECLARE_DAAL_STRING_CONST(nMatrices)                         \
+    DECLARE_DAAL_STRING_CONST(initialBasicSubsetMean)            \
+    DECLARE_DAAL_STRING_CONST(initialBasicSubsetCovariance)      \
+    DECLARE_DAAL_STRING_CONST(basicSubsetMean)                   \
+    DECLARE_DAAL_STRING_CONST(basicSubsetCovariance)
 
 /**
  *  Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) namespace
@@ -22,6 +22,9 @@
 */
 
 #include <immintrin.h>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 
 #include "services/env_detect.h"
 #include "services/daal_defines.h"
@@ -131,6 +134,29 @@ DAAL_EXPORT daal::services::Environment::Environment() : _globalControl {}
     this->setDefaultExecutionContext(internal::CpuExecutionContext());
 }
 
+namespace
+{
+// The contexts of the threads which run the computations on different devices
+thread_local daal::services::SharedPtr<daal::services::internal::sycl::ExecutionContextIface> threadExecutionContext;
+} // namespace
+
+DAAL_EXPORT void daal::services::Environment::setThreadExecutionContext(
+    const SharedPtr<services::internal::sycl::ExecutionContextIface> & ctx)
+{
+    threadExecutionContext = ctx;
+}
+
+DAAL_EXPORT daal::services::SharedPtr<daal::services::internal::sycl::ExecutionContextIface>
+    daal::services::Environment::getThreadExecutionContext() const
+{
+    return threadExecutionContext;
+}
+
+DAAL_EXPORT daal::services::internal::sycl::ExecutionContextIface & daal::services::Environment::getDefaultExecutionContext()
+{
+    return threadExecutionContext ? *threadExecutionContext : *_executionContext;
+}
+
 DAAL_EXPORT daal::services::Environment::Environment(const Environment & e) : daal::services::Environment::Environment() {}
 
 DAAL_EXPORT void daal::services::Environment::initNumberOfThreads()
@@ -197,3 +223,32 @@ DAAL_EXPORT void daal::services::Environment::enableThreadPinning(const bool ena
 #endif
     return;
 }
+
+namespace
+{
+/* -1 until the mode is read from DAAL_DETERMINISTIC or set by enableDeterministicMode() */
+std::atomic<int> deterministicMode(-1);
+} // namespace
+
+DAAL_EXPORT bool __daal_serv_is_deterministic()
+{
+    int mode = deterministicMode.load(std::memory_order_relaxed);
+    if (mode < 0)
+    {
+        const char * value = std::getenv("DAAL_DETERMINISTIC");
+        int expected       = -1;
+        deterministicMode.compare_exchange_strong(expected, (value && value[0] && std::strcmp(value, "0") != 0) ? 1 : 0);
+        mode = deterministicMode.load(std::memory_order_relaxed);
+    }
+    return mode == 1;
+}
+
+DAAL_EXPORT void daal::services::Environment::enableDeterministicMode(const bool enableDeterministicModeFlag)
+{
+    deterministicMode.store(enableDeterministicModeFlag ? 1 : 0, std::memory_order_relaxed);
+}
+
+DAAL_EXPORT bool daal::services::Environment::isDeterministicMode() const
+{
+    return __daal_serv_is_deterministic();
+}
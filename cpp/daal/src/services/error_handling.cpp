@@ -877,6 +877,14 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorRleDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
     add(ErrorRleDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
 
+    add(ErrorLz4Internal, "LZ4 internal error");
+    add(ErrorLz4OutputStreamSizeIsNotEnough, "Size of output stream is not enough to start compression");
+    add(ErrorLz4DataFormat, "Input compressed stream is in wrong format or corrupted");
+    add(ErrorLz4DataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
+    add(ErrorLz4DataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
+
+    add(ErrorBlockCompressionDataFormat, "Input compressed stream has no valid block index or is corrupted");
+
     // Min-max normalization errors: -9400..-9499
     add(ErrorLowerBoundGreaterThanOrEqualToUpperBound, "Lower bound parameter greater than or equal to upper bound");
 
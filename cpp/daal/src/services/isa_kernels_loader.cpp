@@ -0,0 +1,170 @@
+/* file: isa_kernels_loader.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Lazy loading of the kernels of the CPU types built into the separate
+//  libraries (make SPLIT_ISA=yes).
+//
+//  The library of the kernels of the CPU type, e.g. libonedal_core_avx2.so,
+//  is loaded from the directory of the core library by the first dispatcher
+//  that chooses the CPU type. The containers of the loaded library register
+//  their factories on loading, the dispatchers create the containers by the
+//  names of their types. If the library is not found, the dispatchers fall
+//  back to the sse2 kernels of the core library.
+//--
+*/
+
+#include "services/daal_defines.h"
+#include "services/env_detect.h"
+#include "src/services/service_defines.h"
+
+#if defined(__linux__)
+    #include <dlfcn.h>
+#endif
+
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace
+{
+typedef void * (*ContainerFactory)(void *);
+
+const char * getIsaLibrarySuffix(const int cpuid)
+{
+    switch (cpuid)
+    {
+    case daal::ssse3: return "ssse3";
+    case daal::sse42: return "sse42";
+    case daal::avx: return "avx";
+    case daal::avx2: return "avx2";
+    case daal::avx512_mic: return "avx512_mic";
+    case daal::avx512: return "avx512";
+    default: return nullptr;
+    }
+}
+
+/* The factories are registered by the static initializers of the loaded libraries, so the lock of the registry is
+   not held while the libraries are loaded */
+class ContainerRegistry
+{
+public:
+    static ContainerRegistry & instance()
+    {
+        static ContainerRegistry registry;
+        return registry;
+    }
+
+    void add(const char * typeName, ContainerFactory factory)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _factories[typeName] = factory;
+    }
+
+    ContainerFactory find(const char * typeName)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::map<std::string, ContainerFactory>::const_iterator it = _factories.find(typeName);
+        return (it == _factories.end()) ? nullptr : it->second;
+    }
+
+private:
+    ContainerRegistry() {}
+
+    std::mutex _mutex;
+    std::map<std::string, ContainerFactory> _factories;
+};
+
+#if defined(__linux__)
+/* Returns the path of the library of the CPU type next to the core library: onedal_core in the name of the core
+   library is replaced by onedal_core_<cpu>, so the versioned names are kept */
+std::string getIsaLibraryPath(const char * suffix)
+{
+    const std::string coreName = "onedal_core";
+    std::string path           = std::string("lib") + coreName + ".so";
+
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void *>(&getIsaLibraryPath), &info) && info.dli_fname)
+    {
+        const std::string corePath(info.dli_fname);
+        const size_t nameStart = corePath.rfind('/') == std::string::npos ? 0 : corePath.rfind('/') + 1;
+        if (corePath.find(coreName, nameStart) != std::string::npos) path = corePath;
+    }
+
+    const size_t nameStart = path.rfind('/') == std::string::npos ? 0 : path.rfind('/') + 1;
+    const size_t pos       = path.find(coreName, nameStart) + coreName.size();
+    return path.substr(0, pos) + '_' + suffix + path.substr(pos);
+}
+#endif
+
+class IsaLibraries
+{
+public:
+    static IsaLibraries & instance()
+    {
+        static IsaLibraries libraries;
+        return libraries;
+    }
+
+    /* Loads the library of the CPU type once, returns false if it is not loaded */
+    bool load(const int cpuid)
+    {
+        if (cpuid < 0 || cpuid > daal::lastCpuType) return false;
+        std::call_once(_once[cpuid], &IsaLibraries::doLoad, this, cpuid);
+        return _isLoaded[cpuid];
+    }
+
+private:
+    IsaLibraries()
+    {
+        for (int i = 0; i <= daal::lastCpuType; i++) _isLoaded[i] = false;
+    }
+
+    void doLoad(const int cpuid)
+    {
+        const char * suffix = getIsaLibrarySuffix(cpuid);
+        if (!suffix) return;
+#if defined(__linux__)
+        const std::string path = getIsaLibraryPath(suffix);
+        /* the library is never unloaded, the containers created by it may live until the exit */
+        _isLoaded[cpuid] = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL) != nullptr;
+        if (!_isLoaded[cpuid])
+        {
+            std::fprintf(stderr, "oneDAL: the %s kernels are not loaded (%s), the sse2 kernels are used\n", suffix, dlerror());
+        }
+#endif
+    }
+
+    std::once_flag _once[daal::lastCpuType + 1];
+    bool _isLoaded[daal::lastCpuType + 1];
+};
+
+} // namespace
+
+DAAL_EXPORT void __daal_serv_isa_container_register(const char * typeName, void * (*factory)(void *))
+{
+    if (typeName && factory) ContainerRegistry::instance().add(typeName, factory);
+}
+
+DAAL_EXPORT void * __daal_serv_isa_container_create(int cpuid, const char * typeName, void * env)
+{
+    if (!typeName || !IsaLibraries::instance().load(cpuid)) return nullptr;
+    const ContainerFactory factory = ContainerRegistry::instance().find(typeName);
+    return factory ? factory(env) : nullptr;
+}
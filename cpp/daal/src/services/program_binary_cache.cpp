@@ -0,0 +1,251 @@
+/* file: program_binary_cache.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "services/internal/sycl/program_binary_cache.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <direct.h>
+    #include <process.h>
+    #define DAAL_MKDIR(path) _mkdir(path)
+    #define DAAL_GETPID()    _getpid()
+#else
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define DAAL_MKDIR(path) mkdir(path, 0755)
+    #define DAAL_GETPID()    getpid()
+#endif
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace sycl
+{
+namespace interface1
+{
+namespace
+{
+// The binaries larger than this are not stored, they are likely corrupted
+const size_t maxBinarySize = size_t(1) << 30;
+
+class CacheDirectory
+{
+public:
+    static CacheDirectory & instance()
+    {
+        static CacheDirectory directory;
+        return directory;
+    }
+
+    void set(const char * path)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _path = path ? path : "";
+        while (_path.size() > 1 && (_path[_path.size() - 1] == '/' || _path[_path.size() - 1] == '\\'))
+        {
+            _path.erase(_path.size() - 1);
+        }
+        _isCreated = false;
+    }
+
+    std::string get()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _path;
+    }
+
+    /* Returns the path of the cache file, creates the directory before
+     * the first write */
+    std::string getFilePath(const char * key, bool forWrite)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_path.empty() || !key || !key[0]) return std::string();
+        if (forWrite && !_isCreated)
+        {
+            // The parent directories are expected to exist
+            DAAL_MKDIR(_path.c_str());
+            _isCreated = true;
+        }
+        return _path + "/" + key + ".bin";
+    }
+
+private:
+    CacheDirectory() : _isCreated(false)
+    {
+        const char * path = std::getenv("DAAL_GPU_PROGRAM_CACHE_DIR");
+        set(path);
+    }
+
+    std::mutex _mutex;
+    std::string _path;
+    bool _isCreated;
+};
+
+class BundleRegistry
+{
+public:
+    static BundleRegistry & instance()
+    {
+        static BundleRegistry registry;
+        return registry;
+    }
+
+    void add(const ProgramBinaryBundleEntry * entries, size_t count)
+    {
+        if (!entries || count == 0) return;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _parts.push_back(std::make_pair(entries, count));
+    }
+
+    bool isEmpty()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _parts.empty();
+    }
+
+    const ProgramBinaryBundleEntry * find(const char * key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // The bundles hold a few hundred programs, the linear search is
+        // negligible compared to the program creation
+        for (size_t i = 0; i < _parts.size(); i++)
+        {
+            for (size_t j = 0; j < _parts[i].second; j++)
+            {
+                const ProgramBinaryBundleEntry & entry = _parts[i].first[j];
+                if (entry.key && std::strcmp(entry.key, key) == 0) return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::pair<const ProgramBinaryBundleEntry *, size_t> > _parts;
+};
+
+} // namespace
+
+void ProgramBinaryBundle::registerEntries(const ProgramBinaryBundleEntry * entries, size_t count)
+{
+    BundleRegistry::instance().add(entries, count);
+}
+
+bool ProgramBinaryBundle::isEmpty()
+{
+    return BundleRegistry::instance().isEmpty();
+}
+
+bool ProgramBinaryBundle::find(const char * key, const unsigned char ** binary, size_t * size)
+{
+    if (!key || !binary || !size) return false;
+
+    const ProgramBinaryBundleEntry * entry = BundleRegistry::instance().find(key);
+    if (!entry || !entry->binary || entry->size == 0) return false;
+
+    *binary = entry->binary;
+    *size   = entry->size;
+    return true;
+}
+
+void ProgramBinaryCache::setDirectory(const char * path)
+{
+    CacheDirectory::instance().set(path);
+}
+
+services::String ProgramBinaryCache::getDirectory()
+{
+    return services::String(CacheDirectory::instance().get().c_str());
+}
+
+bool ProgramBinaryCache::isEnabled()
+{
+    return !CacheDirectory::instance().get().empty();
+}
+
+bool ProgramBinaryCache::load(const char * key, services::Collection<unsigned char> & binary)
+{
+    const std::string filePath = CacheDirectory::instance().getFilePath(key, false);
+    if (filePath.empty()) return false;
+
+    FILE * file = std::fopen(filePath.c_str(), "rb");
+    if (!file) return false;
+
+    bool isRead = false;
+    if (std::fseek(file, 0, SEEK_END) == 0)
+    {
+        const long size = std::ftell(file);
+        if (size > 0 && static_cast<size_t>(size) <= maxBinarySize && std::fseek(file, 0, SEEK_SET) == 0)
+        {
+            services::Collection<unsigned char> data(static_cast<size_t>(size));
+            if (data.data() && std::fread(data.data(), 1, data.size(), file) == data.size())
+            {
+                binary = data;
+                isRead = true;
+            }
+        }
+    }
+    std::fclose(file);
+    return isRead;
+}
+
+bool ProgramBinaryCache::store(const char * key, const unsigned char * binary, size_t size)
+{
+    if (!binary || size == 0 || size > maxBinarySize) return false;
+
+    const std::string filePath = CacheDirectory::instance().getFilePath(key, true);
+    if (filePath.empty()) return false;
+
+    // The file is written under the unique name and renamed, so the concurrent
+    // processes never read the partially written binary
+    const std::string tmpPath = filePath + "." + std::to_string(DAAL_GETPID()) + ".tmp";
+    FILE * file               = std::fopen(tmpPath.c_str(), "wb");
+    if (!file) return false;
+
+    const bool isWritten = std::fwrite(binary, 1, size, file) == size;
+    if (std::fclose(file) != 0 || !isWritten)
+    {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+#if defined(_WIN32) || defined(_WIN64)
+    // The rename does not replace the existing file on Windows
+    std::remove(filePath.c_str());
+#endif
+    if (std::rename(tmpPath.c_str(), filePath.c_str()) != 0)
+    {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace interface1
+} // namespace sycl
+} // namespace internal
+} // namespace services
+} // namespace daal
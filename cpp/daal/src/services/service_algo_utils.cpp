@@ -25,6 +25,8 @@
 #include "services/error_handling.h"
 #include "src/services/service_algo_utils.h"
 
+#include <chrono>
+
 namespace daal
 {
 namespace services
@@ -38,6 +40,37 @@ HostAppIface::~HostAppIface()
     delete _impl;
     _impl = NULL;
 }
+
+namespace
+{
+double getSteadyTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+CancellationToken::CancellationToken() : _isCancelled(0), _timeLimit(0.0), _startTime(getSteadyTime()) {}
+
+CancellationToken::CancellationToken(double timeLimit) : _isCancelled(0), _timeLimit(timeLimit), _startTime(getSteadyTime()) {}
+
+CancellationToken::~CancellationToken() {}
+
+void CancellationToken::cancel()
+{
+    _isCancelled.set(1);
+}
+
+void CancellationToken::setTimeLimit(double timeLimit)
+{
+    _startTime = getSteadyTime();
+    _timeLimit = timeLimit;
+}
+
+bool CancellationToken::isCancelled()
+{
+    if (_isCancelled.get()) return true;
+    return _timeLimit > 0.0 && getSteadyTime() - _startTime > _timeLimit;
+}
 } // namespace interface1
 
 namespace internal
@@ -95,6 +95,34 @@ struct ScalableCalloc
     static void deallocate(T * ptr) { service_scalable_free<T, cpu>(ptr); }
 };
 
+template <typename T, CpuType cpu>
+struct ScratchMalloc
+{
+    static T * allocate(size_t n) { return service_scratch_malloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_scratch_free<T, cpu>(ptr); }
+};
+
+template <typename T, CpuType cpu>
+struct ScratchCalloc
+{
+    static T * allocate(size_t n) { return service_scratch_calloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_scratch_free<T, cpu>(ptr); }
+};
+
+template <typename T, CpuType cpu>
+struct ArenaMalloc
+{
+    static T * allocate(size_t n) { return service_arena_malloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_arena_free<T, cpu>(ptr); }
+};
+
+template <typename T, CpuType cpu>
+struct ArenaCalloc
+{
+    static T * allocate(size_t n) { return service_arena_calloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_arena_free<T, cpu>(ptr); }
+};
+
 /* CPU specific deleters */
 
 template <typename T, CpuType cpu>
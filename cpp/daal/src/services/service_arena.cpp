@@ -0,0 +1,155 @@
+/* file: service_arena.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the arena allocator for the compute temporaries
+//--
+*/
+
+#include "src/services/service_arena.h"
+#include "services/daal_memory.h"
+#include "src/externals/service_memory.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace
+{
+const size_t minChunkSize = 64 * 1024;
+const size_t maxChunkSize = 4 * 1024 * 1024;
+
+/* The header before every block tells arena_free() where the block came from */
+struct BlockHeader
+{
+    size_t offset;
+    size_t fromArena;
+};
+
+thread_local ScopedArena * currentArena = NULL;
+
+inline size_t alignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+inline size_t blockOffset(size_t alignment)
+{
+    return alignUp(sizeof(BlockHeader), alignment);
+}
+} // namespace
+
+struct ScopedArena::Chunk
+{
+    Chunk * next;
+    size_t size;
+};
+
+ScopedArena::ScopedArena() : _chunks(NULL), _cur(NULL), _end(NULL), _nextChunkSize(minChunkSize), _prev(currentArena)
+{
+    currentArena = this;
+}
+
+ScopedArena::~ScopedArena()
+{
+    currentArena = _prev;
+    while (_chunks)
+    {
+        Chunk * next = _chunks->next;
+        // The chunks come from the scratch cache of the thread, so the
+        // following compute calls get them without going to the heap
+        trackDeallocation(_chunks);
+        threaded_scratch_free(_chunks);
+        _chunks = next;
+    }
+}
+
+ScopedArena * ScopedArena::current()
+{
+    return currentArena;
+}
+
+bool ScopedArena::addChunk(size_t minSize)
+{
+    size_t size = _nextChunkSize;
+    while (size < minSize) size *= 2;
+    if (_nextChunkSize < maxChunkSize) _nextChunkSize *= 2;
+
+    Chunk * chunk = static_cast<Chunk *>(threaded_scratch_malloc(size, DAAL_MALLOC_DEFAULT_ALIGNMENT));
+    if (!chunk) return false;
+    trackAllocation(chunk, size);
+    chunk->next = _chunks;
+    chunk->size = size;
+    _chunks     = chunk;
+    _cur        = reinterpret_cast<char *>(chunk) + sizeof(Chunk);
+    _end        = reinterpret_cast<char *>(chunk) + size;
+    return true;
+}
+
+void * ScopedArena::allocate(size_t size, size_t alignment)
+{
+    const size_t offset = blockOffset(alignment);
+    char * ptr          = _cur ? reinterpret_cast<char *>(alignUp(reinterpret_cast<size_t>(_cur) + offset, alignment)) : NULL;
+    if (!ptr || ptr > _end || size > size_t(_end - ptr))
+    {
+        if (!addChunk(sizeof(Chunk) + offset + alignment + size)) return NULL;
+        ptr = reinterpret_cast<char *>(alignUp(reinterpret_cast<size_t>(_cur) + offset, alignment));
+    }
+    _cur = ptr + size;
+    return ptr;
+}
+
+void * arena_malloc(size_t size, size_t alignment)
+{
+    if (alignment < sizeof(BlockHeader)) alignment = sizeof(BlockHeader);
+    const size_t offset = blockOffset(alignment);
+    ScopedArena * arena = currentArena;
+    char * ptr          = NULL;
+    if (arena)
+    {
+        ptr = static_cast<char *>(arena->allocate(size, alignment));
+    }
+    else
+    {
+        char * block = static_cast<char *>(daal_malloc(size + offset, alignment));
+        ptr          = block ? block + offset : NULL;
+    }
+    if (!ptr) return NULL;
+
+    BlockHeader * header = reinterpret_cast<BlockHeader *>(ptr) - 1;
+    header->offset       = offset;
+    header->fromArena    = arena ? 1 : 0;
+    return ptr;
+}
+
+void arena_free(void * ptr)
+{
+    if (!ptr) return;
+    const BlockHeader * header = static_cast<BlockHeader *>(ptr) - 1;
+    if (!header->fromArena)
+    {
+        daal_free(static_cast<char *>(ptr) - header->offset);
+    }
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
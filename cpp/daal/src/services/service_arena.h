@@ -0,0 +1,72 @@
+/* file: service_arena.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __SERVICE_ARENA_H__
+#define __SERVICE_ARENA_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+/* Bump allocator for the temporaries of one compute call. The arena is
+ * installed as the current arena of the constructing thread and all its
+ * memory is released at once by the destructor. The arenas are nested,
+ * the destructor restores the previously installed one. */
+class ScopedArena
+{
+public:
+    ScopedArena();
+    ~ScopedArena();
+
+    /* Returns the arena installed in the calling thread or NULL */
+    static ScopedArena * current();
+
+    void * allocate(size_t size, size_t alignment);
+
+private:
+    ScopedArena(const ScopedArena &);
+    ScopedArena & operator=(const ScopedArena &);
+
+    struct Chunk;
+
+    bool addChunk(size_t minSize);
+
+    Chunk * _chunks;
+    char * _cur;
+    char * _end;
+    size_t _nextChunkSize;
+    ScopedArena * _prev;
+};
+
+/* Allocates the memory from the current arena of the calling thread or from
+ * the heap if no arena is installed. The memory is freed by arena_free()
+ * which is a no-op for the arena memory, so arena_free() can be called from
+ * any thread, but the arena memory must not be used after the arena is
+ * destroyed. Do not allocate from the arena inside the parallel regions: the
+ * thread may run the stolen tasks of the other compute calls. */
+void * arena_malloc(size_t size, size_t alignment);
+void arena_free(void * ptr);
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
@@ -29,6 +29,31 @@
 
 DAAL_EXPORT int __daal_serv_cpu_detect(int);
 
+/* The bits of __daal_serv_cpu_feature_detect(), the features of the CPU beyond the instruction set of its CPU type */
+#define DAAL_CPU_FEATURE_AVX512_VNNI (1ULL << 0)
+#define DAAL_CPU_FEATURE_AVX512_BF16 (1ULL << 1)
+#define DAAL_CPU_FEATURE_AMX_BF16    (1ULL << 2)
+
+DAAL_EXPORT uint64_t __daal_serv_cpu_feature_detect();
+
+/* Returns the model of the CPU as vendor-family-model, e.g. GenuineIntel-6-106 */
+DAAL_EXPORT const char * __daal_serv_cpu_model();
+
+/* Returns the CPU type of the kernels of the named dispatcher: cpuid lowered by the rules of DAAL_CPU_DISPATCH_OVERRIDE,
+   the choice is written to stderr if DAAL_CPU_DISPATCH_TRACE is set */
+DAAL_EXPORT int __daal_serv_cpu_dispatch(int cpuid, const char * name);
+
+/* Returns true if the partial results of the parallel loops are reduced in the order that does not depend on the
+   number of threads, set by DAAL_DETERMINISTIC=1 or Environment::enableDeterministicMode() */
+DAAL_EXPORT bool __daal_serv_is_deterministic();
+
+/* Registers the factory of the container type built into the library of the kernels of one CPU type */
+DAAL_EXPORT void __daal_serv_isa_container_register(const char * typeName, void * (*factory)(void *));
+
+/* Loads the library of the kernels of the CPU type on the first call and creates the container of the type registered
+   by it, returns nullptr if the library or the type is not found */
+DAAL_EXPORT void * __daal_serv_isa_container_create(int cpuid, const char * typeName, void * env);
+
 bool daal_check_is_intel_cpu();
 
 #define DAAL_CHECK_CPU_ENVIRONMENT (daal_check_is_intel_cpu())
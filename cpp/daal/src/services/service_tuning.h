@@ -0,0 +1,93 @@
+/* file: service_tuning.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Block sizes of the kernels tuned on the CPU model and stored in the
+//  tuning profile.
+//--
+*/
+
+#ifndef __SERVICE_TUNING_H__
+#define __SERVICE_TUNING_H__
+
+#include "services/daal_defines.h"
+#include "src/services/service_defines.h"
+
+/* The number of the dimensions of the data that define the shape class of the tuned block size */
+#define DAAL_TUNING_MAX_SHAPE_SIZE 3
+
+/* Returns the block size of the named kernel of the CPU type and precision (the size of the floating-point type) for
+   the shape of its data: the size of the tuning profile DAAL_TUNING_PROFILE for the CPU model, one of the candidates
+   in [minSize, maxSize] during the tuning run DAAL_TUNING_RUN, otherwise defaultSize. The measurement of the candidate
+   is written to *trial, -1 if it is not measured */
+DAAL_EXPORT size_t __daal_serv_tuned_block_size(int cpuid, const char * kernel, size_t fpSize, const size_t * shape, size_t shapeSize,
+                                                size_t defaultSize, size_t minSize, size_t maxSize, int * trial);
+
+/* Ends the measurement of the candidate block size started by __daal_serv_tuned_block_size */
+DAAL_EXPORT void __daal_serv_tuning_trial_end(int trial);
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+/**
+ *  \brief Block size of the kernel chosen by the tuning profile, the time of the kernel is measured during the tuning
+ *         run from the construction till the destruction of the object
+ */
+template <typename algorithmFPType, CpuType cpu>
+class TunedBlockSize
+{
+public:
+    /**
+     *  \param kernel       Name of the tuned block size, the same for all the CPU types and precisions, e.g. "kmeans::lloydDense"
+     *  \param defaultSize  Block size chosen by the heuristics of the kernel
+     *  \param minSize      The smallest block size accepted by the kernel
+     *  \param maxSize      The largest block size accepted by the kernel
+     *  \param dim0, dim1, dim2  The dimensions of the data, e.g. the number of the rows, the features and the clusters
+     */
+    TunedBlockSize(const char * kernel, const size_t defaultSize, const size_t minSize, const size_t maxSize, const size_t dim0,
+                   const size_t dim1 = 0, const size_t dim2 = 0)
+        : _trial(-1)
+    {
+        const size_t shape[DAAL_TUNING_MAX_SHAPE_SIZE] = { dim0, dim1, dim2 };
+        _size = __daal_serv_tuned_block_size(static_cast<int>(cpu), kernel, sizeof(algorithmFPType), shape, DAAL_TUNING_MAX_SHAPE_SIZE, defaultSize,
+                                             minSize, maxSize, &_trial);
+    }
+
+    ~TunedBlockSize()
+    {
+        if (_trial >= 0) __daal_serv_tuning_trial_end(_trial);
+    }
+
+    size_t get() const { return _size; }
+
+private:
+    TunedBlockSize(const TunedBlockSize &);
+    TunedBlockSize & operator=(const TunedBlockSize &);
+
+    size_t _size;
+    int _trial;
+};
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
@@ -278,4 +278,86 @@ DECLARE_SOURCE(
 
 );
 
+DECLARE_SOURCE(
+    radix_sort_segmented,
+
+    uint __attribute__((overloadable)) invBits(uint x) { return x ^ (-(x >> 31) | 0x80000000u); }
+
+    ulong __attribute__((overloadable)) invBits(ulong x) { return x ^ (-(x >> 63) | 0x8000000000000000ul); }
+
+    // Maps the key to the unsigned integer with the same order, radixKeyKind is
+    // 0 for the floating-point keys, 1 for the signed and 2 for the unsigned ones
+    radixKeyType toOrderedBits(radixKeyType x) {
+        if (radixKeyKind == 0) return invBits(x);
+        if (radixKeyKind == 1) return x ^ ((radixKeyType)1 << (8 * sizeof(radixKeyType) - 1));
+        return x;
+    }
+
+    // Single pass of the stable radix sort for every segment, the segment is
+    // processed by the first sub-group of its work-group
+    __kernel void radixSortSegmentedPass(const __global radixKeyType * keysSrc, const __global radixValueType * valuesSrc,
+                                         const __global int * segmentOffsets, __global radixKeyType * keysDst,
+                                         __global radixValueType * valuesDst, int bitOffset) {
+        const int RADIX_BITS = 4;
+
+        if (get_sub_group_id() > 0) return;
+
+        const int local_size = get_sub_group_size();
+        const int local_id   = get_sub_group_local_id();
+        const int segment_id = get_group_id(0);
+
+        const int iStart = segmentOffsets[segment_id];
+        const int iEnd   = segmentOffsets[segment_id + 1];
+
+        int offset[1 << RADIX_BITS];
+        const int radix_range   = 1 << RADIX_BITS;
+        const int radix_range_1 = radix_range - 1;
+        for (int i = 0; i < radix_range; i++)
+        {
+            offset[i] = 0;
+        }
+
+        // All work-items of the sub-group run the same number of iterations
+        for (int iBase = iStart; iBase < iEnd; iBase += local_size)
+        {
+            const int i                  = iBase + local_id;
+            const bool exists            = i < iEnd;
+            const radixKeyType data_bits = exists ? ((toOrderedBits(keysSrc[i]) >> bitOffset) & radix_range_1) : 0;
+            for (int j = 0; j < radix_range; j++)
+            {
+                offset[j] += sub_group_reduce_add(exists && data_bits == j ? 1 : 0);
+            }
+        }
+
+        int sum = iStart;
+        for (int j = 0; j < radix_range; j++)
+        {
+            const int count = offset[j];
+            offset[j]       = sum;
+            sum += count;
+        }
+
+        for (int iBase = iStart; iBase < iEnd; iBase += local_size)
+        {
+            const int i                   = iBase + local_id;
+            const bool exists             = i < iEnd;
+            const radixKeyType data_value = exists ? keysSrc[i] : 0;
+            const radixKeyType data_bits  = (toOrderedBits(data_value) >> bitOffset) & radix_range_1;
+            int pos_new                   = 0;
+            for (int j = 0; j < radix_range; j++)
+            {
+                const int value = exists && data_bits == j;
+                pos_new |= value * (offset[j] + sub_group_scan_exclusive_add(value));
+                offset[j] += sub_group_reduce_add(value);
+            }
+            if (exists)
+            {
+                keysDst[pos_new]   = data_value;
+                valuesDst[pos_new] = valuesSrc[i];
+            }
+        }
+    }
+
+);
+
 #endif
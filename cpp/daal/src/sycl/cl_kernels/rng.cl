@@ -0,0 +1,111 @@
+/* file: rng.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the kernels of the counter-based random number generator.
+//--
+*/
+
+#ifndef __RNG_CL__
+#define __RNG_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    kernelsRng,
+
+    uint4 philoxRound(const uint4 ctr, const uint2 key) {
+        const uint m0 = 0xD2511F53;
+        const uint m1 = 0xCD9E8D57;
+        return (uint4)(mul_hi(m1, ctr.z) ^ ctr.y ^ key.x, m1 * ctr.z, mul_hi(m0, ctr.x) ^ ctr.w ^ key.y, m0 * ctr.x);
+    }
+
+    /* Philox4x32-10, the 128-bit block of the counter ctr of the stream key */
+    uint4 philox4x32x10(uint4 ctr, uint2 key) {
+        for (int round = 0; round < 10; round++)
+        {
+            ctr = philoxRound(ctr, key);
+            key.x += 0x9E3779B9;
+            key.y += 0xBB67AE85;
+        }
+        return ctr;
+    }
+
+    /* The block of the element i of the stream, the 64-bit counter is offset + i */
+    uint4 blockOf(uint i, uint offsetLo, uint offsetHi, uint keyLo, uint keyHi) {
+        const uint lo = offsetLo + i;
+        const uint hi = offsetHi + (lo < offsetLo ? 1 : 0);
+        return philox4x32x10((uint4)(lo, hi, 0, 0), (uint2)(keyLo, keyHi));
+    }
+
+    /* The number in [0, 1) with all the bits of the mantissa random */
+    algorithmFPType toUnitInterval(uint x, uint y) {
+        if (sizeof(algorithmFPType) == 8)
+        {
+            return ((algorithmFPType)(x >> 5) * (algorithmFPType)67108864.0f + (algorithmFPType)(y >> 6))
+                   * (algorithmFPType)(1.0f / 9007199254740992.0f);
+        }
+        return (algorithmFPType)(x >> 8) * (algorithmFPType)(1.0f / 16777216.0f);
+    }
+
+    __kernel void uniform(__global algorithmFPType * dst, uint n, algorithmFPType a, algorithmFPType b, uint keyLo, uint keyHi, uint offsetLo,
+                          uint offsetHi) {
+        const uint i = get_global_id(0);
+        if (i < n)
+        {
+            const uint4 r = blockOf(i, offsetLo, offsetHi, keyLo, keyHi);
+            dst[i]        = a + (b - a) * toUnitInterval(r.x, r.y);
+        }
+    }
+
+    /* The high half of the product maps the 32 random bits to [0, b - a) */
+    __kernel void uniformInt(__global int * dst, uint n, int a, int b, uint keyLo, uint keyHi, uint offsetLo, uint offsetHi) {
+        const uint i = get_global_id(0);
+        if (i < n)
+        {
+            const uint4 r = blockOf(i, offsetLo, offsetHi, keyLo, keyHi);
+            dst[i]        = a + (int)mul_hi(r.x, (uint)(b - a));
+        }
+    }
+
+    /* Box-Muller transform of the two uniform numbers of the block */
+    __kernel void normal(__global algorithmFPType * dst, uint n, algorithmFPType mean, algorithmFPType sigma, uint keyLo, uint keyHi, uint offsetLo,
+                         uint offsetHi) {
+        const uint i = get_global_id(0);
+        if (i < n)
+        {
+            const uint4 r              = blockOf(i, offsetLo, offsetHi, keyLo, keyHi);
+            const algorithmFPType u1   = (algorithmFPType)1 - toUnitInterval(r.x, r.y);
+            const algorithmFPType u2   = toUnitInterval(r.z, r.w);
+            const algorithmFPType twoPi = (algorithmFPType)6.283185307179586f;
+            dst[i]                     = mean + sigma * sqrt((algorithmFPType)(-2) * log(u1)) * cos(twoPi * u2);
+        }
+    }
+
+    __kernel void bernoulli(__global int * dst, uint n, algorithmFPType p, uint keyLo, uint keyHi, uint offsetLo, uint offsetHi) {
+        const uint i = get_global_id(0);
+        if (i < n)
+        {
+            const uint4 r = blockOf(i, offsetLo, offsetHi, keyLo, keyHi);
+            dst[i]        = toUnitInterval(r.x, r.y) < p ? 1 : 0;
+        }
+    }
+
+);
+
+#endif
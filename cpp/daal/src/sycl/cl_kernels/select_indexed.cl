@@ -238,4 +238,113 @@ DECLARE_SOURCE(
         }
     });
 
+DECLARE_SOURCE(
+    radix_select_simd,
+
+    uint __attribute__((overloadable)) invBits(uint x) { return x ^ (-(x >> 31) | 0x80000000u); }
+
+    ulong __attribute__((overloadable)) invBits(ulong x) { return x ^ (-(x >> 63) | 0x8000000000000000ul); }
+
+    // Selects K smallest values of every row, the row is processed by the
+    // work-group. The bits of the K-th smallest value are found digit by digit
+    // from the most significant one with the histogram in the local memory,
+    // then the values below it and the required number of equal ones are written.
+    __kernel void radix_select_group(__global const algorithmFPType * values_in, __global algorithmFPType * values_out, __global int * indices_out,
+                                     int N, int NLast, int K, int BlockOffset, algorithmFPType FPMax) {
+        const int RADIX_BITS = 8;
+
+        __local int histogram[1 << RADIX_BITS];
+        __local radixIntType shared_prefix;
+        __local int shared_remaining;
+        __local int counters[2];
+
+        const int radix_range   = 1 << RADIX_BITS;
+        const int radix_range_1 = radix_range - 1;
+
+        const int row_id     = get_group_id(0);
+        const int local_id   = get_local_id(0);
+        const int local_size = get_local_size(0);
+
+        const int n            = (row_id == get_num_groups(0) - 1) ? NLast : N;
+        const int select_count = K < n ? K : n;
+
+        const __global algorithmFPType * values = &values_in[row_id * BlockOffset];
+        const __global radixIntType * bits_in   = (const __global radixIntType *)values;
+
+        radixIntType prefix      = 0;
+        radixIntType prefix_mask = 0;
+        int remaining            = select_count;
+
+        for (int bit_offset = 8 * sizeof(radixIntType) - RADIX_BITS; bit_offset >= 0; bit_offset -= RADIX_BITS)
+        {
+            for (int j = local_id; j < radix_range; j += local_size)
+            {
+                histogram[j] = 0;
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+
+            for (int i = local_id; i < n; i += local_size)
+            {
+                const radixIntType bits = invBits(bits_in[i]);
+                if ((bits & prefix_mask) == prefix)
+                {
+                    atomic_inc(&histogram[(bits >> bit_offset) & radix_range_1]);
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+
+            if (local_id == 0)
+            {
+                int digit = 0;
+                for (; digit < radix_range_1 && histogram[digit] < remaining; digit++)
+                {
+                    remaining -= histogram[digit];
+                }
+                shared_prefix    = prefix | ((radixIntType)digit << bit_offset);
+                shared_remaining = remaining;
+                counters[0]      = 0;
+                counters[1]      = 0;
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+
+            prefix    = shared_prefix;
+            remaining = shared_remaining;
+            prefix_mask |= (radixIntType)radix_range_1 << bit_offset;
+        }
+
+        // All values below the threshold are selected, the rest are equal to it
+        const int less_count = select_count - remaining;
+
+        __global algorithmFPType * row_values_out = &values_out[row_id * K];
+        __global int * row_indices_out            = &indices_out[row_id * K];
+
+        for (int i = local_id; i < n; i += local_size)
+        {
+            const radixIntType bits = invBits(bits_in[i]);
+            int pos                 = -1;
+            if (bits < prefix)
+            {
+                pos = atomic_inc(&counters[0]);
+            }
+            else if (bits == prefix)
+            {
+                const int slot = atomic_inc(&counters[1]);
+                pos            = slot < remaining ? less_count + slot : -1;
+            }
+            if (pos >= 0)
+            {
+                row_values_out[pos]  = values[i];
+                row_indices_out[pos] = i;
+            }
+        }
+
+        for (int i = select_count + local_id; i < K; i += local_size)
+        {
+            row_values_out[i]  = FPMax;
+            row_indices_out[i] = -1;
+        }
+    }
+
+);
+
 #endif
@@ -0,0 +1,188 @@
+/* file: statistics_reducer.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the fused reduction kernels computing several
+//  statistics of the vectors in a single pass.
+//--
+*/
+
+#ifndef __STATISTICS_REDUCER_CL__
+#define __STATISTICS_REDUCER_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    statistics_reducer,
+
+    // The NaN values are treated as missing and skipped by all statistics
+    void accumulate(const algorithmFPType el, algorithmFPType * minimum, algorithmFPType * maximum, algorithmFPType * sum,
+                    algorithmFPType * sumOfSquares, int * count) {
+        if (!isnan(el))
+        {
+            *minimum = fmin(*minimum, el);
+            *maximum = fmax(*maximum, el);
+            *sum += el;
+            *sumOfSquares += el * el;
+            *count += 1;
+        }
+    }
+
+    __kernel void statisticsSinglepass(uint vectorsAreRows, __global const algorithmFPType * vectors, uint nVectors, uint vectorSize,
+                                       __global algorithmFPType * minimums, __global algorithmFPType * maximums, __global algorithmFPType * sums,
+                                       __global algorithmFPType * sumsOfSquares, __global int * counts) {
+        const uint local_size = get_local_size(0);
+
+        __local algorithmFPType partialMinimums[LOCAL_BUFFER_SIZE];
+        __local algorithmFPType partialMaximums[LOCAL_BUFFER_SIZE];
+        __local algorithmFPType partialSums[LOCAL_BUFFER_SIZE];
+        __local algorithmFPType partialSumsOfSquares[LOCAL_BUFFER_SIZE];
+        __local int partialCounts[LOCAL_BUFFER_SIZE];
+
+        uint globalDim = 1;
+        uint localDim  = nVectors;
+
+        if (vectorsAreRows != 0)
+        {
+            globalDim = vectorSize;
+            localDim  = 1;
+        }
+
+        const uint itemId  = get_local_id(0);
+        const uint groupId = get_global_id(1);
+
+        algorithmFPType minimum      = INFINITY;
+        algorithmFPType maximum      = -INFINITY;
+        algorithmFPType sum          = 0;
+        algorithmFPType sumOfSquares = 0;
+        int count                    = 0;
+
+        for (uint i = itemId; i < vectorSize; i += local_size)
+        {
+            accumulate(vectors[groupId * globalDim + i * localDim], &minimum, &maximum, &sum, &sumOfSquares, &count);
+        }
+
+        partialMinimums[itemId]      = minimum;
+        partialMaximums[itemId]      = maximum;
+        partialSums[itemId]          = sum;
+        partialSumsOfSquares[itemId] = sumOfSquares;
+        partialCounts[itemId]        = count;
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint stride = local_size / 2; stride > 0; stride /= 2)
+        {
+            if (stride > itemId)
+            {
+                partialMinimums[itemId] = fmin(partialMinimums[itemId], partialMinimums[itemId + stride]);
+                partialMaximums[itemId] = fmax(partialMaximums[itemId], partialMaximums[itemId + stride]);
+                partialSums[itemId] += partialSums[itemId + stride];
+                partialSumsOfSquares[itemId] += partialSumsOfSquares[itemId + stride];
+                partialCounts[itemId] += partialCounts[itemId + stride];
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+
+        if (itemId == 0)
+        {
+            minimums[groupId]      = partialMinimums[0];
+            maximums[groupId]      = partialMaximums[0];
+            sums[groupId]          = partialSums[0];
+            sumsOfSquares[groupId] = partialSumsOfSquares[0];
+            counts[groupId]        = partialCounts[0];
+        }
+    }
+
+    __kernel void statisticsStepColmajor(__global const algorithmFPType * vectors, const uint nVectors, const uint vectorSize,
+                                         __global algorithmFPType * minimums, __global algorithmFPType * maximums, __global algorithmFPType * sums,
+                                         __global algorithmFPType * sumsOfSquares, __global int * counts) {
+        const int tid  = get_local_id(0);
+        const int tnum = get_local_size(0);
+        const int gid  = get_group_id(0);
+        const int gnum = get_num_groups(0);
+
+        const int colParts = (nVectors + tnum - 1) / tnum;
+        const int rowParts = gnum / colParts;
+
+        const int rowPartIndex = gid / colParts;
+        const int colPartIndex = gid - rowPartIndex * colParts;
+
+        const int x = tid + colPartIndex * tnum;
+        if (x >= nVectors)
+        {
+            return;
+        }
+
+        int rowPartSize     = (vectorSize + rowParts - 1) / rowParts;
+        const int rowOffset = rowPartSize * rowPartIndex;
+        if (rowPartSize + rowOffset > vectorSize)
+        {
+            rowPartSize = vectorSize - rowOffset;
+        }
+
+        algorithmFPType minimum      = INFINITY;
+        algorithmFPType maximum      = -INFINITY;
+        algorithmFPType sum          = 0;
+        algorithmFPType sumOfSquares = 0;
+        int count                    = 0;
+
+        for (int row = 0; row < rowPartSize; row++)
+        {
+            accumulate(vectors[(row + rowOffset) * nVectors + x], &minimum, &maximum, &sum, &sumOfSquares, &count);
+        }
+
+        const int pos      = x * rowParts + rowPartIndex;
+        minimums[pos]      = minimum;
+        maximums[pos]      = maximum;
+        sums[pos]          = sum;
+        sumsOfSquares[pos] = sumOfSquares;
+        counts[pos]        = count;
+    }
+
+    __kernel void statisticsFinalStep(__global const algorithmFPType * partialMinimums, __global const algorithmFPType * partialMaximums,
+                                      __global const algorithmFPType * partialSums, __global const algorithmFPType * partialSumsOfSquares,
+                                      __global const int * partialCounts, uint nParts, __global algorithmFPType * minimums,
+                                      __global algorithmFPType * maximums, __global algorithmFPType * sums, __global algorithmFPType * sumsOfSquares,
+                                      __global int * counts) {
+        const uint x = get_global_id(0);
+
+        algorithmFPType minimum      = INFINITY;
+        algorithmFPType maximum      = -INFINITY;
+        algorithmFPType sum          = 0;
+        algorithmFPType sumOfSquares = 0;
+        int count                    = 0;
+
+        for (uint i = x * nParts; i < (x + 1) * nParts; i++)
+        {
+            minimum = fmin(minimum, partialMinimums[i]);
+            maximum = fmax(maximum, partialMaximums[i]);
+            sum += partialSums[i];
+            sumOfSquares += partialSumsOfSquares[i];
+            count += partialCounts[i];
+        }
+
+        minimums[x]      = minimum;
+        maximums[x]      = maximum;
+        sums[x]          = sum;
+        sumsOfSquares[x] = sumOfSquares;
+        counts[x]        = count;
+    }
+
+);
+
+#endif
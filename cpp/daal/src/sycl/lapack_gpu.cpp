@@ -17,6 +17,7 @@
 
 #include "services/internal/sycl/math/reference_lapack.h"
 #include "src/externals/service_lapack.h"
+#include "src/services/service_arrays.h"
 #include "services/error_handling.h"
 #include "src/sycl/blas_gpu.h"
 #include "src/sycl/cl_kernels/kernel_blas.cl"
@@ -81,12 +82,90 @@ services::Status ReferencePotrs<algorithmFPType>::operator()(const math::UpLo up
     return status;
 }
 
+template <typename algorithmFPType>
+services::Status ReferenceGerqf<algorithmFPType>::operator()(const size_t m, const size_t n, services::internal::Buffer<algorithmFPType> & a_buffer,
+                                                             const size_t lda, services::internal::Buffer<algorithmFPType> & tau_buffer)
+{
+    services::Status status;
+
+    DAAL_INT info;
+
+    DAAL_INT mInt   = static_cast<DAAL_INT>(m);
+    DAAL_INT nInt   = static_cast<DAAL_INT>(n);
+    DAAL_INT ldaInt = static_cast<DAAL_INT>(lda);
+
+    services::SharedPtr<algorithmFPType> aPtr   = a_buffer.toHost(data_management::ReadWriteMode::readWrite);
+    services::SharedPtr<algorithmFPType> tauPtr = tau_buffer.toHost(data_management::ReadWriteMode::writeOnly);
+    DAAL_CHECK_MALLOC(aPtr.get() && tauPtr.get());
+
+    algorithmFPType workQuery;
+    DAAL_INT lwork = -1;
+    LapackAutoDispatch<algorithmFPType>::xgerqf(&mInt, &nInt, aPtr.get(), &ldaInt, tauPtr.get(), &workQuery, &lwork, &info);
+    DAAL_CHECK(info == 0, services::ErrorID::ErrorLinearRegressionInternal);
+
+    lwork = static_cast<DAAL_INT>(workQuery);
+    services::internal::TArray<algorithmFPType, sse2> work(lwork);
+    DAAL_CHECK_MALLOC(work.get());
+
+    LapackAutoDispatch<algorithmFPType>::xgerqf(&mInt, &nInt, aPtr.get(), &ldaInt, tauPtr.get(), work.get(), &lwork, &info);
+
+    DAAL_CHECK(info == 0, services::ErrorID::ErrorLinearRegressionInternal);
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status ReferenceOrmrq<algorithmFPType>::operator()(const math::Side side, const math::Transpose trans, const size_t m, const size_t n,
+                                                             const size_t k, services::internal::Buffer<algorithmFPType> & a_buffer,
+                                                             const size_t lda, services::internal::Buffer<algorithmFPType> & tau_buffer,
+                                                             services::internal::Buffer<algorithmFPType> & c_buffer, const size_t ldc)
+{
+    services::Status status;
+
+    char sideChar  = side == math::Side::Left ? 'L' : 'R';
+    char transChar = trans == math::Transpose::Trans ? 'T' : 'N';
+
+    DAAL_INT info;
+
+    DAAL_INT mInt   = static_cast<DAAL_INT>(m);
+    DAAL_INT nInt   = static_cast<DAAL_INT>(n);
+    DAAL_INT kInt   = static_cast<DAAL_INT>(k);
+    DAAL_INT ldaInt = static_cast<DAAL_INT>(lda);
+    DAAL_INT ldcInt = static_cast<DAAL_INT>(ldc);
+
+    services::SharedPtr<algorithmFPType> aPtr   = a_buffer.toHost(data_management::ReadWriteMode::readOnly);
+    services::SharedPtr<algorithmFPType> tauPtr = tau_buffer.toHost(data_management::ReadWriteMode::readOnly);
+    services::SharedPtr<algorithmFPType> cPtr   = c_buffer.toHost(data_management::ReadWriteMode::readWrite);
+    DAAL_CHECK_MALLOC(aPtr.get() && tauPtr.get() && cPtr.get());
+
+    algorithmFPType workQuery;
+    DAAL_INT lwork = -1;
+    LapackAutoDispatch<algorithmFPType>::xormrq(&sideChar, &transChar, &mInt, &nInt, &kInt, aPtr.get(), &ldaInt, tauPtr.get(), cPtr.get(), &ldcInt,
+                                                &workQuery, &lwork, &info);
+    DAAL_CHECK(info == 0, services::ErrorID::ErrorLinearRegressionInternal);
+
+    lwork = static_cast<DAAL_INT>(workQuery);
+    services::internal::TArray<algorithmFPType, sse2> work(lwork);
+    DAAL_CHECK_MALLOC(work.get());
+
+    LapackAutoDispatch<algorithmFPType>::xormrq(&sideChar, &transChar, &mInt, &nInt, &kInt, aPtr.get(), &ldaInt, tauPtr.get(), cPtr.get(), &ldcInt,
+                                                work.get(), &lwork, &info);
+
+    DAAL_CHECK(info == 0, services::ErrorID::ErrorLinearRegressionInternal);
+    return status;
+}
+
 template class ReferencePotrf<float>;
 template class ReferencePotrf<double>;
 
 template class ReferencePotrs<float>;
 template class ReferencePotrs<double>;
 
+template class ReferenceGerqf<float>;
+template class ReferenceGerqf<double>;
+
+template class ReferenceOrmrq<float>;
+template class ReferenceOrmrq<double>;
+
 } // namespace interface1
 } // namespace math
 } // namespace sycl
@@ -64,6 +64,30 @@ struct LapackGpu
 
         return status;
     }
+
+    static services::Status xgerqf(const uint32_t m, const uint32_t n, UniversalBuffer a_buffer, const uint32_t lda, UniversalBuffer tau_buffer)
+    {
+        services::Status status;
+
+        ExecutionContextIface & ctx = services::internal::getDefaultContext();
+
+        ctx.gerqf(m, n, a_buffer, lda, tau_buffer, &status);
+
+        return status;
+    }
+
+    static services::Status xormrq(const math::Side side, const math::Transpose trans, const uint32_t m, const uint32_t n, const uint32_t k,
+                                   UniversalBuffer a_buffer, const uint32_t lda, UniversalBuffer tau_buffer, UniversalBuffer c_buffer,
+                                   const uint32_t ldc)
+    {
+        services::Status status;
+
+        ExecutionContextIface & ctx = services::internal::getDefaultContext();
+
+        ctx.ormrq(side, trans, m, n, k, a_buffer, lda, tau_buffer, c_buffer, ldc, &status);
+
+        return status;
+    }
 };
 
 } // namespace sycl
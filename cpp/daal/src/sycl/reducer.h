@@ -53,6 +53,36 @@ public:
     static Result sum(Layout vectorsLayout, const UniversalBuffer & vectors, uint32_t nVectors, uint32_t vectorSize, services::Status * status);
 };
 
+/// Computes the minimum, maximum, sum, sum of squares and the number of values
+/// of every vector in a single pass over the data. The NaN values are treated
+/// as missing and skipped, the minimum and maximum of the vector without values
+/// are +inf and -inf respectively.
+class StatisticsReducer
+{
+public:
+    StatisticsReducer() = delete;
+
+    struct Result
+    {
+        UniversalBuffer min;
+        UniversalBuffer max;
+        UniversalBuffer sum;
+        UniversalBuffer sumOfSquares;
+        UniversalBuffer count;
+
+        Result(ExecutionContextIface & context, uint32_t nVectors, TypeId type, services::Status * status)
+            : min(context.allocate(type, nVectors, status)),
+              max(context.allocate(type, nVectors, status)),
+              sum(context.allocate(type, nVectors, status)),
+              sumOfSquares(context.allocate(type, nVectors, status)),
+              count(context.allocate(TypeIds::id<int>(), nVectors, status))
+        {}
+    };
+
+public:
+    static Result reduce(Layout vectorsLayout, const UniversalBuffer & vectors, uint32_t nVectors, uint32_t vectorSize, services::Status * status);
+};
+
 class Reducer
 {
 public:
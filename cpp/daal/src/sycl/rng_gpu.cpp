@@ -0,0 +1,124 @@
+/* file: rng_gpu.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "src/sycl/rng_gpu.h"
+#include "services/internal/execution_context.h"
+#include "src/externals/service_ittnotify.h"
+#include "src/sycl/cl_kernels/rng.cl"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace sycl
+{
+DAAL_ITTNOTIFY_DOMAIN(daal.oneapi.internal.rng);
+
+services::Status RngGpu::buildProgram(ClKernelFactoryIface & factory, const TypeId & typeId)
+{
+    services::String fptype_name = getKeyFPType(typeId);
+    auto build_options           = fptype_name;
+    services::String cachekey("__daal_oneapi_internal_rng_");
+    cachekey.add(build_options);
+
+    services::Status status;
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), kernelsRng, build_options.c_str(), &status);
+    return status;
+}
+
+/// The kernels take one or two parameters of the distribution followed by
+/// the key and the offset split into the 32-bit halves
+template <typename T>
+services::Status RngGpu::run(const char * kernelName, const TypeId & programTypeId, UniversalBuffer & dst, const size_t n, const T first,
+                             const T second, const size_t nParams, const DAAL_UINT64 key, const DAAL_UINT64 offset)
+{
+    services::Status status;
+    DAAL_CHECK(n <= static_cast<size_t>(UINT32_MAX), services::ErrorBufferSizeIntegerOverflow);
+    if (n == 0) return status;
+
+    auto & context = services::internal::getDefaultContext();
+    auto & factory = context.getClKernelFactory();
+    DAAL_CHECK_STATUS(status, buildProgram(factory, programTypeId));
+
+    auto kernel = factory.getKernel(kernelName, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(6 + nParams);
+    size_t argIndex = 0;
+    args.set(argIndex++, dst, AccessModeIds::write);
+    args.set(argIndex++, static_cast<uint32_t>(n));
+    args.set(argIndex++, first);
+    if (nParams > 1)
+    {
+        args.set(argIndex++, second);
+    }
+    args.set(argIndex++, static_cast<uint32_t>(key));
+    args.set(argIndex++, static_cast<uint32_t>(key >> 32));
+    args.set(argIndex++, static_cast<uint32_t>(offset));
+    args.set(argIndex++, static_cast<uint32_t>(offset >> 32));
+
+    KernelRange range(n);
+    context.run(range, kernel, args, &status);
+    return status;
+}
+
+services::Status RngGpu::uniform(UniversalBuffer & dst, const size_t n, const double a, const double b, const DAAL_UINT64 key,
+                                 const DAAL_UINT64 offset)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(rng.uniform);
+
+    if (dst.type() == TypeIds::int32)
+    {
+        return run<int32_t>("uniformInt", TypeIds::id<float>(), dst, n, static_cast<int32_t>(a), static_cast<int32_t>(b), 2, key, offset);
+    }
+    if (dst.type() == TypeIds::float32)
+    {
+        return run<float>("uniform", TypeIds::id<float>(), dst, n, static_cast<float>(a), static_cast<float>(b), 2, key, offset);
+    }
+    DAAL_CHECK(dst.type() == TypeIds::float64, services::ErrorDataTypeNotSupported);
+    return run<double>("uniform", TypeIds::id<double>(), dst, n, a, b, 2, key, offset);
+}
+
+services::Status RngGpu::normal(UniversalBuffer & dst, const size_t n, const double mean, const double sigma, const DAAL_UINT64 key,
+                                const DAAL_UINT64 offset)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(rng.normal);
+
+    if (dst.type() == TypeIds::float32)
+    {
+        return run<float>("normal", TypeIds::id<float>(), dst, n, static_cast<float>(mean), static_cast<float>(sigma), 2, key, offset);
+    }
+    DAAL_CHECK(dst.type() == TypeIds::float64, services::ErrorDataTypeNotSupported);
+    return run<double>("normal", TypeIds::id<double>(), dst, n, mean, sigma, 2, key, offset);
+}
+
+/// The probability is compared with the float uniform numbers, so the
+/// program does not need the double support of the device
+services::Status RngGpu::bernoulli(UniversalBuffer & dst, const size_t n, const double p, const DAAL_UINT64 key, const DAAL_UINT64 offset)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(rng.bernoulli);
+
+    DAAL_CHECK(dst.type() == TypeIds::int32, services::ErrorDataTypeNotSupported);
+    return run<float>("bernoulli", TypeIds::id<float>(), dst, n, static_cast<float>(p), 0.0f, 1, key, offset);
+}
+
+} // namespace sycl
+} // namespace internal
+} // namespace services
+} // namespace daal
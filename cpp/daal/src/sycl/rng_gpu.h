@@ -0,0 +1,67 @@
+/* file: rng_gpu.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __RNG_GPU_H__
+#define __RNG_GPU_H__
+
+#include "services/internal/buffer.h"
+#include "services/internal/sycl/types_utils.h"
+#include "services/internal/sycl/execution_context.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace sycl
+{
+/// Generates the random numbers on the device with the counter-based
+/// Philox4x32-10 engine. The element i of the stream of the key is a function
+/// of the key and the counter offset + i only, so the numbers are the same for
+/// any device and launch configuration, and a stream generated in several
+/// calls with the consecutive offsets is the same as the stream of one call.
+class RngGpu
+{
+public:
+    RngGpu() = delete;
+
+    /// Fills the float, double or int32 buffer with the uniform numbers in [a, b)
+    static services::Status uniform(UniversalBuffer & dst, const size_t n, const double a, const double b, const DAAL_UINT64 key,
+                                    const DAAL_UINT64 offset = 0);
+
+    /// Fills the float or double buffer with the normal numbers of the mean and sigma
+    static services::Status normal(UniversalBuffer & dst, const size_t n, const double mean, const double sigma, const DAAL_UINT64 key,
+                                   const DAAL_UINT64 offset = 0);
+
+    /// Fills the int32 buffer with 1 of the probability p and 0 otherwise
+    static services::Status bernoulli(UniversalBuffer & dst, const size_t n, const double p, const DAAL_UINT64 key, const DAAL_UINT64 offset = 0);
+
+private:
+    static services::Status buildProgram(ClKernelFactoryIface & factory, const TypeId & typeId);
+
+    template <typename T>
+    static services::Status run(const char * kernelName, const TypeId & programTypeId, UniversalBuffer & dst, const size_t n, const T first,
+                                const T second, const size_t nParams, const DAAL_UINT64 key, const DAAL_UINT64 offset);
+};
+
+} // namespace sycl
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
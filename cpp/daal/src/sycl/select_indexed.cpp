@@ -108,6 +108,42 @@ void run_direct_select_simd(ExecutionContextIface & context, ClKernelFactoryIfac
     context.run(range, func_kernel, args, status);
 }
 
+void run_radix_select_simd(ExecutionContextIface & context, ClKernelFactoryIface & kernelFactory, const UniversalBuffer & dataVectors, uint32_t nK,
+                           uint32_t nVectors, uint32_t vectorSize, uint32_t lastVectorSize, uint32_t vectorOffset, uint32_t workGroupSize,
+                           QuickSelectIndexed::Result & result, services::Status * status)
+{
+    auto func_kernel = kernelFactory.getKernel("radix_select_group", status);
+    DAAL_CHECK_STATUS_PTR(status);
+
+    KernelRange localRange(workGroupSize);
+    KernelRange globalRange(nVectors * workGroupSize);
+
+    KernelNDRange range(1);
+    range.global(globalRange, status);
+    DAAL_CHECK_STATUS_PTR(status);
+    range.local(localRange, status);
+    DAAL_CHECK_STATUS_PTR(status);
+
+    KernelArguments args(8);
+    args.set(0, dataVectors, AccessModeIds::read);
+    args.set(1, result.values, AccessModeIds::write);
+    args.set(2, result.indices, AccessModeIds::write);
+    args.set(3, vectorSize);
+    args.set(4, lastVectorSize);
+    args.set(5, nK);
+    args.set(6, vectorOffset);
+    if (dataVectors.type() == TypeIds::float32)
+    {
+        args.set(7, FLT_MAX);
+    }
+    else
+    {
+        args.set(7, DBL_MAX);
+    }
+
+    context.run(range, func_kernel, args, status);
+}
+
 void SelectIndexed::convertIndicesToLabels(const UniversalBuffer & indices, const UniversalBuffer & labels, uint32_t nVectors, uint32_t vectorSize,
                                            uint32_t vectorOffset, services::Status * status)
 {
@@ -276,9 +312,55 @@ SelectIndexed * DirectSelectIndexed::create(Params & par, daal::services::Status
     return ret;
 }
 
+void RadixSelectIndexed::buildProgram(ClKernelFactoryIface & kernelFactory, const TypeId & vectorTypeId, services::Status * status)
+{
+    services::String fptype_name = getKeyFPType(vectorTypeId);
+    auto build_options           = fptype_name;
+    build_options.add(vectorTypeId == TypeIds::float32 ? " -D radixIntType=uint " : " -D radixIntType=ulong ");
+    build_options.add("-cl-std=CL1.2 ");
+
+    services::String cachekey("__daal_oneapi_internal_rselect_indexed_");
+    cachekey.add(fptype_name);
+    kernelFactory.build(ExecutionTargetIds::device, cachekey.c_str(), radix_select_simd, build_options.c_str(), status);
+}
+
+SelectIndexed::Result & RadixSelectIndexed::selectIndices(const UniversalBuffer & dataVectors, uint32_t nK, uint32_t nVectors, uint32_t vectorSize,
+                                                          uint32_t lastVectorSize, uint32_t vectorOffset, Result & result, services::Status * status)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(RadixSelectIndexed.select);
+
+    if (nVectors > UINT_MAX / _workGroupSize)
+    {
+        services::internal::tryAssignStatus(status, services::Status(services::ErrorBufferSizeIntegerOverflow));
+        return result;
+    }
+
+    auto & context       = services::internal::getDefaultContext();
+    auto & kernelFactory = context.getClKernelFactory();
+
+    buildProgram(kernelFactory, dataVectors.type(), status);
+    DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, result);
+
+    run_radix_select_simd(context, kernelFactory, dataVectors, nK, nVectors, vectorSize, lastVectorSize, vectorOffset, _workGroupSize, result,
+                          status);
+    return result;
+}
+
+SelectIndexed * RadixSelectIndexed::create(Params & par, daal::services::Status * st)
+{
+    RadixSelectIndexed * ret = new RadixSelectIndexed();
+    if (!ret && st)
+    {
+        *st = daal::services::Status(ErrorMemoryAllocationFailed);
+        return nullptr;
+    }
+    return ret;
+}
+
 SelectIndexedFactory::SelectIndexedFactory()
 {
     _entries << makeEntry<DirectSelectIndexed>();
+    _entries << makeEntry<RadixSelectIndexed>();
     _entries << makeEntry<QuickSelectIndexed>();
 }
 
@@ -136,6 +136,26 @@ private:
     uint32_t _nRndSeq = 0;
 };
 
+/// Radix selection for the large K, every row is processed by the work-group
+/// with the histogram of the digits in the local memory, so all rows of the
+/// block are selected in a single launch whatever K is
+class RadixSelectIndexed : public SelectIndexed
+{
+public:
+    static const int minK = 33;
+    static const int maxK = 4096;
+    static SelectIndexed * create(Params & par, daal::services::Status * st);
+    virtual Result & selectIndices(const UniversalBuffer & dataVectors, uint32_t nK, uint32_t nVectors, uint32_t vectorSize, uint32_t lastVectorSize,
+                                   uint32_t vectorOffset, Result & result, services::Status * status);
+
+private:
+    static void buildProgram(ClKernelFactoryIface & kernelFactory, const TypeId & vectorTypeId, services::Status * status);
+
+private:
+    RadixSelectIndexed() {}
+    static const uint32_t _workGroupSize = 256;
+};
+
 class DirectSelectIndexed : public SelectIndexed
 {
 public:
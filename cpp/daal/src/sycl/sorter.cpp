@@ -252,6 +252,130 @@ services::Status RadixSort::radixReorder(UniversalBuffer & valuesSrc, UniversalB
     return status;
 }
 
+namespace
+{
+bool getSegmentedRadixType(const TypeId & typeId, services::String & typeName, size_t & typeSize)
+{
+    switch (typeId)
+    {
+    case TypeIds::Id::int32:
+    case TypeIds::Id::uint32:
+    case TypeIds::Id::float32:
+        typeName = "uint";
+        typeSize = 4;
+        return true;
+    case TypeIds::Id::int64:
+    case TypeIds::Id::uint64:
+    case TypeIds::Id::float64:
+        typeName = "ulong";
+        typeSize = 8;
+        return true;
+    default: return false;
+    }
+}
+
+// The kernel maps the keys to the unsigned integers with the same order
+const char * getSegmentedRadixKeyKind(const TypeId & typeId)
+{
+    switch (typeId)
+    {
+    case TypeIds::Id::float32:
+    case TypeIds::Id::float64: return " -D radixKeyKind=0 ";
+    case TypeIds::Id::int32:
+    case TypeIds::Id::int64: return " -D radixKeyKind=1 ";
+    default: return " -D radixKeyKind=2 ";
+    }
+}
+
+services::Status buildSegmentedProgram(ClKernelFactoryIface & kernelFactory, const TypeId & keyTypeId, const TypeId & valueTypeId)
+{
+    services::String keyTypeName, valueTypeName;
+    size_t keySize = 0, valueSize = 0;
+    if (!getSegmentedRadixType(keyTypeId, keyTypeName, keySize) || !getSegmentedRadixType(valueTypeId, valueTypeName, valueSize))
+    {
+        return services::Status(services::ErrorDataTypeNotSupported);
+    }
+
+    services::String build_options = " -cl-std=CL1.2 -D radixKeyType=";
+    build_options.add(keyTypeName);
+    build_options.add(" -D radixValueType=");
+    build_options.add(valueTypeName);
+    build_options.add(getSegmentedRadixKeyKind(keyTypeId));
+
+    services::String cachekey("__daal_oneapi_internal_sort_radix_sort_segmented__");
+    cachekey.add(build_options);
+
+    services::Status status;
+    kernelFactory.build(ExecutionTargetIds::device, cachekey.c_str(), radix_sort_segmented, build_options.c_str(), &status);
+    return status;
+}
+
+} // namespace
+
+services::Status RadixSort::sortSegments(UniversalBuffer & keys, UniversalBuffer & values, UniversalBuffer & keysBuffer,
+                                         UniversalBuffer & valuesBuffer, const UniversalBuffer & segmentOffsets, uint32_t nSegments)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(RadixSort.sortSegments);
+
+    services::String keyTypeName;
+    size_t keySize = 0;
+    if (!getSegmentedRadixType(keys.type(), keyTypeName, keySize))
+    {
+        return services::Status(services::ErrorDataTypeNotSupported);
+    }
+    if (nSegments == 0)
+    {
+        return services::Status();
+    }
+
+    // The number of passes is even, so the result ends up in the source buffers
+    for (int bitOffset = 0; bitOffset < int(8 * keySize); bitOffset += 2 * _radixBits)
+    {
+        DAAL_CHECK_STATUS_VAR(radixSortSegmentedPass(keys, values, segmentOffsets, keysBuffer, valuesBuffer, nSegments, bitOffset));
+        DAAL_CHECK_STATUS_VAR(radixSortSegmentedPass(keysBuffer, valuesBuffer, segmentOffsets, keys, values, nSegments, bitOffset + _radixBits));
+    }
+    return services::Status();
+}
+
+services::Status RadixSort::radixSortSegmentedPass(UniversalBuffer & keysSrc, UniversalBuffer & valuesSrc, const UniversalBuffer & segmentOffsets,
+                                                   UniversalBuffer & keysDst, UniversalBuffer & valuesDst, uint32_t nSegments, int bitOffset)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(RadixSort.radixSortSegmentedPass);
+
+    services::Status status;
+
+    auto & context = services::internal::getDefaultContext();
+    auto & factory = context.getClKernelFactory();
+
+    DAAL_CHECK_STATUS_VAR(buildSegmentedProgram(factory, keysSrc.type(), valuesSrc.type()));
+    auto kernel = factory.getKernel("radixSortSegmentedPass", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    {
+        KernelArguments args(6);
+        args.set(0, keysSrc, AccessModeIds::read);
+        args.set(1, valuesSrc, AccessModeIds::read);
+        args.set(2, segmentOffsets, AccessModeIds::read);
+        args.set(3, keysDst, AccessModeIds::write);
+        args.set(4, valuesDst, AccessModeIds::write);
+        args.set(5, bitOffset);
+
+        KernelRange local_range(_preferableSubGroup);
+        KernelRange global_range(_preferableSubGroup * nSegments);
+
+        KernelNDRange range(1);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
 } // namespace sort
 } // namespace sycl
 } // namespace internal
@@ -55,7 +55,20 @@ public:
                                          UniversalBuffer & valuesDst, UniversalBuffer & indicesDst, int nRows, int bitOffset, int localSize,
                                          int nLocalHists);
 
+    /// Sorts the keys with the values in every segment independently in a
+    /// single launch per radix pass. The keys of the segment i are in
+    /// [segmentOffsets[i], segmentOffsets[i + 1]).
+    ///
+    /// The keys are 32- or 64-bit integer or floating-point numbers, the values
+    /// are any 32- or 64-bit numbers. The sorted keys and values are written
+    /// back into keys and values, keysBuffer and valuesBuffer are temporary.
+    static services::Status sortSegments(UniversalBuffer & keys, UniversalBuffer & values, UniversalBuffer & keysBuffer,
+                                         UniversalBuffer & valuesBuffer, const UniversalBuffer & segmentOffsets, uint32_t nSegments);
+
 private:
+    static services::Status radixSortSegmentedPass(UniversalBuffer & keysSrc, UniversalBuffer & valuesSrc, const UniversalBuffer & segmentOffsets,
+                                                   UniversalBuffer & keysDst, UniversalBuffer & valuesDst, uint32_t nSegments, int bitOffset);
+
     static const uint32_t _preferableSubGroup = 16; // preferable maximal sub-group size
     static const uint32_t _radixBits          = 4;  // number of bits used for a single pass of radix sort
 };
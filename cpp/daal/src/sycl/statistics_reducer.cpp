@@ -0,0 +1,186 @@
+/* file: statistics_reducer.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "src/sycl/reducer.h"
+#include "services/internal/execution_context.h"
+#include "src/externals/service_ittnotify.h"
+#include "src/sycl/cl_kernels/statistics_reducer.cl"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace sycl
+{
+namespace math
+{
+DAAL_ITTNOTIFY_DOMAIN(daal.oneapi.internal.math.StatisticsReducer);
+
+namespace
+{
+services::Status buildStatisticsProgram(ClKernelFactoryIface & kernelFactory, const TypeId & vectorTypeId)
+{
+    services::String fptype_name = getKeyFPType(vectorTypeId);
+    auto build_options           = fptype_name;
+    build_options.add("-cl-std=CL1.2 -D LOCAL_BUFFER_SIZE=256");
+
+    services::String cachekey("__daal_oneapi_internal_math_statistics_reducer_");
+    cachekey.add(build_options);
+
+    services::Status status;
+    kernelFactory.build(ExecutionTargetIds::device, cachekey.c_str(), statistics_reducer, build_options.c_str(), &status);
+    return status;
+}
+
+void setResultArguments(KernelArguments & args, uint32_t first, StatisticsReducer::Result & result, AccessModeId mode)
+{
+    args.set(first, result.min, mode);
+    args.set(first + 1, result.max, mode);
+    args.set(first + 2, result.sum, mode);
+    args.set(first + 3, result.sumOfSquares, mode);
+    args.set(first + 4, result.count, mode);
+}
+
+void statisticsSinglepass(ExecutionContextIface & context, ClKernelFactoryIface & kernelFactory, Layout vectorsLayout,
+                          const UniversalBuffer & vectors, uint32_t nVectors, uint32_t vectorSize, uint32_t workItemsPerGroup,
+                          StatisticsReducer::Result & result, services::Status * status)
+{
+    auto kernel = kernelFactory.getKernel("statisticsSinglepass", status);
+    DAAL_CHECK_STATUS_PTR(status);
+
+    KernelRange localRange(workItemsPerGroup, 1);
+    KernelRange globalRange(workItemsPerGroup, nVectors);
+
+    KernelNDRange range(2);
+    range.global(globalRange, status);
+    DAAL_CHECK_STATUS_PTR(status);
+    range.local(localRange, status);
+    DAAL_CHECK_STATUS_PTR(status);
+
+    KernelArguments args(9);
+    uint32_t vectorsAreRows = vectorsLayout == Layout::RowMajor ? 1 : 0;
+    args.set(0, vectorsAreRows);
+    args.set(1, vectors, AccessModeIds::read);
+    args.set(2, nVectors);
+    args.set(3, vectorSize);
+    setResultArguments(args, 4, result, AccessModeIds::write);
+
+    context.run(range, kernel, args, status);
+}
+
+void statisticsStepColmajor(ExecutionContextIface & context, ClKernelFactoryIface & kernelFactory, const UniversalBuffer & vectors,
+                            uint32_t nVectors, uint32_t vectorSize, uint32_t numWorkItems, uint32_t numWorkGroups,
+                            StatisticsReducer::Result & stepResult, services::Status * status)
+{
+    auto kernel = kernelFactory.getKernel("statisticsStepColmajor", status);
+    DAAL_CHECK_STATUS_PTR(status);
+
+    KernelRange localRange(numWorkItems);
+    KernelRange globalRange(numWorkGroups * numWorkItems);
+
+    KernelNDRange range(1);
+    range.global(globalRange, status);
+    DAAL_CHECK_STATUS_PTR(status);
+    range.local(localRange, status);
+    DAAL_CHECK_STATUS_PTR(status);
+
+    KernelArguments args(8);
+    args.set(0, vectors, AccessModeIds::read);
+    args.set(1, nVectors);
+    args.set(2, vectorSize);
+    setResultArguments(args, 3, stepResult, AccessModeIds::write);
+
+    context.run(range, kernel, args, status);
+}
+
+void statisticsFinalStep(ExecutionContextIface & context, ClKernelFactoryIface & kernelFactory, StatisticsReducer::Result & stepResult,
+                         uint32_t nVectors, uint32_t nParts, StatisticsReducer::Result & result, services::Status * status)
+{
+    auto kernel = kernelFactory.getKernel("statisticsFinalStep", status);
+    DAAL_CHECK_STATUS_PTR(status);
+
+    KernelArguments args(11);
+    setResultArguments(args, 0, stepResult, AccessModeIds::read);
+    args.set(5, nParts);
+    setResultArguments(args, 6, result, AccessModeIds::write);
+
+    context.run(KernelRange(nVectors), kernel, args, status);
+}
+
+} // namespace
+
+StatisticsReducer::Result StatisticsReducer::reduce(Layout vectorsLayout, const UniversalBuffer & vectors, uint32_t nVectors, uint32_t vectorSize,
+                                                    services::Status * status)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(StatisticsReducer.reduce);
+
+    auto & context       = services::internal::getDefaultContext();
+    auto & kernelFactory = context.getClKernelFactory();
+
+    Result result(context, nVectors, vectors.type(), status);
+    DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, result);
+
+    services::internal::tryAssignStatus(status, buildStatisticsProgram(kernelFactory, vectors.type()));
+    DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, result);
+
+    const uint32_t maxWorkItemsPerGroup = 256;
+
+    if (vectorsLayout == Layout::RowMajor)
+    {
+        statisticsSinglepass(context, kernelFactory, vectorsLayout, vectors, nVectors, vectorSize, maxWorkItemsPerGroup, result, status);
+    }
+    else
+    {
+        // The same partitioning of the columns as in SumReducer
+        const uint32_t numDivisionsByCol = (nVectors + maxWorkItemsPerGroup - 1) / maxWorkItemsPerGroup;
+        uint32_t numDivisionsByRow       = 9;
+        if (vectorSize < 5000)
+            numDivisionsByRow = 1;
+        else if (vectorSize < 10000)
+            numDivisionsByRow = 3;
+        else if (vectorSize < 20000)
+            numDivisionsByRow = 6;
+
+        const uint32_t workItemsPerGroup = (maxWorkItemsPerGroup < nVectors) ? maxWorkItemsPerGroup : nVectors;
+
+        if (numDivisionsByRow > 1)
+        {
+            Result stepResult(context, numDivisionsByRow * nVectors, vectors.type(), status);
+            DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, result);
+
+            statisticsStepColmajor(context, kernelFactory, vectors, nVectors, vectorSize, workItemsPerGroup, numDivisionsByCol * numDivisionsByRow,
+                                   stepResult, status);
+            DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, result);
+
+            statisticsFinalStep(context, kernelFactory, stepResult, nVectors, numDivisionsByRow, result, status);
+        }
+        else
+        {
+            statisticsStepColmajor(context, kernelFactory, vectors, nVectors, vectorSize, workItemsPerGroup, numDivisionsByCol, result, status);
+        }
+    }
+
+    return result;
+}
+
+} // namespace math
+} // namespace sycl
+} // namespace internal
+} // namespace services
+} // namespace daal
@@ -24,11 +24,18 @@
 #include "src/threading/threading.h"
 #include "services/daal_memory.h"
 
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
 #if defined(__DO_TBB_LAYER__)
     #define TBB_PREVIEW_GLOBAL_CONTROL 1
     #define TBB_PREVIEW_TASK_ARENA     1
 
     #include <stdlib.h> // malloc and free
+    #include <memory>
+    #include <vector>
     #include <tbb/tbb.h>
     #include <tbb/spin_mutex.h>
     #include <tbb/scalable_allocator.h>
@@ -94,6 +101,11 @@ DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** globalCo
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func)
 {
 #if defined(__DO_TBB_LAYER__)
+    if (n <= 1)
+    {
+        if (n == 1) func(0, a);
+        return;
+    }
     tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) {
         int i;
         for (i = r.begin(); i < r.end(); i++)
@@ -113,12 +125,68 @@ DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a,
 DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func)
 {
 #if defined(__DO_TBB_LAYER__)
+    if (n <= 1)
+    {
+        if (n == 1) func(0, 1, a);
+        return;
+    }
     tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) { func(r.begin(), r.end() - r.begin(), a); });
 #elif defined(__DO_SEQ_LAYER__)
     func(0, n, a);
 #endif
 }
 
+#if defined(__DO_TBB_LAYER__)
+// The work, in the scalar operations of the iteration costs, below which a
+// loop runs serially in the calling thread. It comes from the grain size rule
+// of the TBB documentation: a task should run for at least 100000 clock cycles
+// to amortize the scheduling overhead. The operations of the loops that pass
+// their costs load their operands from memory, counted as about 3 cycles
+// each, which gives 100000 / 3 ~ 33000 operations, rounded down to 2^15. The
+// value was not tuned by measurements and is the same on all platforms.
+static const size_t threaderSerialCutoff = size_t(1) << 15;
+
+// The number of the iterations of one TBB task, the task does at least
+// threaderSerialCutoff operations
+static int threaderGrainSize(size_t iterationCost)
+{
+    const size_t cost = iterationCost > 0 ? iterationCost : 1;
+    return cost >= threaderSerialCutoff ? 1 : int(threaderSerialCutoff / cost);
+}
+
+static bool threaderRunSerially(int n, size_t iterationCost)
+{
+    return n <= 1 || size_t(n) * iterationCost < threaderSerialCutoff || _daal_threader_get_max_threads() <= 1;
+}
+#endif
+
+DAAL_EXPORT void _daal_threader_for_cost(int n, int threads_request, size_t iterationCost, const void * a, daal::functype func)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (threaderRunSerially(n, iterationCost))
+    {
+        for (int i = 0; i < n; i++)
+        {
+            func(i, a);
+        }
+        return;
+    }
+    tbb::parallel_for(tbb::blocked_range<int>(0, n, threaderGrainSize(iterationCost)), [&](tbb::blocked_range<int> r) {
+        int i;
+        for (i = r.begin(); i < r.end(); i++)
+        {
+            func(i, a);
+        }
+    });
+#elif defined(__DO_SEQ_LAYER__)
+    int i;
+    for (i = 0; i < n; i++)
+    {
+        func(i, a);
+    }
+#endif
+}
+
 DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func)
 {
 #if defined(__DO_TBB_LAYER__)
@@ -175,6 +243,152 @@ DAAL_EXPORT int _daal_threader_get_max_threads()
 #endif
 }
 
+DAAL_EXPORT void _daal_execute_in_arena(int max_concurrency, int numa_node, const void * a, daal::functype_arena func)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (max_concurrency <= 0 && numa_node < 0)
+    {
+        func(a);
+        return;
+    }
+
+    #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
+    tbb::task_arena::constraints constraints;
+    if (numa_node >= 0)
+    {
+        const std::vector<tbb::numa_node_id> numa_nodes = tbb::info::numa_nodes();
+        if (static_cast<size_t>(numa_node) < numa_nodes.size()) constraints.numa_id = numa_nodes[numa_node];
+    }
+    if (max_concurrency > 0) constraints.max_concurrency = max_concurrency;
+    tbb::task_arena arena(constraints);
+    #else
+    // The NUMA binding of the arenas is not available in the older TBB
+    tbb::task_arena arena(max_concurrency > 0 ? max_concurrency : tbb::task_arena::automatic);
+    #endif
+    arena.execute([&]() { func(a); });
+#elif defined(__DO_SEQ_LAYER__)
+    func(a);
+#endif
+}
+
+#if defined(__DO_TBB_LAYER__) && defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
+namespace
+{
+// The arenas bound to the NUMA nodes of the machine, there are no arenas on
+// the single-node machines
+class NumaArenas
+{
+public:
+    static NumaArenas & get()
+    {
+        static NumaArenas instance;
+        return instance;
+    }
+
+    size_t size() const { return _arenas.size(); }
+
+    tbb::task_arena & arena(size_t node) { return *_arenas[node]; }
+
+    // The first iteration of the node in the proportional to the node
+    // concurrency partitioning of n iterations
+    int begin(int n, size_t node) const { return static_cast<int>((int64_t)n * _concurrencyPrefix[node] / _concurrencyPrefix.back()); }
+
+    // The NUMA partitioning is disabled inside the arenas with the limited
+    // concurrency, e.g. the arenas of the host policy
+    bool isEnabled() const { return _arenas.size() > 1 && tbb::this_task_arena::max_concurrency() >= _concurrencyPrefix.back(); }
+
+private:
+    NumaArenas() : _concurrencyPrefix(1, 0)
+    {
+        const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+        if (nodes.size() <= 1) return;
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            _arenas.emplace_back(new tbb::task_arena(tbb::task_arena::constraints(nodes[i])));
+            _concurrencyPrefix.push_back(_concurrencyPrefix.back() + tbb::info::default_concurrency(nodes[i]));
+        }
+    }
+
+    std::vector<std::unique_ptr<tbb::task_arena> > _arenas;
+    std::vector<int64_t> _concurrencyPrefix;
+};
+
+// Runs func(node) on the threads of every node, the nodes work concurrently
+template <typename F>
+void executeOnNumaNodes(NumaArenas & arenas, const F & func)
+{
+    std::vector<tbb::task_group> groups(arenas.size());
+    for (size_t node = 0; node < arenas.size(); node++)
+    {
+        arenas.arena(node).execute([&, node]() { groups[node].run([&, node]() { func(node); }); });
+    }
+    for (size_t node = 0; node < arenas.size(); node++)
+    {
+        arenas.arena(node).execute([&, node]() { groups[node].wait(); });
+    }
+}
+} // namespace
+#endif
+
+DAAL_EXPORT int _daal_threader_get_numa_node_count()
+{
+#if defined(__DO_TBB_LAYER__) && defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
+    const size_t nodeCount = NumaArenas::get().size();
+    return nodeCount > 1 ? static_cast<int>(nodeCount) : 1;
+#else
+    return 1;
+#endif
+}
+
+DAAL_EXPORT void _daal_threader_for_numa(int n, const void * a, daal::functype_numa func)
+{
+#if defined(__DO_TBB_LAYER__)
+    #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
+    NumaArenas & arenas = NumaArenas::get();
+    if (arenas.isEnabled())
+    {
+        executeOnNumaNodes(arenas, [&](size_t node) {
+            tbb::parallel_for(tbb::blocked_range<int>(arenas.begin(n, node), arenas.begin(n, node + 1), 1), [&](tbb::blocked_range<int> r) {
+                for (int i = r.begin(); i < r.end(); i++)
+                {
+                    func(i, static_cast<int>(node), a);
+                }
+            });
+        });
+        return;
+    }
+    #endif
+    tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) {
+        for (int i = r.begin(); i < r.end(); i++)
+        {
+            func(i, 0, a);
+        }
+    });
+#elif defined(__DO_SEQ_LAYER__)
+    for (int i = 0; i < n; i++)
+    {
+        func(i, 0, a);
+    }
+#endif
+}
+
+DAAL_EXPORT void _daal_threader_for_numa_nodes(const void * a, daal::functype func)
+{
+#if defined(__DO_TBB_LAYER__) && defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
+    NumaArenas & arenas = NumaArenas::get();
+    if (arenas.isEnabled())
+    {
+        executeOnNumaNodes(arenas, [&](size_t node) { func(static_cast<int>(node), a); });
+        return;
+    }
+#endif
+    const int nodeCount = _daal_threader_get_numa_node_count();
+    for (int node = 0; node < nodeCount; node++)
+    {
+        func(node, a);
+    }
+}
+
 DAAL_EXPORT void * _daal_get_tls_ptr(void * a, daal::tls_functype func)
 {
 #if defined(__DO_TBB_LAYER__)
@@ -683,5 +897,222 @@ DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr) {}
 
 #endif
 
+namespace
+{
+// The scratch blocks freed by the thread are kept in the cache of the thread
+// and reused by the following allocations, so the per-thread buffers of the
+// kernels are not allocated on every compute call
+class ScratchCache
+{
+public:
+    static const size_t maxBlockCount  = 16;
+    static const size_t maxCachedBytes = size_t(64) << 20;
+    // The blocks unused for that long are released
+    static const int64_t idleTimeout = 2000; // ms
+
+    ScratchCache() : _blockCount(0), _cachedBytes(0) { registry().add(this); }
+
+    ~ScratchCache()
+    {
+        registry().remove(this);
+        clear();
+    }
+
+    static ScratchCache & local()
+    {
+        static thread_local ScratchCache cache;
+        return cache;
+    }
+
+    static void trimAll() { registry().trimAll(); }
+
+    // Returns the block to the cache if its thread is still alive
+    static bool release(ScratchCache * owner, void * ptr, size_t size, size_t alignment)
+    {
+        ScratchCache & cache = local();
+        if (owner == &cache) return cache.release(ptr, size, alignment);
+        return registry().release(owner, ptr, size, alignment);
+    }
+
+    void * acquire(size_t size, size_t alignment)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 0; i < _blockCount; i++)
+        {
+            Block & block = _blocks[i];
+            // The small requests do not take the large blocks
+            if (block.size >= size && block.size <= 2 * size + 4096 && block.alignment % alignment == 0)
+            {
+                void * ptr = block.ptr;
+                _cachedBytes -= block.size;
+                _blocks[i] = _blocks[--_blockCount];
+                return ptr;
+            }
+        }
+        return nullptr;
+    }
+
+    bool release(void * ptr, size_t size, size_t alignment)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        trimIdle(now());
+        if (_blockCount == maxBlockCount || _cachedBytes + size > maxCachedBytes) return false;
+        _blocks[_blockCount++] = Block { ptr, size, alignment, now() };
+        _cachedBytes += size;
+        return true;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        trimIdle(now(), 0);
+    }
+
+private:
+    struct Block
+    {
+        void * ptr;
+        size_t size;
+        size_t alignment;
+        int64_t lastUse;
+    };
+
+    class Registry
+    {
+    public:
+        void add(ScratchCache * cache)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _caches.push_back(cache);
+        }
+
+        void remove(ScratchCache * cache)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < _caches.size(); i++)
+            {
+                if (_caches[i] == cache)
+                {
+                    _caches[i] = _caches.back();
+                    _caches.pop_back();
+                    break;
+                }
+            }
+        }
+
+        bool release(ScratchCache * owner, void * ptr, size_t size, size_t alignment)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < _caches.size(); i++)
+            {
+                if (_caches[i] == owner) return owner->release(ptr, size, alignment);
+            }
+            return false;
+        }
+
+        void trimAll()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < _caches.size(); i++)
+            {
+                _caches[i]->clear();
+            }
+        }
+
+    private:
+        std::mutex _mutex;
+        std::vector<ScratchCache *> _caches;
+    };
+
+    // The registry is never destroyed: the caches of the worker threads may
+    // outlive the static objects
+    static Registry & registry()
+    {
+        static Registry * instance = new Registry();
+        return *instance;
+    }
+
+    static int64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void trimIdle(int64_t time, int64_t timeout = idleTimeout)
+    {
+        for (size_t i = 0; i < _blockCount;)
+        {
+            if (time - _blocks[i].lastUse >= timeout)
+            {
+                _threaded_scalable_free(_blocks[i].ptr);
+                _cachedBytes -= _blocks[i].size;
+                _blocks[i] = _blocks[--_blockCount];
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    std::mutex _mutex;
+    Block _blocks[maxBlockCount];
+    size_t _blockCount;
+    size_t _cachedBytes;
+};
+
+// The header before the block keeps its size, alignment and the cache of the
+// allocating thread
+struct ScratchHeader
+{
+    size_t size;
+    size_t alignment;
+    ScratchCache * owner;
+};
+
+const size_t minScratchAlignment = 32;
+} // namespace
+
+DAAL_EXPORT void * _daal_scratch_malloc(const size_t size, const size_t alignment)
+{
+    const size_t blockAlignment = alignment < minScratchAlignment ? minScratchAlignment : alignment;
+    const size_t offset         = (sizeof(ScratchHeader) + blockAlignment - 1) / blockAlignment * blockAlignment;
+    // The sizes are rounded up to the page, so the close sizes share the blocks
+    const size_t blockSize = (size + offset + 4095) / 4096 * 4096;
+
+    ScratchCache & cache = ScratchCache::local();
+    char * block         = static_cast<char *>(cache.acquire(blockSize, blockAlignment));
+    if (!block)
+    {
+        block = static_cast<char *>(_threaded_scalable_malloc(blockSize, blockAlignment));
+        if (!block) return nullptr;
+    }
+
+    char * ptr             = block + offset;
+    ScratchHeader * header = reinterpret_cast<ScratchHeader *>(ptr) - 1;
+    header->size           = blockSize;
+    header->alignment      = blockAlignment;
+    header->owner          = &cache;
+    return ptr;
+}
+
+DAAL_EXPORT void _daal_scratch_free(void * ptr)
+{
+    if (!ptr) return;
+    const ScratchHeader header = *(static_cast<ScratchHeader *>(ptr) - 1);
+    const size_t offset        = (sizeof(ScratchHeader) + header.alignment - 1) / header.alignment * header.alignment;
+    char * block               = static_cast<char *>(ptr) - offset;
+    // The per-thread buffers are often freed by the thread doing the final
+    // reduction, so the block is returned to the cache of the allocating thread
+    if (!ScratchCache::release(header.owner, block, header.size, header.alignment))
+    {
+        _threaded_scalable_free(block);
+    }
+}
+
+DAAL_EXPORT void _daal_scratch_trim()
+{
+    ScratchCache::trimAll();
+}
+
 namespace daal
 {}
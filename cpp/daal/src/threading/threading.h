@@ -33,6 +33,8 @@ typedef void (*functype2)(int i, int n, const void * a);
 typedef void * (*tls_functype)(const void * a);
 typedef void (*tls_reduce_functype)(void * p, const void * a);
 typedef void (*functype_break)(int i, bool & needBreak, const void * a);
+typedef void (*functype_arena)(const void * a);
+typedef void (*functype_numa)(int i, int node, const void * a);
 class task;
 } // namespace daal
 
@@ -41,8 +43,13 @@ extern "C"
     DAAL_EXPORT int _daal_threader_get_max_threads();
     DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func);
+    DAAL_EXPORT void _daal_threader_for_cost(int n, int threads_request, size_t iterationCost, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void * a, daal::functype_break func);
+    DAAL_EXPORT void _daal_execute_in_arena(int max_concurrency, int numa_node, const void * a, daal::functype_arena func);
+    DAAL_EXPORT int _daal_threader_get_numa_node_count();
+    DAAL_EXPORT void _daal_threader_for_numa(int n, const void * a, daal::functype_numa func);
+    DAAL_EXPORT void _daal_threader_for_numa_nodes(const void * a, daal::functype func);
 
     DAAL_EXPORT void * _daal_get_tls_ptr(void * a, daal::tls_functype func);
     DAAL_EXPORT void * _daal_get_tls_local(void * tlsPtr);
@@ -74,6 +81,10 @@ extern "C"
 
     DAAL_EXPORT void * _threaded_scalable_malloc(const size_t size, const size_t alignment);
     DAAL_EXPORT void _threaded_scalable_free(void * ptr);
+
+    DAAL_EXPORT void * _daal_scratch_malloc(const size_t size, const size_t alignment);
+    DAAL_EXPORT void _daal_scratch_free(void * ptr);
+    DAAL_EXPORT void _daal_scratch_trim();
 }
 
 namespace daal
@@ -93,6 +104,19 @@ inline void threaded_scalable_free(void * ptr)
     _threaded_scalable_free(ptr);
 }
 
+/// Allocates the scratch buffer from the cache of the calling thread. The
+/// freed buffers stay in the cache for the following calls until they are
+/// idle for a few seconds or daal_free_buffers() is called.
+inline void * threaded_scratch_malloc(const size_t size, const size_t alignment)
+{
+    return _daal_scratch_malloc(size, alignment);
+}
+
+inline void threaded_scratch_free(void * ptr)
+{
+    _daal_scratch_free(ptr);
+}
+
 class ThreaderEnvironment
 {
 public:
@@ -156,6 +180,19 @@ inline void threader_for_blocked(int n, int threads_request, const F & lambda)
     _daal_threader_for_blocked(n, threads_request, a, threader_func_b<F>);
 }
 
+/// Runs the loop in parallel like threader_for, iterationCost is the estimate
+/// of the number of the scalar operations of one iteration. The loop runs
+/// serially in the calling thread if its whole work is too small to pay for
+/// the parallel execution, otherwise every task gets enough iterations to do
+/// at least that much work.
+template <typename F>
+inline void threader_for(int n, int threads_request, size_t iterationCost, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_cost(n, threads_request, iterationCost, a, threader_func<F>);
+}
+
 template <typename F>
 inline void threader_for_optional(int n, int threads_request, const F & lambda)
 {
@@ -172,6 +209,81 @@ inline void threader_for_break(int n, int threads_request, const F & lambda)
     _daal_threader_for_break(n, threads_request, a, threader_func_break<F>);
 }
 
+template <typename F>
+inline void threader_func_arena(const void * a)
+{
+    const F & lambda = *static_cast<const F *>(a);
+    lambda();
+}
+
+/// Runs the function in the task arena limited to max_concurrency threads and
+/// bound to the NUMA node, all the threader primitives called by the function
+/// share the arena. Non-positive max_concurrency and negative numa_node mean
+/// no limit.
+template <typename F>
+inline void threader_execute_in_arena(int max_concurrency, int numa_node, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_execute_in_arena(max_concurrency, numa_node, a, threader_func_arena<F>);
+}
+
+template <typename F>
+inline void threader_func_numa(int i, int node, const void * a)
+{
+    const F & lambda = *static_cast<const F *>(a);
+    lambda(i, node);
+}
+
+inline int threader_get_numa_node_count()
+{
+    return _daal_threader_get_numa_node_count();
+}
+
+/// NUMA-partitioned loop: the iterations are split into the contiguous ranges
+/// proportional to the thread counts of the NUMA nodes, every range is
+/// processed by the threads of its node. The lambda gets the iteration and
+/// the node indices. The ranges are proportional, so the loops over the same
+/// buffer split it at about the same points whatever the iteration count, and
+/// the data first touched in such a loop stays local to the threads of the
+/// following loops. On the single-node machines and inside the arenas with
+/// the limited concurrency all the iterations are processed as node 0.
+template <typename F>
+inline void threader_for_numa(int n, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_numa(n, a, threader_func_numa<F>);
+}
+
+/// Runs lambda(node) on the threads of every NUMA node
+template <typename F>
+inline void threader_for_numa_nodes(const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_numa_nodes(a, threader_func<F>);
+}
+
+/// Copies the source into the buffer, or zeroes the buffer if there is no
+/// source, in the NUMA-partitioned loop. The pages of the buffer are placed on
+/// the nodes whose threads process the corresponding ranges in threader_for_numa
+inline void threader_first_touch_numa(void * ptr, size_t size, const void * src = nullptr)
+{
+    const size_t blockSize = 1 << 20;
+    const size_t nBlocks   = (size + blockSize - 1) / blockSize;
+    char * bytes           = static_cast<char *>(ptr);
+    const char * srcBytes  = static_cast<const char *>(src);
+    threader_for_numa(static_cast<int>(nBlocks), [=](int iBlock, int) {
+        const size_t first = iBlock * blockSize;
+        const size_t last  = (first + blockSize < size) ? first + blockSize : size;
+        for (size_t i = first; i < last; i++)
+        {
+            bytes[i] = srcBytes ? srcBytes[i] : 0;
+        }
+    });
+}
+
 template <typename lambdaType>
 inline void * tls_func(const void * a)
 {
@@ -259,6 +371,242 @@ private:
     tls_deleter * d;
 };
 
+/// Thread-local storage partitioned by the NUMA nodes, the values of the node
+/// are reduced on the threads of that node before the cross-node reduction
+template <typename F>
+class numa_tls : public tlsBase
+{
+public:
+    template <typename lambdaType>
+    explicit numa_tls(const lambdaType & lambda) : _nNodes(threader_get_numa_node_count())
+    {
+        _tls = new tls<F> *[_nNodes];
+        for (int node = 0; node < _nNodes; node++)
+        {
+            _tls[node] = new tls<F>(lambda);
+        }
+    }
+
+    virtual ~numa_tls()
+    {
+        for (int node = 0; node < _nNodes; node++)
+        {
+            delete _tls[node];
+        }
+        delete[] _tls;
+    }
+
+    /// The value of the calling thread in the storage of the node
+    F local(int node) { return _tls[node]->local(); }
+
+    /// Merges the values of every node into the first value of the node with
+    /// merge(dst, src) on the threads of the node, then calls reduce(value)
+    /// for the merged value of every node
+    template <typename mergeLambdaType, typename reduceLambdaType>
+    void reduce(const mergeLambdaType & merge, const reduceLambdaType & reduce)
+    {
+        F * merged     = new F[_nNodes]();
+        bool * isEmpty = new bool[_nNodes];
+        threader_for_numa_nodes([&](int node) {
+            bool empty = true;
+            _tls[node]->reduce([&](F value) {
+                if (empty)
+                {
+                    merged[node] = value;
+                    empty        = false;
+                }
+                else
+                {
+                    merge(merged[node], value);
+                }
+            });
+            isEmpty[node] = empty;
+        });
+
+        for (int node = 0; node < _nNodes; node++)
+        {
+            if (!isEmpty[node]) reduce(merged[node]);
+        }
+        delete[] isEmpty;
+        delete[] merged;
+    }
+
+private:
+    int _nNodes;
+    tls<F> ** _tls;
+};
+
+/// The largest number of the chunks of the blocks of the ordered blocked_tls
+/// and the largest total size in bytes of their values
+const size_t ordered_tls_max_chunks     = 256;
+const size_t ordered_tls_max_total_size = size_t(1) << 28;
+
+/// Returns the number of the chunks of the ordered blocked_tls with the values
+/// of valueSize bytes, it depends only on the size of the values
+inline size_t ordered_tls_chunk_count(size_t valueSize)
+{
+    const size_t count = valueSize ? ordered_tls_max_total_size / valueSize : ordered_tls_max_chunks;
+    return count < 1 ? 1 : (count > ordered_tls_max_chunks ? ordered_tls_max_chunks : count);
+}
+
+/// Storage of the partial results of a blocked loop. By default it is the
+/// thread-local storage, whose values are merged in the order of the threads,
+/// so the rounding of the result depends on the number of the threads and the
+/// scheduling. In the ordered mode the blocks of the loop are split into at
+/// most maxChunks chunks of the consecutive blocks, which depend only on the
+/// number of the blocks. Each chunk processes its blocks in turn into its own
+/// value and the values are reduced in the chunk order, so the result is
+/// reproducible with any number of threads.
+template <typename F>
+class blocked_tls : public tlsBase
+{
+public:
+    template <typename lambdaType>
+    blocked_tls(const lambdaType & lambda, bool isOrdered, size_t maxChunks = ordered_tls_max_chunks)
+        : _tls(nullptr), _nChunks(maxChunks ? maxChunks : 1), _values(nullptr), _isCreated(nullptr), _init(nullptr), _d(nullptr), _create(nullptr)
+    {
+        if (!isOrdered)
+        {
+            _tls = new tls<F>(lambda);
+            return;
+        }
+        _init      = static_cast<void *>(new lambdaType(lambda));
+        _d         = new tls_deleter_<lambdaType>();
+        _create    = tls_func<lambdaType>;
+        _values    = new void *[_nChunks]();
+        _isCreated = new bool[_nChunks]();
+    }
+
+    virtual ~blocked_tls()
+    {
+        delete _tls;
+        if (_d)
+        {
+            _d->del(_init);
+            delete _d;
+        }
+        delete[] _values;
+        delete[] _isCreated;
+    }
+
+    bool isOrdered() const { return !_tls; }
+
+    /// Calls body(iBlock, value) for the blocks 0..nBlocks-1 in parallel with
+    /// the value of the thread, or of the chunk of the block in the ordered mode
+    template <typename lambdaType>
+    void for_blocks(size_t nBlocks, const lambdaType & body)
+    {
+        if (_tls)
+        {
+            threader_for(nBlocks, nBlocks, [&](int iBlock) { body(iBlock, _tls->local()); });
+            return;
+        }
+
+        const size_t nChunks     = nBlocks < _nChunks ? nBlocks : _nChunks;
+        const size_t chunkBlocks = nChunks ? (nBlocks + nChunks - 1) / nChunks : 0;
+        threader_for(nChunks, nChunks, [&](int iChunk) {
+            const size_t begin = iChunk * chunkBlocks;
+            const size_t end   = (begin + chunkBlocks < nBlocks) ? begin + chunkBlocks : nBlocks;
+            if (begin >= end) return;
+            F value = local(iChunk);
+            for (size_t iBlock = begin; iBlock < end; iBlock++)
+            {
+                body(int(iBlock), value);
+            }
+        });
+    }
+
+    /// Calls lambda(value) for the values on the calling thread, in the chunk
+    /// order in the ordered mode
+    template <typename lambdaType>
+    void reduce(const lambdaType & lambda)
+    {
+        if (_tls)
+        {
+            _tls->reduce(lambda);
+            return;
+        }
+        for (size_t i = 0; i < _nChunks; i++)
+        {
+            if (_isCreated[i]) lambda(static_cast<F>(_values[i]));
+        }
+    }
+
+    /// Merges the values pairwise along the binary tree of the chunks in
+    /// parallel with merge(dst, src), which takes over src, then calls
+    /// reduce(value) for the merged value. The values are taken over, so the
+    /// storage holds none after it.
+    template <typename mergeLambdaType, typename reduceLambdaType>
+    void reduce(const mergeLambdaType & merge, const reduceLambdaType & reduce)
+    {
+        size_t n       = _nChunks;
+        void ** values = _values;
+        if (_tls)
+        {
+            n = 0;
+            _tls->reduce([&](F) { n++; });
+            if (!n) return;
+            values = new void *[n];
+            n      = 0;
+            _tls->reduce([&](F value) { values[n++] = static_cast<void *>(value); });
+        }
+        else
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                if (!_isCreated[i]) values[i] = nullptr;
+                _isCreated[i] = false;
+            }
+        }
+
+        for (size_t stride = 1; stride < n; stride *= 2)
+        {
+            const size_t nPairs = (n + 2 * stride - 1) / (2 * stride);
+            threader_for(nPairs, nPairs, [&](int iPair) {
+                const size_t dst = iPair * 2 * stride;
+                const size_t src = dst + stride;
+                if (src < n && values[src])
+                {
+                    if (!values[dst])
+                    {
+                        values[dst] = values[src];
+                    }
+                    else
+                    {
+                        F merged = static_cast<F>(values[dst]);
+                        merge(merged, static_cast<F>(values[src]));
+                        values[dst] = static_cast<void *>(merged);
+                    }
+                }
+            });
+        }
+        if (n && values[0]) reduce(static_cast<F>(values[0]));
+        if (_tls) delete[] values;
+    }
+
+private:
+    F local(size_t chunk)
+    {
+        if (!_isCreated[chunk])
+        {
+            _values[chunk]    = _create(_init);
+            _isCreated[chunk] = true;
+        }
+        return static_cast<F>(_values[chunk]);
+    }
+
+    blocked_tls(const blocked_tls &);
+    blocked_tls & operator=(const blocked_tls &);
+
+    tls<F> * _tls;
+    size_t _nChunks;
+    void ** _values;
+    bool * _isCreated;
+    void * _init;
+    tls_deleter * _d;
+    tls_functype _create;
+};
+
 template <typename F>
 class ls : public tlsBase
 {
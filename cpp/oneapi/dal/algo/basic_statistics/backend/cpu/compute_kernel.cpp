@@ -0,0 +1,280 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/low_order_moments/low_order_moments_kernel.h>
+
+#include "oneapi/dal/algo/basic_statistics/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/basic_statistics/backend/to_daal_method.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::basic_statistics::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace interop = dal::backend::interop;
+
+template <typename Float, typename Method, daal::CpuType Cpu>
+using daal_lom_batch_kernel_t =
+    daal_lom::internal::LowOrderMomentsBatchKernel<Float, to_daal_method<Method>::value, Cpu>;
+
+template <typename Float>
+compute_result make_compute_result(result_option options,
+                                   const std::vector<array<Float>>& statistics,
+                                   int64_t column_count) {
+    const auto make_table = [&](result_option option, int64_t index) {
+        if (!check_mask_flag(options, option)) {
+            return table{};
+        }
+        return table{
+            dal::detail::homogen_table_builder{}.reset(statistics[index], 1, column_count).build()
+        };
+    };
+    return compute_result()
+        .set_min(make_table(result_option::min, 0))
+        .set_max(make_table(result_option::max, 1))
+        .set_sum(make_table(result_option::sum, 2))
+        .set_sum_squares(make_table(result_option::sum_squares, 3))
+        .set_sum_squares_centered(make_table(result_option::sum_squares_centered, 4))
+        .set_mean(make_table(result_option::mean, 5))
+        .set_second_order_raw_moment(make_table(result_option::second_order_raw_moment, 6))
+        .set_variance(make_table(result_option::variance, 7))
+        .set_standard_deviation(make_table(result_option::standard_deviation, 8))
+        .set_variation(make_table(result_option::variation, 9));
+}
+
+template <typename Float, typename Method>
+static compute_result call_daal_kernel(const context_cpu& ctx,
+                                       const descriptor_base& desc,
+                                       const table& data) {
+    const int64_t column_count = data.get_column_count();
+    const auto options = desc.get_result_options();
+
+    // The DAAL kernel writes every result table, the estimates it does not
+    // compute are left as they are
+    std::vector<array<Float>> statistics;
+    auto daal_result = daal_lom::ResultPtr(new daal_lom::Result());
+    for (int64_t i = 0; i < result_count; i++) {
+        statistics.push_back(array<Float>::zeros(column_count));
+        daal_result->set(static_cast<daal_lom::ResultId>(i),
+                         interop::convert_to_daal_homogen_table(statistics.back(),
+                                                                1,
+                                                                column_count));
+    }
+
+    const auto daal_data = interop::convert_to_daal_table_by_kind<Float>(data);
+
+    daal_lom::Parameter daal_parameter(to_daal_estimates(options));
+    const auto status = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+        return daal_lom_batch_kernel_t<Float, Method, daal_cpu>().compute(daal_data.get(),
+                                                                         daal_result.get(),
+                                                                         &daal_parameter);
+    });
+    interop::status_to_exception(status);
+
+    return make_compute_result(options, statistics, column_count);
+}
+
+/// The sum of the float values. The double sum is accurate enough as it is,
+/// the float one subtracts the rounding error of the prior addition from the
+/// next value (Kahan summation).
+template <typename Float>
+struct mixed_sum {
+    Float sum = Float(0);
+    Float compensation = Float(0);
+
+    void add(Float value) {
+        if constexpr (std::is_same_v<Float, double>) {
+            sum += value;
+        }
+        else {
+            const Float y = value - compensation;
+            const Float t = sum + y;
+            compensation = (t - sum) - y;
+            sum = t;
+        }
+    }
+
+    Float get() const {
+        return sum - compensation;
+    }
+};
+
+static bool is_mixed_precision(const descriptor_base& desc, const table& data) {
+    return desc.get_accumulation_mode() == accumulation_mode::mixed_precision &&
+           data.get_kind() == homogen_table::kind() &&
+           data.get_metadata().get_data_type(0) == data_type::float32;
+}
+
+/// Computes the statistics of the float32 table without converting it. The
+/// blocks of rows accumulate their sums in Float, the centered sums are
+/// accumulated by the second pass given the means. The blocks are reduced in
+/// their order, so the result does not depend on the number of threads.
+template <typename Float>
+static compute_result compute_mixed_precision(const context_cpu& ctx,
+                                              const descriptor_base& desc,
+                                              const table& data) {
+    using dal::detail::threader_for_cost;
+
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+    const auto options = desc.get_result_options();
+    const bool centered =
+        check_mask_flag(options,
+                        result_option::sum_squares_centered | result_option::variance |
+                            result_option::standard_deviation | result_option::variation);
+
+    const auto arr_data = row_accessor<const float>{ data }.pull();
+    const float* x = arr_data.get_data();
+
+    constexpr int64_t block_values = 1 << 16;
+    const int64_t rows_per_block = std::max<int64_t>(1, block_values / column_count);
+    const int64_t block_count = (row_count + rows_per_block - 1) / rows_per_block;
+    const std::size_t block_cost = rows_per_block * column_count;
+    const int64_t block_size = block_count * column_count;
+
+    std::vector<Float> block_min(block_size);
+    std::vector<Float> block_max(block_size);
+    std::vector<Float> block_sum(block_size);
+    std::vector<Float> block_sum2(block_size);
+
+    const auto for_each_block = [&](auto&& body) {
+        threader_for_cost(block_count, block_count, block_cost, [&](int block) {
+            const int64_t first = block * rows_per_block;
+            const int64_t last = std::min(row_count, first + rows_per_block);
+            body(block, first, last);
+        });
+    };
+
+    for_each_block([&](int64_t block, int64_t first, int64_t last) {
+        std::vector<mixed_sum<Float>> sum(column_count);
+        std::vector<mixed_sum<Float>> sum2(column_count);
+        Float* min = block_min.data() + block * column_count;
+        Float* max = block_max.data() + block * column_count;
+        std::fill(min, min + column_count, std::numeric_limits<Float>::max());
+        std::fill(max, max + column_count, -std::numeric_limits<Float>::max());
+        for (int64_t i = first; i < last; ++i) {
+            const float* row = x + i * column_count;
+            for (int64_t j = 0; j < column_count; ++j) {
+                const Float value = row[j];
+                min[j] = std::min(min[j], value);
+                max[j] = std::max(max[j], value);
+                sum[j].add(value);
+                sum2[j].add(value * value);
+            }
+        }
+        for (int64_t j = 0; j < column_count; ++j) {
+            block_sum[block * column_count + j] = sum[j].get();
+            block_sum2[block * column_count + j] = sum2[j].get();
+        }
+    });
+
+    const auto reduce_sums = [&](const std::vector<Float>& values, array<Float>& arr) {
+        Float* dst = arr.get_mutable_data();
+        for (int64_t j = 0; j < column_count; ++j) {
+            mixed_sum<Float> sum;
+            for (int64_t b = 0; b < block_count; ++b) {
+                sum.add(values[b * column_count + j]);
+            }
+            dst[j] = sum.get();
+        }
+    };
+
+    auto arr_min = array<Float>::full(column_count, std::numeric_limits<Float>::max());
+    auto arr_max = array<Float>::full(column_count, -std::numeric_limits<Float>::max());
+    auto arr_sum = array<Float>::empty(column_count);
+    auto arr_sum2 = array<Float>::empty(column_count);
+    auto arr_sum2c = array<Float>::zeros(column_count);
+    Float* min = arr_min.get_mutable_data();
+    Float* max = arr_max.get_mutable_data();
+    for (int64_t b = 0; b < block_count; ++b) {
+        for (int64_t j = 0; j < column_count; ++j) {
+            min[j] = std::min(min[j], block_min[b * column_count + j]);
+            max[j] = std::max(max[j], block_max[b * column_count + j]);
+        }
+    }
+    reduce_sums(block_sum, arr_sum);
+    reduce_sums(block_sum2, arr_sum2);
+
+    if (centered) {
+        std::vector<Float> mean(column_count);
+        for (int64_t j = 0; j < column_count; ++j) {
+            mean[j] = arr_sum[j] / Float(row_count);
+        }
+        for_each_block([&](int64_t block, int64_t first, int64_t last) {
+            std::vector<mixed_sum<Float>> sum2c(column_count);
+            for (int64_t i = first; i < last; ++i) {
+                const float* row = x + i * column_count;
+                for (int64_t j = 0; j < column_count; ++j) {
+                    const Float value = Float(row[j]) - mean[j];
+                    sum2c[j].add(value * value);
+                }
+            }
+            for (int64_t j = 0; j < column_count; ++j) {
+                block_sum2[block * column_count + j] = sum2c[j].get();
+            }
+        });
+        reduce_sums(block_sum2, arr_sum2c);
+    }
+
+    const auto partial = make_partial_result(array<Float>::full(1, Float(row_count)),
+                                             arr_min,
+                                             arr_max,
+                                             arr_sum,
+                                             arr_sum2,
+                                             arr_sum2c,
+                                             column_count);
+    return finalize_compute_kernel_cpu<Float, method::dense>{}(ctx, desc, partial);
+}
+
+template <typename Float, typename Method>
+compute_result compute_kernel_cpu<Float, Method>::operator()(const context_cpu& ctx,
+                                                             const descriptor_base& desc,
+                                                             const compute_input& input) const {
+    if constexpr (std::is_same_v<Method, method::dense>) {
+        if (is_mixed_precision(desc, input.get_data())) {
+            return compute_mixed_precision<Float>(ctx, desc, input.get_data());
+        }
+    }
+    return call_daal_kernel<Float, Method>(ctx, desc, input.get_data());
+}
+
+template struct compute_kernel_cpu<float, method::dense>;
+template struct compute_kernel_cpu<double, method::dense>;
+template struct compute_kernel_cpu<float, method::csr>;
+template struct compute_kernel_cpu<double, method::csr>;
+
+template compute_result make_compute_result<float>(result_option,
+                                                   const std::vector<array<float>>&,
+                                                   int64_t);
+template compute_result make_compute_result<double>(result_option,
+                                                    const std::vector<array<double>>&,
+                                                    int64_t);
+
+} // namespace oneapi::dal::basic_statistics::backend
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+
+#include "oneapi/dal/algo/basic_statistics/compute_types.hpp"
+#include "oneapi/dal/algo/basic_statistics/partial_compute_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/communicator.hpp"
+
+namespace oneapi::dal::basic_statistics::backend {
+
+/// The number of the statistics of the compute result, the i-th one is the
+/// i-th bit of result_option and the i-th DAAL low order moments result
+constexpr std::int64_t result_count = 10;
+
+template <typename Float, typename Method>
+struct compute_kernel_cpu {
+    compute_result operator()(const dal::backend::context_cpu& ctx,
+                              const descriptor_base& params,
+                              const compute_input& input) const;
+};
+
+template <typename Float, typename Method>
+struct partial_compute_kernel_cpu {
+    partial_compute_result operator()(const dal::backend::context_cpu& ctx,
+                                      const descriptor_base& params,
+                                      const partial_compute_input& input) const;
+};
+
+template <typename Float, typename Method>
+struct finalize_compute_kernel_cpu {
+    compute_result operator()(const dal::backend::context_cpu& ctx,
+                              const descriptor_base& params,
+                              const partial_compute_result& input) const;
+};
+
+template <typename Float>
+struct merge_kernel_cpu {
+    partial_compute_result operator()(
+        const dal::backend::context_cpu& ctx,
+        const std::vector<partial_compute_result>& partial_results) const;
+};
+
+/// Gathers the partial results of all processes of the SPMD run and merges
+/// them on every process
+template <typename Float>
+struct spmd_merge_kernel_cpu {
+    partial_compute_result operator()(const dal::backend::context_cpu& ctx,
+                                      const spmd::communicator& comm,
+                                      const partial_compute_result& local_partial) const;
+};
+
+/// Builds the compute result of the 1 x p statistics the options request,
+/// the others are left empty
+template <typename Float>
+compute_result make_compute_result(result_option options,
+                                   const std::vector<array<Float>>& statistics,
+                                   std::int64_t column_count);
+
+template <typename Float>
+partial_compute_result make_partial_result(const array<Float>& arr_n_rows,
+                                           const array<Float>& arr_min,
+                                           const array<Float>& arr_max,
+                                           const array<Float>& arr_sum,
+                                           const array<Float>& arr_sum_squares,
+                                           const array<Float>& arr_sum_squares_centered,
+                                           std::int64_t column_count);
+
+} // namespace oneapi::dal::basic_statistics::backend
@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/basic_statistics.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
+#include "oneapi/dal/test/thread_communicator.hpp"
+#include "oneapi/dal/table/csr.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+using basic_statistics::accumulation_mode;
+using basic_statistics::result_option;
+
+// The second column has zeros, so its CSR table has the implicit zeros
+static const double data[] = {
+    1.0, 0.0, //
+    2.0, 4.0, //
+    3.0, 0.0, //
+    4.0, -2.0, //
+};
+static const std::int64_t row_count = 4;
+static const std::int64_t column_count = 2;
+
+static void check_statistic(const table& t, const std::vector<double>& expected) {
+    ASSERT_EQ(t.get_row_count(), 1);
+    ASSERT_EQ(t.get_column_count(), column_count);
+    const auto values = row_accessor<const double>(t).pull();
+    for (std::int64_t j = 0; j < column_count; j++) {
+        ASSERT_NEAR(values[j], expected[j], 1e-12);
+    }
+}
+
+static void check_result(const basic_statistics::compute_result& result) {
+    const double variance_0 = 5.0 / 3.0;
+    const double variance_1 = 19.0 / 3.0;
+    check_statistic(result.get_min(), { 1.0, -2.0 });
+    check_statistic(result.get_max(), { 4.0, 4.0 });
+    check_statistic(result.get_sum(), { 10.0, 2.0 });
+    check_statistic(result.get_sum_squares(), { 30.0, 20.0 });
+    check_statistic(result.get_sum_squares_centered(), { 5.0, 19.0 });
+    check_statistic(result.get_mean(), { 2.5, 0.5 });
+    check_statistic(result.get_second_order_raw_moment(), { 7.5, 5.0 });
+    check_statistic(result.get_variance(), { variance_0, variance_1 });
+    check_statistic(result.get_standard_deviation(),
+                    { std::sqrt(variance_0), std::sqrt(variance_1) });
+    check_statistic(result.get_variation(),
+                    { std::sqrt(variance_0) / 2.5, std::sqrt(variance_1) / 0.5 });
+}
+
+TEST(basic_statistics_test, can_compute_batch) {
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto desc = basic_statistics::descriptor<double>{};
+
+    check_result(compute(desc, data_table));
+}
+
+TEST(basic_statistics_test, computes_requested_statistics_only) {
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto desc = basic_statistics::descriptor<double>{}.set_result_options(
+        result_option::min | result_option::max);
+
+    const auto result = compute(desc, data_table);
+
+    check_statistic(result.get_min(), { 1.0, -2.0 });
+    check_statistic(result.get_max(), { 4.0, 4.0 });
+    ASSERT_FALSE(result.get_sum().has_data());
+    ASSERT_FALSE(result.get_mean().has_data());
+    ASSERT_FALSE(result.get_variance().has_data());
+}
+
+TEST(basic_statistics_test, computes_mean_and_variance_only) {
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto desc = basic_statistics::descriptor<double>{}.set_result_options(
+        result_option::mean | result_option::variance);
+
+    const auto result = compute(desc, data_table);
+
+    check_statistic(result.get_mean(), { 2.5, 0.5 });
+    check_statistic(result.get_variance(), { 5.0 / 3.0, 19.0 / 3.0 });
+    ASSERT_FALSE(result.get_min().has_data());
+    ASSERT_FALSE(result.get_standard_deviation().has_data());
+}
+
+TEST(basic_statistics_test, throws_if_result_options_are_empty) {
+    ASSERT_THROW(basic_statistics::descriptor<double>{}.set_result_options(result_option{}),
+                 invalid_argument);
+}
+
+TEST(basic_statistics_test, partial_compute_matches_batch) {
+    const auto desc = basic_statistics::descriptor<double>{};
+
+    basic_statistics::partial_compute_result partial;
+    for (std::int64_t i = 0; i < row_count; i += 2) {
+        const auto block = homogen_table::wrap(data + i * column_count, 2, column_count);
+        partial = partial_compute(desc, partial, block);
+    }
+
+    check_result(finalize_compute(desc, partial));
+}
+
+TEST(basic_statistics_test, merged_partial_results_match_batch) {
+    const auto desc = basic_statistics::descriptor<double>{};
+
+    std::vector<basic_statistics::partial_compute_result> partials;
+    for (std::int64_t i = 0; i < row_count; i += 2) {
+        const auto block = homogen_table::wrap(data + i * column_count, 2, column_count);
+        partials.push_back(partial_compute(desc, block));
+    }
+
+    check_result(finalize_compute(desc, basic_statistics::merge_partial_results(desc, partials)));
+}
+
+TEST(basic_statistics_test, spmd_compute_matches_batch) {
+    const auto desc = basic_statistics::descriptor<double>{};
+    const std::int64_t rank_count = 2;
+    const std::int64_t rank_row_count = row_count / rank_count;
+
+    test::run_spmd(rank_count, [&](std::int64_t rank, const spmd::communicator& comm) {
+        const auto local_data =
+            homogen_table::wrap(data + rank * rank_row_count * column_count,
+                                rank_row_count,
+                                column_count);
+        const detail::spmd_policy<detail::host_policy> policy{ detail::host_policy{}, comm };
+        check_result(compute(policy, desc, local_data));
+    });
+}
+
+TEST(basic_statistics_test, csr_compute_matches_dense) {
+    const double values[] = { 1.0, 2.0, 4.0, 3.0, 4.0, -2.0 };
+    const std::int64_t column_indices[] = { 0, 0, 1, 0, 0, 1 };
+    const std::int64_t row_offsets[] = { 0, 1, 3, 4, 6 };
+    const auto data_table = csr_table{ array<double>::wrap(values, 6),
+                                       array<std::int64_t>::wrap(column_indices, 6),
+                                       array<std::int64_t>::wrap(row_offsets, row_count + 1),
+                                       column_count };
+    const auto desc = basic_statistics::descriptor<double, basic_statistics::method::csr>{};
+
+    check_result(compute(desc, data_table));
+
+    basic_statistics::partial_compute_result partial;
+    partial = partial_compute(desc, partial, data_table);
+    check_result(finalize_compute(desc, partial));
+}
+
+TEST(basic_statistics_test, mixed_precision_compute_matches_batch) {
+    std::vector<float> float_data(data, data + row_count * column_count);
+    const auto data_table = homogen_table::wrap(float_data.data(), row_count, column_count);
+    const auto desc = basic_statistics::descriptor<double>{}.set_accumulation_mode(
+        accumulation_mode::mixed_precision);
+
+    check_result(compute(desc, data_table));
+}
+
+TEST(basic_statistics_test, mixed_precision_float_sums_are_compensated) {
+    // The float sum of 0.1f stops growing accurately long before 2^22 terms,
+    // the compensated one stays within the float rounding of the exact sum
+    const std::int64_t count = 1 << 22;
+    const std::vector<float> values(count, 0.1f);
+    const auto data_table = homogen_table::wrap(values.data(), count, 1);
+    const auto desc = basic_statistics::descriptor<float>{}
+                          .set_result_options(result_option::sum | result_option::mean)
+                          .set_accumulation_mode(accumulation_mode::mixed_precision);
+
+    const auto result = compute(desc, data_table);
+
+    const double expected_sum = double(count) * double(0.1f);
+    const auto sum = row_accessor<const double>(result.get_sum()).pull();
+    const auto mean = row_accessor<const double>(result.get_mean()).pull();
+    ASSERT_NEAR(sum[0], expected_sum, expected_sum * 1e-6);
+    ASSERT_NEAR(mean[0], double(0.1f), 1e-6);
+}
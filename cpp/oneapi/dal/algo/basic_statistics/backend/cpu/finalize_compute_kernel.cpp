@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/low_order_moments/low_order_moments_kernel.h>
+
+#include "oneapi/dal/algo/basic_statistics/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/basic_statistics/backend/to_daal_method.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::basic_statistics::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lom_online_kernel_t =
+    daal_lom::internal::LowOrderMomentsOnlineKernel<Float, daal_lom::defaultDense, Cpu>;
+
+template <typename Float>
+static array<Float> pull_copy(const table& t) {
+    const auto src = row_accessor<const Float>{ t }.pull();
+    auto dst = array<Float>::empty(src.get_count());
+    std::copy(src.get_data(), src.get_data() + src.get_count(), dst.get_mutable_data());
+    return dst;
+}
+
+/// The min, max, sums and sums of the squares are the partial statistics
+/// themselves, DAAL derives the moments from the sums
+template <typename Float>
+static compute_result call_daal_kernel(const context_cpu& ctx,
+                                       const descriptor_base& desc,
+                                       const partial_compute_result& input) {
+    const int64_t column_count = input.get_partial_sum().get_column_count();
+
+    auto arr_n_rows = pull_copy<Float>(input.get_partial_n_rows());
+    std::vector<array<Float>> statistics = {
+        pull_copy<Float>(input.get_partial_min()),
+        pull_copy<Float>(input.get_partial_max()),
+        pull_copy<Float>(input.get_partial_sum()),
+        pull_copy<Float>(input.get_partial_sum_squares()),
+        pull_copy<Float>(input.get_partial_sum_squares_centered()),
+    };
+    for (int64_t i = statistics.size(); i < result_count; i++) {
+        statistics.push_back(array<Float>::empty(column_count));
+    }
+
+    const auto daal_n_rows = interop::convert_to_daal_homogen_table(arr_n_rows, 1, 1);
+    std::vector<daal::data_management::NumericTablePtr> daal_statistics;
+    for (auto& arr : statistics) {
+        daal_statistics.push_back(interop::convert_to_daal_homogen_table(arr, 1, column_count));
+    }
+
+    daal_lom::Parameter daal_parameter;
+    const auto status = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+        return daal_lom_online_kernel_t<Float, daal_cpu>().finalizeCompute(
+            daal_n_rows.get(),
+            daal_statistics[2].get(),
+            daal_statistics[3].get(),
+            daal_statistics[4].get(),
+            daal_statistics[5].get(),
+            daal_statistics[6].get(),
+            daal_statistics[7].get(),
+            daal_statistics[8].get(),
+            daal_statistics[9].get(),
+            &daal_parameter);
+    });
+    interop::status_to_exception(status);
+
+    return make_compute_result(desc.get_result_options(), statistics, column_count);
+}
+
+template <typename Float, typename Method>
+compute_result finalize_compute_kernel_cpu<Float, Method>::operator()(
+    const context_cpu& ctx,
+    const descriptor_base& desc,
+    const partial_compute_result& input) const {
+    return call_daal_kernel<Float>(ctx, desc, input);
+}
+
+template struct finalize_compute_kernel_cpu<float, method::dense>;
+template struct finalize_compute_kernel_cpu<double, method::dense>;
+template struct finalize_compute_kernel_cpu<float, method::csr>;
+template struct finalize_compute_kernel_cpu<double, method::csr>;
+
+} // namespace oneapi::dal::basic_statistics::backend
@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/low_order_moments/low_order_moments_kernel.h>
+
+#include "oneapi/dal/algo/basic_statistics/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/basic_statistics/backend/to_daal_method.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::basic_statistics::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_dm = daal::data_management;
+namespace interop = dal::backend::interop;
+
+/// The number of the tables of the partial result, the i-th one is the i-th
+/// DAAL low order moments partial result
+constexpr int64_t partial_count = 6;
+
+template <typename Float, typename Method, daal::CpuType Cpu>
+using daal_lom_online_kernel_t =
+    daal_lom::internal::LowOrderMomentsOnlineKernel<Float, to_daal_method<Method>::value, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lom_distributed_kernel_t =
+    daal_lom::internal::LowOrderMomentsDistributedKernel<Float, daal_lom::defaultDense, Cpu>;
+
+/// The DAAL kernels update the partial results in place, so they get copies
+/// of the tables of the prior partial result
+template <typename Float>
+static array<Float> pull_copy(const table& t) {
+    const auto src = row_accessor<const Float>{ t }.pull();
+    auto dst = array<Float>::empty(src.get_count());
+    std::copy(src.get_data(), src.get_data() + src.get_count(), dst.get_mutable_data());
+    return dst;
+}
+
+static std::vector<table> get_partial_tables(const partial_compute_result& partial) {
+    return { partial.get_partial_n_rows(),      partial.get_partial_min(),
+             partial.get_partial_max(),         partial.get_partial_sum(),
+             partial.get_partial_sum_squares(), partial.get_partial_sum_squares_centered() };
+}
+
+template <typename Float>
+partial_compute_result make_partial_result(const array<Float>& arr_n_rows,
+                                           const array<Float>& arr_min,
+                                           const array<Float>& arr_max,
+                                           const array<Float>& arr_sum,
+                                           const array<Float>& arr_sum_squares,
+                                           const array<Float>& arr_sum_squares_centered,
+                                           int64_t column_count) {
+    const auto make_table = [&](const array<Float>& arr) {
+        return dal::detail::homogen_table_builder{}.reset(arr, 1, column_count).build();
+    };
+    return partial_compute_result()
+        .set_partial_n_rows(dal::detail::homogen_table_builder{}.reset(arr_n_rows, 1, 1).build())
+        .set_partial_min(make_table(arr_min))
+        .set_partial_max(make_table(arr_max))
+        .set_partial_sum(make_table(arr_sum))
+        .set_partial_sum_squares(make_table(arr_sum_squares))
+        .set_partial_sum_squares_centered(make_table(arr_sum_squares_centered));
+}
+
+template <typename Float>
+static partial_compute_result make_partial_result(const std::vector<array<Float>>& arrays,
+                                                  int64_t column_count) {
+    return make_partial_result(arrays[0],
+                               arrays[1],
+                               arrays[2],
+                               arrays[3],
+                               arrays[4],
+                               arrays[5],
+                               column_count);
+}
+
+template <typename Float>
+static daal_lom::PartialResultPtr make_daal_partial_result(std::vector<array<Float>>& arrays,
+                                                           int64_t column_count) {
+    auto daal_partial = daal_lom::PartialResultPtr(new daal_lom::PartialResult());
+    daal_partial->set(daal_lom::nObservations,
+                      interop::convert_to_daal_homogen_table(arrays[0], 1, 1));
+    for (int64_t i = 1; i < partial_count; i++) {
+        daal_partial->set(static_cast<daal_lom::PartialResultId>(i),
+                          interop::convert_to_daal_homogen_table(arrays[i], 1, column_count));
+    }
+    return daal_partial;
+}
+
+/// The partial compute accumulates all estimates, so the partial results of
+/// the blocks can be merged and finalized with any result options
+template <typename Float, typename Method>
+static partial_compute_result call_daal_kernel(const context_cpu& ctx,
+                                               const descriptor_base& desc,
+                                               const partial_compute_result& prior,
+                                               const table& data) {
+    const int64_t column_count = data.get_column_count();
+
+    const bool has_prior = prior.get_partial_n_rows().has_data();
+    const auto prior_tables = get_partial_tables(prior);
+    std::vector<array<Float>> arrays;
+    for (int64_t i = 0; i < partial_count; i++) {
+        arrays.push_back(has_prior ? pull_copy<Float>(prior_tables[i])
+                                   : array<Float>::zeros(i == 0 ? 1 : column_count));
+    }
+
+    const auto daal_data = interop::convert_to_daal_table_by_kind<Float>(data);
+    const auto daal_partial = make_daal_partial_result(arrays, column_count);
+
+    daal_lom::Parameter daal_parameter(daal_lom::estimatesAll);
+    const auto status = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+        return daal_lom_online_kernel_t<Float, Method, daal_cpu>().compute(daal_data.get(),
+                                                                          daal_partial.get(),
+                                                                          &daal_parameter,
+                                                                          has_prior);
+    });
+    interop::status_to_exception(status);
+
+    return make_partial_result(arrays, column_count);
+}
+
+template <typename Float, typename Method>
+partial_compute_result partial_compute_kernel_cpu<Float, Method>::operator()(
+    const context_cpu& ctx,
+    const descriptor_base& desc,
+    const partial_compute_input& input) const {
+    return call_daal_kernel<Float, Method>(ctx, desc, input.get_prior(), input.get_data());
+}
+
+template <typename Float>
+partial_compute_result merge_kernel_cpu<Float>::operator()(
+    const context_cpu& ctx,
+    const std::vector<partial_compute_result>& partial_results) const {
+    const int64_t column_count = partial_results.front().get_partial_sum().get_column_count();
+
+    daal_dm::DataCollection daal_partial_results;
+    for (const auto& partial : partial_results) {
+        std::vector<array<Float>> partial_arrays;
+        for (const auto& t : get_partial_tables(partial)) {
+            partial_arrays.push_back(pull_copy<Float>(t));
+        }
+        daal_partial_results.push_back(make_daal_partial_result(partial_arrays, column_count));
+    }
+
+    std::vector<array<Float>> arrays;
+    for (int64_t i = 0; i < partial_count; i++) {
+        arrays.push_back(array<Float>::empty(i == 0 ? 1 : column_count));
+    }
+    const auto daal_partial = make_daal_partial_result(arrays, column_count);
+
+    daal_lom::Parameter daal_parameter(daal_lom::estimatesAll);
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_lom_distributed_kernel_t>(ctx,
+                                                                       &daal_partial_results,
+                                                                       daal_partial.get(),
+                                                                       &daal_parameter));
+
+    return make_partial_result(arrays, column_count);
+}
+
+template <typename Float>
+partial_compute_result spmd_merge_kernel_cpu<Float>::operator()(
+    const context_cpu& ctx,
+    const spmd::communicator& comm,
+    const partial_compute_result& local_partial) const {
+    const int64_t column_count = local_partial.get_partial_sum().get_column_count();
+    const int64_t packed_size = 1 + (partial_count - 1) * column_count;
+
+    // The partial results are small, so they are gathered as one packed
+    // array [n_rows, min, max, sum, sum_squares, sum_squares_centered] per
+    // process
+    std::vector<Float> packed(packed_size);
+    {
+        const auto tables = get_partial_tables(local_partial);
+        const auto n_rows = row_accessor<const Float>{ tables[0] }.pull();
+        packed[0] = n_rows[0];
+        for (int64_t i = 1; i < partial_count; i++) {
+            const auto values = row_accessor<const Float>{ tables[i] }.pull();
+            std::copy(values.get_data(),
+                      values.get_data() + column_count,
+                      packed.data() + 1 + (i - 1) * column_count);
+        }
+    }
+    const auto gathered = comm.allgather(packed.data(), packed_size);
+
+    std::vector<partial_compute_result> partials;
+    for (int64_t rank = 0; rank < comm.get_rank_count(); rank++) {
+        const Float* rank_packed = gathered.data() + rank * packed_size;
+        std::vector<array<Float>> arrays;
+        arrays.push_back(array<Float>::full(1, rank_packed[0]));
+        for (int64_t i = 1; i < partial_count; i++) {
+            auto arr = array<Float>::empty(column_count);
+            const Float* src = rank_packed + 1 + (i - 1) * column_count;
+            std::copy(src, src + column_count, arr.get_mutable_data());
+            arrays.push_back(arr);
+        }
+        partials.push_back(make_partial_result(arrays, column_count));
+    }
+
+    return merge_kernel_cpu<Float>{}(ctx, partials);
+}
+
+template struct partial_compute_kernel_cpu<float, method::dense>;
+template struct partial_compute_kernel_cpu<double, method::dense>;
+template struct partial_compute_kernel_cpu<float, method::csr>;
+template struct partial_compute_kernel_cpu<double, method::csr>;
+
+template struct merge_kernel_cpu<float>;
+template struct merge_kernel_cpu<double>;
+
+template struct spmd_merge_kernel_cpu<float>;
+template struct spmd_merge_kernel_cpu<double>;
+
+template partial_compute_result make_partial_result<float>(const array<float>&,
+                                                           const array<float>&,
+                                                           const array<float>&,
+                                                           const array<float>&,
+                                                           const array<float>&,
+                                                           const array<float>&,
+                                                           int64_t);
+template partial_compute_result make_partial_result<double>(const array<double>&,
+                                                            const array<double>&,
+                                                            const array<double>&,
+                                                            const array<double>&,
+                                                            const array<double>&,
+                                                            const array<double>&,
+                                                            int64_t);
+
+} // namespace oneapi::dal::basic_statistics::backend
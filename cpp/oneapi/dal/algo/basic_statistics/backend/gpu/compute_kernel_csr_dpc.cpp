@@ -0,0 +1,264 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+
+#include "oneapi/dal/algo/basic_statistics/backend/gpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/csr_kernels_dpc.hpp"
+
+namespace oneapi::dal::basic_statistics::backend {
+
+using dal::backend::context_gpu;
+using dal::backend::csr_device_data;
+
+template <typename Float>
+class csr_block_moments_kernel;
+template <typename Float>
+class csr_column_moments_kernel;
+template <typename Float>
+class csr_block_centered_kernel;
+template <typename Float>
+class csr_column_centered_kernel;
+
+/// The largest number of the values of one statistic of all blocks, the
+/// blocks of rows are reduced without atomics
+constexpr std::int64_t max_block_values = 1 << 20;
+
+/// The statistics the two passes over the non-zero values accumulate, the
+/// second pass runs only if the centered sums are needed
+struct csr_passes {
+    bool min_max;
+    bool centered;
+};
+
+static csr_passes get_passes(result_option options) {
+    const auto needs = [&](result_option set) {
+        return check_mask_flag(options, set);
+    };
+    return { needs(result_option::min | result_option::max),
+             needs(result_option::sum_squares_centered | result_option::variance |
+                   result_option::standard_deviation | result_option::variation) };
+}
+
+/// Computes the partial statistics of the rows of the CSR table on the device.
+/// Every work-item of the first kernel accumulates the non-zero values of a
+/// block of rows to the statistics of the block, the second one reduces the
+/// blocks of every column and accounts for the implicit zeros of the column.
+template <typename Float>
+static partial_compute_result compute_partial(sycl::queue& queue,
+                                              const table& data,
+                                              const csr_passes& passes) {
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+
+    const csr_device_data<Float> csr{ queue, data };
+    const Float* values = csr.values.get_data();
+    const std::int64_t* indices = csr.column_indices.get_data();
+    const std::int64_t* offsets = csr.row_offsets.get_data();
+
+    const std::int64_t block_count =
+        std::max<std::int64_t>(1, std::min(row_count, max_block_values / column_count));
+    const std::int64_t rows_per_block = (row_count + block_count - 1) / block_count;
+    const std::int64_t block_size = block_count * column_count;
+
+    const auto alloc = sycl::usm::alloc::device;
+    auto arr_block_nnz = array<Float>::empty(queue, block_size, alloc);
+    auto arr_block_sum = array<Float>::empty(queue, block_size, alloc);
+    auto arr_block_sum2 = array<Float>::empty(queue, block_size, alloc);
+    auto arr_block_min = array<Float>::empty(queue, passes.min_max ? block_size : 1, alloc);
+    auto arr_block_max = array<Float>::empty(queue, passes.min_max ? block_size : 1, alloc);
+    Float* block_nnz = arr_block_nnz.get_mutable_data();
+    Float* block_sum = arr_block_sum.get_mutable_data();
+    Float* block_sum2 = arr_block_sum2.get_mutable_data();
+    Float* block_min = arr_block_min.get_mutable_data();
+    Float* block_max = arr_block_max.get_mutable_data();
+
+    auto arr_n_rows = array<Float>::full(queue, 1, Float(row_count));
+    auto arr_nnz = array<Float>::empty(queue, column_count, alloc);
+    auto arr_min = array<Float>::zeros(queue, column_count);
+    auto arr_max = array<Float>::zeros(queue, column_count);
+    auto arr_sum = array<Float>::empty(queue, column_count);
+    auto arr_sum2 = array<Float>::empty(queue, column_count);
+    auto arr_sum2c = array<Float>::zeros(queue, column_count);
+    Float* nnz = arr_nnz.get_mutable_data();
+    Float* min = arr_min.get_mutable_data();
+    Float* max = arr_max.get_mutable_data();
+    Float* sum = arr_sum.get_mutable_data();
+    Float* sum2 = arr_sum2.get_mutable_data();
+    Float* sum2c = arr_sum2c.get_mutable_data();
+
+    const bool min_max = passes.min_max;
+    const Float max_value = std::numeric_limits<Float>::max();
+
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<csr_block_moments_kernel<Float>>(
+                sycl::range<1>(block_count),
+                [=](sycl::id<1> idx) {
+                    const std::int64_t b = idx[0];
+                    const std::int64_t slot = b * column_count;
+                    for (std::int64_t j = 0; j < column_count; ++j) {
+                        block_nnz[slot + j] = Float(0);
+                        block_sum[slot + j] = Float(0);
+                        block_sum2[slot + j] = Float(0);
+                        if (min_max) {
+                            block_min[slot + j] = max_value;
+                            block_max[slot + j] = -max_value;
+                        }
+                    }
+                    const std::int64_t first = b * rows_per_block;
+                    const std::int64_t last = sycl::min(first + rows_per_block, row_count);
+                    for (std::int64_t i = first; i < last; ++i) {
+                        for (std::int64_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+                            const std::int64_t j = slot + indices[k];
+                            const Float value = values[k];
+                            block_nnz[j] += Float(1);
+                            block_sum[j] += value;
+                            block_sum2[j] += value * value;
+                            if (min_max) {
+                                block_min[j] = sycl::min(block_min[j], value);
+                                block_max[j] = sycl::max(block_max[j], value);
+                            }
+                        }
+                    }
+                });
+        })
+        .wait_and_throw();
+
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<csr_column_moments_kernel<Float>>(
+                sycl::range<1>(column_count),
+                [=](sycl::id<1> idx) {
+                    const std::int64_t j = idx[0];
+                    Float nnz_j = Float(0);
+                    Float sum_j = Float(0);
+                    Float sum2_j = Float(0);
+                    Float min_j = max_value;
+                    Float max_j = -max_value;
+                    for (std::int64_t b = 0; b < block_count; ++b) {
+                        const std::int64_t slot = b * column_count + j;
+                        nnz_j += block_nnz[slot];
+                        sum_j += block_sum[slot];
+                        sum2_j += block_sum2[slot];
+                        if (min_max) {
+                            min_j = sycl::min(min_j, block_min[slot]);
+                            max_j = sycl::max(max_j, block_max[slot]);
+                        }
+                    }
+                    nnz[j] = nnz_j;
+                    sum[j] = sum_j;
+                    sum2[j] = sum2_j;
+                    if (min_max) {
+                        // The implicit zeros of the column take part in the min and max
+                        const bool has_zeros = nnz_j < Float(row_count);
+                        min[j] = has_zeros ? sycl::min(min_j, Float(0)) : min_j;
+                        max[j] = has_zeros ? sycl::max(max_j, Float(0)) : max_j;
+                    }
+                });
+        })
+        .wait_and_throw();
+
+    if (passes.centered) {
+        queue
+            .submit([&](sycl::handler& cgh) {
+                cgh.parallel_for<csr_block_centered_kernel<Float>>(
+                    sycl::range<1>(block_count),
+                    [=](sycl::id<1> idx) {
+                        const std::int64_t b = idx[0];
+                        const std::int64_t slot = b * column_count;
+                        for (std::int64_t j = 0; j < column_count; ++j) {
+                            block_sum2[slot + j] = Float(0);
+                        }
+                        const std::int64_t first = b * rows_per_block;
+                        const std::int64_t last = sycl::min(first + rows_per_block, row_count);
+                        for (std::int64_t i = first; i < last; ++i) {
+                            for (std::int64_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+                                const std::int64_t j = indices[k];
+                                const Float value = values[k] - sum[j] / Float(row_count);
+                                block_sum2[slot + j] += value * value;
+                            }
+                        }
+                    });
+            })
+            .wait_and_throw();
+
+        queue
+            .submit([&](sycl::handler& cgh) {
+                cgh.parallel_for<csr_column_centered_kernel<Float>>(
+                    sycl::range<1>(column_count),
+                    [=](sycl::id<1> idx) {
+                        const std::int64_t j = idx[0];
+                        const Float mean = sum[j] / Float(row_count);
+                        // Every implicit zero of the column adds mean^2
+                        Float sum2c_j = (Float(row_count) - nnz[j]) * mean * mean;
+                        for (std::int64_t b = 0; b < block_count; ++b) {
+                            sum2c_j += block_sum2[b * column_count + j];
+                        }
+                        sum2c[j] = sum2c_j;
+                    });
+            })
+            .wait_and_throw();
+    }
+
+    return make_partial_result(arr_n_rows,
+                               arr_min,
+                               arr_max,
+                               arr_sum,
+                               arr_sum2,
+                               arr_sum2c,
+                               column_count);
+}
+
+/// The moments are derived from the p sums on the host
+template <typename Float>
+struct compute_kernel_gpu<Float, method::csr> {
+    compute_result operator()(const context_gpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) const {
+        const auto partial =
+            compute_partial<Float>(ctx.get_queue(),
+                                   input.get_data(),
+                                   get_passes(desc.get_result_options()));
+        const auto cpu_ctx = dal::backend::context_cpu{ dal::detail::host_policy{} };
+        return finalize_compute_kernel_cpu<Float, method::csr>{}(cpu_ctx, desc, partial);
+    }
+};
+
+/// The statistics of the block are merged with the prior ones on the host
+template <typename Float>
+struct partial_compute_kernel_gpu<Float, method::csr> {
+    partial_compute_result operator()(const context_gpu& ctx,
+                                      const descriptor_base& desc,
+                                      const partial_compute_input& input) const {
+        const auto partial =
+            compute_partial<Float>(ctx.get_queue(), input.get_data(), csr_passes{ true, true });
+        if (!input.get_prior().get_partial_n_rows().has_data()) {
+            return partial;
+        }
+        const auto cpu_ctx = dal::backend::context_cpu{ dal::detail::host_policy{} };
+        return merge_kernel_cpu<Float>{}(cpu_ctx, { input.get_prior(), partial });
+    }
+};
+
+template struct compute_kernel_gpu<float, method::csr>;
+template struct compute_kernel_gpu<double, method::csr>;
+
+template struct partial_compute_kernel_gpu<float, method::csr>;
+template struct partial_compute_kernel_gpu<double, method::csr>;
+
+} // namespace oneapi::dal::basic_statistics::backend
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/low_order_moments/oneapi/low_order_moments_kernel_batch_oneapi.h>
+
+#include "oneapi/dal/algo/basic_statistics/backend/gpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/basic_statistics/backend/to_daal_method.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::basic_statistics::backend {
+
+using std::int64_t;
+using dal::backend::context_gpu;
+
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_lom_gpu_kernel_t =
+    daal_lom::oneapi::internal::LowOrderMomentsBatchKernelOneAPI<Float, daal_lom::defaultDense>;
+
+/// The DAAL kernel runs the device reduction of the estimates the options
+/// need only, e.g. the min and max options do not accumulate any sums
+template <typename Float>
+static compute_result call_daal_kernel(const context_gpu& ctx,
+                                       const descriptor_base& desc,
+                                       const table& data) {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+    const auto options = desc.get_result_options();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, column_count);
+
+    std::vector<array<Float>> statistics;
+    auto daal_result = daal_lom::ResultPtr(new daal_lom::Result());
+    for (int64_t i = 0; i < result_count; i++) {
+        statistics.push_back(array<Float>::zeros(queue, column_count));
+        daal_result->set(static_cast<daal_lom::ResultId>(i),
+                         interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                     statistics.back(),
+                                                                     1,
+                                                                     column_count));
+    }
+
+    daal_lom::Parameter daal_parameter(to_daal_estimates(options));
+    const auto status =
+        daal_lom_gpu_kernel_t<Float>().compute(daal_data.get(), daal_result.get(), &daal_parameter);
+    interop::status_to_exception(status);
+
+    return make_compute_result(options, statistics, column_count);
+}
+
+template <typename Float>
+struct compute_kernel_gpu<Float, method::dense> {
+    compute_result operator()(const context_gpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) const {
+        return call_daal_kernel<Float>(ctx, desc, input.get_data());
+    }
+};
+
+template struct compute_kernel_gpu<float, method::dense>;
+template struct compute_kernel_gpu<double, method::dense>;
+
+} // namespace oneapi::dal::basic_statistics::backend
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/low_order_moments/oneapi/low_order_moments_kernel_online_oneapi.h>
+
+#include "oneapi/dal/algo/basic_statistics/backend/gpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/basic_statistics/backend/to_daal_method.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::basic_statistics::backend {
+
+using std::int64_t;
+using dal::backend::context_gpu;
+
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_lom_online_gpu_kernel_t =
+    daal_lom::oneapi::internal::LowOrderMomentsOnlineKernelOneAPI<Float, daal_lom::defaultDense>;
+
+/// The DAAL kernel updates the partial results in place, so it gets device
+/// copies of the tables of the prior partial result
+template <typename Float>
+static array<Float> pull_copy(sycl::queue& queue, const table& t, int64_t count) {
+    if (!t.has_data()) {
+        return array<Float>::zeros(queue, count);
+    }
+    const auto src = row_accessor<const Float>{ t }.pull(queue);
+    auto dst = array<Float>::empty(queue, count);
+    queue.memcpy(dst.get_mutable_data(), src.get_data(), sizeof(Float) * count).wait_and_throw();
+    return dst;
+}
+
+template <typename Float>
+static partial_compute_result call_daal_kernel(const context_gpu& ctx,
+                                               const descriptor_base& desc,
+                                               const partial_compute_result& prior,
+                                               const table& data) {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+    const bool has_prior = prior.get_partial_n_rows().has_data();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    auto arr_n_rows = pull_copy<Float>(queue, prior.get_partial_n_rows(), 1);
+    std::vector<array<Float>> partials = {
+        pull_copy<Float>(queue, prior.get_partial_min(), column_count),
+        pull_copy<Float>(queue, prior.get_partial_max(), column_count),
+        pull_copy<Float>(queue, prior.get_partial_sum(), column_count),
+        pull_copy<Float>(queue, prior.get_partial_sum_squares(), column_count),
+        pull_copy<Float>(queue, prior.get_partial_sum_squares_centered(), column_count),
+    };
+
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, column_count);
+    auto daal_partial = daal_lom::PartialResultPtr(new daal_lom::PartialResult());
+    daal_partial->set(daal_lom::nObservations,
+                      interop::convert_to_daal_sycl_homogen_table(queue, arr_n_rows, 1, 1));
+    for (std::size_t i = 0; i < partials.size(); i++) {
+        daal_partial->set(
+            static_cast<daal_lom::PartialResultId>(i + 1),
+            interop::convert_to_daal_sycl_homogen_table(queue, partials[i], 1, column_count));
+    }
+
+    daal_lom::Parameter daal_parameter(daal_lom::estimatesAll);
+    const auto status = daal_lom_online_gpu_kernel_t<Float>().compute(daal_data.get(),
+                                                                    daal_partial.get(),
+                                                                    &daal_parameter,
+                                                                    has_prior);
+    interop::status_to_exception(status);
+
+    return make_partial_result(arr_n_rows,
+                               partials[0],
+                               partials[1],
+                               partials[2],
+                               partials[3],
+                               partials[4],
+                               column_count);
+}
+
+template <typename Float>
+struct partial_compute_kernel_gpu<Float, method::dense> {
+    partial_compute_result operator()(const context_gpu& ctx,
+                                      const descriptor_base& desc,
+                                      const partial_compute_input& input) const {
+        return call_daal_kernel<Float>(ctx, desc, input.get_prior(), input.get_data());
+    }
+};
+
+template struct partial_compute_kernel_gpu<float, method::dense>;
+template struct partial_compute_kernel_gpu<double, method::dense>;
+
+} // namespace oneapi::dal::basic_statistics::backend
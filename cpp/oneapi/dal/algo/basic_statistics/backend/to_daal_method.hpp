@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <include/algorithms/moments/low_order_moments_types.h>
+
+#include "oneapi/dal/algo/basic_statistics/common.hpp"
+
+namespace daal_lom = daal::algorithms::low_order_moments;
+
+namespace oneapi::dal::basic_statistics::backend {
+
+template <daal_lom::Method Value>
+using daal_method_constant = std::integral_constant<daal_lom::Method, Value>;
+
+template <typename Method>
+struct to_daal_method;
+
+template <>
+struct to_daal_method<method::dense> : daal_method_constant<daal_lom::defaultDense> {};
+
+template <>
+struct to_daal_method<method::csr> : daal_method_constant<daal_lom::fastCSR> {};
+
+/// The smallest set of the DAAL estimates that covers the requested results.
+/// The DAAL kernels accumulate only the estimates of the set in one pass over
+/// the rows, e.g. the min and max options do not accumulate any sums.
+inline daal_lom::EstimatesToCompute to_daal_estimates(result_option options) {
+    const auto covered_by = [&](result_option set) {
+        return bitwise_and(options, set) == options;
+    };
+    if (covered_by(result_option::min | result_option::max)) {
+        return daal_lom::estimatesMinMax;
+    }
+    if (covered_by(result_option::mean)) {
+        return daal_lom::estimatesMean;
+    }
+    if (covered_by(result_option::mean | result_option::variance)) {
+        return daal_lom::estimatesMeanVariance;
+    }
+    if (covered_by(result_option::min | result_option::max | result_option::mean |
+                   result_option::variance)) {
+        return daal_lom::estimatesMinMaxMeanVariance;
+    }
+    return daal_lom::estimatesAll;
+}
+
+} // namespace oneapi::dal::basic_statistics::backend
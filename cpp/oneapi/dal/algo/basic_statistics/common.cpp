@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/basic_statistics/common.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::basic_statistics {
+
+class detail::descriptor_impl : public base {
+public:
+    result_option result_options = result_option::all;
+    accumulation_mode accumulation = accumulation_mode::standard;
+};
+
+using detail::descriptor_impl;
+
+descriptor_base::descriptor_base() : impl_(new descriptor_impl{}) {}
+
+result_option descriptor_base::get_result_options() const {
+    return impl_->result_options;
+}
+
+accumulation_mode descriptor_base::get_accumulation_mode() const {
+    return impl_->accumulation;
+}
+
+void descriptor_base::set_result_options_impl(result_option value) {
+    if (bitwise_and(value, result_option::all) != value ||
+        !check_mask_flag(value, result_option::all)) {
+        throw invalid_argument("Result options should be a non-empty set of result_option flags");
+    }
+    impl_->result_options = value;
+}
+
+void descriptor_base::set_accumulation_mode_impl(accumulation_mode value) {
+    impl_->accumulation = value;
+}
+
+} // namespace oneapi::dal::basic_statistics
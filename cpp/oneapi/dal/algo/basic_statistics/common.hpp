@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/util/common.hpp"
+
+namespace oneapi::dal::basic_statistics {
+
+namespace detail {
+struct tag {};
+class descriptor_impl;
+} // namespace detail
+
+namespace method {
+struct dense {};
+struct csr {};
+using by_default = dense;
+} // namespace method
+
+/// The statistics of the columns the compute returns
+enum class result_option : std::uint64_t {
+    min = 0x00000001ULL,
+    max = 0x00000002ULL,
+    sum = 0x00000004ULL,
+    sum_squares = 0x00000008ULL,
+    sum_squares_centered = 0x00000010ULL,
+    mean = 0x00000020ULL,
+    second_order_raw_moment = 0x00000040ULL,
+    variance = 0x00000080ULL,
+    standard_deviation = 0x00000100ULL,
+    variation = 0x00000200ULL,
+    all = 0x000003FFULL
+};
+
+/// How the sums of the compute are accumulated. The standard mode converts the
+/// data to the floating-point type of the descriptor first. The mixed precision
+/// mode reads a float32 table as it is stored and accumulates its sums in
+/// double for the double descriptor, or with the compensated float summation
+/// for the float one, so the accuracy is that of the double sums at the memory
+/// traffic of the float data.
+enum class accumulation_mode { standard, mixed_precision };
+
+inline result_option operator|(result_option value_left, result_option value_right) {
+    return bitwise_or(value_left, value_right);
+}
+
+inline result_option& operator|=(result_option& value_left, result_option value_right) {
+    value_left = value_left | value_right;
+    return value_left;
+}
+
+inline result_option operator&(result_option value_left, result_option value_right) {
+    return bitwise_and(value_left, value_right);
+}
+
+inline result_option& operator&=(result_option& value_left, result_option value_right) {
+    value_left = value_left & value_right;
+    return value_left;
+}
+
+class ONEAPI_DAL_EXPORT descriptor_base : public base {
+public:
+    using tag_t = detail::tag;
+    using float_t = float;
+    using method_t = method::by_default;
+
+    descriptor_base();
+
+    /// The statistics to compute, all of them by default. The batch compute
+    /// runs the single pass over the data that accumulates only the
+    /// statistics the requested ones are derived from. The partial compute
+    /// accumulates all of them, so its results can be merged and finalized
+    /// with any options.
+    result_option get_result_options() const;
+
+    /// The accumulation of the sums, the standard one by default
+    accumulation_mode get_accumulation_mode() const;
+
+protected:
+    void set_result_options_impl(result_option value);
+    void set_accumulation_mode_impl(accumulation_mode value);
+
+    dal::detail::pimpl<detail::descriptor_impl> impl_;
+};
+
+template <typename Float = descriptor_base::float_t, typename Method = descriptor_base::method_t>
+class descriptor : public descriptor_base {
+public:
+    using float_t = Float;
+    using method_t = Method;
+
+    auto& set_result_options(result_option value) {
+        set_result_options_impl(value);
+        return *this;
+    }
+
+    auto& set_accumulation_mode(accumulation_mode value) {
+        set_accumulation_mode_impl(value);
+        return *this;
+    }
+};
+
+} // namespace oneapi::dal::basic_statistics
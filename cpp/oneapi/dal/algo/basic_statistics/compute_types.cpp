@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/basic_statistics/compute_types.hpp"
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::basic_statistics {
+
+class detail::compute_input_impl : public base {
+public:
+    compute_input_impl(const table& data) : data(data) {}
+    table data;
+};
+
+class detail::compute_result_impl : public base {
+public:
+    table min;
+    table max;
+    table sum;
+    table sum_squares;
+    table sum_squares_centered;
+    table mean;
+    table second_order_raw_moment;
+    table variance;
+    table standard_deviation;
+    table variation;
+};
+
+using detail::compute_input_impl;
+using detail::compute_result_impl;
+
+compute_input::compute_input(const table& data) : impl_(new compute_input_impl(data)) {}
+
+table compute_input::get_data() const {
+    return impl_->data;
+}
+
+void compute_input::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+compute_result::compute_result() : impl_(new compute_result_impl{}) {}
+
+table compute_result::get_min() const {
+    return impl_->min;
+}
+
+table compute_result::get_max() const {
+    return impl_->max;
+}
+
+table compute_result::get_sum() const {
+    return impl_->sum;
+}
+
+table compute_result::get_sum_squares() const {
+    return impl_->sum_squares;
+}
+
+table compute_result::get_sum_squares_centered() const {
+    return impl_->sum_squares_centered;
+}
+
+table compute_result::get_mean() const {
+    return impl_->mean;
+}
+
+table compute_result::get_second_order_raw_moment() const {
+    return impl_->second_order_raw_moment;
+}
+
+table compute_result::get_variance() const {
+    return impl_->variance;
+}
+
+table compute_result::get_standard_deviation() const {
+    return impl_->standard_deviation;
+}
+
+table compute_result::get_variation() const {
+    return impl_->variation;
+}
+
+void compute_result::set_min_impl(const table& value) {
+    impl_->min = value;
+}
+
+void compute_result::set_max_impl(const table& value) {
+    impl_->max = value;
+}
+
+void compute_result::set_sum_impl(const table& value) {
+    impl_->sum = value;
+}
+
+void compute_result::set_sum_squares_impl(const table& value) {
+    impl_->sum_squares = value;
+}
+
+void compute_result::set_sum_squares_centered_impl(const table& value) {
+    impl_->sum_squares_centered = value;
+}
+
+void compute_result::set_mean_impl(const table& value) {
+    impl_->mean = value;
+}
+
+void compute_result::set_second_order_raw_moment_impl(const table& value) {
+    impl_->second_order_raw_moment = value;
+}
+
+void compute_result::set_variance_impl(const table& value) {
+    impl_->variance = value;
+}
+
+void compute_result::set_standard_deviation_impl(const table& value) {
+    impl_->standard_deviation = value;
+}
+
+void compute_result::set_variation_impl(const table& value) {
+    impl_->variation = value;
+}
+
+} // namespace oneapi::dal::basic_statistics
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/algo/basic_statistics/common.hpp"
+
+namespace oneapi::dal::basic_statistics {
+
+namespace detail {
+class compute_input_impl;
+class compute_result_impl;
+} // namespace detail
+
+class ONEAPI_DAL_EXPORT compute_input : public base {
+public:
+    compute_input(const table& data);
+
+    table get_data() const;
+
+    auto& set_data(const table& data) {
+        set_data_impl(data);
+        return *this;
+    }
+
+private:
+    void set_data_impl(const table& data);
+
+    dal::detail::pimpl<detail::compute_input_impl> impl_;
+};
+
+/// The 1 x p tables of the statistics of the columns, the statistics not
+/// requested by the result options of the descriptor are empty tables
+class ONEAPI_DAL_EXPORT compute_result : public base {
+public:
+    compute_result();
+
+    /// The 1 x p table of the column minimums
+    table get_min() const;
+
+    /// The 1 x p table of the column maximums
+    table get_max() const;
+
+    /// The 1 x p table of the column sums
+    table get_sum() const;
+
+    /// The 1 x p table of the column sums of the squares
+    table get_sum_squares() const;
+
+    /// The 1 x p table of the column sums of the squares of the centered values
+    table get_sum_squares_centered() const;
+
+    /// The 1 x p table of the column means
+    table get_mean() const;
+
+    /// The 1 x p table of the column second order raw moments
+    table get_second_order_raw_moment() const;
+
+    /// The 1 x p table of the column variances with the n - 1 divisor
+    table get_variance() const;
+
+    /// The 1 x p table of the column standard deviations
+    table get_standard_deviation() const;
+
+    /// The 1 x p table of the column coefficients of variation
+    table get_variation() const;
+
+    auto& set_min(const table& value) {
+        set_min_impl(value);
+        return *this;
+    }
+
+    auto& set_max(const table& value) {
+        set_max_impl(value);
+        return *this;
+    }
+
+    auto& set_sum(const table& value) {
+        set_sum_impl(value);
+        return *this;
+    }
+
+    auto& set_sum_squares(const table& value) {
+        set_sum_squares_impl(value);
+        return *this;
+    }
+
+    auto& set_sum_squares_centered(const table& value) {
+        set_sum_squares_centered_impl(value);
+        return *this;
+    }
+
+    auto& set_mean(const table& value) {
+        set_mean_impl(value);
+        return *this;
+    }
+
+    auto& set_second_order_raw_moment(const table& value) {
+        set_second_order_raw_moment_impl(value);
+        return *this;
+    }
+
+    auto& set_variance(const table& value) {
+        set_variance_impl(value);
+        return *this;
+    }
+
+    auto& set_standard_deviation(const table& value) {
+        set_standard_deviation_impl(value);
+        return *this;
+    }
+
+    auto& set_variation(const table& value) {
+        set_variation_impl(value);
+        return *this;
+    }
+
+private:
+    void set_min_impl(const table&);
+    void set_max_impl(const table&);
+    void set_sum_impl(const table&);
+    void set_sum_squares_impl(const table&);
+    void set_sum_squares_centered_impl(const table&);
+    void set_mean_impl(const table&);
+    void set_second_order_raw_moment_impl(const table&);
+    void set_variance_impl(const table&);
+    void set_standard_deviation_impl(const table&);
+    void set_variation_impl(const table&);
+
+    dal::detail::pimpl<detail::compute_result_impl> impl_;
+};
+
+} // namespace oneapi::dal::basic_statistics
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/algo/basic_statistics/compute_types.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/csr.hpp"
+
+namespace oneapi::dal::basic_statistics::detail {
+
+template <typename Context, typename... Options>
+struct compute_ops_dispatcher {
+    compute_result operator()(const Context&, const descriptor_base&, const compute_input&) const;
+};
+
+/// Checks that the statistics requested by the result options are
+/// 1 x column_count tables
+inline void check_result_tables(result_option options,
+                                const compute_result& result,
+                                std::int64_t column_count) {
+    const auto check = [&](result_option option, const table& t) {
+        if (check_mask_flag(options, option) &&
+            (t.get_row_count() != 1 || t.get_column_count() != column_count)) {
+            throw internal_error("Result statistics should be 1 x column_count tables");
+        }
+    };
+    check(result_option::min, result.get_min());
+    check(result_option::max, result.get_max());
+    check(result_option::sum, result.get_sum());
+    check(result_option::sum_squares, result.get_sum_squares());
+    check(result_option::sum_squares_centered, result.get_sum_squares_centered());
+    check(result_option::mean, result.get_mean());
+    check(result_option::second_order_raw_moment, result.get_second_order_raw_moment());
+    check(result_option::variance, result.get_variance());
+    check(result_option::standard_deviation, result.get_standard_deviation());
+    check(result_option::variation, result.get_variation());
+}
+
+template <typename Descriptor>
+struct compute_ops {
+    using float_t = typename Descriptor::float_t;
+    using method_t = typename Descriptor::method_t;
+    using input_t = compute_input;
+    using result_t = compute_result;
+    using descriptor_base_t = descriptor_base;
+
+    void check_preconditions(const Descriptor& params, const compute_input& input) const {
+        if (!(input.get_data().has_data())) {
+            throw domain_error("Input data should not be empty");
+        }
+        if constexpr (std::is_same_v<method_t, method::csr>) {
+            if (input.get_data().get_kind() != csr_table::kind()) {
+                throw invalid_argument("Input data should be CSR table for csr method");
+            }
+        }
+    }
+
+    void check_postconditions(const Descriptor& params,
+                              const compute_input& input,
+                              const compute_result& result) const {
+        check_result_tables(params.get_result_options(),
+                            result,
+                            input.get_data().get_column_count());
+    }
+
+    template <typename Context>
+    auto operator()(const Context& ctx, const Descriptor& desc, const compute_input& input) const {
+        check_preconditions(desc, input);
+        const auto result = compute_ops_dispatcher<Context, float_t, method_t>()(ctx, desc, input);
+        check_postconditions(desc, input, result);
+        return result;
+    }
+};
+
+} // namespace oneapi::dal::basic_statistics::detail
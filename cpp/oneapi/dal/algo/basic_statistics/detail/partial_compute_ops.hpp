@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+
+#include "oneapi/dal/algo/basic_statistics/partial_compute_types.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/csr.hpp"
+
+namespace oneapi::dal::basic_statistics::detail {
+
+template <typename Context, typename... Options>
+struct partial_compute_ops_dispatcher {
+    partial_compute_result operator()(const Context&,
+                                      const descriptor_base&,
+                                      const partial_compute_input&) const;
+};
+
+template <typename Descriptor>
+struct partial_compute_ops {
+    using float_t = typename Descriptor::float_t;
+    using method_t = typename Descriptor::method_t;
+    using input_t = partial_compute_input;
+    using result_t = partial_compute_result;
+    using descriptor_base_t = descriptor_base;
+
+    void check_preconditions(const Descriptor& params, const input_t& input) const {
+        const auto& data = input.get_data();
+        if (!(data.has_data())) {
+            throw domain_error("Input data should not be empty");
+        }
+        if constexpr (std::is_same_v<method_t, method::csr>) {
+            if (data.get_kind() != csr_table::kind()) {
+                throw invalid_argument("Input data should be CSR table for csr method");
+            }
+        }
+        const auto& prior_sum = input.get_prior().get_partial_sum();
+        if (prior_sum.has_data() && prior_sum.get_column_count() != data.get_column_count()) {
+            throw invalid_argument(
+                "Input data column_count should be equal to prior partial_sum column_count");
+        }
+    }
+
+    void check_postconditions(const Descriptor& params,
+                              const input_t& input,
+                              const result_t& result) const {
+        const std::int64_t column_count = input.get_data().get_column_count();
+        if (result.get_partial_min().get_column_count() != column_count ||
+            result.get_partial_max().get_column_count() != column_count ||
+            result.get_partial_sum().get_column_count() != column_count ||
+            result.get_partial_sum_squares().get_column_count() != column_count ||
+            result.get_partial_sum_squares_centered().get_column_count() != column_count) {
+            throw internal_error(
+                "Result partial statistics column_count should be equal to data column_count");
+        }
+    }
+
+    template <typename Context>
+    auto operator()(const Context& ctx, const Descriptor& desc, const input_t& input) const {
+        check_preconditions(desc, input);
+        const auto result =
+            partial_compute_ops_dispatcher<Context, float_t, method_t>()(ctx, desc, input);
+        check_postconditions(desc, input, result);
+        return result;
+    }
+};
+
+/// Merges the partial results with the DAAL distributed step on the host
+template <typename Float>
+ONEAPI_DAL_EXPORT partial_compute_result merge_partial_results_impl(
+    const std::vector<partial_compute_result>& partial_results);
+
+} // namespace oneapi::dal::basic_statistics::detail
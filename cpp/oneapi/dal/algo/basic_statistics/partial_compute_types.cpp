@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/basic_statistics/partial_compute_types.hpp"
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::basic_statistics {
+
+class detail::partial_compute_result_impl : public base {
+public:
+    table n_rows;
+    table min;
+    table max;
+    table sum;
+    table sum_squares;
+    table sum_squares_centered;
+};
+
+class detail::partial_compute_input_impl : public base {
+public:
+    partial_compute_input_impl(const partial_compute_result& prior, const table& data)
+            : prior(prior),
+              data(data) {}
+
+    partial_compute_result prior;
+    table data;
+};
+
+using detail::partial_compute_input_impl;
+using detail::partial_compute_result_impl;
+
+partial_compute_result::partial_compute_result() : impl_(new partial_compute_result_impl{}) {}
+
+table partial_compute_result::get_partial_n_rows() const {
+    return impl_->n_rows;
+}
+
+table partial_compute_result::get_partial_min() const {
+    return impl_->min;
+}
+
+table partial_compute_result::get_partial_max() const {
+    return impl_->max;
+}
+
+table partial_compute_result::get_partial_sum() const {
+    return impl_->sum;
+}
+
+table partial_compute_result::get_partial_sum_squares() const {
+    return impl_->sum_squares;
+}
+
+table partial_compute_result::get_partial_sum_squares_centered() const {
+    return impl_->sum_squares_centered;
+}
+
+void partial_compute_result::set_partial_n_rows_impl(const table& value) {
+    impl_->n_rows = value;
+}
+
+void partial_compute_result::set_partial_min_impl(const table& value) {
+    impl_->min = value;
+}
+
+void partial_compute_result::set_partial_max_impl(const table& value) {
+    impl_->max = value;
+}
+
+void partial_compute_result::set_partial_sum_impl(const table& value) {
+    impl_->sum = value;
+}
+
+void partial_compute_result::set_partial_sum_squares_impl(const table& value) {
+    impl_->sum_squares = value;
+}
+
+void partial_compute_result::set_partial_sum_squares_centered_impl(const table& value) {
+    impl_->sum_squares_centered = value;
+}
+
+partial_compute_input::partial_compute_input(const table& data)
+        : impl_(new partial_compute_input_impl(partial_compute_result{}, data)) {}
+
+partial_compute_input::partial_compute_input(const partial_compute_result& prior,
+                                             const table& data)
+        : impl_(new partial_compute_input_impl(prior, data)) {}
+
+partial_compute_result partial_compute_input::get_prior() const {
+    return impl_->prior;
+}
+
+table partial_compute_input::get_data() const {
+    return impl_->data;
+}
+
+void partial_compute_input::set_prior_impl(const partial_compute_result& value) {
+    impl_->prior = value;
+}
+
+void partial_compute_input::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+} // namespace oneapi::dal::basic_statistics
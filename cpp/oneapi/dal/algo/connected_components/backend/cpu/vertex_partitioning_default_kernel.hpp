@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/connected_components/common.hpp"
+#include "oneapi/dal/algo/connected_components/vertex_partitioning_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::preview {
+namespace connected_components {
+namespace detail {
+
+/// Computes the connected components of the graph with the Afforest algorithm.
+/// The components are kept as a forest of the vertices, in which every vertex
+/// points to a vertex with a smaller index, and the edges are linked in
+/// parallel with the atomic updates of the roots. The first neighbor_rounds
+/// neighbors of every vertex are linked first, then the largest component is
+/// estimated by sampling and the remaining edges are linked only for the
+/// vertices out of it.
+template <typename Cpu>
+vertex_partitioning_result call_afforest_default_kernel(
+    const descriptor_base &desc,
+    vertex_partitioning_input<undirected_adjacency_array_graph<>> &input);
+
+} // namespace detail
+} // namespace connected_components
+} // namespace oneapi::dal::preview
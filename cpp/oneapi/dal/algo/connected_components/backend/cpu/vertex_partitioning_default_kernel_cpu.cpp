@@ -0,0 +1,209 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dal/algo/connected_components/backend/cpu/vertex_partitioning_default_kernel.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_array_graph_impl.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::preview {
+namespace connected_components {
+namespace detail {
+
+/// The number of the vertices processed by one task of the threading layer
+constexpr std::int64_t afforest_block_size = 4096;
+
+/// The number of the vertices sampled to find the largest component
+constexpr std::int64_t afforest_sample_count = 1024;
+
+using component_t = std::atomic<std::int32_t>;
+
+template <typename Cpu, typename Body>
+void for_each_vertex_block(std::int64_t vertex_count, const Body &body) {
+    using load_graph::detail::threader_for;
+    const std::int64_t block_count = (vertex_count + afforest_block_size - 1) / afforest_block_size;
+    threader_for(block_count, block_count, [&](int b) {
+        const std::int32_t begin = static_cast<std::int32_t>(b * afforest_block_size);
+        const std::int32_t end =
+            static_cast<std::int32_t>(std::min(vertex_count, (b + 1) * afforest_block_size));
+        body(begin, end);
+    });
+}
+
+/// Returns the sorted neighbors of the vertex, the compressed adjacency lists
+/// are decoded into the buffer
+template <typename Cpu, typename GraphImpl>
+inline const std::int32_t *get_neighbors(const GraphImpl &g,
+                                         std::int32_t vertex,
+                                         std::vector<std::int32_t> &buffer) {
+    if (g._compressed_neighbors.empty()) {
+        return g._vertex_neighbors.data() + g._edge_offsets[vertex];
+    }
+    // the decoder writes up to 3 extra elements
+    const std::int32_t count = g._degrees[vertex];
+    if (buffer.size() < static_cast<std::size_t>(count) + 4) {
+        buffer.resize(static_cast<std::size_t>(count) + 4);
+    }
+    g._compressed_neighbors.decode_list(g._compressed_neighbors.get_list(vertex),
+                                        count,
+                                        buffer.data());
+    return buffer.data();
+}
+
+/// Merges the trees of the vertices u and v, the root with the larger index is
+/// attached to the root with the smaller one
+template <typename Cpu>
+inline void link(std::int32_t u, std::int32_t v, component_t *components) {
+    std::int32_t p1 = components[u].load(std::memory_order_relaxed);
+    std::int32_t p2 = components[v].load(std::memory_order_relaxed);
+    while (p1 != p2) {
+        const std::int32_t high = std::max(p1, p2);
+        const std::int32_t low = std::min(p1, p2);
+        std::int32_t p_high = components[high].load(std::memory_order_relaxed);
+        if (p_high == low) {
+            return;
+        }
+        if (p_high == high && components[high].compare_exchange_strong(p_high, low)) {
+            return;
+        }
+        p1 = components[components[high].load(std::memory_order_relaxed)].load(
+            std::memory_order_relaxed);
+        p2 = components[low].load(std::memory_order_relaxed);
+    }
+}
+
+/// Points every vertex directly to the root of its tree
+template <typename Cpu>
+inline void compress(std::int64_t vertex_count, component_t *components) {
+    for_each_vertex_block<Cpu>(vertex_count, [&](std::int32_t begin, std::int32_t end) {
+        for (std::int32_t u = begin; u < end; ++u) {
+            std::int32_t parent = components[u].load(std::memory_order_relaxed);
+            std::int32_t grandparent = components[parent].load(std::memory_order_relaxed);
+            while (parent != grandparent) {
+                components[u].store(grandparent, std::memory_order_relaxed);
+                parent = grandparent;
+                grandparent = components[parent].load(std::memory_order_relaxed);
+            }
+        }
+    });
+}
+
+/// Returns the most frequent root of the sampled vertices, the ties are
+/// resolved in favor of the smaller root
+template <typename Cpu>
+inline std::int32_t sample_frequent_component(std::int64_t vertex_count,
+                                              const component_t *components) {
+    std::mt19937 engine(777);
+    std::uniform_int_distribution<std::int32_t> distribution(
+        0,
+        static_cast<std::int32_t>(vertex_count - 1));
+    std::unordered_map<std::int32_t, std::int64_t> counts;
+    for (std::int64_t i = 0; i < afforest_sample_count; ++i) {
+        counts[components[distribution(engine)].load(std::memory_order_relaxed)]++;
+    }
+    std::int32_t frequent = 0;
+    std::int64_t frequent_count = 0;
+    for (const auto &item : counts) {
+        if (item.second > frequent_count ||
+            (item.second == frequent_count && item.first < frequent)) {
+            frequent = item.first;
+            frequent_count = item.second;
+        }
+    }
+    return frequent;
+}
+
+template <typename Cpu>
+vertex_partitioning_result call_afforest_default_kernel(
+    const descriptor_base &desc,
+    vertex_partitioning_input<undirected_adjacency_array_graph<>> &input) {
+    const auto &g = oneapi::dal::preview::detail::get_impl(input.get_graph());
+    const std::int64_t vertex_count = g->_vertex_count;
+    const std::int32_t *degrees = g->_degrees.data();
+    const std::int64_t neighbor_rounds = desc.get_neighbor_rounds();
+    if (vertex_count == 0) {
+        return vertex_partitioning_result(table{}, 0);
+    }
+
+    std::unique_ptr<component_t[]> components_ptr(new component_t[vertex_count]);
+    component_t *components = components_ptr.get();
+    for_each_vertex_block<Cpu>(vertex_count, [&](std::int32_t begin, std::int32_t end) {
+        for (std::int32_t u = begin; u < end; ++u) {
+            components[u].store(u, std::memory_order_relaxed);
+        }
+    });
+
+    // the trees grow from the first neighbors of all vertices
+    for (std::int64_t r = 0; r < neighbor_rounds; ++r) {
+        for_each_vertex_block<Cpu>(vertex_count, [&](std::int32_t begin, std::int32_t end) {
+            std::vector<std::int32_t> buffer;
+            for (std::int32_t u = begin; u < end; ++u) {
+                if (degrees[u] > r) {
+                    link<Cpu>(u, get_neighbors<Cpu>(*g, u, buffer)[r], components);
+                }
+            }
+        });
+        compress<Cpu>(vertex_count, components);
+    }
+
+    // the edges of the vertices of the largest component are not needed, since
+    // the other end of each edge out of it links it from its own side
+    const std::int32_t frequent = sample_frequent_component<Cpu>(vertex_count, components);
+    for_each_vertex_block<Cpu>(vertex_count, [&](std::int32_t begin, std::int32_t end) {
+        std::vector<std::int32_t> buffer;
+        for (std::int32_t u = begin; u < end; ++u) {
+            if (components[u].load(std::memory_order_relaxed) == frequent ||
+                degrees[u] <= neighbor_rounds) {
+                continue;
+            }
+            const std::int32_t *neighbors = get_neighbors<Cpu>(*g, u, buffer);
+            for (std::int32_t r = static_cast<std::int32_t>(neighbor_rounds); r < degrees[u];
+                 ++r) {
+                link<Cpu>(u, neighbors[r], components);
+            }
+        }
+    });
+    compress<Cpu>(vertex_count, components);
+
+    // the roots are the smallest vertices of the components, so the labels
+    // are numbered in the order of the first vertices of the components
+    auto labels = array<std::int32_t>::empty(vertex_count);
+    std::int32_t *labels_data = labels.get_mutable_data();
+    std::int32_t component_count = 0;
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        const std::int32_t root = components[u].load(std::memory_order_relaxed);
+        labels_data[u] = (root == u) ? component_count++ : labels_data[root];
+    }
+
+    return vertex_partitioning_result(
+        dal::detail::homogen_table_builder{}.reset(labels, vertex_count, 1).build(),
+        component_count);
+}
+
+template vertex_partitioning_result call_afforest_default_kernel<__CPU_TAG__>(
+    const descriptor_base &desc,
+    vertex_partitioning_input<undirected_adjacency_array_graph<>> &input);
+
+} // namespace detail
+} // namespace connected_components
+} // namespace oneapi::dal::preview
@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/connected_components/common.hpp"
+
+namespace oneapi::dal::preview {
+namespace connected_components {
+
+class detail::descriptor_impl : public base {
+public:
+    std::int64_t neighbor_rounds = 2;
+};
+
+using detail::descriptor_impl;
+
+descriptor_base::descriptor_base() : impl_(new descriptor_impl{}) {}
+
+std::int64_t descriptor_base::get_neighbor_rounds() const {
+    return impl_->neighbor_rounds;
+}
+
+void descriptor_base::set_neighbor_rounds_impl(std::int64_t neighbor_rounds) {
+    impl_->neighbor_rounds = neighbor_rounds;
+}
+
+} // namespace connected_components
+} // namespace oneapi::dal::preview
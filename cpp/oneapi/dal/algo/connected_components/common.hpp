@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
+
+namespace oneapi::dal::preview {
+namespace connected_components {
+namespace detail {
+struct tag {};
+class descriptor_impl;
+} // namespace detail
+
+namespace method {
+struct afforest {};
+using by_default = afforest;
+} // namespace method
+
+/// The base class for the connected components algorithm descriptor
+class ONEAPI_DAL_EXPORT descriptor_base : public base {
+public:
+    using tag_t = detail::tag;
+    using float_t = float;
+    using method_t = method::by_default;
+
+    /// Constructs the empty descriptor
+    descriptor_base();
+
+    /// Returns the number of the first neighbors of each vertex linked before
+    /// the largest component is sampled
+    auto get_neighbor_rounds() const -> std::int64_t;
+
+protected:
+    void set_neighbor_rounds_impl(std::int64_t neighbor_rounds);
+
+    oneapi::dal::detail::pimpl<detail::descriptor_impl> impl_;
+};
+
+/// Class for the connected components algorithm descriptor
+///
+/// @tparam Float The floating-point type of the algorithm
+/// @tparam Method The algorithm method
+template <typename Float = descriptor_base::float_t, typename Method = descriptor_base::method_t>
+class descriptor : public descriptor_base {
+public:
+    using method_t = Method;
+
+    /// Sets the number of the first neighbors of each vertex linked before the
+    /// largest component is sampled. The remaining edges of the vertices of
+    /// the largest component are skipped, so for the graphs with a giant
+    /// component most of the edges are never processed.
+    ///
+    /// @param [in] neighbor_rounds  The number of the sampled neighbors, 2 by default
+    auto& set_neighbor_rounds(std::int64_t neighbor_rounds) {
+        this->set_neighbor_rounds_impl(neighbor_rounds);
+        return *this;
+    }
+};
+
+} // namespace connected_components
+} // namespace oneapi::dal::preview
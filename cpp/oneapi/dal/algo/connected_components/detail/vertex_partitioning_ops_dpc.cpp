@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/connected_components/backend/cpu/vertex_partitioning_default_kernel.hpp"
+#include "oneapi/dal/algo/connected_components/detail/vertex_partitioning_ops.hpp"
+#include "oneapi/dal/backend/dispatcher_dpc.hpp"
+
+namespace oneapi::dal::preview {
+namespace connected_components {
+namespace detail {
+using oneapi::dal::detail::data_parallel_policy;
+
+template <typename Float, class Method, typename Graph>
+struct ONEAPI_DAL_EXPORT
+    vertex_partitioning_ops_dispatcher<data_parallel_policy, Float, Method, Graph> {
+    vertex_partitioning_result operator()(const data_parallel_policy &policy,
+                                          const descriptor_base &desc,
+                                          vertex_partitioning_input<Graph> &input) const {
+        // the components are computed by the CPU kernels only
+        const auto ctx = oneapi::dal::backend::context_cpu{ oneapi::dal::detail::host_policy{} };
+        return dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+            return call_afforest_default_kernel<decltype(cpu)>(desc, input);
+        });
+    }
+};
+
+#define INSTANTIATE(F, M, G)          \
+    template struct ONEAPI_DAL_EXPORT \
+        vertex_partitioning_ops_dispatcher<data_parallel_policy, F, M, G>;
+
+INSTANTIATE(float,
+            oneapi::dal::preview::connected_components::method::by_default,
+            undirected_adjacency_array_graph<>)
+
+} // namespace detail
+} // namespace connected_components
+} // namespace oneapi::dal::preview
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/connected_components/vertex_partitioning_types.hpp"
+
+namespace oneapi::dal::preview {
+namespace connected_components {
+template <typename Graph>
+class detail::vertex_partitioning_input_impl : public base {
+public:
+    vertex_partitioning_input_impl(const Graph& graph_data_input)
+            : graph_data(graph_data_input) {}
+
+    const Graph& graph_data;
+};
+
+using detail::vertex_partitioning_input_impl;
+
+template <typename Graph>
+vertex_partitioning_input<Graph>::vertex_partitioning_input(const Graph& data)
+        : impl_(new vertex_partitioning_input_impl<Graph>(data)) {}
+
+template <typename Graph>
+const Graph& vertex_partitioning_input<Graph>::get_graph() const {
+    return impl_->graph_data;
+}
+
+class detail::vertex_partitioning_result_impl : public base {
+public:
+    vertex_partitioning_result_impl() : component_count(0) {}
+
+    vertex_partitioning_result_impl(const table& labels, std::int64_t component_count)
+            : labels(labels),
+              component_count(component_count) {}
+
+    table labels;
+    std::int64_t component_count;
+};
+
+template class detail::vertex_partitioning_input_impl<undirected_adjacency_array_graph<>>;
+
+template class ONEAPI_DAL_EXPORT vertex_partitioning_input<undirected_adjacency_array_graph<>>;
+
+using detail::vertex_partitioning_result_impl;
+
+vertex_partitioning_result::vertex_partitioning_result()
+        : impl_(new vertex_partitioning_result_impl()) {}
+
+vertex_partitioning_result::vertex_partitioning_result(const table& labels,
+                                                       std::int64_t component_count)
+        : impl_(new vertex_partitioning_result_impl(labels, component_count)) {}
+
+table vertex_partitioning_result::get_labels() const {
+    return impl_->labels;
+}
+
+std::int64_t vertex_partitioning_result::get_component_count() const {
+    return impl_->component_count;
+}
+} // namespace connected_components
+} // namespace oneapi::dal::preview
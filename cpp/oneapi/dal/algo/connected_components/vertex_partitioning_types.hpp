@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the definition of the input and output for the connected components
+/// algorithm
+
+#pragma once
+
+#include "oneapi/dal/algo/connected_components/common.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::preview {
+namespace connected_components {
+
+namespace detail {
+template <typename Graph>
+class vertex_partitioning_input_impl;
+class vertex_partitioning_result_impl;
+} // namespace detail
+
+/// Class for the description of the input parameters of the connected
+/// components algorithm
+///
+/// @tparam Graph  Type of the input graph
+template <typename Graph>
+class ONEAPI_DAL_EXPORT vertex_partitioning_input {
+public:
+    /// Constructs the algorithm input initialized with the graph
+    ///
+    /// @param [in]   graph  The input graph
+    vertex_partitioning_input(const Graph& graph);
+
+    /// Returns the constant reference to the input graph
+    const Graph& get_graph() const;
+
+private:
+    dal::detail::pimpl<detail::vertex_partitioning_input_impl<Graph>> impl_;
+};
+
+/// Class for the description of the result of the connected components algorithm
+class ONEAPI_DAL_EXPORT vertex_partitioning_result {
+public:
+    /// Constructs the empty result
+    vertex_partitioning_result();
+
+    /// Constructs the algorithm result initialized with the table of the
+    /// component labels of the vertices and the number of the components
+    ///
+    /// @param [in]   labels           The table of size vertex_count*1 with the
+    ///                                labels of the components of the vertices
+    /// @param [in]   component_count  The number of the connected components
+    vertex_partitioning_result(const table& labels, std::int64_t component_count);
+
+    /// Returns the table of size vertex_count*1 with the labels of the
+    /// components of the vertices. The labels are in [0, component_count) and
+    /// are numbered in the order of the first vertices of the components.
+    table get_labels() const;
+
+    /// The number of the connected components of the graph
+    std::int64_t get_component_count() const;
+
+private:
+    dal::detail::pimpl<detail::vertex_partitioning_result_impl> impl_;
+};
+} // namespace connected_components
+} // namespace oneapi::dal::preview
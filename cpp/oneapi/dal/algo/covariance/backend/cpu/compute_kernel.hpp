@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "oneapi/dal/algo/covariance/compute_types.hpp"
+#include "oneapi/dal/algo/covariance/partial_compute_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/communicator.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+template <typename Float, typename Method>
+struct compute_kernel_cpu {
+    compute_result operator()(const dal::backend::context_cpu& ctx,
+                              const descriptor_base& params,
+                              const compute_input& input) const;
+};
+
+template <typename Float, typename Method>
+struct partial_compute_kernel_cpu {
+    partial_compute_result operator()(const dal::backend::context_cpu& ctx,
+                                      const descriptor_base& params,
+                                      const partial_compute_input& input) const;
+};
+
+template <typename Float, typename Method>
+struct finalize_compute_kernel_cpu {
+    compute_result operator()(const dal::backend::context_cpu& ctx,
+                              const descriptor_base& params,
+                              const partial_compute_result& input) const;
+};
+
+template <typename Float>
+struct merge_kernel_cpu {
+    partial_compute_result operator()(
+        const dal::backend::context_cpu& ctx,
+        const std::vector<partial_compute_result>& partial_results) const;
+};
+
+/// Gathers the partial results of all processes of the SPMD run and merges
+/// them on every process
+template <typename Float>
+struct spmd_merge_kernel_cpu {
+    partial_compute_result operator()(const dal::backend::context_cpu& ctx,
+                                      const spmd::communicator& comm,
+                                      const partial_compute_result& local_partial) const;
+};
+
+/// Computes the correlation matrix from the p x p covariance matrix, the
+/// correlations of the columns with zero variance are zero
+template <typename Float>
+array<Float> compute_correlation(const array<Float>& cov, std::int64_t column_count);
+
+} // namespace oneapi::dal::covariance::backend
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/covariance/covariance_kernel.h>
+
+#include "oneapi/dal/algo/covariance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_cov = daal::algorithms::covariance;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_cov_kernel_t =
+    daal_cov::internal::CovarianceDenseBatchKernel<Float, daal_cov::defaultDense, Cpu>;
+
+template <typename Float>
+array<Float> compute_correlation(const array<Float>& cov, int64_t column_count) {
+    auto arr_cor = array<Float>::empty(column_count * column_count);
+    Float* cor = arr_cor.get_mutable_data();
+
+    std::vector<Float> inv_sigmas(column_count);
+    for (int64_t i = 0; i < column_count; i++) {
+        const Float var = cov[i * column_count + i];
+        inv_sigmas[i] = (var > Float(0)) ? Float(1) / std::sqrt(var) : Float(0);
+    }
+    for (int64_t i = 0; i < column_count; i++) {
+        for (int64_t j = 0; j < column_count; j++) {
+            cor[i * column_count + j] = (i == j && inv_sigmas[i] > Float(0))
+                                            ? Float(1)
+                                            : cov[i * column_count + j] * inv_sigmas[i] *
+                                                  inv_sigmas[j];
+        }
+    }
+    return arr_cor;
+}
+
+template <typename Float>
+static compute_result call_daal_kernel(const context_cpu& ctx,
+                                       const descriptor_base& desc,
+                                       const table& data) {
+    const int64_t column_count = data.get_column_count();
+
+    auto arr_cov = array<Float>::empty(column_count * column_count);
+    auto arr_means = array<Float>::empty(1 * column_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_cov_matrix =
+        interop::convert_to_daal_homogen_table(arr_cov, column_count, column_count);
+    const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, column_count);
+
+    daal_cov::Parameter daal_parameter;
+    interop::status_to_exception(interop::call_daal_kernel<Float, daal_cov_kernel_t>(
+        ctx,
+        daal_data.get(),
+        daal_cov_matrix.get(),
+        daal_means.get(),
+        &daal_parameter));
+
+    const auto arr_cor = compute_correlation(arr_cov, column_count);
+
+    // clang-format off
+    return compute_result()
+        .set_cov_matrix(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_cov, column_count, column_count)
+                .build()
+        )
+        .set_cor_matrix(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_cor, column_count, column_count)
+                .build()
+        )
+        .set_means(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_means, 1, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+template <typename Float>
+static compute_result compute(const context_cpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_data());
+}
+
+template <typename Float>
+struct compute_kernel_cpu<Float, method::dense> {
+    compute_result operator()(const context_cpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) const {
+        return compute<Float>(ctx, desc, input);
+    }
+};
+
+template struct compute_kernel_cpu<float, method::dense>;
+template struct compute_kernel_cpu<double, method::dense>;
+
+template array<float> compute_correlation(const array<float>&, int64_t);
+template array<double> compute_correlation(const array<double>&, int64_t);
+
+} // namespace oneapi::dal::covariance::backend
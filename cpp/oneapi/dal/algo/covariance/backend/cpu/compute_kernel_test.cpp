@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/covariance.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
+#include "oneapi/dal/test/thread_communicator.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+// The second column is twice the first one, so the columns have the means
+// 2.5 and 5, the variances 5/3 and 20/3 and the correlation 1
+static const double data[] = {
+    1.0, 2.0, //
+    2.0, 4.0, //
+    3.0, 6.0, //
+    4.0, 8.0, //
+};
+static const std::int64_t row_count = 4;
+static const std::int64_t column_count = 2;
+
+static void check_result(const covariance::compute_result& result) {
+    const double expected_cov[] = { 5.0 / 3.0, 10.0 / 3.0, 10.0 / 3.0, 20.0 / 3.0 };
+    const double expected_means[] = { 2.5, 5.0 };
+
+    ASSERT_EQ(result.get_cov_matrix().get_row_count(), column_count);
+    ASSERT_EQ(result.get_cov_matrix().get_column_count(), column_count);
+    ASSERT_EQ(result.get_cor_matrix().get_row_count(), column_count);
+    ASSERT_EQ(result.get_means().get_column_count(), column_count);
+
+    const auto cov = row_accessor<const double>(result.get_cov_matrix()).pull();
+    const auto cor = row_accessor<const double>(result.get_cor_matrix()).pull();
+    const auto means = row_accessor<const double>(result.get_means()).pull();
+
+    for (std::int64_t i = 0; i < column_count * column_count; i++) {
+        ASSERT_NEAR(cov[i], expected_cov[i], 1e-12);
+        ASSERT_NEAR(cor[i], 1.0, 1e-12);
+    }
+    for (std::int64_t j = 0; j < column_count; j++) {
+        ASSERT_NEAR(means[j], expected_means[j], 1e-12);
+    }
+}
+
+TEST(covariance_dense_test, can_compute_batch) {
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto desc = covariance::descriptor<double>{};
+
+    check_result(compute(desc, data_table));
+}
+
+TEST(covariance_dense_test, partial_compute_matches_batch) {
+    const auto desc = covariance::descriptor<double>{};
+
+    covariance::partial_compute_result partial;
+    for (std::int64_t i = 0; i < row_count; i += 2) {
+        const auto block = homogen_table::wrap(data + i * column_count, 2, column_count);
+        partial = partial_compute(desc, partial, block);
+    }
+
+    check_result(finalize_compute(desc, partial));
+}
+
+TEST(covariance_dense_test, merged_partial_results_match_batch) {
+    const auto desc = covariance::descriptor<double>{};
+
+    std::vector<covariance::partial_compute_result> partials;
+    for (std::int64_t i = 0; i < row_count; i += 2) {
+        const auto block = homogen_table::wrap(data + i * column_count, 2, column_count);
+        partials.push_back(partial_compute(desc, block));
+    }
+
+    check_result(finalize_compute(desc, covariance::merge_partial_results(desc, partials)));
+}
+
+TEST(covariance_dense_test, spmd_compute_matches_batch) {
+    const auto desc = covariance::descriptor<double>{};
+    const std::int64_t rank_count = 2;
+    const std::int64_t rank_row_count = row_count / rank_count;
+
+    test::run_spmd(rank_count, [&](std::int64_t rank, const spmd::communicator& comm) {
+        const auto local_data =
+            homogen_table::wrap(data + rank * rank_row_count * column_count,
+                                rank_row_count,
+                                column_count);
+        const detail::spmd_policy<detail::host_policy> policy{ detail::host_policy{}, comm };
+        check_result(compute(policy, desc, local_data));
+    });
+}
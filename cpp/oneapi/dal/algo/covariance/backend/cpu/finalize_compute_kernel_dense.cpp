@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/covariance/covariance_kernel.h>
+
+#include "oneapi/dal/algo/covariance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_cov = daal::algorithms::covariance;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_cov_online_kernel_t =
+    daal_cov::internal::CovarianceDenseOnlineKernel<Float, daal_cov::defaultDense, Cpu>;
+
+template <typename Float>
+static array<Float> pull_copy(const table& t) {
+    const auto src = row_accessor<const Float>{ t }.pull();
+    auto dst = array<Float>::empty(src.get_count());
+    std::copy(src.get_data(), src.get_data() + src.get_count(), dst.get_mutable_data());
+    return dst;
+}
+
+template <typename Float>
+static compute_result call_daal_kernel(const context_cpu& ctx,
+                                       const descriptor_base& desc,
+                                       const partial_compute_result& input) {
+    const int64_t column_count = input.get_partial_sum().get_column_count();
+
+    auto arr_n_rows = pull_copy<Float>(input.get_partial_n_rows());
+    auto arr_crossproduct = pull_copy<Float>(input.get_partial_crossproduct());
+    auto arr_sum = pull_copy<Float>(input.get_partial_sum());
+    auto arr_cov = array<Float>::empty(column_count * column_count);
+    auto arr_means = array<Float>::empty(1 * column_count);
+
+    const auto daal_n_rows = interop::convert_to_daal_homogen_table(arr_n_rows, 1, 1);
+    const auto daal_crossproduct =
+        interop::convert_to_daal_homogen_table(arr_crossproduct, column_count, column_count);
+    const auto daal_sum = interop::convert_to_daal_homogen_table(arr_sum, 1, column_count);
+    const auto daal_cov_matrix =
+        interop::convert_to_daal_homogen_table(arr_cov, column_count, column_count);
+    const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, column_count);
+
+    daal_cov::Parameter daal_parameter;
+    const auto status = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+        return daal_cov_online_kernel_t<Float, daal_cpu>().finalizeCompute(daal_n_rows.get(),
+                                                                          daal_crossproduct.get(),
+                                                                          daal_sum.get(),
+                                                                          daal_cov_matrix.get(),
+                                                                          daal_means.get(),
+                                                                          &daal_parameter);
+    });
+    interop::status_to_exception(status);
+
+    const auto arr_cor = compute_correlation(arr_cov, column_count);
+
+    // clang-format off
+    return compute_result()
+        .set_cov_matrix(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_cov, column_count, column_count)
+                .build()
+        )
+        .set_cor_matrix(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_cor, column_count, column_count)
+                .build()
+        )
+        .set_means(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_means, 1, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+template <typename Float>
+struct finalize_compute_kernel_cpu<Float, method::dense> {
+    compute_result operator()(const context_cpu& ctx,
+                              const descriptor_base& desc,
+                              const partial_compute_result& input) const {
+        return call_daal_kernel<Float>(ctx, desc, input);
+    }
+};
+
+template struct finalize_compute_kernel_cpu<float, method::dense>;
+template struct finalize_compute_kernel_cpu<double, method::dense>;
+
+} // namespace oneapi::dal::covariance::backend
@@ -0,0 +1,220 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/covariance/covariance_kernel.h>
+
+#include "oneapi/dal/algo/covariance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_cov = daal::algorithms::covariance;
+namespace daal_dm = daal::data_management;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_cov_online_kernel_t =
+    daal_cov::internal::CovarianceDenseOnlineKernel<Float, daal_cov::defaultDense, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_cov_distributed_kernel_t =
+    daal_cov::internal::CovarianceDistributedKernel<Float, daal_cov::defaultDense, Cpu>;
+
+/// The DAAL kernels update the partial results in place, so they get copies
+/// of the tables of the prior partial result
+template <typename Float>
+static array<Float> pull_copy(const table& t) {
+    const auto src = row_accessor<const Float>{ t }.pull();
+    auto dst = array<Float>::empty(src.get_count());
+    std::copy(src.get_data(), src.get_data() + src.get_count(), dst.get_mutable_data());
+    return dst;
+}
+
+template <typename Float>
+static partial_compute_result make_partial_result(const array<Float>& arr_n_rows,
+                                                  const array<Float>& arr_crossproduct,
+                                                  const array<Float>& arr_sum,
+                                                  int64_t column_count) {
+    // clang-format off
+    return partial_compute_result()
+        .set_partial_n_rows(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_n_rows, 1, 1)
+                .build()
+        )
+        .set_partial_crossproduct(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_crossproduct, column_count, column_count)
+                .build()
+        )
+        .set_partial_sum(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_sum, 1, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+template <typename Float>
+static partial_compute_result call_daal_kernel(const context_cpu& ctx,
+                                               const descriptor_base& desc,
+                                               const partial_compute_result& prior,
+                                               const table& data) {
+    const int64_t column_count = data.get_column_count();
+
+    const bool has_prior = prior.get_partial_n_rows().has_data();
+    auto arr_n_rows =
+        has_prior ? pull_copy<Float>(prior.get_partial_n_rows()) : array<Float>::zeros(1);
+    auto arr_crossproduct = has_prior ? pull_copy<Float>(prior.get_partial_crossproduct())
+                                      : array<Float>::zeros(column_count * column_count);
+    auto arr_sum =
+        has_prior ? pull_copy<Float>(prior.get_partial_sum()) : array<Float>::zeros(column_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_n_rows = interop::convert_to_daal_homogen_table(arr_n_rows, 1, 1);
+    const auto daal_crossproduct =
+        interop::convert_to_daal_homogen_table(arr_crossproduct, column_count, column_count);
+    const auto daal_sum = interop::convert_to_daal_homogen_table(arr_sum, 1, column_count);
+
+    daal_cov::Parameter daal_parameter;
+    interop::status_to_exception(interop::call_daal_kernel<Float, daal_cov_online_kernel_t>(
+        ctx,
+        daal_data.get(),
+        daal_n_rows.get(),
+        daal_crossproduct.get(),
+        daal_sum.get(),
+        &daal_parameter));
+
+    return make_partial_result(arr_n_rows, arr_crossproduct, arr_sum, column_count);
+}
+
+template <typename Float>
+struct partial_compute_kernel_cpu<Float, method::dense> {
+    partial_compute_result operator()(const context_cpu& ctx,
+                                      const descriptor_base& desc,
+                                      const partial_compute_input& input) const {
+        return call_daal_kernel<Float>(ctx, desc, input.get_prior(), input.get_data());
+    }
+};
+
+template <typename Float>
+partial_compute_result merge_kernel_cpu<Float>::operator()(
+    const context_cpu& ctx,
+    const std::vector<partial_compute_result>& partial_results) const {
+    const int64_t column_count = partial_results.front().get_partial_sum().get_column_count();
+
+    daal_dm::DataCollection daal_partial_results;
+    for (const auto& partial : partial_results) {
+        auto arr_partial_n_rows = pull_copy<Float>(partial.get_partial_n_rows());
+        auto arr_partial_crossproduct = pull_copy<Float>(partial.get_partial_crossproduct());
+        auto arr_partial_sum = pull_copy<Float>(partial.get_partial_sum());
+
+        auto daal_partial = daal_cov::PartialResultPtr(new daal_cov::PartialResult());
+        daal_partial->set(daal_cov::nObservations,
+                          interop::convert_to_daal_homogen_table(arr_partial_n_rows, 1, 1));
+        daal_partial->set(daal_cov::crossProduct,
+                          interop::convert_to_daal_homogen_table(arr_partial_crossproduct,
+                                                                 column_count,
+                                                                 column_count));
+        daal_partial->set(daal_cov::sum,
+                          interop::convert_to_daal_homogen_table(arr_partial_sum, 1, column_count));
+        daal_partial_results.push_back(daal_partial);
+    }
+
+    auto arr_n_rows = array<Float>::empty(1);
+    auto arr_crossproduct = array<Float>::empty(column_count * column_count);
+    auto arr_sum = array<Float>::empty(column_count);
+
+    const auto daal_n_rows = interop::convert_to_daal_homogen_table(arr_n_rows, 1, 1);
+    const auto daal_crossproduct =
+        interop::convert_to_daal_homogen_table(arr_crossproduct, column_count, column_count);
+    const auto daal_sum = interop::convert_to_daal_homogen_table(arr_sum, 1, column_count);
+
+    daal_cov::Parameter daal_parameter;
+    interop::status_to_exception(interop::call_daal_kernel<Float, daal_cov_distributed_kernel_t>(
+        ctx,
+        &daal_partial_results,
+        daal_n_rows.get(),
+        daal_crossproduct.get(),
+        daal_sum.get(),
+        &daal_parameter));
+
+    return make_partial_result(arr_n_rows, arr_crossproduct, arr_sum, column_count);
+}
+
+template <typename Float>
+partial_compute_result spmd_merge_kernel_cpu<Float>::operator()(
+    const context_cpu& ctx,
+    const spmd::communicator& comm,
+    const partial_compute_result& local_partial) const {
+    const int64_t column_count = local_partial.get_partial_sum().get_column_count();
+    const int64_t crossproduct_size = column_count * column_count;
+    const int64_t packed_size = 1 + column_count + crossproduct_size;
+
+    // The partial results are small, so they are gathered as one packed
+    // array [n_rows, sum, crossproduct] per process
+    std::vector<Float> packed(packed_size);
+    {
+        const auto n_rows = row_accessor<const Float>{ local_partial.get_partial_n_rows() }.pull();
+        const auto sum = row_accessor<const Float>{ local_partial.get_partial_sum() }.pull();
+        const auto crossproduct =
+            row_accessor<const Float>{ local_partial.get_partial_crossproduct() }.pull();
+        packed[0] = n_rows[0];
+        std::copy(sum.get_data(), sum.get_data() + column_count, packed.data() + 1);
+        std::copy(crossproduct.get_data(),
+                  crossproduct.get_data() + crossproduct_size,
+                  packed.data() + 1 + column_count);
+    }
+    const auto gathered = comm.allgather(packed.data(), packed_size);
+
+    std::vector<partial_compute_result> partials;
+    for (int64_t rank = 0; rank < comm.get_rank_count(); rank++) {
+        const Float* rank_packed = gathered.data() + rank * packed_size;
+        auto arr_n_rows = array<Float>::full(1, rank_packed[0]);
+        auto arr_sum = array<Float>::empty(column_count);
+        auto arr_crossproduct = array<Float>::empty(crossproduct_size);
+        std::copy(rank_packed + 1, rank_packed + 1 + column_count, arr_sum.get_mutable_data());
+        std::copy(rank_packed + 1 + column_count,
+                  rank_packed + packed_size,
+                  arr_crossproduct.get_mutable_data());
+        partials.push_back(
+            make_partial_result(arr_n_rows, arr_crossproduct, arr_sum, column_count));
+    }
+
+    return merge_kernel_cpu<Float>{}(ctx, partials);
+}
+
+template struct partial_compute_kernel_cpu<float, method::dense>;
+template struct partial_compute_kernel_cpu<double, method::dense>;
+
+template struct merge_kernel_cpu<float>;
+template struct merge_kernel_cpu<double>;
+
+template struct spmd_merge_kernel_cpu<float>;
+template struct spmd_merge_kernel_cpu<double>;
+
+} // namespace oneapi::dal::covariance::backend
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/covariance/oneapi/covariance_kernel_oneapi.h>
+
+#include "oneapi/dal/algo/covariance/backend/gpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using std::int64_t;
+using dal::backend::context_gpu;
+
+namespace daal_cov = daal::algorithms::covariance;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_cov_gpu_kernel_t =
+    daal_cov::oneapi::internal::CovarianceDenseBatchKernelOneAPI<Float, daal_cov::defaultDense>;
+
+template <typename Float>
+static compute_result call_daal_kernel(const context_gpu& ctx,
+                                       const descriptor_base& desc,
+                                       const table& data) {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    auto arr_cov = array<Float>::empty(queue, column_count * column_count);
+    auto arr_means = array<Float>::empty(queue, 1 * column_count);
+
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, column_count);
+    const auto daal_cov_matrix =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_cov, column_count, column_count);
+    const auto daal_means =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_means, 1, column_count);
+
+    daal_cov::Parameter daal_parameter;
+    const auto status = daal_cov_gpu_kernel_t<Float>().compute(daal_data.get(),
+                                                             daal_cov_matrix.get(),
+                                                             daal_means.get(),
+                                                             &daal_parameter);
+    interop::status_to_exception(status);
+
+    const auto cov_table = dal::detail::homogen_table_builder{}
+                               .reset(arr_cov, column_count, column_count)
+                               .build();
+
+    // The p x p normalization is cheap next to the cross-product, so it runs
+    // on the host copy of the covariance
+    const auto arr_cor =
+        compute_correlation(row_accessor<const Float>{ cov_table }.pull(), column_count);
+
+    // clang-format off
+    return compute_result()
+        .set_cov_matrix(cov_table)
+        .set_cor_matrix(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_cor, column_count, column_count)
+                .build()
+        )
+        .set_means(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_means, 1, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+template <typename Float>
+struct compute_kernel_gpu<Float, method::dense> {
+    compute_result operator()(const context_gpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) const {
+        return call_daal_kernel<Float>(ctx, desc, input.get_data());
+    }
+};
+
+template struct compute_kernel_gpu<float, method::dense>;
+template struct compute_kernel_gpu<double, method::dense>;
+
+} // namespace oneapi::dal::covariance::backend
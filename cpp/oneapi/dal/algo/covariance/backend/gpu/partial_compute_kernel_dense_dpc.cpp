@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/kernel.h>
+#include <daal/src/algorithms/covariance/oneapi/covariance_kernel_oneapi.h>
+
+#include "oneapi/dal/algo/covariance/backend/gpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using std::int64_t;
+using dal::backend::context_gpu;
+
+namespace daal_cov = daal::algorithms::covariance;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_cov_online_gpu_kernel_t =
+    daal_cov::oneapi::internal::CovarianceDenseOnlineKernelOneAPI<Float, daal_cov::defaultDense>;
+
+/// The DAAL kernel updates the partial results in place, so it gets device
+/// copies of the tables of the prior partial result
+template <typename Float>
+static array<Float> pull_copy(sycl::queue& queue, const table& t, int64_t count) {
+    if (!t.has_data()) {
+        return array<Float>::zeros(queue, count);
+    }
+    const auto src = row_accessor<const Float>{ t }.pull(queue);
+    auto dst = array<Float>::empty(queue, count);
+    queue.memcpy(dst.get_mutable_data(), src.get_data(), sizeof(Float) * count).wait_and_throw();
+    return dst;
+}
+
+template <typename Float>
+static partial_compute_result call_daal_kernel(const context_gpu& ctx,
+                                               const descriptor_base& desc,
+                                               const partial_compute_result& prior,
+                                               const table& data) {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    auto arr_n_rows = pull_copy<Float>(queue, prior.get_partial_n_rows(), 1);
+    auto arr_crossproduct =
+        pull_copy<Float>(queue, prior.get_partial_crossproduct(), column_count * column_count);
+    auto arr_sum = pull_copy<Float>(queue, prior.get_partial_sum(), column_count);
+
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, column_count);
+    const auto daal_n_rows = interop::convert_to_daal_sycl_homogen_table(queue, arr_n_rows, 1, 1);
+    const auto daal_crossproduct = interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                               arr_crossproduct,
+                                                                               column_count,
+                                                                               column_count);
+    const auto daal_sum =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_sum, 1, column_count);
+
+    daal_cov::Parameter daal_parameter;
+    const auto status = daal_cov_online_gpu_kernel_t<Float>().compute(daal_data.get(),
+                                                                    daal_n_rows.get(),
+                                                                    daal_crossproduct.get(),
+                                                                    daal_sum.get(),
+                                                                    &daal_parameter);
+    interop::status_to_exception(status);
+
+    // clang-format off
+    return partial_compute_result()
+        .set_partial_n_rows(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_n_rows, 1, 1)
+                .build()
+        )
+        .set_partial_crossproduct(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_crossproduct, column_count, column_count)
+                .build()
+        )
+        .set_partial_sum(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_sum, 1, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+template <typename Float>
+struct partial_compute_kernel_gpu<Float, method::dense> {
+    partial_compute_result operator()(const context_gpu& ctx,
+                                      const descriptor_base& desc,
+                                      const partial_compute_input& input) const {
+        return call_daal_kernel<Float>(ctx, desc, input.get_prior(), input.get_data());
+    }
+};
+
+template struct partial_compute_kernel_gpu<float, method::dense>;
+template struct partial_compute_kernel_gpu<double, method::dense>;
+
+} // namespace oneapi::dal::covariance::backend
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/compute_types.hpp"
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::covariance {
+
+class detail::compute_input_impl : public base {
+public:
+    compute_input_impl(const table& data) : data(data) {}
+    table data;
+};
+
+class detail::compute_result_impl : public base {
+public:
+    table cov_matrix;
+    table cor_matrix;
+    table means;
+};
+
+using detail::compute_input_impl;
+using detail::compute_result_impl;
+
+compute_input::compute_input(const table& data) : impl_(new compute_input_impl(data)) {}
+
+table compute_input::get_data() const {
+    return impl_->data;
+}
+
+void compute_input::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+compute_result::compute_result() : impl_(new compute_result_impl{}) {}
+
+table compute_result::get_cov_matrix() const {
+    return impl_->cov_matrix;
+}
+
+table compute_result::get_cor_matrix() const {
+    return impl_->cor_matrix;
+}
+
+table compute_result::get_means() const {
+    return impl_->means;
+}
+
+void compute_result::set_cov_matrix_impl(const table& value) {
+    impl_->cov_matrix = value;
+}
+
+void compute_result::set_cor_matrix_impl(const table& value) {
+    impl_->cor_matrix = value;
+}
+
+void compute_result::set_means_impl(const table& value) {
+    impl_->means = value;
+}
+
+} // namespace oneapi::dal::covariance
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/covariance/common.hpp"
+
+namespace oneapi::dal::covariance {
+
+namespace detail {
+class compute_input_impl;
+class compute_result_impl;
+} // namespace detail
+
+class ONEAPI_DAL_EXPORT compute_input : public base {
+public:
+    compute_input(const table& data);
+
+    table get_data() const;
+
+    auto& set_data(const table& data) {
+        set_data_impl(data);
+        return *this;
+    }
+
+private:
+    void set_data_impl(const table& data);
+
+    dal::detail::pimpl<detail::compute_input_impl> impl_;
+};
+
+class ONEAPI_DAL_EXPORT compute_result : public base {
+public:
+    compute_result();
+
+    /// The p x p covariance matrix with the n - 1 divisor
+    table get_cov_matrix() const;
+
+    /// The p x p correlation matrix, the correlations of the constant
+    /// columns are zero
+    table get_cor_matrix() const;
+
+    /// The 1 x p table of the column means
+    table get_means() const;
+
+    auto& set_cov_matrix(const table& value) {
+        set_cov_matrix_impl(value);
+        return *this;
+    }
+
+    auto& set_cor_matrix(const table& value) {
+        set_cor_matrix_impl(value);
+        return *this;
+    }
+
+    auto& set_means(const table& value) {
+        set_means_impl(value);
+        return *this;
+    }
+
+private:
+    void set_cov_matrix_impl(const table&);
+    void set_cor_matrix_impl(const table&);
+    void set_means_impl(const table&);
+
+    dal::detail::pimpl<detail::compute_result_impl> impl_;
+};
+
+} // namespace oneapi::dal::covariance
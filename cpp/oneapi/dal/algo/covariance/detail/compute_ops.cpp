@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/detail/compute_ops.hpp"
+#include "oneapi/dal/algo/covariance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
+
+namespace oneapi::dal::covariance::detail {
+using oneapi::dal::detail::host_policy;
+using oneapi::dal::detail::spmd_policy;
+
+template <typename Float, typename Method>
+struct ONEAPI_DAL_EXPORT compute_ops_dispatcher<host_policy, Float, Method> {
+    compute_result operator()(const host_policy& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) const {
+        using kernel_dispatcher_t =
+            dal::backend::kernel_dispatcher<backend::compute_kernel_cpu<Float, Method>>;
+        return kernel_dispatcher_t()(ctx, desc, input);
+    }
+};
+
+/// Every process computes the partial result of its rows, the partial results
+/// of all processes are merged and finalized on every process
+template <typename Float, typename Method>
+struct ONEAPI_DAL_EXPORT compute_ops_dispatcher<spmd_policy<host_policy>, Float, Method> {
+    compute_result operator()(const spmd_policy<host_policy>& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) const {
+        using partial_kernel_dispatcher_t =
+            dal::backend::kernel_dispatcher<backend::partial_compute_kernel_cpu<Float, Method>>;
+        using merge_kernel_dispatcher_t =
+            dal::backend::kernel_dispatcher<backend::spmd_merge_kernel_cpu<Float>>;
+        using finalize_kernel_dispatcher_t =
+            dal::backend::kernel_dispatcher<backend::finalize_compute_kernel_cpu<Float, Method>>;
+
+        const auto& local = ctx.get_local();
+        const auto local_partial =
+            partial_kernel_dispatcher_t()(local, desc, partial_compute_input{ input.get_data() });
+        const auto partial =
+            merge_kernel_dispatcher_t()(local, ctx.get_communicator(), local_partial);
+        return finalize_kernel_dispatcher_t()(local, desc, partial);
+    }
+};
+
+#define INSTANTIATE(F, M)                                                         \
+    template struct ONEAPI_DAL_EXPORT compute_ops_dispatcher<host_policy, F, M>; \
+    template struct ONEAPI_DAL_EXPORT compute_ops_dispatcher<spmd_policy<host_policy>, F, M>;
+
+INSTANTIATE(float, method::dense)
+INSTANTIATE(double, method::dense)
+
+} // namespace oneapi::dal::covariance::detail
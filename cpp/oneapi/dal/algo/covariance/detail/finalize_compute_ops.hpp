@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/covariance/compute_types.hpp"
+#include "oneapi/dal/algo/covariance/partial_compute_types.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::covariance::detail {
+
+template <typename Context, typename... Options>
+struct finalize_compute_ops_dispatcher {
+    compute_result operator()(const Context&,
+                              const descriptor_base&,
+                              const partial_compute_result&) const;
+};
+
+template <typename Descriptor>
+struct finalize_compute_ops {
+    using float_t = typename Descriptor::float_t;
+    using method_t = typename Descriptor::method_t;
+    using input_t = partial_compute_result;
+    using result_t = compute_result;
+    using descriptor_base_t = descriptor_base;
+
+    void check_preconditions(const Descriptor& params, const input_t& input) const {
+        if (!(input.get_partial_n_rows().has_data())) {
+            throw domain_error("Input partial_n_rows should not be empty");
+        }
+        if (!(input.get_partial_crossproduct().has_data())) {
+            throw domain_error("Input partial_crossproduct should not be empty");
+        }
+        if (!(input.get_partial_sum().has_data())) {
+            throw domain_error("Input partial_sum should not be empty");
+        }
+    }
+
+    void check_postconditions(const Descriptor& params,
+                              const input_t& input,
+                              const result_t& result) const {
+        const std::int64_t column_count = input.get_partial_sum().get_column_count();
+        if (result.get_cov_matrix().get_row_count() != column_count ||
+            result.get_cov_matrix().get_column_count() != column_count) {
+            throw internal_error("Result cov_matrix should be column_count x column_count table");
+        }
+        if (result.get_means().get_column_count() != column_count) {
+            throw internal_error(
+                "Result means column_count should be equal to partial_sum column_count");
+        }
+    }
+
+    template <typename Context>
+    auto operator()(const Context& ctx, const Descriptor& desc, const input_t& input) const {
+        check_preconditions(desc, input);
+        const auto result =
+            finalize_compute_ops_dispatcher<Context, float_t, method_t>()(ctx, desc, input);
+        check_postconditions(desc, input, result);
+        return result;
+    }
+};
+
+} // namespace oneapi::dal::covariance::detail
@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/detail/partial_compute_ops.hpp"
+#include "oneapi/dal/algo/covariance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::covariance::detail {
+using oneapi::dal::detail::host_policy;
+
+template <typename Float, typename Method>
+struct ONEAPI_DAL_EXPORT partial_compute_ops_dispatcher<host_policy, Float, Method> {
+    partial_compute_result operator()(const host_policy& ctx,
+                                      const descriptor_base& desc,
+                                      const partial_compute_input& input) const {
+        using kernel_dispatcher_t =
+            dal::backend::kernel_dispatcher<backend::partial_compute_kernel_cpu<Float, Method>>;
+        return kernel_dispatcher_t()(ctx, desc, input);
+    }
+};
+
+/// The partial results are small, so they are merged on the host wherever
+/// they were computed
+template <typename Float>
+partial_compute_result merge_partial_results_impl(
+    const std::vector<partial_compute_result>& partials) {
+    const auto ctx = dal::backend::context_cpu{ host_policy{} };
+    return backend::merge_kernel_cpu<Float>{}(ctx, partials);
+}
+
+#define INSTANTIATE(F, M) \
+    template struct ONEAPI_DAL_EXPORT partial_compute_ops_dispatcher<host_policy, F, M>;
+
+INSTANTIATE(float, method::dense)
+INSTANTIATE(double, method::dense)
+
+template ONEAPI_DAL_EXPORT partial_compute_result merge_partial_results_impl<float>(
+    const std::vector<partial_compute_result>&);
+template ONEAPI_DAL_EXPORT partial_compute_result merge_partial_results_impl<double>(
+    const std::vector<partial_compute_result>&);
+
+} // namespace oneapi::dal::covariance::detail
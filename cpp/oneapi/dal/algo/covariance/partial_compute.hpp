@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/covariance/detail/partial_compute_ops.hpp"
+#include "oneapi/dal/algo/covariance/partial_compute_types.hpp"
+#include "oneapi/dal/partial_compute.hpp"
+
+namespace oneapi::dal::detail {
+
+template <typename Descriptor>
+struct partial_compute_ops<Descriptor, dal::covariance::detail::tag>
+        : dal::covariance::detail::partial_compute_ops<Descriptor> {};
+
+} // namespace oneapi::dal::detail
+
+namespace oneapi::dal::covariance {
+
+/// Merges the partial results of the disjoint sets of rows, e.g. the ones
+/// computed on the nodes of a cluster, into the partial result of all rows
+template <typename Float, typename Method>
+partial_compute_result merge_partial_results(
+    const descriptor<Float, Method>& desc,
+    const std::vector<partial_compute_result>& partial_results) {
+    if (partial_results.empty()) {
+        throw invalid_argument("Input partial_results should not be empty");
+    }
+    return detail::merge_partial_results_impl<Float>(partial_results);
+}
+
+} // namespace oneapi::dal::covariance
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/covariance/common.hpp"
+
+namespace oneapi::dal::covariance {
+
+namespace detail {
+class partial_compute_input_impl;
+class partial_compute_result_impl;
+} // namespace detail
+
+/// The sums and the cross-product of the centered rows seen so far, the
+/// memory they take does not depend on the number of rows
+class ONEAPI_DAL_EXPORT partial_compute_result : public base {
+public:
+    partial_compute_result();
+
+    /// The 1 x 1 table of the number of rows, empty before the first block
+    table get_partial_n_rows() const;
+
+    /// The p x p cross-product of the rows centered around their mean
+    table get_partial_crossproduct() const;
+
+    /// The 1 x p table of the column sums
+    table get_partial_sum() const;
+
+    auto& set_partial_n_rows(const table& value) {
+        set_partial_n_rows_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_crossproduct(const table& value) {
+        set_partial_crossproduct_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_sum(const table& value) {
+        set_partial_sum_impl(value);
+        return *this;
+    }
+
+private:
+    void set_partial_n_rows_impl(const table&);
+    void set_partial_crossproduct_impl(const table&);
+    void set_partial_sum_impl(const table&);
+
+    dal::detail::pimpl<detail::partial_compute_result_impl> impl_;
+};
+
+class ONEAPI_DAL_EXPORT partial_compute_input : public base {
+public:
+    partial_compute_input(const table& data);
+    partial_compute_input(const partial_compute_result& prior, const table& data);
+
+    partial_compute_result get_prior() const;
+    table get_data() const;
+
+    auto& set_prior(const partial_compute_result& value) {
+        set_prior_impl(value);
+        return *this;
+    }
+
+    auto& set_data(const table& value) {
+        set_data_impl(value);
+        return *this;
+    }
+
+private:
+    void set_prior_impl(const partial_compute_result& value);
+    void set_data_impl(const table& value);
+
+    dal::detail::pimpl<detail::partial_compute_input_impl> impl_;
+};
+
+} // namespace oneapi::dal::covariance
@@ -46,12 +46,9 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const model<Task>& trained_model,
                                            const table& data) {
     const int64_t row_count = data.get_row_count();
-    const int64_t column_count = data.get_column_count();
 
-    auto arr_data = row_accessor<const Float>{ data }.pull();
 
-    const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
 
     /* init param for daal kernel */
     auto daal_input = rgr::prediction::Input();
@@ -158,3 +158,110 @@ TEST(infer_and_train_cls_kernels_test, can_process_corner_case) {
 
     ASSERT_LE(calculate_classification_error(labels_table, y_test), accuracy_threshold);
 }
+
+TEST(infer_and_train_cls_kernels_test, can_process_small_batch_as_single_rows) {
+    constexpr std::int64_t row_count_train = 6;
+    constexpr std::int64_t row_count_test = 3;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t class_count = 2;
+
+    const float x_train[] = {
+        -2.f, -1.f, -1.f, -1.f, -1.f, -2.f, +1.f, +1.f, +1.f, +2.f, +2.f, +1.f
+    };
+    const float y_train[] = { 0.f, 0.f, 0.f, 1.f, 1.f, 1.f };
+    const float x_test[] = { -1.f, -1.f, 0.5f, 0.5f, 3.f, 2.f };
+
+    const auto x_train_table = dal::homogen_table::wrap(x_train, row_count_train, column_count);
+    const auto y_train_table = dal::homogen_table::wrap(y_train, row_count_train, 1);
+    const auto x_test_table = dal::homogen_table::wrap(x_test, row_count_test, column_count);
+
+    const auto df_desc =
+        df::descriptor<float, df::task::classification, df::method::dense>{}
+            .set_tree_count(10)
+            .set_infer_mode(df::infer_mode::class_labels | df::infer_mode::class_probabilities)
+            .set_voting_mode(df::voting_mode::weighted);
+
+    const auto result_train = dal::train(df_desc, x_train_table, y_train_table);
+    const auto result_infer = dal::infer(df_desc, result_train.get_model(), x_test_table);
+
+    const auto labels = dal::row_accessor<const float>(result_infer.get_labels()).pull();
+    const auto probs = dal::row_accessor<const float>(result_infer.get_probabilities()).pull();
+    ASSERT_EQ(labels.get_count(), row_count_test);
+    ASSERT_EQ(probs.get_count(), row_count_test * class_count);
+
+    for (std::int64_t i = 0; i < row_count_test; i++) {
+        const auto x_row_table =
+            dal::homogen_table::wrap(x_test + i * column_count, 1, column_count);
+        const auto result_row = dal::infer(df_desc, result_train.get_model(), x_row_table);
+
+        const auto row_labels = dal::row_accessor<const float>(result_row.get_labels()).pull();
+        const auto row_probs =
+            dal::row_accessor<const float>(result_row.get_probabilities()).pull();
+        ASSERT_EQ(row_labels[0], labels[i]);
+        for (std::int64_t j = 0; j < class_count; j++) {
+            ASSERT_NEAR(row_probs[j], probs[i * class_count + j], 1e-5);
+        }
+    }
+}
+
+TEST(infer_and_train_cls_kernels_test, can_process_simple_case_hist_method) {
+    constexpr double accuracy_threshold = 0.05;
+    constexpr std::int64_t row_count_train = 6;
+    constexpr std::int64_t row_count_test = 3;
+    constexpr std::int64_t column_count = 2;
+
+    const float x_train[] = {
+        -2.f, -1.f, -1.f, -1.f, -1.f, -2.f, +1.f, +1.f, +1.f, +2.f, +2.f, +1.f
+    };
+    const float y_train[] = { 0.f, 0.f, 0.f, 1.f, 1.f, 1.f };
+    const float x_test[] = { -1.f, -1.f, 2.f, 2.f, 3.f, 2.f };
+    const float y_test[] = { 0.f, 1.f, 1.f };
+
+    const auto x_train_table = dal::homogen_table::wrap(x_train, row_count_train, column_count);
+    const auto y_train_table = dal::homogen_table::wrap(y_train, row_count_train, 1);
+    const auto x_test_table = dal::homogen_table::wrap(x_test, row_count_test, column_count);
+
+    const auto df_train_desc =
+        df::descriptor<float, df::task::classification, df::method::hist>{}.set_min_bin_size(1);
+    const auto df_infer_desc = df::descriptor<float, df::task::classification, df::method::dense>{};
+
+    const auto result_train = dal::train(df_train_desc, x_train_table, y_train_table);
+    const auto result_infer =
+        dal::infer(df_infer_desc, result_train.get_model(), x_test_table);
+
+    auto labels_table = result_infer.get_labels();
+    ASSERT_EQ(labels_table.has_data(), true);
+    ASSERT_EQ(labels_table.get_row_count(), row_count_test);
+    ASSERT_EQ(labels_table.get_column_count(), 1);
+
+    ASSERT_LE(calculate_classification_error(labels_table, y_test), accuracy_threshold);
+
+    // The same seed gives the same forest
+    const auto result_train_again = dal::train(df_train_desc, x_train_table, y_train_table);
+    const auto result_infer_again =
+        dal::infer(df_infer_desc, result_train_again.get_model(), x_test_table);
+    const auto labels = dal::row_accessor<const float>(labels_table).pull();
+    const auto labels_again =
+        dal::row_accessor<const float>(result_infer_again.get_labels()).pull();
+    for (std::int64_t i = 0; i < row_count_test; ++i) {
+        ASSERT_EQ(labels[i], labels_again[i]);
+    }
+}
+
+TEST(infer_and_train_cls_kernels_test, hist_method_rejects_error_metrics) {
+    constexpr std::int64_t row_count_train = 6;
+    constexpr std::int64_t column_count = 2;
+
+    const float x_train[] = {
+        -2.f, -1.f, -1.f, -1.f, -1.f, -2.f, +1.f, +1.f, +1.f, +2.f, +2.f, +1.f
+    };
+    const float y_train[] = { 0.f, 0.f, 0.f, 1.f, 1.f, 1.f };
+
+    const auto x_train_table = dal::homogen_table::wrap(x_train, row_count_train, column_count);
+    const auto y_train_table = dal::homogen_table::wrap(y_train, row_count_train, 1);
+
+    const auto df_desc = df::descriptor<float, df::task::classification, df::method::hist>{}
+                             .set_error_metric_mode(df::error_metric_mode::out_of_bag_error);
+
+    ASSERT_THROW(dal::train(df_desc, x_train_table, y_train_table), dal::unimplemented);
+}
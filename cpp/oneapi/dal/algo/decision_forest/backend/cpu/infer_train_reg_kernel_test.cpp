@@ -127,3 +127,46 @@ TEST(infer_and_train_reg_kernels_test, can_process_simple_case_non_default_param
 
     ASSERT_LE(calculate_mse(result_infer.get_labels(), y_test), mse_threshold);
 }
+
+TEST(infer_and_train_reg_kernels_test, can_process_simple_case_hist_method) {
+    const double mse_threshold = 0.05;
+    constexpr std::int64_t row_count_train = 10;
+    constexpr std::int64_t row_count_test = 5;
+    constexpr std::int64_t column_count = 2;
+
+    const float x_train[] = {
+        0.1f,  0.25f, 0.15f, 0.35f, 0.25f, 0.55f, 0.3f, 0.65f, 0.4f, 0.85f,
+        0.45f, 0.95f, 0.55f, 1.15f, 0.6f,  1.25f, 0.7f, 1.45f, 0.8f, 1.65f,
+    };
+
+    const float y_train[] = {
+        0.0079f, 0.0160f, 0.0407f, 0.0573f, 0.0989f, 0.1240f, 0.1827f, 0.2163f, 0.2919f, 0.3789f,
+    };
+
+    const float x_test[] = {
+        0.2f, 0.45f, 0.35f, 0.75f, 0.5f, 1.05f, 0.65f, 1.35f, 0.75f, 1.55f,
+    };
+
+    const float y_test[] = {
+        0.0269f, 0.0767f, 0.1519f, 0.2527f, 0.3340f,
+    };
+    const auto x_train_table = dal::homogen_table::wrap(x_train, row_count_train, column_count);
+    const auto y_train_table = dal::homogen_table::wrap(y_train, row_count_train, 1);
+
+    const auto x_test_table = dal::homogen_table::wrap(x_test, row_count_test, column_count);
+
+    const auto df_train_desc =
+        df::descriptor<float, df::task::regression, df::method::hist>{}.set_min_bin_size(1);
+    const auto df_infer_desc = df::descriptor<float, df::task::regression, df::method::dense>{};
+
+    const auto result_train = dal::train(df_train_desc, x_train_table, y_train_table);
+    const auto result_infer =
+        dal::infer(df_infer_desc, result_train.get_model(), x_test_table);
+
+    auto labels_table = result_infer.get_labels();
+    ASSERT_EQ(labels_table.has_data(), true);
+    ASSERT_EQ(labels_table.get_row_count(), row_count_test);
+    ASSERT_EQ(labels_table.get_column_count(), 1);
+
+    ASSERT_LE(calculate_mse(result_infer.get_labels(), y_test), mse_threshold);
+}
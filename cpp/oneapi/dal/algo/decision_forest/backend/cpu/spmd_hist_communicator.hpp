@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/src/algorithms/dtrees/forest/df_train_hist_communicator.h>
+
+#include "oneapi/dal/spmd/communicator.hpp"
+
+namespace oneapi::dal::decision_forest::backend {
+
+/// Runs the collectives of the DAAL hist kernel over the processes of the
+/// communicator of the SPMD policy
+class spmd_hist_communicator
+        : public daal::algorithms::decision_forest::training::internal::HistCommunicator {
+public:
+    explicit spmd_hist_communicator(const spmd::communicator& comm) : comm_(comm) {}
+
+    size_t getRankCount() const override {
+        return static_cast<size_t>(comm_.get_rank_count());
+    }
+
+    size_t getRank() const override {
+        return static_cast<size_t>(comm_.get_rank());
+    }
+
+    void allreduce(double* values, size_t n) const override {
+        comm_.allreduce(values, static_cast<std::int64_t>(n));
+    }
+
+    void allgather(const double* send, size_t n, double* recv) const override {
+        comm_.get_impl()->allgather(send, static_cast<std::int64_t>(n * sizeof(double)), recv);
+    }
+
+    void bcast(double* values, size_t n) const override {
+        comm_.bcast(values, static_cast<std::int64_t>(n));
+    }
+
+private:
+    const spmd::communicator& comm_;
+};
+
+} // namespace oneapi::dal::decision_forest::backend
@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/algo/decision_forest/train_types.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/communicator.hpp"
 
 namespace oneapi::dal::decision_forest::backend {
 
@@ -28,4 +29,15 @@ struct train_kernel_cpu {
                                   const train_input<Task>& input) const;
 };
 
+/// Trains the forest on the rows of all processes of the SPMD run. The bin
+/// borders and the histograms of the tree levels are reduced over the
+/// processes, so every process builds the same trees
+template <typename Float, typename Task, typename Method>
+struct spmd_train_kernel_cpu {
+    train_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                  const spmd::communicator& comm,
+                                  const descriptor_base<Task>& params,
+                                  const train_input<Task>& input) const;
+};
+
 } // namespace oneapi::dal::decision_forest::backend
@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/decision_forest/infer.hpp"
+#include "oneapi/dal/algo/decision_forest/test/utils.hpp"
+#include "oneapi/dal/algo/decision_forest/train.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
+#include "oneapi/dal/test/thread_communicator.hpp"
+
+using namespace oneapi;
+namespace df = oneapi::dal::decision_forest;
+
+using spmd_policy_t = dal::detail::spmd_policy<dal::detail::host_policy>;
+
+TEST(train_kernel_hist_spmd_test, classification_trees_are_same_on_all_ranks) {
+    constexpr std::int64_t rank_count = 2;
+    constexpr std::int64_t rank_row_count = 6;
+    constexpr std::int64_t row_count_test = 4;
+    constexpr std::int64_t column_count = 2;
+
+    // Every rank holds the rows of both classes
+    const float x_train[] = { -2.f, -1.f, -1.f, -1.f, -1.f, -2.f, +1.f, +1.f,
+                              +1.f, +2.f, +2.f, +1.f, -3.f, -2.f, -2.f, -3.f,
+                              -1.f, -3.f, +2.f, +2.f, +3.f, +1.f, +2.f, +3.f };
+    const float y_train[] = { 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f };
+    const float x_test[] = { -1.f, -1.f, 2.f, 2.f, 3.f, 2.f, -2.f, -2.f };
+    const float y_test[] = { 0.f, 1.f, 1.f, 0.f };
+
+    const auto train_desc = df::descriptor<float, df::task::classification, df::method::hist>{}
+                                .set_tree_count(5)
+                                .set_features_per_node(column_count)
+                                .set_bootstrap(false);
+    const auto infer_desc = df::descriptor<float, df::task::classification, df::method::dense>{};
+    const auto x_test_table = dal::homogen_table::wrap(x_test, row_count_test, column_count);
+
+    std::vector<std::vector<float>> rank_labels(rank_count);
+    dal::test::run_spmd(rank_count, [&](std::int64_t rank, const dal::spmd::communicator& comm) {
+        const auto x_table =
+            dal::homogen_table::wrap(x_train + rank * rank_row_count * column_count,
+                                     rank_row_count,
+                                     column_count);
+        const auto y_table = dal::homogen_table::wrap(y_train + rank * rank_row_count,
+                                                      rank_row_count,
+                                                      1);
+        const spmd_policy_t policy{ dal::detail::host_policy{}, comm };
+
+        const auto result_train = dal::train(policy, train_desc, x_table, y_table);
+        ASSERT_EQ(result_train.get_model().get_tree_count(), 5);
+
+        const auto result_infer =
+            dal::infer(infer_desc, result_train.get_model(), x_test_table);
+        const auto labels = dal::row_accessor<const float>(result_infer.get_labels()).pull();
+        rank_labels[rank].assign(labels.get_data(), labels.get_data() + row_count_test);
+
+        ASSERT_LE(calculate_classification_error(result_infer.get_labels(), y_test), 0.05);
+    });
+
+    ASSERT_EQ(rank_labels[0], rank_labels[1]);
+}
+
+TEST(train_kernel_hist_spmd_test, regression_fits_step_function) {
+    constexpr std::int64_t rank_count = 2;
+    constexpr std::int64_t rank_row_count = 8;
+    constexpr std::int64_t row_count_test = 4;
+    constexpr std::int64_t column_count = 1;
+
+    // The response is 1 for the positive values and -1 for the negative ones,
+    // the rows of the step are split between the ranks
+    const float x_train[] = { -4.f, -3.f, -2.f, -1.f, 1.f, 2.f, 3.f, 4.f,
+                              -4.5f, -3.5f, -2.5f, -1.5f, 1.5f, 2.5f, 3.5f, 4.5f };
+    const float y_train[] = { -1.f, -1.f, -1.f, -1.f, 1.f, 1.f, 1.f, 1.f,
+                              -1.f, -1.f, -1.f, -1.f, 1.f, 1.f, 1.f, 1.f };
+    const float x_test[] = { -3.f, -1.2f, 1.2f, 3.f };
+    const float y_test[] = { -1.f, -1.f, 1.f, 1.f };
+
+    const auto train_desc = df::descriptor<float, df::task::regression, df::method::hist>{}
+                                .set_tree_count(3)
+                                .set_features_per_node(column_count)
+                                .set_min_observations_in_leaf_node(2)
+                                .set_bootstrap(false);
+    const auto infer_desc = df::descriptor<float, df::task::regression, df::method::dense>{};
+    const auto x_test_table = dal::homogen_table::wrap(x_test, row_count_test, column_count);
+
+    dal::test::run_spmd(rank_count, [&](std::int64_t rank, const dal::spmd::communicator& comm) {
+        const auto x_table = dal::homogen_table::wrap(x_train + rank * rank_row_count,
+                                                      rank_row_count,
+                                                      column_count);
+        const auto y_table = dal::homogen_table::wrap(y_train + rank * rank_row_count,
+                                                      rank_row_count,
+                                                      1);
+        const spmd_policy_t policy{ dal::detail::host_policy{}, comm };
+
+        const auto result_train = dal::train(policy, train_desc, x_table, y_table);
+        const auto result_infer =
+            dal::infer(infer_desc, result_train.get_model(), x_test_table);
+
+        ASSERT_LE(calculate_mse(result_infer.get_labels(), y_test), 1e-6);
+    });
+}
+
+TEST(train_kernel_hist_spmd_test, throws_on_all_ranks_if_one_has_invalid_labels) {
+    constexpr std::int64_t rank_count = 2;
+    constexpr std::int64_t rank_row_count = 2;
+    constexpr std::int64_t column_count = 1;
+
+    const float x_train[] = { -1.f, 1.f, -2.f, 2.f };
+    const float y_train[] = { 0.f, 1.f, 0.f, 5.f };
+
+    const auto train_desc = df::descriptor<float, df::task::classification, df::method::hist>{}
+                                .set_tree_count(1)
+                                .set_bootstrap(false);
+
+    dal::test::run_spmd(rank_count, [&](std::int64_t rank, const dal::spmd::communicator& comm) {
+        const auto x_table = dal::homogen_table::wrap(x_train + rank * rank_row_count,
+                                                      rank_row_count,
+                                                      column_count);
+        const auto y_table = dal::homogen_table::wrap(y_train + rank * rank_row_count,
+                                                      rank_row_count,
+                                                      1);
+        const spmd_policy_t policy{ dal::detail::host_policy{}, comm };
+
+        ASSERT_THROW(dal::train(policy, train_desc, x_table, y_table), dal::invalid_argument);
+    });
+}
+
+TEST(train_kernel_hist_spmd_test, one_rank_gives_forest_of_batch_training) {
+    constexpr std::int64_t row_count_train = 6;
+    constexpr std::int64_t row_count_test = 3;
+    constexpr std::int64_t column_count = 2;
+
+    const float x_train[] = {
+        -2.f, -1.f, -1.f, -1.f, -1.f, -2.f, +1.f, +1.f, +1.f, +2.f, +2.f, +1.f
+    };
+    const float y_train[] = { 0.f, 0.f, 0.f, 1.f, 1.f, 1.f };
+    const float x_test[] = { -1.f, -1.f, 2.f, 2.f, 3.f, 2.f };
+
+    const auto train_desc = df::descriptor<float, df::task::classification, df::method::hist>{}
+                                .set_tree_count(5)
+                                .set_min_bin_size(1)
+                                .set_seed(13);
+    const auto infer_desc = df::descriptor<float, df::task::classification, df::method::dense>{}
+                                .set_infer_mode(df::infer_mode::class_probabilities);
+    const auto x_table = dal::homogen_table::wrap(x_train, row_count_train, column_count);
+    const auto y_table = dal::homogen_table::wrap(y_train, row_count_train, 1);
+    const auto x_test_table = dal::homogen_table::wrap(x_test, row_count_test, column_count);
+
+    const auto batch_model = dal::train(train_desc, x_table, y_table).get_model();
+    const auto batch_probs =
+        dal::row_accessor<const float>(
+            dal::infer(infer_desc, batch_model, x_test_table).get_probabilities())
+            .pull();
+
+    dal::test::run_spmd(1, [&](std::int64_t rank, const dal::spmd::communicator& comm) {
+        const spmd_policy_t policy{ dal::detail::host_policy{}, comm };
+
+        const auto spmd_model = dal::train(policy, train_desc, x_table, y_table).get_model();
+        const auto spmd_probs =
+            dal::row_accessor<const float>(
+                dal::infer(infer_desc, spmd_model, x_test_table).get_probabilities())
+                .pull();
+
+        ASSERT_EQ(spmd_probs.get_count(), batch_probs.get_count());
+        for (std::int64_t i = 0; i < batch_probs.get_count(); ++i) {
+            ASSERT_EQ(spmd_probs[i], batch_probs[i]);
+        }
+    });
+}
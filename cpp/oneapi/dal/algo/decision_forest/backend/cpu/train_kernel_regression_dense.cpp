@@ -58,12 +58,8 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
     const int64_t row_count = data.get_row_count();
     const int64_t column_count = data.get_column_count();
 
-    auto arr_data = row_accessor<const Float>{ data }.pull();
-    auto arr_label = row_accessor<const Float>{ labels }.pull();
-
-    const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
-    const auto daal_labels = interop::convert_to_daal_homogen_table(arr_label, row_count, 1);
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_labels = interop::convert_to_daal_table<Float>(labels);
 
     /* init param for daal kernel */
     auto daal_input = reg::training::Input();
@@ -76,8 +72,7 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
     daal_parameter.featuresPerNode = desc.get_features_per_node();
     daal_parameter.maxTreeDepth = desc.get_max_tree_depth();
     daal_parameter.minObservationsInLeafNode = desc.get_min_observations_in_leaf_node();
-    // TODO take engines from desc
-    daal_parameter.engine = daal::algorithms::engines::mt2203::Batch<>::create();
+    daal_parameter.engine = daal::algorithms::engines::mt2203::Batch<>::create(desc.get_seed());
     daal_parameter.impurityThreshold = desc.get_impurity_threshold();
     daal_parameter.memorySavingMode = desc.get_memory_saving_mode();
     daal_parameter.bootstrap = desc.get_bootstrap();
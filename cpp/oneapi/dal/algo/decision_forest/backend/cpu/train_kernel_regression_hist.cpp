@@ -14,21 +14,138 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <daal/include/services/error_handling.h>
+#include <daal/src/algorithms/dtrees/forest/regression/df_regression_model_impl.h>
+#include <daal/src/services/service_algo_utils.h>
+
+#include <daal/include/algorithms/decision_forest/decision_forest_regression_training_batch.h>
+#include <daal/include/algorithms/decision_forest/decision_forest_regression_training_types.h>
+
+#include <daal/src/algorithms/dtrees/forest/regression/df_regression_train_kernel.h>
+//to prevent reordering by clang-format
+#include <daal/src/algorithms/dtrees/forest/regression/df_regression_train_hist_kernel.h>
+
+#include "oneapi/dal/algo/decision_forest/backend/cpu/spmd_hist_communicator.hpp"
 #include "oneapi/dal/algo/decision_forest/backend/cpu/train_kernel.hpp"
-#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/algo/decision_forest/backend/interop_helpers.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/detail/common.hpp"
 
 namespace oneapi::dal::decision_forest::backend {
 
+using dal::backend::context_cpu;
+
+namespace df = daal::algorithms::decision_forest;
+namespace reg = daal::algorithms::decision_forest::regression;
+
+namespace interop = dal::backend::interop;
+namespace df_interop = dal::backend::interop::decision_forest;
+
+template <typename Float, daal::CpuType Cpu>
+using reg_hist_kernel_t =
+    reg::training::internal::RegressionTrainBatchKernel<Float, reg::training::hist, Cpu>;
+
+using reg_model_p = reg::ModelPtr;
+
+template <typename Float, typename Task>
+static train_result<Task> call_daal_kernel(const context_cpu& ctx,
+                                           const descriptor_base<Task>& desc,
+                                           const table& data,
+                                           const table& labels,
+                                           const df::training::internal::HistCommunicator& comm) {
+    const int64_t column_count = data.get_column_count();
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_labels = interop::convert_to_daal_table<Float>(labels);
+
+    /* init param for daal kernel */
+    auto daal_input = reg::training::Input();
+    daal_input.set(reg::training::data, daal_data);
+    daal_input.set(reg::training::dependentVariable, daal_labels);
+
+    auto daal_parameter = reg::training::Parameter();
+    daal_parameter.nTrees = desc.get_tree_count();
+    daal_parameter.observationsPerTreeFraction = desc.get_observations_per_tree_fraction();
+    daal_parameter.featuresPerNode = desc.get_features_per_node();
+    daal_parameter.maxTreeDepth = desc.get_max_tree_depth();
+    daal_parameter.minObservationsInLeafNode = desc.get_min_observations_in_leaf_node();
+    daal_parameter.engine = daal::algorithms::engines::mt2203::Batch<>::create(desc.get_seed());
+    daal_parameter.impurityThreshold = desc.get_impurity_threshold();
+    daal_parameter.memorySavingMode = desc.get_memory_saving_mode();
+    daal_parameter.bootstrap = desc.get_bootstrap();
+    daal_parameter.minObservationsInSplitNode = desc.get_min_observations_in_split_node();
+    daal_parameter.minWeightFractionInLeafNode = desc.get_min_weight_fraction_in_leaf_node();
+    daal_parameter.minImpurityDecreaseInSplitNode = desc.get_min_impurity_decrease_in_split_node();
+    daal_parameter.maxLeafNodes = desc.get_max_leaf_nodes();
+    daal_parameter.maxBins = desc.get_max_bins();
+    daal_parameter.minBinSize = desc.get_min_bin_size();
+
+    /* the hist kernel rejects the error metrics and the variable importance */
+    daal_parameter.resultsToCompute = static_cast<std::uint64_t>(desc.get_error_metric_mode());
+    daal_parameter.varImportance =
+        df_interop::convert_to_daal_variable_importance_mode(desc.get_variable_importance_mode());
+
+    train_result<Task> res;
+
+    auto daal_result = reg::training::Result();
+
+    reg::ModelPtr mptr = reg::ModelPtr(new reg::internal::ModelImpl(column_count));
+
+    interop::status_to_exception(interop::call_daal_kernel<Float, reg_hist_kernel_t>(
+        ctx,
+        daal::services::internal::hostApp(daal_input),
+        daal_data.get(),
+        daal_labels.get(),
+        nullptr, // no weights
+        *mptr,
+        daal_result,
+        daal_parameter,
+        comm));
+
+    return res.set_model(dal::detail::pimpl_accessor().make_from_pimpl<model<Task>>(
+        std::make_shared<interop::decision_forest::interop_model_impl<Task, reg_model_p>>(mptr)));
+}
+
+template <typename Float, typename Task>
+static train_result<Task> train(const context_cpu& ctx,
+                                const descriptor_base<Task>& desc,
+                                const train_input<Task>& input) {
+    return call_daal_kernel<Float>(ctx,
+                                   desc,
+                                   input.get_data(),
+                                   input.get_labels(),
+                                   df::training::internal::HistCommunicator{});
+}
+
 template <typename Float, typename Task>
 struct train_kernel_cpu<Float, Task, method::hist> {
-    train_result<Task> operator()(const dal::backend::context_cpu& ctx,
-                                  const descriptor_base<Task>& params,
+    train_result<Task> operator()(const context_cpu& ctx,
+                                  const descriptor_base<Task>& desc,
                                   const train_input<Task>& input) const {
-        throw unimplemented("Decision forest train hist method is not implemented for CPU");
+        return train<Float, Task>(ctx, desc, input);
+    }
+};
+
+template <typename Float, typename Task>
+struct spmd_train_kernel_cpu<Float, Task, method::hist> {
+    train_result<Task> operator()(const context_cpu& ctx,
+                                  const spmd::communicator& comm,
+                                  const descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        return call_daal_kernel<Float>(ctx,
+                                       desc,
+                                       input.get_data(),
+                                       input.get_labels(),
+                                       spmd_hist_communicator{ comm });
     }
 };
 
 template struct train_kernel_cpu<float, task::regression, method::hist>;
 template struct train_kernel_cpu<double, task::regression, method::hist>;
 
+template struct spmd_train_kernel_cpu<float, task::regression, method::hist>;
+template struct spmd_train_kernel_cpu<double, task::regression, method::hist>;
+
 } // namespace oneapi::dal::decision_forest::backend
@@ -206,3 +206,54 @@ TEST(infer_and_train_cls_kernels_test, can_process_corner_case) {
 
     ASSERT_LE(calculate_classification_error(labels_table, y_test_host), accuracy_threshold);
 }
+
+TEST(infer_and_train_cls_kernels_test, can_find_exact_split_by_dense_method) {
+    constexpr double accuracy_threshold = 0.05;
+    constexpr std::int64_t row_count_train = 16;
+    constexpr std::int64_t row_count_test = 4;
+    constexpr std::int64_t column_count = 1;
+
+    const float x_train_host[] = { 0.f, 1.f, 2.f,  3.f,  4.f,  5.f,  6.f,  7.f,
+                                   8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f };
+    const float y_train_host[] = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f,
+                                   0.f, 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f };
+
+    const float x_test_host[] = { 11.f, 12.f, 13.f, 14.f };
+    const float y_test_host[] = { 0.f, 0.f, 1.f, 1.f };
+
+    auto selector = sycl::gpu_selector();
+    auto queue = sycl::queue(selector);
+
+    auto x_train = sycl::malloc_shared<float>(row_count_train * column_count, queue);
+    ASSERT_NE(x_train, nullptr);
+    std::memcpy(x_train, x_train_host, sizeof(float) * row_count_train * column_count);
+    const auto x_train_table =
+        dal::homogen_table::wrap(queue, x_train, row_count_train, column_count);
+
+    auto y_train = sycl::malloc_shared<float>(row_count_train, queue);
+    ASSERT_NE(y_train, nullptr);
+    std::memcpy(y_train, y_train_host, sizeof(float) * row_count_train);
+    const auto y_train_table = dal::homogen_table::wrap(queue, y_train, row_count_train, 1);
+
+    auto x_test = sycl::malloc_shared<float>(row_count_test * column_count, queue);
+    ASSERT_NE(x_test, nullptr);
+    std::memcpy(x_test, x_test_host, sizeof(float) * row_count_test * column_count);
+    const auto x_test_table = dal::homogen_table::wrap(queue, x_test, row_count_test, column_count);
+
+    // Two bins cannot separate the classes, the dense method ignores them
+    const auto df_desc = df::descriptor<float, df::task::classification, df::method::dense>{}
+                             .set_class_count(2)
+                             .set_tree_count(1)
+                             .set_bootstrap(false)
+                             .set_min_observations_in_leaf_node(1)
+                             .set_max_bins(2);
+
+    const auto result_train = dal::train(queue, df_desc, x_train_table, y_train_table);
+    const auto result_infer = dal::infer(queue, df_desc, result_train.get_model(), x_test_table);
+
+    auto labels_table = result_infer.get_labels();
+    ASSERT_EQ(labels_table.has_data(), true);
+    ASSERT_EQ(labels_table.get_row_count(), row_count_test);
+
+    ASSERT_LE(calculate_classification_error(labels_table, y_test_host), accuracy_threshold);
+}
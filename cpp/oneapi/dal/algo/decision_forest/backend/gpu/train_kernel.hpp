@@ -28,4 +28,13 @@ struct train_kernel_gpu {
                                   const train_input<Task>& input) const;
 };
 
+/// Trains by the hist kernel with the given binning of the features instead of
+/// the one of the descriptor
+template <typename Float, typename Task>
+train_result<Task> train_by_bins(const dal::backend::context_gpu& ctx,
+                                 const descriptor_base<Task>& params,
+                                 const train_input<Task>& input,
+                                 std::int64_t max_bins,
+                                 std::int64_t min_bin_size);
+
 } // namespace oneapi::dal::decision_forest::backend
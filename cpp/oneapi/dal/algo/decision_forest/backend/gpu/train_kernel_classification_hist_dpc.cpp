@@ -51,7 +51,9 @@ template <typename Float, typename Task>
 static train_result<Task> call_daal_kernel(const context_gpu& ctx,
                                            const descriptor_base<Task>& desc,
                                            const table& data,
-                                           const table& labels) {
+                                           const table& labels,
+                                           std::int64_t max_bins,
+                                           std::int64_t min_bin_size) {
     auto& queue = ctx.get_queue();
     interop::execution_context_guard guard(queue);
 
@@ -77,8 +79,7 @@ static train_result<Task> call_daal_kernel(const context_gpu& ctx,
     daal_parameter.featuresPerNode = desc.get_features_per_node();
     daal_parameter.maxTreeDepth = desc.get_max_tree_depth();
     daal_parameter.minObservationsInLeafNode = desc.get_min_observations_in_leaf_node();
-    // TODO take engines from desc
-    daal_parameter.engine = daal::algorithms::engines::mt2203::Batch<>::create();
+    daal_parameter.engine = daal::algorithms::engines::mt2203::Batch<>::create(desc.get_seed());
     daal_parameter.impurityThreshold = desc.get_impurity_threshold();
     daal_parameter.memorySavingMode = desc.get_memory_saving_mode();
     daal_parameter.bootstrap = desc.get_bootstrap();
@@ -86,8 +87,8 @@ static train_result<Task> call_daal_kernel(const context_gpu& ctx,
     daal_parameter.minWeightFractionInLeafNode = desc.get_min_weight_fraction_in_leaf_node();
     daal_parameter.minImpurityDecreaseInSplitNode = desc.get_min_impurity_decrease_in_split_node();
     daal_parameter.maxLeafNodes = desc.get_max_leaf_nodes();
-    daal_parameter.maxBins = desc.get_max_bins();
-    daal_parameter.minBinSize = desc.get_min_bin_size();
+    daal_parameter.maxBins = max_bins;
+    daal_parameter.minBinSize = min_bin_size;
 
     daal_parameter.resultsToCompute = static_cast<std::uint64_t>(desc.get_error_metric_mode());
 
@@ -161,7 +162,26 @@ template <typename Float, typename Task>
 static train_result<Task> train(const context_gpu& ctx,
                                 const descriptor_base<Task>& desc,
                                 const train_input<Task>& input) {
-    return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_labels());
+    return call_daal_kernel<Float>(ctx,
+                                   desc,
+                                   input.get_data(),
+                                   input.get_labels(),
+                                   desc.get_max_bins(),
+                                   desc.get_min_bin_size());
+}
+
+template <typename Float, typename Task>
+train_result<Task> train_by_bins(const context_gpu& ctx,
+                                 const descriptor_base<Task>& desc,
+                                 const train_input<Task>& input,
+                                 std::int64_t max_bins,
+                                 std::int64_t min_bin_size) {
+    return call_daal_kernel<Float>(ctx,
+                                   desc,
+                                   input.get_data(),
+                                   input.get_labels(),
+                                   max_bins,
+                                   min_bin_size);
 }
 
 template <typename Float, typename Task>
@@ -176,4 +196,17 @@ struct train_kernel_gpu<Float, Task, method::hist> {
 template struct train_kernel_gpu<float, task::classification, method::hist>;
 template struct train_kernel_gpu<double, task::classification, method::hist>;
 
+template train_result<task::classification> train_by_bins<float, task::classification>(
+    const context_gpu&,
+    const descriptor_base<task::classification>&,
+    const train_input<task::classification>&,
+    std::int64_t,
+    std::int64_t);
+template train_result<task::classification> train_by_bins<double, task::classification>(
+    const context_gpu&,
+    const descriptor_base<task::classification>&,
+    const train_input<task::classification>&,
+    std::int64_t,
+    std::int64_t);
+
 } // namespace oneapi::dal::decision_forest::backend
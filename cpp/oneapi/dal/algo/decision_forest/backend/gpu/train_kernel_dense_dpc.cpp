@@ -14,8 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "oneapi/dal/algo/decision_forest/backend/gpu/train_kernel.hpp"
-#include "oneapi/dal/exceptions.hpp"
 
 namespace oneapi::dal::decision_forest::backend {
 
@@ -24,7 +25,14 @@ struct train_kernel_gpu<Float, Task, method::dense> {
     train_result<Task> operator()(const dal::backend::context_gpu& ctx,
                                   const descriptor_base<Task>& params,
                                   const train_input<Task>& input) const {
-        throw unimplemented("Decision forest train dense method is not implemented for GPU");
+        /* The bin per distinct value of every feature makes the splits of the level-wise
+           histogram training the exact ones. The feature index sorts the values by the
+           radix sort, and max_bins equal to the row count does not merge any of them.
+           The histograms of a level are built for blocks of nodes within the memory limit
+           of the hist kernel, the nodes whose histograms exceed it alone are processed by
+           blocks of their features, so the memory does not grow with the number of bins */
+        const std::int64_t max_bins = std::max<std::int64_t>(input.get_data().get_row_count(), 2);
+        return train_by_bins<Float, Task>(ctx, params, input, max_bins, 1);
     }
 };
 
@@ -15,7 +15,9 @@
 *******************************************************************************/
 
 #include "oneapi/dal/algo/decision_forest/common.hpp"
+#include "oneapi/dal/algo/decision_forest/backend/interop_helpers.hpp"
 #include "oneapi/dal/algo/decision_forest/detail/model_impl.hpp"
+#include "oneapi/dal/backend/interop/serialization.hpp"
 #include "oneapi/dal/exceptions.hpp"
 
 namespace oneapi::dal::decision_forest {
@@ -42,6 +44,7 @@ public:
     std::int64_t max_leaf_nodes = 0;
     std::int64_t max_bins = 256;
     std::int64_t min_bin_size = 5;
+    std::int64_t seed = 777;
 
     error_metric_mode error_metric_mode_value = error_metric_mode::none;
     infer_mode infer_mode_value = infer_mode::class_labels;
@@ -70,6 +73,7 @@ public:
     std::int64_t max_leaf_nodes = 0;
     std::int64_t max_bins = 256;
     std::int64_t min_bin_size = 5;
+    std::int64_t seed = 777;
 
     error_metric_mode error_metric_mode_value = error_metric_mode::none;
     infer_mode infer_mode_value = infer_mode::class_labels;
@@ -77,8 +81,6 @@ public:
     bool memory_saving_mode = false;
     bool bootstrap = true;
 
-    // engine field
-
     variable_importance_mode variable_importance_mode_value = variable_importance_mode::none;
     voting_mode voting_mode_value = voting_mode::weighted;
 };
@@ -141,6 +143,10 @@ template <typename Task>
 std::int64_t descriptor_base<Task>::get_min_bin_size() const {
     return impl_->min_bin_size;
 }
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_seed() const {
+    return impl_->seed;
+}
 
 template <typename Task>
 error_metric_mode descriptor_base<Task>::get_error_metric_mode() const {
@@ -239,6 +245,11 @@ void descriptor_base<Task>::set_min_bin_size_impl(std::int64_t value) {
     check_domain_cond((value >= 1), "min_bin_size schould be >= 1");
     impl_->min_bin_size = value;
 }
+template <typename Task>
+void descriptor_base<Task>::set_seed_impl(std::int64_t value) {
+    check_domain_cond((value >= 0), "seed schould be >= 0");
+    impl_->seed = value;
+}
 
 template <typename Task>
 void descriptor_base<Task>::set_error_metric_mode_impl(error_metric_mode value) {
@@ -295,6 +306,56 @@ void model<Task>::clear() {
     impl_->clear();
 }
 
+template <typename Task>
+struct model_serialization_traits {};
+
+template <>
+struct model_serialization_traits<task::classification> {
+    using daal_model_t = daal::algorithms::decision_forest::classification::Model;
+    static constexpr auto id = dal::detail::serialization_id::decision_forest_classification_model;
+};
+
+template <>
+struct model_serialization_traits<task::regression> {
+    using daal_model_t = daal::algorithms::decision_forest::regression::Model;
+    static constexpr auto id = dal::detail::serialization_id::decision_forest_regression_model;
+};
+
+template <typename Task>
+void model<Task>::serialize(dal::detail::binary_output_archive& ar) const {
+    using traits_t = model_serialization_traits<Task>;
+    using daal_model_ptr_t = daal::services::SharedPtr<typename traits_t::daal_model_t>;
+    using interop_model_t =
+        dal::backend::interop::decision_forest::interop_model_impl<Task, daal_model_ptr_t>;
+
+    ar.write(traits_t::id);
+    // The model that is not trained has no trees and is written as the flag only
+    const bool is_trained = impl_->is_interop();
+    ar.write(std::uint32_t(is_trained));
+    if (is_trained) {
+        auto& interop = static_cast<interop_model_t&>(*impl_);
+        dal::backend::interop::serialize_daal_object(*interop.get_model(), ar);
+    }
+}
+
+template <typename Task>
+void model<Task>::deserialize(dal::detail::binary_input_archive& ar) {
+    using traits_t = model_serialization_traits<Task>;
+    using daal_model_ptr_t = daal::services::SharedPtr<typename traits_t::daal_model_t>;
+    using interop_model_t =
+        dal::backend::interop::decision_forest::interop_model_impl<Task, daal_model_ptr_t>;
+
+    ar.expect(traits_t::id);
+    if (ar.read<std::uint32_t>() != 0) {
+        const auto daal_model =
+            dal::backend::interop::deserialize_daal_object<typename traits_t::daal_model_t>(ar);
+        impl_ = std::make_shared<interop_model_t>(daal_model);
+    }
+    else {
+        impl_ = std::make_shared<detail::model_impl<Task>>();
+    }
+}
+
 template class ONEAPI_DAL_EXPORT model<task::classification>;
 template class ONEAPI_DAL_EXPORT model<task::regression>;
 } // namespace oneapi::dal::decision_forest
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/detail/archives.hpp"
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/table/common.hpp"
 #include "oneapi/dal/util/common.hpp"
@@ -103,6 +104,8 @@ public:
     std::int64_t get_max_bins() const;
     std::int64_t get_min_bin_size() const;
 
+    std::int64_t get_seed() const;
+
     bool get_memory_saving_mode() const;
     bool get_bootstrap() const;
 
@@ -142,6 +145,8 @@ protected:
     void set_max_bins_impl(std::int64_t value);
     void set_min_bin_size_impl(std::int64_t value);
 
+    void set_seed_impl(std::int64_t value);
+
     void set_error_metric_mode_impl(error_metric_mode value);
     void set_infer_mode_impl(infer_mode value);
 
@@ -227,6 +232,11 @@ public:
         return *this;
     }
 
+    auto& set_seed(std::int64_t value) {
+        parent::set_seed_impl(value);
+        return *this;
+    }
+
     auto& set_error_metric_mode(error_metric_mode value) {
         parent::set_error_metric_mode_impl(value);
         return *this;
@@ -292,6 +302,11 @@ protected:
 
 private:
     explicit model(const pimpl& impl);
+
+    friend dal::detail::serialization_accessor;
+    void serialize(dal::detail::binary_output_archive& ar) const;
+    void deserialize(dal::detail::binary_input_archive& ar);
+
     pimpl impl_;
 };
 
@@ -100,6 +100,13 @@ TEST(df_bad_arg_tests, set_features_per_node) {
         (df::descriptor<float, df::task::regression, df::method::hist>{}.set_features_per_node(2)));
 }
 
+TEST(df_bad_arg_tests, set_seed) {
+    ASSERT_THROW((df::descriptor<float, df::task::regression, df::method::hist>{}.set_seed(-1)),
+                 dal::domain_error);
+
+    ASSERT_NO_THROW((df::descriptor<float, df::task::regression, df::method::hist>{}.set_seed(0)));
+}
+
 TEST(df_bad_arg_tests, set_impurity_threshold) {
     ASSERT_THROW(
         (df::descriptor<float, df::task::regression, df::method::hist>{}.set_impurity_threshold(
@@ -17,9 +17,11 @@
 #include "oneapi/dal/algo/decision_forest/detail/train_ops.hpp"
 #include "oneapi/dal/algo/decision_forest/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
 
 namespace oneapi::dal::decision_forest::detail {
 using oneapi::dal::detail::host_policy;
+using oneapi::dal::detail::spmd_policy;
 
 template <typename Float, typename Task, typename Method>
 struct train_ops_dispatcher<host_policy, Float, Task, Method> {
@@ -32,8 +34,27 @@ struct train_ops_dispatcher<host_policy, Float, Task, Method> {
     }
 };
 
-#define INSTANTIATE(F, T, M) \
-    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, F, T, M>;
+/// The histograms of the hist method are reduced over the processes, the
+/// dense method is not supported by the SPMD policy
+template <typename Float, typename Task, typename Method>
+struct train_ops_dispatcher<spmd_policy<host_policy>, Float, Task, Method> {
+    train_result<Task> operator()(const spmd_policy<host_policy>& ctx,
+                                  const descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        if constexpr (std::is_same_v<Method, method::hist>) {
+            using kernel_dispatcher_t = dal::backend::kernel_dispatcher<
+                backend::spmd_train_kernel_cpu<Float, Task, Method>>;
+            return kernel_dispatcher_t()(ctx.get_local(), ctx.get_communicator(), desc, input);
+        }
+        else {
+            throw unimplemented("Only the hist method is supported by the SPMD policy");
+        }
+    }
+};
+
+#define INSTANTIATE(F, T, M)                                                      \
+    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, F, T, M>; \
+    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<spmd_policy<host_policy>, F, T, M>;
 
 INSTANTIATE(float, task::classification, method::dense)
 INSTANTIATE(float, task::classification, method::hist)
@@ -20,3 +20,5 @@
 #pragma once
 
 #include "oneapi/dal/algo/jaccard/vertex_similarity.hpp"
+#include "oneapi/dal/algo/jaccard/vertex_similarity_all_pairs.hpp"
+#include "oneapi/dal/algo/jaccard/vertex_similarity_stream.hpp"
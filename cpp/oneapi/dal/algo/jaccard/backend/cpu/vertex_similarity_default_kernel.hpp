@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <vector>
 
 #include "oneapi/dal/algo/jaccard/common.hpp"
 #include "oneapi/dal/algo/jaccard/vertex_similarity_types.hpp"
@@ -24,6 +27,7 @@
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/graph/detail/compressed_neighbor_set.hpp"
 
 namespace oneapi::dal::preview {
 namespace jaccard {
@@ -41,17 +45,32 @@ DAAL_FORCEINLINE std::int32_t max(const std::int32_t &a, const std::int32_t &b)
     return (a <= b) ? b : a;
 }
 
+DAAL_FORCEINLINE std::int64_t compute_max_pairs_count(const std::int32_t &row_range_begin,
+                                                      const std::int32_t &row_range_end,
+                                                      const std::int32_t &column_range_begin,
+                                                      const std::int32_t &column_range_end,
+                                                      const std::int64_t &top_k = 0) {
+    const std::int64_t column_count = column_range_end - column_range_begin;
+    const std::int64_t row_pairs_count = (top_k > 0) ? std::min(top_k, column_count) : column_count;
+    return (row_range_end - row_range_begin) * row_pairs_count;
+}
+
 DAAL_FORCEINLINE std::size_t compute_max_block_size(const std::int32_t &row_range_begin,
                                                     const std::int32_t &row_range_end,
                                                     const std::int32_t &column_range_begin,
-                                                    const std::int32_t &column_range_end) {
+                                                    const std::int32_t &column_range_end,
+                                                    const std::int64_t &top_k = 0,
+                                                    const std::int64_t &coeff_count = 1) {
     // compute the number of the vertex pairs in the block of the graph
-    auto vertex_pairs_count =
-        (row_range_end - row_range_begin) * (column_range_end - column_range_begin);
+    auto vertex_pairs_count = compute_max_pairs_count(row_range_begin,
+                                                      row_range_end,
+                                                      column_range_begin,
+                                                      column_range_end,
+                                                      top_k);
 
     // compute the size of the result element for the algorithm
     auto vertex_pair_element_count = 2; // 2 elements in the vertex pair
-    auto jaccard_coeff_element_count = 1; // 1 Jaccard coeff for the vertex pair
+    auto jaccard_coeff_element_count = coeff_count; // 1 coeff per similarity kind
 
     auto vertex_pair_size = vertex_pair_element_count * sizeof(std::int32_t); // size in bytes
     auto jaccard_coeff_size = jaccard_coeff_element_count * sizeof(float); // size in bytes
@@ -60,6 +79,453 @@ DAAL_FORCEINLINE std::size_t compute_max_block_size(const std::int32_t &row_rang
     return block_result_size;
 }
 
+/// The ratio of the degrees of the vertices in the pair starting from which the
+/// neighbors of the vertex with the smaller degree are searched in the neighbors
+/// of the other vertex instead of merging the sorted neighbor lists. The merge is
+/// vectorized on AVX2 and AVX-512, so galloping pays off at larger ratios there.
+template <typename Cpu>
+constexpr std::int64_t galloping_degree_ratio = 16;
+
+template <>
+constexpr std::int64_t galloping_degree_ratio<dal::backend::cpu_dispatch_avx2> = 32;
+
+template <>
+constexpr std::int64_t galloping_degree_ratio<dal::backend::cpu_dispatch_avx512> = 64;
+
+/// The minimal degree of the row vertex for which its neighbors are stored in
+/// the bitmap, which is reused for all column vertices of the row
+template <typename Cpu>
+constexpr std::int32_t bitmap_min_degree = 1024;
+
+template <>
+constexpr std::int32_t bitmap_min_degree<dal::backend::cpu_dispatch_avx2> = 2048;
+
+template <>
+constexpr std::int32_t bitmap_min_degree<dal::backend::cpu_dispatch_avx512> = 4096;
+
+/// The maximal number of bits in the bitmap of the row vertex neighbors
+constexpr std::int64_t bitmap_max_bit_count = std::int64_t(1) << 26;
+
+/// The visitor of the common neighbors for the intersections which only count them
+struct ignore_neighbor {
+    DAAL_FORCEINLINE void operator()(std::int32_t) const {}
+};
+
+/// Counts the common neighbors of the vertices by searching each neighbor of the
+/// vertex with the small degree in the neighbors of the vertex with the large
+/// degree with an exponential search followed by a binary search
+template <typename Cpu, typename Visitor = ignore_neighbor>
+DAAL_FORCEINLINE std::size_t intersection_galloping(const std::int32_t *neigh_small,
+                                                    const std::int32_t *neigh_large,
+                                                    std::int32_t n_small,
+                                                    std::int32_t n_large,
+                                                    const Visitor &visit = Visitor{}) {
+    std::size_t total = 0;
+    std::int32_t low = 0;
+    for (std::int32_t i = 0; i < n_small && low < n_large; ++i) {
+        const std::int32_t value = neigh_small[i];
+        if (value > neigh_large[n_large - 1]) {
+            break;
+        }
+        std::int32_t step = 1;
+        while (low + step < n_large && neigh_large[low + step] < value) {
+            low += step;
+            step *= 2;
+        }
+        const std::int32_t high = min(low + step + 1, n_large);
+        low = static_cast<std::int32_t>(
+            std::lower_bound(neigh_large + low, neigh_large + high, value) - neigh_large);
+        if (low < n_large && neigh_large[low] == value) {
+            total++;
+            visit(value);
+            low++;
+        }
+    }
+    return total;
+}
+
+/// Counts the common neighbors of the vertices by the scalar merge of the
+/// sorted neighbor lists and passes each of them to the visitor
+template <typename Cpu, typename Visitor>
+DAAL_FORCEINLINE std::size_t intersection_merge(const std::int32_t *neigh_u,
+                                                const std::int32_t *neigh_v,
+                                                std::int32_t n_u,
+                                                std::int32_t n_v,
+                                                const Visitor &visit) {
+    std::size_t total = 0;
+    std::int32_t i_u = 0, i_v = 0;
+    while (i_u < n_u && i_v < n_v) {
+        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
+            return total;
+        }
+        if (neigh_u[i_u] == neigh_v[i_v]) {
+            total++;
+            visit(neigh_u[i_u]);
+            i_u++, i_v++;
+        }
+        else if (neigh_u[i_u] < neigh_v[i_v])
+            i_u++;
+        else
+            i_v++;
+    }
+    return total;
+}
+
+/// Bitmap of the neighbors of the row vertex with a high degree
+template <typename Cpu>
+class neighbor_bitmap {
+public:
+    /// Stores the neighbors of the vertex if its degree is high enough and its
+    /// neighbor indices span a short enough range
+    void build(const std::int32_t *neighbors, std::int32_t count) {
+        clear();
+        if (count < bitmap_min_degree<Cpu>) {
+            return;
+        }
+        const std::int64_t bit_count =
+            std::int64_t(neighbors[count - 1]) - std::int64_t(neighbors[0]) + 1;
+        if (bit_count > bitmap_max_bit_count) {
+            return;
+        }
+        const std::size_t word_count = static_cast<std::size_t>((bit_count + 63) / 64);
+        if (bits_.size() < word_count) {
+            bits_.resize(word_count, 0);
+        }
+        first_ = neighbors[0];
+        last_ = neighbors[count - 1];
+        for (std::int32_t i = 0; i < count; ++i) {
+            const std::int64_t bit = neighbors[i] - first_;
+            bits_[bit >> 6] |= std::uint64_t(1) << (bit & 63);
+        }
+        neighbors_ = neighbors;
+        count_ = count;
+    }
+
+    bool is_built() const {
+        return count_ > 0;
+    }
+
+    /// Counts the neighbors from the list which are set in the bitmap
+    template <typename Visitor = ignore_neighbor>
+    DAAL_FORCEINLINE std::size_t intersection(const std::int32_t *neigh,
+                                              std::int32_t n,
+                                              const Visitor &visit = Visitor{}) const {
+        std::size_t total = 0;
+        for (std::int32_t i = 0; i < n; ++i) {
+            const std::int32_t value = neigh[i];
+            if (value > last_) {
+                break;
+            }
+            if (value >= first_) {
+                const std::int64_t bit = value - first_;
+                const std::size_t is_set = (bits_[bit >> 6] >> (bit & 63)) & 1;
+                total += is_set;
+                if (is_set) {
+                    visit(value);
+                }
+            }
+        }
+        return total;
+    }
+
+private:
+    // resets only the bits set for the previous vertex
+    void clear() {
+        for (std::int32_t i = 0; i < count_; ++i) {
+            bits_[(neighbors_[i] - first_) >> 6] = 0;
+        }
+        count_ = 0;
+    }
+
+    std::vector<std::uint64_t> bits_;
+    const std::int32_t *neighbors_ = nullptr;
+    std::int32_t count_ = 0;
+    std::int32_t first_ = 0;
+    std::int32_t last_ = 0;
+};
+
+/// Counts the common neighbors of the row vertex u and the column vertex v
+/// choosing the method by the degrees of the vertices: the galloping search
+/// for the pairs with very different degrees, the bitmap of the row vertex
+/// with a high degree, and the merge of the neighbor lists otherwise. The galloping
+/// search and the bitmap pass the common neighbors to the visitor, the merge is
+/// expected to do the same if the visitor is not ignore_neighbor.
+template <typename Cpu, typename Merge, typename Visitor = ignore_neighbor>
+DAAL_FORCEINLINE std::size_t intersection_by_degree(std::int32_t *neigh_u,
+                                                    std::int32_t *neigh_v,
+                                                    std::int32_t n_u,
+                                                    std::int32_t n_v,
+                                                    const neighbor_bitmap<Cpu> &bitmap_u,
+                                                    const Merge &merge,
+                                                    const Visitor &visit = Visitor{}) {
+    constexpr std::int64_t ratio = galloping_degree_ratio<Cpu>;
+    if (n_v >= ratio * n_u) {
+        return intersection_galloping<Cpu>(neigh_u, neigh_v, n_u, n_v, visit);
+    }
+    if (bitmap_u.is_built()) {
+        return bitmap_u.intersection(neigh_v, n_v, visit);
+    }
+    if (n_u >= ratio * n_v) {
+        return intersection_galloping<Cpu>(neigh_v, neigh_u, n_v, n_u, visit);
+    }
+    return merge(neigh_u, neigh_v, n_u, n_v);
+}
+
+/// Counts the common neighbors of the vertices as intersection_by_degree and, if
+/// the weights of the vertices are given, sums the weights of the common
+/// neighbors. The vectorized merge does not locate the common neighbors, so the
+/// weighted intersection uses the scalar merge.
+template <typename Cpu, typename Merge>
+DAAL_FORCEINLINE std::size_t intersection_with_weights(std::int32_t *neigh_u,
+                                                       std::int32_t *neigh_v,
+                                                       std::int32_t n_u,
+                                                       std::int32_t n_v,
+                                                       const neighbor_bitmap<Cpu> &bitmap_u,
+                                                       const Merge &merge,
+                                                       const float *weights,
+                                                       float &weight_sum) {
+    weight_sum = 0.0f;
+    if (!weights) {
+        return intersection_by_degree(neigh_u, neigh_v, n_u, n_v, bitmap_u, merge);
+    }
+    const auto add_weight = [&](std::int32_t w) {
+        weight_sum += weights[w];
+    };
+    const auto weighted_merge = [&](const std::int32_t *u,
+                                    const std::int32_t *v,
+                                    std::int32_t count_u,
+                                    std::int32_t count_v) {
+        return intersection_merge<Cpu>(u, v, count_u, count_v, add_weight);
+    };
+    return intersection_by_degree(neigh_u, neigh_v, n_u, n_v, bitmap_u, weighted_merge, add_weight);
+}
+
+/// The number of the kinds of the similarity coefficients
+constexpr std::int64_t similarity_kind_count = 5;
+
+/// Computes the coefficients of the similarity kinds selected in the descriptor
+/// from the number of the common neighbors of the vertex pair and the sum of
+/// their Adamic-Adar weights 1 / log(d(w)). The coefficients of the k-th
+/// selected kind are the k-th row of the coefficients of the block.
+template <typename Cpu>
+class similarity_coeffs {
+public:
+    similarity_coeffs(similarity_kind kinds,
+                      const std::int32_t *degrees,
+                      std::int64_t vertex_count) {
+        for (std::int32_t k = 0; k < similarity_kind_count; ++k) {
+            const auto kind = static_cast<similarity_kind>(std::uint64_t(1) << k);
+            if (check_mask_flag(kinds, kind)) {
+                kinds_[count_++] = k;
+            }
+        }
+        // the common neighbor of two distinct vertices has the degree > 1
+        // unless the graph has self-loops, the weights of such vertices are 0
+        if (check_mask_flag(kinds, similarity_kind::adamic_adar)) {
+            weights_.resize(vertex_count);
+            for (std::int64_t w = 0; w < vertex_count; ++w) {
+                weights_[w] = (degrees[w] > 1) ? 1.0f / std::log(float(degrees[w])) : 0.0f;
+            }
+        }
+    }
+
+    std::int64_t get_count() const {
+        return count_;
+    }
+
+    /// Returns the Adamic-Adar weights of the vertices, or nullptr if the
+    /// Adamic-Adar index is not selected
+    const float *get_weights() const {
+        return weights_.empty() ? nullptr : weights_.data();
+    }
+
+    /// Returns the coefficient of the k-th selected kind of the pair of vertices
+    /// with the degrees n_u and n_v
+    DAAL_FORCEINLINE float get(std::int64_t k,
+                               std::size_t intersection_value,
+                               float weight_sum,
+                               std::int32_t n_u,
+                               std::int32_t n_v) const {
+        const float value = float(intersection_value);
+        switch (kinds_[k]) {
+            case 0: return value / float(n_u + n_v - std::int64_t(intersection_value));
+            case 1: return value / float(min(n_u, n_v));
+            case 2: return value / std::sqrt(float(n_u) * float(n_v));
+            case 3: return weight_sum;
+            default: return value;
+        }
+    }
+
+    /// Writes the coefficients of all selected kinds of the pair to the position
+    /// of the rows of the coefficients with the given stride
+    DAAL_FORCEINLINE void write(float *coeffs,
+                                std::int64_t stride,
+                                std::int64_t position,
+                                std::size_t intersection_value,
+                                float weight_sum,
+                                std::int32_t n_u,
+                                std::int32_t n_v) const {
+        for (std::int64_t k = 0; k < count_; ++k) {
+            coeffs[k * stride + position] = get(k, intersection_value, weight_sum, n_u, n_v);
+        }
+    }
+
+    /// Writes the coefficients of the pair of the vertex with itself. The ratio
+    /// kinds are 1 for any degree as the Jaccard coefficient of the diagonal.
+    void write_diagonal(float *coeffs,
+                        std::int64_t stride,
+                        std::int64_t position,
+                        const std::int32_t *neighbors,
+                        std::int32_t n) const {
+        float weight_sum = 0.0f;
+        for (std::int32_t i = 0; i < n && !weights_.empty(); ++i) {
+            weight_sum += weights_[neighbors[i]];
+        }
+        for (std::int64_t k = 0; k < count_; ++k) {
+            const bool is_ratio = kinds_[k] < 3;
+            coeffs[k * stride + position] = is_ratio ? 1.0f : get(k, n, weight_sum, n, n);
+        }
+    }
+
+private:
+    std::int32_t kinds_[similarity_kind_count] = {};
+    std::int64_t count_ = 0;
+    std::vector<float> weights_;
+};
+
+/// Decoder of the compressed adjacency lists
+template <typename Cpu>
+struct neighbor_decoder {
+    static void decode(const std::uint8_t *in, std::int32_t count, std::int32_t *out) {
+        dal::preview::detail::compressed_neighbor_set<std::int32_t>::decode_list(in, count, out);
+    }
+};
+
+/// Provides the sorted neighbors of the row and column vertices of the graph
+/// block. The neighbors of the graph with compressed adjacency lists are decoded
+/// into the buffers. The column neighbors stay valid until the next call of
+/// get_column. The row neighbors stay valid until the second next call of
+/// get_row, since the row bitmap clears the bits of the previous row.
+template <typename Cpu, typename Decoder = neighbor_decoder<Cpu>>
+class neighbor_reader {
+public:
+    template <typename GraphImpl>
+    explicit neighbor_reader(const GraphImpl &g)
+            : offsets_(g._edge_offsets.data()),
+              neighbors_(const_cast<std::int32_t *>(g._vertex_neighbors.data())),
+              degrees_(g._degrees.data()),
+              compressed_(g._compressed_neighbors.empty() ? nullptr
+                                                          : &g._compressed_neighbors) {}
+
+    DAAL_FORCEINLINE std::int32_t *get_row(std::int32_t vertex) {
+        row_buffer_index_ ^= 1;
+        return get(vertex, row_buffers_[row_buffer_index_]);
+    }
+
+    DAAL_FORCEINLINE std::int32_t *get_column(std::int32_t vertex) {
+        return get(vertex, column_buffer_);
+    }
+
+private:
+    DAAL_FORCEINLINE std::int32_t *get(std::int32_t vertex, std::vector<std::int32_t> &buffer) {
+        if (!compressed_) {
+            return neighbors_ + offsets_[vertex];
+        }
+        // the decoders write up to 3 extra elements; the element before the
+        // neighbors keeps the checks of the first and the last neighbor of the
+        // empty list false as for the adjacent lists of the plain graph
+        const std::int32_t count = degrees_[vertex];
+        const std::size_t buffer_size = static_cast<std::size_t>(count) + 5;
+        if (buffer.size() < buffer_size) {
+            buffer.resize(buffer_size);
+            buffer[0] = -1;
+        }
+        Decoder::decode(compressed_->get_list(vertex), count, buffer.data() + 1);
+        return buffer.data() + 1;
+    }
+
+    const std::int32_t *offsets_;
+    std::int32_t *neighbors_;
+    const std::int32_t *degrees_;
+    const dal::preview::detail::compressed_neighbor_set<std::int32_t> *compressed_;
+    std::vector<std::int32_t> row_buffers_[2];
+    int row_buffer_index_ = 0;
+    std::vector<std::int32_t> column_buffer_;
+};
+
+/// Bounded heap of the vertex pairs with the largest coefficients of the first
+/// selected similarity kind in a row of the graph block. The worst of the kept
+/// pairs is on the top of the heap. The pairs keep their intersections, so the
+/// coefficients of the other kinds are computed only for the kept pairs.
+template <typename Cpu>
+class top_k_heap {
+public:
+    struct item_t {
+        float coeff;
+        std::int32_t vertex;
+        std::size_t intersection_value;
+        float weight_sum;
+    };
+
+    explicit top_k_heap(std::int64_t k) : k_(k) {
+        items_.reserve(k);
+    }
+
+    DAAL_FORCEINLINE void push(float coeff,
+                               std::int32_t vertex,
+                               std::size_t intersection_value = 0,
+                               float weight_sum = 0.0f) {
+        const item_t item = { coeff, vertex, intersection_value, weight_sum };
+        if (static_cast<std::int64_t>(items_.size()) < k_) {
+            items_.push_back(item);
+            std::push_heap(items_.begin(), items_.end(), is_better);
+        }
+        else if (is_better(item, items_.front())) {
+            std::pop_heap(items_.begin(), items_.end(), is_better);
+            items_.back() = item;
+            std::push_heap(items_.begin(), items_.end(), is_better);
+        }
+    }
+
+    /// Writes the kept pairs of the row in the order of descending coefficients
+    /// starting from the position nnz and empties the heap
+    ///
+    /// @return The position after the last written pair
+    std::int64_t flush(std::int32_t row,
+                       std::int32_t *first_vertices,
+                       std::int32_t *second_vertices,
+                       float *coeffs,
+                       std::int64_t stride,
+                       const similarity_coeffs<Cpu> &similarity,
+                       const std::int32_t *degrees,
+                       std::int64_t nnz) {
+        std::sort_heap(items_.begin(), items_.end(), is_better);
+        for (const auto &item : items_) {
+            similarity.write(coeffs,
+                             stride,
+                             nnz,
+                             item.intersection_value,
+                             item.weight_sum,
+                             degrees[row],
+                             degrees[item.vertex]);
+            first_vertices[nnz] = row;
+            second_vertices[nnz] = item.vertex;
+            nnz++;
+        }
+        items_.clear();
+        return nnz;
+    }
+
+private:
+    // larger coefficients are better, ties are resolved in favor of smaller indices
+    static bool is_better(const item_t &a, const item_t &b) {
+        return (a.coeff > b.coeff) || (a.coeff == b.coeff && a.vertex < b.vertex);
+    }
+
+    std::int64_t k_;
+    std::vector<item_t> items_;
+};
+
 } // namespace detail
 } // namespace jaccard
 } // namespace oneapi::dal::preview
@@ -264,75 +264,172 @@ DAAL_FORCEINLINE std::size_t intersection(std::int32_t *neigh_u,
     return total;
 }
 
+/// Shuffle masks, which move the bytes of 4 differences of the compressed
+/// adjacency list to the 32-bit lanes, and the data lengths of the 4 differences
+/// for all values of the control byte
+struct stream_vbyte_tables {
+    std::uint8_t shuffle[256][16];
+    std::uint8_t length[256];
+
+    constexpr stream_vbyte_tables() : shuffle(), length() {
+        for (int control = 0; control < 256; ++control) {
+            int offset = 0;
+            for (int k = 0; k < 4; ++k) {
+                const int byte_count = ((control >> (2 * k)) & 3) + 1;
+                for (int b = 0; b < 4; ++b) {
+                    shuffle[control][4 * k + b] =
+                        static_cast<std::uint8_t>(b < byte_count ? offset + b : 0xFF);
+                }
+                offset += byte_count;
+            }
+            length[control] = static_cast<std::uint8_t>(offset);
+        }
+    }
+};
+
+inline constexpr stream_vbyte_tables stream_vbyte_lookup{};
+
+/// Decoder of the compressed adjacency lists, which restores 4 neighbors per
+/// control byte with the byte shuffle and the prefix sum in the vector register
+template <typename Cpu>
+struct neighbor_decoder_avx2 {
+    static void decode(const std::uint8_t *in, std::int32_t count, std::int32_t *out) {
+        using compressed_set_t = dal::preview::detail::compressed_neighbor_set<std::int32_t>;
+        const std::uint8_t *control = in;
+        const std::uint8_t *data = in + (count + 3) / 4;
+        const std::int32_t group_count = count / 4;
+        __m128i previous = _mm_setzero_si128();
+        for (std::int32_t g = 0; g < group_count; ++g) {
+            const std::uint8_t c = control[g];
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+            const __m128i mask =
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(stream_vbyte_lookup.shuffle[c]));
+            __m128i values = _mm_shuffle_epi8(bytes, mask);
+            values = _mm_add_epi32(values, _mm_slli_si128(values, 4));
+            values = _mm_add_epi32(values, _mm_slli_si128(values, 8));
+            values = _mm_add_epi32(values, previous);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 4 * g), values);
+            previous = _mm_shuffle_epi32(values, _MM_SHUFFLE(3, 3, 3, 3));
+            data += stream_vbyte_lookup.length[c];
+        }
+        const std::uint32_t last =
+            group_count ? static_cast<std::uint32_t>(out[4 * group_count - 1]) : 0;
+        compressed_set_t::decode_tail(control, data, 4 * group_count, count, last, out);
+    }
+};
+
 template <typename Cpu>
 vertex_similarity_result call_jaccard_default_kernel_avx2(
     const descriptor_base &desc,
     vertex_similarity_input<undirected_adjacency_array_graph<>> &input) {
     const auto &my_graph = input.get_graph();
     const auto &g = oneapi::dal::preview::detail::get_impl(my_graph);
-    auto g_edge_offsets = g->_edge_offsets.data();
-    auto g_vertex_neighbors = g->_vertex_neighbors.data();
     auto g_degrees = g->_degrees.data();
     const std::int32_t row_begin = static_cast<std::int32_t>(desc.get_row_range_begin());
     const auto row_end = static_cast<std::int32_t>(desc.get_row_range_end());
     const auto column_begin = static_cast<std::int32_t>(desc.get_column_range_begin());
     const auto column_end = static_cast<std::int32_t>(desc.get_column_range_end());
-    const auto number_elements_in_block = (row_end - row_begin) * (column_end - column_begin);
+    const auto top_k = desc.get_top_k();
+    const bool upper_triangle = desc.get_upper_triangle();
+    const similarity_coeffs<Cpu> similarity(desc.get_similarity(), g_degrees, g->_vertex_count);
+    const std::int64_t coeff_count = similarity.get_count();
+    const float *weights = similarity.get_weights();
+    const auto number_elements_in_block =
+        compute_max_pairs_count(row_begin, row_end, column_begin, column_end, top_k);
     const size_t max_block_size =
-        compute_max_block_size(row_begin, row_end, column_begin, column_end);
+        compute_max_block_size(row_begin, row_end, column_begin, column_end, top_k, coeff_count);
     void *result_ptr = input.get_caching_builder()(max_block_size);
     int *first_vertices = reinterpret_cast<int *>(result_ptr);
     int *second_vertices = first_vertices + number_elements_in_block;
-    float *jaccard = reinterpret_cast<float *>(first_vertices + 2 * number_elements_in_block);
+    float *coeffs = reinterpret_cast<float *>(first_vertices + 2 * number_elements_in_block);
     std::int64_t nnz = 0;
-    for (std::int32_t i = row_begin; i < row_end; ++i) {
-        const auto i_neighbor_size = g_degrees[i];
-        const auto i_neigbhors = g_vertex_neighbors + g_edge_offsets[i];
-        const auto diagonal = min(i, column_end);
-        for (std::int32_t j = column_begin; j < diagonal; j++) {
-            const auto j_neighbor_size = g_degrees[j];
-            const auto j_neigbhors = g_vertex_neighbors + g_edge_offsets[j];
-            if (!(i_neigbhors[0] > j_neigbhors[j_neighbor_size - 1]) &&
-                !(j_neigbhors[0] > i_neigbhors[i_neighbor_size - 1])) {
-                auto intersection_value =
-                    intersection(i_neigbhors, j_neigbhors, i_neighbor_size, j_neighbor_size);
-                if (intersection_value) {
-                    jaccard[nnz] = float(intersection_value) /
-                                   float(i_neighbor_size + j_neighbor_size - intersection_value);
+    top_k_heap<Cpu> heap(top_k);
+    neighbor_bitmap<Cpu> bitmap;
+    neighbor_reader<Cpu, neighbor_decoder_avx2<Cpu>> reader(*g);
+
+    // all selected coefficients of the pair are computed from one intersection
+    const auto process_pair = [&](std::int32_t i,
+                                  std::int32_t *i_neigbhors,
+                                  std::int32_t i_neighbor_size,
+                                  std::int32_t j) {
+        const auto j_neighbor_size = g_degrees[j];
+        const auto j_neigbhors = reader.get_column(j);
+        if (!(i_neigbhors[0] > j_neigbhors[j_neighbor_size - 1]) &&
+            !(j_neigbhors[0] > i_neigbhors[i_neighbor_size - 1])) {
+            float weight_sum = 0.0f;
+            auto intersection_value = intersection_with_weights(i_neigbhors,
+                                                                j_neigbhors,
+                                                                i_neighbor_size,
+                                                                j_neighbor_size,
+                                                                bitmap,
+                                                                intersection,
+                                                                weights,
+                                                                weight_sum);
+            if (intersection_value) {
+                if (top_k) {
+                    const float coeff = similarity.get(0,
+                                                       intersection_value,
+                                                       weight_sum,
+                                                       i_neighbor_size,
+                                                       j_neighbor_size);
+                    heap.push(coeff, j, intersection_value, weight_sum);
+                }
+                else {
+                    similarity.write(coeffs,
+                                     number_elements_in_block,
+                                     nnz,
+                                     intersection_value,
+                                     weight_sum,
+                                     i_neighbor_size,
+                                     j_neighbor_size);
                     first_vertices[nnz] = i;
                     second_vertices[nnz] = j;
                     nnz++;
                 }
             }
         }
+    };
 
-        if (diagonal >= column_begin && diagonal < column_end) {
-            jaccard[nnz] = 1.0;
+    for (std::int32_t i = row_begin; i < row_end; ++i) {
+        const auto i_neighbor_size = g_degrees[i];
+        const auto i_neigbhors = reader.get_row(i);
+        bitmap.build(i_neigbhors, i_neighbor_size);
+        const auto diagonal = min(i, column_end);
+        const auto lower_triangle_end = upper_triangle ? column_begin : diagonal;
+        for (std::int32_t j = column_begin; j < lower_triangle_end; j++) {
+            process_pair(i, i_neigbhors, i_neighbor_size, j);
+        }
+
+        if (!top_k && diagonal >= column_begin && diagonal < column_end) {
+            similarity.write_diagonal(coeffs,
+                                      number_elements_in_block,
+                                      nnz,
+                                      i_neigbhors,
+                                      i_neighbor_size);
             first_vertices[nnz] = i;
             second_vertices[nnz] = diagonal;
             nnz++;
         }
 
         for (std::int32_t j = max(column_begin, diagonal + 1); j < column_end; j++) {
-            const auto j_neighbor_size = g_degrees[j];
-            const auto j_neigbhors = g_vertex_neighbors + g_edge_offsets[j];
-            if (!(i_neigbhors[0] > j_neigbhors[j_neighbor_size - 1]) &&
-                !(j_neigbhors[0] > i_neigbhors[i_neighbor_size - 1])) {
-                auto intersection_value =
-                    intersection(i_neigbhors, j_neigbhors, i_neighbor_size, j_neighbor_size);
-                if (intersection_value) {
-                    jaccard[nnz] = float(intersection_value) /
-                                   float(i_neighbor_size + j_neighbor_size - intersection_value);
-                    first_vertices[nnz] = i;
-                    second_vertices[nnz] = j;
-                    nnz++;
-                }
-            }
+            process_pair(i, i_neigbhors, i_neighbor_size, j);
+        }
+
+        if (top_k) {
+            nnz = heap.flush(i,
+                             first_vertices,
+                             second_vertices,
+                             coeffs,
+                             number_elements_in_block,
+                             similarity,
+                             g_degrees,
+                             nnz);
         }
     }
-    vertex_similarity_result res(homogen_table::wrap(first_vertices, 2, number_elements_in_block),
-                                 homogen_table::wrap(jaccard, 1, number_elements_in_block),
-                                 nnz);
+    vertex_similarity_result res(
+        homogen_table::wrap(first_vertices, 2, number_elements_in_block),
+        homogen_table::wrap(coeffs, coeff_count, number_elements_in_block),
+        nnz);
     return res;
 }
 } // namespace detail
@@ -56,69 +56,112 @@ vertex_similarity_result call_jaccard_default_kernel_scalar(
     vertex_similarity_input<undirected_adjacency_array_graph<>> &input) {
     const auto &my_graph = input.get_graph();
     const auto &g = oneapi::dal::preview::detail::get_impl(my_graph);
-    auto g_edge_offsets = g->_edge_offsets.data();
-    auto g_vertex_neighbors = g->_vertex_neighbors.data();
     auto g_degrees = g->_degrees.data();
     const std::int32_t row_begin = static_cast<std::int32_t>(desc.get_row_range_begin());
     const auto row_end = static_cast<std::int32_t>(desc.get_row_range_end());
     const auto column_begin = static_cast<std::int32_t>(desc.get_column_range_begin());
     const auto column_end = static_cast<std::int32_t>(desc.get_column_range_end());
-    const auto number_elements_in_block = (row_end - row_begin) * (column_end - column_begin);
+    const auto top_k = desc.get_top_k();
+    const bool upper_triangle = desc.get_upper_triangle();
+    const similarity_coeffs<Cpu> similarity(desc.get_similarity(), g_degrees, g->_vertex_count);
+    const std::int64_t coeff_count = similarity.get_count();
+    const float *weights = similarity.get_weights();
+    const auto number_elements_in_block =
+        compute_max_pairs_count(row_begin, row_end, column_begin, column_end, top_k);
     const size_t max_block_size =
-        compute_max_block_size(row_begin, row_end, column_begin, column_end);
+        compute_max_block_size(row_begin, row_end, column_begin, column_end, top_k, coeff_count);
     void *result_ptr = input.get_caching_builder()(max_block_size);
     int *first_vertices = reinterpret_cast<int *>(result_ptr);
     int *second_vertices = first_vertices + number_elements_in_block;
-    float *jaccard = reinterpret_cast<float *>(first_vertices + 2 * number_elements_in_block);
+    float *coeffs = reinterpret_cast<float *>(first_vertices + 2 * number_elements_in_block);
     std::int64_t nnz = 0;
-    for (std::int32_t i = row_begin; i < row_end; ++i) {
-        const auto i_neighbor_size = g_degrees[i];
-        const auto i_neigbhors = g_vertex_neighbors + g_edge_offsets[i];
-        const auto diagonal = min(i, column_end);
-        for (std::int32_t j = column_begin; j < diagonal; j++) {
-            const auto j_neighbor_size = g_degrees[j];
-            const auto j_neigbhors = g_vertex_neighbors + g_edge_offsets[j];
-            if (!(i_neigbhors[0] > j_neigbhors[j_neighbor_size - 1]) &&
-                !(j_neigbhors[0] > i_neigbhors[i_neighbor_size - 1])) {
-                auto intersection_value =
-                    intersection(i_neigbhors, j_neigbhors, i_neighbor_size, j_neighbor_size);
-                if (intersection_value) {
-                    jaccard[nnz] = float(intersection_value) /
-                                   float(i_neighbor_size + j_neighbor_size - intersection_value);
+    top_k_heap<Cpu> heap(top_k);
+    neighbor_bitmap<Cpu> bitmap;
+    neighbor_reader<Cpu> reader(*g);
+
+    // all selected coefficients of the pair are computed from one intersection
+    const auto process_pair = [&](std::int32_t i,
+                                  std::int32_t *i_neigbhors,
+                                  std::int32_t i_neighbor_size,
+                                  std::int32_t j) {
+        const auto j_neighbor_size = g_degrees[j];
+        const auto j_neigbhors = reader.get_column(j);
+        if (!(i_neigbhors[0] > j_neigbhors[j_neighbor_size - 1]) &&
+            !(j_neigbhors[0] > i_neigbhors[i_neighbor_size - 1])) {
+            float weight_sum = 0.0f;
+            auto intersection_value = intersection_with_weights(i_neigbhors,
+                                                                j_neigbhors,
+                                                                i_neighbor_size,
+                                                                j_neighbor_size,
+                                                                bitmap,
+                                                                intersection,
+                                                                weights,
+                                                                weight_sum);
+            if (intersection_value) {
+                if (top_k) {
+                    const float coeff = similarity.get(0,
+                                                       intersection_value,
+                                                       weight_sum,
+                                                       i_neighbor_size,
+                                                       j_neighbor_size);
+                    heap.push(coeff, j, intersection_value, weight_sum);
+                }
+                else {
+                    similarity.write(coeffs,
+                                     number_elements_in_block,
+                                     nnz,
+                                     intersection_value,
+                                     weight_sum,
+                                     i_neighbor_size,
+                                     j_neighbor_size);
                     first_vertices[nnz] = i;
                     second_vertices[nnz] = j;
                     nnz++;
                 }
             }
         }
+    };
 
-        if (diagonal >= column_begin && diagonal < column_end) {
-            jaccard[nnz] = 1.0;
+    for (std::int32_t i = row_begin; i < row_end; ++i) {
+        const auto i_neighbor_size = g_degrees[i];
+        const auto i_neigbhors = reader.get_row(i);
+        bitmap.build(i_neigbhors, i_neighbor_size);
+        const auto diagonal = min(i, column_end);
+        const auto lower_triangle_end = upper_triangle ? column_begin : diagonal;
+        for (std::int32_t j = column_begin; j < lower_triangle_end; j++) {
+            process_pair(i, i_neigbhors, i_neighbor_size, j);
+        }
+
+        if (!top_k && diagonal >= column_begin && diagonal < column_end) {
+            similarity.write_diagonal(coeffs,
+                                      number_elements_in_block,
+                                      nnz,
+                                      i_neigbhors,
+                                      i_neighbor_size);
             first_vertices[nnz] = i;
             second_vertices[nnz] = diagonal;
             nnz++;
         }
 
         for (std::int32_t j = max(column_begin, diagonal + 1); j < column_end; j++) {
-            const auto j_neighbor_size = g_degrees[j];
-            const auto j_neigbhors = g_vertex_neighbors + g_edge_offsets[j];
-            if (!(i_neigbhors[0] > j_neigbhors[j_neighbor_size - 1]) &&
-                !(j_neigbhors[0] > i_neigbhors[i_neighbor_size - 1])) {
-                auto intersection_value =
-                    intersection(i_neigbhors, j_neigbhors, i_neighbor_size, j_neighbor_size);
-                if (intersection_value) {
-                    jaccard[nnz] = float(intersection_value) /
-                                   float(i_neighbor_size + j_neighbor_size - intersection_value);
-                    first_vertices[nnz] = i;
-                    second_vertices[nnz] = j;
-                    nnz++;
-                }
-            }
+            process_pair(i, i_neigbhors, i_neighbor_size, j);
+        }
+
+        if (top_k) {
+            nnz = heap.flush(i,
+                             first_vertices,
+                             second_vertices,
+                             coeffs,
+                             number_elements_in_block,
+                             similarity,
+                             g_degrees,
+                             nnz);
         }
     }
-    vertex_similarity_result res(homogen_table::wrap(first_vertices, 2, number_elements_in_block),
-                                 homogen_table::wrap(jaccard, 1, number_elements_in_block),
-                                 nnz);
+    vertex_similarity_result res(
+        homogen_table::wrap(first_vertices, 2, number_elements_in_block),
+        homogen_table::wrap(coeffs, coeff_count, number_elements_in_block),
+        nnz);
     return res;
 }
 } // namespace detail
@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/algo/jaccard/common.hpp"
+#include "oneapi/dal/algo/jaccard/vertex_similarity_types.hpp"
+#include "oneapi/dal/backend/dispatcher_dpc.hpp"
+
+namespace oneapi::dal::preview {
+namespace jaccard {
+namespace detail {
+
+/// Computes the Jaccard coefficients of the block of the graph on the GPU. The
+/// CSR arrays of the graph are copied to the USM device memory, the coefficients
+/// of the pairs are computed by a work-group per row vertex, and the nonzero
+/// coefficients are compacted on the device and copied to the result buffer of
+/// the caching builder.
+template <typename Graph>
+vertex_similarity_result call_jaccard_default_kernel_gpu(const dal::backend::context_gpu &ctx,
+                                                         const descriptor_base &desc,
+                                                         vertex_similarity_input<Graph> &input);
+
+} // namespace detail
+} // namespace jaccard
+} // namespace oneapi::dal::preview
@@ -0,0 +1,285 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <vector>
+
+#include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_default_kernel.hpp"
+#include "oneapi/dal/algo/jaccard/backend/gpu/vertex_similarity_default_kernel.hpp"
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_array_graph_impl.hpp"
+#include "src/sycl/partition.h"
+
+namespace oneapi::dal::preview {
+namespace jaccard {
+namespace detail {
+
+namespace interop = dal::backend::interop;
+namespace daal_sycl = daal::services::internal::sycl;
+
+// The number of work-items processing the columns of one row vertex
+constexpr std::int64_t gpu_row_work_group_size = 64;
+
+// The maximal number of vertex pairs of the graph block processed at once, which
+// bounds the size of the device buffers of the coefficients and the flags
+constexpr std::int64_t gpu_max_pairs_per_pass = std::int64_t(1) << 26;
+
+template <typename T>
+using daal_buffer_t = daal::services::internal::Buffer<T>;
+
+/// Counts the common elements of the sorted lists. The elements of the short
+/// list are searched in the long list if the binary search is cheaper than
+/// the merge of the lists.
+inline std::int32_t intersection_gpu(const std::int32_t *neigh_u,
+                                     const std::int32_t *neigh_v,
+                                     std::int32_t n_u,
+                                     std::int32_t n_v) {
+    if (n_u > n_v) {
+        std::swap(neigh_u, neigh_v);
+        std::swap(n_u, n_v);
+    }
+    if (n_u == 0 || neigh_u[0] > neigh_v[n_v - 1] || neigh_v[0] > neigh_u[n_u - 1]) {
+        return 0;
+    }
+    std::int32_t log_v = 1;
+    while ((std::int32_t(1) << log_v) < n_v) {
+        log_v++;
+    }
+    std::int32_t total = 0;
+    if (std::int64_t(n_u) * log_v < std::int64_t(n_u) + n_v) {
+        std::int32_t low = 0;
+        for (std::int32_t i = 0; i < n_u; ++i) {
+            const std::int32_t value = neigh_u[i];
+            std::int32_t high = n_v;
+            while (low < high) {
+                const std::int32_t middle = (low + high) / 2;
+                if (neigh_v[middle] < value) {
+                    low = middle + 1;
+                }
+                else {
+                    high = middle;
+                }
+            }
+            if (low == n_v) {
+                break;
+            }
+            total += (neigh_v[low] == value);
+        }
+        return total;
+    }
+    std::int32_t i_u = 0, i_v = 0;
+    while (i_u < n_u && i_v < n_v) {
+        const std::int32_t a = neigh_u[i_u];
+        const std::int32_t b = neigh_v[i_v];
+        total += (a == b);
+        i_u += (a <= b);
+        i_v += (a >= b);
+    }
+    return total;
+}
+
+template <typename T>
+array<T> copy_to_device(sycl::queue &queue, const T *data, std::int64_t count) {
+    auto device_array =
+        array<T>::empty(queue, std::max<std::int64_t>(count, 1), sycl::usm::alloc::device);
+    if (count > 0) {
+        queue.memcpy(device_array.get_mutable_data(), data, sizeof(T) * count).wait_and_throw();
+    }
+    return device_array;
+}
+
+template <>
+vertex_similarity_result call_jaccard_default_kernel_gpu<undirected_adjacency_array_graph<>>(
+    const dal::backend::context_gpu &ctx,
+    const descriptor_base &desc,
+    vertex_similarity_input<undirected_adjacency_array_graph<>> &input) {
+    auto &queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const auto &g = oneapi::dal::preview::detail::get_impl(input.get_graph());
+    const std::int64_t vertex_count = g->_vertex_count;
+    const std::int64_t neighbor_count = g->_edge_offsets[vertex_count];
+
+    // the compressed adjacency lists are decoded on the host
+    std::vector<std::int32_t> decoded;
+    const std::int32_t *host_neighbors = g->_vertex_neighbors.data();
+    if (!g->_compressed_neighbors.empty()) {
+        decoded.resize(neighbor_count);
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            g->_compressed_neighbors.decode_list(g->_compressed_neighbors.get_list(u),
+                                                 g->_degrees[u],
+                                                 decoded.data() + g->_edge_offsets[u]);
+        }
+        host_neighbors = decoded.data();
+    }
+
+    const auto offsets_array = copy_to_device(queue, g->_edge_offsets.data(), vertex_count + 1);
+    const auto degrees_array = copy_to_device(queue, g->_degrees.data(), vertex_count);
+    const auto neighbors_array = copy_to_device(queue, host_neighbors, neighbor_count);
+    const std::int32_t *offsets = offsets_array.get_data();
+    const std::int32_t *degrees = degrees_array.get_data();
+    const std::int32_t *neighbors = neighbors_array.get_data();
+
+    const auto row_begin = static_cast<std::int32_t>(desc.get_row_range_begin());
+    const auto row_end = static_cast<std::int32_t>(desc.get_row_range_end());
+    const auto column_begin = static_cast<std::int32_t>(desc.get_column_range_begin());
+    const auto column_end = static_cast<std::int32_t>(desc.get_column_range_end());
+    const bool upper_triangle = desc.get_upper_triangle();
+    const auto number_elements_in_block =
+        compute_max_pairs_count(row_begin, row_end, column_begin, column_end);
+    const size_t max_block_size =
+        compute_max_block_size(row_begin, row_end, column_begin, column_end);
+    void *result_ptr = input.get_caching_builder()(max_block_size);
+    int *first_vertices = reinterpret_cast<int *>(result_ptr);
+    int *second_vertices = first_vertices + number_elements_in_block;
+    float *jaccard = reinterpret_cast<float *>(first_vertices + 2 * number_elements_in_block);
+    std::int64_t nnz = 0;
+
+    const std::int64_t column_count = column_end - column_begin;
+    const std::int64_t rows_per_pass =
+        std::max<std::int64_t>(1, gpu_max_pairs_per_pass / std::max<std::int64_t>(column_count, 1));
+    const std::int64_t max_pass_pairs =
+        std::min<std::int64_t>(rows_per_pass, row_end - row_begin) * column_count;
+    if (max_pass_pairs <= 0) {
+        return vertex_similarity_result(
+            homogen_table::wrap(first_vertices, 2, number_elements_in_block),
+            homogen_table::wrap(jaccard, 1, number_elements_in_block),
+            nnz);
+    }
+
+    auto coeffs_array = array<float>::empty(queue, max_pass_pairs, sycl::usm::alloc::device);
+    auto flags_array = array<std::int32_t>::empty(queue, max_pass_pairs, sycl::usm::alloc::device);
+    auto indices_array =
+        array<std::int32_t>::empty(queue, max_pass_pairs, sycl::usm::alloc::device);
+    auto selected_array =
+        array<std::int32_t>::empty(queue, max_pass_pairs, sycl::usm::alloc::device);
+    auto pass_first_array =
+        array<std::int32_t>::empty(queue, max_pass_pairs, sycl::usm::alloc::device);
+    auto pass_second_array =
+        array<std::int32_t>::empty(queue, max_pass_pairs, sycl::usm::alloc::device);
+    auto pass_coeffs_array = array<float>::empty(queue, max_pass_pairs, sycl::usm::alloc::device);
+    float *coeffs = coeffs_array.get_mutable_data();
+    std::int32_t *flags = flags_array.get_mutable_data();
+    std::int32_t *indices = indices_array.get_mutable_data();
+    std::int32_t *selected = selected_array.get_mutable_data();
+    std::int32_t *pass_first = pass_first_array.get_mutable_data();
+    std::int32_t *pass_second = pass_second_array.get_mutable_data();
+    float *pass_coeffs = pass_coeffs_array.get_mutable_data();
+
+    queue
+        .submit([&](sycl::handler &cgh) {
+            cgh.parallel_for<class jaccard_gpu_fill_indices>(sycl::range<1>(max_pass_pairs),
+                                                             [=](sycl::id<1> idx) {
+                                                                 indices[idx[0]] =
+                                                                     std::int32_t(idx[0]);
+                                                             });
+        })
+        .wait_and_throw();
+
+    for (std::int64_t pass_begin = row_begin; pass_begin < row_end; pass_begin += rows_per_pass) {
+        const std::int32_t pass_row_begin = static_cast<std::int32_t>(pass_begin);
+        const std::int64_t pass_row_count =
+            std::min<std::int64_t>(rows_per_pass, row_end - pass_begin);
+        const std::int64_t pass_pairs = pass_row_count * column_count;
+
+        // a work-group per row vertex, the work-items of the group stride over the columns
+        const auto range =
+            sycl::nd_range<1>(sycl::range<1>(pass_row_count * gpu_row_work_group_size),
+                              sycl::range<1>(gpu_row_work_group_size));
+        queue
+            .submit([&](sycl::handler &cgh) {
+                cgh.parallel_for<class jaccard_gpu_block>(range, [=](sycl::nd_item<1> item) {
+                    const std::int32_t row = static_cast<std::int32_t>(item.get_group(0));
+                    const std::int32_t i = pass_row_begin + row;
+                    const std::int32_t n_i = degrees[i];
+                    const std::int32_t *neigh_i = neighbors + offsets[i];
+                    const std::int32_t diagonal = i < column_end ? i : column_end;
+                    const std::int32_t lower_triangle_end =
+                        upper_triangle ? column_begin : diagonal;
+                    for (std::int64_t c = item.get_local_id(0); c < column_count;
+                         c += gpu_row_work_group_size) {
+                        const std::int32_t j = column_begin + static_cast<std::int32_t>(c);
+                        float coeff = 0.0f;
+                        if (j == diagonal) {
+                            coeff = 1.0f;
+                        }
+                        else if (j < lower_triangle_end || j > diagonal) {
+                            const std::int32_t n_j = degrees[j];
+                            const std::int32_t intersection_value =
+                                intersection_gpu(neigh_i, neighbors + offsets[j], n_i, n_j);
+                            if (intersection_value) {
+                                coeff = float(intersection_value) /
+                                        float(n_i + n_j - intersection_value);
+                            }
+                        }
+                        const std::int64_t position = row * column_count + c;
+                        coeffs[position] = coeff;
+                        flags[position] = coeff != 0.0f;
+                    }
+                });
+            })
+            .wait_and_throw();
+
+        // the positions of the nonzero coefficients keep the row-major order of the CPU kernels
+        std::size_t selected_count = 0;
+        interop::status_to_exception(daal_sycl::Partition::flaggedIndex(
+            daal_buffer_t<std::int32_t>(flags, pass_pairs, sycl::usm::alloc::device),
+            daal_buffer_t<std::int32_t>(indices, pass_pairs, sycl::usm::alloc::device),
+            daal_buffer_t<std::int32_t>(selected, pass_pairs, sycl::usm::alloc::device),
+            pass_pairs,
+            selected_count));
+        if (selected_count == 0) {
+            continue;
+        }
+
+        queue
+            .submit([&](sycl::handler &cgh) {
+                cgh.parallel_for<class jaccard_gpu_gather>(
+                    sycl::range<1>(selected_count),
+                    [=](sycl::id<1> idx) {
+                        const std::int32_t position = selected[idx[0]];
+                        pass_first[idx[0]] =
+                            pass_row_begin + static_cast<std::int32_t>(position / column_count);
+                        pass_second[idx[0]] =
+                            column_begin + static_cast<std::int32_t>(position % column_count);
+                        pass_coeffs[idx[0]] = coeffs[position];
+                    });
+            })
+            .wait_and_throw();
+
+        auto first_event =
+            queue.memcpy(first_vertices + nnz, pass_first, sizeof(std::int32_t) * selected_count);
+        auto second_event =
+            queue.memcpy(second_vertices + nnz, pass_second, sizeof(std::int32_t) * selected_count);
+        auto coeffs_event =
+            queue.memcpy(jaccard + nnz, pass_coeffs, sizeof(float) * selected_count);
+        sycl::event::wait_and_throw({ first_event, second_event, coeffs_event });
+        nnz += selected_count;
+    }
+
+    vertex_similarity_result res(homogen_table::wrap(first_vertices, 2, number_elements_in_block),
+                                 homogen_table::wrap(jaccard, 1, number_elements_in_block),
+                                 nnz);
+    return res;
+}
+
+} // namespace detail
+} // namespace jaccard
+} // namespace oneapi::dal::preview
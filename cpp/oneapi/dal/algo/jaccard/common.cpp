@@ -25,6 +25,9 @@ public:
     std::int64_t row_range_end = 0;
     std::int64_t column_range_begin = 0;
     std::int64_t column_range_end = 0;
+    std::int64_t top_k = 0;
+    bool upper_triangle = false;
+    similarity_kind similarity = similarity_kind::jaccard;
 };
 
 using detail::descriptor_impl;
@@ -47,6 +50,18 @@ std::int64_t descriptor_base::get_column_range_end() const {
     return impl_->column_range_end;
 }
 
+std::int64_t descriptor_base::get_top_k() const {
+    return impl_->top_k;
+}
+
+bool descriptor_base::get_upper_triangle() const {
+    return impl_->upper_triangle;
+}
+
+similarity_kind descriptor_base::get_similarity() const {
+    return impl_->similarity;
+}
+
 void descriptor_base::set_row_range_impl(std::int64_t begin, std::int64_t end) {
     impl_->row_range_begin = begin;
     impl_->row_range_end = end;
@@ -65,6 +80,18 @@ void descriptor_base::set_block_impl(const std::initializer_list<std::int64_t>&
     impl_->column_range_end = *(column_range.begin() + 1);
 }
 
+void descriptor_base::set_top_k_impl(std::int64_t top_k) {
+    impl_->top_k = top_k;
+}
+
+void descriptor_base::set_upper_triangle_impl(bool upper_triangle) {
+    impl_->upper_triangle = upper_triangle;
+}
+
+void descriptor_base::set_similarity_impl(similarity_kind kinds) {
+    impl_->similarity = kinds;
+}
+
 void* caching_builder::operator()(std::size_t block_max_size) {
     if (size < block_max_size) {
         size = block_max_size;
@@ -18,6 +18,7 @@
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
 #include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/util/common.hpp"
 
 namespace oneapi::dal::preview {
 namespace jaccard {
@@ -31,6 +32,17 @@ struct fast {};
 using by_default = fast;
 } // namespace method
 
+/// The kinds of the similarity coefficients of the vertex pair (u, v) computed
+/// from the common neighbors of the vertices. Several kinds can be combined to
+/// compute them from one intersection of the neighbors per pair.
+enum class similarity_kind : std::uint64_t {
+    jaccard = 0x00000001ULL, /*!< |N(u) & N(v)| / |N(u) | N(v)| */
+    overlap = 0x00000002ULL, /*!< |N(u) & N(v)| / min(d(u), d(v)) */
+    cosine = 0x00000004ULL, /*!< |N(u) & N(v)| / sqrt(d(u) * d(v)), the Salton index */
+    adamic_adar = 0x00000008ULL, /*!< Sum of 1 / log(d(w)) over the common neighbors w */
+    common_neighbors = 0x00000010ULL /*!< |N(u) & N(v)| */
+};
+
 /// The base class for the Jaccard similarity algorithm descriptor
 class ONEAPI_DAL_EXPORT descriptor_base : public base {
 public:
@@ -53,11 +65,24 @@ public:
     /// Returns the end of the column of the graph block
     auto get_column_range_end() const -> std::int64_t;
 
+    /// Returns the number of the most similar vertices kept for each row of the
+    /// graph block, 0 means that all non-zero coefficients are returned
+    auto get_top_k() const -> std::int64_t;
+
+    /// Returns whether only the vertex pairs (i, j) with i <= j are computed
+    auto get_upper_triangle() const -> bool;
+
+    /// Returns the kinds of the computed similarity coefficients
+    auto get_similarity() const -> similarity_kind;
+
 protected:
     void set_row_range_impl(std::int64_t begin, std::int64_t end);
     void set_column_range_impl(std::int64_t begin, std::int64_t end);
     void set_block_impl(const std::initializer_list<std::int64_t>& row_range,
                         const std::initializer_list<std::int64_t>& column_range);
+    void set_top_k_impl(std::int64_t top_k);
+    void set_upper_triangle_impl(bool upper_triangle);
+    void set_similarity_impl(similarity_kind kinds);
 
     oneapi::dal::detail::pimpl<detail::descriptor_impl> impl_;
 };
@@ -99,6 +124,43 @@ public:
         this->set_block_impl(row_range, column_range);
         return *this;
     }
+
+    /// Sets the number of the most similar vertices kept for each row of the
+    /// graph block. Only the top_k vertex pairs with the largest Jaccard
+    /// coefficients are returned for each row, ordered by descending
+    /// coefficients. The pair of the vertex with itself is not included. The
+    /// value 0 means that all non-zero coefficients are returned.
+    ///
+    /// @param [in] top_k  The number of the most similar vertices for each row
+    auto& set_top_k(std::int64_t top_k) {
+        this->set_top_k_impl(top_k);
+        return *this;
+    }
+
+    /// Sets whether only the vertex pairs (i, j) with i <= j of the graph block
+    /// are computed. As the Jaccard similarity of the undirected graph is
+    /// symmetric, this allows to skip the pairs from the lower triangle of the
+    /// blocks intersecting the diagonal.
+    ///
+    /// @param [in] upper_triangle  The flag of the upper triangle computation
+    auto& set_upper_triangle(bool upper_triangle) {
+        this->set_upper_triangle_impl(upper_triangle);
+        return *this;
+    }
+
+    /// Sets the kinds of the computed similarity coefficients, Jaccard by
+    /// default. The coefficients of all selected kinds are computed from one
+    /// intersection of the neighbors of each vertex pair. The result has a row
+    /// of the coefficients table per selected kind in the order of the flags of
+    /// similarity_kind, the pairs with no common neighbors are skipped. In the
+    /// top_k mode the pairs are ranked by the coefficients of the first
+    /// selected kind.
+    ///
+    /// @param [in] kinds  The combination of the similarity kinds
+    auto& set_similarity(similarity_kind kinds) {
+        this->set_similarity_impl(kinds);
+        return *this;
+    }
 };
 
 /// Structure for the caching builder
@@ -112,5 +174,23 @@ struct ONEAPI_DAL_EXPORT caching_builder {
     std::shared_ptr<byte_t> result_ptr;
     std::size_t size = 0;
 };
+
+inline similarity_kind operator|(similarity_kind value_left, similarity_kind value_right) {
+    return bitwise_or(value_left, value_right);
+}
+
+inline similarity_kind& operator|=(similarity_kind& value_left, similarity_kind value_right) {
+    value_left = value_left | value_right;
+    return value_left;
+}
+
+inline similarity_kind operator&(similarity_kind value_left, similarity_kind value_right) {
+    return bitwise_and(value_left, value_right);
+}
+
+inline similarity_kind& operator&=(similarity_kind& value_left, similarity_kind value_right) {
+    value_left = value_left & value_right;
+    return value_left;
+}
 } // namespace jaccard
 } // namespace oneapi::dal::preview
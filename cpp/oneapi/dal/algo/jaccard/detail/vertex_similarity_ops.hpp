@@ -58,6 +58,13 @@ struct vertex_similarity_ops {
         if (row_end > vertex_count || column_end > vertex_count) {
             throw oneapi::dal::out_of_range("interval > vertex_count");
         }
+        if (param.get_top_k() < 0) {
+            throw oneapi::dal::invalid_argument("Negative top_k");
+        }
+        const auto kinds = static_cast<std::uint64_t>(param.get_similarity());
+        if (kinds == 0 || (kinds >> 5) != 0) {
+            throw oneapi::dal::invalid_argument("Invalid similarity kind");
+        }
     }
 
     template <typename Policy>
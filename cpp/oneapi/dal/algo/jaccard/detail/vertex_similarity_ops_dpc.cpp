@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/jaccard/backend/cpu/select_kernel.hpp"
+#include "oneapi/dal/algo/jaccard/backend/gpu/vertex_similarity_default_kernel.hpp"
+#include "oneapi/dal/algo/jaccard/detail/vertex_similarity_ops.hpp"
+#include "oneapi/dal/backend/dispatcher_dpc.hpp"
+
+namespace oneapi::dal::preview {
+namespace jaccard {
+namespace detail {
+using oneapi::dal::detail::data_parallel_policy;
+
+template <typename Float, class Method, typename Graph>
+struct ONEAPI_DAL_EXPORT
+    vertex_similarity_ops_dispatcher<data_parallel_policy, Float, Method, Graph> {
+    vertex_similarity_result operator()(const data_parallel_policy &policy,
+                                        const descriptor_base &desc,
+                                        vertex_similarity_input<Graph> &input) const {
+        // top-k selection and the similarity kinds other than Jaccard are
+        // computed by the CPU kernels only
+        const auto device = policy.get_queue().get_device();
+        if (device.is_gpu() && desc.get_top_k() == 0 &&
+            desc.get_similarity() == similarity_kind::jaccard) {
+            const auto gpu_ctx = oneapi::dal::backend::context_gpu{ policy };
+            return call_jaccard_default_kernel_gpu(gpu_ctx, desc, input);
+        }
+        static auto impl = get_backend<Float, Method>(desc, input);
+        return (*impl)(oneapi::dal::backend::context_cpu{ oneapi::dal::detail::host_policy{} },
+                       desc,
+                       input);
+    }
+};
+
+#define INSTANTIATE(F, M, G)          \
+    template struct ONEAPI_DAL_EXPORT \
+        vertex_similarity_ops_dispatcher<data_parallel_policy, F, M, G>;
+
+INSTANTIATE(float,
+            oneapi::dal::preview::jaccard::method::by_default,
+            undirected_adjacency_array_graph<>)
+
+} // namespace detail
+} // namespace jaccard
+} // namespace oneapi::dal::preview
@@ -0,0 +1,202 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/// @file
+/// Contains the definition of the all pairs processing for Jaccard Similarity
+/// algorithm
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "oneapi/dal/algo/jaccard/vertex_similarity.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_array_graph_impl.hpp"
+
+namespace oneapi::dal::preview {
+namespace jaccard {
+namespace detail {
+
+/// The maximal number of the vertex pairs in one tile. It bounds the size of the
+/// result buffer allocated for the tile.
+constexpr std::int64_t tile_max_pair_count = 1 << 20;
+
+/// The number of tiles per thread used to balance the load
+constexpr std::int64_t tiles_per_thread = 16;
+
+struct tile_range {
+    std::int32_t begin;
+    std::int32_t end;
+};
+
+/// Estimates the cost of the vertex pair (i, j) as the number of the compared
+/// neighbors d(i) + d(j) plus the constant overhead of the pair
+template <typename Graph>
+class tile_cost_model {
+public:
+    explicit tile_cost_model(const Graph &graph) {
+        const auto &layout = oneapi::dal::preview::detail::get_impl(graph);
+        vertex_count_ = static_cast<std::int32_t>(layout->_vertex_count);
+        degrees_ = layout->_degrees.data();
+        degree_prefix_sums_.resize(vertex_count_ + 1, 0);
+        for (std::int32_t i = 0; i < vertex_count_; ++i) {
+            degree_prefix_sums_[i + 1] = degree_prefix_sums_[i] + degrees_[i];
+        }
+    }
+
+    std::int32_t get_vertex_count() const {
+        return vertex_count_;
+    }
+
+    /// The cost of the pairs (i, j) with i <= j of the row i
+    std::int64_t get_row_cost(std::int32_t i) const {
+        return get_cost({ i, i + 1 }, { i, vertex_count_ });
+    }
+
+    /// The cost of the pairs of the rows and columns tile
+    std::int64_t get_cost(const tile_range &rows, const tile_range &columns) const {
+        const std::int64_t row_count = rows.end - rows.begin;
+        const std::int64_t column_count = columns.end - columns.begin;
+        const std::int64_t row_degrees = get_degree_sum(rows);
+        const std::int64_t column_degrees = get_degree_sum(columns);
+        return column_count * (row_count + row_degrees) + row_count * column_degrees;
+    }
+
+    std::int64_t get_degree_sum(const tile_range &vertices) const {
+        return degree_prefix_sums_[vertices.end] - degree_prefix_sums_[vertices.begin];
+    }
+
+private:
+    std::int32_t vertex_count_;
+    const std::int32_t *degrees_;
+    std::vector<std::int64_t> degree_prefix_sums_;
+};
+
+/// Splits the rows of the upper triangle of the similarity matrix into the
+/// ranges with the cost close to the target
+template <typename Graph>
+std::vector<tile_range> split_rows(const tile_cost_model<Graph> &model,
+                                   std::int64_t target_cost) {
+    std::vector<tile_range> row_tiles;
+    const std::int32_t vertex_count = model.get_vertex_count();
+    std::int32_t begin = 0;
+    std::int64_t cost = 0;
+    for (std::int32_t i = 0; i < vertex_count; ++i) {
+        cost += model.get_row_cost(i);
+        if (cost >= target_cost || i + 1 == vertex_count) {
+            row_tiles.push_back({ begin, i + 1 });
+            begin = i + 1;
+            cost = 0;
+        }
+    }
+    return row_tiles;
+}
+
+/// Splits the columns [rows.begin, vertex_count) of the row range into the
+/// ranges with the cost close to the target and at most tile_max_pair_count pairs
+template <typename Graph>
+std::vector<tile_range> split_columns(const tile_cost_model<Graph> &model,
+                                      const tile_range &rows,
+                                      std::int64_t target_cost) {
+    std::vector<tile_range> column_tiles;
+    const std::int32_t vertex_count = model.get_vertex_count();
+    const std::int64_t row_count = rows.end - rows.begin;
+    const std::int64_t max_column_count = std::max<std::int64_t>(1, tile_max_pair_count / row_count);
+
+    std::int32_t begin = rows.begin;
+    while (begin < vertex_count) {
+        // the largest end which fits the target cost, the cost grows with the end
+        std::int32_t low = begin + 1;
+        std::int32_t high =
+            static_cast<std::int32_t>(std::min<std::int64_t>(vertex_count, begin + max_column_count));
+        while (low < high) {
+            const std::int32_t middle = low + (high - low + 1) / 2;
+            if (model.get_cost(rows, { begin, middle }) <= target_cost) {
+                low = middle;
+            }
+            else {
+                high = middle - 1;
+            }
+        }
+        column_tiles.push_back({ begin, low });
+        begin = low;
+    }
+    return column_tiles;
+}
+
+} // namespace detail
+
+/// Computes the Jaccard similarity coefficients of all vertex pairs (i, j) with
+/// i <= j of the graph without the manual splitting into blocks. The pairs are
+/// split into tiles with close estimated cost, the tiles are processed in
+/// parallel by the threading layer and the result of each tile is passed to the
+/// callback as soon as it is computed.
+///
+/// @tparam Descriptor Type of the algorithm descriptor
+/// @tparam Graph      Type of the input graph
+/// @tparam Callback   Type of the function called with the result of the tile
+///
+/// @param [in] desc      The descriptor of the algorithm. The row and column
+///                       ranges are ignored, the top_k mode is not supported.
+/// @param [in] graph     The input graph
+/// @param [in] callback  The function invoked as callback(result) for every tile.
+///                       It is called concurrently from several threads. The result
+///                       tables are valid only during the call.
+template <typename Descriptor, typename Graph, typename Callback>
+void vertex_similarity_all_pairs(const Descriptor &desc,
+                                 const Graph &graph,
+                                 const Callback &callback) {
+    using load_graph::detail::threader_for;
+    using load_graph::detail::threader_get_max_threads;
+
+    if (desc.get_top_k() != 0) {
+        throw invalid_argument("top_k is not supported for all pairs processing");
+    }
+
+    const detail::tile_cost_model<Graph> model(graph);
+    if (model.get_vertex_count() == 0) {
+        return;
+    }
+
+    std::int64_t total_cost = 0;
+    for (std::int32_t i = 0; i < model.get_vertex_count(); ++i) {
+        total_cost += model.get_row_cost(i);
+    }
+    const std::int64_t tile_count = detail::tiles_per_thread * threader_get_max_threads();
+    const std::int64_t target_cost = std::max<std::int64_t>(1, total_cost / tile_count);
+
+    const auto row_tiles = detail::split_rows(model, target_cost);
+    threader_for(row_tiles.size(), row_tiles.size(), [&](int r) {
+        const auto rows = row_tiles[r];
+        const auto column_tiles = detail::split_columns(model, rows, target_cost);
+        threader_for(column_tiles.size(), column_tiles.size(), [&](int c) {
+            const auto columns = column_tiles[c];
+            Descriptor tile_desc;
+            tile_desc.set_block({ rows.begin, rows.end }, { columns.begin, columns.end })
+                .set_upper_triangle(true)
+                .set_similarity(desc.get_similarity());
+
+            caching_builder builder;
+            const auto result = vertex_similarity(tile_desc, graph, builder);
+            callback(result);
+        });
+    });
+}
+
+} // namespace jaccard
+} // namespace oneapi::dal::preview
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the definition of the streaming processing for Jaccard Similarity
+/// algorithm
+
+#pragma once
+
+#include <algorithm>
+
+#include "oneapi/dal/algo/jaccard/vertex_similarity.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::preview {
+namespace jaccard {
+namespace detail {
+
+/// The maximal number of the vertex pairs in one batch passed to the sink. It
+/// bounds the size of the result buffer of each thread.
+constexpr std::int64_t stream_batch_pair_count = 1 << 18;
+
+} // namespace detail
+
+/// The vertex pairs with nonzero Jaccard coefficients computed for the rows
+/// [row_begin, row_end) of the graph block. The arrays are ordered as the
+/// result of vertex_similarity for the same rows. The coefficient of the k-th
+/// selected similarity kind of the pair p is coeffs[k * coeff_stride + p].
+struct vertex_similarity_batch {
+    std::int64_t row_begin;
+    std::int64_t row_end;
+    std::int64_t count;
+    const std::int32_t *first_vertices;
+    const std::int32_t *second_vertices;
+    const float *coeffs;
+    std::int64_t coeff_stride;
+};
+
+/// Computes the Jaccard similarity coefficients of the graph block and passes
+/// them to the sink in batches of consecutive rows instead of the preallocated
+/// result. The batches are computed in parallel by the threading layer, so
+/// that the peak memory is bounded by the number of threads times the batch
+/// size regardless of the size of the block.
+///
+/// @tparam Descriptor Type of the algorithm descriptor
+/// @tparam Graph      Type of the input graph
+/// @tparam Sink       Type of the function called with the computed batches
+///
+/// @param [in] desc   The descriptor of the algorithm
+/// @param [in] graph  The input graph
+/// @param [in] sink   The function invoked as sink(batch) for every batch. It
+///                    is called concurrently from several threads, and the
+///                    batches of different rows come in arbitrary order. The
+///                    arrays of the batch are valid only during the call.
+template <typename Descriptor, typename Graph, typename Sink>
+void vertex_similarity_stream(const Descriptor &desc, const Graph &graph, const Sink &sink) {
+    using load_graph::detail::threader_for;
+
+    const std::int64_t row_begin = desc.get_row_range_begin();
+    const std::int64_t row_end = desc.get_row_range_end();
+    const std::int64_t column_begin = desc.get_column_range_begin();
+    const std::int64_t column_end = desc.get_column_range_end();
+    const std::int64_t top_k = desc.get_top_k();
+    if (row_begin > row_end) {
+        throw invalid_argument("row_begin > row_end");
+    }
+    if (column_begin > column_end) {
+        throw invalid_argument("column_begin > column_end");
+    }
+
+    const std::int64_t row_pair_count =
+        (top_k > 0) ? std::min(top_k, column_end - column_begin) : column_end - column_begin;
+    const std::int64_t rows_per_batch =
+        std::max<std::int64_t>(1,
+                               detail::stream_batch_pair_count /
+                                   std::max<std::int64_t>(1, row_pair_count));
+    const std::int64_t batch_count = (row_end - row_begin + rows_per_batch - 1) / rows_per_batch;
+
+    threader_for(batch_count, batch_count, [&](int b) {
+        const std::int64_t batch_row_begin = row_begin + b * rows_per_batch;
+        const std::int64_t batch_row_end = std::min(row_end, batch_row_begin + rows_per_batch);
+
+        // the descriptors share the implementation on copy, so the batch gets its own one
+        Descriptor batch_desc;
+        batch_desc.set_block({ batch_row_begin, batch_row_end }, { column_begin, column_end })
+            .set_top_k(top_k)
+            .set_upper_triangle(desc.get_upper_triangle())
+            .set_similarity(desc.get_similarity());
+
+        caching_builder builder;
+        const auto result = vertex_similarity(batch_desc, graph, builder);
+
+        // the result tables wrap the buffer of the builder: the first vertices,
+        // the second vertices and the coefficients of the block pairs
+        const std::int64_t block_pair_count = result.get_coeffs().get_column_count();
+        const auto first_vertices =
+            reinterpret_cast<const std::int32_t *>(builder.result_ptr.get());
+        vertex_similarity_batch batch;
+        batch.row_begin = batch_row_begin;
+        batch.row_end = batch_row_end;
+        batch.count = result.get_nonzero_coeff_count();
+        batch.first_vertices = first_vertices;
+        batch.second_vertices = first_vertices + block_pair_count;
+        batch.coeffs = reinterpret_cast<const float *>(first_vertices + 2 * block_pair_count);
+        batch.coeff_stride = block_pair_count;
+        sink(batch);
+    });
+}
+
+} // namespace jaccard
+} // namespace oneapi::dal::preview
@@ -71,7 +71,9 @@ public:
     ///                             vertex pairs which have non-zero Jaccard
     ///                             similarity coefficients
     /// @param [in]   coeffs        The table of size 1*nonzero_coeff_count with
-    ///                             non-zero Jaccard similarity coefficients
+    ///                             non-zero Jaccard similarity coefficients, or
+    ///                             with a row per similarity kind selected in
+    ///                             the descriptor
     ///
     /// @param [in] nonzero_coeff_count The number of non-zero Jaccard coefficients
     vertex_similarity_result(const table& vertex_pairs,
@@ -79,7 +81,9 @@ public:
                              std::int64_t nonzero_coeff_count);
 
     /// Returns the table of size 1*nonzero_coeff_count with non-zero Jaccard
-    /// similarity coefficients
+    /// similarity coefficients. If several similarity kinds are selected in the
+    /// descriptor, the table has a row of the coefficients per kind in the
+    /// order of the flags of similarity_kind.
     table get_coeffs() const;
 
     /// Returns the table of size 2*nonzero_coeff_count with vertex pairs which have
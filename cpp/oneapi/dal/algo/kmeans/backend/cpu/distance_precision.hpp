@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/include/algorithms/kmeans/kmeans_types.h>
+
+#include "oneapi/dal/algo/kmeans/common.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+/// The bfloat16 precision falls back to the single precision cross products if
+/// the policy does not enable the bfloat16 instructions
+inline daal::algorithms::kmeans::DistancePrecision convert_to_daal_distance_precision(
+    const dal::backend::context_cpu& ctx,
+    distance_precision precision) {
+    namespace daal_kmeans = daal::algorithms::kmeans;
+    switch (precision) {
+        case distance_precision::reduced: return daal_kmeans::reducedPrecision;
+        case distance_precision::bfloat16:
+            return dal::backend::is_bf16_enabled(ctx) ? daal_kmeans::bfloat16Precision
+                                                      : daal_kmeans::reducedPrecision;
+        default: return daal_kmeans::fullPrecision;
+    }
+}
+
+} // namespace oneapi::dal::kmeans::backend
@@ -17,6 +17,7 @@
 #include <daal/include/algorithms/kmeans/kmeans_types.h>
 #include <daal/src/algorithms/kmeans/kmeans_lloyd_kernel.h>
 
+#include "oneapi/dal/algo/kmeans/backend/cpu/distance_precision.hpp"
 #include "oneapi/dal/algo/kmeans/backend/cpu/infer_kernel.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
@@ -36,7 +37,14 @@ template <typename Float, daal::CpuType Cpu>
 using daal_kmeans_lloyd_dense_kernel_t =
     daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
 
-template <typename Float, typename Task>
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_lloyd_csr_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydCSR, Float, Cpu>;
+
+template <typename Float,
+          template <typename, daal::CpuType>
+          typename DaalKernel,
+          typename Task>
 static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const descriptor_base<Task>& desc,
                                            const model<Task>& trained_model,
@@ -49,17 +57,15 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
 
     daal_kmeans::Parameter par(cluster_count, max_iteration_count);
     par.resultsToEvaluate = daal_kmeans::computeAssignments;
+    par.distancePrecision = convert_to_daal_distance_precision(ctx, desc.get_distance_precision());
 
-    auto arr_data = row_accessor<const Float>{ data }.pull();
     auto arr_initial_centroids = row_accessor<const Float>{ trained_model.get_centroids() }.pull();
 
     array<int> arr_labels = array<int>::empty(row_count);
     array<Float> arr_objective_function_value = array<Float>::empty(1);
     array<int> arr_iteration_count = array<int>::empty(1);
 
-    const auto daal_data = interop::convert_to_daal_homogen_table(arr_data,
-                                                                  data.get_row_count(),
-                                                                  data.get_column_count());
+    const auto daal_data = interop::convert_to_daal_table_by_kind<Float>(data);
     const auto daal_initial_centroids =
         interop::convert_to_daal_homogen_table(arr_initial_centroids, cluster_count, column_count);
     const auto daal_labels = interop::convert_to_daal_homogen_table(arr_labels, row_count, 1);
@@ -77,21 +83,24 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                                        daal_iteration_count.get() };
 
     interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
-                                                                           input,
-                                                                           output,
-                                                                           &par));
+        interop::call_daal_kernel<Float, DaalKernel>(ctx, nullptr, input, output, &par));
 
     return infer_result<Task>()
         .set_labels(dal::detail::homogen_table_builder{}.reset(arr_labels, row_count, 1).build())
         .set_objective_function_value(static_cast<double>(arr_objective_function_value[0]));
 }
 
-template <typename Float, typename Task>
+template <typename Float,
+          template <typename, daal::CpuType>
+          typename DaalKernel,
+          typename Task>
 static infer_result<Task> infer(const context_cpu& ctx,
                                 const descriptor_base<Task>& desc,
                                 const infer_input<Task>& input) {
-    return call_daal_kernel<Float, Task>(ctx, desc, input.get_model(), input.get_data());
+    return call_daal_kernel<Float, DaalKernel, Task>(ctx,
+                                                     desc,
+                                                     input.get_model(),
+                                                     input.get_data());
 }
 
 template <typename Float>
@@ -99,11 +108,34 @@ struct infer_kernel_cpu<Float, method::by_default, task::clustering> {
     infer_result<task::clustering> operator()(const context_cpu& ctx,
                                               const descriptor_base<task::clustering>& desc,
                                               const infer_input<task::clustering>& input) const {
-        return infer<Float, task::clustering>(ctx, desc, input);
+        return infer<Float, daal_kmeans_lloyd_dense_kernel_t, task::clustering>(ctx, desc, input);
     }
 };
 
+template <typename Float>
+struct infer_kernel_cpu<Float, method::lloyd_csr, task::clustering> {
+    infer_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_base<task::clustering>& desc,
+                                              const infer_input<task::clustering>& input) const {
+        return infer<Float, daal_kmeans_lloyd_csr_kernel_t, task::clustering>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::hamerly_dense, task::clustering>
+        : public infer_kernel_cpu<Float, method::by_default, task::clustering> {};
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::mini_batch_dense, task::clustering>
+        : public infer_kernel_cpu<Float, method::by_default, task::clustering> {};
+
 template struct infer_kernel_cpu<float, method::by_default, task::clustering>;
 template struct infer_kernel_cpu<double, method::by_default, task::clustering>;
+template struct infer_kernel_cpu<float, method::hamerly_dense, task::clustering>;
+template struct infer_kernel_cpu<double, method::hamerly_dense, task::clustering>;
+template struct infer_kernel_cpu<float, method::mini_batch_dense, task::clustering>;
+template struct infer_kernel_cpu<double, method::mini_batch_dense, task::clustering>;
+template struct infer_kernel_cpu<float, method::lloyd_csr, task::clustering>;
+template struct infer_kernel_cpu<double, method::lloyd_csr, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/algo/kmeans/train_types.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/communicator.hpp"
 
 namespace oneapi::dal::kmeans::backend {
 
@@ -28,4 +29,14 @@ struct train_kernel_cpu {
                                   const train_input<Task>& input) const;
 };
 
+/// Trains the model on the rows of all processes of the SPMD run, every
+/// process gets the same centroids and the labels of its rows
+template <typename Float, typename Method, typename Task>
+struct spmd_train_kernel_cpu {
+    train_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                  const spmd::communicator& comm,
+                                  const descriptor_base<Task>& params,
+                                  const train_input<Task>& input) const;
+};
+
 } // namespace oneapi::dal::kmeans::backend
@@ -14,9 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+
 #include <daal/src/algorithms/kmeans/kmeans_init_kernel.h>
 #include <daal/src/algorithms/kmeans/kmeans_lloyd_kernel.h>
 
+#include "oneapi/dal/algo/kmeans/backend/cpu/distance_precision.hpp"
 #include "oneapi/dal/algo/kmeans/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
@@ -38,11 +41,60 @@ template <typename Float, daal::CpuType Cpu>
 using daal_kmeans_lloyd_dense_kernel_t =
     daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
 
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_hamerly_dense_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::hamerlyDense, Float, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_lloyd_csr_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydCSR, Float, Cpu>;
+
 template <typename Float, daal::CpuType Cpu>
 using daal_kmeans_init_plus_plus_dense_kernel_t =
     daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusDense, Float, Cpu>;
 
-template <typename Float, typename Task>
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_init_plus_plus_csr_kernel_t =
+    daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusCSR, Float, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_lloyd_dense_step1_kernel_t =
+    daal_kmeans::internal::KMeansDistributedStep1Kernel<daal_kmeans::lloydDense, Float, Cpu>;
+
+template <typename Float,
+          template <typename, daal::CpuType>
+          typename DaalInitKernel>
+static table compute_initial_centroids(const context_cpu& ctx,
+                                       const daal::data_management::NumericTablePtr& daal_data,
+                                       int64_t cluster_count) {
+    const int64_t column_count = daal_data->getNumberOfColumns();
+    daal_kmeans_init::Parameter par(cluster_count);
+
+    const size_t init_len_input = 1;
+    daal::data_management::NumericTable* init_input[init_len_input] = { daal_data.get() };
+
+    auto daal_centroids = interop::allocate_daal_homogen_table<Float>(cluster_count, column_count);
+    const size_t init_len_output = 1;
+    daal::data_management::NumericTable* init_output[init_len_output] = { daal_centroids.get() };
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, DaalInitKernel>(ctx,
+                                                         init_len_input,
+                                                         init_input,
+                                                         init_len_output,
+                                                         init_output,
+                                                         &par,
+                                                         *(par.engine)));
+
+    return interop::convert_from_daal_homogen_table<Float>(daal_centroids);
+}
+
+template <typename Float,
+          template <typename, daal::CpuType>
+          typename DaalKernel,
+          template <typename, daal::CpuType>
+          typename DaalInitKernel,
+          typename Task>
 static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const descriptor_base<Task>& desc,
                                            const table& data,
@@ -56,37 +108,14 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
 
     daal_kmeans::Parameter par(cluster_count, max_iteration_count);
     par.accuracyThreshold = accuracy_threshold;
+    par.distancePrecision = convert_to_daal_distance_precision(ctx, desc.get_distance_precision());
 
-    auto arr_data = row_accessor<const Float>{ data }.pull();
-    const auto daal_data = interop::convert_to_daal_homogen_table(arr_data,
-                                                                  data.get_row_count(),
-                                                                  data.get_column_count());
+    const auto daal_data = interop::convert_to_daal_table_by_kind<Float>(data);
 
     auto new_initial_centroids = initial_centroids;
     if (!new_initial_centroids.has_data()) {
-        daal_kmeans_init::Parameter par(cluster_count);
-
-        const size_t init_len_input = 1;
-        daal::data_management::NumericTable* init_input[init_len_input] = { daal_data.get() };
-
-        auto daal_centroids =
-            interop::allocate_daal_homogen_table<Float>(cluster_count, column_count);
-        const size_t init_len_output = 1;
-        daal::data_management::NumericTable* init_output[init_len_output] = {
-            daal_centroids.get()
-        };
-
-        interop::status_to_exception(
-            interop::call_daal_kernel<Float, daal_kmeans_init_plus_plus_dense_kernel_t>(
-                ctx,
-                init_len_input,
-                init_input,
-                init_len_output,
-                init_output,
-                &par,
-                *(par.engine)));
-
-        new_initial_centroids = interop::convert_from_daal_homogen_table<Float>(daal_centroids);
+        new_initial_centroids =
+            compute_initial_centroids<Float, DaalInitKernel>(ctx, daal_data, cluster_count);
     }
 
     auto arr_initial_centroids = row_accessor<const Float>{ new_initial_centroids }.pull();
@@ -117,10 +146,7 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                                        daal_iteration_count.get() };
 
     interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
-                                                                           input,
-                                                                           output,
-                                                                           &par));
+        interop::call_daal_kernel<Float, DaalKernel>(ctx, nullptr, input, output, &par));
 
     return train_result<Task>()
         .set_labels(dal::detail::homogen_table_builder{}.reset(arr_labels, row_count, 1).build())
@@ -132,14 +158,19 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                             .build()));
 }
 
-template <typename Float, typename Task>
+template <typename Float,
+          template <typename, daal::CpuType>
+          typename DaalKernel,
+          template <typename, daal::CpuType>
+          typename DaalInitKernel,
+          typename Task>
 static train_result<Task> train(const context_cpu& ctx,
                                 const descriptor_base<Task>& desc,
                                 const train_input<Task>& input) {
-    return call_daal_kernel<Float, Task>(ctx,
-                                         desc,
-                                         input.get_data(),
-                                         input.get_initial_centroids());
+    return call_daal_kernel<Float, DaalKernel, DaalInitKernel, Task>(ctx,
+                                                                     desc,
+                                                                     input.get_data(),
+                                                                     input.get_initial_centroids());
 }
 
 template <typename Float>
@@ -147,11 +178,179 @@ struct train_kernel_cpu<Float, method::lloyd_dense, task::clustering> {
     train_result<task::clustering> operator()(const context_cpu& ctx,
                                               const descriptor_base<task::clustering>& desc,
                                               const train_input<task::clustering>& input) const {
-        return train<Float, task::clustering>(ctx, desc, input);
+        return train<Float,
+                     daal_kmeans_lloyd_dense_kernel_t,
+                     daal_kmeans_init_plus_plus_dense_kernel_t,
+                     task::clustering>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::hamerly_dense, task::clustering> {
+    train_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_base<task::clustering>& desc,
+                                              const train_input<task::clustering>& input) const {
+        return train<Float,
+                     daal_kmeans_hamerly_dense_kernel_t,
+                     daal_kmeans_init_plus_plus_dense_kernel_t,
+                     task::clustering>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::lloyd_csr, task::clustering> {
+    train_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_base<task::clustering>& desc,
+                                              const train_input<task::clustering>& input) const {
+        return train<Float,
+                     daal_kmeans_lloyd_csr_kernel_t,
+                     daal_kmeans_init_plus_plus_csr_kernel_t,
+                     task::clustering>(ctx, desc, input);
+    }
+};
+
+/// Every iteration assigns the rows of the process to the nearest centroids,
+/// the sums and the counts of the rows in the clusters and the objective
+/// function are reduced over all processes, so every process computes the same
+/// centroids. The clusters without rows keep their centroids.
+template <typename Float>
+struct spmd_train_kernel_cpu<Float, method::lloyd_dense, task::clustering> {
+    train_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const spmd::communicator& comm,
+                                              const descriptor_base<task::clustering>& desc,
+                                              const train_input<task::clustering>& input) const {
+        const auto& data = input.get_data();
+        const int64_t row_count = data.get_row_count();
+        const int64_t column_count = data.get_column_count();
+
+        const int64_t cluster_count = desc.get_cluster_count();
+        const int64_t max_iteration_count = desc.get_max_iteration_count();
+        const double accuracy_threshold = desc.get_accuracy_threshold();
+        const int64_t centroid_count = cluster_count * column_count;
+
+        daal_kmeans::Parameter par(cluster_count, max_iteration_count);
+        par.resultsToEvaluate = daal_kmeans::computeCentroids;
+
+        const auto daal_data = interop::convert_to_daal_table_by_kind<Float>(data);
+
+        array<Float> arr_centroids = array<Float>::empty(centroid_count);
+        Float* centroids = arr_centroids.get_mutable_data();
+        table initial_centroids = input.get_initial_centroids();
+        if (!initial_centroids.has_data() && comm.is_root_rank()) {
+            initial_centroids =
+                compute_initial_centroids<Float, daal_kmeans_init_plus_plus_dense_kernel_t>(
+                    ctx,
+                    daal_data,
+                    cluster_count);
+        }
+        if (initial_centroids.has_data()) {
+            const auto arr_initial = row_accessor<const Float>{ initial_centroids }.pull();
+            for (int64_t i = 0; i < centroid_count; ++i) {
+                centroids[i] = arr_initial[i];
+            }
+        }
+        if (!input.get_initial_centroids().has_data()) {
+            comm.bcast(centroids, centroid_count);
+        }
+
+        array<int> arr_counts = array<int>::empty(cluster_count);
+        array<Float> arr_sums = array<Float>::empty(centroid_count);
+        array<Float> arr_objective_function_value = array<Float>::empty(1);
+        array<Float> arr_candidate_distances = array<Float>::empty(cluster_count);
+        array<Float> arr_candidate_centroids = array<Float>::empty(centroid_count);
+        array<int> arr_labels = array<int>::empty(row_count);
+
+        const auto daal_centroids =
+            interop::convert_to_daal_homogen_table(arr_centroids, cluster_count, column_count);
+        const auto daal_counts =
+            interop::convert_to_daal_homogen_table(arr_counts, cluster_count, 1);
+        const auto daal_sums =
+            interop::convert_to_daal_homogen_table(arr_sums, cluster_count, column_count);
+        const auto daal_objective_function_value =
+            interop::convert_to_daal_homogen_table(arr_objective_function_value, 1, 1);
+        const auto daal_candidate_distances =
+            interop::convert_to_daal_homogen_table(arr_candidate_distances, cluster_count, 1);
+        const auto daal_candidate_centroids =
+            interop::convert_to_daal_homogen_table(arr_candidate_centroids,
+                                                   cluster_count,
+                                                   column_count);
+        const auto daal_labels = interop::convert_to_daal_homogen_table(arr_labels, row_count, 1);
+
+        const size_t len_input = 2;
+        daal::data_management::NumericTable* input_tables[len_input] = { daal_data.get(),
+                                                                         daal_centroids.get() };
+        const size_t len_output = 6;
+        daal::data_management::NumericTable* output_tables[len_output] = {
+            daal_counts.get(),
+            daal_sums.get(),
+            daal_objective_function_value.get(),
+            daal_candidate_distances.get(),
+            daal_candidate_centroids.get(),
+            daal_labels.get()
+        };
+
+        const auto compute_partial_sums = [&]() {
+            interop::status_to_exception(
+                interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_step1_kernel_t>(
+                    ctx,
+                    len_input,
+                    input_tables,
+                    len_output,
+                    output_tables,
+                    &par));
+            comm.allreduce(arr_counts.get_mutable_data(), cluster_count);
+            comm.allreduce(arr_sums.get_mutable_data(), centroid_count);
+            comm.allreduce(arr_objective_function_value.get_mutable_data(), 1);
+        };
+
+        double old_objective_function_value = 0.0;
+        int64_t iteration_count = 0;
+        while (iteration_count < max_iteration_count) {
+            compute_partial_sums();
+            ++iteration_count;
+
+            for (int64_t i = 0; i < cluster_count; ++i) {
+                if (arr_counts[i] > 0) {
+                    const Float inv_count = Float(1) / Float(arr_counts[i]);
+                    for (int64_t j = 0; j < column_count; ++j) {
+                        centroids[i * column_count + j] =
+                            arr_sums[i * column_count + j] * inv_count;
+                    }
+                }
+            }
+
+            const double objective_function_value = arr_objective_function_value[0];
+            if (iteration_count > 1 &&
+                std::abs(old_objective_function_value - objective_function_value) <
+                    accuracy_threshold) {
+                break;
+            }
+            old_objective_function_value = objective_function_value;
+        }
+
+        // The labels and the objective function of the final centroids
+        par.resultsToEvaluate = daal_kmeans::computeCentroids | daal_kmeans::computeAssignments;
+        compute_partial_sums();
+
+        return train_result<task::clustering>()
+            .set_labels(
+                dal::detail::homogen_table_builder{}.reset(arr_labels, row_count, 1).build())
+            .set_iteration_count(iteration_count)
+            .set_objective_function_value(static_cast<double>(arr_objective_function_value[0]))
+            .set_model(model<task::clustering>().set_centroids(
+                dal::detail::homogen_table_builder{}
+                    .reset(arr_centroids, cluster_count, column_count)
+                    .build()));
     }
 };
 
 template struct train_kernel_cpu<float, method::lloyd_dense, task::clustering>;
 template struct train_kernel_cpu<double, method::lloyd_dense, task::clustering>;
+template struct train_kernel_cpu<float, method::hamerly_dense, task::clustering>;
+template struct train_kernel_cpu<double, method::hamerly_dense, task::clustering>;
+template struct train_kernel_cpu<float, method::lloyd_csr, task::clustering>;
+template struct train_kernel_cpu<double, method::lloyd_csr, task::clustering>;
+template struct spmd_train_kernel_cpu<float, method::lloyd_dense, task::clustering>;
+template struct spmd_train_kernel_cpu<double, method::lloyd_dense, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
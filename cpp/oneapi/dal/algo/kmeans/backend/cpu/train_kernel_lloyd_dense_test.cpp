@@ -14,9 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "oneapi/dal/algo/kmeans/infer.hpp"
 #include "oneapi/dal/algo/kmeans/train.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
+#include "oneapi/dal/test/thread_communicator.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 
 using namespace oneapi::dal;
@@ -85,3 +89,146 @@ TEST(kmeans_lloyd_dense_cpu, infer_results) {
         ASSERT_EQ(infer_labels[i], test_labels[i]);
     }
 }
+
+TEST(kmeans_hamerly_dense_cpu, train_results_match_lloyd) {
+    constexpr std::int64_t row_count = 1000;
+    constexpr std::int64_t column_count = 3;
+    constexpr std::int64_t cluster_count = 7;
+
+    std::vector<float> data(row_count * column_count);
+    std::uint32_t state = 7777;
+    for (auto& x : data) {
+        state = state * 1664525u + 1013904223u;
+        x = static_cast<float>(state >> 8) / static_cast<float>(1 << 24);
+    }
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        data[i * column_count] += static_cast<float>(i % cluster_count) * 1.5f;
+    }
+    const auto data_table = homogen_table::wrap(data.data(), row_count, column_count);
+    const auto initial_centroids =
+        homogen_table::wrap(data.data(), cluster_count, column_count);
+
+    const auto lloyd_desc = kmeans::descriptor<float, kmeans::method::lloyd_dense>()
+                                .set_cluster_count(cluster_count)
+                                .set_max_iteration_count(20)
+                                .set_accuracy_threshold(0.0);
+    const auto hamerly_desc = kmeans::descriptor<float, kmeans::method::hamerly_dense>()
+                                  .set_cluster_count(cluster_count)
+                                  .set_max_iteration_count(20)
+                                  .set_accuracy_threshold(0.0);
+
+    const auto lloyd_result = train(lloyd_desc, data_table, initial_centroids);
+    const auto hamerly_result = train(hamerly_desc, data_table, initial_centroids);
+
+    ASSERT_EQ(lloyd_result.get_iteration_count(), hamerly_result.get_iteration_count());
+    ASSERT_NEAR(lloyd_result.get_objective_function_value(),
+                hamerly_result.get_objective_function_value(),
+                1e-3 * lloyd_result.get_objective_function_value());
+
+    const auto lloyd_labels = row_accessor<const int>(lloyd_result.get_labels()).pull();
+    const auto hamerly_labels = row_accessor<const int>(hamerly_result.get_labels()).pull();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        ASSERT_EQ(lloyd_labels[i], hamerly_labels[i]);
+    }
+
+    const auto lloyd_centroids =
+        row_accessor<const float>(lloyd_result.get_model().get_centroids()).pull();
+    const auto hamerly_centroids =
+        row_accessor<const float>(hamerly_result.get_model().get_centroids()).pull();
+    for (std::int64_t i = 0; i < cluster_count * column_count; ++i) {
+        ASSERT_NEAR(lloyd_centroids[i], hamerly_centroids[i], 1e-4);
+    }
+}
+
+TEST(kmeans_lloyd_dense_cpu, reduced_precision_results_match_full) {
+    constexpr std::int64_t row_count = 2000;
+    constexpr std::int64_t column_count = 5;
+    constexpr std::int64_t cluster_count = 9;
+
+    std::vector<double> data(row_count * column_count);
+    std::uint32_t state = 4242;
+    for (auto& x : data) {
+        state = state * 1664525u + 1013904223u;
+        x = static_cast<double>(state >> 8) / static_cast<double>(1 << 24);
+    }
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        data[i * column_count] += static_cast<double>(i % cluster_count) * 0.5;
+    }
+    const auto data_table = homogen_table::wrap(data.data(), row_count, column_count);
+    const auto initial_centroids =
+        homogen_table::wrap(data.data(), cluster_count, column_count);
+
+    const auto full_desc = kmeans::descriptor<double, kmeans::method::lloyd_dense>()
+                               .set_cluster_count(cluster_count)
+                               .set_max_iteration_count(20)
+                               .set_accuracy_threshold(0.0);
+    const auto full_result = train(full_desc, data_table, initial_centroids);
+    const auto full_labels = row_accessor<const int>(full_result.get_labels()).pull();
+    const auto full_centroids =
+        row_accessor<const double>(full_result.get_model().get_centroids()).pull();
+
+    // The bfloat16 precision falls back to the single precision on the CPUs without it
+    for (auto precision :
+         { kmeans::distance_precision::reduced, kmeans::distance_precision::bfloat16 }) {
+        auto reduced_desc = full_desc;
+        reduced_desc.set_distance_precision(precision);
+        const auto reduced_result = train(reduced_desc, data_table, initial_centroids);
+
+        ASSERT_EQ(full_result.get_iteration_count(), reduced_result.get_iteration_count());
+        ASSERT_NEAR(full_result.get_objective_function_value(),
+                    reduced_result.get_objective_function_value(),
+                    1e-9 * full_result.get_objective_function_value());
+
+        const auto reduced_labels = row_accessor<const int>(reduced_result.get_labels()).pull();
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            ASSERT_EQ(full_labels[i], reduced_labels[i]);
+        }
+
+        const auto reduced_centroids =
+            row_accessor<const double>(reduced_result.get_model().get_centroids()).pull();
+        for (std::int64_t i = 0; i < cluster_count * column_count; ++i) {
+            ASSERT_NEAR(full_centroids[i], reduced_centroids[i], 1e-9);
+        }
+    }
+}
+
+TEST(kmeans_lloyd_dense_cpu, spmd_train_results) {
+    constexpr std::int64_t rank_count = 2;
+    constexpr std::int64_t rank_row_count = 4;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t cluster_count = 2;
+
+    static const float data[] = { 1.0,  1.0,  2.0,  2.0,  1.0,  2.0,  2.0,  1.0,
+                                  -1.0, -1.0, -1.0, -2.0, -2.0, -1.0, -2.0, -2.0 };
+    static const float initial_centroids[] = { 1.0, 1.0, -1.0, -1.0 };
+    static const float centroids[] = { 1.5, 1.5, -1.5, -1.5 };
+
+    const auto kmeans_desc = kmeans::descriptor<>()
+                                 .set_cluster_count(cluster_count)
+                                 .set_max_iteration_count(4)
+                                 .set_accuracy_threshold(0.001);
+
+    test::run_spmd(rank_count, [&](std::int64_t rank, const spmd::communicator& comm) {
+        const auto local_data = homogen_table::wrap(data + rank * rank_row_count * column_count,
+                                                    rank_row_count,
+                                                    column_count);
+        const auto initial_centroids_table =
+            homogen_table::wrap(initial_centroids, cluster_count, column_count);
+        const detail::spmd_policy<detail::host_policy> policy{ detail::host_policy{}, comm };
+
+        const auto result = train(policy, kmeans_desc, local_data, initial_centroids_table);
+
+        const auto labels = row_accessor<const int>(result.get_labels()).pull();
+        ASSERT_EQ(labels.get_count(), rank_row_count);
+        for (std::int64_t i = 0; i < rank_row_count; ++i) {
+            ASSERT_EQ(labels[i], rank);
+        }
+
+        const auto train_centroids =
+            row_accessor<const float>(result.get_model().get_centroids()).pull();
+        for (std::int64_t i = 0; i < cluster_count * column_count; ++i) {
+            ASSERT_FLOAT_EQ(train_centroids[i], centroids[i]);
+        }
+        ASSERT_NEAR(result.get_objective_function_value(), 4.0, 1e-5);
+    });
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/kmeans/infer.hpp"
+#include "oneapi/dal/algo/kmeans/train.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+TEST(kmeans_mini_batch_dense_cpu, train_results) {
+    constexpr std::int64_t row_count = 8;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t cluster_count = 2;
+
+    const float data[] = { 1.0,  1.0,  -1.0, -1.0, 2.0,  2.0,  -1.0, -2.0,
+                           1.0,  2.0,  -2.0, -1.0, 2.0,  1.0,  -2.0, -2.0 };
+    const float initial_centroids[] = { -1.0, -1.0, 1.0, 1.0 };
+
+    const int labels[] = { 1, 0, 1, 0, 1, 0, 1, 0 };
+
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto initial_centroids_table =
+        homogen_table::wrap(initial_centroids, cluster_count, column_count);
+
+    const auto kmeans_desc = kmeans::descriptor<float, kmeans::method::mini_batch_dense>()
+                                 .set_cluster_count(cluster_count)
+                                 .set_max_iteration_count(8)
+                                 .set_batch_size(4);
+
+    const auto result_train = train(kmeans_desc, data_table, initial_centroids_table);
+    ASSERT_EQ(result_train.get_iteration_count(), 8);
+
+    const auto train_labels = row_accessor<const int>(result_train.get_labels()).pull();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        ASSERT_EQ(labels[i], train_labels[i]);
+    }
+
+    const auto train_centroids =
+        row_accessor<const float>(result_train.get_model().get_centroids()).pull();
+    const float centroids[] = { -1.5, -1.5, 1.5, 1.5 };
+    for (std::int64_t i = 0; i < cluster_count * column_count; ++i) {
+        ASSERT_NEAR(centroids[i], train_centroids[i], 0.25);
+    }
+
+    const auto counts = row_accessor<const float>(result_train.get_cluster_counts()).pull();
+    ASSERT_FLOAT_EQ(counts[0] + counts[1], 32.0);
+}
+
+TEST(kmeans_mini_batch_dense_cpu, train_by_chunks) {
+    constexpr std::int64_t row_count = 4000;
+    constexpr std::int64_t chunk_row_count = 1000;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t cluster_count = 4;
+
+    const float centers[] = { 0.0, 0.0, 10.0, 0.0, 0.0, 10.0, 10.0, 10.0 };
+
+    std::vector<float> data(row_count * column_count);
+    std::uint32_t state = 12345;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            state = state * 1664525u + 1013904223u;
+            const float noise = static_cast<float>(state >> 8) / static_cast<float>(1 << 24);
+            data[i * column_count + j] = centers[(i % cluster_count) * column_count + j] + noise;
+        }
+    }
+
+    const auto kmeans_desc = kmeans::descriptor<float, kmeans::method::mini_batch_dense>()
+                                 .set_cluster_count(cluster_count)
+                                 .set_max_iteration_count(10)
+                                 .set_batch_size(100);
+
+    table centroids = homogen_table::wrap(data.data(), cluster_count, column_count);
+    table counts;
+    for (std::int64_t start = 0; start < row_count; start += chunk_row_count) {
+        const auto chunk =
+            homogen_table::wrap(data.data() + start * column_count, chunk_row_count, column_count);
+        auto input = kmeans::train_input<>{ chunk, centroids };
+        if (counts.has_data()) {
+            input.set_initial_cluster_counts(counts);
+        }
+        const auto result = train(kmeans_desc, input);
+        centroids = result.get_model().get_centroids();
+        counts = result.get_cluster_counts();
+    }
+
+    const auto total_counts = row_accessor<const float>(counts).pull();
+    float total_count = 0;
+    for (std::int64_t i = 0; i < cluster_count; ++i) {
+        total_count += total_counts[i];
+    }
+    ASSERT_FLOAT_EQ(total_count, 4 * 10 * 100);
+
+    const auto trained_centroids = row_accessor<const float>(centroids).pull();
+    for (std::int64_t i = 0; i < cluster_count * column_count; ++i) {
+        ASSERT_NEAR(centers[i] + 0.5, trained_centroids[i], 0.1);
+    }
+}
@@ -17,6 +17,7 @@
 #include <src/algorithms/kmeans/oneapi/kmeans_dense_lloyd_batch_kernel_ucapi.h>
 
 #include "oneapi/dal/algo/kmeans/backend/gpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/kmeans/backend/gpu/lloyd_csr_kernels_dpc.hpp"
 #include "oneapi/dal/backend/interop/common_dpc.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
@@ -102,7 +103,69 @@ struct infer_kernel_gpu<Float, method::by_default, task::clustering> {
     }
 };
 
+template <typename Float>
+struct infer_kernel_gpu<Float, method::hamerly_dense, task::clustering>
+        : public infer_kernel_gpu<Float, method::by_default, task::clustering> {};
+
+template <typename Float>
+struct infer_kernel_gpu<Float, method::mini_batch_dense, task::clustering>
+        : public infer_kernel_gpu<Float, method::by_default, task::clustering> {};
+
+template <typename Float>
+struct infer_kernel_gpu<Float, method::lloyd_csr, task::clustering> {
+    infer_result<task::clustering> operator()(const dal::backend::context_gpu& ctx,
+                                              const descriptor_base<task::clustering>& params,
+                                              const infer_input<task::clustering>& input) const {
+        auto& queue = ctx.get_queue();
+
+        const auto data = input.get_data();
+        const int64_t row_count = data.get_row_count();
+        const int64_t column_count = data.get_column_count();
+        const int64_t cluster_count = params.get_cluster_count();
+
+        const csr_device_data<Float> csr_data{ queue, data };
+
+        auto arr_host_centroids = row_accessor<const Float>{ input.get_model().get_centroids() }.pull();
+        auto arr_centroids =
+            copy_to_device(queue, arr_host_centroids.get_data(), cluster_count * column_count);
+        auto arr_labels = array<int>::empty(queue, row_count);
+
+        auto arr_row_norms = array<Float>::empty(queue, row_count, sycl::usm::alloc::device);
+        auto arr_centroid_norms =
+            array<Float>::empty(queue, cluster_count, sycl::usm::alloc::device);
+        auto arr_objective = array<Float>::empty(queue, 1, sycl::usm::alloc::device);
+
+        dal::backend::compute_csr_row_norms(queue, csr_data, row_count, arr_row_norms.get_mutable_data());
+        compute_centroid_norms(queue,
+                               arr_centroids.get_data(),
+                               cluster_count,
+                               column_count,
+                               arr_centroid_norms.get_mutable_data());
+        const Float objective = assign_rows(queue,
+                                            csr_data,
+                                            arr_row_norms.get_data(),
+                                            arr_centroids.get_data(),
+                                            arr_centroid_norms.get_data(),
+                                            row_count,
+                                            cluster_count,
+                                            column_count,
+                                            arr_labels.get_mutable_data(),
+                                            arr_objective.get_mutable_data());
+
+        return infer_result<task::clustering>()
+            .set_labels(
+                dal::detail::homogen_table_builder{}.reset(arr_labels, row_count, 1).build())
+            .set_objective_function_value(static_cast<double>(objective));
+    }
+};
+
 template struct infer_kernel_gpu<float, method::by_default, task::clustering>;
 template struct infer_kernel_gpu<double, method::by_default, task::clustering>;
+template struct infer_kernel_gpu<float, method::hamerly_dense, task::clustering>;
+template struct infer_kernel_gpu<double, method::hamerly_dense, task::clustering>;
+template struct infer_kernel_gpu<float, method::mini_batch_dense, task::clustering>;
+template struct infer_kernel_gpu<double, method::mini_batch_dense, task::clustering>;
+template struct infer_kernel_gpu<float, method::lloyd_csr, task::clustering>;
+template struct infer_kernel_gpu<double, method::lloyd_csr, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
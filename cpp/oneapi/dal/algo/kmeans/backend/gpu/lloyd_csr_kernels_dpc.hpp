@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#ifndef ONEAPI_DAL_DATA_PARALLEL
+#error ONEAPI_DAL_DATA_PARALLEL must be defined to include this file
+#endif
+
+#include <limits>
+
+#include "oneapi/dal/backend/csr_kernels_dpc.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+using std::int64_t;
+using dal::backend::copy_to_device;
+using dal::backend::csr_device_data;
+
+// The number of work-items reducing the objective function in one group
+constexpr std::int64_t gpu_csr_work_group_size = 256;
+
+template <typename T>
+using global_atomic_ref = sycl::ONEAPI::atomic_ref<T,
+                                                   sycl::ONEAPI::memory_order::relaxed,
+                                                   sycl::ONEAPI::memory_scope::device,
+                                                   sycl::access::address_space::global_space>;
+
+template <typename Float>
+class kmeans_csr_centroid_norms;
+template <typename Float>
+class kmeans_csr_assign;
+template <typename Float>
+class kmeans_csr_accumulate;
+template <typename Float>
+class kmeans_csr_divide;
+
+template <typename Float>
+void compute_centroid_norms(sycl::queue& queue,
+                                   const Float* centroids,
+                                   int64_t cluster_count,
+                                   int64_t column_count,
+                                   Float* norms) {
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<kmeans_csr_centroid_norms<Float>>(
+                sycl::range<1>(cluster_count),
+                [=](sycl::id<1> idx) {
+                    const Float* centroid = centroids + idx[0] * column_count;
+                    Float sum = Float(0);
+                    for (int64_t j = 0; j < column_count; ++j) {
+                        sum += centroid[j] * centroid[j];
+                    }
+                    norms[idx[0]] = sum;
+                });
+        })
+        .wait_and_throw();
+}
+
+/// Assigns the rows to the closest centroids. The distances are computed as
+/// |x|^2 + |c|^2 - 2 <x, c>, the dot products with the centroids take the
+/// non-zero values of the row only. Returns the objective function value.
+template <typename Float>
+Float assign_rows(sycl::queue& queue,
+                         const csr_device_data<Float>& data,
+                         const Float* row_norms,
+                         const Float* centroids,
+                         const Float* centroid_norms,
+                         int64_t row_count,
+                         int64_t cluster_count,
+                         int64_t column_count,
+                         int* labels,
+                         Float* objective) {
+    const Float* values = data.values.get_data();
+    const int64_t* indices = data.column_indices.get_data();
+    const int64_t* offsets = data.row_offsets.get_data();
+    const Float max_value = std::numeric_limits<Float>::max();
+
+    queue.memset(objective, 0, sizeof(Float)).wait_and_throw();
+
+    const int64_t group_count = (row_count + gpu_csr_work_group_size - 1) / gpu_csr_work_group_size;
+    const auto range = sycl::nd_range<1>(sycl::range<1>(group_count * gpu_csr_work_group_size),
+                                         sycl::range<1>(gpu_csr_work_group_size));
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<kmeans_csr_assign<Float>>(range, [=](sycl::nd_item<1> item) {
+                const int64_t i = item.get_global_id(0);
+                Float min_distance = Float(0);
+                if (i < row_count) {
+                    int label = 0;
+                    min_distance = max_value;
+                    for (int64_t c = 0; c < cluster_count; ++c) {
+                        const Float* centroid = centroids + c * column_count;
+                        Float dot = Float(0);
+                        for (int64_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+                            dot += values[k] * centroid[indices[k]];
+                        }
+                        const Float distance = centroid_norms[c] - Float(2) * dot;
+                        if (distance < min_distance) {
+                            min_distance = distance;
+                            label = static_cast<int>(c);
+                        }
+                    }
+                    labels[i] = label;
+                    min_distance = sycl::max(min_distance + row_norms[i], Float(0));
+                }
+                const Float group_sum =
+                    sycl::ONEAPI::reduce(item.get_group(), min_distance, sycl::ONEAPI::plus<Float>());
+                if (item.get_local_id(0) == 0) {
+                    global_atomic_ref<Float>(objective[0]).fetch_add(group_sum);
+                }
+            });
+        })
+        .wait_and_throw();
+
+    Float objective_value = Float(0);
+    queue.memcpy(&objective_value, objective, sizeof(Float)).wait_and_throw();
+    return objective_value;
+}
+
+/// Moves the centroids to the means of their rows. The centroids of the
+/// empty clusters stay in place.
+template <typename Float>
+void update_centroids(sycl::queue& queue,
+                             const csr_device_data<Float>& data,
+                             const int* labels,
+                             int64_t row_count,
+                             int64_t cluster_count,
+                             int64_t column_count,
+                             Float* sums,
+                             int* counts,
+                             Float* centroids) {
+    const Float* values = data.values.get_data();
+    const int64_t* indices = data.column_indices.get_data();
+    const int64_t* offsets = data.row_offsets.get_data();
+
+    auto sums_event = queue.memset(sums, 0, sizeof(Float) * cluster_count * column_count);
+    auto counts_event = queue.memset(counts, 0, sizeof(int) * cluster_count);
+    sycl::event::wait_and_throw({ sums_event, counts_event });
+
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<kmeans_csr_accumulate<Float>>(
+                sycl::range<1>(row_count),
+                [=](sycl::id<1> idx) {
+                    const int64_t i = idx[0];
+                    const int64_t label = labels[i];
+                    global_atomic_ref<int>(counts[label]).fetch_add(1);
+                    Float* sum = sums + label * column_count;
+                    for (int64_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+                        global_atomic_ref<Float>(sum[indices[k]]).fetch_add(values[k]);
+                    }
+                });
+        })
+        .wait_and_throw();
+
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<kmeans_csr_divide<Float>>(
+                sycl::range<1>(cluster_count * column_count),
+                [=](sycl::id<1> idx) {
+                    const int count = counts[idx[0] / column_count];
+                    if (count > 0) {
+                        centroids[idx[0]] = sums[idx[0]] / Float(count);
+                    }
+                });
+        })
+        .wait_and_throw();
+}
+
+} // namespace oneapi::dal::kmeans::backend
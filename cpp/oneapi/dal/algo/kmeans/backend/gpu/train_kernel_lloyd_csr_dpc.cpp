@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans/backend/gpu/lloyd_csr_kernels_dpc.hpp"
+#include "oneapi/dal/algo/kmeans/backend/gpu/train_kernel.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+using std::int64_t;
+using dal::backend::context_gpu;
+
+template <typename Float>
+struct train_kernel_gpu<Float, method::lloyd_csr, task::clustering> {
+    train_result<task::clustering> operator()(const dal::backend::context_gpu& ctx,
+                                              const descriptor_base<task::clustering>& params,
+                                              const train_input<task::clustering>& input) const {
+        if (!(input.get_initial_centroids().has_data())) {
+            throw domain_error("Input initial_centroids should not be empty");
+        }
+
+        auto& queue = ctx.get_queue();
+
+        const auto data = input.get_data();
+        const int64_t row_count = data.get_row_count();
+        const int64_t column_count = data.get_column_count();
+
+        const int64_t cluster_count = params.get_cluster_count();
+        const int64_t max_iteration_count = params.get_max_iteration_count();
+        const double accuracy_threshold = params.get_accuracy_threshold();
+
+        const csr_device_data<Float> csr_data{ queue, data };
+
+        auto arr_initial_centroids =
+            row_accessor<const Float>{ input.get_initial_centroids() }.pull();
+        auto arr_centroids = copy_to_device(queue,
+                                            arr_initial_centroids.get_data(),
+                                            cluster_count * column_count);
+        auto arr_labels = array<int>::empty(queue, row_count);
+
+        auto arr_row_norms = array<Float>::empty(queue, row_count, sycl::usm::alloc::device);
+        auto arr_centroid_norms =
+            array<Float>::empty(queue, cluster_count, sycl::usm::alloc::device);
+        auto arr_sums =
+            array<Float>::empty(queue, cluster_count * column_count, sycl::usm::alloc::device);
+        auto arr_counts = array<int>::empty(queue, cluster_count, sycl::usm::alloc::device);
+        auto arr_objective = array<Float>::empty(queue, 1, sycl::usm::alloc::device);
+
+        Float* centroids = arr_centroids.get_mutable_data();
+        Float* centroid_norms = arr_centroid_norms.get_mutable_data();
+        int* labels = arr_labels.get_mutable_data();
+
+        dal::backend::compute_csr_row_norms(queue, csr_data, row_count, arr_row_norms.get_mutable_data());
+
+        Float prev_objective = Float(0);
+        int64_t iteration = 0;
+        for (; iteration < max_iteration_count; iteration++) {
+            compute_centroid_norms(queue, centroids, cluster_count, column_count, centroid_norms);
+            const Float objective = assign_rows(queue,
+                                                csr_data,
+                                                arr_row_norms.get_data(),
+                                                centroids,
+                                                centroid_norms,
+                                                row_count,
+                                                cluster_count,
+                                                column_count,
+                                                labels,
+                                                arr_objective.get_mutable_data());
+            update_centroids(queue,
+                             csr_data,
+                             labels,
+                             row_count,
+                             cluster_count,
+                             column_count,
+                             arr_sums.get_mutable_data(),
+                             arr_counts.get_mutable_data(),
+                             centroids);
+
+            if (accuracy_threshold > 0.0) {
+                const Float diff = objective - prev_objective;
+                if ((diff > 0 ? diff : -diff) < accuracy_threshold) {
+                    iteration++;
+                    break;
+                }
+            }
+            prev_objective = objective;
+        }
+
+        compute_centroid_norms(queue, centroids, cluster_count, column_count, centroid_norms);
+        const Float objective = assign_rows(queue,
+                                            csr_data,
+                                            arr_row_norms.get_data(),
+                                            centroids,
+                                            centroid_norms,
+                                            row_count,
+                                            cluster_count,
+                                            column_count,
+                                            labels,
+                                            arr_objective.get_mutable_data());
+
+        auto arr_result_centroids = array<Float>::empty(queue, cluster_count * column_count);
+        queue
+            .memcpy(arr_result_centroids.get_mutable_data(),
+                    centroids,
+                    sizeof(Float) * cluster_count * column_count)
+            .wait_and_throw();
+
+        return train_result<task::clustering>()
+            .set_labels(
+                dal::detail::homogen_table_builder{}.reset(arr_labels, row_count, 1).build())
+            .set_iteration_count(iteration)
+            .set_objective_function_value(static_cast<double>(objective))
+            .set_model(model<task::clustering>().set_centroids(
+                dal::detail::homogen_table_builder{}
+                    .reset(arr_result_centroids, cluster_count, column_count)
+                    .build()));
+    }
+};
+
+template struct train_kernel_gpu<float, method::lloyd_csr, task::clustering>;
+template struct train_kernel_gpu<double, method::lloyd_csr, task::clustering>;
+
+} // namespace oneapi::dal::kmeans::backend
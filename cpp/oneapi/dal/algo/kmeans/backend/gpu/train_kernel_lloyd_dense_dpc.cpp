@@ -113,7 +113,14 @@ struct train_kernel_gpu<Float, method::lloyd_dense, task::clustering> {
     }
 };
 
+/// The bounds of Hamerly pay off on CPU only, so the GPU runs Lloyd iterations
+template <typename Float>
+struct train_kernel_gpu<Float, method::hamerly_dense, task::clustering>
+        : public train_kernel_gpu<Float, method::lloyd_dense, task::clustering> {};
+
 template struct train_kernel_gpu<float, method::lloyd_dense, task::clustering>;
 template struct train_kernel_gpu<double, method::lloyd_dense, task::clustering>;
+template struct train_kernel_gpu<float, method::hamerly_dense, task::clustering>;
+template struct train_kernel_gpu<double, method::hamerly_dense, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
@@ -16,6 +16,7 @@
 
 #include "oneapi/dal/algo/kmeans/common.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/detail/table_serialization.hpp"
 
 namespace oneapi::dal::kmeans {
 
@@ -25,6 +26,11 @@ public:
     std::int64_t cluster_count = 2;
     std::int64_t max_iteration_count = 100;
     double accuracy_threshold = 0;
+    std::int64_t batch_size = 1024;
+    learning_rate_schedule rate_schedule = learning_rate_schedule::inverse_count;
+    double learning_rate = 0.1;
+    double reassignment_ratio = 0.01;
+    distance_precision precision = distance_precision::full;
 };
 
 template <>
@@ -54,6 +60,31 @@ double descriptor_base<task::clustering>::get_accuracy_threshold() const {
     return impl_->accuracy_threshold;
 }
 
+template <>
+std::int64_t descriptor_base<task::clustering>::get_batch_size() const {
+    return impl_->batch_size;
+}
+
+template <>
+learning_rate_schedule descriptor_base<task::clustering>::get_learning_rate_schedule() const {
+    return impl_->rate_schedule;
+}
+
+template <>
+double descriptor_base<task::clustering>::get_learning_rate() const {
+    return impl_->learning_rate;
+}
+
+template <>
+double descriptor_base<task::clustering>::get_reassignment_ratio() const {
+    return impl_->reassignment_ratio;
+}
+
+template <>
+distance_precision descriptor_base<task::clustering>::get_distance_precision() const {
+    return impl_->precision;
+}
+
 template <>
 void descriptor_base<task::clustering>::set_cluster_count_impl(std::int64_t value) {
     if (value <= 0) {
@@ -78,6 +109,41 @@ void descriptor_base<task::clustering>::set_accuracy_threshold_impl(double value
     impl_->accuracy_threshold = value;
 }
 
+template <>
+void descriptor_base<task::clustering>::set_batch_size_impl(std::int64_t value) {
+    if (value <= 0) {
+        throw domain_error("batch_size should be > 0");
+    }
+    impl_->batch_size = value;
+}
+
+template <>
+void descriptor_base<task::clustering>::set_learning_rate_schedule_impl(
+    learning_rate_schedule value) {
+    impl_->rate_schedule = value;
+}
+
+template <>
+void descriptor_base<task::clustering>::set_learning_rate_impl(double value) {
+    if (value <= 0.0 || value > 1.0) {
+        throw domain_error("learning_rate should be in (0.0, 1.0]");
+    }
+    impl_->learning_rate = value;
+}
+
+template <>
+void descriptor_base<task::clustering>::set_reassignment_ratio_impl(double value) {
+    if (value < 0.0 || value > 1.0) {
+        throw domain_error("reassignment_ratio should be in [0.0, 1.0]");
+    }
+    impl_->reassignment_ratio = value;
+}
+
+template <>
+void descriptor_base<task::clustering>::set_distance_precision_impl(distance_precision value) {
+    impl_->precision = value;
+}
+
 template <typename Task>
 model<Task>::model() : impl_(new model_impl{}) {}
 
@@ -96,6 +162,18 @@ void model<task::clustering>::set_centroids_impl(const table& value) {
     impl_->centroids = value;
 }
 
+template <>
+void model<task::clustering>::serialize(dal::detail::binary_output_archive& ar) const {
+    ar.write(dal::detail::serialization_id::kmeans_clustering_model);
+    dal::detail::serialize_table(impl_->centroids, ar);
+}
+
+template <>
+void model<task::clustering>::deserialize(dal::detail::binary_input_archive& ar) {
+    ar.expect(dal::detail::serialization_id::kmeans_clustering_model);
+    impl_->centroids = dal::detail::deserialize_table(ar);
+}
+
 template class ONEAPI_DAL_EXPORT descriptor_base<task::clustering>;
 template class ONEAPI_DAL_EXPORT model<task::clustering>;
 
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/detail/archives.hpp"
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/table/common.hpp"
 
@@ -38,9 +39,40 @@ class model_impl;
 
 namespace method {
 struct lloyd_dense {};
+struct hamerly_dense {};
+struct mini_batch_dense {};
+struct lloyd_csr {};
 using by_default = lloyd_dense;
 } // namespace method
 
+/// The rate at which the mini_batch_dense method moves the centroid towards
+/// the mean of its observations in the batch
+enum class learning_rate_schedule {
+    /// The number of the observations of the centroid in the batch divided by
+    /// the total number of its observations seen so far
+    inverse_count,
+    /// The constant learning_rate
+    constant
+};
+
+/// The precision of the distances between the observations and the centroids
+enum class distance_precision {
+    /// The distances are computed in the precision of the data
+    full,
+    /// The distances of the double precision data are computed in single
+    /// precision, the observations whose closest centroid is not proven by the
+    /// bound of the rounding error are recomputed in double precision, so the
+    /// assignments do not change. Used by the lloyd_dense method on CPU.
+    reduced,
+    /// The distances of the data in both precisions are computed in bfloat16
+    /// by the AMX tiles or the AVX-512 BF16 dot products if they are enabled
+    /// in the policy, otherwise in the same way as reduced. The observations
+    /// whose closest centroid is not proven by the bound of the rounding error
+    /// are recomputed in the precision of the data. Used by the lloyd_dense
+    /// method on CPU.
+    bfloat16
+};
+
 template <typename Task = task::by_default>
 class ONEAPI_DAL_EXPORT descriptor_base : public base {
 public:
@@ -54,11 +86,21 @@ public:
     std::int64_t get_cluster_count() const;
     std::int64_t get_max_iteration_count() const;
     double get_accuracy_threshold() const;
+    std::int64_t get_batch_size() const;
+    learning_rate_schedule get_learning_rate_schedule() const;
+    double get_learning_rate() const;
+    double get_reassignment_ratio() const;
+    distance_precision get_distance_precision() const;
 
 protected:
     void set_cluster_count_impl(std::int64_t);
     void set_max_iteration_count_impl(std::int64_t);
     void set_accuracy_threshold_impl(double);
+    void set_batch_size_impl(std::int64_t);
+    void set_learning_rate_schedule_impl(learning_rate_schedule);
+    void set_learning_rate_impl(double);
+    void set_reassignment_ratio_impl(double);
+    void set_distance_precision_impl(distance_precision);
 
     dal::detail::pimpl<detail::descriptor_impl<task_t>> impl_;
 };
@@ -85,6 +127,31 @@ public:
         descriptor_base<Task>::set_accuracy_threshold_impl(value);
         return *this;
     }
+
+    auto& set_batch_size(int64_t value) {
+        descriptor_base<Task>::set_batch_size_impl(value);
+        return *this;
+    }
+
+    auto& set_learning_rate_schedule(learning_rate_schedule value) {
+        descriptor_base<Task>::set_learning_rate_schedule_impl(value);
+        return *this;
+    }
+
+    auto& set_learning_rate(double value) {
+        descriptor_base<Task>::set_learning_rate_impl(value);
+        return *this;
+    }
+
+    auto& set_reassignment_ratio(double value) {
+        descriptor_base<Task>::set_reassignment_ratio_impl(value);
+        return *this;
+    }
+
+    auto& set_distance_precision(distance_precision value) {
+        descriptor_base<Task>::set_distance_precision_impl(value);
+        return *this;
+    }
 };
 
 template <typename Task = task::by_default>
@@ -106,6 +173,10 @@ public:
 private:
     void set_centroids_impl(const table&);
 
+    friend dal::detail::serialization_accessor;
+    void serialize(dal::detail::binary_output_archive& ar) const;
+    void deserialize(dal::detail::binary_input_archive& ar);
+
     dal::detail::pimpl<detail::model_impl<task_t>> impl_;
 };
 
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/kmeans/train.hpp"
+#include "oneapi/dal/algo/pca/common.hpp"
+#include "oneapi/dal/serialization.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+namespace {
+
+kmeans::model<> train_model() {
+    constexpr std::int64_t row_count = 8;
+    constexpr std::int64_t column_count = 2;
+
+    static const float data[] = { 1.0,  1.0,  2.0,  2.0,  1.0,  2.0,  2.0,  1.0,
+                                  -1.0, -1.0, -1.0, -2.0, -2.0, -1.0, -2.0, -2.0 };
+
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto kmeans_desc = kmeans::descriptor<>()
+                                 .set_cluster_count(2)
+                                 .set_max_iteration_count(4)
+                                 .set_accuracy_threshold(0.001);
+    return train(kmeans_desc, data_table).get_model();
+}
+
+void check_same_centroids(const kmeans::model<>& expected, const kmeans::model<>& actual) {
+    const auto expected_centroids = expected.get_centroids();
+    const auto actual_centroids = actual.get_centroids();
+    ASSERT_EQ(actual_centroids.get_row_count(), expected_centroids.get_row_count());
+    ASSERT_EQ(actual_centroids.get_column_count(), expected_centroids.get_column_count());
+
+    const auto expected_data = row_accessor<const float>(expected_centroids).pull();
+    const auto actual_data = row_accessor<const float>(actual_centroids).pull();
+    for (std::int64_t i = 0; i < expected_data.get_count(); ++i) {
+        ASSERT_FLOAT_EQ(expected_data[i], actual_data[i]);
+    }
+}
+
+} // namespace
+
+TEST(kmeans_serialization, restores_centroids_without_copy) {
+    const auto model = train_model();
+    const auto data = serialize(model);
+
+    kmeans::model<> restored;
+    deserialize(data, restored);
+    check_same_centroids(model, restored);
+
+    const auto centroids = row_accessor<const float>(restored.get_centroids()).pull();
+    const auto begin = reinterpret_cast<const float*>(data.get_data());
+    const auto end = reinterpret_cast<const float*>(data.get_data() + data.get_count());
+    ASSERT_GE(centroids.get_data(), begin);
+    ASSERT_LT(centroids.get_data(), end);
+}
+
+TEST(kmeans_serialization, restores_compressed_model) {
+    const auto model = train_model();
+
+    for (auto method : { compression_method::zlib, compression_method::lz4 }) {
+        kmeans::model<> restored;
+        deserialize(serialize(model, method), restored);
+        check_same_centroids(model, restored);
+    }
+}
+
+TEST(kmeans_serialization, restores_model_without_centroids) {
+    kmeans::model<> restored;
+    deserialize(serialize(kmeans::model<>{}), restored);
+    ASSERT_FALSE(restored.get_centroids().has_data());
+}
+
+TEST(kmeans_serialization, throws_on_model_of_other_algorithm) {
+    const auto data = serialize(train_model());
+
+    pca::model<> restored;
+    ASSERT_THROW(deserialize(data, restored), invalid_argument);
+}
+
+TEST(kmeans_serialization, throws_on_truncated_data) {
+    const auto data = serialize(train_model());
+    const array<byte_t> truncated{ data, data.get_data(), data.get_count() - 1 };
+
+    kmeans::model<> restored;
+    ASSERT_THROW(deserialize(truncated, restored), invalid_argument);
+}
@@ -37,5 +37,11 @@ struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<host_policy, Float, Method, Task>
 
 INSTANTIATE(float, method::by_default, task::clustering)
 INSTANTIATE(double, method::by_default, task::clustering)
+INSTANTIATE(float, method::hamerly_dense, task::clustering)
+INSTANTIATE(double, method::hamerly_dense, task::clustering)
+INSTANTIATE(float, method::mini_batch_dense, task::clustering)
+INSTANTIATE(double, method::mini_batch_dense, task::clustering)
+INSTANTIATE(float, method::lloyd_csr, task::clustering)
+INSTANTIATE(double, method::lloyd_csr, task::clustering)
 
 } // namespace oneapi::dal::kmeans::detail
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "oneapi/dal/algo/kmeans/infer_types.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/csr.hpp"
 
 namespace oneapi::dal::kmeans::detail {
 
@@ -34,7 +37,7 @@ struct ONEAPI_DAL_EXPORT infer_ops_dispatcher {
 template <typename Descriptor>
 struct infer_ops {
     using float_t = typename Descriptor::float_t;
-    using method_t = method::by_default;
+    using method_t = typename Descriptor::method_t;
     using task_t = typename Descriptor::task_t;
     using input_t = infer_input<task_t>;
     using result_t = infer_result<task_t>;
@@ -47,6 +50,11 @@ struct infer_ops {
         if (!(input.get_model().get_centroids().has_data())) {
             throw domain_error("Input model centroids should not be empty");
         }
+        if constexpr (std::is_same_v<method_t, method::lloyd_csr>) {
+            if (input.get_data().get_kind() != csr_table::kind()) {
+                throw invalid_argument("Input data should be a CSR table for lloyd_csr method");
+            }
+        }
         if (input.get_model().get_centroids().get_row_count() != params.get_cluster_count()) {
             throw invalid_argument(
                 "Model centroids row_count should be equal to descriptor cluster_count");
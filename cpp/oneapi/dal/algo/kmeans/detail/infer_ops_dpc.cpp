@@ -18,6 +18,7 @@
 #include "oneapi/dal/algo/kmeans/backend/gpu/infer_kernel.hpp"
 #include "oneapi/dal/algo/kmeans/detail/infer_ops.hpp"
 #include "oneapi/dal/backend/dispatcher_dpc.hpp"
+#include "oneapi/dal/backend/multi_device_dpc.hpp"
 
 namespace oneapi::dal::kmeans::detail {
 using oneapi::dal::detail::data_parallel_policy;
@@ -27,11 +28,56 @@ struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<data_parallel_policy, Float, Metho
     infer_result<Task> operator()(const data_parallel_policy& ctx,
                                   const descriptor_base<Task>& params,
                                   const infer_input<Task>& input) const {
+        const auto data = input.get_data();
+        const std::int64_t shard_count = dal::backend::get_shard_count(ctx, data.get_row_count());
+        if (shard_count > 1) {
+            return infer_on_devices(ctx, params, input, shard_count);
+        }
+        return infer_on_device(ctx, params, input);
+    }
+
+private:
+    infer_result<Task> infer_on_device(const data_parallel_policy& ctx,
+                                       const descriptor_base<Task>& params,
+                                       const infer_input<Task>& input) const {
         using kernel_dispatcher_t =
             dal::backend::kernel_dispatcher<backend::infer_kernel_cpu<Float, Method, Task>,
                                             backend::infer_kernel_gpu<Float, Method, Task>>;
         return kernel_dispatcher_t{}(ctx, params, input);
     }
+
+    /// The rows are split between the devices, the objective function is the
+    /// sum of the distances, so the values of the devices are added up
+    infer_result<Task> infer_on_devices(const data_parallel_policy& ctx,
+                                        const descriptor_base<Task>& params,
+                                        const infer_input<Task>& input,
+                                        std::int64_t shard_count) const {
+        const auto data = input.get_data();
+        const auto shards = dal::backend::split_rows(data.get_row_count(), shard_count);
+
+        std::vector<table> labels(shard_count);
+        std::vector<double> objective_function_values(shard_count, 0.0);
+        dal::backend::for_each_shard(
+            ctx,
+            shard_count,
+            [&](std::int64_t i, const data_parallel_policy& device_ctx) {
+                const auto shard_data =
+                    dal::backend::pull_rows<Float>(device_ctx.get_queue(), data, shards[i]);
+                const infer_input<Task> shard_input{ input.get_model(), shard_data };
+                const auto shard_result = infer_on_device(device_ctx, params, shard_input);
+                labels[i] = shard_result.get_labels();
+                objective_function_values[i] = shard_result.get_objective_function_value();
+            });
+
+        double objective_function_value = 0.0;
+        for (const double value : objective_function_values) {
+            objective_function_value += value;
+        }
+
+        return infer_result<Task>{}
+            .set_labels(dal::backend::concat_rows<int>(ctx.get_queue(), labels))
+            .set_objective_function_value(objective_function_value);
+    }
 };
 
 #define INSTANTIATE(F, M, T) \
@@ -39,5 +85,11 @@ struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<data_parallel_policy, Float, Metho
 
 INSTANTIATE(float, method::by_default, task::clustering)
 INSTANTIATE(double, method::by_default, task::clustering)
+INSTANTIATE(float, method::hamerly_dense, task::clustering)
+INSTANTIATE(double, method::hamerly_dense, task::clustering)
+INSTANTIATE(float, method::mini_batch_dense, task::clustering)
+INSTANTIATE(double, method::mini_batch_dense, task::clustering)
+INSTANTIATE(float, method::lloyd_csr, task::clustering)
+INSTANTIATE(double, method::lloyd_csr, task::clustering)
 
 } // namespace oneapi::dal::kmeans::detail
@@ -17,9 +17,11 @@
 #include "oneapi/dal/algo/kmeans/detail/train_ops.hpp"
 #include "oneapi/dal/algo/kmeans/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
 
 namespace oneapi::dal::kmeans::detail {
 using oneapi::dal::detail::host_policy;
+using oneapi::dal::detail::spmd_policy;
 
 template <typename Float, typename Method, typename Task>
 struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, Float, Method, Task> {
@@ -32,10 +34,35 @@ struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, Float, Method, Task>
     }
 };
 
-#define INSTANTIATE(F, M, T) \
-    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, F, M, T>;
+/// The Lloyd iterations are distributed over the processes, the other methods
+/// are not supported by the SPMD policy
+template <typename Float, typename Method, typename Task>
+struct ONEAPI_DAL_EXPORT train_ops_dispatcher<spmd_policy<host_policy>, Float, Method, Task> {
+    train_result<Task> operator()(const spmd_policy<host_policy>& ctx,
+                                  const descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        if constexpr (std::is_same_v<Method, method::lloyd_dense>) {
+            using kernel_dispatcher_t = dal::backend::kernel_dispatcher<
+                backend::spmd_train_kernel_cpu<Float, Method, Task>>;
+            return kernel_dispatcher_t()(ctx.get_local(), ctx.get_communicator(), desc, input);
+        }
+        else {
+            throw unimplemented("Only the Lloyd dense method is supported by the SPMD policy");
+        }
+    }
+};
+
+#define INSTANTIATE(F, M, T)                                                      \
+    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, F, M, T>; \
+    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<spmd_policy<host_policy>, F, M, T>;
 
 INSTANTIATE(float, method::lloyd_dense, task::clustering)
 INSTANTIATE(double, method::lloyd_dense, task::clustering)
+INSTANTIATE(float, method::hamerly_dense, task::clustering)
+INSTANTIATE(double, method::hamerly_dense, task::clustering)
+INSTANTIATE(float, method::mini_batch_dense, task::clustering)
+INSTANTIATE(double, method::mini_batch_dense, task::clustering)
+INSTANTIATE(float, method::lloyd_csr, task::clustering)
+INSTANTIATE(double, method::lloyd_csr, task::clustering)
 
 } // namespace oneapi::dal::kmeans::detail
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "oneapi/dal/algo/kmeans/train_types.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/csr.hpp"
 
 namespace oneapi::dal::kmeans::detail {
 
@@ -44,6 +47,11 @@ struct train_ops {
         if (!(input.get_data().has_data())) {
             throw domain_error("Input data should not be empty");
         }
+        if constexpr (std::is_same_v<method_t, method::lloyd_csr>) {
+            if (input.get_data().get_kind() != csr_table::kind()) {
+                throw invalid_argument("Input data should be a CSR table for lloyd_csr method");
+            }
+        }
         if (input.get_initial_centroids().has_data()) {
             if (input.get_initial_centroids().get_row_count() != params.get_cluster_count()) {
                 throw invalid_argument(
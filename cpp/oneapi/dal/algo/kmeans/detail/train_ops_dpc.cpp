@@ -39,5 +39,11 @@ struct ONEAPI_DAL_EXPORT train_ops_dispatcher<data_parallel_policy, Float, Metho
 
 INSTANTIATE(float, method::lloyd_dense, task::clustering)
 INSTANTIATE(double, method::lloyd_dense, task::clustering)
+INSTANTIATE(float, method::hamerly_dense, task::clustering)
+INSTANTIATE(double, method::hamerly_dense, task::clustering)
+INSTANTIATE(float, method::mini_batch_dense, task::clustering)
+INSTANTIATE(double, method::mini_batch_dense, task::clustering)
+INSTANTIATE(float, method::lloyd_csr, task::clustering)
+INSTANTIATE(double, method::lloyd_csr, task::clustering)
 
 } // namespace oneapi::dal::kmeans::detail
@@ -37,6 +37,7 @@ public:
 
     table get_data() const;
     table get_initial_centroids() const;
+    table get_initial_cluster_counts() const;
 
     auto& set_data(const table& data) {
         set_data_impl(data);
@@ -48,9 +49,18 @@ public:
         return *this;
     }
 
+    /// The numbers of the observations accumulated in the initial centroids,
+    /// the mini_batch_dense method continues the learning rate schedule from
+    /// them, e.g. when it runs on the consecutive chunks of the data
+    auto& set_initial_cluster_counts(const table& data) {
+        set_initial_cluster_counts_impl(data);
+        return *this;
+    }
+
 private:
     void set_data_impl(const table& data);
     void set_initial_centroids_impl(const table& data);
+    void set_initial_cluster_counts_impl(const table& data);
 
     dal::detail::pimpl<detail::train_input_impl<task_t>> impl_;
 };
@@ -65,6 +75,7 @@ public:
     table get_labels() const;
     int64_t get_iteration_count() const;
     double get_objective_function_value() const;
+    table get_cluster_counts() const;
 
     auto& set_model(const model<task_t>& value) {
         set_model_impl(value);
@@ -85,11 +96,17 @@ public:
         return *this;
     }
 
+    auto& set_cluster_counts(const table& value) {
+        set_cluster_counts_impl(value);
+        return *this;
+    }
+
 private:
     void set_model_impl(const model<task_t>&);
     void set_labels_impl(const table&);
     void set_iteration_count_impl(std::int64_t);
     void set_objective_function_value_impl(double);
+    void set_cluster_counts_impl(const table&);
 
     dal::detail::pimpl<detail::train_result_impl<task_t>> impl_;
 };
@@ -44,10 +44,7 @@ static compute_result<Task> call_daal_kernel(const context_cpu& ctx,
 
     daal_kmeans_init::Parameter par(cluster_count);
 
-    auto arr_data = row_accessor<const Float>{ data }.pull();
-    const auto daal_data = interop::convert_to_daal_homogen_table(arr_data,
-                                                                  data.get_row_count(),
-                                                                  data.get_column_count());
+    const auto daal_data = interop::convert_to_daal_table_by_kind<Float>(data);
     const size_t len_input = 1;
     daal::data_management::NumericTable* input[len_input] = { daal_data.get() };
 
@@ -94,5 +91,13 @@ template struct compute_kernel_cpu<float, method::plus_plus_dense, task::init>;
 template struct compute_kernel_cpu<double, method::plus_plus_dense, task::init>;
 template struct compute_kernel_cpu<float, method::parallel_plus_dense, task::init>;
 template struct compute_kernel_cpu<double, method::parallel_plus_dense, task::init>;
+template struct compute_kernel_cpu<float, method::csr, task::init>;
+template struct compute_kernel_cpu<double, method::csr, task::init>;
+template struct compute_kernel_cpu<float, method::random_csr, task::init>;
+template struct compute_kernel_cpu<double, method::random_csr, task::init>;
+template struct compute_kernel_cpu<float, method::plus_plus_csr, task::init>;
+template struct compute_kernel_cpu<double, method::plus_plus_csr, task::init>;
+template struct compute_kernel_cpu<float, method::parallel_plus_csr, task::init>;
+template struct compute_kernel_cpu<double, method::parallel_plus_csr, task::init>;
 
 } // namespace oneapi::dal::kmeans_init::backend
@@ -19,6 +19,7 @@
 
 #include "oneapi/dal/algo/kmeans_init/backend/gpu/compute_kernel.hpp"
 #include "oneapi/dal/algo/kmeans_init/backend/to_daal_method.hpp"
+#include "oneapi/dal/algo/kmeans_init/detail/compute_ops.hpp"
 #include "oneapi/dal/backend/interop/common_dpc.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
@@ -42,10 +43,8 @@ template <typename Float, typename Method, typename Task>
 static compute_result<Task> call_daal_kernel(const context_gpu& ctx,
                                              const descriptor_base<Task>& params,
                                              const table& data) {
-    if constexpr (std::is_same_v<Method, method::plus_plus_dense>)
-        throw unimplemented("plus_plus_dense method is not implemented for GPU");
-    if constexpr (std::is_same_v<Method, method::parallel_plus_dense>)
-        throw unimplemented("parallel_plus_dense method is not implemented for GPU");
+    if constexpr (detail::is_csr_method_v<Method>)
+        throw unimplemented("CSR methods are not implemented for GPU");
 
     auto& queue = ctx.get_queue();
     interop::execution_context_guard guard(queue);
@@ -108,5 +107,13 @@ template struct compute_kernel_gpu<float, method::plus_plus_dense, task::init>;
 template struct compute_kernel_gpu<double, method::plus_plus_dense, task::init>;
 template struct compute_kernel_gpu<float, method::parallel_plus_dense, task::init>;
 template struct compute_kernel_gpu<double, method::parallel_plus_dense, task::init>;
+template struct compute_kernel_gpu<float, method::csr, task::init>;
+template struct compute_kernel_gpu<double, method::csr, task::init>;
+template struct compute_kernel_gpu<float, method::random_csr, task::init>;
+template struct compute_kernel_gpu<double, method::random_csr, task::init>;
+template struct compute_kernel_gpu<float, method::plus_plus_csr, task::init>;
+template struct compute_kernel_gpu<double, method::plus_plus_csr, task::init>;
+template struct compute_kernel_gpu<float, method::parallel_plus_csr, task::init>;
+template struct compute_kernel_gpu<double, method::parallel_plus_csr, task::init>;
 
 } // namespace oneapi::dal::kmeans_init::backend
@@ -53,3 +53,49 @@ TEST(kmeans_init_gpu, compute_result) {
 
     sycl::free(data, queue);
 }
+
+template <typename Method>
+void check_centroids_are_distinct_rows() {
+    auto selector = sycl::gpu_selector();
+    auto queue = sycl::queue(selector);
+
+    constexpr std::int64_t row_count = 8;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t cluster_count = 4;
+
+    const float data_host[] = { 1.0,  1.0,  2.0,  2.0,  1.0,  2.0,  2.0,  1.0,
+                                -1.0, -1.0, -1.0, -2.0, -2.0, -1.0, -2.0, -2.0 };
+    auto data = sycl::malloc_shared<float>(row_count * column_count, queue);
+    queue.memcpy(data, data_host, sizeof(float) * row_count * column_count).wait();
+    const auto data_table = homogen_table::wrap(queue, data, row_count, column_count);
+
+    const auto kmeans_desc =
+        kmeans_init::descriptor<float, Method>().set_cluster_count(cluster_count);
+
+    const auto result_compute = compute(queue, kmeans_desc, data_table);
+
+    const auto compute_centroids =
+        row_accessor<const float>(result_compute.get_centroids()).pull(queue).get_data();
+    bool row_taken[row_count] = {};
+    for (std::int64_t i = 0; i < cluster_count; ++i) {
+        std::int64_t row = 0;
+        while (row < row_count &&
+               (row_taken[row] ||
+                data_host[row * column_count] != compute_centroids[i * column_count] ||
+                data_host[row * column_count + 1] != compute_centroids[i * column_count + 1])) {
+            ++row;
+        }
+        ASSERT_LT(row, row_count);
+        row_taken[row] = true;
+    }
+
+    sycl::free(data, queue);
+}
+
+TEST(kmeans_init_gpu, plus_plus_centroids_are_distinct_rows) {
+    check_centroids_are_distinct_rows<kmeans_init::method::plus_plus_dense>();
+}
+
+TEST(kmeans_init_gpu, parallel_plus_centroids_are_distinct_rows) {
+    check_centroids_are_distinct_rows<kmeans_init::method::parallel_plus_dense>();
+}
@@ -45,4 +45,18 @@ template <>
 struct to_daal_method<method::parallel_plus_dense>
         : daal_method_constant<daal_kmeans_init::parallelPlusDense> {};
 
+template <>
+struct to_daal_method<method::csr> : daal_method_constant<daal_kmeans_init::deterministicCSR> {};
+
+template <>
+struct to_daal_method<method::random_csr> : daal_method_constant<daal_kmeans_init::randomCSR> {};
+
+template <>
+struct to_daal_method<method::plus_plus_csr> : daal_method_constant<daal_kmeans_init::plusPlusCSR> {
+};
+
+template <>
+struct to_daal_method<method::parallel_plus_csr>
+        : daal_method_constant<daal_kmeans_init::parallelPlusCSR> {};
+
 } // namespace oneapi::dal::kmeans_init::backend
@@ -38,6 +38,10 @@ struct dense {};
 struct random_dense {};
 struct plus_plus_dense {};
 struct parallel_plus_dense {};
+struct csr {};
+struct random_csr {};
+struct plus_plus_csr {};
+struct parallel_plus_csr {};
 using by_default = dense;
 } // namespace method
 
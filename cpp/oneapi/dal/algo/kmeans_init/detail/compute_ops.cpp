@@ -43,5 +43,13 @@ INSTANTIATE(float, method::plus_plus_dense, task::init)
 INSTANTIATE(double, method::plus_plus_dense, task::init)
 INSTANTIATE(float, method::parallel_plus_dense, task::init)
 INSTANTIATE(double, method::parallel_plus_dense, task::init)
+INSTANTIATE(float, method::csr, task::init)
+INSTANTIATE(double, method::csr, task::init)
+INSTANTIATE(float, method::random_csr, task::init)
+INSTANTIATE(double, method::random_csr, task::init)
+INSTANTIATE(float, method::plus_plus_csr, task::init)
+INSTANTIATE(double, method::plus_plus_csr, task::init)
+INSTANTIATE(float, method::parallel_plus_csr, task::init)
+INSTANTIATE(double, method::parallel_plus_csr, task::init)
 
 } // namespace oneapi::dal::kmeans_init::detail
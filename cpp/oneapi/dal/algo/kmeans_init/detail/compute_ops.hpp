@@ -16,11 +16,20 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "oneapi/dal/algo/kmeans_init/compute_types.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/csr.hpp"
 
 namespace oneapi::dal::kmeans_init::detail {
 
+template <typename Method>
+constexpr bool is_csr_method_v =
+    std::is_same_v<Method, method::csr> || std::is_same_v<Method, method::random_csr> ||
+    std::is_same_v<Method, method::plus_plus_csr> ||
+    std::is_same_v<Method, method::parallel_plus_csr>;
+
 template <typename Context,
           typename Float,
           typename Method = method::dense,
@@ -44,6 +53,11 @@ struct compute_ops {
         if (!(input.get_data().has_data())) {
             throw domain_error("Input data should not be empty");
         }
+        if constexpr (is_csr_method_v<method_t>) {
+            if (input.get_data().get_kind() != csr_table::kind()) {
+                throw invalid_argument("Input data should be a CSR table for CSR methods");
+            }
+        }
         if (input.get_data().get_row_count() == params.get_cluster_count()) {
             throw invalid_argument(
                 "Input data row_count should be equal to descriptor cluster_count");
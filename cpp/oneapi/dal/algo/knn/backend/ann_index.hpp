@@ -0,0 +1,32 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/knn/common.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+/// The inverted file index of the ann method, the grouped rows and labels of
+/// the list i occupy [list_offsets[i], list_offsets[i + 1])
+struct ann_index {
+    table centroids;
+    table list_offsets;
+    table data;
+    table labels;
+};
+
+} // namespace oneapi::dal::knn::backend
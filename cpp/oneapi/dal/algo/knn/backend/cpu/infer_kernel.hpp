@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/algo/knn/infer_types.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/communicator.hpp"
 
 namespace oneapi::dal::knn::backend {
 
@@ -28,4 +29,16 @@ struct infer_kernel_cpu {
                                   const infer_input<Task>& input) const;
 };
 
+/// Searches the neighbors of the queries among the rows of all processes of the
+/// SPMD run. Every process has the model of its own part of the rows and the
+/// same queries, the indices of the result are the ones in the rows of all
+/// processes in the order of the ranks
+template <typename Float, typename Method, typename Task>
+struct spmd_infer_kernel_cpu {
+    infer_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                  const spmd::communicator& comm,
+                                  const descriptor_base<Task>& params,
+                                  const infer_input<Task>& input) const;
+};
+
 } // namespace oneapi::dal::knn::backend
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <daal/src/algorithms/k_nearest_neighbors/bf_knn_classification_ivf_kernel.h>
+
+#include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+namespace daal_knn = daal::algorithms::bf_knn_classification;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_knn_ivf_predict_kernel_t = daal_knn::internal::IVFPredictKernel<Float, Cpu>;
+
+template <typename Float>
+static infer_result<task::classification> call_daal_kernel(
+    const context_cpu &ctx,
+    const descriptor_base<task::classification> &desc,
+    const table &data,
+    model<task::classification> m) {
+    const ann_index &index = dal::detail::get_impl<detail::model_impl>(m).get_ann_index();
+    if (!index.centroids.has_data()) {
+        throw invalid_argument("Model should be trained with the ann method");
+    }
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    if (column_count != index.data.get_column_count()) {
+        throw invalid_argument("Number of columns in data should match the trained model");
+    }
+
+    const std::int64_t list_count = index.centroids.get_row_count();
+    const std::int64_t train_row_count = index.data.get_row_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull();
+    auto arr_labels = array<Float>::empty(1 * row_count);
+    auto arr_centroids = row_accessor<const Float>{ index.centroids }.pull();
+    auto arr_list_offsets = row_accessor<const int>{ index.list_offsets }.pull();
+    auto arr_index_data = row_accessor<const Float>{ index.data }.pull();
+    auto arr_index_labels = row_accessor<const Float>{ index.labels }.pull();
+
+    const auto daal_data =
+        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+    const auto daal_labels = interop::convert_to_daal_homogen_table(arr_labels, row_count, 1);
+    const auto daal_centroids =
+        interop::convert_to_daal_homogen_table(arr_centroids, list_count, column_count);
+    const auto daal_list_offsets =
+        interop::convert_to_daal_homogen_table(arr_list_offsets, list_count + 1, 1);
+    const auto daal_index_data =
+        interop::convert_to_daal_homogen_table(arr_index_data, train_row_count, column_count);
+    const auto daal_index_labels =
+        interop::convert_to_daal_homogen_table(arr_index_labels, train_row_count, 1);
+
+    const daal_knn::internal::IVFParameter daal_parameter(desc.get_class_count(),
+                                                          desc.get_neighbor_count(),
+                                                          desc.get_probe_count());
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_knn_ivf_predict_kernel_t>(ctx,
+                                                                        daal_data.get(),
+                                                                        daal_centroids.get(),
+                                                                        daal_list_offsets.get(),
+                                                                        daal_index_data.get(),
+                                                                        daal_index_labels.get(),
+                                                                        daal_labels.get(),
+                                                                        daal_parameter));
+    return infer_result<task::classification>().set_labels(
+        dal::detail::homogen_table_builder{}.reset(arr_labels, row_count, 1).build());
+}
+
+template <typename Float>
+static infer_result<task::classification> infer(const context_cpu &ctx,
+                                                const descriptor_base<task::classification> &desc,
+                                                const infer_input<task::classification> &input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_model());
+}
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::ann, task::classification> {
+    infer_result<task::classification> operator()(
+        const context_cpu &ctx,
+        const descriptor_base<task::classification> &desc,
+        const infer_input<task::classification> &input) const {
+        return infer<Float>(ctx, desc, input);
+    }
+};
+
+template struct infer_kernel_cpu<float, method::ann, task::classification>;
+template struct infer_kernel_cpu<double, method::ann, task::classification>;
+
+} // namespace oneapi::dal::knn::backend
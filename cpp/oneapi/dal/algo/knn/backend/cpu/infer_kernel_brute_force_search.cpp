@@ -0,0 +1,268 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <daal/src/algorithms/k_nearest_neighbors/bf_knn_classification_predict_kernel.h>
+
+#include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+namespace daal_knn = daal::algorithms::bf_knn_classification;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_knn_brute_force_kernel_t =
+    daal_knn::prediction::internal::KNNClassificationPredictKernel<Float, Cpu>;
+
+template <typename Float>
+static infer_result<task::search> call_daal_kernel(const context_cpu &ctx,
+                                                   const descriptor_base<task::search> &desc,
+                                                   const table &data,
+                                                   model<task::search> m,
+                                                   std::int64_t neighbor_count) {
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull();
+    auto arr_indices = array<std::int32_t>::empty(row_count * neighbor_count);
+    auto arr_distances = array<Float>::empty(row_count * neighbor_count);
+
+    const auto daal_data =
+        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+    const auto daal_indices =
+        interop::convert_to_daal_homogen_table(arr_indices, row_count, neighbor_count);
+    const auto daal_distances =
+        interop::convert_to_daal_homogen_table(arr_distances, row_count, neighbor_count);
+
+    // No results to evaluate turns the voting off, the kernel writes the
+    // neighbors only
+    const std::int64_t dummy_class_count = 2;
+    const auto data_use_in_model = daal_knn::doNotUse;
+    const DAAL_UINT64 results_to_compute =
+        daal_knn::computeIndicesOfNeighbors | daal_knn::computeDistances;
+    const DAAL_UINT64 results_to_evaluate = 0;
+    daal_knn::Parameter daal_parameter(dummy_class_count,
+                                       neighbor_count,
+                                       data_use_in_model,
+                                       results_to_compute,
+                                       results_to_evaluate);
+
+    interop::status_to_exception(interop::call_daal_kernel<Float, daal_knn_brute_force_kernel_t>(
+        ctx,
+        daal_data.get(),
+        dal::detail::get_impl<detail::model_impl>(m).get_interop()->get_daal_model().get(),
+        nullptr,
+        daal_indices.get(),
+        daal_distances.get(),
+        &daal_parameter));
+
+    return infer_result<task::search>()
+        .set_indices(dal::detail::homogen_table_builder{}
+                         .reset(arr_indices, row_count, neighbor_count)
+                         .build())
+        .set_distances(dal::detail::homogen_table_builder{}
+                           .reset(arr_distances, row_count, neighbor_count)
+                           .build());
+}
+
+template <typename Float>
+static infer_result<task::search> infer(const context_cpu &ctx,
+                                        const descriptor_base<task::search> &desc,
+                                        const infer_input<task::search> &input) {
+    return call_daal_kernel<Float>(ctx,
+                                   desc,
+                                   input.get_data(),
+                                   input.get_model(),
+                                   desc.get_neighbor_count());
+}
+
+/// The candidates of every query are neighbor_count pairs of the distance and
+/// the index sorted by the distances, the missing ones have the index -1 and
+/// the largest distance. Merges the sorted candidates of the queries of the rank into the ones of
+/// the other rank, the closer one goes first and the ties go to the smaller
+/// index, so the result does not depend on the order of the merges. It is the
+/// sorted counterpart of mergeNeighbours of the DAAL kernel.
+template <typename Float>
+static void merge_candidates(std::int64_t query_count,
+                             std::int64_t neighbor_count,
+                             const Float *distances,
+                             const std::int64_t *indices,
+                             Float *merged_distances,
+                             std::int64_t *merged_indices) {
+    std::vector<Float> dst_distances(neighbor_count);
+    std::vector<std::int64_t> dst_indices(neighbor_count);
+    for (std::int64_t i = 0; i < query_count; i++) {
+        const Float *d1 = merged_distances + i * neighbor_count;
+        const std::int64_t *i1 = merged_indices + i * neighbor_count;
+        const Float *d2 = distances + i * neighbor_count;
+        const std::int64_t *i2 = indices + i * neighbor_count;
+
+        std::int64_t j1 = 0;
+        std::int64_t j2 = 0;
+        for (std::int64_t j = 0; j < neighbor_count; j++) {
+            const bool is_closer =
+                d1[j1] < d2[j2] || (d1[j1] == d2[j2] && i1[j1] < i2[j2]);
+            const bool is_first = (i2[j2] < 0) || (i1[j1] >= 0 && is_closer);
+            if (is_first) {
+                dst_distances[j] = d1[j1];
+                dst_indices[j] = i1[j1++];
+            }
+            else {
+                dst_distances[j] = d2[j2];
+                dst_indices[j] = i2[j2++];
+            }
+        }
+        std::copy(dst_distances.begin(),
+                  dst_distances.end(),
+                  merged_distances + i * neighbor_count);
+        std::copy(dst_indices.begin(), dst_indices.end(), merged_indices + i * neighbor_count);
+    }
+}
+
+/// Every process searches the neighbors among its own rows with the batch
+/// kernel, then the candidates of the processes are gathered and merged
+/// pairwise along a binary tree of the ranks. The queries are not split, so the
+/// rows of the model stay on their processes, only neighbor_count candidates of
+/// every query per process are exchanged.
+template <typename Float>
+static infer_result<task::search> call_daal_spmd_kernel(const context_cpu &ctx,
+                                                        const spmd::communicator &comm,
+                                                        const descriptor_base<task::search> &desc,
+                                                        const table &data,
+                                                        model<task::search> m) {
+    const std::int64_t query_count = data.get_row_count();
+    const std::int64_t neighbor_count = desc.get_neighbor_count();
+    const std::int64_t rank_count = comm.get_rank_count();
+    const std::int64_t rank = comm.get_rank();
+
+    const auto daal_model =
+        dal::detail::get_impl<detail::model_impl>(m).get_interop()->get_daal_model();
+    const std::int64_t local_row_count =
+        static_cast<daal_knn::Model *>(daal_model.get())->impl()->getData()->getNumberOfRows();
+
+    // The indices of the result are int32 as the ones of the batch search
+    const auto row_counts = comm.allgather(&local_row_count, 1);
+    std::int64_t row_offset = 0;
+    std::int64_t row_count = 0;
+    for (std::int64_t r = 0; r < rank_count; r++) {
+        row_offset += (r < rank) ? row_counts[r] : 0;
+        row_count += row_counts[r];
+    }
+    if (row_count > std::numeric_limits<std::int32_t>::max()) {
+        throw range_error("Number of rows of all processes should fit into int32");
+    }
+    if (row_count < neighbor_count) {
+        throw invalid_argument("Number of rows of all processes should be >= neighbor count");
+    }
+
+    const std::int64_t candidate_count = query_count * neighbor_count;
+    std::vector<Float> local_distances(candidate_count, std::numeric_limits<Float>::max());
+    std::vector<std::int64_t> local_indices(candidate_count, -1);
+
+    const std::int64_t local_neighbor_count = std::min(neighbor_count, local_row_count);
+    if (local_neighbor_count > 0) {
+        const auto local_result =
+            call_daal_kernel<Float>(ctx, desc, data, m, local_neighbor_count);
+        const auto result_distances =
+            row_accessor<const Float>{ local_result.get_distances() }.pull();
+        const auto result_indices =
+            row_accessor<const std::int32_t>{ local_result.get_indices() }.pull();
+        for (std::int64_t i = 0; i < query_count; i++) {
+            for (std::int64_t j = 0; j < local_neighbor_count; j++) {
+                local_distances[i * neighbor_count + j] =
+                    result_distances[i * local_neighbor_count + j];
+                local_indices[i * neighbor_count + j] =
+                    row_offset + result_indices[i * local_neighbor_count + j];
+            }
+        }
+    }
+
+    auto distances = comm.allgather(local_distances.data(), candidate_count);
+    auto indices = comm.allgather(local_indices.data(), candidate_count);
+
+    // The candidates of the rank r + step are merged into the ones of r, the
+    // result is in the candidates of the rank 0
+    for (std::int64_t step = 1; step < rank_count; step *= 2) {
+        for (std::int64_t r = 0; r + step < rank_count; r += 2 * step) {
+            merge_candidates<Float>(query_count,
+                                    neighbor_count,
+                                    distances.data() + (r + step) * candidate_count,
+                                    indices.data() + (r + step) * candidate_count,
+                                    distances.data() + r * candidate_count,
+                                    indices.data() + r * candidate_count);
+        }
+    }
+
+    auto arr_indices = array<std::int32_t>::empty(candidate_count);
+    auto arr_distances = array<Float>::empty(candidate_count);
+    std::int32_t *indices_data = arr_indices.get_mutable_data();
+    Float *distances_data = arr_distances.get_mutable_data();
+    for (std::int64_t i = 0; i < candidate_count; i++) {
+        indices_data[i] = static_cast<std::int32_t>(indices[i]);
+        distances_data[i] = distances[i];
+    }
+
+    return infer_result<task::search>()
+        .set_indices(dal::detail::homogen_table_builder{}
+                         .reset(arr_indices, query_count, neighbor_count)
+                         .build())
+        .set_distances(dal::detail::homogen_table_builder{}
+                           .reset(arr_distances, query_count, neighbor_count)
+                           .build());
+}
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::brute_force, task::search> {
+    infer_result<task::search> operator()(const context_cpu &ctx,
+                                          const descriptor_base<task::search> &desc,
+                                          const infer_input<task::search> &input) const {
+        return infer<Float>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct spmd_infer_kernel_cpu<Float, method::brute_force, task::search> {
+    infer_result<task::search> operator()(const context_cpu &ctx,
+                                          const spmd::communicator &comm,
+                                          const descriptor_base<task::search> &desc,
+                                          const infer_input<task::search> &input) const {
+        return call_daal_spmd_kernel<Float>(ctx,
+                                            comm,
+                                            desc,
+                                            input.get_data(),
+                                            input.get_model());
+    }
+};
+
+template struct infer_kernel_cpu<float, method::brute_force, task::search>;
+template struct infer_kernel_cpu<double, method::brute_force, task::search>;
+template struct spmd_infer_kernel_cpu<float, method::brute_force, task::search>;
+template struct spmd_infer_kernel_cpu<double, method::brute_force, task::search>;
+
+} // namespace oneapi::dal::knn::backend
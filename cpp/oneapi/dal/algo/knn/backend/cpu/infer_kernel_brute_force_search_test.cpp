@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/knn/infer.hpp"
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
+#include "oneapi/dal/test/thread_communicator.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+using search_descriptor_t = knn::descriptor<double, knn::method::brute_force, knn::task::search>;
+
+TEST(knn_brute_force_search_cpu, spmd_infer_results_match_batch) {
+    constexpr std::int64_t rank_count = 3;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t neighbor_count = 3;
+    constexpr std::int64_t query_count = 3;
+
+    // The last rank has fewer rows than the neighbor count
+    static const std::int64_t rank_row_counts[] = { 4, 3, 2 };
+    static const double data[] = { 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 5.0, 5.0, 2.0, 2.0, 6.0,
+                                   5.0, 0.5, 0.5, 9.0, 9.0, 1.0, 1.5 };
+    static const double queries[] = { 0.0, 0.2, 5.4, 5.0, 8.0, 8.0 };
+    constexpr std::int64_t row_count = 9;
+
+    const auto desc = search_descriptor_t(neighbor_count);
+    const auto query_table = homogen_table::wrap(queries, query_count, column_count);
+
+    const auto batch_model = train(desc, homogen_table::wrap(data, row_count, column_count))
+                                 .get_model();
+    const auto batch_result = infer(desc, query_table, batch_model);
+    const auto batch_indices = row_accessor<const std::int32_t>(batch_result.get_indices()).pull();
+    const auto batch_distances = row_accessor<const double>(batch_result.get_distances()).pull();
+
+    test::run_spmd(rank_count, [&](std::int64_t rank, const spmd::communicator& comm) {
+        std::int64_t row_offset = 0;
+        for (std::int64_t r = 0; r < rank; r++) {
+            row_offset += rank_row_counts[r];
+        }
+        const auto local_data = homogen_table::wrap(data + row_offset * column_count,
+                                                    rank_row_counts[rank],
+                                                    column_count);
+        const auto local_model = train(desc, local_data).get_model();
+
+        const detail::spmd_policy<detail::host_policy> policy{ detail::host_policy{}, comm };
+        const auto result = infer(policy, desc, query_table, local_model);
+
+        const auto indices = row_accessor<const std::int32_t>(result.get_indices()).pull();
+        const auto distances = row_accessor<const double>(result.get_distances()).pull();
+        ASSERT_EQ(indices.get_count(), query_count * neighbor_count);
+        for (std::int64_t i = 0; i < query_count * neighbor_count; i++) {
+            ASSERT_EQ(indices[i], batch_indices[i]);
+            ASSERT_NEAR(distances[i], batch_distances[i], 1e-9);
+        }
+    });
+}
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <daal/src/algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_dense_default_batch.h>
+
+#include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+namespace daal_knn = daal::algorithms::kdtree_knn_classification;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_knn_kd_tree_kernel_t = daal_knn::prediction::internal::
+    KNNClassificationPredictKernel<Float, daal_knn::prediction::defaultDense, Cpu>;
+
+template <typename Float>
+static infer_result<task::search> call_daal_kernel(const context_cpu &ctx,
+                                                   const descriptor_base<task::search> &desc,
+                                                   const table &data,
+                                                   model<task::search> m) {
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t neighbor_count = desc.get_neighbor_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull();
+    auto arr_indices = array<std::int32_t>::empty(row_count * neighbor_count);
+    auto arr_distances = array<Float>::empty(row_count * neighbor_count);
+
+    const auto daal_data =
+        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+    const auto daal_indices =
+        interop::convert_to_daal_homogen_table(arr_indices, row_count, neighbor_count);
+    const auto daal_distances =
+        interop::convert_to_daal_homogen_table(arr_distances, row_count, neighbor_count);
+
+    // No results to evaluate turns the voting off, the kernel writes the
+    // neighbors only
+    const std::int64_t dummy_class_count = 2;
+    const std::int64_t dummy_seed = 777;
+    const auto data_use_in_model = daal_knn::doNotUse;
+    const DAAL_UINT64 results_to_compute =
+        daal_knn::computeIndicesOfNeighbors | daal_knn::computeDistances;
+    const DAAL_UINT64 results_to_evaluate = 0;
+    daal_knn::Parameter daal_parameter(dummy_class_count,
+                                       neighbor_count,
+                                       dummy_seed,
+                                       data_use_in_model,
+                                       results_to_compute,
+                                       results_to_evaluate);
+
+    interop::status_to_exception(interop::call_daal_kernel<Float, daal_knn_kd_tree_kernel_t>(
+        ctx,
+        daal_data.get(),
+        dal::detail::get_impl<detail::model_impl>(m).get_interop()->get_daal_model().get(),
+        nullptr,
+        daal_indices.get(),
+        daal_distances.get(),
+        &daal_parameter));
+
+    return infer_result<task::search>()
+        .set_indices(dal::detail::homogen_table_builder{}
+                         .reset(arr_indices, row_count, neighbor_count)
+                         .build())
+        .set_distances(dal::detail::homogen_table_builder{}
+                           .reset(arr_distances, row_count, neighbor_count)
+                           .build());
+}
+
+template <typename Float>
+static infer_result<task::search> infer(const context_cpu &ctx,
+                                        const descriptor_base<task::search> &desc,
+                                        const infer_input<task::search> &input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_model());
+}
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::kd_tree, task::search> {
+    infer_result<task::search> operator()(const context_cpu &ctx,
+                                          const descriptor_base<task::search> &desc,
+                                          const infer_input<task::search> &input) const {
+        return infer<Float>(ctx, desc, input);
+    }
+};
+
+template struct infer_kernel_cpu<float, method::kd_tree, task::search>;
+template struct infer_kernel_cpu<double, method::kd_tree, task::search>;
+
+} // namespace oneapi::dal::knn::backend
@@ -0,0 +1,225 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+
+#include <daal/src/algorithms/k_nearest_neighbors/bf_knn_classification_ivf_kernel.h>
+#include <daal/src/algorithms/kmeans/kmeans_init_kernel.h>
+#include <daal/src/algorithms/kmeans/kmeans_lloyd_kernel.h>
+
+#include "oneapi/dal/algo/knn/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_knn = daal::algorithms::bf_knn_classification;
+namespace daal_kmeans = daal::algorithms::kmeans;
+namespace daal_kmeans_init = daal::algorithms::kmeans::init;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_knn_ivf_train_kernel_t = daal_knn::internal::IVFTrainKernel<Float, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_lloyd_dense_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_init_plus_plus_dense_kernel_t =
+    daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusDense, Float, Cpu>;
+
+/// The centroids are trained on at most this number of the rows per list,
+/// more rows barely move the centroids of the coarse quantizer
+constexpr int64_t max_sample_rows_per_list = 256;
+
+/// The coarse quantizer needs only a few Lloyd iterations, the lists are
+/// searched exactly anyway
+constexpr int64_t quantizer_iteration_count = 10;
+
+template <typename Float>
+static table train_centroids(const context_cpu& ctx,
+                             const array<Float>& arr_data,
+                             int64_t row_count,
+                             int64_t column_count,
+                             int64_t list_count) {
+    const int64_t sample_count = std::min(row_count, list_count * max_sample_rows_per_list);
+
+    // The sample takes the evenly spaced rows to cover the whole data
+    auto arr_sample = arr_data;
+    if (sample_count < row_count) {
+        arr_sample = array<Float>::empty(sample_count * column_count);
+        const Float* data_ptr = arr_data.get_data();
+        Float* sample_ptr = arr_sample.get_mutable_data();
+        for (int64_t i = 0; i < sample_count; i++) {
+            const int64_t row = i * row_count / sample_count;
+            std::copy(data_ptr + row * column_count,
+                      data_ptr + (row + 1) * column_count,
+                      sample_ptr + i * column_count);
+        }
+    }
+    const auto daal_sample =
+        interop::convert_to_daal_homogen_table(arr_sample, sample_count, column_count);
+
+    daal_kmeans_init::Parameter init_par(list_count);
+
+    const size_t init_len_input = 1;
+    daal::data_management::NumericTable* init_input[init_len_input] = { daal_sample.get() };
+
+    auto daal_initial_centroids =
+        interop::allocate_daal_homogen_table<Float>(list_count, column_count);
+    const size_t init_len_output = 1;
+    daal::data_management::NumericTable* init_output[init_len_output] = {
+        daal_initial_centroids.get()
+    };
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_kmeans_init_plus_plus_dense_kernel_t>(
+            ctx,
+            init_len_input,
+            init_input,
+            init_len_output,
+            init_output,
+            &init_par,
+            *(init_par.engine)));
+
+    daal_kmeans::Parameter par(list_count, quantizer_iteration_count);
+    par.resultsToEvaluate = daal_kmeans::computeCentroids;
+
+    array<Float> arr_centroids = array<Float>::empty(list_count * column_count);
+    array<Float> arr_objective_function_value = array<Float>::empty(1);
+    array<int> arr_iteration_count = array<int>::empty(1);
+
+    const auto daal_centroids =
+        interop::convert_to_daal_homogen_table(arr_centroids, list_count, column_count);
+    const auto daal_objective_function_value =
+        interop::convert_to_daal_homogen_table(arr_objective_function_value, 1, 1);
+    const auto daal_iteration_count =
+        interop::convert_to_daal_homogen_table(arr_iteration_count, 1, 1);
+
+    daal::data_management::NumericTable* input[2] = { daal_sample.get(),
+                                                      daal_initial_centroids.get() };
+
+    daal::data_management::NumericTable* output[4] = { daal_centroids.get(),
+                                                       nullptr,
+                                                       daal_objective_function_value.get(),
+                                                       daal_iteration_count.get() };
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
+                                                                           nullptr,
+                                                                           input,
+                                                                           output,
+                                                                           &par));
+
+    return dal::detail::homogen_table_builder{}
+        .reset(arr_centroids, list_count, column_count)
+        .build();
+}
+
+template <typename Float>
+static train_result<task::classification> call_daal_kernel(
+    const context_cpu& ctx,
+    const descriptor_base<task::classification>& desc,
+    const table& data,
+    const table& labels) {
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+
+    const int64_t list_count =
+        std::min(row_count,
+                 desc.get_list_count() > 0
+                     ? desc.get_list_count()
+                     : std::max<int64_t>(1, std::llround(std::sqrt(double(row_count)))));
+
+    auto arr_data = row_accessor<const Float>{ data }.pull();
+    auto arr_labels = row_accessor<const Float>{ labels }.pull();
+
+    const table centroids =
+        train_centroids<Float>(ctx, arr_data, row_count, column_count, list_count);
+    auto arr_centroids = row_accessor<const Float>{ centroids }.pull();
+
+    const auto daal_data =
+        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+    const auto daal_labels = interop::convert_to_daal_homogen_table(arr_labels, row_count, 1);
+    const auto daal_centroids =
+        interop::convert_to_daal_homogen_table(arr_centroids, list_count, column_count);
+
+    array<int> arr_list_offsets = array<int>::empty(list_count + 1);
+    array<Float> arr_index_data = array<Float>::empty(row_count * column_count);
+    array<Float> arr_index_labels = array<Float>::empty(row_count);
+
+    const auto daal_list_offsets =
+        interop::convert_to_daal_homogen_table(arr_list_offsets, list_count + 1, 1);
+    const auto daal_index_data =
+        interop::convert_to_daal_homogen_table(arr_index_data, row_count, column_count);
+    const auto daal_index_labels =
+        interop::convert_to_daal_homogen_table(arr_index_labels, row_count, 1);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_knn_ivf_train_kernel_t>(ctx,
+                                                                      daal_data.get(),
+                                                                      daal_labels.get(),
+                                                                      daal_centroids.get(),
+                                                                      daal_list_offsets.get(),
+                                                                      daal_index_data.get(),
+                                                                      daal_index_labels.get()));
+
+    ann_index index;
+    index.centroids = centroids;
+    index.list_offsets =
+        dal::detail::homogen_table_builder{}.reset(arr_list_offsets, list_count + 1, 1).build();
+    index.data = dal::detail::homogen_table_builder{}
+                     .reset(arr_index_data, row_count, column_count)
+                     .build();
+    index.labels =
+        dal::detail::homogen_table_builder{}.reset(arr_index_labels, row_count, 1).build();
+
+    const auto model_impl = std::make_shared<detail::model_impl>(index);
+    return train_result<task::classification>().set_model(
+        dal::detail::pimpl_accessor::make<model<task::classification>>(model_impl));
+}
+
+template <typename Float>
+static train_result<task::classification> train(const context_cpu& ctx,
+                                                const descriptor_base<task::classification>& desc,
+                                                const train_input<task::classification>& input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_labels());
+}
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::ann, task::classification> {
+    train_result<task::classification> operator()(
+        const context_cpu& ctx,
+        const descriptor_base<task::classification>& desc,
+        const train_input<task::classification>& input) const {
+        return train<Float>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_cpu<float, method::ann, task::classification>;
+template struct train_kernel_cpu<double, method::ann, task::classification>;
+
+} // namespace oneapi::dal::knn::backend
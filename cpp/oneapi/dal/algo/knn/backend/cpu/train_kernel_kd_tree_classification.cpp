@@ -71,12 +71,14 @@ static train_result<task::classification> call_daal_kernel(
     knn_model->impl()->setData<Float>(daal_data, copy_data_labels);
     knn_model->impl()->setLabels<Float>(daal_labels, copy_data_labels);
 
-    interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_knn_kd_tree_kernel_t>(ctx,
-                                                                    daal_data.get(),
-                                                                    daal_labels.get(),
-                                                                    knn_model,
-                                                                    *daal_parameter.engine.get()));
+    // The kernel rearranges the rows it is given into the order of the leaves,
+    // so it works on the copies in the model rather than on the input
+    interop::status_to_exception(interop::call_daal_kernel<Float, daal_knn_kd_tree_kernel_t>(
+        ctx,
+        knn_model->impl()->getData().get(),
+        knn_model->impl()->getLabels().get(),
+        knn_model,
+        *daal_parameter.engine.get()));
 
     auto interop = new daal_model_interop_t(model_ptr);
     const auto model_impl = std::make_shared<detail::model_impl>(interop);
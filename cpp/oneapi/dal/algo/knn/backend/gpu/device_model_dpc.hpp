@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_model_ucapi_impl.h>
+
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+namespace daal_bf_knn = daal::algorithms::bf_knn_classification;
+
+/// Copies the rows of the DAAL table into the device USM once, the table
+/// already resident on the device is shared as is
+template <typename T>
+inline daal::data_management::NumericTablePtr copy_to_device(
+    sycl::queue& queue,
+    const daal::data_management::NumericTablePtr& nt) {
+    namespace interop = dal::backend::interop;
+    using daal::data_management::internal::SyclHomogenNumericTable;
+    if (dynamic_cast<SyclHomogenNumericTable<T>*>(nt.get())) {
+        return nt;
+    }
+
+    const std::int64_t row_count = nt->getNumberOfRows();
+    const std::int64_t column_count = nt->getNumberOfColumns();
+    auto arr = array<T>::empty(queue, row_count * column_count, sycl::usm::alloc::device);
+
+    daal::data_management::BlockDescriptor<T> block;
+    interop::status_to_exception(
+        nt->getBlockOfRows(0, row_count, daal::data_management::readOnly, block));
+    dal::detail::memcpy(dal::detail::data_parallel_policy{ queue },
+                        arr.get_mutable_data(),
+                        block.getBlockPtr(),
+                        sizeof(T) * row_count * column_count);
+    interop::status_to_exception(nt->releaseBlockOfRows(block));
+
+    return interop::convert_to_daal_sycl_homogen_table(queue, arr, row_count, column_count);
+}
+
+/// Returns the brute-force model of the training data, and the labels if
+/// they are used, resident on the device of the queue. The labels are
+/// converted to the integers the voting reads, so the infer calls neither
+/// copy nor convert them
+template <typename Float>
+inline daal_cls::ModelPtr get_device_daal_model(sycl::queue& queue,
+                                                model_interop& interop,
+                                                bool with_labels) {
+    return interop.get_device_daal_model(
+        queue.get_context(),
+        [&](const daal_cls::ModelPtr& host_model) -> daal_cls::ModelPtr {
+            auto source = static_cast<daal_bf_knn::Model*>(host_model.get());
+            daal_cls::ModelPtr model_ptr(new daal_bf_knn::Model(source->getNumberOfFeatures()));
+            if (!model_ptr) {
+                throw host_bad_alloc();
+            }
+
+            auto device_model = static_cast<daal_bf_knn::Model*>(model_ptr.get());
+            const bool copy = false;
+            auto data = copy_to_device<Float>(queue, source->impl()->getData());
+            device_model->impl()->setData<Float>(data, copy);
+            if (with_labels && source->impl()->getLabels()) {
+                auto labels = copy_to_device<std::int32_t>(queue, source->impl()->getLabels());
+                device_model->impl()->setLabels<Float>(labels, copy);
+            }
+            return model_ptr;
+        });
+}
+
+} // namespace oneapi::dal::knn::backend
@@ -16,6 +16,7 @@
 
 #include <src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_predict_kernel_ucapi.h>
 
+#include "oneapi/dal/algo/knn/backend/gpu/device_model_dpc.hpp"
 #include "oneapi/dal/algo/knn/backend/gpu/infer_kernel.hpp"
 #include "oneapi/dal/algo/knn/backend/model_impl.hpp"
 #include "oneapi/dal/backend/interop/common_dpc.hpp"
@@ -60,9 +61,15 @@ static infer_result<task::classification> call_daal_kernel(
                                        desc.get_neighbor_count(),
                                        data_use_in_model);
 
+    // The training data and labels are copied to the device on the first call only
+    const auto device_model = get_device_daal_model<Float>(
+        queue,
+        *dal::detail::get_impl<detail::model_impl>(m).get_interop(),
+        true);
+
     interop::status_to_exception(daal_knn_brute_force_kernel_t<Float>().compute(
         daal_data.get(),
-        dal::detail::get_impl<detail::model_impl>(m).get_interop()->get_daal_model().get(),
+        device_model.get(),
         daal_labels.get(),
         &daal_parameter));
 
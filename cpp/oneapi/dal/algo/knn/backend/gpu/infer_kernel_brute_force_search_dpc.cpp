@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_predict_kernel_ucapi.h>
+
+#include "oneapi/dal/algo/knn/backend/gpu/device_model_dpc.hpp"
+#include "oneapi/dal/algo/knn/backend/gpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_gpu;
+
+namespace daal_knn = daal::algorithms::bf_knn_classification;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_knn_brute_force_kernel_t =
+    daal_knn::prediction::internal::KNNClassificationPredictKernelUCAPI<Float>;
+
+template <typename Float>
+static infer_result<task::search> call_daal_kernel(const context_gpu& ctx,
+                                                   const descriptor_base<task::search>& desc,
+                                                   const table& data,
+                                                   const model<task::search> m) {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t neighbor_count = desc.get_neighbor_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    auto arr_indices = array<std::int32_t>::empty(queue, row_count * neighbor_count);
+    auto arr_distances = array<Float>::empty(queue, row_count * neighbor_count);
+
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, column_count);
+    const auto daal_indices = interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                          arr_indices,
+                                                                          row_count,
+                                                                          neighbor_count);
+    const auto daal_distances = interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                            arr_distances,
+                                                                            row_count,
+                                                                            neighbor_count);
+
+    const std::int64_t dummy_class_count = 2;
+    const auto data_use_in_model = daal_knn::doNotUse;
+    daal_knn::Parameter daal_parameter(dummy_class_count, neighbor_count, data_use_in_model);
+
+    // The training data is copied to the device on the first call only
+    const auto device_model = get_device_daal_model<Float>(
+        queue,
+        *dal::detail::get_impl<detail::model_impl>(m).get_interop(),
+        false);
+
+    /* The null labels table skips the voting */
+    interop::status_to_exception(daal_knn_brute_force_kernel_t<Float>().compute(
+        daal_data.get(),
+        device_model.get(),
+        nullptr,
+        daal_indices.get(),
+        daal_distances.get(),
+        &daal_parameter));
+
+    return infer_result<task::search>()
+        .set_indices(dal::detail::homogen_table_builder{}
+                         .reset(arr_indices, row_count, neighbor_count)
+                         .build())
+        .set_distances(dal::detail::homogen_table_builder{}
+                           .reset(arr_distances, row_count, neighbor_count)
+                           .build());
+}
+
+template <typename Float>
+static infer_result<task::search> infer(const context_gpu& ctx,
+                                        const descriptor_base<task::search>& desc,
+                                        const infer_input<task::search>& input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_model());
+}
+
+template <typename Float>
+struct infer_kernel_gpu<Float, method::brute_force, task::search> {
+    infer_result<task::search> operator()(const context_gpu& ctx,
+                                          const descriptor_base<task::search>& desc,
+                                          const infer_input<task::search>& input) const {
+        return infer<Float>(ctx, desc, input);
+    }
+};
+
+template struct infer_kernel_gpu<float, method::brute_force, task::search>;
+template struct infer_kernel_gpu<double, method::brute_force, task::search>;
+
+} // namespace oneapi::dal::knn::backend
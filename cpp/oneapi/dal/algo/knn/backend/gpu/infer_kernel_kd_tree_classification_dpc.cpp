@@ -14,11 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <src/algorithms/k_nearest_neighbors/oneapi/kdtree_knn_classification_predict_kernel_ucapi.h>
+
 #include "oneapi/dal/algo/knn/backend/gpu/infer_kernel.hpp"
-#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
 #include "oneapi/dal/backend/interop/common_dpc.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
-#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
 
 #include "oneapi/dal/table/row_accessor.hpp"
 
@@ -26,13 +28,64 @@ namespace oneapi::dal::knn::backend {
 
 using dal::backend::context_gpu;
 
-template <typename Float, typename Task>
-struct infer_kernel_gpu<Float, method::kd_tree, Task> {
-    infer_result<Task> operator()(const context_gpu& ctx,
-                                  const descriptor_base<Task>& desc,
-                                  const infer_input<Task>& input) const {
-        throw unimplemented("k-NN k-d tree method is not implemented for GPU");
-        return infer_result<Task>();
+namespace daal_knn = daal::algorithms::kdtree_knn_classification;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_knn_kd_tree_kernel_t =
+    daal_knn::prediction::internal::KNNClassificationPredictKernelUCAPI<Float>;
+
+template <typename Float>
+static infer_result<task::classification> call_daal_kernel(
+    const context_gpu& ctx,
+    const descriptor_base<task::classification>& desc,
+    const table& data,
+    const model<task::classification> m) {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    auto arr_labels = array<Float>::empty(queue, 1 * row_count);
+
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, column_count);
+    const auto daal_labels =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_labels, row_count, 1);
+
+    const std::int64_t dummy_seed = 777;
+    const auto data_use_in_model = daal_knn::doNotUse;
+    daal_knn::Parameter daal_parameter(desc.get_class_count(),
+                                       desc.get_neighbor_count(),
+                                       dummy_seed,
+                                       data_use_in_model);
+
+    interop::status_to_exception(daal_knn_kd_tree_kernel_t<Float>().compute(
+        daal_data.get(),
+        dal::detail::get_impl<detail::model_impl>(m).get_interop()->get_daal_model().get(),
+        daal_labels.get(),
+        &daal_parameter));
+
+    return infer_result<task::classification>().set_labels(
+        dal::detail::homogen_table_builder{}.reset(arr_labels, row_count, 1).build());
+}
+
+template <typename Float>
+static infer_result<task::classification> infer(const context_gpu& ctx,
+                                                const descriptor_base<task::classification>& desc,
+                                                const infer_input<task::classification>& input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_model());
+}
+
+template <typename Float>
+struct infer_kernel_gpu<Float, method::kd_tree, task::classification> {
+    infer_result<task::classification> operator()(
+        const context_gpu& ctx,
+        const descriptor_base<task::classification>& desc,
+        const infer_input<task::classification>& input) const {
+        return infer<Float>(ctx, desc, input);
     }
 };
 
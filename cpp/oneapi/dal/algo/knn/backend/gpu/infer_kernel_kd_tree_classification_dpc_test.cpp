@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/knn/infer.hpp"
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+/// The values in [-1, 1), so the split values of the tree have both signs
+static std::vector<float> generate_values(std::int64_t count, std::uint32_t seed) {
+    std::vector<float> values(count);
+    for (auto& value : values) {
+        seed = seed * 1664525u + 1013904223u;
+        value = float(seed >> 8) / float(1 << 23) - 1.0f;
+    }
+    return values;
+}
+
+static table wrap_on_device(sycl::queue& queue,
+                            const std::vector<float>& host,
+                            std::int64_t row_count,
+                            std::int64_t column_count) {
+    auto data = sycl::malloc_shared<float>(host.size(), queue);
+    queue.memcpy(data, host.data(), sizeof(float) * host.size()).wait();
+    return homogen_table{ queue, data, row_count, column_count, [queue](const float* ptr) {
+                             sycl::free(const_cast<float*>(ptr), queue);
+                         } };
+}
+
+TEST(knn_kd_tree_classification_gpu, infer_results_match_brute_force) {
+    auto selector = sycl::gpu_selector();
+    auto queue = sycl::queue(selector);
+
+    constexpr std::int64_t row_count = 1000;
+    constexpr std::int64_t query_count = 200;
+    constexpr std::int64_t column_count = 3;
+    constexpr std::int64_t class_count = 4;
+    constexpr std::int64_t neighbor_count = 1;
+
+    const auto x_host = generate_values(row_count * column_count, 7);
+    const auto q_host = generate_values(query_count * column_count, 11);
+    std::vector<float> y_host(row_count);
+    for (std::int64_t i = 0; i < row_count; i++) {
+        y_host[i] = float(i % class_count);
+    }
+
+    const auto x_table = wrap_on_device(queue, x_host, row_count, column_count);
+    const auto y_table = wrap_on_device(queue, y_host, row_count, 1);
+    const auto q_table = wrap_on_device(queue, q_host, query_count, column_count);
+
+    const auto kd_tree_desc =
+        knn::descriptor<float, knn::method::kd_tree>(class_count, neighbor_count);
+    const auto brute_force_desc =
+        knn::descriptor<float, knn::method::brute_force>(class_count, neighbor_count);
+
+    const auto kd_tree_model = train(queue, kd_tree_desc, x_table, y_table).get_model();
+    const auto brute_force_model = train(queue, brute_force_desc, x_table, y_table).get_model();
+
+    const auto kd_tree_labels =
+        row_accessor<const float>(infer(queue, kd_tree_desc, q_table, kd_tree_model).get_labels())
+            .pull();
+    const auto brute_force_labels =
+        row_accessor<const float>(
+            infer(queue, brute_force_desc, q_table, brute_force_model).get_labels())
+            .pull();
+
+    ASSERT_EQ(kd_tree_labels.get_count(), query_count);
+    for (std::int64_t i = 0; i < query_count; i++) {
+        ASSERT_EQ(kd_tree_labels[i], brute_force_labels[i]);
+    }
+}
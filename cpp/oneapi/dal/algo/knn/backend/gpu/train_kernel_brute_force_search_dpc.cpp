@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_model_ucapi_impl.h>
+
+#include "oneapi/dal/algo/knn/backend/gpu/train_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_gpu;
+
+namespace daal_knn = daal::algorithms::bf_knn_classification;
+namespace interop = dal::backend::interop;
+
+/// The brute force method has nothing to train, the model keeps the copy of
+/// the rows the queries are compared with
+template <typename Float>
+static train_result<task::search> call_daal_kernel(const context_gpu& ctx,
+                                                   const descriptor_base<task::search>& desc,
+                                                   const table& data) {
+    using daal_model_interop_t = backend::model_interop;
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, column_count);
+
+    daal::algorithms::classifier::ModelPtr model_ptr(new daal_knn::Model(column_count));
+    if (!model_ptr) {
+        throw host_bad_alloc();
+    }
+
+    auto knn_model = static_cast<daal_knn::Model*>(model_ptr.get());
+    const bool copy_data = true;
+    interop::status_to_exception(knn_model->impl()->setData<Float>(daal_data, copy_data));
+
+    auto interop = new daal_model_interop_t(model_ptr);
+    const auto model_impl = std::make_shared<detail::model_impl>(interop);
+    return train_result<task::search>().set_model(
+        dal::detail::pimpl_accessor::make<model<task::search>>(model_impl));
+}
+
+template <typename Float>
+static train_result<task::search> train(const context_gpu& ctx,
+                                        const descriptor_base<task::search>& desc,
+                                        const train_input<task::search>& input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_data());
+}
+
+template <typename Float>
+struct train_kernel_gpu<Float, method::brute_force, task::search> {
+    train_result<task::search> operator()(const context_gpu& ctx,
+                                          const descriptor_base<task::search>& desc,
+                                          const train_input<task::search>& input) const {
+        return train<Float>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_gpu<float, method::brute_force, task::search>;
+template struct train_kernel_gpu<double, method::brute_force, task::search>;
+
+} // namespace oneapi::dal::knn::backend
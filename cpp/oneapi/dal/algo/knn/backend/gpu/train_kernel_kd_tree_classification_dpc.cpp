@@ -14,22 +14,89 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <src/algorithms/k_nearest_neighbors/kdtree_knn_classification_model_impl.h>
+#include <src/algorithms/k_nearest_neighbors/oneapi/kdtree_knn_classification_train_kernel_ucapi.h>
+
 #include "oneapi/dal/algo/knn/backend/gpu/train_kernel.hpp"
-#include "oneapi/dal/backend/dispatcher_dpc.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
 #include "oneapi/dal/backend/interop/common_dpc.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
 
 namespace oneapi::dal::knn::backend {
 
+using daal::services::Status;
 using dal::backend::context_gpu;
 
-template <typename Float, typename Task>
-struct train_kernel_gpu<Float, method::kd_tree, Task> {
-    train_result<Task> operator()(const context_gpu& ctx,
-                                  const descriptor_base<Task>& desc,
-                                  const train_input<Task>& input) const {
-        throw unimplemented("k-NN k-d tree method is not implemented for GPU");
-        return train_result<Task>();
+namespace daal_knn = daal::algorithms::kdtree_knn_classification;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_knn_kd_tree_kernel_t =
+    daal_knn::training::internal::KNNClassificationTrainKernelUCAPI<Float>;
+
+template <typename Float>
+static train_result<task::classification> call_daal_kernel(
+    const context_gpu& ctx,
+    const descriptor_base<task::classification>& desc,
+    const table& data,
+    const table& labels) {
+    using daal_model_interop_t = backend::model_interop;
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    auto arr_labels = row_accessor<const Float>{ labels }.pull(queue);
+
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, column_count);
+    const auto daal_labels =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_labels, row_count, 1);
+
+    const std::int64_t dummy_seed = 777;
+    const auto data_use_in_model = daal_knn::doNotUse;
+    daal_knn::Parameter daal_parameter(desc.get_class_count(),
+                                       desc.get_neighbor_count(),
+                                       dummy_seed,
+                                       data_use_in_model);
+
+    Status status;
+    const daal::algorithms::classifier::ModelPtr model_ptr =
+        daal_knn::Model::create(column_count, &status);
+    interop::status_to_exception(status);
+
+    /* The kernel stores the rows and the labels rearranged in the order of the tree leaves */
+    auto knn_model = static_cast<daal_knn::Model*>(model_ptr.get());
+    interop::status_to_exception(daal_knn_kd_tree_kernel_t<Float>().compute(daal_data.get(),
+                                                                            daal_labels.get(),
+                                                                            knn_model,
+                                                                            daal_parameter));
+
+    auto interop = new daal_model_interop_t(model_ptr);
+    const auto model_impl = std::make_shared<detail::model_impl>(interop);
+    return train_result<task::classification>().set_model(
+        dal::detail::pimpl_accessor::make<model<task::classification>>(model_impl));
+}
+
+template <typename Float>
+static train_result<task::classification> train(const context_gpu& ctx,
+                                                const descriptor_base<task::classification>& desc,
+                                                const train_input<task::classification>& input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_labels());
+}
+
+template <typename Float>
+struct train_kernel_gpu<Float, method::kd_tree, task::classification> {
+    train_result<task::classification> operator()(
+        const context_gpu& ctx,
+        const descriptor_base<task::classification>& desc,
+        const train_input<task::classification>& input) const {
+        return train<Float>(ctx, desc, input);
     }
 };
 
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "oneapi/dal/algo/knn/common.hpp"
+#include "oneapi/dal/algo/knn/backend/ann_index.hpp"
 #include "oneapi/dal/algo/knn/backend/model_interop.hpp"
 
 namespace oneapi::dal::knn::detail {
@@ -25,13 +26,18 @@ class model_impl : public base {
 public:
     model_impl() : interop_(nullptr) {}
     model_impl(knn::backend::model_interop* interop) : interop_(interop) {}
+    model_impl(const knn::backend::ann_index& index) : interop_(nullptr), index_(index) {}
     ~model_impl();
     knn::backend::model_interop* get_interop() {
         return interop_;
     }
+    const knn::backend::ann_index& get_ann_index() const {
+        return index_;
+    }
 
 private:
     knn::backend::model_interop* interop_;
+    knn::backend::ann_index index_;
 };
 
 } // namespace oneapi::dal::knn::detail
@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <mutex>
+#include <optional>
+
 #include "algorithms/classifier/classifier_model.h"
 #include "oneapi/dal/algo/knn/common.hpp"
+#include "oneapi/dal/detail/common_dpc.hpp"
 
 namespace oneapi::dal::knn::backend {
 
@@ -27,14 +31,41 @@ class model_interop {
 public:
     model_interop(const daal_cls::ModelPtr& daal_model) : daal_model(daal_model) {}
     void set_daal_model(const daal_cls::ModelPtr& model) {
+        std::lock_guard<std::mutex> lock(device_mutex);
         daal_model = model;
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+        device_daal_model.reset();
+        device_context.reset();
+#endif
     }
     daal_cls::ModelPtr get_daal_model() {
         return daal_model;
     }
 
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    /// Returns the model of the training data and labels resident on the
+    /// device of the context. It is built by make_model(get_daal_model()) on
+    /// the first call for the context and reused by the next infer calls, so
+    /// they transfer only the queries to the device
+    template <typename MakeModel>
+    daal_cls::ModelPtr get_device_daal_model(const sycl::context& context,
+                                             MakeModel&& make_model) {
+        std::lock_guard<std::mutex> lock(device_mutex);
+        if (!device_daal_model || !device_context || *device_context != context) {
+            device_daal_model = make_model(daal_model);
+            device_context = context;
+        }
+        return device_daal_model;
+    }
+#endif
+
 private:
     daal_cls::ModelPtr daal_model;
+    std::mutex device_mutex;
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    daal_cls::ModelPtr device_daal_model;
+    std::optional<sycl::context> device_context;
+#endif
 };
 
 } // namespace oneapi::dal::knn::backend
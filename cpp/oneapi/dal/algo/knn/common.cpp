@@ -16,15 +16,19 @@
 
 #include "oneapi/dal/algo/knn/common.hpp"
 #include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/backend/interop/serialization.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/detail/table_serialization.hpp"
 
 namespace oneapi::dal::knn {
 
-template <>
-class detail::descriptor_impl<task::classification> : public base {
+template <typename Task>
+class detail::descriptor_impl : public base {
 public:
     std::int64_t class_count = 2;
     std::int64_t neighbor_count = 1;
+    std::int64_t list_count = 0;
+    std::int64_t probe_count = 8;
 };
 
 using detail::descriptor_impl;
@@ -33,32 +37,58 @@ using detail::model_impl;
 template <typename Task>
 descriptor_base<Task>::descriptor_base() : impl_(new descriptor_impl<Task>{}) {}
 
-template <>
-std::int64_t descriptor_base<task::classification>::get_class_count() const {
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_class_count_impl() const {
     return impl_->class_count;
 }
 
-template <>
-std::int64_t descriptor_base<task::classification>::get_neighbor_count() const {
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_neighbor_count() const {
     return impl_->neighbor_count;
 }
 
-template <>
-void descriptor_base<task::classification>::set_class_count_impl(std::int64_t value) {
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_list_count() const {
+    return impl_->list_count;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_probe_count() const {
+    return impl_->probe_count;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_class_count_impl(std::int64_t value) {
     if (value < 2) {
         throw domain_error("class_count should be > 1");
     }
     impl_->class_count = value;
 }
 
-template <>
-void descriptor_base<task::classification>::set_neighbor_count_impl(std::int64_t value) {
+template <typename Task>
+void descriptor_base<Task>::set_neighbor_count_impl(std::int64_t value) {
     if (value < 1) {
         throw domain_error("neighbor_count should be > 0");
     }
     impl_->neighbor_count = value;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_list_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw domain_error("list_count should be >= 0");
+    }
+    impl_->list_count = value;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_probe_count_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error("probe_count should be > 0");
+    }
+    impl_->probe_count = value;
+}
+
 class empty_model_impl : public detail::model_impl {};
 
 template <typename Task>
@@ -67,7 +97,62 @@ model<Task>::model() : impl_(new empty_model_impl{}) {}
 template <typename Task>
 model<Task>::model(const std::shared_ptr<detail::model_impl>& impl) : impl_(impl) {}
 
+template <typename Task>
+constexpr dal::detail::serialization_id model_serialization_id =
+    std::is_same_v<Task, task::search> ? dal::detail::serialization_id::knn_search_model
+                                       : dal::detail::serialization_id::knn_classification_model;
+
+/// The kinds of the serialized models, the empty model is not trained
+enum class serialized_model_kind : std::uint32_t { empty, interop, ann_index };
+
+template <typename Task>
+void model<Task>::serialize(dal::detail::binary_output_archive& ar) const {
+    ar.write(model_serialization_id<Task>);
+    if (auto interop = impl_->get_interop()) {
+        ar.write(serialized_model_kind::interop);
+        dal::backend::interop::serialize_daal_object(*interop->get_daal_model(), ar);
+    }
+    else if (impl_->get_ann_index().centroids.has_data()) {
+        const auto& index = impl_->get_ann_index();
+        ar.write(serialized_model_kind::ann_index);
+        dal::detail::serialize_table(index.centroids, ar);
+        dal::detail::serialize_table(index.list_offsets, ar);
+        dal::detail::serialize_table(index.data, ar);
+        dal::detail::serialize_table(index.labels, ar);
+    }
+    else {
+        ar.write(serialized_model_kind::empty);
+    }
+}
+
+template <typename Task>
+void model<Task>::deserialize(dal::detail::binary_input_archive& ar) {
+    ar.expect(model_serialization_id<Task>);
+    switch (ar.read<serialized_model_kind>()) {
+        case serialized_model_kind::empty: impl_.reset(new empty_model_impl{}); break;
+        case serialized_model_kind::interop: {
+            using daal_model_t = daal::algorithms::classifier::Model;
+            const auto daal_model =
+                dal::backend::interop::deserialize_daal_object<daal_model_t>(ar);
+            impl_.reset(new model_impl{ new backend::model_interop{ daal_model } });
+            break;
+        }
+        case serialized_model_kind::ann_index: {
+            backend::ann_index index;
+            index.centroids = dal::detail::deserialize_table(ar);
+            index.list_offsets = dal::detail::deserialize_table(ar);
+            index.data = dal::detail::deserialize_table(ar);
+            index.labels = dal::detail::deserialize_table(ar);
+            impl_.reset(new model_impl{ index });
+            break;
+        }
+        default: throw invalid_argument("Corrupted data of the serialized object");
+    }
+}
+
 template class ONEAPI_DAL_EXPORT descriptor_base<task::classification>;
+template class ONEAPI_DAL_EXPORT descriptor_base<task::search>;
 template class ONEAPI_DAL_EXPORT model<task::classification>;
+template class ONEAPI_DAL_EXPORT model<task::search>;
 
 } // namespace oneapi::dal::knn
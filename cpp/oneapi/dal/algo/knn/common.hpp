@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/detail/archives.hpp"
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/table/common.hpp"
 
@@ -23,6 +24,9 @@ namespace oneapi::dal::knn {
 
 namespace task {
 struct classification {};
+/// Finds the neighbors of the queries and returns their indices and distances
+/// without the labels and the voting
+struct search {};
 using by_default = classification;
 } // namespace task
 
@@ -38,6 +42,10 @@ class model_impl;
 namespace method {
 struct kd_tree {};
 struct brute_force {};
+/// Approximate search in the inverted file index: the training rows are
+/// grouped into the lists of their closest k-means centroids, and every query
+/// is compared with the rows of the probe_count lists of its closest centroids
+struct ann {};
 using by_default = brute_force;
 } // namespace method
 
@@ -48,15 +56,35 @@ public:
     using float_t = float;
     using method_t = method::by_default;
     using task_t = Task;
+    template <typename T>
+    using is_classification_t =
+        std::enable_if_t<std::is_same_v<T, std::decay_t<task::classification>>>;
 
     descriptor_base();
 
-    std::int64_t get_class_count() const;
+    /* classification specific methods */
+    template <typename T = Task, typename = is_classification_t<T>>
+    std::int64_t get_class_count() const {
+        return get_class_count_impl();
+    }
+
     std::int64_t get_neighbor_count() const;
 
+    /// The number of the lists of the ann method, 0 selects the square root of
+    /// the number of the training rows
+    std::int64_t get_list_count() const;
+
+    /// The number of the lists searched for every query by the ann method,
+    /// larger values trade the speed for the recall
+    std::int64_t get_probe_count() const;
+
 protected:
+    std::int64_t get_class_count_impl() const;
+
     void set_class_count_impl(std::int64_t value);
     void set_neighbor_count_impl(std::int64_t value);
+    void set_list_count_impl(std::int64_t value);
+    void set_probe_count_impl(std::int64_t value);
 
     dal::detail::pimpl<detail::descriptor_impl<task_t>> impl_;
 };
@@ -71,11 +99,25 @@ public:
     using method_t = Method;
     using task_t = Task;
 
+    template <typename T>
+    using is_classification_t =
+        std::enable_if_t<std::is_same_v<T, std::decay_t<task::classification>>>;
+    template <typename T>
+    using is_search_t = std::enable_if_t<std::is_same_v<T, std::decay_t<task::search>>>;
+
+    template <typename T = Task, typename = is_classification_t<T>>
     explicit descriptor(std::int64_t class_count, std::int64_t neighbor_count) {
         set_class_count(class_count);
         set_neighbor_count(neighbor_count);
     }
 
+    template <typename T = Task, typename = is_search_t<T>>
+    explicit descriptor(std::int64_t neighbor_count) {
+        set_neighbor_count(neighbor_count);
+    }
+
+    /* classification specific methods */
+    template <typename T = Task, typename = is_classification_t<T>>
     auto& set_class_count(std::int64_t value) {
         descriptor_base<task_t>::set_class_count_impl(value);
         return *this;
@@ -85,6 +127,16 @@ public:
         descriptor_base<task_t>::set_neighbor_count_impl(value);
         return *this;
     }
+
+    auto& set_list_count(std::int64_t value) {
+        descriptor_base<task_t>::set_list_count_impl(value);
+        return *this;
+    }
+
+    auto& set_probe_count(std::int64_t value) {
+        descriptor_base<task_t>::set_probe_count_impl(value);
+        return *this;
+    }
 };
 
 template <typename Task = task::by_default>
@@ -96,6 +148,11 @@ public:
 
 private:
     explicit model(const std::shared_ptr<detail::model_impl>& impl);
+
+    friend dal::detail::serialization_accessor;
+    void serialize(dal::detail::binary_output_archive& ar) const;
+    void deserialize(dal::detail::binary_input_archive& ar);
+
     dal::detail::pimpl<detail::model_impl> impl_;
 };
 
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/knn/infer.hpp"
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/serialization.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+using kd_tree_search_descriptor_t =
+    knn::descriptor<double, knn::method::kd_tree, knn::task::search>;
+
+TEST(knn_serialization, restored_kd_tree_model_finds_same_neighbors) {
+    constexpr std::int64_t row_count = 9;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t neighbor_count = 3;
+    constexpr std::int64_t query_count = 3;
+
+    static const double data[] = { 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 5.0, 5.0, 2.0,
+                                   2.0, 6.0, 5.0, 0.5, 0.5, 9.0, 9.0, 1.0, 1.5 };
+    static const double queries[] = { 0.0, 0.2, 5.4, 5.0, 8.0, 8.0 };
+
+    const auto desc = kd_tree_search_descriptor_t(neighbor_count);
+    const auto query_table = homogen_table::wrap(queries, query_count, column_count);
+    const auto model = train(desc, homogen_table::wrap(data, row_count, column_count)).get_model();
+
+    knn::model<knn::task::search> restored;
+    deserialize(serialize(model), restored);
+
+    // The tree keeps the rows rearranged, the restored model maps them back
+    // to the original indices
+    const auto expected = infer(desc, query_table, model);
+    const auto actual = infer(desc, query_table, restored);
+    const auto expected_indices = row_accessor<const std::int32_t>(expected.get_indices()).pull();
+    const auto actual_indices = row_accessor<const std::int32_t>(actual.get_indices()).pull();
+    const auto expected_distances = row_accessor<const double>(expected.get_distances()).pull();
+    const auto actual_distances = row_accessor<const double>(actual.get_distances()).pull();
+    ASSERT_EQ(actual_indices.get_count(), query_count * neighbor_count);
+    for (std::int64_t i = 0; i < query_count * neighbor_count; i++) {
+        ASSERT_EQ(actual_indices[i], expected_indices[i]);
+        ASSERT_DOUBLE_EQ(actual_distances[i], expected_distances[i]);
+    }
+
+    // The nearest neighbor of the first query is the row (0, 0)
+    ASSERT_EQ(actual_indices[0], 0);
+}
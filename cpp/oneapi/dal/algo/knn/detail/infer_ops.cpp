@@ -17,9 +17,11 @@
 #include "oneapi/dal/algo/knn/detail/infer_ops.hpp"
 #include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
 
 namespace oneapi::dal::knn::detail {
 using oneapi::dal::detail::host_policy;
+using oneapi::dal::detail::spmd_policy;
 
 template <typename Float, typename Method, typename Task>
 struct infer_ops_dispatcher<host_policy, Float, Method, Task> {
@@ -32,12 +34,38 @@ struct infer_ops_dispatcher<host_policy, Float, Method, Task> {
     }
 };
 
-#define INSTANTIATE(F, M, T) \
-    template struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<host_policy, F, M, T>;
+/// The brute force search is distributed over the processes, the other
+/// methods and the classification are not supported by the SPMD policy
+template <typename Float, typename Method, typename Task>
+struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<spmd_policy<host_policy>, Float, Method, Task> {
+    infer_result<Task> operator()(const spmd_policy<host_policy>& ctx,
+                                  const descriptor_base<Task>& desc,
+                                  const infer_input<Task>& input) const {
+        if constexpr (std::is_same_v<Method, method::brute_force> &&
+                      std::is_same_v<Task, task::search>) {
+            using kernel_dispatcher_t = dal::backend::kernel_dispatcher<
+                backend::spmd_infer_kernel_cpu<Float, Method, Task>>;
+            return kernel_dispatcher_t()(ctx.get_local(), ctx.get_communicator(), desc, input);
+        }
+        else {
+            throw unimplemented("Only the brute force search is supported by the SPMD policy");
+        }
+    }
+};
+
+#define INSTANTIATE(F, M, T)                                                      \
+    template struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<host_policy, F, M, T>; \
+    template struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<spmd_policy<host_policy>, F, M, T>;
 
 INSTANTIATE(float, method::kd_tree, task::classification)
 INSTANTIATE(double, method::kd_tree, task::classification)
 INSTANTIATE(float, method::brute_force, task::classification)
 INSTANTIATE(double, method::brute_force, task::classification)
+INSTANTIATE(float, method::kd_tree, task::search)
+INSTANTIATE(double, method::kd_tree, task::search)
+INSTANTIATE(float, method::brute_force, task::search)
+INSTANTIATE(double, method::brute_force, task::search)
+INSTANTIATE(float, method::ann, task::classification)
+INSTANTIATE(double, method::ann, task::classification)
 
 } // namespace oneapi::dal::knn::detail
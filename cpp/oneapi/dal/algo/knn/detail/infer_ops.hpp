@@ -49,11 +49,28 @@ struct infer_ops {
     void check_postconditions(const Descriptor& params,
                               const input_t& input,
                               const result_t& result) const {
-        if (result.get_labels().get_column_count() != 1) {
-            throw internal_error("Result labels column_count should contain a single column");
+        const std::int64_t row_count = input.get_data().get_row_count();
+        if constexpr (std::is_same_v<task_t, task::search>) {
+            const std::int64_t neighbor_count = params.get_neighbor_count();
+            if (result.get_indices().get_row_count() != row_count ||
+                result.get_indices().get_column_count() != neighbor_count) {
+                throw internal_error(
+                    "Result indices should be row_count x neighbor_count table");
+            }
+            if (result.get_distances().get_row_count() != row_count ||
+                result.get_distances().get_column_count() != neighbor_count) {
+                throw internal_error(
+                    "Result distances should be row_count x neighbor_count table");
+            }
         }
-        if (result.get_labels().get_row_count() != input.get_data().get_row_count()) {
-            throw internal_error("Number of labels in result should match number of rows in input");
+        else {
+            if (result.get_labels().get_column_count() != 1) {
+                throw internal_error("Result labels column_count should contain a single column");
+            }
+            if (result.get_labels().get_row_count() != row_count) {
+                throw internal_error(
+                    "Number of labels in result should match number of rows in input");
+            }
         }
     }
 
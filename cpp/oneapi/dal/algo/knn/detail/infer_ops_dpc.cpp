@@ -18,6 +18,7 @@
 #include "oneapi/dal/algo/knn/backend/gpu/infer_kernel.hpp"
 #include "oneapi/dal/algo/knn/detail/infer_ops.hpp"
 #include "oneapi/dal/backend/dispatcher_dpc.hpp"
+#include "oneapi/dal/backend/multi_device_dpc.hpp"
 
 namespace oneapi::dal::knn::detail {
 using oneapi::dal::detail::data_parallel_policy;
@@ -26,11 +27,67 @@ struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<data_parallel_policy, Float, Metho
     infer_result<Task> operator()(const data_parallel_policy& ctx,
                                   const descriptor_base<Task>& params,
                                   const infer_input<Task>& input) const {
+        if constexpr (std::is_same_v<Method, method::brute_force>) {
+            const auto& data = input.get_data();
+            const std::int64_t shard_count =
+                dal::backend::get_shard_count(ctx, data.get_row_count());
+            if (shard_count > 1) {
+                return infer_on_devices(ctx, params, input, shard_count);
+            }
+        }
+        return infer_on_device(ctx, params, input);
+    }
+
+private:
+    infer_result<Task> infer_on_device(const data_parallel_policy& ctx,
+                                       const descriptor_base<Task>& params,
+                                       const infer_input<Task>& input) const {
         using kernel_dispatcher_t =
             dal::backend::kernel_dispatcher<backend::infer_kernel_cpu<Float, Method, Task>,
                                             backend::infer_kernel_gpu<Float, Method, Task>>;
         return kernel_dispatcher_t{}(ctx, params, input);
     }
+
+    /// The queries are split between the devices, every device searches
+    /// the whole training set for its queries
+    infer_result<Task> infer_on_devices(const data_parallel_policy& ctx,
+                                        const descriptor_base<Task>& params,
+                                        const infer_input<Task>& input,
+                                        std::int64_t shard_count) const {
+        const auto& data = input.get_data();
+        const auto shards = dal::backend::split_rows(data.get_row_count(), shard_count);
+
+        std::vector<infer_result<Task>> results(shard_count);
+        dal::backend::for_each_shard(
+            ctx,
+            shard_count,
+            [&](std::int64_t i, const data_parallel_policy& device_ctx) {
+                const auto shard_data =
+                    dal::backend::pull_rows<Float>(device_ctx.get_queue(), data, shards[i]);
+                const infer_input<Task> shard_input{ shard_data, input.get_model() };
+                results[i] = infer_on_device(device_ctx, params, shard_input);
+            });
+
+        if constexpr (std::is_same_v<Task, task::search>) {
+            std::vector<table> indices(shard_count);
+            std::vector<table> distances(shard_count);
+            for (std::int64_t i = 0; i < shard_count; i++) {
+                indices[i] = results[i].get_indices();
+                distances[i] = results[i].get_distances();
+            }
+            return infer_result<Task>{}
+                .set_indices(dal::backend::concat_rows<std::int32_t>(ctx.get_queue(), indices))
+                .set_distances(dal::backend::concat_rows<Float>(ctx.get_queue(), distances));
+        }
+        else {
+            std::vector<table> labels(shard_count);
+            for (std::int64_t i = 0; i < shard_count; i++) {
+                labels[i] = results[i].get_labels();
+            }
+            return infer_result<Task>{}.set_labels(
+                dal::backend::concat_rows<Float>(ctx.get_queue(), labels));
+        }
+    }
 };
 
 #define INSTANTIATE(F, M, T) \
@@ -40,5 +97,11 @@ INSTANTIATE(float, method::kd_tree, task::classification)
 INSTANTIATE(double, method::kd_tree, task::classification)
 INSTANTIATE(float, method::brute_force, task::classification)
 INSTANTIATE(double, method::brute_force, task::classification)
+INSTANTIATE(float, method::kd_tree, task::search)
+INSTANTIATE(double, method::kd_tree, task::search)
+INSTANTIATE(float, method::brute_force, task::search)
+INSTANTIATE(double, method::brute_force, task::search)
+INSTANTIATE(float, method::ann, task::classification)
+INSTANTIATE(double, method::ann, task::classification)
 
 } // namespace oneapi::dal::knn::detail
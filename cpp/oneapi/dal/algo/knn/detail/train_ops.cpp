@@ -39,5 +39,11 @@ INSTANTIATE(float, method::kd_tree, task::classification)
 INSTANTIATE(double, method::kd_tree, task::classification)
 INSTANTIATE(float, method::brute_force, task::classification)
 INSTANTIATE(double, method::brute_force, task::classification)
+INSTANTIATE(float, method::kd_tree, task::search)
+INSTANTIATE(double, method::kd_tree, task::search)
+INSTANTIATE(float, method::brute_force, task::search)
+INSTANTIATE(double, method::brute_force, task::search)
+INSTANTIATE(float, method::ann, task::classification)
+INSTANTIATE(double, method::ann, task::classification)
 
 } // namespace oneapi::dal::knn::detail
@@ -44,14 +44,16 @@ struct train_ops {
         if (!(input.get_data().has_data())) {
             throw domain_error("Input data should not be empty");
         }
-        if (!(input.get_labels().has_data())) {
-            throw domain_error("Input labels should not be empty");
-        }
-        if (input.get_labels().get_column_count() != 1) {
-            throw domain_error("Labels should contain a single column");
-        }
-        if (!(input.get_labels().get_row_count() == input.get_data().get_row_count())) {
-            throw domain_error("Number of labels should match number of rows in data");
+        if constexpr (std::is_same_v<task_t, task::classification>) {
+            if (!(input.get_labels().has_data())) {
+                throw domain_error("Input labels should not be empty");
+            }
+            if (input.get_labels().get_column_count() != 1) {
+                throw domain_error("Labels should contain a single column");
+            }
+            if (!(input.get_labels().get_row_count() == input.get_data().get_row_count())) {
+                throw domain_error("Number of labels should match number of rows in data");
+            }
         }
     }
 
@@ -33,6 +33,8 @@ template <typename Task>
 class infer_result_impl : public base {
 public:
     table labels;
+    table indices;
+    table distances;
 };
 } // namespace detail
 
@@ -64,7 +66,7 @@ void infer_input<Task>::set_model_impl(const model<Task>& value) {
 }
 
 template <typename Task>
-infer_result<Task>::infer_result() : impl_(new infer_result_impl{}) {}
+infer_result<Task>::infer_result() : impl_(new infer_result_impl<Task>{}) {}
 
 template <typename Task>
 const table& infer_result<Task>::get_labels() const {
@@ -76,7 +78,29 @@ void infer_result<Task>::set_labels_impl(const table& value) {
     impl_->labels = value;
 }
 
+template <typename Task>
+const table& infer_result<Task>::get_indices_impl() const {
+    return impl_->indices;
+}
+
+template <typename Task>
+void infer_result<Task>::set_indices_impl(const table& value) {
+    impl_->indices = value;
+}
+
+template <typename Task>
+const table& infer_result<Task>::get_distances_impl() const {
+    return impl_->distances;
+}
+
+template <typename Task>
+void infer_result<Task>::set_distances_impl(const table& value) {
+    impl_->distances = value;
+}
+
 template class ONEAPI_DAL_EXPORT infer_input<task::classification>;
 template class ONEAPI_DAL_EXPORT infer_result<task::classification>;
+template class ONEAPI_DAL_EXPORT infer_input<task::search>;
+template class ONEAPI_DAL_EXPORT infer_result<task::search>;
 
 } // namespace oneapi::dal::knn
@@ -56,6 +56,9 @@ private:
 template <typename Task = task::by_default>
 class ONEAPI_DAL_EXPORT infer_result {
 public:
+    template <typename T>
+    using is_search_t = std::enable_if_t<std::is_same_v<T, std::decay_t<task::search>>>;
+
     infer_result();
 
     const table& get_labels() const;
@@ -65,9 +68,41 @@ public:
         return *this;
     }
 
+    /* search specific methods */
+
+    /// The row_count x neighbor_count table of the indices of the neighbors in
+    /// the training data, the closest neighbor goes first
+    template <typename T = Task, typename = is_search_t<T>>
+    const table& get_indices() const {
+        return get_indices_impl();
+    }
+
+    /// The row_count x neighbor_count table of the Euclidean distances to the
+    /// neighbors in the order of the indices
+    template <typename T = Task, typename = is_search_t<T>>
+    const table& get_distances() const {
+        return get_distances_impl();
+    }
+
+    template <typename T = Task, typename = is_search_t<T>>
+    auto& set_indices(const table& value) {
+        set_indices_impl(value);
+        return *this;
+    }
+
+    template <typename T = Task, typename = is_search_t<T>>
+    auto& set_distances(const table& value) {
+        set_distances_impl(value);
+        return *this;
+    }
+
 private:
     void set_labels_impl(const table&);
     const table& get_labels_impl() const;
+    void set_indices_impl(const table&);
+    const table& get_indices_impl() const;
+    void set_distances_impl(const table&);
+    const table& get_distances_impl() const;
     dal::detail::pimpl<detail::infer_result_impl<Task>> impl_;
 };
 
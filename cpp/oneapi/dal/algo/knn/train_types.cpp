@@ -64,7 +64,7 @@ void train_input<Task>::set_labels_impl(const table& value) {
 }
 
 template <typename Task>
-train_result<Task>::train_result() : impl_(new train_result_impl{}) {}
+train_result<Task>::train_result() : impl_(new train_result_impl<Task>{}) {}
 
 template <typename Task>
 const model<Task>& train_result<Task>::get_model() const {
@@ -78,5 +78,7 @@ void train_result<Task>::set_model_impl(const model<Task>& value) {
 
 template class ONEAPI_DAL_EXPORT train_input<task::classification>;
 template class ONEAPI_DAL_EXPORT train_result<task::classification>;
+template class ONEAPI_DAL_EXPORT train_input<task::search>;
+template class ONEAPI_DAL_EXPORT train_result<task::search>;
 
 } // namespace oneapi::dal::knn
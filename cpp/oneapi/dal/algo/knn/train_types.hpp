@@ -31,8 +31,15 @@ class train_result_impl;
 template <typename Task = task::by_default>
 class ONEAPI_DAL_EXPORT train_input : public base {
 public:
+    template <typename T>
+    using is_search_t = std::enable_if_t<std::is_same_v<T, std::decay_t<task::search>>>;
+
     train_input(const table& data, const table& labels);
 
+    /// The search task keeps the training data only, there are no labels
+    template <typename T = Task, typename = is_search_t<T>>
+    train_input(const table& data) : train_input(data, table{}) {}
+
     const table& get_data() const;
     const table& get_labels() const;
 
@@ -14,16 +14,65 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <daal/src/algorithms/kernel_function/kernel_function_linear_csr_fast_kernel.h>
+
 #include "oneapi/dal/algo/linear_kernel/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
 
 namespace oneapi::dal::linear_kernel::backend {
 
+using dal::backend::context_cpu;
+
+namespace daal_linear_kernel = daal::algorithms::kernel_function::linear;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_linear_kernel_t =
+    daal_linear_kernel::internal::KernelImplLinear<daal_linear_kernel::fastCSR, Float, Cpu>;
+
+template <typename Float>
+static compute_result call_daal_kernel(const context_cpu& ctx,
+                                       const descriptor_base& desc,
+                                       const table& x,
+                                       const table& y) {
+    const int64_t row_count_x = x.get_row_count();
+    const int64_t row_count_y = y.get_row_count();
+
+    auto arr_values = array<Float>::empty(row_count_x * row_count_y);
+
+    const auto daal_x = interop::convert_to_daal_csr_table<Float>(x);
+    const auto daal_y = interop::convert_to_daal_csr_table<Float>(y);
+    const auto daal_values =
+        interop::convert_to_daal_homogen_table(arr_values, row_count_x, row_count_y);
+
+    daal_linear_kernel::Parameter daal_parameter(desc.get_scale(), desc.get_shift());
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_linear_kernel_t>(ctx,
+                                                               daal_x.get(),
+                                                               daal_y.get(),
+                                                               daal_values.get(),
+                                                               &daal_parameter));
+
+    return compute_result().set_values(
+        dal::detail::homogen_table_builder{}.reset(arr_values, row_count_x, row_count_y).build());
+}
+
+template <typename Float>
+static compute_result compute(const context_cpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_x(), input.get_y());
+}
+
 template <typename Float>
 struct compute_kernel_cpu<Float, method::csr> {
-    compute_result operator()(const dal::backend::context_cpu& ctx,
+    compute_result operator()(const context_cpu& ctx,
                               const descriptor_base& desc,
                               const compute_input& input) const {
-        return compute_result();
+        return compute<Float>(ctx, desc, input);
     }
 };
 
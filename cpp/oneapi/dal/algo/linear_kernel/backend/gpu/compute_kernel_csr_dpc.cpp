@@ -15,15 +15,59 @@
 *******************************************************************************/
 
 #include "oneapi/dal/algo/linear_kernel/backend/gpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/csr_kernels_dpc.hpp"
 
 namespace oneapi::dal::linear_kernel::backend {
 
+using dal::backend::context_gpu;
+using dal::backend::csr_device_data;
+
+template <typename Float>
+struct linear_op {
+    Float operator()(Float dot, int64_t, int64_t) const {
+        return scale * dot + shift;
+    }
+
+    Float scale;
+    Float shift;
+};
+
+template <typename Float>
+static compute_result compute(const context_gpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) {
+    auto& queue = ctx.get_queue();
+    const table& x = input.get_x();
+    const table& y = input.get_y();
+
+    const int64_t row_count_x = x.get_row_count();
+    const int64_t row_count_y = y.get_row_count();
+
+    const csr_device_data<Float> x_data{ queue, x };
+    const csr_device_data<Float> y_data{ queue, y };
+
+    auto arr_values = array<Float>::empty(queue, row_count_x * row_count_y);
+
+    const linear_op<Float> op{ static_cast<Float>(desc.get_scale()),
+                               static_cast<Float>(desc.get_shift()) };
+    dal::backend::compute_csr_gram(queue,
+                                   x_data,
+                                   y_data,
+                                   row_count_x,
+                                   row_count_y,
+                                   arr_values.get_mutable_data(),
+                                   op);
+
+    return compute_result().set_values(
+        dal::detail::homogen_table_builder{}.reset(arr_values, row_count_x, row_count_y).build());
+}
+
 template <typename Float>
 struct compute_kernel_gpu<Float, method::csr> {
-    compute_result operator()(const dal::backend::context_gpu& ctx,
-                              const descriptor_base& params,
+    compute_result operator()(const context_gpu& ctx,
+                              const descriptor_base& desc,
                               const compute_input& input) const {
-        return compute_result();
+        return compute<Float>(ctx, desc, input);
     }
 };
 
@@ -19,6 +19,7 @@
 #include "oneapi/dal/algo/linear_kernel/compute_types.hpp"
 #include "oneapi/dal/algo/linear_kernel/detail/compute_ops.hpp"
 #include "oneapi/dal/compute.hpp"
+#include "oneapi/dal/detail/compute_by_tiles.hpp"
 
 namespace oneapi::dal::detail {
 
@@ -27,3 +28,36 @@ struct compute_ops<Descriptor, dal::linear_kernel::detail::tag>
         : dal::linear_kernel::detail::compute_ops<Descriptor> {};
 
 } // namespace oneapi::dal::detail
+
+namespace oneapi::dal::linear_kernel {
+
+/// Computes the kernel function by the tiles of tile_row_count rows of x without
+/// allocating the whole x.get_row_count() x y.get_row_count() matrix of values.
+/// The sink is called as sink(first_row, values) for every tile, see
+/// dal::detail::compute_by_tiles.
+template <typename Float, typename Method, typename Sink>
+void compute_by_tiles(const descriptor<Float, Method>& desc,
+                      const table& x,
+                      const table& y,
+                      std::int64_t tile_row_count,
+                      Sink&& sink) {
+    static_assert(std::is_same_v<Method, method::dense>,
+                  "compute_by_tiles supports only the dense method");
+    dal::detail::compute_by_tiles(desc, x, y, tile_row_count, std::forward<Sink>(sink));
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+template <typename Float, typename Method, typename Sink>
+void compute_by_tiles(sycl::queue& queue,
+                      const descriptor<Float, Method>& desc,
+                      const table& x,
+                      const table& y,
+                      std::int64_t tile_row_count,
+                      Sink&& sink) {
+    static_assert(std::is_same_v<Method, method::dense>,
+                  "compute_by_tiles supports only the dense method");
+    dal::detail::compute_by_tiles(queue, desc, x, y, tile_row_count, std::forward<Sink>(sink));
+}
+#endif
+
+} // namespace oneapi::dal::linear_kernel
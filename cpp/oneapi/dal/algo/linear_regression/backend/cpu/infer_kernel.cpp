@@ -0,0 +1,159 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+
+#include <daal/include/algorithms/linear_regression/linear_regression_model_builder.h>
+#include <daal/src/algorithms/linear_model/linear_model_predict_kernel.h>
+
+#include "oneapi/dal/algo/linear_regression/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::linear_regression::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_lr = daal::algorithms::linear_regression;
+namespace daal_lm = daal::algorithms::linear_model;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lm_predict_kernel_t =
+    daal_lm::prediction::internal::PredictKernel<Float, daal_lm::prediction::defaultDense, Cpu>;
+
+template <typename Float>
+table infer_responses_kernel_cpu<Float>::operator()(const context_cpu& ctx,
+                                                    const table& data,
+                                                    const table& betas) const {
+    const int64_t row_count = data.get_row_count();
+    const int64_t feature_count = data.get_column_count();
+    const int64_t response_count = betas.get_row_count();
+
+    // The betas always hold the intercept column, so the model gets the
+    // intercept flag and adds the zero intercepts of the models without them
+    const auto arr_betas = row_accessor<const Float>{ betas }.pull();
+    daal_lr::ModelBuilder<Float> builder(feature_count, response_count);
+    builder.setBeta(arr_betas.get_data(), arr_betas.get_data() + arr_betas.get_count());
+    interop::status_to_exception(builder.getStatus());
+    const auto daal_model = builder.getModel();
+
+    auto arr_responses = array<Float>::empty(row_count * response_count);
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_responses =
+        interop::convert_to_daal_homogen_table(arr_responses, row_count, response_count);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_lm_predict_kernel_t>(ctx,
+                                                                   daal_data.get(),
+                                                                   daal_model.get(),
+                                                                   daal_responses.get()));
+
+    return dal::detail::homogen_table_builder{}
+        .reset(arr_responses, row_count, response_count)
+        .build();
+}
+
+template <typename Float>
+table infer_indexed_responses_kernel_cpu<Float>::operator()(const context_cpu& ctx,
+                                                            const table& data,
+                                                            const table& betas,
+                                                            const table& model_indices) const {
+    using dal::detail::threader_for_cost;
+
+    const int64_t row_count = data.get_row_count();
+    const int64_t feature_count = data.get_column_count();
+    const int64_t beta_count = feature_count + 1;
+    const int64_t model_count = betas.get_row_count();
+    const int64_t index_count = model_indices.get_column_count();
+
+    const auto arr_indices = row_accessor<const std::int32_t>{ model_indices }.pull();
+    const std::int32_t* indices = arr_indices.get_data();
+    for (int64_t i = 0; i < row_count * index_count; ++i) {
+        if (indices[i] < 0 || indices[i] >= model_count) {
+            throw out_of_range("Input model_indices should be less than model betas row_count");
+        }
+    }
+
+    const auto arr_data = row_accessor<const Float>{ data }.pull();
+    const auto arr_betas = row_accessor<const Float>{ betas }.pull();
+    auto arr_responses = array<Float>::empty(row_count * index_count);
+    const Float* x = arr_data.get_data();
+    const Float* beta = arr_betas.get_data();
+    Float* responses = arr_responses.get_mutable_data();
+
+    // Every row reads only the betas of its models, the dense product by all
+    // the stacked models would take model_count times more operations
+    constexpr int64_t block_size = 256;
+    const int64_t block_count = (row_count + block_size - 1) / block_size;
+    const std::size_t block_cost = block_size * index_count * beta_count;
+    threader_for_cost(block_count, block_count, block_cost, [&](int block) {
+        const int64_t end = std::min(row_count, (block + 1) * block_size);
+        for (int64_t i = block * block_size; i < end; ++i) {
+            const Float* row = x + i * feature_count;
+            for (int64_t j = 0; j < index_count; ++j) {
+                const Float* model_beta = beta + indices[i * index_count + j] * beta_count;
+                Float sum = model_beta[0];
+                for (int64_t k = 0; k < feature_count; ++k) {
+                    sum += model_beta[k + 1] * row[k];
+                }
+                responses[i * index_count + j] = sum;
+            }
+        }
+    });
+
+    return dal::detail::homogen_table_builder{}
+        .reset(arr_responses, row_count, index_count)
+        .build();
+}
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::norm_eq, task::regression> {
+    infer_result<task::regression> operator()(const context_cpu& ctx,
+                                              const descriptor_base<task::regression>& desc,
+                                              const infer_input<task::regression>& input) const {
+        if (input.get_model_indices().has_data()) {
+            const auto responses =
+                infer_indexed_responses_kernel_cpu<Float>{}(ctx,
+                                                            input.get_data(),
+                                                            input.get_model().get_betas(),
+                                                            input.get_model_indices());
+            return infer_result<task::regression>().set_responses(responses);
+        }
+        const auto responses = infer_responses_kernel_cpu<Float>{}(ctx,
+                                                                   input.get_data(),
+                                                                   input.get_model().get_betas());
+        return infer_result<task::regression>().set_responses(responses);
+    }
+};
+
+template struct infer_responses_kernel_cpu<float>;
+template struct infer_responses_kernel_cpu<double>;
+
+template struct infer_indexed_responses_kernel_cpu<float>;
+template struct infer_indexed_responses_kernel_cpu<double>;
+
+template struct infer_kernel_cpu<float, method::norm_eq, task::regression>;
+template struct infer_kernel_cpu<double, method::norm_eq, task::regression>;
+
+} // namespace oneapi::dal::linear_regression::backend
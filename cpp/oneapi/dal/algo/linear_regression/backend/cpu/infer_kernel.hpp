@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/algo/linear_regression/infer_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::linear_regression::backend {
+
+template <typename Float, typename Method, typename Task>
+struct infer_kernel_cpu {
+    infer_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                  const descriptor_base<Task>& params,
+                                  const infer_input<Task>& input) const;
+};
+
+/// Computes the row_count x response_count table of the responses of the
+/// data for the response_count x (column_count + 1) table of the betas, it
+/// is shared with the other linear models
+template <typename Float>
+struct infer_responses_kernel_cpu {
+    table operator()(const dal::backend::context_cpu& ctx,
+                     const table& data,
+                     const table& betas) const;
+};
+
+/// Computes the row_count x k table of the responses of the data, the response
+/// j of the row i is computed by the betas row model_indices[i, j], so a single
+/// call evaluates the rows by many models stacked into the betas
+template <typename Float>
+struct infer_indexed_responses_kernel_cpu {
+    table operator()(const dal::backend::context_cpu& ctx,
+                     const table& data,
+                     const table& betas,
+                     const table& model_indices) const;
+};
+
+} // namespace oneapi::dal::linear_regression::backend
@@ -0,0 +1,43 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/algo/linear_regression/train_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/communicator.hpp"
+
+namespace oneapi::dal::linear_regression::backend {
+
+template <typename Float, typename Method, typename Task>
+struct train_kernel_cpu {
+    train_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                  const descriptor_base<Task>& params,
+                                  const train_input<Task>& input) const;
+};
+
+/// Trains the model on the rows of all processes of the SPMD run, the normal
+/// equations of the processes are summed, so every process gets the same model
+template <typename Float, typename Method, typename Task>
+struct spmd_train_kernel_cpu {
+    train_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                  const spmd::communicator& comm,
+                                  const descriptor_base<Task>& params,
+                                  const train_input<Task>& input) const;
+};
+
+} // namespace oneapi::dal::linear_regression::backend
@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <daal/src/algorithms/linear_regression/linear_regression_train_kernel.h>
+
+#include "oneapi/dal/algo/linear_regression/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+namespace oneapi::dal::linear_regression::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_lr = daal::algorithms::linear_regression;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lr_norm_eq_kernel_t =
+    daal_lr::training::internal::BatchKernel<Float, daal_lr::training::normEqDense, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lr_norm_eq_online_kernel_t =
+    daal_lr::training::internal::OnlineKernel<Float, daal_lr::training::normEqDense, Cpu>;
+
+template <typename Float, typename Task>
+static train_result<Task> call_daal_kernel(const context_cpu& ctx,
+                                           const descriptor_base<Task>& desc,
+                                           const table& data,
+                                           const table& responses) {
+    const bool compute_intercept = desc.get_compute_intercept();
+
+    const int64_t feature_count = data.get_column_count();
+    const int64_t response_count = responses.get_column_count();
+    const int64_t beta_count = feature_count + 1;
+    const int64_t xtx_size = compute_intercept ? beta_count : feature_count;
+
+    auto arr_xtx = array<Float>::empty(xtx_size * xtx_size);
+    auto arr_xty = array<Float>::empty(response_count * xtx_size);
+    auto arr_betas = array<Float>::zeros(response_count * beta_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_responses = interop::convert_to_daal_table<Float>(responses);
+    const auto daal_xtx = interop::convert_to_daal_homogen_table(arr_xtx, xtx_size, xtx_size);
+    const auto daal_xty =
+        interop::convert_to_daal_homogen_table(arr_xty, response_count, xtx_size);
+    const auto daal_betas =
+        interop::convert_to_daal_homogen_table(arr_betas, response_count, beta_count);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_lr_norm_eq_kernel_t>(ctx,
+                                                                   *daal_data,
+                                                                   *daal_responses,
+                                                                   *daal_xtx,
+                                                                   *daal_xty,
+                                                                   *daal_betas,
+                                                                   compute_intercept));
+
+    const auto betas =
+        dal::detail::homogen_table_builder{}.reset(arr_betas, response_count, beta_count).build();
+    return train_result<Task>().set_model(model<Task>().set_betas(betas));
+}
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::norm_eq, task::regression> {
+    train_result<task::regression> operator()(const context_cpu& ctx,
+                                              const descriptor_base<task::regression>& desc,
+                                              const train_input<task::regression>& input) const {
+        return call_daal_kernel<Float, task::regression>(ctx,
+                                                         desc,
+                                                         input.get_data(),
+                                                         input.get_responses());
+    }
+};
+
+/// The sums of the normal equations over the rows of the processes do not
+/// depend on the distribution of the rows, so the betas are solved on every
+/// process from the reduced xtx and xty
+template <typename Float, typename Task>
+static train_result<Task> call_daal_spmd_kernel(const context_cpu& ctx,
+                                                const spmd::communicator& comm,
+                                                const descriptor_base<Task>& desc,
+                                                const table& data,
+                                                const table& responses) {
+    const bool compute_intercept = desc.get_compute_intercept();
+
+    const int64_t feature_count = data.get_column_count();
+    const int64_t response_count = responses.get_column_count();
+    const int64_t beta_count = feature_count + 1;
+    const int64_t xtx_size = compute_intercept ? beta_count : feature_count;
+
+    auto arr_xtx = array<Float>::zeros(xtx_size * xtx_size);
+    auto arr_xty = array<Float>::zeros(response_count * xtx_size);
+    auto arr_xtx_final = array<Float>::empty(xtx_size * xtx_size);
+    auto arr_xty_final = array<Float>::empty(response_count * xtx_size);
+    auto arr_betas = array<Float>::zeros(response_count * beta_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_responses = interop::convert_to_daal_table<Float>(responses);
+    const auto daal_xtx = interop::convert_to_daal_homogen_table(arr_xtx, xtx_size, xtx_size);
+    const auto daal_xty =
+        interop::convert_to_daal_homogen_table(arr_xty, response_count, xtx_size);
+    const auto daal_xtx_final =
+        interop::convert_to_daal_homogen_table(arr_xtx_final, xtx_size, xtx_size);
+    const auto daal_xty_final =
+        interop::convert_to_daal_homogen_table(arr_xty_final, response_count, xtx_size);
+    const auto daal_betas =
+        interop::convert_to_daal_homogen_table(arr_betas, response_count, beta_count);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_lr_norm_eq_online_kernel_t>(ctx,
+                                                                          *daal_data,
+                                                                          *daal_responses,
+                                                                          *daal_xtx,
+                                                                          *daal_xty,
+                                                                          compute_intercept));
+
+    comm.allreduce(arr_xtx.get_mutable_data(), arr_xtx.get_count());
+    comm.allreduce(arr_xty.get_mutable_data(), arr_xty.get_count());
+
+    const auto status = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+        return daal_lr_norm_eq_online_kernel_t<Float, daal_cpu>().finalizeCompute(
+            *daal_xtx,
+            *daal_xty,
+            *daal_xtx_final,
+            *daal_xty_final,
+            *daal_betas,
+            compute_intercept);
+    });
+    interop::status_to_exception(status);
+
+    const auto betas =
+        dal::detail::homogen_table_builder{}.reset(arr_betas, response_count, beta_count).build();
+    return train_result<Task>().set_model(model<Task>().set_betas(betas));
+}
+
+template <typename Float>
+struct spmd_train_kernel_cpu<Float, method::norm_eq, task::regression> {
+    train_result<task::regression> operator()(const context_cpu& ctx,
+                                              const spmd::communicator& comm,
+                                              const descriptor_base<task::regression>& desc,
+                                              const train_input<task::regression>& input) const {
+        return call_daal_spmd_kernel<Float, task::regression>(ctx,
+                                                              comm,
+                                                              desc,
+                                                              input.get_data(),
+                                                              input.get_responses());
+    }
+};
+
+template struct train_kernel_cpu<float, method::norm_eq, task::regression>;
+template struct train_kernel_cpu<double, method::norm_eq, task::regression>;
+template struct spmd_train_kernel_cpu<float, method::norm_eq, task::regression>;
+template struct spmd_train_kernel_cpu<double, method::norm_eq, task::regression>;
+
+} // namespace oneapi::dal::linear_regression::backend
@@ -0,0 +1,159 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/linear_regression/infer.hpp"
+#include "oneapi/dal/algo/linear_regression/train.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
+#include "oneapi/dal/test/thread_communicator.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+TEST(linear_regression_norm_eq_cpu, train_and_infer_results) {
+    constexpr std::int64_t row_count = 6;
+    constexpr std::int64_t column_count = 2;
+
+    const float data[] = { 1.0, 0.0, 0.0, 1.0, 1.0, 1.0, 2.0, 1.0, 1.0, 3.0, 3.0, 2.0 };
+    float responses[row_count];
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        responses[i] = 1.0 + 2.0 * data[i * column_count] + 3.0 * data[i * column_count + 1];
+    }
+
+    const float betas[] = { 1.0, 2.0, 3.0 };
+
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto responses_table = homogen_table::wrap(responses, row_count, 1);
+
+    const auto lr_desc = linear_regression::descriptor<>();
+
+    const auto result_train = train(lr_desc, data_table, responses_table);
+
+    const auto train_betas = result_train.get_model().get_betas();
+    ASSERT_EQ(train_betas.get_row_count(), 1);
+    ASSERT_EQ(train_betas.get_column_count(), column_count + 1);
+
+    const auto betas_data = row_accessor<const float>(train_betas).pull().get_data();
+    for (std::int64_t i = 0; i < column_count + 1; ++i) {
+        ASSERT_NEAR(betas[i], betas_data[i], 1e-4);
+    }
+
+    const auto result_infer = infer(lr_desc, result_train.get_model(), data_table);
+
+    const auto infer_responses =
+        row_accessor<const float>(result_infer.get_responses()).pull().get_data();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        ASSERT_NEAR(responses[i], infer_responses[i], 1e-3);
+    }
+}
+
+TEST(linear_regression_norm_eq_cpu, train_results_without_intercept) {
+    constexpr std::int64_t row_count = 6;
+    constexpr std::int64_t column_count = 2;
+
+    const float data[] = { 1.0, 0.0, 0.0, 1.0, 1.0, 1.0, 2.0, 1.0, 1.0, 3.0, 3.0, 2.0 };
+    float responses[row_count];
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        responses[i] = 2.0 * data[i * column_count] + 3.0 * data[i * column_count + 1];
+    }
+
+    const float betas[] = { 0.0, 2.0, 3.0 };
+
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto responses_table = homogen_table::wrap(responses, row_count, 1);
+
+    const auto lr_desc = linear_regression::descriptor<>().set_compute_intercept(false);
+
+    const auto result_train = train(lr_desc, data_table, responses_table);
+
+    const auto betas_data =
+        row_accessor<const float>(result_train.get_model().get_betas()).pull().get_data();
+    for (std::int64_t i = 0; i < column_count + 1; ++i) {
+        ASSERT_NEAR(betas[i], betas_data[i], 1e-4);
+    }
+}
+
+TEST(linear_regression_norm_eq_cpu, infer_results_by_model_indices) {
+    constexpr std::int64_t row_count = 4;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t model_count = 3;
+
+    const float data[] = { 1.0, 0.0, 0.0, 1.0, 1.0, 1.0, 2.0, 3.0 };
+    const float betas[] = { 1.0, 2.0, 3.0, -1.0, 0.5, 0.0, 0.0, 0.0, 4.0 };
+    const std::int32_t model_indices[] = { 0, 2, 1, 0, 2, 2, 1, 0 };
+    constexpr std::int64_t index_count = 2;
+
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto betas_table = homogen_table::wrap(betas, model_count, column_count + 1);
+    const auto indices_table = homogen_table::wrap(model_indices, row_count, index_count);
+
+    const auto lr_desc = linear_regression::descriptor<>();
+    const auto lr_model = linear_regression::model<>().set_betas(betas_table);
+
+    const auto result_infer =
+        infer(lr_desc, linear_regression::infer_input<>(lr_model, data_table)
+                           .set_model_indices(indices_table));
+
+    const auto infer_responses = result_infer.get_responses();
+    ASSERT_EQ(infer_responses.get_row_count(), row_count);
+    ASSERT_EQ(infer_responses.get_column_count(), index_count);
+
+    const auto responses = row_accessor<const float>(infer_responses).pull().get_data();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        for (std::int64_t j = 0; j < index_count; ++j) {
+            const float* beta = betas + model_indices[i * index_count + j] * (column_count + 1);
+            const float expected = beta[0] + beta[1] * data[i * column_count] +
+                                   beta[2] * data[i * column_count + 1];
+            ASSERT_NEAR(expected, responses[i * index_count + j], 1e-5);
+        }
+    }
+}
+
+TEST(linear_regression_norm_eq_cpu, spmd_train_results) {
+    constexpr std::int64_t rank_count = 2;
+    constexpr std::int64_t rank_row_count = 3;
+    constexpr std::int64_t column_count = 2;
+
+    static const double data[] = { 1.0, 0.0, 0.0, 1.0, 1.0, 1.0, 2.0, 1.0, 1.0, 3.0, 3.0, 2.0 };
+    static const double betas[] = { 1.0, 2.0, 3.0 };
+
+    const auto lr_desc = linear_regression::descriptor<double>();
+
+    test::run_spmd(rank_count, [&](std::int64_t rank, const spmd::communicator& comm) {
+        const double* local_data = data + rank * rank_row_count * column_count;
+        double responses[rank_row_count];
+        for (std::int64_t i = 0; i < rank_row_count; ++i) {
+            responses[i] =
+                1.0 + 2.0 * local_data[i * column_count] + 3.0 * local_data[i * column_count + 1];
+        }
+
+        const auto data_table = homogen_table::wrap(local_data, rank_row_count, column_count);
+        const auto responses_table = homogen_table::wrap(responses, rank_row_count, 1);
+        const detail::spmd_policy<detail::host_policy> policy{ detail::host_policy{}, comm };
+
+        const auto result_train = train(policy, lr_desc, data_table, responses_table);
+
+        const auto train_betas = result_train.get_model().get_betas();
+        ASSERT_EQ(train_betas.get_row_count(), 1);
+        ASSERT_EQ(train_betas.get_column_count(), column_count + 1);
+
+        const auto betas_data = row_accessor<const double>(train_betas).pull();
+        for (std::int64_t i = 0; i < column_count + 1; ++i) {
+            ASSERT_NEAR(betas[i], betas_data[i], 1e-9);
+        }
+    });
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/algo/linear_regression/infer_types.hpp"
+#include "oneapi/dal/backend/dispatcher_dpc.hpp"
+
+namespace oneapi::dal::linear_regression::backend {
+
+template <typename Float, typename Method, typename Task>
+struct infer_kernel_gpu {
+    infer_result<Task> operator()(const dal::backend::context_gpu& ctx,
+                                  const descriptor_base<Task>& params,
+                                  const infer_input<Task>& input) const;
+};
+
+/// Computes the responses of the data on the device, see
+/// infer_responses_kernel_cpu
+template <typename Float>
+struct infer_responses_kernel_gpu {
+    table operator()(const dal::backend::context_gpu& ctx,
+                     const table& data,
+                     const table& betas) const;
+};
+
+/// Computes the responses of the data by the indexed betas on the device, see
+/// infer_indexed_responses_kernel_cpu
+template <typename Float>
+struct infer_indexed_responses_kernel_gpu {
+    table operator()(const dal::backend::context_gpu& ctx,
+                     const table& data,
+                     const table& betas,
+                     const table& model_indices) const;
+};
+
+} // namespace oneapi::dal::linear_regression::backend
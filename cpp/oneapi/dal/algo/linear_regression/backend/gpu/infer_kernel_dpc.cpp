@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <daal/include/algorithms/linear_regression/linear_regression_model_builder.h>
+#include <src/algorithms/linear_model/oneapi/linear_model_predict_kernel_oneapi.h>
+
+#include "oneapi/dal/algo/linear_regression/backend/gpu/infer_kernel.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::linear_regression::backend {
+
+using std::int64_t;
+using dal::backend::context_gpu;
+
+namespace daal_lr = daal::algorithms::linear_regression;
+namespace daal_lm = daal::algorithms::linear_model;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+class infer_indexed_responses_kernel;
+
+template <typename Float>
+using daal_lm_predict_kernel_oneapi_t =
+    daal_lm::prediction::internal::PredictKernelOneAPI<Float, daal_lm::prediction::defaultDense>;
+
+template <typename Float>
+table infer_responses_kernel_gpu<Float>::operator()(const context_gpu& ctx,
+                                                    const table& data,
+                                                    const table& betas) const {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const int64_t row_count = data.get_row_count();
+    const int64_t feature_count = data.get_column_count();
+    const int64_t response_count = betas.get_row_count();
+
+    // The builder allocates the betas on the device under the guard
+    const auto arr_betas = row_accessor<const Float>{ betas }.pull();
+    daal_lr::ModelBuilder<Float> builder(feature_count, response_count);
+    builder.setBeta(arr_betas.get_data(), arr_betas.get_data() + arr_betas.get_count());
+    interop::status_to_exception(builder.getStatus());
+    const auto daal_model = builder.getModel();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    auto arr_responses = array<Float>::empty(queue, row_count * response_count);
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, feature_count);
+    const auto daal_responses = interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                            arr_responses,
+                                                                            row_count,
+                                                                            response_count);
+
+    interop::status_to_exception(
+        daal_lm_predict_kernel_oneapi_t<Float>().compute(daal_data.get(),
+                                                         daal_model.get(),
+                                                         daal_responses.get()));
+
+    return dal::detail::homogen_table_builder{}
+        .reset(arr_responses, row_count, response_count)
+        .build();
+}
+
+template <typename Float>
+table infer_indexed_responses_kernel_gpu<Float>::operator()(const context_gpu& ctx,
+                                                            const table& data,
+                                                            const table& betas,
+                                                            const table& model_indices) const {
+    auto& queue = ctx.get_queue();
+
+    const int64_t row_count = data.get_row_count();
+    const int64_t feature_count = data.get_column_count();
+    const int64_t beta_count = feature_count + 1;
+    const int64_t model_count = betas.get_row_count();
+    const int64_t index_count = model_indices.get_column_count();
+
+    const auto host_indices = row_accessor<const std::int32_t>{ model_indices }.pull();
+    const std::int32_t* host_index = host_indices.get_data();
+    for (int64_t i = 0; i < row_count * index_count; ++i) {
+        if (host_index[i] < 0 || host_index[i] >= model_count) {
+            throw out_of_range("Input model_indices should be less than model betas row_count");
+        }
+    }
+
+    const auto arr_indices = row_accessor<const std::int32_t>{ model_indices }.pull(queue);
+    const auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    const auto arr_betas = row_accessor<const Float>{ betas }.pull(queue);
+    auto arr_responses = array<Float>::empty(queue, row_count * index_count);
+    const std::int32_t* indices = arr_indices.get_data();
+    const Float* x = arr_data.get_data();
+    const Float* beta = arr_betas.get_data();
+    Float* responses = arr_responses.get_mutable_data();
+
+    // A work-item per response reads only the betas of its model, see the
+    // CPU kernel
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<infer_indexed_responses_kernel<Float>>(
+                sycl::range<2>(row_count, index_count),
+                [=](sycl::id<2> idx) {
+                    const int64_t i = idx[0];
+                    const int64_t j = idx[1];
+                    const Float* row = x + i * feature_count;
+                    const Float* model_beta = beta + indices[i * index_count + j] * beta_count;
+                    Float sum = model_beta[0];
+                    for (int64_t k = 0; k < feature_count; ++k) {
+                        sum += model_beta[k + 1] * row[k];
+                    }
+                    responses[i * index_count + j] = sum;
+                });
+        })
+        .wait_and_throw();
+
+    return dal::detail::homogen_table_builder{}
+        .reset(arr_responses, row_count, index_count)
+        .build();
+}
+
+template <typename Float>
+struct infer_kernel_gpu<Float, method::norm_eq, task::regression> {
+    infer_result<task::regression> operator()(const context_gpu& ctx,
+                                              const descriptor_base<task::regression>& desc,
+                                              const infer_input<task::regression>& input) const {
+        if (input.get_model_indices().has_data()) {
+            const auto responses =
+                infer_indexed_responses_kernel_gpu<Float>{}(ctx,
+                                                            input.get_data(),
+                                                            input.get_model().get_betas(),
+                                                            input.get_model_indices());
+            return infer_result<task::regression>().set_responses(responses);
+        }
+        const auto responses = infer_responses_kernel_gpu<Float>{}(ctx,
+                                                                   input.get_data(),
+                                                                   input.get_model().get_betas());
+        return infer_result<task::regression>().set_responses(responses);
+    }
+};
+
+template struct infer_responses_kernel_gpu<float>;
+template struct infer_responses_kernel_gpu<double>;
+
+template struct infer_indexed_responses_kernel_gpu<float>;
+template struct infer_indexed_responses_kernel_gpu<double>;
+
+template struct infer_kernel_gpu<float, method::norm_eq, task::regression>;
+template struct infer_kernel_gpu<double, method::norm_eq, task::regression>;
+
+} // namespace oneapi::dal::linear_regression::backend
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <src/algorithms/linear_regression/oneapi/linear_regression_train_kernel_oneapi.h>
+
+#include "oneapi/dal/algo/linear_regression/backend/gpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::linear_regression::backend {
+
+using std::int64_t;
+using dal::backend::context_gpu;
+
+namespace daal_lr = daal::algorithms::linear_regression;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_lr_norm_eq_kernel_oneapi_t =
+    daal_lr::training::internal::BatchKernelOneAPI<Float, daal_lr::training::normEqDense>;
+
+template <typename Float>
+struct train_kernel_gpu<Float, method::norm_eq, task::regression> {
+    train_result<task::regression> operator()(const context_gpu& ctx,
+                                              const descriptor_base<task::regression>& desc,
+                                              const train_input<task::regression>& input) const {
+        auto& queue = ctx.get_queue();
+        interop::execution_context_guard guard(queue);
+
+        const auto data = input.get_data();
+        const auto responses = input.get_responses();
+        const bool compute_intercept = desc.get_compute_intercept();
+
+        const int64_t row_count = data.get_row_count();
+        const int64_t feature_count = data.get_column_count();
+        const int64_t response_count = responses.get_column_count();
+        const int64_t beta_count = feature_count + 1;
+        const int64_t xtx_size = compute_intercept ? beta_count : feature_count;
+
+        auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+        auto arr_responses = row_accessor<const Float>{ responses }.pull(queue);
+        auto arr_xtx = array<Float>::zeros(queue, xtx_size * xtx_size);
+        auto arr_xty = array<Float>::zeros(queue, response_count * xtx_size);
+        auto arr_betas = array<Float>::zeros(queue, response_count * beta_count);
+
+        const auto daal_data =
+            interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, feature_count);
+        const auto daal_responses = interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                                arr_responses,
+                                                                                row_count,
+                                                                                response_count);
+        const auto daal_xtx =
+            interop::convert_to_daal_sycl_homogen_table(queue, arr_xtx, xtx_size, xtx_size);
+        const auto daal_xty =
+            interop::convert_to_daal_sycl_homogen_table(queue, arr_xty, response_count, xtx_size);
+        const auto daal_betas = interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                            arr_betas,
+                                                                            response_count,
+                                                                            beta_count);
+
+        interop::status_to_exception(
+            daal_lr_norm_eq_kernel_oneapi_t<Float>().compute(*daal_data,
+                                                             *daal_responses,
+                                                             *daal_xtx,
+                                                             *daal_xty,
+                                                             *daal_betas,
+                                                             compute_intercept));
+
+        const auto betas = dal::detail::homogen_table_builder{}
+                               .reset(arr_betas, response_count, beta_count)
+                               .build();
+        return train_result<task::regression>().set_model(
+            model<task::regression>().set_betas(betas));
+    }
+};
+
+template struct train_kernel_gpu<float, method::norm_eq, task::regression>;
+template struct train_kernel_gpu<double, method::norm_eq, task::regression>;
+
+} // namespace oneapi::dal::linear_regression::backend
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <CL/sycl.hpp>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/linear_regression/infer.hpp"
+#include "oneapi/dal/algo/linear_regression/train.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+TEST(linear_regression_norm_eq_gpu, train_and_infer_results) {
+    auto selector = sycl::gpu_selector();
+    auto queue = sycl::queue(selector);
+
+    constexpr std::int64_t row_count = 6;
+    constexpr std::int64_t column_count = 2;
+
+    const float data_host[] = { 1.0, 0.0, 0.0, 1.0, 1.0, 1.0, 2.0, 1.0, 1.0, 3.0, 3.0, 2.0 };
+    float responses_host[row_count];
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        responses_host[i] =
+            1.0 + 2.0 * data_host[i * column_count] + 3.0 * data_host[i * column_count + 1];
+    }
+
+    auto data = sycl::malloc_shared<float>(row_count * column_count, queue);
+    queue.memcpy(data, data_host, sizeof(float) * row_count * column_count).wait();
+    const auto data_table = homogen_table::wrap(queue, data, row_count, column_count);
+
+    auto responses = sycl::malloc_shared<float>(row_count, queue);
+    queue.memcpy(responses, responses_host, sizeof(float) * row_count).wait();
+    const auto responses_table = homogen_table::wrap(queue, responses, row_count, 1);
+
+    const float betas[] = { 1.0, 2.0, 3.0 };
+
+    const auto lr_desc = linear_regression::descriptor<>();
+
+    const auto result_train = train(queue, lr_desc, data_table, responses_table);
+
+    const auto betas_data =
+        row_accessor<const float>(result_train.get_model().get_betas()).pull().get_data();
+    for (std::int64_t i = 0; i < column_count + 1; ++i) {
+        ASSERT_NEAR(betas[i], betas_data[i], 1e-3);
+    }
+
+    const auto result_infer = infer(queue, lr_desc, result_train.get_model(), data_table);
+
+    const auto infer_responses =
+        row_accessor<const float>(result_infer.get_responses()).pull().get_data();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        ASSERT_NEAR(responses_host[i], infer_responses[i], 1e-2);
+    }
+
+    sycl::free(data, queue);
+    sycl::free(responses, queue);
+}
+
+TEST(linear_regression_norm_eq_gpu, infer_results_by_model_indices) {
+    auto selector = sycl::gpu_selector();
+    auto queue = sycl::queue(selector);
+
+    constexpr std::int64_t row_count = 4;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t model_count = 3;
+    constexpr std::int64_t index_count = 2;
+
+    const float data_host[] = { 1.0, 0.0, 0.0, 1.0, 1.0, 1.0, 2.0, 3.0 };
+    const float betas[] = { 1.0, 2.0, 3.0, -1.0, 0.5, 0.0, 0.0, 0.0, 4.0 };
+    const std::int32_t model_indices[] = { 0, 2, 1, 0, 2, 2, 1, 0 };
+
+    auto data = sycl::malloc_shared<float>(row_count * column_count, queue);
+    queue.memcpy(data, data_host, sizeof(float) * row_count * column_count).wait();
+    const auto data_table = homogen_table::wrap(queue, data, row_count, column_count);
+
+    const auto betas_table = homogen_table::wrap(betas, model_count, column_count + 1);
+    const auto indices_table = homogen_table::wrap(model_indices, row_count, index_count);
+
+    const auto lr_desc = linear_regression::descriptor<>();
+    const auto lr_model = linear_regression::model<>().set_betas(betas_table);
+
+    const auto result_infer =
+        infer(queue,
+              lr_desc,
+              linear_regression::infer_input<>(lr_model, data_table)
+                  .set_model_indices(indices_table));
+
+    const auto responses =
+        row_accessor<const float>(result_infer.get_responses()).pull().get_data();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        for (std::int64_t j = 0; j < index_count; ++j) {
+            const float* beta = betas + model_indices[i * index_count + j] * (column_count + 1);
+            const float expected = beta[0] + beta[1] * data_host[i * column_count] +
+                                   beta[2] * data_host[i * column_count + 1];
+            ASSERT_NEAR(expected, responses[i * index_count + j], 1e-4);
+        }
+    }
+
+    sycl::free(data, queue);
+}
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::linear_regression {
+
+namespace task {
+struct regression {};
+using by_default = regression;
+} // namespace task
+
+namespace detail {
+struct tag {};
+
+template <typename Task = task::by_default>
+class descriptor_impl;
+
+template <typename Task = task::by_default>
+class model_impl;
+} // namespace detail
+
+namespace method {
+struct norm_eq {};
+using by_default = norm_eq;
+} // namespace method
+
+template <typename Task = task::by_default>
+class ONEAPI_DAL_EXPORT descriptor_base : public base {
+public:
+    using tag_t = detail::tag;
+    using task_t = Task;
+    using float_t = float;
+    using method_t = method::by_default;
+
+    descriptor_base();
+
+    auto get_compute_intercept() const -> bool;
+
+protected:
+    void set_compute_intercept_impl(bool value);
+
+    dal::detail::pimpl<detail::descriptor_impl<task_t>> impl_;
+};
+
+template <typename Float = descriptor_base<task::by_default>::float_t,
+          typename Method = descriptor_base<task::by_default>::method_t,
+          typename Task = task::by_default>
+class descriptor : public descriptor_base<Task> {
+public:
+    using float_t = Float;
+    using method_t = Method;
+
+    auto& set_compute_intercept(bool value) {
+        descriptor_base<Task>::set_compute_intercept_impl(value);
+        return *this;
+    }
+};
+
+/// The model holds the response_count x (feature_count + 1) table of the
+/// coefficients, the first column is the intercept or zero if the intercept
+/// is not computed
+template <typename Task = task::by_default>
+class ONEAPI_DAL_EXPORT model : public base {
+    friend dal::detail::pimpl_accessor;
+
+public:
+    using task_t = Task;
+    model();
+
+    table get_betas() const;
+
+    auto& set_betas(const table& value) {
+        set_betas_impl(value);
+        return *this;
+    }
+
+private:
+    void set_betas_impl(const table&);
+
+    dal::detail::pimpl<detail::model_impl<task_t>> impl_;
+};
+
+} // namespace oneapi::dal::linear_regression
@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/linear_regression/detail/train_ops.hpp"
+#include "oneapi/dal/algo/linear_regression/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
+
+namespace oneapi::dal::linear_regression::detail {
+using oneapi::dal::detail::host_policy;
+using oneapi::dal::detail::spmd_policy;
+
+template <typename Float, typename Method, typename Task>
+struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, Float, Method, Task> {
+    train_result<Task> operator()(const host_policy& ctx,
+                                  const descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        using kernel_dispatcher_t =
+            dal::backend::kernel_dispatcher<backend::train_kernel_cpu<Float, Method, Task>>;
+        return kernel_dispatcher_t()(ctx, desc, input);
+    }
+};
+
+template <typename Float, typename Method, typename Task>
+struct ONEAPI_DAL_EXPORT train_ops_dispatcher<spmd_policy<host_policy>, Float, Method, Task> {
+    train_result<Task> operator()(const spmd_policy<host_policy>& ctx,
+                                  const descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        using kernel_dispatcher_t =
+            dal::backend::kernel_dispatcher<backend::spmd_train_kernel_cpu<Float, Method, Task>>;
+        return kernel_dispatcher_t()(ctx.get_local(), ctx.get_communicator(), desc, input);
+    }
+};
+
+#define INSTANTIATE(F, M, T)                                                      \
+    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, F, M, T>; \
+    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<spmd_policy<host_policy>, F, M, T>;
+
+INSTANTIATE(float, method::norm_eq, task::regression)
+INSTANTIATE(double, method::norm_eq, task::regression)
+
+} // namespace oneapi::dal::linear_regression::detail
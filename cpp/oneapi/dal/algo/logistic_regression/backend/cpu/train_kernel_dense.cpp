@@ -0,0 +1,43 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/logistic_regression/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/logistic_regression/backend/daal_batch.hpp"
+
+namespace oneapi::dal::logistic_regression::backend {
+
+using dal::backend::context_cpu;
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::dense, task::classification> {
+    train_result<task::classification> operator()(
+        const context_cpu& ctx,
+        const descriptor_base<task::classification>& desc,
+        const train_input<task::classification>& input) const {
+        const auto daal_data = interop::convert_to_daal_table<Float>(input.get_data());
+        const auto daal_labels = interop::convert_to_daal_table<Float>(input.get_labels());
+
+        const auto betas = train_by_daal_batch<Float>(desc, daal_data, daal_labels);
+        return train_result<task::classification>().set_model(
+            model<task::classification>().set_betas(betas));
+    }
+};
+
+template struct train_kernel_cpu<float, method::dense, task::classification>;
+template struct train_kernel_cpu<double, method::dense, task::classification>;
+
+} // namespace oneapi::dal::logistic_regression::backend
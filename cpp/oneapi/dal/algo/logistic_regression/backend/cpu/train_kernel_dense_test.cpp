@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/logistic_regression/infer.hpp"
+#include "oneapi/dal/algo/logistic_regression/train.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+TEST(logistic_regression_dense_cpu, train_and_infer_results) {
+    constexpr std::int64_t row_count = 6;
+    constexpr std::int64_t column_count = 1;
+
+    const float data[] = { -2.0, -1.5, -1.0, 1.0, 1.5, 2.0 };
+    const float labels[] = { 0.0, 0.0, 0.0, 1.0, 1.0, 1.0 };
+
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto labels_table = homogen_table::wrap(labels, row_count, 1);
+
+    const auto logreg_desc =
+        logistic_regression::descriptor<>().set_learning_rate(0.1).set_max_iteration_count(1000);
+
+    const auto result_train = train(logreg_desc, data_table, labels_table);
+
+    const auto betas = result_train.get_model().get_betas();
+    ASSERT_EQ(betas.get_row_count(), 1);
+    ASSERT_EQ(betas.get_column_count(), column_count + 1);
+
+    const auto result_infer = infer(logreg_desc, result_train.get_model(), data_table);
+
+    const auto infer_labels = row_accessor<const float>(result_infer.get_labels()).pull().get_data();
+    const auto infer_probabilities =
+        row_accessor<const float>(result_infer.get_probabilities()).pull().get_data();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        ASSERT_FLOAT_EQ(labels[i], infer_labels[i]);
+        ASSERT_EQ(infer_probabilities[i] > 0.5f, labels[i] > 0.5f);
+    }
+}
+
+TEST(logistic_regression_dense_cpu, class_count_should_be_at_least_two) {
+    ASSERT_THROW((logistic_regression::descriptor<>().set_class_count(1)), domain_error);
+}
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <daal/include/algorithms/logistic_regression/logistic_regression_model_builder.h>
+#include <daal/include/algorithms/logistic_regression/logistic_regression_predict.h>
+#include <daal/include/algorithms/logistic_regression/logistic_regression_training_batch.h>
+#include <daal/include/algorithms/optimization_solver/sgd/sgd_batch.h>
+
+#include "oneapi/dal/algo/logistic_regression/infer_types.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::logistic_regression::backend {
+
+namespace daal_logreg = daal::algorithms::logistic_regression;
+namespace daal_classifier = daal::algorithms::classifier;
+namespace daal_sgd = daal::algorithms::optimization_solver::sgd;
+namespace daal_dm = daal::data_management;
+namespace interop = dal::backend::interop;
+
+/// The DAAL algorithms allocate their results and dispatch by the CPU and
+/// the device of the current execution context themselves, the kernels of
+/// both contexts only convert the tables
+
+template <typename Float>
+inline table train_by_daal_batch(const descriptor_base<task::classification>& desc,
+                                 const daal_dm::NumericTablePtr& daal_data,
+                                 const daal_dm::NumericTablePtr& daal_labels) {
+    const std::int64_t row_count = daal_data->getNumberOfRows();
+
+    auto solver = daal_sgd::Batch<Float, daal_sgd::momentum>::create();
+    solver->parameter.nIterations = desc.get_max_iteration_count();
+    solver->parameter.accuracyThreshold = desc.get_accuracy_threshold();
+    solver->parameter.batchSize = row_count;
+    solver->parameter.learningRateSequence =
+        daal_dm::HomogenNumericTable<Float>::create(1,
+                                                    1,
+                                                    daal_dm::NumericTable::doAllocate,
+                                                    static_cast<Float>(desc.get_learning_rate()));
+
+    daal_logreg::training::Batch<Float> alg(desc.get_class_count(), solver);
+    alg.parameter().interceptFlag = desc.get_compute_intercept();
+    alg.parameter().penaltyL1 = static_cast<float>(desc.get_l1_regularization());
+    alg.parameter().penaltyL2 = static_cast<float>(desc.get_l2_regularization());
+    alg.input.set(daal_classifier::training::data, daal_data);
+    alg.input.set(daal_classifier::training::labels, daal_labels);
+
+    interop::status_to_exception(alg.compute());
+
+    const auto daal_model = alg.getResult()->get(daal_classifier::training::model);
+    return interop::convert_from_daal_homogen_table<Float>(daal_model->getBeta());
+}
+
+template <typename Float>
+inline infer_result<task::classification> infer_by_daal_batch(
+    const descriptor_base<task::classification>& desc,
+    const table& betas,
+    const daal_dm::NumericTablePtr& daal_data) {
+    const std::int64_t class_count = desc.get_class_count();
+    const std::int64_t feature_count = daal_data->getNumberOfColumns();
+
+    const auto arr_betas = row_accessor<const Float>{ betas }.pull();
+    daal_logreg::ModelBuilder<Float> builder(feature_count, class_count);
+    builder.setBeta(arr_betas.get_data(), arr_betas.get_data() + arr_betas.get_count());
+    interop::status_to_exception(builder.getStatus());
+
+    daal_logreg::prediction::Batch<Float> alg(class_count);
+    alg.parameter().resultsToEvaluate =
+        daal_classifier::computeClassLabels | daal_classifier::computeClassProbabilities;
+    alg.input.set(daal_classifier::prediction::data, daal_data);
+    alg.input.set(daal_classifier::prediction::model, builder.getModel());
+
+    interop::status_to_exception(alg.compute());
+
+    const auto daal_result = alg.getResult();
+    return infer_result<task::classification>()
+        .set_labels(interop::convert_from_daal_homogen_table<Float>(
+            daal_result->get(daal_classifier::prediction::prediction)))
+        .set_probabilities(interop::convert_from_daal_homogen_table<Float>(
+            daal_result->get(daal_classifier::prediction::probabilities)));
+}
+
+} // namespace oneapi::dal::logistic_regression::backend
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/logistic_regression/backend/daal_batch.hpp"
+#include "oneapi/dal/algo/logistic_regression/backend/gpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+
+namespace oneapi::dal::logistic_regression::backend {
+
+using dal::backend::context_gpu;
+
+template <typename Float>
+struct train_kernel_gpu<Float, method::dense, task::classification> {
+    train_result<task::classification> operator()(
+        const context_gpu& ctx,
+        const descriptor_base<task::classification>& desc,
+        const train_input<task::classification>& input) const {
+        auto& queue = ctx.get_queue();
+        interop::execution_context_guard guard(queue);
+
+        const auto data = input.get_data();
+        const auto labels = input.get_labels();
+        const std::int64_t row_count = data.get_row_count();
+
+        auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+        auto arr_labels = row_accessor<const Float>{ labels }.pull(queue);
+        const auto daal_data = interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                           arr_data,
+                                                                           row_count,
+                                                                           data.get_column_count());
+        const auto daal_labels =
+            interop::convert_to_daal_sycl_homogen_table(queue, arr_labels, row_count, 1);
+
+        const auto betas = train_by_daal_batch<Float>(desc, daal_data, daal_labels);
+        return train_result<task::classification>().set_model(
+            model<task::classification>().set_betas(betas));
+    }
+};
+
+template struct train_kernel_gpu<float, method::dense, task::classification>;
+template struct train_kernel_gpu<double, method::dense, task::classification>;
+
+} // namespace oneapi::dal::logistic_regression::backend
@@ -0,0 +1,151 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/logistic_regression/common.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::logistic_regression {
+
+template <>
+class detail::descriptor_impl<task::classification> : public base {
+public:
+    std::int64_t class_count = 2;
+    bool compute_intercept = true;
+    double l1_regularization = 0;
+    double l2_regularization = 0;
+    std::int64_t max_iteration_count = 1000;
+    double accuracy_threshold = 1e-4;
+    double learning_rate = 1e-3;
+};
+
+template <>
+class detail::model_impl<task::classification> : public base {
+public:
+    table betas;
+};
+
+using detail::descriptor_impl;
+using detail::model_impl;
+
+template <typename Task>
+descriptor_base<Task>::descriptor_base() : impl_(new descriptor_impl<Task>{}) {}
+
+template <>
+std::int64_t descriptor_base<task::classification>::get_class_count() const {
+    return impl_->class_count;
+}
+
+template <>
+bool descriptor_base<task::classification>::get_compute_intercept() const {
+    return impl_->compute_intercept;
+}
+
+template <>
+double descriptor_base<task::classification>::get_l1_regularization() const {
+    return impl_->l1_regularization;
+}
+
+template <>
+double descriptor_base<task::classification>::get_l2_regularization() const {
+    return impl_->l2_regularization;
+}
+
+template <>
+std::int64_t descriptor_base<task::classification>::get_max_iteration_count() const {
+    return impl_->max_iteration_count;
+}
+
+template <>
+double descriptor_base<task::classification>::get_accuracy_threshold() const {
+    return impl_->accuracy_threshold;
+}
+
+template <>
+double descriptor_base<task::classification>::get_learning_rate() const {
+    return impl_->learning_rate;
+}
+
+template <>
+void descriptor_base<task::classification>::set_class_count_impl(std::int64_t value) {
+    if (value < 2) {
+        throw domain_error("class_count should be >= 2");
+    }
+    impl_->class_count = value;
+}
+
+template <>
+void descriptor_base<task::classification>::set_compute_intercept_impl(bool value) {
+    impl_->compute_intercept = value;
+}
+
+template <>
+void descriptor_base<task::classification>::set_l1_regularization_impl(double value) {
+    if (value < 0.0) {
+        throw domain_error("l1_regularization should be >= 0.0");
+    }
+    impl_->l1_regularization = value;
+}
+
+template <>
+void descriptor_base<task::classification>::set_l2_regularization_impl(double value) {
+    if (value < 0.0) {
+        throw domain_error("l2_regularization should be >= 0.0");
+    }
+    impl_->l2_regularization = value;
+}
+
+template <>
+void descriptor_base<task::classification>::set_max_iteration_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw domain_error("max_iteration_count should be >= 0");
+    }
+    impl_->max_iteration_count = value;
+}
+
+template <>
+void descriptor_base<task::classification>::set_accuracy_threshold_impl(double value) {
+    if (value < 0.0) {
+        throw domain_error("accuracy_threshold should be >= 0.0");
+    }
+    impl_->accuracy_threshold = value;
+}
+
+template <>
+void descriptor_base<task::classification>::set_learning_rate_impl(double value) {
+    if (value <= 0.0) {
+        throw domain_error("learning_rate should be > 0.0");
+    }
+    impl_->learning_rate = value;
+}
+
+template <typename Task>
+model<Task>::model() : impl_(new model_impl<Task>{}) {}
+
+template <typename Task>
+table model<Task>::get_betas() const {
+    return impl_->betas;
+}
+
+template <typename Task>
+void model<Task>::set_betas_impl(const table& value) {
+    impl_->betas = value;
+}
+
+template class ONEAPI_DAL_EXPORT descriptor_base<task::classification>;
+template class ONEAPI_DAL_EXPORT model<task::classification>;
+
+} // namespace oneapi::dal::logistic_regression
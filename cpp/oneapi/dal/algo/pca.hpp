@@ -16,4 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/algo/pca/finalize_train.hpp"
+#include "oneapi/dal/algo/pca/infer.hpp"
+#include "oneapi/dal/algo/pca/partial_train.hpp"
 #include "oneapi/dal/algo/pca/train.hpp"
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/pca/backend/cpu/partial_train_kernel.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+template <typename Float>
+struct finalize_train_kernel_cpu<Float, method::cov, task::dim_reduction> {
+    train_result<task::dim_reduction> operator()(
+        const context_cpu& ctx,
+        const descriptor_base<task::dim_reduction>& desc,
+        const partial_train_result<task::dim_reduction>& input) const {
+        const auto n_rows = row_accessor<const double>{ input.get_partial_n_rows() }.pull();
+        const auto sum = row_accessor<const Float>{ input.get_partial_sum() }.pull();
+        const auto crossproduct =
+            row_accessor<const Float>{ input.get_partial_crossproduct() }.pull();
+        const double row_count = n_rows[0];
+        const int64_t column_count = sum.get_count();
+
+        covariance_moments<Float> moments;
+        moments.row_count = int64_t(row_count);
+        moments.means = array<Float>::empty(column_count);
+        moments.covariance = array<Float>::empty(column_count * column_count);
+
+        Float* means = moments.means.get_mutable_data();
+        Float* covariance = moments.covariance.get_mutable_data();
+        for (int64_t j = 0; j < column_count; j++) {
+            means[j] = Float(sum[j] / row_count);
+        }
+        for (int64_t i = 0; i < column_count * column_count; i++) {
+            covariance[i] = Float(crossproduct[i] / (row_count - 1.0));
+        }
+
+        const std::vector<covariance_moments<Float>> parts{ moments };
+        return train_from_moments_kernel_cpu<Float, task::dim_reduction>{}(ctx, desc, parts);
+    }
+};
+
+template struct finalize_train_kernel_cpu<float, method::cov, task::dim_reduction>;
+template struct finalize_train_kernel_cpu<double, method::cov, task::dim_reduction>;
+
+} // namespace oneapi::dal::pca::backend
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "oneapi/dal/algo/pca/backend/cpu/partial_train_kernel.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+/// Makes the largest by absolute value component of the vector positive, the
+/// same rule as the one of the DAAL kernels
+template <typename Float>
+static void flip_sign(Float* vector, int64_t count) {
+    int64_t max_index = 0;
+    for (int64_t j = 1; j < count; j++) {
+        if (std::abs(vector[j]) > std::abs(vector[max_index])) {
+            max_index = j;
+        }
+    }
+    if (vector[max_index] < Float(0)) {
+        for (int64_t j = 0; j < count; j++) {
+            vector[j] = -vector[j];
+        }
+    }
+}
+
+/// The factor F of the centered rows gives the variances as the squared norms
+/// of its columns, the SVD of F D^{-1} with the standard deviations D gives
+/// the components of the correlation matrix as the cov method does
+template <typename Float>
+struct finalize_train_kernel_cpu<Float, method::svd, task::dim_reduction> {
+    train_result<task::dim_reduction> operator()(
+        const context_cpu& ctx,
+        const descriptor_base<task::dim_reduction>& desc,
+        const partial_train_result<task::dim_reduction>& input) const {
+        const auto n_rows = row_accessor<const double>{ input.get_partial_n_rows() }.pull();
+        const auto sum = row_accessor<const Float>{ input.get_partial_sum() }.pull();
+        const auto factor = row_accessor<const Float>{ input.get_partial_factor() }.pull();
+        const double row_count = n_rows[0];
+        const int64_t column_count = sum.get_count();
+        const int64_t component_count = desc.get_component_count();
+
+        auto arr_eigvec = array<Float>::empty(column_count * component_count);
+        auto arr_eigval = array<Float>::empty(1 * component_count);
+        auto arr_means = array<Float>::empty(1 * column_count);
+        auto arr_vars = array<Float>::empty(1 * column_count);
+        Float* eigvec = arr_eigvec.get_mutable_data();
+        Float* eigval = arr_eigval.get_mutable_data();
+        Float* means = arr_means.get_mutable_data();
+        Float* vars = arr_vars.get_mutable_data();
+
+        std::vector<double> inv_sigmas(column_count);
+        for (int64_t j = 0; j < column_count; j++) {
+            double squared_norm = 0.0;
+            for (int64_t i = 0; i < column_count; i++) {
+                squared_norm += double(factor[i * column_count + j]) * factor[i * column_count + j];
+            }
+            means[j] = Float(sum[j] / row_count);
+            vars[j] = Float(squared_norm / (row_count - 1.0));
+            inv_sigmas[j] = (vars[j] > Float(0)) ? 1.0 / std::sqrt(double(vars[j])) : 0.0;
+        }
+
+        std::vector<Float> scaled(column_count * column_count);
+        for (int64_t i = 0; i < column_count; i++) {
+            for (int64_t j = 0; j < column_count; j++) {
+                scaled[i * column_count + j] = Float(factor[i * column_count + j] * inv_sigmas[j]);
+            }
+        }
+
+        // The rows of sigma * V^T are ordered by the decreasing singular values
+        const auto scaled_factor = compute_svd_factor(scaled.data(), column_count, column_count);
+        const Float* sv = scaled_factor.get_data();
+        for (int64_t k = 0; k < component_count; k++) {
+            double squared_sigma = 0.0;
+            for (int64_t j = 0; j < column_count; j++) {
+                squared_sigma += double(sv[k * column_count + j]) * sv[k * column_count + j];
+            }
+            const double inv_sigma = (squared_sigma > 0.0) ? 1.0 / std::sqrt(squared_sigma) : 0.0;
+            for (int64_t j = 0; j < column_count; j++) {
+                eigvec[k * column_count + j] = Float(sv[k * column_count + j] * inv_sigma);
+            }
+            eigval[k] = Float(squared_sigma / (row_count - 1.0));
+            if (desc.get_deterministic()) {
+                flip_sign(eigvec + k * column_count, column_count);
+            }
+        }
+
+        // clang-format off
+        const auto mdl = model<task::dim_reduction>{}
+            .set_eigenvectors(
+                dal::detail::homogen_table_builder{}
+                    .reset(arr_eigvec, component_count, column_count)
+                    .build()
+            );
+
+        return train_result<task::dim_reduction>()
+            .set_model(mdl)
+            .set_eigenvalues(
+                dal::detail::homogen_table_builder{}
+                    .reset(arr_eigval, 1, component_count)
+                    .build()
+            )
+            .set_variances(
+                dal::detail::homogen_table_builder{}
+                    .reset(arr_vars, 1, column_count)
+                    .build()
+            )
+            .set_means(
+                dal::detail::homogen_table_builder{}
+                    .reset(arr_means, 1, column_count)
+                    .build()
+            );
+        // clang-format on
+    }
+};
+
+template struct finalize_train_kernel_cpu<float, method::svd, task::dim_reduction>;
+template struct finalize_train_kernel_cpu<double, method::svd, task::dim_reduction>;
+
+} // namespace oneapi::dal::pca::backend
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/pca/transform/pca_transform_kernel.h>
+
+#include "oneapi/dal/algo/pca/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+using dal::backend::context_cpu;
+
+namespace daal_pca_tr = daal::algorithms::pca::transform;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_pca_transform_kernel_t =
+    daal_pca_tr::internal::TransformKernel<Float, daal_pca_tr::defaultDense, Cpu>;
+
+/// The kernel folds the centering, the standardization and the whitening
+/// into the basis and the bias of one GEMM, so the data is read once
+template <typename Float, typename Task>
+static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
+                                           const descriptor_base<Task>& desc,
+                                           const model<Task>& trained_model,
+                                           const table& data) {
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t component_count = desc.get_component_count();
+
+    auto arr_result = array<Float>::empty(row_count * component_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_eigenvectors =
+        interop::convert_to_daal_table<Float>(trained_model.get_eigenvectors());
+    const auto daal_means = interop::convert_to_daal_table<Float>(trained_model.get_means());
+    const auto daal_variances =
+        interop::convert_to_daal_table<Float>(trained_model.get_variances());
+    const auto daal_eigenvalues =
+        desc.get_whiten() ? interop::convert_to_daal_table<Float>(trained_model.get_eigenvalues())
+                          : daal::data_management::NumericTablePtr{};
+    const auto daal_result =
+        interop::convert_to_daal_homogen_table(arr_result, row_count, component_count);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_pca_transform_kernel_t>(ctx,
+                                                                      *daal_data,
+                                                                      *daal_eigenvectors,
+                                                                      daal_means.get(),
+                                                                      daal_variances.get(),
+                                                                      daal_eigenvalues.get(),
+                                                                      *daal_result));
+
+    return infer_result<Task>().set_transformed_data(
+        dal::detail::homogen_table_builder{}.reset(arr_result, row_count, component_count).build());
+}
+
+template <typename Float, typename Task>
+infer_result<Task> infer_kernel_cpu<Float, Task>::operator()(
+    const context_cpu& ctx,
+    const descriptor_base<Task>& desc,
+    const infer_input<Task>& input) const {
+    return call_daal_kernel<Float, Task>(ctx, desc, input.get_model(), input.get_data());
+}
+
+template struct infer_kernel_cpu<float, task::dim_reduction>;
+template struct infer_kernel_cpu<double, task::dim_reduction>;
+
+} // namespace oneapi::dal::pca::backend
@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/pca/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/pca/partial_train_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/communicator.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+template <typename Float, typename Method, typename Task>
+struct partial_train_kernel_cpu {
+    partial_train_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                          const descriptor_base<Task>& params,
+                                          const partial_train_input<Task>& input) const;
+};
+
+template <typename Float, typename Method, typename Task>
+struct finalize_train_kernel_cpu {
+    train_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                  const descriptor_base<Task>& params,
+                                  const partial_train_result<Task>& input) const;
+};
+
+/// Gathers the partial results of all processes of the SPMD run and merges
+/// them on every process
+template <typename Float, typename Method, typename Task>
+struct spmd_merge_kernel_cpu {
+    partial_train_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                          const spmd::communicator& comm,
+                                          const partial_train_result<Task>& local_partial) const;
+};
+
+/// Returns the partial results of all processes in the order of the ranks.
+/// The p x p tables are the cross-products for the cov method and the factors
+/// for the svd method.
+template <typename Float, typename Task>
+std::vector<partial_train_result<Task>> allgather_partial_results(
+    const spmd::communicator& comm,
+    const partial_train_result<Task>& local_partial,
+    bool has_factor);
+
+/// Adds the moments of the block of rows to the cross-product of the prior
+/// partial result, the devices compute the block moments and reuse it
+template <typename Float, typename Task>
+partial_train_result<Task> merge_moments(const partial_train_result<Task>& prior,
+                                         const covariance_moments<Float>& block);
+
+/// Computes the p x p factor sigma * V^T of the SVD of the row_count x p
+/// row-major matrix, the matrices of row_count < p rows are padded with zeros
+template <typename Float>
+array<Float> compute_svd_factor(const Float* rows,
+                                std::int64_t row_count,
+                                std::int64_t column_count);
+
+} // namespace oneapi::dal::pca::backend
@@ -0,0 +1,264 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/include/algorithms/covariance/covariance_batch.h>
+
+#include "oneapi/dal/algo/pca/backend/cpu/partial_train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_cov = daal::algorithms::covariance;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+static covariance_moments<Float> compute_moments(const table& data) {
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+
+    covariance_moments<Float> moments;
+    moments.row_count = row_count;
+
+    // The covariance of the single row is not defined, its scatter is zero
+    if (row_count == 1) {
+        moments.means = row_accessor<const Float>{ data }.pull();
+        moments.covariance = array<Float>::zeros(column_count * column_count);
+        return moments;
+    }
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    daal_cov::Batch<Float, daal_cov::defaultDense> covariance_alg;
+    covariance_alg.input.set(daal_cov::data, daal_data);
+    interop::status_to_exception(covariance_alg.compute());
+
+    const auto daal_result = covariance_alg.getResult();
+    const auto means = interop::convert_from_daal_homogen_table<Float>(
+        daal_result->get(daal_cov::mean));
+    const auto covariance = interop::convert_from_daal_homogen_table<Float>(
+        daal_result->get(daal_cov::covariance));
+    moments.means = row_accessor<const Float>{ means }.pull();
+    moments.covariance = row_accessor<const Float>{ covariance }.pull();
+    return moments;
+}
+
+/// Merges the scatter matrices around the means of the prior rows and the block:
+/// S = S_p + (n_b - 1) C_b + n_p n_b / (n_p + n_b) (m_p - m_b) (m_p - m_b)^T
+template <typename Float, typename Task>
+partial_train_result<Task> merge_moments(const partial_train_result<Task>& prior,
+                                         const covariance_moments<Float>& block) {
+    const int64_t column_count = block.means.get_count();
+    const Float* block_means = block.means.get_data();
+    const Float* block_covariance = block.covariance.get_data();
+
+    double prior_row_count = 0.0;
+    if (prior.get_partial_n_rows().has_data()) {
+        prior_row_count = row_accessor<const double>{ prior.get_partial_n_rows() }.pull()[0];
+    }
+    const double block_row_count = double(block.row_count);
+    const double row_count = prior_row_count + block_row_count;
+
+    auto arr_n_rows = array<double>::full(1, row_count);
+    auto arr_sum = array<Float>::empty(column_count);
+    auto arr_crossproduct = array<Float>::empty(column_count * column_count);
+    Float* sum = arr_sum.get_mutable_data();
+    Float* crossproduct = arr_crossproduct.get_mutable_data();
+
+    for (int64_t i = 0; i < column_count * column_count; i++) {
+        crossproduct[i] = Float(double(block.row_count - 1) * block_covariance[i]);
+    }
+    for (int64_t j = 0; j < column_count; j++) {
+        sum[j] = Float(block_row_count * block_means[j]);
+    }
+
+    if (prior_row_count > 0.0) {
+        const auto prior_sum = row_accessor<const Float>{ prior.get_partial_sum() }.pull();
+        const auto prior_crossproduct =
+            row_accessor<const Float>{ prior.get_partial_crossproduct() }.pull();
+
+        std::vector<double> deviations(column_count);
+        for (int64_t j = 0; j < column_count; j++) {
+            deviations[j] = double(prior_sum[j]) / prior_row_count - block_means[j];
+            sum[j] += prior_sum[j];
+        }
+
+        const double weight = prior_row_count * block_row_count / row_count;
+        for (int64_t i = 0; i < column_count; i++) {
+            for (int64_t j = 0; j < column_count; j++) {
+                const int64_t ij = i * column_count + j;
+                crossproduct[ij] = Float(double(crossproduct[ij]) + prior_crossproduct[ij] +
+                                         weight * deviations[i] * deviations[j]);
+            }
+        }
+    }
+
+    // clang-format off
+    return partial_train_result<Task>()
+        .set_partial_n_rows(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_n_rows, 1, 1)
+                .build()
+        )
+        .set_partial_sum(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_sum, 1, column_count)
+                .build()
+        )
+        .set_partial_crossproduct(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_crossproduct, column_count, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+template <typename Float, typename Task>
+std::vector<partial_train_result<Task>> allgather_partial_results(
+    const spmd::communicator& comm,
+    const partial_train_result<Task>& local_partial,
+    bool has_factor) {
+    const table& local_matrix =
+        has_factor ? local_partial.get_partial_factor() : local_partial.get_partial_crossproduct();
+    const int64_t column_count = local_partial.get_partial_sum().get_column_count();
+    const int64_t matrix_size = column_count * column_count;
+    const int64_t packed_size = 1 + column_count + matrix_size;
+
+    // The partial results are small, so they are gathered as one packed
+    // array [n_rows, sum, matrix] per process
+    std::vector<double> packed(packed_size);
+    {
+        const auto n_rows = row_accessor<const double>{ local_partial.get_partial_n_rows() }.pull();
+        const auto sum = row_accessor<const double>{ local_partial.get_partial_sum() }.pull();
+        const auto matrix = row_accessor<const double>{ local_matrix }.pull();
+        packed[0] = n_rows[0];
+        std::copy(sum.get_data(), sum.get_data() + column_count, packed.data() + 1);
+        std::copy(matrix.get_data(),
+                  matrix.get_data() + matrix_size,
+                  packed.data() + 1 + column_count);
+    }
+    const auto gathered = comm.allgather(packed.data(), packed_size);
+
+    std::vector<partial_train_result<Task>> partials;
+    for (int64_t rank = 0; rank < comm.get_rank_count(); rank++) {
+        const double* rank_packed = gathered.data() + rank * packed_size;
+        auto arr_n_rows = array<double>::full(1, rank_packed[0]);
+        auto arr_sum = array<Float>::empty(column_count);
+        auto arr_matrix = array<Float>::empty(matrix_size);
+        std::copy(rank_packed + 1, rank_packed + 1 + column_count, arr_sum.get_mutable_data());
+        std::copy(rank_packed + 1 + column_count,
+                  rank_packed + packed_size,
+                  arr_matrix.get_mutable_data());
+
+        const auto matrix = dal::detail::homogen_table_builder{}
+                                .reset(arr_matrix, column_count, column_count)
+                                .build();
+        auto partial = partial_train_result<Task>()
+                           .set_partial_n_rows(
+                               dal::detail::homogen_table_builder{}.reset(arr_n_rows, 1, 1).build())
+                           .set_partial_sum(dal::detail::homogen_table_builder{}
+                                                .reset(arr_sum, 1, column_count)
+                                                .build());
+        if (has_factor) {
+            partial.set_partial_factor(matrix);
+        }
+        else {
+            partial.set_partial_crossproduct(matrix);
+        }
+        partials.push_back(partial);
+    }
+    return partials;
+}
+
+template <typename Float>
+struct spmd_merge_kernel_cpu<Float, method::cov, task::dim_reduction> {
+    partial_train_result<task::dim_reduction> operator()(
+        const context_cpu& ctx,
+        const spmd::communicator& comm,
+        const partial_train_result<task::dim_reduction>& local_partial) const {
+        const auto partials =
+            allgather_partial_results<Float>(comm, local_partial, /* has_factor = */ false);
+        const int64_t column_count = local_partial.get_partial_sum().get_column_count();
+
+        // The partial results of the other processes are added as the moments
+        // of the blocks of rows
+        partial_train_result<task::dim_reduction> result = partials.front();
+        for (std::size_t i = 1; i < partials.size(); i++) {
+            const double row_count =
+                row_accessor<const double>{ partials[i].get_partial_n_rows() }.pull()[0];
+            const auto sum = row_accessor<const Float>{ partials[i].get_partial_sum() }.pull();
+            const auto crossproduct =
+                row_accessor<const Float>{ partials[i].get_partial_crossproduct() }.pull();
+
+            covariance_moments<Float> moments;
+            moments.row_count = int64_t(row_count);
+            moments.means = array<Float>::empty(column_count);
+            moments.covariance = array<Float>::zeros(column_count * column_count);
+            Float* means = moments.means.get_mutable_data();
+            for (int64_t j = 0; j < column_count; j++) {
+                means[j] = Float(sum[j] / row_count);
+            }
+            if (row_count > 1.0) {
+                Float* covariance = moments.covariance.get_mutable_data();
+                for (int64_t k = 0; k < column_count * column_count; k++) {
+                    covariance[k] = Float(crossproduct[k] / (row_count - 1.0));
+                }
+            }
+            result = merge_moments<Float>(result, moments);
+        }
+        return result;
+    }
+};
+
+template <typename Float>
+struct partial_train_kernel_cpu<Float, method::cov, task::dim_reduction> {
+    partial_train_result<task::dim_reduction> operator()(
+        const context_cpu& ctx,
+        const descriptor_base<task::dim_reduction>& desc,
+        const partial_train_input<task::dim_reduction>& input) const {
+        const auto block = compute_moments<Float>(input.get_data());
+        return merge_moments<Float>(input.get_prior(), block);
+    }
+};
+
+template struct partial_train_kernel_cpu<float, method::cov, task::dim_reduction>;
+template struct partial_train_kernel_cpu<double, method::cov, task::dim_reduction>;
+
+template struct spmd_merge_kernel_cpu<float, method::cov, task::dim_reduction>;
+template struct spmd_merge_kernel_cpu<double, method::cov, task::dim_reduction>;
+
+template std::vector<partial_train_result<task::dim_reduction>> allgather_partial_results<float>(
+    const spmd::communicator&,
+    const partial_train_result<task::dim_reduction>&,
+    bool);
+template std::vector<partial_train_result<task::dim_reduction>> allgather_partial_results<double>(
+    const spmd::communicator&,
+    const partial_train_result<task::dim_reduction>&,
+    bool);
+
+template partial_train_result<task::dim_reduction> merge_moments(
+    const partial_train_result<task::dim_reduction>&,
+    const covariance_moments<float>&);
+template partial_train_result<task::dim_reduction> merge_moments(
+    const partial_train_result<task::dim_reduction>&,
+    const covariance_moments<double>&);
+
+} // namespace oneapi::dal::pca::backend
@@ -0,0 +1,248 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <algorithm>
+
+#include <daal/include/algorithms/svd/svd_batch.h>
+
+#include "oneapi/dal/algo/pca/backend/cpu/partial_train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_svd = daal::algorithms::svd;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+static array<Float> pull_to_host(const daal::data_management::NumericTablePtr& daal_table) {
+    return row_accessor<const Float>{ interop::convert_from_daal_homogen_table<Float>(daal_table) }
+        .pull();
+}
+
+template <typename Float>
+array<Float> compute_svd_factor(const Float* rows, int64_t row_count, int64_t column_count) {
+    // The DAAL SVD needs at least as many rows as columns, the zero rows do
+    // not change the singular values and the right singular vectors
+    const int64_t padded_row_count = std::max(row_count, column_count);
+    auto arr_rows = array<Float>::zeros(padded_row_count * column_count);
+    std::copy(rows, rows + row_count * column_count, arr_rows.get_mutable_data());
+
+    const auto daal_rows =
+        interop::convert_to_daal_homogen_table(arr_rows, padded_row_count, column_count);
+
+    daal_svd::Batch<Float> svd_alg;
+    svd_alg.parameter.leftSingularMatrix = daal_svd::notRequired;
+    svd_alg.input.set(daal_svd::data, daal_rows);
+    interop::status_to_exception(svd_alg.compute());
+
+    const auto daal_result = svd_alg.getResult();
+    const auto sigma = pull_to_host<Float>(daal_result->get(daal_svd::singularValues));
+    const auto vt = pull_to_host<Float>(daal_result->get(daal_svd::rightSingularMatrix));
+
+    auto arr_factor = array<Float>::empty(column_count * column_count);
+    Float* factor = arr_factor.get_mutable_data();
+    for (int64_t i = 0; i < column_count; i++) {
+        for (int64_t j = 0; j < column_count; j++) {
+            factor[i * column_count + j] = sigma[i] * vt[i * column_count + j];
+        }
+    }
+    return arr_factor;
+}
+
+/// Merges the SVD of the prior rows and the block: the factor of the rows
+/// centered around the mean of all rows is the factor of the stacked matrix
+/// [F_p; sqrt(n_p n_b / (n_p + n_b)) (m_p - m_b)^T; X_b - 1 m_b^T]
+template <typename Float>
+static partial_train_result<task::dim_reduction> merge_svd(
+    const partial_train_result<task::dim_reduction>& prior,
+    const table& data) {
+    const int64_t block_row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+    const auto block = row_accessor<const Float>{ data }.pull();
+
+    double prior_row_count = 0.0;
+    if (prior.get_partial_n_rows().has_data()) {
+        prior_row_count = row_accessor<const double>{ prior.get_partial_n_rows() }.pull()[0];
+    }
+    const double row_count = prior_row_count + double(block_row_count);
+
+    std::vector<double> block_means(column_count, 0.0);
+    for (int64_t i = 0; i < block_row_count; i++) {
+        for (int64_t j = 0; j < column_count; j++) {
+            block_means[j] += block[i * column_count + j];
+        }
+    }
+
+    auto arr_n_rows = array<double>::full(1, row_count);
+    auto arr_sum = array<Float>::empty(column_count);
+    Float* sum = arr_sum.get_mutable_data();
+    for (int64_t j = 0; j < column_count; j++) {
+        sum[j] = Float(block_means[j]);
+        block_means[j] /= double(block_row_count);
+    }
+
+    const int64_t prior_factor_row_count = (prior_row_count > 0.0) ? column_count + 1 : 0;
+    const int64_t stacked_row_count = prior_factor_row_count + block_row_count;
+    std::vector<Float> stacked(stacked_row_count * column_count);
+
+    if (prior_row_count > 0.0) {
+        const auto prior_sum = row_accessor<const Float>{ prior.get_partial_sum() }.pull();
+        const auto prior_factor = row_accessor<const Float>{ prior.get_partial_factor() }.pull();
+        std::copy(prior_factor.get_data(),
+                  prior_factor.get_data() + column_count * column_count,
+                  stacked.data());
+
+        const double weight = std::sqrt(prior_row_count * double(block_row_count) / row_count);
+        Float* correction = stacked.data() + column_count * column_count;
+        for (int64_t j = 0; j < column_count; j++) {
+            correction[j] = Float(weight * (prior_sum[j] / prior_row_count - block_means[j]));
+            sum[j] += prior_sum[j];
+        }
+    }
+
+    Float* centered = stacked.data() + prior_factor_row_count * column_count;
+    for (int64_t i = 0; i < block_row_count; i++) {
+        for (int64_t j = 0; j < column_count; j++) {
+            centered[i * column_count + j] = Float(block[i * column_count + j] - block_means[j]);
+        }
+    }
+
+    auto arr_factor = compute_svd_factor(stacked.data(), stacked_row_count, column_count);
+
+    // clang-format off
+    return partial_train_result<task::dim_reduction>()
+        .set_partial_n_rows(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_n_rows, 1, 1)
+                .build()
+        )
+        .set_partial_sum(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_sum, 1, column_count)
+                .build()
+        )
+        .set_partial_factor(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_factor, column_count, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+/// Merges the SVD of two disjoint sets of rows, the factor of the rows centered
+/// around the mean of all rows is the factor of the stacked matrix
+/// [F_a; sqrt(n_a n_b / (n_a + n_b)) (m_a - m_b)^T; F_b]
+template <typename Float>
+static partial_train_result<task::dim_reduction> merge_svd_factors(
+    const partial_train_result<task::dim_reduction>& a,
+    const partial_train_result<task::dim_reduction>& b) {
+    const int64_t column_count = a.get_partial_sum().get_column_count();
+    const double a_row_count = row_accessor<const double>{ a.get_partial_n_rows() }.pull()[0];
+    const double b_row_count = row_accessor<const double>{ b.get_partial_n_rows() }.pull()[0];
+    const double row_count = a_row_count + b_row_count;
+
+    const auto a_sum = row_accessor<const Float>{ a.get_partial_sum() }.pull();
+    const auto b_sum = row_accessor<const Float>{ b.get_partial_sum() }.pull();
+    const auto a_factor = row_accessor<const Float>{ a.get_partial_factor() }.pull();
+    const auto b_factor = row_accessor<const Float>{ b.get_partial_factor() }.pull();
+
+    const int64_t factor_size = column_count * column_count;
+    const int64_t stacked_row_count = 2 * column_count + 1;
+    std::vector<Float> stacked(stacked_row_count * column_count);
+    std::copy(a_factor.get_data(), a_factor.get_data() + factor_size, stacked.data());
+    std::copy(b_factor.get_data(),
+              b_factor.get_data() + factor_size,
+              stacked.data() + factor_size + column_count);
+
+    auto arr_n_rows = array<double>::full(1, row_count);
+    auto arr_sum = array<Float>::empty(column_count);
+    Float* sum = arr_sum.get_mutable_data();
+    Float* correction = stacked.data() + factor_size;
+    const double weight = std::sqrt(a_row_count * b_row_count / row_count);
+    for (int64_t j = 0; j < column_count; j++) {
+        correction[j] = Float(weight * (a_sum[j] / a_row_count - b_sum[j] / b_row_count));
+        sum[j] = a_sum[j] + b_sum[j];
+    }
+
+    auto arr_factor = compute_svd_factor(stacked.data(), stacked_row_count, column_count);
+
+    // clang-format off
+    return partial_train_result<task::dim_reduction>()
+        .set_partial_n_rows(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_n_rows, 1, 1)
+                .build()
+        )
+        .set_partial_sum(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_sum, 1, column_count)
+                .build()
+        )
+        .set_partial_factor(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_factor, column_count, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+template <typename Float>
+struct spmd_merge_kernel_cpu<Float, method::svd, task::dim_reduction> {
+    partial_train_result<task::dim_reduction> operator()(
+        const context_cpu& ctx,
+        const spmd::communicator& comm,
+        const partial_train_result<task::dim_reduction>& local_partial) const {
+        const auto partials =
+            allgather_partial_results<Float>(comm, local_partial, /* has_factor = */ true);
+
+        // The pairwise merges in the order of the ranks give the same factor
+        // on every process
+        partial_train_result<task::dim_reduction> result = partials.front();
+        for (std::size_t i = 1; i < partials.size(); i++) {
+            result = merge_svd_factors<Float>(result, partials[i]);
+        }
+        return result;
+    }
+};
+
+template <typename Float>
+struct partial_train_kernel_cpu<Float, method::svd, task::dim_reduction> {
+    partial_train_result<task::dim_reduction> operator()(
+        const context_cpu& ctx,
+        const descriptor_base<task::dim_reduction>& desc,
+        const partial_train_input<task::dim_reduction>& input) const {
+        return merge_svd<Float>(input.get_prior(), input.get_data());
+    }
+};
+
+template struct partial_train_kernel_cpu<float, method::svd, task::dim_reduction>;
+template struct partial_train_kernel_cpu<double, method::svd, task::dim_reduction>;
+
+template struct spmd_merge_kernel_cpu<float, method::svd, task::dim_reduction>;
+template struct spmd_merge_kernel_cpu<double, method::svd, task::dim_reduction>;
+
+template array<float> compute_svd_factor(const float*, int64_t, int64_t);
+template array<double> compute_svd_factor(const double*, int64_t, int64_t);
+
+} // namespace oneapi::dal::pca::backend
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <vector>
+
+#include <daal/src/algorithms/svd/svd_dense_randomized_kernel.h>
+
 #include "oneapi/dal/algo/pca/train_types.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 
@@ -28,4 +32,37 @@ struct train_kernel_cpu {
                                   const train_input<Task>& input) const;
 };
 
+/// The means and the covariance matrix of the block of rows in the host memory
+template <typename Float>
+struct covariance_moments {
+    std::int64_t row_count = 0;
+    array<Float> means;
+    array<Float> covariance;
+};
+
+/// Combines the moments of the blocks of rows and computes the principal
+/// components of all rows
+template <typename Float, typename Task>
+struct train_from_moments_kernel_cpu {
+    train_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                  const descriptor_base<Task>& params,
+                                  const std::vector<covariance_moments<Float>>& moments) const;
+};
+
+/// The parameters of the randomized range finder: the oversampled columns
+/// and the power iterations keep the accuracy of the last components for the
+/// slowly decaying spectra, the fixed seed makes the results reproducible
+inline daal::algorithms::svd::internal::RandomizedParameter make_randomized_parameter(
+    std::int64_t component_count) {
+    constexpr std::size_t oversample_count = 10;
+    constexpr std::size_t power_iteration_count = 4;
+    constexpr std::size_t seed = 777;
+    return daal::algorithms::svd::internal::RandomizedParameter{
+        static_cast<std::size_t>(component_count),
+        oversample_count,
+        power_iteration_count,
+        seed
+    };
+}
+
 } // namespace oneapi::dal::pca::backend
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+
 #include <daal/src/algorithms/pca/pca_dense_correlation_batch_kernel.h>
 
 #include "oneapi/dal/algo/pca/backend/cpu/train_kernel.hpp"
@@ -39,11 +41,9 @@ template <typename Float, typename Task>
 static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const descriptor_base<Task>& desc,
                                            const table& data) {
-    const int64_t row_count = data.get_row_count();
     const int64_t column_count = data.get_column_count();
     const int64_t component_count = desc.get_component_count();
 
-    auto arr_data = row_accessor<const Float>{ data }.pull();
     auto arr_eigvec = array<Float>::empty(column_count * component_count);
     auto arr_eigval = array<Float>::empty(1 * component_count);
     auto arr_means = array<Float>::empty(1 * column_count);
@@ -52,9 +52,8 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
     // TODO: read-only access performed with deep copy of data since daal numeric tables are mutable.
     // Need to create special immutable homogen table on daal interop side
 
-    // TODO: data is table, not a homogen_table. Think better about accessor - is it enough to have just a row_accessor?
-    const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+    // Column-major data is passed to the covariance kernel as the SOA table with no transpose
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
     const auto daal_eigenvectors =
         interop::convert_to_daal_homogen_table(arr_eigvec, component_count, column_count);
     const auto daal_eigenvalues =
@@ -129,4 +128,133 @@ struct train_kernel_cpu<Float, method::cov, task::dim_reduction> {
 template struct train_kernel_cpu<float, method::cov, task::dim_reduction>;
 template struct train_kernel_cpu<double, method::cov, task::dim_reduction>;
 
+/// Combines the covariance matrices of the blocks around the mean of all rows:
+/// (n - 1) C = sum_i [ (n_i - 1) C_i + n_i (m_i - m) (m_i - m)^T ]
+template <typename Float>
+static void combine_moments(const std::vector<covariance_moments<Float>>& moments,
+                            std::int64_t column_count,
+                            Float* means,
+                            Float* covariance) {
+    std::int64_t row_count = 0;
+    for (const auto& part : moments) {
+        row_count += part.row_count;
+    }
+
+    for (std::int64_t j = 0; j < column_count; j++) {
+        double mean = 0.0;
+        for (const auto& part : moments) {
+            mean += double(part.row_count) * part.means[j];
+        }
+        means[j] = Float(mean / row_count);
+    }
+
+    std::vector<double> deviations(column_count);
+    std::vector<double> scatter(column_count * column_count, 0.0);
+    for (const auto& part : moments) {
+        const Float* part_covariance = part.covariance.get_data();
+        for (std::int64_t j = 0; j < column_count; j++) {
+            deviations[j] = double(part.means[j]) - means[j];
+        }
+        for (std::int64_t i = 0; i < column_count; i++) {
+            for (std::int64_t j = 0; j < column_count; j++) {
+                scatter[i * column_count + j] +=
+                    double(part.row_count - 1) * part_covariance[i * column_count + j] +
+                    double(part.row_count) * deviations[i] * deviations[j];
+            }
+        }
+    }
+
+    for (std::int64_t i = 0; i < column_count * column_count; i++) {
+        covariance[i] = Float(scatter[i] / (row_count - 1));
+    }
+}
+
+template <typename Float, typename Task>
+train_result<Task> train_from_moments_kernel_cpu<Float, Task>::operator()(
+    const context_cpu& ctx,
+    const descriptor_base<Task>& desc,
+    const std::vector<covariance_moments<Float>>& moments) const {
+    const int64_t column_count = moments.front().means.get_count();
+    const int64_t component_count = desc.get_component_count();
+
+    auto arr_eigvec = array<Float>::empty(column_count * component_count);
+    auto arr_eigval = array<Float>::empty(1 * component_count);
+    auto arr_means = array<Float>::empty(1 * column_count);
+    auto arr_vars = array<Float>::empty(1 * column_count);
+    auto arr_cor = array<Float>::empty(column_count * column_count);
+
+    Float* cor = arr_cor.get_mutable_data();
+    Float* vars = arr_vars.get_mutable_data();
+    combine_moments(moments, column_count, arr_means.get_mutable_data(), cor);
+
+    // The same transformation as the one of the covariance kernel
+    std::vector<Float> inv_sqrts(column_count);
+    for (int64_t i = 0; i < column_count; i++) {
+        vars[i] = cor[i * column_count + i];
+        inv_sqrts[i] = Float(1) / std::sqrt(vars[i]);
+    }
+    for (int64_t i = 0; i < column_count; i++) {
+        for (int64_t j = 0; j < column_count; j++) {
+            cor[i * column_count + j] =
+                (i == j) ? Float(1) : cor[i * column_count + j] * inv_sqrts[i] * inv_sqrts[j];
+        }
+    }
+
+    const auto daal_cor = interop::convert_to_daal_homogen_table(arr_cor, column_count, column_count);
+    const auto daal_eigenvectors =
+        interop::convert_to_daal_homogen_table(arr_eigvec, component_count, column_count);
+    const auto daal_eigenvalues =
+        interop::convert_to_daal_homogen_table(arr_eigval, 1, component_count);
+    const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, column_count);
+    const auto daal_variances = interop::convert_to_daal_homogen_table(arr_vars, 1, column_count);
+
+    // The means and the variances are already computed, so only the
+    // eigenvalues are requested
+    constexpr bool is_correlation = true;
+    constexpr uint64_t results_to_compute = int64_t(daal_pca::eigenvalue);
+    daal_cov::BatchImpl* no_covariance_alg = nullptr;
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_pca_cor_kernel_t>(ctx,
+                                                                is_correlation,
+                                                                desc.get_deterministic(),
+                                                                *daal_cor,
+                                                                no_covariance_alg,
+                                                                results_to_compute,
+                                                                *daal_eigenvectors,
+                                                                *daal_eigenvalues,
+                                                                *daal_means,
+                                                                *daal_variances));
+
+    // clang-format off
+    const auto mdl = model<Task>{}
+        .set_eigenvectors(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_eigvec, component_count, column_count)
+                .build()
+        );
+
+    return train_result<Task>()
+        .set_model(mdl)
+        .set_eigenvalues(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_eigval, 1, component_count)
+                .build()
+        )
+        .set_variances(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_vars, 1, column_count)
+                .build()
+        )
+        .set_means(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_means, 1, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+template struct train_from_moments_kernel_cpu<float, task::dim_reduction>;
+template struct train_from_moments_kernel_cpu<double, task::dim_reduction>;
+
 } // namespace oneapi::dal::pca::backend
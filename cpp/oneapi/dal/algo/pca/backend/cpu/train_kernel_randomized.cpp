@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/pca/pca_dense_randomized_batch_kernel.h>
+
+#include "oneapi/dal/algo/pca/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_pca = daal::algorithms::pca;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_pca_randomized_kernel_t = daal_pca::internal::PCARandomizedKernel<Float, Cpu>;
+
+template <typename Float, typename Task>
+static train_result<Task> call_daal_kernel(const context_cpu& ctx,
+                                           const descriptor_base<Task>& desc,
+                                           const table& data) {
+    const int64_t column_count = data.get_column_count();
+    const int64_t component_count = desc.get_component_count();
+
+    auto arr_eigvec = array<Float>::empty(column_count * component_count);
+    auto arr_eigval = array<Float>::empty(1 * component_count);
+    auto arr_means = array<Float>::empty(1 * column_count);
+    auto arr_vars = array<Float>::empty(1 * column_count);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_eigenvectors =
+        interop::convert_to_daal_homogen_table(arr_eigvec, component_count, column_count);
+    const auto daal_eigenvalues =
+        interop::convert_to_daal_homogen_table(arr_eigval, 1, component_count);
+    const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, column_count);
+    const auto daal_variances = interop::convert_to_daal_homogen_table(arr_vars, 1, column_count);
+
+    const auto par = make_randomized_parameter(component_count);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_pca_randomized_kernel_t>(ctx,
+                                                                       desc.get_deterministic(),
+                                                                       *daal_data,
+                                                                       par,
+                                                                       *daal_eigenvectors,
+                                                                       *daal_eigenvalues,
+                                                                       *daal_means,
+                                                                       *daal_variances));
+
+    // clang-format off
+    const auto mdl = model<Task>{}
+        .set_eigenvectors(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_eigvec, component_count, column_count)
+                .build()
+        );
+
+    return train_result<Task>()
+        .set_model(mdl)
+        .set_eigenvalues(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_eigval, 1, component_count)
+                .build()
+        )
+        .set_variances(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_vars, 1, column_count)
+                .build()
+        )
+        .set_means(
+            dal::detail::homogen_table_builder{}
+                .reset(arr_means, 1, column_count)
+                .build()
+        );
+    // clang-format on
+}
+
+template <typename Float, typename Task>
+static train_result<Task> train(const context_cpu& ctx,
+                                const descriptor_base<Task>& desc,
+                                const train_input<Task>& input) {
+    return call_daal_kernel<Float, Task>(ctx, desc, input.get_data());
+}
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::randomized, task::dim_reduction> {
+    train_result<task::dim_reduction> operator()(
+        const context_cpu& ctx,
+        const descriptor_base<task::dim_reduction>& desc,
+        const train_input<task::dim_reduction>& input) const {
+        return train<Float, task::dim_reduction>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_cpu<float, method::randomized, task::dim_reduction>;
+template struct train_kernel_cpu<double, method::randomized, task::dim_reduction>;
+
+} // namespace oneapi::dal::pca::backend
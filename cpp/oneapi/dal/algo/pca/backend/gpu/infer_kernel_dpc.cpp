@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/src/algorithms/pca/transform/oneapi/pca_transform_dense_default_batch_oneapi.h>
+
+#include "oneapi/dal/algo/pca/backend/gpu/infer_kernel.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+using dal::backend::context_gpu;
+
+namespace daal_pca_tr = daal::algorithms::pca::transform;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_pca_transform_kernel_t =
+    daal_pca_tr::oneapi::internal::TransformKernelOneAPI<Float, daal_pca_tr::defaultDense>;
+
+template <typename Float>
+static auto convert_to_daal_sycl_table(sycl::queue& queue, const table& t) {
+    auto arr = row_accessor<const Float>{ t }.pull(queue);
+    return interop::convert_to_daal_sycl_homogen_table(queue,
+                                                       arr,
+                                                       t.get_row_count(),
+                                                       t.get_column_count());
+}
+
+/// The kernel folds the centering, the standardization and the whitening
+/// into the basis and the bias of one GEMM, so the data is read once
+template <typename Float, typename Task>
+static infer_result<Task> call_daal_kernel(const context_gpu& ctx,
+                                           const descriptor_base<Task>& desc,
+                                           const model<Task>& trained_model,
+                                           const table& data) {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t component_count = desc.get_component_count();
+
+    auto arr_result = array<Float>::empty(queue, row_count * component_count);
+
+    const auto daal_data = convert_to_daal_sycl_table<Float>(queue, data);
+    const auto daal_eigenvectors =
+        convert_to_daal_sycl_table<Float>(queue, trained_model.get_eigenvectors());
+    const auto daal_means = convert_to_daal_sycl_table<Float>(queue, trained_model.get_means());
+    const auto daal_variances =
+        convert_to_daal_sycl_table<Float>(queue, trained_model.get_variances());
+    const auto daal_eigenvalues =
+        desc.get_whiten()
+            ? convert_to_daal_sycl_table<Float>(queue, trained_model.get_eigenvalues())
+            : decltype(daal_means){};
+    const auto daal_result = interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                         arr_result,
+                                                                         row_count,
+                                                                         component_count);
+
+    daal_pca_transform_kernel_t<Float> daal_kernel;
+    interop::status_to_exception(daal_kernel.compute(*daal_data,
+                                                     *daal_eigenvectors,
+                                                     daal_means.get(),
+                                                     daal_variances.get(),
+                                                     daal_eigenvalues.get(),
+                                                     *daal_result));
+
+    return infer_result<Task>().set_transformed_data(
+        dal::detail::homogen_table_builder{}.reset(arr_result, row_count, component_count).build());
+}
+
+template <typename Float, typename Task>
+infer_result<Task> infer_kernel_gpu<Float, Task>::operator()(
+    const context_gpu& ctx,
+    const descriptor_base<Task>& desc,
+    const infer_input<Task>& input) const {
+    return call_daal_kernel<Float, Task>(ctx, desc, input.get_model(), input.get_data());
+}
+
+template struct infer_kernel_gpu<float, task::dim_reduction>;
+template struct infer_kernel_gpu<double, task::dim_reduction>;
+
+} // namespace oneapi::dal::pca::backend
@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/pca/backend/gpu/partial_train_kernel.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+using dal::backend::context_gpu;
+
+/// The moments of the block are computed on the device, only the p x p
+/// cross-product is merged on the host
+template <typename Float>
+struct partial_train_kernel_gpu<Float, method::cov, task::dim_reduction> {
+    partial_train_result<task::dim_reduction> operator()(
+        const context_gpu& ctx,
+        const descriptor_base<task::dim_reduction>& desc,
+        const partial_train_input<task::dim_reduction>& input) const {
+        const auto block = moments_kernel_gpu<Float>{}(ctx, input.get_data());
+        return merge_moments<Float>(input.get_prior(), block);
+    }
+};
+
+template struct partial_train_kernel_gpu<float, method::cov, task::dim_reduction>;
+template struct partial_train_kernel_gpu<double, method::cov, task::dim_reduction>;
+
+} // namespace oneapi::dal::pca::backend
@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/pca/backend/gpu/partial_train_kernel.hpp"
+
+namespace oneapi::dal::pca::backend {
+
+using dal::backend::context_cpu;
+using dal::backend::context_gpu;
+
+/// The block with the prior factor is decomposed by the host SVD, the rows
+/// of the block are pulled to the host once
+template <typename Float>
+struct partial_train_kernel_gpu<Float, method::svd, task::dim_reduction> {
+    partial_train_result<task::dim_reduction> operator()(
+        const context_gpu& ctx,
+        const descriptor_base<task::dim_reduction>& desc,
+        const partial_train_input<task::dim_reduction>& input) const {
+        const auto cpu_ctx = context_cpu{ dal::detail::host_policy{} };
+        return partial_train_kernel_cpu<Float, method::svd, task::dim_reduction>{}(cpu_ctx,
+                                                                                  desc,
+                                                                                  input);
+    }
+};
+
+template struct partial_train_kernel_gpu<float, method::svd, task::dim_reduction>;
+template struct partial_train_kernel_gpu<double, method::svd, task::dim_reduction>;
+
+} // namespace oneapi::dal::pca::backend
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/algo/pca/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/algo/pca/train_types.hpp"
 #include "oneapi/dal/backend/dispatcher_dpc.hpp"
 
@@ -28,4 +29,11 @@ struct train_kernel_gpu {
                                   const train_input<Task>& input) const;
 };
 
+/// Computes the means and the covariance matrix of the rows on the device
+template <typename Float>
+struct moments_kernel_gpu {
+    covariance_moments<Float> operator()(const dal::backend::context_gpu& ctx,
+                                         const table& data) const;
+};
+
 } // namespace oneapi::dal::pca::backend
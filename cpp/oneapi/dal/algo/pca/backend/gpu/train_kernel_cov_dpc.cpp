@@ -159,4 +159,38 @@ struct train_kernel_gpu<Float, method::cov, task::dim_reduction> {
 template struct train_kernel_gpu<float, method::cov, task::dim_reduction>;
 template struct train_kernel_gpu<double, method::cov, task::dim_reduction>;
 
+template <typename Float>
+static array<Float> pull_to_host(const daal::data_management::NumericTablePtr& daal_table) {
+    return row_accessor<const Float>{ interop::convert_from_daal_homogen_table<Float>(daal_table) }
+        .pull();
+}
+
+template <typename Float>
+covariance_moments<Float> moments_kernel_gpu<Float>::operator()(const context_gpu& ctx,
+                                                               const table& data) const {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue);
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, column_count);
+
+    daal_cov::Batch<Float, daal_cov::defaultDense> covariance_alg;
+    covariance_alg.input.set(daal_cov::data, daal_data);
+    interop::status_to_exception(covariance_alg.compute());
+
+    const auto daal_result = covariance_alg.getResult();
+    covariance_moments<Float> moments;
+    moments.row_count = row_count;
+    moments.means = pull_to_host<Float>(daal_result->get(daal_cov::mean));
+    moments.covariance = pull_to_host<Float>(daal_result->get(daal_cov::covariance));
+    return moments;
+}
+
+template struct moments_kernel_gpu<float>;
+template struct moments_kernel_gpu<double>;
+
 } // namespace oneapi::dal::pca::backend
@@ -16,6 +16,7 @@
 
 #include "oneapi/dal/algo/pca/common.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/detail/table_serialization.hpp"
 
 namespace oneapi::dal::pca {
 
@@ -24,12 +25,16 @@ class detail::descriptor_impl<task::dim_reduction> : public base {
 public:
     std::int64_t component_count = -1;
     bool deterministic = false;
+    bool whiten = false;
 };
 
 template <>
 class detail::model_impl<task::dim_reduction> : public base {
 public:
     table eigenvectors;
+    table means;
+    table variances;
+    table eigenvalues;
 };
 
 using detail::descriptor_impl;
@@ -48,6 +53,11 @@ bool descriptor_base<task::dim_reduction>::get_deterministic() const {
     return impl_->deterministic;
 }
 
+template <>
+bool descriptor_base<task::dim_reduction>::get_whiten() const {
+    return impl_->whiten;
+}
+
 template <>
 void descriptor_base<task::dim_reduction>::set_component_count_impl(std::int64_t value) {
     if (value < 0) {
@@ -61,6 +71,11 @@ void descriptor_base<task::dim_reduction>::set_deterministic_impl(bool value) {
     impl_->deterministic = value;
 }
 
+template <>
+void descriptor_base<task::dim_reduction>::set_whiten_impl(bool value) {
+    impl_->whiten = value;
+}
+
 template <typename Task>
 model<Task>::model() : impl_(new model_impl{}) {}
 
@@ -69,11 +84,59 @@ table model<Task>::get_eigenvectors() const {
     return impl_->eigenvectors;
 }
 
+template <typename Task>
+table model<Task>::get_means() const {
+    return impl_->means;
+}
+
+template <typename Task>
+table model<Task>::get_variances() const {
+    return impl_->variances;
+}
+
+template <typename Task>
+table model<Task>::get_eigenvalues() const {
+    return impl_->eigenvalues;
+}
+
 template <typename Task>
 void model<Task>::set_eigenvectors_impl(const table& value) {
     impl_->eigenvectors = value;
 }
 
+template <typename Task>
+void model<Task>::set_means_impl(const table& value) {
+    impl_->means = value;
+}
+
+template <typename Task>
+void model<Task>::set_variances_impl(const table& value) {
+    impl_->variances = value;
+}
+
+template <typename Task>
+void model<Task>::set_eigenvalues_impl(const table& value) {
+    impl_->eigenvalues = value;
+}
+
+template <typename Task>
+void model<Task>::serialize(dal::detail::binary_output_archive& ar) const {
+    ar.write(dal::detail::serialization_id::pca_dim_reduction_model);
+    dal::detail::serialize_table(impl_->eigenvectors, ar);
+    dal::detail::serialize_table(impl_->means, ar);
+    dal::detail::serialize_table(impl_->variances, ar);
+    dal::detail::serialize_table(impl_->eigenvalues, ar);
+}
+
+template <typename Task>
+void model<Task>::deserialize(dal::detail::binary_input_archive& ar) {
+    ar.expect(dal::detail::serialization_id::pca_dim_reduction_model);
+    impl_->eigenvectors = dal::detail::deserialize_table(ar);
+    impl_->means = dal::detail::deserialize_table(ar);
+    impl_->variances = dal::detail::deserialize_table(ar);
+    impl_->eigenvalues = dal::detail::deserialize_table(ar);
+}
+
 template class ONEAPI_DAL_EXPORT descriptor_base<task::dim_reduction>;
 template class ONEAPI_DAL_EXPORT model<task::dim_reduction>;
 
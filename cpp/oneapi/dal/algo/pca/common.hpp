@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/detail/archives.hpp"
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/table/common.hpp"
 
@@ -39,6 +40,9 @@ class model_impl;
 namespace method {
 struct cov {};
 struct svd {};
+/// The top components of the correlation matrix found with the randomized
+/// truncated SVD of the standardized data, O(n * p * k) instead of O(n * p^2)
+struct randomized {};
 using by_default = cov;
 } // namespace method
 
@@ -54,10 +58,12 @@ public:
 
     auto get_component_count() const -> std::int64_t;
     auto get_deterministic() const -> bool;
+    auto get_whiten() const -> bool;
 
 protected:
     void set_component_count_impl(std::int64_t value);
     void set_deterministic_impl(bool value);
+    void set_whiten_impl(bool value);
 
     dal::detail::pimpl<detail::descriptor_impl<task_t>> impl_;
 };
@@ -79,6 +85,12 @@ public:
         descriptor_base<Task>::set_deterministic_impl(value);
         return *this;
     }
+
+    /// The infer scales the projections to the unit variance if it is true
+    auto& set_whiten(bool value) {
+        descriptor_base<Task>::set_whiten_impl(value);
+        return *this;
+    }
 };
 
 template <typename Task = task::by_default>
@@ -91,13 +103,41 @@ public:
 
     table get_eigenvectors() const;
 
+    /// The means, the variances of the features and the eigenvalues the infer
+    /// centers, standardizes and whitens the data with, the train sets them
+    table get_means() const;
+    table get_variances() const;
+    table get_eigenvalues() const;
+
     auto& set_eigenvectors(const table& value) {
         set_eigenvectors_impl(value);
         return *this;
     }
 
+    auto& set_means(const table& value) {
+        set_means_impl(value);
+        return *this;
+    }
+
+    auto& set_variances(const table& value) {
+        set_variances_impl(value);
+        return *this;
+    }
+
+    auto& set_eigenvalues(const table& value) {
+        set_eigenvalues_impl(value);
+        return *this;
+    }
+
 private:
     void set_eigenvectors_impl(const table&);
+    void set_means_impl(const table&);
+    void set_variances_impl(const table&);
+    void set_eigenvalues_impl(const table&);
+
+    friend dal::detail::serialization_accessor;
+    void serialize(dal::detail::binary_output_archive& ar) const;
+    void deserialize(dal::detail::binary_input_archive& ar);
 
     dal::detail::pimpl<detail::model_impl<task_t>> impl_;
 };
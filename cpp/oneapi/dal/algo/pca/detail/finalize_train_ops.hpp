@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/pca/partial_train_types.hpp"
+#include "oneapi/dal/algo/pca/train_types.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::pca::detail {
+
+template <typename Context,
+          typename Float,
+          typename Method = method::by_default,
+          typename Task = task::by_default>
+struct ONEAPI_DAL_EXPORT finalize_train_ops_dispatcher {
+    train_result<Task> operator()(const Context&,
+                                  const descriptor_base<Task>&,
+                                  const partial_train_result<Task>&) const;
+};
+
+template <typename Descriptor>
+struct finalize_train_ops {
+    using float_t = typename Descriptor::float_t;
+    using task_t = typename Descriptor::task_t;
+    using method_t = typename Descriptor::method_t;
+    using input_t = partial_train_result<task_t>;
+    using result_t = train_result<task_t>;
+    using descriptor_base_t = descriptor_base<task_t>;
+
+    void check_preconditions(const Descriptor& params, const input_t& input) const {
+        if (!(input.get_partial_n_rows().has_data())) {
+            throw domain_error("Input partial_n_rows should not be empty");
+        }
+        if (input.get_partial_sum().get_column_count() < params.get_component_count()) {
+            throw invalid_argument(
+                "Input partial_sum column_count should be >= descriptor component_count");
+        }
+    }
+
+    void check_postconditions(const Descriptor& params,
+                              const input_t& input,
+                              const result_t& result) const {
+        const std::int64_t column_count = input.get_partial_sum().get_column_count();
+        if (result.get_eigenvalues().get_column_count() != params.get_component_count()) {
+            throw internal_error(
+                "Result eigenvalues column_count should be equal to descriptor component_count");
+        }
+        if (result.get_eigenvectors().get_row_count() != params.get_component_count()) {
+            throw internal_error(
+                "Result eigenvectors row_count should be equal to descriptor component_count");
+        }
+        if (result.get_eigenvectors().get_column_count() != column_count) {
+            throw internal_error(
+                "Result eigenvectors column_count should be equal to partial_sum column_count");
+        }
+    }
+
+    template <typename Context>
+    auto operator()(const Context& ctx, const Descriptor& desc, const input_t& input) const {
+        check_preconditions(desc, input);
+        auto result =
+            finalize_train_ops_dispatcher<Context, float_t, method_t, task_t>()(ctx, desc, input);
+        check_postconditions(desc, input, result);
+        // The model keeps the moments the infer normalizes the data with
+        return result.set_model(result.get_model()
+                                    .set_means(result.get_means())
+                                    .set_variances(result.get_variances())
+                                    .set_eigenvalues(result.get_eigenvalues()));
+    }
+};
+
+} // namespace oneapi::dal::pca::detail
@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/pca/partial_train_types.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::pca::detail {
+
+template <typename Context,
+          typename Float,
+          typename Method = method::by_default,
+          typename Task = task::by_default>
+struct ONEAPI_DAL_EXPORT partial_train_ops_dispatcher {
+    partial_train_result<Task> operator()(const Context&,
+                                          const descriptor_base<Task>&,
+                                          const partial_train_input<Task>&) const;
+};
+
+template <typename Descriptor>
+struct partial_train_ops {
+    using float_t = typename Descriptor::float_t;
+    using task_t = typename Descriptor::task_t;
+    using method_t = typename Descriptor::method_t;
+    using input_t = partial_train_input<task_t>;
+    using result_t = partial_train_result<task_t>;
+    using descriptor_base_t = descriptor_base<task_t>;
+
+    void check_preconditions(const Descriptor& params, const input_t& input) const {
+        const auto& data = input.get_data();
+        if (!(data.has_data())) {
+            throw domain_error("Input data should not be empty");
+        }
+        const auto& prior_sum = input.get_prior().get_partial_sum();
+        if (prior_sum.has_data() && prior_sum.get_column_count() != data.get_column_count()) {
+            throw invalid_argument(
+                "Input data column_count should be equal to prior partial_sum column_count");
+        }
+    }
+
+    void check_postconditions(const Descriptor& params,
+                              const input_t& input,
+                              const result_t& result) const {
+        const std::int64_t column_count = input.get_data().get_column_count();
+        if (result.get_partial_n_rows().get_row_count() != 1 ||
+            result.get_partial_n_rows().get_column_count() != 1) {
+            throw internal_error("Result partial_n_rows should be 1 x 1 table");
+        }
+        if (result.get_partial_sum().get_column_count() != column_count) {
+            throw internal_error(
+                "Result partial_sum column_count should be equal to input data column_count");
+        }
+    }
+
+    template <typename Context>
+    auto operator()(const Context& ctx, const Descriptor& desc, const input_t& input) const {
+        check_preconditions(desc, input);
+        const auto result =
+            partial_train_ops_dispatcher<Context, float_t, method_t, task_t>()(ctx, desc, input);
+        check_postconditions(desc, input, result);
+        return result;
+    }
+};
+
+} // namespace oneapi::dal::pca::detail
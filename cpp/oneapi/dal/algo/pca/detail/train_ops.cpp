@@ -15,11 +15,14 @@
 *******************************************************************************/
 
 #include "oneapi/dal/algo/pca/detail/train_ops.hpp"
+#include "oneapi/dal/algo/pca/backend/cpu/partial_train_kernel.hpp"
 #include "oneapi/dal/algo/pca/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/spmd/policy.hpp"
 
 namespace oneapi::dal::pca::detail {
 using oneapi::dal::detail::host_policy;
+using oneapi::dal::detail::spmd_policy;
 
 template <typename Float, typename Method, typename Task>
 struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, Float, Method, Task> {
@@ -32,12 +35,52 @@ struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, Float, Method, Task>
     }
 };
 
-#define INSTANTIATE(F, M, T) \
-    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, F, M, T>;
+/// Every process computes the partial result of its rows, the partial results
+/// of all processes are merged and finalized on every process
+template <typename Float, typename Method, typename Task>
+struct ONEAPI_DAL_EXPORT train_ops_dispatcher<spmd_policy<host_policy>, Float, Method, Task> {
+    train_result<Task> operator()(const spmd_policy<host_policy>& ctx,
+                                  const descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        using partial_kernel_dispatcher_t = dal::backend::kernel_dispatcher<
+            backend::partial_train_kernel_cpu<Float, Method, Task>>;
+        using merge_kernel_dispatcher_t =
+            dal::backend::kernel_dispatcher<backend::spmd_merge_kernel_cpu<Float, Method, Task>>;
+        using finalize_kernel_dispatcher_t = dal::backend::kernel_dispatcher<
+            backend::finalize_train_kernel_cpu<Float, Method, Task>>;
+
+        const auto& local = ctx.get_local();
+        const auto local_partial = partial_kernel_dispatcher_t()(
+            local,
+            desc,
+            partial_train_input<Task>{ input.get_data() });
+        const auto partial =
+            merge_kernel_dispatcher_t()(local, ctx.get_communicator(), local_partial);
+        return finalize_kernel_dispatcher_t()(local, desc, partial);
+    }
+};
+
+/// The randomized range finder needs the products with all rows at every power
+/// iteration, it has no partial result
+template <typename Float, typename Task>
+struct ONEAPI_DAL_EXPORT
+    train_ops_dispatcher<spmd_policy<host_policy>, Float, method::randomized, Task> {
+    train_result<Task> operator()(const spmd_policy<host_policy>& ctx,
+                                  const descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        throw unimplemented("Randomized method is not supported by the SPMD policy");
+    }
+};
+
+#define INSTANTIATE(F, M, T)                                                      \
+    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<host_policy, F, M, T>; \
+    template struct ONEAPI_DAL_EXPORT train_ops_dispatcher<spmd_policy<host_policy>, F, M, T>;
 
 INSTANTIATE(float, method::cov, task::dim_reduction)
 INSTANTIATE(float, method::svd, task::dim_reduction)
+INSTANTIATE(float, method::randomized, task::dim_reduction)
 INSTANTIATE(double, method::cov, task::dim_reduction)
 INSTANTIATE(double, method::svd, task::dim_reduction)
+INSTANTIATE(double, method::randomized, task::dim_reduction)
 
 } // namespace oneapi::dal::pca::detail
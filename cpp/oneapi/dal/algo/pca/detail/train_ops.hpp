@@ -81,10 +81,14 @@ struct train_ops {
     template <typename Context>
     auto operator()(const Context& ctx, const Descriptor& desc, const input_t& input) const {
         check_preconditions(desc, input);
-        const auto result =
+        auto result =
             train_ops_dispatcher<Context, float_t, method_t, task_t>()(ctx, desc, input);
         check_postconditions(desc, input, result);
-        return result;
+        // The model keeps the moments the infer normalizes the data with
+        return result.set_model(result.get_model()
+                                    .set_means(result.get_means())
+                                    .set_variances(result.get_variances())
+                                    .set_eigenvalues(result.get_eigenvalues()));
     }
 };
 
@@ -18,6 +18,7 @@
 #include "oneapi/dal/algo/pca/backend/gpu/train_kernel.hpp"
 #include "oneapi/dal/algo/pca/detail/train_ops.hpp"
 #include "oneapi/dal/backend/dispatcher_dpc.hpp"
+#include "oneapi/dal/backend/multi_device_dpc.hpp"
 
 namespace oneapi::dal::pca::detail {
 using oneapi::dal::detail::data_parallel_policy;
@@ -27,11 +28,45 @@ struct ONEAPI_DAL_EXPORT train_ops_dispatcher<data_parallel_policy, Float, Metho
     train_result<Task> operator()(const data_parallel_policy& ctx,
                                   const descriptor_base<Task>& params,
                                   const train_input<Task>& input) const {
+        if constexpr (std::is_same_v<Method, method::cov>) {
+            const auto& data = input.get_data();
+            const std::int64_t shard_count =
+                dal::backend::get_shard_count(ctx, data.get_row_count());
+            if (shard_count > 1) {
+                return train_on_devices(ctx, params, input, shard_count);
+            }
+        }
         using kernel_dispatcher_t =
             dal::backend::kernel_dispatcher<backend::train_kernel_cpu<Float, Method, Task>,
                                             backend::train_kernel_gpu<Float, Method, Task>>;
         return kernel_dispatcher_t{}(ctx, params, input);
     }
+
+private:
+    /// Every device computes the means and the covariance matrix of its rows,
+    /// they are combined and decomposed on the host
+    train_result<Task> train_on_devices(const data_parallel_policy& ctx,
+                                        const descriptor_base<Task>& params,
+                                        const train_input<Task>& input,
+                                        std::int64_t shard_count) const {
+        const auto& data = input.get_data();
+        const auto shards = dal::backend::split_rows(data.get_row_count(), shard_count);
+
+        std::vector<backend::covariance_moments<Float>> moments(shard_count);
+        dal::backend::for_each_shard(
+            ctx,
+            shard_count,
+            [&](std::int64_t i, const data_parallel_policy& device_ctx) {
+                const auto shard_data =
+                    dal::backend::pull_rows<Float>(device_ctx.get_queue(), data, shards[i]);
+                const dal::backend::context_gpu gpu_ctx{ device_ctx };
+                const dal::detail::usm_allocator_scope scope{ device_ctx.get_allocator() };
+                moments[i] = backend::moments_kernel_gpu<Float>{}(gpu_ctx, shard_data);
+            });
+
+        const auto cpu_ctx = dal::backend::context_cpu{ dal::detail::host_policy{} };
+        return backend::train_from_moments_kernel_cpu<Float, Task>{}(cpu_ctx, params, moments);
+    }
 };
 
 #define INSTANTIATE(F, M, T) \
@@ -39,7 +74,9 @@ struct ONEAPI_DAL_EXPORT train_ops_dispatcher<data_parallel_policy, Float, Metho
 
 INSTANTIATE(float, method::cov, task::dim_reduction)
 INSTANTIATE(float, method::svd, task::dim_reduction)
+INSTANTIATE(float, method::randomized, task::dim_reduction)
 INSTANTIATE(double, method::cov, task::dim_reduction)
 INSTANTIATE(double, method::svd, task::dim_reduction)
+INSTANTIATE(double, method::randomized, task::dim_reduction)
 
 } // namespace oneapi::dal::pca::detail
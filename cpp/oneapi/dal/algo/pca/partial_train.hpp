@@ -0,0 +1,29 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/pca/detail/partial_train_ops.hpp"
+#include "oneapi/dal/algo/pca/partial_train_types.hpp"
+#include "oneapi/dal/partial_train.hpp"
+
+namespace oneapi::dal::detail {
+
+template <typename Descriptor>
+struct partial_train_ops<Descriptor, dal::pca::detail::tag>
+        : dal::pca::detail::partial_train_ops<Descriptor> {};
+
+} // namespace oneapi::dal::detail
@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/pca/partial_train_types.hpp"
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::pca {
+
+template <typename Task>
+class detail::partial_train_result_impl : public base {
+public:
+    table n_rows;
+    table sum;
+    table crossproduct;
+    table factor;
+};
+
+template <typename Task>
+class detail::partial_train_input_impl : public base {
+public:
+    partial_train_input_impl(const partial_train_result<Task>& prior, const table& data)
+            : prior(prior),
+              data(data) {}
+
+    partial_train_result<Task> prior;
+    table data;
+};
+
+using detail::partial_train_input_impl;
+using detail::partial_train_result_impl;
+
+template <typename Task>
+partial_train_result<Task>::partial_train_result() : impl_(new partial_train_result_impl<Task>{}) {}
+
+template <typename Task>
+table partial_train_result<Task>::get_partial_n_rows() const {
+    return impl_->n_rows;
+}
+
+template <typename Task>
+table partial_train_result<Task>::get_partial_sum() const {
+    return impl_->sum;
+}
+
+template <typename Task>
+table partial_train_result<Task>::get_partial_crossproduct() const {
+    return impl_->crossproduct;
+}
+
+template <typename Task>
+table partial_train_result<Task>::get_partial_factor() const {
+    return impl_->factor;
+}
+
+template <typename Task>
+void partial_train_result<Task>::set_partial_n_rows_impl(const table& value) {
+    impl_->n_rows = value;
+}
+
+template <typename Task>
+void partial_train_result<Task>::set_partial_sum_impl(const table& value) {
+    impl_->sum = value;
+}
+
+template <typename Task>
+void partial_train_result<Task>::set_partial_crossproduct_impl(const table& value) {
+    impl_->crossproduct = value;
+}
+
+template <typename Task>
+void partial_train_result<Task>::set_partial_factor_impl(const table& value) {
+    impl_->factor = value;
+}
+
+template <typename Task>
+partial_train_input<Task>::partial_train_input(const table& data)
+        : impl_(new partial_train_input_impl<Task>(partial_train_result<Task>{}, data)) {}
+
+template <typename Task>
+partial_train_input<Task>::partial_train_input(const partial_train_result<Task>& prior,
+                                               const table& data)
+        : impl_(new partial_train_input_impl<Task>(prior, data)) {}
+
+template <typename Task>
+partial_train_result<Task> partial_train_input<Task>::get_prior() const {
+    return impl_->prior;
+}
+
+template <typename Task>
+table partial_train_input<Task>::get_data() const {
+    return impl_->data;
+}
+
+template <typename Task>
+void partial_train_input<Task>::set_prior_impl(const partial_train_result<Task>& value) {
+    impl_->prior = value;
+}
+
+template <typename Task>
+void partial_train_input<Task>::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+template class ONEAPI_DAL_EXPORT partial_train_input<task::dim_reduction>;
+template class ONEAPI_DAL_EXPORT partial_train_result<task::dim_reduction>;
+
+} // namespace oneapi::dal::pca
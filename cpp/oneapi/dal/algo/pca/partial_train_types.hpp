@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/pca/common.hpp"
+
+namespace oneapi::dal::pca {
+
+namespace detail {
+template <typename Task = task::by_default>
+class partial_train_input_impl;
+
+template <typename Task = task::by_default>
+class partial_train_result_impl;
+} // namespace detail
+
+/// The state of the incremental training over the blocks of rows seen so far,
+/// the memory it takes does not depend on the number of rows. The cov method
+/// keeps the sums and the cross-product of the centered rows, the svd method
+/// keeps the sums and the p x p factor F with F^T F equal to the cross-product.
+template <typename Task = task::by_default>
+class ONEAPI_DAL_EXPORT partial_train_result {
+public:
+    using task_t = Task;
+    partial_train_result();
+
+    /// The 1 x 1 table of the number of rows, empty before the first block
+    table get_partial_n_rows() const;
+
+    /// The 1 x p table of the column sums
+    table get_partial_sum() const;
+
+    /// The p x p cross-product of the centered rows, the cov method only
+    table get_partial_crossproduct() const;
+
+    /// The p x p factor sigma * V^T of the SVD of the centered rows, the svd
+    /// method only
+    table get_partial_factor() const;
+
+    auto& set_partial_n_rows(const table& value) {
+        set_partial_n_rows_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_sum(const table& value) {
+        set_partial_sum_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_crossproduct(const table& value) {
+        set_partial_crossproduct_impl(value);
+        return *this;
+    }
+
+    auto& set_partial_factor(const table& value) {
+        set_partial_factor_impl(value);
+        return *this;
+    }
+
+private:
+    void set_partial_n_rows_impl(const table&);
+    void set_partial_sum_impl(const table&);
+    void set_partial_crossproduct_impl(const table&);
+    void set_partial_factor_impl(const table&);
+
+    dal::detail::pimpl<detail::partial_train_result_impl<task_t>> impl_;
+};
+
+template <typename Task = task::by_default>
+class ONEAPI_DAL_EXPORT partial_train_input : public base {
+public:
+    using task_t = Task;
+    partial_train_input(const table& data);
+    partial_train_input(const partial_train_result<task_t>& prior, const table& data);
+
+    partial_train_result<task_t> get_prior() const;
+    table get_data() const;
+
+    auto& set_prior(const partial_train_result<task_t>& value) {
+        set_prior_impl(value);
+        return *this;
+    }
+
+    auto& set_data(const table& value) {
+        set_data_impl(value);
+        return *this;
+    }
+
+private:
+    void set_prior_impl(const partial_train_result<task_t>& value);
+    void set_data_impl(const table& value);
+
+    dal::detail::pimpl<detail::partial_train_input_impl<task_t>> impl_;
+};
+
+} // namespace oneapi::dal::pca
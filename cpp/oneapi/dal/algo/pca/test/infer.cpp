@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "oneapi/dal/test/datasets.hpp"
+#include "oneapi/dal/algo/pca/infer.hpp"
+#include "oneapi/dal/algo/pca/train.hpp"
+#include "oneapi/dal/backend/linalg.hpp"
+
+namespace oneapi::dal::pca::test {
+
+namespace la = backend::linalg;
+
+ALGO_TEST_CASE("PCA infer", (float, double), (method::cov, method::svd)) {
+    DECLARE_TEST_POLICY(policy);
+
+    const dal::test::dataset data =
+        GENERATE_DATASET(dal::test::random_dataset(1000, 20).uniform(-2, 5),
+                         dal::test::random_dataset(100, 10).uniform(-0.2, 1.5));
+    const std::string table_type = GENERATE("homogen");
+    const std::int64_t component_count = GENERATE(2, 5);
+    const bool whiten = GENERATE(false, true);
+
+    SECTION("transform") {
+        const table x = data.get_table<Float>(policy, table_type);
+
+        const auto pca_desc = descriptor<Float, Method>{}
+                                  .set_component_count(component_count)
+                                  .set_deterministic(true)
+                                  .set_whiten(whiten);
+
+        const auto train_result = dal::test::train(policy, pca_desc, x);
+        const auto model = train_result.get_model();
+        const auto infer_result = dal::test::infer(policy, pca_desc, model, x);
+        const auto y = la::matrix<double>::wrap(infer_result.get_transformed_data());
+
+        SECTION("transformed data shape is expected") {
+            CHECK(y.get_row_count() == x.get_row_count());
+            CHECK(y.get_column_count() == component_count);
+        }
+
+        SECTION("transformed data is the projection of the standardized data") {
+            const auto X = la::matrix<double>::wrap(x);
+            const auto V = la::matrix<double>::wrap(model.get_eigenvectors());
+            const auto m = la::matrix<double>::wrap(model.get_means());
+            const auto v = la::matrix<double>::wrap(model.get_variances());
+            const auto w = la::matrix<double>::wrap(model.get_eigenvalues());
+
+            // The standardization is folded into the basis and the bias, the
+            // whitening scales the projections in the same pass
+            const auto basis = la::matrix<double>::full(
+                V.get_shape(),
+                [&](std::int64_t c, std::int64_t j) {
+                    return V.get(c, j) / std::sqrt(v.get(0, j));
+                });
+            const auto bias = la::dot(m, basis.T()).map([](double x) {
+                return -x;
+            });
+            const auto whitening =
+                la::matrix<double>::full({ 1, component_count }, [&](std::int64_t, std::int64_t c) {
+                    return whiten ? 1.0 / std::sqrt(w.get(0, c)) : 1.0;
+                });
+            const auto Y = la::dot(X,
+                                   basis.T(),
+                                   la::add_row<double>{ bias } |
+                                       la::multiply_row<double>{ whitening });
+
+            const double diff = (Y - y).abs().max();
+            CHECK(diff < dal::test::get_tolerance<Float>(1e-8, 1e-3) * (Y.abs().max() + 1.0));
+        }
+
+        SECTION("whitened components have unit variance") {
+            if (whiten) {
+                for (std::int64_t c = 0; c < component_count; c++) {
+                    double sum = 0.0;
+                    double sum_of_squares = 0.0;
+                    for (std::int64_t i = 0; i < y.get_row_count(); i++) {
+                        sum += y.get(i, c);
+                        sum_of_squares += y.get(i, c) * y.get(i, c);
+                    }
+                    const double n = double(y.get_row_count());
+                    const double variance = (sum_of_squares - sum * sum / n) / (n - 1);
+                    CHECK(std::abs(variance - 1.0) < dal::test::get_tolerance<Float>(1e-6, 1e-2));
+                }
+            }
+        }
+    }
+}
+
+} // namespace oneapi::dal::pca::test
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "oneapi/dal/test/datasets.hpp"
+#include "oneapi/dal/algo/pca/finalize_train.hpp"
+#include "oneapi/dal/algo/pca/partial_train.hpp"
+#include "oneapi/dal/algo/pca/train.hpp"
+#include "oneapi/dal/backend/linalg.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::pca::test {
+
+namespace la = backend::linalg;
+
+ALGO_TEST_CASE("PCA partial train", (float, double), (method::cov, method::svd)) {
+    DECLARE_TEST_POLICY(policy);
+
+    const dal::test::dataset data =
+        GENERATE_DATASET(dal::test::random_dataset(1000, 20).uniform(-2, 5),
+                         dal::test::random_dataset(100, 10).uniform(-0.2, 1.5));
+    const std::string table_type = GENERATE("homogen");
+    const std::int64_t component_count = GENERATE(2, 5);
+
+    SECTION("training by blocks") {
+        const table x = data.get_table<Float>(policy, table_type);
+        const std::int64_t row_count = x.get_row_count();
+        const std::int64_t column_count = x.get_column_count();
+
+        const auto batch_desc = descriptor<Float, method::cov>{}
+                                    .set_component_count(component_count)
+                                    .set_deterministic(true);
+        const auto batch_result = dal::test::train(policy, batch_desc, x);
+
+        const auto pca_desc = descriptor<Float, Method>{}
+                                  .set_component_count(component_count)
+                                  .set_deterministic(true);
+
+        // The single row block checks the merge of the rows with no scatter
+        const std::int64_t bounds[] = { 0, 1, row_count / 3, row_count / 2, row_count };
+        partial_train_result<> partial_result;
+        for (std::int64_t b = 0; b + 1 < 5; b++) {
+            auto block_rows = row_accessor<const Float>{ x }.pull({ bounds[b], bounds[b + 1] });
+            const auto block = dal::detail::homogen_table_builder{}
+                                   .reset(block_rows, bounds[b + 1] - bounds[b], column_count)
+                                   .build();
+            partial_result = dal::test::partial_train(policy, pca_desc, partial_result, block);
+        }
+
+        const auto n_rows =
+            row_accessor<const double>{ partial_result.get_partial_n_rows() }.pull();
+        const auto result = dal::test::finalize_train(policy, pca_desc, partial_result);
+        const double tolerance = dal::test::get_tolerance<Float>(1e-8, 1e-3);
+
+        SECTION("row count is the sum of the block row counts") {
+            CHECK(n_rows[0] == double(row_count));
+        }
+
+        SECTION("means are the same as the ones of batch training") {
+            const auto m = la::matrix<double>::wrap(result.get_means());
+            const auto m_batch = la::matrix<double>::wrap(batch_result.get_means());
+            CHECK((m - m_batch).abs().max() < tolerance * (m_batch.abs().max() + 1.0));
+        }
+
+        SECTION("eigenvalues are the same as the ones of batch training") {
+            const auto W = la::matrix<double>::wrap(result.get_eigenvalues());
+            const auto W_batch = la::matrix<double>::wrap(batch_result.get_eigenvalues());
+            CHECK((W - W_batch).abs().max() < tolerance * W_batch.abs().max());
+        }
+
+        SECTION("eigenvectors are the same as the ones of batch training up to sign") {
+            const auto V = la::matrix<double>::wrap(result.get_eigenvectors());
+            const auto V_batch = la::matrix<double>::wrap(batch_result.get_eigenvectors());
+            const auto VxVT = la::dot(V, V_batch.T());
+            for (std::int64_t k = 0; k < component_count; k++) {
+                CHECK(std::abs(std::abs(VxVT.get(k, k)) - 1.0) < std::sqrt(tolerance));
+            }
+        }
+    }
+}
+
+} // namespace oneapi::dal::pca::test
@@ -22,7 +22,7 @@ namespace oneapi::dal::pca::test {
 
 namespace la = backend::linalg;
 
-ALGO_TEST_CASE("PCA", (float, double), (method::cov)) {
+ALGO_TEST_CASE("PCA", (float, double), (method::cov, method::randomized)) {
     DECLARE_TEST_POLICY(policy);
 
     const dal::test::dataset data =
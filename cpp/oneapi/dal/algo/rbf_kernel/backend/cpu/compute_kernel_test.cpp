@@ -14,8 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "oneapi/dal/algo/rbf_kernel/compute.hpp"
+#include "oneapi/dal/table/csr.hpp"
 #include "oneapi/dal/table/homogen.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 
@@ -166,3 +169,109 @@ TEST(rbf_kernel_dense_test, can_compute_diff_matrix_not_default_params) {
         }
     }
 }
+
+TEST(rbf_kernel_csr_test, can_compute_same_values_as_dense) {
+    constexpr std::int64_t row_count_x = 3;
+    constexpr std::int64_t row_count_y = 2;
+    constexpr std::int64_t column_count = 4;
+    const float x_dense[] = {
+        1.f, 0.f, 2.f, 0.f, //
+        0.f, 0.f, 0.f, 0.f, //
+        0.f, 3.f, 0.f, 4.f, //
+    };
+    const float y_dense[] = {
+        0.f, 1.f, 2.f, 0.f, //
+        5.f, 0.f, 0.f, 1.f, //
+    };
+    const float x_values[] = { 1.f, 2.f, 3.f, 4.f };
+    const std::int64_t x_column_indices[] = { 0, 2, 1, 3 };
+    const std::int64_t x_row_offsets[] = { 0, 2, 2, 4 };
+    const float y_values[] = { 1.f, 2.f, 5.f, 1.f };
+    const std::int64_t y_column_indices[] = { 1, 2, 0, 3 };
+    const std::int64_t y_row_offsets[] = { 0, 2, 4 };
+
+    const auto x_table = csr_table{ array<float>::wrap(x_values, 4),
+                                    array<std::int64_t>::wrap(x_column_indices, 4),
+                                    array<std::int64_t>::wrap(x_row_offsets, row_count_x + 1),
+                                    column_count };
+    const auto y_table = csr_table{ array<float>::wrap(y_values, 4),
+                                    array<std::int64_t>::wrap(y_column_indices, 4),
+                                    array<std::int64_t>::wrap(y_row_offsets, row_count_y + 1),
+                                    column_count };
+
+    const auto kernel_desc =
+        rbf_kernel::descriptor<float, rbf_kernel::method::csr>{}.set_sigma(1.5);
+    const auto values_table = compute(kernel_desc, x_table, y_table).get_values();
+    const auto ref_table = compute(rbf_kernel::descriptor{}.set_sigma(1.5),
+                                   homogen_table::wrap(x_dense, row_count_x, column_count),
+                                   homogen_table::wrap(y_dense, row_count_y, column_count))
+                               .get_values();
+    ASSERT_EQ(values_table.get_row_count(), row_count_x);
+    ASSERT_EQ(values_table.get_column_count(), row_count_y);
+
+    const auto values = row_accessor<const float>(values_table).pull();
+    const auto ref_values = row_accessor<const float>(ref_table).pull();
+    for (std::int64_t i = 0; i < values.get_count(); i++) {
+        ASSERT_FLOAT_EQ(values[i], ref_values[i]);
+    }
+}
+
+TEST(rbf_kernel_csr_test, throws_if_input_is_dense) {
+    const float x_data[] = { 1.f, 2.f };
+    const auto x_table = homogen_table::wrap(x_data, 1, 2);
+
+    const auto kernel_desc =
+        rbf_kernel::descriptor<float, rbf_kernel::method::csr>{}.set_sigma(1.5);
+    ASSERT_THROW(compute(kernel_desc, x_table, x_table), invalid_argument);
+}
+
+TEST(rbf_kernel_dense_test, can_compute_by_tiles) {
+    constexpr std::int64_t row_count_x = 5;
+    constexpr std::int64_t row_count_y = 3;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t tile_row_count = 2;
+    const float x_data[] = {
+        1.f, 2.f, -1.f, 0.5f, 3.f, 1.f, 0.f, -2.f, 2.f, 2.f,
+    };
+    const float y_data[] = {
+        1.f, 1.f, -3.f, 1.f, 0.5f, -1.f,
+    };
+
+    const auto x_table = homogen_table::wrap(x_data, row_count_x, column_count);
+    const auto y_table = homogen_table::wrap(y_data, row_count_y, column_count);
+
+    const auto kernel_desc = rbf_kernel::descriptor{}.set_sigma(1.5);
+
+    std::vector<float> tiled_values(row_count_x * row_count_y);
+    std::vector<std::int64_t> first_rows;
+    const auto copy_tile = [&](std::int64_t first_row, const table& tile) {
+        ASSERT_EQ(tile.get_column_count(), row_count_y);
+        const auto tile_values = row_accessor<const float>(tile).pull();
+        for (std::int64_t i = 0; i < tile_values.get_count(); i++) {
+            tiled_values[first_row * row_count_y + i] = tile_values[i];
+        }
+        first_rows.push_back(first_row);
+    };
+    rbf_kernel::compute_by_tiles(kernel_desc, x_table, y_table, tile_row_count, copy_tile);
+
+    ASSERT_EQ(first_rows, (std::vector<std::int64_t>{ 0, 2, 4 }));
+
+    const auto values_table = compute(kernel_desc, x_table, y_table).get_values();
+    const auto values = row_accessor<const float>(values_table).pull();
+    for (std::int64_t i = 0; i < values.get_count(); i++) {
+        ASSERT_FLOAT_EQ(tiled_values[i], values[i]);
+    }
+}
+
+TEST(rbf_kernel_dense_test, compute_by_tiles_throws_if_tile_row_count_is_not_positive) {
+    const float x_data[] = { 1.f, 2.f };
+    const auto x_table = homogen_table::wrap(x_data, 1, 2);
+
+    const auto kernel_desc = rbf_kernel::descriptor{};
+    ASSERT_THROW(rbf_kernel::compute_by_tiles(kernel_desc,
+                                              x_table,
+                                              x_table,
+                                              0,
+                                              [](std::int64_t, const table&) {}),
+                 invalid_argument);
+}
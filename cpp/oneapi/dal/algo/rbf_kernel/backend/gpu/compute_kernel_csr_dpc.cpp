@@ -15,15 +15,70 @@
 *******************************************************************************/
 
 #include "oneapi/dal/algo/rbf_kernel/backend/gpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/csr_kernels_dpc.hpp"
 
 namespace oneapi::dal::rbf_kernel::backend {
 
+using dal::backend::context_gpu;
+using dal::backend::csr_device_data;
+
+/// Computes exp(-|x_i - y_j|^2 / (2 sigma^2)) from the dot product and the
+/// squared norms of the rows
+template <typename Float>
+struct rbf_op {
+    Float operator()(Float dot, int64_t i, int64_t j) const {
+        const Float distance = sycl::max(x_norms[i] + y_norms[j] - Float(2) * dot, Float(0));
+        return sycl::exp(coeff * distance);
+    }
+
+    const Float* x_norms;
+    const Float* y_norms;
+    Float coeff;
+};
+
+template <typename Float>
+static compute_result compute(const context_gpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) {
+    auto& queue = ctx.get_queue();
+    const table& x = input.get_x();
+    const table& y = input.get_y();
+
+    const int64_t row_count_x = x.get_row_count();
+    const int64_t row_count_y = y.get_row_count();
+
+    const csr_device_data<Float> x_data{ queue, x };
+    const csr_device_data<Float> y_data{ queue, y };
+
+    auto arr_x_norms = array<Float>::empty(queue, row_count_x, sycl::usm::alloc::device);
+    auto arr_y_norms = array<Float>::empty(queue, row_count_y, sycl::usm::alloc::device);
+    dal::backend::compute_csr_row_norms(queue, x_data, row_count_x, arr_x_norms.get_mutable_data());
+    dal::backend::compute_csr_row_norms(queue, y_data, row_count_y, arr_y_norms.get_mutable_data());
+
+    auto arr_values = array<Float>::empty(queue, row_count_x * row_count_y);
+
+    const double sigma = desc.get_sigma();
+    const rbf_op<Float> op{ arr_x_norms.get_data(),
+                            arr_y_norms.get_data(),
+                            static_cast<Float>(-0.5 / (sigma * sigma)) };
+    dal::backend::compute_csr_gram(queue,
+                                   x_data,
+                                   y_data,
+                                   row_count_x,
+                                   row_count_y,
+                                   arr_values.get_mutable_data(),
+                                   op);
+
+    return compute_result().set_values(
+        dal::detail::homogen_table_builder{}.reset(arr_values, row_count_x, row_count_y).build());
+}
+
 template <typename Float>
 struct compute_kernel_gpu<Float, method::csr> {
-    compute_result operator()(const dal::backend::context_gpu& ctx,
-                              const descriptor_base& params,
+    compute_result operator()(const context_gpu& ctx,
+                              const descriptor_base& desc,
                               const compute_input& input) const {
-        return compute_result();
+        return compute<Float>(ctx, desc, input);
     }
 };
 
@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/algo/rbf_kernel/compute_types.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/csr.hpp"
 
 namespace oneapi::dal::rbf_kernel::detail {
 
@@ -44,6 +45,12 @@ struct compute_ops {
         if (input.get_x().get_column_count() != input.get_y().get_column_count()) {
             throw invalid_argument("Input x column_count should be equal to y column_count");
         }
+        if constexpr (std::is_same_v<method_t, method::csr>) {
+            if (input.get_x().get_kind() != csr_table::kind() ||
+                input.get_y().get_kind() != csr_table::kind()) {
+                throw invalid_argument("Input x and y should be CSR tables for csr method");
+            }
+        }
     }
 
     void check_postconditions(const Descriptor& params,
@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/linear_regression/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/ridge_regression/backend/cpu/infer_kernel.hpp"
+
+namespace oneapi::dal::ridge_regression::backend {
+
+using dal::backend::context_cpu;
+using dal::linear_regression::backend::infer_responses_kernel_cpu;
+
+template <typename Float>
+struct infer_kernel_cpu<Float, method::norm_eq, task::regression> {
+    infer_result<task::regression> operator()(const context_cpu& ctx,
+                                              const descriptor_base<task::regression>& desc,
+                                              const infer_input<task::regression>& input) const {
+        // The betas have the layout of the linear regression model
+        const auto responses = infer_responses_kernel_cpu<Float>{}(ctx,
+                                                                   input.get_data(),
+                                                                   input.get_model().get_betas());
+        return infer_result<task::regression>().set_responses(responses);
+    }
+};
+
+template struct infer_kernel_cpu<float, method::norm_eq, task::regression>;
+template struct infer_kernel_cpu<double, method::norm_eq, task::regression>;
+
+} // namespace oneapi::dal::ridge_regression::backend
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+
+#include "oneapi/dal/algo/ridge_regression/train_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::ridge_regression::backend {
+
+template <typename Float, typename Method, typename Task>
+struct train_kernel_cpu {
+    train_result<Task> operator()(const dal::backend::context_cpu& ctx,
+                                  const descriptor_base<Task>& params,
+                                  const train_input<Task>& input) const;
+};
+
+/// Computes the betas of the ridge models for all the alphas from the cross
+/// products of the data. The betas of the alpha i occupy the rows
+/// i * response_count, ..., (i + 1) * response_count - 1 of the result.
+template <typename Float>
+struct train_path_kernel_cpu {
+    table operator()(const dal::backend::context_cpu& ctx,
+                     array<Float>& xtx,
+                     array<Float>& xty,
+                     const table& alphas,
+                     std::int64_t feature_count,
+                     std::int64_t response_count,
+                     bool compute_intercept) const;
+};
+
+/// The cross products of the rows of one fold, `yty` holds the sums of the
+/// squares of every response
+template <typename Float>
+struct fold_cross_products {
+    array<Float> xtx;
+    array<Float> xty;
+    array<Float> yty;
+    std::int64_t row_count;
+};
+
+/// The first row of the fold, the fold f holds the rows
+/// get_fold_first_row(f), ..., get_fold_first_row(f + 1) - 1
+inline std::int64_t get_fold_first_row(std::int64_t row_count,
+                                       std::int64_t fold_count,
+                                       std::int64_t fold) {
+    return fold * row_count / fold_count;
+}
+
+/// The sums of the squares of every response of the row-major block
+template <typename Float>
+inline array<Float> compute_response_squares(const array<Float>& responses,
+                                             std::int64_t row_count,
+                                             std::int64_t response_count) {
+    auto arr_yty = array<Float>::zeros(response_count);
+    const Float* y = responses.get_data();
+    Float* yty = arr_yty.get_mutable_data();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        for (std::int64_t r = 0; r < response_count; ++r) {
+            yty[r] += y[i * response_count + r] * y[i * response_count + r];
+        }
+    }
+    return arr_yty;
+}
+
+/// Sums the cross products of the folds to the ones of all the rows
+template <typename Float>
+inline void sum_fold_cross_products(const std::vector<fold_cross_products<Float>>& folds,
+                                    array<Float>& xtx,
+                                    array<Float>& xty) {
+    xtx = array<Float>::zeros(folds.front().xtx.get_count());
+    xty = array<Float>::zeros(folds.front().xty.get_count());
+    Float* xtx_ptr = xtx.get_mutable_data();
+    Float* xty_ptr = xty.get_mutable_data();
+    for (const auto& fold : folds) {
+        for (std::int64_t i = 0; i < xtx.get_count(); ++i) {
+            xtx_ptr[i] += fold.xtx[i];
+        }
+        for (std::int64_t i = 0; i < xty.get_count(); ++i) {
+            xty_ptr[i] += fold.xty[i];
+        }
+    }
+}
+
+/// Computes the mean squared validation errors of every fold for all the
+/// alphas. The models of the fold are solved from the cross products of all
+/// the folds minus the ones of the fold, their errors on the fold are derived
+/// from the cross products of the fold, so the data is not read again.
+template <typename Float>
+struct train_cv_kernel_cpu {
+    table operator()(const dal::backend::context_cpu& ctx,
+                     const std::vector<fold_cross_products<Float>>& folds,
+                     const table& alphas,
+                     std::int64_t feature_count,
+                     std::int64_t response_count,
+                     bool compute_intercept) const;
+};
+
+} // namespace oneapi::dal::ridge_regression::backend
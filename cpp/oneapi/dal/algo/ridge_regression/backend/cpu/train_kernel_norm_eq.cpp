@@ -0,0 +1,382 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+
+#include <daal/src/algorithms/ridge_regression/ridge_regression_train_kernel.h>
+
+#include "oneapi/dal/algo/ridge_regression/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::ridge_regression::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+
+namespace daal_rr = daal::algorithms::ridge_regression;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_rr_norm_eq_kernel_t =
+    daal_rr::training::internal::BatchKernel<Float, daal_rr::training::normEqDense, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_rr_path_kernel_t = daal_rr::training::internal::PathKernel<Float, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_rr_norm_eq_online_kernel_t =
+    daal_rr::training::internal::OnlineKernel<Float, daal_rr::training::normEqDense, Cpu>;
+
+template <typename Float>
+table train_path_kernel_cpu<Float>::operator()(const context_cpu& ctx,
+                                               array<Float>& xtx,
+                                               array<Float>& xty,
+                                               const table& alphas,
+                                               int64_t feature_count,
+                                               int64_t response_count,
+                                               bool compute_intercept) const {
+    const int64_t alpha_count = alphas.get_column_count();
+    const int64_t beta_count = feature_count + 1;
+    const int64_t xtx_size = compute_intercept ? beta_count : feature_count;
+    const int64_t path_row_count = alpha_count * response_count;
+
+    auto arr_alphas = row_accessor<const Float>{ alphas }.pull();
+    auto arr_path_betas = array<Float>::zeros(path_row_count * beta_count);
+
+    const auto daal_xtx = interop::convert_to_daal_homogen_table(xtx, xtx_size, xtx_size);
+    const auto daal_xty = interop::convert_to_daal_homogen_table(xty, response_count, xtx_size);
+    const auto daal_alphas = interop::convert_to_daal_homogen_table(arr_alphas, 1, alpha_count);
+    const auto daal_path_betas =
+        interop::convert_to_daal_homogen_table(arr_path_betas, path_row_count, beta_count);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_rr_path_kernel_t>(ctx,
+                                                                *daal_xtx,
+                                                                *daal_xty,
+                                                                *daal_alphas,
+                                                                *daal_path_betas,
+                                                                compute_intercept));
+
+    return dal::detail::homogen_table_builder{}
+        .reset(arr_path_betas, path_row_count, beta_count)
+        .build();
+}
+
+template <typename Float>
+table train_cv_kernel_cpu<Float>::operator()(const context_cpu& ctx,
+                                             const std::vector<fold_cross_products<Float>>& folds,
+                                             const table& alphas,
+                                             int64_t feature_count,
+                                             int64_t response_count,
+                                             bool compute_intercept) const {
+    const int64_t fold_count = folds.size();
+    const int64_t alpha_count = alphas.get_column_count();
+    const int64_t beta_count = feature_count + 1;
+    const int64_t xtx_size = compute_intercept ? beta_count : feature_count;
+
+    array<Float> arr_total_xtx;
+    array<Float> arr_total_xty;
+    sum_fold_cross_products(folds, arr_total_xtx, arr_total_xty);
+    const Float* total_xtx = arr_total_xtx.get_data();
+    const Float* total_xty = arr_total_xty.get_data();
+
+    auto arr_errors = array<Float>::empty(fold_count * alpha_count);
+    Float* errors = arr_errors.get_mutable_data();
+
+    // The betas in the order of the columns of the cross products, the
+    // intercept is the last one
+    std::vector<double> b(xtx_size);
+    for (int64_t f = 0; f < fold_count; ++f) {
+        const Float* fold_xtx = folds[f].xtx.get_data();
+        const Float* fold_xty = folds[f].xty.get_data();
+        const Float* fold_yty = folds[f].yty.get_data();
+
+        auto arr_train_xtx = array<Float>::empty(xtx_size * xtx_size);
+        auto arr_train_xty = array<Float>::empty(response_count * xtx_size);
+        Float* train_xtx = arr_train_xtx.get_mutable_data();
+        Float* train_xty = arr_train_xty.get_mutable_data();
+        for (int64_t i = 0; i < xtx_size * xtx_size; ++i) {
+            train_xtx[i] = total_xtx[i] - fold_xtx[i];
+        }
+        for (int64_t i = 0; i < response_count * xtx_size; ++i) {
+            train_xty[i] = total_xty[i] - fold_xty[i];
+        }
+
+        const auto path_betas = train_path_kernel_cpu<Float>{}(ctx,
+                                                               arr_train_xtx,
+                                                               arr_train_xty,
+                                                               alphas,
+                                                               feature_count,
+                                                               response_count,
+                                                               compute_intercept);
+        const auto arr_path_betas = row_accessor<const Float>{ path_betas }.pull();
+        const Float* path = arr_path_betas.get_data();
+
+        // The squared error of the response r is y^T y - 2 b^T X^T y + b^T X^T X b,
+        // the kernels fill one triangle of X^T X and the other one stays zero
+        for (int64_t a = 0; a < alpha_count; ++a) {
+            double sse = 0.0;
+            for (int64_t r = 0; r < response_count; ++r) {
+                const Float* beta = path + (a * response_count + r) * beta_count;
+                for (int64_t j = 0; j < feature_count; ++j) {
+                    b[j] = beta[j + 1];
+                }
+                if (compute_intercept) {
+                    b[feature_count] = beta[0];
+                }
+                double cross = 0.0;
+                double quad = 0.0;
+                for (int64_t j = 0; j < xtx_size; ++j) {
+                    double row = fold_xtx[j * xtx_size + j] * b[j];
+                    for (int64_t k = 0; k < xtx_size; ++k) {
+                        if (k != j) {
+                            row += (fold_xtx[j * xtx_size + k] + fold_xtx[k * xtx_size + j]) * b[k];
+                        }
+                    }
+                    cross += b[j] * fold_xty[r * xtx_size + j];
+                    quad += b[j] * row;
+                }
+                sse += fold_yty[r] - 2.0 * cross + quad;
+            }
+            const double value_count = double(folds[f].row_count * response_count);
+            errors[f * alpha_count + a] = static_cast<Float>(std::max(sse, 0.0) / value_count);
+        }
+    }
+
+    return dal::detail::homogen_table_builder{}
+        .reset(arr_errors, fold_count, alpha_count)
+        .build();
+}
+
+/// The cross products of every fold are accumulated by the online kernel in
+/// one pass over the data
+template <typename Float>
+static std::vector<fold_cross_products<Float>> compute_fold_cross_products(
+    const context_cpu& ctx,
+    const table& data,
+    const table& responses,
+    int64_t fold_count,
+    bool compute_intercept) {
+    const int64_t row_count = data.get_row_count();
+    const int64_t feature_count = data.get_column_count();
+    const int64_t response_count = responses.get_column_count();
+    const int64_t xtx_size = compute_intercept ? feature_count + 1 : feature_count;
+
+    std::vector<fold_cross_products<Float>> folds;
+    for (int64_t f = 0; f < fold_count; ++f) {
+        const int64_t first = get_fold_first_row(row_count, fold_count, f);
+        const int64_t last = get_fold_first_row(row_count, fold_count, f + 1);
+        const int64_t fold_row_count = last - first;
+
+        auto arr_data = row_accessor<const Float>{ data }.pull({ first, last });
+        auto arr_responses = row_accessor<const Float>{ responses }.pull({ first, last });
+
+        fold_cross_products<Float> fold{
+            array<Float>::zeros(xtx_size * xtx_size),
+            array<Float>::zeros(response_count * xtx_size),
+            compute_response_squares(arr_responses, fold_row_count, response_count),
+            fold_row_count,
+        };
+
+        const auto daal_data =
+            interop::convert_to_daal_homogen_table(arr_data, fold_row_count, feature_count);
+        const auto daal_responses =
+            interop::convert_to_daal_homogen_table(arr_responses, fold_row_count, response_count);
+        const auto daal_xtx = interop::convert_to_daal_homogen_table(fold.xtx, xtx_size, xtx_size);
+        const auto daal_xty =
+            interop::convert_to_daal_homogen_table(fold.xty, response_count, xtx_size);
+
+        const auto status = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+            constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+            return daal_rr_norm_eq_online_kernel_t<Float, daal_cpu>().compute(*daal_data,
+                                                                             *daal_responses,
+                                                                             *daal_xtx,
+                                                                             *daal_xty,
+                                                                             compute_intercept);
+        });
+        interop::status_to_exception(status);
+
+        folds.push_back(fold);
+    }
+    return folds;
+}
+
+/// The model, the path and the cross-validation errors are solved from the
+/// cross products of the folds, the data is read once
+template <typename Float, typename Task>
+static train_result<Task> train_with_cv(const context_cpu& ctx,
+                                        const descriptor_base<Task>& desc,
+                                        const table& data,
+                                        const table& responses,
+                                        const table& alphas,
+                                        int64_t fold_count) {
+    const bool compute_intercept = desc.get_compute_intercept();
+
+    const int64_t feature_count = data.get_column_count();
+    const int64_t response_count = responses.get_column_count();
+    const int64_t beta_count = feature_count + 1;
+    const int64_t xtx_size = compute_intercept ? beta_count : feature_count;
+
+    const auto folds = compute_fold_cross_products<Float>(ctx,
+                                                          data,
+                                                          responses,
+                                                          fold_count,
+                                                          compute_intercept);
+
+    array<Float> arr_xtx;
+    array<Float> arr_xty;
+    sum_fold_cross_products(folds, arr_xtx, arr_xty);
+    auto arr_betas = array<Float>::zeros(response_count * beta_count);
+    auto arr_ridge = array<Float>::full(1, static_cast<Float>(desc.get_alpha()));
+
+    const auto daal_xtx = interop::convert_to_daal_homogen_table(arr_xtx, xtx_size, xtx_size);
+    const auto daal_xty =
+        interop::convert_to_daal_homogen_table(arr_xty, response_count, xtx_size);
+    const auto daal_betas =
+        interop::convert_to_daal_homogen_table(arr_betas, response_count, beta_count);
+    const auto daal_ridge = interop::convert_to_daal_homogen_table(arr_ridge, 1, 1);
+
+    const auto status = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+        return daal_rr_norm_eq_online_kernel_t<Float, daal_cpu>().finalizeCompute(
+            *daal_xtx,
+            *daal_xty,
+            *daal_xtx,
+            *daal_xty,
+            *daal_betas,
+            compute_intercept,
+            *daal_ridge);
+    });
+    interop::status_to_exception(status);
+
+    const auto betas =
+        dal::detail::homogen_table_builder{}.reset(arr_betas, response_count, beta_count).build();
+    auto result = train_result<Task>().set_model(model<Task>().set_betas(betas));
+
+    if (alphas.has_data()) {
+        result.set_path_betas(train_path_kernel_cpu<Float>{}(ctx,
+                                                             arr_xtx,
+                                                             arr_xty,
+                                                             alphas,
+                                                             feature_count,
+                                                             response_count,
+                                                             compute_intercept));
+    }
+
+    const auto cv_alphas =
+        alphas.has_data()
+            ? alphas
+            : dal::detail::homogen_table_builder{}
+                  .reset(array<Float>::full(1, static_cast<Float>(desc.get_alpha())), 1, 1)
+                  .build();
+    return result.set_cv_errors(train_cv_kernel_cpu<Float>{}(ctx,
+                                                             folds,
+                                                             cv_alphas,
+                                                             feature_count,
+                                                             response_count,
+                                                             compute_intercept));
+}
+
+template <typename Float, typename Task>
+static train_result<Task> call_daal_kernel(const context_cpu& ctx,
+                                           const descriptor_base<Task>& desc,
+                                           const table& data,
+                                           const table& responses,
+                                           const table& alphas) {
+    const bool compute_intercept = desc.get_compute_intercept();
+
+    const int64_t feature_count = data.get_column_count();
+    const int64_t response_count = responses.get_column_count();
+    const int64_t beta_count = feature_count + 1;
+    const int64_t xtx_size = compute_intercept ? beta_count : feature_count;
+
+    auto arr_xtx = array<Float>::empty(xtx_size * xtx_size);
+    auto arr_xty = array<Float>::empty(response_count * xtx_size);
+    auto arr_betas = array<Float>::zeros(response_count * beta_count);
+    auto arr_ridge = array<Float>::full(1, static_cast<Float>(desc.get_alpha()));
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_responses = interop::convert_to_daal_table<Float>(responses);
+    const auto daal_xtx = interop::convert_to_daal_homogen_table(arr_xtx, xtx_size, xtx_size);
+    const auto daal_xty =
+        interop::convert_to_daal_homogen_table(arr_xty, response_count, xtx_size);
+    const auto daal_betas =
+        interop::convert_to_daal_homogen_table(arr_betas, response_count, beta_count);
+    const auto daal_ridge = interop::convert_to_daal_homogen_table(arr_ridge, 1, 1);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_rr_norm_eq_kernel_t>(ctx,
+                                                                   *daal_data,
+                                                                   *daal_responses,
+                                                                   *daal_xtx,
+                                                                   *daal_xty,
+                                                                   *daal_betas,
+                                                                   compute_intercept,
+                                                                   *daal_ridge));
+
+    const auto betas =
+        dal::detail::homogen_table_builder{}.reset(arr_betas, response_count, beta_count).build();
+    auto result = train_result<Task>().set_model(model<Task>().set_betas(betas));
+
+    // The cross products are left intact by the kernel and serve the whole path
+    if (alphas.has_data()) {
+        result.set_path_betas(train_path_kernel_cpu<Float>{}(ctx,
+                                                             arr_xtx,
+                                                             arr_xty,
+                                                             alphas,
+                                                             feature_count,
+                                                             response_count,
+                                                             compute_intercept));
+    }
+    return result;
+}
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::norm_eq, task::regression> {
+    train_result<task::regression> operator()(const context_cpu& ctx,
+                                              const descriptor_base<task::regression>& desc,
+                                              const train_input<task::regression>& input) const {
+        if (input.get_fold_count() > 0) {
+            return train_with_cv<Float, task::regression>(ctx,
+                                                          desc,
+                                                          input.get_data(),
+                                                          input.get_responses(),
+                                                          input.get_alphas(),
+                                                          input.get_fold_count());
+        }
+        return call_daal_kernel<Float, task::regression>(ctx,
+                                                         desc,
+                                                         input.get_data(),
+                                                         input.get_responses(),
+                                                         input.get_alphas());
+    }
+};
+
+template struct train_path_kernel_cpu<float>;
+template struct train_path_kernel_cpu<double>;
+
+template struct train_cv_kernel_cpu<float>;
+template struct train_cv_kernel_cpu<double>;
+
+template struct train_kernel_cpu<float, method::norm_eq, task::regression>;
+template struct train_kernel_cpu<double, method::norm_eq, task::regression>;
+
+} // namespace oneapi::dal::ridge_regression::backend
@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/ridge_regression/infer.hpp"
+#include "oneapi/dal/algo/ridge_regression/train.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+TEST(ridge_regression_norm_eq_cpu, train_and_infer_results) {
+    constexpr std::int64_t row_count = 3;
+    constexpr std::int64_t column_count = 1;
+
+    const float data[] = { 1.0, 2.0, 3.0 };
+    const float responses[] = { 2.0, 4.0, 6.0 };
+
+    // The beta is <x, y> / (<x, x> + alpha) without the intercept
+    const float betas[] = { 0.0, 28.0 / 15.0 };
+
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto responses_table = homogen_table::wrap(responses, row_count, 1);
+
+    const auto rr_desc =
+        ridge_regression::descriptor<>().set_alpha(1.0).set_compute_intercept(false);
+
+    const auto result_train = train(rr_desc, data_table, responses_table);
+
+    const auto betas_data =
+        row_accessor<const float>(result_train.get_model().get_betas()).pull().get_data();
+    for (std::int64_t i = 0; i < column_count + 1; ++i) {
+        ASSERT_NEAR(betas[i], betas_data[i], 1e-5);
+    }
+
+    const auto result_infer = infer(rr_desc, result_train.get_model(), data_table);
+
+    const auto infer_responses =
+        row_accessor<const float>(result_infer.get_responses()).pull().get_data();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        ASSERT_NEAR(betas[1] * data[i], infer_responses[i], 1e-5);
+    }
+}
+
+TEST(ridge_regression_norm_eq_cpu, alpha_should_be_positive) {
+    ASSERT_THROW((ridge_regression::descriptor<>().set_alpha(0.0)), domain_error);
+}
+
+TEST(ridge_regression_norm_eq_cpu, path_betas_match_single_alpha_models) {
+    constexpr std::int64_t row_count = 3;
+    constexpr std::int64_t column_count = 1;
+    constexpr std::int64_t alpha_count = 3;
+
+    const float data[] = { 1.0, 2.0, 3.0 };
+    const float responses[] = { 2.0, 4.0, 6.0 };
+    const float alphas[] = { 1.0, 2.0, 6.0 };
+
+    const auto data_table = homogen_table::wrap(data, row_count, column_count);
+    const auto responses_table = homogen_table::wrap(responses, row_count, 1);
+    const auto alphas_table = homogen_table::wrap(alphas, 1, alpha_count);
+
+    const auto input = ridge_regression::train_input<>(data_table, responses_table)
+                           .set_alphas(alphas_table);
+
+    for (std::int64_t i = 0; i < alpha_count; ++i) {
+        const auto rr_desc = ridge_regression::descriptor<>().set_alpha(alphas[i]);
+
+        const auto result_train = train(rr_desc, input);
+        const auto path_betas = result_train.get_path_betas();
+        ASSERT_EQ(path_betas.get_row_count(), alpha_count);
+        ASSERT_EQ(path_betas.get_column_count(), column_count + 1);
+
+        // The slope is the centered <x, y> / (<x, x> + alpha), the intercept
+        // is not regularized
+        const float slope = 4.0 / (2.0 + alphas[i]);
+        const auto arr_path = row_accessor<const float>(path_betas).pull();
+        ASSERT_NEAR(slope, arr_path[i * 2 + 1], 1e-5);
+        ASSERT_NEAR(4.0 - 2.0 * slope, arr_path[i * 2], 1e-5);
+
+        const auto arr_betas =
+            row_accessor<const float>(result_train.get_model().get_betas()).pull();
+        ASSERT_NEAR(arr_betas[0], arr_path[i * 2], 1e-5);
+        ASSERT_NEAR(arr_betas[1], arr_path[i * 2 + 1], 1e-5);
+    }
+}
+
+TEST(ridge_regression_norm_eq_cpu, cv_errors_match_models_trained_without_the_fold) {
+    constexpr std::int64_t row_count = 6;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t fold_count = 3;
+    constexpr std::int64_t alpha_count = 2;
+
+    const double data[] = { 1.0, 0.5, 2.0, -1.0, 3.0, 2.0, 4.0, 0.0, 5.0, 1.5, 6.0, -0.5 };
+    const double responses[] = { 1.0, 3.5, 4.0, 7.5, 8.0, 11.0 };
+    const double alphas[] = { 0.5, 2.0 };
+
+    const auto input = ridge_regression::train_input<>(
+                           homogen_table::wrap(data, row_count, column_count),
+                           homogen_table::wrap(responses, row_count, 1))
+                           .set_alphas(homogen_table::wrap(alphas, 1, alpha_count))
+                           .set_fold_count(fold_count);
+    const auto cv_result = train(ridge_regression::descriptor<double>{}, input);
+
+    const auto cv_errors = cv_result.get_cv_errors();
+    ASSERT_EQ(cv_errors.get_row_count(), fold_count);
+    ASSERT_EQ(cv_errors.get_column_count(), alpha_count);
+    const auto arr_cv_errors = row_accessor<const double>(cv_errors).pull();
+
+    // The folds are the blocks of two rows
+    for (std::int64_t f = 0; f < fold_count; ++f) {
+        std::vector<double> train_data;
+        std::vector<double> train_responses;
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            if (i / 2 != f) {
+                train_data.insert(train_data.end(),
+                                  data + i * column_count,
+                                  data + (i + 1) * column_count);
+                train_responses.push_back(responses[i]);
+            }
+        }
+        const auto train_data_table =
+            homogen_table::wrap(train_data.data(), row_count - 2, column_count);
+        const auto train_responses_table =
+            homogen_table::wrap(train_responses.data(), row_count - 2, 1);
+
+        for (std::int64_t a = 0; a < alpha_count; ++a) {
+            const auto rr_desc = ridge_regression::descriptor<double>{}.set_alpha(alphas[a]);
+            const auto betas = row_accessor<const double>(
+                                   train(rr_desc, train_data_table, train_responses_table)
+                                       .get_model()
+                                       .get_betas())
+                                   .pull();
+            double mse = 0.0;
+            for (std::int64_t i = 2 * f; i < 2 * f + 2; ++i) {
+                const double prediction =
+                    betas[0] + betas[1] * data[i * column_count] +
+                    betas[2] * data[i * column_count + 1];
+                mse += (responses[i] - prediction) * (responses[i] - prediction) / 2.0;
+            }
+            ASSERT_NEAR(mse, arr_cv_errors[f * alpha_count + a], 1e-8 * (1.0 + mse));
+        }
+    }
+
+    // The model is trained on all the rows
+    const auto batch_betas =
+        row_accessor<const double>(
+            train(ridge_regression::descriptor<double>{},
+                  homogen_table::wrap(data, row_count, column_count),
+                  homogen_table::wrap(responses, row_count, 1))
+                .get_model()
+                .get_betas())
+            .pull();
+    const auto cv_betas =
+        row_accessor<const double>(cv_result.get_model().get_betas()).pull();
+    for (std::int64_t j = 0; j < column_count + 1; ++j) {
+        ASSERT_NEAR(batch_betas[j], cv_betas[j], 1e-10);
+    }
+}
+
+TEST(ridge_regression_norm_eq_cpu, fold_count_should_not_exceed_row_count) {
+    const double data[] = { 1.0, 2.0, 3.0 };
+    const auto input = ridge_regression::train_input<>(homogen_table::wrap(data, 3, 1),
+                                                       homogen_table::wrap(data, 3, 1))
+                           .set_fold_count(4);
+    ASSERT_THROW(train(ridge_regression::descriptor<double>{}, input), invalid_argument);
+}
@@ -0,0 +1,207 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <daal/src/algorithms/ridge_regression/ridge_regression_train_kernel.h>
+#include <src/algorithms/linear_model/oneapi/linear_model_train_normeq_kernel_oneapi.h>
+
+#include "oneapi/dal/algo/ridge_regression/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/ridge_regression/backend/gpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::ridge_regression::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+using dal::backend::context_gpu;
+
+namespace daal_rr = daal::algorithms::ridge_regression;
+namespace daal_ne = daal::algorithms::linear_model::normal_equations;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_ne_update_kernel_oneapi_t = daal_ne::training::internal::UpdateKernelOneAPI<Float>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_rr_norm_eq_online_kernel_t =
+    daal_rr::training::internal::OnlineKernel<Float, daal_rr::training::normEqDense, Cpu>;
+
+/// Accumulates the cross products of the rows of the range on the device
+template <typename Float>
+static void update_cross_products(sycl::queue& queue,
+                                  const table& data,
+                                  const table& responses,
+                                  const range& rows,
+                                  array<Float>& xtx,
+                                  array<Float>& xty,
+                                  bool compute_intercept) {
+    interop::execution_context_guard guard(queue);
+
+    const int64_t row_count = rows.get_element_count(data.get_row_count());
+    const int64_t feature_count = data.get_column_count();
+    const int64_t response_count = responses.get_column_count();
+    const int64_t xtx_size = compute_intercept ? feature_count + 1 : feature_count;
+
+    auto arr_data = row_accessor<const Float>{ data }.pull(queue, rows);
+    auto arr_responses = row_accessor<const Float>{ responses }.pull(queue, rows);
+
+    const auto daal_data =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_data, row_count, feature_count);
+    const auto daal_responses = interop::convert_to_daal_sycl_homogen_table(queue,
+                                                                            arr_responses,
+                                                                            row_count,
+                                                                            response_count);
+    const auto daal_xtx =
+        interop::convert_to_daal_sycl_homogen_table(queue, xtx, xtx_size, xtx_size);
+    const auto daal_xty =
+        interop::convert_to_daal_sycl_homogen_table(queue, xty, response_count, xtx_size);
+
+    interop::status_to_exception(
+        daal_ne_update_kernel_oneapi_t<Float>::compute(*daal_data,
+                                                       *daal_responses,
+                                                       *daal_xtx,
+                                                       *daal_xty,
+                                                       compute_intercept));
+}
+
+/// DAAL has no ridge regression kernel for GPU, the cross products are
+/// computed on the device and the small system is solved on the host
+template <typename Float>
+struct train_kernel_gpu<Float, method::norm_eq, task::regression> {
+    train_result<task::regression> operator()(const context_gpu& ctx,
+                                              const descriptor_base<task::regression>& desc,
+                                              const train_input<task::regression>& input) const {
+        auto& queue = ctx.get_queue();
+
+        const auto data = input.get_data();
+        const auto responses = input.get_responses();
+        const bool compute_intercept = desc.get_compute_intercept();
+
+        const int64_t row_count = data.get_row_count();
+        const int64_t feature_count = data.get_column_count();
+        const int64_t response_count = responses.get_column_count();
+        const int64_t beta_count = feature_count + 1;
+        const int64_t xtx_size = compute_intercept ? beta_count : feature_count;
+
+        // The cross products of the folds are computed in one pass over the
+        // data and summed up
+        const int64_t fold_count = input.get_fold_count();
+        std::vector<fold_cross_products<Float>> folds;
+        array<Float> arr_xtx;
+        array<Float> arr_xty;
+        if (fold_count > 0) {
+            for (int64_t f = 0; f < fold_count; ++f) {
+                const int64_t first = get_fold_first_row(row_count, fold_count, f);
+                const int64_t last = get_fold_first_row(row_count, fold_count, f + 1);
+                const auto arr_fold_responses =
+                    row_accessor<const Float>{ responses }.pull({ first, last });
+
+                fold_cross_products<Float> fold{
+                    array<Float>::zeros(queue, xtx_size * xtx_size),
+                    array<Float>::zeros(queue, response_count * xtx_size),
+                    compute_response_squares(arr_fold_responses, last - first, response_count),
+                    last - first,
+                };
+                update_cross_products(queue,
+                                      data,
+                                      responses,
+                                      { first, last },
+                                      fold.xtx,
+                                      fold.xty,
+                                      compute_intercept);
+                folds.push_back(fold);
+            }
+            sum_fold_cross_products(folds, arr_xtx, arr_xty);
+        }
+        else {
+            arr_xtx = array<Float>::zeros(queue, xtx_size * xtx_size);
+            arr_xty = array<Float>::zeros(queue, response_count * xtx_size);
+            update_cross_products(queue,
+                                  data,
+                                  responses,
+                                  { 0, row_count },
+                                  arr_xtx,
+                                  arr_xty,
+                                  compute_intercept);
+        }
+
+        // The shared arrays are accessible on the host
+        auto arr_betas = array<Float>::zeros(response_count * beta_count);
+        auto arr_ridge = array<Float>::full(1, static_cast<Float>(desc.get_alpha()));
+
+        const auto daal_xtx = interop::convert_to_daal_homogen_table(arr_xtx, xtx_size, xtx_size);
+        const auto daal_xty =
+            interop::convert_to_daal_homogen_table(arr_xty, response_count, xtx_size);
+        const auto daal_betas =
+            interop::convert_to_daal_homogen_table(arr_betas, response_count, beta_count);
+        const auto daal_ridge = interop::convert_to_daal_homogen_table(arr_ridge, 1, 1);
+
+        const auto status = dal::backend::dispatch_by_cpu(context_cpu{}, [&](auto cpu) {
+            constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+            return daal_rr_norm_eq_online_kernel_t<Float, daal_cpu>().finalizeCompute(
+                *daal_xtx,
+                *daal_xty,
+                *daal_xtx,
+                *daal_xty,
+                *daal_betas,
+                compute_intercept,
+                *daal_ridge);
+        });
+        interop::status_to_exception(status);
+
+        const auto betas = dal::detail::homogen_table_builder{}
+                               .reset(arr_betas, response_count, beta_count)
+                               .build();
+        auto result = train_result<task::regression>().set_model(
+            model<task::regression>().set_betas(betas));
+
+        const auto alphas = input.get_alphas();
+        if (alphas.has_data()) {
+            result.set_path_betas(train_path_kernel_cpu<Float>{}(context_cpu{},
+                                                                 arr_xtx,
+                                                                 arr_xty,
+                                                                 alphas,
+                                                                 feature_count,
+                                                                 response_count,
+                                                                 compute_intercept));
+        }
+
+        if (fold_count > 0) {
+            const auto cv_alphas =
+                alphas.has_data()
+                    ? alphas
+                    : dal::detail::homogen_table_builder{}
+                          .reset(array<Float>::full(1, static_cast<Float>(desc.get_alpha())), 1, 1)
+                          .build();
+            result.set_cv_errors(train_cv_kernel_cpu<Float>{}(context_cpu{},
+                                                              folds,
+                                                              cv_alphas,
+                                                              feature_count,
+                                                              response_count,
+                                                              compute_intercept));
+        }
+        return result;
+    }
+};
+
+template struct train_kernel_gpu<float, method::norm_eq, task::regression>;
+template struct train_kernel_gpu<double, method::norm_eq, task::regression>;
+
+} // namespace oneapi::dal::ridge_regression::backend
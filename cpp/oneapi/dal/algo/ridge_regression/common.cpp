@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/ridge_regression/common.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::ridge_regression {
+
+template <>
+class detail::descriptor_impl<task::regression> : public base {
+public:
+    double alpha = 1.0;
+    bool compute_intercept = true;
+};
+
+template <>
+class detail::model_impl<task::regression> : public base {
+public:
+    table betas;
+};
+
+using detail::descriptor_impl;
+using detail::model_impl;
+
+template <typename Task>
+descriptor_base<Task>::descriptor_base() : impl_(new descriptor_impl<Task>{}) {}
+
+template <>
+double descriptor_base<task::regression>::get_alpha() const {
+    return impl_->alpha;
+}
+
+template <>
+bool descriptor_base<task::regression>::get_compute_intercept() const {
+    return impl_->compute_intercept;
+}
+
+template <>
+void descriptor_base<task::regression>::set_alpha_impl(double value) {
+    if (value <= 0.0) {
+        throw domain_error("alpha should be > 0.0");
+    }
+    impl_->alpha = value;
+}
+
+template <>
+void descriptor_base<task::regression>::set_compute_intercept_impl(bool value) {
+    impl_->compute_intercept = value;
+}
+
+template <typename Task>
+model<Task>::model() : impl_(new model_impl<Task>{}) {}
+
+template <typename Task>
+table model<Task>::get_betas() const {
+    return impl_->betas;
+}
+
+template <typename Task>
+void model<Task>::set_betas_impl(const table& value) {
+    impl_->betas = value;
+}
+
+template class ONEAPI_DAL_EXPORT descriptor_base<task::regression>;
+template class ONEAPI_DAL_EXPORT model<task::regression>;
+
+} // namespace oneapi::dal::ridge_regression
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/algo/ridge_regression/common.hpp"
+
+namespace oneapi::dal::ridge_regression {
+
+namespace detail {
+template <typename Task = task::by_default>
+class train_input_impl;
+
+template <typename Task = task::by_default>
+class train_result_impl;
+} // namespace detail
+
+template <typename Task = task::by_default>
+class ONEAPI_DAL_EXPORT train_input : public base {
+public:
+    using task_t = Task;
+    train_input(const table& data, const table& responses);
+
+    table get_data() const;
+    table get_responses() const;
+
+    auto& set_data(const table& value) {
+        set_data_impl(value);
+        return *this;
+    }
+
+    auto& set_responses(const table& value) {
+        set_responses_impl(value);
+        return *this;
+    }
+
+    /// The 1 x alpha_count table of the values of alpha of the
+    /// regularization path, they are solved for from the cross products of
+    /// the same pass over the data as the model. The path is not computed if
+    /// the table is empty.
+    table get_alphas() const;
+
+    auto& set_alphas(const table& value) {
+        set_alphas_impl(value);
+        return *this;
+    }
+
+    /// The number of the folds of the cross-validation of the alphas of the
+    /// path, or of the alpha of the descriptor if the path is empty. The
+    /// folds are the contiguous blocks of rows of nearly equal size, the
+    /// cross-validation is not run if the count is zero.
+    std::int64_t get_fold_count() const;
+
+    auto& set_fold_count(std::int64_t value) {
+        set_fold_count_impl(value);
+        return *this;
+    }
+
+private:
+    void set_data_impl(const table& value);
+    void set_responses_impl(const table& value);
+    void set_alphas_impl(const table& value);
+    void set_fold_count_impl(std::int64_t value);
+
+    dal::detail::pimpl<detail::train_input_impl<task_t>> impl_;
+};
+
+template <typename Task = task::by_default>
+class ONEAPI_DAL_EXPORT train_result {
+public:
+    using task_t = Task;
+    train_result();
+
+    model<task_t> get_model() const;
+
+    auto& set_model(const model<task_t>& value) {
+        set_model_impl(value);
+        return *this;
+    }
+
+    /// The (alpha_count * response_count) x (feature_count + 1) table of the
+    /// betas of the regularization path, the rows of the alpha i are
+    /// i * response_count, ..., (i + 1) * response_count - 1
+    table get_path_betas() const;
+
+    auto& set_path_betas(const table& value) {
+        set_path_betas_impl(value);
+        return *this;
+    }
+
+    /// The fold_count x alpha_count table of the mean squared errors of the
+    /// responses of the rows of every fold predicted by the model trained on
+    /// the other folds
+    table get_cv_errors() const;
+
+    auto& set_cv_errors(const table& value) {
+        set_cv_errors_impl(value);
+        return *this;
+    }
+
+private:
+    void set_model_impl(const model<task_t>&);
+    void set_path_betas_impl(const table&);
+    void set_cv_errors_impl(const table&);
+
+    dal::detail::pimpl<detail::train_result_impl<task_t>> impl_;
+};
+
+} // namespace oneapi::dal::ridge_regression
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/algo/sigmoid_kernel/compute.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+using namespace oneapi::dal;
+
+TEST(sigmoid_kernel_dense_test, can_compute_simple_matrix) {
+    constexpr std::int64_t row_count_x = 2;
+    constexpr std::int64_t row_count_y = 2;
+    constexpr std::int64_t column_count = 2;
+    const float x_data[] = {
+        1.f,
+        2.f,
+        1.f,
+        1.f,
+    };
+    const float y_data[] = {
+        1.f,
+        1.f,
+        3.f,
+        1.f,
+    };
+
+    const auto x_table = homogen_table::wrap(x_data, row_count_x, column_count);
+    const auto y_table = homogen_table::wrap(y_data, row_count_y, column_count);
+
+    const auto kernel_desc = sigmoid_kernel::descriptor{};
+    const auto values_table = compute(kernel_desc, x_table, y_table).get_values();
+    ASSERT_EQ(values_table.get_row_count(), row_count_x);
+    ASSERT_EQ(values_table.get_column_count(), row_count_y);
+
+    const auto values = row_accessor<const float>(values_table).pull();
+    ASSERT_FLOAT_EQ(values[0], std::tanh(3.f));
+    ASSERT_FLOAT_EQ(values[1], std::tanh(5.f));
+    ASSERT_FLOAT_EQ(values[2], std::tanh(2.f));
+    ASSERT_FLOAT_EQ(values[3], std::tanh(4.f));
+}
+
+TEST(sigmoid_kernel_dense_test, can_compute_same_simple_matrix) {
+    constexpr std::int64_t row_count = 2;
+    constexpr std::int64_t column_count = 2;
+    const float x_data[] = {
+        1.f,
+        2.f,
+        1.f,
+        3.f,
+    };
+
+    const auto x_table = homogen_table::wrap(x_data, row_count, column_count);
+
+    const auto kernel_desc = sigmoid_kernel::descriptor{}.set_scale(0.1);
+    const auto values_table = compute(kernel_desc, x_table, x_table).get_values();
+    ASSERT_EQ(values_table.get_row_count(), row_count);
+    ASSERT_EQ(values_table.get_column_count(), row_count);
+
+    const auto values = row_accessor<const float>(values_table).pull();
+    ASSERT_FLOAT_EQ(values[0], std::tanh(0.5f));
+    ASSERT_FLOAT_EQ(values[1], std::tanh(0.7f));
+    ASSERT_FLOAT_EQ(values[2], std::tanh(0.7f));
+    ASSERT_FLOAT_EQ(values[3], std::tanh(1.f));
+}
+
+TEST(sigmoid_kernel_dense_test, can_compute_diff_matrix_not_default_params) {
+    constexpr std::int64_t row_count_x = 2;
+    constexpr std::int64_t row_count_y = 3;
+    constexpr std::int64_t column_count = 1;
+    const float x_data[] = {
+        1.f,
+        2.f,
+    };
+    const float y_data[] = {
+        1.f,
+        1.f,
+        3.f,
+    };
+
+    const auto x_table = homogen_table::wrap(x_data, row_count_x, column_count);
+    const auto y_table = homogen_table::wrap(y_data, row_count_y, column_count);
+
+    const auto kernel_desc = sigmoid_kernel::descriptor{}.set_scale(0.5).set_shift(-1.0);
+    const auto values_table = compute(kernel_desc, x_table, y_table).get_values();
+    ASSERT_EQ(values_table.get_row_count(), row_count_x);
+    ASSERT_EQ(values_table.get_column_count(), row_count_y);
+
+    const auto values = row_accessor<const float>(values_table).pull();
+    ASSERT_FLOAT_EQ(values[0], std::tanh(-0.5f));
+    ASSERT_FLOAT_EQ(values[1], std::tanh(-0.5f));
+    ASSERT_FLOAT_EQ(values[2], std::tanh(0.5f));
+    ASSERT_FLOAT_EQ(values[3], std::tanh(0.f));
+    ASSERT_FLOAT_EQ(values[4], std::tanh(0.f));
+    ASSERT_FLOAT_EQ(values[5], std::tanh(2.f));
+}
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/sigmoid_kernel/backend/gpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/common_dpc.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include <daal/src/algorithms/kernel_function/oneapi/kernel_function_linear_dense_default_kernel_oneapi.h>
+
+namespace oneapi::dal::sigmoid_kernel::backend {
+
+using dal::backend::context_gpu;
+
+namespace daal_linear_kernel = daal::algorithms::kernel_function::linear;
+namespace interop = dal::backend::interop;
+
+template <typename Float>
+using daal_linear_kernel_t =
+    daal_linear_kernel::internal::KernelImplLinearOneAPI<daal_linear_kernel::defaultDense, Float>;
+
+template <typename Float>
+class sigmoid_values_kernel;
+
+template <typename Float>
+static compute_result call_daal_kernel(const context_gpu& ctx,
+                                       const descriptor_base& desc,
+                                       const table& x,
+                                       const table& y) {
+    auto& queue = ctx.get_queue();
+    interop::execution_context_guard guard(queue);
+
+    const int64_t row_count_x = x.get_row_count();
+    const int64_t row_count_y = y.get_row_count();
+    const int64_t column_count = x.get_column_count();
+
+    auto arr_x = row_accessor<const Float>{ x }.pull(queue);
+    auto arr_y = row_accessor<const Float>{ y }.pull(queue);
+
+    auto arr_values = array<Float>::empty(queue, row_count_x * row_count_y);
+
+    const auto daal_x =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_x, row_count_x, column_count);
+    const auto daal_y =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_y, row_count_y, column_count);
+    const auto daal_values =
+        interop::convert_to_daal_sycl_homogen_table(queue, arr_values, row_count_x, row_count_y);
+
+    // The linear kernel computes scale * <x, y> + shift on the device, the
+    // values of the kernel function are taken from it elementwise in place
+    daal_linear_kernel::Parameter daal_parameter(desc.get_scale(), desc.get_shift());
+    daal_linear_kernel_t<Float>().compute(daal_x.get(),
+                                          daal_y.get(),
+                                          daal_values.get(),
+                                          &daal_parameter);
+
+    Float* values = arr_values.get_mutable_data();
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<sigmoid_values_kernel<Float>>(
+                sycl::range<1>(row_count_x * row_count_y),
+                [=](sycl::id<1> idx) {
+                    values[idx] = sycl::tanh(values[idx]);
+                });
+        })
+        .wait_and_throw();
+
+    return compute_result().set_values(
+        dal::detail::homogen_table_builder{}.reset(arr_values, row_count_x, row_count_y).build());
+}
+
+template <typename Float>
+static compute_result compute(const context_gpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_x(), input.get_y());
+}
+
+template <typename Float>
+struct compute_kernel_gpu<Float, method::dense> {
+    compute_result operator()(const context_gpu& ctx,
+                              const descriptor_base& desc,
+                              const compute_input& input) const {
+        return compute<Float>(ctx, desc, input);
+    }
+};
+
+template struct compute_kernel_gpu<float, method::dense>;
+template struct compute_kernel_gpu<double, method::dense>;
+
+} // namespace oneapi::dal::sigmoid_kernel::backend
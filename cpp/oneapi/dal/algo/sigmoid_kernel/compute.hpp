@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/sigmoid_kernel/compute_types.hpp"
+#include "oneapi/dal/algo/sigmoid_kernel/detail/compute_ops.hpp"
+#include "oneapi/dal/compute.hpp"
+#include "oneapi/dal/detail/compute_by_tiles.hpp"
+
+namespace oneapi::dal::detail {
+
+template <typename Descriptor>
+struct compute_ops<Descriptor, dal::sigmoid_kernel::detail::tag>
+        : dal::sigmoid_kernel::detail::compute_ops<Descriptor> {};
+
+} // namespace oneapi::dal::detail
+
+namespace oneapi::dal::sigmoid_kernel {
+
+/// Computes the kernel function by the tiles of tile_row_count rows of x without
+/// allocating the whole x.get_row_count() x y.get_row_count() matrix of values.
+/// The sink is called as sink(first_row, values) for every tile, see
+/// dal::detail::compute_by_tiles.
+template <typename Float, typename Method, typename Sink>
+void compute_by_tiles(const descriptor<Float, Method>& desc,
+                      const table& x,
+                      const table& y,
+                      std::int64_t tile_row_count,
+                      Sink&& sink) {
+    dal::detail::compute_by_tiles(desc, x, y, tile_row_count, std::forward<Sink>(sink));
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+template <typename Float, typename Method, typename Sink>
+void compute_by_tiles(sycl::queue& queue,
+                      const descriptor<Float, Method>& desc,
+                      const table& x,
+                      const table& y,
+                      std::int64_t tile_row_count,
+                      Sink&& sink) {
+    dal::detail::compute_by_tiles(queue, desc, x, y, tile_row_count, std::forward<Sink>(sink));
+}
+#endif
+
+} // namespace oneapi::dal::sigmoid_kernel
@@ -38,7 +38,7 @@ template <typename Float, daal::CpuType Cpu>
 using daal_svm_predict_kernel_t =
     daal_svm::prediction::internal::SVMPredictImpl<daal_svm::prediction::defaultDense, Float, Cpu>;
 
-template <typename Float>
+template <typename Float, typename Task>
 static infer_result call_daal_kernel(const context_cpu& ctx,
                                      const descriptor_base& desc,
                                      const model& trained_model,
@@ -48,13 +48,11 @@ static infer_result call_daal_kernel(const context_cpu& ctx,
     const int64_t support_vector_count = trained_model.get_support_vector_count();
 
     // TODO: data is table, not a homogen_table. Think better about accessor - is it enough to have just a row_accessor?
-    auto arr_data = row_accessor<const Float>{ data }.pull();
     auto arr_support_vectors =
         row_accessor<const Float>{ trained_model.get_support_vectors() }.pull();
     auto arr_coeffs = row_accessor<const Float>{ trained_model.get_coeffs() }.pull();
 
-    const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
     const auto daal_support_vectors = interop::convert_to_daal_homogen_table(arr_support_vectors,
                                                                              support_vector_count,
                                                                              column_count);
@@ -82,6 +80,13 @@ static infer_result call_daal_kernel(const context_cpu& ctx,
                                                                     *daal_decision_function,
                                                                     &daal_parameter));
 
+    /* The decision function of the regression is the predicted response */
+    if constexpr (std::is_same_v<Task, task::regression>) {
+        const auto table_response =
+            dal::detail::homogen_table_builder{}.reset(arr_decision_function, row_count, 1).build();
+        return infer_result().set_decision_function(table_response).set_labels(table_response);
+    }
+
     auto arr_label = array<Float>::empty(row_count * 1);
     auto label_data = arr_label.get_mutable_data();
     for (std::int64_t i = 0; i < row_count; ++i) {
@@ -95,11 +100,11 @@ static infer_result call_daal_kernel(const context_cpu& ctx,
         .set_labels(dal::detail::homogen_table_builder{}.reset(arr_label, row_count, 1).build());
 }
 
-template <typename Float>
+template <typename Float, typename Task>
 static infer_result infer(const context_cpu& ctx,
                           const descriptor_base& desc,
                           const infer_input& input) {
-    return call_daal_kernel<Float>(ctx, desc, input.get_model(), input.get_data());
+    return call_daal_kernel<Float, Task>(ctx, desc, input.get_model(), input.get_data());
 }
 
 template <typename Float>
@@ -107,11 +112,22 @@ struct infer_kernel_cpu<Float, task::classification, method::by_default> {
     infer_result operator()(const context_cpu& ctx,
                             const descriptor_base& desc,
                             const infer_input& input) const {
-        return infer<Float>(ctx, desc, input);
+        return infer<Float, task::classification>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct infer_kernel_cpu<Float, task::regression, method::by_default> {
+    infer_result operator()(const context_cpu& ctx,
+                            const descriptor_base& desc,
+                            const infer_input& input) const {
+        return infer<Float, task::regression>(ctx, desc, input);
     }
 };
 
 template struct infer_kernel_cpu<float, task::classification, method::by_default>;
 template struct infer_kernel_cpu<double, task::classification, method::by_default>;
+template struct infer_kernel_cpu<float, task::regression, method::by_default>;
+template struct infer_kernel_cpu<double, task::regression, method::by_default>;
 
 } // namespace oneapi::dal::svm::backend
@@ -45,28 +45,42 @@ template <typename Float, daal::CpuType Cpu>
 using daal_svm_smo_kernel_t =
     daal_svm::training::internal::SVMTrainImpl<daal_svm::training::boser, Float, Cpu>;
 
-template <typename Float, typename Method>
+template <typename Task>
+constexpr daal_svm::training::internal::SvmType get_daal_svm_type() {
+    if constexpr (std::is_same_v<Task, task::regression>)
+        return daal_svm::training::internal::regression;
+    return daal_svm::training::internal::classification;
+}
+
+template <typename Float, typename Task, typename Method>
 static train_result call_daal_kernel(const context_cpu& ctx,
                                      const descriptor_base& desc,
                                      const table& data,
                                      const table& labels,
-                                     const table& weights) {
+                                     const table& weights,
+                                     const table& initial_alphas) {
     const int64_t row_count = data.get_row_count();
     const int64_t column_count = data.get_column_count();
 
     // TODO: data is table, not a homogen_table. Think better about accessor - is it enough to have just a row_accessor?
-    auto arr_data = row_accessor<const Float>{ data }.pull();
     auto arr_weights = row_accessor<const Float>{ weights }.pull();
 
     auto arr_label = row_accessor<const Float>{ labels }.pull();
 
+    auto arr_initial_alphas = row_accessor<const Float>{ initial_alphas }.pull();
+
+    /* The regression trains on the responses as they are */
+    constexpr bool is_regression = std::is_same_v<Task, task::regression>;
     binary_label_t<Float> unique_label;
-    auto arr_new_label = convert_labels(arr_label, { Float(-1.0), Float(1.0) }, unique_label);
+    auto arr_new_label = is_regression
+                             ? arr_label
+                             : convert_labels(arr_label, { Float(-1.0), Float(1.0) }, unique_label);
 
-    const auto daal_data =
-        interop::convert_to_daal_homogen_table(arr_data, row_count, column_count);
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
     const auto daal_labels = interop::convert_to_daal_homogen_table(arr_new_label, row_count, 1);
     const auto daal_weights = interop::convert_to_daal_homogen_table(arr_weights, row_count, 1);
+    const auto daal_initial_alphas =
+        interop::convert_to_daal_homogen_table(arr_initial_alphas, row_count, 1);
 
     auto kernel_impl = desc.get_kernel_impl()->get_impl();
     const auto daal_kernel = kernel_impl->get_daal_kernel_function();
@@ -85,6 +99,7 @@ static train_result call_daal_kernel(const context_cpu& ctx,
     if constexpr (std::is_same_v<Method, method::smo>)
         interop::status_to_exception(
             interop::call_daal_kernel<Float, daal_svm_smo_kernel_t>(ctx,
+                                                                    nullptr,
                                                                     daal_data,
                                                                     daal_weights,
                                                                     *daal_labels,
@@ -93,31 +108,38 @@ static train_result call_daal_kernel(const context_cpu& ctx,
     else if constexpr (std::is_same_v<Method, method::thunder>)
         interop::status_to_exception(
             interop::call_daal_kernel<Float, daal_svm_thunder_kernel_t>(ctx,
+                                                                        nullptr,
                                                                         daal_data,
                                                                         daal_weights,
                                                                         *daal_labels,
                                                                         daal_model.get(),
-                                                                        &daal_parameter));
+                                                                        &daal_parameter,
+                                                                        daal_initial_alphas,
+                                                                        get_daal_svm_type<Task>(),
+                                                                        desc.get_epsilon()));
 
     auto table_support_indices =
         interop::convert_from_daal_homogen_table<Float>(daal_model->getSupportIndices());
 
-    auto trained_model = convert_from_daal_model<Float>(*daal_model)
-                             .set_first_class_label(unique_label.first)
-                             .set_second_class_label(unique_label.second);
+    auto trained_model = convert_from_daal_model<Float>(*daal_model);
+    if constexpr (!is_regression) {
+        trained_model.set_first_class_label(unique_label.first)
+            .set_second_class_label(unique_label.second);
+    }
 
     return train_result().set_model(trained_model).set_support_indices(table_support_indices);
 }
 
-template <typename Float, typename Method>
+template <typename Float, typename Task, typename Method>
 static train_result train(const context_cpu& ctx,
                           const descriptor_base& desc,
                           const train_input& input) {
-    return call_daal_kernel<Float, Method>(ctx,
+    return call_daal_kernel<Float, Task, Method>(ctx,
                                            desc,
                                            input.get_data(),
                                            input.get_labels(),
-                                           input.get_weights());
+                                           input.get_weights(),
+                                           input.get_initial_alphas());
 }
 
 template <typename Float, typename Method>
@@ -125,7 +147,16 @@ struct train_kernel_cpu<Float, task::classification, Method> {
     train_result operator()(const context_cpu& ctx,
                             const descriptor_base& desc,
                             const train_input& input) const {
-        return train<Float, Method>(ctx, desc, input);
+        return train<Float, task::classification, Method>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct train_kernel_cpu<Float, task::regression, method::thunder> {
+    train_result operator()(const context_cpu& ctx,
+                            const descriptor_base& desc,
+                            const train_input& input) const {
+        return train<Float, task::regression, method::thunder>(ctx, desc, input);
     }
 };
 
@@ -133,5 +164,7 @@ template struct train_kernel_cpu<float, task::classification, method::thunder>;
 template struct train_kernel_cpu<float, task::classification, method::smo>;
 template struct train_kernel_cpu<double, task::classification, method::thunder>;
 template struct train_kernel_cpu<double, task::classification, method::smo>;
+template struct train_kernel_cpu<float, task::regression, method::thunder>;
+template struct train_kernel_cpu<double, task::regression, method::thunder>;
 
 } // namespace oneapi::dal::svm::backend
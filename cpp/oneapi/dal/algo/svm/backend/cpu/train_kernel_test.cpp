@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 #include "oneapi/dal/algo/svm/infer.hpp"
 #include "oneapi/dal/algo/svm/train.hpp"
@@ -85,6 +87,38 @@ TEST(svm_thunder_dense_test, can_classify_linear_separable_surface_with_not_defa
     ASSERT_FLOAT_EQ(decision_function[support_index_positive], +1.f);
 }
 
+TEST(svm_thunder_dense_test, can_classify_linear_separable_surface_with_first_degree_polynomial) {
+    constexpr std::int64_t row_count_train = 6;
+    constexpr std::int64_t column_count = 2;
+    const float x_train[] = {
+        -2.f, -1.f, -1.f, -1.f, -1.f, -2.f, +1.f, +1.f, +1.f, +2.f, +2.f, +1.f,
+    };
+    const float y_train[] = {
+        -1.f, -1.f, -1.f, +1.f, +1.f, +1.f,
+    };
+    constexpr std::int64_t support_index_negative = 1;
+    constexpr std::int64_t support_index_positive = 3;
+    const auto x_train_table = homogen_table::wrap(x_train, row_count_train, column_count);
+    const auto y_train_table = homogen_table::wrap(y_train, row_count_train, 1);
+
+    const auto kernel_desc =
+        polynomial_kernel::descriptor{}.set_scale(0.1).set_shift(0.0).set_degree(1);
+    const auto svm_desc = svm::descriptor{ kernel_desc }.set_c(10.0);
+    const auto result_train = train(svm_desc, x_train_table, y_train_table);
+    ASSERT_EQ(result_train.get_support_vector_count(), 2);
+
+    auto support_indices_table = result_train.get_support_indices();
+    const auto support_indices = row_accessor<const float>(support_indices_table).pull();
+    ASSERT_EQ(support_indices[0], support_index_negative);
+    ASSERT_EQ(support_indices[1], support_index_positive);
+
+    const auto result_infer = infer(svm_desc, result_train.get_model(), x_train_table);
+    auto decision_function_table = result_infer.get_decision_function();
+    const auto decision_function = row_accessor<const float>(decision_function_table).pull();
+    ASSERT_FLOAT_EQ(decision_function[support_index_negative], -1.f);
+    ASSERT_FLOAT_EQ(decision_function[support_index_positive], +1.f);
+}
+
 TEST(svm_thunder_dense_test, can_classify_linear_separable_surface_with_big_margin) {
     constexpr std::int64_t row_count_train = 6;
     constexpr std::int64_t column_count = 2;
@@ -364,3 +398,108 @@ TEST(svm_thunder_dense_test, can_classify_any_two_labels) {
         ASSERT_EQ(result_train.get_model().get_second_class_label(), expected_labels[1]);
     }
 }
+
+TEST(svm_thunder_dense_test, can_warm_start_from_previous_model) {
+    constexpr std::int64_t row_count_train = 6;
+    constexpr std::int64_t row_count_grown = 8;
+    constexpr std::int64_t column_count = 2;
+    const float x_train[] = {
+        -2.f, -1.f, -1.f, -1.f, -1.f, -2.f, +1.f, +1.f,
+        +1.f, +2.f, +2.f, +1.f, -3.f, -3.f, +3.f, +3.f,
+    };
+    const float y_train[] = {
+        -1.f, -1.f, -1.f, +1.f, +1.f, +1.f, -1.f, +1.f,
+    };
+    constexpr std::int64_t support_index_negative = 1;
+    constexpr std::int64_t support_index_positive = 3;
+
+    const auto svm_desc = svm::descriptor{}.set_c(1.0);
+    const auto result_train = train(svm_desc,
+                                    homogen_table::wrap(x_train, row_count_train, column_count),
+                                    homogen_table::wrap(y_train, row_count_train, 1));
+    ASSERT_EQ(result_train.get_support_vector_count(), 2);
+
+    auto support_indices_table = result_train.get_support_indices();
+    const auto support_indices = row_accessor<const float>(support_indices_table).pull();
+    const auto coeffs = row_accessor<const float>(result_train.get_coeffs()).pull();
+    float initial_alphas[row_count_grown] = {};
+    for (std::int64_t i = 0; i < support_indices.get_count(); i++) {
+        initial_alphas[static_cast<std::int64_t>(support_indices[i])] = std::abs(coeffs[i]);
+    }
+
+    const auto x_grown_table = homogen_table::wrap(x_train, row_count_grown, column_count);
+    const auto y_grown_table = homogen_table::wrap(y_train, row_count_grown, 1);
+    const auto alphas_table = homogen_table::wrap(initial_alphas, row_count_grown, 1);
+    const auto input =
+        svm::train_input{ x_grown_table, y_grown_table }.set_initial_alphas(alphas_table);
+    const auto result_grown = train(svm_desc, input);
+    ASSERT_EQ(result_grown.get_support_vector_count(), 2);
+
+    auto grown_indices_table = result_grown.get_support_indices();
+    const auto grown_indices = row_accessor<const float>(grown_indices_table).pull();
+    ASSERT_EQ(grown_indices[0], support_index_negative);
+    ASSERT_EQ(grown_indices[1], support_index_positive);
+
+    const auto result_infer = infer(svm_desc, result_grown.get_model(), x_grown_table);
+    const auto decision_function =
+        row_accessor<const float>(result_infer.get_decision_function()).pull();
+    ASSERT_FLOAT_EQ(decision_function[support_index_negative], -1.f);
+    ASSERT_FLOAT_EQ(decision_function[support_index_positive], +1.f);
+}
+
+TEST(svm_smo_dense_test, throws_if_initial_alphas_are_given) {
+    const float x_train[] = { -1.f, -1.f, +1.f, +1.f };
+    const float y_train[] = { -1.f, +1.f };
+    const float initial_alphas[] = { 0.f, 0.f };
+
+    const auto x_train_table = homogen_table::wrap(x_train, 2, 2);
+    const auto y_train_table = homogen_table::wrap(y_train, 2, 1);
+    const auto alphas_table = homogen_table::wrap(initial_alphas, 2, 1);
+    const auto input =
+        svm::train_input{ x_train_table, y_train_table }.set_initial_alphas(alphas_table);
+    const auto svm_desc = svm::descriptor<float, svm::task::classification, svm::method::smo>{};
+    ASSERT_THROW(train(svm_desc, input), invalid_argument);
+}
+
+TEST(svm_thunder_dense_test, can_fit_linear_function_by_regression) {
+    constexpr std::int64_t row_count_train = 8;
+    const float x_train[] = {
+        0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f,
+    };
+    const float y_train[] = {
+        1.f, 3.f, 5.f, 7.f, 9.f, 11.f, 13.f, 15.f,
+    };
+    constexpr double epsilon = 0.1;
+    const auto x_train_table = homogen_table::wrap(x_train, row_count_train, 1);
+    const auto y_train_table = homogen_table::wrap(y_train, row_count_train, 1);
+
+    const auto svm_desc =
+        svm::descriptor<float, svm::task::regression>{}.set_c(10.0).set_epsilon(epsilon);
+    const auto result_train = train(svm_desc, x_train_table, y_train_table);
+    ASSERT_GT(result_train.get_support_vector_count(), 0);
+
+    const auto result_infer = infer(svm_desc, result_train.get_model(), x_train_table);
+    const auto response = row_accessor<const float>(result_infer.get_labels()).pull();
+    for (std::int64_t i = 0; i < row_count_train; i++) {
+        ASSERT_LE(std::abs(response[i] - y_train[i]), epsilon + 1e-2);
+    }
+}
+
+TEST(svm_thunder_dense_test, regression_throws_if_initial_alphas_are_given) {
+    const float x_train[] = { -1.f, +1.f };
+    const float y_train[] = { -1.f, +1.f };
+    const float initial_alphas[] = { 0.f, 0.f };
+
+    const auto x_train_table = homogen_table::wrap(x_train, 2, 1);
+    const auto y_train_table = homogen_table::wrap(y_train, 2, 1);
+    const auto alphas_table = homogen_table::wrap(initial_alphas, 2, 1);
+    const auto input =
+        svm::train_input{ x_train_table, y_train_table }.set_initial_alphas(alphas_table);
+    const auto svm_desc = svm::descriptor<float, svm::task::regression>{};
+    ASSERT_THROW(train(svm_desc, input), invalid_argument);
+}
+
+TEST(svm_thunder_dense_test, throws_if_epsilon_is_negative) {
+    auto svm_desc = svm::descriptor<float, svm::task::regression>{};
+    ASSERT_THROW(svm_desc.set_epsilon(-1.0), domain_error);
+}
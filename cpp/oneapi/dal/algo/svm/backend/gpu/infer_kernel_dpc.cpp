@@ -38,7 +38,7 @@ template <typename Float>
 using daal_svm_predict_kernel_t =
     daal_svm::prediction::internal::SVMPredictImplOneAPI<daal_svm::prediction::defaultDense, Float>;
 
-template <typename Float>
+template <typename Float, typename Task>
 static infer_result call_daal_kernel(const context_gpu& ctx,
                                      const descriptor_base& desc,
                                      const model& trained_model,
@@ -85,6 +85,13 @@ static infer_result call_daal_kernel(const context_gpu& ctx,
                                                                             *daal_decision_function,
                                                                             &daal_parameter));
 
+    /* The decision function of the regression is the predicted response */
+    if constexpr (std::is_same_v<Task, task::regression>) {
+        const auto table_response =
+            dal::detail::homogen_table_builder{}.reset(arr_decision_function, row_count, 1).build();
+        return infer_result().set_decision_function(table_response).set_labels(table_response);
+    }
+
     // TODO: rework with help dpcpp code
     auto arr_label = array<Float>::empty(row_count * 1);
     auto label_data = arr_label.get_mutable_data();
@@ -99,11 +106,11 @@ static infer_result call_daal_kernel(const context_gpu& ctx,
         .set_labels(dal::detail::homogen_table_builder{}.reset(arr_label, row_count, 1).build());
 }
 
-template <typename Float>
+template <typename Float, typename Task>
 static infer_result infer(const context_gpu& ctx,
                           const descriptor_base& desc,
                           const infer_input& input) {
-    return call_daal_kernel<Float>(ctx, desc, input.get_model(), input.get_data());
+    return call_daal_kernel<Float, Task>(ctx, desc, input.get_model(), input.get_data());
 }
 
 template <typename Float>
@@ -111,11 +118,22 @@ struct infer_kernel_gpu<Float, task::classification, method::by_default> {
     infer_result operator()(const context_gpu& ctx,
                             const descriptor_base& desc,
                             const infer_input& input) const {
-        return infer<Float>(ctx, desc, input);
+        return infer<Float, task::classification>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct infer_kernel_gpu<Float, task::regression, method::by_default> {
+    infer_result operator()(const context_gpu& ctx,
+                            const descriptor_base& desc,
+                            const infer_input& input) const {
+        return infer<Float, task::regression>(ctx, desc, input);
     }
 };
 
 template struct infer_kernel_gpu<float, task::classification, method::by_default>;
 template struct infer_kernel_gpu<double, task::classification, method::by_default>;
+template struct infer_kernel_gpu<float, task::regression, method::by_default>;
+template struct infer_kernel_gpu<double, task::regression, method::by_default>;
 
 } // namespace oneapi::dal::svm::backend
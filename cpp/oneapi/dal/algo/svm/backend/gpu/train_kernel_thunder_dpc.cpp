@@ -94,6 +94,9 @@ template <typename Float>
 static train_result train(const context_gpu& ctx,
                           const descriptor_base& desc,
                           const train_input& input) {
+    if (input.get_initial_alphas().has_data()) {
+        throw unimplemented("Input initial_alphas are not supported on GPU");
+    }
     return call_daal_kernel<Float>(ctx, desc, input.get_data(), input.get_labels());
 }
 
@@ -106,7 +109,18 @@ struct train_kernel_gpu<Float, task::classification, method::thunder> {
     }
 };
 
+template <typename Float>
+struct train_kernel_gpu<Float, task::regression, method::thunder> {
+    train_result operator()(const dal::backend::context_gpu& ctx,
+                            const descriptor_base& desc,
+                            const train_input& input) const {
+        throw unimplemented("SVM regression is not implemented for GPU");
+    }
+};
+
 template struct train_kernel_gpu<float, task::classification, method::thunder>;
 template struct train_kernel_gpu<double, task::classification, method::thunder>;
+template struct train_kernel_gpu<float, task::regression, method::thunder>;
+template struct train_kernel_gpu<double, task::regression, method::thunder>;
 
 } // namespace oneapi::dal::svm::backend
@@ -20,6 +20,7 @@
 
 #include <daal/include/algorithms/kernel_function/kernel_function_linear.h>
 #include <daal/include/algorithms/kernel_function/kernel_function_rbf.h>
+#include <daal/src/algorithms/kernel_function/polynomial/kernel_function_polynomial.h>
 
 namespace oneapi::dal::svm::detail {
 
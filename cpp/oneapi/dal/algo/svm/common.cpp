@@ -17,6 +17,7 @@
 #include "oneapi/dal/algo/svm/common.hpp"
 #include "oneapi/dal/algo/svm/backend/kernel_function_impl.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/detail/table_serialization.hpp"
 
 namespace oneapi::dal::svm {
 
@@ -25,6 +26,7 @@ namespace detail {
 using daal_kf = daal::algorithms::kernel_function::KernelIfacePtr;
 namespace daal_linear_kernel = daal::algorithms::kernel_function::linear;
 namespace daal_rbf_kernel = daal::algorithms::kernel_function::rbf;
+namespace daal_polynomial_kernel = daal::algorithms::kernel_function::polynomial::internal;
 
 template <typename Float, typename Method>
 class daal_interop_linear_kernel_impl : public kernel_function_impl {
@@ -121,6 +123,80 @@ INSTANTIATE_RBF(double, rbf_kernel::method::csr)
 
 #undef INSTANTIATE_RBF
 
+template <typename F, typename M>
+using polynomial_kernel_t = polynomial_kernel::descriptor<F, M>;
+
+template <typename Float>
+class daal_interop_polynomial_kernel_impl : public kernel_function_impl {
+public:
+    daal_interop_polynomial_kernel_impl(double scale,
+                                        double shift,
+                                        std::int64_t degree,
+                                        daal_polynomial_kernel::KernelType kernel_type)
+            : scale_(scale),
+              shift_(shift),
+              degree_(degree),
+              kernel_type_(kernel_type) {}
+
+    daal_kf get_daal_kernel_function() override {
+        auto alg = new daal_polynomial_kernel::Batch<Float, daal_polynomial_kernel::defaultDense>;
+        alg->parameter.scale = scale_;
+        alg->parameter.shift = shift_;
+        alg->parameter.degree = static_cast<std::size_t>(degree_);
+        alg->parameter.kernelType = kernel_type_;
+        return daal_kf(alg);
+    }
+
+private:
+    double scale_;
+    double shift_;
+    std::int64_t degree_;
+    daal_polynomial_kernel::KernelType kernel_type_;
+};
+
+template <typename F, typename M>
+kernel_function<polynomial_kernel_t<F, M>>::kernel_function(const polynomial_kernel_t<F, M> &kernel)
+        : kernel_(kernel),
+          impl_(new daal_interop_polynomial_kernel_impl<F>{ kernel.get_scale(),
+                                                            kernel.get_shift(),
+                                                            kernel.get_degree(),
+                                                            daal_polynomial_kernel::poly }) {}
+
+template <typename F, typename M>
+kernel_function_impl *kernel_function<polynomial_kernel_t<F, M>>::get_impl() const {
+    return impl_.get();
+}
+
+#define INSTANTIATE_POLYNOMIAL(F, M) template class kernel_function<polynomial_kernel_t<F, M>>;
+
+INSTANTIATE_POLYNOMIAL(float, polynomial_kernel::method::dense)
+INSTANTIATE_POLYNOMIAL(double, polynomial_kernel::method::dense)
+
+#undef INSTANTIATE_POLYNOMIAL
+
+template <typename F, typename M>
+using sigmoid_kernel_t = sigmoid_kernel::descriptor<F, M>;
+
+template <typename F, typename M>
+kernel_function<sigmoid_kernel_t<F, M>>::kernel_function(const sigmoid_kernel_t<F, M> &kernel)
+        : kernel_(kernel),
+          impl_(new daal_interop_polynomial_kernel_impl<F>{ kernel.get_scale(),
+                                                            kernel.get_shift(),
+                                                            0,
+                                                            daal_polynomial_kernel::sigmoid }) {}
+
+template <typename F, typename M>
+kernel_function_impl *kernel_function<sigmoid_kernel_t<F, M>>::get_impl() const {
+    return impl_.get();
+}
+
+#define INSTANTIATE_SIGMOID(F, M) template class kernel_function<sigmoid_kernel_t<F, M>>;
+
+INSTANTIATE_SIGMOID(float, sigmoid_kernel::method::dense)
+INSTANTIATE_SIGMOID(double, sigmoid_kernel::method::dense)
+
+#undef INSTANTIATE_SIGMOID
+
 } // namespace detail
 
 class detail::descriptor_impl : public base {
@@ -134,6 +210,7 @@ public:
     double cache_size = 200.0;
     double tau = 1e-6;
     bool shrinking = true;
+    double epsilon = 0.1;
 };
 
 class detail::model_impl : public base {
@@ -176,6 +253,10 @@ bool descriptor_base::get_shrinking() const {
     return impl_->shrinking;
 }
 
+double descriptor_base::get_epsilon() const {
+    return impl_->epsilon;
+}
+
 void descriptor_base::set_c_impl(double value) {
     if (value <= 0.0) {
         throw domain_error("c should be > 0");
@@ -215,6 +296,13 @@ void descriptor_base::set_shrinking_impl(bool value) {
     impl_->shrinking = value;
 }
 
+void descriptor_base::set_epsilon_impl(double value) {
+    if (value < 0.0) {
+        throw domain_error("epsilon should be >= 0.0");
+    }
+    impl_->epsilon = value;
+}
+
 void descriptor_base::set_kernel_impl(const detail::kf_iface_ptr &kernel) {
     impl_->kernel = kernel;
 }
@@ -273,4 +361,24 @@ void model::set_second_class_label_impl(std::int64_t value) {
     impl_->second_class_label = value;
 }
 
+void model::serialize(dal::detail::binary_output_archive &ar) const {
+    ar.write(dal::detail::serialization_id::svm_classification_model);
+    dal::detail::serialize_table(impl_->support_vectors, ar);
+    dal::detail::serialize_table(impl_->coeffs, ar);
+    ar.write(impl_->bias);
+    ar.write(impl_->support_vector_count);
+    ar.write(impl_->first_class_label);
+    ar.write(impl_->second_class_label);
+}
+
+void model::deserialize(dal::detail::binary_input_archive &ar) {
+    ar.expect(dal::detail::serialization_id::svm_classification_model);
+    impl_->support_vectors = dal::detail::deserialize_table(ar);
+    impl_->coeffs = dal::detail::deserialize_table(ar);
+    impl_->bias = ar.read<double>();
+    impl_->support_vector_count = ar.read<std::int64_t>();
+    impl_->first_class_label = ar.read<double>();
+    impl_->second_class_label = ar.read<double>();
+}
+
 } // namespace oneapi::dal::svm
@@ -17,7 +17,10 @@
 #pragma once
 
 #include "oneapi/dal/algo/linear_kernel.hpp"
+#include "oneapi/dal/algo/polynomial_kernel.hpp"
 #include "oneapi/dal/algo/rbf_kernel.hpp"
+#include "oneapi/dal/algo/sigmoid_kernel.hpp"
+#include "oneapi/dal/detail/archives.hpp"
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/table/common.hpp"
 
@@ -81,6 +84,32 @@ private:
     dal::detail::pimpl<kernel_function_impl> impl_;
 };
 
+template <typename Float, typename Method>
+class ONEAPI_DAL_EXPORT kernel_function<polynomial_kernel::descriptor<Float, Method>>
+        : public base, public kernel_function_iface {
+public:
+    using kernel_t = polynomial_kernel::descriptor<Float, Method>;
+    explicit kernel_function(const kernel_t &kernel);
+    kernel_function_impl *get_impl() const override;
+
+private:
+    kernel_t kernel_;
+    dal::detail::pimpl<kernel_function_impl> impl_;
+};
+
+template <typename Float, typename Method>
+class ONEAPI_DAL_EXPORT kernel_function<sigmoid_kernel::descriptor<Float, Method>>
+        : public base, public kernel_function_iface {
+public:
+    using kernel_t = sigmoid_kernel::descriptor<Float, Method>;
+    explicit kernel_function(const kernel_t &kernel);
+    kernel_function_impl *get_impl() const override;
+
+private:
+    kernel_t kernel_;
+    dal::detail::pimpl<kernel_function_impl> impl_;
+};
+
 } // namespace detail
 
 namespace method {
@@ -109,6 +138,7 @@ public:
     double get_cache_size() const;
     double get_tau() const;
     bool get_shrinking() const;
+    double get_epsilon() const;
     const detail::kf_iface_ptr &get_kernel_impl() const;
 
 protected:
@@ -120,6 +150,7 @@ protected:
     void set_cache_size_impl(double);
     void set_tau_impl(double);
     void set_shrinking_impl(bool);
+    void set_epsilon_impl(double);
     void set_kernel_impl(const detail::kf_iface_ptr &);
 
     dal::detail::pimpl<detail::descriptor_impl> impl_;
@@ -179,6 +210,13 @@ public:
         set_shrinking_impl(value);
         return *this;
     }
+
+    /// The half-width of the insensitive tube of the regression, the training
+    /// of the classification ignores it
+    auto &set_epsilon(double value) {
+        set_epsilon_impl(value);
+        return *this;
+    }
 };
 
 class ONEAPI_DAL_EXPORT model : public base {
@@ -237,6 +275,10 @@ private:
     void set_first_class_label_impl(std::int64_t);
     void set_second_class_label_impl(std::int64_t);
 
+    friend dal::detail::serialization_accessor;
+    void serialize(dal::detail::binary_output_archive &ar) const;
+    void deserialize(dal::detail::binary_input_archive &ar);
+
     dal::detail::pimpl<detail::model_impl> impl_;
 };
 
@@ -37,5 +37,7 @@ struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<host_policy, Float, Task, Method>
 
 INSTANTIATE(float, task::classification, method::by_default)
 INSTANTIATE(double, task::classification, method::by_default)
+INSTANTIATE(float, task::regression, method::by_default)
+INSTANTIATE(double, task::regression, method::by_default)
 
 } // namespace oneapi::dal::svm::detail
@@ -38,5 +38,7 @@ struct ONEAPI_DAL_EXPORT infer_ops_dispatcher<data_parallel_policy, Float, Task,
 
 INSTANTIATE(float, task::classification, method::by_default)
 INSTANTIATE(double, task::classification, method::by_default)
+INSTANTIATE(float, task::regression, method::by_default)
+INSTANTIATE(double, task::regression, method::by_default)
 
 } // namespace oneapi::dal::svm::detail
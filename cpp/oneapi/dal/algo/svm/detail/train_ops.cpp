@@ -39,5 +39,7 @@ INSTANTIATE(float, task::classification, method::smo)
 INSTANTIATE(float, task::classification, method::thunder)
 INSTANTIATE(double, task::classification, method::smo)
 INSTANTIATE(double, task::classification, method::thunder)
+INSTANTIATE(float, task::regression, method::thunder)
+INSTANTIATE(double, task::regression, method::thunder)
 
 } // namespace oneapi::dal::svm::detail
@@ -51,6 +51,21 @@ struct train_ops {
                 throw invalid_argument("Input data row_count should be equal to weights row_count");
             }
         }
+        if (input.get_initial_alphas().has_data()) {
+            if (!std::is_same_v<method_t, method::thunder>) {
+                throw invalid_argument("Input initial_alphas are supported only by thunder method");
+            }
+            if (std::is_same_v<task_t, task::regression>) {
+                throw invalid_argument("Input initial_alphas are not supported by regression");
+            }
+            if (input.get_data().get_row_count() != input.get_initial_alphas().get_row_count()) {
+                throw invalid_argument(
+                    "Input data row_count should be equal to initial_alphas row_count");
+            }
+            if (input.get_initial_alphas().get_column_count() != 1) {
+                throw invalid_argument("Input initial_alphas column_count should be equal to 1");
+            }
+        }
         if (!(params.get_kernel_impl()->get_impl())) {
             throw invalid_argument("Input kernel should be not be empty");
         }
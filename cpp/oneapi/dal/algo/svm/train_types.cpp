@@ -28,6 +28,7 @@ public:
     table data;
     table labels;
     table weights;
+    table initial_alphas;
 };
 
 class detail::train_result_impl : public base {
@@ -62,10 +63,18 @@ void train_input::set_labels_impl(const table& value) {
     impl_->labels = value;
 }
 
+table train_input::get_initial_alphas() const {
+    return impl_->initial_alphas;
+}
+
 void train_input::set_weights_impl(const table& value) {
     impl_->weights = value;
 }
 
+void train_input::set_initial_alphas_impl(const table& value) {
+    impl_->initial_alphas = value;
+}
+
 train_result::train_result() : impl_(new train_result_impl{}) {}
 
 model train_result::get_model() const {
@@ -50,10 +50,22 @@ public:
         return *this;
     }
 
+    /// The row_count x 1 table of the dual coefficients alpha >= 0 the thunder
+    /// method starts from. sum(alpha[i] * y[i]) shall be zero, e.g. the absolute
+    /// values of the coeffs of a previous model at its support indices and zeros
+    /// for the rest of the rows. Empty by default: the training starts from zeros.
+    table get_initial_alphas() const;
+
+    auto& set_initial_alphas(const table& value) {
+        set_initial_alphas_impl(value);
+        return *this;
+    }
+
 private:
     void set_data_impl(const table& value);
     void set_labels_impl(const table& value);
     void set_weights_impl(const table& value);
+    void set_initial_alphas_impl(const table& value);
 
     dal::detail::pimpl<detail::train_input_impl> impl_;
 };
@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/triangle_counting/common.hpp"
+#include "oneapi/dal/algo/triangle_counting/vertex_ranking_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::preview {
+namespace triangle_counting {
+namespace detail {
+
+/// Counts the triangles of the graph. The edges are oriented from the vertex
+/// with the smaller degree to the vertex with the larger one, so every triangle
+/// is found once at its first vertex as a common successor of the vertices of
+/// one of its edges, and the successor lists of the high degree vertices are
+/// short. The successors are intersected by the kernels of the Jaccard
+/// similarity, vectorized ones for the global count.
+template <typename Cpu>
+vertex_ranking_result call_triangle_counting_default_kernel(
+    const descriptor_base &desc,
+    vertex_ranking_input<undirected_adjacency_array_graph<>> &input);
+
+} // namespace detail
+} // namespace triangle_counting
+} // namespace oneapi::dal::preview
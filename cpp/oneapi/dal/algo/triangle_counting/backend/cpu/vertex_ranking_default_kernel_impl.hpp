@@ -0,0 +1,228 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_default_kernel.hpp"
+#include "oneapi/dal/algo/triangle_counting/backend/cpu/vertex_ranking_default_kernel.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_array_graph_impl.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::preview {
+namespace triangle_counting {
+namespace detail {
+
+/// The number of the vertices processed by one task of the orientation passes
+constexpr std::int64_t orientation_block_size = 4096;
+
+/// The number of the tasks of the counting pass per thread used to balance the load
+constexpr std::int64_t counting_tasks_per_thread = 16;
+
+template <typename Cpu, typename Body>
+void for_each_vertex_block(std::int64_t vertex_count, const Body &body) {
+    using load_graph::detail::threader_for;
+    const std::int64_t block_count =
+        (vertex_count + orientation_block_size - 1) / orientation_block_size;
+    threader_for(block_count, block_count, [&](int b) {
+        const std::int32_t begin = static_cast<std::int32_t>(b * orientation_block_size);
+        const std::int32_t end =
+            static_cast<std::int32_t>(std::min(vertex_count, (b + 1) * orientation_block_size));
+        body(begin, end);
+    });
+}
+
+/// Splits the vertices into the ranges of the close estimated cost of the
+/// counting pass, the cost of the vertex grows as the square of the number
+/// of its successors
+template <typename Cpu>
+std::vector<std::int32_t> split_vertices(const std::vector<std::int64_t> &offsets) {
+    using load_graph::detail::threader_get_max_threads;
+    const std::int64_t vertex_count = static_cast<std::int64_t>(offsets.size()) - 1;
+    const auto get_cost = [&](std::int64_t u) {
+        const std::int64_t successor_count = offsets[u + 1] - offsets[u];
+        return successor_count * (successor_count + 1);
+    };
+
+    std::int64_t total_cost = 0;
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        total_cost += get_cost(u);
+    }
+    const std::int64_t task_count = counting_tasks_per_thread * threader_get_max_threads();
+    const std::int64_t target_cost = std::max<std::int64_t>(1, total_cost / task_count);
+
+    std::vector<std::int32_t> bounds(1, 0);
+    std::int64_t cost = 0;
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        cost += get_cost(u);
+        if (cost >= target_cost || u + 1 == vertex_count) {
+            bounds.push_back(static_cast<std::int32_t>(u + 1));
+            cost = 0;
+        }
+    }
+    return bounds;
+}
+
+/// Counts the triangles with the merge of the sorted successor lists of the
+/// vertices and the decoder of the compressed adjacency lists of the CPU
+template <typename Cpu, typename Decoder, typename Merge>
+vertex_ranking_result count_triangles(
+    const descriptor_base &desc,
+    vertex_ranking_input<undirected_adjacency_array_graph<>> &input,
+    const Merge &merge) {
+    using jaccard::detail::intersection_by_degree;
+    using jaccard::detail::intersection_merge;
+    using jaccard::detail::neighbor_bitmap;
+    using jaccard::detail::neighbor_reader;
+    using load_graph::detail::threader_for;
+
+    const auto &g = oneapi::dal::preview::detail::get_impl(input.get_graph());
+    const std::int64_t vertex_count = g->_vertex_count;
+    const std::int32_t *degrees = g->_degrees.data();
+    const bool is_local = desc.get_kind() != kind::global;
+    if (vertex_count == 0) {
+        return vertex_ranking_result(table{}, 0);
+    }
+
+    // u precedes v if it has the smaller degree, or the same degree and the smaller index
+    const auto precedes = [degrees](std::int32_t u, std::int32_t v) {
+        return degrees[u] < degrees[v] || (degrees[u] == degrees[v] && u < v);
+    };
+
+    // the successors of the vertices keep the order of the sorted neighbors
+    std::vector<std::int64_t> offsets(vertex_count + 1, 0);
+    for_each_vertex_block<Cpu>(vertex_count, [&](std::int32_t begin, std::int32_t end) {
+        neighbor_reader<Cpu, Decoder> reader(*g);
+        for (std::int32_t u = begin; u < end; ++u) {
+            const std::int32_t *neighbors = reader.get_column(u);
+            std::int64_t successor_count = 0;
+            for (std::int32_t k = 0; k < degrees[u]; ++k) {
+                successor_count += precedes(u, neighbors[k]);
+            }
+            offsets[u + 1] = successor_count;
+        }
+    });
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        offsets[u + 1] += offsets[u];
+    }
+
+    std::vector<std::int32_t> successors(std::max<std::int64_t>(offsets[vertex_count], 1));
+    for_each_vertex_block<Cpu>(vertex_count, [&](std::int32_t begin, std::int32_t end) {
+        neighbor_reader<Cpu, Decoder> reader(*g);
+        for (std::int32_t u = begin; u < end; ++u) {
+            const std::int32_t *neighbors = reader.get_column(u);
+            std::int32_t *out = successors.data() + offsets[u];
+            for (std::int32_t k = 0; k < degrees[u]; ++k) {
+                if (precedes(u, neighbors[k])) {
+                    *out++ = neighbors[k];
+                }
+            }
+        }
+    });
+
+    std::unique_ptr<std::atomic<std::int64_t>[]> local_counts;
+    if (is_local) {
+        local_counts.reset(new std::atomic<std::int64_t>[vertex_count]);
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            local_counts[u].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    const auto bounds = split_vertices<Cpu>(offsets);
+    const std::int64_t task_count = static_cast<std::int64_t>(bounds.size()) - 1;
+    std::vector<std::int64_t> task_counts(task_count, 0);
+    threader_for(task_count, task_count, [&](int t) {
+        neighbor_bitmap<Cpu> bitmap;
+        std::int64_t count = 0;
+        for (std::int32_t u = bounds[t]; u < bounds[t + 1]; ++u) {
+            std::int32_t *u_successors = successors.data() + offsets[u];
+            const auto u_count = static_cast<std::int32_t>(offsets[u + 1] - offsets[u]);
+            // a triangle needs two successors of its first vertex
+            if (u_count < 2) {
+                continue;
+            }
+            bitmap.build(u_successors, u_count);
+            for (std::int32_t k = 0; k < u_count; ++k) {
+                const std::int32_t v = u_successors[k];
+                std::int32_t *v_successors = successors.data() + offsets[v];
+                const auto v_count = static_cast<std::int32_t>(offsets[v + 1] - offsets[v]);
+                if (v_count == 0) {
+                    continue;
+                }
+                if (!is_local) {
+                    count += intersection_by_degree(u_successors,
+                                                    v_successors,
+                                                    u_count,
+                                                    v_count,
+                                                    bitmap,
+                                                    merge);
+                    continue;
+                }
+
+                // the local counts need the third vertices of the triangles,
+                // which the vectorized merge does not locate
+                const auto add_triangle = [&](std::int32_t w) {
+                    local_counts[w].fetch_add(1, std::memory_order_relaxed);
+                };
+                const auto visiting_merge = [&](const std::int32_t *a,
+                                                const std::int32_t *b,
+                                                std::int32_t count_a,
+                                                std::int32_t count_b) {
+                    return intersection_merge<Cpu>(a, b, count_a, count_b, add_triangle);
+                };
+                const std::int64_t triangle_count = intersection_by_degree(u_successors,
+                                                                           v_successors,
+                                                                           u_count,
+                                                                           v_count,
+                                                                           bitmap,
+                                                                           visiting_merge,
+                                                                           add_triangle);
+                if (triangle_count) {
+                    local_counts[u].fetch_add(triangle_count, std::memory_order_relaxed);
+                    local_counts[v].fetch_add(triangle_count, std::memory_order_relaxed);
+                }
+                count += triangle_count;
+            }
+        }
+        task_counts[t] = count;
+    });
+
+    std::int64_t global_count = 0;
+    for (std::int64_t t = 0; t < task_count; ++t) {
+        global_count += task_counts[t];
+    }
+    if (!is_local) {
+        return vertex_ranking_result(table{}, global_count);
+    }
+
+    auto ranks = array<std::int64_t>::empty(vertex_count);
+    std::int64_t *ranks_data = ranks.get_mutable_data();
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        ranks_data[u] = local_counts[u].load(std::memory_order_relaxed);
+    }
+    return vertex_ranking_result(
+        dal::detail::homogen_table_builder{}.reset(ranks, vertex_count, 1).build(),
+        global_count);
+}
+
+} // namespace detail
+} // namespace triangle_counting
+} // namespace oneapi::dal::preview
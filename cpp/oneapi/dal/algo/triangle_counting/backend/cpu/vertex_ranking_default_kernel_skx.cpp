@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <immintrin.h>
+
+#include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_default_kernel_avx2.hpp"
+#include "oneapi/dal/algo/triangle_counting/backend/cpu/vertex_ranking_default_kernel_impl.hpp"
+
+namespace oneapi::dal::preview {
+namespace triangle_counting {
+namespace detail {
+
+using cpu_t = oneapi::dal::backend::cpu_dispatch_avx512;
+
+template <>
+vertex_ranking_result call_triangle_counting_default_kernel<cpu_t>(
+    const descriptor_base &desc,
+    vertex_ranking_input<undirected_adjacency_array_graph<>> &input) {
+    return count_triangles<cpu_t, jaccard::detail::neighbor_decoder_avx2<cpu_t>>(
+        desc,
+        input,
+        jaccard::detail::intersection);
+}
+
+} // namespace detail
+} // namespace triangle_counting
+} // namespace oneapi::dal::preview
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
+
+namespace oneapi::dal::preview {
+namespace triangle_counting {
+namespace detail {
+struct tag {};
+class descriptor_impl;
+} // namespace detail
+
+namespace method {
+struct ordered_count {};
+using by_default = ordered_count;
+} // namespace method
+
+/// The kinds of the triangle counts computed by the algorithm
+enum class kind {
+    local, /*!< The number of the triangles of every vertex */
+    global, /*!< The number of the triangles of the graph */
+    local_and_global /*!< Both the local and the global counts */
+};
+
+/// The base class for the triangle counting algorithm descriptor
+class ONEAPI_DAL_EXPORT descriptor_base : public base {
+public:
+    using tag_t = detail::tag;
+    using float_t = float;
+    using method_t = method::by_default;
+
+    /// Constructs the empty descriptor
+    descriptor_base();
+
+    /// Returns the kind of the computed triangle counts
+    auto get_kind() const -> kind;
+
+protected:
+    void set_kind_impl(kind value);
+
+    oneapi::dal::detail::pimpl<detail::descriptor_impl> impl_;
+};
+
+/// Class for the triangle counting algorithm descriptor
+///
+/// @tparam Float The floating-point type of the algorithm
+/// @tparam Method The algorithm method
+template <typename Float = descriptor_base::float_t, typename Method = descriptor_base::method_t>
+class descriptor : public descriptor_base {
+public:
+    using method_t = Method;
+
+    /// Sets the kind of the computed triangle counts, global by default. The
+    /// local counts need the common neighbors of the vertex pairs themselves,
+    /// so they are found by the scalar intersections and cost more than the
+    /// global count, which uses the vectorized ones.
+    ///
+    /// @param [in] value  The kind of the triangle counts
+    auto& set_kind(kind value) {
+        this->set_kind_impl(value);
+        return *this;
+    }
+};
+
+} // namespace triangle_counting
+} // namespace oneapi::dal::preview
@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/triangle_counting/detail/vertex_ranking_ops.hpp"
+#include "oneapi/dal/algo/triangle_counting/backend/cpu/vertex_ranking_default_kernel.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::preview {
+namespace triangle_counting {
+namespace detail {
+
+template <typename Policy, typename Float, class Method, typename Graph>
+ONEAPI_DAL_EXPORT vertex_ranking_result
+vertex_ranking_ops_dispatcher<Policy, Float, Method, Graph>::operator()(
+    const Policy &policy,
+    const descriptor_base &desc,
+    vertex_ranking_input<Graph> &input) const {
+    const auto ctx = dal::backend::context_cpu{ policy };
+    return dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return call_triangle_counting_default_kernel<decltype(cpu)>(desc, input);
+    });
+}
+
+#define INSTANTIATE(F, M, G)          \
+    template struct ONEAPI_DAL_EXPORT \
+        vertex_ranking_ops_dispatcher<oneapi::dal::detail::host_policy, F, M, G>;
+
+INSTANTIATE(float,
+            oneapi::dal::preview::triangle_counting::method::by_default,
+            undirected_adjacency_array_graph<>)
+
+} // namespace detail
+} // namespace triangle_counting
+} // namespace oneapi::dal::preview
@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/triangle_counting/common.hpp"
+#include "oneapi/dal/algo/triangle_counting/vertex_ranking_types.hpp"
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_array_graph_impl.hpp"
+
+namespace oneapi::dal::preview {
+namespace triangle_counting {
+namespace detail {
+
+template <typename Policy, typename Float, class Method, typename Graph>
+struct ONEAPI_DAL_EXPORT vertex_ranking_ops_dispatcher {
+    vertex_ranking_result operator()(const Policy &policy,
+                                     const descriptor_base &descriptor,
+                                     vertex_ranking_input<Graph> &input) const;
+};
+
+template <typename Descriptor, typename Graph>
+struct vertex_ranking_ops {
+    using float_t = typename Descriptor::float_t;
+    using method_t = typename Descriptor::method_t;
+    using input_t = vertex_ranking_input<Graph>;
+    using result_t = vertex_ranking_result;
+    using descriptor_base_t = descriptor_base;
+
+    void check_preconditions(const Descriptor &param,
+                             vertex_ranking_input<Graph> &input) const {
+        const auto count_kind = param.get_kind();
+        if (count_kind != kind::local && count_kind != kind::global &&
+            count_kind != kind::local_and_global) {
+            throw oneapi::dal::invalid_argument("Invalid kind");
+        }
+    }
+
+    template <typename Policy>
+    auto operator()(const Policy &policy,
+                    const Descriptor &desc,
+                    vertex_ranking_input<Graph> &input) const {
+        check_preconditions(desc, input);
+        return vertex_ranking_ops_dispatcher<Policy, float_t, method_t, Graph>()(policy,
+                                                                                 desc,
+                                                                                 input);
+    }
+};
+
+} // namespace detail
+} // namespace triangle_counting
+} // namespace oneapi::dal::preview
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/triangle_counting/vertex_ranking_types.hpp"
+
+namespace oneapi::dal::preview {
+namespace triangle_counting {
+template <typename Graph>
+class detail::vertex_ranking_input_impl : public base {
+public:
+    vertex_ranking_input_impl(const Graph& graph_data_input)
+            : graph_data(graph_data_input) {}
+
+    const Graph& graph_data;
+};
+
+using detail::vertex_ranking_input_impl;
+
+template <typename Graph>
+vertex_ranking_input<Graph>::vertex_ranking_input(const Graph& data)
+        : impl_(new vertex_ranking_input_impl<Graph>(data)) {}
+
+template <typename Graph>
+const Graph& vertex_ranking_input<Graph>::get_graph() const {
+    return impl_->graph_data;
+}
+
+class detail::vertex_ranking_result_impl : public base {
+public:
+    vertex_ranking_result_impl() : global_rank(0) {}
+
+    vertex_ranking_result_impl(const table& ranks, std::int64_t global_rank)
+            : ranks(ranks),
+              global_rank(global_rank) {}
+
+    table ranks;
+    std::int64_t global_rank;
+};
+
+template class detail::vertex_ranking_input_impl<undirected_adjacency_array_graph<>>;
+
+template class ONEAPI_DAL_EXPORT vertex_ranking_input<undirected_adjacency_array_graph<>>;
+
+using detail::vertex_ranking_result_impl;
+
+vertex_ranking_result::vertex_ranking_result()
+        : impl_(new vertex_ranking_result_impl()) {}
+
+vertex_ranking_result::vertex_ranking_result(const table& ranks,
+                                             std::int64_t global_rank)
+        : impl_(new vertex_ranking_result_impl(ranks, global_rank)) {}
+
+table vertex_ranking_result::get_ranks() const {
+    return impl_->ranks;
+}
+
+std::int64_t vertex_ranking_result::get_global_rank() const {
+    return impl_->global_rank;
+}
+} // namespace triangle_counting
+} // namespace oneapi::dal::preview
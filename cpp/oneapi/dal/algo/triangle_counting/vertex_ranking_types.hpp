@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the definition of the input and output for the triangle counting
+/// algorithm
+
+#pragma once
+
+#include "oneapi/dal/algo/triangle_counting/common.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::preview {
+namespace triangle_counting {
+
+namespace detail {
+template <typename Graph>
+class vertex_ranking_input_impl;
+class vertex_ranking_result_impl;
+} // namespace detail
+
+/// Class for the description of the input parameters of the triangle
+/// counting algorithm
+///
+/// @tparam Graph  Type of the input graph
+template <typename Graph>
+class ONEAPI_DAL_EXPORT vertex_ranking_input {
+public:
+    /// Constructs the algorithm input initialized with the graph
+    ///
+    /// @param [in]   graph  The input graph
+    vertex_ranking_input(const Graph& graph);
+
+    /// Returns the constant reference to the input graph
+    const Graph& get_graph() const;
+
+private:
+    dal::detail::pimpl<detail::vertex_ranking_input_impl<Graph>> impl_;
+};
+
+/// Class for the description of the result of the triangle counting algorithm
+class ONEAPI_DAL_EXPORT vertex_ranking_result {
+public:
+    /// Constructs the empty result
+    vertex_ranking_result();
+
+    /// Constructs the algorithm result initialized with the table of the local
+    /// triangle counts and the global triangle count
+    ///
+    /// @param [in]   ranks        The table of size vertex_count*1 with the
+    ///                            numbers of the triangles of the vertices, or
+    ///                            the empty table if they are not computed
+    /// @param [in]   global_rank  The number of the triangles of the graph
+    vertex_ranking_result(const table& ranks, std::int64_t global_rank);
+
+    /// Returns the table of size vertex_count*1 with the numbers of the
+    /// triangles of the vertices, it is empty for the global kind
+    table get_ranks() const;
+
+    /// The number of the triangles of the graph
+    std::int64_t get_global_rank() const;
+
+private:
+    dal::detail::pimpl<detail::vertex_ranking_result_impl> impl_;
+};
+} // namespace triangle_counting
+} // namespace oneapi::dal::preview
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "oneapi/dal/array.hpp"
+#include "oneapi/dal/detail/memory_usage.hpp"
 #include "gtest/gtest.h"
 
 using namespace oneapi::dal;
@@ -201,3 +202,20 @@ TEST(array_test, can_wrap_const_data_with_offset_and_deleter) {
     ASSERT_EQ(arr.get_data(), cdata);
     ASSERT_FALSE(arr.has_mutable_data());
 }
+
+TEST(array_test, tracks_memory_usage_of_allocated_array) {
+    detail::enable_memory_tracking();
+    detail::reset_memory_peak();
+    const auto before = detail::get_memory_usage();
+    {
+        auto arr = array<float>::zeros(1000);
+        const auto usage = detail::get_memory_usage();
+        ASSERT_EQ(usage.current_bytes - before.current_bytes, 1000 * sizeof(float));
+        ASSERT_EQ(usage.allocation_count, 1);
+    }
+    const auto after = detail::get_memory_usage();
+    detail::enable_memory_tracking(false);
+
+    ASSERT_EQ(after.current_bytes, before.current_bytes);
+    ASSERT_EQ(after.peak_bytes - before.current_bytes, 1000 * sizeof(float));
+}
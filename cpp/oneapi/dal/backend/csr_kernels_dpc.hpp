@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#ifndef ONEAPI_DAL_DATA_PARALLEL
+#error ONEAPI_DAL_DATA_PARALLEL must be defined to include this file
+#endif
+
+#include "oneapi/dal/table/backend/convert.hpp"
+#include "oneapi/dal/table/backend/csr_table_impl.hpp"
+
+namespace oneapi::dal::backend {
+
+using std::int64_t;
+
+template <typename Float>
+class csr_row_norms_kernel;
+template <typename Float, typename Op>
+class csr_gram_kernel;
+
+template <typename T>
+inline array<T> copy_to_device(sycl::queue& queue, const T* src, int64_t count) {
+    auto arr = array<T>::empty(queue, count, sycl::usm::alloc::device);
+    if (count > 0) {
+        queue.memcpy(arr.get_mutable_data(), src, sizeof(T) * count).wait_and_throw();
+    }
+    return arr;
+}
+
+/// The arrays of the CSR table on the device, the values are converted to Float
+template <typename Float>
+struct csr_device_data {
+    csr_device_data(sycl::queue& queue, const table& data) {
+        using csr_table_wrapper = dal::detail::table_impl_wrapper<dal::backend::csr_table_impl>;
+        const auto& impl = dal::detail::get_impl<csr_table_wrapper>(data).get();
+        const int64_t non_zero_count = impl.get_non_zero_count();
+
+        if (impl.get_data_type() == dal::detail::make_data_type<Float>()) {
+            values = copy_to_device(queue,
+                                    reinterpret_cast<const Float*>(impl.get_data()),
+                                    non_zero_count);
+        }
+        else {
+            auto host_values = array<Float>::empty(non_zero_count);
+            dal::backend::convert_vector(dal::detail::default_host_policy{},
+                                         impl.get_data(),
+                                         host_values.get_mutable_data(),
+                                         impl.get_data_type(),
+                                         dal::detail::make_data_type<Float>(),
+                                         non_zero_count);
+            values = copy_to_device(queue, host_values.get_data(), non_zero_count);
+        }
+        column_indices = copy_to_device(queue, impl.get_column_indices(), non_zero_count);
+        row_offsets = copy_to_device(queue, impl.get_row_offsets(), impl.get_row_count() + 1);
+    }
+
+    array<Float> values;
+    array<int64_t> column_indices;
+    array<int64_t> row_offsets;
+};
+
+/// Computes the squared norms of the rows
+template <typename Float>
+void compute_csr_row_norms(sycl::queue& queue,
+                           const csr_device_data<Float>& data,
+                           int64_t row_count,
+                           Float* norms) {
+    const Float* values = data.values.get_data();
+    const int64_t* offsets = data.row_offsets.get_data();
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<csr_row_norms_kernel<Float>>(
+                sycl::range<1>(row_count),
+                [=](sycl::id<1> idx) {
+                    const int64_t i = idx[0];
+                    Float sum = Float(0);
+                    for (int64_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+                        sum += values[k] * values[k];
+                    }
+                    norms[i] = sum;
+                });
+        })
+        .wait_and_throw();
+}
+
+/// Computes the row_count_x x row_count_y matrix of op(<x_i, y_j>, i, j). The
+/// dot products merge the non-zero values of the rows, so the column indices
+/// shall be sorted in every row. The op applies the kernel function to the
+/// dot product while the work-item still holds it.
+template <typename Float, typename Op>
+void compute_csr_gram(sycl::queue& queue,
+                      const csr_device_data<Float>& x,
+                      const csr_device_data<Float>& y,
+                      int64_t row_count_x,
+                      int64_t row_count_y,
+                      Float* values,
+                      const Op& op) {
+    const Float* x_values = x.values.get_data();
+    const int64_t* x_indices = x.column_indices.get_data();
+    const int64_t* x_offsets = x.row_offsets.get_data();
+    const Float* y_values = y.values.get_data();
+    const int64_t* y_indices = y.column_indices.get_data();
+    const int64_t* y_offsets = y.row_offsets.get_data();
+    queue
+        .submit([&](sycl::handler& cgh) {
+            cgh.parallel_for<csr_gram_kernel<Float, Op>>(
+                sycl::range<2>(row_count_x, row_count_y),
+                [=](sycl::id<2> idx) {
+                    const int64_t i = idx[0];
+                    const int64_t j = idx[1];
+                    int64_t kx = x_offsets[i];
+                    int64_t ky = y_offsets[j];
+                    const int64_t x_end = x_offsets[i + 1];
+                    const int64_t y_end = y_offsets[j + 1];
+                    Float dot = Float(0);
+                    while (kx < x_end && ky < y_end) {
+                        const int64_t cx = x_indices[kx];
+                        const int64_t cy = y_indices[ky];
+                        if (cx == cy) {
+                            dot += x_values[kx++] * y_values[ky++];
+                        }
+                        else if (cx < cy) {
+                            ++kx;
+                        }
+                        else {
+                            ++ky;
+                        }
+                    }
+                    values[i * row_count_y + j] = op(dot, i, j);
+                });
+        })
+        .wait_and_throw();
+}
+
+} // namespace oneapi::dal::backend
@@ -17,6 +17,7 @@
 #include "oneapi/dal/backend/dispatcher.hpp"
 
 #include <daal/src/services/service_defines.h>
+#include <daal/src/threading/threading.h>
 
 namespace oneapi::dal::backend {
 
@@ -35,9 +36,89 @@ inline constexpr detail::cpu_extension from_daal_cpu_type(daal::CpuType cpu) {
     return cpu_extension::none;
 }
 
+inline constexpr std::uint64_t from_daal_cpu_features(std::uint64_t features) {
+    using detail::cpu_extension;
+    std::uint64_t result = 0;
+    if (features & DAAL_CPU_FEATURE_AVX512_VNNI) {
+        result |= std::uint64_t(cpu_extension::avx512_vnni);
+    }
+    if (features & DAAL_CPU_FEATURE_AVX512_BF16) {
+        result |= std::uint64_t(cpu_extension::avx512_bf16);
+    }
+    if (features & DAAL_CPU_FEATURE_AMX_BF16) {
+        result |= std::uint64_t(cpu_extension::amx_bf16);
+    }
+    return result;
+}
+
 detail::cpu_extension detect_top_cpu_extension() {
     const auto daal_cpu = (daal::CpuType)__daal_serv_cpu_detect(0);
-    return from_daal_cpu_type(daal_cpu);
+    const auto top = from_daal_cpu_type(daal_cpu);
+    if (top != detail::cpu_extension::avx512) {
+        return top;
+    }
+    const std::uint64_t features = from_daal_cpu_features(__daal_serv_cpu_feature_detect());
+    return static_cast<detail::cpu_extension>(std::uint64_t(top) | features);
+}
+
+inline constexpr daal::CpuType to_daal_cpu_type(detail::cpu_extension cpu) {
+    using detail::cpu_extension;
+    switch (cpu) {
+        case cpu_extension::ssse3: return daal::ssse3;
+        case cpu_extension::sse42: return daal::sse42;
+        case cpu_extension::avx: return daal::avx;
+        case cpu_extension::avx2: return daal::avx2;
+        case cpu_extension::avx512: return daal::avx512;
+        default: return daal::sse2;
+    }
+}
+
+detail::cpu_extension get_dispatched_cpu_extensions(detail::cpu_extension extensions,
+                                                    const char* kernel_name) {
+    using detail::cpu_extension;
+    // The feature bits above avx512 do not select the kernels
+    std::uint64_t top = 0;
+    for (std::uint64_t bit = std::uint64_t(cpu_extension::sse2);
+         bit <= std::uint64_t(cpu_extension::avx512);
+         bit <<= 1) {
+        if (std::uint64_t(extensions) & bit) {
+            top = bit;
+        }
+    }
+    if (top == 0) {
+        return extensions;
+    }
+
+    const int cpuid = to_daal_cpu_type(static_cast<cpu_extension>(top));
+    const int dispatched = __daal_serv_cpu_dispatch(cpuid, kernel_name);
+    if (dispatched == cpuid) {
+        return extensions;
+    }
+    return from_daal_cpu_type(static_cast<daal::CpuType>(dispatched));
+}
+
+std::string extract_kernel_name(const char* signature) {
+    // GCC and Clang write "[with Kernel = name]" and "[Kernel = name]"
+    const std::string text{ signature };
+    const std::string key = "Kernel = ";
+    const auto start = text.find(key);
+    const auto end = text.rfind(']');
+    if (start == std::string::npos || end == std::string::npos || end < start) {
+        return text;
+    }
+    return text.substr(start + key.size(), end - start - key.size());
+}
+
+void execute_in_task_arena(const detail::host_policy& ctx, const std::function<void()>& func) {
+    const auto& executor = ctx.get_task_arena_executor();
+    if (executor) {
+        executor(func);
+    }
+    else {
+        daal::threader_execute_in_arena(static_cast<int>(ctx.get_max_concurrency()),
+                                        static_cast<int>(ctx.get_numa_node()),
+                                        func);
+    }
 }
 
 } // namespace oneapi::dal::backend
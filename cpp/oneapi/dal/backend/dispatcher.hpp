@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <functional>
+#include <optional>
+#include <string>
+
 #include "oneapi/dal/backend/dispatcher_cpu.hpp"
 #include "oneapi/dal/detail/policy.hpp"
 
@@ -23,6 +27,25 @@ namespace oneapi::dal::backend {
 
 detail::cpu_extension detect_top_cpu_extension();
 
+/// Returns the extensions of the named kernel: the enabled ones lowered by the
+/// rules of DAAL_CPU_DISPATCH_OVERRIDE. The choice is written to stderr if
+/// DAAL_CPU_DISPATCH_TRACE is set.
+detail::cpu_extension get_dispatched_cpu_extensions(detail::cpu_extension extensions,
+                                                    const char* kernel_name);
+
+/// Returns the name of the type of the kernel in the signature of the function
+std::string extract_kernel_name(const char* signature);
+
+template <typename Kernel>
+inline const char* get_kernel_name() {
+#if defined(_MSC_VER)
+    static const std::string name = extract_kernel_name(__FUNCSIG__);
+#else
+    static const std::string name = extract_kernel_name(__PRETTY_FUNCTION__);
+#endif
+    return name.c_str();
+}
+
 struct cpu_dispatch_sse2 {};
 struct cpu_dispatch_ssse3 {};
 struct cpu_dispatch_sse42 {};
@@ -42,6 +65,10 @@ public:
     explicit context_cpu(const detail::host_policy& ctx)
             : cpu_extensions_(ctx.get_enabled_cpu_extensions()) {}
 
+    context_cpu(const detail::host_policy& ctx, const char* kernel_name)
+            : cpu_extensions_(
+                  get_dispatched_cpu_extensions(ctx.get_enabled_cpu_extensions(), kernel_name)) {}
+
     detail::cpu_extension get_enabled_cpu_extensions() const {
         return cpu_extensions_;
     }
@@ -50,11 +77,32 @@ private:
     detail::cpu_extension cpu_extensions_;
 };
 
+/// Runs the function in the task arena given by the threading constraints of
+/// the policy, the DAAL threader primitives called by the function share it
+void execute_in_task_arena(const detail::host_policy& ctx, const std::function<void()>& func);
+
+template <typename Op>
+auto execute_with_threading_constraints(const detail::host_policy& ctx, Op&& op) {
+    if (!ctx.has_threading_constraints()) {
+        return op();
+    }
+
+    std::optional<decltype(op())> result;
+    execute_in_task_arena(ctx, [&]() {
+        result.emplace(op());
+    });
+    return std::move(*result);
+}
+
 template <typename CpuKernel>
 struct kernel_dispatcher<CpuKernel> {
     template <typename... Args>
     auto operator()(const detail::host_policy& ctx, Args&&... args) const {
-        return CpuKernel()(context_cpu{ ctx }, std::forward<Args>(args)...);
+        return execute_with_threading_constraints(ctx, [&]() {
+            const detail::allocator_scope scope{ ctx.get_allocator() };
+            const context_cpu cpu_ctx{ ctx, get_kernel_name<CpuKernel>() };
+            return CpuKernel()(cpu_ctx, std::forward<Args>(args)...);
+        });
     }
 };
 
@@ -62,6 +110,17 @@ inline bool test_cpu_extension(detail::cpu_extension mask, detail::cpu_extension
     return ((std::uint64_t)mask & (std::uint64_t)test) > 0;
 }
 
+/// Returns true if the kernels of avx512 may compute in bfloat16 by the AVX-512
+/// BF16 dot products or the AMX tiles
+inline bool is_bf16_enabled(const context_cpu& ctx) {
+    using detail::cpu_extension;
+    const cpu_extension cpu_ex = ctx.get_enabled_cpu_extensions();
+    const auto bf16_mask = static_cast<cpu_extension>((std::uint64_t)cpu_extension::avx512_bf16 |
+                                                      (std::uint64_t)cpu_extension::amx_bf16);
+    return test_cpu_extension(cpu_ex, cpu_extension::avx512) &&
+           test_cpu_extension(cpu_ex, bf16_mask);
+}
+
 template <typename Op>
 constexpr auto dispatch_by_cpu(const context_cpu& ctx, Op&& op) {
     using detail::cpu_extension;
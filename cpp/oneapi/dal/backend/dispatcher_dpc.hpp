@@ -51,6 +51,7 @@ struct kernel_dispatcher<CpuKernel, GpuKernel> {
         }
         else if (device.is_gpu()) {
             const auto gpu_policy = context_gpu{ policy };
+            const detail::usm_allocator_scope scope{ policy.get_allocator() };
             return GpuKernel()(gpu_policy, std::forward<Args>(args)...);
         }
         else {
@@ -62,13 +62,16 @@ private:
 };
 
 execution_context_guard::execution_context_guard(const sycl::queue& queue) {
+    using daal_ctx_iface_t = daal::services::internal::sycl::ExecutionContextIface;
     auto ctx = execution_context_cache::get_instance().lookup(queue);
-    daal::services::Environment::getInstance()->setDefaultExecutionContext(ctx);
+    auto env = daal::services::Environment::getInstance();
+    previous_ = env->getThreadExecutionContext();
+    env->setThreadExecutionContext(
+        daal::services::internal::ImplAccessor::getImplPtr<daal_ctx_iface_t>(ctx));
 }
 
 execution_context_guard::~execution_context_guard() {
-    daal::services::Environment::getInstance()->setDefaultExecutionContext(
-        daal::services::internal::CpuExecutionContext());
+    daal::services::Environment::getInstance()->setThreadExecutionContext(previous_);
 }
 
 void enable_daal_sycl_execution_context_cache() {
@@ -25,12 +25,17 @@
 
 namespace oneapi::dal::backend::interop {
 
+/// Sets the DAAL execution context of the queue for the current thread, so the
+/// threads which run on different devices do not interfere
 struct execution_context_guard {
     explicit execution_context_guard(const sycl::queue &queue);
 
     ~execution_context_guard();
 
     execution_context_guard(const execution_context_guard &) = delete;
+
+private:
+    daal::services::SharedPtr<daal::services::internal::sycl::ExecutionContextIface> previous_;
 };
 
 void enable_daal_sycl_execution_context_cache();
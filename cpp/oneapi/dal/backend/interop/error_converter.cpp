@@ -37,12 +37,15 @@ void status_to_exception(const daal::services::Status& s) {
         case ErrorID::ErrorCpuIsInvalid:
         case ErrorID::ErrorIncorrectCombinationOfComputationModeAndStep:
         case ErrorID::ErrorInconsistentNumberOfClasses:
+        case ErrorID::ErrorIncorrectClassLabels:
         case ErrorID::ErrorEMInitInconsistentNumberOfComponents:
         case ErrorID::ErrorNaiveBayesIncorrectModel:
         case ErrorID::ErrorIncorrectNComponents:
         case ErrorID::ErrorZlibDataFormat:
         case ErrorID::ErrorBzip2DataFormat:
         case ErrorID::ErrorLzoDataFormat:
+        case ErrorID::ErrorLz4DataFormat:
+        case ErrorID::ErrorBlockCompressionDataFormat:
         case ErrorID::ErrorQuantileOrderValueIsInvalid:
         case ErrorID::ErrorALSInconsistentSparseDataBlocks:
         case ErrorID::ErrorNullVariance:
@@ -150,6 +153,9 @@ void status_to_exception(const daal::services::Status& s) {
         case ErrorID::ErrorRleDataFormat:
         case ErrorID::ErrorRleDataFormatLessThenHeader:
         case ErrorID::ErrorRleDataFormatNotFullBlock:
+        case ErrorID::ErrorLz4OutputStreamSizeIsNotEnough:
+        case ErrorID::ErrorLz4DataFormatLessThenHeader:
+        case ErrorID::ErrorLz4DataFormatNotFullBlock:
         case ErrorID::ErrorLowerBoundGreaterThanOrEqualToUpperBound:
         case ErrorID::ErrorZeroNumberOfTerms:
         case ErrorID::ErrorKDBWrongTypeOfOutput:
@@ -208,6 +214,7 @@ void status_to_exception(const daal::services::Status& s) {
         case ErrorID::ErrorBzip2Internal:
         case ErrorID::ErrorLzoInternal:
         case ErrorID::ErrorRleInternal:
+        case ErrorID::ErrorLz4Internal:
         case ErrorID::ErrorQuantilesInternal:
         case ErrorID::ErrorALSInternal:
         case ErrorID::ErrorSorting:
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/detail/memory_usage.hpp"
+#include "src/externals/service_memory.h"
+
+namespace oneapi::dal::detail {
+
+void enable_memory_tracking(bool enable) {
+    daal::services::daal_enable_memory_tracking(enable);
+}
+
+memory_usage get_memory_usage() {
+    const auto usage = daal::services::daal_get_memory_usage();
+    memory_usage result;
+    result.current_bytes = static_cast<std::int64_t>(usage.currentBytes);
+    result.peak_bytes = static_cast<std::int64_t>(usage.peakBytes);
+    result.allocation_count = static_cast<std::int64_t>(usage.allocationCount);
+    return result;
+}
+
+void reset_memory_peak() {
+    daal::services::daal_reset_memory_peak();
+}
+
+void track_allocation(const void* ptr, std::int64_t size) {
+    daal::services::internal::trackAllocation(ptr, static_cast<std::size_t>(size));
+}
+
+void track_deallocation(const void* ptr) {
+    daal::services::internal::trackDeallocation(ptr);
+}
+
+} // namespace oneapi::dal::detail
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/include/data_management/data/data_archive.h>
+
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/detail/archives.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::backend::interop {
+
+/// Writes the DAAL object serialized into the DAAL archive as the array
+inline void serialize_daal_object(daal::data_management::SerializationIface& object,
+                                  dal::detail::binary_output_archive& ar) {
+    daal::data_management::InputDataArchive daal_archive;
+    object.serialize(daal_archive);
+    const auto size = daal_archive.getSizeOfArchive();
+    const auto data = daal_archive.getArchiveAsArraySharedPtr();
+    if (daal_archive.getErrors()->size() != 0 || (size > 0 && !data)) {
+        throw internal_error("Cannot serialize the DAAL object");
+    }
+    ar.write_array(data.get(), size);
+}
+
+/// Reads the DAAL object written by serialize_daal_object(). The DAAL archive
+/// is created over the memory of the archive, so the numeric tables of the
+/// object refer to it without copying.
+template <typename Object>
+inline daal::services::SharedPtr<Object> deserialize_daal_object(
+    dal::detail::binary_input_archive& ar) {
+    auto data = ar.read_array();
+    const auto size = data.get_count();
+    const auto daal_data =
+        daal::services::SharedPtr<daal::byte>(const_cast<byte_t*>(data.get_data()),
+                                              daal_array_owner<byte_t>{ data });
+
+    daal::data_management::OutputDataArchive daal_archive{ daal_data, std::size_t(size) };
+    const auto object = daal::services::dynamicPointerCast<Object>(daal_archive.getAsSharedPtr());
+    if (daal_archive.getErrors()->size() != 0 || !object) {
+        throw invalid_argument("Corrupted DAAL object of the serialized object");
+    }
+    return object;
+}
+
+} // namespace oneapi::dal::backend::interop
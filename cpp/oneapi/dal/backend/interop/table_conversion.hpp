@@ -16,13 +16,22 @@
 
 #pragma once
 
+#include <daal/include/data_management/data/csr_numeric_table.h>
 #include <daal/include/data_management/data/homogen_numeric_table.h>
+#include <daal/include/data_management/data/soa_numeric_table.h>
 
 #ifdef ONEAPI_DAL_DATA_PARALLEL
 #include <daal/include/data_management/data/internal/numeric_table_sycl_homogen.h>
 #endif
 
+#include "oneapi/dal/backend/interop/table_conversion_cache.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/backend/convert.hpp"
+#include "oneapi/dal/table/backend/csr_table_impl.hpp"
+#include "oneapi/dal/table/column_stats.hpp"
+#include "oneapi/dal/table/csr.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
 
 namespace oneapi::dal::backend::interop {
 
@@ -60,6 +69,166 @@ inline auto convert_to_daal_homogen_table(array<T>& data,
                                                                  row_count);
 }
 
+struct daal_table_owner {
+    explicit daal_table_owner(const table& t) : table_(t) {}
+
+    void operator()(const void*) {
+        table_ = table{};
+    }
+
+    table table_;
+};
+
+/// Wraps the columns of the column-major homogen table into the DAAL SOA
+/// numeric table without a copy. The data type of the table shall be T.
+template <typename T>
+inline daal::data_management::NumericTablePtr convert_to_daal_soa_table(const table& t) {
+    using daal::data_management::DictionaryIface;
+    using daal::data_management::SOANumericTable;
+
+    const std::int64_t row_count = t.get_row_count();
+    const std::int64_t column_count = t.get_column_count();
+    const auto& t_impl = detail::get_impl<detail::homogen_table_impl_iface>(t);
+
+    // DAAL kernels access the input tables in read-only mode only
+    auto data = const_cast<T*>(reinterpret_cast<const T*>(t_impl.get_data()));
+
+    auto daal_table = SOANumericTable::create(column_count, row_count, DictionaryIface::equal);
+    for (std::int64_t i = 0; i < column_count; i++) {
+        const auto column =
+            daal::services::SharedPtr<T>(data + i * row_count, daal_table_owner{ t });
+        daal_table->setArray(column, i);
+    }
+    return daal_table;
+}
+
+/// Passes the statistics of the columns kept with the table to the basic
+/// statistics of the DAAL table, so the DAAL kernels that need them do not
+/// pass over the values
+inline void set_daal_basic_statistics(const table& t,
+                                      const daal::data_management::NumericTablePtr& daal_table) {
+    using daal::data_management::NumericTable;
+
+    if (!daal_table || !has_column_stats(t) ||
+        daal_table->getBasicStatisticsStatus() == NumericTable::basicStatisticsActual) {
+        return;
+    }
+    const column_stats stats = compute_column_stats(t);
+    const std::int64_t column_count = stats.get_column_count();
+    const auto to_daal = [&](const array<double>& values) {
+        const auto nt = allocate_daal_homogen_table<double>(1, column_count);
+        std::copy(values.get_data(), values.get_data() + column_count, nt->getArray());
+        return nt;
+    };
+    daal_table->basicStatistics.set(NumericTable::minimum, to_daal(stats.get_min()));
+    daal_table->basicStatistics.set(NumericTable::maximum, to_daal(stats.get_max()));
+    daal_table->basicStatistics.set(NumericTable::sum, to_daal(stats.get_sum()));
+    daal_table->basicStatistics.set(NumericTable::sumSquares, to_daal(stats.get_sum_squares()));
+    daal_table->setBasicStatisticsStatus(NumericTable::basicStatisticsActual);
+    if (stats.get_all_finite()) {
+        daal_table->setFinitenessStatus(NumericTable::allFinite);
+    }
+}
+
+/// Converts the input table into the DAAL numeric table. The column-major
+/// homogen tables of type T are passed as SOA tables without a copy, so the
+/// column-oriented kernels consume them with no transpose. Other tables are
+/// pulled into the row-major blocks of type T, the result is kept in the
+/// global conversion cache for the next calls on the same table. The
+/// statistics of the columns kept with the table are passed to the result.
+template <typename T>
+inline daal::data_management::NumericTablePtr convert_to_daal_table(const table& t) {
+    if (t.get_kind() == homogen_table::kind() && t.has_data() &&
+        t.get_data_layout() == data_layout::column_major &&
+        t.get_metadata().get_data_type(0) == detail::make_data_type<T>()) {
+        const auto daal_table = convert_to_daal_soa_table<T>(t);
+        set_daal_basic_statistics(t, daal_table);
+        return daal_table;
+    }
+
+    auto& cache = table_conversion_cache::get_global();
+    const auto dtype = detail::make_data_type<T>();
+    if (auto cached = cache.find(t, dtype)) {
+        set_daal_basic_statistics(t, cached);
+        return cached;
+    }
+
+    const std::int64_t row_count = t.get_row_count();
+    const std::int64_t column_count = t.get_column_count();
+    auto arr = row_accessor<const T>{ t }.pull();
+    const daal::data_management::NumericTablePtr daal_table =
+        convert_to_daal_homogen_table(arr, row_count, column_count);
+    set_daal_basic_statistics(t, daal_table);
+    cache.insert(t, dtype, daal_table, row_count * column_count * sizeof(T));
+    return daal_table;
+}
+
+/// Converts the CSR table into the DAAL CSR numeric table. The DAAL kernels
+/// support the one-based indices only, so the indices are copied, the values
+/// are shared when their type is T.
+template <typename T>
+inline daal::data_management::CSRNumericTablePtr convert_to_daal_csr_table(const table& t) {
+    using daal::data_management::CSRNumericTable;
+    using csr_table_wrapper = detail::table_impl_wrapper<dal::backend::csr_table_impl>;
+
+    if (t.get_kind() != csr_table::kind()) {
+        throw invalid_argument("Input table is not a CSR table");
+    }
+    const auto& impl = detail::get_impl<csr_table_wrapper>(t).get();
+    const std::int64_t row_count = impl.get_row_count();
+    const std::int64_t non_zero_count = impl.get_non_zero_count();
+
+    daal::services::SharedPtr<T> values;
+    if (impl.get_data_type() == detail::make_data_type<T>()) {
+        // DAAL kernels access the input tables in read-only mode only
+        auto data = const_cast<T*>(reinterpret_cast<const T*>(impl.get_data()));
+        values = daal::services::SharedPtr<T>(data, daal_table_owner{ t });
+    }
+    else {
+        auto arr = array<T>::empty(non_zero_count);
+        dal::backend::convert_vector(detail::default_host_policy{},
+                                     impl.get_data(),
+                                     arr.get_mutable_data(),
+                                     impl.get_data_type(),
+                                     detail::make_data_type<T>(),
+                                     non_zero_count);
+        values = daal::services::SharedPtr<T>(arr.get_mutable_data(), daal_array_owner<T>{ arr });
+    }
+
+    auto column_indices = array<std::size_t>::empty(non_zero_count);
+    auto row_offsets = array<std::size_t>::empty(row_count + 1);
+    const std::int64_t* src_indices = impl.get_column_indices();
+    const std::int64_t* src_offsets = impl.get_row_offsets();
+    std::size_t* dst_indices = column_indices.get_mutable_data();
+    std::size_t* dst_offsets = row_offsets.get_mutable_data();
+    for (std::int64_t i = 0; i < non_zero_count; i++) {
+        dst_indices[i] = static_cast<std::size_t>(src_indices[i] + 1);
+    }
+    for (std::int64_t i = 0; i <= row_count; i++) {
+        dst_offsets[i] = static_cast<std::size_t>(src_offsets[i] + 1);
+    }
+
+    return CSRNumericTable::create(
+        values,
+        daal::services::SharedPtr<std::size_t>(dst_indices,
+                                               daal_array_owner<std::size_t>{ column_indices }),
+        daal::services::SharedPtr<std::size_t>(dst_offsets,
+                                               daal_array_owner<std::size_t>{ row_offsets }),
+        impl.get_column_count(),
+        row_count,
+        CSRNumericTable::oneBased);
+}
+
+/// Converts the CSR tables into the DAAL CSR tables, so the sparse kernels read
+/// the non-zero values only, and the other tables into the dense DAAL tables
+template <typename T>
+inline daal::data_management::NumericTablePtr convert_to_daal_table_by_kind(const table& t) {
+    if (t.get_kind() == csr_table::kind()) {
+        return convert_to_daal_csr_table<T>(t);
+    }
+    return convert_to_daal_table<T>(t);
+}
+
 template <typename T>
 inline table convert_from_daal_homogen_table(const daal::data_management::NumericTablePtr& nt) {
     daal::data_management::BlockDescriptor<T> block;
@@ -84,11 +253,15 @@ inline auto convert_to_daal_sycl_homogen_table(sycl::queue& queue,
     const auto daal_data =
         daal::services::SharedPtr<T>(data.get_mutable_data(), daal_array_owner<T>{ data });
 
+    // The kernels take the USM pointer directly, so the device data is passed
+    // without a copy into the SYCL* buffer
+    auto alloc_kind = sycl::get_pointer_type(daal_data.get(), queue.get_context());
+    if (alloc_kind == sycl::usm::alloc::unknown) {
+        alloc_kind = sycl::usm::alloc::shared;
+    }
+
     using daal::data_management::internal::SyclHomogenNumericTable;
-    return SyclHomogenNumericTable<T>::create(daal_data,
-                                              column_count,
-                                              row_count,
-                                              cl::sycl::usm::alloc::shared);
+    return SyclHomogenNumericTable<T>::create(daal_data, column_count, row_count, alloc_kind);
 }
 
 #endif
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/backend/interop/table_conversion_cache.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::backend::interop {
+
+using std::int64_t;
+
+static const auto& get_table_impl(const table& t) {
+    return detail::pimpl_accessor().get_pimpl(t);
+}
+
+table_conversion_cache& table_conversion_cache::get_global() {
+    static table_conversion_cache cache;
+    return cache;
+}
+
+void table_conversion_cache::set_memory_budget(int64_t budget) {
+    if (budget < 0) {
+        throw invalid_argument("Negative memory budget");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_ = budget;
+    evict(budget_);
+}
+
+int64_t table_conversion_cache::get_memory_budget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return budget_;
+}
+
+int64_t table_conversion_cache::get_memory_usage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return usage_;
+}
+
+void table_conversion_cache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    evict(0);
+}
+
+daal::data_management::NumericTablePtr table_conversion_cache::find(const table& t,
+                                                                    data_type dtype) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (budget_ == 0) {
+        return daal::data_management::NumericTablePtr();
+    }
+
+    const auto& impl = get_table_impl(t);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->dtype == dtype && it->table_impl.lock() == impl) {
+            // The most recently used entries are kept at the front
+            entries_.splice(entries_.begin(), entries_, it);
+            return entries_.front().daal_table;
+        }
+    }
+    return daal::data_management::NumericTablePtr();
+}
+
+void table_conversion_cache::insert(const table& t,
+                                    data_type dtype,
+                                    const daal::data_management::NumericTablePtr& daal_table,
+                                    int64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!daal_table || size > budget_) {
+        return;
+    }
+
+    const auto& impl = get_table_impl(t);
+    for (const auto& e : entries_) {
+        if (e.dtype == dtype && e.table_impl.lock() == impl) {
+            return;
+        }
+    }
+
+    evict(budget_ - size);
+    entries_.push_front(entry{ impl, dtype, daal_table, size });
+    usage_ += size;
+}
+
+void table_conversion_cache::evict(int64_t budget) {
+    // The entries of the destroyed tables are dropped first
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->table_impl.expired()) {
+            usage_ -= it->size;
+            it = entries_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    while (usage_ > budget && !entries_.empty()) {
+        usage_ -= entries_.back().size;
+        entries_.pop_back();
+    }
+}
+
+} // namespace oneapi::dal::backend::interop
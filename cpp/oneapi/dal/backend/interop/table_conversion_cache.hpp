@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/include/data_management/data/numeric_table.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::backend::interop {
+
+/// Keeps the DAAL numeric tables converted from the oneDAL tables, so the
+/// repeated calls on the same table skip the conversion. The entries are
+/// keyed on the identity of the table implementation and the data type of
+/// the conversion. An entry becomes invalid when all the copies of its table
+/// are destroyed. The least recently used entries are evicted when the total
+/// size of the converted data exceeds the memory budget.
+///
+/// The data of the cached tables is assumed to be not modified in place.
+class ONEAPI_DAL_EXPORT table_conversion_cache {
+public:
+    static table_conversion_cache& get_global();
+
+    table_conversion_cache() : budget_(0), usage_(0) {}
+
+    table_conversion_cache(const table_conversion_cache&) = delete;
+    table_conversion_cache& operator=(const table_conversion_cache&) = delete;
+
+    /// Sets the maximal total size of the cached data in bytes. The zero
+    /// budget (default) disables the cache.
+    void set_memory_budget(std::int64_t budget);
+    std::int64_t get_memory_budget() const;
+
+    /// The total size of the cached data in bytes
+    std::int64_t get_memory_usage() const;
+
+    void clear();
+
+    /// @return The cached conversion of the table or the null pointer
+    daal::data_management::NumericTablePtr find(const table& t, data_type dtype);
+
+    /// Caches the conversion of the table of the given size in bytes. The
+    /// conversion shall not reference the table itself, otherwise the entry
+    /// never becomes invalid.
+    void insert(const table& t,
+                data_type dtype,
+                const daal::data_management::NumericTablePtr& daal_table,
+                std::int64_t size);
+
+private:
+    struct entry {
+        std::weak_ptr<detail::table_impl_iface> table_impl;
+        data_type dtype;
+        daal::data_management::NumericTablePtr daal_table;
+        std::int64_t size;
+    };
+
+    void evict(std::int64_t budget);
+
+    mutable std::mutex mutex_;
+    std::list<entry> entries_;
+    std::int64_t budget_;
+    std::int64_t usage_;
+};
+
+} // namespace oneapi::dal::backend::interop
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
 #include "oneapi/dal/detail/threading.hpp"
 #include "src/threading/threading.h"
 
@@ -23,3 +25,30 @@ ONEAPI_DAL_EXPORT void _daal_threader_for_oneapi(int n,
                                                  oneapi::dal::preview::functype func) {
     _daal_threader_for(n, threads_request, a, static_cast<daal::functype>(func));
 }
+
+ONEAPI_DAL_EXPORT void _daal_threader_for_cost_oneapi(int n,
+                                                      int threads_request,
+                                                      std::size_t iteration_cost,
+                                                      const void* a,
+                                                      oneapi::dal::preview::functype func) {
+    _daal_threader_for_cost(n,
+                            threads_request,
+                            iteration_cost,
+                            a,
+                            static_cast<daal::functype>(func));
+}
+
+ONEAPI_DAL_EXPORT int _daal_threader_get_max_threads_oneapi() {
+    return _daal_threader_get_max_threads();
+}
+
+ONEAPI_DAL_EXPORT void _daal_first_touch_numa_oneapi(void* dst, const void* src, std::int64_t size) {
+    // The buffers smaller than a few pages per thread are not worth the loop
+    constexpr std::int64_t min_numa_size = 1 << 26;
+    if (size >= min_numa_size && daal::threader_get_numa_node_count() > 1) {
+        daal::threader_first_touch_numa(dst, static_cast<std::size_t>(size), src);
+    }
+    else if (src != nullptr) {
+        std::memcpy(dst, src, static_cast<std::size_t>(size));
+    }
+}
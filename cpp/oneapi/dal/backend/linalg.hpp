@@ -17,4 +17,5 @@
 #pragma once
 
 #include "oneapi/dal/backend/linalg/matrix.hpp"
+#include "oneapi/dal/backend/linalg/expression.hpp"
 #include "oneapi/dal/backend/linalg/dot.hpp"
@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+
+#include "oneapi/dal/backend/linalg/expression.hpp"
+
+namespace oneapi::dal::backend::linalg {
+
+/// The size of the square tiles of the result of the fused products, the tile
+/// stays in the cache while the expression is applied to it
+constexpr std::int64_t dot_tile_size = 32;
+
+namespace detail {
+
+/// Reads the element (i, j) of the matrix of either layout
+template <typename Float>
+class strided_view {
+public:
+    explicit strided_view(const matrix<Float>& m)
+            : data_(m.get_data()),
+              row_step_(m.get_layout() == layout::row_major ? m.get_stride() : 1),
+              column_step_(m.get_layout() == layout::row_major ? 1 : m.get_stride()) {}
+
+    Float operator()(std::int64_t i, std::int64_t j) const {
+        return data_[i * row_step_ + j * column_step_];
+    }
+
+private:
+    const Float* data_;
+    std::int64_t row_step_;
+    std::int64_t column_step_;
+};
+
+} // namespace detail
+
+/// Computes the product `a x b` tile by tile and calls `op(i, j, expr(i, j,
+/// c_ij))` for every element of the product, the product is not stored
+template <typename Float, typename Expr, typename Op>
+inline void dot_enumerate(const matrix<Float>& a,
+                          const matrix<Float>& b,
+                          const expression<Expr>& expr,
+                          Op&& op) {
+    ONEDAL_ASSERT(a.get_column_count() == b.get_row_count(),
+                  "Column count of A must match row count of B");
+
+    const std::int64_t m = a.get_row_count();
+    const std::int64_t n = b.get_column_count();
+    const std::int64_t k = a.get_column_count();
+    const detail::strided_view<Float> a_at{ a };
+    const detail::strided_view<Float> b_at{ b };
+    const Expr& epilogue = expr.derived();
+
+    Float tile[dot_tile_size * dot_tile_size];
+    for (std::int64_t i0 = 0; i0 < m; i0 += dot_tile_size) {
+        const std::int64_t i1 = std::min(m, i0 + dot_tile_size);
+        for (std::int64_t j0 = 0; j0 < n; j0 += dot_tile_size) {
+            const std::int64_t j1 = std::min(n, j0 + dot_tile_size);
+            std::fill(tile, tile + dot_tile_size * dot_tile_size, Float(0));
+            for (std::int64_t p = 0; p < k; p++) {
+                for (std::int64_t i = i0; i < i1; i++) {
+                    const Float a_ip = a_at(i, p);
+                    Float* tile_row = tile + (i - i0) * dot_tile_size;
+                    for (std::int64_t j = j0; j < j1; j++) {
+                        tile_row[j - j0] += a_ip * b_at(p, j);
+                    }
+                }
+            }
+            for (std::int64_t i = i0; i < i1; i++) {
+                const Float* tile_row = tile + (i - i0) * dot_tile_size;
+                for (std::int64_t j = j0; j < j1; j++) {
+                    op(i, j, epilogue(i, j, tile_row[j - j0]));
+                }
+            }
+        }
+    }
+}
+
+/// Computes `c = expr(a x b)` in one pass over `c`
+template <typename Float, typename Expr>
+inline void dot(const matrix<Float>& a,
+                const matrix<Float>& b,
+                matrix<Float>& c,
+                const expression<Expr>& expr) {
+    ONEDAL_ASSERT(c.get_row_count() == a.get_row_count(), "Row count of C must match A");
+    ONEDAL_ASSERT(c.get_column_count() == b.get_column_count(), "Column count of C must match B");
+    dot_enumerate(a, b, expr, [&](std::int64_t i, std::int64_t j, Float x) {
+        c.set(i, j) = x;
+    });
+}
+
+template <typename Float>
+inline void dot(const matrix<Float>& a, const matrix<Float>& b, matrix<Float>& c) {
+    dot(a, b, c, identity{});
+}
+
+template <typename Float, typename Expr>
+inline matrix<Float> dot(const matrix<Float>& a,
+                         const matrix<Float>& b,
+                         const expression<Expr>& expr) {
+    auto c = matrix<Float>::empty({ a.get_row_count(), b.get_column_count() });
+    dot(a, b, c, expr);
+    return c;
+}
+
+template <typename Float>
+inline matrix<Float> dot(const matrix<Float>& a, const matrix<Float>& b) {
+    return dot(a, b, identity{});
+}
+
+/// Reduces every row of `expr(a x b)` to one value without storing the
+/// product, e.g. the distances to the closest centroids
+template <typename Float, typename Expr, typename Reduce>
+inline matrix<Float> dot_reduce_rows(const matrix<Float>& a,
+                                     const matrix<Float>& b,
+                                     const expression<Expr>& expr,
+                                     Float init,
+                                     Reduce&& reduce) {
+    auto reduced = matrix<Float>::full({ a.get_row_count(), 1 }, init);
+    Float* reduced_ptr = reduced.get_mutable_data();
+    dot_enumerate(a, b, expr, [&](std::int64_t i, std::int64_t, Float x) {
+        reduced_ptr[i] = reduce(reduced_ptr[i], x);
+    });
+    return reduced;
+}
+
+} // namespace oneapi::dal::backend::linalg
@@ -0,0 +1,186 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+
+#include "oneapi/dal/backend/linalg/matrix.hpp"
+
+namespace oneapi::dal::backend::linalg {
+
+/// The base of the elementwise expressions the fused evaluations apply to
+/// every element (i, j, x) of the result right after it is computed, e.g.
+/// `add_row(bias) | sigmoid_op{}` adds the bias and applies the sigmoid in the
+/// same pass over the output tile
+template <typename Derived>
+struct expression {
+    const Derived& derived() const {
+        return static_cast<const Derived&>(*this);
+    }
+};
+
+template <typename First, typename Second>
+class composed : public expression<composed<First, Second>> {
+public:
+    composed(const First& first, const Second& second) : first_(first), second_(second) {}
+
+    template <typename Float>
+    Float operator()(std::int64_t i, std::int64_t j, Float x) const {
+        return second_(i, j, first_(i, j, x));
+    }
+
+private:
+    First first_;
+    Second second_;
+};
+
+/// Applies `lhs` and then `rhs`
+template <typename Lhs, typename Rhs>
+inline composed<Lhs, Rhs> operator|(const expression<Lhs>& lhs, const expression<Rhs>& rhs) {
+    return { lhs.derived(), rhs.derived() };
+}
+
+struct identity : public expression<identity> {
+    template <typename Float>
+    Float operator()(std::int64_t, std::int64_t, Float x) const {
+        return x;
+    }
+};
+
+template <typename Float>
+class scale : public expression<scale<Float>> {
+public:
+    explicit scale(Float alpha) : alpha_(alpha) {}
+
+    Float operator()(std::int64_t, std::int64_t, Float x) const {
+        return alpha_ * x;
+    }
+
+private:
+    Float alpha_;
+};
+
+/// The base of the expressions that read one value of a row or a column
+/// vector per element, the expression keeps the vector alive
+template <typename Float>
+class vector_expression_base {
+protected:
+    explicit vector_expression_base(const matrix<Float>& v) : v_(v), data_(v.get_data()) {
+        ONEDAL_ASSERT(v.get_row_count() == 1 || v.get_column_count() == 1,
+                      "Vector must be a single row or a single column");
+    }
+
+    Float at(std::int64_t i) const {
+        return data_[i];
+    }
+
+private:
+    matrix<Float> v_;
+    const Float* data_;
+};
+
+/// Adds v[j] to every element of the j-th column, e.g. the bias of the
+/// responses of the models
+template <typename Float>
+class add_row : public expression<add_row<Float>>, vector_expression_base<Float> {
+public:
+    explicit add_row(const matrix<Float>& v) : vector_expression_base<Float>(v) {}
+
+    Float operator()(std::int64_t, std::int64_t j, Float x) const {
+        return x + this->at(j);
+    }
+};
+
+/// Adds v[i] to every element of the i-th row
+template <typename Float>
+class add_column : public expression<add_column<Float>>, vector_expression_base<Float> {
+public:
+    explicit add_column(const matrix<Float>& v) : vector_expression_base<Float>(v) {}
+
+    Float operator()(std::int64_t i, std::int64_t, Float x) const {
+        return x + this->at(i);
+    }
+};
+
+/// Multiplies every element of the j-th column by v[j]
+template <typename Float>
+class multiply_row : public expression<multiply_row<Float>>, vector_expression_base<Float> {
+public:
+    explicit multiply_row(const matrix<Float>& v) : vector_expression_base<Float>(v) {}
+
+    Float operator()(std::int64_t, std::int64_t j, Float x) const {
+        return x * this->at(j);
+    }
+};
+
+template <typename Float>
+class clamp_min : public expression<clamp_min<Float>> {
+public:
+    explicit clamp_min(Float bound) : bound_(bound) {}
+
+    Float operator()(std::int64_t, std::int64_t, Float x) const {
+        return std::max(x, bound_);
+    }
+
+private:
+    Float bound_;
+};
+
+struct exp_op : public expression<exp_op> {
+    template <typename Float>
+    Float operator()(std::int64_t, std::int64_t, Float x) const {
+        return std::exp(x);
+    }
+};
+
+struct sqrt_op : public expression<sqrt_op> {
+    template <typename Float>
+    Float operator()(std::int64_t, std::int64_t, Float x) const {
+        return std::sqrt(x);
+    }
+};
+
+struct sigmoid_op : public expression<sigmoid_op> {
+    template <typename Float>
+    Float operator()(std::int64_t, std::int64_t, Float x) const {
+        return Float(1) / (Float(1) + std::exp(-x));
+    }
+};
+
+/// The column of the squared L2 norms of the rows of `x`
+template <typename Float>
+inline matrix<Float> row_squared_norms(const matrix<Float>& x) {
+    auto norms = matrix<Float>::zeros({ x.get_row_count(), 1 });
+    Float* norms_ptr = norms.get_mutable_data();
+    x.enumerate([&](std::int64_t i, std::int64_t, Float v) {
+        norms_ptr[i] += v * v;
+    });
+    return norms;
+}
+
+/// Turns the inner products <x_i, y_j> of `dot(x, y.T())` into the squared
+/// distances ||x_i||^2 - 2 <x_i, y_j> + ||y_j||^2, the small negative values
+/// the rounding gives are clamped to zero
+template <typename Float>
+inline auto squared_l2_distances(const matrix<Float>& x, const matrix<Float>& y) {
+    return scale<Float>{ Float(-2) } | add_column<Float>{ row_squared_norms(x) } |
+           add_row<Float>{ row_squared_norms(y) } | clamp_min<Float>{ Float(0) };
+}
+
+} // namespace oneapi::dal::backend::linalg
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cmath>
+#include <limits>
+
+#include "oneapi/dal/test/common.hpp"
+#include "oneapi/dal/backend/linalg/dot.hpp"
+
+namespace oneapi::dal::backend::linalg::test {
+
+matrix<double> make_matrix(std::int64_t row_count, std::int64_t column_count, double shift) {
+    return matrix<double>::full({ row_count, column_count }, [&](std::int64_t i, std::int64_t j) {
+        return std::sin(double(i * column_count + j) + shift);
+    });
+}
+
+void check_near(const matrix<double>& actual, const matrix<double>& expected) {
+    REQUIRE(actual.get_shape() == expected.get_shape());
+    REQUIRE((actual - expected).abs().max() < 1e-10);
+}
+
+TEST_CASE("fused dot matches separate passes", "[linalg][host]") {
+    const std::int64_t m = GENERATE(3, 40);
+    const std::int64_t n = GENERATE(5, 70);
+    const std::int64_t k = GENERATE(4, 33);
+
+    const auto A = make_matrix(m, k, 0.0);
+    const auto B = make_matrix(n, k, 1.0);
+    const auto bias = make_matrix(1, n, 2.0);
+    const auto C = dot(A, B.T());
+
+    SECTION("bias and sigmoid, m = " + std::to_string(m) + ", n = " + std::to_string(n)) {
+        const auto fused = dot(A, B.T(), add_row<double>{ bias } | sigmoid_op{});
+        auto expected = matrix<double>::full({ m, n }, [&](std::int64_t i, std::int64_t j) {
+            return 1.0 / (1.0 + std::exp(-(C.get(i, j) + bias.get(0, j))));
+        });
+        check_near(fused, expected);
+    }
+
+    SECTION("squared distances and rbf, k = " + std::to_string(k)) {
+        const double sigma = 2.0;
+        const auto distances = dot(A, B.T(), squared_l2_distances(A, B));
+        const auto rbf = dot(A,
+                             B.T(),
+                             squared_l2_distances(A, B) |
+                                 scale<double>{ -0.5 / (sigma * sigma) } | exp_op{});
+        for (std::int64_t i = 0; i < m; i++) {
+            for (std::int64_t j = 0; j < n; j++) {
+                double expected = 0.0;
+                for (std::int64_t p = 0; p < k; p++) {
+                    const double diff = A.get(i, p) - B.get(j, p);
+                    expected += diff * diff;
+                }
+                REQUIRE(std::abs(distances.get(i, j) - expected) < 1e-10);
+                REQUIRE(std::abs(rbf.get(i, j) - std::exp(-0.5 * expected / (sigma * sigma))) <
+                        1e-10);
+            }
+        }
+    }
+
+    SECTION("row reduction, k = " + std::to_string(k)) {
+        const auto closest = dot_reduce_rows(A,
+                                             B.T(),
+                                             squared_l2_distances(A, B),
+                                             std::numeric_limits<double>::max(),
+                                             [](double x, double y) {
+                                                 return std::min(x, y);
+                                             });
+        const auto distances = dot(A, B.T(), squared_l2_distances(A, B));
+        REQUIRE(closest.get_shape() == shape{ m, 1 });
+        for (std::int64_t i = 0; i < m; i++) {
+            double expected = distances.get(i, 0);
+            for (std::int64_t j = 1; j < n; j++) {
+                expected = std::min(expected, distances.get(i, j));
+            }
+            REQUIRE(closest.get(i, 0) == expected);
+        }
+    }
+}
+
+} // namespace oneapi::dal::backend::linalg::test
@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#ifndef ONEAPI_DAL_DATA_PARALLEL
+#error ONEAPI_DAL_DATA_PARALLEL must be defined to include this file
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::backend {
+
+/// The smallest number of rows worth running on a separate device
+constexpr std::int64_t min_shard_row_count = 1 << 14;
+
+/// Returns the number of devices the rows are split between, every device
+/// gets at least min_shard_row_count rows. The rows are split only between
+/// the GPUs, the host and CPU devices run on the host threads anyway.
+inline std::int64_t get_shard_count(const detail::data_parallel_policy& policy,
+                                    std::int64_t row_count) {
+    const std::int64_t device_count = policy.get_device_count();
+    if (device_count < 2) {
+        return 1;
+    }
+    for (const auto& queue : policy.get_queues()) {
+        if (!queue.get_device().is_gpu()) {
+            return 1;
+        }
+    }
+    return std::max<std::int64_t>(1, std::min(device_count, row_count / min_shard_row_count));
+}
+
+/// Splits the rows into the contiguous ranges with sizes which differ by one
+/// row at most
+inline std::vector<range> split_rows(std::int64_t row_count, std::int64_t shard_count) {
+    std::vector<range> shards;
+    shards.reserve(shard_count);
+    const std::int64_t base_size = row_count / shard_count;
+    const std::int64_t remainder = row_count % shard_count;
+    std::int64_t start = 0;
+    for (std::int64_t i = 0; i < shard_count; i++) {
+        const std::int64_t end = start + base_size + (i < remainder ? 1 : 0);
+        shards.emplace_back(start, end);
+        start = end;
+    }
+    return shards;
+}
+
+/// Runs ``body(shard_index, device_policy)`` for the first ``shard_count``
+/// devices of the policy concurrently. The first shard runs in the calling
+/// thread. The first exception thrown by the shards is rethrown after all of
+/// them complete.
+template <typename Body>
+inline void for_each_shard(const detail::data_parallel_policy& policy,
+                           std::int64_t shard_count,
+                           Body&& body) {
+    std::vector<std::exception_ptr> errors(shard_count);
+    const auto run_shard = [&](std::int64_t i) {
+        try {
+            body(i, policy.get_device_policy(i));
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(shard_count - 1);
+    for (std::int64_t i = 1; i < shard_count; i++) {
+        threads.emplace_back(run_shard, i);
+    }
+    run_shard(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/// Copies the rows of the table to the device of the queue
+template <typename Float>
+inline table pull_rows(sycl::queue& queue, const table& t, const range& rows) {
+    auto arr = row_accessor<const Float>{ t }.pull(queue, rows);
+    const std::int64_t row_count = rows.get_element_count(t.get_row_count());
+    return detail::homogen_table_builder{}.reset(arr, row_count, t.get_column_count()).build();
+}
+
+/// Concatenates the rows of the tables into the table on the device of the
+/// queue. The tables may reside on different devices, so the rows are staged
+/// through the host.
+template <typename T>
+inline table concat_rows(sycl::queue& queue, const std::vector<table>& parts) {
+    std::int64_t row_count = 0;
+    for (const auto& part : parts) {
+        row_count += part.get_row_count();
+    }
+    const std::int64_t column_count = parts.empty() ? 0 : parts.front().get_column_count();
+
+    auto arr = array<T>::empty(queue, row_count * column_count);
+    T* data = arr.get_mutable_data();
+    for (const auto& part : parts) {
+        const auto rows = row_accessor<const T>{ part }.pull();
+        std::memcpy(data, rows.get_data(), sizeof(T) * rows.get_count());
+        data += rows.get_count();
+    }
+    return detail::homogen_table_builder{}.reset(arr, row_count, column_count).build();
+}
+
+} // namespace oneapi::dal::backend
@@ -0,0 +1,228 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+#include <CL/sycl.hpp>
+#endif
+
+// The benchmarks are the Google Benchmark binaries, the machine-readable
+// results are produced by the standard options passed after "--", e.g.
+// "bazel run //cpp/oneapi/dal/benchmark:kmeans_benchmark -- --benchmark_format=json
+// --benchmark_out=kmeans.json"
+
+namespace oneapi::dal::bench {
+
+/// The sizes of the synthetic datasets as {row_count, column_count}
+using dataset_size = std::pair<std::int64_t, std::int64_t>;
+
+inline std::vector<dataset_size> get_default_sizes() {
+    return { { 1000, 16 }, { 10000, 32 }, { 100000, 64 } };
+}
+
+inline const char* get_cpu_extension_name(detail::cpu_extension extension) {
+    using detail::cpu_extension;
+    switch (extension) {
+        case cpu_extension::sse2: return "sse2";
+        case cpu_extension::ssse3: return "ssse3";
+        case cpu_extension::sse42: return "sse42";
+        case cpu_extension::avx: return "avx";
+        case cpu_extension::avx2: return "avx2";
+        case cpu_extension::avx512: return "avx512";
+        default: return "none";
+    }
+}
+
+/// The instruction sets supported by the machine, the kernels of the higher
+/// ones would fail with the illegal instruction
+inline std::vector<detail::cpu_extension> get_supported_cpu_extensions() {
+    using detail::cpu_extension;
+    const auto top = detail::host_policy{}.get_enabled_cpu_extensions();
+    std::vector<cpu_extension> extensions;
+    for (auto extension : { cpu_extension::sse2,
+                            cpu_extension::ssse3,
+                            cpu_extension::sse42,
+                            cpu_extension::avx,
+                            cpu_extension::avx2,
+                            cpu_extension::avx512 }) {
+        if (static_cast<std::uint64_t>(extension) <= static_cast<std::uint64_t>(top)) {
+            extensions.push_back(extension);
+        }
+    }
+    return extensions;
+}
+
+/// Generates the row-major data with the components uniformly distributed in
+/// [a, b). The same seed gives the same data on every run.
+inline array<float> generate_uniform(std::int64_t count,
+                                     double a,
+                                     double b,
+                                     std::int64_t seed = 7777) {
+    std::mt19937 engine(static_cast<std::uint32_t>(seed));
+    std::uniform_real_distribution<float> distr(a, b);
+    auto data = array<float>::empty(count);
+    float* data_ptr = data.get_mutable_data();
+    for (std::int64_t i = 0; i < count; i++) {
+        data_ptr[i] = distr(engine);
+    }
+    return data;
+}
+
+/// Generates the class labels 0, ..., class_count - 1 stored as floats
+inline array<float> generate_labels(std::int64_t count,
+                                    std::int64_t class_count,
+                                    std::int64_t seed = 7777) {
+    std::mt19937 engine(static_cast<std::uint32_t>(seed));
+    std::uniform_int_distribution<std::int64_t> distr(0, class_count - 1);
+    auto data = array<float>::empty(count);
+    float* data_ptr = data.get_mutable_data();
+    for (std::int64_t i = 0; i < count; i++) {
+        data_ptr[i] = static_cast<float>(distr(engine));
+    }
+    return data;
+}
+
+/// Converts the labels 0, 1 into the labels -1, +1 of the two-class problems
+inline array<float> to_signed_labels(const array<float>& labels) {
+    auto data = array<float>::empty(labels.get_count());
+    float* data_ptr = data.get_mutable_data();
+    for (std::int64_t i = 0; i < labels.get_count(); i++) {
+        data_ptr[i] = labels[i] > 0.f ? 1.f : -1.f;
+    }
+    return data;
+}
+
+/// Places the data into the table of the policy: the host memory for the host
+/// policy and the USM memory of the queue for the data parallel one
+inline table make_table(const detail::host_policy&,
+                        const array<float>& data,
+                        std::int64_t row_count,
+                        std::int64_t column_count) {
+    return detail::homogen_table_builder{}.reset(data, row_count, column_count).build();
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+inline table make_table(const detail::data_parallel_policy& policy,
+                        const array<float>& data,
+                        std::int64_t row_count,
+                        std::int64_t column_count) {
+    return detail::homogen_table_builder{}
+        .allocate(policy.get_queue(), row_count, column_count)
+        .copy_data(policy.get_queue(), data.get_data(), row_count, column_count)
+        .build();
+}
+
+inline sycl::queue& get_gpu_queue() {
+    static sycl::queue queue{ sycl::gpu_selector{} };
+    return queue;
+}
+
+inline bool has_gpu() {
+    try {
+        get_gpu_queue();
+        return true;
+    }
+    catch (const sycl::exception&) {
+        return false;
+    }
+}
+#endif
+
+/// The benchmark body invoked with the policy of the variant
+template <typename Policy>
+using benchmark_body = std::function<void(::benchmark::State&, const Policy&)>;
+
+/// Registers the variants "<name>/<isa>/rows:R/cols:C" of the benchmark for
+/// every supported instruction set and every dataset size
+inline void register_host_benchmark(const std::string& name,
+                                    const benchmark_body<detail::host_policy>& body,
+                                    const std::vector<dataset_size>& sizes = get_default_sizes()) {
+    for (auto extension : get_supported_cpu_extensions()) {
+        const std::string variant_name = name + "/" + get_cpu_extension_name(extension);
+        auto bench = ::benchmark::RegisterBenchmark(variant_name.c_str(),
+                                                    [=](::benchmark::State& state) {
+                                                        detail::host_policy policy;
+                                                        policy.set_enabled_cpu_extensions(extension);
+                                                        body(state, policy);
+                                                    });
+        for (const auto& size : sizes) {
+            bench->Args({ size.first, size.second });
+        }
+        bench->ArgNames({ "rows", "cols" })->Unit(::benchmark::kMillisecond)->UseRealTime();
+    }
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+/// Registers the variants "<name>/gpu/rows:R/cols:C" of the benchmark if the
+/// GPU is available
+inline void register_gpu_benchmark(const std::string& name,
+                                   const benchmark_body<detail::data_parallel_policy>& body,
+                                   const std::vector<dataset_size>& sizes = get_default_sizes()) {
+    if (!has_gpu()) {
+        return;
+    }
+    const std::string variant_name = name + "/gpu";
+    auto bench = ::benchmark::RegisterBenchmark(variant_name.c_str(),
+                                                [=](::benchmark::State& state) {
+                                                    const detail::data_parallel_policy policy{
+                                                        get_gpu_queue()
+                                                    };
+                                                    body(state, policy);
+                                                });
+    for (const auto& size : sizes) {
+        bench->Args({ size.first, size.second });
+    }
+    bench->ArgNames({ "rows", "cols" })->Unit(::benchmark::kMillisecond)->UseRealTime();
+}
+#endif
+
+/// Reports the processed rows per second in the machine-readable output
+inline void set_row_counters(::benchmark::State& state, std::int64_t row_count) {
+    state.SetItemsProcessed(state.iterations() * row_count);
+    state.counters["rows"] = static_cast<double>(row_count);
+}
+
+} // namespace oneapi::dal::bench
+
+/// Registers the benchmark body for the host and, in the DPC++ build, for the GPU.
+/// The body is the generic lambda taking the state and the policy.
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+#define DAL_BENCHMARK_REGISTER(name, ...)                                                   \
+    static const bool _dal_benchmark_registered_##name = [] {                              \
+        const auto body = __VA_ARGS__;                                                      \
+        oneapi::dal::bench::register_host_benchmark(#name, body);                      \
+        oneapi::dal::bench::register_gpu_benchmark(#name, body);                       \
+        return true;                                                                        \
+    }()
+#else
+#define DAL_BENCHMARK_REGISTER(name, ...)                                                   \
+    static const bool _dal_benchmark_registered_##name = [] {                              \
+        const auto body = __VA_ARGS__;                                                      \
+        oneapi::dal::bench::register_host_benchmark(#name, body);                      \
+        return true;                                                                        \
+    }()
+#endif
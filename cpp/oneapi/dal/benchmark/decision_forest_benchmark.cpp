@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/decision_forest.hpp"
+#include "oneapi/dal/benchmark/common.hpp"
+
+namespace oneapi::dal::bench {
+
+namespace df = decision_forest;
+
+constexpr std::int64_t class_count = 5;
+constexpr std::int64_t tree_count = 50;
+
+/// The CPU trains with the dense method, the GPU supports the hist one only.
+/// The inference uses the dense method on both.
+template <typename Policy>
+struct train_method {
+    using type = df::method::dense;
+};
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+template <>
+struct train_method<detail::data_parallel_policy> {
+    using type = df::method::hist;
+};
+#endif
+
+template <typename Task, typename Method>
+auto make_df_descriptor() {
+    auto desc = df::descriptor<float, Task, Method>{}.set_tree_count(tree_count);
+    if constexpr (std::is_same_v<Task, df::task::classification>) {
+        desc.set_class_count(class_count);
+    }
+    return desc;
+}
+
+template <typename Task, typename Policy>
+auto make_labels(const Policy& policy, std::int64_t row_count) {
+    if constexpr (std::is_same_v<Task, df::task::classification>) {
+        return make_table(policy, generate_labels(row_count, class_count), row_count, 1);
+    }
+    else {
+        return make_table(policy, generate_uniform(row_count, -1.0, 1.0, 42), row_count, 1);
+    }
+}
+
+template <typename Task, typename Policy>
+void run_df_train(::benchmark::State& state, const Policy& policy) {
+    const std::int64_t row_count = state.range(0);
+    const std::int64_t column_count = state.range(1);
+    const auto x = make_table(policy,
+                              generate_uniform(row_count * column_count, -1.0, 1.0),
+                              row_count,
+                              column_count);
+    const auto y = make_labels<Task>(policy, row_count);
+    const auto desc = make_df_descriptor<Task, typename train_method<Policy>::type>();
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::train(policy, desc, x, y));
+    }
+    set_row_counters(state, row_count);
+}
+
+template <typename Task, typename Policy>
+void run_df_infer(::benchmark::State& state, const Policy& policy) {
+    const std::int64_t row_count = state.range(0);
+    const std::int64_t column_count = state.range(1);
+    const auto x = make_table(policy,
+                              generate_uniform(row_count * column_count, -1.0, 1.0),
+                              row_count,
+                              column_count);
+    const auto y = make_labels<Task>(policy, row_count);
+    const auto train_desc = make_df_descriptor<Task, typename train_method<Policy>::type>();
+    const auto infer_desc = make_df_descriptor<Task, df::method::dense>();
+    const auto model = dal::train(policy, train_desc, x, y).get_model();
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::infer(policy, infer_desc, model, x));
+    }
+    set_row_counters(state, row_count);
+}
+
+DAL_BENCHMARK_REGISTER(df_cls_train, [](::benchmark::State& state, const auto& policy) {
+    run_df_train<df::task::classification>(state, policy);
+});
+
+DAL_BENCHMARK_REGISTER(df_cls_infer, [](::benchmark::State& state, const auto& policy) {
+    run_df_infer<df::task::classification>(state, policy);
+});
+
+DAL_BENCHMARK_REGISTER(df_reg_train, [](::benchmark::State& state, const auto& policy) {
+    run_df_train<df::task::regression>(state, policy);
+});
+
+DAL_BENCHMARK_REGISTER(df_reg_infer, [](::benchmark::State& state, const auto& policy) {
+    run_df_infer<df::task::regression>(state, policy);
+});
+
+} // namespace oneapi::dal::bench
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <atomic>
+
+#include "oneapi/dal/algo/jaccard.hpp"
+#include "oneapi/dal/benchmark/common.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
+#include "oneapi/dal/io/detail/load_graph.hpp"
+
+namespace oneapi::dal::bench {
+
+using graph_t = preview::undirected_adjacency_array_graph<>;
+
+/// Generates the random graph where every vertex is connected with
+/// average_degree / 2 uniformly chosen vertices
+inline graph_t make_random_graph(std::int32_t vertex_count,
+                                 std::int32_t average_degree,
+                                 std::int64_t seed = 7777) {
+    std::mt19937 engine(static_cast<std::uint32_t>(seed));
+    std::uniform_int_distribution<std::int32_t> distr(0, vertex_count - 1);
+    preview::edge_list<std::int32_t> edges;
+    edges.reserve(static_cast<std::size_t>(vertex_count) * (average_degree / 2));
+    for (std::int32_t u = 0; u < vertex_count; u++) {
+        for (std::int32_t i = 0; i < average_degree / 2; i++) {
+            const std::int32_t v = distr(engine);
+            if (u != v) {
+                edges.emplace_back(u, v);
+            }
+        }
+    }
+    graph_t graph;
+    preview::load_graph::detail::convert_to_csr_impl(edges, graph);
+    return graph;
+}
+
+void register_jaccard_benchmark(const std::string& name,
+                                void (*body)(::benchmark::State&, const graph_t&)) {
+    auto bench = ::benchmark::RegisterBenchmark(name.c_str(), [=](::benchmark::State& state) {
+        const auto graph = make_random_graph(static_cast<std::int32_t>(state.range(0)),
+                                             static_cast<std::int32_t>(state.range(1)));
+        body(state, graph);
+    });
+    bench->Args({ 1 << 12, 16 })->Args({ 1 << 14, 32 })->Args({ 1 << 16, 16 });
+    bench->ArgNames({ "vertices", "degree" })->Unit(::benchmark::kMillisecond)->UseRealTime();
+}
+
+// The block of the first rows against all the vertices, as in the examples
+void run_jaccard_block(::benchmark::State& state, const graph_t& graph) {
+    const std::int64_t vertex_count = state.range(0);
+    const std::int64_t row_count = std::min<std::int64_t>(vertex_count, 1024);
+    const auto desc = preview::jaccard::descriptor<>().set_block({ 0, row_count },
+                                                                 { 0, vertex_count });
+    std::int64_t nonzero_count = 0;
+    for (auto _ : state) {
+        preview::jaccard::caching_builder builder;
+        const auto result = preview::vertex_similarity(desc, graph, builder);
+        nonzero_count = result.get_nonzero_coeff_count();
+    }
+    set_row_counters(state, row_count);
+    state.counters["nonzero_coeffs"] = static_cast<double>(nonzero_count);
+}
+
+void run_jaccard_all_pairs(::benchmark::State& state, const graph_t& graph) {
+    const auto desc = preview::jaccard::descriptor<>();
+    std::atomic<std::int64_t> nonzero_count = 0;
+    for (auto _ : state) {
+        nonzero_count = 0;
+        preview::jaccard::vertex_similarity_all_pairs(desc, graph, [&](const auto& result) {
+            nonzero_count += result.get_nonzero_coeff_count();
+        });
+    }
+    set_row_counters(state, state.range(0));
+    state.counters["nonzero_coeffs"] = static_cast<double>(nonzero_count.load());
+}
+
+// The graph algorithms have the CPU implementation only and dispatch by the
+// instruction set of the machine
+static const bool jaccard_registered = [] {
+    register_jaccard_benchmark("jaccard_block", run_jaccard_block);
+    register_jaccard_benchmark("jaccard_all_pairs", run_jaccard_all_pairs);
+    return true;
+}();
+
+} // namespace oneapi::dal::bench
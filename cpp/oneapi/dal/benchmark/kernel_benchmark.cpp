@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/linear_kernel.hpp"
+#include "oneapi/dal/algo/rbf_kernel.hpp"
+#include "oneapi/dal/benchmark/common.hpp"
+
+namespace oneapi::dal::bench {
+
+// The result is the dense row_count x row_count matrix
+const std::vector<dataset_size> kernel_sizes = { { 1000, 16 }, { 5000, 32 }, { 10000, 64 } };
+
+template <typename Descriptor, typename Policy>
+void run_kernel_compute(::benchmark::State& state, const Policy& policy) {
+    const std::int64_t row_count = state.range(0);
+    const std::int64_t column_count = state.range(1);
+    const auto x = make_table(policy,
+                              generate_uniform(row_count * column_count, -1.0, 1.0),
+                              row_count,
+                              column_count);
+    const auto desc = Descriptor{};
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::compute(policy, desc, x, x));
+    }
+    set_row_counters(state, row_count);
+}
+
+template <typename Descriptor>
+void register_kernel_benchmark(const std::string& name) {
+    register_host_benchmark(
+        name,
+        [](::benchmark::State& state, const detail::host_policy& policy) {
+            run_kernel_compute<Descriptor>(state, policy);
+        },
+        kernel_sizes);
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    register_gpu_benchmark(
+        name,
+        [](::benchmark::State& state, const detail::data_parallel_policy& policy) {
+            run_kernel_compute<Descriptor>(state, policy);
+        },
+        kernel_sizes);
+#endif
+}
+
+static const bool kernels_registered = [] {
+    register_kernel_benchmark<linear_kernel::descriptor<float>>("linear_kernel_compute");
+    register_kernel_benchmark<rbf_kernel::descriptor<float>>("rbf_kernel_compute");
+    return true;
+}();
+
+} // namespace oneapi::dal::bench
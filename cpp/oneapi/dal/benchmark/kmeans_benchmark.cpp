@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/kmeans.hpp"
+#include "oneapi/dal/benchmark/common.hpp"
+
+namespace oneapi::dal::bench {
+
+constexpr std::int64_t cluster_count = 10;
+
+template <typename Policy>
+table make_initial_centroids(const Policy& policy, const array<float>& data, std::int64_t column_count) {
+    // The first rows of the uniform data are the random initial centroids
+    auto centroids = array<float>::empty(cluster_count * column_count);
+    for (std::int64_t i = 0; i < centroids.get_count(); i++) {
+        centroids.get_mutable_data()[i] = data[i];
+    }
+    return make_table(policy, centroids, cluster_count, column_count);
+}
+
+const auto kmeans_desc = kmeans::descriptor<float>{}
+                             .set_cluster_count(cluster_count)
+                             .set_max_iteration_count(10)
+                             .set_accuracy_threshold(0.0);
+
+DAL_BENCHMARK_REGISTER(kmeans_train, [](::benchmark::State& state, const auto& policy) {
+    const std::int64_t row_count = state.range(0);
+    const std::int64_t column_count = state.range(1);
+    const auto data = generate_uniform(row_count * column_count, -10.0, 10.0);
+    const auto x = make_table(policy, data, row_count, column_count);
+    const auto initial_centroids = make_initial_centroids(policy, data, column_count);
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::train(policy, kmeans_desc, x, initial_centroids));
+    }
+    set_row_counters(state, row_count);
+});
+
+DAL_BENCHMARK_REGISTER(kmeans_infer, [](::benchmark::State& state, const auto& policy) {
+    const std::int64_t row_count = state.range(0);
+    const std::int64_t column_count = state.range(1);
+    const auto data = generate_uniform(row_count * column_count, -10.0, 10.0);
+    const auto x = make_table(policy, data, row_count, column_count);
+    const auto initial_centroids = make_initial_centroids(policy, data, column_count);
+    const auto model = dal::train(policy, kmeans_desc, x, initial_centroids).get_model();
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::infer(policy, kmeans_desc, model, x));
+    }
+    set_row_counters(state, row_count);
+});
+
+} // namespace oneapi::dal::bench
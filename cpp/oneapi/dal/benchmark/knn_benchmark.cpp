@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/knn.hpp"
+#include "oneapi/dal/benchmark/common.hpp"
+
+namespace oneapi::dal::bench {
+
+constexpr std::int64_t class_count = 5;
+constexpr std::int64_t neighbor_count = 10;
+
+template <typename Method, typename Policy>
+void run_knn_train(::benchmark::State& state, const Policy& policy) {
+    const std::int64_t row_count = state.range(0);
+    const std::int64_t column_count = state.range(1);
+    const auto x = make_table(policy,
+                              generate_uniform(row_count * column_count, -1.0, 1.0),
+                              row_count,
+                              column_count);
+    const auto y = make_table(policy, generate_labels(row_count, class_count), row_count, 1);
+    const auto desc = knn::descriptor<float, Method>{ class_count, neighbor_count };
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::train(policy, desc, x, y));
+    }
+    set_row_counters(state, row_count);
+}
+
+template <typename Method, typename Policy>
+void run_knn_infer(::benchmark::State& state, const Policy& policy) {
+    const std::int64_t row_count = state.range(0);
+    const std::int64_t column_count = state.range(1);
+    const auto x = make_table(policy,
+                              generate_uniform(row_count * column_count, -1.0, 1.0),
+                              row_count,
+                              column_count);
+    const auto y = make_table(policy, generate_labels(row_count, class_count), row_count, 1);
+    const auto desc = knn::descriptor<float, Method>{ class_count, neighbor_count };
+    const auto model = dal::train(policy, desc, x, y).get_model();
+
+    // The queries are the separate points of the same distribution
+    const std::int64_t query_count = std::min<std::int64_t>(row_count, 10000);
+    const auto x_query = make_table(policy,
+                                    generate_uniform(query_count * column_count, -1.0, 1.0, 42),
+                                    query_count,
+                                    column_count);
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::infer(policy, desc, x_query, model));
+    }
+    set_row_counters(state, query_count);
+}
+
+DAL_BENCHMARK_REGISTER(knn_brute_force_train, [](::benchmark::State& state, const auto& policy) {
+    run_knn_train<knn::method::brute_force>(state, policy);
+});
+
+DAL_BENCHMARK_REGISTER(knn_brute_force_infer, [](::benchmark::State& state, const auto& policy) {
+    run_knn_infer<knn::method::brute_force>(state, policy);
+});
+
+// The k-d tree method is available on CPU only
+static const bool knn_kd_tree_registered = [] {
+    register_host_benchmark("knn_kd_tree_train",
+                            [](::benchmark::State& state, const detail::host_policy& policy) {
+                                run_knn_train<knn::method::kd_tree>(state, policy);
+                            });
+    register_host_benchmark("knn_kd_tree_infer",
+                            [](::benchmark::State& state, const detail::host_policy& policy) {
+                                run_knn_infer<knn::method::kd_tree>(state, policy);
+                            });
+    return true;
+}();
+
+} // namespace oneapi::dal::bench
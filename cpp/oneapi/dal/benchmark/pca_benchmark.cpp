@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+
+#include "oneapi/dal/algo/pca.hpp"
+#include "oneapi/dal/benchmark/common.hpp"
+
+namespace oneapi::dal::bench {
+
+DAL_BENCHMARK_REGISTER(pca_cov_train, [](::benchmark::State& state, const auto& policy) {
+    const std::int64_t row_count = state.range(0);
+    const std::int64_t column_count = state.range(1);
+    const auto x = make_table(policy,
+                              generate_uniform(row_count * column_count, -1.0, 1.0),
+                              row_count,
+                              column_count);
+    const auto desc = pca::descriptor<float, pca::method::cov>{}.set_component_count(
+        column_count / 2);
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::train(policy, desc, x));
+    }
+    set_row_counters(state, row_count);
+});
+
+DAL_BENCHMARK_REGISTER(pca_randomized_train, [](::benchmark::State& state, const auto& policy) {
+    const std::int64_t row_count = state.range(0);
+    const std::int64_t column_count = state.range(1);
+    const auto x = make_table(policy,
+                              generate_uniform(row_count * column_count, -1.0, 1.0),
+                              row_count,
+                              column_count);
+    const auto desc = pca::descriptor<float, pca::method::randomized>{}.set_component_count(
+        std::min<std::int64_t>(64, column_count));
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::train(policy, desc, x));
+    }
+    set_row_counters(state, row_count);
+});
+
+} // namespace oneapi::dal::bench
@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/algo/svm.hpp"
+#include "oneapi/dal/benchmark/common.hpp"
+
+namespace oneapi::dal::bench {
+
+// The training time of SVM grows quadratically with the row count
+const std::vector<dataset_size> svm_sizes = { { 1000, 16 }, { 5000, 32 }, { 20000, 64 } };
+
+template <typename Policy>
+auto make_svm_train_data(const Policy& policy, std::int64_t row_count, std::int64_t column_count) {
+    const auto x = make_table(policy,
+                              generate_uniform(row_count * column_count, -1.0, 1.0),
+                              row_count,
+                              column_count);
+    const auto y =
+        make_table(policy, to_signed_labels(generate_labels(row_count, 2)), row_count, 1);
+    return std::make_pair(x, y);
+}
+
+template <typename Policy>
+void run_svm_train(::benchmark::State& state, const Policy& policy) {
+    const std::int64_t row_count = state.range(0);
+    const auto [x, y] = make_svm_train_data(policy, row_count, state.range(1));
+    const auto desc = svm::descriptor{}.set_c(1.0).set_max_iteration_count(100);
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::train(policy, desc, x, y));
+    }
+    set_row_counters(state, row_count);
+}
+
+template <typename Policy>
+void run_svm_infer(::benchmark::State& state, const Policy& policy) {
+    const std::int64_t row_count = state.range(0);
+    const auto [x, y] = make_svm_train_data(policy, row_count, state.range(1));
+    const auto desc = svm::descriptor{}.set_c(1.0).set_max_iteration_count(100);
+    const auto model = dal::train(policy, desc, x, y).get_model();
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(dal::infer(policy, desc, model, x));
+    }
+    set_row_counters(state, row_count);
+}
+
+static const bool svm_registered = [] {
+    register_host_benchmark(
+        "svm_train",
+        [](::benchmark::State& state, const detail::host_policy& policy) {
+            run_svm_train(state, policy);
+        },
+        svm_sizes);
+    register_host_benchmark(
+        "svm_infer",
+        [](::benchmark::State& state, const detail::host_policy& policy) {
+            run_svm_infer(state, policy);
+        },
+        svm_sizes);
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    register_gpu_benchmark(
+        "svm_train",
+        [](::benchmark::State& state, const detail::data_parallel_policy& policy) {
+            run_svm_train(state, policy);
+        },
+        svm_sizes);
+    register_gpu_benchmark(
+        "svm_infer",
+        [](::benchmark::State& state, const detail::data_parallel_policy& policy) {
+            run_svm_infer(state, policy);
+        },
+        svm_sizes);
+#endif
+    return true;
+}();
+
+} // namespace oneapi::dal::bench
@@ -70,7 +70,8 @@ enum class data_type {
     uint64,
     float32,
     float64,
-    bfloat16
+    bfloat16,
+    float16
 };
 
 struct range {
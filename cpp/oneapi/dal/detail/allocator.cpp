@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/detail/allocator.hpp"
+
+namespace oneapi::dal::detail {
+
+static thread_local std::shared_ptr<allocator_iface> current_allocator;
+
+allocator_scope::allocator_scope(const std::shared_ptr<allocator_iface>& allocator)
+        : is_active_(allocator != nullptr) {
+    if (is_active_) {
+        previous_ = std::move(current_allocator);
+        current_allocator = allocator;
+    }
+}
+
+allocator_scope::~allocator_scope() {
+    if (is_active_) {
+        current_allocator = std::move(previous_);
+    }
+}
+
+const std::shared_ptr<allocator_iface>& get_current_allocator() noexcept {
+    return current_allocator;
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+static thread_local std::shared_ptr<usm_allocator_iface> current_usm_allocator;
+
+usm_allocator_scope::usm_allocator_scope(const std::shared_ptr<usm_allocator_iface>& allocator)
+        : is_active_(allocator != nullptr) {
+    if (is_active_) {
+        previous_ = std::move(current_usm_allocator);
+        current_usm_allocator = allocator;
+    }
+}
+
+usm_allocator_scope::~usm_allocator_scope() {
+    if (is_active_) {
+        current_usm_allocator = std::move(previous_);
+    }
+}
+
+const std::shared_ptr<usm_allocator_iface>& get_current_usm_allocator() noexcept {
+    return current_usm_allocator;
+}
+#endif
+
+} // namespace oneapi::dal::detail
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <memory>
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::detail {
+
+/// The user-defined allocator of the host memory, e.g. a pooled one. It is
+/// used for the result tables and the internal buffers of the library.
+class allocator_iface {
+public:
+    virtual ~allocator_iface() = default;
+
+    /// Allocates at least `size` bytes aligned to 64 bytes or returns null
+    virtual void* allocate(std::int64_t size) = 0;
+
+    /// Returns the block of `size` bytes obtained from `allocate`
+    virtual void deallocate(void* pointer, std::int64_t size) noexcept = 0;
+};
+
+/// Makes the allocator current in the calling thread for the lifetime of the
+/// scope. The arrays allocated in the scope keep the allocator and return the
+/// memory to it, so they may outlive the scope. The scopes may be nested, the
+/// scope of the null allocator keeps the current one.
+class ONEAPI_DAL_EXPORT allocator_scope {
+public:
+    explicit allocator_scope(const std::shared_ptr<allocator_iface>& allocator);
+    ~allocator_scope();
+
+    allocator_scope(const allocator_scope&) = delete;
+    allocator_scope& operator=(const allocator_scope&) = delete;
+
+private:
+    bool is_active_;
+    std::shared_ptr<allocator_iface> previous_;
+};
+
+/// The allocator of the innermost scope of the calling thread or null
+ONEAPI_DAL_EXPORT const std::shared_ptr<allocator_iface>& get_current_allocator() noexcept;
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+/// The user-defined allocator of the USM memory, e.g. a device memory pool
+class usm_allocator_iface {
+public:
+    virtual ~usm_allocator_iface() = default;
+
+    /// Allocates at least `size` bytes of the USM memory of the given kind
+    /// on the queue or returns null
+    virtual void* allocate(const sycl::queue& queue, std::int64_t size, sycl::usm::alloc kind) = 0;
+
+    /// Returns the block of `size` bytes obtained from `allocate`
+    virtual void deallocate(const sycl::queue& queue,
+                            void* pointer,
+                            std::int64_t size,
+                            sycl::usm::alloc kind) noexcept = 0;
+};
+
+/// Makes the USM allocator current in the calling thread for the lifetime of
+/// the scope in the same way as `allocator_scope`
+class ONEAPI_DAL_EXPORT usm_allocator_scope {
+public:
+    explicit usm_allocator_scope(const std::shared_ptr<usm_allocator_iface>& allocator);
+    ~usm_allocator_scope();
+
+    usm_allocator_scope(const usm_allocator_scope&) = delete;
+    usm_allocator_scope& operator=(const usm_allocator_scope&) = delete;
+
+private:
+    bool is_active_;
+    std::shared_ptr<usm_allocator_iface> previous_;
+};
+
+ONEAPI_DAL_EXPORT const std::shared_ptr<usm_allocator_iface>& get_current_usm_allocator() noexcept;
+#endif
+
+} // namespace oneapi::dal::detail
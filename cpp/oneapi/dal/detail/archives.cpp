@@ -0,0 +1,204 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include <daal/include/data_management/compression/compression_stream.h>
+
+#include "oneapi/dal/detail/archives.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::detail {
+
+namespace daal_dm = daal::data_management;
+
+namespace {
+
+inline std::int64_t align_up(std::int64_t value) {
+    return (value + archive_alignment - 1) / archive_alignment * archive_alignment;
+}
+
+inline daal_dm::CompressionMethod convert_to_daal_compression(compression_method method) {
+    switch (method) {
+        case compression_method::zlib: return daal_dm::zlib;
+        case compression_method::lz4: return daal_dm::lz4;
+        default: throw invalid_argument("Unsupported compression method");
+    }
+}
+
+inline bool is_supported_compression(std::uint32_t compression) {
+    return compression == static_cast<std::uint32_t>(compression_method::none) ||
+           compression == static_cast<std::uint32_t>(compression_method::zlib) ||
+           compression == static_cast<std::uint32_t>(compression_method::lz4);
+}
+
+/// Compresses the payload by the independent blocks into the array that
+/// starts at the given offset of the result
+array<byte_t> compress(compression_method method,
+                       const byte_t* data,
+                       std::int64_t size,
+                       std::int64_t offset,
+                       std::int64_t& compressed_size) {
+    daal_dm::BlockCompressionStream stream{ convert_to_daal_compression(method) };
+    daal_dm::DataBlock block{ const_cast<byte_t*>(data), std::size_t(size) };
+    stream.push_back(&block);
+    compressed_size = std::int64_t(stream.getCompressedDataSize());
+    if (stream.getErrors()->size() != 0) {
+        throw internal_error("Cannot compress the serialized object");
+    }
+
+    auto result = array<byte_t>::zeros(offset + compressed_size);
+    stream.copyCompressedArray(result.get_mutable_data() + offset, std::size_t(compressed_size));
+    return result;
+}
+
+array<byte_t> decompress(compression_method method,
+                         const byte_t* data,
+                         std::int64_t size,
+                         std::int64_t decompressed_size) {
+    daal_dm::BlockDecompressionStream stream{ convert_to_daal_compression(method) };
+    daal_dm::DataBlock block{ const_cast<byte_t*>(data), std::size_t(size) };
+    stream.push_back(&block);
+    if (std::int64_t(stream.getDecompressedDataSize()) != decompressed_size ||
+        stream.getErrors()->size() != 0) {
+        throw invalid_argument("Corrupted compressed data of the serialized object");
+    }
+
+    auto result = array<byte_t>::empty(decompressed_size);
+    stream.copyDecompressedArray(result.get_mutable_data(), std::size_t(decompressed_size));
+    return result;
+}
+
+} // namespace
+
+void binary_output_archive::write_bytes(const void* data, std::int64_t size) {
+    const auto bytes = static_cast<const byte_t*>(data);
+    payload_.insert(payload_.end(), bytes, bytes + size);
+}
+
+void binary_output_archive::write_array(const void* data, std::int64_t size) {
+    write(size);
+    payload_.resize(align_up(payload_.size()), 0);
+    if (size > 0) {
+        write_bytes(data, size);
+    }
+}
+
+array<byte_t> binary_output_archive::to_array(compression_method method) const {
+    archive_header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, archive_magic, sizeof(header.magic));
+    header.version = archive_version;
+    header.byte_order = archive_byte_order;
+    header.compression = static_cast<std::uint32_t>(method);
+    header.payload_size = payload_.size();
+
+    const std::int64_t offset = align_up(sizeof(header));
+    array<byte_t> result;
+    if (method == compression_method::none || header.payload_size == 0) {
+        header.compression = static_cast<std::uint32_t>(compression_method::none);
+        header.stored_size = header.payload_size;
+        result = array<byte_t>::zeros(offset + header.stored_size);
+        if (header.stored_size > 0) {
+            std::memcpy(result.get_mutable_data() + offset, payload_.data(), header.stored_size);
+        }
+    }
+    else {
+        result = compress(method, payload_.data(), header.payload_size, offset, header.stored_size);
+    }
+    std::memcpy(result.get_mutable_data(), &header, sizeof(header));
+    return result;
+}
+
+binary_input_archive::binary_input_archive(const array<byte_t>& data) {
+    archive_header header;
+    const std::int64_t offset = align_up(sizeof(header));
+    if (data.get_count() < offset) {
+        throw invalid_argument("The data does not contain the serialized object");
+    }
+    std::memcpy(&header, data.get_data(), sizeof(header));
+    if (std::memcmp(header.magic, archive_magic, sizeof(header.magic)) != 0) {
+        throw invalid_argument("The data does not contain the serialized object");
+    }
+    if (header.version != archive_version) {
+        throw invalid_argument("Unsupported version of the serialization format");
+    }
+    if (header.byte_order != archive_byte_order) {
+        throw invalid_argument("Byte order of the serialized object does not match the platform");
+    }
+    if (!is_supported_compression(header.compression) || header.payload_size < 0 ||
+        header.stored_size < 0 ||
+        (header.compression == static_cast<std::uint32_t>(compression_method::none) &&
+         header.stored_size != header.payload_size)) {
+        throw invalid_argument("Corrupted header of the serialized object");
+    }
+    if (header.stored_size > data.get_count() - offset) {
+        throw invalid_argument("Unexpected end of the serialized object");
+    }
+
+    const byte_t* stored = data.get_data() + offset;
+    const auto method = static_cast<compression_method>(header.compression);
+    if (method == compression_method::none) {
+        payload_.reset(data, stored, header.payload_size);
+    }
+    else {
+        payload_ = decompress(method, stored, header.stored_size, header.payload_size);
+    }
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+binary_input_archive::binary_input_archive(sycl::queue& queue, const array<byte_t>& data)
+        : binary_input_archive(data) {
+    const std::int64_t size = payload_.get_count();
+    if (size > 0) {
+        device_payload_ = array<byte_t>::empty(queue, size, sycl::usm::alloc::device);
+        detail::memcpy(data_parallel_policy{ queue },
+                       device_payload_.get_mutable_data(),
+                       payload_.get_data(),
+                       size);
+    }
+}
+#endif
+
+void binary_input_archive::read_bytes(void* data, std::int64_t size) {
+    if (size > payload_.get_count() - offset_) {
+        throw_corrupted();
+    }
+    std::memcpy(data, payload_.get_data() + offset_, size);
+    offset_ += size;
+}
+
+array<byte_t> binary_input_archive::read_array(bool on_device) {
+    const auto size = read<std::int64_t>();
+    const std::int64_t start = align_up(offset_);
+    if (size < 0 || start > payload_.get_count() || size > payload_.get_count() - start) {
+        throw_corrupted();
+    }
+    offset_ = start + size;
+
+    // The allocated payload is aligned, so are the arrays at the aligned offsets
+    const array<byte_t>& source = (on_device && device_payload_.get_count() > 0)
+                                      ? device_payload_
+                                      : payload_;
+    return array<byte_t>{ source, source.get_data() + start, size };
+}
+
+void binary_input_archive::throw_corrupted() const {
+    throw invalid_argument("Corrupted data of the serialized object");
+}
+
+} // namespace oneapi::dal::detail
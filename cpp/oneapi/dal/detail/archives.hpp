@@ -0,0 +1,146 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "oneapi/dal/array.hpp"
+
+namespace oneapi::dal {
+
+/// The compression of the serialized objects. The compressed objects are
+/// decompressed into memory on loading, while the uncompressed ones are read
+/// in place.
+enum class compression_method { none, zlib, lz4 };
+
+namespace detail {
+
+constexpr char archive_magic[8] = { 'O', 'D', 'A', 'L', 'A', 'R', 'C', '\0' };
+constexpr std::uint32_t archive_version = 1;
+constexpr std::uint32_t archive_byte_order = 0x01020304;
+
+/// The payload starts at this offset from the beginning of the archive and the
+/// arrays in the payload are aligned to it, so the arrays of the archive in the
+/// memory-mapped file are aligned for the vector loads
+constexpr std::int64_t archive_alignment = 64;
+
+/// The header of the serialized object, it is followed by the zero padding up
+/// to archive_alignment and the stored_size bytes of the payload. The
+/// compressed payload is decompressed into payload_size bytes.
+struct archive_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t compression;
+    std::uint32_t reserved;
+    std::int64_t payload_size;
+    std::int64_t stored_size;
+};
+
+/// The identifiers of the serializable objects that are written before their
+/// data, so the data of one object is not read into another
+enum class serialization_id : std::uint32_t {
+    kmeans_clustering_model = 1,
+    pca_dim_reduction_model = 2,
+    knn_classification_model = 3,
+    knn_search_model = 4,
+    svm_classification_model = 5,
+    decision_forest_classification_model = 6,
+    decision_forest_regression_model = 7
+};
+
+/// Collects the serialized data of the objects in memory
+class ONEAPI_DAL_EXPORT binary_output_archive {
+public:
+    /// Writes the value of the trivially copyable type as is
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Only trivially copyable values are written");
+        write_bytes(&value, sizeof(T));
+    }
+
+    /// Writes the size of the array and the array aligned to archive_alignment
+    void write_array(const void* data, std::int64_t size);
+
+    /// Returns the header and the payload, the payload is compressed with the
+    /// given method
+    array<byte_t> to_array(compression_method method = compression_method::none) const;
+
+private:
+    void write_bytes(const void* data, std::int64_t size);
+
+    std::vector<byte_t> payload_;
+};
+
+/// Reads the serialized data of the objects from the memory of the archive
+class ONEAPI_DAL_EXPORT binary_input_archive {
+public:
+    /// Checks the header of the archive, the uncompressed payload is read in place
+    explicit binary_input_archive(const array<byte_t>& data);
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    /// Also uploads the whole payload to the device memory with a single
+    /// transfer, the arrays read with on_device refer to the device copy
+    binary_input_archive(sycl::queue& queue, const array<byte_t>& data);
+#endif
+
+    template <typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values are read");
+        T value;
+        read_bytes(&value, sizeof(T));
+        return value;
+    }
+
+    /// Reads the value and throws if it differs from the expected one
+    template <typename T>
+    void expect(const T& value) {
+        if (read<T>() != value) {
+            throw_corrupted();
+        }
+    }
+
+    /// Reads the array written by write_array() without copying, the array
+    /// shares the ownership of the archive memory
+    array<byte_t> read_array(bool on_device = false);
+
+private:
+    void read_bytes(void* data, std::int64_t size);
+    [[noreturn]] void throw_corrupted() const;
+
+    array<byte_t> payload_;
+    array<byte_t> device_payload_;
+    std::int64_t offset_ = 0;
+};
+
+/// Grants the archives access to the private serialization methods of the objects
+struct serialization_accessor {
+    template <typename Object>
+    void serialize(const Object& object, binary_output_archive& ar) const {
+        object.serialize(ar);
+    }
+
+    template <typename Object>
+    void deserialize(Object& object, binary_input_archive& ar) const {
+        object.deserialize(ar);
+    }
+};
+
+} // namespace detail
+} // namespace oneapi::dal
@@ -92,6 +92,9 @@ constexpr std::int64_t get_data_type_size(data_type t) {
     else if (t == data_type::uint64) {
         return sizeof(uint64_t);
     }
+    else if (t == data_type::bfloat16 || t == data_type::float16) {
+        return sizeof(uint16_t);
+    }
     else {
         throw unimplemented{ "Data type is not supported" };
     }
@@ -134,7 +137,8 @@ constexpr data_type make_data_type_impl() {
 }
 
 constexpr bool is_floating_point(data_type t) {
-    if (t == data_type::bfloat16 || t == data_type::float32 || t == data_type::float64) {
+    if (t == data_type::bfloat16 || t == data_type::float16 || t == data_type::float32 ||
+        t == data_type::float64) {
         return true;
     }
     else {
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/compute.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_block_iterator.hpp"
+
+namespace oneapi::dal::detail {
+
+/// Computes the kernel function of the x and y tables by the tiles of
+/// tile_row_count rows of x. Only one tile of x and one tile of the values
+/// exist at a time: the sink gets the index of the first row of the tile in x
+/// and the tile_row_count x y.get_row_count() table of the values, and shall
+/// copy or reduce the values before it returns.
+template <typename Descriptor, typename Sink>
+void compute_by_tiles(const Descriptor& desc,
+                      const table& x,
+                      const table& y,
+                      std::int64_t tile_row_count,
+                      Sink&& sink) {
+    using float_t = typename Descriptor::float_t;
+    row_block_iterator<float_t> tiles{ x, tile_row_count };
+    while (tiles.next()) {
+        const auto x_tile =
+            homogen_table::wrap(tiles.get_data(), tiles.get_row_count(), tiles.get_column_count());
+        sink(tiles.get_first_row(), dal::compute(desc, x_tile, y).get_values());
+    }
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+template <typename Descriptor, typename Sink>
+void compute_by_tiles(sycl::queue& queue,
+                      const Descriptor& desc,
+                      const table& x,
+                      const table& y,
+                      std::int64_t tile_row_count,
+                      Sink&& sink) {
+    using float_t = typename Descriptor::float_t;
+    row_block_iterator<float_t> tiles{ queue, x, tile_row_count, sycl::usm::alloc::device };
+    while (tiles.next()) {
+        const auto x_tile = homogen_table::wrap(queue,
+                                                tiles.get_data(),
+                                                tiles.get_row_count(),
+                                                tiles.get_column_count());
+        sink(tiles.get_first_row(), dal::compute(queue, desc, x_tile, y).get_values());
+    }
+}
+#endif
+
+} // namespace oneapi::dal::detail
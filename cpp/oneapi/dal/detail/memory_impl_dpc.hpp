@@ -16,10 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstring>
 
+#include "oneapi/dal/detail/allocator.hpp"
 #include "oneapi/dal/detail/common_dpc.hpp"
+#include "oneapi/dal/detail/memory_usage.hpp"
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/exceptions.hpp"
 
 namespace oneapi::dal::detail {
 #ifdef ONEAPI_DAL_DATA_PARALLEL
@@ -32,12 +36,15 @@ inline T* malloc(const data_parallel_policy& policy,
     auto device = queue.get_device();
     auto context = queue.get_context();
     // TODO: is not safe since sycl::memset accepts count as size_t
-    return sycl::malloc<T>(count, device, context, alloc);
+    T* pointer = sycl::malloc<T>(count, device, context, alloc);
+    track_allocation(pointer, count * sizeof(T));
+    return pointer;
 }
 
 template <typename T>
 inline void free(const data_parallel_policy& policy, T* pointer) {
     using mutable_t = std::remove_const_t<T>;
+    track_deallocation(pointer);
     sycl::free(const_cast<mutable_t*>(pointer), policy.get_queue());
 }
 
@@ -50,12 +57,96 @@ inline void memset(const data_parallel_policy& policy,
     event.wait();
 }
 
+/// The copies from the pageable host memory to USM starting from this size
+/// are pipelined through the pinned staging buffers
+constexpr std::int64_t pipelined_memcpy_min_size = std::int64_t(64) << 20;
+constexpr std::int64_t pipelined_memcpy_chunk_size = std::int64_t(8) << 20;
+
+/// Pair of pinned host buffers, the chunk is copied into one of them while the
+/// device transfers the previous chunk from the other one
+class pinned_staging_buffers {
+public:
+    pinned_staging_buffers(const sycl::context& context, std::int64_t size) : context_(context) {
+        for (auto& buffer : buffers_) {
+            buffer = sycl::malloc_host<char>(size, context_);
+        }
+    }
+
+    ~pinned_staging_buffers() {
+        for (auto& buffer : buffers_) {
+            if (buffer) {
+                sycl::free(buffer, context_);
+            }
+        }
+    }
+
+    pinned_staging_buffers(const pinned_staging_buffers&) = delete;
+    pinned_staging_buffers& operator=(const pinned_staging_buffers&) = delete;
+
+    bool is_allocated() const {
+        return buffers_[0] && buffers_[1];
+    }
+
+    char* get(std::int64_t index) const {
+        return buffers_[index % 2];
+    }
+
+private:
+    sycl::context context_;
+    char* buffers_[2] = { nullptr, nullptr };
+};
+
+/// The pageable memory is not visible to the device, so the driver stages it
+/// internally and the transfer does not overlap with the host copy. Here the
+/// host copy of the chunk overlaps with the transfer of the previous one.
+inline void memcpy_pipelined(sycl::queue& queue, void* dest, const void* src, std::int64_t size) {
+    const std::int64_t chunk_size = std::min(size, pipelined_memcpy_chunk_size);
+    const pinned_staging_buffers staging{ queue.get_context(), chunk_size };
+    if (!staging.is_allocated()) {
+        queue.memcpy(dest, src, size).wait();
+        return;
+    }
+
+    auto dest_bytes = static_cast<char*>(dest);
+    auto src_bytes = static_cast<const char*>(src);
+    sycl::event events[2];
+    try {
+        for (std::int64_t offset = 0, chunk = 0; offset < size; offset += chunk_size, chunk++) {
+            const std::int64_t count = std::min(chunk_size, size - offset);
+            auto& event = events[chunk % 2];
+
+            // The staging buffer is reused once its previous transfer completes
+            event.wait();
+            std::memcpy(staging.get(chunk), src_bytes + offset, count);
+            event = queue.memcpy(dest_bytes + offset, staging.get(chunk), count);
+        }
+        events[0].wait_and_throw();
+        events[1].wait_and_throw();
+    }
+    catch (...) {
+        // The staging buffers are not released while the transfers use them
+        events[0].wait();
+        events[1].wait();
+        throw;
+    }
+}
+
 inline void memcpy(const data_parallel_policy& policy,
                    void* dest,
                    const void* src,
                    std::int64_t size) {
     // TODO: is not safe since queue.memcpy accepts size as size_t
-    auto event = policy.get_queue().memcpy(dest, src, size);
+    auto& queue = policy.get_queue();
+    if (size >= pipelined_memcpy_min_size) {
+        const auto context = queue.get_context();
+        const bool is_pageable_src = sycl::get_pointer_type(src, context) == sycl::usm::alloc::unknown;
+        const bool is_usm_dest = sycl::get_pointer_type(dest, context) != sycl::usm::alloc::unknown;
+        if (is_pageable_src && is_usm_dest) {
+            memcpy_pipelined(queue, dest, src, size);
+            return;
+        }
+    }
+    auto event = queue.memcpy(dest, src, size);
     event.wait();
 }
 
@@ -78,13 +169,28 @@ public:
     data_parallel_allocator(const data_parallel_policy& policy,
                             sycl::usm::alloc kind = sycl::usm::alloc::shared)
             : policy_(policy),
-              kind_(kind) {}
+              kind_(kind),
+              allocator_(get_current_usm_allocator()) {}
 
     T* allocate(std::int64_t n) const {
+        if (allocator_) {
+            T* pointer =
+                static_cast<T*>(allocator_->allocate(policy_.get_queue(), n * sizeof(T), kind_));
+            if (pointer == nullptr) {
+                throw device_bad_alloc();
+            }
+            track_allocation(pointer, n * sizeof(T));
+            return pointer;
+        }
         return malloc<T>(policy_, n, kind_);
     }
 
     void deallocate(T* p, std::int64_t n) const {
+        if (allocator_) {
+            track_deallocation(p);
+            allocator_->deallocate(policy_.get_queue(), p, n * sizeof(T), kind_);
+            return;
+        }
         return free(policy_, p);
     }
 
@@ -95,6 +201,7 @@ public:
 private:
     data_parallel_policy policy_;
     sycl::usm::alloc kind_;
+    std::shared_ptr<usm_allocator_iface> allocator_;
 };
 
 #endif
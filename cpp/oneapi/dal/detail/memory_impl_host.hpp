@@ -17,19 +17,26 @@
 #pragma once
 
 #include <cstring>
+#include <type_traits>
 
+#include "oneapi/dal/detail/allocator.hpp"
 #include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/memory_usage.hpp"
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/exceptions.hpp"
 
 namespace oneapi::dal::detail {
 
 template <typename T>
 inline T* malloc(const default_host_policy&, std::int64_t count) {
-    return new T[count];
+    T* pointer = new T[count];
+    track_allocation(pointer, count * sizeof(T));
+    return pointer;
 }
 
 template <typename T>
 inline void free(const default_host_policy&, T* pointer) {
+    track_deallocation(pointer);
     delete[] pointer;
 }
 
@@ -53,15 +60,39 @@ inline void fill(const default_host_policy&, T* dest, std::int64_t count, const
     }
 }
 
+/// Allocates the memory from the current allocator of the thread if there is
+/// one, the copies of the allocator return the memory to the same allocator
 template <typename T>
 class host_allocator {
 public:
+    host_allocator() {
+        if constexpr (std::is_trivial_v<T>) {
+            allocator_ = get_current_allocator();
+        }
+    }
+
     T* allocate(std::int64_t n) const {
+        if (allocator_) {
+            T* pointer = static_cast<T*>(allocator_->allocate(n * sizeof(T)));
+            if (pointer == nullptr) {
+                throw host_bad_alloc();
+            }
+            track_allocation(pointer, n * sizeof(T));
+            return pointer;
+        }
         return malloc<T>(default_host_policy{}, n);
     }
     void deallocate(T* p, std::int64_t n) const {
+        if (allocator_) {
+            track_deallocation(p);
+            allocator_->deallocate(p, n * sizeof(T));
+            return;
+        }
         return free(default_host_policy{}, p);
     }
+
+private:
+    std::shared_ptr<allocator_iface> allocator_;
 };
 
 } // namespace oneapi::dal::detail
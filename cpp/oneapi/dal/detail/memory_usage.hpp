@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::detail {
+/// Statistics of the memory allocated by the library while the memory
+/// tracking is enabled. The host memory of DAAL kernels and the host and USM
+/// memory of oneDAL arrays are accounted.
+struct memory_usage {
+    /// The size of the tracked blocks that are not freed yet
+    std::int64_t current_bytes = 0;
+
+    /// The maximal value of `current_bytes` since the last reset of the peak
+    std::int64_t peak_bytes = 0;
+
+    /// The number of tracked allocations since the last reset of the peak
+    std::int64_t allocation_count = 0;
+};
+
+/// Enables or disables the memory tracking. The blocks allocated while the
+/// tracking is enabled are accounted until they are freed.
+ONEAPI_DAL_EXPORT void enable_memory_tracking(bool enable = true);
+
+/// Returns the statistics collected over all the threads and all the
+/// algorithms computed in parallel
+ONEAPI_DAL_EXPORT memory_usage get_memory_usage();
+
+/// Sets the peak to the current size of the tracked memory. The peak after
+/// the following train, infer or compute call is its high-water mark.
+ONEAPI_DAL_EXPORT void reset_memory_peak();
+
+ONEAPI_DAL_EXPORT void track_allocation(const void* ptr, std::int64_t size);
+ONEAPI_DAL_EXPORT void track_deallocation(const void* ptr);
+} // namespace oneapi::dal::detail
@@ -16,12 +16,17 @@
 
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/exceptions.hpp"
 
 namespace oneapi::dal::detail {
 
 class host_policy_impl : public base {
 public:
     cpu_extension cpu_extensions_mask = backend::detect_top_cpu_extension();
+    std::int64_t max_concurrency = 0;
+    std::int64_t numa_node = -1;
+    task_arena_executor executor;
+    std::shared_ptr<allocator_iface> allocator;
 };
 
 host_policy::host_policy() : impl_(new host_policy_impl()) {}
@@ -30,13 +35,97 @@ void host_policy::set_enabled_cpu_extensions_impl(const cpu_extension& extension
     impl_->cpu_extensions_mask = extensions;
 }
 
+void host_policy::set_max_concurrency_impl(std::int64_t max_concurrency) {
+    if (max_concurrency < 0) {
+        throw invalid_argument("Negative max_concurrency");
+    }
+    impl_->max_concurrency = max_concurrency;
+}
+
+void host_policy::set_numa_node_impl(std::int64_t numa_node) noexcept {
+    impl_->numa_node = numa_node;
+}
+
+void host_policy::set_task_arena_executor_impl(const task_arena_executor& executor) {
+    impl_->executor = executor;
+}
+
 cpu_extension host_policy::get_enabled_cpu_extensions() const noexcept {
     return impl_->cpu_extensions_mask;
 }
 
+std::int64_t host_policy::get_max_concurrency() const noexcept {
+    return impl_->max_concurrency;
+}
+
+std::int64_t host_policy::get_numa_node() const noexcept {
+    return impl_->numa_node;
+}
+
+const task_arena_executor& host_policy::get_task_arena_executor() const noexcept {
+    return impl_->executor;
+}
+
+void host_policy::set_allocator_impl(const std::shared_ptr<allocator_iface>& allocator) noexcept {
+    impl_->allocator = allocator;
+}
+
+const std::shared_ptr<allocator_iface>& host_policy::get_allocator() const noexcept {
+    return impl_->allocator;
+}
+
+bool host_policy::has_threading_constraints() const noexcept {
+    return impl_->executor || impl_->max_concurrency > 0 || impl_->numa_node >= 0;
+}
+
 #ifdef ONEAPI_DAL_DATA_PARALLEL
+class data_parallel_policy_impl : public base {
+public:
+    std::vector<sycl::queue> queues;
+    std::shared_ptr<usm_allocator_iface> allocator;
+};
+
+const sycl::queue& data_parallel_policy::get_primary_queue(const std::vector<sycl::queue>& queues) {
+    if (queues.empty()) {
+        throw invalid_argument("Empty list of queues");
+    }
+    return queues.front();
+}
+
 void data_parallel_policy::init_impl(const sycl::queue& queue) {
-    this->impl_ = nullptr; // reserved for future use
+    this->impl_.reset(new data_parallel_policy_impl());
+    impl_->queues.push_back(queue);
+}
+
+void data_parallel_policy::init_impl(const std::vector<sycl::queue>& queues) {
+    this->impl_.reset(new data_parallel_policy_impl());
+    impl_->queues = queues;
+}
+
+const std::vector<sycl::queue>& data_parallel_policy::get_queues() const noexcept {
+    return impl_->queues;
+}
+
+std::int64_t data_parallel_policy::get_device_count() const noexcept {
+    return static_cast<std::int64_t>(impl_->queues.size());
+}
+
+data_parallel_policy data_parallel_policy::get_device_policy(std::int64_t device_index) const {
+    if (device_index < 0 || device_index >= get_device_count()) {
+        throw out_of_range("Device index is out of range");
+    }
+    data_parallel_policy policy{ impl_->queues[device_index] };
+    policy.set_allocator(impl_->allocator);
+    return policy;
+}
+
+void data_parallel_policy::set_allocator_impl(
+    const std::shared_ptr<usm_allocator_iface>& allocator) noexcept {
+    impl_->allocator = allocator;
+}
+
+const std::shared_ptr<usm_allocator_iface>& data_parallel_policy::get_allocator() const noexcept {
+    return impl_->allocator;
 }
 #endif
 
@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <functional>
 #include <type_traits>
+#include <vector>
 #ifdef ONEAPI_DAL_DATA_PARALLEL
 #include <CL/sycl.hpp>
 #endif
 
+#include "oneapi/dal/detail/allocator.hpp"
 #include "oneapi/dal/detail/common.hpp"
 
 namespace oneapi::dal::detail {
@@ -35,24 +38,80 @@ enum class cpu_extension : uint64_t {
     sse42 = 1U << 2,
     avx = 1U << 3,
     avx2 = 1U << 4,
-    avx512 = 1U << 5
+    avx512 = 1U << 5,
+    /// The features beyond the instruction set of avx512, the kernels of avx512
+    /// check them at run time to choose the bfloat16 computations
+    avx512_vnni = 1U << 6,
+    avx512_bf16 = 1U << 7,
+    amx_bf16 = 1U << 8
 };
 
 class ONEAPI_DAL_EXPORT default_host_policy {};
 
+/// Runs the function in the task arena, e.g. in the user's ``tbb::task_arena``
+using task_arena_executor = std::function<void(const std::function<void()>&)>;
+
 class ONEAPI_DAL_EXPORT host_policy : public base {
 public:
     host_policy();
 
     cpu_extension get_enabled_cpu_extensions() const noexcept;
 
+    /// The maximal number of threads the computations run on, zero means the
+    /// threads of the global scheduler
+    std::int64_t get_max_concurrency() const noexcept;
+
+    /// The index of the NUMA node the threads are bound to, negative value
+    /// means no binding
+    std::int64_t get_numa_node() const noexcept;
+
+    const task_arena_executor& get_task_arena_executor() const noexcept;
+
+    /// The allocator of the result tables and the internal buffers, null
+    /// means the default allocator of the library
+    const std::shared_ptr<allocator_iface>& get_allocator() const noexcept;
+
     auto& set_enabled_cpu_extensions(const cpu_extension& extensions) {
         set_enabled_cpu_extensions_impl(extensions);
         return *this;
     }
 
+    auto& set_max_concurrency(std::int64_t max_concurrency) {
+        set_max_concurrency_impl(max_concurrency);
+        return *this;
+    }
+
+    auto& set_numa_node(std::int64_t numa_node) {
+        set_numa_node_impl(numa_node);
+        return *this;
+    }
+
+    /// Runs the computations in the given arena, e.g. in ``tbb::task_arena``.
+    /// The arena must outlive the policy. The arena takes precedence over the
+    /// max_concurrency and numa_node constraints.
+    template <typename TaskArena>
+    auto& set_task_arena(TaskArena& arena) {
+        set_task_arena_executor_impl([&arena](const std::function<void()>& func) {
+            arena.execute(func);
+        });
+        return *this;
+    }
+
+    auto& set_allocator(const std::shared_ptr<allocator_iface>& allocator) {
+        set_allocator_impl(allocator);
+        return *this;
+    }
+
+    /// Checks that the computations run in the constrained arena rather than
+    /// in the global scheduler
+    bool has_threading_constraints() const noexcept;
+
 private:
     void set_enabled_cpu_extensions_impl(const cpu_extension& extensions) noexcept;
+    void set_max_concurrency_impl(std::int64_t max_concurrency);
+    void set_numa_node_impl(std::int64_t numa_node) noexcept;
+    void set_task_arena_executor_impl(const task_arena_executor& executor);
+    void set_allocator_impl(const std::shared_ptr<allocator_iface>& allocator) noexcept;
 
     pimpl<detail::host_policy_impl> impl_;
 };
@@ -65,12 +124,44 @@ public:
         init_impl(queue);
     }
 
+    /// Runs the computations on the devices of all queues. The rows of the
+    /// input tables are split between the devices by the algorithms which
+    /// support it, the others run on the first queue. The queues are expected
+    /// to share the SYCL context, so the USM data of the model is accessible
+    /// on all devices.
+    explicit data_parallel_policy(const std::vector<sycl::queue>& queues)
+            : queue_(get_primary_queue(queues)) {
+        init_impl(queues);
+    }
+
+    /// The first queue of the policy
     sycl::queue& get_queue() const noexcept {
         return queue_;
     }
 
+    const std::vector<sycl::queue>& get_queues() const noexcept;
+
+    std::int64_t get_device_count() const noexcept;
+
+    /// The policy of the single device with the given index, it shares the
+    /// allocator of this policy
+    data_parallel_policy get_device_policy(std::int64_t device_index) const;
+
+    /// The allocator of the USM memory of the result tables and the internal
+    /// buffers, null means the USM allocation on the queue
+    const std::shared_ptr<usm_allocator_iface>& get_allocator() const noexcept;
+
+    auto& set_allocator(const std::shared_ptr<usm_allocator_iface>& allocator) {
+        set_allocator_impl(allocator);
+        return *this;
+    }
+
 private:
+    static const sycl::queue& get_primary_queue(const std::vector<sycl::queue>& queues);
+
     void init_impl(const sycl::queue& queue);
+    void init_impl(const std::vector<sycl::queue>& queues);
+    void set_allocator_impl(const std::shared_ptr<usm_allocator_iface>& allocator) noexcept;
 
 private:
     mutable sycl::queue queue_;
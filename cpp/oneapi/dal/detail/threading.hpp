@@ -27,9 +27,55 @@ ONEAPI_DAL_EXPORT void _daal_threader_for_oneapi(int n,
                                                  int threads_request,
                                                  const void *a,
                                                  oneapi::dal::preview::functype func);
+ONEAPI_DAL_EXPORT void _daal_threader_for_cost_oneapi(int n,
+                                                      int threads_request,
+                                                      std::size_t iteration_cost,
+                                                      const void *a,
+                                                      oneapi::dal::preview::functype func);
+ONEAPI_DAL_EXPORT int _daal_threader_get_max_threads_oneapi();
+ONEAPI_DAL_EXPORT void _daal_first_touch_numa_oneapi(void *dst, const void *src, std::int64_t size);
 }
 
+namespace oneapi::dal::detail {
+/// Copies the source into the large host buffer, or zero-initializes the
+/// buffer if the source is null, on the threads of all the NUMA nodes. The
+/// pages are placed on the nodes whose threads process the corresponding rows
+/// in the NUMA-partitioned DAAL loops. The small buffers and the buffers on
+/// the single-node machines are copied as is and not initialized.
+inline void first_touch_numa(void *dst, const void *src, std::int64_t size) {
+    _daal_first_touch_numa_oneapi(dst, src, size);
+}
+
+template <typename F>
+inline void threader_cost_func(int i, const void *a) {
+    const F &lambda = *static_cast<const F *>(a);
+    lambda(i);
+}
+
+/// Runs the loop in parallel like threader_for, iteration_cost is the estimate
+/// of the number of the scalar operations of one iteration. The loop runs
+/// serially if its whole work, n * iteration_cost, is below the cutoff of
+/// daal::threader_for with the iteration cost.
+template <typename F>
+inline void threader_for_cost(std::int64_t n,
+                              std::int64_t threads_request,
+                              std::size_t iteration_cost,
+                              const F &lambda) {
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_cost_oneapi((int)n,
+                                   (int)threads_request,
+                                   iteration_cost,
+                                   a,
+                                   threader_cost_func<F>);
+}
+} // namespace oneapi::dal::detail
+
 namespace oneapi::dal::preview::load_graph::detail {
+inline int threader_get_max_threads() {
+    return _daal_threader_get_max_threads_oneapi();
+}
+
 template <typename F>
 inline void threader_func(int i, const void *a) {
     const F &lambda = *static_cast<const F *>(a);
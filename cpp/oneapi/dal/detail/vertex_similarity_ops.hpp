@@ -24,20 +24,30 @@ namespace detail {
 template <typename Descriptor, typename Graph, typename Tag>
 struct vertex_similarity_ops;
 
-template <typename Descriptor, typename Head, typename... Tail>
-auto vertex_similarity_dispatch_by_input(const Descriptor &desc, Head &&head, Tail &&... tail) {
+template <typename Policy, typename Descriptor, typename Head, typename... Tail>
+auto vertex_similarity_dispatch_by_input(const Policy &policy,
+                                         const Descriptor &desc,
+                                         Head &&head,
+                                         Tail &&... tail) {
     using tag_t = typename Descriptor::tag_t;
     using ops_t = vertex_similarity_ops<Descriptor, std::decay_t<Head>, tag_t>;
     using input_t = typename ops_t::input_t;
 
     auto input = input_t{ std::forward<Head>(head), std::forward<Tail>(tail)... };
-    return ops_t()(oneapi::dal::detail::host_policy{}, desc, input);
+    return ops_t()(policy, desc, input);
 }
 
 template <typename Head, typename... Tail>
 auto vertex_similarity_dispatch(Head &&head, Tail &&... tail) {
-    return vertex_similarity_dispatch_by_input(std::forward<Head>(head),
-                                               std::forward<Tail>(tail)...);
+    if constexpr (oneapi::dal::detail::is_execution_policy_v<std::decay_t<Head>>) {
+        return vertex_similarity_dispatch_by_input(std::forward<Head>(head),
+                                                   std::forward<Tail>(tail)...);
+    }
+    else {
+        return vertex_similarity_dispatch_by_input(oneapi::dal::detail::host_policy{},
+                                                   std::forward<Head>(head),
+                                                   std::forward<Tail>(tail)...);
+    }
 }
 
 } // namespace detail
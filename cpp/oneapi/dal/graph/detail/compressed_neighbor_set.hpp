@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "oneapi/dal/graph/detail/graph_container.hpp"
+
+namespace oneapi::dal::preview::detail {
+
+/// Adjacency lists of the graph compressed with the Stream VByte codec. The
+/// sorted list of neighbors is replaced by the differences of the consecutive
+/// neighbors. The differences are stored in 1 to 4 bytes each, the lengths of
+/// every 4 differences are packed into one control byte. The control bytes of
+/// the list are followed by the data bytes of the list, so that 4 differences
+/// are decoded at once with a byte shuffle.
+///
+/// @tparam IndexType  Type of vertex indices
+template <typename IndexType = std::int32_t>
+class compressed_neighbor_set {
+public:
+    using vertex_type = IndexType;
+
+    /// The number of bytes after the end of the data, which allows the decoders
+    /// to load 16 bytes at once from any position of the data
+    static constexpr std::int64_t padding_size = 16;
+
+    bool empty() const {
+        return _offsets.empty();
+    }
+
+    /// The size of the compressed adjacency lists in bytes
+    std::int64_t get_size_in_bytes() const {
+        return static_cast<std::int64_t>(_data.size() + _offsets.size() * sizeof(std::int64_t));
+    }
+
+    /// The compressed adjacency list of the vertex
+    const std::uint8_t *get_list(vertex_type vertex) const {
+        return _data.data() + _offsets[vertex];
+    }
+
+    /// The number of bytes in the compressed list of count neighbors
+    static std::int64_t get_encoded_size(const vertex_type *neighbors, std::int64_t count) {
+        std::int64_t size = (count + 3) / 4;
+        std::uint32_t previous = 0;
+        for (std::int64_t i = 0; i < count; ++i) {
+            const std::uint32_t value = static_cast<std::uint32_t>(neighbors[i]);
+            size += get_byte_count(value - previous);
+            previous = value;
+        }
+        return size;
+    }
+
+    /// Writes the compressed list of count sorted neighbors to the output
+    static void encode_list(const vertex_type *neighbors, std::int64_t count, std::uint8_t *out) {
+        std::uint8_t *control = out;
+        std::uint8_t *data = out + (count + 3) / 4;
+        std::memset(control, 0, static_cast<std::size_t>((count + 3) / 4));
+        std::uint32_t previous = 0;
+        for (std::int64_t i = 0; i < count; ++i) {
+            const std::uint32_t value = static_cast<std::uint32_t>(neighbors[i]);
+            const std::uint32_t delta = value - previous;
+            const std::uint32_t byte_count = get_byte_count(delta);
+            control[i >> 2] |= static_cast<std::uint8_t>((byte_count - 1) << ((i & 3) * 2));
+            for (std::uint32_t b = 0; b < byte_count; ++b) {
+                *data++ = static_cast<std::uint8_t>(delta >> (8 * b));
+            }
+            previous = value;
+        }
+    }
+
+    /// Decodes the compressed list of count neighbors to the output
+    ///
+    /// @return The position in the compressed data after the decoded neighbors
+    static const std::uint8_t *decode_list(const std::uint8_t *in,
+                                           std::int64_t count,
+                                           vertex_type *out) {
+        return decode_tail(in, in + (count + 3) / 4, 0, count, 0, out);
+    }
+
+    /// Decodes the neighbors [begin, count) of the compressed list with the
+    /// control bytes at control and the data of the neighbor begin at data
+    static const std::uint8_t *decode_tail(const std::uint8_t *control,
+                                           const std::uint8_t *data,
+                                           std::int64_t begin,
+                                           std::int64_t count,
+                                           std::uint32_t previous,
+                                           vertex_type *out) {
+        for (std::int64_t i = begin; i < count; ++i) {
+            const std::uint32_t byte_count = ((control[i >> 2] >> ((i & 3) * 2)) & 3) + 1;
+            std::uint32_t delta = 0;
+            for (std::uint32_t b = 0; b < byte_count; ++b) {
+                delta |= std::uint32_t(data[b]) << (8 * b);
+            }
+            data += byte_count;
+            previous += delta;
+            out[i] = static_cast<vertex_type>(previous);
+        }
+        return data;
+    }
+
+    // compressed adjacency lists of all vertices followed by the padding
+    graph_container<std::uint8_t> _data;
+
+    // offsets of the compressed adjacency lists in the data, vertex_count + 1 elements
+    graph_container<std::int64_t> _offsets;
+
+private:
+    static std::uint32_t get_byte_count(std::uint32_t value) {
+        return (value < (1u << 8)) ? 1 : (value < (1u << 16)) ? 2 : (value < (1u << 24)) ? 3 : 4;
+    }
+};
+
+} // namespace oneapi::dal::preview::detail
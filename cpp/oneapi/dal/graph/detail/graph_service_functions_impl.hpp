@@ -37,4 +37,12 @@ template <typename Graph>
 ONEAPI_DAL_EXPORT auto get_vertex_neighbors_impl(const Graph &graph,
                                                  const vertex_type<Graph> &vertex) noexcept
     -> const_edge_range_type<Graph>;
+
+template <typename Graph>
+ONEAPI_DAL_EXPORT bool has_compressed_neighbors_impl(const Graph &graph) noexcept;
+
+template <typename Graph>
+ONEAPI_DAL_EXPORT auto get_original_vertex_impl(const Graph &graph,
+                                                const vertex_type<Graph> &vertex) noexcept
+    -> vertex_type<Graph>;
 } // namespace oneapi::dal::preview::detail
@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/graph/detail/compressed_neighbor_set.hpp"
 #include "oneapi/dal/graph/detail/graph_container.hpp"
 
 namespace oneapi::dal::preview::detail {
@@ -75,6 +76,12 @@ public:
     vertex_set _degrees;
     edge_set _edge_offsets;
 
+    // original indices of the vertices if the vertices were reordered, empty otherwise
+    vertex_set _vertex_permutation;
+
+    // compressed adjacency lists, _vertex_neighbors is empty if they are not empty
+    compressed_neighbor_set<IndexType> _compressed_neighbors;
+
     vertex_user_value_set _vertex_value;
     edge_user_value_set _edge_value;
 
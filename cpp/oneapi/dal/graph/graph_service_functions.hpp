@@ -83,7 +83,29 @@ constexpr auto get_vertex_neighbors(const Graph &graph, vertex_type<Graph> verte
     if (vertex < 0 || (vertex_size_type<Graph>)vertex >= detail::get_vertex_count_impl(graph)) {
         throw out_of_range("Vertex index should be in [0, vertex_count)");
     }
+    if (detail::has_compressed_neighbors_impl(graph)) {
+        throw invalid_argument("Neighbors of the compressed graph cannot be accessed as a range");
+    }
     return detail::get_vertex_neighbors_impl(graph, vertex);
 }
 
+/// Returns the index of the vertex in the source data of the graph. The indices
+/// differ if the vertices were reordered at the graph loading.
+///
+/// @tparam Graph  Type of the graph
+///
+/// @param [in]   graph  Input graph object
+///
+/// @param [in]   vertex Identifier of the vertex
+///
+/// @return The original index of the vertex
+template <typename Graph>
+constexpr auto get_original_vertex(const Graph &graph, vertex_type<Graph> vertex)
+    -> vertex_type<Graph> {
+    if (vertex < 0 || (vertex_size_type<Graph>)vertex >= detail::get_vertex_count_impl(graph)) {
+        throw out_of_range("Vertex index should be in [0, vertex_count)");
+    }
+    return detail::get_original_vertex_impl(graph, vertex);
+}
+
 } // namespace oneapi::dal::preview
@@ -48,6 +48,8 @@ undirected_adjacency_array_graph<VertexValue, EdgeValue, GraphValue, IndexType,
     impl_->_vertex_neighbors = layout->_vertex_neighbors;
     impl_->_edge_offsets = layout->_edge_offsets;
     impl_->_degrees = layout->_degrees;
+    impl_->_vertex_permutation = layout->_vertex_permutation;
+    impl_->_compressed_neighbors = layout->_compressed_neighbors;
 
     impl_->_vertex_value = layout->_vertex_value;
     impl_->_edge_value = layout->_edge_value;
@@ -72,6 +74,8 @@ undirected_adjacency_array_graph<VertexValue, EdgeValue, GraphValue, IndexType,
     impl_->_vertex_neighbors = std::move(layout->_vertex_neighbors);
     impl_->_edge_offsets = std::move(layout->_edge_offsets);
     impl_->_degrees = std::move(layout->_degrees);
+    impl_->_vertex_permutation = std::move(layout->_vertex_permutation);
+    impl_->_compressed_neighbors = std::move(layout->_compressed_neighbors);
 
     impl_->_vertex_value = std::move(layout->_vertex_value);
     impl_->_edge_value = std::move(layout->_edge_value);
@@ -94,6 +98,8 @@ undirected_adjacency_array_graph<VertexValue, EdgeValue, GraphValue, IndexType,
         impl_->_vertex_neighbors = layout->_vertex_neighbors;
         impl_->_edge_offsets = layout->_edge_offsets;
         impl_->_degrees = layout->_degrees;
+        impl_->_vertex_permutation = layout->_vertex_permutation;
+        impl_->_compressed_neighbors = layout->_compressed_neighbors;
 
         impl_->_vertex_value = layout->_vertex_value;
         impl_->_edge_value = layout->_edge_value;
@@ -121,6 +127,8 @@ undirected_adjacency_array_graph<VertexValue, EdgeValue, GraphValue, IndexType,
         impl_->_vertex_neighbors = std::move(layout->_vertex_neighbors);
         impl_->_edge_offsets = std::move(layout->_edge_offsets);
         impl_->_degrees = std::move(layout->_degrees);
+        impl_->_vertex_permutation = std::move(layout->_vertex_permutation);
+        impl_->_compressed_neighbors = std::move(layout->_compressed_neighbors);
 
         impl_->_vertex_value = std::move(layout->_vertex_value);
         impl_->_edge_value = std::move(layout->_edge_value);
@@ -193,5 +201,25 @@ ONEAPI_DAL_EXPORT auto get_vertex_neighbors_impl(const Graph &graph,
 template ONEAPI_DAL_EXPORT auto get_vertex_neighbors_impl(
     const graph_default &graph,
     const vertex_type<graph_default> &vertex) noexcept -> const_edge_range_type<graph_default>;
+
+template <typename Graph>
+ONEAPI_DAL_EXPORT bool has_compressed_neighbors_impl(const Graph &graph) noexcept {
+    const auto &layout = detail::get_impl(graph);
+    return !layout->_compressed_neighbors.empty();
+}
+
+template ONEAPI_DAL_EXPORT bool has_compressed_neighbors_impl(const graph_default &graph) noexcept;
+
+template <typename Graph>
+ONEAPI_DAL_EXPORT auto get_original_vertex_impl(const Graph &graph,
+                                                const vertex_type<Graph> &vertex) noexcept
+    -> vertex_type<Graph> {
+    const auto &layout = detail::get_impl(graph);
+    return layout->_vertex_permutation.empty() ? vertex : layout->_vertex_permutation[vertex];
+}
+
+template ONEAPI_DAL_EXPORT auto get_original_vertex_impl(
+    const graph_default &graph,
+    const vertex_type<graph_default> &vertex) noexcept -> vertex_type<graph_default>;
 } // namespace detail
 } // namespace oneapi::dal::preview
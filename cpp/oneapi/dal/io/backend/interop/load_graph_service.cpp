@@ -14,12 +14,226 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/io/detail/load_graph_service.hpp"
+#include "oneapi/dal/io/detail/mapped_file.hpp"
 #include "src/externals/service_service.h"
+#include "src/threading/threading.h"
 
 namespace oneapi::dal::preview::load_graph::detail {
 
 ONEAPI_DAL_EXPORT int daal_string_to_int(const char* nptr, char** endptr) {
     return daal::internal::Service<>::serv_string_to_int(nptr, endptr);
 }
+
+namespace {
+
+inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Checks that all 8 bytes of the word are ASCII digits
+inline bool is_eight_digits(std::uint64_t word) {
+    return ((word & 0xF0F0F0F0F0F0F0F0) |
+            (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+// Converts 8 ASCII digits packed into the little-endian word with three
+// multiplications instead of 8 dependent multiply-add steps
+inline std::uint32_t parse_eight_digits(std::uint64_t word) {
+    word = ((word & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+    word = ((word & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+    return static_cast<std::uint32_t>(((word & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+
+enum class parse_status { ok, negative_index, malformed_line, index_overflow };
+
+inline bool is_separator(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == ',';
+}
+
+/// Parses the non-negative vertex index starting at the first digit. Parsing
+/// stops as soon as the value exceeds the range of std::int32_t.
+inline const char* parse_vertex(const char* p,
+                                const char* end,
+                                std::int32_t& value,
+                                parse_status& status) {
+    constexpr std::uint64_t max_value = std::numeric_limits<std::int32_t>::max();
+    std::uint64_t result = 0;
+    if (end - p >= 8) {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        if (is_eight_digits(word)) {
+            result = parse_eight_digits(word);
+            p += 8;
+        }
+    }
+    for (; p < end && is_digit(*p); ++p) {
+        result = result * 10 + static_cast<std::uint64_t>(*p - '0');
+        if (result > max_value) {
+            status = parse_status::index_overflow;
+            return end;
+        }
+    }
+    value = static_cast<std::int32_t>(result);
+    return p;
+}
+
+inline const char* skip_separators(const char* p, const char* end) {
+    for (; p < end && is_separator(*p); ++p) {
+    }
+    return p;
+}
+
+/// Checks that the vertex index starts at the pointer. The sign of negative
+/// indices and any other text are reported via the status.
+inline bool starts_vertex(const char* p, const char* end, parse_status& status) {
+    if (p < end && is_digit(*p)) {
+        return true;
+    }
+    const bool is_negative = (p + 1 < end && *p == '-' && is_digit(*(p + 1)));
+    status = is_negative ? parse_status::negative_index : parse_status::malformed_line;
+    return false;
+}
+
+/// Parses the lines in the range [begin, end) into the edges. Every non-empty
+/// line starts with two vertex indices delimited by separators, the rest of
+/// the line after a separator is ignored.
+///
+/// @return The number of parsed edges
+std::int64_t parse_edges(const char* begin,
+                         const char* end,
+                         std::pair<std::int32_t, std::int32_t>* edges,
+                         parse_status& status) {
+    std::int64_t edge_count = 0;
+    const char* p = begin;
+    while (p < end && status == parse_status::ok) {
+        const char* line_end = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (line_end == nullptr) {
+            line_end = end;
+        }
+
+        p = skip_separators(p, line_end);
+        if (p < line_end) {
+            std::int32_t source = 0, destination = 0;
+            if (!starts_vertex(p, line_end, status)) {
+                break;
+            }
+            p = parse_vertex(p, line_end, source, status);
+            const char* next = skip_separators(p, line_end);
+            if (status != parse_status::ok) {
+                break;
+            }
+            if (next == p) {
+                status = parse_status::malformed_line;
+                break;
+            }
+            if (!starts_vertex(next, line_end, status)) {
+                break;
+            }
+            p = parse_vertex(next, line_end, destination, status);
+            if (status != parse_status::ok) {
+                break;
+            }
+            if (p < line_end && !is_separator(*p)) {
+                status = parse_status::malformed_line;
+                break;
+            }
+            edges[edge_count++] = std::make_pair(source, destination);
+        }
+        p = line_end + 1;
+    }
+    return edge_count;
+}
+
+} // namespace
+
+ONEAPI_DAL_EXPORT edge_list<std::int32_t> load_edge_list(const std::string& name) {
+    using int_t = std::int32_t;
+
+    const dal::detail::mapped_file file(name);
+    const char* data = file.get_data();
+    const std::size_t size = file.get_size();
+
+    edge_list<int_t> elist;
+    if (size == 0) {
+        return elist;
+    }
+
+    // Chunks must be large enough to amortize the scheduling overhead
+    constexpr std::size_t min_chunk_size = 1 << 20;
+    const std::size_t thread_count = daal::threader_get_threads_number();
+    const std::size_t chunk_count =
+        std::max<std::size_t>(1, std::min(4 * thread_count, size / min_chunk_size));
+
+    // Chunk boundaries are moved to the beginning of the next line
+    std::vector<const char*> bounds(chunk_count + 1);
+    bounds[0] = data;
+    bounds[chunk_count] = data + size;
+    for (std::size_t i = 1; i < chunk_count; ++i) {
+        const char* bound = std::max(bounds[i - 1], data + i * (size / chunk_count));
+        const char* line_end =
+            static_cast<const char*>(std::memchr(bound, '\n', data + size - bound));
+        bounds[i] = line_end ? line_end + 1 : data + size;
+    }
+
+    // The number of lines in the chunk is the upper bound of its edge count
+    std::vector<std::int64_t> line_counts(chunk_count);
+    daal::threader_for(chunk_count, chunk_count, [&](int i) {
+        const char* chunk_end = bounds[i + 1];
+        std::int64_t lines = 0;
+        for (const char* p = bounds[i]; p < chunk_end; ++lines) {
+            const char* line_end = static_cast<const char*>(std::memchr(p, '\n', chunk_end - p));
+            p = line_end ? line_end + 1 : chunk_end;
+        }
+        line_counts[i] = lines;
+    });
+
+    std::vector<std::int64_t> chunk_offsets(chunk_count + 1, 0);
+    for (std::size_t i = 0; i < chunk_count; ++i) {
+        chunk_offsets[i + 1] = chunk_offsets[i] + line_counts[i];
+    }
+
+    // Every chunk is parsed directly into its own range of the resulting list
+    elist.resize(chunk_offsets[chunk_count]);
+    auto edges = elist.data();
+    std::vector<std::int64_t> edge_counts(chunk_count);
+    std::vector<parse_status> statuses(chunk_count, parse_status::ok);
+    daal::threader_for(chunk_count, chunk_count, [&](int i) {
+        edge_counts[i] =
+            parse_edges(bounds[i], bounds[i + 1], edges + chunk_offsets[i], statuses[i]);
+    });
+
+    for (const auto status : statuses) {
+        if (status == parse_status::negative_index) {
+            throw invalid_argument("Negative vertex index");
+        }
+        if (status == parse_status::index_overflow) {
+            throw invalid_argument("Vertex index exceeds the range of the vertex type");
+        }
+        if (status == parse_status::malformed_line) {
+            throw invalid_argument("The line of the edge list is not a pair of vertex indices");
+        }
+    }
+
+    // Close the gaps left by empty lines
+    std::int64_t edge_count = edge_counts[0];
+    for (std::size_t i = 1; i < chunk_count; ++i) {
+        if (edge_count != chunk_offsets[i]) {
+            std::copy(edges + chunk_offsets[i],
+                      edges + chunk_offsets[i] + edge_counts[i],
+                      edges + edge_count);
+        }
+        edge_count += edge_counts[i];
+    }
+    elist.resize(edge_count);
+
+    return elist;
+}
+
 } // namespace oneapi::dal::preview::load_graph::detail
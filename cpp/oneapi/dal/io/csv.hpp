@@ -16,4 +16,5 @@
 
 #pragma once
 
+#include "oneapi/dal/io/csv/chunk_reader.hpp"
 #include "oneapi/dal/io/csv/read.hpp"
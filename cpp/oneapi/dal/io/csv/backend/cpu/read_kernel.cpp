@@ -25,19 +25,19 @@
 
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
-#include "oneapi/dal/backend/interop/table_conversion.hpp"
 #include "oneapi/dal/io/csv/backend/cpu/read_kernel.hpp"
+#include "oneapi/dal/io/csv/backend/native_reader.hpp"
 #include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
 
 namespace oneapi::dal::csv::backend {
 
 namespace interop = dal::backend::interop;
 namespace daal_dm = daal::data_management;
 
-template <>
-table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
-                                         const data_source& ds,
-                                         const read_args<table>& args) const {
+template <typename T>
+static numeric_csv<T> read_with_daal_data_source(const data_source& ds,
+                                                 const read_args<table>& args) {
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
@@ -52,8 +52,39 @@ table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
     daal_data_source.loadDataBlock();
     interop::status_to_exception(daal_data_source.status());
 
-    return oneapi::dal::backend::interop::convert_from_daal_homogen_table<DAAL_DATA_TYPE>(
-        daal_data_source.getNumericTable());
+    auto nt = daal_data_source.getNumericTable();
+
+    daal_dm::BlockDescriptor<DAAL_DATA_TYPE> block;
+    const std::int64_t row_count = nt->getNumberOfRows();
+    const std::int64_t column_count = nt->getNumberOfColumns();
+
+    interop::status_to_exception(nt->getBlockOfRows(0, row_count, daal_dm::readOnly, block));
+    auto result = select_numeric_csv<T>(block.getBlockPtr(), row_count, column_count, args);
+    interop::status_to_exception(nt->releaseBlockOfRows(block));
+
+    return result;
+}
+
+template <typename T>
+static table read_table(const data_source& ds, const read_args<table>& args) {
+    numeric_csv<T> csv;
+    if (!read_numeric_csv(ds, args, csv)) {
+        csv = read_with_daal_data_source<T>(ds, args);
+    }
+    return dal::detail::homogen_table_builder{}
+        .reset(csv.data, csv.row_count, csv.column_count)
+        .build();
+}
+
+template <>
+table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
+                                         const data_source& ds,
+                                         const read_args<table>& args) const {
+    switch (args.get_data_type()) {
+        case data_type::float64: return read_table<double>(ds, args);
+        case data_type::int32: return read_table<std::int32_t>(ds, args);
+        default: return read_table<float>(ds, args);
+    }
 }
 
 } // namespace oneapi::dal::csv::backend
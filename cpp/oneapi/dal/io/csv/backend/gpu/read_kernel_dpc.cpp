@@ -25,9 +25,9 @@
 
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
-#include "oneapi/dal/backend/interop/table_conversion.hpp"
 #include "oneapi/dal/detail/memory.hpp"
 #include "oneapi/dal/io/csv/backend/gpu/read_kernel.hpp"
+#include "oneapi/dal/io/csv/backend/native_reader.hpp"
 #include "oneapi/dal/table/common.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
 
@@ -36,12 +36,9 @@ namespace oneapi::dal::csv::backend {
 namespace interop = dal::backend::interop;
 namespace daal_dm = daal::data_management;
 
-template <>
-table read_kernel_gpu<table>::operator()(const dal::backend::context_gpu& ctx,
-                                         const data_source& ds,
-                                         const read_args<table>& args) const {
-    auto& queue = ctx.get_queue();
-
+template <typename T>
+static numeric_csv<T> read_with_daal_data_source(const data_source& ds,
+                                                 const read_args<table>& args) {
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
@@ -63,17 +60,42 @@ table read_kernel_gpu<table>::operator()(const dal::backend::context_gpu& ctx,
     const std::int64_t column_count = nt->getNumberOfColumns();
 
     interop::status_to_exception(nt->getBlockOfRows(0, row_count, daal_dm::readOnly, block));
-    DAAL_DATA_TYPE* data = block.getBlockPtr();
+    auto result = select_numeric_csv<T>(block.getBlockPtr(), row_count, column_count, args);
+    interop::status_to_exception(nt->releaseBlockOfRows(block));
+
+    return result;
+}
 
-    auto arr = array<DAAL_DATA_TYPE>::empty(queue, row_count * column_count);
+template <typename T>
+static table read_table(sycl::queue& queue, const data_source& ds, const read_args<table>& args) {
+    numeric_csv<T> csv;
+    if (!read_numeric_csv(ds, args, csv)) {
+        csv = read_with_daal_data_source<T>(ds, args);
+    }
+
+    const std::int64_t element_count = csv.row_count * csv.column_count;
+    auto arr = array<T>::empty(queue, element_count);
     dal::detail::memcpy(queue,
                         arr.get_mutable_data(),
-                        data,
-                        sizeof(DAAL_DATA_TYPE) * row_count * column_count);
+                        csv.data.get_data(),
+                        sizeof(T) * element_count);
 
-    interop::status_to_exception(nt->releaseBlockOfRows(block));
+    return dal::detail::homogen_table_builder{}
+        .reset(arr, csv.row_count, csv.column_count)
+        .build();
+}
+
+template <>
+table read_kernel_gpu<table>::operator()(const dal::backend::context_gpu& ctx,
+                                         const data_source& ds,
+                                         const read_args<table>& args) const {
+    auto& queue = ctx.get_queue();
 
-    return dal::detail::homogen_table_builder{}.reset(arr, row_count, column_count).build();
+    switch (args.get_data_type()) {
+        case data_type::float64: return read_table<double>(queue, ds, args);
+        case data_type::int32: return read_table<std::int32_t>(queue, ds, args);
+        default: return read_table<float>(queue, ds, args);
+    }
 }
 
 } // namespace oneapi::dal::csv::backend
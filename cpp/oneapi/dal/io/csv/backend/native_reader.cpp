@@ -0,0 +1,608 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/csv/backend/native_reader.hpp"
+#include "oneapi/dal/io/detail/mapped_file.hpp"
+#include "src/threading/threading.h"
+
+namespace oneapi::dal::csv::backend {
+
+namespace {
+
+inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline bool is_space(char c) {
+    return c == ' ' || c == '\t';
+}
+
+// Checks that all 8 bytes of the word are ASCII digits
+inline bool is_eight_digits(std::uint64_t word) {
+    return ((word & 0xF0F0F0F0F0F0F0F0) |
+            (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+// Converts 8 ASCII digits packed into the little-endian word with three
+// multiplications instead of 8 dependent multiply-add steps
+inline std::uint32_t parse_eight_digits(std::uint64_t word) {
+    word = ((word & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+    word = ((word & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+    return static_cast<std::uint32_t>(((word & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+
+// Accumulates the digits of the range into the mantissa, 8 digits at a time
+// while the mantissa cannot overflow
+inline const char* parse_digits(const char* p,
+                                const char* end,
+                                std::uint64_t& mantissa,
+                                std::int64_t& digit_count) {
+    while (end - p >= 8 && digit_count <= 11) {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        if (!is_eight_digits(word)) {
+            break;
+        }
+        mantissa = mantissa * 100000000 + parse_eight_digits(word);
+        digit_count += 8;
+        p += 8;
+    }
+    for (; p < end && is_digit(*p); ++p, ++digit_count) {
+        mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+    }
+    return p;
+}
+
+template <typename Float>
+inline Float string_to_floating(const char* text) {
+    if constexpr (std::is_same_v<Float, float>) {
+        return std::strtof(text, nullptr);
+    }
+    else {
+        return std::strtod(text, nullptr);
+    }
+}
+
+template <typename Float>
+inline Float parse_floating_fallback(const char* begin, const char* end) {
+    constexpr std::size_t buffer_size = 64;
+    const std::size_t size = static_cast<std::size_t>(end - begin);
+    if (size < buffer_size) {
+        char buffer[buffer_size];
+        std::memcpy(buffer, begin, size);
+        buffer[size] = '\0';
+        return string_to_floating<Float>(buffer);
+    }
+    return string_to_floating<Float>(std::string(begin, end).c_str());
+}
+
+/// Parses the decimal number in the range [begin, end) the same way as
+/// std::strtof or std::strtod does. Numbers with at most 19 significant digits
+/// and small exponents take the fast path: the mantissa and the power of ten
+/// are both exact in double, so their product or quotient is correctly
+/// rounded. The rounding of that double to float matches the rounding of the
+/// exact value unless the double is the midpoint of two floats. The rest of
+/// the numbers, including special values, go to the standard functions.
+template <typename Float>
+inline Float parse_floating(const char* begin, const char* end) {
+    static constexpr double exact_powers_of_ten[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                                      1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                                      1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                                      1e18, 1e19, 1e20, 1e21, 1e22 };
+    constexpr std::int64_t max_exact_power = 22;
+    constexpr std::uint64_t max_exact_mantissa = std::uint64_t(1) << 53;
+
+    const char* p = begin;
+    while (p < end && is_space(*p)) {
+        ++p;
+    }
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    std::uint64_t mantissa = 0;
+    std::int64_t digit_count = 0;
+    p = parse_digits(p, end, mantissa, digit_count);
+    std::int64_t exponent = 0;
+    if (p < end && *p == '.') {
+        const std::int64_t integer_digit_count = digit_count;
+        p = parse_digits(p + 1, end, mantissa, digit_count);
+        exponent = integer_digit_count - digit_count;
+    }
+    if (digit_count == 0 || digit_count > 19) {
+        return parse_floating_fallback<Float>(begin, end);
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negative_exponent = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative_exponent = (*p == '-');
+            ++p;
+        }
+        if (p == end || !is_digit(*p)) {
+            return parse_floating_fallback<Float>(begin, end);
+        }
+        std::int64_t value = 0;
+        for (; p < end && is_digit(*p); ++p) {
+            value = std::min<std::int64_t>(value * 10 + (*p - '0'), 1 << 20);
+        }
+        exponent += negative_exponent ? -value : value;
+    }
+
+    // Anything but trailing spaces may change the meaning of the number, e.g.
+    // the hexadecimal prefix
+    while (p < end && is_space(*p)) {
+        ++p;
+    }
+    if (p != end || mantissa > max_exact_mantissa || exponent < -max_exact_power ||
+        exponent > max_exact_power) {
+        return parse_floating_fallback<Float>(begin, end);
+    }
+
+    double value = static_cast<double>(mantissa);
+    value = (exponent < 0) ? value / exact_powers_of_ten[-exponent]
+                           : value * exact_powers_of_ten[exponent];
+
+    if constexpr (std::is_same_v<Float, float>) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        constexpr std::uint64_t dropped_bits_mask = (std::uint64_t(1) << 29) - 1;
+        constexpr std::uint64_t midpoint_bits = std::uint64_t(1) << 28;
+        if ((bits & dropped_bits_mask) == midpoint_bits) {
+            return parse_floating_fallback<Float>(begin, end);
+        }
+    }
+
+    const Float result = static_cast<Float>(value);
+    return negative ? -result : result;
+}
+
+inline std::int32_t saturate_to_int32(double value) {
+    using limits = std::numeric_limits<std::int32_t>;
+    if (!(value == value)) {
+        return 0;
+    }
+    return static_cast<std::int32_t>(
+        std::max<double>(limits::min(), std::min<double>(limits::max(), value)));
+}
+
+/// Parses the integer in the range [begin, end). Fractional numbers are
+/// truncated and the values out of the range of int32_t are saturated.
+inline std::int32_t parse_integer(const char* begin, const char* end) {
+    const char* p = begin;
+    while (p < end && is_space(*p)) {
+        ++p;
+    }
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    std::uint64_t value = 0;
+    std::int64_t digit_count = 0;
+    p = parse_digits(p, end, value, digit_count);
+    while (p < end && is_space(*p)) {
+        ++p;
+    }
+    if (p != end || digit_count == 0 || digit_count > 18) {
+        return saturate_to_int32(parse_floating<double>(begin, end));
+    }
+    const double signed_value = static_cast<double>(value);
+    return saturate_to_int32(negative ? -signed_value : signed_value);
+}
+
+template <typename T>
+inline T parse_value(const char* begin, const char* end) {
+    if constexpr (std::is_same_v<T, std::int32_t>) {
+        return parse_integer(begin, end);
+    }
+    else {
+        return parse_floating<T>(begin, end);
+    }
+}
+
+template <typename T>
+inline T convert_value(float value) {
+    if constexpr (std::is_same_v<T, std::int32_t>) {
+        return saturate_to_int32(value);
+    }
+    else {
+        return static_cast<T>(value);
+    }
+}
+
+inline const char* find_line_end(const char* p, const char* end) {
+    const char* line_end = static_cast<const char*>(std::memchr(p, '\n', end - p));
+    return line_end ? line_end : end;
+}
+
+inline const char* next_line(const char* line_end, const char* end) {
+    return (line_end < end) ? line_end + 1 : end;
+}
+
+// Excludes the carriage returns from the end of the line
+inline const char* trim_line(const char* begin, const char* line_end) {
+    while (line_end > begin && line_end[-1] == '\r') {
+        --line_end;
+    }
+    return line_end;
+}
+
+inline const char* find_token_end(const char* p, const char* end, char delimiter) {
+    const char* token_end = static_cast<const char*>(std::memchr(p, delimiter, end - p));
+    return token_end ? token_end : end;
+}
+
+inline const char* next_token(const char* token_end, const char* end) {
+    return (token_end < end) ? token_end + 1 : end;
+}
+
+/// Counts the fields of the row as the DAAL tokenizer does: the empty field
+/// after the trailing delimiter is not counted
+std::int64_t count_columns(const char* begin, const char* end, char delimiter) {
+    std::int64_t column_count = 0;
+    for (const char* p = begin; p < end; ++column_count) {
+        p = next_token(find_token_end(p, end, delimiter), end);
+    }
+    return column_count;
+}
+
+/// Maps the fields of the file rows to the columns of the result
+struct column_selection {
+    /// Pairs of the field index and the result column sorted by field index
+    std::vector<std::pair<std::int64_t, std::int64_t>> fields;
+    std::int64_t column_count = 0;
+};
+
+column_selection make_column_selection(const read_args<table>& args,
+                                       std::int64_t file_column_count) {
+    column_selection selection;
+    const auto& indices = args.get_column_indices();
+    if (indices.get_count() == 0) {
+        selection.column_count = file_column_count;
+        for (std::int64_t j = 0; j < file_column_count; ++j) {
+            selection.fields.emplace_back(j, j);
+        }
+        return selection;
+    }
+
+    const std::int64_t* index_data = indices.get_data();
+    selection.column_count = indices.get_count();
+    for (std::int64_t j = 0; j < selection.column_count; ++j) {
+        if (index_data[j] >= file_column_count) {
+            throw out_of_range("Column index is greater than the number of columns");
+        }
+        selection.fields.emplace_back(index_data[j], j);
+    }
+    std::stable_sort(selection.fields.begin(), selection.fields.end());
+    return selection;
+}
+
+/// Checks that the selected fields of the row are numbers in terms of
+/// std::strtof as the DAAL data source does
+bool has_numeric_fields(const char* begin,
+                        const char* end,
+                        char delimiter,
+                        const column_selection& selection) {
+    const auto& fields = selection.fields;
+    std::size_t k = 0;
+    for (std::int64_t field = 0; k < fields.size(); ++field) {
+        const char* token_end = find_token_end(begin, end, delimiter);
+        if (fields[k].first == field) {
+            const std::string token(begin, token_end);
+            char* number_end = nullptr;
+            std::strtof(token.c_str(), &number_end);
+            if (number_end == token.c_str()) {
+                return false;
+            }
+            while (k < fields.size() && fields[k].first == field) {
+                ++k;
+            }
+        }
+        begin = next_token(token_end, end);
+    }
+    return true;
+}
+
+/// Converts the selected fields of the row. The fields that are not selected
+/// are only skipped, the rest of the row after the last selected field is not
+/// scanned at all.
+template <typename T>
+void parse_row(const char* begin,
+               const char* end,
+               char delimiter,
+               const column_selection& selection,
+               T* row) {
+    const auto& fields = selection.fields;
+    std::size_t k = 0;
+    for (std::int64_t field = 0; k < fields.size() && begin < end; ++field) {
+        const char* token_end = find_token_end(begin, end, delimiter);
+        if (fields[k].first == field) {
+            const T value = parse_value<T>(begin, token_end);
+            for (; k < fields.size() && fields[k].first == field; ++k) {
+                row[fields[k].second] = value;
+            }
+        }
+        begin = next_token(token_end, end);
+    }
+    for (; k < fields.size(); ++k) {
+        row[fields[k].second] = T(0);
+    }
+}
+
+// The range of the rows to read
+inline std::pair<std::int64_t, std::int64_t> get_row_range(const read_args<table>& args,
+                                                           std::int64_t row_count) {
+    const std::int64_t first = std::min(args.get_row_offset(), row_count);
+    const std::int64_t limit = args.get_row_limit();
+    const std::int64_t last = (limit < 0) ? row_count : first + std::min(limit, row_count - first);
+    return { first, last };
+}
+
+} // namespace
+
+template <typename T>
+bool read_numeric_csv(const data_source& ds,
+                      const read_args<table>& args,
+                      numeric_csv<T>& result) {
+    const dal::detail::mapped_file file(ds.get_file_name());
+    const char* data = file.get_data();
+    const char* data_end = data + file.get_size();
+    const char delimiter = ds.get_delimiter();
+
+    const char* begin = data;
+    if (ds.get_parse_header() && begin < data_end) {
+        begin = next_line(find_line_end(begin, data_end), data_end);
+    }
+
+    result = numeric_csv<T>{};
+    const char* first_row_end = trim_line(begin, find_line_end(begin, data_end));
+    if (first_row_end == begin) {
+        return false;
+    }
+
+    const auto selection =
+        make_column_selection(args, count_columns(begin, first_row_end, delimiter));
+    if (!has_numeric_fields(begin, first_row_end, delimiter, selection)) {
+        return false;
+    }
+
+    // Chunks must be large enough to amortize the scheduling overhead
+    constexpr std::size_t min_chunk_size = 1 << 20;
+    const std::size_t size = static_cast<std::size_t>(data_end - begin);
+    const std::size_t thread_count = daal::threader_get_threads_number();
+    const std::size_t chunk_count =
+        std::max<std::size_t>(1, std::min(4 * thread_count, size / min_chunk_size));
+
+    // Chunk boundaries are moved to the beginning of the next line
+    std::vector<const char*> bounds(chunk_count + 1);
+    bounds[0] = begin;
+    bounds[chunk_count] = data_end;
+    for (std::size_t i = 1; i < chunk_count; ++i) {
+        const char* bound = std::max(bounds[i - 1], begin + i * (size / chunk_count));
+        bounds[i] = next_line(find_line_end(bound, data_end), data_end);
+    }
+
+    // The lines of the chunk are counted up to the first empty one
+    std::vector<std::int64_t> line_counts(chunk_count);
+    std::vector<char> empty_line_flags(chunk_count, 0);
+    daal::threader_for(chunk_count, chunk_count, [&](int i) {
+        const char* chunk_end = bounds[i + 1];
+        std::int64_t lines = 0;
+        for (const char* p = bounds[i]; p < chunk_end; ++lines) {
+            const char* line_end = find_line_end(p, chunk_end);
+            if (trim_line(p, line_end) == p) {
+                empty_line_flags[i] = 1;
+                break;
+            }
+            p = next_line(line_end, chunk_end);
+        }
+        line_counts[i] = lines;
+    });
+
+    // The chunks after the first empty line contribute no rows
+    std::vector<std::int64_t> row_offsets(chunk_count + 1, 0);
+    bool has_ended = false;
+    for (std::size_t i = 0; i < chunk_count; ++i) {
+        row_offsets[i + 1] = row_offsets[i] + (has_ended ? 0 : line_counts[i]);
+        has_ended |= (empty_line_flags[i] != 0);
+    }
+    const auto row_range = get_row_range(args, row_offsets[chunk_count]);
+    const std::int64_t first_row = row_range.first;
+    const std::int64_t last_row = row_range.second;
+    const std::int64_t row_count = last_row - first_row;
+    const std::int64_t column_count = selection.column_count;
+
+    // Every chunk is parsed directly into its own range of the rows
+    auto values = array<T>::empty(row_count * column_count);
+    T* rows = values.get_mutable_data();
+    daal::threader_for(chunk_count, chunk_count, [&](int i) {
+        const std::int64_t chunk_first = std::max(row_offsets[i], first_row);
+        const std::int64_t chunk_last = std::min(row_offsets[i + 1], last_row);
+        const char* chunk_end = bounds[i + 1];
+        const char* p = bounds[i];
+        for (std::int64_t r = row_offsets[i]; r < chunk_last; ++r) {
+            const char* line_end = find_line_end(p, chunk_end);
+            if (r >= chunk_first) {
+                T* row = rows + (r - first_row) * column_count;
+                parse_row(p, trim_line(p, line_end), delimiter, selection, row);
+            }
+            p = next_line(line_end, chunk_end);
+        }
+    });
+
+    result.data = values;
+    result.row_count = row_count;
+    result.column_count = column_count;
+    return true;
+}
+
+template <typename T>
+numeric_csv<T> select_numeric_csv(const float* data,
+                                  std::int64_t row_count,
+                                  std::int64_t column_count,
+                                  const read_args<table>& args) {
+    const auto selection = make_column_selection(args, column_count);
+    const auto [first_row, last_row] = get_row_range(args, row_count);
+
+    numeric_csv<T> result;
+    result.row_count = last_row - first_row;
+    result.column_count = selection.column_count;
+    result.data = array<T>::empty(result.row_count * result.column_count);
+
+    T* rows = result.data.get_mutable_data();
+    for (std::int64_t r = first_row; r < last_row; ++r) {
+        const float* source = data + r * column_count;
+        T* row = rows + (r - first_row) * result.column_count;
+        for (const auto& [field, column] : selection.fields) {
+            row[column] = convert_value<T>(source[field]);
+        }
+    }
+    return result;
+}
+
+struct numeric_csv_chunks::state {
+    explicit state(const data_source& ds) : file(ds.get_file_name()), delimiter(ds.get_delimiter()) {}
+
+    const dal::detail::mapped_file file;
+    const char delimiter;
+    column_selection selection;
+    bool is_numeric = false;
+
+    // The beginning of the next row and the end of the data
+    const char* position = nullptr;
+    const char* end = nullptr;
+
+    // The number of rows left to read, -1 if the rows are not limited
+    std::int64_t row_limit = -1;
+
+    // The beginnings of the rows of the current chunk and the end of the last row
+    std::vector<const char*> row_bounds;
+};
+
+numeric_csv_chunks::numeric_csv_chunks(const data_source& ds, const read_args<table>& args)
+        : state_(new state(ds)) {
+    auto& s = *state_;
+    const char* data = s.file.get_data();
+    s.end = data + s.file.get_size();
+    s.position = data;
+    if (ds.get_parse_header() && s.position < s.end) {
+        s.position = next_line(find_line_end(s.position, s.end), s.end);
+    }
+
+    const char* first_row_end = trim_line(s.position, find_line_end(s.position, s.end));
+    if (first_row_end == s.position) {
+        return;
+    }
+    s.selection =
+        make_column_selection(args, count_columns(s.position, first_row_end, s.delimiter));
+    s.is_numeric = has_numeric_fields(s.position, first_row_end, s.delimiter, s.selection);
+
+    for (std::int64_t i = 0; i < args.get_row_offset() && s.position < s.end; ++i) {
+        const char* line_end = find_line_end(s.position, s.end);
+        if (trim_line(s.position, line_end) == s.position) {
+            s.end = s.position;
+            break;
+        }
+        s.position = next_line(line_end, s.end);
+    }
+    s.row_limit = args.get_row_limit();
+}
+
+numeric_csv_chunks::~numeric_csv_chunks() = default;
+
+bool numeric_csv_chunks::is_numeric() const {
+    return state_->is_numeric;
+}
+
+std::int64_t numeric_csv_chunks::get_column_count() const {
+    return state_->selection.column_count;
+}
+
+template <typename T>
+std::int64_t numeric_csv_chunks::read(std::int64_t row_count, T* rows) {
+    auto& s = *state_;
+    if (s.row_limit >= 0) {
+        row_count = std::min(row_count, s.row_limit);
+    }
+
+    // The data ends at the first empty line
+    s.row_bounds.clear();
+    while (static_cast<std::int64_t>(s.row_bounds.size()) < row_count && s.position < s.end) {
+        const char* line_end = find_line_end(s.position, s.end);
+        if (trim_line(s.position, line_end) == s.position) {
+            s.end = s.position;
+            break;
+        }
+        s.row_bounds.push_back(s.position);
+        s.position = next_line(line_end, s.end);
+    }
+    const std::int64_t chunk_row_count = s.row_bounds.size();
+    s.row_bounds.push_back(s.position);
+    if (s.row_limit >= 0) {
+        s.row_limit -= chunk_row_count;
+    }
+
+    // Blocks of rows are large enough to amortize the scheduling overhead
+    constexpr std::int64_t block_row_count = 1024;
+    const std::int64_t block_count = (chunk_row_count + block_row_count - 1) / block_row_count;
+    const std::int64_t column_count = s.selection.column_count;
+    daal::threader_for(block_count, block_count, [&](int i) {
+        const std::int64_t first = i * block_row_count;
+        const std::int64_t last = std::min(chunk_row_count, first + block_row_count);
+        for (std::int64_t r = first; r < last; ++r) {
+            const char* row_begin = s.row_bounds[r];
+            const char* line_end = find_line_end(row_begin, s.row_bounds[r + 1]);
+            parse_row(row_begin,
+                      trim_line(row_begin, line_end),
+                      s.delimiter,
+                      s.selection,
+                      rows + r * column_count);
+        }
+    });
+
+    return chunk_row_count;
+}
+
+#define INSTANTIATE(T)                                                                     \
+    template bool read_numeric_csv<T>(const data_source&,                                  \
+                                      const read_args<table>&,                             \
+                                      numeric_csv<T>&);                                    \
+    template numeric_csv<T> select_numeric_csv<T>(const float*,                            \
+                                                  std::int64_t,                            \
+                                                  std::int64_t,                            \
+                                                  const read_args<table>&);                \
+    template std::int64_t numeric_csv_chunks::read<T>(std::int64_t, T*);
+
+INSTANTIATE(float)
+INSTANTIATE(double)
+INSTANTIATE(std::int32_t)
+
+} // namespace oneapi::dal::csv::backend
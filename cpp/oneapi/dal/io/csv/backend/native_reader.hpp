@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <memory>
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/io/csv/common.hpp"
+#include "oneapi/dal/io/csv/read_types.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+/// Row-major content of the selected numeric fields of the CSV file
+template <typename T>
+struct numeric_csv {
+    array<T> data;
+    std::int64_t row_count = 0;
+    std::int64_t column_count = 0;
+};
+
+/// Reads the CSV file without the DAAL data source. The file is memory-mapped,
+/// split into newline-aligned chunks and the chunks are parsed in parallel
+/// directly into the resulting row-major buffer. The rows follow the rules of
+/// the DAAL data source: the number of columns is defined by the first row,
+/// missing fields are set to zero, extra fields are ignored and the data ends
+/// at the first empty line. Only the fields of the selected columns in the
+/// selected range of rows are converted.
+///
+/// @tparam T The type of the elements of the result: float, double or int32_t
+///
+/// @param [in]  ds     The CSV data source
+/// @param [in]  args   The column selection and the row range
+/// @param [out] result The parsed data
+///
+/// @return False if the first row is empty or its selected fields are not
+///         numeric. Such files are left to the DAAL data source that reports
+///         the errors and builds the dictionaries of categorical features.
+template <typename T>
+bool read_numeric_csv(const data_source& ds,
+                      const read_args<table>& args,
+                      numeric_csv<T>& result);
+
+/// Applies the column selection and the row range of the arguments to the
+/// row-major data that is read by the DAAL data source
+template <typename T>
+numeric_csv<T> select_numeric_csv(const float* data,
+                                  std::int64_t row_count,
+                                  std::int64_t column_count,
+                                  const read_args<table>& args);
+
+/// Sequential reader of the numeric CSV file by chunks of rows. The rows
+/// follow the same rules as in read_numeric_csv(), the boundaries of the rows
+/// of the chunk are found sequentially and the rows are parsed in parallel.
+class numeric_csv_chunks {
+public:
+    numeric_csv_chunks(const data_source& ds, const read_args<table>& args);
+    ~numeric_csv_chunks();
+
+    /// False if the first row is empty or its selected fields are not numeric
+    bool is_numeric() const;
+
+    /// The number of the columns of the chunks
+    std::int64_t get_column_count() const;
+
+    /// Parses at most the row_count next rows into the row-major buffer
+    ///
+    /// @return The number of the parsed rows, zero at the end of the data
+    template <typename T>
+    std::int64_t read(std::int64_t row_count, T* rows);
+
+private:
+    struct state;
+    std::unique_ptr<state> state_;
+};
+
+} // namespace oneapi::dal::csv::backend
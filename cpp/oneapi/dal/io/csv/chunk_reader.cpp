@@ -0,0 +1,176 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "oneapi/dal/io/csv/backend/native_reader.hpp"
+#include "oneapi/dal/io/csv/chunk_reader.hpp"
+#include "oneapi/dal/io/csv/detail/read_ops.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::csv {
+
+class detail::chunk_reader_impl : public base {
+public:
+    virtual std::int64_t get_column_count() const = 0;
+    virtual bool read_next(table& chunk) = 0;
+};
+
+namespace {
+
+/// Buffers of the fixed size that are reused by the chunks
+template <typename T>
+class buffer_pool : public std::enable_shared_from_this<buffer_pool<T>> {
+public:
+    explicit buffer_pool(std::int64_t buffer_size) : buffer_size_(buffer_size) {}
+
+    ~buffer_pool() {
+        for (T* buffer : free_buffers_) {
+            delete[] buffer;
+        }
+    }
+
+    /// The array over the free buffer. The buffer is returned to the pool when
+    /// the array and the arrays that refer to it are destroyed.
+    array<T> acquire() {
+        T* buffer = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!free_buffers_.empty()) {
+                buffer = free_buffers_.back();
+                free_buffers_.pop_back();
+            }
+        }
+        if (buffer == nullptr) {
+            buffer = new T[buffer_size_];
+        }
+
+        auto pool = this->shared_from_this();
+        return array<T>{ buffer, buffer_size_, [pool](T* buffer) {
+                            pool->release(buffer);
+                        } };
+    }
+
+private:
+    void release(T* buffer) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_buffers_.push_back(buffer);
+    }
+
+    const std::int64_t buffer_size_;
+    std::mutex mutex_;
+    std::vector<T*> free_buffers_;
+};
+
+template <typename T>
+class typed_chunk_reader_impl : public detail::chunk_reader_impl {
+public:
+    typed_chunk_reader_impl(const data_source& ds,
+                            std::int64_t chunk_row_count,
+                            const read_args<table>& args)
+            : parser_(ds, args),
+              chunk_row_count_(chunk_row_count) {
+        if (!parser_.is_numeric()) {
+            throw invalid_argument("Chunked reading supports numeric fields only");
+        }
+        pool_ = std::make_shared<buffer_pool<T>>(chunk_row_count_ * parser_.get_column_count());
+        prefetch();
+    }
+
+    ~typed_chunk_reader_impl() {
+        // The background parsing refers to the parser and must be finished
+        if (next_chunk_.valid()) {
+            next_chunk_.wait();
+        }
+    }
+
+    std::int64_t get_column_count() const override {
+        return parser_.get_column_count();
+    }
+
+    bool read_next(table& chunk) override {
+        if (!next_chunk_.valid()) {
+            return false;
+        }
+        auto [data, row_count] = next_chunk_.get();
+        if (row_count == 0) {
+            return false;
+        }
+        prefetch();
+
+        chunk = dal::detail::homogen_table_builder{}
+                    .reset(data, row_count, parser_.get_column_count())
+                    .build();
+        return true;
+    }
+
+private:
+    void prefetch() {
+        next_chunk_ = std::async(std::launch::async, [this]() {
+            const auto buffer = pool_->acquire();
+            T* rows = buffer.get_mutable_data();
+            const std::int64_t row_count = parser_.read(chunk_row_count_, rows);
+
+            // The last chunk covers only the parsed part of the buffer
+            array<T> data;
+            data.reset(buffer, rows, row_count * parser_.get_column_count());
+            return std::make_pair(data, row_count);
+        });
+    }
+
+    backend::numeric_csv_chunks parser_;
+    const std::int64_t chunk_row_count_;
+    std::shared_ptr<buffer_pool<T>> pool_;
+    std::future<std::pair<array<T>, std::int64_t>> next_chunk_;
+};
+
+detail::chunk_reader_impl* make_chunk_reader_impl(const data_source& ds,
+                                                  std::int64_t chunk_row_count,
+                                                  const read_args<table>& args) {
+    detail::read_ops<table, data_source>{}.check_preconditions(ds, args);
+    if (chunk_row_count <= 0) {
+        throw invalid_argument("Non-positive chunk_row_count");
+    }
+
+    switch (args.get_data_type()) {
+        case data_type::float64:
+            return new typed_chunk_reader_impl<double>(ds, chunk_row_count, args);
+        case data_type::int32:
+            return new typed_chunk_reader_impl<std::int32_t>(ds, chunk_row_count, args);
+        default: return new typed_chunk_reader_impl<float>(ds, chunk_row_count, args);
+    }
+}
+
+} // namespace
+
+chunk_reader::chunk_reader(const data_source& ds,
+                           std::int64_t chunk_row_count,
+                           const read_args<table>& args)
+        : impl_(make_chunk_reader_impl(ds, chunk_row_count, args)) {}
+
+std::int64_t chunk_reader::get_column_count() const {
+    return impl_->get_column_count();
+}
+
+bool chunk_reader::read_next(table& chunk) {
+    return impl_->read_next(chunk);
+}
+
+} // namespace oneapi::dal::csv
@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/io/csv/read_types.hpp"
+
+namespace oneapi::dal::csv {
+
+namespace detail {
+class chunk_reader_impl;
+} // namespace detail
+
+/// Reads the CSV file with numeric fields by chunks of rows, e.g. to pass the
+/// data sets larger than memory to the online algorithms. The next chunk is
+/// parsed on the background thread while the current one is processed. The
+/// chunk buffers come from the pool and return to it once the tables that
+/// refer to them are destroyed, so the memory is bounded by two chunks plus
+/// the chunks that the caller keeps.
+///
+/// @code
+/// csv::chunk_reader reader{ csv::data_source{ "data.csv" }, 65536 };
+/// for (table chunk; reader.read_next(chunk);) {
+///     ...
+/// }
+/// @endcode
+class ONEAPI_DAL_EXPORT chunk_reader : public base {
+public:
+    /// @param [in] ds              The CSV data source
+    /// @param [in] chunk_row_count The number of rows in the chunks, the last
+    ///                             chunk may be smaller
+    /// @param [in] args            The column selection, the data type and the
+    ///                             range of rows to read
+    chunk_reader(const data_source& ds,
+                 std::int64_t chunk_row_count,
+                 const read_args<table>& args = read_args<table>{});
+
+    /// The number of columns in the chunks
+    std::int64_t get_column_count() const;
+
+    /// Reads the next chunk of rows
+    ///
+    /// @param [out] chunk The homogen table with the rows of the chunk
+    ///
+    /// @return False at the end of the data, the chunk is left unchanged then
+    bool read_next(table& chunk);
+
+private:
+    dal::detail::pimpl<detail::chunk_reader_impl> impl_;
+};
+
+} // namespace oneapi::dal::csv
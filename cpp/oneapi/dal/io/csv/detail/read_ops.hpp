@@ -38,7 +38,26 @@ struct read_ops<Object, data_source> {
     using result_t = Object;
     using data_source_base_t = data_source;
 
-    void check_preconditions(const data_source& ds, const args_t& args) const {}
+    void check_preconditions(const data_source& ds, const args_t& args) const {
+        const auto dtype = args.get_data_type();
+        if (dtype != data_type::float32 && dtype != data_type::float64 &&
+            dtype != data_type::int32) {
+            throw invalid_argument("Unsupported data type");
+        }
+        if (args.get_row_offset() < 0) {
+            throw invalid_argument("Negative row_offset");
+        }
+        if (args.get_row_limit() < -1) {
+            throw invalid_argument("row_limit < -1");
+        }
+        const auto& columns = args.get_column_indices();
+        const std::int64_t* column_data = columns.get_data();
+        for (std::int64_t i = 0; i < columns.get_count(); ++i) {
+            if (column_data[i] < 0) {
+                throw invalid_argument("Negative column index");
+            }
+        }
+    }
 
     void check_postconditions(const data_source& ds,
                               const args_t& args,
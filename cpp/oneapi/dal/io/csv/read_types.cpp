@@ -25,8 +25,45 @@ template <>
 class detail::read_args_impl<table> : public base {
 public:
     read_args_impl() {}
+
+    array<std::int64_t> column_indices;
+    data_type dtype = data_type::float32;
+    std::int64_t row_offset = 0;
+    std::int64_t row_limit = -1;
 };
 
 read_args<table>::read_args() : impl_(new detail::read_args_impl<table>()) {}
 
+const array<std::int64_t>& read_args<table>::get_column_indices() const {
+    return impl_->column_indices;
+}
+
+data_type read_args<table>::get_data_type() const {
+    return impl_->dtype;
+}
+
+std::int64_t read_args<table>::get_row_offset() const {
+    return impl_->row_offset;
+}
+
+std::int64_t read_args<table>::get_row_limit() const {
+    return impl_->row_limit;
+}
+
+void read_args<table>::set_column_indices_impl(const array<std::int64_t>& value) {
+    impl_->column_indices = value;
+}
+
+void read_args<table>::set_data_type_impl(data_type value) {
+    impl_->dtype = value;
+}
+
+void read_args<table>::set_row_offset_impl(std::int64_t value) {
+    impl_->row_offset = value;
+}
+
+void read_args<table>::set_row_limit_impl(std::int64_t value) {
+    impl_->row_limit = value;
+}
+
 } // namespace oneapi::dal::csv
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/array.hpp"
 #include "oneapi/dal/io/csv/common.hpp"
 
 namespace oneapi::dal::csv {
@@ -33,6 +34,47 @@ class ONEAPI_DAL_EXPORT read_args<table> : public base {
 public:
     read_args();
 
+    /// The indices of the columns of the file that form the columns of the
+    /// result, in the order of the result. The fields of other columns are
+    /// skipped without conversion. Empty selects all the columns.
+    const array<std::int64_t>& get_column_indices() const;
+
+    /// The type of the elements of the result: float32, float64 or int32
+    data_type get_data_type() const;
+
+    /// The number of data rows to skip at the beginning of the file. The
+    /// header row is not counted.
+    std::int64_t get_row_offset() const;
+
+    /// The maximum number of rows to read, -1 reads all the rows
+    std::int64_t get_row_limit() const;
+
+    auto& set_column_indices(const array<std::int64_t>& value) {
+        set_column_indices_impl(value);
+        return *this;
+    }
+
+    auto& set_data_type(data_type value) {
+        set_data_type_impl(value);
+        return *this;
+    }
+
+    auto& set_row_offset(std::int64_t value) {
+        set_row_offset_impl(value);
+        return *this;
+    }
+
+    auto& set_row_limit(std::int64_t value) {
+        set_row_limit_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_column_indices_impl(const array<std::int64_t>& value);
+    void set_data_type_impl(data_type value);
+    void set_row_offset_impl(std::int64_t value);
+    void set_row_limit_impl(std::int64_t value);
+
 private:
     dal::detail::pimpl<detail::read_args_impl<table>> impl_;
 };
@@ -0,0 +1,224 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_array_graph_impl.hpp"
+#include "oneapi/dal/graph/graph_common.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
+
+namespace oneapi::dal::preview::load_graph::detail {
+
+constexpr char graph_binary_magic[8] = { 'O', 'D', 'A', 'L', 'C', 'S', 'R', '\0' };
+constexpr std::uint32_t graph_binary_version = 2;
+constexpr std::uint32_t graph_binary_byte_order = 0x01020304;
+
+/// The header of the binary CSR file. The header is followed by the arrays of
+/// edge offsets (vertex_count + 1 elements), degrees (vertex_count elements)
+/// vertex neighbors (neighbor_count elements) and the original indices of the
+/// vertices (permutation_count elements, zero if the vertices were not
+/// reordered) in the native byte order of the writer.
+struct graph_binary_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t vertex_index_size;
+    std::uint32_t edge_index_size;
+    std::int64_t vertex_count;
+    std::int64_t edge_count;
+    std::int64_t neighbor_count;
+    std::int64_t permutation_count;
+};
+
+template <typename Container>
+inline void write_array(std::ofstream &file, const Container &data) {
+    file.write(reinterpret_cast<const char *>(data.data()),
+               data.size() * sizeof(typename Container::value_type));
+}
+
+template <typename Container>
+inline void read_array(std::ifstream &file, Container &data, std::int64_t count) {
+    data.resize(count);
+    file.read(reinterpret_cast<char *>(data.data()),
+              count * sizeof(typename Container::value_type));
+}
+
+template <typename Graph>
+void save_binary_impl(const Graph &g, const std::string &name) {
+    using vertex_t = typename Graph::vertex_type;
+    using edge_t = typename Graph::edge_type;
+
+    const auto &layout = oneapi::dal::preview::detail::get_impl(g);
+
+    std::ofstream file(name, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw invalid_argument("Cannot open the file for writing");
+    }
+
+    graph_binary_header header;
+    std::memcpy(header.magic, graph_binary_magic, sizeof(header.magic));
+    header.version = graph_binary_version;
+    header.byte_order = graph_binary_byte_order;
+    header.vertex_index_size = sizeof(vertex_t);
+    header.edge_index_size = sizeof(edge_t);
+    header.vertex_count = static_cast<std::int64_t>(layout->_vertex_count);
+    header.edge_count = static_cast<std::int64_t>(layout->_edge_count);
+    header.permutation_count = static_cast<std::int64_t>(layout->_vertex_permutation.size());
+
+    // the compressed adjacency lists are stored decoded
+    const auto &compressed = layout->_compressed_neighbors;
+    typename Graph::vertex_set decoded;
+    if (!compressed.empty()) {
+        decoded.resize(layout->_edge_offsets[layout->_vertex_count]);
+        for (std::int64_t u = 0; u < header.vertex_count; ++u) {
+            compressed.decode_list(compressed.get_list(u),
+                                   layout->_degrees[u],
+                                   decoded.data() + layout->_edge_offsets[u]);
+        }
+    }
+    const auto &neighbors = compressed.empty() ? layout->_vertex_neighbors : decoded;
+    header.neighbor_count = static_cast<std::int64_t>(neighbors.size());
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    write_array(file, layout->_edge_offsets);
+    write_array(file, layout->_degrees);
+    write_array(file, neighbors);
+    write_array(file, layout->_vertex_permutation);
+
+    if (!file.good()) {
+        throw invalid_argument("Cannot write the graph to the file");
+    }
+}
+
+/// Checks that the file holds exactly the arrays of the header after it, so
+/// the arrays are allocated only for the sizes the file really has
+inline void check_binary_size(std::ifstream &file,
+                              const graph_binary_header &header,
+                              std::uint64_t vertex_size,
+                              std::uint64_t edge_size) {
+    const auto data_begin = file.tellg();
+    file.seekg(0, std::ios::end);
+    const auto data_end = file.tellg();
+    file.seekg(data_begin);
+    if (data_begin < 0 || data_end < data_begin) {
+        throw invalid_argument("Cannot read the binary graph file");
+    }
+    const std::uint64_t data_size = static_cast<std::uint64_t>(data_end - data_begin);
+
+    // Every count is bounded by the file size first, so the sums do not overflow
+    const std::uint64_t vertex_count = header.vertex_count;
+    const std::uint64_t neighbor_count = header.neighbor_count;
+    const std::uint64_t permutation_count = header.permutation_count;
+    if (vertex_count >= data_size / edge_size || neighbor_count > data_size / vertex_size ||
+        permutation_count > data_size / vertex_size) {
+        throw invalid_argument("The binary graph file is shorter than its header states");
+    }
+    const std::uint64_t expected_size = (vertex_count + 1) * edge_size +
+                                        (vertex_count + neighbor_count + permutation_count) *
+                                            vertex_size;
+    if (expected_size != data_size) {
+        throw invalid_argument("The size of the binary graph file does not match its header");
+    }
+}
+
+/// Checks that the offsets are the non-decreasing bounds of the neighbors
+/// matching the degrees, and that every vertex id is a vertex of the graph
+template <typename EdgeSet, typename VertexSet>
+void check_binary_arrays(const graph_binary_header &header,
+                         const EdgeSet &offsets,
+                         const VertexSet &degrees,
+                         const VertexSet &neighbors,
+                         const VertexSet &permutation) {
+    const std::int64_t vertex_count = header.vertex_count;
+    if (offsets[0] != 0 || static_cast<std::int64_t>(offsets[vertex_count]) !=
+                               header.neighbor_count) {
+        throw invalid_argument("Corrupted edge offsets of the binary graph");
+    }
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        if (offsets[u + 1] < offsets[u] ||
+            static_cast<std::int64_t>(offsets[u + 1] - offsets[u]) !=
+                static_cast<std::int64_t>(degrees[u])) {
+            throw invalid_argument("Corrupted edge offsets of the binary graph");
+        }
+    }
+    const auto is_vertex = [&](std::int64_t v) {
+        return v >= 0 && v < vertex_count;
+    };
+    for (std::int64_t i = 0; i < header.neighbor_count; ++i) {
+        if (!is_vertex(neighbors[i])) {
+            throw invalid_argument("Neighbor of the binary graph is not a vertex of the graph");
+        }
+    }
+    for (std::int64_t i = 0; i < header.permutation_count; ++i) {
+        if (!is_vertex(permutation[i])) {
+            throw invalid_argument("Corrupted vertex permutation of the binary graph");
+        }
+    }
+}
+
+template <typename Graph>
+void load_binary_impl(const std::string &name, Graph &g) {
+    using vertex_t = typename Graph::vertex_type;
+    using edge_t = typename Graph::edge_type;
+
+    std::ifstream file(name, std::ios::binary);
+    if (!file.is_open()) {
+        throw invalid_argument("File not found");
+    }
+
+    graph_binary_header header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file.good() || std::memcmp(header.magic, graph_binary_magic, sizeof(header.magic))) {
+        throw invalid_argument("The file does not contain the graph in the binary format");
+    }
+    if (header.version != graph_binary_version) {
+        throw invalid_argument("Unsupported version of the binary graph format");
+    }
+    if (header.byte_order != graph_binary_byte_order ||
+        header.vertex_index_size != sizeof(vertex_t) || header.edge_index_size != sizeof(edge_t)) {
+        throw invalid_argument("Binary graph layout does not match the graph type");
+    }
+    if (header.vertex_count < 0 || header.neighbor_count < 0 || header.edge_count < 0 ||
+        (header.permutation_count != 0 && header.permutation_count != header.vertex_count)) {
+        throw invalid_argument("Corrupted binary graph header");
+    }
+    check_binary_size(file, header, sizeof(vertex_t), sizeof(edge_t));
+
+    auto &layout = oneapi::dal::preview::detail::get_impl(g);
+    read_array(file, layout->_edge_offsets, header.vertex_count + 1);
+    read_array(file, layout->_degrees, header.vertex_count);
+    read_array(file, layout->_vertex_neighbors, header.neighbor_count);
+    read_array(file, layout->_vertex_permutation, header.permutation_count);
+    if (!file.good()) {
+        throw invalid_argument("Unexpected end of the binary graph file");
+    }
+    check_binary_arrays(header,
+                        layout->_edge_offsets,
+                        layout->_degrees,
+                        layout->_vertex_neighbors,
+                        layout->_vertex_permutation);
+
+    layout->_vertex_count = header.vertex_count;
+    layout->_edge_count = header.edge_count;
+}
+
+} // namespace oneapi::dal::preview::load_graph::detail
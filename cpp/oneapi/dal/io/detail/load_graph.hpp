@@ -17,40 +17,74 @@
 #pragma once
 
 #include <algorithm>
-#include <fstream>
+#include <vector>
 
 #include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/graph/detail/graph_container.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_array_graph_impl.hpp"
 #include "oneapi/dal/graph/graph_common.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
+#include "oneapi/dal/io/detail/graph_binary_format.hpp"
 #include "oneapi/dal/io/detail/load_graph_service.hpp"
 #include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
 #include "oneapi/dal/io/graph_csv_data_source.hpp"
 #include "oneapi/dal/io/load_graph_descriptor.hpp"
 #include "services/daal_atomic_int.h"
 #include "services/daal_memory.h"
 
 namespace oneapi::dal::preview::load_graph::detail {
-edge_list<std::int32_t> load_edge_list(const std::string &name) {
-    using int_t = std::int32_t;
+// The number of elements processed by one task of the parallel loops
+constexpr std::int64_t csr_block_size = 1 << 16;
 
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument("File not found");
-    }
-    edge_list<int_t> elist;
-    elist.reserve(1024);
-
-    char source_vertex[32], destination_vertex[32];
-    while (file >> source_vertex >> destination_vertex) {
-        auto edge = std::make_pair(daal_string_to_int(&source_vertex[0], 0),
-                                   daal_string_to_int(&destination_vertex[0], 0));
-        elist.push_back(edge);
+// The number of vertices processed by one task during the sorting of adjacency lists
+constexpr std::int64_t csr_vertex_block_size = 1 << 10;
+
+// Vertices with the larger number of neighbors are sorted by separate tasks
+constexpr std::int64_t csr_hub_degree = 1 << 12;
+
+/// Runs the function for the ranges [begin, end) of size block_size covering [0, n)
+template <typename F>
+inline void threader_for_blocks(std::int64_t n, std::int64_t block_size, const F &lambda) {
+    const std::int64_t block_count = (n + block_size - 1) / block_size;
+    threader_for(block_count, block_count, [&](int block) {
+        const std::int64_t begin = block * block_size;
+        const std::int64_t end = std::min(n, begin + block_size);
+        lambda(block, begin, end);
+    });
+}
+
+/// Computes the exclusive prefix sum of the values get(0), ..., get(n - 1) into
+/// out[0], ..., out[n]
+///
+/// @return The total sum of the values
+template <typename T, typename Get>
+inline T parallel_prefix_sum(std::int64_t n, const Get &get, T *out) {
+    const std::int64_t block_count = (n + csr_block_size - 1) / csr_block_size;
+    std::vector<T> block_sums(block_count + 1, 0);
+
+    threader_for_blocks(n, csr_block_size, [&](int block, std::int64_t begin, std::int64_t end) {
+        T sum = 0;
+        for (std::int64_t i = begin; i < end; ++i) {
+            sum += get(i);
+        }
+        block_sums[block + 1] = sum;
+    });
+
+    for (std::int64_t block = 0; block < block_count; ++block) {
+        block_sums[block + 1] += block_sums[block];
     }
 
-    file.close();
-    return elist;
+    threader_for_blocks(n, csr_block_size, [&](int block, std::int64_t begin, std::int64_t end) {
+        T sum = block_sums[block];
+        for (std::int64_t i = begin; i < end; ++i) {
+            out[i] = sum;
+            sum += get(i);
+        }
+    });
+
+    out[n] = block_sums[block_count];
+    return out[n];
 }
 
 template <typename Graph>
@@ -64,11 +98,21 @@ void convert_to_csr_impl(const edge_list<vertex_type<Graph>> &edges, Graph &g) {
     using vector_vertex_t = typename Graph::vertex_set;
     using atomic_t = typename daal::services::Atomic<vertex_t>;
 
-    vertex_t max_id = edges[0].first;
-    for (auto u : edges) {
-        vertex_t edge_max = std::max(u.first, u.second);
-        max_id = std::max(max_id, edge_max);
-    }
+    const std::int64_t edge_list_size = static_cast<std::int64_t>(edges.size());
+    const std::int64_t edge_block_count = (edge_list_size + csr_block_size - 1) / csr_block_size;
+
+    std::vector<vertex_t> block_max_ids(edge_block_count, edges[0].first);
+    threader_for_blocks(edge_list_size,
+                        csr_block_size,
+                        [&](int block, std::int64_t begin, std::int64_t end) {
+                            vertex_t block_max = edges[begin].first;
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                block_max = std::max(block_max,
+                                                     std::max(edges[i].first, edges[i].second));
+                            }
+                            block_max_ids[block] = block_max;
+                        });
+    const vertex_t max_id = *std::max_element(block_max_ids.begin(), block_max_ids.end());
 
     const vertex_t vertex_count = max_id + 1;
 
@@ -80,49 +124,57 @@ void convert_to_csr_impl(const edge_list<vertex_type<Graph>> &edges, Graph &g) {
         (void *)allocator.allocate(vertex_count * (sizeof(atomic_t) / sizeof(char)));
     atomic_t *degrees_cv = new (degrees_vec_void) atomic_t[vertex_count];
 
-    threader_for(edges.size(), edges.size(), [&](vertex_t u) {
-        degrees_cv[edges[u].first].inc();
-        degrees_cv[edges[u].second].inc();
-    });
-
-    void *rows_vec_void =
-        (void *)allocator.allocate((vertex_count + 1) * (sizeof(atomic_t) / sizeof(char)));
-    atomic_t *rows_vec_atomic = new (rows_vec_void) atomic_t[vertex_count + 1];
-
-    vertex_t total_sum_degrees = 0;
-    rows_vec_atomic[0].set(total_sum_degrees);
-    for (vertex_t i = 0; i < vertex_count; ++i) {
-        total_sum_degrees += degrees_cv[i].get();
-        rows_vec_atomic[i + 1].set(total_sum_degrees);
-    }
-    allocator.deallocate((char *)degrees_vec_void,
-                         vertex_count * (sizeof(atomic_t) / sizeof(char)));
-
-    void *unfiltered_neighs_void = (void *)allocator.allocate(
-        (rows_vec_atomic[vertex_count].get()) * (sizeof(vertex_t) / sizeof(char)));
-    vertex_t *unfiltered_neighs =
-        new (unfiltered_neighs_void) vertex_t[rows_vec_atomic[vertex_count].get()];
+    threader_for_blocks(edge_list_size,
+                        csr_block_size,
+                        [&](int, std::int64_t begin, std::int64_t end) {
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                degrees_cv[edges[i].first].inc();
+                                degrees_cv[edges[i].second].inc();
+                            }
+                        });
 
     void *unfiltered_offsets_void =
         (void *)allocator.allocate((vertex_count + 1) * (sizeof(edge_t) / sizeof(char)));
     edge_t *unfiltered_offsets = new (unfiltered_offsets_void) edge_t[vertex_count + 1];
 
-    threader_for(vertex_count + 1, vertex_count + 1, [&](vertex_t n) {
-        unfiltered_offsets[n] = rows_vec_atomic[n].get();
-    });
+    const edge_t unfiltered_neighs_count = parallel_prefix_sum(
+        vertex_count,
+        [&](std::int64_t u) {
+            return static_cast<edge_t>(degrees_cv[u].get());
+        },
+        unfiltered_offsets);
 
-    threader_for(edges.size(), edges.size(), [&](vertex_t u) {
-        unfiltered_neighs[rows_vec_atomic[edges[u].first].inc() - 1] = edges[u].second;
-        unfiltered_neighs[rows_vec_atomic[edges[u].second].inc() - 1] = edges[u].first;
-    });
-    allocator.deallocate((char *)rows_vec_void,
-                         (vertex_count + 1) * (sizeof(atomic_t) / sizeof(char)));
+    // from now on the degree counters are reused as the insertion positions
+    threader_for_blocks(vertex_count,
+                        csr_block_size,
+                        [&](int, std::int64_t begin, std::int64_t end) {
+                            for (std::int64_t u = begin; u < end; ++u) {
+                                degrees_cv[u].set(unfiltered_offsets[u]);
+                            }
+                        });
+
+    void *unfiltered_neighs_void =
+        (void *)allocator.allocate(unfiltered_neighs_count * (sizeof(vertex_t) / sizeof(char)));
+    vertex_t *unfiltered_neighs = new (unfiltered_neighs_void) vertex_t[unfiltered_neighs_count];
+
+    threader_for_blocks(edge_list_size,
+                        csr_block_size,
+                        [&](int, std::int64_t begin, std::int64_t end) {
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                unfiltered_neighs[degrees_cv[edges[i].first].inc() - 1] =
+                                    edges[i].second;
+                                unfiltered_neighs[degrees_cv[edges[i].second].inc() - 1] =
+                                    edges[i].first;
+                            }
+                        });
+    allocator.deallocate((char *)degrees_vec_void,
+                         vertex_count * (sizeof(atomic_t) / sizeof(char)));
 
     layout->_degrees = std::move(vector_vertex_t(vertex_count));
     auto degrees_data = layout->_degrees.data();
 
     //removing self-loops,  multiple edges from graph, and make neighbors in CSR sorted
-    threader_for(vertex_count, vertex_count, [&](vertex_t u) {
+    auto filter_neighbors = [&](vertex_t u) {
         auto start_p = unfiltered_neighs + unfiltered_offsets[u];
         auto end_p = unfiltered_neighs + unfiltered_offsets[u + 1];
 
@@ -131,42 +183,293 @@ void convert_to_csr_impl(const edge_list<vertex_type<Graph>> &edges, Graph &g) {
         auto neighs_u_new_end = std::unique(start_p, end_p);
         neighs_u_new_end = std::remove(start_p, neighs_u_new_end, u);
         degrees_data[u] = (vertex_t)std::distance(start_p, neighs_u_new_end);
+    };
+
+    auto is_hub = [&](vertex_t u) {
+        return unfiltered_offsets[u + 1] - unfiltered_offsets[u] >= csr_hub_degree;
+    };
+
+    // the longest adjacency lists are sorted first, one task per vertex, so that
+    // they do not end up at the tail of the loop over the vertex blocks
+    std::vector<vertex_t> hubs;
+    for (vertex_t u = 0; u < vertex_count; ++u) {
+        if (is_hub(u)) {
+            hubs.push_back(u);
+        }
+    }
+    std::sort(hubs.begin(), hubs.end(), [&](vertex_t u, vertex_t v) {
+        return unfiltered_offsets[u + 1] - unfiltered_offsets[u] >
+               unfiltered_offsets[v + 1] - unfiltered_offsets[v];
     });
+    threader_for(hubs.size(), hubs.size(), [&](int i) {
+        filter_neighbors(hubs[i]);
+    });
+
+    threader_for_blocks(vertex_count,
+                        csr_vertex_block_size,
+                        [&](int, std::int64_t begin, std::int64_t end) {
+                            for (vertex_t u = begin; u < end; ++u) {
+                                if (!is_hub(u)) {
+                                    filter_neighbors(u);
+                                }
+                            }
+                        });
 
     layout->_edge_offsets = std::move(vector_vertex_t(vertex_count + 1));
     auto edge_offsets_data = layout->_edge_offsets.data();
 
-    total_sum_degrees = 0;
-    edge_offsets_data[0] = total_sum_degrees;
-    for (vertex_t i = 0; i < vertex_count; ++i) {
-        total_sum_degrees += degrees_data[i];
-        edge_offsets_data[i + 1] = total_sum_degrees;
-    }
+    const edge_t total_sum_degrees = parallel_prefix_sum(
+        vertex_count,
+        [&](std::int64_t u) {
+            return static_cast<edge_t>(degrees_data[u]);
+        },
+        edge_offsets_data);
     layout->_edge_count = total_sum_degrees / 2;
 
-    layout->_vertex_neighbors = std::move(vector_vertex_t(layout->_edge_offsets[vertex_count]));
+    layout->_vertex_neighbors = std::move(vector_vertex_t(total_sum_degrees));
 
     auto vert_neighs = layout->_vertex_neighbors.data();
     auto edge_offs = layout->_edge_offsets.data();
-    threader_for(vertex_count, vertex_count, [&](vertex_t u) {
-        auto u_neighs = vert_neighs + edge_offs[u];
-        auto u_neighs_unf = unfiltered_neighs + unfiltered_offsets[u];
-        for (vertex_t i = 0; i < degrees_data[u]; i++) {
-            u_neighs[i] = u_neighs_unf[i];
-        }
-    });
+    threader_for_blocks(vertex_count,
+                        csr_vertex_block_size,
+                        [&](int, std::int64_t begin, std::int64_t end) {
+                            for (vertex_t u = begin; u < end; ++u) {
+                                std::copy(unfiltered_neighs + unfiltered_offsets[u],
+                                          unfiltered_neighs + unfiltered_offsets[u] +
+                                              degrees_data[u],
+                                          vert_neighs + edge_offs[u]);
+                            }
+                        });
 
     allocator.deallocate((char *)unfiltered_neighs_void,
-                         (rows_vec_atomic[vertex_count].get()) * (sizeof(vertex_t) / sizeof(char)));
+                         unfiltered_neighs_count * (sizeof(vertex_t) / sizeof(char)));
     allocator.deallocate((char *)unfiltered_offsets_void,
                          (vertex_count + 1) * (sizeof(edge_t) / sizeof(char)));
     return;
-} // namespace oneapi::dal::preview::load_graph::detail
+}
+
+/// Computes the order of the vertices by the degree in descending order. The
+/// vertices of the same degree keep their relative order.
+///
+/// @return The original indices of the vertices in the new order
+template <typename Graph>
+std::vector<vertex_type<Graph>> compute_degree_order(const Graph &g) {
+    using vertex_t = typename Graph::vertex_type;
+
+    const auto &layout = oneapi::dal::preview::detail::get_impl(g);
+    const auto degrees = layout->_degrees.data();
+    const vertex_t vertex_count = layout->_vertex_count;
+
+    std::vector<vertex_t> order(vertex_count);
+    for (vertex_t u = 0; u < vertex_count; ++u) {
+        order[u] = u;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](vertex_t u, vertex_t v) {
+        return degrees[u] > degrees[v];
+    });
+    return order;
+}
+
+/// Computes the Reverse Cuthill-McKee order of the vertices. Each connected
+/// component is traversed in the breadth-first order starting from its vertex
+/// of the minimum degree, the neighbors are visited in ascending degree order.
+///
+/// @return The original indices of the vertices in the new order
+template <typename Graph>
+std::vector<vertex_type<Graph>> compute_rcm_order(const Graph &g) {
+    using vertex_t = typename Graph::vertex_type;
+
+    const auto &layout = oneapi::dal::preview::detail::get_impl(g);
+    const auto degrees = layout->_degrees.data();
+    const auto offsets = layout->_edge_offsets.data();
+    const auto neighbors = layout->_vertex_neighbors.data();
+    const vertex_t vertex_count = layout->_vertex_count;
+
+    // the start vertices of the components are taken in ascending degree order
+    std::vector<vertex_t> by_degree(vertex_count);
+    for (vertex_t u = 0; u < vertex_count; ++u) {
+        by_degree[u] = u;
+    }
+    std::stable_sort(by_degree.begin(), by_degree.end(), [&](vertex_t u, vertex_t v) {
+        return degrees[u] < degrees[v];
+    });
+
+    std::vector<vertex_t> order;
+    order.reserve(vertex_count);
+    std::vector<char> visited(vertex_count, 0);
+    for (const vertex_t start : by_degree) {
+        if (visited[start]) {
+            continue;
+        }
+        visited[start] = 1;
+        std::size_t head = order.size();
+        order.push_back(start);
+        for (; head < order.size(); ++head) {
+            const vertex_t u = order[head];
+            const std::size_t level_begin = order.size();
+            for (auto p = neighbors + offsets[u]; p != neighbors + offsets[u + 1]; ++p) {
+                if (!visited[*p]) {
+                    visited[*p] = 1;
+                    order.push_back(*p);
+                }
+            }
+            std::stable_sort(order.begin() + level_begin,
+                             order.end(),
+                             [&](vertex_t v, vertex_t w) {
+                                 return degrees[v] < degrees[w];
+                             });
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+/// Relabels the vertices of the graph, so that the vertex order[i] gets the
+/// index i. The adjacency lists of the relabeled graph are sorted. The original
+/// indices are kept in the graph and combined with the previous relabeling.
+template <typename Graph>
+void reorder_vertices_impl(const std::vector<vertex_type<Graph>> &order, Graph &g) {
+    using vertex_t = typename Graph::vertex_type;
+    using edge_t = typename Graph::edge_type;
+    using vector_vertex_t = typename Graph::vertex_set;
+
+    auto &layout = oneapi::dal::preview::detail::get_impl(g);
+    const vertex_t vertex_count = layout->_vertex_count;
+
+    std::vector<vertex_t> new_index(vertex_count);
+    threader_for_blocks(vertex_count,
+                        csr_block_size,
+                        [&](int, std::int64_t begin, std::int64_t end) {
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                new_index[order[i]] = static_cast<vertex_t>(i);
+                            }
+                        });
+
+    const auto old_degrees = layout->_degrees.data();
+    const auto old_offsets = layout->_edge_offsets.data();
+    const auto old_neighbors = layout->_vertex_neighbors.data();
+
+    vector_vertex_t degrees(vertex_count);
+    vector_vertex_t offsets(vertex_count + 1);
+    vector_vertex_t neighbors(layout->_vertex_neighbors.size());
+    vector_vertex_t permutation(vertex_count);
+    auto degrees_data = degrees.data();
+    auto offsets_data = offsets.data();
+    auto neighbors_data = neighbors.data();
+    auto permutation_data = permutation.data();
+    const auto &old_permutation = layout->_vertex_permutation;
+
+    threader_for_blocks(vertex_count,
+                        csr_block_size,
+                        [&](int, std::int64_t begin, std::int64_t end) {
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                degrees_data[i] = old_degrees[order[i]];
+                                permutation_data[i] = old_permutation.empty()
+                                                          ? order[i]
+                                                          : old_permutation[order[i]];
+                            }
+                        });
+
+    parallel_prefix_sum(
+        vertex_count,
+        [&](std::int64_t i) {
+            return static_cast<edge_t>(degrees_data[i]);
+        },
+        offsets_data);
+
+    threader_for_blocks(vertex_count,
+                        csr_vertex_block_size,
+                        [&](int, std::int64_t begin, std::int64_t end) {
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                const vertex_t u = order[i];
+                                auto out = neighbors_data + offsets_data[i];
+                                for (auto p = old_neighbors + old_offsets[u];
+                                     p != old_neighbors + old_offsets[u + 1];
+                                     ++p) {
+                                    *out++ = new_index[*p];
+                                }
+                                std::sort(neighbors_data + offsets_data[i], out);
+                            }
+                        });
+
+    layout->_degrees = std::move(degrees);
+    layout->_edge_offsets = std::move(offsets);
+    layout->_vertex_neighbors = std::move(neighbors);
+    layout->_vertex_permutation = std::move(permutation);
+}
+
+template <typename Graph>
+void reorder_vertices_impl(vertex_ordering ordering, Graph &g) {
+    switch (ordering) {
+        case vertex_ordering::none: return;
+        case vertex_ordering::degree: reorder_vertices_impl(compute_degree_order(g), g); return;
+        case vertex_ordering::rcm: reorder_vertices_impl(compute_rcm_order(g), g); return;
+        default: throw invalid_argument("Unsupported vertex ordering");
+    }
+}
+
+/// Replaces the adjacency lists of the graph with the compressed ones
+template <typename Graph>
+void compress_neighbors_impl(Graph &g) {
+    using vertex_t = typename Graph::vertex_type;
+    using compressed_set_t = oneapi::dal::preview::detail::compressed_neighbor_set<vertex_t>;
+
+    auto &layout = oneapi::dal::preview::detail::get_impl(g);
+    const std::int64_t vertex_count = layout->_vertex_count;
+    const auto offsets = layout->_edge_offsets.data();
+    const auto neighbors = layout->_vertex_neighbors.data();
+
+    compressed_set_t compressed;
+    compressed._offsets.resize(vertex_count + 1);
+    auto compressed_offsets = compressed._offsets.data();
+    const std::int64_t size = parallel_prefix_sum(
+        vertex_count,
+        [&](std::int64_t u) {
+            return compressed_set_t::get_encoded_size(neighbors + offsets[u],
+                                                      offsets[u + 1] - offsets[u]);
+        },
+        compressed_offsets);
+
+    compressed._data.resize(size + compressed_set_t::padding_size, 0);
+    auto compressed_data = compressed._data.data();
+    threader_for_blocks(vertex_count,
+                        csr_vertex_block_size,
+                        [&](int, std::int64_t begin, std::int64_t end) {
+                            for (std::int64_t u = begin; u < end; ++u) {
+                                compressed_set_t::encode_list(neighbors + offsets[u],
+                                                              offsets[u + 1] - offsets[u],
+                                                              compressed_data +
+                                                                  compressed_offsets[u]);
+                            }
+                        });
+
+    layout->_compressed_neighbors = std::move(compressed);
+    typename Graph::vertex_set().swap(layout->_vertex_neighbors);
+}
+
+/// Applies the options of the descriptor to the loaded graph
+template <typename Descriptor, typename Graph>
+void postprocess_impl(const Descriptor &desc, Graph &g) {
+    reorder_vertices_impl(desc.get_vertex_ordering(), g);
+    if (desc.get_neighbor_compression()) {
+        compress_neighbors_impl(g);
+    }
+}
 
 template <typename Descriptor, typename DataSource>
 output_type<Descriptor> load_impl(const Descriptor &desc, const DataSource &data_source) {
     output_type<Descriptor> graph;
     convert_to_csr_impl(load_edge_list(data_source.get_filename()), graph);
+    postprocess_impl(desc, graph);
+    return graph;
+}
+
+template <typename Descriptor>
+output_type<Descriptor> load_impl(const Descriptor &desc,
+                                  const graph_binary_data_source &data_source) {
+    output_type<Descriptor> graph;
+    load_binary_impl(data_source.get_filename(), graph);
+    postprocess_impl(desc, graph);
     return graph;
 }
 } // namespace oneapi::dal::preview::load_graph::detail
@@ -16,8 +16,25 @@
 
 #pragma once
 
+#include <string>
+
 #include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/graph/graph_common.hpp"
 
 namespace oneapi::dal::preview::load_graph::detail {
 ONEAPI_DAL_EXPORT int daal_string_to_int(const char *nptr, char **endptr);
+
+/// Reads the edge list from the text file with one edge per line. The file is
+/// memory-mapped, split into newline-aligned chunks and the chunks are parsed
+/// in parallel directly into the resulting edge list. Every non-empty line
+/// starts with two non-negative vertex indices delimited by spaces, tabs or
+/// commas; the rest of the line after a delimiter is ignored.
+///
+/// @param [in] name The name of the file
+///
+/// @return The edge list in the order of the lines of the file
+///
+/// @throws invalid_argument if a line is malformed, an index is negative or
+///         exceeds the range of std::int32_t
+ONEAPI_DAL_EXPORT edge_list<std::int32_t> load_edge_list(const std::string &name);
 } // namespace oneapi::dal::preview::load_graph::detail
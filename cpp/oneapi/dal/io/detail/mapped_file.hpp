@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::detail {
+
+/// Read-only memory mapping of the whole file
+class mapped_file {
+public:
+    explicit mapped_file(const std::string& name) {
+#if defined(_WIN32) || defined(_WIN64)
+        file_ = CreateFileA(name.c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            nullptr,
+                            OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN,
+                            nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            throw invalid_argument("File not found");
+        }
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_, &file_size)) {
+            CloseHandle(file_);
+            throw invalid_argument("Cannot get the size of the file");
+        }
+        size_ = static_cast<std::size_t>(file_size.QuadPart);
+        if (size_ == 0) {
+            return;
+        }
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr) {
+            CloseHandle(file_);
+            throw invalid_argument("Cannot map the file");
+        }
+        data_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_ == nullptr) {
+            CloseHandle(mapping_);
+            CloseHandle(file_);
+            throw invalid_argument("Cannot map the file");
+        }
+#else
+        file_ = open(name.c_str(), O_RDONLY);
+        if (file_ < 0) {
+            throw invalid_argument("File not found");
+        }
+        struct stat file_stat;
+        if (fstat(file_, &file_stat) != 0) {
+            close(file_);
+            throw invalid_argument("Cannot get the size of the file");
+        }
+        size_ = static_cast<std::size_t>(file_stat.st_size);
+        if (size_ == 0) {
+            return;
+        }
+        void* ptr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_, 0);
+        if (ptr == MAP_FAILED) {
+            close(file_);
+            throw invalid_argument("Cannot map the file");
+        }
+        madvise(ptr, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(ptr);
+#endif
+    }
+
+    ~mapped_file() {
+#if defined(_WIN32) || defined(_WIN64)
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+        }
+        CloseHandle(file_);
+#else
+        if (data_) {
+            munmap(const_cast<char*>(data_), size_);
+        }
+        close(file_);
+#endif
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    const char* get_data() const {
+        return data_;
+    }
+
+    std::size_t get_size() const {
+        return size_;
+    }
+
+private:
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int file_ = -1;
+#endif
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace oneapi::dal::detail
@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace oneapi::dal::detail {
+
+constexpr char table_binary_magic[8] = { 'O', 'D', 'A', 'L', 'T', 'B', 'L', '\0' };
+constexpr std::uint32_t table_binary_version = 1;
+constexpr std::uint32_t table_binary_byte_order = 0x01020304;
+
+/// The payload starts at the page boundary, so the mapped elements are aligned
+/// for any element type and vector loads
+constexpr std::int64_t table_binary_alignment = 4096;
+
+/// The header of the binary table file. The header is followed by the zero
+/// padding up to payload_offset and the payload_size bytes of the elements in
+/// the native byte order of the writer. Row-major tables store the rows one
+/// after another, column-major tables store every column as a contiguous
+/// block. The data type and the layout are the values of the data_type and
+/// data_layout enumerations.
+struct table_binary_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t dtype;
+    std::uint32_t layout;
+    std::int64_t row_count;
+    std::int64_t column_count;
+    std::int64_t payload_offset;
+    std::int64_t payload_size;
+};
+
+} // namespace oneapi::dal::detail
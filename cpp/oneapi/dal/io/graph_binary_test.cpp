@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/graph/graph_service_functions.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/io/save_graph.hpp"
+
+using namespace oneapi::dal;
+using namespace oneapi::dal::preview;
+
+using graph_t = undirected_adjacency_array_graph<>;
+using header_t = load_graph::detail::graph_binary_header;
+
+static std::vector<char> read_file(const std::string& name) {
+    std::ifstream file(name, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file),
+                             std::istreambuf_iterator<char>());
+}
+
+static void write_file(const std::string& name, const std::vector<char>& bytes) {
+    std::ofstream file(name, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), bytes.size());
+}
+
+class graph_binary_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::ofstream csv(csv_name);
+        csv << "0 1\n1 2\n2 0\n2 3\n";
+        csv.close();
+        const auto graph =
+            load_graph::load(load_graph::descriptor<>{}, graph_csv_data_source{ csv_name });
+        save_graph::save(save_graph::descriptor<>{},
+                         graph,
+                         graph_binary_data_source{ binary_name });
+        bytes = read_file(binary_name);
+    }
+
+    void TearDown() override {
+        std::remove(csv_name.c_str());
+        std::remove(binary_name.c_str());
+    }
+
+    graph_t load_binary() const {
+        return load_graph::load(load_graph::descriptor<>{},
+                                graph_binary_data_source{ binary_name });
+    }
+
+    const std::string csv_name = "graph_binary_test.csv";
+    const std::string binary_name = "graph_binary_test.bin";
+    std::vector<char> bytes;
+};
+
+TEST_F(graph_binary_test, restores_saved_graph) {
+    const auto graph = load_binary();
+    ASSERT_EQ(get_vertex_count(graph), 4);
+    ASSERT_EQ(get_edge_count(graph), 4);
+    ASSERT_EQ(get_vertex_degree(graph, 2), 3);
+    ASSERT_EQ(get_vertex_degree(graph, 3), 1);
+}
+
+TEST_F(graph_binary_test, throws_if_file_is_truncated) {
+    bytes.resize(bytes.size() - 1);
+    write_file(binary_name, bytes);
+    ASSERT_THROW(load_binary(), invalid_argument);
+}
+
+TEST_F(graph_binary_test, throws_if_counts_exceed_file) {
+    header_t header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.neighbor_count = std::int64_t(1) << 60;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    write_file(binary_name, bytes);
+    ASSERT_THROW(load_binary(), invalid_argument);
+}
+
+TEST_F(graph_binary_test, throws_if_neighbor_is_not_vertex) {
+    header_t header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    const std::size_t neighbors_offset = sizeof(header) +
+                                         (header.vertex_count + 1) * header.edge_index_size +
+                                         header.vertex_count * header.vertex_index_size;
+    const graph_t::vertex_type vertex = 100;
+    std::memcpy(bytes.data() + neighbors_offset, &vertex, sizeof(vertex));
+    write_file(binary_name, bytes);
+    ASSERT_THROW(load_binary(), invalid_argument);
+}
+
+TEST_F(graph_binary_test, throws_if_offsets_are_not_monotone) {
+    header_t header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    const graph_t::edge_type offset = header.neighbor_count + 1;
+    std::memcpy(bytes.data() + sizeof(header) + header.edge_index_size, &offset, sizeof(offset));
+    write_file(binary_name, bytes);
+    ASSERT_THROW(load_binary(), invalid_argument);
+}
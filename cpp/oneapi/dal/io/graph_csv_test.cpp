@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/detail/load_graph_service.hpp"
+
+using namespace oneapi::dal;
+using namespace oneapi::dal::preview;
+
+class graph_csv_test : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::remove(name.c_str());
+    }
+
+    edge_list<std::int32_t> load(const std::string& text) const {
+        std::ofstream file(name, std::ios::binary | std::ios::trunc);
+        file << text;
+        file.close();
+        return load_graph::detail::load_edge_list(name);
+    }
+
+    const std::string name = "graph_csv_test.csv";
+};
+
+TEST_F(graph_csv_test, parses_edges_with_separators_and_empty_lines) {
+    const auto edges = load("0 1\n\n  12345678\t2147483647\r\n3,4 0.5\n\n5 6");
+    ASSERT_EQ(edges.size(), 4);
+    ASSERT_EQ(edges[0], std::make_pair(0, 1));
+    ASSERT_EQ(edges[1], std::make_pair(12345678, 2147483647));
+    ASSERT_EQ(edges[2], std::make_pair(3, 4));
+    ASSERT_EQ(edges[3], std::make_pair(5, 6));
+}
+
+TEST_F(graph_csv_test, parses_every_line_of_large_file) {
+    std::string text;
+    constexpr std::int32_t edge_count = 300000;
+    for (std::int32_t i = 0; i < edge_count; ++i) {
+        text += std::to_string(i) + " " + std::to_string(i + 1) + "\n";
+    }
+    const auto edges = load(text);
+    ASSERT_EQ(edges.size(), edge_count);
+    for (std::int32_t i = 0; i < edge_count; ++i) {
+        ASSERT_EQ(edges[i], std::make_pair(i, i + 1));
+    }
+}
+
+TEST_F(graph_csv_test, throws_if_line_has_comment) {
+    ASSERT_THROW(load("0 1\n# 1 2\n"), invalid_argument);
+}
+
+TEST_F(graph_csv_test, throws_if_vertex_has_letters) {
+    ASSERT_THROW(load("a1 b2\n"), invalid_argument);
+    ASSERT_THROW(load("1a 2\n"), invalid_argument);
+    ASSERT_THROW(load("1 2b\n"), invalid_argument);
+}
+
+TEST_F(graph_csv_test, throws_if_line_has_single_vertex) {
+    ASSERT_THROW(load("0 1\n2\n"), invalid_argument);
+}
+
+TEST_F(graph_csv_test, throws_if_vertex_is_negative) {
+    ASSERT_THROW(load("0 -1\n"), invalid_argument);
+}
+
+TEST_F(graph_csv_test, throws_if_vertex_overflows) {
+    ASSERT_THROW(load("2147483648 0\n"), invalid_argument);
+    ASSERT_THROW(load("0 123456789012\n"), invalid_argument);
+}
@@ -24,6 +24,17 @@
 
 namespace oneapi::dal::preview::load_graph {
 
+/// The order of the vertices in the loaded graph
+enum class vertex_ordering {
+    /// The vertices keep the indices of the source data
+    none,
+    /// The vertices are sorted by the degree in descending order
+    degree,
+    /// The vertices are reordered by the Reverse Cuthill-McKee algorithm, so that
+    /// the neighbors of each vertex have close indices
+    rcm
+};
+
 /// A structure, which defines the parameters of the graph loading operation
 ///
 /// @tparam Input  Type of the source data
@@ -32,6 +43,33 @@ template <typename Input = edge_list<int32_t>, typename Output = undirected_adja
 struct descriptor {
     using input_type = Input;
     using output_type = Output;
+
+    /// The order of the vertices in the loaded graph. The original index of
+    /// the vertex is returned by the get_original_vertex function.
+    vertex_ordering get_vertex_ordering() const {
+        return ordering;
+    }
+
+    auto& set_vertex_ordering(vertex_ordering value) {
+        ordering = value;
+        return *this;
+    }
+
+    /// The flag that the adjacency lists of the loaded graph are stored
+    /// compressed. The compressed graph takes 2-4 times less memory, its
+    /// neighbors are decoded on the fly by the algorithms.
+    bool get_neighbor_compression() const {
+        return compression;
+    }
+
+    auto& set_neighbor_compression(bool value) {
+        compression = value;
+        return *this;
+    }
+
+private:
+    vertex_ordering ordering = vertex_ordering::none;
+    bool compression = false;
 };
 
 /// Type of the descriptor output format
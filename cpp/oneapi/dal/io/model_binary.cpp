@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <fstream>
+#include <memory>
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/detail/mapped_file.hpp"
+#include "oneapi/dal/io/model_binary.hpp"
+
+namespace oneapi::dal::detail {
+
+void write_binary_file(const array<byte_t>& data, const std::string& file_name) {
+    std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw invalid_argument("Cannot open the file for writing");
+    }
+    file.write(reinterpret_cast<const char*>(data.get_data()), data.get_count());
+    if (!file.good()) {
+        throw invalid_argument("Cannot write the model to the file");
+    }
+}
+
+array<byte_t> map_binary_file(const std::string& file_name) {
+    auto file = std::make_shared<mapped_file>(file_name);
+    const auto data = reinterpret_cast<const byte_t*>(file->get_data());
+
+    // The deleter owns the mapping, so the file stays mapped while the data
+    // is referenced
+    return array<byte_t>{ data, std::int64_t(file->get_size()), [file](const byte_t*) {} };
+}
+
+} // namespace oneapi::dal::detail
@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/// @file
+/// Contains the definition of the binary model file functionality
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/serialization.hpp"
+
+namespace oneapi::dal {
+
+namespace detail {
+
+ONEAPI_DAL_EXPORT void write_binary_file(const array<byte_t>& data, const std::string& file_name);
+ONEAPI_DAL_EXPORT array<byte_t> map_binary_file(const std::string& file_name);
+
+} // namespace detail
+
+/// Writes the model serialized by serialize() to the file
+///
+/// @param [in] object    The model of kmeans, knn, svm, decision_forest or pca
+/// @param [in] file_name The name of the file
+/// @param [in] method    The compression of the serialized data
+template <typename Object>
+void save_model(const Object& object,
+                const std::string& file_name,
+                compression_method method = compression_method::none) {
+    detail::write_binary_file(serialize(object, method), file_name);
+}
+
+/// Reads the model written by save_model(). The file is memory-mapped and the
+/// tables of the uncompressed model refer to the mapped data without copying,
+/// the mapping is released when the model and its tables are destroyed.
+///
+/// @param [in]  file_name The name of the file
+/// @param [out] object    The model of the same type as the saved one
+template <typename Object>
+void load_model(const std::string& file_name, Object& object) {
+    deserialize(detail::map_binary_file(file_name), object);
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+/// Reads the model written by save_model() and uploads its data to the device
+/// of the queue with a single transfer from the mapped file
+template <typename Object>
+void load_model(sycl::queue& queue, const std::string& file_name, Object& object) {
+    deserialize(queue, detail::map_binary_file(file_name), object);
+}
+#endif
+
+} // namespace oneapi::dal
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/// @file
+/// Contains the definition of the graph saving functionality
+
+#pragma once
+
+#include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
+#include "oneapi/dal/io/detail/graph_binary_format.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
+#include "oneapi/dal/io/save_graph_descriptor.hpp"
+
+namespace oneapi::dal::preview::save_graph {
+
+/// Writes the graph to the data source specified in the descriptor in the
+/// binary CSR format, which is read back by load_graph::load
+///
+/// @tparam Descriptor Type of the operation descriptor
+/// @tparam DataSource Type of the data source
+/// @param [in] desc   The descriptor of the operation
+/// @param [in] graph  The graph to save
+/// @param [in] data_source The data source
+template <typename Descriptor = descriptor<>, typename DataSource = graph_binary_data_source>
+ONEAPI_DAL_EXPORT void save(const Descriptor &desc,
+                            const input_type<Descriptor> &graph,
+                            const DataSource &data_source) {
+    load_graph::detail::save_binary_impl(graph, data_source.get_filename());
+}
+} // namespace oneapi::dal::preview::save_graph
@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/// @file
+/// Types and descriptors of the operations for graph saving functionality
+
+#pragma once
+
+#include "oneapi/dal/graph/graph_common.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
+
+namespace oneapi::dal::preview::save_graph {
+
+/// A structure, which defines the parameters of the graph saving operation
+///
+/// @tparam Input  Type of the graph to save
+template <typename Input = undirected_adjacency_array_graph<>>
+struct descriptor {
+    using input_type = Input;
+};
+
+/// Type of the descriptor input format
+/// @tparam Descriptor  Type of the descriptor
+template <typename Descriptor>
+using input_type = typename Descriptor::input_type;
+
+} // namespace oneapi::dal::preview::save_graph
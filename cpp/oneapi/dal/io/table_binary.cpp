@@ -0,0 +1,174 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/detail/mapped_file.hpp"
+#include "oneapi/dal/io/detail/table_binary_format.hpp"
+#include "oneapi/dal/io/table_binary.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal {
+
+namespace {
+
+inline std::int64_t align_up(std::int64_t value, std::int64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// The element types of homogen tables
+inline bool is_supported_data_type(std::uint32_t dtype) {
+    switch (static_cast<data_type>(dtype)) {
+        case data_type::int32:
+        case data_type::int64:
+        case data_type::uint32:
+        case data_type::uint64:
+        case data_type::float32:
+        case data_type::float64: return true;
+        default: return false;
+    }
+}
+
+inline bool is_supported_layout(std::uint32_t layout) {
+    return layout == static_cast<std::uint32_t>(data_layout::row_major) ||
+           layout == static_cast<std::uint32_t>(data_layout::column_major);
+}
+
+/// Computes the byte size of the elements, the counts are non-negative
+inline std::int64_t get_payload_size(std::int64_t row_count,
+                                     std::int64_t column_count,
+                                     std::int64_t element_size) {
+    constexpr std::int64_t max_size = std::numeric_limits<std::int64_t>::max();
+    if (row_count > 0 && column_count > max_size / element_size / row_count) {
+        throw invalid_argument("The size of the binary table overflows");
+    }
+    return row_count * column_count * element_size;
+}
+
+/// Wraps the mapped elements into the table without copying
+template <typename Data>
+homogen_table wrap_mapped_data(const std::shared_ptr<detail::mapped_file>& file,
+                               const detail::table_binary_header& header) {
+    const Data* data = reinterpret_cast<const Data*>(file->get_data() + header.payload_offset);
+
+    // The deleter owns the mapping, so the file stays mapped while the
+    // elements are referenced
+    const array<Data> elements{ data,
+                                header.row_count * header.column_count,
+                                [file](const Data*) {} };
+    return detail::homogen_table_builder{}
+        .reset(elements, header.row_count, header.column_count)
+        .set_layout(static_cast<data_layout>(header.layout))
+        .build();
+}
+
+homogen_table wrap_mapped_data(const std::shared_ptr<detail::mapped_file>& file,
+                               const detail::table_binary_header& header) {
+    switch (static_cast<data_type>(header.dtype)) {
+        case data_type::int32: return wrap_mapped_data<std::int32_t>(file, header);
+        case data_type::int64: return wrap_mapped_data<std::int64_t>(file, header);
+        case data_type::uint32: return wrap_mapped_data<std::uint32_t>(file, header);
+        case data_type::uint64: return wrap_mapped_data<std::uint64_t>(file, header);
+        case data_type::float32: return wrap_mapped_data<float>(file, header);
+        case data_type::float64: return wrap_mapped_data<double>(file, header);
+        default: throw invalid_argument("Unsupported data type of the binary table");
+    }
+}
+
+} // namespace
+
+void write_table(const table& t, const std::string& file_name) {
+    if (t.get_kind() != homogen_table::kind()) {
+        throw invalid_argument("Only homogen tables can be written to the binary file");
+    }
+    const auto& impl = detail::get_impl<detail::homogen_table_impl_iface>(t);
+    const data_type dtype = t.get_metadata().get_data_type(0);
+    if (!is_supported_data_type(static_cast<std::uint32_t>(dtype))) {
+        throw invalid_argument("Unsupported data type of the binary table");
+    }
+
+    detail::table_binary_header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, detail::table_binary_magic, sizeof(header.magic));
+    header.version = detail::table_binary_version;
+    header.byte_order = detail::table_binary_byte_order;
+    header.dtype = static_cast<std::uint32_t>(dtype);
+    header.layout = static_cast<std::uint32_t>(t.get_data_layout());
+    header.row_count = t.get_row_count();
+    header.column_count = t.get_column_count();
+    header.payload_offset = align_up(sizeof(header), detail::table_binary_alignment);
+    header.payload_size = get_payload_size(header.row_count,
+                                           header.column_count,
+                                           detail::get_data_type_size(dtype));
+
+    std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw invalid_argument("Cannot open the file for writing");
+    }
+    const std::vector<char> padding(header.payload_offset - sizeof(header), 0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(padding.data(), padding.size());
+    file.write(static_cast<const char*>(impl.get_data()), header.payload_size);
+    if (!file.good()) {
+        throw invalid_argument("Cannot write the table to the file");
+    }
+}
+
+homogen_table read_table(const std::string& file_name) {
+    auto file = std::make_shared<detail::mapped_file>(file_name);
+
+    detail::table_binary_header header;
+    const std::int64_t file_size = file->get_size();
+    if (file_size < static_cast<std::int64_t>(sizeof(header))) {
+        throw invalid_argument("The file does not contain the table in the binary format");
+    }
+    std::memcpy(&header, file->get_data(), sizeof(header));
+    if (std::memcmp(header.magic, detail::table_binary_magic, sizeof(header.magic)) != 0) {
+        throw invalid_argument("The file does not contain the table in the binary format");
+    }
+    if (header.version != detail::table_binary_version) {
+        throw invalid_argument("Unsupported version of the binary table format");
+    }
+    if (header.byte_order != detail::table_binary_byte_order) {
+        throw invalid_argument("Byte order of the binary table does not match the platform");
+    }
+    if (!is_supported_data_type(header.dtype) || !is_supported_layout(header.layout) ||
+        header.row_count < 0 || header.column_count < 0 ||
+        header.payload_offset < static_cast<std::int64_t>(sizeof(header)) ||
+        header.payload_offset % detail::table_binary_alignment != 0) {
+        throw invalid_argument("Corrupted binary table header");
+    }
+    const std::int64_t element_size =
+        detail::get_data_type_size(static_cast<data_type>(header.dtype));
+    if (header.payload_size !=
+        get_payload_size(header.row_count, header.column_count, element_size)) {
+        throw invalid_argument("Corrupted binary table header");
+    }
+    if (header.payload_offset > file_size ||
+        header.payload_size > file_size - header.payload_offset) {
+        throw invalid_argument("Unexpected end of the binary table file");
+    }
+
+    return wrap_mapped_data(file, header);
+}
+
+} // namespace oneapi::dal
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/// @file
+/// Contains the definition of the binary table file functionality
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/table/homogen.hpp"
+
+namespace oneapi::dal {
+
+/// Writes the homogen table to the file in the binary format with the shape,
+/// the data type and the layout in the header and the elements of the table
+/// as they are stored in memory, aligned to the page boundary
+///
+/// @param [in] t         The homogen table with the data in host memory
+/// @param [in] file_name The name of the file
+ONEAPI_DAL_EXPORT void write_table(const table& t, const std::string& file_name);
+
+/// Reads the table written by write_table(). The file is memory-mapped and
+/// the table refers to the mapped elements without copying, so the processes
+/// that read the same file share its pages in the page cache. The mapping is
+/// released when the table and its copies are destroyed.
+///
+/// @param [in] file_name The name of the file
+///
+/// @return The read-only homogen table with the data type and the layout of
+///         the written table
+ONEAPI_DAL_EXPORT homogen_table read_table(const std::string& file_name);
+
+} // namespace oneapi::dal
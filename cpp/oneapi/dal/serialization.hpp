@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the definition of the serialization of the models
+
+#pragma once
+
+#include "oneapi/dal/detail/archives.hpp"
+
+namespace oneapi::dal {
+
+/// Serializes the model into the binary format. The arrays of the model are
+/// aligned in the result, so the uncompressed model written to the file can be
+/// memory-mapped and read without copying its data.
+///
+/// @param [in] object The model of kmeans, knn, svm, decision_forest or pca
+/// @param [in] method The compression of the serialized data
+///
+/// @return The serialized data in host memory
+template <typename Object>
+array<byte_t> serialize(const Object& object,
+                        compression_method method = compression_method::none) {
+    detail::binary_output_archive ar;
+    detail::serialization_accessor{}.serialize(object, ar);
+    return ar.to_array(method);
+}
+
+/// Restores the model from the data written by serialize(). The tables of the
+/// model refer to the uncompressed data without copying and share its ownership.
+///
+/// @param [in]  data   The serialized data in host memory
+/// @param [out] object The model of the same type as the serialized one
+template <typename Object>
+void deserialize(const array<byte_t>& data, Object& object) {
+    detail::binary_input_archive ar{ data };
+    detail::serialization_accessor{}.deserialize(object, ar);
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+/// Restores the model from the data written by serialize() and uploads the
+/// data to the device of the queue with a single transfer, the tables of the
+/// model refer to the device memory
+template <typename Object>
+void deserialize(sycl::queue& queue, const array<byte_t>& data, Object& object) {
+    detail::binary_input_archive ar{ queue, data };
+    detail::serialization_accessor{}.deserialize(object, ar);
+}
+#endif
+
+} // namespace oneapi::dal
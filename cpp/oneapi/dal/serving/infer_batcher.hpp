@@ -0,0 +1,285 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::serving {
+
+class infer_batcher_options {
+public:
+    /// The largest number of the rows of one batch
+    std::int64_t max_batch_size = 256;
+
+    /// The longest time the first request of the batch waits for the others
+    std::chrono::microseconds max_latency{ 1000 };
+
+    /// The batch size grows while the requests queue up behind the full
+    /// batches and shrinks to the rows of the batches run by max_latency, so
+    /// under the low load the requests do not wait for the batches that never
+    /// fill up. The batch size is max_batch_size if it is false.
+    bool adaptive = true;
+};
+
+class infer_batcher_stats {
+public:
+    /// The number of the bins of the latency histogram
+    static constexpr std::int64_t bin_count = 32;
+
+    /// The bin i counts the requests completed in [2^i, 2^(i + 1))
+    /// microseconds after the submission, the bin 0 also counts the faster ones
+    std::vector<std::int64_t> latency_histogram = std::vector<std::int64_t>(bin_count, 0);
+
+    std::int64_t request_count = 0;
+    std::int64_t batch_count = 0;
+
+    /// The batch size the batcher waits for at the moment
+    std::int64_t batch_size = 0;
+};
+
+/// Accumulates the concurrent single-row requests into the batches and runs
+/// the batched inference on them in the background thread. The batch is run
+/// once it has the batch size rows or its first request waits max_latency.
+/// The inference function takes the table of the rows of the batch and
+/// returns the table of the results of the same row count, e.g.
+///
+///     infer_batcher<float> batcher{ column_count, [=](const table& x) {
+///         return dal::infer(desc, model, x).get_labels();
+///     } };
+///     std::future<array<float>> labels = batcher.submit(row);
+///
+/// The future of the request gets the row of the results, or the exception
+/// thrown by the inference function. submit() is thread-safe.
+template <typename Float = float>
+class infer_batcher {
+public:
+    using infer_function_t = std::function<table(const table&)>;
+
+    infer_batcher(std::int64_t column_count,
+                  const infer_function_t& infer_function,
+                  const infer_batcher_options& options = infer_batcher_options{})
+            : column_count_(column_count),
+              infer_function_(infer_function),
+              options_(options),
+              batch_size_(1),
+              stopped_(false) {
+        if (column_count <= 0) {
+            throw invalid_argument("Column count should be > 0");
+        }
+        if (options.max_batch_size <= 0) {
+            throw invalid_argument("Max batch size should be > 0");
+        }
+        if (!infer_function) {
+            throw invalid_argument("Infer function should not be empty");
+        }
+        batch_size_ = options_.adaptive ? 1 : options_.max_batch_size;
+        worker_ = std::thread([this]() {
+            run();
+        });
+    }
+
+    /// Runs the remaining requests, then stops the background thread
+    ~infer_batcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_ = true;
+        }
+        has_requests_.notify_all();
+        worker_.join();
+    }
+
+    infer_batcher(const infer_batcher&) = delete;
+    infer_batcher& operator=(const infer_batcher&) = delete;
+
+    std::int64_t get_column_count() const {
+        return column_count_;
+    }
+
+    /// Copies the row of column_count values and submits it to the next batch
+    std::future<array<Float>> submit(const Float* row) {
+        request req;
+        req.row.assign(row, row + column_count_);
+        req.submitted = steady_clock_t::now();
+        std::future<array<Float>> result = req.promise.get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopped_) {
+                throw invalid_argument("Batcher is stopped");
+            }
+            requests_.push_back(std::move(req));
+        }
+        has_requests_.notify_one();
+        return result;
+    }
+
+    infer_batcher_stats get_stats() const {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        infer_batcher_stats stats = stats_;
+        stats.batch_size = batch_size_.load();
+        return stats;
+    }
+
+private:
+    using steady_clock_t = std::chrono::steady_clock;
+
+    struct request {
+        std::vector<Float> row;
+        std::promise<array<Float>> promise;
+        steady_clock_t::time_point submitted;
+    };
+
+    void run() {
+        std::vector<request> batch;
+        for (;;) {
+            bool has_backlog = false;
+            bool is_late = false;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                has_requests_.wait(lock, [this]() {
+                    return stopped_ || !requests_.empty();
+                });
+                if (requests_.empty()) {
+                    return;
+                }
+
+                // The batch waits for the batch size rows or till its first
+                // request waits max_latency, the stop runs it at once
+                const std::int64_t batch_size = batch_size_.load();
+                const auto deadline = requests_.front().submitted + options_.max_latency;
+                has_requests_.wait_until(lock, deadline, [&]() {
+                    return stopped_ || std::int64_t(requests_.size()) >= batch_size;
+                });
+
+                const std::int64_t count = std::min<std::int64_t>(requests_.size(), batch_size);
+                batch.clear();
+                for (std::int64_t i = 0; i < count; i++) {
+                    batch.push_back(std::move(requests_.front()));
+                    requests_.pop_front();
+                }
+                has_backlog = !requests_.empty();
+                is_late = !stopped_ && count < batch_size;
+            }
+            run_batch(batch);
+            adapt_batch_size(has_backlog, is_late, batch.size());
+        }
+    }
+
+    void run_batch(std::vector<request>& batch) {
+        const std::int64_t row_count = batch.size();
+        std::vector<Float> rows(row_count * column_count_);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            std::copy(batch[i].row.begin(), batch[i].row.end(), rows.begin() + i * column_count_);
+        }
+
+        std::vector<array<Float>> results;
+        std::exception_ptr error;
+        try {
+            const auto x = homogen_table::wrap(rows.data(), row_count, column_count_);
+            const table result = infer_function_(x);
+            if (result.get_row_count() != row_count) {
+                throw invalid_argument("Infer function should return the result of every row");
+            }
+            const auto values = row_accessor<const Float>{ result }.pull();
+            const std::int64_t result_column_count = result.get_column_count();
+            for (std::int64_t i = 0; i < row_count; i++) {
+                auto row = array<Float>::empty(result_column_count);
+                std::copy(values.get_data() + i * result_column_count,
+                          values.get_data() + (i + 1) * result_column_count,
+                          row.get_mutable_data());
+                results.push_back(row);
+            }
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        // The statistics are updated before the futures are ready, so they
+        // count every request completed for the caller
+        update_stats(batch, steady_clock_t::now());
+        for (std::int64_t i = 0; i < row_count; i++) {
+            if (error) {
+                batch[i].promise.set_exception(error);
+            }
+            else {
+                batch[i].promise.set_value(results[i]);
+            }
+        }
+    }
+
+    void update_stats(const std::vector<request>& batch, steady_clock_t::time_point completed) {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        for (const auto& req : batch) {
+            const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                completed - req.submitted);
+            std::int64_t bin = 0;
+            while (bin + 1 < infer_batcher_stats::bin_count &&
+                   (std::int64_t(2) << bin) <= latency.count()) {
+                bin++;
+            }
+            stats_.latency_histogram[bin]++;
+        }
+        stats_.request_count += batch.size();
+        stats_.batch_count++;
+    }
+
+    /// Doubles the batch size while the requests queue up behind the batches
+    /// and shrinks it to the rows of the batch run by the latency deadline
+    void adapt_batch_size(bool has_backlog, bool is_late, std::int64_t row_count) {
+        if (!options_.adaptive) {
+            return;
+        }
+        const std::int64_t batch_size = batch_size_.load();
+        if (has_backlog) {
+            batch_size_ = std::min(batch_size * 2, options_.max_batch_size);
+        }
+        else if (is_late) {
+            batch_size_ = std::max<std::int64_t>(row_count, 1);
+        }
+    }
+
+    const std::int64_t column_count_;
+    const infer_function_t infer_function_;
+    const infer_batcher_options options_;
+
+    std::atomic<std::int64_t> batch_size_;
+    bool stopped_;
+    std::deque<request> requests_;
+    std::mutex mutex_;
+    std::condition_variable has_requests_;
+
+    mutable std::mutex stats_mutex_;
+    infer_batcher_stats stats_;
+
+    std::thread worker_;
+};
+
+} // namespace oneapi::dal::serving
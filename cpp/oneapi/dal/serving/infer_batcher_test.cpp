@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <numeric>
+
+#include "oneapi/dal/serving/infer_batcher.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+using namespace oneapi::dal::serving;
+
+// Returns the table of the sums of the rows
+static table sum_rows(const table& x) {
+    const auto values = row_accessor<const float>{ x }.pull();
+    const std::int64_t row_count = x.get_row_count();
+    const std::int64_t column_count = x.get_column_count();
+    auto sums = array<float>::empty(row_count);
+    float* sums_data = sums.get_mutable_data();
+    for (std::int64_t i = 0; i < row_count; i++) {
+        sums_data[i] = std::accumulate(values.get_data() + i * column_count,
+                                       values.get_data() + (i + 1) * column_count,
+                                       0.0f);
+    }
+    return homogen_table{ sums.get_data(), row_count, 1, [sums](const float*) {} };
+}
+
+TEST(infer_batcher_test, returns_results_of_concurrent_requests) {
+    constexpr std::int64_t column_count = 3;
+    constexpr std::int64_t thread_count = 8;
+    constexpr std::int64_t request_count = 200;
+
+    infer_batcher_options options;
+    options.max_batch_size = 16;
+    infer_batcher<float> batcher{ column_count, sum_rows, options };
+
+    std::vector<std::thread> threads;
+    std::vector<int> is_correct(thread_count, 1);
+    for (std::int64_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t]() {
+            for (std::int64_t i = 0; i < request_count; i++) {
+                const float row[column_count] = { float(t), float(i), 1.0f };
+                const auto result = batcher.submit(row).get();
+                if (result.get_count() != 1 || result[0] != float(t + i + 1)) {
+                    is_correct[t] = 0;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (std::int64_t t = 0; t < thread_count; t++) {
+        ASSERT_TRUE(is_correct[t]);
+    }
+
+    const auto stats = batcher.get_stats();
+    ASSERT_EQ(stats.request_count, thread_count * request_count);
+    ASSERT_LE(stats.batch_count, stats.request_count);
+    ASSERT_GE(stats.batch_size, 1);
+    ASSERT_LE(stats.batch_size, options.max_batch_size);
+    ASSERT_EQ(std::accumulate(stats.latency_histogram.begin(), stats.latency_histogram.end(),
+                              std::int64_t(0)),
+              stats.request_count);
+}
+
+TEST(infer_batcher_test, runs_single_request_by_latency_deadline) {
+    infer_batcher_options options;
+    options.adaptive = false;
+    options.max_batch_size = 64;
+    options.max_latency = std::chrono::microseconds{ 100 };
+    infer_batcher<float> batcher{ 2, sum_rows, options };
+
+    const float row[] = { 1.0f, 2.0f };
+    const auto result = batcher.submit(row).get();
+
+    ASSERT_EQ(result.get_count(), 1);
+    ASSERT_FLOAT_EQ(result[0], 3.0f);
+    ASSERT_EQ(batcher.get_stats().batch_count, 1);
+    ASSERT_EQ(batcher.get_stats().batch_size, 64);
+}
+
+TEST(infer_batcher_test, passes_exception_of_infer_function_to_requests) {
+    infer_batcher<float> batcher{ 2, [](const table&) -> table {
+                                     throw invalid_argument("Failed inference");
+                                 } };
+
+    const float row[] = { 1.0f, 2.0f };
+    auto result = batcher.submit(row);
+
+    ASSERT_THROW(result.get(), invalid_argument);
+}
+
+TEST(infer_batcher_test, throws_if_column_count_is_not_positive) {
+    ASSERT_THROW((infer_batcher<float>{ 0, sum_rows }), invalid_argument);
+}
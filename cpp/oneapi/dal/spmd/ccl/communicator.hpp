@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <oneapi/ccl.hpp>
+
+#include "oneapi/dal/spmd/communicator.hpp"
+
+namespace oneapi::dal::spmd::ccl {
+
+namespace detail {
+
+inline ::ccl::datatype make_ccl_data_type(data_type dtype) {
+    switch (dtype) {
+        case data_type::int32: return ::ccl::datatype::int32;
+        case data_type::int64: return ::ccl::datatype::int64;
+        case data_type::uint32: return ::ccl::datatype::uint32;
+        case data_type::uint64: return ::ccl::datatype::uint64;
+        case data_type::float32: return ::ccl::datatype::float32;
+        case data_type::float64: return ::ccl::datatype::float64;
+        default: throw unimplemented("Data type is not supported by the oneCCL communicator");
+    }
+}
+
+} // namespace detail
+
+/// The communicator over the ranks of the oneCCL communicator. The header is
+/// not included by the library, so the library itself does not depend on
+/// oneCCL. The communicator created with the queue runs the collectives on the
+/// stream of the queue, so the device USM buffers are exchanged between the
+/// devices without the copies through the host.
+class communicator_impl : public communicator_iface {
+public:
+    explicit communicator_impl(::ccl::communicator&& comm)
+            : comm_(std::make_shared<::ccl::communicator>(std::move(comm))) {}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    communicator_impl(::ccl::communicator&& comm, sycl::queue& queue)
+            : comm_(std::make_shared<::ccl::communicator>(std::move(comm))),
+              stream_(std::make_shared<::ccl::stream>(::ccl::create_stream(queue))) {}
+#endif
+
+    std::int64_t get_rank() const override {
+        return comm_->rank();
+    }
+
+    std::int64_t get_rank_count() const override {
+        return comm_->size();
+    }
+
+    void barrier() override {
+        ::ccl::barrier(*comm_).wait();
+    }
+
+    void allreduce_sum(void* buf, std::int64_t count, data_type dtype) override {
+        ::ccl::allreduce(buf,
+                         buf,
+                         std::size_t(count),
+                         detail::make_ccl_data_type(dtype),
+                         ::ccl::reduction::sum,
+                         *comm_)
+            .wait();
+    }
+
+    void allgather(const void* send_buf, std::int64_t size, void* recv_buf) override {
+        const std::vector<std::size_t> recv_counts(get_rank_count(), std::size_t(size));
+        ::ccl::allgatherv(send_buf,
+                          std::size_t(size),
+                          recv_buf,
+                          recv_counts,
+                          ::ccl::datatype::int8,
+                          *comm_)
+            .wait();
+    }
+
+    void bcast(void* buf, std::int64_t size, std::int64_t root) override {
+        ::ccl::broadcast(buf, std::size_t(size), ::ccl::datatype::int8, int(root), *comm_).wait();
+    }
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    bool is_device_aware() const override {
+        return bool(stream_);
+    }
+
+    void allreduce_sum(sycl::queue& queue,
+                       void* usm_buf,
+                       std::int64_t count,
+                       data_type dtype) override {
+        if (!stream_) {
+            communicator_iface::allreduce_sum(queue, usm_buf, count, dtype);
+            return;
+        }
+        queue.wait_and_throw();
+        ::ccl::allreduce(usm_buf,
+                         usm_buf,
+                         std::size_t(count),
+                         detail::make_ccl_data_type(dtype),
+                         ::ccl::reduction::sum,
+                         *comm_,
+                         *stream_)
+            .wait();
+    }
+#endif
+
+private:
+    std::shared_ptr<::ccl::communicator> comm_;
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    std::shared_ptr<::ccl::stream> stream_;
+#endif
+};
+
+inline spmd::communicator make_communicator(::ccl::communicator&& comm) {
+    return spmd::communicator{ std::make_shared<communicator_impl>(std::move(comm)) };
+}
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+inline spmd::communicator make_communicator(::ccl::communicator&& comm, sycl::queue& queue) {
+    return spmd::communicator{ std::make_shared<communicator_impl>(std::move(comm), queue) };
+}
+#endif
+
+} // namespace oneapi::dal::spmd::ccl
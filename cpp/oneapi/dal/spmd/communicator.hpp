@@ -0,0 +1,144 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/dal/common.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::spmd {
+
+/// The collective operations over the processes of the SPMD (single program,
+/// multiple data) run, e.g. the ones of MPI or oneCCL. Every process calls the
+/// same collectives in the same order with the buffers of the same sizes.
+class ONEAPI_DAL_EXPORT communicator_iface {
+public:
+    virtual ~communicator_iface() = default;
+
+    /// The index of this process in [0, rank_count)
+    virtual std::int64_t get_rank() const = 0;
+    virtual std::int64_t get_rank_count() const = 0;
+
+    virtual void barrier() = 0;
+
+    /// Replaces the count values of the buffer by their sums over all processes
+    virtual void allreduce_sum(void* buf, std::int64_t count, data_type dtype) = 0;
+
+    /// Collects the size bytes of every process into recv_buf in the order of
+    /// the ranks, recv_buf takes size x rank_count bytes
+    virtual void allgather(const void* send_buf, std::int64_t size, void* recv_buf) = 0;
+
+    /// Copies the size bytes of the root process into the buffers of the others
+    virtual void bcast(void* buf, std::int64_t size, std::int64_t root) = 0;
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    /// Checks that the collectives take the device USM memory as is, e.g. the
+    /// ones of oneCCL or GPU-aware MPI
+    virtual bool is_device_aware() const {
+        return false;
+    }
+
+    /// The allreduce of the USM buffer once the kernels submitted to the queue
+    /// complete. The buffers are copied through the host unless the
+    /// communicator is device-aware.
+    virtual void allreduce_sum(sycl::queue& queue,
+                               void* usm_buf,
+                               std::int64_t count,
+                               data_type dtype) {
+        queue.wait_and_throw();
+        const auto kind = sycl::get_pointer_type(usm_buf, queue.get_context());
+        if (is_device_aware() || kind != sycl::usm::alloc::device) {
+            allreduce_sum(usm_buf, count, dtype);
+            return;
+        }
+        const std::int64_t size = count * dal::detail::get_data_type_size(dtype);
+        std::vector<byte_t> host_buf(size);
+        queue.memcpy(host_buf.data(), usm_buf, size).wait_and_throw();
+        allreduce_sum(host_buf.data(), count, dtype);
+        queue.memcpy(usm_buf, host_buf.data(), size).wait_and_throw();
+    }
+#endif
+};
+
+/// The communicator the algorithms use under the SPMD policy, it shares the
+/// ownership of the backend implementation
+class communicator {
+public:
+    explicit communicator(const std::shared_ptr<communicator_iface>& impl) : impl_(impl) {
+        if (!impl_) {
+            throw invalid_argument("Communicator implementation should not be null");
+        }
+    }
+
+    std::int64_t get_rank() const {
+        return impl_->get_rank();
+    }
+
+    std::int64_t get_rank_count() const {
+        return impl_->get_rank_count();
+    }
+
+    bool is_root_rank() const {
+        return get_rank() == 0;
+    }
+
+    void barrier() const {
+        impl_->barrier();
+    }
+
+    template <typename T>
+    void allreduce(T* values, std::int64_t count) const {
+        impl_->allreduce_sum(values, count, dal::detail::make_data_type<T>());
+    }
+
+    /// Returns the count values of every process in the order of the ranks
+    template <typename T>
+    std::vector<T> allgather(const T* values, std::int64_t count) const {
+        std::vector<T> result(count * get_rank_count());
+        impl_->allgather(values, count * sizeof(T), result.data());
+        return result;
+    }
+
+    template <typename T>
+    void bcast(T* values, std::int64_t count, std::int64_t root = 0) const {
+        impl_->bcast(values, count * sizeof(T), root);
+    }
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    template <typename T>
+    void allreduce(sycl::queue& queue, T* usm_values, std::int64_t count) const {
+        impl_->allreduce_sum(queue, usm_values, count, dal::detail::make_data_type<T>());
+    }
+#endif
+
+    const std::shared_ptr<communicator_iface>& get_impl() const noexcept {
+        return impl_;
+    }
+
+private:
+    std::shared_ptr<communicator_iface> impl_;
+};
+
+} // namespace oneapi::dal::spmd
@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <memory>
+
+#include <mpi.h>
+
+#include "oneapi/dal/spmd/communicator.hpp"
+
+namespace oneapi::dal::spmd::mpi {
+
+namespace detail {
+
+inline MPI_Datatype make_mpi_data_type(data_type dtype) {
+    switch (dtype) {
+        case data_type::int32: return MPI_INT32_T;
+        case data_type::int64: return MPI_INT64_T;
+        case data_type::uint32: return MPI_UINT32_T;
+        case data_type::uint64: return MPI_UINT64_T;
+        case data_type::float32: return MPI_FLOAT;
+        case data_type::float64: return MPI_DOUBLE;
+        default: throw unimplemented("Data type is not supported by the MPI communicator");
+    }
+}
+
+inline void check_mpi_status(int status) {
+    if (status != MPI_SUCCESS) {
+        throw internal_error("MPI collective operation failed");
+    }
+}
+
+} // namespace detail
+
+/// The communicator over the processes of the MPI communicator. The header is
+/// not included by the library, so the library itself does not depend on a
+/// particular MPI implementation. MPI is initialized and finalized by the
+/// application.
+class communicator_impl : public communicator_iface {
+public:
+    /// The device_aware flag states that the MPI implementation takes the
+    /// device USM memory, e.g. a GPU-aware build of Intel MPI
+    explicit communicator_impl(MPI_Comm comm = MPI_COMM_WORLD, bool device_aware = false)
+            : comm_(comm),
+              device_aware_(device_aware) {}
+
+    std::int64_t get_rank() const override {
+        int rank = 0;
+        detail::check_mpi_status(MPI_Comm_rank(comm_, &rank));
+        return rank;
+    }
+
+    std::int64_t get_rank_count() const override {
+        int size = 0;
+        detail::check_mpi_status(MPI_Comm_size(comm_, &size));
+        return size;
+    }
+
+    void barrier() override {
+        detail::check_mpi_status(MPI_Barrier(comm_));
+    }
+
+    void allreduce_sum(void* buf, std::int64_t count, data_type dtype) override {
+        detail::check_mpi_status(MPI_Allreduce(MPI_IN_PLACE,
+                                               buf,
+                                               int(count),
+                                               detail::make_mpi_data_type(dtype),
+                                               MPI_SUM,
+                                               comm_));
+    }
+
+    void allgather(const void* send_buf, std::int64_t size, void* recv_buf) override {
+        detail::check_mpi_status(MPI_Allgather(send_buf,
+                                               int(size),
+                                               MPI_BYTE,
+                                               recv_buf,
+                                               int(size),
+                                               MPI_BYTE,
+                                               comm_));
+    }
+
+    void bcast(void* buf, std::int64_t size, std::int64_t root) override {
+        detail::check_mpi_status(MPI_Bcast(buf, int(size), MPI_BYTE, int(root), comm_));
+    }
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    bool is_device_aware() const override {
+        return device_aware_;
+    }
+#endif
+
+private:
+    MPI_Comm comm_;
+    [[maybe_unused]] bool device_aware_;
+};
+
+inline spmd::communicator make_communicator(MPI_Comm comm = MPI_COMM_WORLD,
+                                            bool device_aware = false) {
+    return spmd::communicator{ std::make_shared<communicator_impl>(comm, device_aware) };
+}
+
+} // namespace oneapi::dal::spmd::mpi
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/spmd/communicator.hpp"
+
+namespace oneapi::dal::detail {
+
+/// Runs the algorithm on the local data of every process of the SPMD run. The
+/// processes exchange the partial results through the communicator, so every
+/// process gets the same result computed from the data of all processes.
+template <typename LocalPolicy>
+class spmd_policy : public base {
+public:
+    using local_policy_t = LocalPolicy;
+
+    spmd_policy(const LocalPolicy& local_policy, const spmd::communicator& comm)
+            : local_policy_(local_policy),
+              comm_(comm) {}
+
+    /// The policy of the computations on the local data
+    const LocalPolicy& get_local() const noexcept {
+        return local_policy_;
+    }
+
+    const spmd::communicator& get_communicator() const noexcept {
+        return comm_;
+    }
+
+private:
+    LocalPolicy local_policy_;
+    spmd::communicator comm_;
+};
+
+template <>
+struct is_execution_policy<spmd_policy<host_policy>> : std::bool_constant<true> {};
+
+} // namespace oneapi::dal::detail
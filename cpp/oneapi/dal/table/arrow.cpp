@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/arrow.hpp"
+#include "oneapi/dal/table/backend/arrow_table_impl.hpp"
+
+using std::int64_t;
+
+namespace oneapi::dal {
+
+using arrow_table_wrapper = detail::table_impl_wrapper<backend::arrow_table_impl>;
+
+int64_t arrow_table::kind() {
+    return backend::arrow_table_impl::arrow_table_kind;
+}
+
+arrow_table::arrow_table() {
+    init_impl(new arrow_table_wrapper(backend::arrow_table_impl{}));
+}
+
+arrow_table::arrow_table(ArrowSchema* schema, ArrowArray* batches, int64_t batch_count) {
+    init_impl(new arrow_table_wrapper(backend::arrow_table_impl{ schema, batches, batch_count }));
+}
+
+int64_t arrow_table::get_chunk_count() const {
+    return detail::get_impl<arrow_table_wrapper>(*this).get().get_chunk_count();
+}
+
+} // namespace oneapi::dal
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "oneapi/dal/table/common.hpp"
+
+// The structures of the Arrow C data interface. The definitions are ABI-stable
+// and shared with the Arrow libraries, the guard prevents redefinition when
+// the Arrow headers are included before this one.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE           2
+#define ARROW_FLAG_MAP_KEYS_SORTED    4
+
+extern "C" {
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    std::int64_t flags;
+    std::int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    std::int64_t length;
+    std::int64_t null_count;
+    std::int64_t offset;
+    std::int64_t n_buffers;
+    std::int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+} // extern "C"
+
+#endif // ARROW_C_DATA_INTERFACE
+
+namespace oneapi::dal {
+
+/// The table over the Arrow columnar data exported via the Arrow C data
+/// interface. The column buffers are not copied: the column accessor returns
+/// them directly when the requested rows lie in one chunk, have the requested
+/// data type and contain no nulls. The row-major blocks are materialized on
+/// demand. The table is read-only and available on host only.
+class ONEAPI_DAL_EXPORT arrow_table : public table {
+public:
+    static std::int64_t kind();
+
+public:
+    arrow_table();
+
+    /// Creates the table from the record batches sharing the same schema.
+    /// Each batch is the struct array, its children are the chunks of the
+    /// columns. The supported column formats are "i", "I", "l", "L", "e",
+    /// "f" and "g". Nulls are read as NaN in floating-point blocks and as zero
+    /// in integer blocks.
+    ///
+    /// The table takes the ownership of the schema and the batches even if
+    /// the construction fails: the release callbacks of the passed structures
+    /// are set to null and the table releases the data when it is destroyed.
+    ///
+    /// @param [in,out] schema      The schema of the record batches
+    /// @param [in,out] batches     The array of the record batches
+    /// @param [in]     batch_count The number of the record batches
+    arrow_table(ArrowSchema* schema, ArrowArray* batches, std::int64_t batch_count = 1);
+
+    /// The number of the chunks in every column
+    std::int64_t get_chunk_count() const;
+
+    std::int64_t get_kind() const {
+        return kind();
+    }
+};
+
+} // namespace oneapi::dal
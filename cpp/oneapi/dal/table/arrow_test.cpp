@@ -0,0 +1,275 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "oneapi/dal/table/arrow.hpp"
+#include "oneapi/dal/table/column_accessor.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+using std::int32_t;
+using std::int64_t;
+
+// Produces the Arrow structures over the buffers owned by the test and counts
+// the release callbacks
+class arrow_producer {
+public:
+    void add_field(const char* format) {
+        formats_.push_back(format);
+    }
+
+    void add_batch(int64_t length,
+                   const std::vector<const void*>& values,
+                   const std::vector<const std::uint8_t*>& validity = {},
+                   int64_t offset = 0) {
+        batch_desc desc;
+        desc.length = length;
+        desc.offset = offset;
+        desc.values = values;
+        desc.validity = validity;
+        desc.validity.resize(values.size(), nullptr);
+        batches_.push_back(desc);
+    }
+
+    ArrowSchema* get_schema() {
+        fields_.resize(formats_.size());
+        field_ptrs_.clear();
+        for (std::size_t j = 0; j < formats_.size(); ++j) {
+            fields_[j] = ArrowSchema{
+                formats_[j], "", nullptr, ARROW_FLAG_NULLABLE, 0, nullptr, nullptr, nullptr, nullptr
+            };
+            field_ptrs_.push_back(&fields_[j]);
+        }
+        schema_ = ArrowSchema{ "+s",
+                               "",
+                               nullptr,
+                               0,
+                               int64_t(fields_.size()),
+                               field_ptrs_.data(),
+                               nullptr,
+                               &release_schema,
+                               this };
+        return &schema_;
+    }
+
+    ArrowArray* get_batches() {
+        arrays_.clear();
+        for (auto& desc : batches_) {
+            desc.buffers.clear();
+            desc.children.resize(desc.values.size());
+            for (std::size_t j = 0; j < desc.values.size(); ++j) {
+                desc.buffers.push_back({ desc.validity[j], desc.values[j] });
+            }
+        }
+        for (auto& desc : batches_) {
+            desc.child_ptrs.clear();
+            for (std::size_t j = 0; j < desc.values.size(); ++j) {
+                const int64_t null_count = desc.validity[j] ? -1 : 0;
+                desc.children[j] = ArrowArray{ desc.offset + desc.length,
+                                               null_count,
+                                               0,
+                                               2,
+                                               0,
+                                               desc.buffers[j].data(),
+                                               nullptr,
+                                               nullptr,
+                                               &release_array,
+                                               this };
+                desc.child_ptrs.push_back(&desc.children[j]);
+            }
+            static const void* no_buffers[] = { nullptr };
+            arrays_.push_back(ArrowArray{ desc.length,
+                                          0,
+                                          desc.offset,
+                                          1,
+                                          int64_t(desc.values.size()),
+                                          no_buffers,
+                                          desc.child_ptrs.data(),
+                                          nullptr,
+                                          &release_batch,
+                                          this });
+        }
+        return arrays_.data();
+    }
+
+    int64_t release_count = 0;
+
+private:
+    struct batch_desc {
+        int64_t length;
+        int64_t offset;
+        std::vector<const void*> values;
+        std::vector<const std::uint8_t*> validity;
+        std::vector<std::vector<const void*>> buffers;
+        std::vector<ArrowArray> children;
+        std::vector<ArrowArray*> child_ptrs;
+    };
+
+    static void release_schema(ArrowSchema* schema) {
+        static_cast<arrow_producer*>(schema->private_data)->release_count++;
+        schema->release = nullptr;
+    }
+
+    static void release_array(ArrowArray* array) {
+        array->release = nullptr;
+    }
+
+    static void release_batch(ArrowArray* batch) {
+        for (int64_t j = 0; j < batch->n_children; ++j) {
+            batch->children[j]->release(batch->children[j]);
+        }
+        static_cast<arrow_producer*>(batch->private_data)->release_count++;
+        batch->release = nullptr;
+    }
+
+    std::vector<const char*> formats_;
+    std::vector<ArrowSchema> fields_;
+    std::vector<ArrowSchema*> field_ptrs_;
+    ArrowSchema schema_;
+    std::vector<batch_desc> batches_;
+    std::vector<ArrowArray> arrays_;
+};
+
+TEST(arrow_table_test, can_construct_empty_table) {
+    arrow_table t;
+
+    ASSERT_FALSE(t.has_data());
+    ASSERT_EQ(t.get_kind(), arrow_table::kind());
+    ASSERT_EQ(t.get_row_count(), 0);
+    ASSERT_EQ(t.get_column_count(), 0);
+    ASSERT_EQ(t.get_chunk_count(), 0);
+}
+
+TEST(arrow_table_test, can_read_column_without_copy) {
+    const float x[] = { 1.f, 2.f, 3.f, 4.f };
+    const int32_t y[] = { 5, 6, 7, 8 };
+
+    arrow_producer producer;
+    producer.add_field("f");
+    producer.add_field("i");
+    producer.add_batch(4, { x, y });
+
+    arrow_table t{ producer.get_schema(), producer.get_batches() };
+    ASSERT_EQ(t.get_row_count(), 4);
+    ASSERT_EQ(t.get_column_count(), 2);
+    ASSERT_EQ(t.get_metadata().get_data_type(0), data_type::float32);
+    ASSERT_EQ(t.get_metadata().get_data_type(1), data_type::int32);
+    ASSERT_EQ(t.get_metadata().get_feature_type(1), feature_type::ordinal);
+
+    const auto col = column_accessor<const float>(t).pull(0, { 1, 3 });
+    ASSERT_EQ(col.get_count(), 2);
+    ASSERT_EQ(col.get_data(), x + 1);
+
+    const auto converted = column_accessor<const float>(t).pull(1);
+    ASSERT_EQ(converted.get_count(), 4);
+    for (int64_t i = 0; i < 4; ++i) {
+        ASSERT_FLOAT_EQ(converted[i], float(y[i]));
+    }
+}
+
+TEST(arrow_table_test, can_read_rows_from_chunked_columns) {
+    const double x0[] = { 1.0, 2.0, 3.0 };
+    const int64_t y0[] = { 10, 20, 30 };
+    const double x1[] = { -1.0, 4.0, 5.0 };
+    const int64_t y1[] = { -10, 40, 50 };
+
+    arrow_producer producer;
+    producer.add_field("g");
+    producer.add_field("l");
+    producer.add_batch(3, { x0, y0 });
+    producer.add_batch(2, { x1, y1 }, {}, 1);
+
+    arrow_table t{ producer.get_schema(), producer.get_batches(), 2 };
+    ASSERT_EQ(t.get_row_count(), 5);
+    ASSERT_EQ(t.get_chunk_count(), 2);
+
+    const auto rows = row_accessor<const float>(t).pull({ 1, 5 });
+    const float expected[] = { 2.f, 20.f, 3.f, 30.f, 4.f, 40.f, 5.f, 50.f };
+    ASSERT_EQ(rows.get_count(), 8);
+    for (int64_t i = 0; i < 8; ++i) {
+        ASSERT_FLOAT_EQ(rows[i], expected[i]);
+    }
+
+    const auto col = column_accessor<const double>(t).pull(0, { 2, 4 });
+    ASSERT_EQ(col.get_count(), 2);
+    ASSERT_DOUBLE_EQ(col[0], 3.0);
+    ASSERT_DOUBLE_EQ(col[1], 4.0);
+}
+
+TEST(arrow_table_test, can_read_nulls) {
+    const float x[] = { 1.f, 2.f, 3.f, 4.f };
+    const int32_t y[] = { 5, 6, 7, 8 };
+    const std::uint8_t validity[] = { 0b1101 };
+
+    arrow_producer producer;
+    producer.add_field("f");
+    producer.add_field("i");
+    producer.add_batch(4, { x, y }, { validity, validity });
+
+    arrow_table t{ producer.get_schema(), producer.get_batches() };
+
+    const auto rows = row_accessor<const double>(t).pull();
+    ASSERT_EQ(rows.get_count(), 8);
+    ASSERT_DOUBLE_EQ(rows[0], 1.0);
+    ASSERT_TRUE(std::isnan(rows[2]));
+    ASSERT_TRUE(std::isnan(rows[3]));
+    ASSERT_DOUBLE_EQ(rows[5], 7.0);
+
+    const auto col = column_accessor<const int32_t>(t).pull(1);
+    ASSERT_NE(col.get_data(), y);
+    ASSERT_EQ(col[0], 5);
+    ASSERT_EQ(col[1], 0);
+    ASSERT_EQ(col[3], 8);
+}
+
+TEST(arrow_table_test, keeps_data_alive_while_blocks_exist) {
+    const float x[] = { 1.f, 2.f };
+
+    arrow_producer producer;
+    producer.add_field("f");
+    producer.add_batch(2, { x });
+
+    ArrowSchema* schema = producer.get_schema();
+    ArrowArray* batch = producer.get_batches();
+    array<float> col;
+    {
+        arrow_table t{ schema, batch };
+        ASSERT_TRUE(schema->release == nullptr);
+        ASSERT_TRUE(batch->release == nullptr);
+        col = column_accessor<const float>(t).pull(0);
+    }
+    ASSERT_EQ(producer.release_count, 0);
+    ASSERT_EQ(col.get_data(), x);
+
+    col.reset();
+    ASSERT_EQ(producer.release_count, 2);
+}
+
+TEST(arrow_table_test, throws_on_unsupported_format) {
+    const char* x[] = { "a", "b" };
+
+    arrow_producer producer;
+    producer.add_field("u");
+    producer.add_batch(2, { x });
+
+    ASSERT_THROW((arrow_table{ producer.get_schema(), producer.get_batches() }),
+                 invalid_argument);
+    ASSERT_EQ(producer.release_count, 2);
+}
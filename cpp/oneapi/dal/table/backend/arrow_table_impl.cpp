@@ -0,0 +1,295 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/backend/arrow_table_impl.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/backend/convert.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace oneapi::dal::backend {
+
+using std::int64_t;
+
+/// Keeps the imported Arrow structures alive while the table or the blocks
+/// pulled from it without a copy exist
+struct arrow_table_impl::owner {
+    owner(ArrowSchema* source_schema, ArrowArray* source_batches, int64_t batch_count)
+            : schema(*source_schema) {
+        source_schema->release = nullptr;
+        batches.reserve(batch_count);
+        for (int64_t i = 0; i < batch_count; ++i) {
+            batches.push_back(source_batches[i]);
+            source_batches[i].release = nullptr;
+        }
+    }
+
+    owner(const owner&) = delete;
+    owner& operator=(const owner&) = delete;
+
+    ~owner() {
+        for (auto& batch : batches) {
+            if (batch.release != nullptr) {
+                batch.release(&batch);
+            }
+        }
+        if (schema.release != nullptr) {
+            schema.release(&schema);
+        }
+    }
+
+    ArrowSchema schema;
+    std::vector<ArrowArray> batches;
+};
+
+static data_type get_arrow_data_type(const char* format) {
+    if (format != nullptr && format[0] != '\0' && format[1] == '\0') {
+        switch (format[0]) {
+            case 'i': return data_type::int32;
+            case 'I': return data_type::uint32;
+            case 'l': return data_type::int64;
+            case 'L': return data_type::uint64;
+            case 'e': return data_type::float16;
+            case 'f': return data_type::float32;
+            case 'g': return data_type::float64;
+            default: break;
+        }
+    }
+    throw invalid_argument("Unsupported Arrow column format");
+}
+
+arrow_table_impl::arrow_table_impl(ArrowSchema* schema,
+                                   ArrowArray* batches,
+                                   int64_t batch_count)
+        : row_count_(0) {
+    if (schema == nullptr || schema->release == nullptr) {
+        throw invalid_argument("Arrow schema is null or released");
+    }
+    if (batch_count < 0 || (batch_count > 0 && batches == nullptr)) {
+        throw invalid_argument("Invalid Arrow record batches");
+    }
+
+    // The ownership is taken first, so the data is released on any error below
+    owner_ = std::make_shared<owner>(schema, batches, batch_count);
+
+    const auto& root = owner_->schema;
+    if (root.format == nullptr || std::strcmp(root.format, "+s") != 0) {
+        throw invalid_argument("Arrow schema is not a struct");
+    }
+
+    const int64_t column_count = root.n_children;
+    auto dtypes = array<data_type>::empty(column_count);
+    auto ftypes = array<feature_type>::empty(column_count);
+    columns_.resize(column_count);
+    for (int64_t j = 0; j < column_count; ++j) {
+        const ArrowSchema* field = root.children[j];
+        if (field->dictionary != nullptr) {
+            throw invalid_argument("Dictionary-encoded Arrow columns are not supported");
+        }
+        const auto dtype = get_arrow_data_type(field->format);
+        columns_[j].dtype = dtype;
+        columns_[j].chunks.reserve(batch_count);
+        dtypes.get_mutable_data()[j] = dtype;
+        ftypes.get_mutable_data()[j] =
+            detail::is_floating_point(dtype) ? feature_type::ratio : feature_type::ordinal;
+    }
+    meta_ = table_metadata{ dtypes, ftypes };
+
+    chunk_offsets_.reserve(batch_count + 1);
+    chunk_offsets_.push_back(0);
+    for (const auto& batch : owner_->batches) {
+        if (batch.release == nullptr) {
+            throw invalid_argument("Arrow record batch is released");
+        }
+        if (batch.n_children != column_count) {
+            throw invalid_argument("Arrow record batch does not match the schema");
+        }
+        if (batch.null_count != 0 && batch.n_buffers > 0 && batch.buffers[0] != nullptr) {
+            throw invalid_argument("Null rows in Arrow record batches are not supported");
+        }
+
+        // Empty batches do not form chunks
+        if (batch.length == 0) {
+            continue;
+        }
+
+        for (int64_t j = 0; j < column_count; ++j) {
+            const ArrowArray* child = batch.children[j];
+            if (child->length < batch.offset + batch.length) {
+                throw invalid_argument("Arrow record batch does not match the schema");
+            }
+            if (child->n_buffers != 2 || child->buffers[1] == nullptr) {
+                throw invalid_argument("Unsupported Arrow column layout");
+            }
+
+            const auto dtype = columns_[j].dtype;
+            const int64_t first = batch.offset + child->offset;
+            const auto values = reinterpret_cast<const byte_t*>(child->buffers[1]) +
+                                first * detail::get_data_type_size(dtype);
+            const auto validity = reinterpret_cast<const std::uint8_t*>(child->buffers[0]);
+
+            // The null count can be unknown (-1), then the bitmap is checked
+            const int64_t null_count = validity ? child->null_count : 0;
+            columns_[j].chunks.push_back({ values, validity, first, null_count });
+        }
+
+        row_count_ += batch.length;
+        chunk_offsets_.push_back(row_count_);
+    }
+}
+
+int64_t arrow_table_impl::find_chunk(int64_t row) const {
+    const auto it = std::upper_bound(chunk_offsets_.begin(), chunk_offsets_.end(), row);
+    return static_cast<int64_t>(it - chunk_offsets_.begin()) - 1;
+}
+
+template <typename Data>
+void arrow_table_impl::copy_column(Data* dst,
+                                   int64_t dst_stride,
+                                   int64_t column_index,
+                                   int64_t first_row,
+                                   int64_t row_count) const {
+    const auto& col = columns_[column_index];
+    const data_type block_dtype = detail::make_data_type<Data>();
+    const int64_t type_size = detail::get_data_type_size(col.dtype);
+    const Data null_value = std::numeric_limits<Data>::has_quiet_NaN
+                                ? std::numeric_limits<Data>::quiet_NaN()
+                                : Data(0);
+
+    const int64_t end_row = first_row + row_count;
+    for (int64_t k = find_chunk(first_row), row = first_row; row < end_row; ++k) {
+        const auto& chunk = col.chunks[k];
+        const int64_t chunk_row = row - chunk_offsets_[k];
+        const int64_t count = std::min(end_row, chunk_offsets_[k + 1]) - row;
+        const byte_t* src = chunk.values + chunk_row * type_size;
+        Data* block_ptr = dst + (row - first_row) * dst_stride;
+
+        if (dst_stride == 1 && col.dtype == block_dtype) {
+            std::memcpy(block_ptr, src, count * sizeof(Data));
+        }
+        else if (dst_stride == 1) {
+            convert_vector(detail::default_host_policy{},
+                           src,
+                           block_ptr,
+                           col.dtype,
+                           block_dtype,
+                           count);
+        }
+        else {
+            convert_vector(detail::default_host_policy{},
+                           src,
+                           block_ptr,
+                           col.dtype,
+                           block_dtype,
+                           type_size,
+                           dst_stride * sizeof(Data),
+                           count);
+        }
+
+        if (chunk.null_count != 0) {
+            for (int64_t i = 0; i < count; ++i) {
+                const int64_t bit = chunk.validity_offset + chunk_row + i;
+                if (((chunk.validity[bit >> 3] >> (bit & 7)) & 1) == 0) {
+                    block_ptr[i * dst_stride] = null_value;
+                }
+            }
+        }
+        row += count;
+    }
+}
+
+static void check_rows(int64_t first_row, int64_t row_count, int64_t table_row_count) {
+    if (first_row < 0 || row_count < 0 || first_row + row_count > table_row_count) {
+        throw out_of_range("Row range is out of the table");
+    }
+}
+
+template <typename Data>
+void arrow_table_impl::pull_rows(array<Data>& block, const range& rows) const {
+    const int64_t column_count = get_column_count();
+    if (column_count == 1) {
+        pull_column(block, 0, rows);
+        return;
+    }
+
+    const int64_t first_row = rows.start_idx;
+    const int64_t row_count = rows.get_element_count(row_count_);
+    check_rows(first_row, row_count, row_count_);
+
+    const int64_t element_count = row_count * column_count;
+    if (element_count == 0) {
+        block.reset();
+        return;
+    }
+
+    if (block.get_count() < element_count || block.has_mutable_data() == false) {
+        block.reset(element_count);
+    }
+
+    Data* dst = block.get_mutable_data();
+    for (int64_t j = 0; j < column_count; ++j) {
+        copy_column(dst + j, column_count, j, first_row, row_count);
+    }
+}
+
+template <typename Data>
+void arrow_table_impl::pull_column(array<Data>& block,
+                                   int64_t column_index,
+                                   const range& rows) const {
+    if (column_index < 0 || column_index >= get_column_count()) {
+        throw out_of_range("Column index is out of range");
+    }
+
+    const int64_t first_row = rows.start_idx;
+    const int64_t row_count = rows.get_element_count(row_count_);
+    check_rows(first_row, row_count, row_count_);
+
+    if (row_count == 0) {
+        block.reset();
+        return;
+    }
+
+    // The column buffer is returned as is when no conversion is needed
+    const auto& col = columns_[column_index];
+    const int64_t k = find_chunk(first_row);
+    const auto& chunk = col.chunks[k];
+    if (col.dtype == detail::make_data_type<Data>() && chunk.null_count == 0 &&
+        first_row + row_count <= chunk_offsets_[k + 1]) {
+        const auto chunk_data = reinterpret_cast<const Data*>(chunk.values);
+        const auto data = chunk_data + (first_row - chunk_offsets_[k]);
+        block.reset(data, row_count, [keep_alive = owner_](const Data*) {});
+        return;
+    }
+
+    if (block.get_count() < row_count || block.has_mutable_data() == false) {
+        block.reset(row_count);
+    }
+    copy_column(block.get_mutable_data(), 1, column_index, first_row, row_count);
+}
+
+#define INSTANTIATE(Data)                                                                    \
+    template void arrow_table_impl::pull_rows(array<Data>&, const range&) const;             \
+    template void arrow_table_impl::pull_column(array<Data>&, int64_t, const range&) const;
+
+INSTANTIATE(float)
+INSTANTIATE(double)
+INSTANTIATE(std::int32_t)
+
+#undef INSTANTIATE
+
+} // namespace oneapi::dal::backend
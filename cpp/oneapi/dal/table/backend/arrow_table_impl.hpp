@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "oneapi/dal/table/arrow.hpp"
+
+namespace oneapi::dal::backend {
+
+class arrow_table_impl {
+public:
+    static constexpr std::int64_t arrow_table_kind = 2;
+
+public:
+    arrow_table_impl() : row_count_(0) {}
+
+    arrow_table_impl(ArrowSchema* schema, ArrowArray* batches, std::int64_t batch_count);
+
+    std::int64_t get_column_count() const {
+        return static_cast<std::int64_t>(columns_.size());
+    }
+
+    std::int64_t get_row_count() const {
+        return row_count_;
+    }
+
+    std::int64_t get_kind() const {
+        return arrow_table_kind;
+    }
+
+    const table_metadata& get_metadata() const {
+        return meta_;
+    }
+
+    data_layout get_data_layout() const {
+        return data_layout::unknown;
+    }
+
+    std::int64_t get_chunk_count() const {
+        return chunk_offsets_.empty() ? 0 : static_cast<std::int64_t>(chunk_offsets_.size()) - 1;
+    }
+
+    template <typename Data>
+    void pull_rows(array<Data>& block, const range& rows) const;
+
+    template <typename Data>
+    void pull_column(array<Data>& block, std::int64_t column_index, const range& rows) const;
+
+private:
+    struct column_chunk {
+        const byte_t* values;
+        const std::uint8_t* validity;
+        std::int64_t validity_offset;
+        std::int64_t null_count;
+    };
+
+    struct column {
+        data_type dtype;
+        std::vector<column_chunk> chunks;
+    };
+
+    struct owner;
+
+    std::int64_t find_chunk(std::int64_t row) const;
+
+    template <typename Data>
+    void copy_column(Data* dst,
+                     std::int64_t dst_stride,
+                     std::int64_t column_index,
+                     std::int64_t first_row,
+                     std::int64_t row_count) const;
+
+    std::shared_ptr<owner> owner_;
+    table_metadata meta_;
+    std::vector<column> columns_;
+    std::vector<std::int64_t> chunk_offsets_;
+    std::int64_t row_count_;
+};
+
+} // namespace oneapi::dal::backend
@@ -14,17 +14,190 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+#include <type_traits>
+
 #include "oneapi/dal/table/backend/convert.hpp"
 #include "oneapi/dal/backend/interop/data_conversion.hpp"
+#include "oneapi/dal/detail/common.hpp"
 
 namespace oneapi::dal::backend {
 
+namespace {
+
+// The half-precision conversions are branchless bit manipulations, so the
+// contiguous loops below are vectorized by the compiler
+inline float bits_to_float(std::uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline std::uint32_t float_to_bits(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline float bfloat16_to_float(std::uint16_t h) {
+    return bits_to_float(std::uint32_t(h) << 16);
+}
+
+inline std::uint16_t float_to_bfloat16(float f) {
+    const std::uint32_t bits = float_to_bits(f);
+    if ((bits & 0x7fffffffu) > 0x7f800000u) {
+        // Keeps NaN quiet, the truncation might turn it into infinity
+        return std::uint16_t((bits >> 16) | 0x40u);
+    }
+    // Round to nearest even
+    return std::uint16_t((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+}
+
+inline float float16_to_float(std::uint16_t h) {
+    // The multiplication rebiases the exponent and normalizes the subnormals
+    const std::uint32_t magnitude = std::uint32_t(h & 0x7fffu) << 13;
+    float value = bits_to_float(magnitude) * bits_to_float((254u - 15u) << 23);
+    std::uint32_t bits = float_to_bits(value);
+    if (value >= bits_to_float((127u + 16u) << 23)) {
+        bits |= 255u << 23; // Inf and NaN
+    }
+    return bits_to_float(bits | (std::uint32_t(h & 0x8000u) << 16));
+}
+
+inline std::uint16_t float_to_float16(float f) {
+    std::uint32_t bits = float_to_bits(f);
+    const std::uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    std::uint32_t result;
+    if (bits >= ((127u + 16u) << 23)) {
+        // Overflows to infinity, NaN stays quiet
+        result = (bits > (255u << 23)) ? 0x7e00u : 0x7c00u;
+    }
+    else if (bits < (113u << 23)) {
+        // The addition aligns the subnormal mantissa and rounds it to nearest even
+        const std::uint32_t magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+        result = float_to_bits(bits_to_float(bits) + bits_to_float(magic)) - magic;
+    }
+    else {
+        const std::uint32_t mantissa_odd = (bits >> 13) & 1u;
+        bits += (std::uint32_t(15 - 127) << 23) + 0xfffu + mantissa_odd;
+        result = bits >> 13;
+    }
+    return std::uint16_t(result | (sign >> 16));
+}
+
+// The storage types of the half-precision values, the conversion is chosen at
+// compile time to keep the loops free of the type checks
+struct bfloat16_storage {
+    std::uint16_t bits;
+};
+
+struct float16_storage {
+    std::uint16_t bits;
+};
+
+template <typename T>
+inline float to_float(T value) {
+    return static_cast<float>(value);
+}
+
+inline float to_float(bfloat16_storage value) {
+    return bfloat16_to_float(value.bits);
+}
+
+inline float to_float(float16_storage value) {
+    return float16_to_float(value.bits);
+}
+
+template <typename T>
+inline T from_float(float value) {
+    if constexpr (std::is_same_v<T, bfloat16_storage>) {
+        return T{ float_to_bfloat16(value) };
+    }
+    else if constexpr (std::is_same_v<T, float16_storage>) {
+        return T{ float_to_float16(value) };
+    }
+    else {
+        return static_cast<T>(value);
+    }
+}
+
+template <typename Src, typename Dst>
+void convert_half_vector_impl(const void* src,
+                              void* dst,
+                              std::int64_t src_stride,
+                              std::int64_t dst_stride,
+                              std::int64_t element_count) {
+    if (src_stride == sizeof(Src) && dst_stride == sizeof(Dst)) {
+        const Src* src_data = static_cast<const Src*>(src);
+        Dst* dst_data = static_cast<Dst*>(dst);
+        for (std::int64_t i = 0; i < element_count; i++) {
+            dst_data[i] = from_float<Dst>(to_float(src_data[i]));
+        }
+    }
+    else {
+        const byte_t* src_bytes = static_cast<const byte_t*>(src);
+        byte_t* dst_bytes = static_cast<byte_t*>(dst);
+        for (std::int64_t i = 0; i < element_count; i++) {
+            Src value;
+            std::memcpy(&value, src_bytes + i * src_stride, sizeof(Src));
+            const Dst result = from_float<Dst>(to_float(value));
+            std::memcpy(dst_bytes + i * dst_stride, &result, sizeof(Dst));
+        }
+    }
+}
+
+inline bool is_half_type(data_type t) {
+    return t == data_type::bfloat16 || t == data_type::float16;
+}
+
+template <typename Op>
+void dispatch_half_conversion_type(data_type t, Op&& op) {
+    switch (t) {
+        case data_type::float32: op(float{}); break;
+        case data_type::float64: op(double{}); break;
+        case data_type::int32: op(std::int32_t{}); break;
+        case data_type::bfloat16: op(bfloat16_storage{}); break;
+        case data_type::float16: op(float16_storage{}); break;
+        default: throw unimplemented{ "Data type is not supported" };
+    }
+}
+
+void convert_half_vector(const void* src,
+                         void* dst,
+                         data_type src_type,
+                         data_type dst_type,
+                         std::int64_t src_stride,
+                         std::int64_t dst_stride,
+                         std::int64_t element_count) {
+    dispatch_half_conversion_type(src_type, [&](auto src_value) {
+        dispatch_half_conversion_type(dst_type, [&](auto dst_value) {
+            using src_t = decltype(src_value);
+            using dst_t = decltype(dst_value);
+            convert_half_vector_impl<src_t, dst_t>(src, dst, src_stride, dst_stride, element_count);
+        });
+    });
+}
+
+} // namespace
+
 void convert_vector(const detail::default_host_policy& policy,
                     const void* src,
                     void* dst,
                     data_type src_type,
                     data_type dst_type,
                     std::int64_t element_count) {
+    if (is_half_type(src_type) || is_half_type(dst_type)) {
+        convert_half_vector(src,
+                            dst,
+                            src_type,
+                            dst_type,
+                            detail::get_data_type_size(src_type),
+                            detail::get_data_type_size(dst_type),
+                            element_count);
+        return;
+    }
     interop::daal_convert(src, dst, src_type, dst_type, element_count);
 }
 
@@ -36,6 +209,10 @@ void convert_vector(const detail::default_host_policy& policy,
                     std::int64_t src_stride,
                     std::int64_t dst_stride,
                     std::int64_t element_count) {
+    if (is_half_type(src_type) || is_half_type(dst_type)) {
+        convert_half_vector(src, dst, src_type, dst_type, src_stride, dst_stride, element_count);
+        return;
+    }
     interop::daal_convert(src, dst, src_type, dst_type, src_stride, dst_stride, element_count);
 }
 
@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/backend/csr_table_impl.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/backend/convert.hpp"
+
+#include <algorithm>
+
+namespace oneapi::dal::backend {
+
+using std::int64_t;
+
+csr_table_impl::csr_table_impl(const array<byte_t>& data,
+                               data_type dtype,
+                               const array<int64_t>& column_indices,
+                               const array<int64_t>& row_offsets,
+                               int64_t column_count)
+        : data_(data),
+          column_indices_(column_indices),
+          row_offsets_(row_offsets),
+          dtype_(dtype),
+          row_count_(row_offsets.get_count() - 1),
+          column_count_(column_count) {
+    if (row_offsets.get_count() < 1) {
+        throw invalid_argument("Row offsets of the CSR table shall contain at least one element");
+    }
+    if (column_count < 0) {
+        throw invalid_argument("The number of columns of the CSR table is negative");
+    }
+    if (column_indices.get_count() * detail::get_data_type_size(dtype) != data.get_count()) {
+        throw invalid_argument("The numbers of the values and the column indices do not match");
+    }
+
+    auto dtypes = array<data_type>::full(column_count, dtype);
+    auto ftypes = array<feature_type>::full(
+        column_count,
+        detail::is_floating_point(dtype) ? feature_type::ratio : feature_type::ordinal);
+    meta_ = table_metadata{ dtypes, ftypes };
+}
+
+static void check_rows(int64_t first_row, int64_t row_count, int64_t table_row_count) {
+    if (first_row < 0 || row_count < 0 || first_row + row_count > table_row_count) {
+        throw out_of_range("Row range is out of the table");
+    }
+}
+
+/// Returns the values with the indices [first, first + count) in the type of
+/// the block, the values are converted into the buffer when the types differ
+template <typename Data>
+const Data* csr_table_impl::get_values(array<Data>& buffer, int64_t first, int64_t count) const {
+    const int64_t type_size = detail::get_data_type_size(dtype_);
+    const byte_t* src = data_.get_data() + first * type_size;
+    const data_type block_dtype = detail::make_data_type<Data>();
+    if (dtype_ == block_dtype) {
+        return reinterpret_cast<const Data*>(src);
+    }
+
+    buffer.reset(count);
+    convert_vector(detail::default_host_policy{},
+                   src,
+                   buffer.get_mutable_data(),
+                   dtype_,
+                   block_dtype,
+                   count);
+    return buffer.get_data();
+}
+
+template <typename Data>
+void csr_table_impl::pull_rows(array<Data>& block, const range& rows) const {
+    const int64_t first_row = rows.start_idx;
+    const int64_t row_count = rows.get_element_count(row_count_);
+    check_rows(first_row, row_count, row_count_);
+
+    const int64_t element_count = row_count * column_count_;
+    if (element_count == 0) {
+        block.reset();
+        return;
+    }
+
+    if (block.get_count() < element_count || block.has_mutable_data() == false) {
+        block.reset(element_count);
+    }
+
+    Data* dst = block.get_mutable_data();
+    std::fill(dst, dst + element_count, Data(0));
+
+    const int64_t* offsets = row_offsets_.get_data();
+    const int64_t* indices = column_indices_.get_data();
+    const int64_t first = offsets[first_row];
+
+    array<Data> buffer;
+    const Data* values = get_values(buffer, first, offsets[first_row + row_count] - first);
+    for (int64_t i = 0; i < row_count; ++i) {
+        Data* row = dst + i * column_count_;
+        for (int64_t k = offsets[first_row + i]; k < offsets[first_row + i + 1]; ++k) {
+            row[indices[k]] = values[k - first];
+        }
+    }
+}
+
+template <typename Data>
+void csr_table_impl::pull_column(array<Data>& block,
+                                 int64_t column_index,
+                                 const range& rows) const {
+    if (column_index < 0 || column_index >= column_count_) {
+        throw out_of_range("Column index is out of range");
+    }
+
+    const int64_t first_row = rows.start_idx;
+    const int64_t row_count = rows.get_element_count(row_count_);
+    check_rows(first_row, row_count, row_count_);
+
+    if (row_count == 0) {
+        block.reset();
+        return;
+    }
+
+    if (block.get_count() < row_count || block.has_mutable_data() == false) {
+        block.reset(row_count);
+    }
+
+    Data* dst = block.get_mutable_data();
+    std::fill(dst, dst + row_count, Data(0));
+
+    const int64_t* offsets = row_offsets_.get_data();
+    const int64_t* indices = column_indices_.get_data();
+    const int64_t first = offsets[first_row];
+
+    array<Data> buffer;
+    const Data* values = get_values(buffer, first, offsets[first_row + row_count] - first);
+    for (int64_t i = 0; i < row_count; ++i) {
+        const int64_t* row_begin = indices + offsets[first_row + i];
+        const int64_t* row_end = indices + offsets[first_row + i + 1];
+        const int64_t* it = std::find(row_begin, row_end, column_index);
+        if (it != row_end) {
+            dst[i] = values[it - indices - first];
+        }
+    }
+}
+
+#define INSTANTIATE(Data)                                                                      \
+    template void csr_table_impl::pull_rows(array<Data>&, const range&) const;               \
+    template void csr_table_impl::pull_column(array<Data>&, int64_t, const range&) const;
+
+INSTANTIATE(float)
+INSTANTIATE(double)
+INSTANTIATE(std::int32_t)
+
+#undef INSTANTIATE
+
+} // namespace oneapi::dal::backend
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/csr.hpp"
+
+namespace oneapi::dal::backend {
+
+class csr_table_impl {
+public:
+    static constexpr std::int64_t csr_table_kind = 3;
+
+public:
+    csr_table_impl() : dtype_(data_type::float32), row_count_(0), column_count_(0) {}
+
+    csr_table_impl(const array<byte_t>& data,
+                   data_type dtype,
+                   const array<std::int64_t>& column_indices,
+                   const array<std::int64_t>& row_offsets,
+                   std::int64_t column_count);
+
+    std::int64_t get_column_count() const {
+        return column_count_;
+    }
+
+    std::int64_t get_row_count() const {
+        return row_count_;
+    }
+
+    std::int64_t get_kind() const {
+        return csr_table_kind;
+    }
+
+    const table_metadata& get_metadata() const {
+        return meta_;
+    }
+
+    data_layout get_data_layout() const {
+        return data_layout::unknown;
+    }
+
+    const void* get_data() const {
+        return data_.get_data();
+    }
+
+    data_type get_data_type() const {
+        return dtype_;
+    }
+
+    const std::int64_t* get_column_indices() const {
+        return column_indices_.get_data();
+    }
+
+    const std::int64_t* get_row_offsets() const {
+        return row_offsets_.get_data();
+    }
+
+    std::int64_t get_non_zero_count() const {
+        return column_indices_.get_count();
+    }
+
+    template <typename Data>
+    void pull_rows(array<Data>& block, const range& rows) const;
+
+    template <typename Data>
+    void pull_column(array<Data>& block, std::int64_t column_index, const range& rows) const;
+
+private:
+    template <typename Data>
+    const Data* get_values(array<Data>& buffer, std::int64_t first, std::int64_t count) const;
+
+    array<byte_t> data_;
+    array<std::int64_t> column_indices_;
+    array<std::int64_t> row_offsets_;
+    data_type dtype_;
+    table_metadata meta_;
+    std::int64_t row_count_;
+    std::int64_t column_count_;
+};
+
+} // namespace oneapi::dal::backend
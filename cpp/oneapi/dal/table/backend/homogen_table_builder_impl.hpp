@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/table/backend/homogen_table_impl.hpp"
 #include "oneapi/dal/table/homogen.hpp"
 
@@ -66,6 +67,7 @@ public:
 
     void allocate(std::int64_t row_count, std::int64_t column_count) {
         data_.reset(row_count * column_count * detail::get_data_type_size(dtype_));
+        detail::first_touch_numa(data_.get_mutable_data(), nullptr, data_.get_size());
         row_count_ = row_count;
         column_count_ = column_count;
     }
@@ -76,10 +78,7 @@ public:
 
     void copy_data(const void* data, std::int64_t row_count, std::int64_t column_count) {
         data_.reset(row_count * column_count * detail::get_data_type_size(dtype_));
-        detail::memcpy(detail::default_host_policy{},
-                       data_.get_mutable_data(),
-                       data,
-                       data_.get_size());
+        detail::first_touch_numa(data_.get_mutable_data(), data, data_.get_size());
 
         row_count_ = row_count;
         column_count_ = column_count;
@@ -17,6 +17,7 @@
 #include "oneapi/dal/table/backend/homogen_table_impl.hpp"
 #include "oneapi/dal/table/backend/convert.hpp"
 
+#include <cstdint>
 #include <cstring>
 
 namespace oneapi::dal::backend {
@@ -32,6 +33,13 @@ table_metadata create_homogen_metadata(int64_t feature_count, data_type dtype) {
     return table_metadata{ dtypes, ftypes };
 }
 
+template <typename Policy>
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+constexpr bool is_device_policy = std::is_same_v<Policy, detail::data_parallel_policy>;
+#else
+constexpr bool is_device_policy = false;
+#endif
+
 template <typename Policy, typename Data>
 void make_mutable_data(const Policy& policy, array<Data>& array) {
     if constexpr (std::is_same_v<Policy, detail::default_host_policy>) {
@@ -91,6 +99,23 @@ bool has_array_data_kind(const Policy& policy, const array<Data>& array, const A
     return false;
 }
 
+// The block returned without a copy refers to the table data. It cannot be
+// reused as the destination buffer, otherwise the conversion overwrites the table.
+template <typename Data>
+bool is_table_data_block(const array<Data>& block, const array<byte_t>& data) {
+    const auto block_begin = reinterpret_cast<std::uintptr_t>(block.get_data());
+    const auto block_end = block_begin + block.get_count() * sizeof(Data);
+    const auto data_begin = reinterpret_cast<std::uintptr_t>(data.get_data());
+    const auto data_end = data_begin + data.get_count();
+    return block_begin < data_end && data_begin < block_end;
+}
+
+static void check_layout(data_layout layout) {
+    if (layout != data_layout::row_major && layout != data_layout::column_major) {
+        throw std::runtime_error("unsupported data layout"); // TODO: oneDAL exception
+    }
+}
+
 template <typename Policy, typename Data, typename Alloc>
 void homogen_table_impl::pull_rows_impl(const Policy& policy,
                                         array<Data>& block,
@@ -99,15 +124,17 @@ void homogen_table_impl::pull_rows_impl(const Policy& policy,
     // TODO: check range correctness
     // TODO: check array size if non-zero
 
-    const int64_t range_size = rows.get_element_count(row_count_) * col_count_;
+    const int64_t range_row_count = rows.get_element_count(row_count_);
+    const int64_t range_size = range_row_count * col_count_;
     const data_type block_dtype = detail::make_data_type<Data>();
 
-    if (layout_ != data_layout::row_major) {
-        throw std::runtime_error("unsupported data layout"); // TODO: oneDAL exception
-    }
+    check_layout(layout_);
+
+    // Column-major rows are contiguous only in the single-column table
+    const bool is_contiguous = layout_ == data_layout::row_major || col_count_ == 1;
 
     const auto table_dtype = meta_.get_data_type(0);
-    if (block_dtype == table_dtype && has_array_data_kind(policy, data_, kind)) {
+    if (is_contiguous && block_dtype == table_dtype && has_array_data_kind(policy, data_, kind)) {
         if (data_.has_mutable_data()) {
             auto row_data = reinterpret_cast<Data*>(data_.get_mutable_data());
             auto row_start_pointer = row_data + rows.start_idx * col_count_;
@@ -121,18 +148,45 @@ void homogen_table_impl::pull_rows_impl(const Policy& policy,
     }
     else {
         if (block.get_count() < range_size || block.has_mutable_data() == false ||
-            has_array_data_kind(policy, block, kind) == false) {
+            has_array_data_kind(policy, block, kind) == false ||
+            is_table_data_block(block, data_)) {
             reset_array(policy, block, range_size, kind);
         }
 
         auto type_size = detail::get_data_type_size(table_dtype);
-        auto row_start_pointer = data_.get_data() + rows.start_idx * col_count_ * type_size;
-        backend::convert_vector(policy,
-                                row_start_pointer,
-                                block.get_mutable_data(),
-                                table_dtype,
-                                block_dtype,
-                                range_size);
+        if (is_contiguous && block_dtype == table_dtype && is_device_policy<Policy>) {
+            // Only the memory kind differs, so the rows are transferred by the
+            // device rather than converted by the host through the USM pages
+            auto row_start_pointer = data_.get_data() + rows.start_idx * col_count_ * type_size;
+            detail::memcpy(policy,
+                           block.get_mutable_data(),
+                           row_start_pointer,
+                           range_size * sizeof(Data));
+        }
+        else if (is_contiguous) {
+            auto row_start_pointer = data_.get_data() + rows.start_idx * col_count_ * type_size;
+            backend::convert_vector(policy,
+                                    row_start_pointer,
+                                    block.get_mutable_data(),
+                                    table_dtype,
+                                    block_dtype,
+                                    range_size);
+        }
+        else {
+            // Every column is scattered into its position in the rows of the block
+            for (int64_t column_index = 0; column_index < col_count_; column_index++) {
+                auto column_start_pointer =
+                    data_.get_data() + (column_index * row_count_ + rows.start_idx) * type_size;
+                backend::convert_vector(policy,
+                                        column_start_pointer,
+                                        block.get_mutable_data() + column_index,
+                                        table_dtype,
+                                        block_dtype,
+                                        type_size,
+                                        col_count_ * sizeof(Data),
+                                        range_row_count);
+            }
+        }
     }
 }
 
@@ -145,17 +199,31 @@ void homogen_table_impl::push_rows_impl(const Policy& policy,
 
     const int64_t row_count = get_row_count();
     const int64_t column_count = get_column_count();
-    const int64_t range_count = rows.get_element_count(row_count) * column_count;
+    const int64_t range_row_count = rows.get_element_count(row_count);
+    const int64_t range_count = range_row_count * column_count;
     const data_type block_dtype = detail::make_data_type<Data>();
 
-    if (layout_ != data_layout::row_major) {
-        throw std::runtime_error("unsupported data layout");
-    }
+    check_layout(layout_);
 
     make_mutable_data(policy, data_);
 
     const auto table_dtype = meta_.get_data_type(0);
-    if (block_dtype == table_dtype) {
+    if (layout_ == data_layout::column_major && column_count > 1) {
+        const auto type_size = detail::get_data_type_size(table_dtype);
+        for (int64_t column_index = 0; column_index < column_count; column_index++) {
+            auto column_start_pointer =
+                data_.get_mutable_data() + (column_index * row_count + rows.start_idx) * type_size;
+            backend::convert_vector(policy,
+                                    block.get_data() + column_index,
+                                    column_start_pointer,
+                                    block_dtype,
+                                    table_dtype,
+                                    column_count * sizeof(Data),
+                                    type_size,
+                                    range_row_count);
+        }
+    }
+    else if (block_dtype == table_dtype) {
         auto row_data = reinterpret_cast<Data*>(data_.get_mutable_data());
         auto row_start_pointer = row_data + rows.start_idx * column_count;
 
@@ -193,38 +261,39 @@ void homogen_table_impl::pull_column_impl(const Policy& policy,
     const int64_t range_count = rows.get_element_count(row_count);
     const data_type block_dtype = detail::make_data_type<Data>();
 
-    if (layout_ != data_layout::row_major) {
-        throw std::runtime_error("unsupported data layout");
-    }
+    check_layout(layout_);
 
-    const auto table_dtype = meta_.get_data_type(0);
-    if (block_dtype == table_dtype && column_count == 1 &&
-        has_array_data_kind(policy, data_, kind)) {
-        // TODO: assert column_index == 0
+    const bool is_column_major = layout_ == data_layout::column_major;
+    const bool is_contiguous = is_column_major || column_count == 1;
+    const int64_t element_offset = is_column_major ? column_index * row_count + rows.start_idx
+                                                   : column_index + rows.start_idx * column_count;
 
+    const auto table_dtype = meta_.get_data_type(0);
+    if (is_contiguous && block_dtype == table_dtype && has_array_data_kind(policy, data_, kind)) {
         if (data_.has_mutable_data()) {
             auto col_data = reinterpret_cast<Data*>(data_.get_mutable_data());
-            block.reset(data_, col_data + rows.start_idx * column_count, range_count);
+            block.reset(data_, col_data + element_offset, range_count);
         }
         else {
             auto col_data = reinterpret_cast<const Data*>(data_.get_data());
-            block.reset(data_, col_data + rows.start_idx * column_count, range_count);
+            block.reset(data_, col_data + element_offset, range_count);
         }
     }
     else {
         if (block.get_count() < range_count || block.has_mutable_data() == false ||
-            has_array_data_kind(policy, block, kind) == false) {
+            has_array_data_kind(policy, block, kind) == false ||
+            is_table_data_block(block, data_)) {
             reset_array(policy, block, range_count, kind);
         }
 
-        auto src_ptr = data_.get_data() + detail::get_data_type_size(table_dtype) *
-                                              (column_index + rows.start_idx * column_count);
+        const auto type_size = detail::get_data_type_size(table_dtype);
+        auto src_ptr = data_.get_data() + type_size * element_offset;
         backend::convert_vector(policy,
                                 src_ptr,
                                 block.get_mutable_data(),
                                 table_dtype,
                                 block_dtype,
-                                detail::get_data_type_size(table_dtype) * column_count,
+                                type_size * (is_column_major ? 1 : column_count),
                                 sizeof(Data),
                                 range_count);
     }
@@ -242,11 +311,17 @@ void homogen_table_impl::push_column_impl(const Policy& policy,
     const int64_t range_count = rows.get_element_count(row_count);
     const data_type block_dtype = detail::make_data_type<Data>();
 
+    check_layout(layout_);
+
+    const bool is_column_major = layout_ == data_layout::column_major;
+    const bool is_contiguous = is_column_major || column_count == 1;
+    const int64_t element_offset = is_column_major ? column_index * row_count + rows.start_idx
+                                                   : column_index + rows.start_idx * column_count;
+
     auto table_dtype = meta_.get_data_type(0);
-    const int64_t row_offset =
-        detail::get_data_type_size(table_dtype) * (column_index + rows.start_idx * column_count);
+    const int64_t row_offset = detail::get_data_type_size(table_dtype) * element_offset;
 
-    if (block_dtype == table_dtype && column_count == 1) {
+    if (block_dtype == table_dtype && is_contiguous) {
         if (reinterpret_cast<const void*>(data_.get_data() + row_offset) !=
             reinterpret_cast<const void*>(block.get_data())) {
             make_mutable_data(policy, data_);
@@ -262,6 +337,7 @@ void homogen_table_impl::push_column_impl(const Policy& policy,
     else {
         make_mutable_data(policy, data_);
 
+        const auto type_size = detail::get_data_type_size(table_dtype);
         auto dst_ptr = data_.get_mutable_data() + row_offset;
         backend::convert_vector(policy,
                                 block.get_data(),
@@ -269,7 +345,7 @@ void homogen_table_impl::push_column_impl(const Policy& policy,
                                 block_dtype,
                                 table_dtype,
                                 sizeof(Data),
-                                detail::get_data_type_size(table_dtype) * column_count,
+                                type_size * (is_column_major ? 1 : column_count),
                                 range_count);
     }
 }
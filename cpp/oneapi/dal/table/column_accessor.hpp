@@ -75,6 +75,32 @@ public:
     }
 #endif
 
+    T* pull(data_t* buffer,
+            std::int64_t buffer_count,
+            std::int64_t column_index,
+            const range& rows = { 0, -1 }) const {
+        return base::pull(detail::default_host_policy{},
+                          buffer,
+                          buffer_count,
+                          { column_index, rows },
+                          detail::host_allocator<data_t>{});
+    }
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    T* pull(sycl::queue& queue,
+            data_t* buffer,
+            std::int64_t buffer_count,
+            std::int64_t column_index,
+            const range& rows = { 0, -1 },
+            const sycl::usm::alloc& alloc = sycl::usm::alloc::shared) const {
+        return base::pull(detail::data_parallel_policy{ queue },
+                          buffer,
+                          buffer_count,
+                          { column_index, rows },
+                          detail::data_parallel_allocator<data_t>(queue, alloc));
+    }
+#endif
+
     template <typename Q = T>
     std::enable_if_t<sizeof(Q) && !is_readonly> push(const array<data_t>& block,
                                                      std::int64_t column_index,
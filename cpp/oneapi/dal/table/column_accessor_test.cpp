@@ -14,9 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "oneapi/dal/table/column_accessor.hpp"
 #include "gtest/gtest.h"
 #include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
 
 using namespace oneapi::dal;
 using std::int32_t;
@@ -99,3 +102,67 @@ TEST(column_accessor_test, can_get_columns_from_homogen_table_builder) {
         }
     }
 }
+
+TEST(column_accessor_test, can_get_column_from_column_major_homogen_table_without_copy) {
+    float data[] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+
+    homogen_table t{ data, 4, 2, empty_delete<const float>(), data_layout::column_major };
+    const auto col = column_accessor<const float>{ t }.pull(1, { 1, 4 });
+
+    ASSERT_EQ(col.get_count(), 3);
+    ASSERT_EQ(col.get_data(), data + 5);
+
+    const auto converted = column_accessor<const double>{ t }.pull(0);
+    ASSERT_EQ(converted.get_count(), 4);
+    for (std::int64_t i = 0; i < converted.get_count(); i++) {
+        ASSERT_DOUBLE_EQ(converted[i], double(data[i]));
+    }
+}
+
+TEST(column_accessor_test, can_get_column_from_homogen_table_into_raw_buffer) {
+    float data[] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+
+    homogen_table t{ data, 4, 2, empty_delete<const float>() };
+    std::int32_t col[4];
+    ASSERT_EQ(column_accessor<const std::int32_t>{ t }.pull(col, 4, 1), col);
+
+    for (std::int64_t i = 0; i < 4; i++) {
+        ASSERT_EQ(col[i], std::int32_t(data[i * 2 + 1]));
+    }
+}
+
+TEST(column_accessor_test, does_not_overwrite_table_data_with_reused_block) {
+    float data[] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+    auto arr = array<float>::empty(8);
+    std::copy(data, data + 8, arr.get_mutable_data());
+    auto t = detail::homogen_table_builder{}.reset(arr, 4, 2).build();
+
+    array<float> block;
+    row_accessor<const float>{ t }.pull(block);
+    ASSERT_EQ(block.get_data(), arr.get_data());
+
+    column_accessor<const float>{ t }.pull(block, 1);
+    for (std::int64_t i = 0; i < 8; i++) {
+        ASSERT_FLOAT_EQ(arr[i], data[i]);
+    }
+    for (std::int64_t i = 0; i < 4; i++) {
+        ASSERT_FLOAT_EQ(block[i], data[i * 2 + 1]);
+    }
+}
+
+TEST(column_accessor_test, can_get_column_from_column_major_float16_table) {
+    // 1, 2, 3, -1, -2, -3 in float16
+    const std::uint16_t data[] = { 0x3c00, 0x4000, 0x4200, 0xbc00, 0xc000, 0xc200 };
+
+    homogen_table t{ data,
+                     3,
+                     2,
+                     empty_delete<const std::uint16_t>(),
+                     data_type::float16,
+                     data_layout::column_major };
+    const auto col = column_accessor<const float>(t).pull(1, { 1, 3 });
+
+    ASSERT_EQ(col.get_count(), 2);
+    ASSERT_FLOAT_EQ(col[0], -2.0f);
+    ASSERT_FLOAT_EQ(col[1], -3.0f);
+}
@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "oneapi/dal/table/column_stats.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal {
+
+namespace detail {
+
+// The statistics are accumulated by the chunks of the consecutive blocks of
+// the rows and merged in the order of the chunks, so they do not depend on
+// the number of the threads
+constexpr std::int64_t stats_block_row_count = 1024;
+constexpr std::int64_t stats_max_chunk_count = 256;
+
+struct column_stats_partial {
+    explicit column_stats_partial(std::int64_t column_count)
+            : min(column_count, std::numeric_limits<double>::max()),
+              max(column_count, -std::numeric_limits<double>::max()),
+              sum(column_count, 0.0),
+              sum_squares(column_count, 0.0) {}
+
+    void update(const double* rows, std::int64_t row_count) {
+        const std::int64_t column_count = sum.size();
+        for (std::int64_t i = 0; i < row_count; i++) {
+            const double* row = rows + i * column_count;
+            for (std::int64_t j = 0; j < column_count; j++) {
+                const double value = row[j];
+                min[j] = (value < min[j]) ? value : min[j];
+                max[j] = (value > max[j]) ? value : max[j];
+                sum[j] += value;
+                sum_squares[j] += value * value;
+            }
+        }
+    }
+
+    void merge(const column_stats_partial& other) {
+        for (std::size_t j = 0; j < sum.size(); j++) {
+            min[j] = std::min(min[j], other.min[j]);
+            max[j] = std::max(max[j], other.max[j]);
+            sum[j] += other.sum[j];
+            sum_squares[j] += other.sum_squares[j];
+        }
+    }
+
+    std::vector<double> min;
+    std::vector<double> max;
+    std::vector<double> sum;
+    std::vector<double> sum_squares;
+};
+
+static array<double> to_array(const std::vector<double>& values) {
+    auto result = array<double>::empty(values.size());
+    std::copy(values.begin(), values.end(), result.get_mutable_data());
+    return result;
+}
+
+static column_stats compute_stats(const table& t) {
+    using dal::preview::load_graph::detail::threader_for;
+
+    const std::int64_t row_count = t.get_row_count();
+    const std::int64_t column_count = t.get_column_count();
+    const std::int64_t block_count =
+        (row_count + stats_block_row_count - 1) / stats_block_row_count;
+    const std::int64_t chunk_count = std::min(block_count, stats_max_chunk_count);
+    const std::int64_t chunk_block_count = (block_count + chunk_count - 1) / chunk_count;
+
+    std::vector<column_stats_partial> partials(chunk_count,
+                                               column_stats_partial{ column_count });
+    threader_for(chunk_count, chunk_count, [&](std::int64_t chunk) {
+        const row_accessor<const double> accessor{ t };
+        array<double> block;
+        const std::int64_t first_row = chunk * chunk_block_count * stats_block_row_count;
+        const std::int64_t last_row =
+            std::min(first_row + chunk_block_count * stats_block_row_count, row_count);
+        for (std::int64_t row = first_row; row < last_row; row += stats_block_row_count) {
+            const std::int64_t end_row = std::min(row + stats_block_row_count, last_row);
+            const double* rows = accessor.pull(block, { row, end_row });
+            partials[chunk].update(rows, end_row - row);
+        }
+    });
+
+    column_stats_partial& total = partials[0];
+    for (std::int64_t chunk = 1; chunk < chunk_count; chunk++) {
+        total.merge(partials[chunk]);
+    }
+
+    // The sums of squares are finite only if all the values are finite
+    const bool all_finite = std::all_of(total.sum_squares.begin(),
+                                        total.sum_squares.end(),
+                                        [](double value) {
+                                            return std::isfinite(value);
+                                        });
+    return column_stats{ to_array(total.min),
+                         to_array(total.max),
+                         to_array(total.sum),
+                         to_array(total.sum_squares),
+                         all_finite };
+}
+
+} // namespace detail
+
+column_stats compute_column_stats(const table& t) {
+    if (!t.has_data()) {
+        throw invalid_argument("Input table should not be empty");
+    }
+    const auto& impl = detail::get_impl<detail::table_impl_iface>(t);
+    if (const auto stats = impl.get_column_stats()) {
+        return *stats;
+    }
+    const auto stats = std::make_shared<const column_stats>(detail::compute_stats(t));
+    impl.set_column_stats(stats);
+    return *stats;
+}
+
+bool has_column_stats(const table& t) {
+    return bool(detail::get_impl<detail::table_impl_iface>(t).get_column_stats());
+}
+
+void set_column_stats(const table& t, const column_stats& stats) {
+    if (stats.get_column_count() != t.get_column_count()) {
+        throw invalid_argument("Column count of the statistics should match the table");
+    }
+    detail::get_impl<detail::table_impl_iface>(t).set_column_stats(
+        std::make_shared<const column_stats>(stats));
+}
+
+} // namespace oneapi::dal
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal {
+
+/// The minimums, the maximums, the sums and the sums of squares of the columns
+/// of a table, the algorithms use them instead of a pass over the values
+class column_stats {
+public:
+    column_stats() = default;
+
+    column_stats(const array<double>& min,
+                 const array<double>& max,
+                 const array<double>& sum,
+                 const array<double>& sum_squares,
+                 bool all_finite)
+            : min_(min),
+              max_(max),
+              sum_(sum),
+              sum_squares_(sum_squares),
+              all_finite_(all_finite) {}
+
+    std::int64_t get_column_count() const {
+        return sum_.get_count();
+    }
+
+    const array<double>& get_min() const {
+        return min_;
+    }
+
+    const array<double>& get_max() const {
+        return max_;
+    }
+
+    const array<double>& get_sum() const {
+        return sum_;
+    }
+
+    const array<double>& get_sum_squares() const {
+        return sum_squares_;
+    }
+
+    /// True if all the values of the table are finite, false if some of them
+    /// are infinite or NaN, or if the sums of squares are too large to tell
+    bool get_all_finite() const {
+        return all_finite_;
+    }
+
+private:
+    array<double> min_;
+    array<double> max_;
+    array<double> sum_;
+    array<double> sum_squares_;
+    bool all_finite_ = false;
+};
+
+/// Returns the statistics of the columns of the table. The first call
+/// computes them in one pass over the rows and keeps them with the table, so
+/// the next calls and the algorithms that need them do not pass over the
+/// values again. The copies of the table share the statistics. If the memory
+/// wrapped by the table is modified, the table shall be created again.
+ONEAPI_DAL_EXPORT column_stats compute_column_stats(const table& t);
+
+/// Returns true if the statistics of the columns are kept with the table
+ONEAPI_DAL_EXPORT bool has_column_stats(const table& t);
+
+/// Keeps the statistics computed by another pass over the values of the
+/// table, e.g. by the reading of the table, with it
+ONEAPI_DAL_EXPORT void set_column_stats(const table& t, const column_stats& stats);
+
+} // namespace oneapi::dal
@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <limits>
+#include <vector>
+
+#include "oneapi/dal/table/column_stats.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+
+TEST(column_stats_test, computes_statistics_of_columns) {
+    constexpr std::int64_t row_count = 3001;
+    constexpr std::int64_t column_count = 2;
+    std::vector<double> data(row_count * column_count);
+    for (std::int64_t i = 0; i < row_count; i++) {
+        data[i * column_count] = double(i);
+        data[i * column_count + 1] = double(i % 7) - 3.0;
+    }
+    const auto t = homogen_table::wrap(data.data(), row_count, column_count);
+
+    const auto stats = compute_column_stats(t);
+
+    ASSERT_EQ(stats.get_column_count(), column_count);
+    ASSERT_DOUBLE_EQ(stats.get_min()[0], 0.0);
+    ASSERT_DOUBLE_EQ(stats.get_max()[0], double(row_count - 1));
+    ASSERT_DOUBLE_EQ(stats.get_min()[1], -3.0);
+    ASSERT_DOUBLE_EQ(stats.get_max()[1], 3.0);
+    ASSERT_DOUBLE_EQ(stats.get_sum()[0], double(row_count) * (row_count - 1) / 2);
+    ASSERT_DOUBLE_EQ(stats.get_sum_squares()[0],
+                     double(row_count - 1) * row_count * (2 * row_count - 1) / 6);
+    ASSERT_TRUE(stats.get_all_finite());
+}
+
+TEST(column_stats_test, keeps_statistics_with_copies_of_table) {
+    const double data[] = { 1.0, 2.0, 3.0, 4.0 };
+    const auto t = homogen_table::wrap(data, 2, 2);
+    const table copy = t;
+
+    ASSERT_FALSE(has_column_stats(copy));
+    compute_column_stats(t);
+
+    ASSERT_TRUE(has_column_stats(copy));
+    ASSERT_DOUBLE_EQ(compute_column_stats(copy).get_sum()[1], 6.0);
+}
+
+TEST(column_stats_test, detects_not_finite_values) {
+    const double data[] = { 1.0, std::numeric_limits<double>::quiet_NaN(), 3.0, 4.0 };
+    const auto t = homogen_table::wrap(data, 2, 2);
+
+    ASSERT_FALSE(compute_column_stats(t).get_all_finite());
+}
+
+TEST(column_stats_test, throws_if_table_is_empty) {
+    ASSERT_THROW(compute_column_stats(table{}), invalid_argument);
+}
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/csr.hpp"
+#include "oneapi/dal/table/backend/csr_table_impl.hpp"
+
+using std::int64_t;
+
+namespace oneapi::dal {
+
+using csr_table_wrapper = detail::table_impl_wrapper<backend::csr_table_impl>;
+
+int64_t csr_table::kind() {
+    return backend::csr_table_impl::csr_table_kind;
+}
+
+csr_table::csr_table() {
+    table::init_impl(new csr_table_wrapper(backend::csr_table_impl{}));
+}
+
+const void* csr_table::get_data() const {
+    return detail::get_impl<csr_table_wrapper>(*this).get().get_data();
+}
+
+const int64_t* csr_table::get_column_indices() const {
+    return detail::get_impl<csr_table_wrapper>(*this).get().get_column_indices();
+}
+
+const int64_t* csr_table::get_row_offsets() const {
+    return detail::get_impl<csr_table_wrapper>(*this).get().get_row_offsets();
+}
+
+int64_t csr_table::get_non_zero_count() const {
+    return detail::get_impl<csr_table_wrapper>(*this).get().get_non_zero_count();
+}
+
+void csr_table::init_impl(const array<byte_t>& data,
+                          const data_type& dtype,
+                          const array<int64_t>& column_indices,
+                          const array<int64_t>& row_offsets,
+                          int64_t column_count) {
+    table::init_impl(new csr_table_wrapper(
+        backend::csr_table_impl{ data, dtype, column_indices, row_offsets, column_count }));
+}
+
+} // namespace oneapi::dal
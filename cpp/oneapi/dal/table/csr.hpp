@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal {
+
+/// The table in the compressed sparse row format: the non-zero values of the
+/// rows are stored one after another together with their column indices, the
+/// offsets array points to the first value of every row. The indices and the
+/// offsets are zero-based. The arrays are not copied.
+///
+/// The row and column accessors densify the requested rows on host, the
+/// algorithms with the sparse methods read the arrays directly.
+class ONEAPI_DAL_EXPORT csr_table : public table {
+public:
+    static std::int64_t kind();
+
+public:
+    csr_table();
+
+    /// Creates the table from the arrays in the compressed sparse row format
+    ///
+    /// @param [in] data           The non-zero values
+    /// @param [in] column_indices The column indices of the values, the size
+    ///                            shall be equal to the size of data
+    /// @param [in] row_offsets    The offsets of the rows in the values, the
+    ///                            size is the number of rows plus one, the
+    ///                            last element is the number of the values
+    /// @param [in] column_count   The number of columns
+    template <typename Data>
+    csr_table(const array<Data>& data,
+              const array<std::int64_t>& column_indices,
+              const array<std::int64_t>& row_offsets,
+              std::int64_t column_count) {
+        const auto byte_data = reinterpret_cast<const byte_t*>(data.get_data());
+        const std::int64_t byte_count = data.get_count() * std::int64_t(sizeof(Data));
+        init_impl(array<byte_t>{ data, byte_data, byte_count },
+                  detail::make_data_type<Data>(),
+                  column_indices,
+                  row_offsets,
+                  column_count);
+    }
+
+    template <typename Data>
+    const Data* get_data() const {
+        return reinterpret_cast<const Data*>(this->get_data());
+    }
+
+    const void* get_data() const;
+    const std::int64_t* get_column_indices() const;
+    const std::int64_t* get_row_offsets() const;
+
+    /// The number of the stored values
+    std::int64_t get_non_zero_count() const;
+
+    std::int64_t get_kind() const {
+        return kind();
+    }
+
+private:
+    void init_impl(const array<byte_t>& data,
+                   const data_type& dtype,
+                   const array<std::int64_t>& column_indices,
+                   const array<std::int64_t>& row_offsets,
+                   std::int64_t column_count);
+};
+
+} // namespace oneapi::dal
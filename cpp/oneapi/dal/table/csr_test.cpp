@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/table/csr.hpp"
+#include "oneapi/dal/table/column_accessor.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+using std::int64_t;
+
+TEST(csr_table_test, can_construct_empty_table) {
+    csr_table t;
+
+    ASSERT_FALSE(t.has_data());
+    ASSERT_EQ(t.get_kind(), csr_table::kind());
+    ASSERT_EQ(t.get_row_count(), 0);
+    ASSERT_EQ(t.get_column_count(), 0);
+    ASSERT_EQ(t.get_non_zero_count(), 0);
+}
+
+TEST(csr_table_test, can_construct_table_without_copy) {
+    const float data[] = { 1.f, 2.f, 3.f, 4.f };
+    const int64_t column_indices[] = { 0, 3, 1, 2 };
+    const int64_t row_offsets[] = { 0, 2, 2, 4 };
+
+    csr_table t{ array<float>::wrap(data, 4),
+                 array<int64_t>::wrap(column_indices, 4),
+                 array<int64_t>::wrap(row_offsets, 4),
+                 4 };
+
+    ASSERT_TRUE(t.has_data());
+    ASSERT_EQ(t.get_kind(), csr_table::kind());
+    ASSERT_EQ(t.get_row_count(), 3);
+    ASSERT_EQ(t.get_column_count(), 4);
+    ASSERT_EQ(t.get_non_zero_count(), 4);
+    ASSERT_EQ(t.get_metadata().get_data_type(0), data_type::float32);
+    ASSERT_EQ(t.get_data<float>(), data);
+    ASSERT_EQ(t.get_column_indices(), column_indices);
+    ASSERT_EQ(t.get_row_offsets(), row_offsets);
+}
+
+TEST(csr_table_test, can_read_dense_rows_and_columns) {
+    const double data[] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+    const int64_t column_indices[] = { 2, 0, 1, 0, 2 };
+    const int64_t row_offsets[] = { 0, 1, 3, 3, 5 };
+
+    csr_table t{ array<double>::wrap(data, 5),
+                 array<int64_t>::wrap(column_indices, 5),
+                 array<int64_t>::wrap(row_offsets, 5),
+                 3 };
+
+    const auto rows = row_accessor<const float>(t).pull({ 1, 4 });
+    const float expected_rows[] = { 2.f, 3.f, 0.f, 0.f, 0.f, 0.f, 4.f, 0.f, 5.f };
+    ASSERT_EQ(rows.get_count(), 9);
+    for (int64_t i = 0; i < 9; ++i) {
+        ASSERT_FLOAT_EQ(rows[i], expected_rows[i]);
+    }
+
+    const auto col = column_accessor<const double>(t).pull(2);
+    const double expected_column[] = { 1.0, 0.0, 0.0, 5.0 };
+    ASSERT_EQ(col.get_count(), 4);
+    for (int64_t i = 0; i < 4; ++i) {
+        ASSERT_DOUBLE_EQ(col[i], expected_column[i]);
+    }
+}
+
+TEST(csr_table_test, throws_on_mismatched_arrays) {
+    const float data[] = { 1.f, 2.f, 3.f };
+    const int64_t column_indices[] = { 0, 1 };
+    const int64_t row_offsets[] = { 0, 2 };
+
+    ASSERT_THROW((csr_table{ array<float>::wrap(data, 3),
+                             array<int64_t>::wrap(column_indices, 2),
+                             array<int64_t>::wrap(row_offsets, 2),
+                             2 }),
+                 invalid_argument);
+    ASSERT_THROW((csr_table{ array<float>::wrap(data, 2),
+                             array<int64_t>::wrap(column_indices, 2),
+                             array<int64_t>{},
+                             2 }),
+                 invalid_argument);
+}
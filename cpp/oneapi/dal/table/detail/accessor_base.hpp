@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/table/detail/access_iface.hpp"
 
 namespace oneapi::dal::detail {
@@ -60,6 +61,26 @@ public:
         }
     }
 
+    /// Pulls the block into the caller-owned buffer of the given capacity.
+    /// The block is copied into the buffer if the table provides it without
+    /// a copy.
+    template <typename Policy, typename Allocator>
+    T* pull(const Policy& policy,
+            data_t* buffer,
+            std::int64_t buffer_count,
+            const BlockIndex& idx,
+            const Allocator& alloc) const {
+        array<data_t> block{ buffer, buffer_count, empty_delete<data_t>() };
+        get_access(policy).pull(policy, block, idx, alloc);
+        if (block.get_data() != buffer) {
+            if (block.get_count() > buffer_count) {
+                throw invalid_argument("Buffer is too small for the pulled block");
+            }
+            memcpy(policy, buffer, block.get_data(), block.get_count() * sizeof(data_t));
+        }
+        return buffer;
+    }
+
     template <typename Policy>
     void push(const Policy& policy, const array<data_t>& block, const BlockIndex& idx) {
         get_access(policy).push(policy, block, idx);
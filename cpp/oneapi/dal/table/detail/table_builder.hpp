@@ -124,8 +124,16 @@ public:
         return impl.build_homogen();
     }
 
+    /// The allocator of the data allocated by the builder, null means the
+    /// default allocator of the library
+    auto& set_allocator(const std::shared_ptr<allocator_iface>& allocator) {
+        allocator_ = allocator;
+        return *this;
+    }
+
     auto& reset(homogen_table&& t) {
         auto& impl = get_impl();
+        const allocator_scope scope{ allocator_ };
         impl.reset(std::move(t));
         return *this;
     }
@@ -160,6 +168,7 @@ public:
     }
     auto& allocate(std::int64_t row_count, std::int64_t column_count) {
         auto& impl = get_impl();
+        const allocator_scope scope{ allocator_ };
         impl.allocate(row_count, column_count);
         return *this;
     }
@@ -170,16 +179,23 @@ public:
     }
     auto& copy_data(const void* data, std::int64_t row_count, std::int64_t column_count) {
         auto& impl = get_impl();
+        const allocator_scope scope{ allocator_ };
         impl.copy_data(data, row_count, column_count);
         return *this;
     }
 
 #ifdef ONEAPI_DAL_DATA_PARALLEL
+    auto& set_allocator(const std::shared_ptr<usm_allocator_iface>& allocator) {
+        usm_allocator_ = allocator;
+        return *this;
+    }
+
     auto& allocate(const sycl::queue& queue,
                    std::int64_t row_count,
                    std::int64_t column_count,
                    const sycl::usm::alloc& alloc = sycl::usm::alloc::shared) {
         auto& impl = get_impl();
+        const usm_allocator_scope scope{ usm_allocator_ };
         impl.allocate(queue, row_count, column_count, alloc);
         return *this;
     }
@@ -191,6 +207,7 @@ public:
                     const sycl::vector_class<sycl::event>& dependencies = {}) {
         auto& impl = get_impl();
         detail::wait_and_throw(dependencies);
+        const usm_allocator_scope scope{ usm_allocator_ };
         impl.copy_data(queue, data, row_count, column_count);
         return *this;
     }
@@ -200,6 +217,11 @@ private:
     detail::homogen_table_builder_iface& get_impl() {
         return detail::get_impl<detail::homogen_table_builder_iface>(*this);
     }
+
+    std::shared_ptr<allocator_iface> allocator_;
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    std::shared_ptr<usm_allocator_iface> usm_allocator_;
+#endif
 };
 
 } // namespace oneapi::dal::detail
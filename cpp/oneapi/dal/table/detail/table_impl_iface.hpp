@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <memory>
+
 #include "oneapi/dal/table/detail/access_iface.hpp"
 
 namespace oneapi::dal {
 
 class table_metadata;
+class column_stats;
 enum class data_layout;
 
 } // namespace oneapi::dal
@@ -34,6 +37,21 @@ public:
     virtual const table_metadata& get_metadata() const = 0;
     virtual std::int64_t get_kind() const = 0;
     virtual data_layout get_data_layout() const = 0;
+
+    /// The statistics of the columns computed from the values of the table,
+    /// shared by the copies of the table. They are set once the first pass
+    /// computes them and are not changed after it, since the tables are
+    /// immutable.
+    std::shared_ptr<const column_stats> get_column_stats() const {
+        return std::atomic_load(&column_stats_);
+    }
+
+    void set_column_stats(const std::shared_ptr<const column_stats>& stats) const {
+        std::atomic_store(&column_stats_, stats);
+    }
+
+private:
+    mutable std::shared_ptr<const column_stats> column_stats_;
 };
 
 class homogen_table_impl_iface : public table_impl_iface {
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/detail/table_serialization.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::detail {
+
+namespace {
+
+inline data_type get_serialized_data_type(const table& t) {
+    const data_type dtype = t.get_metadata().get_data_type(0);
+    switch (dtype) {
+        case data_type::float64:
+        case data_type::int32: return dtype;
+        default: return data_type::float32;
+    }
+}
+
+template <typename Data>
+void serialize_elements(const table& t, binary_output_archive& ar) {
+    const auto elements = row_accessor<const Data>{ t }.pull();
+    ar.write_array(elements.get_data(), elements.get_size());
+}
+
+/// Wraps the elements into the table without copying
+template <typename Data>
+table wrap_elements(const array<byte_t>& elements,
+                    std::int64_t row_count,
+                    std::int64_t column_count) {
+    const array<Data> data{ elements,
+                            reinterpret_cast<const Data*>(elements.get_data()),
+                            row_count * column_count };
+    return homogen_table_builder{}
+        .reset(data, row_count, column_count)
+        .set_layout(data_layout::row_major)
+        .build();
+}
+
+} // namespace
+
+void serialize_table(const table& t, binary_output_archive& ar) {
+    const bool has_data = t.has_data();
+    ar.write(std::uint32_t(has_data));
+    if (!has_data) {
+        return;
+    }
+
+    const data_type dtype = get_serialized_data_type(t);
+    ar.write(static_cast<std::uint32_t>(dtype));
+    ar.write(t.get_row_count());
+    ar.write(t.get_column_count());
+    switch (dtype) {
+        case data_type::float64: serialize_elements<double>(t, ar); break;
+        case data_type::int32: serialize_elements<std::int32_t>(t, ar); break;
+        default: serialize_elements<float>(t, ar); break;
+    }
+}
+
+table deserialize_table(binary_input_archive& ar) {
+    const bool has_data = ar.read<std::uint32_t>() != 0;
+    if (!has_data) {
+        return table{};
+    }
+
+    const auto dtype = static_cast<data_type>(ar.read<std::uint32_t>());
+    const auto row_count = ar.read<std::int64_t>();
+    const auto column_count = ar.read<std::int64_t>();
+    if ((dtype != data_type::float32 && dtype != data_type::float64 &&
+         dtype != data_type::int32) ||
+        row_count <= 0 || column_count <= 0) {
+        throw invalid_argument("Corrupted table of the serialized object");
+    }
+
+    const auto elements = ar.read_array(true);
+    if (elements.get_count() != row_count * column_count * get_data_type_size(dtype)) {
+        throw invalid_argument("Corrupted table of the serialized object");
+    }
+    switch (dtype) {
+        case data_type::float64: return wrap_elements<double>(elements, row_count, column_count);
+        case data_type::int32:
+            return wrap_elements<std::int32_t>(elements, row_count, column_count);
+        default: return wrap_elements<float>(elements, row_count, column_count);
+    }
+}
+
+} // namespace oneapi::dal::detail
@@ -0,0 +1,33 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/detail/archives.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::detail {
+
+/// Writes the shape, the data type and the row-major elements of the table.
+/// The floating-point and int32 tables keep their data type, the elements of
+/// other types are converted to float32.
+ONEAPI_DAL_EXPORT void serialize_table(const table& t, binary_output_archive& ar);
+
+/// Reads the table written by serialize_table() as the homogen table that
+/// refers to the memory of the archive without copying
+ONEAPI_DAL_EXPORT table deserialize_table(binary_input_archive& ar);
+
+} // namespace oneapi::dal::detail
@@ -93,6 +93,26 @@ public:
                   column_count,
                   data_pointer,
                   std::forward<ConstDeleter>(data_deleter),
+                  detail::make_data_type<Data>(),
+                  layout);
+    }
+
+    /// Creates the table over the data stored in the given type, e.g. over
+    /// ``std::uint16_t`` data holding ``data_type::bfloat16`` values. The
+    /// size of ``Data`` must match the size of the data type.
+    template <typename Data, typename ConstDeleter>
+    homogen_table(const Data* data_pointer,
+                  std::int64_t row_count,
+                  std::int64_t column_count,
+                  ConstDeleter&& data_deleter,
+                  data_type dtype,
+                  data_layout layout = data_layout::row_major) {
+        init_impl(detail::default_host_policy{},
+                  row_count,
+                  column_count,
+                  data_pointer,
+                  std::forward<ConstDeleter>(data_deleter),
+                  dtype,
                   layout);
     }
 
@@ -110,6 +130,26 @@ public:
                   column_count,
                   data_pointer,
                   std::forward<ConstDeleter>(data_deleter),
+                  detail::make_data_type<Data>(),
+                  layout);
+        detail::wait_and_throw(dependencies);
+    }
+
+    template <typename Data, typename ConstDeleter>
+    homogen_table(const sycl::queue& queue,
+                  const Data* data_pointer,
+                  std::int64_t row_count,
+                  std::int64_t column_count,
+                  ConstDeleter&& data_deleter,
+                  data_type dtype,
+                  const sycl::vector_class<sycl::event>& dependencies = {},
+                  data_layout layout = data_layout::row_major) {
+        init_impl(detail::data_parallel_policy{ queue },
+                  row_count,
+                  column_count,
+                  data_pointer,
+                  std::forward<ConstDeleter>(data_deleter),
+                  dtype,
                   layout);
         detail::wait_and_throw(dependencies);
     }
@@ -141,7 +181,12 @@ private:
                    std::int64_t column_count,
                    const Data* data_pointer,
                    ConstDeleter&& data_deleter,
+                   const data_type& dtype,
                    data_layout layout) {
+        if (std::int64_t(sizeof(Data)) != detail::get_data_type_size(dtype)) {
+            throw invalid_argument("Data type size mismatch");
+        }
+
         array<Data> data_array{ data_pointer,
                                 row_count * column_count,
                                 std::forward<ConstDeleter>(data_deleter) };
@@ -151,12 +196,7 @@ private:
 
         auto byte_array = array<byte_t>{ data_array, byte_data, byte_count };
 
-        init_impl(policy,
-                  row_count,
-                  column_count,
-                  byte_array,
-                  detail::make_data_type<Data>(),
-                  layout);
+        init_impl(policy, row_count, column_count, byte_array, dtype, layout);
     }
 
     template <typename Policy>
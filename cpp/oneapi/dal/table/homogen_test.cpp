@@ -14,11 +14,30 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdlib>
+
+#include "oneapi/dal/table/detail/table_builder.hpp"
 #include "oneapi/dal/table/homogen.hpp"
 #include "gtest/gtest.h"
 
 using namespace oneapi::dal;
 
+class counting_allocator : public detail::allocator_iface {
+public:
+    void* allocate(std::int64_t size) override {
+        allocated_bytes += size;
+        return std::malloc(size);
+    }
+
+    void deallocate(void* pointer, std::int64_t size) noexcept override {
+        deallocated_bytes += size;
+        std::free(pointer);
+    }
+
+    std::int64_t allocated_bytes = 0;
+    std::int64_t deallocated_bytes = 0;
+};
+
 TEST(homogen_table_test, can_construct_empty_table) {
     homogen_table t;
 
@@ -212,3 +231,35 @@ TEST(homogen_table_test, can_upcast_table) {
     ASSERT_EQ(data_type::float32, t.get_metadata().get_data_type(0));
     ASSERT_EQ(t.get_kind(), homogen_table::kind());
 }
+
+TEST(homogen_table_test, can_allocate_table_with_custom_allocator) {
+    auto allocator = std::make_shared<counting_allocator>();
+    {
+        auto t = detail::homogen_table_builder{}
+                     .set_allocator(allocator)
+                     .set_data_type(data_type::float64)
+                     .allocate(3, 2)
+                     .build();
+
+        ASSERT_EQ(3, t.get_row_count());
+        ASSERT_EQ(6 * sizeof(double), allocator->allocated_bytes);
+        ASSERT_EQ(0, allocator->deallocated_bytes);
+    }
+    ASSERT_EQ(6 * sizeof(double), allocator->deallocated_bytes);
+}
+
+TEST(homogen_table_test, allocates_arrays_in_allocator_scope) {
+    auto allocator = std::make_shared<counting_allocator>();
+    array<float> outside;
+    {
+        const detail::allocator_scope scope{ allocator };
+        auto arr = array<float>::zeros(10);
+        outside = array<float>::empty(5);
+    }
+    const auto arr = array<float>::empty(7);
+
+    ASSERT_EQ(15 * sizeof(float), allocator->allocated_bytes);
+    ASSERT_EQ(10 * sizeof(float), allocator->deallocated_bytes);
+    outside.reset();
+    ASSERT_EQ(15 * sizeof(float), allocator->deallocated_bytes);
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "oneapi/dal/table/homogen_view.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/backend/homogen_table_impl.hpp"
+
+namespace oneapi::dal {
+
+using std::int64_t;
+
+struct view_block {
+    // The rows of the row-major table or the columns of the column-major one
+    int64_t major_start;
+    int64_t major_count;
+    int64_t major_total;
+    // The elements within the major line
+    int64_t minor_start;
+    int64_t minor_count;
+    int64_t minor_total;
+};
+
+static void check_range(const range& r, int64_t max_count, const char* message) {
+    const int64_t count = r.get_element_count(max_count);
+    if (r.start_idx < 0 || count < 0 || r.start_idx + count > max_count) {
+        throw out_of_range(message);
+    }
+}
+
+static view_block make_view_block(const homogen_table& parent,
+                                  const range& rows,
+                                  const range& columns) {
+    const int64_t row_count = parent.get_row_count();
+    const int64_t column_count = parent.get_column_count();
+    check_range(rows, row_count, "Row range is out of the table");
+    check_range(columns, column_count, "Column range is out of the table");
+
+    const int64_t view_row_count = rows.get_element_count(row_count);
+    const int64_t view_column_count = columns.get_element_count(column_count);
+    if (parent.get_data_layout() == data_layout::column_major) {
+        return { columns.start_idx, view_column_count, column_count,
+                 rows.start_idx,    view_row_count,    row_count };
+    }
+    else {
+        return { rows.start_idx,    view_row_count,    row_count,
+                 columns.start_idx, view_column_count, column_count };
+    }
+}
+
+static bool is_contiguous(const view_block& block) {
+    return block.minor_count == block.minor_total || block.major_count <= 1;
+}
+
+bool homogen_table_view_builder::is_zero_copy() const {
+    return is_contiguous(make_view_block(parent_, rows_, columns_));
+}
+
+homogen_table homogen_table_view_builder::build() const {
+    const auto block = make_view_block(parent_, rows_, columns_);
+    const int64_t view_column_count = columns_.get_element_count(parent_.get_column_count());
+    if (block.major_count == 0 || block.minor_count == 0) {
+        return homogen_table{};
+    }
+
+    const data_type dtype = parent_.get_metadata().get_data_type(0);
+    const int64_t type_size = detail::get_data_type_size(dtype);
+    const auto parent_data = reinterpret_cast<const byte_t*>(parent_.get_data());
+    const int64_t line_size = block.minor_count * type_size;
+    const int64_t byte_count = block.major_count * line_size;
+    const auto block_start =
+        parent_data + (block.major_start * block.minor_total + block.minor_start) * type_size;
+
+    array<byte_t> data;
+    if (is_contiguous(block)) {
+        // The copy of the parent keeps its data alive until the view is destroyed
+        data = array<byte_t>{ block_start, byte_count, [parent = parent_](const byte_t*) {} };
+    }
+    else {
+        data.reset(byte_count);
+        auto dst = data.get_mutable_data();
+        const int64_t parent_line_size = block.minor_total * type_size;
+        for (int64_t i = 0; i < block.major_count; i++) {
+            std::memcpy(dst + i * line_size, block_start + i * parent_line_size, line_size);
+        }
+    }
+
+    return homogen_table{
+        backend::homogen_table_impl{ view_column_count, data, dtype, parent_.get_data_layout() }
+    };
+}
+
+} // namespace oneapi::dal
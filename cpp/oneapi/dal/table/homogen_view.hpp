@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/homogen.hpp"
+
+namespace oneapi::dal {
+
+/// Creates the tables over the blocks of rows and columns of a homogen table.
+/// The view shares the data of the parent table when the selected block is
+/// contiguous: a row range of the row-major table or a column range of the
+/// column-major table. The parent data stays alive while the view exists.
+/// Other blocks are copied into the new table on host.
+class ONEAPI_DAL_EXPORT homogen_table_view_builder {
+public:
+    explicit homogen_table_view_builder(const homogen_table& parent)
+            : parent_(parent),
+              rows_(0, -1),
+              columns_(0, -1) {}
+
+    /// Selects the rows [start_idx, end_idx) of the parent table, all the
+    /// rows are selected by default
+    homogen_table_view_builder& set_row_range(const range& rows) {
+        rows_ = rows;
+        return *this;
+    }
+
+    /// Selects the columns [start_idx, end_idx) of the parent table, all the
+    /// columns are selected by default
+    homogen_table_view_builder& set_column_range(const range& columns) {
+        columns_ = columns;
+        return *this;
+    }
+
+    /// Checks that the view built with the current ranges shares the data of
+    /// the parent table
+    bool is_zero_copy() const;
+
+    homogen_table build() const;
+
+private:
+    homogen_table parent_;
+    range rows_;
+    range columns_;
+};
+
+} // namespace oneapi::dal
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/homogen_view.hpp"
+#include "oneapi/dal/table/column_accessor.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+
+TEST(homogen_table_view_test, can_create_row_range_view_without_copy) {
+    const float data[] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+
+    homogen_table view;
+    {
+        const auto parent = homogen_table::wrap(data, 4, 2);
+        homogen_table_view_builder builder{ parent };
+        builder.set_row_range({ 1, 3 });
+        ASSERT_TRUE(builder.is_zero_copy());
+        view = builder.build();
+    }
+
+    ASSERT_EQ(view.get_row_count(), 2);
+    ASSERT_EQ(view.get_column_count(), 2);
+    ASSERT_EQ(view.get_data<float>(), data + 2);
+
+    const auto rows = row_accessor<const float>(view).pull();
+    ASSERT_EQ(rows.get_data(), data + 2);
+    ASSERT_FLOAT_EQ(rows[3], 6.f);
+}
+
+TEST(homogen_table_view_test, can_create_column_range_view_of_column_major_table_without_copy) {
+    const double data[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+
+    const homogen_table parent{ data, 2, 3, empty_delete<const double>(),
+                                data_layout::column_major };
+    homogen_table_view_builder builder{ parent };
+    builder.set_column_range({ 1, -1 });
+    ASSERT_TRUE(builder.is_zero_copy());
+
+    const auto view = builder.build();
+    ASSERT_EQ(view.get_data_layout(), data_layout::column_major);
+    ASSERT_EQ(view.get_row_count(), 2);
+    ASSERT_EQ(view.get_column_count(), 2);
+
+    const auto column = column_accessor<const double>(view).pull(1);
+    ASSERT_EQ(column.get_data(), data + 4);
+}
+
+TEST(homogen_table_view_test, can_create_strided_view_with_copy) {
+    const std::int32_t data[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+    const auto parent = homogen_table::wrap(data, 4, 3);
+    homogen_table_view_builder builder{ parent };
+    builder.set_row_range({ 1, 3 }).set_column_range({ 1, 3 });
+    ASSERT_FALSE(builder.is_zero_copy());
+
+    const auto view = builder.build();
+    ASSERT_EQ(view.get_metadata().get_data_type(0), data_type::int32);
+
+    const std::int32_t expected[] = { 5, 6, 8, 9 };
+    const auto rows = row_accessor<const std::int32_t>(view).pull();
+    ASSERT_EQ(rows.get_count(), 4);
+    for (std::int64_t i = 0; i < 4; i++) {
+        ASSERT_EQ(rows[i], expected[i]);
+    }
+}
+
+TEST(homogen_table_view_test, throws_if_range_is_out_of_table) {
+    const float data[] = { 1.f, 2.f, 3.f, 4.f };
+
+    const auto parent = homogen_table::wrap(data, 2, 2);
+    ASSERT_THROW(homogen_table_view_builder{ parent }.set_row_range({ 1, 3 }).build(),
+                 out_of_range);
+    ASSERT_THROW(homogen_table_view_builder{ parent }.set_column_range({ -1, 1 }).build(),
+                 out_of_range);
+}
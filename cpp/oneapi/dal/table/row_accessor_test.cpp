@@ -14,9 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+
 #include "oneapi/dal/table/row_accessor.hpp"
 #include "gtest/gtest.h"
 #include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/row_block_iterator.hpp"
 
 using namespace oneapi::dal;
 
@@ -67,3 +72,153 @@ TEST(homogen_table_test, can_read_table_data_via_row_accessor_and_array_outside)
         ASSERT_EQ(data_ptr[i], data[i]);
     }
 }
+
+TEST(homogen_table_test, can_read_column_major_table_data_via_row_accessor) {
+    float data[] = { 1.0f, 2.0f, 3.0f, -1.0f, -2.0f, -3.0f };
+
+    homogen_table t{ data, 3, 2, empty_delete<const float>(), data_layout::column_major };
+    const auto rows_block = row_accessor<const float>(t).pull({ 1, 3 });
+
+    const float expected[] = { 2.0f, -2.0f, 3.0f, -3.0f };
+    ASSERT_EQ(rows_block.get_count(), 4);
+    for (std::int64_t i = 0; i < rows_block.get_count(); i++) {
+        ASSERT_FLOAT_EQ(rows_block[i], expected[i]);
+    }
+}
+
+TEST(homogen_table_test, can_write_column_major_table_data_via_row_accessor) {
+    const double data[] = { 1.0, 2.0, 3.0, -1.0, -2.0, -3.0 };
+    auto arr = array<double>::empty(6);
+    std::copy(data, data + 6, arr.get_mutable_data());
+
+    detail::homogen_table_builder b;
+    b.reset(arr, 3, 2).set_layout(data_layout::column_major);
+    {
+        row_accessor<float> acc{ b };
+        auto rows_block = acc.pull({ 0, 2 });
+        rows_block.need_mutable_data();
+        for (std::int64_t i = 0; i < rows_block.get_count(); i++) {
+            rows_block.get_mutable_data()[i] *= 10.0f;
+        }
+        acc.push(rows_block, { 0, 2 });
+    }
+
+    auto t = b.build();
+    ASSERT_EQ(t.get_data_layout(), data_layout::column_major);
+
+    const double expected[] = { 10.0, 20.0, 3.0, -10.0, -20.0, -3.0 };
+    const auto result = t.get_data<double>();
+    for (std::int64_t i = 0; i < 6; i++) {
+        ASSERT_DOUBLE_EQ(result[i], expected[i]);
+    }
+}
+
+TEST(homogen_table_test, can_read_table_data_via_row_accessor_into_raw_buffer) {
+    float data[] = { 1.0f, 2.0f, 3.0f, -1.0f, -2.0f, -3.0f };
+
+    homogen_table t{ data, 2, 3, empty_delete<const float>() };
+    float same_type[6];
+    double converted[6];
+
+    ASSERT_EQ(row_accessor<const float>(t).pull(same_type, 6, { 1, 2 }), same_type);
+    ASSERT_EQ(row_accessor<const double>(t).pull(converted, 6), converted);
+
+    for (std::int64_t i = 0; i < 3; i++) {
+        ASSERT_FLOAT_EQ(same_type[i], data[3 + i]);
+    }
+    for (std::int64_t i = 0; i < 6; i++) {
+        ASSERT_DOUBLE_EQ(converted[i], static_cast<double>(data[i]));
+    }
+    ASSERT_THROW(row_accessor<const double>(t).pull(converted, 5), invalid_argument);
+}
+
+TEST(homogen_table_test, can_scan_table_data_via_row_block_iterator) {
+    float data[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f };
+
+    homogen_table t{ data, 5, 2, empty_delete<const float>() };
+    row_block_iterator<double> it{ t, 2 };
+
+    std::int64_t read_row_count = 0;
+    const double* block_data = nullptr;
+    while (it.next()) {
+        ASSERT_EQ(it.get_first_row(), read_row_count);
+        ASSERT_EQ(it.get_row_count(), std::min<std::int64_t>(2, 5 - read_row_count));
+        if (block_data) {
+            ASSERT_EQ(block_data, it.get_data());
+        }
+        block_data = it.get_data();
+
+        for (std::int64_t i = 0; i < it.get_row_count() * it.get_column_count(); i++) {
+            ASSERT_DOUBLE_EQ(it.get_data()[i], double(data[read_row_count * 2 + i]));
+        }
+        read_row_count += it.get_row_count();
+    }
+    ASSERT_EQ(read_row_count, 5);
+}
+
+TEST(homogen_table_test, can_read_bfloat16_table_data_via_row_accessor) {
+    // 1, 2, -3.5, 0.5, 256, -0.0078125 in bfloat16
+    const std::uint16_t data[] = { 0x3f80, 0x4000, 0xc060, 0x3f00, 0x4380, 0xbc00 };
+
+    homogen_table t{ data, 2, 3, empty_delete<const std::uint16_t>(), data_type::bfloat16 };
+    ASSERT_EQ(t.get_metadata().get_data_type(0), data_type::bfloat16);
+    ASSERT_EQ(t.get_metadata().get_feature_type(0), feature_type::ratio);
+
+    const auto rows_block = row_accessor<const float>(t).pull({ 0, -1 });
+
+    const float expected[] = { 1.0f, 2.0f, -3.5f, 0.5f, 256.0f, -0.0078125f };
+    ASSERT_EQ(rows_block.get_count(), 6);
+    for (std::int64_t i = 0; i < rows_block.get_count(); i++) {
+        ASSERT_FLOAT_EQ(rows_block[i], expected[i]);
+    }
+}
+
+TEST(homogen_table_test, can_read_float16_table_data_via_row_accessor) {
+    // 1, -3.5, 65504 (max), 2^-24 (min subnormal), +inf, NaN in float16
+    const std::uint16_t data[] = { 0x3c00, 0xc300, 0x7bff, 0x0001, 0x7c00, 0x7e00 };
+
+    homogen_table t{ data, 3, 2, empty_delete<const std::uint16_t>(), data_type::float16 };
+    const auto rows_block = row_accessor<const double>(t).pull({ 0, -1 });
+
+    ASSERT_EQ(rows_block.get_count(), 6);
+    ASSERT_DOUBLE_EQ(rows_block[0], 1.0);
+    ASSERT_DOUBLE_EQ(rows_block[1], -3.5);
+    ASSERT_DOUBLE_EQ(rows_block[2], 65504.0);
+    ASSERT_DOUBLE_EQ(rows_block[3], 1.0 / (1 << 24));
+    ASSERT_TRUE(std::isinf(rows_block[4]) && rows_block[4] > 0);
+    ASSERT_TRUE(std::isnan(rows_block[5]));
+
+    ASSERT_THROW((homogen_table{ data, 3, 2, empty_delete<const std::uint16_t>(),
+                                 data_type::float32 }),
+                 invalid_argument);
+}
+
+TEST(homogen_table_test, can_write_half_table_data_via_row_accessor) {
+    const float data[] = { 1.0f, 1.00390625f, 1.01171875f, -2.0f, 7.0e4f, 1.0e-8f };
+
+    for (auto dtype : { data_type::bfloat16, data_type::float16 }) {
+        detail::homogen_table_builder b;
+        b.set_data_type(dtype).allocate(2, 3);
+        {
+            row_accessor<float> acc{ b };
+            acc.push(array<float>::wrap(data, 6), { 0, 2 });
+        }
+
+        auto t = b.build();
+        const auto result = t.get_data<std::uint16_t>();
+        if (dtype == data_type::bfloat16) {
+            // Ties are rounded to even, large and tiny values are representable
+            const std::uint16_t expected[] = { 0x3f80, 0x3f80, 0x3f82, 0xc000, 0x4789, 0x322c };
+            for (std::int64_t i = 0; i < 6; i++) {
+                ASSERT_EQ(result[i], expected[i]);
+            }
+        }
+        else {
+            // Large values overflow to infinity, tiny values underflow to zero
+            const std::uint16_t expected[] = { 0x3c00, 0x3c04, 0x3c0c, 0xc000, 0x7c00, 0x0000 };
+            for (std::int64_t i = 0; i < 6; i++) {
+                ASSERT_EQ(result[i], expected[i]);
+            }
+        }
+    }
+}
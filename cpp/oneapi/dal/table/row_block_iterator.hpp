@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+#include <optional>
+#endif
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal {
+
+/// Reads the table in the consecutive blocks of rows. Every block is pulled
+/// into the same buffer, so the scan allocates at most once: when the first
+/// block needs a conversion.
+template <typename Data>
+class row_block_iterator {
+public:
+    row_block_iterator(const table& t, std::int64_t block_row_count)
+            : accessor_(t),
+              row_count_(t.get_row_count()),
+              column_count_(t.get_column_count()),
+              block_row_count_(block_row_count),
+              first_row_(0),
+              current_row_count_(0),
+              data_(nullptr) {
+        if (block_row_count <= 0) {
+            throw invalid_argument("Non-positive block_row_count");
+        }
+    }
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    row_block_iterator(sycl::queue& queue,
+                       const table& t,
+                       std::int64_t block_row_count,
+                       const sycl::usm::alloc& alloc = sycl::usm::alloc::shared)
+            : row_block_iterator(t, block_row_count) {
+        queue_ = queue;
+        alloc_ = alloc;
+    }
+#endif
+
+    /// Pulls the next block of rows
+    ///
+    /// @return False if all the rows are already read
+    bool next() {
+        first_row_ += current_row_count_;
+        if (first_row_ >= row_count_) {
+            current_row_count_ = 0;
+            data_ = nullptr;
+            return false;
+        }
+
+        current_row_count_ = std::min(block_row_count_, row_count_ - first_row_);
+        const range rows{ first_row_, first_row_ + current_row_count_ };
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+        if (queue_) {
+            data_ = accessor_.pull(*queue_, block_, rows, alloc_);
+            return true;
+        }
+#endif
+        data_ = accessor_.pull(block_, rows);
+        return true;
+    }
+
+    /// The rows of the current block in row-major order
+    const Data* get_data() const {
+        return data_;
+    }
+
+    /// The index of the first row of the current block in the table
+    std::int64_t get_first_row() const {
+        return first_row_;
+    }
+
+    /// The number of rows in the current block
+    std::int64_t get_row_count() const {
+        return current_row_count_;
+    }
+
+    std::int64_t get_column_count() const {
+        return column_count_;
+    }
+
+private:
+    row_accessor<const Data> accessor_;
+    array<Data> block_;
+    std::int64_t row_count_;
+    std::int64_t column_count_;
+    std::int64_t block_row_count_;
+    std::int64_t first_row_;
+    std::int64_t current_row_count_;
+    const Data* data_;
+
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+    std::optional<sycl::queue> queue_;
+    sycl::usm::alloc alloc_ = sycl::usm::alloc::shared;
+#endif
+};
+
+} // namespace oneapi::dal
@@ -24,6 +24,8 @@
 #include "oneapi/dal/train.hpp"
 #include "oneapi/dal/infer.hpp"
 #include "oneapi/dal/compute.hpp"
+#include "oneapi/dal/partial_train.hpp"
+#include "oneapi/dal/finalize_train.hpp"
 #include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/test/macro.hpp"
 
@@ -63,6 +65,16 @@ inline auto compute(host_test_policy& policy, Args&&... args) {
     return dal::compute(std::forward<Args>(args)...);
 }
 
+template <typename... Args>
+inline auto partial_train(host_test_policy& policy, Args&&... args) {
+    return dal::partial_train(std::forward<Args>(args)...);
+}
+
+template <typename... Args>
+inline auto finalize_train(host_test_policy& policy, Args&&... args) {
+    return dal::finalize_train(std::forward<Args>(args)...);
+}
+
 #ifdef ONEAPI_DAL_DATA_PARALLEL
 class test_queue_provider {
 public:
@@ -121,6 +133,16 @@ template <typename... Args>
 inline auto compute(device_test_policy& policy, Args&&... args) {
     return dal::compute(policy.get_queue(), std::forward<Args>(args)...);
 }
+
+template <typename... Args>
+inline auto partial_train(device_test_policy& policy, Args&&... args) {
+    return dal::partial_train(policy.get_queue(), std::forward<Args>(args)...);
+}
+
+template <typename... Args>
+inline auto finalize_train(device_test_policy& policy, Args&&... args) {
+    return dal::finalize_train(policy.get_queue(), std::forward<Args>(args)...);
+}
 #endif
 
 } // namespace oneapi::dal::test
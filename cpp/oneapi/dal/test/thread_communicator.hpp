@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dal/spmd/communicator.hpp"
+
+namespace oneapi::dal::test {
+
+/// The state shared by the ranks of the thread communicator
+class thread_communicator_context {
+public:
+    explicit thread_communicator_context(std::int64_t rank_count)
+            : rank_count_(rank_count),
+              buffers_(rank_count, nullptr) {}
+
+    std::int64_t get_rank_count() const {
+        return rank_count_;
+    }
+
+    void barrier() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const std::int64_t generation = generation_;
+        if (++arrived_count_ == rank_count_) {
+            arrived_count_ = 0;
+            generation_++;
+            cv_.notify_all();
+        }
+        else {
+            cv_.wait(lock, [&]() {
+                return generation_ != generation;
+            });
+        }
+    }
+
+    /// Publishes the buffer of the rank, the buffers of all ranks are
+    /// accessible between the following barriers
+    void publish(std::int64_t rank, const void* buf) {
+        buffers_[rank] = buf;
+        barrier();
+    }
+
+    const byte_t* get_buffer(std::int64_t rank) const {
+        return static_cast<const byte_t*>(buffers_[rank]);
+    }
+
+private:
+    const std::int64_t rank_count_;
+    std::vector<const void*> buffers_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::int64_t arrived_count_ = 0;
+    std::int64_t generation_ = 0;
+};
+
+/// The communicator over the threads of the test, every rank runs in its own
+/// thread
+class thread_communicator : public spmd::communicator_iface {
+public:
+    thread_communicator(thread_communicator_context& context, std::int64_t rank)
+            : context_(context),
+              rank_(rank) {}
+
+    std::int64_t get_rank() const override {
+        return rank_;
+    }
+
+    std::int64_t get_rank_count() const override {
+        return context_.get_rank_count();
+    }
+
+    void barrier() override {
+        context_.barrier();
+    }
+
+    void allreduce_sum(void* buf, std::int64_t count, data_type dtype) override {
+        switch (dtype) {
+            case data_type::int32:
+                allreduce_sum_impl(static_cast<std::int32_t*>(buf), count);
+                break;
+            case data_type::int64:
+                allreduce_sum_impl(static_cast<std::int64_t*>(buf), count);
+                break;
+            case data_type::float32:
+                allreduce_sum_impl(static_cast<float*>(buf), count);
+                break;
+            case data_type::float64:
+                allreduce_sum_impl(static_cast<double*>(buf), count);
+                break;
+            default: throw unimplemented("Data type is not supported by the thread communicator");
+        }
+    }
+
+    void allgather(const void* send_buf, std::int64_t size, void* recv_buf) override {
+        context_.publish(rank_, send_buf);
+        for (std::int64_t rank = 0; rank < get_rank_count(); rank++) {
+            std::memcpy(static_cast<byte_t*>(recv_buf) + rank * size,
+                        context_.get_buffer(rank),
+                        size);
+        }
+        context_.barrier();
+    }
+
+    void bcast(void* buf, std::int64_t size, std::int64_t root) override {
+        context_.publish(rank_, buf);
+        if (rank_ != root) {
+            std::memcpy(buf, context_.get_buffer(root), size);
+        }
+        context_.barrier();
+    }
+
+private:
+    template <typename T>
+    void allreduce_sum_impl(T* buf, std::int64_t count) {
+        std::vector<T> sums(count, T(0));
+        context_.publish(rank_, buf);
+        for (std::int64_t rank = 0; rank < get_rank_count(); rank++) {
+            const T* rank_buf = reinterpret_cast<const T*>(context_.get_buffer(rank));
+            for (std::int64_t i = 0; i < count; i++) {
+                sums[i] += rank_buf[i];
+            }
+        }
+        context_.barrier();
+        std::copy(sums.begin(), sums.end(), buf);
+    }
+
+    thread_communicator_context& context_;
+    const std::int64_t rank_;
+};
+
+/// Runs the body for every rank in its own thread and rethrows the first
+/// exception of the ranks. The body takes the rank and the communicator.
+template <typename Body>
+void run_spmd(std::int64_t rank_count, Body&& body) {
+    thread_communicator_context context{ rank_count };
+    std::vector<std::exception_ptr> errors(rank_count);
+    std::vector<std::thread> threads;
+    for (std::int64_t rank = 0; rank < rank_count; rank++) {
+        threads.emplace_back([&, rank]() {
+            try {
+                const spmd::communicator comm{ std::make_shared<thread_communicator>(context,
+                                                                                     rank) };
+                body(rank, comm);
+            }
+            catch (...) {
+                errors[rank] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace oneapi::dal::test
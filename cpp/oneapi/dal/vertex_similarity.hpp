@@ -30,4 +30,14 @@ auto vertex_similarity(Args &&... args) {
     return detail::vertex_similarity_dispatch(std::forward<Args>(args)...);
 }
 
+#ifdef ONEAPI_DAL_DATA_PARALLEL
+/// The main processing function for vertex similarity family of the algorithms
+/// on the device of the queue
+template <typename... Args>
+auto vertex_similarity(sycl::queue &queue, Args &&... args) {
+    return detail::vertex_similarity_dispatch(oneapi::dal::detail::data_parallel_policy{ queue },
+                                              std::forward<Args>(args)...);
+}
+#endif
+
 } // namespace oneapi::dal::preview
@@ -144,10 +144,14 @@ def dal_test(name, hdrs=[], srcs=[],
              host=True, dpc=True, framework="gtest",
              data=[], tags=[], **kwargs):
     # TODO: Refactor this rule once decision on the tests structure is made
-    if not framework in ["gtest", "catch2", "none"]:
+    if not framework in ["gtest", "catch2", "benchmark", "none"]:
         fail("Unknown test framework '{}' in test rule '{}'".format(framework, name))
     gtest = (framework == "gtest")
     catch2 = (framework == "catch2")
+    benchmark = (framework == "benchmark")
+    if benchmark:
+        # Benchmarks run on demand only, not as a part of the test targets
+        tags = tags + ["benchmark", "manual"]
     module_name = "__" + name
     if not host and dpc:
         module_name = _remove_dpc_suffix(module_name) + "_dpc"
@@ -204,7 +208,9 @@ def dal_test(name, hdrs=[], srcs=[],
             "@gtest//:gtest_main",
         ] if gtest else []) + ([
             "@onedal//cpp/oneapi/dal/test:catch2_main",
-        ] if catch2 else []) +
+        ] if catch2 else []) + ([
+            "@benchmark//:benchmark_main",
+        ] if benchmark else []) +
         extra_deps,
         testonly = True,
         **kwargs,
@@ -0,0 +1,100 @@
+#===============================================================================
+# Copyright 2020 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#===============================================================================
+
+##  Content:
+##     Generator of the C++ source which embeds the GPU program binaries into
+##     the library. The input is the directory of the program binary cache
+##     (DAAL_GPU_PROGRAM_CACHE_DIR) filled by the runs on the target devices.
+##     Usage: python gen_program_bundle.py <cache directory> <output .cpp>
+##******************************************************************************
+
+import os
+import re
+import sys
+
+KEY_PATTERN = re.compile(r'^[0-9a-f]{32}\.bin$')
+
+HEADER = '''/* file: gpu_program_bundle.cpp */
+/* This file is generated by dev/gen_program_bundle.py, do not edit */
+
+#include "services/internal/sycl/program_binary_cache.h"
+
+namespace
+{
+using daal::services::internal::sycl::ProgramBinaryBundle;
+using daal::services::internal::sycl::ProgramBinaryBundleEntry;
+'''
+
+FOOTER = '''
+struct BundleRegistrar
+{
+    BundleRegistrar() { ProgramBinaryBundle::registerEntries(entries, entryCount); }
+};
+
+const BundleRegistrar registrar;
+} // namespace
+'''
+
+def get_binaries(directory):
+    names = sorted(x for x in os.listdir(directory) if KEY_PATTERN.match(x))
+    binaries = []
+    for name in names:
+        with open(os.path.join(directory, name), 'rb') as f:
+            data = f.read()
+        if data:
+            binaries.append((name[:-len('.bin')], data))
+    return binaries
+
+def format_array(name, data):
+    lines = ['const unsigned char {}[] = {{'.format(name)]
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x{:02x}'.format(x) for x in data[i:i + 16]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+def generate(binaries):
+    parts = [HEADER]
+    for i, (_, data) in enumerate(binaries):
+        parts.append(format_array('binary{}'.format(i), data) + '\n')
+
+    entries = ['    {{ "{}", binary{}, sizeof(binary{}) }},'.format(key, i, i) for i, (key, _) in enumerate(binaries)]
+    # The empty bundle keeps the array well-formed
+    if not entries:
+        entries = ['    { nullptr, nullptr, 0 },']
+    parts.append('const ProgramBinaryBundleEntry entries[] = {\n' + '\n'.join(entries) + '\n};\n')
+    parts.append('const size_t entryCount = {};'.format(len(binaries)))
+    parts.append(FOOTER)
+    return '\n'.join(parts)
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write('Usage: {} <cache directory> <output .cpp>\n'.format(argv[0]))
+        return 1
+
+    binaries = get_binaries(argv[1])
+    content = generate(binaries)
+
+    # The unchanged file is not rewritten to avoid the rebuild
+    if os.path.exists(argv[2]):
+        with open(argv[2]) as f:
+            if f.read() == content:
+                return 0
+    with open(argv[2], 'w') as f:
+        f.write(content)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
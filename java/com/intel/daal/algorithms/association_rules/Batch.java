@@ -94,7 +94,7 @@ public class Batch extends AnalysisBatch {
             throw new IllegalArgumentException("type unsupported");
         }
 
-        if (this.method != Method.apriori) {
+        if (this.method != Method.apriori && this.method != Method.fpGrowth) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -50,7 +50,9 @@ public final class Method {
         return _value;
     }
 
-    private static final int   Apriori = 0;
-    public static final Method apriori = new Method(Apriori); /*!< Apriori method */
+    private static final int   Apriori  = 0;
+    private static final int   FpGrowth = 1;
+    public static final Method apriori  = new Method(Apriori);  /*!< Apriori method */
+    public static final Method fpGrowth = new Method(FpGrowth); /*!< FP-growth method */
 }
 /** @} */
@@ -27,7 +27,8 @@ USING_COMMON_NAMESPACES();
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Input_cInit(JNIEnv * env, jobject thisObj, jlong algAddr, jint prec,
                                                                                       jint method, jint cmode)
 {
-    return jniBatch<association_rules::Method, association_rules::Batch, association_rules::apriori>::getInput(prec, method, algAddr);
+    return jniBatch<association_rules::Method, association_rules::Batch, association_rules::apriori, association_rules::fpGrowth>::getInput(
+        prec, method, algAddr);
 }
 
 /*
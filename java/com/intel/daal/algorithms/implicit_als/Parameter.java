@@ -123,6 +123,23 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
         return cGetPreferenceThreshold(this.cObject);
     }
 
+    /**
+     * Sets the number of the conjugate gradient iterations used to solve the system of every row,
+     * 0 means the systems are solved by the Cholesky decomposition
+     * @param nConjugateGradientIterations Number of the conjugate gradient iterations
+     */
+    public void setNConjugateGradientIterations(long nConjugateGradientIterations) {
+        cSetNConjugateGradientIterations(this.cObject, nConjugateGradientIterations);
+    }
+
+    /**
+     * Gets the number of the conjugate gradient iterations used to solve the system of every row
+     * @return Number of the conjugate gradient iterations
+     */
+    public long getNConjugateGradientIterations() {
+        return cGetNConjugateGradientIterations(this.cObject);
+    }
+
     private native void cSetNFactors(long algAddr, long nFactors);
 
     private native long cGetNFactors(long algAddr);
@@ -142,5 +159,9 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
     private native void cSetPreferenceThreshold(long algAddr, double preferenceThreshold);
 
     private native double cGetPreferenceThreshold(long algAddr);
+
+    private native void cSetNConjugateGradientIterations(long algAddr, long nConjugateGradientIterations);
+
+    private native long cGetNConjugateGradientIterations(long algAddr);
 }
 /** @} */
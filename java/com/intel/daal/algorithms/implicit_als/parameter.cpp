@@ -124,3 +124,24 @@ JNIEXPORT jdouble JNICALL Java_com_intel_daal_algorithms_implicit_1als_Parameter
 {
     return ((Parameter *)parAddr)->preferenceThreshold;
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_implicit_als_Parameter
+ * Method:    cSetNConjugateGradientIterations
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_implicit_1als_Parameter_cSetNConjugateGradientIterations(JNIEnv *, jobject, jlong parAddr,
+                                                                                                               jlong nConjugateGradientIterations)
+{
+    ((Parameter *)parAddr)->nConjugateGradientIterations = nConjugateGradientIterations;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_implicit_als_Parameter
+ * Method:    cGetNConjugateGradientIterations
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_implicit_1als_Parameter_cGetNConjugateGradientIterations(JNIEnv *, jobject, jlong parAddr)
+{
+    return ((Parameter *)parAddr)->nConjugateGradientIterations;
+}
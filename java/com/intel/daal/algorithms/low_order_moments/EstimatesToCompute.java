@@ -48,11 +48,15 @@ public final class EstimatesToCompute {
         return _value;
     }
 
-    @Native private static final int EstimatesAll          = 0;
-    @Native private static final int EstimatesMinMax       = 1;
-    @Native private static final int EstimatesMeanVariance = 2;
-
-    public static final EstimatesToCompute estimatesAll           = new EstimatesToCompute(EstimatesAll);          /*!< Default: Compute all supported moments */
-    public static final EstimatesToCompute estimatesMinMax        = new EstimatesToCompute(EstimatesMinMax);       /*!< MinMAx: Compute minimum and maximum  */
-    public static final EstimatesToCompute estimatesMeanVariance  = new EstimatesToCompute(EstimatesMeanVariance); /*!< MeanVariance: Compute mean and variance  */
+    @Native private static final int EstimatesAll                = 0;
+    @Native private static final int EstimatesMinMax             = 1;
+    @Native private static final int EstimatesMeanVariance       = 2;
+    @Native private static final int EstimatesMean               = 3;
+    @Native private static final int EstimatesMinMaxMeanVariance = 4;
+
+    public static final EstimatesToCompute estimatesAll                = new EstimatesToCompute(EstimatesAll);                /*!< Default: Compute all supported moments */
+    public static final EstimatesToCompute estimatesMinMax             = new EstimatesToCompute(EstimatesMinMax);             /*!< MinMAx: Compute minimum and maximum  */
+    public static final EstimatesToCompute estimatesMeanVariance       = new EstimatesToCompute(EstimatesMeanVariance);       /*!< MeanVariance: Compute mean and variance  */
+    public static final EstimatesToCompute estimatesMean               = new EstimatesToCompute(EstimatesMean);               /*!< Mean: Compute mean  */
+    public static final EstimatesToCompute estimatesMinMaxMeanVariance = new EstimatesToCompute(EstimatesMinMaxMeanVariance); /*!< MinMaxMeanVariance: Compute minimum, maximum, mean and variance  */
 }
@@ -22,9 +22,11 @@
 #include "com/intel/daal/common_helpers.h"
 
 #include "com_intel_daal_algorithms_low_order_moments_EstimatesToCompute.h"
-#define EstimatesAll          com_intel_daal_algorithms_low_order_moments_EstimatesToCompute_EstimatesAll
-#define EstimatesMinMax       com_intel_daal_algorithms_low_order_moments_EstimatesToCompute_EstimatesMinMax
-#define EstimatesMeanVariance com_intel_daal_algorithms_low_order_moments_EstimatesToCompute_EstimatesMeanVariance
+#define EstimatesAll                com_intel_daal_algorithms_low_order_moments_EstimatesToCompute_EstimatesAll
+#define EstimatesMinMax             com_intel_daal_algorithms_low_order_moments_EstimatesToCompute_EstimatesMinMax
+#define EstimatesMeanVariance       com_intel_daal_algorithms_low_order_moments_EstimatesToCompute_EstimatesMeanVariance
+#define EstimatesMean               com_intel_daal_algorithms_low_order_moments_EstimatesToCompute_EstimatesMean
+#define EstimatesMinMaxMeanVariance com_intel_daal_algorithms_low_order_moments_EstimatesToCompute_EstimatesMinMaxMeanVariance
 
 USING_COMMON_NAMESPACES()
 using namespace daal;
@@ -52,6 +54,14 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_low_1order_1moments_Parame
     {
         parameterAddr->estimatesToCompute = low_order_moments::estimatesMeanVariance;
     }
+    else if (estComp == EstimatesMean)
+    {
+        parameterAddr->estimatesToCompute = low_order_moments::estimatesMean;
+    }
+    else if (estComp == EstimatesMinMaxMeanVariance)
+    {
+        parameterAddr->estimatesToCompute = low_order_moments::estimatesMinMaxMeanVariance;
+    }
 }
 
 /*
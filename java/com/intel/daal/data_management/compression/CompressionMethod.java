@@ -50,6 +50,7 @@ public final class CompressionMethod {
     @Native private static final int Lzo   = 1;
     @Native private static final int Rle   = 2;
     @Native private static final int Bzip2 = 3;
+    @Native private static final int Lz4   = 4;
 
     public static final CompressionMethod zlib  = new CompressionMethod(Zlib);  /*!< DEFLATE compression method with ZLIB block header
                                                                                      or simple GZIP block header */
@@ -57,5 +58,6 @@ public final class CompressionMethod {
             Lzo);                                                               /*!< LZO1X compatible compression method */
     public static final CompressionMethod rle   = new CompressionMethod(Rle);   /*!< Run-Length Encoding method */
     public static final CompressionMethod bzip2 = new CompressionMethod(Bzip2); /*!< BZIP2 compression method */
+    public static final CompressionMethod lz4   = new CompressionMethod(Lz4);   /*!< LZ4 compression method */
 }
 /** @} */
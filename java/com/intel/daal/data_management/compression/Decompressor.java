@@ -46,7 +46,7 @@ public class Decompressor extends Compression {
     public Decompressor(DaalContext context, CompressionMethod method) {
         super(context);
         if (method != CompressionMethod.zlib && method != CompressionMethod.lzo && method != CompressionMethod.rle
-                && method != CompressionMethod.bzip2) {
+                && method != CompressionMethod.bzip2 && method != CompressionMethod.lz4) {
             throw new IllegalArgumentException("method unsupported");
         }
         this.cObject = cInit(method.getValue());
@@ -37,3 +37,4 @@
 #define Lzo   com_intel_daal_data_management_compression_CompressionMethod_Lzo
 #define Rle   com_intel_daal_data_management_compression_CompressionMethod_Rle
 #define Bzip2 com_intel_daal_data_management_compression_CompressionMethod_Bzip2
+#define Lz4   com_intel_daal_data_management_compression_CompressionMethod_Lz4
@@ -34,6 +34,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_compression_Compres
     case Lzo: compressor = (jlong)(new Compressor<data_management::lzo>()); break;
     case Rle: compressor = (jlong)(new Compressor<data_management::rle>()); break;
     case Bzip2: compressor = (jlong)(new Compressor<data_management::bzip2>()); break;
+    case Lz4: compressor = (jlong)(new Compressor<data_management::lz4>()); break;
     default: break;
     }
     return compressor;
@@ -49,6 +50,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_compression_Compres
     case Lzo: par = (jlong) & (((Compressor<data_management::lzo> *)comprAddr)->parameter); break;
     case Rle: par = (jlong) & (((Compressor<data_management::rle> *)comprAddr)->parameter); break;
     case Bzip2: par = (jlong) & (((Compressor<data_management::bzip2> *)comprAddr)->parameter); break;
+    case Lz4: par = (jlong) & (((Compressor<data_management::lz4> *)comprAddr)->parameter); break;
     default: break;
     }
     return par;
@@ -34,6 +34,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_compression_Decompr
     case Lzo: decompressor = (jlong)(new Decompressor<data_management::lzo>()); break;
     case Rle: decompressor = (jlong)(new Decompressor<data_management::rle>()); break;
     case Bzip2: decompressor = (jlong)(new Decompressor<data_management::bzip2>()); break;
+    case Lz4: decompressor = (jlong)(new Decompressor<data_management::lz4>()); break;
     default: break;
     }
     return decompressor;
@@ -49,6 +50,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_compression_Decompr
     case Lzo: par = (jlong) & (((Decompressor<data_management::lzo> *)comprAddr)->parameter); break;
     case Rle: par = (jlong) & (((Decompressor<data_management::rle> *)comprAddr)->parameter); break;
     case Bzip2: par = (jlong) & (((Decompressor<data_management::bzip2> *)comprAddr)->parameter); break;
+    case Lz4: par = (jlong) & (((Decompressor<data_management::lz4> *)comprAddr)->parameter); break;
     default: break;
     }
     return par;
@@ -0,0 +1,47 @@
+/* file: Lz4CompressionParameter.java */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/**
+ * @ingroup data_compression
+ * @{
+ */
+package com.intel.daal.data_management.compression.lz4;
+
+import com.intel.daal.utils.*;
+import com.intel.daal.data_management.compression.CompressionParameter;
+import com.intel.daal.services.DaalContext;
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__COMPRESSION__LZ4__LZ4COMPRESSIONPARAMETER"></a>
+ *
+ * @brief Parameter for the LZ4 compression and decompression
+ * LZ4 compressed block header consists of two sections: 1) uncompressed data size(4 bytes),
+ * 2) compressed data size(4 bytes).
+ *
+ * @par Enumerations
+ *      - @ref CompressionLevel - %Compression levels enumeration
+ */
+public class Lz4CompressionParameter extends CompressionParameter {
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    public Lz4CompressionParameter(DaalContext context, long cParameter) {
+        super(context, cParameter);
+    }
+}
+/** @} */
@@ -0,0 +1,56 @@
+/* file: Lz4Compressor.java */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup data_compression
+ * @{
+ */
+package com.intel.daal.data_management.compression.lz4;
+
+import com.intel.daal.utils.*;
+import com.intel.daal.data_management.compression.CompressionMethod;
+import com.intel.daal.data_management.compression.Compressor;
+import com.intel.daal.services.DaalContext;
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__COMPRESSION__LZ4__LZ4COMPRESSOR"></a>
+ *
+ * @brief Specialization of the Compressor class for the LZ4 compression method
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * @par References
+ *      - @ref Lz4CompressionParameter class
+ */
+public class Lz4Compressor extends Compressor {
+    public Lz4CompressionParameter parameter; /*!< LZ4 compression parameters */
+
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    /**
+     * Constructs the LZ4 compression algorithm
+     * @param context   Context to manage the LZ4 compression algorithm
+     */
+    public Lz4Compressor(DaalContext context) {
+        super(context, CompressionMethod.lz4);
+        parameter = new Lz4CompressionParameter(context,
+                cInitParameter(this.cObject, CompressionMethod.lz4.getValue()));
+    }
+}
+/** @} */
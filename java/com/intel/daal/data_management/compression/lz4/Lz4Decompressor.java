@@ -0,0 +1,56 @@
+/* file: Lz4Decompressor.java */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup data_compression
+ * @{
+ */
+package com.intel.daal.data_management.compression.lz4;
+
+import com.intel.daal.utils.*;
+import com.intel.daal.data_management.compression.CompressionMethod;
+import com.intel.daal.data_management.compression.Decompressor;
+import com.intel.daal.services.DaalContext;
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__COMPRESSION__LZ4__LZ4DECOMPRESSOR"></a>
+ *
+ * @brief Specialization of the Decompressor class for the LZ4 decompression method
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * @par References
+ *      - @ref Lz4CompressionParameter class
+ */
+public class Lz4Decompressor extends Decompressor {
+    public Lz4CompressionParameter parameter; /*!< LZ4 compression parameters */
+
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    /**
+     * Constructs the LZ4 decompression algorithm
+     * @param context   Context to manage the LZ4 decompression algorithm
+     */
+    public Lz4Decompressor(DaalContext context) {
+        super(context, CompressionMethod.lz4);
+        parameter = new Lz4CompressionParameter(context,
+                cInitParameter(this.cObject, CompressionMethod.lz4.getValue()));
+    }
+}
+/** @} */
@@ -22,6 +22,7 @@
 package com.intel.daal.data_management.data;
 
 import com.intel.daal.utils.*;
+import java.nio.ByteBuffer;
 import java.nio.DoubleBuffer;
 import java.nio.FloatBuffer;
 import java.nio.IntBuffer;
@@ -476,6 +477,38 @@ public class HomogenNumericTable extends NumericTable {
         tableImpl = new HomogenNumericTableByteBufferImpl(context, cls, nColumns, nRows, allocFlag, constValue, featuresEqual);
     }
 
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer without copying,
+     * e.g. the off-heap memory of the Spark partition or of the Apache Arrow vector wrapped into the buffer.
+     * The buffer is kept alive while the C++ numeric table uses its memory, the values are stored in the native byte order
+     *
+     * @param context                 Context to manage created homogeneous numeric table
+     * @param cls                     Numeric type of values in the table
+     * @param buffer                  Direct buffer with nRows x nColumns values stored row by row
+     * @param nColumns                Number of columns in the table
+     * @param nRows                   Number of rows in the table
+     */
+    public HomogenNumericTable(DaalContext context, Class<? extends Number> cls, ByteBuffer buffer, long nColumns, long nRows) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, cls, buffer, nColumns, nRows, DataDictionary.FeaturesEqual.notEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer without copying
+     *
+     * @param context                 Context to manage created homogeneous numeric table
+     * @param featuresEqual           Flag that makes all features in the Numeric Table Data Dictionary equal
+     * @param cls                     Numeric type of values in the table
+     * @param buffer                  Direct buffer with nRows x nColumns values stored row by row
+     * @param nColumns                Number of columns in the table
+     * @param nRows                   Number of rows in the table
+     */
+    public HomogenNumericTable(DaalContext context, DataDictionary.FeaturesEqual featuresEqual, Class<? extends Number> cls, ByteBuffer buffer,
+            long nColumns, long nRows) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, cls, buffer, nColumns, nRows, featuresEqual);
+    }
+
     /**
      * Constructs an empty Numeric Table with a predefined Data Dictionary
      *
@@ -22,6 +22,7 @@
 package com.intel.daal.data_management.data;
 
 import com.intel.daal.utils.*;
+import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
 import java.nio.DoubleBuffer;
@@ -40,6 +41,9 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
 
     private static final long maxBufferSize = 2147483647;
 
+    /* The direct buffer whose memory is used by the C++ numeric table without copying */
+    private ByteBuffer adoptedBuffer = null;
+
     /** @private */
     static {
         LibUtils.loadLibrary();
@@ -120,6 +124,37 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         }
     }
 
+    /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,Class<? extends Number>,ByteBuffer,long,long,DataDictionary.FeaturesEqual) */
+    public HomogenNumericTableByteBufferImpl(DaalContext context, Class<? extends Number> cls, ByteBuffer buffer, long nColumns, long nRows,
+            DataDictionary.FeaturesEqual featuresEqual) {
+        super(context);
+        if (!buffer.isDirect()) {
+            throw new IllegalArgumentException("direct buffer is expected");
+        }
+        if (cls == Double.class) {
+            cObject = dInitFromBuffer(buffer, nColumns, nRows, featuresEqual.ordinal());
+        } else if (cls == Float.class) {
+            cObject = sInitFromBuffer(buffer, nColumns, nRows, featuresEqual.ordinal());
+        } else if (cls == Long.class) {
+            cObject = lInitFromBuffer(buffer, nColumns, nRows, featuresEqual.ordinal());
+        } else if (cls == Integer.class) {
+            cObject = iInitFromBuffer(buffer, nColumns, nRows, featuresEqual.ordinal());
+        } else {
+            throw new IllegalArgumentException("type unsupported");
+        }
+        dict = new DataDictionary(context, nColumns, cGetCDataDictionary(cObject));
+        if (dict.getFeaturesEqual().ordinal() == DataDictionary.FeaturesEqual.equal.ordinal()) {
+            dict.setFeature(cls, 0);
+        } else {
+            for (int i = 0; i < nColumns; i++) {
+                dict.setFeature(cls, i);
+            }
+        }
+        type = cls;
+        dataAllocatedInJava = false;
+        adoptedBuffer = buffer;
+    }
+
     /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,Class<? extends Number>,DataDictionary) */
     public HomogenNumericTableByteBufferImpl(DaalContext context, Class<? extends Number> cls, DataDictionary dict) {
         super(context);
@@ -162,6 +197,10 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
+        if (isAdoptedBufferOf(Double.class)) {
+            return getAdoptedBlock(vectorIndex * nColumns * 8, bufferSize * 8).asDoubleBuffer();
+        }
+
         // Gets data from C++ NumericTable object
         if (bufferSize * 8 > maxBufferSize) {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
@@ -180,6 +219,10 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
+        if (isAdoptedBufferOf(Float.class)) {
+            return getAdoptedBlock(vectorIndex * nColumns * 4, bufferSize * 4).asFloatBuffer();
+        }
+
         // Gets data from C++ NumericTable object
         if (bufferSize * 4 > maxBufferSize) {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
@@ -198,6 +241,10 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
+        if (isAdoptedBufferOf(Integer.class)) {
+            return getAdoptedBlock(vectorIndex * nColumns * 4, bufferSize * 4).asIntBuffer();
+        }
+
         // Gets data from C++ NumericTable object
         if (bufferSize * 4> maxBufferSize) {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
@@ -271,6 +318,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
         }
 
+        // The views of the adopted buffer are released in place, other direct buffers are read without a copy on the Java heap
+        if (buf.isDirect() && buf.order() == ByteOrder.nativeOrder() && buf.capacity() >= bufferSize) {
+            releaseDoubleBlockBuffer(getCObject(), vectorIndex, vectorNum, buf);
+            return;
+        }
+
         double[] data = new double[buf.capacity()];
         buf.position(0);
         buf.get(data);
@@ -293,6 +346,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
         }
 
+        // The views of the adopted buffer are released in place, other direct buffers are read without a copy on the Java heap
+        if (buf.isDirect() && buf.order() == ByteOrder.nativeOrder() && buf.capacity() >= bufferSize) {
+            releaseFloatBlockBuffer(getCObject(), vectorIndex, vectorNum, buf);
+            return;
+        }
+
         float[] data = new float[buf.capacity()];
         buf.position(0);
         buf.get(data);
@@ -315,6 +374,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
         }
 
+        // The views of the adopted buffer are released in place, other direct buffers are read without a copy on the Java heap
+        if (buf.isDirect() && buf.order() == ByteOrder.nativeOrder() && buf.capacity() >= bufferSize) {
+            releaseIntBlockBuffer(getCObject(), vectorIndex, vectorNum, buf);
+            return;
+        }
+
         int[] data = new int[buf.capacity()];
         buf.position(0);
         buf.get(data);
@@ -613,6 +678,18 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         }
     }
 
+    private boolean isAdoptedBufferOf(Class<? extends Number> cls) {
+        return adoptedBuffer != null && type == cls;
+    }
+
+    /* Returns the view of the adopted buffer, the writes to the view are the writes to the table */
+    private ByteBuffer getAdoptedBlock(long offset, long size) {
+        ByteBuffer view = adoptedBuffer.duplicate();
+        view.limit((int)(offset + size));
+        view.position((int)offset);
+        return view.slice().order(ByteOrder.nativeOrder());
+    }
+
     private void initHomogenNumericTable(DaalContext context, Class<? extends Number> cls, DataDictionary dict) {
         this.dict = dict;
         cObject = dictInit(dict.getCObject());
@@ -625,6 +702,10 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     private native long sInit(long nColumns, int featuresEqual);
     private native long lInit(long nColumns, int featuresEqual);
     private native long iInit(long nColumns, int featuresEqual);
+    private native long dInitFromBuffer(ByteBuffer buffer, long nColumns, long nRows, int featuresEqual);
+    private native long sInitFromBuffer(ByteBuffer buffer, long nColumns, long nRows, int featuresEqual);
+    private native long lInitFromBuffer(ByteBuffer buffer, long nColumns, long nRows, int featuresEqual);
+    private native long iInitFromBuffer(ByteBuffer buffer, long nColumns, long nRows, int featuresEqual);
     private native long dictInit(long cObject);
 
     private native void cAllocateDataMemoryDouble(long cObject);
@@ -645,9 +726,9 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     private native ByteBuffer getFloatBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
     private native ByteBuffer getIntBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
 
-    private native void releaseDoubleBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
-    private native void releaseFloatBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
-    private native void releaseIntBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
+    private native void releaseDoubleBlockBuffer(long cObject, long vectorIndex, long vectorNum, Buffer buffer);
+    private native void releaseFloatBlockBuffer(long cObject, long vectorIndex, long vectorNum, Buffer buffer);
+    private native void releaseIntBlockBuffer(long cObject, long vectorIndex, long vectorNum, Buffer buffer);
 
     private native void assignLong(long cObject, long constValue);
     private native void assignInt(long cObject, int constValue);
@@ -107,6 +107,124 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumeric
     return (jlong)sPtr;
 }
 
+namespace
+{
+/* Holds the global reference to the direct buffer adopted by the numeric table, so the buffer is not collected while the table refers to
+   its memory. The reference is deleted together with the last reference to the table memory, possibly on the thread not attached to JVM */
+class DirectBufferDeleter : public services::DeleterIface
+{
+public:
+    DirectBufferDeleter(JavaVM * jvm, jobject buffer) : _jvm(jvm), _buffer(buffer) {}
+
+    void operator()(const void * /*ptr*/) DAAL_C11_OVERRIDE
+    {
+        JNIEnv * env = NULL;
+        jint status  = _jvm->GetEnv((void **)&env, JNI_VERSION_1_6);
+        if (status == JNI_OK)
+        {
+            env->DeleteGlobalRef(_buffer);
+        }
+        else if (status == JNI_EDETACHED && _jvm->AttachCurrentThread((void **)&env, NULL) == JNI_OK)
+        {
+            env->DeleteGlobalRef(_buffer);
+            _jvm->DetachCurrentThread();
+        }
+    }
+
+private:
+    JavaVM * _jvm;
+    jobject _buffer;
+};
+
+/* Creates the numeric table over the memory of the direct buffer without copying */
+template <typename T>
+jlong initFromDirectBuffer(JNIEnv * env, jobject byteBuffer, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    T * data = (T *)(env->GetDirectBufferAddress(byteBuffer));
+    if (!data || env->GetDirectBufferCapacity(byteBuffer) < (jlong)(nColumns * nRows * sizeof(T)))
+    {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "Direct buffer with enough capacity is expected");
+        return 0;
+    }
+
+    JavaVM * jvm = NULL;
+    if (env->GetJavaVM(&jvm) != JNI_OK)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), "Couldn't get Java VM");
+        return 0;
+    }
+
+    jobject bufferRef = env->NewGlobalRef(byteBuffer);
+    if (!bufferRef)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), "Couldn't create global ref from byteBuffer");
+        return 0;
+    }
+
+    services::Status s;
+    const services::SharedPtr<T> dataPtr(data, DirectBufferDeleter(jvm, bufferRef));
+    NumericTablePtr tbl = HomogenNumericTable<T>::create((DictionaryIface::FeaturesEqual)featuresEqual, dataPtr, nColumns, nRows, &s);
+    if (!s)
+    {
+        DAAL_CHECK_THROW(s);
+        return 0;
+    }
+    return (jlong)(new SerializationIfacePtr(tbl));
+}
+} // namespace
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    dInitFromBuffer
+ * Signature:(Ljava/nio/ByteBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_dInitFromBuffer(JNIEnv * env, jobject thisobj,
+                                                                                                                    jobject byteBuffer,
+                                                                                                                    jlong nColumns, jlong nRows,
+                                                                                                                    jint featuresEqual)
+{
+    return initFromDirectBuffer<double>(env, byteBuffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    sInitFromBuffer
+ * Signature:(Ljava/nio/ByteBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_sInitFromBuffer(JNIEnv * env, jobject thisobj,
+                                                                                                                    jobject byteBuffer,
+                                                                                                                    jlong nColumns, jlong nRows,
+                                                                                                                    jint featuresEqual)
+{
+    return initFromDirectBuffer<float>(env, byteBuffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    lInitFromBuffer
+ * Signature:(Ljava/nio/ByteBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_lInitFromBuffer(JNIEnv * env, jobject thisobj,
+                                                                                                                    jobject byteBuffer,
+                                                                                                                    jlong nColumns, jlong nRows,
+                                                                                                                    jint featuresEqual)
+{
+    return initFromDirectBuffer<__int64>(env, byteBuffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    iInitFromBuffer
+ * Signature:(Ljava/nio/ByteBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_iInitFromBuffer(JNIEnv * env, jobject thisobj,
+                                                                                                                    jobject byteBuffer,
+                                                                                                                    jlong nColumns, jlong nRows,
+                                                                                                                    jint featuresEqual)
+{
+    return initFromDirectBuffer<int>(env, byteBuffer, nColumns, nRows, featuresEqual);
+}
+
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    getDoubleBuffer
@@ -182,7 +300,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    releaseFloatBlockBuffer
- * Signature:(JJJLjava/nio/ByteBuffer;)V
+ * Signature:(JJJLjava/nio/Buffer;)V
  */
 JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseFloatBlockBuffer(
     JNIEnv * env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject byteBuffer)
@@ -196,9 +314,13 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     float * data      = block.getBlockPtr();
     const float * src = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for (size_t i = 0; i < vectorNum * nCols; i++)
+    /* the rows of the table over the adopted buffer are released in place */
+    if (data != src)
     {
-        data[i] = src[i];
+        for (size_t i = 0; i < vectorNum * nCols; i++)
+        {
+            data[i] = src[i];
+        }
     }
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
@@ -207,7 +329,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    releaseDoubleBlockBuffer
- * Signature:(JJJLjava/nio/ByteBuffer;)V
+ * Signature:(JJJLjava/nio/Buffer;)V
  */
 JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseDoubleBlockBuffer(
     JNIEnv * env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject byteBuffer)
@@ -221,9 +343,13 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     double * data      = block.getBlockPtr();
     const double * src = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for (size_t i = 0; i < vectorNum * nCols; i++)
+    /* the rows of the table over the adopted buffer are released in place */
+    if (data != src)
     {
-        data[i] = src[i];
+        for (size_t i = 0; i < vectorNum * nCols; i++)
+        {
+            data[i] = src[i];
+        }
     }
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
@@ -232,7 +358,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    releaseIntBlockBuffer
- * Signature:(JJJLjava/nio/ByteBuffer;)V
+ * Signature:(JJJLjava/nio/Buffer;)V
  */
 JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseIntBlockBuffer(
     JNIEnv * env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject byteBuffer)
@@ -246,9 +372,13 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     int * data      = block.getBlockPtr();
     const int * src = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for (size_t i = 0; i < vectorNum * nCols; i++)
+    /* the rows of the table over the adopted buffer are released in place */
+    if (data != src)
     {
-        data[i] = src[i];
+        for (size_t i = 0; i < vectorNum * nCols; i++)
+        {
+            data[i] = src[i];
+        }
     }
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
@@ -44,6 +44,13 @@ int rankId, comm_size;
 const string datasetFileNames[] = { "./data/distributed/covcormoments_dense_1.csv", "./data/distributed/covcormoments_dense_2.csv",
                                     "./data/distributed/covcormoments_dense_3.csv", "./data/distributed/covcormoments_dense_4.csv" };
 
+void preparePacker(NumericTablePacker & packer, const covariance::PartialResultPtr & partialResult)
+{
+    packer.add(partialResult->get(covariance::nObservations));
+    packer.add(partialResult->get(covariance::crossProduct), packedFloat64, packedUpperTriangle);
+    packer.add(partialResult->get(covariance::sum));
+}
+
 int main(int argc, char * argv[])
 {
     checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
@@ -67,23 +74,24 @@ int main(int argc, char * argv[])
     /* Compute a variance-covariance matrix */
     localAlgorithm.compute();
 
-    /* Serialize partial results required by step 2 */
-    services::SharedPtr<byte> serializedData;
-    InputDataArchive dataArch;
-    localAlgorithm.getPartialResult()->serialize(dataArch);
-    size_t perNodeArchLength = dataArch.getSizeOfArchive();
+    /* Pack the values of partial results required by step 2 without metadata,
+       only the upper triangle of the symmetric cross-product matrix is packed */
+    NumericTablePacker localPacker;
+    preparePacker(localPacker, localAlgorithm.getPartialResult());
+    const size_t perNodePackedSize = localPacker.getPackedSize();
 
-    /* Serialized data is of equal size on each node if each node called compute() equal number of times */
+    /* Packed data is of equal size on each node */
+    services::SharedPtr<byte> serializedData;
     if (rankId == mpi_root)
     {
-        serializedData = services::SharedPtr<byte>(new byte[perNodeArchLength * nBlocks]);
+        serializedData = services::SharedPtr<byte>(new byte[perNodePackedSize * nBlocks]);
     }
 
-    byte * nodeResults = new byte[perNodeArchLength];
-    dataArch.copyArchiveToArray(nodeResults, perNodeArchLength);
+    byte * nodeResults = new byte[perNodePackedSize];
+    localPacker.pack(nodeResults, perNodePackedSize);
 
     /* Transfer partial results to step 2 on the root node */
-    MPI_Gather(nodeResults, perNodeArchLength, MPI_CHAR, serializedData.get(), perNodeArchLength, MPI_CHAR, mpi_root, MPI_COMM_WORLD);
+    MPI_Gather(nodeResults, perNodePackedSize, MPI_CHAR, serializedData.get(), perNodePackedSize, MPI_CHAR, mpi_root, MPI_COMM_WORLD);
 
     delete[] nodeResults;
 
@@ -94,12 +102,13 @@ int main(int argc, char * argv[])
 
         for (size_t i = 0; i < nBlocks; i++)
         {
-            /* Deserialize partial results from step 1 */
-            OutputDataArchive dataArch(serializedData.get() + perNodeArchLength * i, perNodeArchLength);
-
+            /* Allocate partial results of the same dimensions as the local ones and unpack the values from step 1 into them */
             covariance::PartialResultPtr dataForStep2FromStep1 = covariance::PartialResultPtr(new covariance::PartialResult());
+            dataForStep2FromStep1->allocate<double>(&localAlgorithm.input, &localAlgorithm.parameter, covariance::defaultDense);
 
-            dataForStep2FromStep1->deserialize(dataArch);
+            NumericTablePacker masterPacker;
+            preparePacker(masterPacker, dataForStep2FromStep1);
+            masterPacker.unpack(serializedData.get() + perNodePackedSize * i, perNodePackedSize);
 
             /* Set local partial results as input for the master-node algorithm */
             masterAlgorithm.input.add(covariance::partialResults, dataForStep2FromStep1);
@@ -59,6 +59,7 @@ NumericTablePtr loadData(int rankId)
 }
 
 NumericTablePtr init(int rankId, const NumericTablePtr & pData);
+void preparePacker(NumericTablePacker & packer, const kmeans::PartialResultPtr & partialResult);
 NumericTablePtr compute(int rankId, const NumericTablePtr & pData, const NumericTablePtr & initialCentroids);
 
 int main(int argc, char * argv[])
@@ -151,6 +152,15 @@ NumericTablePtr init(int rankId, const NumericTablePtr & pData)
     return NumericTablePtr();
 }
 
+void preparePacker(NumericTablePacker & packer, const kmeans::PartialResultPtr & partialResult)
+{
+    packer.add(partialResult->get(kmeans::nObservations), packedInt32);
+    packer.add(partialResult->get(kmeans::partialSums), packedFloat32);
+    packer.add(partialResult->get(kmeans::partialObjectiveFunction), packedFloat32);
+    packer.add(partialResult->get(kmeans::partialCandidatesDistances), packedFloat32);
+    packer.add(partialResult->get(kmeans::partialCandidatesCentroids), packedFloat32);
+}
+
 NumericTablePtr compute(int rankId, const NumericTablePtr & pData, const NumericTablePtr & initialCentroids)
 {
     const bool isRoot          = (rankId == mpi_root);
@@ -188,20 +198,21 @@ NumericTablePtr compute(int rankId, const NumericTablePtr & pData, const Numeric
     /* Compute k-means */
     localAlgorithm.compute();
 
-    /* Serialize partial results required by step 2 */
-    InputDataArchive dataArch;
-    localAlgorithm.getPartialResult()->serialize(dataArch);
-    size_t perNodeArchLength = dataArch.getSizeOfArchive();
+    /* Pack the values of partial results required by step 2 without metadata,
+       the counts of observations are packed as integers */
+    NumericTablePacker localPacker;
+    preparePacker(localPacker, localAlgorithm.getPartialResult());
+    const size_t perNodePackedSize = localPacker.getPackedSize();
     ByteBuffer serializedData;
 
-    /* Serialized data is of equal size on each node if each node called compute() equal number of times */
-    if (isRoot) serializedData.resize(perNodeArchLength * nBlocks);
+    /* Packed data is of equal size on each node */
+    if (isRoot) serializedData.resize(perNodePackedSize * nBlocks);
 
-    ByteBuffer nodeResults(perNodeArchLength);
-    dataArch.copyArchiveToArray(&nodeResults[0], perNodeArchLength);
+    ByteBuffer nodeResults(perNodePackedSize);
+    localPacker.pack(&nodeResults[0], perNodePackedSize);
 
     /* Transfer partial results to step 2 on the root node */
-    MPI_Gather(&nodeResults[0], perNodeArchLength, MPI_CHAR, serializedData.size() ? &serializedData[0] : NULL, perNodeArchLength, MPI_CHAR, mpi_root,
+    MPI_Gather(&nodeResults[0], perNodePackedSize, MPI_CHAR, serializedData.size() ? &serializedData[0] : NULL, perNodePackedSize, MPI_CHAR, mpi_root,
                MPI_COMM_WORLD);
 
     if (isRoot)
@@ -211,11 +222,13 @@ NumericTablePtr compute(int rankId, const NumericTablePtr & pData, const Numeric
 
         for (size_t i = 0; i < nBlocks; i++)
         {
-            /* Deserialize partial results from step 1 */
-            OutputDataArchive dataArch(&serializedData[perNodeArchLength * i], perNodeArchLength);
-
+            /* Allocate partial results of the same dimensions as the local ones and unpack the values from step 1 into them */
             kmeans::PartialResultPtr dataForStep2FromStep1(new kmeans::PartialResult());
-            dataForStep2FromStep1->deserialize(dataArch);
+            dataForStep2FromStep1->allocate<algorithmFPType>(&localAlgorithm.input, &localAlgorithm.parameter(), kmeans::lloydDense);
+
+            NumericTablePacker masterPacker;
+            preparePacker(masterPacker, dataForStep2FromStep1);
+            masterPacker.unpack(&serializedData[perNodePackedSize * i], perNodePackedSize);
 
             /* Set local partial results as input for the master-node algorithm */
             masterAlgorithm.input.add(kmeans::partialResults, dataForStep2FromStep1);